@@ -0,0 +1,204 @@
+import {ArrayBlob} from './Blobs';
+import * as Encoder from './Encoder';
+import {ReducedImage} from './Images';
+
+// 差分フレームアニメーション (数値は全てリトルエンディアン)
+// 入力はフレームを縦に並べた画像。最初のフレームをキーフレームとして全体を、
+// 以降は前のフレームから変化した範囲の矩形だけを格納する。
+// ヘッダ (12 バイト):
+//   [0..3]   マジック "RDAN"
+//   [4]      バージョン
+//   [5]      プレーン数
+//   [6..7]   フレーム数
+//   [8..9]   幅
+//   [10..11] 高さ
+// フレームテーブル (フレームあたり 16 バイト):
+//   [0..1]   矩形の X 座標
+//   [2..3]   矩形の Y 座標
+//   [4..5]   矩形の幅 (変化が無い場合は 0)
+//   [6..7]   矩形の高さ (変化が無い場合は 0)
+//   [8..11]  データのオフセット (アニメーション先頭から)
+//   [12..15] プレーンあたりのデータサイズ
+// データは矩形ごとにプレーンの順に連結する。
+// 矩形の境界はフラグメント単位に揃える。
+
+export const MAGIC = 'RDAN';
+export const VERSION = 1;
+export const HEADER_SIZE = 12;
+export const FRAME_ENTRY_SIZE = 16;
+
+export class AnimArgs {
+  public name: string = 'anim';
+  // エンコード設定 (src はフレームを縦に並べた画像)
+  public encode: Encoder.EncodeArgs|null = null;
+  public numFrames: number = 1;
+}
+
+class Rect {
+  constructor(
+      public x: number, public y: number, public width: number,
+      public height: number) {}
+}
+
+export function build(args: AnimArgs): ArrayBlob {
+  const enc = args.encode as Encoder.EncodeArgs;
+  const src = enc.src as ReducedImage;
+  const numFrames = args.numFrames;
+  if (src.height % numFrames != 0) {
+    throw new Error('画像の高さがフレーム数で割り切れません。');
+  }
+  const width = src.width;
+  const height = src.height / numFrames;
+  if (numFrames > 0xffff || width > 0xffff || height > 0xffff) {
+    throw new Error('アニメーションに格納できないサイズです。');
+  }
+
+  // 矩形の境界をフラグメントに揃える
+  const firstOut = enc.planes[0].output;
+  const vertPack = enc.planes[0].vertPack;
+  const fragW = vertPack ? 1 : firstOut.pixelsPerFrag;
+  const fragH = vertPack ? firstOut.pixelsPerFrag : 1;
+
+  // 各フレームの矩形を求めてエンコードする
+  const rects: Rect[] = [];
+  const datas: Uint8Array[][] = [];
+  for (let f = 0; f < numFrames; f++) {
+    let rect: Rect|null;
+    if (f == 0) {
+      rect = new Rect(0, 0, width, height);
+    } else {
+      rect = diffRect(src, width, height, f - 1, f);
+      if (rect) rect = alignRect(rect, width, height, fragW, fragH);
+    }
+    if (!rect) {
+      rects.push(new Rect(0, 0, 0, 0));
+      datas.push([]);
+      continue;
+    }
+    rects.push(rect);
+    datas.push(encodeRect(enc, crop(src, rect, f * height)));
+  }
+
+  // 配置を決定
+  const numPlanes = enc.planes.length;
+  let offset = HEADER_SIZE + FRAME_ENTRY_SIZE * numFrames;
+  const offsets: number[] = [];
+  for (const planes of datas) {
+    offsets.push(offset);
+    for (const data of planes) offset += data.length;
+  }
+  const totalSize = offset;
+
+  const blob = new ArrayBlob(args.name, totalSize);
+  const a = blob.array;
+  const put16 = (pos: number, v: number) => {
+    a[pos] = v & 0xff;
+    a[pos + 1] = (v >> 8) & 0xff;
+  };
+  const put32 = (pos: number, v: number) => {
+    put16(pos, v & 0xffff);
+    put16(pos + 2, (v >>> 16) & 0xffff);
+  };
+
+  // ヘッダ
+  for (let i = 0; i < MAGIC.length; i++) {
+    a[i] = MAGIC.charCodeAt(i);
+  }
+  a[4] = VERSION;
+  a[5] = numPlanes;
+  put16(6, numFrames);
+  put16(8, width);
+  put16(10, height);
+
+  // フレームテーブルとデータ
+  let numChanged = 0;
+  let changedPixels = 0;
+  for (let f = 0; f < numFrames; f++) {
+    const r = rects[f];
+    const entry = HEADER_SIZE + FRAME_ENTRY_SIZE * f;
+    put16(entry + 0, r.x);
+    put16(entry + 2, r.y);
+    put16(entry + 4, r.width);
+    put16(entry + 6, r.height);
+    put32(entry + 8, offsets[f]);
+    put32(entry + 12, datas[f].length > 0 ? datas[f][0].length : 0);
+    let pos = offsets[f];
+    for (const data of datas[f]) {
+      a.set(data, pos);
+      pos += data.length;
+    }
+    if (f > 0 && r.width > 0) {
+      numChanged++;
+      changedPixels += r.width * r.height;
+    }
+  }
+
+  const fullSize = datas[0].reduce((sum, d) => sum + d.length, 0) * numFrames;
+  const ratio = (fullSize / totalSize).toFixed(2);
+  const meanPixels =
+      numFrames > 1 ? Math.round(changedPixels / (numFrames - 1)) : 0;
+  blob.comment = `${width}x${height}px, ${src.format.toString()}\n` +
+      `Delta animation, ${numFrames} frames, ${numChanged} changed, ` +
+      `${meanPixels} px per delta (mean)\n` +
+      `${totalSize} Bytes (x${ratio} vs full frames)\n`;
+  return blob;
+}
+
+// 2 つのフレームの差分を含む最小の矩形。差分が無い場合は null
+function diffRect(
+    src: ReducedImage, width: number, height: number, prev: number,
+    curr: number): Rect|null {
+  let left = width, right = -1, top = height, bottom = -1;
+  const prevBase = prev * width * height;
+  const currBase = curr * width * height;
+  for (let y = 0; y < height; y++) {
+    for (let x = 0; x < width; x++) {
+      const i = y * width + x;
+      let changed = false;
+      for (const ch of src.data) {
+        if (ch[prevBase + i] != ch[currBase + i]) {
+          changed = true;
+          break;
+        }
+      }
+      if (changed) {
+        if (x < left) left = x;
+        if (x > right) right = x;
+        if (y < top) top = y;
+        if (y > bottom) bottom = y;
+      }
+    }
+  }
+  if (right < 0) return null;
+  return new Rect(left, top, right - left + 1, bottom - top + 1);
+}
+
+function alignRect(
+    r: Rect, width: number, height: number, fragW: number,
+    fragH: number): Rect {
+  const x0 = Math.floor(r.x / fragW) * fragW;
+  const y0 = Math.floor(r.y / fragH) * fragH;
+  const x1 = Math.min(width, Math.ceil((r.x + r.width) / fragW) * fragW);
+  const y1 = Math.min(height, Math.ceil((r.y + r.height) / fragH) * fragH);
+  return new Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+function crop(src: ReducedImage, r: Rect, offsetY: number): ReducedImage {
+  const img = new ReducedImage(r.width, r.height, src.format, src.palette);
+  for (let ch = 0; ch < src.data.length; ch++) {
+    for (let y = 0; y < r.height; y++) {
+      const start = (offsetY + r.y + y) * src.width + r.x;
+      img.data[ch].set(
+          src.data[ch].subarray(start, start + r.width), y * r.width);
+    }
+  }
+  return img;
+}
+
+// テンプレートと同じ設定で矩形をエンコードし、プレーンごとのデータを返す
+function encodeRect(tmpl: Encoder.EncodeArgs, img: ReducedImage):
+    Uint8Array[] {
+  const args = Encoder.cloneArgs(tmpl, img);
+  Encoder.encode(args);
+  return args.planes.map(p => (p.output.blob as ArrayBlob).array);
+}
@@ -1,5 +1,9 @@
 import {ArrayBlob} from './Blobs';
+import * as Animation from './Animation';
+import * as Compression from './Compression';
+import * as Container from './Container';
 import * as Debug from './Debug';
+import * as Encoder from './Encoder';
 import {PixelFormat, PixelFormatInfo, ReducedImage} from './Images';
 
 export const enum CodeFormat {
@@ -31,6 +35,26 @@ export class CodeGenArgs {
   public src: ReducedImage|null = null;
   public blobs: ArrayBlob[] = [];
   public format: CodeFormat = CodeFormat.C_ARRAY;
+  public compression: Compression.Method = Compression.Method.NONE;
+  public lzWindowBits: number = Compression.LZ77_DEFAULT_WINDOW_BITS;
+  public palette: Uint32Array|null = null;
+  // RGB565 の値からパレットのインデックスを引く LUT (1 要素 1 バイト)
+  public paletteLut: Uint8Array|null = null;
+  // タイルマップ形式の場合のマップ (blobs はタイルバンク)
+  public tileMap: ArrayBlob|null = null;
+  // 2 以上の場合は縦に並んだフレームを差分アニメーションにする
+  public animFrames: number = 1;
+  public container: boolean = false;
+  // rawdisp::AssetDesc を出力する (C 配列のファイル全体のみ)
+  public descriptor: boolean = false;
+  // コンテナ形式の場合に参照する
+  public encode: Encoder.EncodeArgs|null = null;
+  // 配列の先頭アドレスの境界 (バイト、2 の冪)。1 の場合は指定しない
+  public alignment: number = 1;
+  // 配列を置くセクション名。空の場合は指定しない
+  public section: string = '';
+  // 配列の長さを alignment の倍数に揃える (DMA などの転送単位)
+  public padding: boolean = false;
   public codeUnit: CodeUnit = CodeUnit.FILE;
   public indent: Indent = Indent.SPACE_X2;
   public arrayCols: number = 16;
@@ -80,79 +104,209 @@ export class StringBuilder {
 }
 
 export function generate(args: CodeGenArgs): void {
+  if (args.alignment < 1 || (args.alignment & (args.alignment - 1)) != 0) {
+    throw new Error('アライメントは 2 の冪を指定してください。');
+  }
+  if (args.section && !/^[.\w$]+$/.test(args.section)) {
+    throw new Error('セクション名に使用できない文字が含まれています。');
+  }
+
+  // タイルマップはランダムアクセスし、アニメーションは矩形ごとに
+  // そのまま転送するので、圧縮とコンテナは使わない
+  const tiled = !!args.tileMap;
+  const animated = args.animFrames > 1;
+  if (tiled || animated) {
+    // 記述子も圧縮なしとして出力する
+    args.compression = Compression.Method.NONE;
+  }
+  if (animated) {
+    const animArgs = new Animation.AnimArgs();
+    animArgs.name = args.name;
+    animArgs.encode = args.encode;
+    animArgs.numFrames = args.animFrames;
+    args.blobs = [Animation.build(animArgs)];
+  } else if (args.compression != Compression.Method.NONE) {
+    args.blobs = args.blobs.map(
+        blob => compressBlob(blob, args.compression, args.lzWindowBits));
+  }
+
+  let paletteBlob: ArrayBlob|null = null;
+  if (!tiled && !animated && args.container) {
+    // 全プレーンとパレットを 1 つのコンテナにまとめる
+    const packArgs = new Container.PackArgs();
+    packArgs.name = args.name;
+    packArgs.encode = args.encode;
+    packArgs.blobs = args.blobs;
+    packArgs.compression = args.compression;
+    packArgs.palette = args.palette;
+    args.blobs = [Container.pack(packArgs)];
+  } else if (args.palette) {
+    // パレットは圧縮せず最後に置く
+    paletteBlob = makePaletteBlob(args.palette);
+  }
+
+  let extraBlobs: ArrayBlob[] = [];
+  if (args.tileMap) extraBlobs.push(args.tileMap);
+  if (paletteBlob) extraBlobs.push(paletteBlob);
+  if (args.paletteLut) {
+    extraBlobs.push(makePaletteLutBlob(args.paletteLut));
+  }
+
   switch (args.format) {
     case CodeFormat.C_ARRAY:
-      generateCArray(args);
+      generateCArray(args, extraBlobs);
       break;
     case CodeFormat.RAW_BINARY:
-      generateRawBinary(args);
+      generateRawBinary(args, extraBlobs);
       break;
     default:
       throw new Error('Unknown code format');
   }
 }
 
-function generateCArray(args: CodeGenArgs): void {
-  const sw = new Debug.StopWatch(false);
+function compressBlob(
+    blob: ArrayBlob, method: Compression.Method,
+    lzWindowBits: number): ArrayBlob {
+  const array = Compression.compress(method, blob.array, lzWindowBits);
+  const ret = new ArrayBlob(blob.name, array.length);
+  ret.array = array;
+  const ratio = (blob.array.length / array.length).toFixed(2);
+  ret.comment = blob.comment.trimEnd() + '\n' +
+      `${Compression.methodName(method)} compressed` +
+      (method == Compression.Method.LZ77 ?
+           ` (window ${1 << lzWindowBits} Bytes)` :
+           '') +
+      ', ' +
+      `${array.length} Bytes (x${ratio})\n`;
+  return ret;
+}
+
+// パレットを RGB888 (R, G, B の順に 3 バイトずつ) の配列にする
+function makePaletteBlob(palette: Uint32Array): ArrayBlob {
+  const blob = new ArrayBlob('palette', palette.length * 3);
+  for (let i = 0; i < palette.length; i++) {
+    blob.array[i * 3 + 0] = palette[i] & 0xff;
+    blob.array[i * 3 + 1] = (palette[i] >> 8) & 0xff;
+    blob.array[i * 3 + 2] = (palette[i] >> 16) & 0xff;
+  }
+  blob.comment = `Palette, ${palette.length} colors, RGB888\n` +
+      `${blob.array.length} Bytes\n`;
+  return blob;
+}
+
+// LUT を rawdisp::Rgb565PaletteLut の形式にする。16 色以下なら 1 バイトに
+// 2 要素 (先の要素が上位ニブル)、それ以外は 1 バイトに 1 要素
+function makePaletteLutBlob(lut: Uint8Array): ArrayBlob {
+  const entryBits = lut.every(i => i < 16) ? 4 : 8;
+  const blob = new ArrayBlob('palette_lut', lut.length * entryBits / 8);
+  if (entryBits == 4) {
+    for (let i = 0; i < blob.array.length; i++) {
+      blob.array[i] = (lut[i * 2] << 4) | lut[i * 2 + 1];
+    }
+  } else {
+    blob.array.set(lut);
+  }
+  blob.comment = `RGB565 to palette index LUT, 32x64x32, ` +
+      `${entryBits} bits per entry\n` +
+      `rawdisp::Rgb565PaletteLut<${entryBits}>, ` +
+      `${blob.array.length} Bytes\n`;
+  return blob;
+}
 
-  // インデント決定
-  let indent = '  ';
-  switch (args.indent) {
+function indentString(indent: Indent): string {
+  switch (indent) {
     case Indent.SPACE_X2:
-      indent = '  ';
-      break;
+      return '  ';
     case Indent.SPACE_X4:
-      indent = '    ';
-      break;
+      return '    ';
     case Indent.TAB:
-      indent = '\t';
-      break;
+      return '\t';
     default:
       throw new Error('Unknown indent type');
   }
+}
+
+// パディング後の配列の長さ
+function paddedLength(args: CodeGenArgs, length: number): number {
+  if (!args.padding) return length;
+  return Math.ceil(length / args.alignment) * args.alignment;
+}
+
+// 配列に付ける GCC/Clang の属性
+function arrayAttributes(args: CodeGenArgs): string {
+  const attrs: string[] = [];
+  if (args.alignment > 1) attrs.push(`aligned(${args.alignment})`);
+  if (args.section) attrs.push(`section("${args.section}")`);
+  if (attrs.length == 0) return '';
+  return ` __attribute__((${attrs.join(', ')}))`;
+}
+
+// extraBlobs はマップやパレットなど、プレーン以外の配列
+function generateCArray(args: CodeGenArgs, extraBlobs: ArrayBlob[]): void {
+  const sw = new Debug.StopWatch(false);
+
+  const indent = indentString(args.indent);
 
   let hexTable: string[] = [];
   for (let i = 0; i < 256; i++) {
     hexTable.push(`0x${i.toString(16).padStart(2, '0')},`);
   }
 
+  const blobs = args.blobs.concat(extraBlobs);
+
   let buffLen = 100;
-  for (let blob of args.blobs) {
-    const len = blob.array.length;
+  for (let blob of blobs) {
+    const len = paddedLength(args, blob.array.length);
     buffLen += 10 + len * 2 + Math.ceil(len / args.arrayCols) * 2;
   }
+  const withDesc = args.descriptor && (!args.container || !!args.tileMap) &&
+      args.animFrames <= 1 && !!args.encode && args.codeUnit >= CodeUnit.FILE;
+  if (withDesc) buffLen += 50 + 40 * args.blobs.length;
+
   const buff = new StringBuilder(buffLen);
 
   if (args.codeUnit >= CodeUnit.FILE) {
     buff.push(`#pragma once\n`);
     buff.push(`\n`);
     buff.push(`#include <stdint.h>\n`);
+    if (withDesc) {
+      buff.push(`\n`);
+      buff.push(`#include "rawdisp/asset_desc.hpp"\n`);
+    }
     buff.push(`\n`);
   }
 
-  for (let iBlob = 0; iBlob < args.blobs.length; iBlob++) {
-    const blob = args.blobs[iBlob];
+  const arrayNames: string[] = [];
+  const attrs = arrayAttributes(args);
+
+  for (let iBlob = 0; iBlob < blobs.length; iBlob++) {
+    const blob = blobs[iBlob];
     const array = blob.array;
+    const length = paddedLength(args, array.length);
 
     let arrayName: string;
-    if (args.blobs.length <= 1) {
-      arrayName = args.name;
-    } else {
+    if (extraBlobs.indexOf(blob) >= 0 || args.blobs.length > 1) {
       arrayName = args.name + '_' + blob.name;
+    } else {
+      arrayName = args.name;
     }
+    arrayNames.push(arrayName);
 
     if (args.codeUnit >= CodeUnit.ARRAY_DEF) {
       const lines = blob.comment.trimEnd().split('\n');
+      if (length > array.length) {
+        lines.push(`Padded to ${length} Bytes`);
+      }
       for (let line of lines) {
         buff.push(`// ${line}\n`);
       }
-      buff.push(`const uint8_t ${arrayName}[] = {\n`);
+      buff.push(`const uint8_t ${arrayName}[]${attrs} = {\n`);
     }
 
-    for (let i = 0; i < array.length; i++) {
+    for (let i = 0; i < length; i++) {
       if (i % args.arrayCols == 0) buff.push(indent);
-      buff.push(hexTable[array[i]]);
-      if ((i + 1) % args.arrayCols == 0 || i + 1 == array.length) {
+      buff.push(hexTable[i < array.length ? array[i] : 0]);
+      if ((i + 1) % args.arrayCols == 0 || i + 1 == length) {
         buff.push('\n');
       } else {
         buff.push(' ');
@@ -163,7 +317,12 @@ function generateCArray(args: CodeGenArgs): void {
       buff.push('};\n');
     }
 
-    const lastBlob = (iBlob + 1 >= args.blobs.length);
+    const lastBlob = (iBlob + 1 >= blobs.length);
+    if (withDesc && lastBlob) {
+      buff.push('\n');
+      const hasPalette = extraBlobs.some(b => b.name == 'palette');
+      generateDescriptor(args, arrayNames, hasPalette, indent, buff);
+    }
     if (args.codeUnit < CodeUnit.FILE || lastBlob) {
       const code = new Code();
 
@@ -183,7 +342,88 @@ function generateCArray(args: CodeGenArgs): void {
   sw.lap('CodeGen.generate()');
 }
 
-function generateRawBinary(args: CodeGenArgs): void {
+const ASSET_FORMAT_NAMES = [
+  'RGBA8888', 'RGB888', 'RGB666', 'RGB565', 'RGB444', 'RGB332', 'RGB111',
+  'GRAY4', 'GRAY2', 'BW', 'I2_RGB888', 'I4_RGB888', 'I6_RGB888'
+];
+const COMPRESSION_NAMES = ['NONE', 'RLE', 'LZ77'];
+const PLANE_TYPE_NAMES = ['DIRECT', 'INDEX_MATCH'];
+const PACK_UNIT_NAMES = ['UNPACKED', 'PIXEL', 'ALIGNMENT'];
+
+// 配列の後ろに constexpr の rawdisp::AssetDesc を出力する
+function generateDescriptor(
+    args: CodeGenArgs, arrayNames: string[], hasPalette: boolean,
+    indent: string, buff: StringBuilder): void {
+  const enc = args.encode as Encoder.EncodeArgs;
+  const src = enc.src as ReducedImage;
+  if (enc.planes.length > 4) {
+    throw new Error('記述子に格納できるプレーンは 4 つまでです。');
+  }
+  const ns = 'rawdisp::';
+  const i1 = indent, i2 = indent.repeat(2), i3 = indent.repeat(3),
+        i4 = indent.repeat(4);
+
+  buff.push(`constexpr ${ns}AssetDesc ${args.name}_desc = {\n`);
+  buff.push(`${i1}.width = ${src.width},\n`);
+  buff.push(`${i1}.height = ${src.height},\n`);
+  buff.push(`${i1}.format = ${ns}AssetFormat::${
+      ASSET_FORMAT_NAMES[src.format.id]},\n`);
+  buff.push(`${i1}.numPlanes = ${enc.planes.length},\n`);
+  buff.push(`${i1}.planes = {\n`);
+  for (let i = 0; i < enc.planes.length; i++) {
+    const plane = enc.planes[i];
+    const out = plane.output;
+    const arrayName = arrayNames[i];
+
+    // フラグメントの行 (vertAddr の場合は列) の間隔
+    const fragW = plane.vertPack ? 1 : out.pixelsPerFrag;
+    const fragH = plane.vertPack ? out.pixelsPerFrag : 1;
+    const stride = plane.vertAddr ?
+        Math.ceil(src.height / fragH) * out.bytesPerFrag :
+        Math.ceil(src.width / fragW) * out.bytesPerFrag;
+
+    const flags = Container.planeFlags(enc, plane);
+    buff.push(`${i2}{\n`);
+    buff.push(`${i3}.id = "${plane.id}",\n`);
+    buff.push(`${i3}.data = ${arrayName},\n`);
+    // パディングした場合は元の長さ
+    const size = args.blobs[i].array.length;
+    if (paddedLength(args, size) > size) {
+      buff.push(`${i3}.size = ${size},\n`);
+    } else {
+      buff.push(`${i3}.size = sizeof(${arrayName}),\n`);
+    }
+    buff.push(`${i3}.compression = ${ns}Compression::${
+        COMPRESSION_NAMES[args.compression]},\n`);
+    buff.push(`${i3}.layout = {\n`);
+    buff.push(`${i4}.type = ${ns}PlaneType::${
+        PLANE_TYPE_NAMES[plane.type]},\n`);
+    buff.push(`${i4}.matchIndex = ${plane.indexMatchValue},\n`);
+    buff.push(`${i4}.flags = 0x${
+        flags.toString(16).padStart(2, '0')},\n`);
+    buff.push(`${i4}.packUnit = ${ns}PackUnit::${
+        PACK_UNIT_NAMES[plane.packUnit]},\n`);
+    buff.push(`${i4}.pixelStride = ${out.pixelStride},\n`);
+    buff.push(`${i4}.pixelsPerFrag = ${out.pixelsPerFrag},\n`);
+    buff.push(`${i4}.bytesPerFrag = ${out.bytesPerFrag},\n`);
+    buff.push(`${i3}},\n`);
+    buff.push(`${i3}.stride = ${stride},\n`);
+    buff.push(`${i2}},\n`);
+  }
+  buff.push(`${i1}},\n`);
+  if (hasPalette) {
+    const palette = args.palette as Uint32Array;
+    buff.push(`${i1}.palette = ${args.name}_palette,\n`);
+    buff.push(`${i1}.paletteColors = ${palette.length},\n`);
+  } else {
+    buff.push(`${i1}.palette = nullptr,\n`);
+    buff.push(`${i1}.paletteColors = 0,\n`);
+  }
+  buff.push(`};\n`);
+}
+
+function generateRawBinary(args: CodeGenArgs, extraBlobs: ArrayBlob[]):
+    void {
   let buff = new Uint8Array(0);
 
   let hexTable: string[] = [];
@@ -195,40 +435,92 @@ function generateRawBinary(args: CodeGenArgs): void {
     const blob = args.blobs[iBlob];
     const array = blob.array;
 
-    // buff に blob.array を連結する
-    const newBuff = new Uint8Array(buff.length + array.length);
+    // buff に blob.array を連結する (パディングは 0 で埋まる)
+    const newBuff =
+        new Uint8Array(buff.length + paddedLength(args, array.length));
     newBuff.set(buff, 0);
     newBuff.set(array, buff.length);
     buff = newBuff;
 
     const lastBlob = (iBlob + 1 >= args.blobs.length);
     if (args.codeUnit < CodeUnit.FILE || lastBlob) {
-      const code = new Code();
-
+      let name: string;
       if (args.codeUnit >= CodeUnit.FILE) {
-        code.name = args.name + '.bin';
+        name = args.name + '.bin';
       } else {
-        code.name = args.name + '_' + blob.name + '.bin';
-      }
-
-      const len = buff.length;
-      const sbLen = 100 + len * 2 + Math.ceil(len / args.arrayCols) * 2;
-      const sb = new StringBuilder(sbLen);
-      for (let i = 0; i < buff.length; i++) {
-        sb.push(hexTable[buff[i]]);
-        if (i + 1 < buff.length) {
-          if ((i + 1) % args.arrayCols == 0) {
-            sb.push('\n');
-          } else {
-            sb.push(' ');
-          }
-        }
+        name = args.name + '_' + blob.name + '.bin';
       }
-      code.code = sb.join('');
-      code.numLines = sb.numLines();
-      args.codes.push(code);
+      args.codes.push(makeBinaryCode(name, buff, hexTable, args.arrayCols));
 
       if (!lastBlob) buff = new Uint8Array(0);
     }
   }
+
+  // マップとパレットは常に別ファイルにする
+  for (const blob of extraBlobs) {
+    const array = new Uint8Array(paddedLength(args, blob.array.length));
+    array.set(blob.array);
+    args.codes.push(makeBinaryCode(
+        args.name + '_' + blob.name + '.bin', array, hexTable,
+        args.arrayCols));
+  }
+}
+
+function makeBinaryCode(
+    name: string, buff: Uint8Array, hexTable: string[],
+    arrayCols: number): Code {
+  const code = new Code();
+  code.name = name;
+
+  const len = buff.length;
+  const sbLen = 100 + len * 2 + Math.ceil(len / arrayCols) * 2;
+  const sb = new StringBuilder(sbLen);
+  for (let i = 0; i < buff.length; i++) {
+    sb.push(hexTable[buff[i]]);
+    if (i + 1 < buff.length) {
+      if ((i + 1) % arrayCols == 0) {
+        sb.push('\n');
+      } else {
+        sb.push(' ');
+      }
+    }
+  }
+  code.code = sb.join('');
+  code.numLines = sb.numLines();
+  return code;
+}
+
+// 複数解像度で生成した各レベルの記述子を rawdisp::AssetSet にまとめる。
+// levels は生成済みの各レベルの引数 (ファイル全体、記述子あり)
+export function generateAssetSet(
+    name: string, levels: CodeGenArgs[], indent: Indent): Code {
+  const i1 = indentString(indent), i2 = i1.repeat(2);
+  const buff = new StringBuilder(200 + 60 * levels.length);
+  buff.push(`#pragma once\n`);
+  buff.push(`\n`);
+  buff.push(`#include "rawdisp/asset_set.hpp"\n`);
+  buff.push(`\n`);
+  for (const level of levels) {
+    buff.push(`#include "${level.name}.h"\n`);
+  }
+  buff.push(`\n`);
+  const sizes = levels.map(l => {
+    const src = l.src as ReducedImage;
+    return `${src.width}x${src.height}`;
+  });
+  buff.push(`// ${levels.length} levels: ${sizes.join(', ')}\n`);
+  buff.push(`constexpr rawdisp::AssetSet ${name}_set = {\n`);
+  buff.push(`${i1}.numLevels = ${levels.length},\n`);
+  buff.push(`${i1}.levels = {\n`);
+  for (const level of levels) {
+    buff.push(`${i2}&${level.name}_desc,\n`);
+  }
+  buff.push(`${i1}},\n`);
+  buff.push(`};\n`);
+
+  const code = new Code();
+  code.name = name + '_set.h';
+  code.code = buff.join('');
+  code.numLines = buff.numLines();
+  return code;
 }
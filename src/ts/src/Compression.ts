@@ -0,0 +1,204 @@
+// 圧縮形式
+// ヘッダ (6 バイト):
+//   [0]    圧縮方式 (Method)
+//   [1]    方式ごとのパラメータ (LZ77: 窓サイズのビット数)
+//   [2..5] 展開後のサイズ (リトルエンディアン)
+
+export const enum Method {
+  NONE = 0,
+  RLE = 1,
+  LZ77 = 2,
+}
+
+export const HEADER_SIZE = 6;
+
+// RLE の制御バイト:
+//   0xxxxxxx: 続く (x + 1) バイトをそのまま出力 (1～128)
+//   1xxxxxxx: 続く 1 バイトを (x + 3) 回繰り返す (3～130)
+const RLE_MIN_RUN = 3;
+const RLE_MAX_RUN = 0x7f + RLE_MIN_RUN;
+const RLE_MAX_LITERAL = 0x80;
+
+// LZ77 のトークン:
+//   フラグバイト 1 つが続く 8 トークンの種類を LSB から表す
+//   0: リテラル 1 バイト
+//   1: 16bit リトルエンディアンの一致情報
+//      下位 windowBits ビットが (距離 - 1)、上位ビットが (長さ - 3)
+export const LZ77_MIN_WINDOW_BITS = 8;
+export const LZ77_MAX_WINDOW_BITS = 12;
+export const LZ77_DEFAULT_WINDOW_BITS = 10;
+const LZ77_MIN_MATCH = 3;
+const LZ77_HASH_BITS = 15;
+const LZ77_MAX_CHAIN = 256;
+
+class ByteWriter {
+  buff: Uint8Array;
+  length: number = 0;
+
+  constructor(capacity: number) {
+    this.buff = new Uint8Array(Math.max(16, capacity));
+  }
+
+  push(b: number): void {
+    if (this.length >= this.buff.length) {
+      const newBuff = new Uint8Array(this.buff.length * 2);
+      newBuff.set(this.buff, 0);
+      this.buff = newBuff;
+    }
+    this.buff[this.length++] = b;
+  }
+
+  toArray(): Uint8Array {
+    return this.buff.slice(0, this.length);
+  }
+}
+
+function writeHeader(
+    out: ByteWriter, method: Method, param: number, size: number): void {
+  out.push(method);
+  out.push(param);
+  for (let i = 0; i < 4; i++) {
+    out.push((size >>> (i * 8)) & 0xff);
+  }
+}
+
+export function methodName(method: Method): string {
+  switch (method) {
+    case Method.NONE:
+      return 'None';
+    case Method.RLE:
+      return 'RLE';
+    case Method.LZ77:
+      return 'LZ77';
+    default:
+      throw new Error('Unknown compression method');
+  }
+}
+
+export function compress(
+    method: Method, data: Uint8Array,
+    lzWindowBits: number = LZ77_DEFAULT_WINDOW_BITS): Uint8Array {
+  switch (method) {
+    case Method.NONE:
+      return data;
+    case Method.RLE:
+      return encodeRle(data);
+    case Method.LZ77:
+      return encodeLz77(data, lzWindowBits);
+    default:
+      throw new Error('Unknown compression method');
+  }
+}
+
+export function encodeRle(data: Uint8Array): Uint8Array {
+  const out = new ByteWriter(HEADER_SIZE + data.length + data.length / 64);
+  writeHeader(out, Method.RLE, 0, data.length);
+
+  let litStart = 0;
+  let litLen = 0;
+  const flushLiteral = () => {
+    while (litLen > 0) {
+      const n = Math.min(litLen, RLE_MAX_LITERAL);
+      out.push(n - 1);
+      for (let i = 0; i < n; i++) {
+        out.push(data[litStart + i]);
+      }
+      litStart += n;
+      litLen -= n;
+    }
+  };
+
+  let i = 0;
+  while (i < data.length) {
+    let run = 1;
+    while (i + run < data.length && run < RLE_MAX_RUN &&
+           data[i + run] == data[i]) {
+      run++;
+    }
+    if (run >= RLE_MIN_RUN) {
+      flushLiteral();
+      out.push(0x80 | (run - RLE_MIN_RUN));
+      out.push(data[i]);
+      i += run;
+      litStart = i;
+    } else {
+      litLen++;
+      i++;
+    }
+  }
+  flushLiteral();
+  return out.toArray();
+}
+
+export function encodeLz77(data: Uint8Array, windowBits: number): Uint8Array {
+  if (windowBits < LZ77_MIN_WINDOW_BITS || LZ77_MAX_WINDOW_BITS < windowBits) {
+    throw new Error(`Invalid window size: ${windowBits} bits`);
+  }
+  const windowSize = 1 << windowBits;
+  const maxMatch = LZ77_MIN_MATCH + (1 << (16 - windowBits)) - 1;
+
+  const out = new ByteWriter(HEADER_SIZE + data.length + data.length / 8);
+  writeHeader(out, Method.LZ77, windowBits, data.length);
+
+  // 3 バイトのハッシュチェーンで一致を探す
+  const head = new Int32Array(1 << LZ77_HASH_BITS).fill(-1);
+  const prev = new Int32Array(data.length).fill(-1);
+  const hashAt = (i: number) => {
+    const v = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16);
+    return (Math.imul(v, 0x9e3779b1) >>> (32 - LZ77_HASH_BITS));
+  };
+  const insert = (i: number) => {
+    if (i + LZ77_MIN_MATCH > data.length) return;
+    const h = hashAt(i);
+    prev[i] = head[h];
+    head[h] = i;
+  };
+
+  let flagPos = -1;
+  let flagBit = 8;
+  const pushFlag = (isMatch: boolean) => {
+    if (flagBit >= 8) {
+      flagPos = out.length;
+      out.push(0);
+      flagBit = 0;
+    }
+    if (isMatch) out.buff[flagPos] |= (1 << flagBit);
+    flagBit++;
+  };
+
+  let i = 0;
+  while (i < data.length) {
+    let bestLen = 0;
+    let bestDist = 0;
+    if (i + LZ77_MIN_MATCH <= data.length) {
+      const maxLen = Math.min(maxMatch, data.length - i);
+      let cand = head[hashAt(i)];
+      let chain = LZ77_MAX_CHAIN;
+      while (cand >= 0 && i - cand <= windowSize && chain-- > 0) {
+        let len = 0;
+        while (len < maxLen && data[cand + len] == data[i + len]) len++;
+        if (len > bestLen) {
+          bestLen = len;
+          bestDist = i - cand;
+          if (len >= maxLen) break;
+        }
+        cand = prev[cand];
+      }
+    }
+
+    if (bestLen >= LZ77_MIN_MATCH) {
+      pushFlag(true);
+      const token = (bestDist - 1) | ((bestLen - LZ77_MIN_MATCH) << windowBits);
+      out.push(token & 0xff);
+      out.push((token >> 8) & 0xff);
+      for (let j = 0; j < bestLen; j++) insert(i + j);
+      i += bestLen;
+    } else {
+      pushFlag(false);
+      out.push(data[i]);
+      insert(i);
+      i++;
+    }
+  }
+  return out.toArray();
+}
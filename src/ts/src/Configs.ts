@@ -186,6 +186,24 @@ const epd_kwr = (function(): Config {
   return p;
 })();
 
+const epd_kwr_2bpp = (function(): Config {
+  let p = {...defaultConfig};
+  p.label = '黒白赤 (2bpp)';
+  p.description = '3色電子ペーパー向けの形式。白と赤のプレーンは転送時に生成する。';
+  p.format = Images.PixelFormat.I2_RGB888;
+  p.packUnit = Encoder.PackUnit.ALIGNMENT;
+  p.farPixelFirst = true;
+  p.palette = new Uint32Array([
+    Colors.strToU32('#000'),
+    Colors.strToU32('#FFF'),
+    Colors.strToU32('#C00'),
+  ]);
+  p.planeCfgs = [
+    makeDirectPlane('index'),
+  ];
+  return p;
+})();
+
 const epd_kwry = (function(): Config {
   let p = {...defaultConfig};
   p.label = '黒白赤黄 (2bpp)';
@@ -303,6 +321,7 @@ export const presets: Record<string, Config> = {
   bw_hscan,
   bw_vpack,
   epd_kwr,
+  epd_kwr_2bpp,
   epd_kwry,
   epd_kwyrbg,
   epd_kwgbryo,
@@ -0,0 +1,169 @@
+import {ArrayBlob} from './Blobs';
+import * as Compression from './Compression';
+import * as Encoder from './Encoder';
+import {ReducedImage} from './Images';
+
+// アセットコンテナ (数値は全てリトルエンディアン)
+// ヘッダ (24 バイト):
+//   [0..3]   マジック "RDAS"
+//   [4]      バージョン
+//   [5]      プレーン数
+//   [6]      ピクセルフォーマット (Images.PixelFormat)
+//   [7]      予約
+//   [8..9]   幅
+//   [10..11] 高さ
+//   [12..15] パレットのオフセット (パレットが無い場合は 0)
+//   [16..17] パレットの色数
+//   [18..19] 予約
+//   [20..23] コンテナ全体のサイズ
+// プレーンテーブル (プレーンあたり 24 バイト):
+//   [0..7]   ID (ASCII, 余りは 0 埋め)
+//   [8..11]  データのオフセット
+//   [12..15] データのサイズ
+//   [16]     プレーンの種類 (Encoder.PlaneType)
+//   [17]     一致させるインデックス
+//   [18]     フラグ (FLAG_*)
+//   [19]     圧縮方式 (Compression.Method)
+//   [20]     パッキング単位 (Encoder.PackUnit)
+//   [21]     ピクセルあたりのビット数 (パディング含む)
+//   [22]     フラグメントあたりのピクセル数
+//   [23]     フラグメントあたりのバイト数
+// データとパレット (RGB888) は 4 バイト境界に配置する。
+// オフセットはコンテナ先頭からのバイト数。
+
+export const MAGIC = 'RDAS';
+export const VERSION = 1;
+export const HEADER_SIZE = 24;
+export const PLANE_ENTRY_SIZE = 24;
+export const PLANE_ID_SIZE = 8;
+
+export const FLAG_FAR_PIXEL_FIRST = 0x01;
+export const FLAG_BIG_ENDIAN = 0x02;
+export const FLAG_VERT_PACK = 0x04;
+export const FLAG_VERT_ADDR = 0x08;
+export const FLAG_ALIGN_LEFT = 0x10;
+export const FLAG_COLOR_DESCENDING = 0x20;
+export const FLAG_ALPHA_FIRST = 0x40;
+export const FLAG_POST_INVERT = 0x80;
+
+const ALIGNMENT = 4;
+
+export class PackArgs {
+  public name: string = 'container';
+  public encode: Encoder.EncodeArgs|null = null;
+  // プレーンの順に並んだデータ (圧縮済みでもよい)
+  public blobs: ArrayBlob[] = [];
+  public compression: Compression.Method = Compression.Method.NONE;
+  public palette: Uint32Array|null = null;
+}
+
+function alignUp(n: number): number {
+  return Math.ceil(n / ALIGNMENT) * ALIGNMENT;
+}
+
+export function planeFlags(
+    enc: Encoder.EncodeArgs, plane: Encoder.PlaneArgs): number {
+  let flags = 0;
+  if (plane.farPixelFirst) flags |= FLAG_FAR_PIXEL_FIRST;
+  if (plane.bigEndian) flags |= FLAG_BIG_ENDIAN;
+  if (plane.vertPack) flags |= FLAG_VERT_PACK;
+  if (plane.vertAddr) flags |= FLAG_VERT_ADDR;
+  if (plane.alignLeft) flags |= FLAG_ALIGN_LEFT;
+  if (enc.colorDescending) flags |= FLAG_COLOR_DESCENDING;
+  if (enc.alphaFirst) flags |= FLAG_ALPHA_FIRST;
+  if (plane.postInvert) flags |= FLAG_POST_INVERT;
+  return flags;
+}
+
+export function pack(args: PackArgs): ArrayBlob {
+  const enc = args.encode as Encoder.EncodeArgs;
+  const src = enc.src as ReducedImage;
+  const numPlanes = enc.planes.length;
+  if (numPlanes != args.blobs.length) {
+    throw new Error('内部エラー: プレーン数とデータ数が一致しません。');
+  }
+  if (numPlanes > 255 || src.width > 0xffff || src.height > 0xffff) {
+    throw new Error('コンテナに格納できないサイズです。');
+  }
+
+  // 配置を決定
+  let offset = alignUp(HEADER_SIZE + PLANE_ENTRY_SIZE * numPlanes);
+  const dataOffsets: number[] = [];
+  for (const blob of args.blobs) {
+    dataOffsets.push(offset);
+    offset = alignUp(offset + blob.array.length);
+  }
+  let paletteOffset = 0;
+  let paletteColors = 0;
+  if (args.palette) {
+    paletteOffset = offset;
+    paletteColors = args.palette.length;
+    offset = alignUp(offset + paletteColors * 3);
+  }
+  const totalSize = offset;
+
+  const blob = new ArrayBlob(args.name, totalSize);
+  const a = blob.array;
+  const put16 = (pos: number, v: number) => {
+    a[pos] = v & 0xff;
+    a[pos + 1] = (v >> 8) & 0xff;
+  };
+  const put32 = (pos: number, v: number) => {
+    put16(pos, v & 0xffff);
+    put16(pos + 2, (v >>> 16) & 0xffff);
+  };
+
+  // ヘッダ
+  for (let i = 0; i < MAGIC.length; i++) {
+    a[i] = MAGIC.charCodeAt(i);
+  }
+  a[4] = VERSION;
+  a[5] = numPlanes;
+  a[6] = src.format.id;
+  put16(8, src.width);
+  put16(10, src.height);
+  put32(12, paletteOffset);
+  put16(16, paletteColors);
+  put32(20, totalSize);
+
+  // プレーンテーブルとデータ
+  for (let i = 0; i < numPlanes; i++) {
+    const plane = enc.planes[i];
+    const out = plane.output;
+    const data = args.blobs[i].array;
+    const entry = HEADER_SIZE + PLANE_ENTRY_SIZE * i;
+    for (let j = 0; j < PLANE_ID_SIZE && j < plane.id.length; j++) {
+      a[entry + j] = plane.id.charCodeAt(j) & 0x7f;
+    }
+    put32(entry + 8, dataOffsets[i]);
+    put32(entry + 12, data.length);
+    a[entry + 16] = plane.type;
+    a[entry + 17] = plane.indexMatchValue;
+    a[entry + 18] = planeFlags(enc, plane);
+    a[entry + 19] = args.compression;
+    a[entry + 20] = plane.packUnit;
+    a[entry + 21] = out.pixelStride;
+    a[entry + 22] = out.pixelsPerFrag;
+    a[entry + 23] = out.bytesPerFrag;
+    a.set(data, dataOffsets[i]);
+  }
+
+  // パレット
+  if (args.palette) {
+    for (let i = 0; i < paletteColors; i++) {
+      const c = args.palette[i];
+      a[paletteOffset + i * 3 + 0] = c & 0xff;
+      a[paletteOffset + i * 3 + 1] = (c >> 8) & 0xff;
+      a[paletteOffset + i * 3 + 2] = (c >> 16) & 0xff;
+    }
+  }
+
+  blob.comment = `${src.width}x${src.height}px, ${src.format.toString()}\n` +
+      `Asset container, ${numPlanes} plane(s)` +
+      (args.palette ? `, ${paletteColors} colors palette` : '') +
+      (args.compression != Compression.Method.NONE ?
+           `, ${Compression.methodName(args.compression)} compressed` :
+           '') +
+      '\n' + `${totalSize} Bytes\n`;
+  return blob;
+}
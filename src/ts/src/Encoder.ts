@@ -3,15 +3,16 @@ import * as Debug from './Debug';
 import {ReducedImage} from './Images';
 import {intCeil} from './Utils';
 
+// PackUnit と PlaneType はアセットコンテナに格納されるので値を変えないこと
 export const enum PackUnit {
-  UNPACKED,
-  PIXEL,
-  ALIGNMENT,
+  UNPACKED = 0,
+  PIXEL = 1,
+  ALIGNMENT = 2,
 }
 
 export const enum PlaneType {
-  DIRECT,
-  INDEX_MATCH,
+  DIRECT = 0,
+  INDEX_MATCH = 1,
 }
 
 export const enum AlignBoundary {
@@ -59,6 +60,30 @@ export class EncodeArgs {
   public planes: PlaneArgs[] = [];
 }
 
+// テンプレートと同じ設定で別の画像をエンコードするための引数を作る
+export function cloneArgs(tmpl: EncodeArgs, src: ReducedImage): EncodeArgs {
+  const args = new EncodeArgs();
+  args.src = src;
+  args.alphaFirst = tmpl.alphaFirst;
+  args.colorDescending = tmpl.colorDescending;
+  for (const t of tmpl.planes) {
+    const plane = new PlaneArgs();
+    plane.id = t.id;
+    plane.type = t.type;
+    plane.indexMatchValue = t.indexMatchValue;
+    plane.postInvert = t.postInvert;
+    plane.farPixelFirst = t.farPixelFirst;
+    plane.bigEndian = t.bigEndian;
+    plane.packUnit = t.packUnit;
+    plane.vertPack = t.vertPack;
+    plane.alignBoundary = t.alignBoundary;
+    plane.alignLeft = t.alignLeft;
+    plane.vertAddr = t.vertAddr;
+    args.planes.push(plane);
+  }
+  return args;
+}
+
 export function encode(args: EncodeArgs): void {
   const sw = new Debug.StopWatch(false);
 
@@ -9,22 +9,23 @@ export const enum ColorSpace {
   RGB,
 }
 
+// アセットコンテナに格納されるので値を変えないこと
 export const enum PixelFormat {
-  RGBA8888,
+  RGBA8888 = 0,
   // RGBA4444,
-  RGB888,
-  RGB666,
-  RGB565,
+  RGB888 = 1,
+  RGB666 = 2,
+  RGB565 = 3,
   // RGB555,
-  RGB444,
-  RGB332,
-  RGB111,
-  GRAY4,
-  GRAY2,
-  BW,
-  I2_RGB888,
-  I4_RGB888,
-  I6_RGB888,
+  RGB444 = 4,
+  RGB332 = 5,
+  RGB111 = 6,
+  GRAY4 = 7,
+  GRAY2 = 8,
+  BW = 9,
+  I2_RGB888 = 10,
+  I4_RGB888 = 11,
+  I6_RGB888 = 12,
 }
 
 export const enum ChannelOrder {
@@ -0,0 +1,70 @@
+import {Size} from './Geometries';
+import {ReducedImage} from './Images';
+import * as Preproc from './Preproc';
+import * as Reducer from './Reducer';
+import * as Resizer from './Resizer';
+
+// 複数解像度の生成
+// 基準の出力と同じ設定で、出力サイズだけを変えてリサイズ・補正・減色をやり直す。
+// 生成したレベルは rawdisp の AssetSet にまとめ、表示先に合うものを実行時に選ぶ。
+
+// AssetSet に格納できるレベル数 (rawdisp::AssetSet::MAX_LEVELS)
+export const MAX_LEVELS = 8;
+
+export class LevelArgs {
+  // 基準の出力に使用した設定 (入出力の画像は参照しない)
+  public resize: Resizer.ResizeArgs|null = null;
+  public preproc: Preproc.PreProcArgs|null = null;
+  public reduce: Reducer.ReduceArgs|null = null;
+  public sizes: Size[] = [];
+}
+
+// "128x64, 296x152" のような指定を解釈する
+export function parseSizes(text: string): Size[] {
+  const sizes: Size[] = [];
+  for (const item of text.split(/[,\s]+/)) {
+    if (!item) continue;
+    const m = item.match(/^(\d+)[xX*](\d+)$/);
+    if (!m) {
+      throw new Error(`解像度の指定が不正です: ${item}`);
+    }
+    const width = parseInt(m[1]), height = parseInt(m[2]);
+    if (width < 1 || height < 1 || width * height > 2048 * 2048) {
+      throw new Error(`解像度が範囲外です: ${item}`);
+    }
+    if (!sizes.some(s => s.width == width && s.height == height)) {
+      sizes.push({width, height});
+    }
+  }
+  return sizes;
+}
+
+export function build(args: LevelArgs): ReducedImage[] {
+  const baseResize = args.resize as Resizer.ResizeArgs;
+  const basePreproc = args.preproc as Preproc.PreProcArgs;
+  const baseReduce = args.reduce as Reducer.ReduceArgs;
+
+  const images: ReducedImage[] = [];
+  for (const size of args.sizes) {
+    const resize = Object.assign(new Resizer.ResizeArgs(), baseResize);
+    resize.outSize = {width: size.width, height: size.height};
+    resize.out = null;
+    Resizer.resize(resize);
+
+    // 自動決定される補正値は基準の出力に揃え、レベル間で色味を変えない
+    const preproc = Object.assign(new Preproc.PreProcArgs(), basePreproc);
+    preproc.src = resize.out;
+    preproc.gamma = {value: basePreproc.gamma.value, automatic: false};
+    preproc.brightness =
+        {value: basePreproc.brightness.value, automatic: false};
+    preproc.contrast = {value: basePreproc.contrast.value, automatic: false};
+    Preproc.process(preproc);
+
+    const reduce = Object.assign(new Reducer.ReduceArgs(), baseReduce);
+    reduce.src = preproc.out;
+    reduce.output = null;
+    Reducer.reduce(reduce);
+    images.push(reduce.output as ReducedImage);
+  }
+  return images;
+}
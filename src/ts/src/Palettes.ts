@@ -293,6 +293,27 @@ export class IndexedPalette extends Palette {
     return avgStep;
   }
 
+  // RGB565 の各値を最も近いパレットのインデックスに対応させる 3D LUT
+  // (32x64x32、画素値がそのままキー)。rawdisp::Rgb565PaletteLut と同じく
+  // 各チャネルは上位ビットを繰り返して 8bit に広げる
+  public makeRgb565Lut(): Uint8Array {
+    const lut = new Uint8Array(65536);
+    const src = new Float32Array(3);
+    const dest = new Uint8Array(1);
+    const error = new Float32Array(3);
+    for (let key = 0; key < 65536; key++) {
+      const r = key >> 11;
+      const g = (key >> 5) & 0x3f;
+      const b = key & 0x1f;
+      src[0] = ((r << 3) | (r >> 2)) / 255;
+      src[1] = ((g << 2) | (g >> 4)) / 255;
+      src[2] = ((b << 3) | (b >> 2)) / 255;
+      this.reduce(src, 0, dest, 0, error);
+      lut[key] = dest[0];
+    }
+    return lut;
+  }
+
   public get convexHull(): ConvexHull3D {
     if (!this.convexHullCache) {
       let numAvailableColors = 0;
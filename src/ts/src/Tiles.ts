@@ -0,0 +1,143 @@
+import {ArrayBlob} from './Blobs';
+import {ReducedImage} from './Images';
+
+// タイルマップ
+// 画像を N x N のタイルに分割し、同じ内容のタイルを 1 つにまとめる。
+// タイルバンク: ユニークなタイルを縦に並べた幅 N、高さ N x タイル数の画像
+// マップ: タイルあたり 16bit リトルエンディアン
+//   bit 0..13: タイル番号
+//   bit 14:    左右反転
+//   bit 15:    上下反転
+// 画像の右端と下端の端数はインデックス 0 で埋める。
+
+export const FLIP_H = 0x4000;
+export const FLIP_V = 0x8000;
+export const INDEX_MASK = 0x3fff;
+export const MAX_TILES = INDEX_MASK + 1;
+
+export class TileArgs {
+  public src: ReducedImage|null = null;
+  public tileSize: number = 8;
+  public allowFlip: boolean = false;
+}
+
+export class TileSet {
+  public bank: ReducedImage|null = null;
+  public map: Uint16Array = new Uint16Array(0);
+  public cols: number = 0;
+  public rows: number = 0;
+  public numTiles: number = 0;
+  public numFlipped: number = 0;
+}
+
+export function build(args: TileArgs): TileSet {
+  const src = args.src as ReducedImage;
+  const n = args.tileSize;
+  const numCh = src.data.length;
+  const cols = Math.ceil(src.width / n);
+  const rows = Math.ceil(src.height / n);
+  const tilePixels = n * n;
+
+  const set = new TileSet();
+  set.cols = cols;
+  set.rows = rows;
+  set.map = new Uint16Array(cols * rows);
+
+  // タイルの内容 (全チャネル) -> タイル番号
+  const dict = new Map<string, number>();
+  const tiles: Uint8Array[] = [];
+  const tile = new Uint8Array(tilePixels * numCh);
+  const flipped = new Uint8Array(tilePixels * numCh);
+
+  for (let row = 0; row < rows; row++) {
+    for (let col = 0; col < cols; col++) {
+      // タイルを切り出す
+      tile.fill(0);
+      for (let ty = 0; ty < n; ty++) {
+        const y = row * n + ty;
+        if (y >= src.height) break;
+        for (let tx = 0; tx < n; tx++) {
+          const x = col * n + tx;
+          if (x >= src.width) break;
+          for (let ch = 0; ch < numCh; ch++) {
+            tile[ch * tilePixels + ty * n + tx] =
+                src.data[ch][y * src.width + x];
+          }
+        }
+      }
+
+      // 反転したものも含めて既存のタイルを探す
+      let entry = -1;
+      const numVariants = args.allowFlip ? 4 : 1;
+      for (let v = 0; v < numVariants && entry < 0; v++) {
+        const flipH = (v & 1) != 0, flipV = (v & 2) != 0;
+        const t = v == 0 ? tile : flipTile(tile, n, numCh, flipH, flipV,
+                                           flipped);
+        const index = dict.get(tileKey(t));
+        if (index !== undefined) {
+          entry = index | (flipH ? FLIP_H : 0) | (flipV ? FLIP_V : 0);
+          if (v != 0) set.numFlipped++;
+        }
+      }
+
+      if (entry < 0) {
+        if (tiles.length >= MAX_TILES) {
+          throw new Error(`ユニークなタイルが ${MAX_TILES} 個を超えました。`);
+        }
+        entry = tiles.length;
+        dict.set(tileKey(tile), entry);
+        tiles.push(tile.slice());
+      }
+      set.map[row * cols + col] = entry;
+    }
+  }
+
+  // タイルバンクを縦に並べた画像にする
+  set.numTiles = tiles.length;
+  const bank = new ReducedImage(n, n * tiles.length, src.format, src.palette);
+  for (let i = 0; i < tiles.length; i++) {
+    for (let ch = 0; ch < numCh; ch++) {
+      bank.data[ch].set(
+          tiles[i].subarray(ch * tilePixels, (ch + 1) * tilePixels),
+          i * tilePixels);
+    }
+  }
+  set.bank = bank;
+  return set;
+}
+
+function tileKey(tile: Uint8Array): string {
+  return String.fromCharCode.apply(null, Array.from(tile));
+}
+
+function flipTile(
+    src: Uint8Array, n: number, numCh: number, flipH: boolean, flipV: boolean,
+    dst: Uint8Array): Uint8Array {
+  const tilePixels = n * n;
+  for (let ch = 0; ch < numCh; ch++) {
+    const base = ch * tilePixels;
+    for (let y = 0; y < n; y++) {
+      const sy = flipV ? n - 1 - y : y;
+      for (let x = 0; x < n; x++) {
+        const sx = flipH ? n - 1 - x : x;
+        dst[base + y * n + x] = src[base + sy * n + sx];
+      }
+    }
+  }
+  return dst;
+}
+
+// マップを 16bit リトルエンディアンの配列にする
+export function makeMapBlob(set: TileSet, tileSize: number): ArrayBlob {
+  const blob = new ArrayBlob('map', set.map.length * 2);
+  for (let i = 0; i < set.map.length; i++) {
+    blob.array[i * 2 + 0] = set.map[i] & 0xff;
+    blob.array[i * 2 + 1] = (set.map[i] >> 8) & 0xff;
+  }
+  blob.comment = `Tile map, ${set.cols}x${set.rows} tiles of ` +
+      `${tileSize}x${tileSize}px, ${set.numTiles} unique tiles\n` +
+      (set.numFlipped > 0 ? `${set.numFlipped} flipped references, ` : '') +
+      `bit 14: H flip, bit 15: V flip\n` +
+      `${blob.array.length} Bytes\n`;
+  return blob;
+}
@@ -1,5 +1,6 @@
 import {ArrayBlob} from './Blobs';
 import * as CodeGen from './CodeGen';
+import * as Compression from './Compression';
 import * as Colors from './Colors';
 import * as ColorSpaceUis from './ColorSpaceUis';
 import * as Configs from './Configs';
@@ -9,6 +10,7 @@ import {Point, Rect, Size} from './Geometries';
 import * as Images from './Images';
 import {ChannelOrder, ColorSpace, PixelFormat} from './Images';
 import * as KMeans from './KMeans';
+import * as Levels from './Levels';
 import * as Math3D from './Math3D';
 import {Mat43, Vec3} from './Math3D';
 import {DitherMethod, FixedPalette, IndexedPalette, Palette, RoundMethod} from './Palettes';
@@ -16,6 +18,7 @@ import * as PaletteUis from './PaletteUis';
 import * as Preproc from './Preproc';
 import * as Reducer from './Reducer';
 import * as Resizer from './Resizer';
+import * as Tiles from './Tiles';
 import * as Ui from './Ui'
 import {clip} from './Utils';
 
@@ -580,6 +583,16 @@ const alignBoundaryBox = Ui.makeSelectBox(
     Encoder.AlignBoundary.BYTE_1);
 const leftAlignBox = Ui.makeCheckBox('左詰め');
 const vertAddrBox = Ui.makeCheckBox('垂直スキャン');
+const tileSizeBox = Ui.makeSelectBox(
+    [
+      {value: 0, label: 'なし'},
+      {value: 8, label: '8x8'},
+      {value: 16, label: '16x16'},
+      {value: 32, label: '32x32'},
+    ],
+    0);
+const tileFlipBox = Ui.makeCheckBox('反転タイルを統合');
+const animFramesBox = Ui.makeTextBox('1', '', 4);
 
 const planeSelectBox = Ui.makeSelectBox([{value: 0, label: 'プレーン0'}], 0);
 const planeGroupBody = Ui.makeGroupBody();
@@ -628,6 +641,19 @@ const encodeSection = Ui.makeSection([
     Ui.pro(Ui.tip(
         [bigEndianBox.parentElement],
         'ピクセル内のバイトの順序を指定します。')),
+    Ui.pro(Ui.tip(
+        ['タイル: ', tileSizeBox],
+        '画像をタイルに分割し、同じタイルを 1 つにまとめた\n' +
+            'タイルバンクとマップを生成します。\n' +
+            'rawdisp の TileMap で描画できます。圧縮とコンテナ形式は無効になります。')),
+    Ui.pro(Ui.tip(
+        [tileFlipBox.parentElement],
+        '左右・上下に反転すると一致するタイルも 1 つにまとめます。')),
+    Ui.pro(Ui.tip(
+        ['アニメーション: ', Ui.upDown(animFramesBox, 1, 256, 1), ' フレーム'],
+        '縦に並べたフレームを差分アニメーションにします。\n' +
+            '最初のフレーム全体と、以降は変化した矩形だけを出力します。\n' +
+            'rawdisp の DeltaPlayer で再生できます。')),
   ]),
   Ui.pro(planeGroupBox),
   pStructCanvas,
@@ -639,6 +665,40 @@ const codeFormatBox = Ui.makeSelectBox(
       {value: CodeGen.CodeFormat.RAW_BINARY, label: '生バイナリ'},
     ],
     CodeGen.CodeFormat.C_ARRAY);
+const compressionBox = Ui.makeSelectBox(
+    [
+      {value: Compression.Method.NONE, label: 'なし'},
+      {value: Compression.Method.RLE, label: 'RLE'},
+      {value: Compression.Method.LZ77, label: 'LZ77'},
+    ],
+    Compression.Method.NONE);
+const lzWindowBox = Ui.makeSelectBox(
+    [
+      {value: 8, label: '256 B'},
+      {value: 10, label: '1 KB'},
+      {value: 12, label: '4 KB'},
+    ],
+    Compression.LZ77_DEFAULT_WINDOW_BITS);
+const paletteOutBox = Ui.makeCheckBox('パレットを出力');
+paletteOutBox.checked = true;
+const paletteLutBox = Ui.makeCheckBox('パレット LUT を出力');
+const containerBox = Ui.makeCheckBox('コンテナ形式');
+const descriptorBox = Ui.makeCheckBox('rawdisp 記述子');
+const alignmentBox = Ui.makeSelectBox(
+    [
+      {value: 1, label: 'なし'},
+      {value: 4, label: '4 B'},
+      {value: 16, label: '16 B'},
+      {value: 32, label: '32 B'},
+    ],
+    1);
+const paddingBox = Ui.makeCheckBox('転送単位にパディング');
+const sectionBox = Ui.makeTextBox('', '(なし)', 32);
+sectionBox.style.textAlign = 'left';
+sectionBox.inputMode = 'text';
+const levelsBox = Ui.makeTextBox('', '(なし)', 40);
+levelsBox.style.textAlign = 'left';
+levelsBox.inputMode = 'text';
 const codeUnitBox = Ui.makeSelectBox(
     [
       {value: CodeGen.CodeUnit.FILE, label: 'ファイル全体'},
@@ -677,6 +737,44 @@ const codeGenSection = Ui.makeSection([
   Ui.makeFloatList([
     Ui.makeHeader('コード生成'),
     Ui.tip(['形式: ', codeFormatBox], '生成するコードの形式を指定します。'),
+    Ui.pro(Ui.tip(
+        ['圧縮: ', compressionBox],
+        'データを圧縮します。展開には rawdisp のデコーダを使用します。')),
+    Ui.pro(Ui.tip(
+        ['LZ77 窓: ', lzWindowBox],
+        'LZ77 の参照窓のサイズを指定します。展開時にこのサイズの RAM を使用します。')),
+    Ui.tip(
+        [paletteOutBox.parentElement],
+        'インデックスカラーの場合にパレットを RGB888 の配列として出力します。'),
+    Ui.pro(Ui.tip(
+        [paletteLutBox.parentElement],
+        'RGB565 の値から最も近いパレットのインデックスを引く 3D LUT (32x64x32) を出力します。\n' +
+            'rawdisp の Rgb565PaletteLut で、実行時に描いた画像を 1 画素 1 回の参照で変換できます。')),
+    Ui.pro(Ui.tip(
+        [containerBox.parentElement],
+        'サイズや形式を記述したヘッダとプレーンテーブル、パレットを含む\n' +
+            '1 つのバイナリにまとめます。rawdisp の AssetContainer で読み込めます。')),
+    Ui.pro(Ui.tip(
+        [descriptorBox.parentElement],
+        'サイズや形式、プレーンの構造を記述した constexpr の AssetDesc を\n' +
+            '配列と一緒に出力します。表示先との適合をコンパイル時に検査できます。')),
+    Ui.pro(Ui.tip(
+        ['アライメント: ', alignmentBox],
+        '配列の先頭アドレスの境界を指定します。\n' +
+            'rawdisp は境界の揃った配列をワード単位で読み出します。')),
+    Ui.pro(Ui.tip(
+        [paddingBox.parentElement],
+        '配列の長さをアライメントの倍数に揃えます。\n' +
+            'DMA を転送単位のまま使えるようになります。')),
+    Ui.pro(Ui.tip(
+        ['セクション: ', sectionBox],
+        '配列を置くセクションの名前を指定します。\n' +
+            'リンカスクリプトで、大きな画像をコードとは別の領域に配置できます。')),
+    Ui.pro(Ui.tip(
+        ['追加解像度: ', levelsBox],
+        '同じ画像を別の解像度でも生成します。「幅x高さ」をカンマ区切りで指定します。\n' +
+            '各解像度の記述子をまとめた AssetSet を出力し、\n' +
+            'rawdisp で表示先に合う解像度を選べます。')),
     Ui.tip(['生成範囲: ', codeUnitBox], '生成するコードの範囲を指定します。'),
     Ui.tip(['列数: ', codeColsBox], '1 行に詰め込む要素数を指定します。'),
     Ui.tip(
@@ -698,6 +796,10 @@ let trimL = 0, trimT = 0, trimR = 1, trimB = 1;
 let trimUiState = TrimState.IDLE;
 
 let normImageCache: Images.NormalizedImage|null = null;
+let resizeArgsCache: Resizer.ResizeArgs|null = null;
+
+// 追加解像度の生成に使う、基準の出力の設定
+let levelBase: Levels.LevelArgs|null = null;
 
 let reducedImage: Images.ReducedImage|null = null;
 
@@ -1235,6 +1337,7 @@ function requestColorReduction(): void {
 
 function reduceColor(): void {
   reducedImage = null;
+  levelBase = null;
 
   if (quantizeTimeoutId >= 0) {
     clearTimeout(quantizeTimeoutId);
@@ -1384,14 +1487,17 @@ function reduceColor(): void {
 
       Resizer.resize(args);
       normImageCache = args.out;
+      resizeArgsCache = args;
     }
 
     // 色の追跡のための代表ピクセルを抽出する
     const samplePixels = normImageCache!.collectCharacteristicColors(32);
 
     // 補正処理
+    let preprocArgs: Preproc.PreProcArgs;
     {
       let args = new Preproc.PreProcArgs();
+      preprocArgs = args;
       args.src = normImageCache as Images.NormalizedImage;
 
       // 画像補正系のパラメータ決定
@@ -1572,6 +1678,11 @@ function reduceColor(): void {
 
       reducedImage = args.output as Images.ReducedImage;
 
+      levelBase = new Levels.LevelArgs();
+      levelBase.resize = resizeArgsCache;
+      levelBase.preproc = preprocArgs;
+      levelBase.reduce = args;
+
       swDetail.lap('Quantization');
 
       // プレビューの作成
@@ -1651,11 +1762,30 @@ function generateCode(): void {
     return;
   }
   let blobs: ArrayBlob[] = [];
-
+  let encodeArgs: Encoder.EncodeArgs|null = null;
+  let tileMapBlob: ArrayBlob|null = null;
 
   try {
     const args = new Encoder.EncodeArgs();
     args.src = reducedImage;
+
+    const tileSize = parseInt(tileSizeBox.value);
+    const animFrames = parseInt(animFramesBox.value) || 1;
+    if (tileSize > 0 && animFrames > 1) {
+      throw new Error('タイルとアニメーションは同時に使用できません。');
+    }
+
+    // タイルマップ形式ではタイルバンクをエンコードする
+    Ui.setVisible(Ui.parentLiOf(tileFlipBox), tileSize > 0);
+    if (tileSize > 0) {
+      const tileArgs = new Tiles.TileArgs();
+      tileArgs.src = reducedImage;
+      tileArgs.tileSize = tileSize;
+      tileArgs.allowFlip = tileFlipBox.checked;
+      const tileSet = Tiles.build(tileArgs);
+      args.src = tileSet.bank;
+      tileMapBlob = Tiles.makeMapBlob(tileSet, tileSize);
+    }
     const chOrder: ChannelOrder = parseInt(channelOrderBox.value);
     switch (chOrder) {
       case ChannelOrder.RGBA:
@@ -1710,6 +1840,7 @@ function generateCode(): void {
     }
 
     Encoder.encode(args);
+    encodeArgs = args;
 
     for (const plane of args.planes) {
       blobs.push(plane.output.blob as ArrayBlob);
@@ -1862,12 +1993,90 @@ function generateCode(): void {
     args.src = reducedImage;
     args.blobs = blobs;
     args.format = parseInt(codeFormatBox.value);
+    args.compression = parseInt(compressionBox.value);
+    args.lzWindowBits = parseInt(lzWindowBox.value);
+    const fmt = reducedImage.format;
+    Ui.setVisible(Ui.parentLiOf(paletteOutBox), fmt.isIndexed);
+    if (fmt.isIndexed && paletteOutBox.checked) {
+      const numColors = 1 << fmt.indexBits;
+      args.palette = new Uint32Array(numColors);
+      for (let i = 0; i < numColors; i++) {
+        args.palette[i] = paletteUi.getEntry(i).color;
+      }
+    }
+    const rgbIndexed = fmt.isIndexed && fmt.colorBits.length == 3;
+    Ui.setVisible(Ui.parentLiOf(paletteLutBox), rgbIndexed);
+    if (rgbIndexed && paletteLutBox.checked) {
+      args.paletteLut = paletteUi.getPalette(fmt).makeRgb565Lut();
+    }
+    args.tileMap = tileMapBlob;
+    args.animFrames = Math.max(1, parseInt(animFramesBox.value) || 1);
+    args.container = containerBox.checked;
+    args.descriptor = descriptorBox.checked;
+    args.alignment = parseInt(alignmentBox.value);
+    Ui.setVisible(Ui.parentLiOf(paddingBox), args.alignment > 1);
+    args.padding = paddingBox.checked;
+    args.section = sectionBox.value.trim();
+    args.encode = encodeArgs;
     args.codeUnit = parseInt(codeUnitBox.value);
     args.indent = parseInt(indentBox.value);
     args.arrayCols = Math.max(1, parseInt(codeColsBox.value));
 
+    // 追加解像度では各レベルの名前に解像度を付け、記述子を必ず出力する
+    const baseName = args.name;
+    const baseW = reducedImage.width, baseH = reducedImage.height;
+    const levelSizes = Levels.parseSizes(levelsBox.value)
+                           .filter(s => s.width != baseW || s.height != baseH);
+    const multiRes = levelSizes.length > 0;
+    if (multiRes) {
+      if (tileMapBlob || args.animFrames > 1 || args.container) {
+        throw new Error(
+            '追加解像度はタイル、アニメーション、コンテナ形式と同時に使用できません。');
+      }
+      if (levelSizes.length + 1 > Levels.MAX_LEVELS) {
+        throw new Error(
+            `解像度は基準の出力を含めて ${Levels.MAX_LEVELS} 個までです。`);
+      }
+      args.name += `_${baseW}x${baseH}`;
+      args.descriptor = true;
+    }
+
     CodeGen.generate(args);
 
+    // トリミング操作中は追加解像度を生成しない
+    if (multiRes && levelBase && trimUiState == TrimState.IDLE) {
+      const levelArgs = new Levels.LevelArgs();
+      levelArgs.resize = levelBase.resize;
+      levelArgs.preproc = levelBase.preproc;
+      levelArgs.reduce = levelBase.reduce;
+      levelArgs.sizes = levelSizes;
+      const levels = [args];
+      for (const img of Levels.build(levelArgs)) {
+        const enc = Encoder.cloneArgs(encodeArgs as Encoder.EncodeArgs, img);
+        Encoder.encode(enc);
+        const level = Object.assign(new CodeGen.CodeGenArgs(), args);
+        level.name = `${baseName}_${img.width}x${img.height}`;
+        level.src = img;
+        level.encode = enc;
+        level.blobs = enc.planes.map(p => p.output.blob as ArrayBlob);
+        level.codes = [];
+        // LUT は解像度によらないので基準の出力にだけ付ける
+        level.paletteLut = null;
+        CodeGen.generate(level);
+        args.codes.push(...level.codes);
+        levels.push(level);
+      }
+      if (args.format == CodeGen.CodeFormat.C_ARRAY &&
+          args.codeUnit >= CodeGen.CodeUnit.FILE) {
+        // 大きい順に並べる
+        const area = (l: CodeGen.CodeGenArgs) =>
+            (l.src as Images.ReducedImage).width *
+            (l.src as Images.ReducedImage).height;
+        levels.sort((a, b) => area(b) - area(a));
+        args.codes.push(CodeGen.generateAssetSet(baseName, levels, args.indent));
+      }
+    }
+
     const isBinary = (args.format == CodeGen.CodeFormat.RAW_BINARY);
 
     codePlaneContainer.innerHTML = '';
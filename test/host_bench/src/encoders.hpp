@@ -0,0 +1,267 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <map>
+#include <vector>
+
+#include "rawdisp/compression.hpp"
+#include "rawdisp/pixel_format.hpp"
+
+// Reference encoders, same output as Compression.ts of the generator.
+
+static inline void writeHeader(std::vector<uint8_t> &out,
+                               rawdisp::Compression method, uint8_t param,
+                               uint32_t size) {
+  out.push_back(static_cast<uint8_t>(method));
+  out.push_back(param);
+  for (int i = 0; i < 4; i++) {
+    out.push_back((size >> (i * 8)) & 0xFF);
+  }
+}
+
+static inline std::vector<uint8_t> encodeRle(const uint8_t *data,
+                                             size_t size) {
+  constexpr size_t MIN_RUN = 3;
+  constexpr size_t MAX_RUN = 0x7F + MIN_RUN;
+  constexpr size_t MAX_LITERAL = 0x80;
+
+  std::vector<uint8_t> out;
+  writeHeader(out, rawdisp::Compression::RLE, 0, size);
+
+  size_t litStart = 0, litLen = 0;
+  auto flushLiteral = [&]() {
+    while (litLen > 0) {
+      size_t n = litLen < MAX_LITERAL ? litLen : MAX_LITERAL;
+      out.push_back(n - 1);
+      out.insert(out.end(), data + litStart, data + litStart + n);
+      litStart += n;
+      litLen -= n;
+    }
+  };
+
+  size_t i = 0;
+  while (i < size) {
+    size_t run = 1;
+    while (i + run < size && run < MAX_RUN && data[i + run] == data[i]) {
+      run++;
+    }
+    if (run >= MIN_RUN) {
+      flushLiteral();
+      out.push_back(0x80 | (run - MIN_RUN));
+      out.push_back(data[i]);
+      i += run;
+      litStart = i;
+    } else {
+      litLen++;
+      i++;
+    }
+  }
+  flushLiteral();
+  return out;
+}
+
+static inline std::vector<uint8_t> encodeLz77(const uint8_t *data, size_t size,
+                                              int windowBits) {
+  constexpr int MIN_MATCH = 3;
+  constexpr int HASH_BITS = 15;
+  constexpr int MAX_CHAIN = 256;
+  const size_t windowSize = (size_t)1 << windowBits;
+  const size_t maxMatch = MIN_MATCH + (1 << (16 - windowBits)) - 1;
+
+  std::vector<uint8_t> out;
+  writeHeader(out, rawdisp::Compression::LZ77, windowBits, size);
+
+  std::vector<int32_t> head(1 << HASH_BITS, -1);
+  std::vector<int32_t> prev(size, -1);
+  auto hashAt = [&](size_t i) {
+    uint32_t v = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16);
+    return (uint32_t)(v * 0x9E3779B1u) >> (32 - HASH_BITS);
+  };
+  auto insert = [&](size_t i) {
+    if (i + MIN_MATCH > size) return;
+    uint32_t h = hashAt(i);
+    prev[i] = head[h];
+    head[h] = i;
+  };
+
+  size_t flagPos = 0;
+  int flagBit = 8;
+  auto pushFlag = [&](bool isMatch) {
+    if (flagBit >= 8) {
+      flagPos = out.size();
+      out.push_back(0);
+      flagBit = 0;
+    }
+    if (isMatch) out[flagPos] |= 1 << flagBit;
+    flagBit++;
+  };
+
+  size_t i = 0;
+  while (i < size) {
+    size_t bestLen = 0, bestDist = 0;
+    if (i + MIN_MATCH <= size) {
+      size_t maxLen = size - i < maxMatch ? size - i : maxMatch;
+      int32_t cand = head[hashAt(i)];
+      int chain = MAX_CHAIN;
+      while (cand >= 0 && i - cand <= windowSize && chain-- > 0) {
+        size_t len = 0;
+        while (len < maxLen && data[cand + len] == data[i + len]) len++;
+        if (len > bestLen) {
+          bestLen = len;
+          bestDist = i - cand;
+          if (len >= maxLen) break;
+        }
+        cand = prev[cand];
+      }
+    }
+
+    if (bestLen >= MIN_MATCH) {
+      pushFlag(true);
+      uint16_t token = (bestDist - 1) | ((bestLen - MIN_MATCH) << windowBits);
+      out.push_back(token & 0xFF);
+      out.push_back(token >> 8);
+      for (size_t j = 0; j < bestLen; j++) insert(i + j);
+      i += bestLen;
+    } else {
+      pushFlag(false);
+      out.push_back(data[i]);
+      insert(i);
+      i++;
+    }
+  }
+  return out;
+}
+
+struct TileSet {
+  std::vector<uint8_t> bank;
+  std::vector<uint8_t> map;
+  int cols;
+  int rows;
+  int numTiles;
+};
+
+// Same output as Tiles.ts for an image packed in the layout of F. The
+// width and height have to be multiples of the tile size.
+template <rawdisp::PixelFormat F>
+static inline TileSet buildTiles(const uint8_t *data, int w, int h, int n,
+                                 bool allowFlip) {
+  using Traits = rawdisp::PixelFormatTraits<F>;
+  constexpr int PPU = Traits::PIXELS_PER_UNIT;
+  constexpr int BPU = Traits::BYTES_PER_UNIT;
+
+  std::vector<uint32_t> pixels((size_t)w * h);
+  for (size_t i = 0; i < pixels.size(); i += PPU) {
+    rawdisp::unpackUnit<F>(data + i / PPU * BPU, pixels.data() + i);
+  }
+
+  TileSet set;
+  set.cols = w / n;
+  set.rows = h / n;
+  std::map<std::vector<uint32_t>, int> dict;
+  std::vector<uint32_t> tile(n * n), flipped(n * n);
+  for (int row = 0; row < set.rows; row++) {
+    for (int col = 0; col < set.cols; col++) {
+      for (int ty = 0; ty < n; ty++) {
+        for (int tx = 0; tx < n; tx++) {
+          tile[ty * n + tx] = pixels[(size_t)(row * n + ty) * w + col * n + tx];
+        }
+      }
+      int entry = -1;
+      for (int v = 0; v < (allowFlip ? 4 : 1) && entry < 0; v++) {
+        for (int ty = 0; ty < n; ty++) {
+          for (int tx = 0; tx < n; tx++) {
+            int sx = (v & 1) ? n - 1 - tx : tx;
+            int sy = (v & 2) ? n - 1 - ty : ty;
+            flipped[ty * n + tx] = tile[sy * n + sx];
+          }
+        }
+        auto it = dict.find(flipped);
+        if (it != dict.end()) entry = it->second | (v << 14);
+      }
+      if (entry < 0) {
+        entry = dict.size();
+        dict[tile] = entry;
+        for (int i = 0; i < n * n; i += PPU) {
+          size_t pos = set.bank.size();
+          set.bank.resize(pos + BPU);
+          rawdisp::packUnit<F>(tile.data() + i, PPU, set.bank.data() + pos);
+        }
+      }
+      set.map.push_back(entry & 0xFF);
+      set.map.push_back(entry >> 8);
+    }
+  }
+  set.numTiles = dict.size();
+  return set;
+}
+
+// Same output as Animation.ts for single plane frames packed in the layout
+// of F, horizontally.
+template <rawdisp::PixelFormat F>
+static inline std::vector<uint8_t> encodeDeltaAnimation(
+    const std::vector<std::vector<uint8_t>> &frames, int w, int h) {
+  using Traits = rawdisp::PixelFormatTraits<F>;
+  constexpr int PPU = Traits::PIXELS_PER_UNIT;
+  constexpr int BPU = Traits::BYTES_PER_UNIT;
+  const size_t rowBytes = rawdisp::bytesForPixels<F>(w);
+
+  auto pixelAt = [&](const std::vector<uint8_t> &frame, int x, int y) {
+    uint32_t unit[PPU];
+    rawdisp::unpackUnit<F>(frame.data() + y * rowBytes + x / PPU * BPU, unit);
+    return unit[x % PPU];
+  };
+
+  std::vector<uint8_t> table, body;
+  size_t n = frames.size();
+  size_t bodyStart = 12 + 16 * n;
+  auto put16 = [](std::vector<uint8_t> &v, uint32_t x) {
+    v.push_back(x & 0xFF);
+    v.push_back((x >> 8) & 0xFF);
+  };
+  for (size_t f = 0; f < n; f++) {
+    int x0 = 0, y0 = 0, x1 = w, y1 = h;
+    if (f > 0) {
+      x0 = w, y0 = h, x1 = 0, y1 = 0;
+      for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+          if (pixelAt(frames[f], x, y) != pixelAt(frames[f - 1], x, y)) {
+            if (x < x0) x0 = x;
+            if (x + 1 > x1) x1 = x + 1;
+            if (y < y0) y0 = y;
+            if (y + 1 > y1) y1 = y + 1;
+          }
+        }
+      }
+      if (x1 == 0) {
+        x0 = y0 = x1 = y1 = 0;
+      } else {
+        x0 = x0 / PPU * PPU;
+        x1 = (x1 + PPU - 1) / PPU * PPU;
+        if (x1 > w) x1 = w;
+      }
+    }
+    size_t planeSize = rawdisp::bytesForPixels<F>(x1 - x0) * (y1 - y0);
+    put16(table, x0);
+    put16(table, y0);
+    put16(table, x1 - x0);
+    put16(table, y1 - y0);
+    uint32_t offset = bodyStart + body.size();
+    put16(table, offset & 0xFFFF);
+    put16(table, offset >> 16);
+    put16(table, planeSize & 0xFFFF);
+    put16(table, planeSize >> 16);
+    for (int y = y0; y < y1; y++) {
+      const uint8_t *row = frames[f].data() + y * rowBytes + x0 / PPU * BPU;
+      body.insert(body.end(), row, row + rawdisp::bytesForPixels<F>(x1 - x0));
+    }
+  }
+
+  std::vector<uint8_t> out = {'R', 'D', 'A', 'N', 1, 1};
+  put16(out, n);
+  put16(out, w);
+  put16(out, h);
+  out.insert(out.end(), table.begin(), table.end());
+  out.insert(out.end(), body.begin(), body.end());
+  return out;
+}
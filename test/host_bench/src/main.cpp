@@ -0,0 +1,1143 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bmp/argb8888_le_240x240.hpp"
+#include "bmp/bw_hs_128x64.hpp"
+#include "bmp/i4_240x240.hpp"
+#include "bmp/kwr_hs_152x296.hpp"
+#include "bmp/kwr_hs_152x296_container.hpp"
+#include "bmp/kwry_hs_240x416.hpp"
+#include "bmp/rgb111_480x320.hpp"
+#include "bmp/rgb444_be_240x240.hpp"
+#include "encoders.hpp"
+#include "rawdisp/alpha_blend.hpp"
+#include "rawdisp/asset_container.hpp"
+#include "rawdisp/blit.hpp"
+#include "rawdisp/delta_player.hpp"
+#include "rawdisp/dither.hpp"
+#include "rawdisp/lz77_decoder.hpp"
+#include "rawdisp/palette_expander.hpp"
+#include "rawdisp/palette_lut.hpp"
+#include "rawdisp/pixel_pipeline.hpp"
+#include "rawdisp/pixel_stream.hpp"
+#include "rawdisp/rle_decoder.hpp"
+#include "rawdisp/spsc_ring.hpp"
+#include "rawdisp/task.hpp"
+#include "rawdisp/tile_map.hpp"
+
+struct Asset {
+  const char *name;
+  const uint8_t *data;
+  size_t size;
+};
+
+static const Asset ASSETS[] = {
+    {"argb8888_le_240x240", argb8888Le240x240, sizeof(argb8888Le240x240)},
+    {"rgb444_be_240x240", rgb444_be_240x240, sizeof(rgb444_be_240x240)},
+    {"rgb111_480x320", rgb111_480x320, sizeof(rgb111_480x320)},
+    {"kwr_hs_152x296_white", kwr_hs_152x296_white,
+     sizeof(kwr_hs_152x296_white)},
+    {"kwry_hs_240x416", kwry_hs_240x416, sizeof(kwry_hs_240x416)},
+    {"bw_hs_128x64", bw_hs_128x64, sizeof(bw_hs_128x64)},
+};
+
+// size of the staging buffer the decoder writes to
+static constexpr size_t CHUNK_SIZE = 512;
+static constexpr double MIN_BENCH_SEC = 0.2;
+
+// Decodes repeatedly, returns MB/s or a negative value on mismatch.
+template <typename TDecoder>
+static double benchDecode(const std::vector<uint8_t> &comp,
+                          const Asset &asset) {
+  static uint8_t out[CHUNK_SIZE];
+  using Clock = std::chrono::steady_clock;
+
+  // verify once
+  {
+    TDecoder dec(comp.data(), comp.size());
+    if (!dec.valid()) return -1;
+    size_t pos = 0, n;
+    while ((n = dec.read(out, CHUNK_SIZE)) > 0) {
+      if (pos + n > asset.size || memcmp(out, asset.data + pos, n) != 0) {
+        return -1;
+      }
+      pos += n;
+    }
+    if (pos != asset.size) return -1;
+  }
+
+  int iterations = 0;
+  double sec = 0;
+  Clock::time_point t0 = Clock::now();
+  while (sec < MIN_BENCH_SEC) {
+    TDecoder dec(comp.data(), comp.size());
+    while (dec.read(out, CHUNK_SIZE) > 0) {
+    }
+    iterations++;
+    sec = std::chrono::duration<double>(Clock::now() - t0).count();
+  }
+  return (double)asset.size * iterations / sec / 1e6;
+}
+
+static bool report(const char *method, const Asset &asset,
+                   const std::vector<uint8_t> &comp, double mbps) {
+  if (mbps < 0) {
+    printf("  %-14s MISMATCH\n", method);
+    return false;
+  }
+  printf("  %-14s %8zu bytes  x%5.2f  %8.1f MB/s\n", method, comp.size(),
+         (double)asset.size / comp.size(), mbps);
+  return true;
+}
+
+static bool benchCompression() {
+  printf("== compression (decode into %zu byte chunks)\n", CHUNK_SIZE);
+  bool ok = true;
+  for (const Asset &asset : ASSETS) {
+    printf("%s: %zu bytes\n", asset.name, asset.size);
+
+    std::vector<uint8_t> rle = encodeRle(asset.data, asset.size);
+    ok &= report("RLE", asset, rle,
+                 benchDecode<rawdisp::RleDecoder>(rle, asset));
+
+    for (int bits = 8; bits <= 12; bits += 2) {
+      char label[32];
+      snprintf(label, sizeof(label), "LZ77 %zuB", (size_t)1 << bits);
+      std::vector<uint8_t> lz = encodeLz77(asset.data, asset.size, bits);
+      ok &= report(label, asset, lz,
+                   benchDecode<rawdisp::Lz77Decoder<4096>>(lz, asset));
+    }
+  }
+  return ok;
+}
+
+// Expands pixel by pixel, as a reference for PaletteExpander.
+template <rawdisp::PixelFormat F, int INDEX_BITS>
+static std::vector<uint8_t> expandNaive(const uint8_t *src, size_t size,
+                                        const uint8_t *palette) {
+  using Traits = rawdisp::PixelFormatTraits<F>;
+  constexpr int PPB = INDEX_BITS > 4 ? 1 : 8 / INDEX_BITS;
+  std::vector<uint32_t> pixels;
+  for (size_t i = 0; i < size; i++) {
+    for (int j = 0; j < PPB; j++) {
+      int index = (src[i] >> ((PPB - 1 - j) * INDEX_BITS)) &
+                  ((1 << INDEX_BITS) - 1);
+      const uint8_t *c = palette + index * 3;
+      pixels.push_back(rawdisp::packRgb<F>(c[0], c[1], c[2]));
+    }
+  }
+  std::vector<uint8_t> out(rawdisp::bytesForPixels<F>(pixels.size()));
+  size_t pos = 0;
+  for (size_t i = 0; i < pixels.size(); i += Traits::PIXELS_PER_UNIT) {
+    int n = pixels.size() - i;
+    if (n > Traits::PIXELS_PER_UNIT) n = Traits::PIXELS_PER_UNIT;
+    pos += rawdisp::packUnit<F>(pixels.data() + i, n, out.data() + pos);
+  }
+  return out;
+}
+
+template <rawdisp::PixelFormat F, int INDEX_BITS>
+static bool benchExpand(const char *label, const uint8_t *src, size_t size,
+                        const uint8_t *palette, int numColors) {
+  using TExpander = rawdisp::PaletteExpander<F, INDEX_BITS>;
+  using Clock = std::chrono::steady_clock;
+  static TExpander expander(palette, numColors);
+  expander.setPalette(palette, numColors);
+
+  std::vector<uint8_t> ref = expandNaive<F, INDEX_BITS>(src, size, palette);
+  std::vector<uint8_t> out(TExpander::dstBytesFor(size));
+  size_t len = ref.size();
+
+  // same chunking as writeIndexedPixels(), from a word aligned copy and
+  // from one that is off by a byte
+  constexpr size_t SRC_CHUNK = TExpander::srcChunkFor(CHUNK_SIZE);
+  static uint8_t buff[CHUNK_SIZE];
+  std::vector<uint32_t> copy((size + 8) / 4);
+  uint8_t *aligned = reinterpret_cast<uint8_t *>(copy.data());
+  double mpps[2];
+  for (int offset = 0; offset < 2; offset++) {
+    uint8_t *s = aligned + offset;
+    memcpy(s, src, size);
+    if (expander.expand(s, size, out.data()) != len ||
+        memcmp(out.data(), ref.data(), len) != 0) {
+      printf("  %-16s MISMATCH (offset %d)\n", label, offset);
+      return false;
+    }
+    int iterations = 0;
+    double sec = 0;
+    Clock::time_point t0 = Clock::now();
+    while (sec < MIN_BENCH_SEC) {
+      for (size_t i = 0; i < size; i += SRC_CHUNK) {
+        size_t n = size - i < SRC_CHUNK ? size - i : SRC_CHUNK;
+        expander.expand(s + i, n, buff);
+      }
+      iterations++;
+      sec = std::chrono::duration<double>(Clock::now() - t0).count();
+    }
+    mpps[offset] = (double)size * TExpander::PIXELS_PER_BYTE * iterations /
+                   sec / 1e6;
+  }
+  printf("  %-16s %8zu -> %8zu bytes  %8.1f MPixel/s (unaligned %.1f)\n",
+         label, size, len, mpps[0], mpps[1]);
+  return true;
+}
+
+static bool benchPalette() {
+  using rawdisp::PixelFormat;
+  printf("== palette expansion\n");
+  const int numColors = sizeof(i4_240x240_palette) / 3;
+  bool ok = true;
+  ok &= benchExpand<PixelFormat::RGB444, 4>(
+      "I4 -> RGB444", i4_240x240, sizeof(i4_240x240), i4_240x240_palette,
+      numColors);
+  ok &= benchExpand<PixelFormat::RGB565, 4>(
+      "I4 -> RGB565", i4_240x240, sizeof(i4_240x240), i4_240x240_palette,
+      numColors);
+  ok &= benchExpand<PixelFormat::RGB666, 4>(
+      "I4 -> RGB666", i4_240x240, sizeof(i4_240x240), i4_240x240_palette,
+      numColors);
+
+  // one index per byte, packed in pairs for RGB444
+  std::vector<uint8_t> i8(sizeof(i4_240x240) * 2 + 1);
+  for (size_t i = 0; i < i8.size(); i++) {
+    i8[i] = (i4_240x240[i / 2 % sizeof(i4_240x240)] >> (i % 2 ? 0 : 4)) & 0xF;
+  }
+  ok &= benchExpand<PixelFormat::RGB444, 8>("I8 -> RGB444", i8.data(),
+                                            i8.size(), i4_240x240_palette,
+                                            numColors);
+  ok &= benchExpand<PixelFormat::RGB565, 8>("I8 -> RGB565", i8.data(),
+                                            i8.size(), i4_240x240_palette,
+                                            numColors);
+  return ok;
+}
+
+// Parses a container and checks the decoded planes against the plain
+// arrays of the same image.
+static bool checkContainer() {
+  using rawdisp::AssetContainer;
+  printf("== asset container\n");
+  AssetContainer asset(kwr_hs_152x296_container,
+                       sizeof(kwr_hs_152x296_container));
+  if (!asset.valid()) {
+    printf("  INVALID\n");
+    return false;
+  }
+  printf("  %dx%d, format %d, %d planes, %d colors, %zu bytes\n",
+         asset.width(), asset.height(), (int)asset.format(),
+         asset.numPlanes(), asset.paletteColors(), asset.size());
+  printf("  native to KR11: %s, RGB565: %s\n",
+         asset.isNativeTo(rawdisp::PixelFormat::KR11) ? "yes" : "no",
+         asset.isNativeTo(rawdisp::PixelFormat::RGB565) ? "yes" : "no");
+
+  const uint8_t *expected[] = {kwr_hs_152x296_white, kwr_hs_152x296_red};
+  bool allOk = true;
+  for (int i = 0; i < asset.numPlanes(); i++) {
+    AssetContainer::Plane p = asset.plane(i);
+    rawdisp::RleDecoder decoder(p.data, p.size);
+    std::vector<uint8_t> out(asset.decodedSize(i));
+    size_t n = decoder.read(out.data(), out.size());
+    bool ok = n == sizeof(kwr_hs_152x296_white) &&
+              memcmp(out.data(), expected[i], n) == 0;
+    printf("  plane \"%.*s\" (index %d): %zu -> %zu bytes, %s\n",
+           (int)p.idLength, p.id, p.layout.matchIndex,
+           p.size, n, ok ? "OK" : "MISMATCH");
+    allOk &= ok;
+  }
+
+  // truncated data must be rejected
+  AssetContainer truncated(kwr_hs_152x296_container,
+                           sizeof(kwr_hs_152x296_container) - 1);
+  printf("  truncated: %s\n", truncated.valid() ? "accepted" : "rejected");
+  return allOk && !truncated.valid();
+}
+
+// Builds a tile map from a plain asset, renders it back in bands and
+// compares with the original.
+template <rawdisp::PixelFormat F>
+static bool benchTiles(const char *label, const uint8_t *data, size_t size,
+                       int w, int h, int tileSize, bool allowFlip) {
+  using Clock = std::chrono::steady_clock;
+  TileSet set = buildTiles<F>(data, w, h, tileSize, allowFlip);
+  rawdisp::TileMap<F> tiles(set.bank.data(), set.bank.size(), set.map.data(),
+                            set.map.size(), tileSize, set.cols, set.rows);
+  if (!tiles.valid()) {
+    printf("  %-26s INVALID\n", label);
+    return false;
+  }
+
+  // band height as in writeTiles() with a 1 KB buffer
+  static uint8_t buff[1024];
+  const size_t rowBytes = tiles.rowBytes(tiles.cols);
+  const int bandRows = sizeof(buff) / rowBytes;
+  std::vector<uint8_t> out;
+  for (int y = 0; y < h; y += bandRows) {
+    int n = h - y < bandRows ? h - y : bandRows;
+    tiles.renderRows(0, tiles.cols, y, n, buff);
+    out.insert(out.end(), buff, buff + rowBytes * n);
+  }
+  if (out.size() != size || memcmp(out.data(), data, size) != 0) {
+    printf("  %-26s MISMATCH\n", label);
+    return false;
+  }
+
+  int iterations = 0;
+  double sec = 0;
+  Clock::time_point t0 = Clock::now();
+  while (sec < MIN_BENCH_SEC) {
+    for (int y = 0; y < h; y += bandRows) {
+      int n = h - y < bandRows ? h - y : bandRows;
+      tiles.renderRows(0, tiles.cols, y, n, buff);
+    }
+    iterations++;
+    sec = std::chrono::duration<double>(Clock::now() - t0).count();
+  }
+  size_t total = set.bank.size() + set.map.size();
+  printf("  %-26s %5d tiles  %7zu -> %7zu bytes (x%.2f)  %7.1f MPixel/s\n",
+         label, tiles.numTiles, size, total, (double)size / total,
+         (double)w * h * iterations / sec / 1e6);
+  return true;
+}
+
+static bool benchTileMaps() {
+  using rawdisp::PixelFormat;
+  printf("== tile map\n");
+
+  // UI-like screen: 32x32 buttons, each one symmetric
+  static uint8_t ui[480 * 320 / 2];
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 480; x++) {
+      int bx = x % 32 < 16 ? x % 32 : 31 - x % 32;
+      int by = y % 32 < 16 ? y % 32 : 31 - y % 32;
+      int c = bx < 2 || by < 2 ? 7 : (bx + by < 12 ? 1 : 6);
+      ui[(y * 480 + x) / 2] |= c << (x % 2 ? 0 : 3);
+    }
+  }
+  bool ok = true;
+  for (bool flip : {false, true}) {
+    printf(" %s\n", flip ? "with flips" : "no flips");
+    ok &= benchTiles<PixelFormat::RGB111>("ui_480x320 8x8", ui, sizeof(ui),
+                                          480, 320, 8, flip);
+    ok &= benchTiles<PixelFormat::BW>("bw_hs_128x64 8x8", bw_hs_128x64,
+                                      sizeof(bw_hs_128x64), 128, 64, 8, flip);
+    ok &= benchTiles<PixelFormat::KR11>("kwr_hs_152x296_white 8x8",
+                                        kwr_hs_152x296_white,
+                                        sizeof(kwr_hs_152x296_white), 152,
+                                        296, 8, flip);
+    ok &= benchTiles<PixelFormat::RGB111>("rgb111_480x320 8x8",
+                                          rgb111_480x320,
+                                          sizeof(rgb111_480x320), 480, 320,
+                                          8, flip);
+    ok &= benchTiles<PixelFormat::RGB111>("rgb111_480x320 16x16",
+                                          rgb111_480x320,
+                                          sizeof(rgb111_480x320), 480, 320,
+                                          16, flip);
+    ok &= benchTiles<PixelFormat::RGB444>("rgb444_be_240x240 8x8",
+                                          rgb444_be_240x240,
+                                          sizeof(rgb444_be_240x240), 240,
+                                          240, 8, flip);
+  }
+  return ok;
+}
+
+// Keeps what a display with horizontally packed memory would show.
+template <rawdisp::PixelFormat F>
+struct FakeDisplay {
+  static constexpr int PPU = rawdisp::PixelFormatTraits<F>::PIXELS_PER_UNIT;
+  static constexpr int BPU = rawdisp::PixelFormatTraits<F>::BYTES_PER_UNIT;
+  const int width;
+  const int height;
+  std::vector<uint8_t> memory;
+  int winX = 0, winY = 0, winW = 0;
+
+  FakeDisplay(int w, int h)
+      : width(w),
+        height(h),
+        memory(rawdisp::bytesForPixels<F>(w) * h) {}
+
+  void setWindow(int x, int y, int w, int h) {
+    winX = x;
+    winY = y;
+    winW = w;
+  }
+
+  void writePixels(const uint8_t *data, size_t length, int plane = 0) {
+    size_t rowBytes = rawdisp::bytesForPixels<F>(winW);
+    size_t stride = rawdisp::bytesForPixels<F>(width);
+    for (size_t i = 0; i * rowBytes < length; i++) {
+      memcpy(memory.data() + (winY + i) * stride + winX / PPU * BPU,
+             data + i * rowBytes, rowBytes);
+    }
+  }
+};
+
+// Encodes a bouncing box over the RGB444 image as a delta animation and
+// plays it back on a fake display, in order and with dropped frames.
+static bool checkDeltaAnimation() {
+  constexpr rawdisp::PixelFormat FMT = rawdisp::PixelFormat::RGB444;
+  constexpr int W = 240, H = 240, BOX = 32, NUM_FRAMES = 60;
+  printf("== delta animation\n");
+
+  std::vector<std::vector<uint8_t>> frames;
+  for (int f = 0; f < NUM_FRAMES; f++) {
+    std::vector<uint8_t> frame(rgb444_be_240x240,
+                               rgb444_be_240x240 + sizeof(rgb444_be_240x240));
+    int bx = (f * 6) % (W - BOX), by = 100;
+    uint32_t color = rawdisp::packRgb<FMT>(255, f * 4, 0);
+    for (int y = by; y < by + BOX; y++) {
+      for (int x = bx; x < bx + BOX; x += 2) {
+        uint32_t unit[2] = {color, color};
+        rawdisp::packUnit<FMT>(unit, 2, frame.data() + (y * W + x) * 3 / 2);
+      }
+    }
+    frames.push_back(frame);
+  }
+
+  std::vector<uint8_t> anim = encodeDeltaAnimation<FMT>(frames, W, H);
+  rawdisp::DeltaAnimation parsed(anim.data(), anim.size());
+  if (!parsed.valid()) {
+    printf("  INVALID\n");
+    return false;
+  }
+  size_t full = sizeof(rgb444_be_240x240) * NUM_FRAMES;
+  printf("  %d frames, %zu -> %zu bytes (x%.2f)\n", parsed.numFrames(), full,
+         anim.size(), (double)full / anim.size());
+
+  bool allOk = true;
+  for (int step : {1, 3, 7}) {
+    FakeDisplay<FMT> display(W, H);
+    rawdisp::DeltaPlayer<FakeDisplay<FMT>> player(display, parsed, 0, 0);
+    bool ok = true;
+    for (int f = 0; f < NUM_FRAMES * 2 && ok; f += step) {
+      player.seek(f);
+      ok = display.memory == frames[f % NUM_FRAMES];
+    }
+    printf("  every %d frame(s): %s, %llu bytes sent in %u draws\n", step,
+           ok ? "OK" : "MISMATCH", (unsigned long long)player.bytesSent,
+           (unsigned)player.framesDrawn);
+    allOk &= ok;
+  }
+
+  // truncated data must be rejected
+  rawdisp::DeltaAnimation truncated(anim.data(), anim.size() - 1);
+  printf("  truncated: %s\n", truncated.valid() ? "accepted" : "rejected");
+  return allOk && !truncated.valid();
+}
+
+// Reads pixel i of a row packed in the layout of F. Only the bytes up to
+// that pixel are read, the row may end in a partial unit.
+template <rawdisp::PixelFormat F>
+static uint32_t getPixel(const uint8_t *row, int i) {
+  using T = rawdisp::PixelFormatTraits<F>;
+  int k = i % T::PIXELS_PER_UNIT;
+  uint8_t bytes[T::BYTES_PER_UNIT] = {};
+  memcpy(bytes, row + i / T::PIXELS_PER_UNIT * T::BYTES_PER_UNIT,
+         rawdisp::bytesForPixels<F>(k + 1));
+  uint32_t unit[T::PIXELS_PER_UNIT];
+  rawdisp::unpackUnit<F>(bytes, unit);
+  return unit[k];
+}
+
+// Blits one plane of a random sprite at random positions and clip rects
+// onto a pixel array as a display would place the stream, and compares
+// with a per pixel reference. Then times a sprite sliding across the left
+// edge against sending the whole sprite every frame.
+template <rawdisp::PixelFormat F>
+static bool checkBlit(const char *label, bool padRows) {
+  using T = rawdisp::PixelFormatTraits<F>;
+  constexpr int SW = 320, SH = 240, MAX_SPRITE = 80;
+  constexpr int BITS = T::BITS_PER_PIXEL / T::NUM_PLANES;
+  constexpr uint32_t MASK = (1ull << T::PIXEL_STRIDE) - 1;
+  std::mt19937 rng(1234);
+  // an odd buffer size to carry partial bytes between reads
+  static uint8_t buff[61];
+
+  bool ok = true;
+  size_t pixelsSent = 0, bytesSent = 0;
+  for (int iter = 0; iter < 2000 && ok; iter++) {
+    int w = 1 + rng() % MAX_SPRITE, h = 1 + rng() % MAX_SPRITE;
+    int stride = rawdisp::bytesForPixels<F>(w);
+    std::vector<uint8_t> sprite(stride * h);
+    for (int y = 0; y < h; y++) {
+      for (int x = 0; x < w; x += T::PIXELS_PER_UNIT) {
+        uint32_t unit[T::PIXELS_PER_UNIT];
+        for (auto &p : unit) p = rng() & MASK;
+        rawdisp::packUnit<F>(unit, w - x, sprite.data() + y * stride +
+                                              x / T::PIXELS_PER_UNIT *
+                                                  T::BYTES_PER_UNIT);
+      }
+    }
+    int x = (int)(rng() % (SW + 2 * w)) - w;
+    int y = (int)(rng() % (SH + 2 * h)) - h;
+    int cx = rng() % SW, cy = rng() % SH;
+    int cw = 1 + rng() % (SW - cx), ch = 1 + rng() % (SH - cy);
+    if (padRows) {
+      // byte addressed displays need the window on whole bytes
+      x = x / T::PIXELS_PER_UNIT * T::PIXELS_PER_UNIT;
+      cx = cx / T::PIXELS_PER_UNIT * T::PIXELS_PER_UNIT;
+      cw = SW - cx;
+    }
+    rawdisp::BlitRect r = rawdisp::clipBlit(x, y, w, h, cx, cy, cw, ch);
+
+    std::vector<uint8_t> stream;
+    if (!r.empty()) {
+      rawdisp::BlitReader<F> reader(sprite.data(), stride, r, padRows);
+      size_t n;
+      while ((n = reader.read(buff, sizeof(buff))) > 0) {
+        stream.insert(stream.end(), buff, buff + n);
+      }
+    }
+    size_t rowBytes = rawdisp::bytesForPixels<F>(r.width);
+    size_t expected = r.empty() ? 0
+                      : padRows ? rowBytes * r.height
+                                : rawdisp::bytesForPixels<F>(
+                                      (size_t)r.width * r.height);
+    if (stream.size() != expected) {
+      ok = false;
+      break;
+    }
+    for (int iy = 0; iy < r.height && ok; iy++) {
+      for (int ix = 0; ix < r.width && ok; ix++) {
+        uint32_t got =
+            padRows ? getPixel<F>(stream.data() + iy * rowBytes, ix)
+                    : getPixel<F>(stream.data(), iy * r.width + ix);
+        uint32_t ref = getPixel<F>(
+            sprite.data() + (r.srcY + iy) * stride, r.srcX + ix);
+        ok = got == ref;
+      }
+    }
+    // padding bits are cleared
+    if (ok && !r.empty()) {
+      size_t bits = padRows ? (size_t)r.width * BITS
+                            : (size_t)r.width * r.height * BITS;
+      uint8_t pad = F == rawdisp::PixelFormat::RGB111 ? 0xC7
+                                                      : 0xFF >> (bits & 7);
+      if (bits & 7) ok = (stream[expected - 1] & pad) == 0;
+    }
+    pixelsSent += (size_t)r.width * r.height;
+    bytesSent += stream.size();
+  }
+  if (!ok) {
+    printf("  %-26s MISMATCH\n", label);
+    return false;
+  }
+
+  // 64x64 sprite sliding out over the left edge, one pixel per frame
+  constexpr int SPRITE = 64;
+  std::vector<uint8_t> sprite(rawdisp::bytesForPixels<F>(SPRITE) * SPRITE,
+                              0x5A);
+  using Clock = std::chrono::steady_clock;
+  size_t visible = 0;
+  int iterations = 0;
+  double sec = 0;
+  Clock::time_point t0 = Clock::now();
+  while (sec < MIN_BENCH_SEC) {
+    for (int x = 0; x > -SPRITE; x--) {
+      rawdisp::BlitRect r = rawdisp::clipBlit(x, 0, SPRITE, SPRITE, 0, 0, SW,
+                                              SH);
+      rawdisp::BlitReader<F> reader(sprite.data(),
+                                    rawdisp::bytesForPixels<F>(SPRITE), r,
+                                    padRows);
+      while (reader.read(buff, sizeof(buff)) > 0) {
+      }
+      if (iterations == 0) visible += (size_t)r.width * r.height;
+    }
+    iterations++;
+    sec = std::chrono::duration<double>(Clock::now() - t0).count();
+  }
+  printf("  %-26s OK  %5.1f bits/px  slide %4.1f%% of full  %7.1f MPixel/s\n",
+         label, pixelsSent ? 8.0 * bytesSent / pixelsSent : 0.0,
+         100.0 * visible / (SPRITE * SPRITE * SPRITE),
+         (double)visible * iterations / sec / 1e6);
+  return true;
+}
+
+static bool checkBlits() {
+  using rawdisp::PixelFormat;
+  printf("== clipped blit\n");
+  bool ok = true;
+  ok &= checkBlit<PixelFormat::RGB111>("RGB111", false);
+  ok &= checkBlit<PixelFormat::RGB444>("RGB444", false);
+  ok &= checkBlit<PixelFormat::RGB565>("RGB565", false);
+  ok &= checkBlit<PixelFormat::RGB666>("RGB666", false);
+  ok &= checkBlit<PixelFormat::KR11>("KR11 (byte addressed)", true);
+  ok &= checkBlit<PixelFormat::BW>("BW", false);
+  ok &= checkBlit<PixelFormat::BW>("BW (byte addressed)", true);
+  return ok;
+}
+
+// Reference blend in floating point, returns a destination pixel value.
+template <rawdisp::PixelFormat F>
+static uint32_t blendReference(uint32_t argb, uint32_t dst, bool premul) {
+  using T = rawdisp::PixelFormatTraits<F>;
+  const int bits[3] = {T::R_BITS, T::G_BITS, T::B_BITS};
+  const int shifts[3] = {T::R_SHIFT, T::G_SHIFT, T::B_SHIFT};
+  double a = (argb >> 24) / 255.0;
+  uint32_t out = 0;
+  for (int c = 0; c < 3; c++) {
+    double mx = (1 << bits[c]) - 1;
+    // source channels truncated to the destination width
+    double s = (((argb >> (16 - 8 * c)) & 0xFF) >> (8 - bits[c])) / mx;
+    double d = ((dst >> shifts[c]) & (uint32_t)mx) / mx;
+    double v = premul ? s + d * (1 - a) : s * a + d * (1 - a);
+    out |= (uint32_t)lround(fmin(v, 1.0) * mx) << shifts[c];
+  }
+  return out;
+}
+
+// Largest channel difference between two pixel values of F.
+template <rawdisp::PixelFormat F>
+static int channelError(uint32_t p, uint32_t q) {
+  using T = rawdisp::PixelFormatTraits<F>;
+  const int bits[3] = {T::R_BITS, T::G_BITS, T::B_BITS};
+  const int shifts[3] = {T::R_SHIFT, T::G_SHIFT, T::B_SHIFT};
+  int worst = 0;
+  for (int c = 0; c < 3; c++) {
+    int m = (1 << bits[c]) - 1;
+    int e = abs((int)((p >> shifts[c]) & m) - (int)((q >> shifts[c]) & m));
+    if (e > worst) worst = e;
+  }
+  return worst;
+}
+
+// Checks the blend against the reference on random pixels, then blends
+// the ARGB8888 image over a checkerboard row by row.
+template <rawdisp::PixelFormat F, bool PREMULTIPLIED>
+static bool benchBlend(const char *label) {
+  using T = rawdisp::PixelFormatTraits<F>;
+  constexpr int W = 240, H = 240;
+  constexpr size_t ROW_BYTES = rawdisp::bytesForPixels<F>(W);
+  std::mt19937 rng(5678);
+
+  // mixed spans of transparent, opaque and translucent pixels, odd width
+  // for the last single pixel
+  constexpr int N = 4095;
+  std::vector<uint8_t> src(N * 4 + 1), dst(rawdisp::bytesForPixels<F>(N));
+  std::vector<uint32_t> srcPx(N), dstPx(N);
+  for (int i = 0; i < N; i++) {
+    int kind = (i / 7) % 3;
+    uint32_t a = kind == 0 ? 0 : kind == 1 ? 255 : rng() & 0xFF;
+    uint32_t rgb = rng() & 0xFFFFFF;
+    if (PREMULTIPLIED) {
+      uint32_t r = ((rgb >> 16) & 0xFF) * a / 255;
+      uint32_t g = ((rgb >> 8) & 0xFF) * a / 255;
+      uint32_t b = (rgb & 0xFF) * a / 255;
+      rgb = (r << 16) | (g << 8) | b;
+    }
+    srcPx[i] = (a << 24) | rgb;
+    dstPx[i] = rng() & ((1u << T::BITS_PER_PIXEL) - 1);
+  }
+  for (int i = 0; i < N; i++) {
+    // offset by one byte for the unaligned path
+    for (int k = 0; k < 4; k++) src[1 + i * 4 + k] = srcPx[i] >> (8 * k);
+    if (i % T::PIXELS_PER_UNIT == 0) {
+      rawdisp::packUnit<F>(&dstPx[i], N - i,
+                           dst.data() + i / T::PIXELS_PER_UNIT *
+                                            T::BYTES_PER_UNIT);
+    }
+  }
+  size_t tail = dst.size();
+  dst.push_back(0xA5);
+  rawdisp::blendArgb8888<F, PREMULTIPLIED>(src.data() + 1, dst.data(), N);
+  int worst = 0;
+  for (int i = 0; i < N; i++) {
+    uint32_t got = getPixel<F>(dst.data(), i);
+    uint32_t ref = blendReference<F>(srcPx[i], dstPx[i], PREMULTIPLIED);
+    int e = channelError<F>(got, ref);
+    if (e > worst) worst = e;
+  }
+  if (worst > 1 || dst[tail] != 0xA5) {
+    printf("  %-26s MISMATCH (error %d)\n", label, worst);
+    return false;
+  }
+
+  // checkerboard background as in the demo
+  static uint8_t board[ROW_BYTES * H], rows[ROW_BYTES * H];
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x += 2) {
+      uint32_t c = ((x / 16 + y / 16) & 1)
+                       ? rawdisp::packRgb<F>(255, 255, 255)
+                       : rawdisp::packRgb<F>(192, 192, 192);
+      uint32_t pair[2] = {c, c};
+      // a pair is one unit of RGB444 or two of RGB565
+      for (int k = 0; k < 2; k += T::PIXELS_PER_UNIT) {
+        rawdisp::packUnit<F>(pair + k, 2 - k,
+                             board + y * ROW_BYTES +
+                                 (x + k) / T::PIXELS_PER_UNIT *
+                                     T::BYTES_PER_UNIT);
+      }
+    }
+  }
+  using Clock = std::chrono::steady_clock;
+  int iterations = 0;
+  double sec = 0;
+  Clock::time_point t0 = Clock::now();
+  while (sec < MIN_BENCH_SEC) {
+    memcpy(rows, board, sizeof(rows));
+    for (int y = 0; y < H; y++) {
+      rawdisp::blendArgb8888<F, PREMULTIPLIED>(
+          argb8888Le240x240 + y * W * 4, rows + y * ROW_BYTES, W);
+    }
+    iterations++;
+    sec = std::chrono::duration<double>(Clock::now() - t0).count();
+  }
+  printf("  %-26s OK (error <= %d)  %7.1f MPixel/s\n", label, worst,
+         (double)W * H * iterations / sec / 1e6);
+  return true;
+}
+
+static bool benchBlends() {
+  using rawdisp::PixelFormat;
+  printf("== alpha blend (argb8888_le_240x240 over checkerboard)\n");
+  bool ok = true;
+  ok &= benchBlend<PixelFormat::RGB565, false>("ARGB8888 -> RGB565");
+  ok &= benchBlend<PixelFormat::RGB444, false>("ARGB8888 -> RGB444");
+  ok &= benchBlend<PixelFormat::RGB565, true>("premultiplied -> RGB565");
+  ok &= benchBlend<PixelFormat::RGB444, true>("premultiplied -> RGB444");
+  return ok;
+}
+
+// Dithers a horizontal gray ramp to black and white with full strength
+// and compares the mean of every 16x16 block with the source, which must
+// stay within `maxError`, then times the RGB444 image dithered to
+// black/white/red.
+static bool benchDither(const char *label, rawdisp::DitherMethod method,
+                        rawdisp::DiffusionKernel kernel, double maxError) {
+  constexpr int W = 256, H = 64, BLOCK = 16;
+  static const uint8_t BW[] = {0, 0, 0, 255, 255, 255};
+  static const uint8_t KWR[] = {0, 0, 0, 255, 255, 255, 0xCC, 0, 0};
+
+  rawdisp::Ditherer<W> bw(BW, 2, W, method, kernel, 256);
+  static uint8_t rgb[W * 3], packed[W / 8];
+  static uint8_t out[H][W];
+  for (int x = 0; x < W; x++) {
+    rgb[x * 3] = rgb[x * 3 + 1] = rgb[x * 3 + 2] = x;
+  }
+  for (int y = 0; y < H; y++) {
+    const uint8_t *idx = bw.ditherRow(rgb);
+    memcpy(out[y], idx, W);
+    // the packed form holds the same indices
+    rawdisp::packIndices<1>(idx, W, packed);
+    for (int x = 0; x < W; x++) {
+      if (((packed[x / 8] >> (7 - x % 8)) & 1) != idx[x]) {
+        printf("  %-26s PACK MISMATCH\n", label);
+        return false;
+      }
+    }
+  }
+  double worst = 0;
+  for (int by = 0; by < H; by += BLOCK) {
+    for (int bx = 0; bx < W; bx += BLOCK) {
+      double sum = 0, ref = 0;
+      for (int y = by; y < by + BLOCK; y++) {
+        for (int x = bx; x < bx + BLOCK; x++) {
+          sum += out[y][x] * 255;
+          ref += x;
+        }
+      }
+      double d = fabs(sum - ref) / (BLOCK * BLOCK);
+      if (d > worst) worst = d;
+    }
+  }
+
+  // RGB444 image as RGB888 rows
+  constexpr int IW = 240, IH = 240;
+  static uint8_t image[IH][IW * 3];
+  for (int y = 0; y < IH; y++) {
+    for (int x = 0; x < IW; x++) {
+      uint32_t c = getPixel<rawdisp::PixelFormat::RGB444>(
+          rgb444_be_240x240 + y * IW * 3 / 2, x);
+      image[y][x * 3 + 0] = ((c >> 8) & 0xF) * 17;
+      image[y][x * 3 + 1] = ((c >> 4) & 0xF) * 17;
+      image[y][x * 3 + 2] = (c & 0xF) * 17;
+    }
+  }
+  rawdisp::Ditherer<IW> kwr(KWR, 3, IW, method, kernel);
+  static uint8_t white[IW / 8], red[IW / 8];
+  using Clock = std::chrono::steady_clock;
+  int iterations = 0;
+  double sec = 0;
+  Clock::time_point t0 = Clock::now();
+  while (sec < MIN_BENCH_SEC) {
+    kwr.reset();
+    for (int y = 0; y < IH; y++) {
+      kwr.ditherRowKr11(image[y], white, red);
+    }
+    iterations++;
+    sec = std::chrono::duration<double>(Clock::now() - t0).count();
+  }
+  printf("  %-26s ramp error %5.1f / 255  KWR %6.1f MPixel/s%s\n", label,
+         worst, (double)IW * IH * iterations / sec / 1e6,
+         worst > maxError ? "  TOO LARGE" : "");
+  return worst <= maxError;
+}
+
+static bool benchDithers() {
+  using rawdisp::DiffusionKernel;
+  using rawdisp::DitherMethod;
+  printf("== dither (16x16 block mean of a gray ramp to BW, 240x240 to KWR)\n");
+  // without dithering the ramp is only thresholded
+  constexpr double MAX_ERROR = 8;
+  bool ok = true;
+  ok &= benchDither("none", DitherMethod::NONE, DiffusionKernel::STUCKI, 128);
+  ok &= benchDither("pattern 4x4", DitherMethod::PATTERN,
+                    DiffusionKernel::STUCKI, MAX_ERROR);
+  ok &= benchDither("Floyd-Steinberg", DitherMethod::DIFFUSION,
+                    DiffusionKernel::FLOYD_STEINBERG, MAX_ERROR);
+  ok &= benchDither("Jarvis-Judice-Ninke", DitherMethod::DIFFUSION,
+                    DiffusionKernel::JARVIS_JUDICE_NINKE, MAX_ERROR);
+  ok &= benchDither("Stucki", DitherMethod::DIFFUSION, DiffusionKernel::STUCKI,
+                    MAX_ERROR);
+  ok &= benchDither("Sierra", DitherMethod::DIFFUSION, DiffusionKernel::SIERRA,
+                    MAX_ERROR);
+  return ok;
+}
+
+static int nearestColor(const uint8_t *palette, int numColors, int r, int g,
+                        int b) {
+  int best = 0;
+  int32_t bestDist = INT32_MAX;
+  for (int i = 0; i < numColors; i++) {
+    int dr = r - palette[i * 3], dg = g - palette[i * 3 + 1],
+        db = b - palette[i * 3 + 2];
+    int32_t dist = dr * dr + dg * dg + db * db;
+    if (dist < bestDist) {
+      bestDist = dist;
+      best = i;
+    }
+  }
+  return best;
+}
+
+// Builds the RGB565 LUT of a panel palette, checks every key against a
+// linear search and times the conversion of the RGB444 image, widened to
+// RGB565, against the search per pixel.
+template <int ENTRY_BITS>
+static bool benchPaletteLut(const char *label, const uint8_t *palette,
+                            int numColors) {
+  using Lut = rawdisp::Rgb565PaletteLut<ENTRY_BITS>;
+  using Clock = std::chrono::steady_clock;
+  static uint8_t table[Lut::SIZE];
+  Clock::time_point t0 = Clock::now();
+  Lut::build(palette, numColors, table);
+  double buildMs =
+      std::chrono::duration<double>(Clock::now() - t0).count() * 1e3;
+  Lut lut(table);
+  for (uint32_t c = 0; c < Lut::NUM_KEYS; c++) {
+    int r = ((c >> 11) << 3) | (c >> 13);
+    int g = (((c >> 5) & 0x3F) << 2) | ((c >> 9) & 3);
+    int b = ((c & 0x1F) << 3) | ((c >> 2) & 7);
+    if (lut.lookup(c) != nearestColor(palette, numColors, r, g, b)) {
+      printf("  %-26s MISMATCH at 0x%04X\n", label, (unsigned)c);
+      return false;
+    }
+  }
+
+  constexpr int W = 240, H = 240;
+  static uint8_t fb[W * H * 2], indices[W * H];
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++) {
+      uint32_t c = getPixel<rawdisp::PixelFormat::RGB444>(
+          rgb444_be_240x240 + y * W * 3 / 2, x);
+      uint32_t r = (c >> 8) & 0xF, g = (c >> 4) & 0xF, b = c & 0xF;
+      uint32_t v = (r << 12) | (r << 7) | (g << 7) | (g << 3) | (b << 1) |
+                   (b >> 3);
+      fb[(y * W + x) * 2] = v >> 8;
+      fb[(y * W + x) * 2 + 1] = v;
+    }
+  }
+  // the packed forms hold the same indices
+  lut.quantize(fb, W * H, indices);
+  static uint8_t packed[W * H / 2], ref[W * H / 2], white[W / 8],
+      red[W / 8], refWhite[W / 8], refRed[W / 8];
+  lut.template quantize<4>(fb, W * H, packed);
+  rawdisp::packIndices<4>(indices, W * H, ref);
+  lut.quantizeKr11(fb, W, white, red);
+  rawdisp::packIndexMatch(indices, W, 1, refWhite);
+  rawdisp::packIndexMatch(indices, W, 2, refRed);
+  if (memcmp(packed, ref, sizeof(ref)) || memcmp(white, refWhite, W / 8) ||
+      memcmp(red, refRed, W / 8)) {
+    printf("  %-26s PACK MISMATCH\n", label);
+    return false;
+  }
+
+  double lutSec = 0, searchSec = 0;
+  int lutIter = 0, searchIter = 0;
+  t0 = Clock::now();
+  while (lutSec < MIN_BENCH_SEC) {
+    lut.quantize(fb, W * H, indices);
+    lutIter++;
+    lutSec = std::chrono::duration<double>(Clock::now() - t0).count();
+  }
+  t0 = Clock::now();
+  while (searchSec < MIN_BENCH_SEC) {
+    for (int i = 0; i < W * H; i++) {
+      uint32_t v = (fb[i * 2] << 8) | fb[i * 2 + 1];
+      int r = ((v >> 11) << 3) | (v >> 13);
+      int g = (((v >> 5) & 0x3F) << 2) | ((v >> 9) & 3);
+      int b = ((v & 0x1F) << 3) | ((v >> 2) & 7);
+      indices[i] = nearestColor(palette, numColors, r, g, b);
+    }
+    searchIter++;
+    searchSec = std::chrono::duration<double>(Clock::now() - t0).count();
+  }
+  printf("  %-26s %3zu KiB build %5.1f ms  LUT %7.1f  search %6.1f MPixel/s\n",
+         label, Lut::SIZE / 1024, buildMs,
+         (double)W * H * lutIter / lutSec / 1e6,
+         (double)W * H * searchIter / searchSec / 1e6);
+  return true;
+}
+
+static bool benchPaletteLuts() {
+  static const uint8_t KWR[] = {0, 0, 0, 255, 255, 255, 0xCC, 0, 0};
+  static const uint8_t KWRY[] = {0,    0, 0, 255, 255, 255,
+                                 255, 255, 0, 0xCC, 0,   0};
+  static const uint8_t KWYRBG[] = {0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+                                   0xFD, 0xC8, 0x11, 0xD3, 0x37, 0x11,
+                                   0x33, 0x42, 0x6F, 0x40, 0x71, 0x13};
+  printf("== RGB565 palette LUT (all keys checked, 240x240 converted)\n");
+  bool ok = true;
+  ok &= benchPaletteLut<4>("KWR", KWR, 3);
+  ok &= benchPaletteLut<4>("KWRY", KWRY, 4);
+  ok &= benchPaletteLut<4>("KWYRBG", KWYRBG, 6);
+  ok &= benchPaletteLut<8>("KWYRBG, 8 bit entries", KWYRBG, 6);
+  return ok;
+}
+
+// Records what a pipeline sends to the display.
+struct RecordingSink {
+  std::vector<uint8_t> data;
+  int plane = -1;
+  int numEnds = 0;
+
+  void setWindow(int x, int y, int w, int h) {}
+  void beginPixels(int plane) {
+    this->plane = plane;
+    data.clear();
+  }
+  void pushPixels(const void *p, size_t length) {
+    const uint8_t *b = static_cast<const uint8_t *>(p);
+    data.insert(data.end(), b, b + length);
+  }
+  void endPixels() { numEnds++; }
+};
+
+static uint8_t counterByte(size_t i) { return (i * 7) ^ (i >> 8); }
+
+struct CounterSource {
+  size_t pos;
+  size_t total;
+};
+
+// chunks of uneven length, so they don't line up with the ring slots
+static size_t produceCounter(void *ctx, uint8_t *buf, size_t capacity) {
+  CounterSource *src = static_cast<CounterSource *>(ctx);
+  size_t n = src->total - src->pos;
+  size_t limit = capacity - src->pos % 7;
+  if (n > limit) n = limit;
+  for (size_t i = 0; i < n; i++) buf[i] = counterByte(src->pos + i);
+  src->pos += n;
+  return n;
+}
+
+// Passes a counter through SpscRing from a second thread, many times
+// around the ring, then streams a byte pattern through PixelPipeline with
+// the producer on a thread.
+static bool checkPipeline() {
+  printf("== SPSC ring / pixel pipeline\n");
+  constexpr uint32_t COUNT = 100000;
+  static rawdisp::SpscRing<uint32_t, 4> ring;
+  std::thread producer([]() {
+    for (uint32_t i = 0; i < COUNT; i++) {
+      uint32_t *slot;
+      while (!(slot = ring.acquire())) {
+        rawdisp::multicore::relax();
+      }
+      *slot = i;
+      ring.commit();
+    }
+  });
+  bool ringOk = true;
+  for (uint32_t expected = 0; expected < COUNT;) {
+    uint32_t *slot = ring.peek();
+    if (!slot) {
+      rawdisp::multicore::relax();
+      continue;
+    }
+    ringOk &= *slot == expected && ring.size() <= ring.CAPACITY;
+    ring.release();
+    expected++;
+  }
+  producer.join();
+  ringOk &= ring.size() == 0 && ring.peek() == nullptr;
+  printf("  ring x%zu, %u values: %s\n", ring.CAPACITY, (unsigned)COUNT,
+         ringOk ? "OK" : "MISMATCH");
+
+  static rawdisp::PixelPipeline<256, 4> pipeline;
+  RecordingSink sink;
+  bool pipeOk = true;
+  for (size_t total : {(size_t)0, (size_t)1, (size_t)256, (size_t)100000}) {
+    CounterSource src = {0, total};
+    int ends = sink.numEnds;
+    pipeline.run(sink, produceCounter, &src, 1);
+    bool ok = sink.data.size() == total && sink.plane == 1 &&
+              sink.numEnds == ends + 1;
+    for (size_t i = 0; ok && i < total; i++) {
+      ok = sink.data[i] == counterByte(i);
+    }
+    printf("  pipeline %6zu bytes in %4u chunks: %s\n", total,
+           (unsigned)pipeline.stats.chunks, ok ? "OK" : "MISMATCH");
+    pipeOk &= ok;
+  }
+  return ringOk && pipeOk;
+}
+
+// Pushes random pixels through PixelStream in chunks of random length, as
+// single pixels, pixel arrays and packed data, so that chunks start and end
+// in the middle of units and the staging buffer. Packed chunks are copied
+// to buffers of exactly bytesForPixels() bytes.
+template <rawdisp::PixelFormat F>
+static bool checkPixelStream(const char *label) {
+  using Traits = rawdisp::PixelFormatTraits<F>;
+  constexpr int PPU = Traits::PIXELS_PER_UNIT;
+  constexpr uint32_t MASK = (1ull << Traits::PIXEL_STRIDE) - 1;
+  constexpr size_t N = 10007;
+  std::mt19937 rng(1);
+  std::vector<uint32_t> pixels(N);
+  for (uint32_t &p : pixels) p = rng() & MASK;
+  std::vector<uint8_t> ref(rawdisp::bytesForPixels<F>(N));
+  for (size_t i = 0; i < N; i += PPU) {
+    int n = N - i < (size_t)PPU ? N - i : PPU;
+    rawdisp::packUnit<F>(pixels.data() + i, n,
+                         ref.data() + i / PPU * Traits::BYTES_PER_UNIT);
+  }
+
+  bool ok = true;
+  for (int trial = 0; trial < 50 && ok; trial++) {
+    RecordingSink sink;
+    {
+      rawdisp::PixelStream<F, 16, RecordingSink> stream(sink, 0, 0, N, 1);
+      size_t pos = 0;
+      while (pos < N) {
+        size_t n = rng() % 20;
+        if (n > N - pos) n = N - pos;
+        switch (rng() % 3) {
+          case 0:
+            for (size_t i = 0; i < n; i++) stream.push(pixels[pos + i]);
+            break;
+          case 1:
+            stream.push(pixels.data() + pos, n);
+            break;
+          default: {
+            std::vector<uint8_t> packed(rawdisp::bytesForPixels<F>(n));
+            for (size_t i = 0; i < n; i += PPU) {
+              int k = n - i < (size_t)PPU ? n - i : PPU;
+              rawdisp::packUnit<F>(pixels.data() + pos + i, k,
+                                   packed.data() + i / PPU *
+                                                       Traits::BYTES_PER_UNIT);
+            }
+            stream.pushPacked(packed.data(), n);
+            break;
+          }
+        }
+        pos += n;
+      }
+      ok = stream.pixelsPushed() == N;
+    }
+    ok &= sink.data == ref && sink.numEnds == 1;
+  }
+  printf("  %-26s %s\n", label, ok ? "OK" : "MISMATCH");
+  return ok;
+}
+
+static bool checkPixelStreams() {
+  using rawdisp::PixelFormat;
+  printf("== pixel stream (random chunks, 16 byte staging buffer)\n");
+  bool ok = true;
+  ok &= checkPixelStream<PixelFormat::RGB111>("RGB111");
+  ok &= checkPixelStream<PixelFormat::RGB444>("RGB444");
+  ok &= checkPixelStream<PixelFormat::RGB565>("RGB565");
+  ok &= checkPixelStream<PixelFormat::BW>("BW");
+  return ok;
+}
+
+static rawdisp::Task sleepingTask(std::string &log, char name, uint32_t ms) {
+  log += name;
+  co_await rawdisp::sleepMs(ms);
+  log += name - 'a' + 'A';
+}
+
+static rawdisp::Task settingTask(std::string &log, bool &flag) {
+  log += 'b';
+  co_await rawdisp::sleepMs(5);
+  flag = true;
+  log += 'B';
+}
+
+static rawdisp::Task waitingChild(std::string &log, const bool &flag) {
+  log += 'd';
+  co_await rawdisp::waitUntil([&flag]() { return flag; });
+  log += 'D';
+}
+
+static rawdisp::Task parentTask(std::string &log, const bool &flag) {
+  log += 'c';
+  co_await waitingChild(log, flag);
+  log += 'C';
+}
+
+// Runs tasks that sleep, wait for a flag set by another task and await a
+// child task, and checks the order they resume in and the time taken.
+static bool checkScheduler() {
+  printf("== task scheduler\n");
+  std::string log;
+  bool flag = false;
+  rawdisp::Scheduler sched;
+  sched.spawn(sleepingTask(log, 'a', 20));
+  sched.spawn(settingTask(log, flag));
+  sched.spawn(parentTask(log, flag));
+  uint64_t t0 = rawdisp::timer::nowUs();
+  sched.run();
+  uint32_t ms = rawdisp::timer::elapsedMs(t0);
+  bool orderOk = log == "abcdBDCA";
+  printf("  %-26s %s\n", ("run order " + log).c_str(),
+         orderOk ? "OK" : "MISMATCH");
+  bool timeOk = ms >= 20 && ms < 200;
+  char label[32];
+  snprintf(label, sizeof(label), "finished in %u ms", (unsigned)ms);
+  printf("  %-26s %s\n", label, timeOk ? "OK" : "MISMATCH");
+
+  int spawned = 0;
+  while (sched.spawn(sleepingTask(log, 'a', 0))) spawned++;
+  bool fullOk = spawned == rawdisp::Scheduler::MAX_TASKS;
+  sched.run();
+  snprintf(label, sizeof(label), "%d of %d slots taken", spawned,
+           rawdisp::Scheduler::MAX_TASKS);
+  printf("  %-26s %s\n", label, fullOk ? "OK" : "MISMATCH");
+  return orderOk && timeOk && fullOk;
+}
+
+// Exits with 1 when any check fails so that it can gate a build.
+int main() {
+  bool ok = true;
+  ok &= checkPipeline();
+  ok &= checkPixelStreams();
+  ok &= checkScheduler();
+  ok &= benchCompression();
+  ok &= benchPalette();
+  ok &= checkContainer();
+  ok &= benchTileMaps();
+  ok &= checkDeltaAnimation();
+  ok &= checkBlits();
+  ok &= benchBlends();
+  ok &= benchDithers();
+  ok &= benchPaletteLuts();
+  if (!ok) printf("FAILED\n");
+  return ok ? 0 : 1;
+}
@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 // 128x64px, B/W
 // MSB First, Horizontal Packing, Horizontal Adressing
 // 1024 Bytes
@@ -71,3 +73,30 @@ const uint8_t bw_hs_128x64[] = {
   0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0xf3, 0x09, 0x00, 0x02, 0x00,
   0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xf4, 0x22, 0x00, 0x00, 0x00,
 };
+
+constexpr rawdisp::AssetDesc bw_hs_128x64_desc = {
+  .width = 128,
+  .height = 64,
+  .format = rawdisp::AssetFormat::BW,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "color",
+      .data = bw_hs_128x64,
+      .size = sizeof(bw_hs_128x64),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 1,
+        .pixelsPerFrag = 8,
+        .bytesPerFrag = 1,
+      },
+      .stride = 16,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
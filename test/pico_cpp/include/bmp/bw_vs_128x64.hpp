@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 // 128x64px, B/W
 // LSB First, Vertical Packing, Horizontal Adressing
 // 1024 Bytes
@@ -71,3 +73,30 @@ const uint8_t bw_vs_128x64[] = {
   0x2f, 0x03, 0xa3, 0x09, 0x54, 0x20, 0x85, 0x40, 0x29, 0x00, 0x00, 0x24, 0x00, 0x01, 0x24, 0x00,
   0x10, 0x02, 0x00, 0x08, 0x00, 0x02, 0x40, 0x10, 0x00, 0x00, 0x24, 0x00, 0x00, 0x08, 0x02, 0x00,
 };
+
+constexpr rawdisp::AssetDesc bw_vs_128x64_desc = {
+  .width = 128,
+  .height = 64,
+  .format = rawdisp::AssetFormat::BW,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "color",
+      .data = bw_vs_128x64,
+      .size = sizeof(bw_vs_128x64),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x24,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 1,
+        .pixelsPerFrag = 8,
+        .bytesPerFrag = 1,
+      },
+      .stride = 128,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
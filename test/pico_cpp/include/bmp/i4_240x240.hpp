@@ -0,0 +1,1845 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "rawdisp/asset_desc.hpp"
+
+// 240x240px, Indexed4
+// MSB First, Horizontal Packing, Horizontal Adressing
+// 28800 Bytes
+const uint8_t i4_240x240[] __attribute__((aligned(4))) = {
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdf, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd,
+  0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdf,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xfd,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xfd, 0xff,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd,
+  0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xff, 0xdf,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xfd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd,
+  0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xff, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd,
+  0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
+  0xff, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd,
+  0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd,
+  0xdb, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
+  0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xdd, 0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xed, 0xed, 0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xff, 0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xdd, 0xdf, 0xed,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd,
+  0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xeb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xfd, 0xff,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xeb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xdd, 0xdd, 0xdd,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xfa, 0xdd, 0xdd, 0xdd, 0xde, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xed,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xff, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xfd, 0xdd,
+  0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xfb, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xdd, 0xdd, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xbd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdf,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdf, 0xfd, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xdd, 0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdd, 0xdd, 0xff,
+  0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xbd,
+  0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xed, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xfb, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd, 0xdd, 0xde, 0xbd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdb, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xdd, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdf, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdf, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xef, 0xdd, 0xdd, 0xdd, 0xff, 0xdd,
+  0xdd, 0xdd, 0xeb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xfb, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfe, 0xbf, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xfe, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdb, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdf, 0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdb, 0xfb, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdf, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdb, 0xeb, 0xdd, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xdd, 0xdb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xed, 0xfd, 0xff, 0xdd,
+  0xdd, 0xdb, 0xdd, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xeb, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdf, 0xbf, 0xfd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdf, 0xfb, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdd, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xda, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdf, 0xfb, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd,
+  0xbd, 0xdd, 0xdd, 0xde, 0xbd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xbd, 0xdd, 0xdd,
+  0xdd, 0xdb, 0xdd, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xed, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xbd, 0xdd, 0xdf, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xbd, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xdd,
+  0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xbd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xff, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xbf, 0xfd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xfb, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xeb, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xde, 0xed, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xff, 0xfd, 0xd9, 0xdf,
+  0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdf, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xfd,
+  0xdd, 0xdd, 0xef, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xff, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xff, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xaf, 0xdd, 0xdd, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xbf, 0xfe, 0x9d, 0xdd, 0xdd, 0xdf, 0xbf, 0xfb, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xdd, 0xff, 0xff, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xff, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xfa, 0xfd, 0xdd, 0xdd, 0xdd, 0xfd, 0xdd, 0xff, 0xbe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xfb, 0xff, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xfb, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd,
+  0xdf, 0xaf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xfa, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfa, 0xfd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xbf, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xdf, 0xfb, 0xff, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfa, 0xff, 0xe9, 0xff,
+  0xdd, 0xdd, 0xdf, 0xea, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xdb, 0xfa, 0xfd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xff, 0xbf, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xbd, 0xdd, 0xdf, 0xfd,
+  0xdf, 0xdf, 0xea, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xaf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xff, 0xfb, 0xff, 0xdd, 0xdd, 0xbd, 0xdd, 0xdd, 0xfd, 0xfb, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xaf, 0xdd, 0xdd, 0xdd, 0xbd, 0xdd, 0xdf,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xbf, 0xff, 0xbd, 0xdd, 0xdd, 0xdd, 0xff, 0xfe, 0xfa, 0xfd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xff, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xfd, 0xff, 0xaf, 0xfe, 0xf9, 0xfd, 0xdd, 0xdd, 0xfb, 0xff, 0xfa, 0xfd, 0xdd, 0xdd,
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbe, 0xfe, 0xfb, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xfa, 0xfb, 0xff, 0xdd, 0xff, 0xff, 0xdf, 0xdb, 0xff, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xbf, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xaf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xfd, 0xff, 0xef, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xaf, 0xff, 0xfb, 0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xde, 0xdd, 0xdf, 0xdd, 0xdd, 0xfb, 0xfb, 0xff,
+  0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0xdf, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbb, 0xff, 0xfb, 0xfd,
+  0xdd, 0xdd, 0xdf, 0xbd, 0xdd, 0xbf, 0xff, 0xdf, 0xdd, 0xfd, 0xfb, 0xfd, 0xef, 0xfe, 0xef, 0xfd,
+  0xdf, 0xdf, 0xdf, 0xbd, 0xdf, 0xfb, 0xfd, 0xdf, 0xff, 0xff, 0xdb, 0xdb, 0xfa, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xfb, 0xfb, 0xff, 0xbf, 0xdd, 0xdd, 0xfd, 0xbd, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xfd,
+  0xfd, 0xdf, 0xbf, 0xbf, 0xef, 0xbf, 0xdd, 0xdf, 0xdf, 0xdd, 0xbf, 0xff, 0xfb, 0xfd, 0xdf, 0xff,
+  0xfd, 0xdd, 0xdd, 0xff, 0xfd, 0xdd, 0xdf, 0xdd, 0xdb, 0xdb, 0xfb, 0xff, 0xbf, 0xdd, 0xff, 0xff,
+  0xdd, 0xdd, 0xdf, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xfb, 0xdb, 0xff, 0xfd, 0xdd, 0xdf, 0xdd, 0xdd,
+  0xed, 0xee, 0xeb, 0xfb, 0xfb, 0xdd, 0xff, 0xfb, 0xff, 0xdf, 0xfd, 0xfd, 0xff, 0xfb, 0xff, 0xef,
+  0xff, 0xdf, 0xdd, 0xdd, 0xfd, 0xbb, 0xff, 0xfb, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xfb, 0xfa, 0xff,
+  0xdf, 0xdd, 0xdd, 0xfc, 0xff, 0xfe, 0x7f, 0xef, 0xed, 0xdd, 0xdd, 0xdd, 0xbd, 0xff, 0xff, 0xbf,
+  0xdf, 0xfd, 0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xdf,
+  0xbf, 0xdd, 0xbf, 0xbd, 0xff, 0xbf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xfb, 0xff, 0xfb, 0xff, 0xdd,
+  0xbd, 0xdd, 0xfb, 0xbf, 0xaf, 0xfd, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xbf, 0xaf, 0xff, 0xfd, 0xdd,
+  0xdf, 0xdd, 0xdf, 0xfa, 0xff, 0xdf, 0xff, 0xfd, 0xdd, 0xdd, 0xdb, 0xff, 0xdf, 0xdf, 0xdf, 0xff,
+  0xdd, 0xdf, 0xbf, 0xaf, 0xff, 0xdf, 0xdd, 0xdd, 0xed, 0xed, 0xdf, 0xbf, 0xdd, 0xdd, 0xbd, 0xfe,
+  0xaf, 0xfb, 0xfd, 0xdf, 0xfd, 0xff, 0xbd, 0xfa, 0xfb, 0xfd, 0xdd, 0xdd, 0xbf, 0xfd, 0xfb, 0xff,
+  0xfb, 0xfb, 0xdd, 0xdd, 0xdd, 0xbf, 0xff, 0xfb, 0xff, 0xbf, 0xbf, 0xfd, 0xfe, 0xfe, 0xef, 0xfd,
+  0xed, 0xdd, 0xbd, 0xdd, 0xfb, 0xdb, 0xfa, 0xff, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xff, 0xaf, 0xeb,
+  0xfb, 0xdd, 0xdd, 0xdd, 0xbf, 0xbf, 0xbf, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xff, 0xff, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0xff, 0xfb, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xff, 0xbf, 0xff, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xfb, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdb, 0xdf, 0xfb, 0xff, 0xff, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xfa, 0xff, 0xaf, 0xfd, 0xfd, 0xdd, 0xdd, 0xdf, 0xfb, 0xfb, 0xfb, 0xfd, 0xdd,
+  0xee, 0xde, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xff, 0xaf, 0xbd, 0xdd, 0xdf, 0xdf, 0xfd, 0xdf,
+  0xfe, 0xfb, 0xfb, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xbf,
+  0xaf, 0xdd, 0xdf, 0xdf, 0xef, 0xf9, 0xff, 0xee, 0xbf, 0xbf, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb,
+  0xfd, 0xff, 0xdd, 0xdd, 0xdd, 0xbf, 0xfa, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xff, 0xff,
+  0xbf, 0xbd, 0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xfd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdf, 0xfa, 0xff, 0xbf,
+  0xbd, 0xdd, 0xdd, 0xdd, 0xdf, 0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xaf, 0xfb, 0xdd,
+  0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfa, 0xff, 0xfd, 0xfd,
+  0xdd, 0xdd, 0xdb, 0xff, 0xef, 0xef, 0xbd, 0xdd, 0xde, 0xbf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xaf, 0xfd, 0xfd, 0xdd, 0xdf, 0xfd, 0xfd, 0xfb, 0xfa, 0xfd, 0xdd, 0xff, 0xfd, 0xba, 0xea, 0xff,
+  0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfe, 0xff, 0xbf, 0xdd, 0xff, 0xff, 0xe7, 0xff, 0xde,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xfa, 0xfb, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xbf,
+  0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfa, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xdd,
+  0xdd, 0xdd, 0xfb, 0xfd, 0xdb, 0xff, 0xaf, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdb, 0xff, 0xff, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdb, 0xdf, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xfa, 0xfb, 0xfd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xbf, 0xdd, 0xdd,
+  0xef, 0xef, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xbf, 0xbd, 0xdd, 0xdd, 0xff, 0xdf, 0xff,
+  0xef, 0xfb, 0xdd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xae, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xaf,
+  0xfb, 0xfb, 0xdf, 0xef, 0xff, 0xf9, 0xfe, 0xed, 0xeb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xff,
+  0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xef, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xdf, 0xff, 0xfb, 0xfd,
+  0xdd, 0xdb, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xfa, 0xfd, 0xdd,
+  0xdd, 0xdd, 0xbd, 0xdf, 0xff, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb, 0xdd, 0xdd, 0xff, 0xeb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xfa, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xbf, 0xbf, 0xdd, 0xfa, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0xfa, 0xdf, 0xff, 0xfd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x9e, 0xfe, 0xf9, 0xfe, 0xde,
+  0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xaf,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xbd, 0xdb, 0xfa, 0xfd, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xbd,
+  0xdd, 0xbd, 0xdf, 0x7d, 0xfd, 0xbf, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xbd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xbf, 0xaf, 0xfb, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xbf, 0xdd, 0xdf,
+  0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
+  0xfa, 0xff, 0xbf, 0xf8, 0xef, 0xef, 0xef, 0xef, 0xef, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff,
+  0xfb, 0xfd, 0xfa, 0xef, 0xff, 0xe9, 0xfe, 0xed, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf,
+  0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xff, 0xfb, 0xdd, 0xdd, 0xdf, 0x8c, 0xdf, 0xff, 0xff, 0xbd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xaf, 0xfb, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xef, 0xef, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb, 0xfd, 0xdf, 0xf7, 0x79, 0xee, 0xef,
+  0xfe, 0xfe, 0xff, 0xef, 0xef, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xfe,
+  0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0xfa, 0xfb,
+  0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xaf, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xaf, 0xfd,
+  0xdd, 0xdd, 0xdf, 0x87, 0x7f, 0xff, 0xaf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xbf, 0xdd, 0xbd, 0xdd, 0xdd, 0xdf, 0xbf, 0xaf, 0xfd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xfa, 0xff, 0xff, 0xdf,
+  0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xfa, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdf, 0xfb,
+  0xea, 0xff, 0xdd, 0xdd, 0xff, 0xdf, 0xff, 0xe7, 0x79, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xef, 0xff, 0xff, 0xef, 0xe9, 0xfd, 0xeb, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xaf,
+  0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xfb, 0xdd, 0xdb, 0xdd, 0xdd, 0xdf, 0xff, 0xff,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfb, 0xff, 0xbd, 0xdd, 0xdd, 0xf7, 0x97, 0xff, 0xff, 0xfd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfb, 0xfa, 0xff, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb, 0xfb, 0xdd,
+  0xdd, 0xdb, 0xdd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdf, 0xfa,
+  0xff, 0xea, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xef, 0xee, 0xfd, 0xdd, 0xdd, 0xdf, 0xef, 0xff,
+  0xff, 0xff, 0x77, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xee,
+  0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xef, 0xff, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xff, 0xfb, 0xfa,
+  0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xaf, 0xbf, 0xff, 0xbd, 0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xfb,
+  0xff, 0xdd, 0xdd, 0xf9, 0x57, 0x7e, 0xff, 0xff, 0xbd, 0xdd, 0xdd, 0xdf, 0xfb, 0xff, 0xff, 0xbf,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xff, 0xbf, 0xaf, 0xff, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xff, 0xfb, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xbf, 0xaf, 0xff, 0xff, 0xdd,
+  0xed, 0xef, 0xff, 0xff, 0xfd, 0xdd, 0xfd, 0xef, 0xee, 0xff, 0xee, 0xfd, 0xdd, 0xdf, 0xfd, 0xaf,
+  0xaf, 0xee, 0xbe, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfe, 0xde, 0xef, 0xff, 0xfd, 0xdd, 0xdf, 0xfd, 0xea, 0xff,
+  0xaf, 0xff, 0xdd, 0xdd, 0xfd, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xdd, 0xdf, 0xdf, 0xbf, 0xff, 0xff,
+  0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xff, 0xdd, 0xfd, 0xff, 0x77, 0x77, 0x7e, 0xdf,
+  0xff, 0xdd, 0xdd, 0xfb, 0xff, 0xfa, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xbf, 0xfa, 0xff, 0xff,
+  0xdd, 0xdd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdf, 0xdf, 0xff, 0xff, 0xbf, 0xfd,
+  0xdd, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xff, 0xff, 0xff, 0xee, 0xed,
+  0xaf, 0xea, 0xfe, 0xaf, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xbe, 0xee, 0xef, 0xf9, 0x99, 0x77, 0x87,
+  0x77, 0x79, 0x77, 0x77, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xee, 0xff, 0xff, 0xfe, 0xff, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xfa, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xaf, 0xff, 0xbf, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xff,
+  0xfb, 0xff, 0xfd, 0xff, 0xe7, 0x5e, 0x5e, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xff, 0xdf, 0xff, 0xbf, 0xfa, 0xfb, 0xff, 0xff, 0xdf, 0xfb, 0xff, 0xaf, 0xaf, 0xbf,
+  0xff, 0xdf, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfb, 0xff, 0xff, 0xbf, 0xff,
+  0xdd, 0xdd, 0xbf, 0xff, 0xff, 0xfe, 0xed, 0xed, 0xdd, 0xdd, 0xef, 0xfe, 0xee, 0xeb, 0xee, 0xbf,
+  0xbf, 0xee, 0xef, 0xfe, 0x8e, 0xfe, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+  0xff, 0xff, 0xee, 0xff, 0xfe, 0xfe, 0x9f, 0xdd, 0xdd, 0xff, 0xff, 0xfe, 0xde, 0xdd, 0xbd, 0xdb,
+  0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfa, 0xff, 0xaf, 0xdb, 0xfb, 0xfb, 0xfb, 0xff,
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xbf, 0xbf, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0x5e, 0x57, 0x59,
+  0x77, 0xdf, 0xff, 0xff, 0xfb, 0xef, 0xaf, 0xbf, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfd, 0xff, 0xff,
+  0xff, 0xbf, 0xfb, 0xff, 0xbf, 0xbf, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xfd, 0xdf, 0xbf, 0xfb, 0xfb,
+  0xfb, 0xff, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xff, 0xeb, 0xdd,
+  0xdd, 0xdd, 0xde, 0xae, 0xee, 0xee, 0xed, 0xde, 0xdd, 0xdd, 0xff, 0x8e, 0xee, 0xfe, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x7f, 0xd9,
+  0xdd, 0xdf, 0xff, 0xde, 0xee, 0xdf, 0xdd, 0xdd, 0xdf, 0xbf, 0xaf, 0xfb, 0xff, 0xdd, 0xfd, 0xdb,
+  0xdf, 0xff, 0xfb, 0xff, 0xff, 0xbf, 0xdf, 0xbf, 0xff, 0xaf, 0xff, 0xff, 0xbf, 0xdf, 0xdb, 0xfb,
+  0xfb, 0xff, 0xff, 0xbf, 0xdf, 0x95, 0x95, 0xe5, 0x97, 0xcc, 0xce, 0xae, 0xcc, 0xce, 0xcc, 0xec,
+  0xae, 0xaa, 0xff, 0xff, 0xfd, 0xdb, 0xdb, 0xff, 0xaf, 0xff, 0xaf, 0xbf, 0xbf, 0xbd, 0xbf, 0xbf,
+  0xff, 0xfb, 0xff, 0xbf, 0xbf, 0xdb, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xbd, 0xdb, 0xff, 0xff,
+  0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xde, 0xd9, 0xe9, 0xd9, 0x9d, 0xee, 0xed, 0xce, 0xd9, 0x99,
+  0x98, 0x9d, 0xf7, 0xee, 0xff, 0xef, 0xef, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0x9d, 0xdf, 0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xdd, 0xdd, 0xdd, 0xbf, 0xff, 0xef, 0xaf, 0xdb, 0xdd, 0xdd,
+  0xbf, 0xff, 0xff, 0xff, 0xdb, 0xdd, 0xdf, 0xbf, 0xff, 0xfa, 0xff, 0xfb, 0xfd, 0xff, 0xf9, 0x77,
+  0x5c, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xce, 0xce, 0xce, 0xee, 0xad, 0xff, 0xdd, 0xdd, 0xbf,
+  0xff, 0xaf, 0xff, 0xfb, 0xfd, 0xdd, 0xdf, 0xff, 0xaf, 0xff, 0xfb, 0xff, 0xff, 0xdf, 0xbf, 0xbf,
+  0xaf, 0xff, 0xfb, 0xdb, 0xfd, 0xdd, 0xbf, 0xaf, 0xd9, 0xdd, 0x9d, 0xde, 0xde, 0xee, 0xd9, 0x9d,
+  0x8d, 0x9d, 0x99, 0xe9, 0xe9, 0xe9, 0x99, 0xd8, 0xd9, 0x9d, 0xe7, 0xfe, 0xfe, 0xfe, 0x99, 0x77,
+  0x57, 0x77, 0x77, 0x97, 0x59, 0xff, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xff,
+  0xdd, 0x9d, 0xff, 0xfe, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfa, 0xfa, 0xfd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xaf, 0xff, 0xdb, 0xfd, 0xdd, 0xdd, 0xdd, 0xfb, 0xff, 0xff, 0xbf, 0xdd, 0xdd, 0xdd,
+  0xbf, 0xff, 0xfa, 0xff, 0xbf, 0xff, 0xf7, 0x7e, 0xce, 0xce, 0xcc, 0xec, 0xce, 0xcc, 0xce, 0xce,
+  0xcc, 0xec, 0xcc, 0xcc, 0xcd, 0xff, 0xdd, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xdd, 0xdd, 0xdb, 0xdf,
+  0xff, 0xfa, 0xff, 0xfd, 0xfd, 0xdd, 0xdd, 0xff, 0xff, 0xfb, 0xfd, 0xdf, 0xbd, 0xdd, 0xfd, 0xff,
+  0xd9, 0xd9, 0xd9, 0xdc, 0xee, 0xdc, 0xd8, 0xd9, 0x99, 0x89, 0x9d, 0x9e, 0xee, 0x99, 0x98, 0x99,
+  0x99, 0x9d, 0x99, 0xe9, 0x97, 0x59, 0x9f, 0xff, 0xff, 0xf9, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x99, 0xff, 0x9d, 0x9f, 0x9d, 0xf9, 0xdd, 0x9d, 0xdd,
+  0xdd, 0xdd, 0xef, 0xff, 0xfd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xd8, 0xc9, 0xe7,
+  0xe7, 0xe7, 0xe7, 0xce, 0xce, 0xce, 0xce, 0xcc, 0xec, 0xce, 0xce, 0xec, 0xec, 0xaf, 0xfd, 0xdf,
+  0xff, 0xaf, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfb, 0xff, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xff,
+  0xfa, 0xff, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xff, 0x9d, 0x9d, 0x9d, 0x9e, 0x9e, 0xc9, 0x99, 0x99,
+  0xd9, 0x9d, 0x89, 0xe9, 0xe9, 0xe7, 0x97, 0x97, 0x77, 0x59, 0xf9, 0x9e, 0xff, 0xf9, 0x95, 0x95,
+  0x95, 0x9f, 0xf9, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x7d, 0xff, 0x99, 0xf9, 0x9d, 0x9d, 0xdd, 0xff, 0xdd, 0xde, 0xdf, 0xed, 0xdd, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xdf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xbd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xff, 0xff, 0xfb, 0xae, 0xee, 0xec, 0xe7, 0xc7, 0x7c, 0xce, 0xe5, 0xec, 0x7e, 0xce, 0xc7,
+  0xec, 0x7e, 0x7c, 0xcc, 0xce, 0xec, 0xdf, 0xdd, 0xff, 0xff, 0xfb, 0xfd, 0xdd, 0xdd, 0xdd, 0xdf,
+  0xff, 0xff, 0xff, 0xff, 0xdd, 0xbd, 0xdb, 0xfb, 0xff, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
+  0xd9, 0xd8, 0xd8, 0x9e, 0x9e, 0x9e, 0x99, 0x98, 0x98, 0x99, 0x77, 0x75, 0x55, 0x55, 0x75, 0x55,
+  0x55, 0x75, 0x59, 0xe9, 0x55, 0x55, 0x59, 0x5f, 0xff, 0x99, 0x5f, 0xff, 0xff, 0xfe, 0xff, 0xef,
+  0xff, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xff, 0x9f, 0x9f, 0x9d, 0xf9, 0x99,
+  0x9f, 0xdf, 0xed, 0xef, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdf, 0xfb, 0xff, 0xbf, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xaa, 0xff, 0xec, 0xec, 0xc5, 0x7c,
+  0xcc, 0xcc, 0xe5, 0xee, 0xce, 0xce, 0x5e, 0xec, 0xec, 0xec, 0xec, 0x7e, 0x7c, 0xce, 0xcd, 0xff,
+  0xfb, 0xff, 0xbf, 0xbd, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xff, 0xdb, 0xdd, 0xdd, 0xdd, 0xff,
+  0xff, 0xaf, 0xfb, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x9d, 0x9d, 0x99, 0xe9, 0xce, 0xec, 0x99, 0x97,
+  0x75, 0x75, 0x57, 0x55, 0x59, 0x55, 0x59, 0x59, 0x53, 0x55, 0x95, 0x55, 0x59, 0x59, 0x9f, 0xf9,
+  0x59, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xf7, 0xff, 0xf9, 0xf9, 0xdf, 0x79, 0x97, 0x97, 0xf9, 0xfe, 0xfe, 0xdf, 0xfd, 0xdd, 0xdd,
+  0xdd, 0xff, 0xef, 0xef, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xff, 0xff,
+  0xdb, 0xef, 0xff, 0xff, 0xee, 0xc2, 0xaa, 0xcc, 0xce, 0xe7, 0xee, 0xce, 0x5e, 0x5e, 0xec, 0x5e,
+  0x5e, 0x5e, 0x5e, 0xec, 0xe7, 0xe7, 0xec, 0xef, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
+  0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf,
+  0x99, 0x99, 0x99, 0xee, 0x9c, 0x75, 0x55, 0x57, 0x55, 0x55, 0x75, 0x55, 0x55, 0x5f, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x59, 0x55, 0xff, 0x95, 0x9f, 0xff, 0xff, 0xff, 0xf9, 0x95, 0x5e, 0xef, 0xff,
+  0xef, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x9f, 0x9f, 0xf7, 0x95, 0x95,
+  0x95, 0xff, 0x9f, 0x9d, 0xef, 0xff, 0xfd, 0xdd, 0xdf, 0xdf, 0xff, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0xac, 0xec, 0xce,
+  0x9c, 0xee, 0xec, 0xe5, 0xee, 0xec, 0xec, 0xec, 0xee, 0xce, 0xe5, 0xe5, 0xec, 0xe7, 0xce, 0xce,
+  0xff, 0xaf, 0xff, 0xbf, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xbf,
+  0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0x9d, 0x99, 0x99, 0x77, 0x55, 0x57, 0x55, 0x75,
+  0x57, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x59, 0x55, 0x95, 0x95, 0x55, 0x5f, 0xf5, 0xff, 0xf9,
+  0xff, 0x9f, 0xf9, 0x59, 0xff, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xe7, 0xff, 0x95, 0x53, 0x95, 0x99, 0x9f, 0x9f, 0x9e, 0xfd, 0xff, 0xdd, 0xdd,
+  0xfd, 0xff, 0xde, 0xee, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xfb, 0xad, 0xef, 0xff, 0xff,
+  0xfe, 0xfe, 0xec, 0xcc, 0xaa, 0xce, 0xef, 0xfe, 0xee, 0xc5, 0xee, 0xee, 0xec, 0xe5, 0xee, 0x5e,
+  0xe5, 0xec, 0xcc, 0x5e, 0xce, 0x5e, 0xcc, 0xec, 0xef, 0xff, 0xbf, 0xff, 0xbd, 0xdd, 0xdf, 0xff,
+  0xff, 0xff, 0xff, 0xfd, 0xdd, 0xdf, 0xdf, 0xff, 0xff, 0xaf, 0xff, 0xdd, 0xdd, 0xdf, 0xff, 0xff,
+  0x9c, 0x97, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55, 0x57, 0x55, 0x55, 0x55, 0x5f, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x95, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0xff, 0xf9, 0x9f, 0xef, 0xfe,
+  0xff, 0xff, 0xee, 0xee, 0x5f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x59, 0x55, 0x95,
+  0x55, 0x5f, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0xef, 0xdf, 0xed, 0xff, 0xfd, 0xff,
+  0xff, 0xda, 0xaa, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xee, 0xcc, 0xcc, 0x5a, 0xac, 0xee, 0xef, 0xfe,
+  0xfe, 0xee, 0xe5, 0xec, 0xe5, 0xee, 0xec, 0xee, 0xce, 0xce, 0x5e, 0x57, 0xcc, 0xec, 0xe5, 0xe7,
+  0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfb, 0x77, 0x55, 0x75, 0x75, 0x57, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x59, 0x55, 0x55, 0x5f, 0xf5, 0xff, 0xf5, 0xff,
+  0x5f, 0x5f, 0xff, 0x5f, 0x95, 0xff, 0xff, 0xff, 0xf5, 0xe5, 0x5f, 0xff, 0xff, 0x5e, 0xff, 0xef,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x95, 0x59, 0x59, 0x59, 0x99, 0x99, 0x9f, 0xff, 0xf9, 0x9f,
+  0x9f, 0x9f, 0x9f, 0xef, 0xde, 0xfe, 0xdf, 0xff, 0xd7, 0xc7, 0x4c, 0x99, 0x84, 0x26, 0x22, 0x7a,
+  0x7c, 0xc5, 0x52, 0xaa, 0xca, 0xee, 0xfe, 0xfe, 0xff, 0xfe, 0xce, 0xee, 0xee, 0xec, 0xee, 0x5e,
+  0xe5, 0xee, 0xec, 0xc5, 0xce, 0x5e, 0xce, 0xce, 0xcc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xfb, 0xff, 0xfb, 0xff, 0xbf, 0xff, 0xfb, 0xff,
+  0x55, 0x57, 0x55, 0x55, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x5f, 0x55, 0x55, 0x55,
+  0x55, 0x5f, 0x55, 0xff, 0x5f, 0xff, 0xff, 0xf9, 0x5f, 0xf9, 0x55, 0xf9, 0xff, 0xff, 0xff, 0x55,
+  0xff, 0xff, 0xff, 0x55, 0x5f, 0xff, 0x5f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0x55, 0x53, 0x55,
+  0x95, 0x93, 0xf5, 0x95, 0x95, 0x99, 0x9f, 0x99, 0xff, 0x9f, 0x9d, 0x9f, 0xfe, 0xfd, 0xff, 0xf7,
+  0x72, 0x2f, 0xff, 0xff, 0x77, 0x52, 0x57, 0x52, 0x55, 0x55, 0x2a, 0x6a, 0xac, 0xef, 0xee, 0xef,
+  0xfe, 0xec, 0xee, 0xe5, 0xec, 0xe5, 0xee, 0xec, 0xee, 0xc5, 0xee, 0x55, 0xce, 0xe5, 0xe5, 0xec,
+  0xec, 0xcf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x57, 0x55, 0x5c, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x55, 0x55, 0xf9, 0xff, 0xf9, 0xf5, 0x5f,
+  0xf9, 0x55, 0xff, 0x9f, 0xff, 0xff, 0xe5, 0xff, 0xf5, 0x55, 0x55, 0xf5, 0xf5, 0x5f, 0xf5, 0xff,
+  0xef, 0xff, 0xff, 0xff, 0xf9, 0x55, 0x55, 0x55, 0x35, 0x55, 0xf9, 0x39, 0x39, 0x53, 0x95, 0x99,
+  0x99, 0x99, 0xd9, 0xd9, 0xd9, 0xff, 0xf9, 0x27, 0x27, 0xfd, 0xdf, 0x94, 0x72, 0x75, 0x25, 0x25,
+  0x52, 0x72, 0x66, 0xa6, 0xcc, 0xec, 0xee, 0xef, 0xee, 0xce, 0xfe, 0xee, 0xee, 0xee, 0xec, 0xe5,
+  0xee, 0xee, 0xec, 0xe5, 0xc7, 0xec, 0xee, 0xc5, 0xe7, 0xc7, 0xff, 0xff, 0xff, 0xbb, 0x6b, 0xbf,
+  0xdd, 0xdb, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xbf, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+  0x55, 0x5c, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x55, 0x55, 0x57, 0x55, 0x55, 0x75, 0x55, 0x5f, 0x55,
+  0x55, 0x5f, 0x55, 0xf5, 0xff, 0xf5, 0x9f, 0xf9, 0x55, 0x53, 0xf5, 0xff, 0xff, 0xf5, 0xff, 0xf5,
+  0x5f, 0x5f, 0x59, 0x55, 0x59, 0x55, 0x5f, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0x95, 0xff, 0x53, 0x5f, 0x9f, 0x5f, 0x35, 0xf3, 0x99, 0x3f, 0x9d, 0x9f, 0x9f, 0x97, 0x25,
+  0x2f, 0xdf, 0xf8, 0x77, 0x25, 0x25, 0x75, 0x72, 0x75, 0x56, 0xa6, 0x6c, 0xcc, 0xce, 0xcc, 0xec,
+  0xec, 0x5e, 0xfe, 0xef, 0xfe, 0xe5, 0xee, 0xec, 0xe5, 0xec, 0xee, 0xce, 0x7e, 0xce, 0x5e, 0xce,
+  0xce, 0x7c, 0xcf, 0xfa, 0x66, 0x62, 0x20, 0x0f, 0xdd, 0xdd, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xbf,
+  0xbf, 0xbf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0x5c, 0x55, 0x55, 0x55, 0x55, 0x74, 0x44, 0x24,
+  0x42, 0x44, 0x44, 0x14, 0x14, 0x34, 0x45, 0x55, 0x55, 0x55, 0x5f, 0xf5, 0xf9, 0x5f, 0x99, 0x51,
+  0x41, 0x4f, 0x9f, 0xff, 0x9f, 0x5f, 0xf5, 0x55, 0xf5, 0x55, 0x95, 0x35, 0x35, 0x95, 0x95, 0xff,
+  0x5f, 0xff, 0xfe, 0xff, 0xff, 0x55, 0x55, 0x53, 0x5f, 0x53, 0x99, 0xf5, 0xf3, 0x5f, 0xff, 0xff,
+  0x59, 0x39, 0x93, 0x93, 0x99, 0xf9, 0x75, 0x22, 0x8f, 0xdf, 0x87, 0x25, 0x25, 0x22, 0x22, 0x55,
+  0x52, 0x66, 0x66, 0xcc, 0xc7, 0x7e, 0x7e, 0xcc, 0x5c, 0x5e, 0xe5, 0xff, 0xff, 0xf5, 0xee, 0x5c,
+  0xee, 0xee, 0x5e, 0xe5, 0xce, 0x5e, 0xce, 0x5e, 0x5e, 0xce, 0xc0, 0x60, 0x25, 0x55, 0x20, 0x0f,
+  0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xdd, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+  0x55, 0x55, 0x55, 0x55, 0x74, 0x11, 0x40, 0x44, 0x64, 0x44, 0x14, 0x11, 0x11, 0x41, 0x14, 0x45,
+  0x55, 0xf5, 0x55, 0xf9, 0x59, 0xf9, 0x53, 0x44, 0x44, 0x99, 0x99, 0xff, 0xf5, 0xf9, 0x55, 0xf5,
+  0x55, 0x35, 0x35, 0x35, 0x33, 0x53, 0x53, 0x55, 0xf5, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x55, 0x55,
+  0xff, 0xff, 0x5f, 0xf3, 0xff, 0xff, 0x35, 0x3f, 0xf3, 0x5f, 0x35, 0xf3, 0x9f, 0xf5, 0x72, 0x25,
+  0x9f, 0xf7, 0x72, 0x25, 0x25, 0x25, 0x55, 0x27, 0x25, 0x66, 0x65, 0xc7, 0xc5, 0xe7, 0xe5, 0xc5,
+  0xee, 0xec, 0x5e, 0xec, 0xee, 0xec, 0xee, 0xfe, 0x5e, 0xce, 0xec, 0xee, 0x5e, 0xec, 0xe5, 0xec,
+  0xec, 0xc7, 0xc2, 0x55, 0x52, 0x52, 0x00, 0x4f, 0xdd, 0xdd, 0xbd, 0xff, 0xff, 0xbf, 0xfb, 0xfb,
+  0xdf, 0xdd, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0x55, 0x5c, 0x55, 0xc5, 0x41, 0x14, 0x8e, 0xdf,
+  0xff, 0xef, 0xff, 0xdf, 0xff, 0xd9, 0x44, 0x43, 0x55, 0x55, 0x55, 0x59, 0xf9, 0x93, 0x9f, 0xff,
+  0xff, 0xf7, 0xff, 0xff, 0x5f, 0x94, 0x49, 0x9f, 0x95, 0x35, 0x32, 0x33, 0x53, 0x53, 0x23, 0x53,
+  0x7f, 0x95, 0xff, 0xff, 0xf5, 0x55, 0x55, 0x55, 0x9f, 0xff, 0xf9, 0xff, 0xf3, 0x53, 0x55, 0x95,
+  0xff, 0x35, 0xf3, 0x5f, 0xff, 0x95, 0x52, 0x52, 0x9f, 0x87, 0x22, 0x25, 0x22, 0x52, 0x22, 0x22,
+  0x22, 0x62, 0x2c, 0xc7, 0x5c, 0xc7, 0xc5, 0x59, 0xe5, 0xec, 0x5e, 0x5e, 0xee, 0x55, 0xee, 0xfe,
+  0xee, 0xe5, 0xee, 0xce, 0xce, 0xc5, 0xee, 0xce, 0x5e, 0xce, 0x7c, 0x25, 0x25, 0x55, 0x00, 0x8f,
+  0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xdb, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfd,
+  0x55, 0x55, 0x55, 0x54, 0x41, 0xef, 0xde, 0xc7, 0x75, 0x77, 0x57, 0x77, 0x97, 0x99, 0xff, 0x82,
+  0x43, 0x5f, 0x53, 0x35, 0x39, 0xff, 0x99, 0x46, 0x69, 0x9f, 0xff, 0x5f, 0xff, 0x84, 0x24, 0x53,
+  0x53, 0x59, 0x9f, 0x9f, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x55, 0x55, 0x55,
+  0x9f, 0xff, 0xff, 0x95, 0x35, 0x53, 0x93, 0x53, 0x5f, 0xf3, 0x5f, 0xff, 0x33, 0x35, 0x35, 0x22,
+  0xf9, 0x72, 0x25, 0x25, 0x22, 0x22, 0x72, 0x52, 0x56, 0x65, 0xc7, 0xc5, 0x77, 0xc5, 0x77, 0xe5,
+  0x77, 0xc5, 0x5e, 0xee, 0x5e, 0xce, 0x5e, 0xee, 0x5e, 0xee, 0xe5, 0xe5, 0xc5, 0xee, 0xce, 0x5e,
+  0xce, 0x5e, 0x7e, 0x25, 0x52, 0x50, 0x00, 0x4f, 0xdd, 0xdd, 0xdd, 0xff, 0xbf, 0xff, 0xfb, 0xfd,
+  0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xbd, 0x5c, 0x55, 0x55, 0x74, 0x4f, 0xd5, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0xf9, 0x42, 0x49, 0x53, 0x53, 0xff, 0x84, 0x66, 0x6a,
+  0x6e, 0x9e, 0xff, 0xf5, 0xf9, 0xf9, 0x44, 0x12, 0x14, 0xfd, 0xd3, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x39, 0xff, 0xf5, 0xff, 0xf5, 0x55, 0x55, 0x53, 0xff, 0xff, 0xff, 0x53, 0x53, 0x59, 0x59, 0x95,
+  0x39, 0xf5, 0xff, 0x33, 0xf3, 0xf5, 0x52, 0x22, 0x97, 0x72, 0x22, 0x22, 0xc2, 0x72, 0x52, 0x52,
+  0x26, 0x22, 0xc5, 0x75, 0xc7, 0x77, 0x7f, 0xff, 0x97, 0xc5, 0xcc, 0xce, 0xce, 0x5e, 0x5e, 0xc5,
+  0x5e, 0xee, 0xee, 0xee, 0xce, 0xec, 0x5e, 0xce, 0x5e, 0xcc, 0xe7, 0x25, 0x25, 0x50, 0x00, 0x0d,
+  0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdd,
+  0x55, 0x5c, 0x5c, 0x24, 0xef, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f,
+  0x94, 0x42, 0x41, 0x9f, 0x81, 0x66, 0x66, 0x66, 0x6e, 0x7f, 0xef, 0x5f, 0x94, 0x6f, 0xf8, 0x04,
+  0x4f, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x9f, 0x9f, 0xff, 0x55, 0x52, 0x55,
+  0x9f, 0xff, 0x53, 0x00, 0x00, 0x53, 0x53, 0x53, 0x59, 0xf3, 0xf3, 0xf3, 0x53, 0xf3, 0x55, 0x25,
+  0x42, 0x22, 0x27, 0xf9, 0x72, 0x22, 0x52, 0x76, 0x26, 0xc2, 0xc7, 0x27, 0x77, 0x77, 0xef, 0xff,
+  0xe7, 0xc2, 0x7e, 0x5e, 0xc5, 0xee, 0xf5, 0x5c, 0x55, 0x5e, 0xee, 0xee, 0x5e, 0x5e, 0xec, 0x5e,
+  0xcc, 0x5e, 0x5e, 0xc5, 0x25, 0x00, 0x20, 0x0f, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd,
+  0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0x55, 0x55, 0x57, 0x44, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf4, 0x41, 0x48, 0xf8, 0x66, 0x66, 0x66, 0xa6,
+  0x6e, 0x8e, 0xf9, 0xf9, 0x66, 0x66, 0x9f, 0x82, 0x4f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x39, 0xf5, 0xf5, 0x55, 0x55, 0x55, 0xff, 0xf5, 0x40, 0x66, 0x66, 0x04, 0x74, 0x78,
+  0x4f, 0xff, 0xf3, 0x3f, 0x3f, 0x3f, 0x35, 0x22, 0x27, 0x22, 0x9f, 0x97, 0x22, 0x52, 0x2e, 0x77,
+  0x27, 0xc2, 0xc2, 0x2c, 0x72, 0x7c, 0x5e, 0xef, 0xf7, 0x75, 0x7c, 0xe5, 0xe5, 0xee, 0xfe, 0xce,
+  0xc5, 0xc5, 0xec, 0xec, 0xee, 0xec, 0xce, 0xe5, 0xec, 0xec, 0xe5, 0xc2, 0x52, 0x00, 0x00, 0x09,
+  0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+  0x5c, 0x55, 0x52, 0x69, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0xff, 0x21, 0x7f, 0x86, 0x66, 0x6a, 0x66, 0x66, 0x6e, 0xe9, 0xe5, 0xf6, 0x66, 0x66, 0x69, 0xf8,
+  0x8f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xff, 0x55, 0x55, 0x55,
+  0x99, 0x50, 0x66, 0x66, 0x66, 0x66, 0x24, 0x47, 0x9f, 0xf3, 0x3f, 0x35, 0xf3, 0xf3, 0x35, 0x52,
+  0x22, 0x7f, 0xff, 0x72, 0x25, 0x27, 0xf7, 0x77, 0x2c, 0x27, 0x75, 0x22, 0x27, 0x2c, 0x7c, 0x7e,
+  0xf7, 0x77, 0x7c, 0x5e, 0xc5, 0xf5, 0xff, 0x5e, 0xc5, 0xce, 0xce, 0x5e, 0x5e, 0xee, 0x5e, 0x55,
+  0xc5, 0xe5, 0xec, 0x77, 0x95, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x5c, 0x57, 0x2d, 0xe5, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0x44, 0xf9, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0xe9, 0x99, 0x96, 0x66, 0x6a, 0x66, 0xef, 0x8d, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0xf9, 0x55, 0x52, 0x55, 0x92, 0x66, 0x66, 0x66, 0x60, 0x25, 0xce, 0x74,
+  0xf9, 0x39, 0x3f, 0x3f, 0x3f, 0x35, 0x35, 0x72, 0x24, 0xf9, 0xf9, 0x25, 0x22, 0x7f, 0x87, 0x2c,
+  0x72, 0x22, 0xc2, 0x62, 0xc7, 0x2c, 0x87, 0xc7, 0xe7, 0x7f, 0x7c, 0xc5, 0xee, 0xf5, 0xce, 0xe5,
+  0xe5, 0x5c, 0xc5, 0xec, 0xcc, 0x5e, 0xee, 0xc5, 0xec, 0xcc, 0x5e, 0xc7, 0x71, 0x00, 0x00, 0x21,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+  0x5c, 0x55, 0x56, 0x4e, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x5e, 0xf9, 0xf6, 0x66, 0xa6, 0x66, 0xa6, 0x6a, 0x66, 0xa9, 0xee, 0x66, 0x6a, 0x66, 0x66, 0x6f,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x52, 0x55, 0x55,
+  0x06, 0x66, 0x66, 0x66, 0x02, 0xcc, 0xef, 0xff, 0x83, 0x99, 0x35, 0x3f, 0x33, 0x3f, 0xff, 0x35,
+  0x52, 0xf9, 0xf7, 0x52, 0x27, 0xf9, 0x77, 0x72, 0x22, 0x52, 0x22, 0x2c, 0x52, 0xad, 0x8d, 0x87,
+  0x9e, 0x7f, 0x77, 0xec, 0x5e, 0xfe, 0x5e, 0x5c, 0xc5, 0x5c, 0xec, 0xe5, 0xec, 0xec, 0xc5, 0xe5,
+  0xc5, 0xe5, 0xec, 0x77, 0x70, 0x00, 0x20, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x52, 0x6f, 0x75, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xa6, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0xaa, 0xaa, 0x66, 0x6a, 0x66, 0x66, 0x66, 0x6e, 0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x3f, 0x53, 0x52, 0x50, 0x06, 0x66, 0x66, 0x06, 0x25, 0xce, 0xff, 0xff,
+  0x43, 0x33, 0x9f, 0xf3, 0xf3, 0xf3, 0xff, 0x95, 0x22, 0x9f, 0xf5, 0x42, 0x7f, 0xf4, 0x52, 0x62,
+  0x22, 0x22, 0x65, 0x22, 0xcc, 0x8d, 0x94, 0x88, 0x7e, 0x9e, 0xe7, 0x7c, 0x5f, 0xec, 0x5c, 0xce,
+  0x5c, 0x75, 0xc5, 0xec, 0x5e, 0x5e, 0x5e, 0xc5, 0x5e, 0xc5, 0xc7, 0xce, 0x20, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0xfb, 0xff, 0xfb, 0xff,
+  0x75, 0xc5, 0xc2, 0x4e, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xee, 0xee, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0xff, 0x66, 0xa6, 0x66, 0xa6, 0x66, 0xae, 0xdf, 0xdf, 0xff, 0x66, 0x66, 0x6a, 0x66, 0xad,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xd3, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf5, 0x20, 0x00,
+  0x66, 0x66, 0x60, 0x65, 0x5c, 0xef, 0xff, 0xe3, 0x33, 0x33, 0x33, 0x33, 0xf3, 0xff, 0x5f, 0x35,
+  0x42, 0x29, 0x94, 0x52, 0x9f, 0x95, 0x72, 0x22, 0x25, 0x22, 0x22, 0x2c, 0x2d, 0xd9, 0x81, 0x11,
+  0x7e, 0xef, 0xf7, 0x7c, 0x7f, 0x77, 0x99, 0x77, 0xcc, 0x75, 0xcc, 0xce, 0x5c, 0xcc, 0xcc, 0x55,
+  0xc5, 0xcc, 0x7c, 0x75, 0x70, 0x00, 0x20, 0x00, 0x9f, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfb, 0xff, 0xbf, 0xff, 0xff, 0x55, 0x55, 0x56, 0x4f, 0x75, 0x55, 0x55, 0x55,
+  0x5e, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x55, 0x55, 0x55, 0xff, 0x66, 0x66, 0x66, 0x66, 0x6c, 0xfd,
+  0xff, 0xff, 0xff, 0xfa, 0x66, 0x66, 0x6a, 0xdf, 0xdd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff,
+  0xd3, 0x33, 0x33, 0x33, 0x33, 0xf5, 0x20, 0x20, 0x66, 0x66, 0x02, 0x25, 0xce, 0xff, 0xff, 0x83,
+  0x1b, 0x33, 0x33, 0x59, 0x35, 0xff, 0xff, 0x55, 0x7f, 0x92, 0x92, 0x27, 0xff, 0x47, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0xcf, 0xf8, 0xd8, 0x31, 0x1e, 0xff, 0xff, 0x77, 0xee, 0x99, 0xd9, 0xd9,
+  0x87, 0xc5, 0x7c, 0x5c, 0xc5, 0xe5, 0xe5, 0xc5, 0x5c, 0xc7, 0x5c, 0xe7, 0x70, 0x20, 0x00, 0x02,
+  0x9f, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbd, 0xdf, 0xff, 0xff,
+  0x7c, 0x5c, 0x22, 0x0f, 0x95, 0x55, 0x55, 0x55, 0x5e, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0x99, 0x66, 0x6a, 0x66, 0x6a, 0xaf, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xc6, 0xa6, 0xad, 0xff,
+  0xfd, 0x33, 0x33, 0x33, 0x3f, 0xff, 0xfd, 0xff, 0xf3, 0x33, 0x33, 0x33, 0x33, 0xf9, 0x04, 0xcc,
+  0x66, 0x60, 0x22, 0xcc, 0xef, 0xff, 0xf7, 0x33, 0x33, 0x13, 0x39, 0x5f, 0xff, 0x3f, 0xff, 0x35,
+  0x78, 0xf9, 0x95, 0x29, 0x9f, 0x50, 0x22, 0x52, 0x22, 0x22, 0x22, 0x22, 0xcf, 0xf4, 0x13, 0x6b,
+  0x1d, 0xff, 0xff, 0xf7, 0xe9, 0xd9, 0xd8, 0x18, 0x8d, 0x77, 0x2c, 0x5c, 0x5e, 0xc5, 0xce, 0x55,
+  0xcc, 0x5e, 0x57, 0x7c, 0x72, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xfd, 0xfb, 0xdd, 0xdf, 0xff,
+  0xff, 0xff, 0xfb, 0xfd, 0xdd, 0xdb, 0xff, 0xff, 0x55, 0x55, 0x26, 0x4f, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55, 0xe7, 0x66, 0x66, 0x6a, 0x66, 0xff, 0xfd,
+  0xfd, 0xff, 0xff, 0xff, 0xfd, 0x6c, 0xdf, 0xdf, 0xdd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xdf,
+  0xd3, 0x33, 0x33, 0x33, 0x33, 0xf4, 0x17, 0xc7, 0x66, 0x62, 0x5c, 0x5e, 0xff, 0xff, 0x93, 0x36,
+  0x3b, 0x3b, 0x47, 0x9f, 0xff, 0xff, 0x5f, 0x95, 0x54, 0xff, 0x92, 0x2f, 0x9f, 0x45, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0xcf, 0xf8, 0xbb, 0x20, 0x1f, 0xff, 0xff, 0xe7, 0xef, 0xff, 0x4d, 0x11,
+  0x18, 0x8c, 0x5c, 0xc5, 0xc5, 0xcc, 0x5c, 0x55, 0xc7, 0xc7, 0x7c, 0x7c, 0x72, 0x00, 0x00, 0x20,
+  0x9f, 0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xdd, 0xdd, 0xff, 0xff,
+  0x7c, 0x5c, 0x24, 0x0f, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55,
+  0x55, 0x96, 0x6a, 0x66, 0x66, 0x6c, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xdd, 0x33, 0x33, 0x33, 0x3f, 0xff, 0xfd, 0xff, 0xd3, 0x33, 0x33, 0x33, 0x3f, 0x34, 0x66, 0x67,
+  0x67, 0x66, 0x65, 0xef, 0xff, 0xfe, 0x83, 0x3b, 0x33, 0x61, 0x95, 0xff, 0xff, 0xff, 0xff, 0xf3,
+  0x55, 0x8f, 0xf2, 0x4f, 0x9f, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x52, 0xcf, 0xf8, 0xb1, 0x72,
+  0x6f, 0xef, 0xff, 0xfe, 0x9f, 0xf8, 0x1d, 0x13, 0x18, 0xdc, 0x77, 0x77, 0xcc, 0x5e, 0xc5, 0x5c,
+  0x7c, 0x7c, 0x5c, 0x77, 0xc2, 0x20, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdf, 0xff,
+  0xfb, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0x57, 0x57, 0x26, 0x4f, 0x55, 0x55, 0x55, 0x55,
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55, 0xe2, 0x66, 0x66, 0xa6, 0x6f, 0xff, 0xfd,
+  0xbb, 0xab, 0xdb, 0xfd, 0xde, 0xdf, 0xdf, 0xdf, 0xdd, 0x33, 0x33, 0x33, 0x3d, 0xff, 0xff, 0xdf,
+  0xd3, 0x33, 0x33, 0x33, 0x3f, 0x44, 0x66, 0x66, 0x7a, 0xca, 0xca, 0xae, 0xef, 0xe4, 0x33, 0x63,
+  0x63, 0x19, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x58, 0xf7, 0x5f, 0xff, 0x35, 0x25, 0x22,
+  0x25, 0x22, 0x22, 0x22, 0x7f, 0xf8, 0x36, 0x76, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0x36,
+  0x38, 0xd7, 0x77, 0x72, 0x77, 0xc5, 0x55, 0xc7, 0x77, 0xc7, 0x77, 0xc7, 0x72, 0x20, 0x00, 0x00,
+  0x2f, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xff,
+  0x7c, 0x5c, 0x42, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0xe7, 0x66, 0xa6, 0x66, 0x6f, 0xff, 0xda, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xdf,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xdd, 0x33, 0x33, 0x33, 0x33, 0x39, 0x86, 0x06, 0x4a,
+  0xaa, 0xaa, 0xaa, 0x7c, 0xcf, 0x83, 0x36, 0x33, 0x36, 0x87, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xf9, 0xf9, 0x78, 0x0f, 0xff, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x52, 0xec, 0xff, 0x86, 0xaa,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xb6, 0x11, 0xb4, 0xd7, 0xc7, 0x77, 0xc7, 0xc5, 0xcc, 0x77,
+  0xc7, 0x7c, 0x77, 0x77, 0xc7, 0x52, 0x20, 0x20, 0x03, 0xff, 0xff, 0xff, 0xdd, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfd, 0xdd, 0xff, 0xff, 0xff, 0x5c, 0xc7, 0x74, 0x4f, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0xff, 0xf5, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfa, 0x66, 0x66, 0x66, 0xaf, 0xff, 0xa6,
+  0x66, 0x66, 0x66, 0x6a, 0x66, 0xa6, 0x66, 0x6f, 0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0xf9, 0x06, 0x6a, 0xaa, 0xa7, 0xac, 0xa4, 0xef, 0xf4, 0x33, 0xb3, 0x3b,
+  0x18, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x53, 0xff, 0x95, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0xcf, 0xff, 0xd6, 0x64, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf1, 0x66, 0x72,
+  0xbd, 0xf7, 0x77, 0x77, 0x75, 0x77, 0x77, 0x7c, 0x5c, 0x77, 0x77, 0xc7, 0x77, 0x25, 0x03, 0x34,
+  0x45, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xc5, 0xec, 0x42, 0x6f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x5e, 0xf7, 0x66, 0x66, 0xa6, 0x6f, 0xff, 0x66, 0x66, 0x6a, 0x66, 0x66, 0x66, 0x66, 0x6a, 0x6e,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf9, 0x16, 0x66, 0x7a,
+  0xaa, 0x86, 0x9f, 0xff, 0xf8, 0xb1, 0x36, 0x33, 0x87, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x9f, 0xff, 0x9e, 0x59, 0xf2, 0x02, 0x22, 0x22, 0x22, 0x52, 0x22, 0xee, 0xee, 0xff, 0x9f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xa4, 0x76, 0x4f, 0xf8, 0x72, 0x62, 0x2c, 0x77, 0xc7, 0x77,
+  0x7c, 0x77, 0x72, 0x77, 0x77, 0x22, 0x52, 0x49, 0x34, 0x44, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xe9, 0x74, 0x4f, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xf7, 0x66, 0x66, 0x66, 0xaf, 0xff, 0xa6,
+  0x66, 0x66, 0x6a, 0x66, 0x6a, 0x66, 0x66, 0x6a, 0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0xff, 0x86, 0x2a, 0xaa, 0x4a, 0x9f, 0xff, 0xff, 0xd8, 0xdb, 0xb3, 0x36,
+  0x77, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0x5f, 0xf9, 0x94, 0x11, 0x00, 0x02,
+  0x22, 0x22, 0x22, 0x52, 0xce, 0x5f, 0xee, 0xfe, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf8, 0x66, 0x4a,
+  0x8f, 0xf7, 0xc2, 0x2c, 0x77, 0x77, 0x77, 0xc7, 0x77, 0x77, 0xc2, 0x7c, 0x77, 0x25, 0x74, 0x44,
+  0x88, 0x88, 0x44, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xec, 0xe7, 0x71, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0xff, 0xf7, 0x66, 0x6a, 0x66, 0xaf, 0xff, 0x66, 0x6a, 0x66, 0x66, 0x6a, 0x66, 0x66, 0xa6, 0x6e,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xf2, 0x66, 0x67,
+  0xef, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xbb, 0x19, 0x77, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff,
+  0xff, 0x5f, 0xff, 0x55, 0x14, 0x10, 0x40, 0x00, 0x22, 0x22, 0x22, 0x22, 0xee, 0xff, 0xef, 0xff,
+  0xff, 0xee, 0xff, 0xff, 0xff, 0xf8, 0xaa, 0xe8, 0xff, 0xf7, 0x74, 0x77, 0x76, 0xc7, 0x2c, 0x2c,
+  0x77, 0xc2, 0x72, 0x27, 0x7c, 0x72, 0x77, 0x28, 0x38, 0x48, 0x88, 0x18, 0xbf, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0x71, 0x4f, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xff, 0xfc, 0x66, 0x66, 0x66, 0x6f, 0xff, 0xa6,
+  0xa6, 0x66, 0xa6, 0x66, 0x66, 0x66, 0x66, 0xaa, 0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x3f, 0xfd, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0xd3, 0xd8,
+  0x77, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x31, 0x10, 0x41, 0x10, 0x12,
+  0x22, 0x22, 0x52, 0x25, 0xee, 0xe9, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x94, 0xff,
+  0xff, 0x88, 0x47, 0x76, 0x5c, 0x2c, 0x72, 0xc2, 0xc2, 0x72, 0xc2, 0x2c, 0x27, 0x72, 0x27, 0x70,
+  0x88, 0x84, 0x88, 0x31, 0x11, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xee, 0x99, 0x74, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f,
+  0xff, 0xf7, 0x66, 0x66, 0x66, 0xaf, 0xff, 0xfa, 0x66, 0x66, 0x66, 0x66, 0x6a, 0x66, 0xa6, 0x6c,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xff, 0x98, 0x9f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x88, 0xdf, 0xf7, 0xef, 0xfe, 0xff, 0xf5, 0xff, 0xff, 0xff,
+  0x5f, 0x55, 0x30, 0x01, 0x21, 0x04, 0x04, 0x02, 0x22, 0x22, 0x22, 0x22, 0xee, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xef, 0xfe, 0xfe, 0xee, 0xee, 0x88, 0x47, 0x72, 0xc5, 0xc2, 0x72, 0xc7, 0x77,
+  0x2c, 0x52, 0x72, 0x27, 0xc2, 0xc2, 0x67, 0x77, 0x24, 0x88, 0x34, 0x88, 0x14, 0x4d, 0xff, 0xff,
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xee, 0x70, 0x4f, 0x75, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xfc, 0x66, 0x66, 0xa6, 0x6e, 0xff, 0xff,
+  0xfe, 0xac, 0xac, 0xa6, 0x66, 0x66, 0x66, 0x6e, 0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x44, 0x8f, 0xff, 0xfd, 0xdf, 0xdd, 0xff, 0xff, 0xdf, 0xff,
+  0xff, 0x99, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x35, 0x11, 0x21, 0x11, 0x11, 0x40, 0x22,
+  0x22, 0x22, 0x22, 0x25, 0x7f, 0xef, 0x5f, 0xfe, 0x55, 0x9e, 0x5f, 0xef, 0xff, 0xfe, 0xee, 0x94,
+  0x87, 0x27, 0xa5, 0x72, 0x77, 0xc2, 0x72, 0xc2, 0xc2, 0x27, 0x22, 0x22, 0xc2, 0xc2, 0x20, 0x27,
+  0x72, 0x84, 0x88, 0x88, 0x41, 0x1b, 0xff, 0xfd, 0xdb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+  0xee, 0xe9, 0x74, 0x6f, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f,
+  0xff, 0xfc, 0x66, 0x66, 0x66, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x66, 0x66, 0x66, 0x6e,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xff, 0xd3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x32, 0x4f,
+  0xff, 0xfd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x55,
+  0x53, 0x50, 0x30, 0x11, 0x04, 0x02, 0x10, 0x22, 0x22, 0x22, 0x22, 0x22, 0x5e, 0xff, 0xff, 0xf5,
+  0x55, 0x55, 0x95, 0x55, 0x5f, 0xee, 0x59, 0x38, 0x27, 0x72, 0x77, 0x6c, 0x27, 0x2c, 0x2c, 0x2c,
+  0x25, 0x2c, 0x22, 0x52, 0x2c, 0x2c, 0x24, 0x44, 0x24, 0x24, 0x88, 0x48, 0x88, 0x11, 0xff, 0xdd,
+  0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xee, 0xe9, 0x94, 0x4f, 0xe5, 0x55, 0x55, 0x55,
+  0x55, 0x5f, 0xef, 0xf5, 0x55, 0x55, 0x55, 0x5f, 0xff, 0xfc, 0x66, 0x66, 0x66, 0x66, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf6, 0x66, 0x66, 0xa6, 0xae, 0xfd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff,
+  0xff, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x94, 0x4f, 0xff, 0xfd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xf5, 0x53, 0x53, 0x00, 0x02, 0x14, 0x00, 0x41, 0x12, 0x22,
+  0x20, 0x22, 0x25, 0x22, 0x27, 0xff, 0xff, 0xf5, 0x79, 0x95, 0x95, 0x95, 0x5f, 0xff, 0x98, 0x42,
+  0x77, 0x67, 0x72, 0x72, 0xc2, 0xc2, 0xc2, 0x72, 0x22, 0x72, 0x22, 0x22, 0xc2, 0x72, 0xc2, 0x44,
+  0x44, 0x44, 0x44, 0x83, 0x84, 0x11, 0xdf, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdd,
+  0xef, 0xe9, 0x92, 0x49, 0x95, 0x55, 0x55, 0x55, 0x55, 0xe5, 0x55, 0xf5, 0x55, 0x55, 0x55, 0x55,
+  0xff, 0xff, 0xc6, 0x66, 0x66, 0x66, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x66, 0xa6, 0x66, 0x6f,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x94, 0x4d,
+  0xff, 0xfd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdf, 0xff, 0x5f, 0xf5, 0xf5, 0x53,
+  0x20, 0x23, 0x01, 0x10, 0x14, 0x01, 0x02, 0x22, 0x00, 0x22, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff,
+  0x59, 0x59, 0x95, 0x95, 0x7f, 0xf5, 0x33, 0x47, 0x27, 0x27, 0x2c, 0x27, 0x2c, 0x27, 0x27, 0x22,
+  0x57, 0x22, 0x22, 0x22, 0x27, 0x2c, 0x22, 0x44, 0x48, 0x44, 0x24, 0x88, 0x88, 0x81, 0x1f, 0xdd,
+  0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0x94, 0x4e, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0x5e, 0x55, 0x9f, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xff, 0x76, 0x66, 0x66, 0x6a, 0x6a, 0xff,
+  0xff, 0xff, 0xfd, 0x66, 0xa6, 0x66, 0x66, 0x6f, 0xfd, 0x33, 0x33, 0x33, 0x3d, 0xff, 0xff, 0xff,
+  0xff, 0x33, 0x33, 0x33, 0x33, 0x3d, 0x37, 0x49, 0xff, 0xff, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xdd, 0xff, 0xff, 0x5f, 0x53, 0x20, 0x32, 0x00, 0x40, 0x21, 0x01, 0x10, 0x22, 0x20,
+  0x00, 0x22, 0x22, 0x22, 0x22, 0x5f, 0xff, 0xff, 0x59, 0x95, 0xf5, 0xf5, 0xff, 0x53, 0x84, 0x27,
+  0x27, 0x72, 0xc2, 0xc2, 0xc2, 0x22, 0x22, 0x52, 0x2c, 0x22, 0x22, 0x25, 0x22, 0xc2, 0x72, 0x24,
+  0x44, 0x84, 0x24, 0x48, 0x48, 0x41, 0x1f, 0xfd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xee, 0xe9, 0x92, 0x19, 0xf5, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x74, 0x4f, 0x55, 0x55, 0x55, 0x55,
+  0x5f, 0xff, 0xc6, 0x66, 0x6a, 0x66, 0x66, 0x6a, 0xab, 0xaa, 0xa6, 0x66, 0x66, 0x6a, 0x66, 0xae,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x33, 0x33, 0x33, 0x3d, 0x93, 0x2f,
+  0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x20, 0x32,
+  0x00, 0x10, 0x41, 0x11, 0x40, 0x40, 0x22, 0x20, 0x00, 0x22, 0x22, 0x22, 0x20, 0x29, 0xff, 0xff,
+  0x95, 0xf5, 0x99, 0x59, 0xf8, 0x33, 0x17, 0x27, 0x27, 0x65, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2c,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xc2, 0x24, 0x44, 0x48, 0x22, 0x28, 0x83, 0x80, 0x1b, 0xff,
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0x94, 0x48, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x74, 0x2f, 0xf5, 0x55, 0x55, 0x55, 0x5f, 0xff, 0xfa, 0x6a, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x6a, 0x66, 0x66, 0x66, 0x6f, 0xff, 0x33, 0x33, 0x33, 0x3f, 0xff, 0xff, 0xff,
+  0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x92, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf3, 0x21, 0x02, 0x00, 0x11, 0x14, 0x00, 0x11, 0x04, 0x00, 0x22, 0x00,
+  0x00, 0x22, 0x22, 0x22, 0x20, 0x02, 0x9f, 0xff, 0xf9, 0x5f, 0x5f, 0x9f, 0x73, 0xb3, 0x42, 0x72,
+  0xa2, 0x5a, 0x2c, 0x22, 0x22, 0x22, 0x5c, 0x22, 0xc2, 0x22, 0x22, 0x22, 0x22, 0x65, 0x2c, 0x22,
+  0x44, 0x44, 0x22, 0x24, 0x84, 0x81, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xef, 0xee, 0x92, 0x44, 0xf5, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x71, 0x44, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0xff, 0xfc, 0x66, 0x66, 0x6a, 0x66, 0xa6, 0x66, 0xa6, 0x6a, 0x66, 0x66, 0xa6, 0xa6, 0xae,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x34, 0x4f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x41, 0x11, 0x11,
+  0x21, 0x01, 0x14, 0x00, 0x40, 0x10, 0x20, 0x02, 0x00, 0x22, 0x20, 0x22, 0x20, 0x22, 0x29, 0xff,
+  0xff, 0xff, 0xfe, 0xf9, 0x33, 0x30, 0x27, 0x65, 0x27, 0x22, 0x72, 0x22, 0x2c, 0x2c, 0x22, 0xc2,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xc2, 0x22, 0x44, 0x44, 0x22, 0x24, 0x88, 0x81, 0x11, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0x94, 0x64, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0xf5, 0x44, 0x42, 0xff, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xff, 0xc6, 0x6a, 0x66, 0x66, 0x66,
+  0xa6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6f, 0xfd, 0x33, 0x33, 0x33, 0x33, 0x3d, 0x3f, 0x3d,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x89, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf8, 0x41, 0x10, 0x40, 0x10, 0x11, 0x12, 0x10, 0x14, 0x04, 0x12, 0x20, 0x00,
+  0x00, 0x22, 0x20, 0x22, 0x20, 0x02, 0x32, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0x8b, 0x42, 0x72, 0x2c,
+  0x26, 0x52, 0x22, 0x2c, 0x22, 0x22, 0xc2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x77,
+  0x24, 0x44, 0x22, 0x24, 0x84, 0x84, 0x11, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xef, 0xee, 0x94, 0x24, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x5e, 0x54, 0x44, 0x4f, 0x55, 0x55, 0x55,
+  0x55, 0x5f, 0xff, 0xe6, 0x66, 0x66, 0x6a, 0x66, 0x66, 0xa6, 0x66, 0xa6, 0xa6, 0x6a, 0x66, 0xaf,
+  0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x35, 0x89,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x10, 0x40, 0x12, 0x11,
+  0x21, 0x01, 0x12, 0x11, 0x01, 0x02, 0x20, 0x00, 0x00, 0x02, 0x20, 0x22, 0x00, 0x20, 0x24, 0x25,
+  0x45, 0x55, 0x55, 0x43, 0x33, 0x72, 0x67, 0x22, 0x25, 0x62, 0x26, 0x22, 0x2c, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x26, 0x24, 0x80, 0x22, 0x28, 0x38, 0x48, 0x11, 0x01,
+  0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0x97, 0x14, 0xf5, 0x55, 0x55, 0x55,
+  0x55, 0xf5, 0x44, 0x04, 0x2f, 0xf5, 0x55, 0x55, 0x55, 0x5f, 0x55, 0xff, 0xa6, 0x6a, 0x66, 0x66,
+  0x66, 0x66, 0xa6, 0xac, 0x66, 0x66, 0x66, 0x6f, 0xfd, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x32, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0x30, 0x11, 0x04, 0x11, 0x10, 0x11, 0x10, 0x40, 0x10, 0x14, 0x00, 0x00, 0x21,
+  0x00, 0x02, 0x20, 0x20, 0x00, 0x20, 0x43, 0x23, 0x43, 0x99, 0x59, 0x38, 0xb4, 0x72, 0x72, 0x72,
+  0xc2, 0x22, 0x25, 0xc2, 0x22, 0x22, 0x22, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x62, 0xc2,
+  0x24, 0x42, 0x22, 0x44, 0x48, 0x84, 0x10, 0x01, 0x18, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xef, 0xfe, 0xe8, 0x44, 0xef, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x24, 0x44, 0x42, 0xff, 0x55, 0x55,
+  0x55, 0x5f, 0x59, 0x7e, 0xfe, 0xa6, 0x66, 0x6a, 0x66, 0x6a, 0x6c, 0xf9, 0x6a, 0x66, 0xa6, 0xaf,
+  0xed, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf3, 0x53, 0x9f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x04, 0x02, 0x10, 0x00, 0x41,
+  0x04, 0x01, 0x00, 0x11, 0x21, 0x00, 0x20, 0x11, 0x02, 0x00, 0x20, 0x00, 0x00, 0x24, 0x23, 0x88,
+  0xff, 0x77, 0x58, 0x3b, 0x37, 0x72, 0x22, 0x65, 0x22, 0x2c, 0x26, 0x22, 0x22, 0x22, 0x02, 0x22,
+  0x22, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0x02, 0x22, 0x48, 0x48, 0x48, 0x11, 0x01,
+  0x10, 0x18, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0x99, 0x24, 0x4e, 0xff, 0x55, 0x55,
+  0x5f, 0x55, 0x44, 0x42, 0x14, 0x5f, 0xf5, 0x55, 0x55, 0xff, 0xe5, 0x44, 0x7e, 0xfe, 0xca, 0xa6,
+  0xaa, 0xcc, 0xff, 0xdf, 0x66, 0x66, 0x66, 0xaf, 0x8f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x3f, 0x33, 0x53, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd1, 0x10, 0x11, 0x11, 0x14, 0x01, 0x10, 0x14, 0x00, 0x40, 0x11, 0x00, 0x01, 0x01,
+  0x20, 0x00, 0x20, 0x00, 0x02, 0x03, 0x98, 0x9f, 0xff, 0x97, 0x93, 0x83, 0x49, 0x22, 0x72, 0x72,
+  0x62, 0x62, 0x22, 0x22, 0x20, 0x22, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x22,
+  0x22, 0x22, 0x24, 0x43, 0x44, 0x83, 0x01, 0x07, 0x24, 0x11, 0x8b, 0xdf, 0xff, 0xff, 0xff, 0xff,
+  0xed, 0x9d, 0xe9, 0x86, 0x24, 0x4e, 0xff, 0xff, 0xf5, 0x74, 0x44, 0x04, 0x44, 0x42, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0x51, 0x44, 0x89, 0xef, 0xff, 0xfe, 0xde, 0x84, 0x4f, 0xfa, 0xaa, 0xca, 0xf9,
+  0x1f, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf3, 0x35, 0x38, 0x9d,
+  0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x30, 0x11, 0x21, 0x02, 0x10, 0x10,
+  0x21, 0x00, 0x10, 0x11, 0x01, 0x20, 0x00, 0x40, 0x11, 0x00, 0x00, 0x00, 0x02, 0x99, 0x9f, 0xff,
+  0xff, 0x77, 0x73, 0xb3, 0x87, 0x22, 0x2a, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x22,
+  0x22, 0x20, 0x02, 0x22, 0x22, 0x20, 0x44, 0x26, 0x22, 0x20, 0x44, 0x84, 0x88, 0x48, 0x01, 0x15,
+  0x77, 0x54, 0x11, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xd9, 0xd9, 0xe9, 0xc8, 0x14, 0x24, 0x55, 0x55,
+  0x54, 0x44, 0x44, 0x46, 0x24, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x41, 0x24, 0x44, 0x01,
+  0x11, 0x44, 0x44, 0x44, 0x9f, 0xff, 0xf9, 0x81, 0x14, 0x9f, 0xff, 0xd3, 0xf3, 0xf3, 0xf3, 0xd3,
+  0xd3, 0xfd, 0xff, 0xff, 0x33, 0x93, 0x99, 0xfd, 0x93, 0x83, 0xdd, 0xdd, 0xdd, 0xdb, 0xbb, 0xbb,
+  0xdd, 0xdb, 0x16, 0x10, 0x01, 0x11, 0x01, 0x12, 0x11, 0x40, 0x01, 0x40, 0x10, 0x10, 0x00, 0x01,
+  0x10, 0x00, 0x20, 0x02, 0x29, 0xd8, 0xff, 0xf9, 0x78, 0x99, 0x38, 0x3b, 0x88, 0x82, 0x22, 0x22,
+  0x22, 0x20, 0x02, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x42, 0x42,
+  0x22, 0x64, 0x84, 0x44, 0x44, 0x84, 0x00, 0x12, 0x57, 0x77, 0x54, 0x14, 0xbd, 0xff, 0xff, 0xff,
+  0xed, 0x9d, 0xe9, 0x87, 0x87, 0x14, 0x14, 0x41, 0x11, 0x14, 0x21, 0x24, 0x14, 0x04, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf2, 0x44, 0x46, 0x40, 0x41, 0x60, 0x40, 0x44, 0xc8, 0x99, 0x87, 0x84, 0x11,
+  0x41, 0x44, 0x37, 0x39, 0x93, 0xf3, 0xf3, 0xf3, 0xff, 0x3f, 0x33, 0x33, 0x35, 0x3f, 0x99, 0x33,
+  0x9d, 0x3d, 0xd3, 0xd3, 0xd3, 0xdd, 0xbd, 0xbd, 0xdb, 0xdd, 0xb3, 0x66, 0x16, 0x01, 0x12, 0x11,
+  0x10, 0x00, 0x40, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x01, 0x00, 0x49, 0x9d, 0x9f, 0xf7, 0x24,
+  0x99, 0x8f, 0x83, 0xb1, 0x88, 0x02, 0x22, 0x64, 0x20, 0x42, 0x02, 0x20, 0x22, 0x22, 0x02, 0x22,
+  0x20, 0x20, 0x22, 0x22, 0x22, 0x02, 0x41, 0x42, 0x22, 0x44, 0x44, 0x43, 0x84, 0x84, 0x01, 0x10,
+  0x57, 0x55, 0x75, 0x71, 0x1b, 0xbf, 0xff, 0xff, 0xed, 0xee, 0xee, 0x98, 0xc8, 0x87, 0x44, 0x44,
+  0x14, 0x04, 0x44, 0x44, 0x42, 0x44, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf5, 0x14, 0x42, 0x14, 0x64,
+  0x04, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x44, 0x24, 0x24, 0x45, 0x35, 0x35, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x53, 0x59, 0xf9, 0x53, 0x93, 0x93, 0xd3, 0xd3, 0xdd, 0xdd, 0x3d, 0x3d, 0xbd,
+  0xbd, 0xdb, 0xbb, 0x36, 0xb1, 0x66, 0x10, 0x10, 0x04, 0x01, 0x01, 0x01, 0x10, 0x12, 0x01, 0x01,
+  0x04, 0x00, 0x49, 0xd9, 0xf9, 0x97, 0x22, 0x78, 0xdd, 0x89, 0x83, 0xb1, 0x18, 0x41, 0x22, 0x44,
+  0x04, 0x44, 0x22, 0x22, 0x22, 0x20, 0x22, 0x20, 0x20, 0x22, 0x22, 0x22, 0x02, 0x04, 0x44, 0x41,
+  0x22, 0x44, 0x44, 0x44, 0x44, 0x38, 0x01, 0x00, 0x55, 0x27, 0x57, 0x75, 0x81, 0x3b, 0xdf, 0xff,
+  0xef, 0xff, 0xed, 0xe8, 0x87, 0x84, 0x44, 0x04, 0x47, 0x89, 0x98, 0xa4, 0x04, 0x67, 0xff, 0xf5,
+  0xff, 0xff, 0x5f, 0xf4, 0x44, 0x04, 0x42, 0x44, 0x49, 0xff, 0xff, 0xed, 0x9f, 0xef, 0xdf, 0xff,
+  0x94, 0x14, 0x44, 0x88, 0x98, 0x73, 0x55, 0x55, 0x55, 0x55, 0x53, 0x53, 0x59, 0x93, 0x93, 0x99,
+  0x93, 0xdd, 0x3d, 0x3d, 0x3d, 0xdd, 0xd3, 0xdd, 0xdb, 0xdd, 0xdb, 0xb1, 0x63, 0x63, 0x66, 0x11,
+  0x00, 0x00, 0x11, 0x21, 0x04, 0x01, 0x00, 0x12, 0x10, 0x18, 0xd9, 0xff, 0xf9, 0xcc, 0xcc, 0x2d,
+  0x82, 0x2f, 0x8b, 0x31, 0x18, 0x81, 0x26, 0x48, 0x88, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02,
+  0x02, 0x02, 0x22, 0x02, 0x20, 0x24, 0x44, 0x42, 0x22, 0x44, 0x48, 0x48, 0x48, 0x44, 0x01, 0x40,
+  0x75, 0x45, 0x75, 0x77, 0x57, 0x41, 0xbd, 0xff, 0xfe, 0xef, 0xfe, 0xee, 0x98, 0x46, 0x26, 0x7f,
+  0xff, 0xff, 0xef, 0xff, 0xf8, 0x44, 0xf9, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x84, 0x04,
+  0x8f, 0xfe, 0x99, 0xd9, 0xe9, 0x99, 0x99, 0xef, 0xff, 0x44, 0x0e, 0xff, 0xff, 0xff, 0x44, 0x9d,
+  0xdf, 0xff, 0xf9, 0x35, 0x3f, 0x53, 0x99, 0x39, 0xd9, 0x3f, 0x3f, 0x3d, 0x3d, 0x3d, 0x3d, 0xd3,
+  0xdd, 0xbd, 0xbd, 0xb3, 0xb6, 0x36, 0x63, 0x66, 0x60, 0x01, 0x01, 0x10, 0x10, 0x40, 0x40, 0x11,
+  0x01, 0x89, 0x9f, 0xff, 0xcc, 0xcc, 0x5c, 0xc2, 0xc5, 0x2f, 0x93, 0xb0, 0x01, 0x10, 0x02, 0x00,
+  0x10, 0x20, 0x02, 0x62, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x20, 0x20, 0x22, 0x14, 0x44, 0x41,
+  0x24, 0x44, 0x44, 0x44, 0x35, 0x34, 0x01, 0x00, 0x58, 0x55, 0x54, 0x54, 0x57, 0x54, 0x4b, 0xbf,
+  0xef, 0xff, 0xef, 0xee, 0x97, 0x44, 0x4f, 0xff, 0xed, 0xe9, 0xd9, 0x9e, 0xff, 0x98, 0xf9, 0x99,
+  0x9f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0xfe, 0x99, 0xd9, 0x9e, 0x9d, 0x9d, 0xe9, 0x99,
+  0x9f, 0xf4, 0x9f, 0x99, 0x99, 0x9f, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0x94, 0x99, 0x39, 0x99, 0x99,
+  0x3f, 0x3f, 0x3f, 0x3d, 0xd3, 0xd3, 0xdd, 0x3d, 0xdd, 0x3d, 0xdb, 0xdb, 0x36, 0xb3, 0x66, 0x36,
+  0x16, 0x11, 0x10, 0x40, 0x10, 0x10, 0x01, 0x01, 0x48, 0xdd, 0xff, 0xdc, 0xcc, 0xc5, 0xc5, 0x55,
+  0xcc, 0x6c, 0x01, 0x30, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x02, 0x22, 0x22, 0x22,
+  0x22, 0x20, 0x20, 0x22, 0x02, 0x02, 0x12, 0x22, 0x04, 0x44, 0x43, 0x53, 0x28, 0x48, 0x00, 0x41,
+  0x2f, 0x24, 0x7f, 0xf8, 0x57, 0x77, 0x71, 0x13, 0xfe, 0xef, 0xff, 0xff, 0x86, 0x24, 0xff, 0x9e,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0xf9, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xf7,
+  0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0x99, 0xfe, 0xff, 0x99, 0x99, 0x99, 0xfd, 0x99,
+  0x99, 0x99, 0x99, 0xff, 0x95, 0x39, 0x99, 0x3f, 0x9f, 0x3f, 0x93, 0xf3, 0xd3, 0xdd, 0x3d, 0xd3,
+  0xd3, 0xdd, 0xbd, 0xbb, 0xb3, 0x66, 0x36, 0x66, 0x66, 0x66, 0x00, 0x01, 0x21, 0x04, 0x04, 0x04,
+  0x9d, 0x9f, 0xff, 0x7a, 0xc5, 0xcc, 0x5c, 0xc5, 0x2c, 0x20, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11,
+  0x10, 0x40, 0x06, 0x00, 0x06, 0x00, 0x00, 0x20, 0x20, 0x22, 0x02, 0x02, 0x04, 0x22, 0x22, 0x02,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x01, 0x01, 0x9f, 0x7f, 0xff, 0xf9, 0x55, 0x57, 0x57, 0x40,
+  0xef, 0xef, 0xfe, 0xfe, 0x24, 0x4f, 0xfe, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0xff, 0xf9, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0xff, 0xf9, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x98,
+  0x99, 0xef, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9f, 0x93, 0x59, 0x99, 0xf3,
+  0xf9, 0xf3, 0xf9, 0x99, 0x3f, 0x3d, 0x3d, 0x3d, 0xdd, 0xd3, 0xdd, 0x3b, 0x36, 0x66, 0x66, 0x66,
+  0x66, 0x06, 0x66, 0x60, 0x10, 0x00, 0x10, 0x18, 0xd8, 0x98, 0xa6, 0x6a, 0x2c, 0xc5, 0xc5, 0x5c,
+  0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x40, 0x02, 0x00, 0x00, 0x60, 0x00,
+  0x20, 0x20, 0x22, 0x02, 0x44, 0x12, 0x22, 0x02, 0x44, 0x44, 0x44, 0x44, 0x84, 0x38, 0x01, 0x04,
+  0xdd, 0xff, 0xff, 0xf8, 0x58, 0x57, 0x55, 0x74, 0xef, 0xef, 0xff, 0xfa, 0x44, 0xef, 0x98, 0x98,
+  0x98, 0xc8, 0x98, 0xc8, 0x98, 0x9f, 0xf9, 0x99, 0x97, 0x99, 0x97, 0x99, 0x97, 0x89, 0x89, 0x9f,
+  0xf9, 0x89, 0x8e, 0xde, 0xf9, 0x88, 0xc8, 0x98, 0xc8, 0x9f, 0xf9, 0x89, 0x89, 0x89, 0x89, 0x89,
+  0x88, 0x98, 0x99, 0x9f, 0x55, 0x35, 0x99, 0xf9, 0x93, 0xf9, 0x3f, 0x3f, 0xf3, 0xf3, 0xf3, 0xd3,
+  0xd3, 0xd3, 0x33, 0xb1, 0x61, 0x66, 0x66, 0x66, 0x06, 0x66, 0x66, 0x06, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0xa6, 0x6a, 0xa6, 0x5c, 0x5c, 0xcc, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x10, 0x10, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x42, 0x44, 0x04, 0x44,
+  0x44, 0x35, 0x35, 0x35, 0x34, 0x54, 0x01, 0x10, 0x9f, 0xdf, 0xdf, 0xf4, 0x55, 0x57, 0x77, 0x57,
+  0xef, 0xee, 0xff, 0xe2, 0x47, 0xf9, 0x8c, 0x88, 0xc8, 0x88, 0xc8, 0x88, 0x8c, 0x8f, 0xf9, 0x88,
+  0x89, 0x87, 0x89, 0x87, 0x89, 0x89, 0x78, 0x8f, 0xfd, 0x9c, 0xdf, 0xff, 0xff, 0xf9, 0x88, 0x98,
+  0x98, 0x8f, 0xf9, 0x88, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x89, 0x99, 0x93, 0x53, 0x99, 0x9f,
+  0xff, 0x3f, 0xf9, 0xf3, 0xf3, 0xf3, 0xf3, 0xd3, 0xd3, 0x33, 0xb3, 0x61, 0x36, 0x16, 0x61, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x60, 0x61, 0x66, 0x66, 0x66, 0xa6, 0x66, 0xa6, 0x66, 0xc5, 0xcc, 0xc6,
+  0x26, 0x00, 0x60, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x43, 0x24, 0x42, 0x43, 0x24, 0x24, 0x44, 0x44, 0x44, 0x34, 0x01, 0x01,
+  0xdf, 0xff, 0xff, 0xf5, 0x55, 0x57, 0x55, 0x95, 0xee, 0xff, 0xee, 0xc4, 0x6f, 0xec, 0x88, 0xc8,
+  0x87, 0x89, 0x88, 0x8c, 0x88, 0x8f, 0xf8, 0x87, 0x87, 0x88, 0x87, 0x88, 0x87, 0x88, 0x8c, 0x88,
+  0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x88, 0x8c, 0x8f, 0xf8, 0x88, 0x78, 0x87, 0x88, 0x78,
+  0x78, 0x87, 0x88, 0xf5, 0x99, 0x55, 0x95, 0xf3, 0x5f, 0x5f, 0x3f, 0x3f, 0x3f, 0xf3, 0xff, 0x33,
+  0x33, 0x3b, 0x63, 0x63, 0x66, 0x63, 0x66, 0x66, 0x66, 0x66, 0x06, 0x00, 0x60, 0x66, 0x06, 0x6b,
+  0x6a, 0x6a, 0x66, 0x6a, 0x6c, 0xcc, 0xcc, 0x26, 0x00, 0x00, 0x01, 0x01, 0x10, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x43, 0x22,
+  0x32, 0x32, 0x32, 0x32, 0x44, 0x48, 0x00, 0x40, 0xdf, 0xdf, 0xdf, 0xd7, 0x54, 0x55, 0x35, 0x57,
+  0xce, 0xee, 0xfe, 0x72, 0x7f, 0x88, 0x78, 0x87, 0x88, 0x9e, 0xe9, 0x88, 0x78, 0x8f, 0xf9, 0x88,
+  0x88, 0x87, 0x88, 0x78, 0x88, 0x78, 0x78, 0x87, 0xff, 0xff, 0xd8, 0x88, 0x88, 0x9f, 0x98, 0x87,
+  0x88, 0x89, 0xf8, 0x78, 0x87, 0x88, 0x78, 0x88, 0x87, 0x88, 0x89, 0x94, 0x59, 0x53, 0x5f, 0x9f,
+  0xff, 0xf3, 0xf5, 0xff, 0xf3, 0xff, 0x33, 0x33, 0x31, 0x31, 0x13, 0xb3, 0x63, 0x66, 0x36, 0x61,
+  0x66, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb1, 0xb6, 0xb6, 0x66, 0xaa, 0xaa, 0xcc, 0xee, 0xc6, 0x20,
+  0x00, 0x20, 0x40, 0x10, 0x40, 0x01, 0x00, 0x20, 0x00, 0x00, 0x40, 0x01, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x01, 0x24, 0x23, 0x54, 0x44, 0x37, 0x40, 0x14, 0x00,
+  0xfd, 0xfd, 0xff, 0xf5, 0x55, 0x35, 0x55, 0x75, 0xce, 0xef, 0xee, 0xa4, 0xaf, 0x47, 0x84, 0x74,
+  0x8e, 0xff, 0xff, 0xf8, 0x84, 0xef, 0xf8, 0x74, 0x74, 0x78, 0x48, 0x44, 0x48, 0x48, 0x44, 0x88,
+  0xff, 0xf9, 0x48, 0x44, 0x87, 0x84, 0x44, 0x84, 0x47, 0x49, 0xf8, 0x44, 0xa4, 0x84, 0x84, 0x74,
+  0x48, 0x47, 0x49, 0x95, 0x99, 0x55, 0x35, 0xf5, 0x35, 0xff, 0xf3, 0xf3, 0xf5, 0x35, 0x35, 0x30,
+  0x31, 0x11, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x06, 0x88, 0xdd, 0xdd,
+  0xdb, 0xbb, 0xfa, 0xaf, 0xff, 0xfc, 0x62, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x20, 0x00,
+  0x00, 0x10, 0x01, 0x10, 0x10, 0x60, 0x26, 0x00, 0x60, 0x00, 0x60, 0x00, 0x01, 0x10, 0x10, 0x10,
+  0x10, 0x00, 0x00, 0x10, 0x20, 0x01, 0x00, 0x10, 0xdf, 0xdf, 0xdf, 0xd3, 0x9d, 0xff, 0x85, 0x57,
+  0xcc, 0xee, 0xee, 0x72, 0xee, 0x4a, 0x44, 0xa4, 0x7f, 0xff, 0xff, 0xff, 0x99, 0xff, 0xf8, 0x48,
+  0x48, 0x44, 0x87, 0x88, 0x44, 0x74, 0x87, 0x47, 0xdf, 0xf8, 0x47, 0x84, 0x48, 0x48, 0x84, 0xa7,
+  0x84, 0x89, 0xf4, 0x84, 0x84, 0x74, 0x78, 0xc8, 0x84, 0x84, 0x89, 0x94, 0x59, 0x53, 0x59, 0x5f,
+  0xff, 0x5f, 0x5f, 0x35, 0x35, 0x53, 0x33, 0x03, 0x00, 0x31, 0x33, 0x63, 0x63, 0x36, 0x36, 0x60,
+  0x00, 0x00, 0x00, 0x60, 0x08, 0xbd, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x40, 0x10,
+  0x60, 0x10, 0x04, 0x01, 0x00, 0x41, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x01, 0x01, 0x21, 0x01, 0x00, 0x10, 0x01, 0x01, 0x10, 0x12, 0x11,
+  0xdd, 0xdf, 0xfd, 0xdf, 0xff, 0xf9, 0x75, 0x70, 0xcc, 0xcf, 0xee, 0xa2, 0xf9, 0x47, 0x47, 0x48,
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x44, 0x74, 0x47, 0x49, 0xff, 0x47, 0x44, 0x44, 0x44,
+  0x9f, 0x84, 0x44, 0x44, 0xa4, 0x46, 0x74, 0x44, 0x44, 0x4c, 0xf4, 0x44, 0x47, 0x46, 0x8e, 0xff,
+  0x47, 0x44, 0x44, 0x9f, 0x95, 0x55, 0x59, 0x95, 0xf5, 0xf3, 0x53, 0x55, 0x53, 0x55, 0x30, 0x30,
+  0x30, 0x33, 0x13, 0x31, 0x36, 0x36, 0x63, 0x01, 0x00, 0x10, 0x60, 0x00, 0xb8, 0xdf, 0xdf, 0xff,
+  0xdf, 0xff, 0xdf, 0xff, 0xfe, 0x60, 0x10, 0x00, 0x10, 0x40, 0x10, 0x00, 0x40, 0x00, 0x01, 0x00,
+  0x22, 0x22, 0x72, 0x77, 0x75, 0x75, 0x72, 0x40, 0x00, 0x06, 0x04, 0x00, 0x01, 0x10, 0x21, 0x00,
+  0x10, 0x11, 0x10, 0x40, 0x10, 0x01, 0x11, 0x08, 0xdf, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0x51, 0x01,
+  0xcc, 0xce, 0xec, 0x76, 0xfc, 0x46, 0x44, 0x44, 0xef, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xf8, 0x44,
+  0x46, 0x44, 0x4f, 0xff, 0x84, 0x44, 0x84, 0x44, 0x9f, 0x44, 0x4a, 0x44, 0x78, 0x44, 0x44, 0x44,
+  0x44, 0x48, 0xf4, 0x84, 0x44, 0x44, 0x8f, 0xff, 0xf4, 0x44, 0x74, 0x48, 0x9f, 0x93, 0x55, 0x9f,
+  0x53, 0x55, 0x35, 0x53, 0x55, 0x33, 0x53, 0x03, 0x03, 0x03, 0x30, 0x13, 0x36, 0x36, 0x30, 0x60,
+  0x11, 0x00, 0x00, 0x01, 0xb8, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x11, 0x00, 0x40,
+  0x00, 0x10, 0x60, 0x40, 0x01, 0x10, 0x00, 0x12, 0x77, 0x75, 0x77, 0x57, 0x57, 0x75, 0x75, 0x42,
+  0x44, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0x01, 0x04, 0x00, 0x10, 0x01, 0x01, 0x10, 0x01, 0x09,
+  0xdd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd3, 0x01, 0x01, 0xcc, 0xcc, 0xec, 0xc2, 0xec, 0x47, 0x46, 0x74,
+  0x8f, 0xff, 0xff, 0xfd, 0x44, 0x4f, 0xf4, 0x44, 0x44, 0x44, 0x4f, 0xff, 0x94, 0x44, 0x46, 0x44,
+  0xc9, 0x46, 0x44, 0x4f, 0xff, 0xf9, 0x44, 0x44, 0x67, 0x48, 0xf4, 0x67, 0x64, 0x44, 0x8f, 0xff,
+  0xf4, 0x44, 0x64, 0x44, 0x4f, 0x9f, 0xff, 0x35, 0x55, 0x35, 0x55, 0x55, 0x55, 0x35, 0x33, 0x00,
+  0x33, 0x30, 0x33, 0x03, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x1b, 0x8f, 0xff, 0xfd, 0xdf,
+  0xff, 0xff, 0xff, 0xfd, 0x61, 0x00, 0x10, 0x01, 0x40, 0x00, 0x40, 0x01, 0x10, 0x00, 0x10, 0x41,
+  0x75, 0x75, 0x75, 0x75, 0x75, 0x77, 0x57, 0x14, 0x42, 0x44, 0x41, 0x04, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x21, 0x10, 0x12, 0x10, 0x40, 0x1d, 0xdd, 0xdf, 0xdd, 0xdd, 0xd3, 0x40, 0x40, 0x11,
+  0xcc, 0xcc, 0xcc, 0xc2, 0xfe, 0x46, 0x24, 0x46, 0x2f, 0xff, 0xff, 0xf4, 0x44, 0x4f, 0xf4, 0x46,
+  0x24, 0x46, 0x4f, 0xff, 0xf4, 0x46, 0x24, 0x44, 0x88, 0x44, 0x24, 0x9f, 0xff, 0xff, 0x44, 0x62,
+  0x44, 0x4c, 0xf4, 0x41, 0x24, 0x44, 0x7f, 0xff, 0xd4, 0x44, 0x44, 0x42, 0x4f, 0xf9, 0x35, 0x33,
+  0x53, 0x55, 0x53, 0x55, 0x33, 0x53, 0x50, 0x30, 0x30, 0x30, 0x03, 0x03, 0x00, 0x06, 0x01, 0x00,
+  0x01, 0x11, 0x11, 0x1b, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x10, 0x01, 0x04, 0x00,
+  0x01, 0x40, 0x00, 0x10, 0x04, 0x00, 0x01, 0x41, 0x57, 0x99, 0x9e, 0xee, 0x79, 0x57, 0x75, 0x42,
+  0x44, 0x42, 0x42, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0x04, 0x00, 0x10, 0x01, 0x0d,
+  0xdf, 0xdd, 0xd3, 0x81, 0x10, 0x11, 0x01, 0x01, 0xcc, 0xcc, 0xcc, 0xc6, 0xce, 0x42, 0x46, 0x24,
+  0x44, 0xff, 0xf8, 0x40, 0x42, 0x44, 0xf4, 0x24, 0x44, 0x24, 0x4f, 0xff, 0xf1, 0x44, 0x44, 0x26,
+  0x98, 0x24, 0x44, 0xef, 0xff, 0xfe, 0x42, 0x44, 0x40, 0x48, 0xf4, 0x24, 0x44, 0x64, 0x4f, 0xff,
+  0xf1, 0x26, 0x24, 0x14, 0x9f, 0x91, 0x10, 0x23, 0x55, 0x55, 0x55, 0x35, 0x35, 0x35, 0x30, 0x33,
+  0x33, 0x03, 0x30, 0x30, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x3d, 0xff, 0xff, 0xdf, 0xfd,
+  0xff, 0xff, 0xfd, 0xb0, 0x01, 0x04, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x40, 0x01, 0x04, 0x24,
+  0x79, 0xee, 0x9e, 0x9e, 0xee, 0x95, 0x75, 0x44, 0x44, 0x13, 0x24, 0x44, 0x20, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x18, 0x43, 0x11, 0x11, 0x01, 0x01, 0x00, 0x40, 0x10,
+  0xcc, 0xcc, 0xcc, 0xc2, 0x7e, 0x64, 0x24, 0x46, 0x26, 0x41, 0x41, 0x04, 0x26, 0x14, 0xf8, 0x04,
+  0x60, 0x12, 0x1f, 0xff, 0xf0, 0x20, 0x40, 0x40, 0x99, 0x60, 0x21, 0x9f, 0xff, 0xf1, 0x10, 0x40,
+  0x46, 0x08, 0xf0, 0x11, 0x62, 0x04, 0x7f, 0xff, 0x91, 0x21, 0x14, 0x7d, 0x91, 0x10, 0x10, 0x00,
+  0x50, 0x53, 0x53, 0x50, 0x00, 0x50, 0x30, 0x35, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x13, 0x01,
+  0x11, 0x11, 0x31, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xfd, 0xfb, 0x00, 0x10, 0x00, 0x10, 0x10,
+  0x40, 0x10, 0x40, 0x04, 0x00, 0x00, 0x04, 0x44, 0x9f, 0x9e, 0xe9, 0xe9, 0xe9, 0xe7, 0x77, 0x44,
+  0x12, 0x42, 0x32, 0x44, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x10, 0x00, 0x00, 0x01,
+  0x00, 0x10, 0x01, 0x01, 0x04, 0x04, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xc6, 0x2f, 0xc4, 0x62, 0x24,
+  0x02, 0x04, 0x02, 0x64, 0x01, 0x24, 0xf7, 0x60, 0x21, 0x26, 0x0f, 0xff, 0x94, 0x10, 0x62, 0x04,
+  0x9e, 0x14, 0x06, 0x48, 0x94, 0x12, 0x12, 0x60, 0x20, 0x47, 0xf4, 0x02, 0x01, 0x04, 0x8f, 0xff,
+  0x84, 0x04, 0x4c, 0x94, 0x10, 0x10, 0x10, 0x02, 0x05, 0x30, 0x00, 0x00, 0x00, 0x05, 0x35, 0x33,
+  0x03, 0x00, 0x30, 0x00, 0x03, 0x03, 0x00, 0x11, 0x13, 0x01, 0x18, 0xdf, 0xff, 0xfd, 0xdf, 0xff,
+  0xfd, 0xff, 0xb0, 0x00, 0x01, 0x01, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x29,
+  0xf9, 0xef, 0x9f, 0xef, 0xef, 0xef, 0x55, 0x44, 0x43, 0x53, 0x24, 0x32, 0x42, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x40, 0x04, 0x01, 0x10, 0x10, 0x11, 0x00, 0x10, 0x04, 0x01, 0x00, 0x00, 0x00,
+  0xcc, 0xcc, 0xcc, 0xcc, 0x6c, 0xe2, 0x62, 0x62, 0x60, 0x62, 0x61, 0x20, 0x40, 0x16, 0xf8, 0x04,
+  0x04, 0x01, 0x4f, 0xff, 0x81, 0x21, 0x21, 0x06, 0xef, 0x04, 0x02, 0x00, 0x40, 0x40, 0x60, 0x40,
+  0x40, 0x09, 0xf4, 0x61, 0x21, 0x21, 0xef, 0xff, 0x80, 0x46, 0x98, 0x11, 0x01, 0x01, 0x21, 0x35,
+  0x30, 0x00, 0x03, 0x00, 0x05, 0x35, 0x05, 0x50, 0x53, 0x03, 0x00, 0x30, 0x00, 0x00, 0x11, 0x13,
+  0x01, 0x11, 0x1d, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00,
+  0x04, 0x04, 0x00, 0x40, 0x60, 0x00, 0x14, 0x19, 0xef, 0xee, 0xee, 0xe9, 0xfe, 0x9f, 0x54, 0x32,
+  0x42, 0x32, 0x42, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+  0x00, 0x41, 0x04, 0x00, 0x10, 0x00, 0x02, 0x0f, 0xcc, 0xcc, 0xcc, 0xcc, 0x26, 0xee, 0x26, 0x20,
+  0x22, 0x10, 0x20, 0x06, 0x20, 0x2e, 0xf8, 0x02, 0x00, 0x00, 0x2f, 0xff, 0x40, 0x60, 0x00, 0x02,
+  0xff, 0x40, 0x00, 0x12, 0x00, 0x00, 0x20, 0x00, 0x02, 0x0e, 0xf4, 0x00, 0x00, 0x60, 0xff, 0xff,
+  0x40, 0x49, 0x90, 0x10, 0x04, 0x44, 0x42, 0x23, 0x20, 0x00, 0x00, 0x30, 0x30, 0x50, 0x50, 0x53,
+  0x55, 0x05, 0x03, 0x00, 0x30, 0x30, 0x30, 0x11, 0x11, 0x11, 0x8f, 0xdf, 0xdf, 0xfd, 0xdf, 0xff,
+  0xff, 0xd1, 0x00, 0x10, 0x00, 0x00, 0x10, 0x60, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x7f,
+  0xe9, 0xf9, 0xff, 0xfe, 0xf5, 0xff, 0x58, 0x23, 0x53, 0x24, 0x43, 0x24, 0x45, 0x32, 0x40, 0x00,
+  0x00, 0x01, 0x00, 0x10, 0x21, 0x00, 0x01, 0x21, 0x01, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x9d,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0xce, 0xe0, 0x64, 0x60, 0x26, 0x02, 0x60, 0x04, 0xef, 0xf9, 0x00,
+  0x06, 0x20, 0x1f, 0xff, 0x40, 0x00, 0x04, 0x01, 0xff, 0xe1, 0x02, 0x00, 0x60, 0x62, 0x00, 0x02,
+  0x60, 0x0f, 0xf8, 0x02, 0x60, 0x00, 0xff, 0xff, 0x14, 0xe8, 0x00, 0x04, 0x44, 0x44, 0x43, 0x20,
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x05, 0x50, 0x55, 0x35, 0x30, 0x30, 0x03, 0x00, 0x30, 0x01, 0x11,
+  0x11, 0x14, 0xdf, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0x11, 0x10, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x00, 0x10, 0x16, 0x01, 0x00, 0x10, 0x04, 0x99, 0xff, 0xef, 0xf5, 0xff, 0xff, 0xff, 0x53, 0x74,
+  0x44, 0x44, 0x45, 0x32, 0x32, 0x44, 0x42, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x11, 0x00, 0x10,
+  0x00, 0x40, 0x10, 0x00, 0x20, 0x00, 0x09, 0xd3, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x62, 0xee, 0x70,
+  0x20, 0x62, 0x00, 0x02, 0x8e, 0xf4, 0x9f, 0x00, 0x20, 0x00, 0x6f, 0xff, 0x40, 0x20, 0x00, 0x07,
+  0xf8, 0xf9, 0x00, 0x60, 0x00, 0x04, 0x90, 0x60, 0x00, 0x4f, 0xfe, 0x00, 0x00, 0x02, 0xff, 0xff,
+  0x09, 0x80, 0x04, 0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x05, 0x00,
+  0x50, 0x50, 0x53, 0x00, 0x03, 0x00, 0x30, 0x11, 0x14, 0x41, 0xff, 0xfd, 0xff, 0xdf, 0xff, 0xdf,
+  0xd3, 0x10, 0x01, 0x00, 0x10, 0x00, 0x10, 0x10, 0x01, 0x06, 0x00, 0x00, 0x40, 0x00, 0x01, 0x9e,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x54, 0x44, 0x44, 0x43, 0x44, 0x44, 0x44, 0x44, 0x32, 0x30,
+  0x00, 0x00, 0x00, 0x21, 0x01, 0x01, 0x21, 0x01, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x9d, 0x33,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x6c, 0x6c, 0xee, 0xa7, 0x44, 0xa7, 0xef, 0xf9, 0x44, 0x4f, 0xe0,
+  0x00, 0x00, 0x9f, 0xff, 0xf1, 0x00, 0x60, 0x4f, 0x94, 0x4f, 0xf8, 0x20, 0x47, 0xff, 0xf8, 0x02,
+  0x44, 0xff, 0x8f, 0x40, 0x00, 0x08, 0xff, 0xff, 0x89, 0x01, 0x44, 0x84, 0x44, 0x34, 0x44, 0x20,
+  0x00, 0x03, 0x53, 0x00, 0x00, 0x30, 0x00, 0x35, 0x03, 0x03, 0x05, 0x35, 0x30, 0x03, 0x23, 0x24,
+  0x32, 0x8f, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xb1, 0x01, 0x00, 0x10, 0x01, 0x04, 0x00, 0x04,
+  0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x04, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x43, 0x43,
+  0x43, 0x54, 0x43, 0x53, 0x23, 0x53, 0x54, 0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x93, 0x39, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0x2a, 0x7c,
+  0x9e, 0xfe, 0xfe, 0x98, 0x46, 0x44, 0x64, 0xff, 0xe8, 0xcd, 0xf8, 0x48, 0xff, 0xe9, 0x9e, 0xfe,
+  0x44, 0x44, 0xef, 0xff, 0xff, 0x98, 0x9f, 0xff, 0xff, 0xe4, 0x4e, 0xf9, 0xc9, 0xef, 0x94, 0x4f,
+  0xf4, 0x04, 0x84, 0x44, 0x84, 0x74, 0x32, 0x00, 0x00, 0x05, 0x00, 0x30, 0x30, 0x00, 0x30, 0x03,
+  0x05, 0x35, 0x30, 0x50, 0x05, 0x32, 0x02, 0x32, 0x23, 0x9f, 0xff, 0xdf, 0xdf, 0xff, 0xdf, 0xdd,
+  0x11, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x10, 0x01, 0x07, 0xff,
+  0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xf5, 0x74, 0x74, 0x74, 0x34, 0x84, 0x44, 0x44, 0x44, 0x43, 0x23,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9d, 0x33, 0x33,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x6c, 0x62, 0x64, 0x44, 0x67, 0x14, 0x64, 0x42, 0x44, 0x44, 0x49,
+  0x9e, 0x99, 0x82, 0x44, 0x48, 0x99, 0x99, 0x84, 0x16, 0x44, 0x14, 0x48, 0x44, 0x44, 0x44, 0x84,
+  0x88, 0x9f, 0xde, 0xff, 0xdf, 0xff, 0x88, 0x48, 0xe1, 0x48, 0x48, 0x48, 0x48, 0x37, 0x40, 0x00,
+  0x03, 0x03, 0x50, 0x00, 0x30, 0x00, 0x03, 0x00, 0x30, 0x50, 0x53, 0x03, 0x53, 0x05, 0x32, 0x03,
+  0x9f, 0xff, 0xdf, 0xff, 0xff, 0xfd, 0xff, 0xd3, 0x10, 0x10, 0x01, 0x00, 0x10, 0x40, 0x00, 0x01,
+  0x00, 0x10, 0x10, 0x01, 0x01, 0x00, 0x0e, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x38, 0x34,
+  0x84, 0x84, 0x44, 0x83, 0x53, 0x44, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0x39, 0x33, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x26,
+  0x76, 0x24, 0x62, 0x42, 0x64, 0xc4, 0x44, 0x64, 0x41, 0x44, 0x44, 0x40, 0x42, 0x64, 0x14, 0x62,
+  0x44, 0x42, 0x44, 0x44, 0x44, 0x62, 0x14, 0x24, 0x4e, 0x81, 0x11, 0x11, 0x44, 0x88, 0x8e, 0xfe,
+  0x81, 0x44, 0x84, 0x84, 0x34, 0x44, 0x10, 0x00, 0x55, 0x53, 0x00, 0x30, 0x03, 0x03, 0x00, 0x30,
+  0x03, 0x03, 0x05, 0x35, 0x30, 0x53, 0x03, 0x9f, 0xff, 0xfd, 0xff, 0xdf, 0xdd, 0xff, 0xff, 0xd1,
+  0x10, 0x01, 0x00, 0x10, 0x00, 0x01, 0x06, 0x00, 0x10, 0x00, 0x01, 0x02, 0x00, 0x10, 0x0e, 0xff,
+  0xff, 0xff, 0xff, 0x5f, 0xff, 0xf5, 0x84, 0x74, 0x34, 0x48, 0x43, 0x74, 0x84, 0x44, 0x35, 0x34,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd3, 0x93, 0x33, 0x33,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0xc6, 0xcc, 0x2c, 0x67, 0x74, 0xa7, 0x87, 0x87, 0xa7, 0x42,
+  0x64, 0x46, 0x24, 0x47, 0x64, 0x44, 0x24, 0x44, 0x47, 0x88, 0x46, 0x44, 0x44, 0x48, 0x44, 0x46,
+  0xe8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x04, 0x84, 0x83, 0x48, 0x84, 0x81, 0x17, 0x99,
+  0x99, 0x95, 0x50, 0x03, 0x00, 0x30, 0x30, 0x03, 0x00, 0x30, 0x03, 0x50, 0x03, 0x05, 0x3f, 0xff,
+  0xfd, 0xff, 0xdf, 0xfd, 0xdf, 0xfd, 0xfd, 0x30, 0x10, 0x01, 0x01, 0x00, 0x10, 0x10, 0x00, 0x10,
+  0x01, 0x06, 0x00, 0x10, 0x10, 0x01, 0x4f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0x37,
+  0x48, 0x84, 0x87, 0x34, 0x48, 0x48, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x99, 0x33, 0x33, 0x33, 0x93, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc6,
+  0xc2, 0xc4, 0xa7, 0x87, 0x88, 0xa8, 0x48, 0x78, 0x47, 0x44, 0x87, 0xa8, 0x48, 0x74, 0x48, 0x47,
+  0x88, 0x87, 0x87, 0x87, 0xa7, 0x87, 0x8a, 0x78, 0xf1, 0x10, 0x14, 0x31, 0x10, 0x10, 0x11, 0x41,
+  0x11, 0x11, 0x44, 0x84, 0x89, 0x49, 0x99, 0x99, 0x99, 0x95, 0x53, 0x00, 0x00, 0x30, 0x30, 0x30,
+  0x00, 0x00, 0x30, 0x35, 0x35, 0x39, 0xff, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xdf, 0xdf, 0xdb, 0x10,
+  0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0xcf, 0xef,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0x84, 0x84, 0x84, 0x84, 0x34, 0x48, 0x48, 0x44, 0x84, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x79, 0x33, 0x33, 0x93, 0x33, 0x33,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0xc6, 0xcc, 0xc6, 0xc7, 0x87, 0xa8, 0xc8, 0x78, 0xc8, 0x87,
+  0x88, 0x87, 0x88, 0x87, 0x88, 0x88, 0x78, 0x88, 0x87, 0x8a, 0x88, 0x78, 0x84, 0x88, 0x78, 0x8e,
+  0x91, 0x00, 0x11, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9f, 0xf9, 0x9e, 0xf9, 0xe9,
+  0x95, 0xff, 0x50, 0x00, 0x30, 0x35, 0x30, 0x00, 0x30, 0x30, 0x03, 0x00, 0x35, 0x3f, 0xff, 0xfd,
+  0xdf, 0xfd, 0xff, 0xdf, 0xdf, 0xfd, 0xd3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x58, 0x37, 0x88,
+  0x34, 0x84, 0x88, 0x48, 0x34, 0x84, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x7f, 0x93, 0xd3, 0x93, 0x33, 0x3f, 0x33, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xac, 0xcc, 0xc6,
+  0xcc, 0xca, 0x78, 0xc8, 0xc9, 0xc9, 0x98, 0xc8, 0xa7, 0x8a, 0x87, 0x89, 0x78, 0x78, 0xa8, 0xc8,
+  0xc8, 0x99, 0x78, 0x88, 0x98, 0xc8, 0x88, 0x9f, 0x10, 0x01, 0x41, 0x43, 0x11, 0x11, 0x11, 0x31,
+  0x11, 0x13, 0x11, 0x11, 0x97, 0xf9, 0xee, 0xe5, 0xff, 0x5f, 0x53, 0x00, 0x00, 0x30, 0x35, 0x30,
+  0x00, 0x00, 0x35, 0x30, 0x39, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xdf, 0xfd, 0xdf, 0xdf, 0x30, 0x00,
+  0x10, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x84, 0x34, 0x78, 0x37, 0x37, 0x37, 0x48, 0x41, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0xf9, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xac, 0xcc, 0x9e, 0x99, 0xe9, 0xc9, 0x89,
+  0x89, 0x89, 0x99, 0x99, 0x98, 0xc9, 0x99, 0x99, 0x9e, 0x99, 0xd9, 0x9c, 0x99, 0x99, 0x99, 0xe9,
+  0x10, 0x01, 0x44, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x01, 0x13, 0x11, 0x19, 0xee, 0x95, 0xff,
+  0x5f, 0xf5, 0x50, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x30, 0x03, 0x03, 0x53, 0xff, 0xff, 0xfd,
+  0xff, 0xdf, 0xfd, 0xdd, 0xfd, 0xfd, 0x11, 0x00, 0x01, 0x00, 0x10, 0x00, 0x10, 0x06, 0x00, 0x06,
+  0x01, 0x01, 0x00, 0x10, 0x00, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x37, 0x84,
+  0x37, 0x48, 0x48, 0x48, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x9f,
+  0xf9, 0xfd, 0xdf, 0xd3, 0x33, 0xd3, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xac, 0xcc,
+  0xac, 0xcc, 0xc9, 0xea, 0xee, 0xde, 0xde, 0xe9, 0xc9, 0xe9, 0xe9, 0xed, 0xed, 0x99, 0x99, 0x9d,
+  0xed, 0xed, 0xee, 0xd9, 0xed, 0x9e, 0xed, 0xf4, 0x10, 0x14, 0x44, 0x11, 0x11, 0x11, 0x43, 0x11,
+  0x11, 0x11, 0x14, 0x11, 0x1f, 0xef, 0xff, 0xef, 0xf5, 0xf9, 0x43, 0x00, 0x00, 0x00, 0x30, 0x03,
+  0x00, 0x00, 0x03, 0x03, 0x03, 0x5f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0xfd, 0xff, 0xd3, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x38, 0xef, 0xff,
+  0xef, 0xff, 0xef, 0xff, 0xff, 0xf5, 0x84, 0x84, 0x84, 0x84, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xff, 0xdf, 0xdf, 0xd9, 0xf3, 0x39, 0x33, 0x33, 0xf3,
+  0xec, 0xcc, 0xcc, 0xcc, 0xac, 0xcc, 0xcc, 0xac, 0xcc, 0xcc, 0xcc, 0xef, 0xfe, 0xef, 0xed, 0xee,
+  0xde, 0x9e, 0xde, 0xde, 0xee, 0xdf, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf0,
+  0x01, 0x14, 0x44, 0x40, 0x11, 0x11, 0x14, 0x31, 0x11, 0x01, 0x11, 0x11, 0x8e, 0x9e, 0x5f, 0x5f,
+  0x5f, 0x5f, 0x21, 0x30, 0x30, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x53, 0x33, 0xff, 0xdd,
+  0xfd, 0xfd, 0xfd, 0xdd, 0xfd, 0xd1, 0x10, 0x01, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10,
+  0x10, 0x00, 0x10, 0x01, 0x13, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf8, 0x43, 0x84,
+  0x88, 0x43, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff,
+  0xdf, 0xdf, 0x9d, 0xff, 0x33, 0x33, 0x33, 0x33, 0xec, 0xcc, 0xca, 0xcc, 0xcc, 0xac, 0xcc, 0xcc,
+  0xca, 0xca, 0xcc, 0xee, 0xef, 0xfe, 0xfe, 0xff, 0xef, 0xff, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x01, 0x44, 0x35, 0x30, 0x10, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x13, 0x11, 0xfe, 0xff, 0xff, 0xf5, 0xff, 0xf5, 0x32, 0x30, 0x00, 0x03, 0x00, 0x30,
+  0x03, 0x00, 0x30, 0x03, 0x00, 0x03, 0x3f, 0xff, 0xdf, 0xdf, 0xdf, 0xfd, 0xff, 0xd1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x13, 0x63, 0x3e, 0xff, 0xef,
+  0xff, 0xef, 0xff, 0x5f, 0xff, 0xf5, 0x84, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xdf, 0xdd, 0x3f, 0xf3, 0x3f, 0x33, 0x33,
+  0xfe, 0xcc, 0xcc, 0xcc, 0xac, 0xcc, 0xac, 0xac, 0xcc, 0xcc, 0xca, 0xcc, 0xfe, 0xef, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41,
+  0x01, 0x44, 0x24, 0x21, 0x01, 0x03, 0x11, 0x11, 0x11, 0x13, 0x11, 0x18, 0xff, 0xe5, 0xfe, 0xff,
+  0xf5, 0xf5, 0x83, 0x13, 0x13, 0x00, 0x00, 0x03, 0x00, 0x30, 0x03, 0x00, 0x03, 0x02, 0x39, 0xdf,
+  0xdf, 0xdf, 0xdf, 0xdd, 0xdd, 0x31, 0x01, 0x00, 0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x01, 0x01, 0x38, 0x31, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff,
+  0xfd, 0xfd, 0xff, 0xff, 0x3f, 0x33, 0x33, 0x33, 0xff, 0xec, 0xcc, 0xac, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xac, 0xca, 0xcc, 0xca, 0xcf, 0xef, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x03, 0x44, 0x32, 0x32, 0x11, 0x10, 0x11, 0x11,
+  0x11, 0x11, 0x31, 0x4f, 0xef, 0xff, 0xf5, 0xf5, 0xff, 0xf5, 0x34, 0x41, 0x10, 0x10, 0x30, 0x00,
+  0x30, 0x30, 0x30, 0x03, 0x00, 0x30, 0x31, 0xdd, 0xfd, 0xfd, 0xfd, 0xdd, 0xff, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x10, 0x01, 0x13, 0x11, 0x36, 0x1f, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0x3f, 0xf3, 0xff, 0x33, 0x33, 0xf3,
+  0xfe, 0xff, 0xcc, 0xcc, 0xca, 0xca, 0xcc, 0xac, 0xca, 0xcc, 0xca, 0xcc, 0xca, 0xfe, 0xff, 0xef,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+  0x04, 0x44, 0x44, 0x23, 0x41, 0x13, 0x11, 0x11, 0x11, 0x11, 0x14, 0xde, 0xfe, 0xef, 0xff, 0xff,
+  0x5f, 0x59, 0x44, 0x34, 0x13, 0x00, 0x03, 0x00, 0x03, 0x03, 0x00, 0x30, 0x00, 0x30, 0x03, 0x1d,
+  0xfd, 0xdd, 0xd3, 0x5d, 0xdd, 0x30, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x13, 0x1b, 0x31, 0x31, 0x1f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x25,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x33, 0x33, 0xff, 0xfe, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca,
+  0xcc, 0xca, 0xcc, 0xca, 0xcc, 0xce, 0xee, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x99, 0x99, 0x99, 0xf9, 0xf9, 0xf9, 0x94, 0x11, 0x31, 0x10,
+  0x10, 0x11, 0x11, 0xff, 0xff, 0xf5, 0xff, 0x5f, 0xff, 0xf5, 0x34, 0x41, 0x41, 0x00, 0x00, 0x03,
+  0x03, 0x53, 0x03, 0x00, 0x03, 0x00, 0x32, 0x31, 0xd3, 0x33, 0x55, 0x9d, 0xdf, 0xd0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x01, 0x36, 0x31, 0x13, 0x61, 0x8f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xf3, 0xff, 0x3f, 0x3f, 0x33, 0x33,
+  0xfe, 0xfe, 0xff, 0xcc, 0xca, 0xca, 0xca, 0xcc, 0xca, 0xcc, 0xca, 0xcc, 0xac, 0xaa, 0xef, 0xaf,
+  0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf9, 0xf9, 0xe9,
+  0xff, 0xff, 0xef, 0x9f, 0xe9, 0x34, 0x11, 0x11, 0x10, 0x13, 0x18, 0xff, 0xfe, 0xff, 0xff, 0xff,
+  0x5f, 0xe5, 0x34, 0x13, 0x11, 0x13, 0x00, 0x00, 0x03, 0x03, 0x20, 0x00, 0x30, 0x03, 0x23, 0x01,
+  0x00, 0x02, 0x14, 0x5d, 0xdd, 0xd0, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0x13, 0x63, 0x13, 0x11, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x52,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x33, 0xf3, 0xff, 0xff, 0xfe, 0xfc, 0xcc, 0xcc, 0xcc, 0xac,
+  0xcc, 0xca, 0xcc, 0xac, 0xcc, 0xcc, 0xac, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0xef, 0xef, 0xfe, 0xfe, 0xfe, 0x9f, 0xee, 0x99, 0x21, 0x11, 0x11,
+  0x11, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xee, 0xf5, 0xff, 0x95, 0x11, 0x41, 0x11, 0x11, 0x03, 0x03,
+  0x01, 0x32, 0x33, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x03, 0xfd, 0xf1, 0x00, 0x00,
+  0x10, 0x00, 0x10, 0x01, 0x00, 0x00, 0x60, 0x01, 0x31, 0x31, 0x36, 0x11, 0x06, 0x9f, 0xff, 0xef,
+  0xff, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xfd, 0xf3, 0xff, 0xf3, 0x33,
+  0xff, 0xfe, 0xff, 0xef, 0xcc, 0xcc, 0xac, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xce,
+  0xfa, 0xff, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xee, 0xf5, 0xfe, 0xef,
+  0xef, 0x9f, 0xfe, 0xfe, 0xf9, 0x43, 0x11, 0x13, 0x11, 0x31, 0x8f, 0xff, 0xef, 0xef, 0xf5, 0xff,
+  0xff, 0x58, 0x11, 0x11, 0x11, 0x30, 0x10, 0x00, 0x30, 0x13, 0x02, 0x30, 0x03, 0x00, 0x03, 0x21,
+  0x10, 0x00, 0x00, 0x08, 0xfd, 0xdd, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x13, 0x63, 0x31, 0x00, 0x66, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xff, 0xff, 0x3f, 0xff, 0x3f, 0x3f, 0x33, 0xee, 0xef, 0xff, 0xff, 0xfc, 0xcc, 0xcc, 0xac,
+  0xcc, 0xac, 0xcc, 0xcc, 0xac, 0xcc, 0xcc, 0xaa, 0xcf, 0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x9e, 0xf9, 0xff, 0xfe, 0xfe, 0xf9, 0xff, 0xf5, 0xff, 0x5f, 0x71, 0x01, 0x11,
+  0x11, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf2, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x01, 0x11, 0x30, 0x03, 0x00, 0x03, 0x03, 0x41, 0x11, 0x00, 0x00, 0x00, 0xdd, 0xfd, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x13, 0x63, 0x36, 0x10, 0x06, 0x66, 0x9f, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x33,
+  0xee, 0xef, 0xfe, 0xfe, 0xff, 0xcc, 0xcc, 0xcc, 0xac, 0xca, 0xca, 0xca, 0xca, 0xac, 0xac, 0xac,
+  0xcc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe9, 0xee, 0xee, 0xef, 0x5f,
+  0xff, 0xee, 0xff, 0xff, 0xff, 0x90, 0x10, 0x11, 0x11, 0x39, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x5f,
+  0xff, 0x95, 0x30, 0x01, 0x11, 0x11, 0x13, 0x11, 0x13, 0x01, 0x11, 0x10, 0x30, 0x00, 0x01, 0x30,
+  0x10, 0x30, 0x00, 0x00, 0x9d, 0xdf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13,
+  0x13, 0x61, 0x00, 0x66, 0x66, 0x9f, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xf3, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0xca,
+  0xca, 0xcc, 0xac, 0xac, 0xcc, 0xca, 0xca, 0xcc, 0xaa, 0xae, 0xfe, 0xaf, 0xef, 0xff, 0xff, 0xfe,
+  0xff, 0xee, 0xee, 0xef, 0xee, 0xf5, 0xff, 0xff, 0xef, 0xff, 0xf5, 0xff, 0xe9, 0xf5, 0x11, 0x10,
+  0x11, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfe, 0xf2, 0x01, 0x01, 0x11, 0x11, 0x31, 0x13,
+  0x00, 0x11, 0x11, 0x30, 0x00, 0x30, 0x30, 0x11, 0x11, 0x00, 0x00, 0x00, 0x8d, 0xdd, 0xd8, 0x00,
+  0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0x36, 0x31, 0x10, 0x06, 0x66, 0x60, 0xef, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x93, 0x93, 0xf3, 0xff, 0xff, 0xfd, 0x33,
+  0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xfc, 0xcc, 0xcc, 0xac, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
+  0xcc, 0xca, 0xaf, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xce, 0xee, 0x9e, 0xf5, 0xf5, 0xff, 0xff, 0xff,
+  0xf5, 0xff, 0xff, 0xff, 0x5f, 0xe9, 0x01, 0x01, 0x11, 0x8f, 0xff, 0xff, 0xef, 0xef, 0xff, 0xf5,
+  0xf5, 0xf5, 0x10, 0x30, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x30, 0x30, 0x11, 0x11,
+  0x30, 0x13, 0x00, 0x00, 0x1f, 0xdd, 0xdd, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x31,
+  0x36, 0x00, 0x66, 0x66, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf5,
+  0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xcc,
+  0xcc, 0xca, 0xcc, 0xac, 0xac, 0xac, 0xac, 0xac, 0xaa, 0xcc, 0xac, 0xfa, 0xff, 0xfe, 0xff, 0xfa,
+  0xee, 0xee, 0xfe, 0xef, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0x5f, 0x01, 0x03,
+  0x01, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xf4, 0x10, 0x01, 0x00, 0x13, 0x13, 0x43,
+  0x41, 0x11, 0x11, 0x10, 0x03, 0x01, 0x11, 0x10, 0x11, 0x01, 0x00, 0x00, 0x1d, 0xdf, 0xdd, 0xb1,
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x01, 0x36, 0x36, 0x30, 0x06, 0x66, 0x66, 0x61, 0xfe, 0xff, 0xff,
+  0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x55, 0x99, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf3,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0xcc, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
+  0xac, 0xaa, 0xca, 0xae, 0xff, 0xaf, 0xfa, 0xee, 0xee, 0xee, 0xee, 0x9e, 0xfe, 0xef, 0xff, 0xff,
+  0xff, 0xe5, 0xff, 0xff, 0xff, 0xf9, 0x23, 0x00, 0x13, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+  0xf5, 0xf5, 0x30, 0x11, 0x30, 0x00, 0x11, 0x44, 0x31, 0x10, 0x03, 0x01, 0x11, 0x34, 0x11, 0x01,
+  0x30, 0x13, 0x00, 0x00, 0x0d, 0xdd, 0xdd, 0x88, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x33,
+  0x00, 0x66, 0x06, 0x66, 0x04, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff,
+  0xff, 0xf9, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x55, 0x55, 0x59,
+  0xff, 0xf9, 0xf5, 0xff, 0x55, 0xff, 0x3f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
+  0xcc, 0xcc, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xaf, 0xff, 0xfa, 0xee,
+  0xee, 0xee, 0xef, 0xee, 0xee, 0xf5, 0xff, 0xef, 0x5f, 0xff, 0xff, 0xf5, 0xfe, 0x5f, 0x51, 0x13,
+  0x1f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xf5, 0x30, 0x00, 0x01, 0x11, 0x13, 0x18,
+  0x11, 0x11, 0x00, 0x00, 0x31, 0x43, 0x11, 0x10, 0x01, 0x11, 0x11, 0x30, 0x03, 0xff, 0xdf, 0xd8,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x00, 0x66, 0x66, 0x60, 0x08, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x55, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x55, 0x55, 0x55, 0x59, 0xff, 0x9f, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x3f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xcf, 0xfc, 0xcc, 0xcc, 0xac, 0xca, 0xca, 0xca, 0xca,
+  0xca, 0xca, 0xca, 0xca, 0xca, 0xaf, 0xae, 0xee, 0xee, 0xef, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x31, 0x8f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xef, 0xff,
+  0x5f, 0xf5, 0x11, 0x10, 0x03, 0x01, 0x11, 0x11, 0x13, 0x11, 0x10, 0x10, 0x11, 0x14, 0x31, 0x01,
+  0x03, 0x13, 0x10, 0x01, 0x03, 0xfd, 0xdd, 0xdb, 0x83, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x11,
+  0x06, 0x66, 0x66, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x20, 0x00, 0x02, 0x25, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff,
+  0x5f, 0xff, 0xff, 0x5f, 0x5f, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0xcc, 0xcc, 0xac, 0xac, 0xac, 0xac, 0xaa, 0xca, 0xca, 0xac, 0xac, 0xaa, 0xce, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xf5, 0xfe, 0xef, 0xef, 0xff, 0xff, 0xf5, 0xff, 0x5f, 0xe9, 0x57, 0x14,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x11, 0x13, 0x00, 0x13, 0x11, 0x11,
+  0x11, 0x11, 0x10, 0x13, 0x01, 0x34, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0xdf, 0xdf, 0xdd,
+  0x8b, 0x10, 0x00, 0x00, 0x01, 0x36, 0x33, 0x60, 0x06, 0x66, 0x60, 0x00, 0x09, 0xff, 0xff, 0xef,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xfd, 0xf3, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xcc, 0xcc, 0xca, 0xca, 0xca, 0xca,
+  0xca, 0xca, 0xac, 0xac, 0xac, 0xac, 0xac, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xef, 0xef, 0xef,
+  0xef, 0xef, 0xff, 0xff, 0xff, 0x5f, 0x55, 0x18, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xe5, 0xff,
+  0x5f, 0xf5, 0x30, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x30, 0x14, 0x11, 0x11,
+  0x10, 0x31, 0x30, 0x03, 0x00, 0xdd, 0xfd, 0xdd, 0xd8, 0xb1, 0x00, 0x00, 0x01, 0x33, 0x61, 0x00,
+  0x66, 0x66, 0x00, 0x00, 0x2e, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff,
+  0xff, 0xf5, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0xcc, 0xcc, 0xca, 0xca, 0xac, 0xac, 0xac, 0xaa, 0xca, 0xaa, 0xaa, 0xac, 0xaa,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xef, 0xef, 0xee, 0xfe, 0xfe, 0xef, 0xff, 0x59, 0x2d,
+  0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x01, 0x13, 0x13, 0x01, 0x13, 0x11,
+  0x11, 0x31, 0x11, 0x10, 0x11, 0x13, 0x11, 0x11, 0x01, 0x11, 0x11, 0x01, 0x10, 0xdd, 0xdd, 0xdd,
+  0xd3, 0xd8, 0x10, 0x00, 0x13, 0x63, 0x11, 0x06, 0x66, 0x66, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x3f, 0xdf,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0xcc, 0xac, 0xac,
+  0xaa, 0xaa, 0xca, 0xac, 0xac, 0xac, 0xaa, 0xac, 0xac, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee,
+  0xff, 0xef, 0xef, 0xef, 0x5f, 0xf5, 0x55, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
+  0x5f, 0x53, 0x01, 0x31, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x13, 0x01, 0x13, 0x01, 0x11, 0x30,
+  0x11, 0x11, 0x31, 0x11, 0x30, 0x3f, 0xdf, 0xdd, 0xdd, 0x8b, 0x80, 0x00, 0x11, 0x31, 0x30, 0x06,
+  0x66, 0x06, 0x00, 0x02, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xf5,
+  0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff,
+  0xff, 0xcf, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xaa, 0xca, 0xca, 0xca, 0xca, 0xaa, 0xca, 0xca, 0xca,
+  0xaa, 0xae, 0xee, 0xee, 0xee, 0xee, 0x95, 0xf5, 0xe5, 0xe5, 0x55, 0x55, 0xf5, 0xf5, 0x95, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0x57, 0x11, 0x11, 0x31, 0x13, 0x01, 0x11,
+  0x01, 0x11, 0x11, 0x13, 0x01, 0x11, 0x11, 0x11, 0x11, 0x30, 0x11, 0x10, 0x10, 0x0d, 0xdd, 0xfd,
+  0xdd, 0x8b, 0x83, 0x00, 0x13, 0x63, 0x60, 0x66, 0x06, 0x60, 0x00, 0x22, 0x2e, 0xff, 0xef, 0xff,
+  0xef, 0xff, 0xef, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x3f,
+  0xff, 0xff, 0xff, 0xff, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xcc, 0xcc, 0xcc, 0xca,
+  0xca, 0xac, 0xaa, 0xaa, 0xca, 0xaa, 0xac, 0xaa, 0xca, 0xaa, 0xae, 0xee, 0xee, 0xee, 0xef, 0xff,
+  0xff, 0xff, 0xf4, 0x14, 0x84, 0x74, 0x47, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xff,
+  0xff, 0x53, 0x21, 0x14, 0x18, 0x11, 0x11, 0x11, 0x01, 0x11, 0x13, 0x11, 0x11, 0x11, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x0d, 0xdf, 0xdd, 0xfd, 0xd3, 0xdb, 0x10, 0x11, 0x31, 0x00, 0x66,
+  0x66, 0x60, 0x00, 0x25, 0x29, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff,
+  0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfc, 0xcf, 0xcf, 0xcc, 0xcc, 0xcc, 0xac, 0xaa, 0xca, 0xac, 0xac, 0xaa, 0xca,
+  0xac, 0xac, 0xaa, 0xae, 0xee, 0xe9, 0xef, 0xff, 0xff, 0xff, 0xf4, 0x11, 0x43, 0x48, 0x4f, 0xff,
+  0xfe, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xe5, 0x54, 0x41, 0x34, 0x31, 0x31, 0x11, 0x00,
+  0x11, 0x00, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x01, 0x11, 0x00, 0x08, 0xdd, 0xdd,
+  0xdd, 0xd8, 0xb8, 0xb1, 0x13, 0x63, 0x00, 0x60, 0x66, 0x00, 0x02, 0x25, 0x29, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf3,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xcc,
+  0xcc, 0xaa, 0xac, 0xac, 0xaa, 0xaa, 0xca, 0xaa, 0xaa, 0xaa, 0xac, 0xaa, 0xee, 0xae, 0xee, 0xef,
+  0xff, 0xff, 0xfe, 0x11, 0x47, 0x44, 0x89, 0xff, 0xef, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0x5f,
+  0xf5, 0x32, 0x42, 0x14, 0x48, 0x11, 0x11, 0x11, 0x10, 0x10, 0x31, 0x11, 0x31, 0x11, 0x01, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0xdf, 0xdf, 0xdd, 0xdd, 0x8d, 0x8b, 0x13, 0x11, 0x06, 0x66,
+  0x66, 0x00, 0x02, 0x22, 0x0e, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf5, 0x95, 0x55, 0x55, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xcc, 0xcc, 0xaa, 0xaa, 0xac, 0xac, 0xaa, 0xca,
+  0xca, 0xca, 0xaa, 0xaa, 0xaa, 0xed, 0xef, 0xde, 0xee, 0xef, 0xff, 0x91, 0x11, 0x84, 0x9f, 0xfe,
+  0xff, 0xef, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0x55, 0x44, 0x32, 0x31, 0x13, 0x41, 0x31, 0x10,
+  0x10, 0x10, 0x01, 0x31, 0x81, 0x11, 0x01, 0x00, 0x31, 0x31, 0x11, 0x10, 0x00, 0x00, 0xdd, 0xdd,
+  0xfd, 0xdd, 0x3d, 0x8b, 0x31, 0x36, 0x00, 0x66, 0x60, 0x00, 0x22, 0x52, 0x09, 0xff, 0xff, 0xff,
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5,
+  0xf5, 0x59, 0x55, 0x22, 0x20, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xcc, 0xcc, 0xca, 0xca, 0xaa, 0xac, 0xaa, 0xaa, 0xaa, 0xca, 0xca, 0xaa, 0xaa, 0xee, 0xee,
+  0xdf, 0xef, 0xef, 0xf8, 0x10, 0x14, 0xff, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xef, 0xff, 0xff,
+  0x53, 0x51, 0x24, 0x01, 0x41, 0x1b, 0x11, 0x11, 0x10, 0x13, 0x01, 0x11, 0x11, 0x30, 0x11, 0x10,
+  0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x3d, 0xdf, 0xdd, 0xdd, 0xd8, 0xb8, 0xbb, 0x13, 0x06, 0x66,
+  0x60, 0x00, 0x22, 0x20, 0x09, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x52, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xcc, 0xcc, 0xcc, 0xaa, 0xca, 0xca, 0xaa,
+  0xca, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xde, 0xed, 0xed, 0xee, 0xde, 0x80, 0x1e, 0xfe, 0xfe,
+  0xef, 0xef, 0xff, 0xff, 0xef, 0xff, 0xef, 0x55, 0x53, 0x23, 0x24, 0x11, 0x13, 0x11, 0x11, 0x11,
+  0x10, 0x01, 0x11, 0x13, 0x63, 0x11, 0x10, 0x03, 0x03, 0x11, 0x11, 0x00, 0x00, 0x00, 0x0d, 0xfd,
+  0xdf, 0xdd, 0xdd, 0x3d, 0x88, 0x31, 0x06, 0x60, 0x60, 0x00, 0x25, 0x20, 0x07, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc, 0xff,
+  0xcf, 0xfc, 0xfc, 0xcc, 0xca, 0xca, 0xaa, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xca, 0xaa, 0xaa, 0xaa,
+  0xea, 0xfe, 0xfb, 0xee, 0xfa, 0x4e, 0xef, 0xef, 0xfe, 0xfe, 0xef, 0xef, 0xff, 0xef, 0xff, 0xe5,
+  0x32, 0x24, 0x12, 0x30, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x30, 0x11, 0x11, 0x11, 0x11, 0x01,
+  0x11, 0x13, 0x01, 0x00, 0x00, 0x00, 0x08, 0xdd, 0xdd, 0xdf, 0xdd, 0xd8, 0xdb, 0xb1, 0x06, 0x66,
+  0x00, 0x02, 0x22, 0x20, 0x09, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x5f, 0xff, 0xf5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xcf, 0xcc, 0xcc, 0xca, 0xca, 0xaa,
+  0xaa, 0xac, 0xac, 0xaa, 0xaa, 0xac, 0xaa, 0xaa, 0xaa, 0xfa, 0xfe, 0xfe, 0xde, 0xed, 0xee, 0xee,
+  0xef, 0xee, 0xfe, 0xfe, 0xef, 0xff, 0xe5, 0x53, 0x24, 0x44, 0x23, 0x50, 0x11, 0x11, 0x11, 0x31,
+  0x11, 0x01, 0x01, 0x11, 0x31, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x03, 0x00, 0x00, 0x01, 0xdd,
+  0xfd, 0xdd, 0xdd, 0x8d, 0x3d, 0x8b, 0x10, 0x66, 0x00, 0x02, 0x52, 0x00, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xf5, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf,
+  0xff, 0xcf, 0xfc, 0xff, 0xcc, 0xcc, 0xca, 0xaa, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xeb, 0xef, 0xea, 0xde, 0xee, 0xfe, 0xfe, 0xfe, 0xff, 0xef, 0xfe, 0xfe, 0xf5, 0x42,
+  0x44, 0x23, 0x22, 0x14, 0x01, 0x10, 0x11, 0x11, 0x11, 0x30, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x31, 0x11, 0x10, 0x13, 0x00, 0x00, 0x00, 0xdd, 0xdf, 0xdf, 0xdd, 0xdd, 0x8b, 0x83, 0xb1, 0x66,
+  0x00, 0x02, 0x22, 0x00, 0x07, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf5, 0x55, 0xf5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xcf, 0xcf, 0xcc, 0xcc, 0xca,
+  0xaa, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xfa, 0xee, 0xed, 0xed,
+  0xee, 0xfe, 0xee, 0xfe, 0xfe, 0xfe, 0x50, 0x14, 0x44, 0x12, 0x32, 0x32, 0x11, 0x10, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x8d,
+  0xdd, 0xdd, 0xdf, 0xdd, 0x3d, 0xdd, 0x8b, 0x06, 0x00, 0x22, 0x50, 0x00, 0x07, 0xff, 0xff, 0xef,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xfc,
+  0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xcc, 0xcc, 0xca, 0xaa, 0xaa, 0xac, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xfe, 0xf5, 0x00, 0x04,
+  0x23, 0x24, 0x24, 0x44, 0x40, 0x10, 0x10, 0x11, 0x31, 0x31, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11,
+  0x11, 0x10, 0x11, 0x33, 0x00, 0x00, 0x00, 0x1d, 0xdd, 0xfd, 0xdd, 0xdd, 0xd8, 0x3b, 0x8b, 0x36,
+  0x00, 0x22, 0x20, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x99, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfc, 0xcc,
+  0xcc, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xae, 0xbe, 0xea,
+  0xfe, 0xde, 0xee, 0xfe, 0xef, 0xe0, 0x00, 0x04, 0x21, 0x23, 0x24, 0x32, 0x41, 0x01, 0x11, 0x01,
+  0x11, 0x13, 0x63, 0x11, 0x10, 0x11, 0x13, 0x13, 0x11, 0x11, 0x10, 0x31, 0x30, 0x00, 0x00, 0x0d,
+  0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xb8, 0xd8, 0xb8, 0x00, 0x22, 0x50, 0x00, 0x04, 0xff, 0xff, 0xff,
+  0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xdd,
+  0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xcf, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
+  0xff, 0xcf, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xfc, 0xcc, 0xcc, 0xca, 0xaa, 0xaa, 0xaa, 0xca, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xae, 0xef, 0xee, 0xee, 0xee, 0xef, 0xee, 0x20, 0x00, 0x01,
+  0x44, 0x42, 0x32, 0x44, 0x41, 0x00, 0x11, 0x01, 0x13, 0x63, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11,
+  0x11, 0x10, 0x10, 0x31, 0x30, 0x00, 0x00, 0x03, 0xdd, 0xfd, 0xdd, 0xfd, 0xd3, 0xd8, 0xb8, 0xd3,
+  0x60, 0x22, 0x20, 0x00, 0x07, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfe, 0x5f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xdf, 0xdd, 0xee, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xee, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xcf, 0xff, 0xfc, 0xff,
+  0xcc, 0xcc, 0xcc, 0xac, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xeb, 0xee, 0xde, 0xee, 0xe1, 0x10, 0x81, 0x10, 0x42, 0x32, 0x44, 0x44, 0x44, 0x11, 0x10, 0x11,
+  0x11, 0x11, 0xb1, 0x11, 0x01, 0x10, 0x11, 0x31, 0x31, 0x10, 0x10, 0x11, 0x31, 0x00, 0x00, 0x00,
+  0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xd8, 0xd3, 0xdb, 0x88, 0x22, 0x20, 0x00, 0x09, 0xff, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x00,
+  0x00, 0x00, 0x05, 0x9e, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0xdd, 0xdd,
+  0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xcc, 0xfc, 0xfc, 0xcc, 0xcc, 0xaa, 0xca, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xee, 0xde, 0xa9, 0x9e, 0xf8, 0x00,
+  0x11, 0x24, 0x44, 0x44, 0x44, 0x10, 0x01, 0x11, 0x11, 0x36, 0x13, 0x11, 0x11, 0x10, 0x11, 0x16,
+  0x31, 0x01, 0x00, 0x13, 0x63, 0x00, 0x00, 0x00, 0x3f, 0xdd, 0xfd, 0xdd, 0xfd, 0xd3, 0xd8, 0x8d,
+  0x8b, 0x45, 0x20, 0x00, 0x09, 0xef, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x29, 0xfe, 0x5f, 0xee, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0x9f, 0xdf, 0xdd, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xcc, 0xff,
+  0xcf, 0xff, 0xfa, 0xec, 0xcc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xea, 0xea, 0xfe, 0xde, 0xee, 0x00, 0x04, 0x44, 0x44, 0x44, 0x44, 0x41, 0x10, 0x01,
+  0x11, 0x13, 0x11, 0x11, 0x10, 0x11, 0x13, 0x13, 0x61, 0x11, 0x00, 0x03, 0x13, 0x10, 0x00, 0x00,
+  0x1d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x8d, 0x3b, 0x8d, 0x31, 0x20, 0x00, 0x09, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf9,
+  0x52, 0x05, 0x9f, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xdd, 0xdd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xac, 0xcc, 0xca, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xae, 0xde, 0xda, 0xfb, 0xa0,
+  0x00, 0x84, 0x48, 0x44, 0x44, 0x41, 0x01, 0x11, 0x31, 0x16, 0x36, 0x11, 0x11, 0x01, 0x01, 0x11,
+  0x11, 0x11, 0x06, 0x01, 0x36, 0x31, 0x00, 0x00, 0x1d, 0xdd, 0xdf, 0xdd, 0xfd, 0xdd, 0xd3, 0xdd,
+  0x3d, 0x88, 0x20, 0x00, 0x0e, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x59, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xee, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xaf, 0xff, 0xec, 0xcc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xed, 0xee, 0xd1, 0x00, 0x14, 0x81, 0x44, 0x44, 0x34, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x31, 0x11, 0x66, 0x00, 0x13, 0x13, 0x10, 0x03,
+  0xd8, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdb, 0x8b, 0x8d, 0x38, 0x30, 0x00, 0x0f, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdd, 0xdd, 0xfd, 0xdd, 0xdd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xcf, 0xff, 0xcf, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xfa, 0xfc, 0xcc,
+  0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xea,
+  0x16, 0x16, 0x44, 0x84, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11,
+  0x61, 0x10, 0x66, 0x60, 0x63, 0x63, 0x13, 0xbd, 0xf8, 0xdd, 0xdf, 0xdd, 0xfd, 0xfd, 0xdd, 0x8d,
+  0x38, 0xb8, 0x99, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xdd, 0xdd, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xcc, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6,
+  0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xad, 0xa1, 0x01, 0x16, 0x44, 0x84, 0x44, 0x41, 0x11,
+  0x16, 0x11, 0x63, 0x61, 0x11, 0x11, 0x11, 0x13, 0x11, 0x10, 0x66, 0x60, 0x01, 0x36, 0x3b, 0xbf,
+  0xff, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0xdd, 0x3d, 0x8b, 0x88, 0xff, 0x90, 0x4f, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xdd, 0xdf, 0xdd, 0xb3,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xaf, 0xfa, 0xfa, 0xff, 0xff,
+  0xae, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xa6, 0x16, 0x11, 0x86, 0x44, 0x44, 0x44, 0x61, 0x11, 0x11, 0x11, 0x11, 0x61, 0x11, 0x11, 0x16,
+  0x11, 0x10, 0x06, 0x66, 0x00, 0x31, 0x1b, 0xdf, 0xff, 0x8d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0x8d, 0x8f, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xef, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x5f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x9f,
+  0xff, 0xfd, 0xff, 0xdd, 0xdf, 0xdd, 0xd3, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfa, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xfa, 0xaa, 0xaa, 0xaf, 0xcc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x66, 0x61, 0x16, 0x48, 0x68, 0x68, 0x11,
+  0x61, 0x63, 0x60, 0x11, 0x11, 0x16, 0x36, 0x11, 0x11, 0x10, 0x06, 0x66, 0x60, 0x63, 0x1b, 0xfd,
+  0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdd, 0xdd, 0x38, 0xdf, 0xff, 0xff, 0x9f, 0xef, 0xff, 0xef,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xdf, 0xdf, 0xdd, 0xdd, 0xbb, 0xbb,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaf, 0xef, 0xee, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x6a, 0xaa, 0xa6, 0xa6, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xa6, 0x66, 0x66, 0x16, 0x44, 0x44, 0x61, 0x36, 0x11, 0x11, 0x61, 0x11, 0x36, 0x11, 0x10,
+  0x1b, 0xb0, 0x06, 0x66, 0x60, 0x01, 0x1b, 0xdf, 0xfe, 0xf8, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0x8f, 0xfe, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xef, 0xef, 0xff,
+  0xff, 0xdf, 0xff, 0xdf, 0xdd, 0xdb, 0xb3, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0xff, 0xaa, 0xaa, 0xaa, 0x66, 0x66, 0x6a, 0xfa, 0xff, 0xfe, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0x6a, 0xaa, 0x66, 0x66, 0x66, 0x61, 0x68, 0x46,
+  0x11, 0x61, 0x16, 0x11, 0x61, 0x61, 0x1b, 0xbb, 0xbd, 0x90, 0x00, 0x66, 0x66, 0x00, 0x6b, 0xff,
+  0xee, 0xef, 0x8d, 0xdd, 0xdf, 0xdd, 0xdd, 0x3f, 0xfe, 0xee, 0xee, 0xef, 0x9f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0xf5, 0x5f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xdf, 0xfd, 0xdd, 0xbb, 0xbb, 0xbb,
+  0x88, 0x48, 0x48, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xcf, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xaa, 0xaa, 0x66, 0x60,
+  0x41, 0x46, 0xbf, 0xfa, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x6a, 0xaa, 0xaa, 0xaa,
+  0xaa, 0x6a, 0xaa, 0xa6, 0x66, 0x66, 0x66, 0x16, 0xb1, 0x11, 0x11, 0x01, 0x6b, 0xbb, 0xdb, 0xdd,
+  0xee, 0xe2, 0x20, 0x06, 0x66, 0x60, 0x1b, 0xff, 0xee, 0xed, 0x0d, 0x8d, 0xdd, 0xdd, 0xd3, 0xff,
+  0xee, 0xee, 0xce, 0xef, 0x9f, 0xff, 0xef, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0xff,
+  0xf9, 0xff, 0xff, 0xdf, 0xdd, 0xbb, 0xbb, 0xb3, 0x11, 0x11, 0x11, 0x14, 0x4f, 0xcf, 0xff, 0xff,
+  0xff, 0xef, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xcf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xca, 0xaa, 0x66, 0x00, 0x04, 0x11, 0x10, 0xad, 0xbf, 0xbf, 0xaf, 0xff, 0xfa,
+  0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0x6a, 0xa6, 0xaa, 0x6a, 0xaa, 0x6a, 0x6a, 0xa6, 0xa6, 0x66, 0x66,
+  0x61, 0x66, 0x6b, 0xbb, 0xbd, 0xdf, 0xde, 0xed, 0xee, 0xa2, 0x20, 0x06, 0x66, 0x66, 0x6b, 0xfd,
+  0xce, 0xe8, 0x08, 0xdd, 0xdd, 0xd3, 0x00, 0xfe, 0xee, 0xce, 0xee, 0xef, 0xef, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf5, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xef, 0xf9, 0xff, 0xf9, 0xdd, 0xdb, 0xb3, 0xbb,
+  0xff, 0x11, 0x11, 0x11, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc6, 0x6a, 0xaa, 0xcf, 0xfc,
+  0xfc, 0xff, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xce, 0xee, 0xe8, 0x11,
+  0x10, 0x11, 0x1f, 0xff, 0xff, 0xbf, 0xfb, 0xfa, 0xfa, 0xaa, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0xa6, 0xb6, 0x6b, 0xba, 0xce, 0xed, 0xcd, 0xaf, 0xde,
+  0xaf, 0x82, 0x22, 0x00, 0x66, 0x66, 0x6d, 0xde, 0xee, 0xe4, 0x00, 0xd8, 0x31, 0x00, 0x04, 0xfe,
+  0xee, 0xec, 0xee, 0xef, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff,
+  0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xdd, 0xbb, 0xbb, 0xff, 0x10, 0x11, 0x11, 0x1f, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xc6, 0x22, 0x26, 0x26, 0xee, 0xff, 0xff, 0xcc, 0xff, 0xfe, 0xec, 0xff, 0xff, 0xff,
+  0xff, 0xaa, 0xaa, 0xef, 0xff, 0xff, 0xff, 0x81, 0x61, 0x41, 0x6d, 0xbf, 0xbf, 0xfb, 0xff, 0xaf,
+  0xff, 0xcc, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xa6, 0xaa, 0xaa, 0x6a, 0x6a, 0xaa, 0xa6, 0xaa, 0xba,
+  0xaa, 0xaa, 0x6a, 0xaa, 0xae, 0xbe, 0xfb, 0xed, 0xee, 0xa0, 0x22, 0x26, 0x06, 0x66, 0x6b, 0xfe,
+  0xde, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xec, 0xee, 0xee, 0xff, 0x7f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xff, 0xef, 0xff, 0x9f, 0x9d, 0xdb, 0xbb,
+  0xff, 0x41, 0x11, 0x11, 0x1d, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x06, 0xef, 0xaf,
+  0xaf, 0xfa, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaa, 0xae, 0xfc, 0xef, 0xff, 0xff, 0xa0,
+  0x01, 0x01, 0x1d, 0xfb, 0xfb, 0xff, 0xfa, 0xff, 0xaf, 0xfa, 0xcc, 0xca, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0x6a, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaf,
+  0xaf, 0xa1, 0x22, 0x20, 0x00, 0x66, 0x6d, 0xed, 0xef, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xed,
+  0xef, 0xee, 0xee, 0xff, 0x9e, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf5, 0xff, 0xef, 0xf8, 0xdd, 0xb3, 0xff, 0x41, 0x11, 0x11, 0x1f, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0xda, 0xff, 0xff, 0xfa, 0xac, 0xcc, 0xff, 0xff, 0xff, 0xff,
+  0xfa, 0xaa, 0xef, 0xfa, 0xff, 0xff, 0xfa, 0x11, 0x10, 0x11, 0x6d, 0xdf, 0xff, 0xbf, 0xbf, 0xbf,
+  0xfa, 0xff, 0xee, 0xcc, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xa6, 0xaa,
+  0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbf, 0xb0, 0x62, 0x26, 0x06, 0x06, 0x6d, 0xbe,
+  0xbf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xde, 0xde, 0xfe, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff,
+  0xff, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0xfe, 0x9f, 0xdd, 0xbb,
+  0xf9, 0x11, 0x01, 0x10, 0x4d, 0xdd, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xda,
+  0xfa, 0xff, 0xaa, 0xac, 0xcf, 0xff, 0xff, 0xff, 0xca, 0xac, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x11,
+  0x11, 0x01, 0x4d, 0xdb, 0xdd, 0xff, 0xaf, 0xfa, 0xff, 0xfa, 0xfa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xba, 0xab, 0xaa,
+  0xaa, 0xa6, 0x66, 0x22, 0x20, 0x00, 0x6d, 0xed, 0xef, 0x60, 0x06, 0x00, 0x00, 0x00, 0xaf, 0xde,
+  0xdf, 0xed, 0xed, 0xef, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf5, 0xff,
+  0x5f, 0xff, 0xfe, 0xf5, 0xff, 0xff, 0x2d, 0xdb, 0x11, 0x11, 0x10, 0x11, 0xdd, 0xfd, 0xfd, 0xff,
+  0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xde, 0xdd, 0xff, 0xff, 0xca, 0xaa, 0xaa, 0xcf, 0xff, 0xff,
+  0xaa, 0xef, 0xff, 0xff, 0xff, 0xfa, 0x11, 0x10, 0x01, 0x10, 0xbd, 0xdf, 0xdd, 0xbb, 0xff, 0xff,
+  0xfa, 0xff, 0xff, 0xaf, 0xfa, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa,
+  0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0xa6, 0x66, 0x66, 0x66, 0x60, 0x6d, 0xea,
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x06, 0xde, 0xbf, 0xaf, 0xbe, 0xde, 0xde, 0xf9, 0xff, 0xef, 0xff,
+  0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x55, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xf5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0x59, 0xdb,
+  0x11, 0x11, 0x11, 0x08, 0xdd, 0xdd, 0xfd, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x01, 0x9b, 0xdd,
+  0xbb, 0xff, 0xf6, 0x66, 0x6a, 0xac, 0xac, 0xaa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x11, 0x1f,
+  0x91, 0x11, 0xdd, 0xdd, 0xdf, 0xde, 0xfe, 0xaf, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb,
+  0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0xb6, 0xaa, 0xb6, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xb6, 0x66, 0x66, 0x66, 0x66, 0x6a, 0xbe, 0xba, 0x00, 0x00, 0x06, 0x00, 0x66, 0xde, 0xed,
+  0xfd, 0xee, 0xbe, 0xbf, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+  0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff,
+  0xff, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xf9, 0xdb, 0x11, 0x11, 0x01, 0x14, 0xdd, 0xdd, 0xfd, 0xfd,
+  0xfd, 0xd1, 0x10, 0x00, 0x00, 0x01, 0xd9, 0x9d, 0xed, 0xeb, 0xfe, 0x10, 0x22, 0x6a, 0xaa, 0xaa,
+  0xaa, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x11, 0x8f, 0xf9, 0x11, 0x1d, 0xdd, 0xbd, 0xaf, 0xee, 0xee,
+  0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xfa, 0xfa, 0xea, 0xff, 0xab, 0xab, 0xaa, 0xaa, 0xaa, 0xa6, 0xa6,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xa6, 0xaa, 0xaa, 0xa6, 0x66, 0x66, 0x66, 0x66, 0xaa, 0xaa,
+  0xa6, 0x66, 0x66, 0x00, 0x60, 0x0b, 0xee, 0xbe, 0xaf, 0xbf, 0xfa, 0xfd, 0xfc, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+  0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x5f, 0xf5, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xe9, 0xfb,
+  0x11, 0xf9, 0x11, 0x11, 0x8d, 0xdd, 0xdf, 0xdd, 0xdf, 0xf1, 0x00, 0x00, 0x00, 0x01, 0x9d, 0xd9,
+  0xbd, 0xde, 0xff, 0x10, 0x06, 0x06, 0x66, 0x6a, 0xaa, 0xaf, 0xff, 0xff, 0xfa, 0x11, 0x11, 0xff,
+  0xff, 0x81, 0x18, 0xdd, 0xdd, 0xdf, 0xee, 0xee, 0xee, 0xaf, 0xfa, 0xff, 0xfa, 0xfe, 0xce, 0xee,
+  0xea, 0xff, 0xfa, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xab, 0xaa, 0xa6, 0xaa, 0xaa,
+  0xab, 0xa6, 0x66, 0x66, 0x66, 0x66, 0x6a, 0xba, 0xa6, 0x66, 0x66, 0x66, 0x66, 0x6b, 0xac, 0xeb,
+  0xfb, 0xea, 0xfd, 0xea, 0xfe, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+  0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xbb, 0xbb, 0xbd, 0xdf, 0xfe, 0xff,
+  0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xf5, 0xfb, 0x1f, 0xff, 0x91, 0x11, 0x1d, 0xdd, 0xdd, 0xdf,
+  0xff, 0xf1, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x8d, 0x99, 0xb9, 0xbf, 0xf0, 0x04, 0x02, 0x02, 0x62,
+  0x60, 0x6a, 0xff, 0xff, 0xf6, 0x11, 0x19, 0xff, 0xff, 0xf4, 0x11, 0xdd, 0xd8, 0xfe, 0xce, 0xce,
+  0xce, 0xff, 0xff, 0xfa, 0xff, 0xae, 0xec, 0xce, 0xcf, 0xfa, 0xff, 0xff, 0xfb, 0xfa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0x6a, 0xaa, 0xaa, 0x6a, 0xa6, 0x66, 0x66, 0x66, 0x66, 0x6a, 0xab,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xbe, 0xef, 0xef, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff,
+  0xf5, 0xff, 0xbb, 0xbb, 0xbb, 0xbd, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xf5, 0xfb,
+  0xff, 0xff, 0xf8, 0x11, 0x11, 0x18, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0x14, 0x9d,
+  0x9d, 0x9d, 0x9f, 0xf9, 0x11, 0x11, 0x06, 0x20, 0x0c, 0x44, 0xae, 0xff, 0xa1, 0x11, 0x4f, 0xff,
+  0xff, 0xff, 0x41, 0x11, 0x11, 0xef, 0xee, 0xee, 0xee, 0xef, 0xaf, 0xff, 0xff, 0xec, 0xee, 0xce,
+  0xcc, 0xff, 0xaf, 0xaf, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xba, 0xab, 0xaa, 0xaa, 0xaa, 0xa6, 0xaa,
+  0xaa, 0xb6, 0x66, 0x66, 0x66, 0x66, 0x6b, 0xa6, 0x66, 0x66, 0x66, 0x66, 0x66, 0xba, 0xba, 0xba,
+  0xba, 0xba, 0xba, 0xaa, 0xbf, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x5f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdb, 0xbb, 0xbb, 0xbb, 0xbd, 0xff,
+  0xf5, 0xff, 0x5f, 0xff, 0xff, 0xf5, 0x5f, 0xdb, 0xff, 0xff, 0xff, 0x11, 0x11, 0x11, 0x14, 0x9f,
+  0xfe, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0xd8, 0xd9, 0xd8, 0xff, 0x41, 0x00, 0x10, 0xf4,
+  0x01, 0xf9, 0x06, 0xf6, 0x11, 0x11, 0x8f, 0xff, 0xff, 0xff, 0xd1, 0x11, 0x11, 0x1f, 0xce, 0xec,
+  0xee, 0xef, 0xff, 0xaf, 0xaf, 0xcf, 0xce, 0xec, 0xee, 0xaf, 0xfa, 0xff, 0xaf, 0xea, 0xfe, 0xea,
+  0xfa, 0xbb, 0xaa, 0xba, 0x6a, 0xa6, 0xaa, 0xaa, 0x6a, 0xaa, 0x66, 0x66, 0x66, 0x66, 0x66, 0xa6,
+  0x66, 0x66, 0x66, 0x66, 0x6b, 0x6b, 0xaa, 0xaa, 0xba, 0xba, 0xba, 0xba, 0xad, 0xaf, 0xff, 0xff,
+  0xff, 0xf5, 0xf5, 0x55, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0xff,
+  0xff, 0xe5, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xff, 0xf5, 0xf5, 0xff, 0x55, 0x5f, 0xff, 0xdb,
+  0xff, 0xff, 0xff, 0xf1, 0x11, 0x11, 0x11, 0x1f, 0xee, 0xef, 0x40, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x8d, 0xd8, 0xdd, 0xdf, 0xf4, 0x11, 0x10, 0x11, 0x00, 0xd9, 0x80, 0x11, 0x11, 0x11, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0x11, 0x01, 0x4f, 0xee, 0xee, 0xce, 0xcf, 0xff, 0xff, 0xff, 0xec, 0xec, 0xee,
+  0xcf, 0xfa, 0xff, 0xff, 0xff, 0xaf, 0xcc, 0xec, 0xea, 0xfa, 0xbb, 0xab, 0xaa, 0xaa, 0xaa, 0x6a,
+  0xaa, 0xba, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0xba, 0xba, 0xba,
+  0xba, 0xab, 0xab, 0xab, 0xab, 0xfe, 0xff, 0xff, 0xfe, 0xf5, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xf5, 0xff, 0xef, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xef, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbb, 0xff, 0xff, 0xff, 0xf4, 0x11, 0x11, 0x11, 0x1f,
+  0xee, 0xee, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x11, 0x19, 0xd9, 0xd9, 0x9f, 0xff, 0x81, 0x10, 0x01,
+  0x10, 0x01, 0x01, 0x00, 0x11, 0x04, 0xd8, 0xdd, 0xdf, 0xff, 0xdd, 0x81, 0x11, 0x4f, 0xee, 0xce,
+  0xee, 0xef, 0xef, 0xaf, 0xfa, 0xfe, 0xee, 0xec, 0xec, 0xff, 0xfa, 0xff, 0xff, 0xec, 0xee, 0xce,
+  0xaf, 0xaf, 0xaf, 0xab, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0xb6, 0xba, 0xaa, 0xaa, 0xba, 0xba, 0xba, 0xba, 0xba, 0xfe, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xee, 0xff, 0xef, 0xff, 0xff, 0x5f,
+  0xff, 0xff, 0xfc, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdd, 0xdf, 0xff, 0xff, 0xfd, 0xbb, 0xbb,
+  0x88, 0x8d, 0x8d, 0x8d, 0x81, 0x11, 0x11, 0x1f, 0xee, 0xee, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01,
+  0x11, 0x88, 0x8d, 0xdd, 0xff, 0xf9, 0x01, 0x11, 0x10, 0x00, 0x11, 0x11, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x8d, 0xd8, 0xd4, 0x11, 0x4f, 0xee, 0xee, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xec, 0xee,
+  0xef, 0xea, 0xff, 0xff, 0xff, 0xaf, 0xce, 0xce, 0xff, 0xfa, 0xfb, 0xfa, 0xfa, 0xfa, 0xab, 0xaa,
+  0xbb, 0xab, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x6b, 0x6b, 0x6b, 0xab, 0xab,
+  0xab, 0xab, 0xab, 0xab, 0xaa, 0xde, 0xef, 0xff, 0xff, 0xfe, 0xfe, 0xef, 0xef, 0xff, 0xff, 0xff,
+  0xff, 0x5f, 0xfa, 0xff, 0xef, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xd8, 0xdb, 0xbb, 0xbb, 0xbb, 0x83, 0x88, 0x39, 0xd9, 0xd4, 0x11, 0x41, 0x9f,
+  0xef, 0xff, 0xef, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x83, 0x84, 0x88, 0x88, 0x88, 0x84, 0x88,
+  0x88, 0x38, 0x88, 0x8b, 0x88, 0x38, 0x84, 0x83, 0x83, 0xd8, 0xdd, 0x9d, 0x41, 0xff, 0xff, 0xee,
+  0xee, 0xff, 0xfa, 0xff, 0xaf, 0xff, 0xee, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xea,
+  0xfa, 0xff, 0xfa, 0xff, 0xff, 0xaf, 0xfe, 0xfa, 0xba, 0xbb, 0xb6, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x6b, 0x6b, 0x6b, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xbe, 0xff, 0xff,
+  0xff, 0xfe, 0xfc, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xbe, 0xf5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0x9f, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0x88, 0x88, 0xd8, 0xd8, 0xd9, 0x30, 0x10, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x88, 0x88, 0x83, 0x88, 0x38, 0x83, 0x83, 0x88, 0x88, 0x88, 0x38, 0x88, 0x88, 0x38, 0x88,
+  0x88, 0xdd, 0x99, 0xd8, 0xd4, 0xff, 0xff, 0xfe, 0xff, 0xef, 0xef, 0xff, 0xff, 0xaf, 0xff, 0xef,
+  0xfa, 0xff, 0xaf, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xaf, 0xaf, 0xfa, 0xfa, 0xfa, 0xfa, 0xff,
+  0xaf, 0xab, 0xba, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xb6, 0xbb, 0xaa, 0xba, 0xb6,
+  0xba, 0xab, 0xaa, 0xba, 0xba, 0xbe, 0xfe, 0xff, 0xfe, 0xfe, 0xeb, 0xba, 0xf5, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xbb, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x5f, 0xfe, 0xfe, 0xe9, 0xdb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xdd, 0x81, 0xd8, 0xd9, 0xd9, 0xd9, 0x98, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x11, 0x38, 0x83, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x38, 0x88, 0x88, 0x88, 0x8b, 0x81, 0xdd, 0x9d, 0x9d, 0x8d, 0x8d, 0xff, 0xff, 0xff,
+  0xef, 0xfe, 0xff, 0xaf, 0xff, 0xff, 0xaf, 0xff, 0xef, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+  0xfa, 0xff, 0xff, 0xaf, 0xbf, 0xff, 0xaf, 0xaf, 0xfb, 0xff, 0xfa, 0x60, 0x60, 0x11, 0x61, 0x60,
+  0x61, 0x66, 0x36, 0xbb, 0x6b, 0x6b, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xbe, 0xff, 0xff,
+  0xff, 0xfe, 0xeb, 0xab, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xab, 0xef, 0xff, 0xff, 0xff,
+  0x5f, 0xff, 0xf5, 0xff, 0xee, 0x7f, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xd4, 0xdd, 0x9d, 0x9d, 0x9d, 0xd8, 0x9f, 0xff, 0xff, 0xff, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x18, 0x88, 0x88, 0x38, 0x88, 0x88, 0x38, 0x88, 0x88, 0x88, 0x38, 0x38, 0x84, 0x1d,
+  0xd8, 0xd9, 0xd8, 0xdd, 0x8f, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xff, 0xaf, 0xff, 0xff, 0xaf,
+  0xfa, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xff, 0xff, 0xaf, 0xaf, 0xff, 0xfa, 0xfa, 0xff, 0xfa,
+  0xfa, 0xfa, 0xfb, 0x61, 0x00, 0x60, 0x01, 0x00, 0x00, 0x06, 0x6b, 0xb6, 0xb6, 0xba, 0xba, 0xba,
+  0xaa, 0x6b, 0xab, 0xab, 0xab, 0xaf, 0xef, 0xfe, 0xff, 0xfe, 0x9b, 0xab, 0xbf, 0x5f, 0xff, 0x5f,
+  0xff, 0xff, 0xef, 0xfb, 0xbb, 0xfe, 0xef, 0x5f, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf7, 0xdb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf8, 0xd8, 0xd8, 0xd8, 0xd8, 0x8d, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xef, 0x94, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x88, 0x38, 0x88, 0x38, 0x88,
+  0x88, 0x1b, 0x4b, 0x88, 0x88, 0x88, 0x1b, 0x4d, 0x9d, 0x9b, 0xdd, 0x9d, 0x8f, 0xff, 0xff, 0xef,
+  0xef, 0xee, 0xec, 0xee, 0xff, 0xaf, 0xff, 0xfa, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xfa, 0xfa,
+  0xff, 0xfe, 0xee, 0xaf, 0xaf, 0xff, 0xfa, 0xff, 0xbf, 0xee, 0xef, 0xb6, 0x00, 0x06, 0x06, 0x06,
+  0x06, 0x03, 0xbb, 0xbb, 0xbb, 0xab, 0xab, 0xab, 0xab, 0xaa, 0xaa, 0xba, 0xba, 0xbf, 0xff, 0xff,
+  0xfe, 0xfe, 0xeb, 0xba, 0xbf, 0xef, 0xff, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xba, 0xff, 0x5f, 0xff,
+  0xff, 0xf5, 0xff, 0xf5, 0xff, 0xef, 0x9f, 0xbb, 0xbb, 0xbd, 0xdd, 0xdd, 0xdd, 0xfd, 0xfd, 0xee,
+  0xf9, 0xd9, 0xdd, 0x9d, 0xd8, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xef, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0x11, 0x18, 0x88, 0x88, 0x8b, 0x18, 0x8b, 0x88, 0x83, 0x88, 0x1b, 0x48, 0xdf, 0x8d,
+  0x8d, 0xd9, 0x8d, 0x98, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xee, 0xee, 0xee, 0xcf, 0xff, 0xaf, 0xff,
+  0xff, 0xce, 0xef, 0xff, 0xaf, 0xaf, 0xff, 0xff, 0xfa, 0xec, 0xee, 0xee, 0xfa, 0xfa, 0xff, 0xbf,
+  0xae, 0xce, 0xef, 0xfb, 0xbb, 0x63, 0x63, 0xb3, 0xb3, 0xbb, 0xba, 0xaa, 0xba, 0xba, 0xba, 0xba,
+  0xaa, 0xba, 0xba, 0xab, 0xab, 0xbe, 0xff, 0xff, 0xff, 0xf5, 0xfa, 0xbb, 0xab, 0xfe, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0xef, 0xbb, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xee, 0xe9, 0xfd,
+  0xdf, 0xfd, 0xdd, 0xdd, 0xdf, 0xdf, 0xff, 0xee, 0xff, 0x83, 0x48, 0x38, 0x18, 0xff, 0xef, 0xff,
+  0xfd, 0xef, 0xee, 0xee, 0xee, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x83, 0x8b, 0x18, 0x83,
+  0x84, 0x83, 0x88, 0x88, 0x88, 0x3d, 0xff, 0x8d, 0xd8, 0x9d, 0xd9, 0x89, 0xff, 0xff, 0xef, 0xeb,
+  0xfe, 0xee, 0xce, 0xee, 0xee, 0xef, 0xff, 0xaf, 0xfc, 0xfe, 0xef, 0xfe, 0xef, 0xff, 0xaf, 0xfa,
+  0xfe, 0xee, 0xee, 0xce, 0xef, 0xff, 0xaf, 0xfa, 0xfe, 0xec, 0xee, 0xef, 0xbd, 0xbb, 0xbb, 0xbb,
+  0xba, 0xba, 0xae, 0xee, 0xaf, 0xbf, 0xbb, 0xaa, 0xba, 0xba, 0xba, 0xba, 0xbb, 0xfe, 0xff, 0xef,
+  0xef, 0xfe, 0xfb, 0xaa, 0xbb, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xfa, 0xbb, 0xfe, 0xef,
+  0x5f, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xee, 0x9f, 0xea, 0xee, 0xeb, 0xfd, 0xdd, 0xdf, 0xdf, 0xee,
+  0xff, 0x88, 0x88, 0x88, 0x8f, 0xfe, 0xee, 0xef, 0xee, 0xfe, 0xec, 0xee, 0xee, 0xf5, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x18, 0x88, 0x88, 0x88, 0x88, 0x8b, 0x88, 0x88, 0x38, 0x38, 0xff, 0xff, 0xfd,
+  0x9d, 0xd8, 0xd8, 0x8f, 0xff, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xff, 0xff,
+  0xaf, 0xec, 0xff, 0xee, 0xce, 0xef, 0xff, 0xaf, 0xfe, 0xec, 0xee, 0xee, 0xee, 0xaf, 0xff, 0xaf,
+  0xec, 0xee, 0xee, 0xfe, 0xee, 0xdd, 0xdb, 0xea, 0xea, 0xee, 0xee, 0xce, 0xfb, 0xfa, 0xff, 0xfe,
+  0xee, 0xff, 0xaf, 0xaa, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xf5, 0xfe, 0x9b, 0xad, 0xfe, 0xef, 0xef,
+  0x5f, 0xf5, 0xff, 0xe5, 0xff, 0xbe, 0xef, 0x5f, 0xff, 0x5f, 0xff, 0xf5, 0xff, 0xff, 0xee, 0xee,
+  0xfe, 0xee, 0xee, 0xbf, 0xbf, 0xff, 0xea, 0xee, 0xff, 0x18, 0x83, 0x81, 0xff, 0xee, 0xee, 0xee,
+  0xfd, 0xee, 0xee, 0xee, 0xe5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x18, 0x38, 0x88,
+  0x38, 0x83, 0x88, 0x88, 0x8d, 0xff, 0xff, 0xf8, 0xd9, 0x88, 0x34, 0xff, 0xfe, 0xee, 0xed, 0xfa,
+  0xfe, 0xec, 0xee, 0xce, 0xee, 0xee, 0xea, 0xff, 0xfe, 0xee, 0xef, 0xce, 0xee, 0xea, 0xff, 0xff,
+  0xec, 0xee, 0xec, 0xef, 0xee, 0xff, 0xaf, 0xff, 0xee, 0xec, 0xee, 0xfe, 0xfe, 0xee, 0xbe, 0xee,
+  0xee, 0xce, 0xce, 0xea, 0xee, 0xaf, 0xaf, 0xae, 0xae, 0xaf, 0xfe, 0xef, 0xaf, 0xfe, 0xfe, 0xfe,
+  0xfe, 0xfe, 0xfe, 0xce, 0xdb, 0xef, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xef, 0xf5,
+  0xff, 0xff, 0xf5, 0xff, 0xff, 0x5f, 0xfe, 0xe7, 0xff, 0xee, 0xaf, 0xff, 0xfb, 0xfa, 0xfe, 0xee,
+  0xff, 0x88, 0x88, 0x89, 0xfe, 0xee, 0xee, 0xee, 0xef, 0xbe, 0xee, 0xec, 0xee, 0xef, 0x92, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0xff, 0xff, 0xff, 0xf3,
+  0x48, 0x38, 0x88, 0xdf, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfa,
+  0xfe, 0xce, 0xee, 0xee, 0xee, 0xff, 0xfa, 0xff, 0xee, 0xec, 0xee, 0xef, 0xfe, 0xff, 0xff, 0xaf,
+  0xce, 0xce, 0xee, 0xfe, 0xfa, 0xfa, 0xfe, 0xee, 0xce, 0xee, 0xec, 0xee, 0xef, 0xfb, 0xff, 0xee,
+  0xee, 0xee, 0xfe, 0xaf, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xf5, 0xfe, 0xed, 0xcf, 0xbf, 0x7f, 0xff,
+  0xff, 0xff, 0xff, 0xef, 0x5f, 0xfb, 0xee, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff,
+  0x5f, 0xee, 0xee, 0xbf, 0xaf, 0xff, 0xee, 0xee, 0xff, 0xd8, 0x83, 0x4f, 0xee, 0xec, 0xee, 0xef,
+  0xfe, 0xfe, 0xec, 0xee, 0xee, 0xee, 0xff, 0x93, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0xb3,
+  0x83, 0x88, 0x18, 0xbf, 0xff, 0xff, 0xff, 0xf8, 0x88, 0x88, 0x84, 0xfe, 0xee, 0xce, 0xff, 0xeb,
+  0xee, 0xee, 0xce, 0xee, 0xfe, 0xef, 0xef, 0xff, 0xfc, 0xfe, 0xce, 0xee, 0xce, 0xef, 0xff, 0xaf,
+  0xaf, 0xee, 0xee, 0xee, 0xfe, 0xea, 0xff, 0xfe, 0xee, 0xee, 0xce, 0xfe, 0xff, 0xff, 0xfa, 0xfe,
+  0xee, 0xce, 0xce, 0xce, 0xea, 0xff, 0xaf, 0xae, 0xec, 0xee, 0xef, 0xfa, 0xff, 0xef, 0xef, 0xef,
+  0xef, 0xf5, 0xfe, 0xee, 0xbe, 0xef, 0xfe, 0xef, 0x5f, 0xff, 0x5f, 0xff, 0xfc, 0xff, 0xee, 0xef,
+  0xfe, 0xf5, 0xff, 0x5f, 0xf5, 0xff, 0xff, 0xfe, 0xf9, 0xfe, 0xee, 0xfb, 0xff, 0xaf, 0xce, 0xee,
+  0x44, 0x11, 0x44, 0xff, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xef, 0xee, 0xee, 0xee, 0xe5, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x88, 0x88, 0x88, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xf8,
+  0x83, 0x88, 0x83, 0xfe, 0xee, 0xee, 0xee, 0xff, 0xef, 0xce, 0xee, 0xee, 0xfe, 0xef, 0xea, 0xfa,
+  0xff, 0xce, 0xee, 0xee, 0xee, 0xee, 0xfa, 0xff, 0xfe, 0xce, 0xec, 0xff, 0xfe, 0xff, 0xaf, 0xaf,
+  0xec, 0xec, 0xee, 0xff, 0xfa, 0xfa, 0xff, 0xbe, 0xce, 0xec, 0xee, 0xee, 0xdf, 0xaf, 0xfa, 0xfe,
+  0xee, 0xce, 0xee, 0xfe, 0xaf, 0xaf, 0xff, 0xfe, 0xfe, 0xf5, 0xfe, 0xed, 0xeb, 0xeb, 0xf7, 0xff,
+  0xff, 0xff, 0xff, 0xef, 0xee, 0xff, 0xee, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x5f,
+  0xf5, 0xfe, 0xed, 0xef, 0xaf, 0xff, 0xee, 0xce, 0x11, 0x11, 0x11, 0xfe, 0xee, 0xce, 0xee, 0xef,
+  0xfe, 0xfe, 0xee, 0xee, 0xe5, 0xef, 0xfe, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x88,
+  0x4b, 0x18, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x88, 0x88, 0x84, 0xfe, 0xee, 0xee, 0xff, 0xaf,
+  0xfe, 0xfe, 0xee, 0xef, 0xff, 0xee, 0xff, 0xff, 0xfe, 0xfe, 0xec, 0xee, 0xee, 0xfe, 0xff, 0xff,
+  0xfe, 0xee, 0xce, 0xef, 0xff, 0xef, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xef, 0xff, 0xff, 0xfa, 0xff,
+  0xee, 0xce, 0xee, 0xee, 0xea, 0xff, 0xbf, 0xfa, 0xec, 0xee, 0xaf, 0xff, 0xff, 0xef, 0xef, 0xef,
+  0xef, 0xf5, 0xff, 0xea, 0xfb, 0xef, 0xfe, 0xef, 0xff, 0x5f, 0xff, 0x5f, 0xfe, 0x5f, 0xee, 0xee,
+  0xff, 0x5f, 0x5f, 0xf5, 0xff, 0x5f, 0xff, 0xff, 0xef, 0xff, 0xed, 0xef, 0xff, 0xbf, 0xee, 0xee,
+  0x11, 0x11, 0x1f, 0xfe, 0xee, 0xee, 0xef, 0xef, 0xeb, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef,
+  0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x18, 0x88, 0xdf, 0xff, 0xff, 0xff, 0xfd,
+  0x88, 0x83, 0x84, 0xfe, 0xee, 0xef, 0xef, 0xff, 0xaf, 0xee, 0xee, 0xff, 0xfe, 0xfe, 0xff, 0xaf,
+  0xaf, 0xee, 0xee, 0xee, 0xef, 0xef, 0xaf, 0xaf, 0xaf, 0xfe, 0xee, 0xff, 0xff, 0xfa, 0xff, 0xaf,
+  0xaf, 0xee, 0xee, 0xef, 0xff, 0xaf, 0xff, 0xaf, 0xee, 0xee, 0xee, 0xeb, 0xff, 0xbf, 0xea, 0xff,
+  0xfe, 0xee, 0xff, 0xff, 0xff, 0xaf, 0xef, 0xff, 0xef, 0xf5, 0xff, 0xdf, 0xef, 0xaf, 0xff, 0xee,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xee, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+  0xff, 0xef, 0xef, 0xbf, 0xaf, 0xfa, 0xff, 0xee, 0x11, 0x11, 0x1f, 0xfe, 0xee, 0xfe, 0xef, 0xee,
+  0xfe, 0xfa, 0xff, 0xee, 0xef, 0xff, 0xfe, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x14, 0x43, 0x8d, 0xff, 0xfd, 0x83, 0x8b, 0x88, 0xff, 0xee, 0xfe, 0xde, 0xaf,
+  0xff, 0xaf, 0xef, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xfe, 0xfe, 0xef, 0xee, 0xef, 0xff, 0xff,
+  0xff, 0xaf, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xef, 0xee, 0xfe, 0xff, 0xfa, 0xfa, 0xff,
+  0xbf, 0xef, 0xed, 0xee, 0xee, 0xfa, 0xff, 0xfa, 0xff, 0xaf, 0xea, 0xff, 0xff, 0xaf, 0xfe, 0xfe,
+  0xfe, 0xfe, 0xff, 0xea, 0xfe, 0xde, 0xbf, 0x7e, 0xef, 0x5f, 0xf5, 0xff, 0x5f, 0xf5, 0xff, 0xee,
+  0xef, 0xff, 0xef, 0x5f, 0x5f, 0xf5, 0xf5, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xee,
+  0x11, 0x11, 0xff, 0xde, 0xfe, 0xef, 0xee, 0xee, 0xee, 0xef, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xee,
+  0xee, 0xf9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x48,
+  0x18, 0x88, 0x4f, 0xfe, 0xde, 0xee, 0xee, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xce, 0xee,
+  0xea, 0xfe, 0xef, 0xee, 0xff, 0xee, 0xcf, 0xee, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xce, 0xef, 0xfe,
+  0xaf, 0xfa, 0xff, 0xaf, 0xea, 0xfe, 0xff, 0xef, 0xea, 0xfb, 0xee, 0xde, 0xee, 0xee, 0xee, 0xaf,
+  0xaf, 0xff, 0xaf, 0xff, 0xff, 0xcf, 0xef, 0xef, 0xef, 0xe5, 0xff, 0xfe, 0xee, 0xee, 0xef, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xef, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xef, 0xee, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0x11, 0x14, 0xfe, 0xed, 0xed, 0xed, 0xee, 0xee,
+  0xec, 0xee, 0xef, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xef, 0x99, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x88, 0x8d, 0xfe, 0xed, 0xee, 0xee, 0xee,
+  0xce, 0xee, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xce, 0xef, 0xff, 0xaf, 0xfe, 0xee, 0xcf, 0xec, 0xee,
+  0xcf, 0xaf, 0xef, 0xff, 0xfe, 0xee, 0xec, 0xee, 0xff, 0xaf, 0xff, 0xff, 0xee, 0xee, 0xce, 0xec,
+  0xff, 0xfe, 0xff, 0xaf, 0xee, 0xee, 0xee, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xaf, 0xee, 0xfe, 0xee,
+  0xf5, 0xff, 0xfe, 0xee, 0xec, 0xec, 0xee, 0xf5, 0xfe, 0xf5, 0xff, 0x5f, 0xf5, 0xff, 0xef, 0xeb,
+  0xef, 0xff, 0xff, 0x5f, 0xf5, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xfe, 0xef, 0xff, 0xff, 0xef, 0xff,
+  0x11, 0x0f, 0xfe, 0xfe, 0xde, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xee, 0xee,
+  0xee, 0x5f, 0xef, 0xf9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x11, 0x01, 0x11,
+  0x11, 0x01, 0x4f, 0xde, 0xbe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xff, 0xff, 0xfe, 0xec, 0xee, 0xee,
+  0xec, 0xef, 0xff, 0xaf, 0xee, 0xec, 0xee, 0xee, 0xee, 0xff, 0xaf, 0xff, 0xfe, 0xee, 0xee, 0xee,
+  0xcf, 0xff, 0xaf, 0xae, 0xee, 0xee, 0xee, 0xee, 0xee, 0xaf, 0xff, 0xfe, 0xce, 0xec, 0xee, 0xce,
+  0xef, 0xfa, 0xff, 0xee, 0xff, 0xcf, 0xef, 0xef, 0xff, 0xf5, 0xff, 0xee, 0xee, 0xee, 0xee, 0xfe,
+  0xee, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xef, 0xee, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f,
+  0x5f, 0xff, 0xee, 0xee, 0xef, 0xff, 0xef, 0xaf, 0x11, 0x9f, 0xff, 0xfe, 0xef, 0xaf, 0xec, 0xee,
+  0xce, 0xec, 0xef, 0xff, 0xff, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xff, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x14, 0x01, 0x41, 0x11, 0x11, 0x11, 0x8f, 0xde, 0xfe, 0xee, 0xee, 0xee,
+  0xec, 0xee, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xfa, 0xff, 0xee, 0xee, 0xee, 0xec,
+  0xee, 0xef, 0xff, 0xee, 0xee, 0xce, 0xec, 0xee, 0xec, 0xff, 0xff, 0xfe, 0xce, 0xec, 0xee, 0xee,
+  0xee, 0xff, 0xaf, 0xfe, 0xee, 0xce, 0xec, 0xee, 0xea, 0xff, 0xaf, 0xee, 0xcf, 0xcf, 0xef, 0xee,
+  0xfe, 0xff, 0xfe, 0xec, 0xee, 0xec, 0xee, 0xef, 0xee, 0xf5, 0xff, 0x5f, 0xff, 0x5f, 0xfe, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xf5, 0xff, 0x5f, 0xf5, 0xf5, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff,
+  0x14, 0xff, 0xfe, 0xfe, 0xeb, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xfe, 0xec, 0xee,
+  0xee, 0xee, 0x5f, 0xef, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x9f, 0xef, 0xec, 0xee, 0xce, 0xec, 0xee, 0xee, 0xff, 0xfe, 0xec, 0xee, 0xce, 0xec,
+  0xee, 0xee, 0xff, 0xfe, 0xce, 0xee, 0xec, 0xee, 0xec, 0xee, 0xaf, 0xaf, 0xce, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xaf, 0xee, 0xee, 0xee, 0xec, 0xec, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
+  0xef, 0xff, 0xfe, 0xee, 0xef, 0xce, 0xee, 0xf5, 0xff, 0x5f, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef,
+  0x5f, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xe5, 0xff, 0xea, 0xfe, 0xef, 0xff, 0xff, 0xf5, 0xe5, 0x5f,
+  0x5f, 0xff, 0xee, 0xce, 0xee, 0xef, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xee, 0xfe, 0xfe, 0xee, 0xce,
+  0xee, 0xee, 0xff, 0xff, 0xff, 0xec, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xef, 0xf9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x40, 0x11, 0xff, 0xda, 0xfe, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xfa, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xce, 0xfa, 0xfe, 0xee, 0xce, 0xee, 0xee,
+  0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xce, 0xec, 0xee, 0xef, 0xfa, 0xfc, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xef, 0xaf, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xaf, 0xaf, 0xec, 0xef, 0xcf, 0xef, 0xff,
+  0xff, 0xff, 0xef, 0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xef, 0x5f, 0xff, 0xff, 0xf5, 0xf5, 0xff,
+  0xff, 0xfe, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xec, 0xee, 0xef, 0xff,
+  0xff, 0xff, 0xee, 0xee, 0xea, 0xfe, 0xce, 0xee, 0xec, 0xff, 0xfe, 0xfe, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xee, 0xee, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10,
+  0x11, 0x14, 0xfe, 0xff, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xff, 0xee, 0xee, 0xec, 0xee,
+  0xce, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xec, 0xee, 0xec, 0xef, 0xef, 0xec, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xff, 0xec, 0xee, 0xce, 0xce,
+  0xcf, 0xff, 0xfc, 0xee, 0xef, 0xee, 0xee, 0x5f, 0x5f, 0xf5, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xf5, 0xff, 0xff, 0x5f, 0xf5, 0xff, 0xfe, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee,
+  0xee, 0xfe, 0xfe, 0xee, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x11, 0x19, 0xfe, 0xda, 0xfe, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xaf, 0xce, 0xee, 0xee, 0xfc,
+  0xee, 0xee, 0xea, 0xfe, 0xee, 0xce, 0xee, 0xee, 0xce, 0xee, 0xea, 0xfe, 0xec, 0xee, 0xce, 0xee,
+  0xce, 0xee, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xaf, 0xee, 0xee, 0xfe, 0xef, 0xff,
+  0xff, 0xff, 0xfe, 0xe5, 0xee, 0xce, 0xee, 0xee, 0xfe, 0xef, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0xff,
+  0xfe, 0xfc, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xef,
+  0xff, 0xee, 0xee, 0xee, 0xea, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xea, 0xfe, 0xee, 0xee,
+  0xec, 0xe5, 0xee, 0xee, 0xfe, 0xe9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x11, 0x4f, 0xed, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xef, 0xaf, 0xee, 0xee, 0xec, 0xee,
+  0xee, 0xee, 0xef, 0xfe, 0xfc, 0xee, 0xef, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xce, 0xee, 0xec, 0xee,
+  0xee, 0xef, 0xef, 0xfc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xaf, 0xff, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xef, 0xfe, 0xee, 0xee, 0xf7, 0xef, 0x5f, 0xf5, 0xff, 0x5f, 0xee, 0xee, 0xee, 0xec, 0xee,
+  0xff, 0x5f, 0xff, 0xf5, 0xf5, 0xff, 0x5f, 0xff, 0xfe, 0xaf, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xee,
+  0xee, 0xfe, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xbf, 0xec, 0xee,
+  0xee, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xce, 0xec, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xfe, 0xef, 0x99,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x4f, 0xfe, 0xeb, 0xee, 0xee, 0xef, 0xee,
+  0xee, 0xee, 0xef, 0xff, 0xee, 0xec, 0xee, 0xee, 0xce, 0xee, 0xee, 0xaf, 0xee, 0xee, 0xef, 0xfe,
+  0xee, 0xee, 0xfa, 0xff, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xfa, 0xfe, 0xee, 0xee, 0xec, 0xee,
+  0xee, 0xef, 0xfa, 0xff, 0xfe, 0xee, 0xee, 0xce, 0xee, 0xfe, 0xaf, 0xee, 0xce, 0xee, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xef, 0xfe, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0xef, 0xff, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xea, 0xfe, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x41, 0xff, 0xeb, 0xef, 0xee, 0xef, 0xff, 0xee, 0xee, 0xee, 0xee, 0xea, 0xfe, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xff, 0xfa, 0xfe, 0xee, 0xff, 0xfe, 0xee, 0xef, 0xef, 0xaf, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xff, 0xef, 0xec, 0xec, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xfc, 0xee, 0xce, 0xee,
+  0xee, 0xef, 0xff, 0xee, 0xee, 0xef, 0x5f, 0xe5, 0xf5, 0xf5, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xf5, 0xff, 0xff, 0x5f, 0xf5, 0xff, 0x5f, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xfe, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xea, 0xfe, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xff, 0xf9,
+  0xf9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xee,
+  0xee, 0xee, 0xee, 0xef, 0xee, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xec, 0xff, 0xef, 0xcf, 0xff, 0xfe,
+  0xef, 0xee, 0xcf, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xcf, 0xaf, 0xef, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xea, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xaf, 0xaf, 0xee, 0xef, 0xf5, 0xff,
+  0xff, 0xf5, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0x5f, 0x5f, 0xff, 0xff, 0xff, 0xff,
+  0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xf9, 0xf9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x1f, 0xfe, 0xee, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xce, 0xee, 0xff, 0xff, 0xff, 0xee, 0xce, 0xee, 0xce, 0xee, 0xfe, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xfe, 0xef, 0xee, 0xff, 0x5e, 0x5f, 0xf5, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xef, 0xf5, 0xff, 0xf5, 0xff, 0x55, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xde, 0xee, 0xee, 0xce, 0xee, 0xce, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee,
+  0xde, 0xf9, 0xf9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xee, 0xec, 0xee, 0xcf, 0xff, 0xff, 0xee,
+  0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xec, 0xff, 0xff, 0xff,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xcf, 0xee, 0xee, 0xee, 0xfe, 0xec, 0xee, 0xcf, 0xef, 0xee, 0xee,
+  0xee, 0xce, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xee,
+  0xf5, 0x5f, 0xfe, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xfe,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xce,
+  0xde, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xed, 0xee, 0xee, 0xef, 0xf9, 0x35, 0x00, 0x03, 0x9f,
+  0xf9, 0xee, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xef, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xce, 0xec, 0xee, 0xef, 0xcf, 0xee,
+  0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xce, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xce, 0xec, 0xee, 0xee, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xef, 0xee, 0xee,
+  0xee, 0xee, 0xfe, 0xff, 0xf5, 0x55, 0xff, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xeb, 0xee, 0xec, 0xee, 0xec, 0xee, 0xec, 0xee,
+  0xaf, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xee, 0xe5, 0xff, 0xf9, 0x99, 0xff, 0x9f, 0x9e, 0xee, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee,
+  0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xef, 0xff, 0xfe,
+  0xec, 0xee, 0xee, 0xee, 0xee, 0xcf, 0xfc, 0xee, 0xef, 0xff, 0xee, 0xee, 0xce, 0xee, 0xaf, 0xce,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xef, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xce, 0xef, 0xee, 0xee,
+  0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0xff, 0xef, 0xff, 0xff, 0xfe, 0xe5,
+  0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xff, 0xee, 0xee, 0xec, 0xee, 0xee, 0xce, 0xee,
+  0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5f, 0xf9, 0xf9, 0xff,
+  0xee, 0xee, 0xce, 0xee, 0xff, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xef, 0xce,
+  0xee, 0xfe, 0xec, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xea, 0xfc, 0xee,
+  0xee, 0xee, 0xec, 0xee, 0xee, 0xfa, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xff, 0xfe, 0xef, 0xee, 0xe5, 0xff, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xce, 0xec,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xce, 0xee, 0xee, 0xef,
+  0xff, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee,
+  0xee, 0xce, 0xee, 0xee, 0xfe, 0xee, 0x5f, 0xee, 0xee, 0xee, 0xee, 0xcf, 0xef, 0xfe, 0xee, 0xee,
+  0xee, 0xee, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0xce, 0xee, 0xff, 0xff, 0xfe,
+  0xee, 0xce, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee, 0xee, 0xcf, 0xce, 0xee,
+  0xec, 0xee, 0xee, 0xce, 0xec, 0xff, 0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee,
+  0xee, 0xff, 0xfe, 0xe5, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xe5, 0xee, 0xec, 0xee, 0xee, 0xee, 0xce, 0xee,
+  0xeb, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xec, 0xee, 0xce, 0xee,
+  0xee, 0xef, 0xfe, 0xee, 0xce, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xfe, 0xee,
+  0xee, 0xce, 0xe5, 0xff, 0xfe, 0xfe, 0xee, 0xee, 0xec, 0xef, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xce, 0xef, 0xff, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xce, 0xfc, 0xee,
+  0xef, 0xff, 0xee, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xfe, 0xce, 0xee,
+  0xee, 0x5e, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0x5e, 0xe5, 0xee, 0xce, 0xee, 0xee, 0xee, 0xec,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xef, 0xff,
+  0xfe, 0xee, 0xec, 0xec, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xe5, 0xef, 0xee, 0x5f, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xef, 0xff, 0xee, 0xee, 0xee,
+  0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xce, 0xee, 0xff, 0xff, 0xfe,
+  0xec, 0xee, 0xee, 0xce, 0xee, 0xee, 0xef, 0xce, 0xee, 0xff, 0xee, 0xee, 0xee, 0xee, 0xfc, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0x5f,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xec, 0xee,
+  0xde, 0xee, 0xee, 0xce, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee,
+  0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xce, 0xee, 0xee, 0xfe, 0xfe, 0xee, 0xec, 0xec, 0xee, 0xee,
+  0xee, 0xec, 0xee, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xfc,
+  0xef, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee,
+  0xce, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xeb, 0xee, 0xce, 0xee, 0xee, 0xef, 0xff, 0xee,
+  0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xec, 0xef, 0xff, 0xff, 0xee, 0xee, 0xce, 0xe5, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xfa,
+  0xfe, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xfe,
+  0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee,
+  0xce, 0xee, 0xff, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xec, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee,
+  0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xfe, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee, 0xff,
+  0xff, 0xfe, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee,
+  0xce, 0xec, 0xee, 0xce, 0xee, 0xef, 0xff, 0xfe, 0xce, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xff, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xe5, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee,
+  0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xff, 0xff, 0xfe, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xce, 0xec, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee,
+  0xef, 0xff, 0xee, 0xee, 0xee, 0xce, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xce, 0xff, 0xff, 0xee,
+  0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xce, 0xec, 0xee, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee,
+  0xce, 0xee, 0xff, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xec,
+  0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xec, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xfe,
+  0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xef, 0xff, 0xee, 0xee, 0xec,
+  0xee, 0xee, 0xce, 0xee, 0xce, 0xee, 0xec, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xec, 0xee, 0xec, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee, 0x5e, 0xee, 0xce, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xec,
+  0xee, 0xce, 0x5e, 0xee, 0xce, 0xee, 0xec, 0xee, 0xec, 0xee, 0xec, 0xee, 0xfe, 0xee, 0xee, 0xec,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xfe, 0xee, 0xce, 0xee, 0xee, 0xec, 0xee, 0xce,
+  0xee, 0xee, 0xce, 0xff, 0xff, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xfe, 0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xee,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xe5, 0xee,
+  0xee, 0xee, 0xee, 0xef, 0xff, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xef, 0xfe,
+  0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xee,
+  0xee, 0x5e, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xce,
+  0xee, 0xce, 0xee, 0xce, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xff, 0xff, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xec, 0xec, 0xee, 0xce, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xff, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee,
+  0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xce, 0xef, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xec,
+  0xee, 0xee, 0xef, 0xef, 0xee, 0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xef, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xfe, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xce, 0xee, 0xef,
+  0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xce, 0xec, 0xff, 0xff, 0xee,
+  0xee, 0xec, 0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xff, 0xee, 0xee, 0xe5, 0xee,
+  0xe5, 0xee, 0xec, 0xee, 0xce, 0xe5, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0xce, 0xce, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xce, 0xec, 0xee,
+  0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xee, 0xec, 0xee, 0xef, 0xff, 0xee, 0xee, 0xe5, 0xee, 0x5e,
+  0xee, 0xee, 0xce, 0xe5, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee,
+  0xee, 0xec, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xef, 0xec, 0xee, 0xce, 0xe5, 0xee, 0xce, 0xee, 0xce,
+  0xee, 0xee, 0xce, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xe5,
+  0xee, 0xee, 0xef, 0xff, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xce, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xce,
+  0xec, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xee,
+  0xec, 0xee, 0xee, 0xff, 0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xec, 0xec, 0xee, 0xce,
+  0xee, 0xef, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef,
+  0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xce, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xce, 0xee, 0xee, 0xec, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0x5e, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xce, 0xee,
+  0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0xec,
+  0xee, 0xff, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xec, 0xee, 0xec, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xec, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xef, 0xef, 0xee,
+  0xee, 0xee, 0xe5, 0xee, 0xee, 0x5e, 0xee, 0xef, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e,
+  0xee, 0xee, 0xe5, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0x5e, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee,
+  0xce, 0xce, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee,
+  0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec,
+  0xee, 0xec, 0xee, 0xee, 0xee, 0xce, 0xee, 0xce, 0xee, 0xec, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xe5,
+  0xee, 0xee, 0xfe, 0xff, 0xee, 0xee, 0x5e, 0xee, 0xe5, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xe5,
+  0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec,
+  0xee, 0xce, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0x5e,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xce, 0xee, 0xee, 0xee, 0xec, 0xee, 0xce,
+  0xee, 0xff, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee,
+  0xec, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe,
+  0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xec, 0xee, 0xce, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xce, 0xee, 0xee, 0x5e,
+  0xee, 0xee, 0xce, 0xee, 0xce, 0xec, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xec, 0xee, 0xce, 0xce, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xce, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xef, 0xef, 0xfe, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0x5e, 0xee, 0xee, 0x5e, 0xee,
+  0xec, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0x5e,
+  0xe5, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0x5e, 0xe5, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0x5e, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce,
+  0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xec, 0xee,
+  0xee, 0xef, 0xee, 0xee, 0xce, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xec, 0xee,
+  0xee, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xff, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xe5,
+  0xee, 0xe5, 0xee, 0xe5, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0x5e, 0xe5, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xe5, 0xee, 0xee, 0xe5, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xce, 0xee, 0xee, 0x5e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xfe, 0xee, 0xee, 0xec, 0xee, 0xec, 0xee, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xee, 0xce, 0xec,
+  0xee, 0xce, 0xee, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xce, 0xee, 0x5e, 0xee, 0xe5, 0xee, 0xee,
+  0xe5, 0xee, 0xee, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xe5, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef,
+  0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+};
+// Palette, 16 colors, RGB888
+// 48 Bytes
+const uint8_t i4_240x240_palette[] __attribute__((aligned(4))) = {
+  0x3c, 0x37, 0x4a, 0x40, 0x51, 0x73, 0x92, 0x47, 0x3b, 0x42, 0x4e, 0xf5, 0x6f, 0x69, 0x7b, 0xeb,
+  0x4b, 0x4a, 0x31, 0xb2, 0x3d, 0xc8, 0x88, 0x71, 0x8c, 0x9c, 0xb2, 0xca, 0xb8, 0xc5, 0x73, 0xf8,
+  0x66, 0x5b, 0xf3, 0xdf, 0xd8, 0xe0, 0x70, 0xb3, 0xe7, 0xf8, 0xec, 0xea, 0xb9, 0xf4, 0xf6, 0xeb,
+};
+
+constexpr rawdisp::AssetDesc i4_240x240_desc = {
+  .width = 240,
+  .height = 240,
+  .format = rawdisp::AssetFormat::I4_RGB888,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "index",
+      .data = i4_240x240,
+      .size = sizeof(i4_240x240),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 4,
+        .pixelsPerFrag = 2,
+        .bytesPerFrag = 1,
+      },
+      .stride = 120,
+    },
+  },
+  .palette = i4_240x240_palette,
+  .paletteColors = 16,
+};
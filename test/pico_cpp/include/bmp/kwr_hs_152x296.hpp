@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 // 152x296px, Indexed2
 // Plane "white", color index=1
 // MSB First, Horizontal Packing, Horizontal Adressing
@@ -718,3 +720,46 @@ const uint8_t kwr_hs_152x296_red[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x15, 0xc0, 0x02, 0x45, 0x42, 0x47, 0xbb, 0x79,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
+
+constexpr rawdisp::AssetDesc kwr_hs_152x296_desc = {
+  .width = 152,
+  .height = 296,
+  .format = rawdisp::AssetFormat::I2_RGB888,
+  .numPlanes = 2,
+  .planes = {
+    {
+      .id = "white",
+      .data = kwr_hs_152x296_white,
+      .size = sizeof(kwr_hs_152x296_white),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::INDEX_MATCH,
+        .matchIndex = 1,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 1,
+        .pixelsPerFrag = 8,
+        .bytesPerFrag = 1,
+      },
+      .stride = 19,
+    },
+    {
+      .id = "red",
+      .data = kwr_hs_152x296_red,
+      .size = sizeof(kwr_hs_152x296_red),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::INDEX_MATCH,
+        .matchIndex = 2,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 1,
+        .pixelsPerFrag = 8,
+        .bytesPerFrag = 1,
+      },
+      .stride = 19,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
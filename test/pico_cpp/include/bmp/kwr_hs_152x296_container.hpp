@@ -0,0 +1,562 @@
+#pragma once
+
+#include <stdint.h>
+
+// 152x296px, Indexed2
+// Asset container, 2 plane(s), 4 colors palette, RLE compressed
+// 8848 Bytes
+const uint8_t kwr_hs_152x296_container[] = {
+  0x52, 0x44, 0x41, 0x53, 0x01, 0x02, 0x0a, 0x00, 0x98, 0x00, 0x28, 0x01, 0x84, 0x22, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x90, 0x22, 0x00, 0x00, 0x77, 0x68, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x01, 0x01, 0x21, 0x01, 0x02, 0x01, 0x08, 0x01,
+  0x72, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x33, 0x12, 0x00, 0x00,
+  0x01, 0x02, 0x21, 0x01, 0x02, 0x01, 0x08, 0x01, 0x01, 0x00, 0xf8, 0x15, 0x00, 0x00, 0x50, 0xad,
+  0x6d, 0xff, 0xf6, 0xbf, 0xfb, 0xff, 0xf6, 0xb5, 0xad, 0xff, 0xf6, 0xb5, 0xaf, 0xff, 0xf6, 0xb5,
+  0xad, 0xff, 0xb5, 0xab, 0xff, 0xfd, 0x6f, 0xfd, 0xff, 0xfd, 0x6b, 0x5b, 0xff, 0xfd, 0x6b, 0x6f,
+  0xff, 0xfd, 0x6b, 0x5b, 0xff, 0xad, 0x77, 0xff, 0xeb, 0x5f, 0xfb, 0xff, 0xeb, 0xad, 0x6f, 0xff,
+  0xf7, 0x5a, 0xbf, 0xff, 0xfb, 0xad, 0x6e, 0xff, 0xda, 0xdf, 0xbb, 0x7e, 0xef, 0xff, 0xbb, 0x7f,
+  0x5a, 0xdb, 0xdd, 0xbe, 0xd6, 0xdf, 0xff, 0xbe, 0xb5, 0xb7, 0xf7, 0xb7, 0x7f, 0xff, 0xff, 0xbf,
+  0x80, 0xff, 0x0d, 0xed, 0xbf, 0xff, 0xff, 0xb5, 0xbf, 0xff, 0xff, 0xda, 0xef, 0xff, 0xfd, 0xdf,
+  0xef, 0x80, 0xff, 0x04, 0xef, 0xff, 0x77, 0xff, 0xf7, 0x80, 0xff, 0x07, 0xfa, 0xff, 0xef, 0xff,
+  0xfb, 0xff, 0xfe, 0xda, 0x80, 0xff, 0x7f, 0xb5, 0x7f, 0xff, 0xfe, 0xba, 0xbf, 0xff, 0xff, 0xef,
+  0x7f, 0xff, 0xff, 0x56, 0xff, 0xff, 0x6a, 0xaf, 0xff, 0xfd, 0x6d, 0xaf, 0xff, 0xff, 0xeb, 0x77,
+  0xff, 0xff, 0xea, 0xd7, 0xff, 0xfe, 0xed, 0xef, 0xfa, 0xb6, 0xb7, 0x7f, 0xfe, 0xb5, 0x77, 0xfe,
+  0xf5, 0x2d, 0xaf, 0xbb, 0xff, 0xb5, 0x5f, 0xfe, 0xfd, 0xaa, 0xff, 0xfb, 0x6d, 0x6f, 0xff, 0xf5,
+  0xd5, 0xab, 0xff, 0xfe, 0xd5, 0x5d, 0xff, 0xff, 0xeb, 0x6b, 0x7f, 0xfb, 0x5b, 0xff, 0xed, 0xab,
+  0x55, 0xff, 0xfa, 0xad, 0x5e, 0xff, 0xea, 0xb6, 0xd7, 0xff, 0xff, 0x5a, 0xb7, 0xff, 0xed, 0x6d,
+  0xfe, 0xf5, 0x5a, 0xdb, 0xff, 0xf7, 0x5b, 0xf3, 0xef, 0xfb, 0x6a, 0xb5, 0xff, 0xff, 0xd6, 0xd5,
+  0xef, 0xf5, 0xaa, 0xff, 0xdb, 0x6d, 0x6d, 0xff, 0xea, 0xd7, 0xed, 0xff, 0xd5, 0xad, 0x56, 0xff,
+  0xfe, 0x55, 0x5a, 0xff, 0xfa, 0xb7, 0xff, 0x7f, 0xf5, 0x55, 0xaa, 0xff, 0xda, 0xb7, 0xfa, 0xff,
+  0xed, 0x5a, 0xed, 0xff, 0xff, 0x6d, 0xb5, 0xff, 0xeb, 0x6a, 0xff, 0xad, 0xaa, 0xb7, 0xff, 0xed,
+  0xaf, 0xfd, 0xff, 0xd6, 0xd6, 0xaa, 0xff, 0xfd, 0xb6, 0xd6, 0xff, 0xad, 0xad, 0x7f, 0xeb, 0x6e,
+  0xd5, 0x7f, 0xea, 0xb7, 0x7b, 0x7f, 0xfa, 0xad, 0x55, 0xbf, 0xfe, 0xaa, 0xad, 0x7f, 0xf5, 0x55,
+  0xff, 0xb5, 0x55, 0x6a, 0xff, 0xb6, 0xd7, 0x3d, 0xfd, 0xab, 0x6b, 0xba, 0xff, 0xf5, 0x6d, 0x6b,
+  0xff, 0xda, 0xed, 0x7f, 0xeb, 0x6d, 0xad, 0xff, 0xed, 0xaf, 0x3f, 0x7f, 0xd6, 0xd5, 0x56, 0xff,
+  0xfa, 0xda, 0xda, 0xbf, 0xeb, 0x55, 0xff, 0xb5, 0xb5, 0x56, 0xff, 0xaa, 0xb7, 0x9e, 0xff, 0xea,
+  0xba, 0xd5, 0xbf, 0xf6, 0xab, 0x56, 0xff, 0xb5, 0x6d, 0xff, 0xee, 0xab, 0x6d, 0x7f, 0xdb, 0x6b,
+  0x8f, 0xff, 0xdb, 0x55, 0xb6, 0xff, 0xea, 0xd6, 0x7f, 0xad, 0x7f, 0xd6, 0xd5, 0xff, 0xaa, 0xda,
+  0xd5, 0xff, 0xea, 0xb7, 0x8f, 0xff, 0xed, 0xae, 0xab, 0xff, 0xf6, 0xb5, 0xd5, 0xff, 0xf5, 0x5a,
+  0xff, 0xda, 0xb5, 0xb6, 0xff, 0xf6, 0xd7, 0x83, 0xff, 0xea, 0xb5, 0x6d, 0x7f, 0xed, 0x6b, 0x36,
+  0xff, 0xdb, 0x6b, 0xff, 0xf6, 0xad, 0x5b, 0xff, 0xda, 0xab, 0xc3, 0xff, 0xf5, 0xab, 0x57, 0xff,
+  0xf6, 0xb5, 0xdb, 0xff, 0xf5, 0xb5, 0xff, 0xf5, 0x6a, 0xd5, 0xff, 0xf6, 0xdd, 0xc0, 0xff, 0xf6,
+  0xb6, 0xda, 0xff, 0xda, 0xd6, 0xaa, 0xff, 0xf6, 0xad, 0xff, 0xfb, 0xb6, 0xb7, 0xff, 0xf5, 0x6b,
+  0xe0, 0x7f, 0xfb, 0x5a, 0xaf, 0xff, 0xf6, 0xb5, 0x6f, 0xff, 0xfa, 0xd6, 0xff, 0xf6, 0xad, 0xaf,
+  0xff, 0xfb, 0x55, 0xe0, 0x3f, 0xfd, 0x6a, 0xdb, 0xff, 0xfd, 0xad, 0xab, 0xff, 0xfd, 0xb5, 0xff,
+  0xfd, 0x55, 0x6f, 0xff, 0xfe, 0xda, 0xe0, 0x1f, 0xfe, 0x1e, 0xad, 0x6f, 0xff, 0xfe, 0xd6, 0xbf,
+  0xff, 0xfe, 0xad, 0xff, 0xff, 0xed, 0xbf, 0xff, 0xff, 0xab, 0xf0, 0x07, 0xff, 0xda, 0xdf, 0xff,
+  0xff, 0xb5, 0x6f, 0xff, 0xff, 0xb5, 0xff, 0xff, 0x5b, 0x80, 0xff, 0x08, 0x7a, 0xf0, 0x01, 0xff,
+  0x6f, 0x7f, 0xff, 0xff, 0x6e, 0x80, 0xff, 0x00, 0xdb, 0x83, 0xff, 0x04, 0xef, 0xf8, 0x80, 0x7f,
+  0xfb, 0x80, 0xff, 0x00, 0xfb, 0x88, 0xff, 0x02, 0xfc, 0x00, 0x1f, 0x8d, 0xff, 0x02, 0xfc, 0x10,
+  0x03, 0x86, 0xff, 0x00, 0xf7, 0x80, 0xff, 0x05, 0xed, 0xff, 0xff, 0xfe, 0x02, 0x00, 0x83, 0xff,
+  0x0d, 0xf7, 0xff, 0xff, 0xda, 0xbf, 0xff, 0xff, 0xdb, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x1f, 0x82,
+  0xff, 0x1f, 0xda, 0xbf, 0xff, 0xad, 0xef, 0xff, 0xfe, 0xb5, 0xbf, 0xff, 0xff, 0x88, 0x40, 0x01,
+  0x10, 0x00, 0x00, 0x7f, 0xff, 0x55, 0x6f, 0xff, 0xb5, 0x5f, 0xff, 0xff, 0x56, 0xaf, 0xff, 0xff,
+  0xc0, 0x04, 0x81, 0x00, 0x7f, 0x01, 0xff, 0xf6, 0xdf, 0xff, 0xdb, 0x6f, 0xff, 0xfa, 0xda, 0xd7,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x04, 0x11, 0x04, 0x00, 0x1f, 0xed, 0x57, 0xff, 0x55, 0x5b, 0xff,
+  0xfe, 0xb5, 0xaf, 0xff, 0xfd, 0xfa, 0x40, 0x05, 0x51, 0x44, 0x51, 0x48, 0x01, 0xfa, 0xdb, 0xff,
+  0xb6, 0xd7, 0xff, 0xf3, 0x56, 0xb5, 0xff, 0xfb, 0xff, 0xc0, 0x50, 0x04, 0x10, 0x04, 0x02, 0x00,
+  0xff, 0x6d, 0xff, 0x6b, 0x5b, 0xff, 0xee, 0xda, 0xd7, 0xff, 0xf5, 0x7f, 0xe0, 0x85, 0x50, 0x41,
+  0x51, 0x28, 0xa8, 0x3f, 0xab, 0xff, 0xba, 0xed, 0xff, 0xf5, 0x6b, 0x6b, 0xff, 0xff, 0xfe, 0x0a,
+  0x20, 0x05, 0x14, 0x04, 0x02, 0x02, 0x1f, 0xd6, 0xff, 0xd5, 0xab, 0xff, 0xfd, 0x56, 0xad, 0xff,
+  0xff, 0xf8, 0x00, 0x95, 0x50, 0x40, 0x90, 0xa8, 0x48, 0x07, 0xed, 0xff, 0x6e, 0xb7, 0xff, 0xeb,
+  0x6a, 0xd7, 0xff, 0xff, 0xe1, 0x7d, 0x55, 0x00, 0x0a, 0x14, 0x22, 0x02, 0x12, 0x83, 0xfb, 0xff,
+  0xda, 0xda, 0xff, 0xfa, 0xdd, 0xb5, 0xff, 0xff, 0x02, 0x48, 0x10, 0x20, 0x40, 0x88, 0x48, 0x40,
+  0x20, 0xfe, 0xff, 0x56, 0xaf, 0xff, 0xed, 0x55, 0x5b, 0xff, 0xf0, 0x14, 0x90, 0x01, 0x15, 0x14,
+  0x22, 0x12, 0x14, 0x88, 0x7d, 0xff, 0xbb, 0x75, 0xff, 0xfb, 0x6d, 0xb7, 0xff, 0xc0, 0xa9, 0x00,
+  0x04, 0x20, 0x42, 0x88, 0x40, 0x40, 0x20, 0x1f, 0xff, 0xd5, 0xaf, 0xff, 0xf5, 0xb6, 0xff, 0xf8,
+  0x3e, 0x44, 0x00, 0x91, 0x4a, 0x20, 0x22, 0x15, 0x15, 0x0a, 0x1f, 0xff, 0x5b, 0x5b, 0xff, 0xfe,
+  0xab, 0xff, 0xc7, 0xff, 0x90, 0x00, 0x45, 0x11, 0x4a, 0x81, 0x40, 0x40, 0x20, 0x87, 0xff, 0xed,
+  0xd7, 0xff, 0xf5, 0xff, 0xfc, 0x3f, 0xff, 0xc0, 0x04, 0x28, 0x88, 0x10, 0x54, 0x14, 0x12, 0x48,
+  0x23, 0xff, 0x56, 0xbf, 0x80, 0xff, 0x6e, 0xc1, 0xff, 0xfe, 0x00, 0x01, 0x42, 0x52, 0xa2, 0x80,
+  0xa1, 0x41, 0x02, 0x81, 0xff, 0xf5, 0xbf, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xf0, 0x0a, 0x2a, 0xa9,
+  0x24, 0x48, 0x54, 0x08, 0x28, 0x48, 0x20, 0xff, 0xaf, 0x7f, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xc0,
+  0x25, 0xd1, 0x14, 0x92, 0x92, 0x82, 0xa2, 0x82, 0x20, 0x84, 0x7f, 0xfb, 0xff, 0xff, 0xe0, 0x2f,
+  0xff, 0xfe, 0x00, 0x17, 0xfc, 0xa5, 0x24, 0x48, 0x50, 0x10, 0x00, 0x8a, 0x20, 0x3f, 0xff, 0xff,
+  0xfe, 0x00, 0x00, 0xb7, 0xf8, 0x00, 0x55, 0xff, 0x52, 0x52, 0x92, 0x85, 0x4a, 0xa0, 0x00, 0x85,
+  0x1f, 0xff, 0xff, 0xc0, 0x00, 0x02, 0x15, 0x80, 0x00, 0x2d, 0xff, 0xe9, 0x29, 0x24, 0x52, 0x20,
+  0x00, 0xa8, 0x20, 0x0f, 0xff, 0xff, 0x82, 0x00, 0x0d, 0x01, 0x53, 0xff, 0xfa, 0xa2, 0x49, 0x24,
+  0x45, 0x50, 0x02, 0x85, 0x47, 0xff, 0xf8, 0x82, 0x00, 0x0f, 0x02, 0x0f, 0xff, 0xfc, 0x15, 0x25,
+  0x49, 0x28, 0x80, 0x50, 0x28, 0x07, 0xff, 0xe0, 0x07, 0xfe, 0x81, 0x00, 0x0e, 0x5f, 0xff, 0xfc,
+  0x54, 0xa9, 0x12, 0x42, 0x28, 0x05, 0x40, 0x51, 0xff, 0xc0, 0x3f, 0xf8, 0x81, 0x00, 0x0e, 0x3f,
+  0xdf, 0xe1, 0xea, 0x4a, 0xa4, 0x94, 0x80, 0x20, 0x15, 0x01, 0xff, 0x00, 0x7f, 0xf0, 0x81, 0x00,
+  0x0e, 0xaf, 0x7f, 0xeb, 0xf9, 0x54, 0x49, 0x52, 0x54, 0x0a, 0x40, 0x08, 0xfe, 0x00, 0xff, 0xc0,
+  0x81, 0x00, 0x0e, 0x12, 0xbf, 0x13, 0xe6, 0x92, 0xa2, 0x09, 0x08, 0x40, 0x92, 0xa0, 0xfc, 0x01,
+  0xff, 0x80, 0x80, 0x00, 0x0e, 0x02, 0x44, 0x5e, 0xa3, 0xef, 0xaa, 0x29, 0x52, 0x52, 0x2a, 0x08,
+  0x02, 0xf8, 0x03, 0xff, 0x82, 0x00, 0x0d, 0x91, 0x40, 0x87, 0xdf, 0xe8, 0x90, 0xa4, 0x84, 0x00,
+  0x82, 0x48, 0xf0, 0x03, 0xfc, 0x82, 0x00, 0x0d, 0x02, 0x2a, 0x0f, 0x9f, 0xf4, 0x54, 0x49, 0x28,
+  0x0a, 0x28, 0x00, 0xe0, 0x07, 0xf8, 0x81, 0x00, 0x0e, 0x09, 0x24, 0x88, 0x07, 0x3f, 0xfc, 0xa4,
+  0xaa, 0x45, 0x21, 0x02, 0xa4, 0xc0, 0x07, 0xf8, 0x83, 0x00, 0x0c, 0x20, 0x08, 0x1f, 0xf8, 0xa8,
+  0x24, 0xa8, 0x04, 0x48, 0x10, 0xc0, 0x0f, 0xe0, 0x82, 0x00, 0x0d, 0x09, 0x00, 0xc4, 0x2f, 0xf8,
+  0xf4, 0x92, 0x4a, 0x29, 0x12, 0x05, 0x80, 0x0f, 0xc0, 0x81, 0x00, 0x0e, 0x02, 0x00, 0x01, 0x84,
+  0x10, 0xf8, 0xfa, 0x2a, 0x91, 0x00, 0x40, 0xa0, 0x80, 0x0f, 0xc0, 0x82, 0x00, 0x0d, 0x24, 0x07,
+  0x90, 0x4a, 0x20, 0xfe, 0x52, 0x4a, 0x2a, 0x12, 0x08, 0x80, 0x0f, 0x80, 0x83, 0x00, 0x0b, 0x03,
+  0x88, 0x11, 0x50, 0x7e, 0x24, 0x94, 0x01, 0x48, 0x42, 0x00, 0x0f, 0x85, 0x00, 0x0a, 0x80, 0x4a,
+  0x40, 0x7e, 0x75, 0x42, 0x28, 0x02, 0x10, 0x00, 0x0e, 0x84, 0x00, 0x0b, 0x90, 0x10, 0x24, 0x92,
+  0x0a, 0x3a, 0x99, 0x12, 0xa8, 0x40, 0x80, 0x0c, 0x84, 0x00, 0x0d, 0x3c, 0x00, 0x09, 0x21, 0x12,
+  0x3f, 0x44, 0x04, 0x02, 0x14, 0x00, 0x0c, 0x00, 0x04, 0x82, 0x00, 0x09, 0xfe, 0x00, 0x20, 0x83,
+  0x08, 0x1f, 0xe9, 0x10, 0xa8, 0x80, 0x80, 0x00, 0x00, 0x38, 0x81, 0x00, 0x0e, 0x09, 0xff, 0x10,
+  0x8a, 0x03, 0x80, 0x03, 0xf4, 0x0a, 0x00, 0x22, 0xc0, 0x00, 0x00, 0x70, 0x81, 0x00, 0x23, 0x01,
+  0xff, 0x00, 0x20, 0x47, 0x80, 0x00, 0x39, 0x10, 0x25, 0x08, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x40,
+  0x00, 0x00, 0x03, 0xff, 0x00, 0x09, 0x0f, 0xc0, 0x01, 0x5e, 0x25, 0x00, 0x00, 0xa0, 0x00, 0x07,
+  0xc0, 0x01, 0x80, 0x80, 0x00, 0x21, 0x7f, 0x00, 0x00, 0x0f, 0xe2, 0x00, 0x01, 0x10, 0x28, 0x24,
+  0x40, 0x00, 0x1f, 0x80, 0x03, 0x80, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x49, 0x1b, 0xe1, 0x04, 0x54,
+  0x75, 0x02, 0x00, 0x80, 0x00, 0x3f, 0x80, 0x0e, 0x80, 0x00, 0x0f, 0x01, 0x0f, 0x00, 0x00, 0x19,
+  0xf4, 0x01, 0x02, 0x1e, 0x90, 0x08, 0x00, 0x00, 0x7f, 0x00, 0x1e, 0x81, 0x00, 0x0e, 0x47, 0x8c,
+  0x00, 0x1c, 0x71, 0x00, 0x51, 0x05, 0x04, 0x01, 0x00, 0x00, 0xe7, 0x00, 0x38, 0x80, 0x00, 0x0f,
+  0x04, 0x03, 0x8c, 0x02, 0x3c, 0x38, 0x82, 0x84, 0x12, 0xd0, 0x20, 0x04, 0x01, 0xce, 0x00, 0x78,
+  0x80, 0x00, 0x0f, 0x02, 0x81, 0x8c, 0x20, 0x38, 0x0c, 0x00, 0x21, 0x00, 0x48, 0x04, 0x0e, 0x01,
+  0xce, 0x00, 0xf0, 0x80, 0x00, 0x0f, 0x2d, 0x21, 0x8e, 0x00, 0x3e, 0x00, 0x00, 0x84, 0x12, 0x20,
+  0x00, 0x1f, 0x01, 0xec, 0x00, 0xe0, 0x80, 0x00, 0x0f, 0x12, 0xa0, 0xce, 0x00, 0x7c, 0x20, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x1f, 0x80, 0xfc, 0x01, 0xe0, 0x80, 0x00, 0x0f, 0x55, 0x08, 0xcf, 0x00,
+  0x78, 0x00, 0x00, 0x09, 0x08, 0x80, 0x10, 0x3f, 0x00, 0x7c, 0x03, 0xc0, 0x80, 0x00, 0x0f, 0xb4,
+  0x00, 0x7f, 0x00, 0x70, 0x04, 0x00, 0x40, 0x20, 0x10, 0x00, 0x73, 0x80, 0x3c, 0x07, 0xc0, 0x80,
+  0x00, 0x47, 0x7e, 0x00, 0x6f, 0x80, 0x70, 0x40, 0x90, 0x00, 0x02, 0x00, 0x00, 0xf3, 0x00, 0x18,
+  0x0f, 0x80, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x7f, 0xc0, 0xe2, 0xa8, 0x00, 0x08, 0x00, 0x00, 0x02,
+  0xf7, 0x02, 0x08, 0x0f, 0x80, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x7f, 0xc0, 0xe5, 0x55, 0x20, 0x02,
+  0x00, 0x20, 0x00, 0xff, 0x03, 0x88, 0x1f, 0x80, 0x00, 0x00, 0x01, 0xf9, 0x80, 0x7f, 0xe0, 0xca,
+  0xaa, 0x88, 0x00, 0x10, 0x00, 0x00, 0xff, 0x01, 0xe4, 0x1f, 0x80, 0x00, 0x0f, 0x01, 0xf1, 0x80,
+  0xff, 0xf0, 0xff, 0x51, 0x40, 0x00, 0x01, 0x00, 0x00, 0xff, 0x01, 0xf8, 0x1b, 0x80, 0x00, 0x07,
+  0x01, 0xf0, 0x00, 0xff, 0xf8, 0xeb, 0xc0, 0x50, 0x81, 0x00, 0x03, 0x1f, 0x01, 0xf8, 0x3f, 0x80,
+  0x00, 0x07, 0x01, 0xf0, 0x00, 0xff, 0xf8, 0xff, 0x40, 0x28, 0x81, 0x00, 0x03, 0xe7, 0x00, 0xfc,
+  0x33, 0x80, 0x00, 0x07, 0x03, 0xf0, 0x00, 0x7f, 0xfd, 0xff, 0x60, 0x10, 0x81, 0x00, 0x03, 0xfc,
+  0x00, 0xfc, 0x3b, 0x80, 0x00, 0x07, 0x03, 0xf0, 0x00, 0xff, 0xfc, 0xfe, 0x20, 0x0d, 0x81, 0x00,
+  0x03, 0xff, 0x80, 0x7c, 0x37, 0x80, 0x00, 0x07, 0x07, 0xf0, 0x00, 0x7f, 0xff, 0xfe, 0x60, 0x18,
+  0x81, 0x00, 0x03, 0xff, 0xe0, 0x3c, 0x3f, 0x81, 0x00, 0x06, 0xf8, 0x00, 0xff, 0xff, 0xfc, 0x20,
+  0x0e, 0x81, 0x00, 0x04, 0xff, 0xfc, 0x1c, 0x3f, 0x80, 0x80, 0x00, 0x07, 0xf8, 0x00, 0xff, 0xff,
+  0xf8, 0x00, 0x1c, 0x80, 0x80, 0x00, 0x0e, 0xff, 0xff, 0x0e, 0x3f, 0x80, 0x00, 0x00, 0x01, 0xf8,
+  0x04, 0xff, 0xff, 0xf8, 0x00, 0x0e, 0x81, 0x00, 0x0e, 0xff, 0xff, 0xc6, 0x3f, 0x80, 0x00, 0x00,
+  0x03, 0x7c, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x1e, 0x81, 0x00, 0x0e, 0xff, 0xff, 0xf8, 0x3f, 0x80,
+  0x00, 0x00, 0x06, 0x7c, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x1e, 0x81, 0x00, 0x0e, 0xff, 0xff, 0xfe,
+  0x1f, 0xc0, 0x00, 0x00, 0x03, 0xfe, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x1e, 0x81, 0x00, 0x80, 0xff,
+  0x0b, 0x8f, 0xc0, 0x00, 0x00, 0x03, 0xff, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x1e, 0x81, 0x00, 0x80,
+  0xff, 0x0b, 0xd3, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xcf, 0xff, 0xff, 0xf0, 0x00, 0x3e, 0x81, 0x00,
+  0x80, 0xff, 0x04, 0xfc, 0xc0, 0x00, 0x00, 0x03, 0x81, 0xff, 0x02, 0xf8, 0x00, 0x3e, 0x81, 0x00,
+  0x80, 0xff, 0x00, 0xf4, 0x80, 0x00, 0x01, 0x06, 0xbf, 0x80, 0xff, 0x02, 0xf8, 0x00, 0x7c, 0x81,
+  0x00, 0x80, 0xff, 0x00, 0xd8, 0x80, 0x00, 0x01, 0x02, 0xef, 0x80, 0xff, 0x02, 0xf8, 0x00, 0xfc,
+  0x81, 0x00, 0x80, 0xff, 0x00, 0xc0, 0x80, 0x00, 0x07, 0x03, 0xbf, 0xff, 0xf7, 0xff, 0xf8, 0x00,
+  0xfc, 0x81, 0x00, 0x02, 0xff, 0xff, 0xfe, 0x81, 0x00, 0x01, 0x03, 0xef, 0x80, 0xff, 0x02, 0xfc,
+  0x0f, 0xfc, 0x81, 0x00, 0x02, 0xff, 0xff, 0xf8, 0x81, 0x00, 0x01, 0x07, 0xbf, 0x80, 0xff, 0x02,
+  0xfe, 0x0f, 0xf8, 0x81, 0x00, 0x02, 0xff, 0xff, 0xf0, 0x81, 0x00, 0x00, 0x03, 0x82, 0xff, 0x01,
+  0x5f, 0xf0, 0x81, 0x00, 0x02, 0xff, 0xff, 0xc0, 0x81, 0x00, 0x00, 0x07, 0x83, 0xff, 0x00, 0xe0,
+  0x81, 0x00, 0x01, 0xff, 0xff, 0x82, 0x00, 0x00, 0x03, 0x83, 0xff, 0x82, 0x00, 0x01, 0xff, 0xfc,
+  0x82, 0x00, 0x00, 0x03, 0x82, 0xff, 0x00, 0xfc, 0x82, 0x00, 0x01, 0xff, 0xf8, 0x82, 0x00, 0x06,
+  0x03, 0xff, 0xfe, 0x0b, 0xff, 0xfe, 0xa8, 0x82, 0x00, 0x01, 0xff, 0xe0, 0x82, 0x00, 0x06, 0x01,
+  0xff, 0xf0, 0x1f, 0x07, 0xfd, 0xd0, 0x82, 0x00, 0x01, 0xff, 0xc0, 0x82, 0x00, 0x06, 0x01, 0xff,
+  0xf0, 0x00, 0x80, 0xff, 0x40, 0x82, 0x00, 0x00, 0xff, 0x84, 0x00, 0x05, 0xff, 0xf8, 0x00, 0x00,
+  0x7f, 0x80, 0x82, 0x00, 0x00, 0xfe, 0x84, 0x00, 0x04, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0x83, 0x00,
+  0x00, 0xfc, 0x84, 0x00, 0x04, 0x7f, 0xf8, 0xaa, 0x40, 0x7e, 0x83, 0x00, 0x00, 0xf8, 0x84, 0x00,
+  0x04, 0x3f, 0xfc, 0x01, 0x10, 0x7c, 0x83, 0x00, 0x00, 0xe0, 0x84, 0x00, 0x04, 0x3f, 0xfc, 0x90,
+  0x84, 0xf8, 0x83, 0x00, 0x00, 0xc0, 0x84, 0x00, 0x04, 0x1f, 0xfc, 0x4a, 0x50, 0xf0, 0x8b, 0x00,
+  0x04, 0x0f, 0xfe, 0x11, 0x11, 0xe0, 0x8b, 0x00, 0x04, 0x0f, 0xfe, 0x24, 0xa1, 0xc0, 0x8b, 0x00,
+  0x04, 0x07, 0xff, 0x4a, 0x27, 0x80, 0x8b, 0x00, 0x03, 0x03, 0xff, 0x91, 0x4f, 0x8c, 0x00, 0x03,
+  0x01, 0xff, 0xc4, 0x9e, 0x8d, 0x00, 0x02, 0xff, 0xfb, 0x7e, 0x8d, 0x00, 0x02, 0x7f, 0xff, 0xfc,
+  0x8d, 0x00, 0x02, 0x1f, 0xff, 0xf8, 0x8d, 0x00, 0x02, 0x0f, 0xff, 0xf0, 0x8d, 0x00, 0x02, 0x05,
+  0xf5, 0x20, 0xb4, 0x00, 0x00, 0x01, 0x8f, 0x00, 0x00, 0xe8, 0x8e, 0x00, 0x01, 0x03, 0xe0, 0x8e,
+  0x00, 0x01, 0xaf, 0xf2, 0x8d, 0x00, 0x02, 0x02, 0x5f, 0xe0, 0x8d, 0x00, 0x04, 0x05, 0x7f, 0xe0,
+  0x00, 0x20, 0x8b, 0x00, 0x02, 0x3a, 0xff, 0xe0, 0x8d, 0x00, 0x02, 0xa9, 0xff, 0xa2, 0x8c, 0x00,
+  0x05, 0x02, 0xc7, 0xfc, 0x3c, 0x00, 0x60, 0x8a, 0x00, 0x05, 0x05, 0xbf, 0xe1, 0x66, 0x00, 0xd0,
+  0x8a, 0x00, 0x04, 0x1b, 0xdf, 0x81, 0x4e, 0x01, 0x8b, 0x00, 0x03, 0x57, 0xfc, 0x02, 0xb6, 0x8c,
+  0x00, 0x03, 0xaf, 0x70, 0x0d, 0xae, 0x8b, 0x00, 0x04, 0x01, 0x7f, 0x80, 0x13, 0x46, 0x8b, 0x00,
+  0x04, 0x06, 0xff, 0x00, 0x0d, 0x07, 0x8b, 0x00, 0x06, 0x05, 0xff, 0x00, 0x08, 0x07, 0x00, 0x20,
+  0x89, 0x00, 0x04, 0x1b, 0xfc, 0x00, 0x00, 0x0f, 0x8b, 0x00, 0x04, 0x57, 0xf0, 0x00, 0x00, 0x06,
+  0x8b, 0x00, 0x04, 0x57, 0xe0, 0x00, 0x00, 0x0c, 0x8a, 0x00, 0x02, 0x01, 0x5f, 0xc0, 0x8d, 0x00,
+  0x02, 0x01, 0x7f, 0x80, 0x8d, 0x00, 0x05, 0x05, 0xbf, 0x80, 0x00, 0x00, 0x40, 0x8a, 0x00, 0x05,
+  0x0a, 0xfc, 0x00, 0x00, 0x01, 0x80, 0x8a, 0x00, 0x04, 0x04, 0x40, 0x00, 0x00, 0x03, 0x8f, 0x00,
+  0x00, 0x0e, 0x8f, 0x00, 0x00, 0x3c, 0x8f, 0x00, 0x00, 0x78, 0x8e, 0x00, 0x01, 0x03, 0xe0, 0x8e,
+  0x00, 0x01, 0x0f, 0xe0, 0x8e, 0x00, 0x01, 0xff, 0x80, 0x8d, 0x00, 0x01, 0x01, 0xff, 0x8e, 0x00,
+  0x01, 0x07, 0xfe, 0x8b, 0x00, 0x04, 0x1b, 0xf0, 0x01, 0xff, 0xfc, 0x8b, 0x00, 0x04, 0x2b, 0xff,
+  0xbf, 0xff, 0xf8, 0x8b, 0x00, 0x04, 0xd7, 0xff, 0x7f, 0x7f, 0xf0, 0x8a, 0x00, 0x01, 0x01, 0x2f,
+  0x80, 0xff, 0x00, 0xe0, 0x8a, 0x00, 0x05, 0x02, 0xdf, 0xfd, 0xfd, 0xff, 0xc0, 0x8a, 0x00, 0x05,
+  0x01, 0x3f, 0xfb, 0xff, 0xff, 0x80, 0x8a, 0x00, 0x04, 0x06, 0xff, 0xf7, 0xf7, 0xff, 0x8b, 0x00,
+  0x00, 0x0a, 0x80, 0xff, 0x00, 0xfe, 0x8b, 0x00, 0x04, 0x05, 0xff, 0xdf, 0xff, 0xfc, 0x8b, 0x00,
+  0x00, 0x0b, 0x80, 0xff, 0x00, 0xf8, 0x8b, 0x00, 0x04, 0x17, 0xff, 0x7f, 0xff, 0xf0, 0x8b, 0x00,
+  0x00, 0x2f, 0x80, 0xff, 0x00, 0xe0, 0x84, 0x00, 0x00, 0x95, 0x83, 0x00, 0x04, 0x1f, 0xfe, 0xff,
+  0xff, 0xc0, 0x83, 0x00, 0x02, 0x0b, 0x76, 0xd0, 0x82, 0x00, 0x04, 0x3f, 0xfd, 0xff, 0xff, 0xc0,
+  0x83, 0x00, 0x02, 0x1f, 0xff, 0xe8, 0x82, 0x00, 0x04, 0x7f, 0xff, 0xf7, 0xff, 0x80, 0x83, 0x00,
+  0x02, 0x76, 0xdb, 0x78, 0x82, 0x00, 0x03, 0x7f, 0xfb, 0xef, 0xff, 0x84, 0x00, 0x02, 0xff, 0xff,
+  0xfe, 0x82, 0x00, 0x03, 0xff, 0xff, 0xef, 0xfe, 0x83, 0x00, 0x03, 0x01, 0xbf, 0xff, 0xde, 0x82,
+  0x00, 0x03, 0xff, 0xfb, 0xff, 0xfc, 0x83, 0x00, 0x04, 0x01, 0xfd, 0xde, 0xff, 0x80, 0x80, 0x00,
+  0x04, 0x01, 0xff, 0xf7, 0xff, 0xf8, 0x83, 0x00, 0x00, 0x03, 0x80, 0xff, 0x81, 0x00, 0x00, 0x01,
+  0x80, 0xff, 0x00, 0xf0, 0x83, 0x00, 0x04, 0x02, 0xff, 0xff, 0xfb, 0x80, 0x80, 0x00, 0x04, 0x03,
+  0xff, 0xef, 0xff, 0xf0, 0x83, 0x00, 0x00, 0x03, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x03,
+  0x80, 0xff, 0x00, 0xe0, 0x83, 0x00, 0x00, 0x07, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x04, 0x07,
+  0xff, 0xdf, 0xff, 0xc0, 0x83, 0x00, 0x00, 0x07, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x07,
+  0x80, 0xff, 0x00, 0x80, 0x83, 0x00, 0x00, 0x07, 0x80, 0xff, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x07,
+  0x80, 0xff, 0x00, 0x80, 0x83, 0x00, 0x00, 0x07, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x0f,
+  0x80, 0xff, 0x84, 0x00, 0x00, 0x0f, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x03, 0x0f, 0xff, 0xff,
+  0xfe, 0x84, 0x00, 0x00, 0x0f, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xfc,
+  0x84, 0x00, 0x00, 0x0f, 0x80, 0xff, 0x00, 0x80, 0x80, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xfc, 0x84,
+  0x00, 0x00, 0x1f, 0x80, 0xff, 0x81, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf8, 0x84, 0x00, 0x00, 0x1f,
+  0x80, 0xff, 0x81, 0x00, 0x80, 0xff, 0x00, 0xf0, 0x84, 0x00, 0x00, 0x1f, 0x80, 0xff, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0xff, 0x00, 0xe0, 0x84, 0x00, 0x00, 0x3f, 0x80, 0xff, 0x80, 0x00, 0x00, 0x0f,
+  0x80, 0xff, 0x00, 0xe0, 0x84, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x1f, 0x80,
+  0xff, 0x00, 0xc0, 0x84, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x7f, 0x80, 0xff,
+  0x00, 0x80, 0x84, 0x00, 0x06, 0x7f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x01, 0x81, 0xff, 0x00, 0x80,
+  0x84, 0x00, 0x0a, 0x7f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfb, 0xff, 0x85, 0x00,
+  0x06, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0x81, 0xff, 0x85, 0x00, 0x0a, 0x7f, 0xff, 0xff,
+  0xfc, 0x02, 0x20, 0x7f, 0xff, 0xff, 0xfb, 0xfe, 0x85, 0x00, 0x05, 0x7f, 0xff, 0xff, 0xfc, 0x10,
+  0x00, 0x80, 0xff, 0x01, 0xf7, 0xfc, 0x85, 0x00, 0x80, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x80, 0xff,
+  0x01, 0xf7, 0xfc, 0x85, 0x00, 0x80, 0xff, 0x02, 0xf8, 0x00, 0x04, 0x81, 0xff, 0x00, 0xf8, 0x85,
+  0x00, 0x80, 0xff, 0x02, 0xf0, 0x40, 0x40, 0x80, 0xff, 0x01, 0xef, 0xf0, 0x85, 0x00, 0x80, 0xff,
+  0x02, 0xf8, 0x04, 0x00, 0x80, 0xff, 0x01, 0xef, 0xf0, 0x84, 0x00, 0x00, 0x01, 0x80, 0xff, 0x02,
+  0xf8, 0x00, 0x00, 0x80, 0xff, 0x01, 0xef, 0xf0, 0x84, 0x00, 0x00, 0x01, 0x80, 0xff, 0x02, 0xf8,
+  0x00, 0x10, 0x80, 0xff, 0x01, 0xdf, 0xe0, 0x84, 0x00, 0x00, 0x01, 0x80, 0xff, 0x02, 0xfc, 0x00,
+  0x00, 0x80, 0xff, 0x01, 0xdf, 0xc0, 0x84, 0x00, 0x00, 0x01, 0x80, 0xff, 0x02, 0xfc, 0x22, 0x00,
+  0x80, 0xff, 0x01, 0xdf, 0xc0, 0x84, 0x00, 0x00, 0x01, 0x80, 0xff, 0x02, 0xfc, 0x00, 0x40, 0x80,
+  0xff, 0x01, 0xdf, 0xc0, 0x84, 0x00, 0x00, 0x03, 0x80, 0xff, 0x03, 0xfc, 0x00, 0x04, 0x3f, 0x80,
+  0xff, 0x00, 0xc0, 0x84, 0x00, 0x00, 0x03, 0x80, 0xff, 0x03, 0xfe, 0x10, 0x00, 0x1f, 0x80, 0xff,
+  0x00, 0x80, 0x84, 0x00, 0x00, 0x03, 0x80, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x0f, 0x80, 0xff, 0x00,
+  0x80, 0x84, 0x00, 0x00, 0x03, 0x80, 0xff, 0x03, 0xfe, 0x04, 0x00, 0x07, 0x80, 0xff, 0x00, 0x80,
+  0x84, 0x00, 0x00, 0x03, 0x81, 0xff, 0x06, 0x00, 0x00, 0x03, 0xff, 0xff, 0xbf, 0x80, 0x84, 0x00,
+  0x00, 0x07, 0x81, 0xff, 0x05, 0x00, 0x00, 0x03, 0xff, 0xff, 0xbf, 0x85, 0x00, 0x00, 0x07, 0x81,
+  0xff, 0x80, 0x00, 0x02, 0xff, 0xff, 0x3f, 0x85, 0x00, 0x00, 0x07, 0x81, 0xff, 0x06, 0x80, 0x00,
+  0x00, 0xff, 0xf8, 0x3f, 0x80, 0x84, 0x00, 0x00, 0x07, 0x81, 0xff, 0x05, 0x80, 0x00, 0x00, 0x3f,
+  0xe0, 0x3f, 0x85, 0x00, 0x00, 0x07, 0x81, 0xff, 0x06, 0xc0, 0x00, 0x00, 0x3f, 0x80, 0x3b, 0x80,
+  0x84, 0x00, 0x00, 0x07, 0x81, 0xff, 0x06, 0xc0, 0x00, 0x00, 0x1c, 0x00, 0x3f, 0x80, 0x84, 0x00,
+  0x00, 0x0f, 0x81, 0xff, 0x00, 0xc0, 0x81, 0x00, 0x01, 0x3b, 0x80, 0x84, 0x00, 0x00, 0x0f, 0x81,
+  0xff, 0x00, 0xe0, 0x81, 0x00, 0x01, 0x1f, 0x80, 0x84, 0x00, 0x00, 0x0f, 0x81, 0xff, 0x00, 0xf0,
+  0x81, 0x00, 0x01, 0x3b, 0xc0, 0x84, 0x00, 0x00, 0x0f, 0x81, 0xff, 0x00, 0xf0, 0x81, 0x00, 0x01,
+  0x1f, 0xc0, 0x84, 0x00, 0x00, 0x0f, 0x81, 0xff, 0x00, 0xf8, 0x81, 0x00, 0x01, 0x1d, 0xc0, 0x84,
+  0x00, 0x00, 0x0f, 0x81, 0xff, 0x00, 0xf8, 0x81, 0x00, 0x01, 0x1f, 0xe0, 0x84, 0x00, 0x00, 0x0f,
+  0x81, 0xff, 0x00, 0xfc, 0x81, 0x00, 0x01, 0x0d, 0xe0, 0x84, 0x00, 0x00, 0x0f, 0x81, 0xff, 0x00,
+  0xfc, 0x81, 0x00, 0x01, 0x0f, 0xf0, 0x84, 0x00, 0x00, 0x0f, 0x81, 0xff, 0x00, 0xfe, 0x81, 0x00,
+  0x01, 0x0d, 0xf0, 0x84, 0x00, 0x00, 0x1f, 0x82, 0xff, 0x81, 0x00, 0x01, 0x0e, 0xf8, 0x84, 0x00,
+  0x00, 0x0f, 0x82, 0xff, 0x81, 0x00, 0x01, 0x0f, 0xf0, 0x84, 0x00, 0x00, 0x1f, 0x82, 0xff, 0x00,
+  0x80, 0x80, 0x00, 0x01, 0x06, 0xfc, 0x84, 0x00, 0x00, 0x1f, 0x82, 0xff, 0x00, 0x80, 0x80, 0x00,
+  0x01, 0x07, 0xf8, 0x84, 0x00, 0x00, 0x1f, 0x82, 0xff, 0x00, 0xc0, 0x80, 0x00, 0x01, 0x07, 0x7e,
+  0x84, 0x00, 0x00, 0x1f, 0x82, 0xff, 0x00, 0xe0, 0x80, 0x00, 0x01, 0x07, 0x78, 0x84, 0x00, 0x00,
+  0x1f, 0x82, 0xff, 0x81, 0x00, 0x01, 0x03, 0xff, 0x84, 0x00, 0x00, 0x1f, 0x82, 0xff, 0x00, 0xe0,
+  0x80, 0x00, 0x02, 0x03, 0x7e, 0x40, 0x83, 0x00, 0x00, 0x1f, 0x82, 0xff, 0x00, 0xfe, 0x80, 0x00,
+  0x01, 0x03, 0x7f, 0x84, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x80, 0x00, 0x02, 0x03, 0xfe, 0x40, 0x83,
+  0x00, 0x00, 0x3f, 0x83, 0xff, 0x80, 0x00, 0x02, 0x01, 0xff, 0x80, 0x83, 0x00, 0x00, 0x3f, 0x83,
+  0xff, 0x80, 0x00, 0x02, 0x01, 0xff, 0x40, 0x83, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x01,
+  0xff, 0xc8, 0x83, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x80, 0x00, 0x02, 0x01, 0xff, 0x90, 0x83, 0x00,
+  0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x01, 0xff, 0xe0, 0x83, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x81,
+  0x00, 0x01, 0xff, 0xca, 0x83, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x01, 0x7f, 0xf0, 0x83,
+  0x00, 0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x01, 0x7b, 0xe5, 0x83, 0x00, 0x00, 0x7f, 0x83, 0xff,
+  0x81, 0x00, 0x01, 0x7f, 0xf0, 0x83, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x02, 0x7f, 0xf9,
+  0x40, 0x82, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x01, 0x3f, 0xf4, 0x83, 0x00, 0x00, 0x7f,
+  0x83, 0xff, 0x81, 0x00, 0x02, 0x7e, 0xfc, 0xa0, 0x82, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00,
+  0x02, 0x37, 0xfa, 0x08, 0x82, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x01, 0x3f, 0xfe, 0x83,
+  0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x02, 0x1f, 0xfe, 0xa4, 0x82, 0x00, 0x00, 0x3f, 0x83,
+  0xff, 0x81, 0x00, 0x02, 0x3f, 0x7e, 0x08, 0x82, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x02,
+  0x1b, 0xf7, 0xa1, 0x82, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x02, 0x0f, 0xff, 0x04, 0x82,
+  0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x03, 0x0f, 0xff, 0xd0, 0x80, 0x81, 0x00, 0x00, 0x3f,
+  0x83, 0xff, 0x81, 0x00, 0x03, 0x0e, 0xdf, 0x82, 0x20, 0x81, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81,
+  0x00, 0x02, 0x07, 0xfd, 0xe8, 0x82, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x02, 0x0f, 0xff,
+  0xe1, 0x82, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x03, 0x07, 0x77, 0xf4, 0x28, 0x81, 0x00,
+  0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x02, 0x05, 0xfe, 0xd1, 0x82, 0x00, 0x00, 0x7f, 0x83, 0xff,
+  0x81, 0x00, 0x03, 0x03, 0xdf, 0xfc, 0x12, 0x81, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x03,
+  0x03, 0xfb, 0xf9, 0x40, 0x81, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x81, 0x00, 0x03, 0x01, 0xff, 0xde,
+  0x09, 0x81, 0x00, 0x00, 0x7f, 0x83, 0xff, 0x81, 0x00, 0x02, 0x03, 0x7e, 0xfc, 0x82, 0x00, 0x00,
+  0x3f, 0x83, 0xff, 0x81, 0x00, 0x04, 0x01, 0xf7, 0xff, 0x52, 0x40, 0x80, 0x00, 0x00, 0x7f, 0x83,
+  0xff, 0x82, 0x00, 0x01, 0xff, 0xb7, 0x82, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x03, 0xdd,
+  0xff, 0xc4, 0x90, 0x80, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x02, 0xff, 0xfd, 0x90, 0x81,
+  0x00, 0x03, 0x3f, 0xff, 0xff, 0x3f, 0x80, 0xff, 0x82, 0x00, 0x03, 0x77, 0x6f, 0xe2, 0x48, 0x80,
+  0x00, 0x06, 0x3f, 0xff, 0xff, 0x8b, 0xf7, 0xff, 0xff, 0x82, 0x00, 0x03, 0x7f, 0xff, 0x40, 0x02,
+  0x80, 0x00, 0x06, 0x3f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0x82, 0x00, 0x03, 0x32, 0xfb, 0xf4,
+  0x90, 0x80, 0x00, 0x06, 0x3f, 0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff, 0x82, 0x00, 0x03, 0x37, 0xbf,
+  0xf0, 0x04, 0x80, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x07, 0x3b, 0xee, 0xdc, 0x90, 0x80,
+  0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x02, 0x1b, 0xff, 0xf2, 0x81, 0x00, 0x00, 0x1f, 0x83,
+  0xff, 0x82, 0x00, 0x07, 0x1b, 0x7b, 0xfc, 0x25, 0x20, 0x00, 0x00, 0x1f, 0x83, 0xff, 0x82, 0x00,
+  0x02, 0x1f, 0xde, 0xfe, 0x81, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x07, 0x0d, 0xff, 0xee,
+  0xa4, 0x48, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x03, 0x0f, 0xef, 0x7b, 0x01, 0x80, 0x00,
+  0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x07, 0x0f, 0xbd, 0xff, 0x88, 0x12, 0x00, 0x00, 0x3f, 0x83,
+  0xff, 0x82, 0x00, 0x07, 0x05, 0xff, 0xbd, 0x82, 0x40, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00,
+  0x07, 0x07, 0xfb, 0xf7, 0xd0, 0x09, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x03, 0x03, 0x5e,
+  0xff, 0x44, 0x80, 0x00, 0x00, 0x3f, 0x83, 0xff, 0x82, 0x00, 0x07, 0x03, 0xff, 0xdb, 0xf0, 0x52,
+  0x40, 0x00, 0x7f, 0x83, 0xff, 0x82, 0x00, 0x07, 0x01, 0xef, 0xff, 0xe4, 0x00, 0x10, 0x00, 0x7f,
+  0x83, 0xff, 0x82, 0x00, 0x07, 0x01, 0xba, 0xbd, 0xb8, 0x44, 0x80, 0x00, 0x7f, 0x83, 0xff, 0x00,
+  0x01, 0x00, 0xf8, 0x15, 0x00, 0x00, 0x50, 0x52, 0x92, 0x00, 0x09, 0x40, 0x04, 0x00, 0x09, 0x4a,
+  0x52, 0x00, 0x09, 0x4a, 0x50, 0x00, 0x09, 0x4a, 0x52, 0x00, 0x4a, 0x54, 0x00, 0x02, 0x90, 0x02,
+  0x00, 0x02, 0x94, 0xa4, 0x00, 0x02, 0x94, 0x90, 0x00, 0x02, 0x94, 0xa4, 0x00, 0x52, 0x88, 0x00,
+  0x14, 0xa0, 0x04, 0x00, 0x14, 0x52, 0x90, 0x00, 0x08, 0xa5, 0x40, 0x00, 0x04, 0x52, 0x91, 0x00,
+  0x25, 0x20, 0x44, 0x81, 0x10, 0x00, 0x44, 0x80, 0xa5, 0x24, 0x22, 0x41, 0x29, 0x20, 0x00, 0x41,
+  0x4a, 0x48, 0x08, 0x48, 0x80, 0x00, 0x00, 0x40, 0x80, 0x00, 0x0d, 0x12, 0x40, 0x00, 0x00, 0x4a,
+  0x40, 0x00, 0x00, 0x25, 0x10, 0x00, 0x02, 0x20, 0x10, 0x80, 0x00, 0x04, 0x10, 0x00, 0x88, 0x00,
+  0x08, 0x80, 0x00, 0x07, 0x05, 0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x25, 0x80, 0x00, 0x7f, 0x4a,
+  0x80, 0x00, 0x01, 0x45, 0x40, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x95, 0x50,
+  0x00, 0x02, 0x92, 0x50, 0x00, 0x00, 0x14, 0x88, 0x00, 0x00, 0x15, 0x28, 0x00, 0x01, 0x12, 0x10,
+  0x05, 0x49, 0x48, 0x80, 0x01, 0x4a, 0x88, 0x01, 0x0a, 0xd2, 0x50, 0x44, 0x00, 0x4a, 0xa0, 0x01,
+  0x02, 0x55, 0x00, 0x04, 0x92, 0x90, 0x00, 0x0a, 0x2a, 0x54, 0x00, 0x01, 0x2a, 0xa2, 0x00, 0x00,
+  0x14, 0x94, 0x80, 0x04, 0xa4, 0x00, 0x12, 0x54, 0xaa, 0x00, 0x05, 0x52, 0xa1, 0x00, 0x15, 0x49,
+  0x28, 0x00, 0x00, 0xa5, 0x48, 0x00, 0x12, 0x92, 0x01, 0x0a, 0xa5, 0x24, 0x00, 0x08, 0xa4, 0x0c,
+  0x10, 0x04, 0x95, 0x4a, 0x00, 0x00, 0x29, 0x2a, 0x10, 0x0a, 0x55, 0x00, 0x24, 0x92, 0x92, 0x00,
+  0x15, 0x28, 0x12, 0x00, 0x2a, 0x52, 0xa9, 0x00, 0x01, 0xaa, 0xa5, 0x00, 0x05, 0x48, 0x00, 0x7f,
+  0x0a, 0xaa, 0x55, 0x00, 0x25, 0x48, 0x05, 0x00, 0x12, 0xa5, 0x12, 0x00, 0x00, 0x92, 0x4a, 0x00,
+  0x14, 0x95, 0x00, 0x52, 0x55, 0x48, 0x00, 0x12, 0x50, 0x02, 0x00, 0x29, 0x29, 0x55, 0x00, 0x02,
+  0x49, 0x29, 0x00, 0x52, 0x52, 0x80, 0x14, 0x91, 0x2a, 0x80, 0x15, 0x48, 0x04, 0x80, 0x05, 0x52,
+  0xaa, 0x40, 0x01, 0x55, 0x52, 0x80, 0x0a, 0xaa, 0x00, 0x4a, 0xaa, 0x95, 0x00, 0x49, 0x28, 0x82,
+  0x02, 0x54, 0x94, 0x45, 0x00, 0x0a, 0x92, 0x94, 0x00, 0x25, 0x12, 0x80, 0x14, 0x92, 0x52, 0x00,
+  0x12, 0x50, 0xc0, 0x80, 0x29, 0x2a, 0xa9, 0x00, 0x05, 0x25, 0x25, 0x40, 0x14, 0xaa, 0x00, 0x4a,
+  0x4a, 0xa9, 0x00, 0x55, 0x48, 0x21, 0x00, 0x15, 0x45, 0x2a, 0x40, 0x09, 0x54, 0xa9, 0x00, 0x4a,
+  0x92, 0x00, 0x11, 0x54, 0x92, 0x80, 0x24, 0x94, 0x50, 0x00, 0x24, 0xaa, 0x49, 0x00, 0x15, 0x29,
+  0x7f, 0x52, 0x80, 0x29, 0x2a, 0x00, 0x55, 0x25, 0x2a, 0x00, 0x15, 0x48, 0x30, 0x00, 0x12, 0x51,
+  0x54, 0x00, 0x09, 0x4a, 0x2a, 0x00, 0x0a, 0xa5, 0x00, 0x25, 0x4a, 0x49, 0x00, 0x09, 0x28, 0x5c,
+  0x00, 0x15, 0x4a, 0x92, 0x80, 0x12, 0x94, 0xc9, 0x00, 0x24, 0x94, 0x00, 0x09, 0x52, 0xa4, 0x00,
+  0x25, 0x54, 0x38, 0x00, 0x0a, 0x54, 0xa8, 0x00, 0x09, 0x4a, 0x24, 0x00, 0x0a, 0x4a, 0x00, 0x0a,
+  0x95, 0x2a, 0x00, 0x09, 0x22, 0x1f, 0x00, 0x09, 0x49, 0x25, 0x00, 0x25, 0x29, 0x55, 0x00, 0x09,
+  0x52, 0x00, 0x04, 0x49, 0x48, 0x00, 0x0a, 0x94, 0x1f, 0x80, 0x04, 0xa5, 0x50, 0x00, 0x09, 0x4a,
+  0x90, 0x00, 0x05, 0x29, 0x00, 0x09, 0x52, 0x50, 0x00, 0x04, 0xaa, 0x0f, 0x40, 0x02, 0x95, 0x24,
+  0x00, 0x02, 0x52, 0x54, 0x00, 0x02, 0x4a, 0x00, 0x02, 0xaa, 0x90, 0x00, 0x01, 0x25, 0x1f, 0xc0,
+  0x01, 0x1e, 0x52, 0x90, 0x00, 0x01, 0x29, 0x40, 0x00, 0x01, 0x52, 0x00, 0x00, 0x12, 0x40, 0x00,
+  0x00, 0x54, 0x0f, 0xf8, 0x00, 0x25, 0x20, 0x00, 0x00, 0x4a, 0x90, 0x00, 0x00, 0x4a, 0x00, 0x00,
+  0xa4, 0x80, 0x00, 0x08, 0x85, 0x07, 0xfa, 0x00, 0x90, 0x80, 0x00, 0x00, 0x91, 0x80, 0x00, 0x00,
+  0x24, 0x83, 0x00, 0x04, 0x10, 0x07, 0x7e, 0x80, 0x04, 0x80, 0x00, 0x00, 0x04, 0x88, 0x00, 0x02,
+  0x03, 0xff, 0xa0, 0x8d, 0x00, 0x02, 0x03, 0xef, 0xec, 0x86, 0x00, 0x00, 0x08, 0x80, 0x00, 0x05,
+  0x12, 0x00, 0x00, 0x01, 0xfd, 0xfe, 0x83, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x25, 0x40, 0x00, 0x00,
+  0x24, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x82, 0x00, 0x7a, 0x25, 0x40, 0x00, 0x52, 0x10, 0x00,
+  0x01, 0x4a, 0x40, 0x00, 0x00, 0x37, 0xbf, 0xfe, 0xeb, 0xbf, 0xfb, 0x80, 0x00, 0xaa, 0x90, 0x00,
+  0x4a, 0xa0, 0x00, 0x00, 0xa9, 0x50, 0x00, 0x00, 0x3f, 0xfb, 0xfe, 0xaf, 0xff, 0xff, 0x7e, 0x00,
+  0x09, 0x20, 0x00, 0x24, 0x90, 0x00, 0x05, 0x25, 0x28, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfb, 0xee,
+  0xfb, 0xfb, 0xe0, 0x12, 0xa8, 0x00, 0xaa, 0xa4, 0x00, 0x01, 0x4a, 0x50, 0x00, 0x02, 0x05, 0xb4,
+  0xba, 0xae, 0xbb, 0xae, 0xb7, 0xee, 0x05, 0x24, 0x00, 0x49, 0x28, 0x00, 0x0c, 0xa9, 0x4a, 0x00,
+  0x04, 0x00, 0x2b, 0xaf, 0xfb, 0xef, 0xfb, 0xfd, 0xfd, 0x00, 0x92, 0x00, 0x94, 0xa4, 0x00, 0x11,
+  0x25, 0x28, 0x00, 0x0a, 0x80, 0x0f, 0x7a, 0xaf, 0xbe, 0xae, 0xd7, 0x57, 0x40, 0x54, 0x00, 0x45,
+  0x12, 0x00, 0x0a, 0x94, 0x94, 0x80, 0x00, 0x7f, 0xb5, 0xdf, 0xfa, 0xeb, 0xfb, 0xfd, 0xfd, 0xc0,
+  0x29, 0x00, 0x2a, 0x54, 0x00, 0x02, 0xa9, 0x52, 0x00, 0x00, 0x03, 0xff, 0x6a, 0xaf, 0xbf, 0x6f,
+  0x57, 0xb7, 0xf8, 0x12, 0x00, 0x91, 0x48, 0x00, 0x14, 0x95, 0x28, 0x00, 0x00, 0x0e, 0xaa, 0xff,
+  0xf5, 0xeb, 0xdd, 0xfd, 0xed, 0x74, 0x04, 0x00, 0x25, 0x25, 0x00, 0x05, 0x22, 0x4a, 0x00, 0x00,
+  0xbd, 0xb7, 0xef, 0xdf, 0xbf, 0x77, 0xb7, 0xbf, 0xdd, 0x01, 0x00, 0xa9, 0x50, 0x00, 0x12, 0xaa,
+  0xa4, 0x00, 0x0a, 0xeb, 0x6f, 0x56, 0xea, 0xeb, 0xdd, 0xed, 0xeb, 0x77, 0x02, 0x00, 0x44, 0x8a,
+  0x00, 0x04, 0x92, 0x48, 0x00, 0x2f, 0x56, 0xf9, 0xfb, 0xdf, 0xbd, 0x77, 0xbf, 0xbf, 0xdf, 0xe0,
+  0x00, 0x2a, 0x50, 0x00, 0x0a, 0x49, 0x00, 0x06, 0xc1, 0xbb, 0x9f, 0x6e, 0xb5, 0xdf, 0xdd, 0xea,
+  0xea, 0xf5, 0xc0, 0x00, 0xa4, 0xa4, 0x00, 0x01, 0x23, 0x54, 0x00, 0x28, 0x00, 0x6c, 0xff, 0xba,
+  0xee, 0xb5, 0x7e, 0xbf, 0xbf, 0xdf, 0x68, 0x00, 0x12, 0x28, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00,
+  0x27, 0xfb, 0xd7, 0x77, 0xef, 0xab, 0xeb, 0xed, 0xb7, 0xd8, 0x00, 0xa9, 0x40, 0x80, 0x00, 0x46,
+  0x16, 0x00, 0x01, 0xdf, 0xfe, 0xbd, 0xad, 0x5d, 0x7f, 0x5e, 0xbe, 0xfd, 0x7e, 0x00, 0x0a, 0x40,
+  0x00, 0x00, 0x02, 0xc0, 0x00, 0x0f, 0x75, 0xd5, 0x56, 0xdb, 0xb7, 0xab, 0xf7, 0xd7, 0xb7, 0xde,
+  0x00, 0x50, 0x80, 0x00, 0x00, 0x56, 0x20, 0x00, 0x3c, 0xda, 0x2e, 0xeb, 0x6d, 0x6d, 0x7d, 0x5d,
+  0x7d, 0xdf, 0x7b, 0x80, 0x04, 0x00, 0x00, 0x18, 0xd0, 0x00, 0x01, 0xfb, 0xe8, 0x03, 0x5a, 0xdb,
+  0xb7, 0xaf, 0xef, 0xe7, 0x75, 0xdf, 0x80, 0x80, 0x00, 0x7f, 0x8f, 0xff, 0x48, 0x07, 0xf7, 0xaa,
+  0x00, 0xad, 0xad, 0x6d, 0x7a, 0xb5, 0x57, 0xff, 0x7a, 0xe0, 0x00, 0x00, 0x2b, 0xff, 0xfd, 0xea,
+  0x7f, 0xdf, 0xd2, 0x00, 0x16, 0xd6, 0xdb, 0xad, 0xdf, 0xfd, 0x57, 0xdf, 0xe0, 0x00, 0x00, 0xb6,
+  0xbf, 0xff, 0xff, 0xbf, 0xde, 0xac, 0x00, 0x05, 0x5d, 0xb6, 0xdb, 0xba, 0xaa, 0xfd, 0x7a, 0xb8,
+  0x00, 0x04, 0xd1, 0xd4, 0x09, 0x55, 0xff, 0x7d, 0xf0, 0x00, 0x03, 0xea, 0xda, 0xb6, 0xd7, 0x7f,
+  0xaf, 0xd7, 0xf8, 0x00, 0x1b, 0x58, 0x01, 0x37, 0xbf, 0xfe, 0x7f, 0xa0, 0x00, 0x03, 0xab, 0x56,
+  0xed, 0xbd, 0xd6, 0xfa, 0xbf, 0xaa, 0x00, 0x17, 0x40, 0x05, 0xff, 0xff, 0xfe, 0xff, 0xc0, 0x20,
+  0x1e, 0x15, 0xb5, 0x5b, 0x6b, 0x7d, 0xdf, 0xea, 0xfe, 0x00, 0xae, 0x00, 0x05, 0x7f, 0xff, 0xfd,
+  0xff, 0x50, 0x80, 0x14, 0x06, 0xab, 0xb6, 0xad, 0xab, 0x75, 0x7f, 0xbf, 0xf6, 0x01, 0x79, 0x00,
+  0x2f, 0xdd, 0xff, 0xf9, 0xff, 0xed, 0x40, 0xec, 0x19, 0x6d, 0x5d, 0xf6, 0xf6, 0xbf, 0x6d, 0x5f,
+  0x02, 0xea, 0x00, 0x1d, 0xff, 0xff, 0xf7, 0xfd, 0xbb, 0xa1, 0x5c, 0x10, 0x55, 0xd6, 0xad, 0xad,
+  0x55, 0xf7, 0xfd, 0x02, 0xb4, 0x00, 0x77, 0x6e, 0xdf, 0xe7, 0xff, 0x6e, 0xbf, 0x78, 0x20, 0x17,
+  0x6f, 0x5b, 0x7b, 0x7f, 0x7d, 0xb7, 0x0b, 0xe8, 0x02, 0xdd, 0xff, 0xff, 0xef, 0xdf, 0xfd, 0xd5,
+  0xe0, 0x60, 0x0b, 0xab, 0xb6, 0xd7, 0x75, 0xd7, 0xff, 0x16, 0xa8, 0x01, 0x77, 0x5b, 0xf7, 0xcf,
+  0x36, 0xdb, 0x77, 0xf8, 0xc0, 0x01, 0x5b, 0x55, 0xba, 0x5e, 0xfd, 0x5b, 0x2b, 0x60, 0x03, 0x5d,
+  0xff, 0x5e, 0xde, 0x7f, 0xff, 0xdf, 0xd7, 0xe0, 0x07, 0x57, 0xdb, 0x57, 0xfb, 0xb7, 0xef, 0x1d,
+  0xa0, 0x0c, 0xb7, 0x56, 0xff, 0x9c, 0xff, 0xf6, 0xfb, 0x3b, 0xd0, 0x7f, 0x07, 0x0b, 0x6d, 0xb5,
+  0xd6, 0xed, 0xfa, 0x2a, 0xd0, 0x25, 0x6d, 0xfb, 0xf5, 0x38, 0xfd, 0xff, 0xfe, 0x7b, 0xef, 0x06,
+  0x05, 0xd5, 0x6e, 0xff, 0xbf, 0x5f, 0x3e, 0xa0, 0x19, 0xdb, 0x5e, 0xa8, 0x35, 0xff, 0xdb, 0xd8,
+  0x6f, 0xb5, 0xdb, 0x01, 0xad, 0xb5, 0xd5, 0xed, 0xf7, 0x15, 0xd0, 0x33, 0x6e, 0xf5, 0x07, 0x65,
+  0xff, 0xff, 0x3c, 0x35, 0xee, 0xaf, 0x81, 0xdb, 0x6b, 0xfe, 0xb7, 0xbd, 0xb5, 0x50, 0x55, 0xb5,
+  0x00, 0xfd, 0x6b, 0xff, 0xfe, 0x8b, 0x7f, 0xb5, 0xbf, 0x81, 0x8a, 0xbd, 0x57, 0xfd, 0xef, 0x96,
+  0xc1, 0x67, 0x6e, 0x8f, 0xb6, 0xdb, 0xff, 0xff, 0x6a, 0x6b, 0xdb, 0x65, 0x75, 0xc5, 0x66, 0xed,
+  0x57, 0xbf, 0x3b, 0x52, 0x8a, 0xd0, 0x7b, 0x78, 0x9b, 0xff, 0xfb, 0xc3, 0x7f, 0xf6, 0xde, 0xed,
+  0xc0, 0xbb, 0xfb, 0xfd, 0xeb, 0xd5, 0x50, 0xdb, 0x40, 0xed, 0xd0, 0x37, 0x7f, 0xfe, 0xef, 0x01,
+  0x7b, 0xdf, 0x7c, 0xf7, 0xe0, 0x16, 0xef, 0x57, 0x7f, 0xd6, 0xcd, 0x2c, 0x03, 0x5b, 0x45, 0x77,
+  0xff, 0x36, 0x00, 0x6b, 0x75, 0xec, 0x39, 0x1c, 0x0b, 0xf5, 0xff, 0xdd, 0x0d, 0x53, 0x94, 0x85,
+  0xb6, 0x88, 0xf7, 0xee, 0xce, 0x00, 0xfb, 0xdf, 0xb8, 0x66, 0x87, 0xc6, 0xef, 0xda, 0xf7, 0xd5,
+  0xa2, 0x60, 0x0d, 0x6c, 0xac, 0xef, 0xef, 0xb8, 0x00, 0x7b, 0xf6, 0xf0, 0x3f, 0xea, 0xa1, 0x5a,
+  0xff, 0xff, 0x46, 0xa3, 0x48, 0x2b, 0xd8, 0x58, 0xab, 0xd7, 0x3f, 0x80, 0xef, 0xff, 0xd0, 0x0d,
+  0xfe, 0xfe, 0xef, 0xd7, 0xdb, 0xb5, 0x64, 0x20, 0x55, 0x64, 0x35, 0xef, 0x4e, 0x97, 0xe0, 0xfb,
+  0xb6, 0xe0, 0x1e, 0xfb, 0xab, 0x8a, 0xfd, 0xff, 0x73, 0x52, 0x40, 0x2d, 0x41, 0x59, 0xe7, 0x8c,
+  0x7e, 0xe0, 0x6f, 0xff, 0xc6, 0x0b, 0xee, 0xfd, 0x61, 0x6f, 0xf7, 0xf9, 0x50, 0x7f, 0x80, 0x36,
+  0xa0, 0xf7, 0x4e, 0x13, 0xdb, 0xb8, 0x71, 0xff, 0xe1, 0x8e, 0xff, 0xae, 0xfa, 0xfb, 0xfe, 0xf9,
+  0x69, 0x18, 0x55, 0x06, 0xdb, 0x27, 0x0e, 0xe0, 0x7c, 0x33, 0xfd, 0x81, 0xc3, 0x75, 0x7b, 0x6d,
+  0x2f, 0xdf, 0xfa, 0xa8, 0x31, 0x6a, 0x82, 0xfc, 0xad, 0x1f, 0x9d, 0x3e, 0x53, 0xdf, 0xc7, 0xf3,
+  0xfb, 0xde, 0xff, 0xb7, 0xfb, 0xf1, 0x52, 0x30, 0xaa, 0x0d, 0xa8, 0x66, 0x8f, 0x92, 0xcc, 0x50,
+  0xff, 0xc0, 0xff, 0xfb, 0x7b, 0x6d, 0xdf, 0xff, 0xe0, 0x28, 0x12, 0xa9, 0x13, 0x63, 0xa4, 0xae,
+  0xad, 0x4f, 0x11, 0xff, 0x82, 0xdc, 0xe3, 0xdf, 0x7f, 0xfb, 0xff, 0xc0, 0x06, 0x01, 0x56, 0x0d,
+  0xc9, 0x54, 0x97, 0x2a, 0xb3, 0x30, 0x7f, 0x07, 0xff, 0xbb, 0xf6, 0xf7, 0x7f, 0xef, 0xc0, 0xc8,
+  0x81, 0x54, 0x2b, 0x23, 0x61, 0xae, 0x4b, 0x05, 0x80, 0xff, 0x8b, 0xbb, 0xfd, 0xbf, 0x7f, 0x5f,
+  0xef, 0xff, 0x8c, 0x22, 0x00, 0xa0, 0x2d, 0x2a, 0x84, 0x8e, 0x80, 0x05, 0x10, 0x5f, 0x06, 0x0b,
+  0x6a, 0xff, 0x7d, 0xff, 0xdf, 0x0c, 0x24, 0x25, 0xa0, 0x54, 0x53, 0x01, 0x8e, 0x07, 0x11, 0x00,
+  0x3f, 0x19, 0x52, 0xfe, 0xf7, 0x7f, 0xff, 0xfd, 0x08, 0x55, 0x95, 0x50, 0x2a, 0xa2, 0x88, 0x8c,
+  0x00, 0xa0, 0x80, 0x2e, 0x02, 0xaa, 0x9d, 0x7d, 0xff, 0xdf, 0xbf, 0x00, 0x64, 0x04, 0x80, 0x29,
+  0x6c, 0x4a, 0xae, 0x00, 0x18, 0x00, 0x16, 0x25, 0x55, 0x35, 0xff, 0x6f, 0xff, 0xbf, 0x00, 0x9a,
+  0x01, 0x40, 0xa5, 0x42, 0x85, 0x42, 0x08, 0x56, 0x00, 0x0f, 0x00, 0xae, 0xaf, 0x7f, 0xfe, 0xff,
+  0x7f, 0x00, 0x32, 0x05, 0x24, 0x45, 0x48, 0xaa, 0x56, 0x01, 0x6a, 0x00, 0x02, 0x14, 0x21, 0xa6,
+  0xbe, 0xff, 0xff, 0x7f, 0xa0, 0x54, 0x04, 0x80, 0x4a, 0xa9, 0x0a, 0xa0, 0x0b, 0xc2, 0x00, 0x12,
+  0x05, 0x00, 0x80, 0x57, 0xbf, 0x7f, 0xfe, 0xff, 0x10, 0xa9, 0x01, 0x0c, 0x55, 0x42, 0xa4, 0x64,
+  0x05, 0xd8, 0x80, 0x80, 0x00, 0x34, 0x23, 0x7e, 0xff, 0xfe, 0xff, 0x03, 0x16, 0x00, 0x84, 0x15,
+  0x45, 0x04, 0xd4, 0x0b, 0x9a, 0x00, 0x03, 0x00, 0x52, 0x32, 0x9e, 0xff, 0xfd, 0xff, 0x00, 0x54,
+  0x81, 0x08, 0x55, 0x45, 0x31, 0x50, 0x0b, 0x59, 0x80, 0x00, 0x00, 0x19, 0x05, 0xde, 0xff, 0xf9,
+  0xff, 0x00, 0x19, 0x00, 0x40, 0x2a, 0x82, 0xa1, 0x57, 0x03, 0x5a, 0x80, 0x00, 0x64, 0x0a, 0xb1,
+  0xde, 0xff, 0xf7, 0xff, 0x00, 0x02, 0x22, 0x80, 0x15, 0x4d, 0x12, 0xa1, 0x02, 0xda, 0x00, 0x00,
+  0x04, 0xfa, 0x83, 0x5e, 0xff, 0xcf, 0xff, 0x00, 0x00, 0x80, 0x00, 0x4a, 0x85, 0x25, 0x56, 0x04,
+  0xe3, 0x00, 0x00, 0x02, 0xfb, 0x50, 0xed, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x20, 0x80, 0x29, 0x15,
+  0x05, 0x64, 0x81, 0x7c, 0x00, 0x00, 0x02, 0xf1, 0xc0, 0xed, 0xff, 0x3f, 0xff, 0x00, 0x00, 0x06,
+  0x00, 0x4a, 0x8a, 0x95, 0x51, 0x82, 0x7c, 0x00, 0x00, 0x01, 0x80, 0xe1, 0xf5, 0xfc, 0xff, 0xff,
+  0x00, 0x00, 0x01, 0x00, 0x15, 0x12, 0x0a, 0xac, 0x01, 0x78, 0x00, 0x00, 0x0c, 0x6c, 0xe0, 0xf5,
+  0xfb, 0xff, 0xff, 0x80, 0x00, 0x0f, 0x40, 0x29, 0x4a, 0x95, 0x54, 0x00, 0xb4, 0x00, 0x00, 0x09,
+  0xec, 0xe1, 0xf9, 0xe2, 0xff, 0xff, 0x80, 0x00, 0x0f, 0x2c, 0x00, 0x14, 0x2a, 0xa4, 0x00, 0x10,
+  0x00, 0x00, 0x0b, 0xdd, 0x40, 0xe9, 0x9f, 0xef, 0xff, 0x80, 0x00, 0x04, 0x02, 0x00, 0x0a, 0x55,
+  0x54, 0x81, 0x00, 0x06, 0x03, 0xd9, 0x41, 0xe2, 0x2f, 0xfe, 0xef, 0x80, 0x00, 0x05, 0x0a, 0x00,
+  0x00, 0xa9, 0x21, 0x40, 0x80, 0x00, 0x06, 0x03, 0xc7, 0x03, 0xd0, 0xff, 0x7f, 0xfd, 0x80, 0x00,
+  0x05, 0x20, 0x00, 0x01, 0x4a, 0xad, 0x10, 0x80, 0x00, 0x06, 0x03, 0xfe, 0x03, 0xc1, 0x7d, 0xfb,
+  0xbf, 0x80, 0x00, 0x18, 0x20, 0x00, 0x02, 0xaa, 0xa4, 0x40, 0x00, 0x08, 0x00, 0x05, 0xff, 0x03,
+  0xd7, 0xdf, 0xbf, 0xef, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x49, 0x2c, 0x10, 0x80, 0x00, 0x0f,
+  0x01, 0xf0, 0x00, 0x4a, 0xf6, 0xeb, 0x7b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xaa, 0xa0, 0x40,
+  0x80, 0x00, 0x0e, 0x01, 0x50, 0x00, 0x1f, 0xbf, 0xff, 0xdf, 0x00, 0x00, 0x08, 0x00, 0x00, 0x05,
+  0x25, 0x4c, 0x82, 0x00, 0x05, 0xa0, 0x01, 0x56, 0xfa, 0xdb, 0x7d, 0x82, 0x00, 0x02, 0x09, 0x54,
+  0xa8, 0x83, 0x00, 0x0c, 0x12, 0xfb, 0xaf, 0xbe, 0xef, 0x00, 0x00, 0x80, 0x00, 0x00, 0x05, 0x25,
+  0x24, 0x83, 0x00, 0x06, 0x81, 0xae, 0xf6, 0xfb, 0xba, 0x00, 0x02, 0x80, 0x00, 0x02, 0x14, 0x89,
+  0x54, 0x83, 0x00, 0x04, 0x87, 0x77, 0x5d, 0xae, 0xef, 0x82, 0x00, 0x0f, 0x29, 0x42, 0x48, 0x00,
+  0x01, 0xf4, 0x00, 0x01, 0x55, 0xba, 0xda, 0xf6, 0xfb, 0xba, 0x00, 0x10, 0x80, 0x00, 0x0d, 0x14,
+  0x8a, 0xa2, 0x00, 0x08, 0xa0, 0xd8, 0x02, 0x23, 0x2f, 0x6f, 0x5f, 0x56, 0xeb, 0x82, 0x00, 0x0f,
+  0x22, 0x0a, 0x4a, 0x00, 0x0b, 0xf5, 0x6b, 0x00, 0x8e, 0x7a, 0xda, 0xea, 0xfb, 0x55, 0x00, 0x80,
+  0x80, 0x00, 0x0d, 0x54, 0x11, 0x29, 0x00, 0x03, 0xff, 0xff, 0x00, 0x38, 0xab, 0x6d, 0xb7, 0x56,
+  0xdb, 0x82, 0x00, 0x0d, 0x88, 0x0a, 0xa4, 0x00, 0x03, 0xff, 0xff, 0x40, 0x7a, 0xd6, 0xab, 0x5a,
+  0xdb, 0x55, 0x82, 0x00, 0x0d, 0x50, 0x29, 0x2a, 0x80, 0x07, 0x55, 0xbf, 0x80, 0xf1, 0x6a, 0xda,
+  0xd6, 0xb6, 0xae, 0x82, 0x00, 0x0e, 0xa0, 0x12, 0x44, 0x40, 0x03, 0xfe, 0xef, 0x81, 0xe2, 0xad,
+  0xab, 0x6d, 0xd5, 0x55, 0x10, 0x80, 0x00, 0x0e, 0x01, 0x00, 0x2a, 0x92, 0x00, 0x01, 0x6f, 0x7a,
+  0x03, 0xcb, 0x55, 0x6d, 0x55, 0x6a, 0xb6, 0x82, 0x00, 0x0d, 0xa0, 0x24, 0x84, 0x00, 0x03, 0xb5,
+  0xaf, 0x07, 0xca, 0xdb, 0x5a, 0xb6, 0x95, 0x6a, 0x81, 0x00, 0x0e, 0x02, 0x40, 0x12, 0x14, 0x00,
+  0x01, 0xee, 0xee, 0x0f, 0x95, 0x55, 0x55, 0xa8, 0x2a, 0xa8, 0x81, 0x00, 0x0e, 0x01, 0x00, 0x24,
+  0x88, 0x00, 0x01, 0xdb, 0x5e, 0x3f, 0x15, 0x55, 0x55, 0x50, 0xaa, 0xac, 0x81, 0x00, 0x0e, 0x02,
+  0x00, 0x15, 0x14, 0x00, 0x00, 0xb5, 0xd8, 0x3f, 0x2a, 0xaa, 0xaa, 0x85, 0x55, 0x50, 0x81, 0x00,
+  0x08, 0x02, 0x00, 0x28, 0x22, 0x00, 0x00, 0x6e, 0xb0, 0x7e, 0x80, 0x55, 0x02, 0x0a, 0xaa, 0xd2,
+  0x81, 0x00, 0x0e, 0x04, 0x00, 0x05, 0x08, 0x00, 0x00, 0x3b, 0x61, 0xfc, 0x2a, 0xaa, 0xb4, 0x52,
+  0xaa, 0xa0, 0x83, 0x00, 0x0c, 0x34, 0x2a, 0x00, 0x00, 0x04, 0x80, 0xfc, 0xaa, 0xaa, 0xa0, 0x2a,
+  0xaa, 0x84, 0x81, 0x00, 0x03, 0x04, 0x00, 0x02, 0x04, 0x80, 0x00, 0x07, 0x01, 0xf8, 0x55, 0x55,
+  0x42, 0xd5, 0x55, 0x11, 0x81, 0x00, 0x03, 0x04, 0x00, 0x14, 0x28, 0x80, 0x00, 0x07, 0x07, 0xf1,
+  0x55, 0x55, 0x0a, 0x95, 0x54, 0x08, 0x83, 0x00, 0x0c, 0x08, 0x04, 0x08, 0x10, 0x00, 0x0f, 0xf4,
+  0x92, 0xaa, 0x15, 0x55, 0x40, 0x22, 0x81, 0x00, 0x0e, 0x08, 0x00, 0x14, 0x10, 0x01, 0x00, 0x0a,
+  0xc7, 0xe8, 0x55, 0x48, 0x52, 0xaa, 0x81, 0x12, 0x87, 0x00, 0x08, 0x1f, 0xdf, 0xeb, 0x54, 0xa0,
+  0x4a, 0x50, 0x10, 0x41, 0x83, 0x00, 0x0c, 0x04, 0x10, 0x00, 0x00, 0x0f, 0xcf, 0xd8, 0xa5, 0x51,
+  0x55, 0x40, 0x42, 0x02, 0x83, 0x00, 0x0c, 0x08, 0x00, 0x20, 0x00, 0xee, 0xdf, 0xda, 0x95, 0x02,
+  0xa8, 0x02, 0x00, 0x49, 0x83, 0x00, 0x0c, 0x04, 0x00, 0x10, 0x0b, 0x07, 0xbf, 0xba, 0xaa, 0x42,
+  0x91, 0x00, 0x0a, 0x04, 0x85, 0x00, 0x0a, 0x29, 0x7c, 0x0f, 0xbf, 0xb1, 0x49, 0x0a, 0x40, 0x08,
+  0x10, 0x92, 0x85, 0x00, 0x0a, 0x11, 0x50, 0x0d, 0x7f, 0x72, 0x2a, 0x05, 0x02, 0x04, 0x48, 0x24,
+  0x85, 0x00, 0x0a, 0x6d, 0x80, 0x0f, 0x7f, 0x75, 0x52, 0x10, 0x14, 0x40, 0x10, 0x09, 0x85, 0x00,
+  0x0a, 0x1a, 0x00, 0x1f, 0xfe, 0xd4, 0x48, 0x14, 0x20, 0x80, 0xa0, 0x52, 0x85, 0x00, 0x0a, 0xc5,
+  0x00, 0x1e, 0x7f, 0xf0, 0xa8, 0x00, 0x00, 0x10, 0x00, 0x08, 0x84, 0x00, 0x0b, 0x01, 0x56, 0x00,
+  0x1c, 0xfe, 0xa4, 0x20, 0x20, 0x02, 0x82, 0xa1, 0x50, 0x84, 0x00, 0x0b, 0x05, 0x38, 0x00, 0x42,
+  0xfe, 0x90, 0x90, 0x00, 0x14, 0x01, 0x00, 0x88, 0x84, 0x00, 0x0b, 0x0a, 0x40, 0x10, 0x81, 0xfd,
+  0x20, 0xa0, 0x00, 0x20, 0x04, 0x45, 0x20, 0x84, 0x00, 0x0b, 0x24, 0x20, 0x02, 0xa1, 0xfe, 0xc0,
+  0x40, 0x00, 0x08, 0x29, 0x00, 0x40, 0x84, 0x00, 0x0c, 0x28, 0x02, 0x25, 0x49, 0xfd, 0x11, 0x22,
+  0x04, 0x00, 0x02, 0x15, 0x00, 0x40, 0x82, 0x00, 0x0d, 0x01, 0x50, 0x80, 0xc2, 0x51, 0xf8, 0x20,
+  0x42, 0x00, 0x0a, 0x80, 0x02, 0x00, 0xa0, 0x82, 0x00, 0x0d, 0x02, 0x80, 0x46, 0x4c, 0x80, 0xfc,
+  0x18, 0x04, 0x5c, 0x52, 0x50, 0x28, 0x00, 0x28, 0x82, 0x00, 0x0d, 0x09, 0x00, 0xbf, 0x92, 0x68,
+  0xf8, 0x68, 0x88, 0x50, 0x95, 0x2a, 0x00, 0x00, 0x55, 0x82, 0x00, 0x0e, 0x0a, 0x00, 0x7f, 0xe6,
+  0xe8, 0xf8, 0x08, 0x0d, 0xa1, 0x52, 0x44, 0x80, 0x00, 0x95, 0x40, 0x81, 0x00, 0x05, 0x24, 0x03,
+  0xff, 0xf3, 0xe0, 0xf0, 0x80, 0x00, 0x05, 0x01, 0x52, 0x50, 0x00, 0x24, 0xa8, 0x81, 0x00, 0x05,
+  0x28, 0x0f, 0xff, 0xfb, 0xe9, 0x38, 0x81, 0x00, 0x04, 0x25, 0x4a, 0x8a, 0xaa, 0x52, 0x81, 0x00,
+  0x05, 0xa8, 0x1f, 0xff, 0xff, 0xe0, 0x38, 0x82, 0x00, 0x03, 0x91, 0x22, 0x52, 0xa5, 0x80, 0x00,
+  0x06, 0x02, 0xa0, 0x3f, 0xff, 0xfd, 0xc8, 0x30, 0x82, 0x00, 0x0d, 0x0a, 0x40, 0xa8, 0x00, 0x40,
+  0x00, 0x00, 0x02, 0x80, 0x7f, 0xff, 0xff, 0x00, 0x18, 0x85, 0x00, 0x00, 0x89, 0x80, 0x00, 0x05,
+  0x0a, 0x40, 0x4f, 0xff, 0xfe, 0x80, 0x85, 0x00, 0x09, 0x05, 0x24, 0x40, 0x00, 0x00, 0x15, 0x03,
+  0xbb, 0xff, 0xfe, 0x86, 0x00, 0x09, 0x6a, 0x55, 0x54, 0x00, 0x00, 0x1b, 0xbf, 0xfd, 0xff, 0xfc,
+  0x86, 0x00, 0x09, 0x29, 0x52, 0xaa, 0x10, 0x00, 0x11, 0x7f, 0xff, 0x7f, 0xf0, 0x86, 0x00, 0x05,
+  0x4a, 0x95, 0x24, 0x82, 0xa8, 0x57, 0x80, 0xff, 0x00, 0xc0, 0x86, 0x00, 0x04, 0x2a, 0xa9, 0x55,
+  0x40, 0x92, 0x80, 0xff, 0x01, 0xbf, 0x80, 0x86, 0x00, 0x04, 0x52, 0x52, 0x92, 0xb4, 0x21, 0x80,
+  0xff, 0x01, 0x9c, 0x10, 0x86, 0x00, 0x08, 0x95, 0x2a, 0x54, 0x8a, 0x0b, 0xbf, 0xff, 0xff, 0xd0,
+  0x87, 0x00, 0x04, 0x24, 0xa5, 0x48, 0x00, 0x02, 0x80, 0xff, 0x88, 0x00, 0x07, 0xaa, 0x92, 0x20,
+  0x00, 0x05, 0x7f, 0xff, 0xfe, 0x88, 0x00, 0x07, 0x52, 0x55, 0x00, 0x00, 0x18, 0x3f, 0xff, 0xd0,
+  0x88, 0x00, 0x06, 0x4a, 0xa0, 0x00, 0x00, 0x24, 0x0a, 0x96, 0x89, 0x00, 0x06, 0xaa, 0x40, 0x00,
+  0x00, 0xd4, 0x00, 0x40, 0x89, 0x00, 0x07, 0x49, 0x00, 0x00, 0x01, 0x28, 0x00, 0x80, 0x80, 0x88,
+  0x00, 0x04, 0xb2, 0x00, 0x00, 0x02, 0xd0, 0x8b, 0x00, 0x06, 0x48, 0x00, 0x00, 0x05, 0x20, 0x02,
+  0x02, 0x89, 0x00, 0x05, 0xb0, 0x00, 0x00, 0x06, 0xc0, 0x04, 0x86, 0x00, 0x0a, 0x2f, 0xff, 0xe0,
+  0x00, 0x40, 0x00, 0x00, 0x09, 0x00, 0x08, 0x08, 0x84, 0x00, 0x08, 0x3f, 0xff, 0xff, 0xf8, 0x00,
+  0x80, 0x00, 0x00, 0x05, 0x87, 0x00, 0x80, 0xff, 0x00, 0xf8, 0x81, 0x00, 0x02, 0x1a, 0x00, 0x20,
+  0x84, 0x00, 0x00, 0x01, 0x80, 0xff, 0x00, 0xf8, 0x81, 0x00, 0x00, 0x14, 0x87, 0x00, 0x80, 0xff,
+  0x00, 0xfc, 0x81, 0x00, 0x02, 0x28, 0x00, 0x80, 0x84, 0x00, 0x00, 0x01, 0x80, 0xff, 0x00, 0xf8,
+  0x81, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x10, 0x83, 0x00, 0x09, 0xff, 0x6a, 0xff, 0xfc, 0x10,
+  0x00, 0x00, 0x01, 0x60, 0x01, 0x86, 0x00, 0x03, 0xf4, 0x89, 0x2f, 0xf8, 0x81, 0x00, 0x01, 0x40,
+  0x02, 0x86, 0x00, 0x0a, 0xe0, 0x00, 0x17, 0xf8, 0x80, 0x00, 0x00, 0x10, 0x80, 0x00, 0x08, 0x84,
+  0x00, 0x05, 0x01, 0x89, 0x24, 0x87, 0xf8, 0x04, 0x80, 0x00, 0x02, 0x80, 0x04, 0x10, 0x84, 0x00,
+  0x07, 0x11, 0x00, 0x00, 0x01, 0xf8, 0x20, 0x00, 0x01, 0x80, 0x00, 0x00, 0x10, 0x84, 0x00, 0x04,
+  0x02, 0x40, 0x00, 0x21, 0xf0, 0x80, 0x00, 0x02, 0x01, 0x00, 0x04, 0x86, 0x00, 0x09, 0x02, 0x21,
+  0x00, 0x79, 0x00, 0x00, 0x44, 0x02, 0x00, 0x08, 0x89, 0x00, 0x04, 0xf0, 0x24, 0x00, 0x00, 0x22,
+  0x80, 0x00, 0x00, 0x08, 0x83, 0x00, 0x06, 0x01, 0x00, 0x00, 0x04, 0x60, 0x00, 0x04, 0x80, 0x00,
+  0x00, 0x10, 0x85, 0x00, 0x00, 0x14, 0x80, 0x00, 0x00, 0x61, 0x80, 0x00, 0x00, 0x04, 0x8b, 0x00,
+  0x06, 0x64, 0x4a, 0x00, 0x40, 0x00, 0x00, 0x20, 0x89, 0x00, 0x04, 0x40, 0x00, 0x10, 0x01, 0x08,
+  0x87, 0x00, 0x00, 0x08, 0x80, 0x00, 0x04, 0x02, 0x48, 0x00, 0x00, 0x08, 0x87, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x03, 0x48, 0x12, 0x01, 0x08, 0x8c, 0x00, 0x04, 0x01, 0x40, 0x00, 0x00, 0x10, 0x8b,
+  0x00, 0x04, 0x48, 0x12, 0x00, 0x00, 0x10, 0x87, 0x00, 0x00, 0x10, 0x80, 0x00, 0x04, 0x05, 0x48,
+  0x20, 0x00, 0x80, 0x8b, 0x00, 0x03, 0x20, 0x12, 0x02, 0x24, 0x8c, 0x00, 0x01, 0x95, 0x48, 0x8a,
+  0x00, 0x00, 0x20, 0x80, 0x00, 0x03, 0x22, 0x45, 0x10, 0x02, 0x80, 0x00, 0x00, 0x10, 0x88, 0x00,
+  0x03, 0x89, 0x28, 0x02, 0x10, 0x8c, 0x00, 0x03, 0x2a, 0x4a, 0x40, 0x20, 0x8c, 0x00, 0x03, 0x48,
+  0x92, 0x08, 0x80, 0x80, 0x00, 0x00, 0x40, 0x88, 0x00, 0x02, 0xa5, 0x49, 0x02, 0x8c, 0x00, 0x08,
+  0x01, 0x15, 0x2a, 0x08, 0x00, 0x00, 0x04, 0x00, 0x80, 0x88, 0x00, 0x02, 0xa4, 0xa4, 0x30, 0x8c,
+  0x00, 0x06, 0x02, 0x28, 0x89, 0x80, 0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x80, 0x80, 0x00, 0x01,
+  0xc2, 0x4a, 0x80, 0x00, 0x01, 0x08, 0x02, 0x89, 0x00, 0x01, 0x8a, 0xaa, 0x80, 0x00, 0x00, 0x08,
+  0x89, 0x00, 0x02, 0x04, 0xaa, 0x91, 0x8d, 0x00, 0x02, 0x0c, 0x12, 0x12, 0x80, 0x00, 0x01, 0x10,
+  0x08, 0x84, 0x00, 0x00, 0x01, 0x80, 0x00, 0x02, 0x05, 0x51, 0x55, 0x80, 0x00, 0x00, 0x10, 0x89,
+  0x00, 0x02, 0x04, 0xaa, 0xaa, 0x80, 0x00, 0x00, 0x10, 0x89, 0x00, 0x02, 0x01, 0x54, 0x82, 0x80,
+  0x00, 0x00, 0x20, 0x8a, 0x00, 0x01, 0x92, 0xaa, 0x80, 0x00, 0x01, 0x20, 0x20, 0x84, 0x00, 0x00,
+  0x0c, 0x80, 0x00, 0x02, 0x01, 0x48, 0xaa, 0x81, 0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x18, 0x80,
+  0x00, 0x02, 0x02, 0x95, 0x09, 0x80, 0x00, 0x00, 0x20, 0x85, 0x00, 0x00, 0xe8, 0x81, 0x00, 0x02,
+  0xaa, 0x51, 0x40, 0x88, 0x00, 0x00, 0xa8, 0x81, 0x00, 0x02, 0x42, 0xaa, 0x20, 0x87, 0x00, 0x01,
+  0x07, 0x68, 0x80, 0x00, 0x03, 0x01, 0x55, 0x44, 0x10, 0x87, 0x00, 0x01, 0x05, 0xa8, 0x80, 0x00,
+  0x03, 0x01, 0x11, 0x00, 0x08, 0x87, 0x00, 0x01, 0x3a, 0xd4, 0x81, 0x00, 0x05, 0x40, 0x00, 0x04,
+  0x00, 0x00, 0x40, 0x84, 0x00, 0x01, 0x16, 0xb0, 0x86, 0x00, 0x01, 0x40, 0x80, 0x83, 0x00, 0x01,
+  0xeb, 0x50, 0x82, 0x00, 0x01, 0x10, 0x01, 0x80, 0x00, 0x00, 0x80, 0x83, 0x00, 0x01, 0xad, 0x60,
+  0x81, 0x00, 0x05, 0x02, 0xa0, 0x20, 0x00, 0x00, 0x40, 0x83, 0x00, 0x02, 0x07, 0x6b, 0x50, 0x81,
+  0x00, 0x06, 0x0a, 0xa0, 0x00, 0x40, 0x0a, 0x00, 0x80, 0x82, 0x00, 0x02, 0x02, 0xd6, 0xc0, 0x81,
+  0x00, 0x05, 0x05, 0x40, 0x28, 0x40, 0x5f, 0x84, 0x83, 0x00, 0x02, 0x1d, 0x6a, 0x80, 0x81, 0x00,
+  0x05, 0x2b, 0x40, 0x02, 0x02, 0x7f, 0xc0, 0x83, 0x00, 0x01, 0x2b, 0x5d, 0x82, 0x00, 0x05, 0x2a,
+  0x80, 0x28, 0x18, 0x0f, 0x84, 0x83, 0x00, 0x01, 0x55, 0xaa, 0x82, 0x00, 0x06, 0x15, 0x40, 0x05,
+  0x00, 0x03, 0xe0, 0x40, 0x82, 0x00, 0x01, 0x5b, 0x58, 0x82, 0x00, 0x05, 0x02, 0x80, 0x20, 0x00,
+  0x00, 0x84, 0x82, 0x00, 0x02, 0x01, 0xad, 0xa8, 0x82, 0x00, 0x06, 0x0a, 0x00, 0x0a, 0x80, 0x00,
+  0x00, 0x20, 0x81, 0x00, 0x02, 0x01, 0x75, 0x60, 0x82, 0x00, 0x06, 0x05, 0x00, 0x14, 0x00, 0x00,
+  0x02, 0x20, 0x81, 0x00, 0x02, 0x06, 0xad, 0xa0, 0x82, 0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x84,
+  0x00, 0x03, 0x05, 0xda, 0x80, 0x20, 0x83, 0x00, 0x04, 0x09, 0x00, 0x00, 0x12, 0x10, 0x81, 0x00,
+  0x03, 0x1a, 0xad, 0x00, 0xa0, 0x81, 0x00, 0x05, 0x02, 0x00, 0x02, 0x40, 0x00, 0x10, 0x82, 0x00,
+  0x03, 0x15, 0xb5, 0x00, 0x90, 0x83, 0x00, 0x04, 0x04, 0x80, 0x00, 0x02, 0x08, 0x81, 0x00, 0x03,
+  0x2d, 0x5a, 0x02, 0x80, 0x83, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x04, 0x81, 0x00, 0x03, 0x5b,
+  0x68, 0x05, 0x50, 0x83, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0c, 0x81, 0x00, 0x03, 0x55, 0xb0,
+  0x0a, 0x80, 0x83, 0x00, 0x04, 0x10, 0x40, 0x00, 0x09, 0x02, 0x81, 0x00, 0x03, 0xb6, 0xa0, 0x15,
+  0x40, 0x82, 0x00, 0x05, 0x40, 0x00, 0x80, 0x00, 0x08, 0x07, 0x80, 0x00, 0x03, 0x01, 0x5b, 0x40,
+  0x29, 0x84, 0x00, 0x04, 0x10, 0x00, 0x20, 0x00, 0x81, 0x80, 0x00, 0x04, 0x01, 0x6a, 0xa0, 0x2a,
+  0xc0, 0x84, 0x00, 0x0a, 0x08, 0x00, 0x00, 0x87, 0x80, 0x00, 0x00, 0x03, 0x5b, 0x80, 0xd5, 0x83,
+  0x00, 0x0d, 0xe0, 0x02, 0x00, 0x00, 0x04, 0x00, 0xc0, 0x00, 0x00, 0x02, 0xb5, 0x01, 0x4a, 0xa0,
+  0x83, 0x00, 0x0c, 0x48, 0x04, 0x10, 0x04, 0x81, 0xa0, 0x00, 0x00, 0x07, 0x6d, 0x02, 0xa9, 0x20,
+  0x82, 0x00, 0x01, 0x01, 0x80, 0x80, 0x00, 0x07, 0x80, 0xe0, 0x00, 0x00, 0x0a, 0xaa, 0x02, 0x55,
+  0x84, 0x00, 0x0b, 0x20, 0x08, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x00, 0x0d, 0xdc, 0x05, 0x54, 0x84,
+  0x00, 0x0b, 0x40, 0x00, 0x50, 0x02, 0x00, 0x78, 0x00, 0x00, 0x0a, 0xb4, 0x0a, 0xaa, 0x84, 0x00,
+  0x0b, 0x20, 0x00, 0x00, 0x02, 0x00, 0xbc, 0x00, 0x00, 0x1d, 0x50, 0x15, 0x48, 0x84, 0x00, 0x0b,
+  0x48, 0x00, 0xa0, 0x01, 0x00, 0x34, 0x00, 0x00, 0x2a, 0xe8, 0x0a, 0x50, 0x84, 0x00, 0x0b, 0x50,
+  0x00, 0x10, 0x80, 0x00, 0x6e, 0x00, 0x00, 0x2e, 0xa0, 0x32, 0xa0, 0x84, 0x00, 0x0b, 0x24, 0x00,
+  0xa0, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x15, 0x60, 0x4a, 0xa0, 0x84, 0x00, 0x0c, 0x90, 0x00, 0x28,
+  0x00, 0x00, 0x35, 0x80, 0x00, 0x76, 0xa0, 0x55, 0x40, 0x40, 0x83, 0x00, 0x0c, 0x20, 0x00, 0x40,
+  0x00, 0x80, 0x0f, 0xc0, 0x00, 0x2b, 0x40, 0xaa, 0x80, 0x80, 0x83, 0x00, 0x0a, 0x48, 0x00, 0x28,
+  0x08, 0x84, 0x1a, 0xe0, 0x00, 0x5a, 0x80, 0xaa, 0x85, 0x00, 0x0c, 0x10, 0x00, 0x90, 0x00, 0x80,
+  0x0f, 0xe0, 0x00, 0xb5, 0x81, 0x55, 0x01, 0xc0, 0x83, 0x00, 0x0b, 0x44, 0x00, 0x24, 0x08, 0x00,
+  0x06, 0xb0, 0x00, 0xae, 0x02, 0xaa, 0x02, 0x84, 0x00, 0x0c, 0x20, 0x40, 0x10, 0x00, 0x40, 0x0b,
+  0xf8, 0x00, 0xb5, 0x01, 0x24, 0x03, 0x80, 0x86, 0x00, 0x08, 0x08, 0x01, 0x03, 0x5c, 0x00, 0xd6,
+  0x05, 0x54, 0x0c, 0x85, 0x00, 0x0b, 0x80, 0x08, 0x04, 0x48, 0x05, 0xf4, 0x01, 0x5a, 0x02, 0xa8,
+  0x0b, 0x80, 0x85, 0x00, 0x09, 0x80, 0x00, 0x40, 0x01, 0xfe, 0x00, 0xd4, 0x0a, 0xa0, 0x16, 0x85,
+  0x00, 0x0b, 0x80, 0x09, 0x08, 0x20, 0x01, 0x5b, 0x01, 0x5a, 0x0a, 0xa8, 0x1d, 0x40, 0x88, 0x00,
+  0x06, 0x81, 0xf7, 0x81, 0xb4, 0x0a, 0x50, 0x2b, 0x84, 0x00, 0x0c, 0x40, 0x10, 0x40, 0x00, 0x24,
+  0x08, 0x5e, 0xc1, 0x68, 0x15, 0x40, 0x5e, 0xc0, 0x84, 0x00, 0x0b, 0x82, 0x01, 0x00, 0x10, 0x00,
+  0xfb, 0xc1, 0x58, 0x0a, 0xa0, 0x6a, 0x80, 0x87, 0x00, 0x08, 0x10, 0x00, 0x2f, 0x61, 0x68, 0x15,
+  0x40, 0xad, 0x40, 0x84, 0x00, 0x0a, 0x0a, 0x40, 0x00, 0x11, 0x20, 0x7d, 0xd1, 0xb0, 0x2a, 0x80,
+  0x76, 0x85, 0x00, 0x0a, 0x01, 0x00, 0x40, 0x08, 0x02, 0x17, 0xfc, 0xa8, 0x14, 0x80, 0xac, 0x85,
+  0x00, 0x00, 0x04, 0x81, 0x00, 0x05, 0x1e, 0xfd, 0x68, 0x2a, 0x81, 0xf4, 0x85, 0x00, 0x0b, 0x09,
+  0x40, 0x00, 0x08, 0x88, 0x0b, 0xd6, 0x50, 0x55, 0x01, 0x58, 0x40, 0x84, 0x00, 0x0a, 0x02, 0x00,
+  0x00, 0x02, 0x01, 0x2e, 0xff, 0x68, 0x2a, 0x82, 0xd4, 0x85, 0x00, 0x0a, 0x01, 0x40, 0x00, 0x04,
+  0x20, 0x03, 0xed, 0x90, 0x52, 0x03, 0xb8, 0x85, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x04, 0x04, 0x06,
+  0xbf, 0xd0, 0x2a, 0x02, 0xd0, 0x40, 0x84, 0x00, 0x0a, 0x02, 0xa0, 0x00, 0x02, 0x00, 0x21, 0xf6,
+  0xe0, 0x2a, 0x07, 0x50, 0x86, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x81, 0x03, 0xff, 0xe0, 0x54, 0x05,
+  0xe0, 0x40, 0x88, 0x00, 0x06, 0x08, 0x00, 0xad, 0xb8, 0x2a, 0x06, 0xa0, 0x84, 0x00, 0x0b, 0x10,
+  0x09, 0x40, 0x00, 0x01, 0x00, 0x48, 0xff, 0xf8, 0x54, 0x0b, 0x40, 0x86, 0x00, 0x09, 0x20, 0x20,
+  0x01, 0x22, 0x00, 0x3b, 0x6c, 0x24, 0x06, 0xc0, 0x87, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x02, 0x6f,
+  0xfe, 0x54, 0x1d, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x80, 0x00, 0x0b, 0x10, 0x08, 0x00, 0x20, 0x00,
+  0x88, 0x90, 0x1d, 0xb7, 0x14, 0x0b, 0x40, 0x80, 0x00, 0x0f, 0x74, 0x08, 0x00, 0x00, 0x20, 0x00,
+  0x40, 0x20, 0x00, 0x80, 0x00, 0xbf, 0xfd, 0x28, 0x1d, 0x80, 0x80, 0x00, 0x01, 0x3f, 0xe0, 0x80,
+  0x00, 0x0a, 0x04, 0x04, 0x50, 0x00, 0x4d, 0x04, 0x0b, 0x6f, 0x84, 0x16, 0x80, 0x80, 0x00, 0x0e,
+  0x0a, 0x80, 0x00, 0x00, 0x01, 0x20, 0x00, 0x50, 0x00, 0x48, 0x40, 0x0f, 0xfb, 0xc8, 0x1b, 0x85,
+  0x00, 0x0a, 0x40, 0x00, 0x00, 0x30, 0x00, 0x04, 0x11, 0x23, 0x6f, 0x64, 0x2d, 0x85, 0x00, 0x0c,
+  0x05, 0x42, 0x04, 0xd8, 0x00, 0x24, 0x00, 0x0d, 0xff, 0xf0, 0x1b, 0x00, 0x20, 0x86, 0x00, 0x07,
+  0xa8, 0x00, 0x24, 0x84, 0x03, 0xda, 0xd8, 0x2d, 0x85, 0x00, 0x0a, 0x02, 0xa0, 0x00, 0x68, 0x00,
+  0x00, 0x21, 0x01, 0xff, 0xfc, 0x16, 0x86, 0x00, 0x09, 0x48, 0x00, 0xac, 0x00, 0x12, 0x00, 0x11,
+  0x5b, 0xb4, 0x1b, 0x85, 0x00, 0x0a, 0x05, 0x10, 0x00, 0xb4, 0x00, 0x10, 0x10, 0x84, 0xfe, 0xfe,
+  0x16, 0x86, 0x00, 0x09, 0xa0, 0x00, 0x56, 0x00, 0x00, 0x42, 0x00, 0x77, 0xed, 0x0a, 0x85, 0x00,
+  0x0a, 0x02, 0x48, 0x00, 0xb5, 0x00, 0x0a, 0x00, 0x42, 0x7d, 0xbf, 0x9e, 0x86, 0x00, 0x09, 0x90,
+  0x00, 0x6d, 0x00, 0x00, 0x04, 0x08, 0x2f, 0xf6, 0xc5, 0x85, 0x00, 0x0c, 0x01, 0x24, 0x00, 0x2b,
+  0x00, 0x04, 0xa1, 0x00, 0xbb, 0xff, 0xe6, 0x00, 0x40, 0x84, 0x00, 0x09, 0x48, 0x00, 0x36, 0x80,
+  0x04, 0x00, 0x24, 0x0f, 0xad, 0xb1, 0x85, 0x00, 0x0a, 0x02, 0x22, 0x00, 0x1a, 0x80, 0x02, 0x10,
+  0x00, 0x1b, 0xff, 0xea, 0x86, 0x00, 0x09, 0x88, 0x00, 0x15, 0xc0, 0x02, 0x45, 0x42, 0x47, 0xbb,
+  0x79, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
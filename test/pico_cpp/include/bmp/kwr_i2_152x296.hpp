@@ -0,0 +1,741 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "rawdisp/asset_desc.hpp"
+
+// 152x296px, Indexed2
+// MSB First, Horizontal Packing, Horizontal Adressing
+// 11248 Bytes
+const uint8_t kwr_i2_152x296[] = {
+  0x66, 0x59, 0x96, 0x59, 0x55, 0x55, 0x55, 0x96, 0x65, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x96,
+  0x65, 0x99, 0x66, 0x59, 0x55, 0x55, 0x55, 0x96, 0x65, 0x99, 0x66, 0x55, 0x55, 0x55, 0x55, 0x96,
+  0x65, 0x99, 0x66, 0x59, 0x55, 0x55, 0x65, 0x99, 0x66, 0x65, 0x55, 0x55, 0x55, 0x59, 0x96, 0x55,
+  0x55, 0x59, 0x55, 0x55, 0x55, 0x59, 0x96, 0x65, 0x99, 0x65, 0x55, 0x55, 0x55, 0x59, 0x96, 0x65,
+  0x96, 0x55, 0x55, 0x55, 0x55, 0x59, 0x96, 0x65, 0x99, 0x65, 0x55, 0x55, 0x66, 0x59, 0x95, 0x95,
+  0x55, 0x55, 0x56, 0x65, 0x99, 0x55, 0x55, 0x65, 0x55, 0x55, 0x56, 0x65, 0x66, 0x59, 0x96, 0x55,
+  0x55, 0x55, 0x55, 0x95, 0x99, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x59, 0x96, 0x56,
+  0x55, 0x55, 0x59, 0x66, 0x59, 0x55, 0x65, 0x65, 0x95, 0x56, 0x56, 0x55, 0x55, 0x55, 0x65, 0x65,
+  0x95, 0x55, 0x99, 0x66, 0x59, 0x65, 0x59, 0x59, 0x65, 0x56, 0x59, 0x96, 0x59, 0x55, 0x55, 0x55,
+  0x65, 0x56, 0x65, 0x99, 0x65, 0x95, 0x55, 0x95, 0x65, 0x95, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x65, 0x99, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x59,
+  0x59, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x95, 0x95,
+  0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x55, 0x56, 0x55,
+  0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x56, 0x59, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x65, 0x99, 0x95, 0x55, 0x55, 0x55, 0x55, 0x56, 0x65, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x56, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x99, 0x96, 0x55, 0x55, 0x55, 0x55, 0x96, 0x66,
+  0x66, 0x55, 0x55, 0x55, 0x55, 0x59, 0x96, 0x59, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x65,
+  0x95, 0x95, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x59, 0x95, 0x55, 0x55, 0x55, 0x56, 0x56, 0x59,
+  0x56, 0x55, 0x55, 0x66, 0x65, 0x96, 0x65, 0x95, 0x95, 0x55, 0x55, 0x56, 0x65, 0x99, 0x95, 0x95,
+  0x55, 0x56, 0x55, 0x99, 0xa6, 0x59, 0x66, 0x55, 0x65, 0x65, 0x55, 0x55, 0x65, 0x99, 0x99, 0x55,
+  0x55, 0x56, 0x55, 0x59, 0x66, 0x66, 0x55, 0x55, 0x55, 0x65, 0x96, 0x59, 0x96, 0x55, 0x55, 0x55,
+  0x55, 0x99, 0x59, 0x99, 0x66, 0x65, 0x55, 0x55, 0x55, 0x56, 0x59, 0x99, 0x99, 0x59, 0x55, 0x55,
+  0x55, 0x55, 0x56, 0x65, 0x96, 0x65, 0x95, 0x55, 0x55, 0x65, 0x99, 0x65, 0x55, 0x55, 0x56, 0x59,
+  0x66, 0x65, 0x99, 0x99, 0x55, 0x55, 0x55, 0x66, 0x66, 0x59, 0x99, 0x56, 0x55, 0x55, 0x56, 0x66,
+  0x65, 0x96, 0x59, 0x95, 0x55, 0x55, 0x55, 0x55, 0x99, 0x66, 0x65, 0x95, 0x55, 0x55, 0x56, 0x59,
+  0x96, 0x59, 0x55, 0x56, 0x55, 0x99, 0x99, 0x66, 0x59, 0x65, 0x55, 0x55, 0x55, 0x95, 0x99, 0x65,
+  0x55, 0xa5, 0x56, 0x55, 0x55, 0x65, 0x96, 0x66, 0x65, 0x99, 0x55, 0x55, 0x55, 0x55, 0x59, 0x96,
+  0x59, 0x99, 0x56, 0x55, 0x55, 0x99, 0x66, 0x66, 0x55, 0x55, 0x59, 0x65, 0x96, 0x59, 0x96, 0x59,
+  0x55, 0x55, 0x56, 0x66, 0x59, 0x95, 0x56, 0x59, 0x55, 0x55, 0x59, 0x99, 0x66, 0x59, 0x99, 0x96,
+  0x55, 0x55, 0x55, 0x56, 0x99, 0x99, 0x99, 0x66, 0x55, 0x55, 0x55, 0x66, 0x65, 0x95, 0x55, 0x55,
+  0x55, 0x99, 0x99, 0x99, 0x66, 0x66, 0x55, 0x55, 0x59, 0x66, 0x65, 0x95, 0x55, 0x66, 0x55, 0x55,
+  0x56, 0x59, 0x99, 0x66, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x96, 0x59, 0x65, 0x99, 0x55, 0x55,
+  0x56, 0x65, 0x96, 0x66, 0x55, 0x55, 0x66, 0x59, 0x66, 0x66, 0x65, 0x95, 0x55, 0x55, 0x56, 0x59,
+  0x66, 0x55, 0x55, 0x59, 0x55, 0x55, 0x59, 0x96, 0x59, 0x96, 0x66, 0x66, 0x55, 0x55, 0x55, 0x59,
+  0x65, 0x96, 0x59, 0x96, 0x55, 0x55, 0x66, 0x59, 0x66, 0x59, 0x95, 0x55, 0x56, 0x65, 0x96, 0x56,
+  0x59, 0x99, 0x95, 0x55, 0x56, 0x66, 0x65, 0x95, 0x15, 0x65, 0x95, 0x55, 0x55, 0x66, 0x66, 0x59,
+  0x99, 0x99, 0x65, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x59, 0x95, 0x55, 0x55, 0x99, 0x99, 0x99,
+  0x55, 0x55, 0x65, 0x99, 0x99, 0x99, 0x96, 0x66, 0x55, 0x55, 0x65, 0x96, 0x59, 0x95, 0x85, 0x59,
+  0x55, 0x59, 0x66, 0x65, 0x96, 0x65, 0x65, 0x66, 0x55, 0x55, 0x55, 0x99, 0x96, 0x59, 0x96, 0x65,
+  0x55, 0x55, 0x59, 0x66, 0x56, 0x59, 0x95, 0x55, 0x56, 0x65, 0x96, 0x59, 0x66, 0x59, 0x55, 0x55,
+  0x56, 0x59, 0x66, 0x55, 0xa5, 0x55, 0x95, 0x55, 0x59, 0x96, 0x59, 0x99, 0x99, 0x96, 0x55, 0x55,
+  0x55, 0x66, 0x59, 0x66, 0x59, 0x66, 0x65, 0x55, 0x56, 0x65, 0x99, 0x99, 0x55, 0x55, 0x65, 0x99,
+  0x65, 0x99, 0x99, 0x96, 0x55, 0x55, 0x66, 0x66, 0x65, 0x95, 0x49, 0x56, 0x55, 0x55, 0x56, 0x66,
+  0x65, 0x66, 0x59, 0x99, 0x65, 0x55, 0x55, 0x96, 0x66, 0x65, 0x99, 0x96, 0x55, 0x55, 0x65, 0x99,
+  0x96, 0x59, 0x55, 0x55, 0x56, 0x56, 0x66, 0x65, 0x96, 0x59, 0x95, 0x55, 0x59, 0x65, 0x96, 0x65,
+  0x62, 0x55, 0x55, 0x55, 0x59, 0x65, 0x99, 0x99, 0x65, 0x96, 0x55, 0x55, 0x56, 0x66, 0x59, 0x96,
+  0x66, 0x59, 0x95, 0x55, 0x59, 0x96, 0x59, 0x99, 0x55, 0x55, 0x66, 0x66, 0x59, 0x66, 0x59, 0x99,
+  0x55, 0x55, 0x56, 0x66, 0x65, 0x95, 0x4a, 0x55, 0x55, 0x55, 0x56, 0x59, 0x66, 0x56, 0x66, 0x65,
+  0x55, 0x55, 0x55, 0x96, 0x65, 0x99, 0x59, 0x99, 0x55, 0x55, 0x55, 0x99, 0x99, 0x66, 0x55, 0x55,
+  0x59, 0x66, 0x65, 0x99, 0x65, 0x96, 0x55, 0x55, 0x55, 0x96, 0x59, 0x95, 0x62, 0xa5, 0x55, 0x55,
+  0x56, 0x66, 0x65, 0x99, 0x96, 0x59, 0x95, 0x55, 0x56, 0x59, 0x96, 0x65, 0xa5, 0x96, 0x55, 0x55,
+  0x59, 0x65, 0x96, 0x65, 0x55, 0x55, 0x55, 0x96, 0x66, 0x59, 0x99, 0x65, 0x55, 0x55, 0x59, 0x66,
+  0x66, 0x65, 0x5a, 0x85, 0x55, 0x55, 0x55, 0x99, 0x66, 0x65, 0x99, 0x95, 0x55, 0x55, 0x55, 0x96,
+  0x65, 0x99, 0x59, 0x65, 0x55, 0x55, 0x55, 0x99, 0x65, 0x99, 0x55, 0x55, 0x55, 0x99, 0x96, 0x66,
+  0x59, 0x99, 0x55, 0x55, 0x55, 0x96, 0x59, 0x59, 0x52, 0xaa, 0x55, 0x55, 0x55, 0x96, 0x65, 0x96,
+  0x59, 0x66, 0x55, 0x55, 0x59, 0x66, 0x59, 0x96, 0x66, 0x66, 0x55, 0x55, 0x55, 0x96, 0x66, 0x59,
+  0x55, 0x55, 0x55, 0x65, 0x65, 0x96, 0x65, 0x95, 0x55, 0x55, 0x55, 0x99, 0x96, 0x65, 0x56, 0xaa,
+  0x95, 0x55, 0x55, 0x65, 0x99, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x96, 0x65, 0x99, 0x96, 0x55,
+  0x55, 0x55, 0x55, 0x66, 0x59, 0x96, 0x55, 0x55, 0x55, 0x96, 0x66, 0x59, 0x66, 0x55, 0x55, 0x55,
+  0x55, 0x65, 0x99, 0x99, 0x54, 0xaa, 0x25, 0x55, 0x55, 0x59, 0x96, 0x66, 0x59, 0x65, 0x55, 0x55,
+  0x55, 0x59, 0x66, 0x59, 0x66, 0x65, 0x55, 0x55, 0x55, 0x59, 0x65, 0x99, 0x55, 0x55, 0x55, 0x59,
+  0x99, 0x99, 0x96, 0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x66, 0x56, 0xaa, 0xa1, 0x55, 0x55, 0x56,
+  0x66, 0x59, 0x96, 0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x96, 0x65, 0x55, 0x55, 0x55, 0x55, 0x56,
+  0x66, 0x59, 0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x65,
+  0x55, 0xaa, 0xaa, 0x95, 0x55, 0x55, 0x59, 0x66, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x99,
+  0x96, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x99, 0x55, 0x55, 0x55, 0x55, 0x99, 0x65, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x95, 0x66, 0x55, 0x2a, 0xaa, 0x89, 0x55, 0x55, 0x96, 0x55, 0x95, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x96, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x65, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x6a, 0x6a, 0xa8,
+  0x95, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x5a, 0xaa, 0xaa, 0x89, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xa9, 0xaa, 0xa8, 0xa5, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56,
+  0xaa, 0xa6, 0xaa, 0xa8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x59, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x65,
+  0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6a, 0xaa, 0xaa, 0xaa, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x66, 0x65, 0x55, 0x55, 0x55, 0x66, 0x59, 0x56, 0x55,
+  0x55, 0x55, 0x55, 0x56, 0x65, 0x99, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4a, 0x6a, 0x9a, 0xaa,
+  0xaa, 0xa9, 0xa9, 0x8a, 0x8a, 0xaa, 0xaa, 0x8a, 0x95, 0x55, 0x55, 0x55, 0x99, 0x99, 0x96, 0x55,
+  0x55, 0x55, 0x65, 0x99, 0x99, 0x55, 0x55, 0x55, 0x55, 0x55, 0x99, 0x96, 0x66, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x5a, 0xaa, 0xaa, 0x9a, 0xaa, 0xa8, 0x88, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xa9,
+  0x55, 0x55, 0x55, 0x96, 0x59, 0x55, 0x55, 0x55, 0x59, 0x65, 0x96, 0x55, 0x55, 0x55, 0x55, 0x66,
+  0x59, 0x66, 0x59, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a,
+  0xa9, 0xa9, 0xaa, 0x9a, 0xaa, 0x8a, 0xa9, 0x55, 0x56, 0x59, 0x99, 0x95, 0x55, 0x55, 0x99, 0x99,
+  0x99, 0x65, 0x55, 0x55, 0x55, 0x56, 0x65, 0x99, 0x66, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x66,
+  0x9a, 0x20, 0x8a, 0x99, 0x99, 0xa9, 0x9a, 0x9a, 0x99, 0xa9, 0x9a, 0x6a, 0xa8, 0xa9, 0x55, 0x66,
+  0x59, 0x65, 0x55, 0x55, 0x65, 0x96, 0x59, 0x95, 0x55, 0x55, 0x55, 0xa5, 0x99, 0x96, 0x65, 0x99,
+  0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x58, 0x8a, 0x99, 0xaa, 0xaa, 0x9a, 0xa9, 0xaa, 0xaa, 0x9a,
+  0xaa, 0xa6, 0xaa, 0xa2, 0x55, 0x55, 0x96, 0x59, 0x55, 0x55, 0x96, 0x65, 0x99, 0x65, 0x55, 0x55,
+  0x56, 0x56, 0x59, 0x66, 0x59, 0x95, 0x55, 0x55, 0x55, 0x99, 0x95, 0x55, 0x54, 0xaa, 0x6a, 0x99,
+  0x99, 0xaa, 0x9a, 0xa9, 0x99, 0xa9, 0xa6, 0x6a, 0x66, 0x6a, 0x25, 0x55, 0x66, 0x65, 0x55, 0x55,
+  0x65, 0x66, 0x56, 0x59, 0x55, 0x55, 0x55, 0x99, 0x96, 0x65, 0x96, 0x65, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x54, 0x8a, 0x66, 0xa6, 0xaa, 0xaa, 0x99, 0xa9, 0x9a, 0xaa, 0x9a, 0xaa, 0xa6, 0xaa, 0xa6,
+  0xa1, 0x55, 0x59, 0x96, 0x55, 0x55, 0x59, 0x99, 0x66, 0x65, 0x55, 0x55, 0x55, 0x59, 0x99, 0x96,
+  0x66, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4a, 0xaa, 0xaa, 0x69, 0x99, 0x99, 0xaa, 0x9a, 0xaa,
+  0x69, 0xaa, 0x66, 0x6a, 0x9a, 0x6a, 0xaa, 0x95, 0x56, 0x59, 0x55, 0x55, 0x96, 0x56, 0x65, 0x95,
+  0x55, 0x55, 0x56, 0x65, 0x96, 0x66, 0x59, 0x95, 0x55, 0x55, 0x55, 0x55, 0x54, 0xa9, 0x99, 0x99,
+  0xaa, 0xaa, 0xaa, 0x66, 0xa9, 0x9a, 0xa6, 0xa6, 0xaa, 0xa6, 0xa9, 0xa6, 0x6a, 0x25, 0x55, 0x65,
+  0x55, 0x55, 0x59, 0x66, 0x59, 0x66, 0x55, 0x55, 0x55, 0x66, 0x59, 0x59, 0x65, 0x99, 0x55, 0x55,
+  0x55, 0x55, 0x8a, 0xa6, 0x9a, 0x6a, 0xa9, 0xaa, 0xa6, 0xaa, 0x9a, 0xaa, 0x6a, 0x6a, 0x9a, 0x6a,
+  0x9a, 0xaa, 0xa6, 0xa2, 0x55, 0x56, 0x55, 0x55, 0x99, 0x96, 0x66, 0x55, 0x55, 0x55, 0x56, 0x59,
+  0x99, 0x99, 0x99, 0x65, 0x55, 0x55, 0x55, 0x88, 0xa9, 0x9a, 0x69, 0xaa, 0x22, 0x29, 0xa9, 0x99,
+  0xa9, 0x9a, 0xa6, 0xa6, 0xa9, 0xa6, 0xa9, 0x9a, 0x6a, 0x6a, 0x15, 0x59, 0x55, 0x55, 0x65, 0x65,
+  0x95, 0x99, 0x55, 0x55, 0x55, 0x65, 0x96, 0x59, 0x65, 0x95, 0x55, 0x55, 0x58, 0xaa, 0x66, 0x69,
+  0xaa, 0x82, 0xaa, 0x9a, 0xa6, 0xaa, 0x9a, 0xa6, 0x6a, 0x6a, 0x9a, 0xaa, 0x9a, 0xaa, 0xa6, 0xaa,
+  0xa9, 0x55, 0x55, 0x55, 0x59, 0x99, 0x66, 0x55, 0x55, 0x55, 0x55, 0x99, 0x65, 0x96, 0x55, 0x55,
+  0x55, 0x68, 0xa5, 0x56, 0x9a, 0x9a, 0x82, 0xaa, 0x69, 0xa9, 0x9a, 0x66, 0xa6, 0xaa, 0xa6, 0xa6,
+  0xa9, 0x99, 0xa9, 0x99, 0xaa, 0x66, 0xa1, 0x55, 0x55, 0x55, 0x99, 0x65, 0x99, 0x65, 0x55, 0x55,
+  0x55, 0x56, 0x66, 0x65, 0x55, 0x55, 0x58, 0x95, 0x55, 0x55, 0x69, 0xa0, 0xaa, 0xaa, 0x9a, 0x99,
+  0xa9, 0xa9, 0x9a, 0x66, 0x6a, 0xa9, 0x9a, 0xaa, 0x9a, 0xaa, 0xa6, 0xaa, 0x68, 0x95, 0x55, 0x55,
+  0x56, 0x59, 0x59, 0x95, 0x55, 0x55, 0x55, 0x99, 0x55, 0x55, 0x55, 0x58, 0xa5, 0x55, 0x55, 0x55,
+  0x58, 0x2a, 0xaa, 0x9a, 0xa6, 0x6a, 0x6a, 0x6a, 0xa9, 0xaa, 0x99, 0x9a, 0xa9, 0x9a, 0xa9, 0xa6,
+  0x9a, 0x6a, 0xa6, 0x85, 0x55, 0x55, 0x99, 0x96, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x52, 0x29, 0x55, 0x55, 0x55, 0x56, 0xa2, 0xaa, 0xaa, 0xa9, 0x9a, 0xa6, 0x99, 0xa6, 0x66, 0xa6,
+  0x6a, 0xaa, 0x66, 0xa9, 0x9a, 0xa9, 0xaa, 0xa6, 0x6a, 0xa9, 0x55, 0x55, 0x55, 0x99, 0x65, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0xa5, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x2a, 0x66, 0xa6, 0x66,
+  0x66, 0x69, 0xa6, 0x9a, 0x9a, 0x6a, 0x99, 0x9a, 0xaa, 0x6a, 0xa6, 0x6a, 0x9a, 0x6a, 0xa6, 0xa8,
+  0x55, 0x55, 0x66, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x62, 0x29, 0x59, 0x55, 0x55, 0x55,
+  0x5a, 0xa0, 0xa6, 0x99, 0x59, 0xa9, 0xa9, 0x9a, 0x69, 0xa6, 0x69, 0xa6, 0x6a, 0xa6, 0x66, 0xa6,
+  0x6a, 0xa6, 0xa6, 0xaa, 0x6a, 0x9a, 0x95, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x56, 0x80,
+  0xa6, 0x55, 0x55, 0x55, 0x55, 0x56, 0xaa, 0x8a, 0xa9, 0x95, 0x55, 0x5a, 0x66, 0x99, 0xa6, 0x9a,
+  0x9a, 0x6a, 0x99, 0xaa, 0xa9, 0xaa, 0xa8, 0x2a, 0x6a, 0x66, 0xa6, 0xaa, 0x85, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x54, 0x80, 0xaa, 0xaa, 0xaa, 0x65, 0x95, 0x55, 0x6a, 0xaa, 0x2a, 0x99, 0x99,
+  0x55, 0x55, 0x99, 0xa6, 0x99, 0xa6, 0x69, 0xa6, 0x6a, 0x99, 0x9a, 0x66, 0x66, 0x2a, 0xaa, 0xaa,
+  0x6a, 0x99, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0x8a, 0xaa, 0xaa, 0xaa, 0xa6, 0xa9, 0x99,
+  0x6a, 0xaa, 0xa2, 0xaa, 0xa6, 0x59, 0x55, 0x55, 0x56, 0x69, 0xa6, 0x69, 0xa6, 0x9a, 0x99, 0xa6,
+  0xa6, 0xaa, 0xaa, 0xa2, 0x66, 0x6a, 0xa6, 0xaa, 0xa8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8a, 0x28,
+  0x8a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0xa2, 0xa9, 0x99, 0xa5, 0x55, 0x55, 0x55, 0x66,
+  0x66, 0xa6, 0x9a, 0x69, 0xa6, 0x9a, 0x9a, 0x99, 0x99, 0x88, 0xaa, 0xa6, 0x6a, 0x99, 0x9a, 0x95,
+  0x55, 0x55, 0x55, 0x60, 0xa2, 0x02, 0xa2, 0x20, 0x00, 0x82, 0x22, 0x22, 0xaa, 0xaa, 0x2a, 0xa6,
+  0xaa, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xa9, 0x99, 0xa6, 0x99, 0x9a, 0x69, 0xa6, 0x6a, 0x6a, 0xaa,
+  0x99, 0xaa, 0xa6, 0x6a, 0xaa, 0x95, 0x55, 0x55, 0x56, 0x8a, 0x22, 0x95, 0x55, 0x56, 0x0a, 0x2a,
+  0x8a, 0xaa, 0xaa, 0xa8, 0x2a, 0xaa, 0x99, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x99, 0x9a, 0x66, 0x69,
+  0xa9, 0xa6, 0x9a, 0xa6, 0xa6, 0x68, 0xaa, 0x99, 0x9a, 0xaa, 0x99, 0x89, 0x55, 0x55, 0x52, 0x2a,
+  0x25, 0x55, 0x55, 0x62, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa, 0xa5, 0x55, 0x59, 0x55,
+  0x56, 0xa9, 0x56, 0x66, 0x9a, 0x66, 0x66, 0x9a, 0x69, 0x9a, 0x6a, 0xa2, 0xa6, 0xaa, 0xa9, 0x99,
+  0xaa, 0xa9, 0x55, 0x55, 0x88, 0xa8, 0x15, 0x55, 0x55, 0x22, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2,
+  0xaa, 0xaa, 0x66, 0x55, 0x95, 0x55, 0x56, 0x65, 0x55, 0x69, 0x99, 0x9a, 0x9a, 0x69, 0x99, 0xa6,
+  0x99, 0x9a, 0x2a, 0x66, 0x9a, 0xaa, 0xaa, 0x68, 0x55, 0x56, 0x2a, 0x82, 0x55, 0x55, 0x58, 0xaa,
+  0xa2, 0xa2, 0xaa, 0xaa, 0xaa, 0x82, 0xaa, 0xaa, 0xa9, 0xa6, 0x65, 0x55, 0xa9, 0xa5, 0x56, 0x96,
+  0x69, 0xa6, 0x66, 0xa6, 0xaa, 0x69, 0xaa, 0x68, 0x9a, 0xaa, 0x69, 0xa6, 0x66, 0xaa, 0x55, 0x58,
+  0xa8, 0x89, 0x55, 0x55, 0x42, 0xa2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xa6, 0x9a, 0x9a,
+  0x99, 0x56, 0x66, 0xa5, 0x56, 0x55, 0x66, 0x66, 0xa6, 0x69, 0x99, 0xa6, 0x99, 0xa6, 0x26, 0x66,
+  0xaa, 0x6a, 0xaa, 0xa6, 0x55, 0x48, 0x8a, 0x25, 0x55, 0x55, 0x2a, 0x2a, 0x28, 0xa8, 0xa2, 0xaa,
+  0xa8, 0x2a, 0xaa, 0xaa, 0x69, 0xa9, 0x9a, 0xaa, 0x6a, 0x95, 0x59, 0x55, 0x56, 0x6a, 0x69, 0xaa,
+  0x66, 0x9a, 0x6a, 0x9a, 0x2a, 0xaa, 0x6a, 0xa6, 0x9a, 0x6a, 0x55, 0x8a, 0xa8, 0x85, 0x55, 0x58,
+  0xa2, 0xa2, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xa2, 0xaa, 0xaa, 0xa6, 0xa6, 0x66, 0xa8, 0x55,
+  0x69, 0x55, 0x55, 0x9a, 0x99, 0x9a, 0x9a, 0x69, 0xa6, 0x6a, 0x2a, 0x66, 0xa6, 0x6a, 0xaa, 0xaa,
+  0x56, 0x28, 0x88, 0x95, 0x55, 0x42, 0x2a, 0x2a, 0x22, 0x8a, 0xaa, 0x2a, 0xa0, 0xaa, 0x0a, 0x69,
+  0xa6, 0x9a, 0x6a, 0x6a, 0xaa, 0x95, 0xa5, 0x55, 0x55, 0x52, 0x66, 0x9a, 0x66, 0x66, 0x9a, 0x99,
+  0x26, 0xa9, 0xaa, 0xa6, 0x66, 0x9a, 0x58, 0x8a, 0x28, 0x15, 0x55, 0x4a, 0x22, 0xa2, 0xaa, 0xaa,
+  0x22, 0xa8, 0xa2, 0xa8, 0x2a, 0xaa, 0xaa, 0xaa, 0xa6, 0xaa, 0xa2, 0x6a, 0xa9, 0x55, 0x55, 0x6a,
+  0x66, 0x6a, 0xa6, 0x9a, 0x66, 0x6a, 0xaa, 0x9a, 0x9a, 0x6a, 0xa9, 0xaa, 0x52, 0xa2, 0x88, 0x55,
+  0x54, 0xa0, 0x8a, 0x2a, 0x22, 0x28, 0xaa, 0xaa, 0x82, 0xa0, 0xaa, 0xaa, 0xaa, 0x69, 0xaa, 0x8a,
+  0x5a, 0x9a, 0xa6, 0x55, 0x55, 0x6a, 0x55, 0x9a, 0x69, 0xa6, 0x9a, 0x66, 0xa6, 0x69, 0xa9, 0xa6,
+  0xaa, 0x99, 0x48, 0x88, 0xa2, 0x55, 0x58, 0x22, 0x28, 0xa2, 0xaa, 0x8a, 0xaa, 0x22, 0x0a, 0x80,
+  0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xa9, 0x6a, 0x9a, 0xa9, 0xaa, 0x55, 0x68, 0x55, 0x66, 0xa6, 0x66,
+  0x69, 0xa9, 0xaa, 0xaa, 0x9a, 0xaa, 0x66, 0xaa, 0x4a, 0xa8, 0x88, 0x55, 0x52, 0x82, 0xa2, 0x8a,
+  0x22, 0xa8, 0x88, 0x80, 0x0a, 0x22, 0xaa, 0xaa, 0xa6, 0x9a, 0xa2, 0x95, 0x69, 0xaa, 0x9a, 0x66,
+  0xa6, 0x8a, 0x55, 0x56, 0x99, 0xa6, 0x9a, 0x66, 0xa6, 0x66, 0xa9, 0xa6, 0xaa, 0x6a, 0x42, 0x22,
+  0xa2, 0x55, 0x4a, 0x0a, 0x28, 0xa8, 0xaa, 0x22, 0x00, 0x2a, 0x28, 0x22, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x0a, 0xa5, 0x4a, 0x62, 0xa9, 0xa9, 0x99, 0xaa, 0x95, 0x56, 0xa6, 0x9a, 0x69, 0x9a, 0xaa, 0xa9,
+  0x9a, 0x6a, 0x9a, 0xa6, 0x8a, 0x22, 0x22, 0x55, 0x22, 0x22, 0x8a, 0x22, 0x00, 0x00, 0xaa, 0xa2,
+  0x28, 0x8a, 0xaa, 0xaa, 0xaa, 0xa8, 0x80, 0x8a, 0x6a, 0xaa, 0x9a, 0x66, 0x9a, 0xaa, 0x95, 0x56,
+  0x95, 0x99, 0x9a, 0xa6, 0x26, 0x6a, 0xaa, 0xa6, 0xa9, 0xaa, 0x82, 0x28, 0xa0, 0x56, 0x28, 0x2a,
+  0x28, 0xa8, 0x80, 0xaa, 0x8a, 0x28, 0xa2, 0x8a, 0xaa, 0xaa, 0xaa, 0xaa, 0x69, 0x88, 0x29, 0x8a,
+  0xa6, 0x9a, 0x69, 0x26, 0x2a, 0x66, 0xa5, 0x66, 0x69, 0x69, 0xa9, 0xa6, 0x66, 0x6a, 0x9a, 0xaa,
+  0x4a, 0x8a, 0x22, 0x58, 0x80, 0x88, 0xa2, 0x00, 0x2a, 0x8a, 0x2a, 0x80, 0x82, 0x8a, 0xaa, 0xaa,
+  0xaa, 0x8a, 0xa5, 0x5a, 0x2a, 0xaa, 0xaa, 0x69, 0xa6, 0xa9, 0xa9, 0xa6, 0xa5, 0x55, 0x9a, 0x9a,
+  0xaa, 0x9a, 0xaa, 0xa6, 0xa9, 0x9a, 0xa2, 0x22, 0x22, 0x50, 0xa2, 0x8a, 0x20, 0x10, 0xa8, 0xa2,
+  0xa2, 0x00, 0x0a, 0x2a, 0xaa, 0xa8, 0xa8, 0xaa, 0x55, 0x56, 0x2a, 0x8a, 0xa6, 0xaa, 0x6a, 0xa5,
+  0xaa, 0x6a, 0xa9, 0x55, 0x56, 0x69, 0xa9, 0xaa, 0x66, 0x6a, 0x6a, 0xaa, 0xa2, 0x28, 0xa0, 0xa2,
+  0x08, 0xa0, 0x05, 0x4a, 0x22, 0x8a, 0x20, 0x22, 0x2a, 0x2a, 0xaa, 0xaa, 0x0a, 0x69, 0x55, 0x55,
+  0x29, 0x8a, 0x6a, 0x66, 0xa8, 0xa5, 0x4a, 0x82, 0x02, 0xa5, 0x55, 0x9a, 0xaa, 0x66, 0xaa, 0xaa,
+  0xa6, 0xa6, 0x50, 0xa2, 0x22, 0x0a, 0x82, 0x20, 0x95, 0x22, 0x8a, 0x28, 0x80, 0x80, 0xaa, 0x2a,
+  0xa8, 0xa8, 0xa0, 0xa9, 0x55, 0x55, 0xaa, 0x8a, 0xa6, 0xaa, 0x9a, 0x95, 0x68, 0x28, 0x80, 0x2a,
+  0xa5, 0x69, 0xa9, 0xaa, 0xa6, 0x99, 0xaa, 0x6a, 0xa2, 0x22, 0x88, 0x08, 0x28, 0x05, 0x54, 0xa2,
+  0x28, 0xa0, 0x98, 0xa0, 0xa8, 0xaa, 0xa8, 0xaa, 0x8a, 0x85, 0x55, 0x55, 0x2a, 0x8a, 0xaa, 0x69,
+  0xaa, 0x55, 0x5a, 0xaa, 0xa8, 0x89, 0x99, 0x56, 0x26, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0x64, 0x28,
+  0x88, 0x0a, 0x20, 0x95, 0x58, 0x8a, 0xa2, 0x81, 0x62, 0x80, 0x88, 0x8a, 0xa2, 0x2a, 0x0a, 0xaa,
+  0x95, 0x55, 0xa8, 0xaa, 0xaa, 0xaa, 0xa2, 0x55, 0x54, 0xa6, 0xaa, 0xa8, 0xaa, 0xa9, 0xa9, 0xaa,
+  0xa6, 0x6a, 0xa6, 0x9a, 0x9a, 0x22, 0x28, 0x20, 0x09, 0x55, 0x62, 0x22, 0x28, 0x25, 0x4a, 0x22,
+  0xa8, 0xaa, 0x20, 0xa8, 0x82, 0x6a, 0xa9, 0x55, 0xaa, 0x8a, 0x9a, 0x69, 0xa9, 0x45, 0x56, 0xa9,
+  0xaa, 0x9a, 0x99, 0x9a, 0x95, 0x99, 0xaa, 0xa6, 0xaa, 0xaa, 0x6a, 0x0a, 0x22, 0x08, 0x25, 0x55,
+  0x48, 0xa2, 0x20, 0x56, 0x22, 0x82, 0xa8, 0x2a, 0x80, 0xa0, 0x2a, 0xa9, 0xa8, 0x55, 0x28, 0xaa,
+  0xaa, 0xaa, 0xa1, 0x69, 0x55, 0x9a, 0xa8, 0xa9, 0xaa, 0xa6, 0x29, 0x56, 0x69, 0xaa, 0xaa, 0x6a,
+  0xaa, 0x82, 0x22, 0x00, 0x95, 0x55, 0x0a, 0x28, 0x89, 0x54, 0xaa, 0x2a, 0x20, 0xa8, 0x02, 0x0a,
+  0xa2, 0x8a, 0x9a, 0x95, 0x6a, 0x52, 0xaa, 0xaa, 0xa9, 0x52, 0x95, 0xa9, 0xaa, 0xaa, 0x99, 0xa9,
+  0xaa, 0x99, 0xaa, 0x9a, 0xaa, 0xa9, 0xaa, 0x82, 0x28, 0x82, 0x56, 0x95, 0x22, 0x22, 0x05, 0x68,
+  0xa2, 0x8a, 0x08, 0x2a, 0x00, 0xa8, 0xa8, 0x10, 0x2a, 0xa5, 0x4a, 0x5a, 0xaa, 0xa6, 0x85, 0x52,
+  0xa5, 0x4a, 0x6a, 0x26, 0x6a, 0x9a, 0x29, 0xa6, 0x59, 0xaa, 0xa6, 0xaa, 0xaa, 0x98, 0x88, 0x81,
+  0x5a, 0x56, 0x28, 0x88, 0x95, 0x48, 0xaa, 0xa0, 0x88, 0xa2, 0x02, 0xaa, 0x82, 0xa6, 0x4a, 0xa9,
+  0x62, 0x5a, 0xa6, 0xaa, 0xa5, 0x6a, 0xaa, 0x5a, 0xaa, 0x8a, 0xa6, 0xa9, 0xaa, 0xaa, 0x9a, 0x6a,
+  0xaa, 0x9a, 0xaa, 0x56, 0x22, 0x09, 0x5a, 0x54, 0x88, 0x88, 0x55, 0xa2, 0x88, 0x80, 0x28, 0x28,
+  0x80, 0xaa, 0x86, 0x59, 0xa4, 0xa1, 0x62, 0x54, 0xaa, 0xaa, 0xa5, 0x54, 0xaa, 0xaa, 0xaa, 0x8a,
+  0x6a, 0x9a, 0x29, 0xa6, 0xa6, 0xaa, 0xaa, 0xaa, 0xa9, 0x55, 0x08, 0x81, 0x56, 0x58, 0x88, 0x82,
+  0x56, 0x0a, 0x28, 0x0a, 0x88, 0x20, 0x88, 0xa8, 0x89, 0xa6, 0x64, 0xaa, 0x52, 0x56, 0xaa, 0xaa,
+  0x95, 0x58, 0xa6, 0xa0, 0xa8, 0x0a, 0xa6, 0xaa, 0x2a, 0xaa, 0xaa, 0x9a, 0xaa, 0xaa, 0xa1, 0x55,
+  0x40, 0x28, 0x55, 0x52, 0x22, 0x29, 0x54, 0xa2, 0xa0, 0x82, 0x22, 0x20, 0x82, 0x2a, 0x19, 0x99,
+  0x8a, 0x4a, 0x5a, 0x55, 0x2a, 0xaa, 0x15, 0x6a, 0xaa, 0xaa, 0x8a, 0x8a, 0xaa, 0x69, 0xaa, 0x6a,
+  0x6a, 0xaa, 0xa9, 0xaa, 0xa5, 0x55, 0xa0, 0x80, 0x95, 0x52, 0x22, 0x25, 0x58, 0x8a, 0x08, 0x0a,
+  0x28, 0x02, 0x88, 0xa8, 0x65, 0x9a, 0x00, 0x22, 0x95, 0x55, 0xaa, 0xaa, 0x95, 0x8a, 0x8a, 0x9a,
+  0xaa, 0xa2, 0x9a, 0xaa, 0x26, 0xaa, 0xa9, 0xaa, 0xaa, 0xaa, 0x95, 0xa5, 0x48, 0x08, 0x05, 0x50,
+  0x88, 0x15, 0x58, 0xa2, 0x08, 0x88, 0x80, 0x20, 0x80, 0xa8, 0x95, 0x54, 0x00, 0x22, 0x16, 0x55,
+  0x62, 0xaa, 0x15, 0x28, 0x10, 0x8a, 0x69, 0x88, 0xaa, 0xaa, 0x2a, 0xa6, 0xaa, 0xaa, 0xa2, 0xaa,
+  0x55, 0xa5, 0x08, 0x20, 0x09, 0x62, 0x88, 0x55, 0x62, 0x20, 0x22, 0x0a, 0x00, 0x02, 0x80, 0xa9,
+  0x55, 0x6a, 0x02, 0x02, 0x15, 0x55, 0x5a, 0xaa, 0x56, 0x86, 0x66, 0x48, 0xaa, 0xa8, 0xaa, 0x6a,
+  0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x55, 0x95, 0x22, 0x26, 0x82, 0x62, 0x22, 0x55, 0x48, 0x88,
+  0x88, 0x08, 0x80, 0x80, 0x80, 0xa1, 0x55, 0x45, 0x88, 0x00, 0x95, 0x55, 0x58, 0xa8, 0x54, 0x19,
+  0x99, 0x99, 0x86, 0xa2, 0x2a, 0xa6, 0xaa, 0xaa, 0xa6, 0xaa, 0x8a, 0xaa, 0x55, 0x55, 0x28, 0x25,
+  0x40, 0x60, 0x81, 0x55, 0x48, 0x82, 0x28, 0xa0, 0x20, 0x88, 0x88, 0xa9, 0x55, 0x41, 0x42, 0x80,
+  0x15, 0x55, 0x56, 0x28, 0x58, 0x66, 0x66, 0x66, 0x4a, 0x62, 0xaa, 0xaa, 0x29, 0xaa, 0xaa, 0xaa,
+  0x8a, 0xaa, 0x55, 0x55, 0x82, 0x89, 0x54, 0x12, 0x21, 0x55, 0x88, 0x22, 0x20, 0x08, 0x80, 0x22,
+  0x20, 0x09, 0x55, 0x81, 0x62, 0x28, 0x55, 0x55, 0x55, 0xaa, 0x55, 0x55, 0x99, 0xa9, 0x98, 0xaa,
+  0x2a, 0xaa, 0xaa, 0xa9, 0xaa, 0xaa, 0x2a, 0xaa, 0x55, 0x55, 0x0a, 0x09, 0x55, 0x62, 0x09, 0x65,
+  0x20, 0x22, 0x20, 0x80, 0x88, 0x88, 0x22, 0x29, 0x55, 0x02, 0x28, 0x88, 0x55, 0x55, 0x55, 0x48,
+  0x56, 0x65, 0x58, 0x02, 0x99, 0x28, 0x8a, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x89, 0x55,
+  0x22, 0x21, 0x55, 0x60, 0x85, 0x55, 0x20, 0x88, 0x88, 0x82, 0x00, 0x88, 0x88, 0x01, 0x55, 0x8a,
+  0xa0, 0x08, 0x55, 0x55, 0x55, 0x62, 0x55, 0x55, 0x90, 0x00, 0x26, 0x6a, 0x8a, 0xaa, 0x2a, 0xaa,
+  0xaa, 0xa8, 0xaa, 0xaa, 0x56, 0x15, 0x88, 0x82, 0x55, 0x52, 0x05, 0xa5, 0x22, 0x22, 0x20, 0x08,
+  0x88, 0x20, 0x28, 0x25, 0x55, 0x22, 0xa2, 0x80, 0x95, 0x55, 0x55, 0x51, 0x55, 0x55, 0x14, 0x00,
+  0x09, 0x0a, 0x2a, 0xa8, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa, 0x55, 0x5a, 0x02, 0x28, 0x55, 0x50,
+  0x85, 0x65, 0x02, 0x22, 0x20, 0x22, 0x00, 0x20, 0xa2, 0x25, 0x55, 0x8a, 0x82, 0x88, 0x55, 0x55,
+  0x55, 0x5a, 0x55, 0x54, 0x26, 0x08, 0x0a, 0x59, 0x82, 0xa8, 0xaa, 0xaa, 0xaa, 0xa2, 0xaa, 0xaa,
+  0x55, 0x55, 0x62, 0x20, 0x95, 0x52, 0x05, 0x95, 0x22, 0x22, 0x20, 0x22, 0x0a, 0x02, 0x22, 0x15,
+  0x55, 0x8a, 0x22, 0x82, 0x95, 0x55, 0x55, 0x55, 0x55, 0x54, 0x16, 0x82, 0x01, 0x62, 0xa2, 0xa8,
+  0xaa, 0xaa, 0xaa, 0x82, 0xaa, 0xaa, 0x55, 0x55, 0x56, 0x82, 0x05, 0x50, 0x25, 0x55, 0x08, 0x88,
+  0x80, 0x08, 0x88, 0x02, 0x22, 0x2a, 0x55, 0x4a, 0x22, 0x88, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
+  0x04, 0x88, 0x8a, 0x56, 0xa2, 0xa8, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x58,
+  0x09, 0x58, 0x85, 0x55, 0x42, 0x22, 0x20, 0xa2, 0x02, 0x08, 0x88, 0x02, 0x55, 0x48, 0xa2, 0x88,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0xaa, 0x88, 0x81, 0x5a, 0x62, 0xa8, 0xaa, 0xaa, 0xa0, 0xaa,
+  0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x80, 0x54, 0x05, 0x55, 0x60, 0x88, 0x80, 0x22, 0x08, 0x22,
+  0x22, 0x29, 0x55, 0x60, 0xa8, 0x1a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0xaa, 0x8a, 0x22, 0x54,
+  0xa8, 0xa2, 0xaa, 0xaa, 0xa2, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x58, 0x14, 0x85, 0x55,
+  0x48, 0x82, 0x02, 0x22, 0x00, 0x22, 0x28, 0x25, 0x95, 0x52, 0x2a, 0xa5, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x48, 0xaa, 0x02, 0xa1, 0x54, 0xa8, 0xa2, 0xaa, 0xaa, 0x0a, 0xaa, 0xaa, 0xaa, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x68, 0x05, 0x55, 0x60, 0x88, 0x80, 0x88, 0x82, 0x22, 0x22, 0x16, 0x95, 0x58,
+  0x2a, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x42, 0x80, 0x00, 0xa9, 0x56, 0xaa, 0x22, 0xaa, 0xa0,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x01, 0x55, 0x52, 0x22, 0x02, 0x08,
+  0x00, 0x88, 0x88, 0xa5, 0x55, 0x56, 0x2a, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa0, 0x28, 0xa0,
+  0xa9, 0x54, 0xaa, 0x22, 0xaa, 0x8a, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x60, 0x55, 0x58, 0x82, 0x20, 0x88, 0x82, 0x22, 0x22, 0x25, 0x55, 0x55, 0x8a, 0x25, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x82, 0xa8, 0xa0, 0xa9, 0x56, 0xaa, 0x82, 0xa8, 0x08, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0xa5, 0x50, 0x00, 0x02, 0x20, 0x08, 0x88, 0x88, 0x25,
+  0x55, 0x55, 0x52, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x8a, 0xa2, 0xa2, 0x25, 0x54, 0xa8, 0x82,
+  0x82, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0x50, 0x00,
+  0x00, 0x88, 0x22, 0x22, 0x22, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4a,
+  0xa2, 0x82, 0x25, 0x56, 0xa8, 0x08, 0x08, 0xaa, 0xaa, 0xa8, 0xa8, 0xaa, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x98, 0x00, 0x00, 0x00, 0x00, 0x88, 0x82, 0x08, 0x16, 0x65, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x4a, 0xa0, 0x2a, 0x15, 0x5a, 0xa2, 0x00, 0xaa, 0xaa, 0x2a, 0xaa,
+  0xaa, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x40, 0x00, 0x00, 0x00, 0x02, 0x20, 0x88,
+  0x88, 0xa6, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4a, 0xaa, 0xa8, 0x55, 0x5a,
+  0xa0, 0x02, 0x2a, 0xa2, 0xaa, 0x8a, 0x8a, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x25, 0x65, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55,
+  0x55, 0x62, 0xaa, 0xaa, 0x55, 0x5a, 0xa2, 0x2a, 0xa2, 0xaa, 0x8a, 0xaa, 0xa8, 0xaa, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x82, 0x08, 0xa5, 0x56, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0xaa, 0x55, 0x55, 0x50, 0x20, 0x88, 0xaa, 0x28,
+  0xa8, 0x8a, 0x2a, 0x8a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x88, 0x88, 0x88, 0x15, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x22, 0x55,
+  0x55, 0x40, 0x02, 0xaa, 0x8a, 0xaa, 0xaa, 0xaa, 0xa2, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x08, 0x22, 0x20, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x99, 0x55, 0x55, 0x02, 0x22, 0x28, 0xaa, 0x88, 0xa2, 0x8a, 0x2a, 0xa2,
+  0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x22, 0x20, 0x88, 0x95,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x08, 0xaa, 0x8a,
+  0x88, 0xaa, 0x8a, 0xa8, 0xa8, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0x08, 0x22, 0x08, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x80, 0x02, 0x88, 0xa8, 0xaa, 0x28, 0xaa, 0x8a, 0x8a, 0x88, 0x55, 0x55, 0x55, 0x58,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x80, 0x82, 0x22, 0x25, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x80, 0x2a, 0x2a, 0x2a, 0x22, 0xa2, 0x88, 0xa8,
+  0xa8, 0xaa, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0x20, 0x08,
+  0x20, 0x85, 0x55, 0x55, 0x55, 0x56, 0xaa, 0x65, 0x55, 0x55, 0x55, 0x56, 0x66, 0x62, 0x8a, 0x88,
+  0xa2, 0x88, 0xaa, 0x28, 0xaa, 0x8a, 0x8a, 0x88, 0x55, 0x55, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x20, 0x80, 0x88, 0x88, 0x09, 0x55, 0x55, 0x55, 0x80, 0x89, 0x55, 0xa2, 0x95,
+  0x55, 0x59, 0x59, 0x0a, 0x08, 0xaa, 0x28, 0xaa, 0x22, 0xaa, 0x22, 0x28, 0xa8, 0x8a, 0x55, 0x55,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x88, 0x20, 0x89, 0x55, 0x55,
+  0x55, 0x8a, 0xaa, 0x22, 0x68, 0x8a, 0x55, 0x55, 0x90, 0xa8, 0x2a, 0x88, 0xa2, 0x88, 0xa8, 0x88,
+  0xaa, 0x8a, 0x22, 0x22, 0x55, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20,
+  0x02, 0x02, 0x08, 0x82, 0x55, 0x55, 0x55, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0x15, 0x55, 0x4a, 0x80,
+  0x88, 0x8a, 0x28, 0xa2, 0x8a, 0x2a, 0x22, 0x28, 0xa2, 0x8a, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x88, 0x88, 0x20, 0x55, 0x55, 0x55, 0x4a, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x25, 0x55, 0x2a, 0x88, 0xa2, 0x28, 0x88, 0x8a, 0x22, 0x88, 0xa2, 0x8a, 0x22, 0x22,
+  0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x08, 0x82, 0x08, 0x88,
+  0x95, 0x55, 0x55, 0x6a, 0x66, 0x66, 0x9a, 0xaa, 0x95, 0x54, 0xaa, 0x02, 0x28, 0x88, 0xa2, 0x88,
+  0xa2, 0x28, 0x8a, 0x28, 0x88, 0xa8, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x02, 0x08, 0x20, 0x20, 0x25, 0x55, 0x55, 0x5a, 0xaa, 0xa9, 0xa9, 0xaa, 0x95, 0x52,
+  0xa8, 0x08, 0x88, 0xa2, 0x88, 0x8a, 0x28, 0xa2, 0xa2, 0x22, 0x22, 0x22, 0x56, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x88, 0x82, 0x08, 0x05, 0x55, 0x55, 0x52,
+  0x69, 0xaa, 0x6a, 0x98, 0x55, 0x4a, 0xa0, 0x8a, 0x22, 0x22, 0x28, 0xa2, 0x22, 0x22, 0x28, 0x88,
+  0x8a, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x08, 0x20,
+  0x80, 0x20, 0x01, 0x55, 0x55, 0x5a, 0x9a, 0x66, 0x99, 0xaa, 0x55, 0x2a, 0xa0, 0x88, 0xa2, 0x8a,
+  0x22, 0x88, 0x8a, 0x28, 0x82, 0x22, 0x28, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x20, 0x00, 0x02, 0x08, 0x02, 0x20, 0x00, 0x55, 0x55, 0x56, 0xa9, 0xa9, 0xa9, 0xa9,
+  0x54, 0xaa, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x88, 0x80, 0x08, 0x88, 0x88, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x20, 0x80, 0x80, 0x00, 0x55,
+  0x55, 0x56, 0xa6, 0x9a, 0x66, 0xa9, 0x5a, 0xaa, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
+  0x88, 0x88, 0x88, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x02, 0x22, 0x02, 0x20, 0x00, 0x15, 0x55, 0x55, 0x9a, 0x66, 0xa6, 0x95, 0x4a, 0xaa, 0x08, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x80, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x80, 0x08, 0x08, 0x00, 0x05, 0x55, 0x55, 0x69, 0xa9,
+  0x9a, 0x55, 0x2a, 0xa8, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x88, 0x88, 0x88, 0xa2, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x80,
+  0x00, 0x01, 0x55, 0x55, 0x5a, 0x9a, 0x69, 0x56, 0xaa, 0xa0, 0x08, 0x88, 0x88, 0x88, 0x8a, 0x20,
+  0x22, 0x08, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x20, 0x08, 0x88, 0x00, 0x00, 0x55, 0x55, 0x55, 0x65, 0x95, 0x54, 0xaa, 0xa0,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x08, 0x88, 0x88, 0x88, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 0x00, 0x15, 0x55,
+  0x55, 0x55, 0x55, 0x52, 0xaa, 0x80, 0x22, 0x22, 0x22, 0x22, 0x20, 0x08, 0xa2, 0x22, 0x22, 0x22,
+  0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x20,
+  0x08, 0x80, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x6a, 0xaa, 0x02, 0x22, 0x22, 0x22, 0x22,
+  0x00, 0x88, 0x82, 0x22, 0x22, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x20, 0x00, 0x80, 0x02, 0x55, 0x55, 0x55, 0x55, 0xaa,
+  0xaa, 0x20, 0x82, 0x08, 0x88, 0x88, 0x02, 0x22, 0x22, 0x22, 0x20, 0x00, 0x08, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x20, 0x02, 0x00, 0x00, 0x02,
+  0x00, 0x11, 0x55, 0x99, 0xa4, 0x2a, 0xa8, 0x80, 0x22, 0x22, 0x20, 0x80, 0x22, 0x08, 0x88, 0x88,
+  0x80, 0x02, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0xa2, 0xaa, 0xa8, 0x8a, 0x22, 0x20,
+  0x88, 0x00, 0x20, 0x88, 0x22, 0x00, 0x02, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa,
+  0xa0, 0xaa, 0xa2, 0x80, 0x88, 0x22, 0x22, 0x02, 0x22, 0x22, 0x20, 0x00, 0x20, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xa8, 0xa9, 0xa2, 0xaa, 0xa2, 0x88, 0x82, 0x22, 0x00, 0x08, 0x88, 0x80,
+  0x00, 0x08, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x8a, 0x54, 0x6a, 0x8a, 0xaa, 0x8a, 0x88,
+  0x88, 0x88, 0x20, 0x08, 0x82, 0x02, 0x00, 0x00, 0x00, 0x88, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0x2a, 0xa5,
+  0x54, 0xaa, 0x8a, 0xaa, 0x8a, 0x02, 0x20, 0x82, 0x00, 0x88, 0x20, 0x00, 0x00, 0x80, 0x02, 0x00,
+  0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x02, 0x66, 0x55, 0x55, 0xa6, 0x2a, 0xaa, 0x2a, 0x08, 0x08, 0x88, 0x00, 0x22,
+  0x00, 0x08, 0x00, 0x20, 0x20, 0x80, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa6, 0x91, 0x55, 0x54, 0xaa, 0x2a, 0xaa,
+  0x2a, 0x22, 0x22, 0x08, 0x02, 0x00, 0x02, 0x20, 0x20, 0x00, 0x02, 0x00, 0x00, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x99,
+  0x15, 0x55, 0x56, 0xaa, 0xaa, 0xa8, 0xa6, 0x20, 0x20, 0x80, 0x02, 0x20, 0x08, 0x00, 0x80, 0x00,
+  0x88, 0x00, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa5, 0x66, 0x55, 0x55, 0x56, 0xa8, 0x2a, 0xaa, 0xaa, 0x00, 0x88, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x69, 0x55, 0x55, 0x46, 0xa4,
+  0xaa, 0xa8, 0x88, 0x20, 0x08, 0x00, 0x08, 0x00, 0x00, 0x08, 0x80, 0x08, 0x88, 0x02, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+  0x5a, 0x95, 0x55, 0x50, 0x25, 0x58, 0xaa, 0xa8, 0x96, 0x00, 0x82, 0x00, 0x00, 0x00, 0x02, 0x20,
+  0x00, 0x02, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x65, 0x55, 0x56, 0x01, 0x94, 0x16, 0xaa, 0xa2, 0x59, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x20, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x65, 0x59, 0x55, 0x40, 0x09,
+  0x98, 0x56, 0xaa, 0xa9, 0xa0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x82, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x95, 0x55, 0x58, 0x08, 0x26, 0x65, 0x96, 0xaa, 0xa2, 0x02, 0x02, 0x08, 0x08, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x08, 0x02, 0x22, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x55, 0x95, 0x00, 0xa0, 0x59, 0x66, 0x56, 0xaa, 0x80,
+  0x08, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x95, 0x55, 0x60, 0x28,
+  0x21, 0xa5, 0x90, 0x14, 0xaa, 0xa0, 0x02, 0x80, 0x00, 0x20, 0x22, 0xa0, 0x22, 0x08, 0x22, 0x00,
+  0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x96, 0x55, 0x55, 0x8a, 0xaa, 0x82, 0x59, 0x28, 0x95, 0xaa, 0x80, 0x28, 0x80, 0x80, 0x80,
+  0x22, 0x00, 0x82, 0x22, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x55, 0x55, 0x2a, 0xaa, 0xa8, 0x68, 0xa8, 0x95,
+  0xaa, 0x80, 0x04, 0x80, 0x00, 0xa2, 0x88, 0x02, 0x22, 0x08, 0x20, 0x20, 0x80, 0x00, 0x00, 0x00,
+  0x82, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x65, 0x55, 0x5a,
+  0xaa, 0xaa, 0xaa, 0x0a, 0xa8, 0x55, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x22, 0x08, 0x22, 0x00, 0x00, 0x00, 0x08, 0x20, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x95, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xa8, 0x96, 0x0a, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0x20, 0x88, 0x80, 0x88, 0x88, 0x88, 0x22, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x95, 0x56, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xa8, 0x50, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x02,
+  0x08, 0x08, 0x22, 0x08, 0x88, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x55,
+  0x5a, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0xa0, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x20, 0x00, 0x88, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x95, 0x55, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x02, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x65, 0x55, 0x60, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x08, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66,
+  0x55, 0x5a, 0x8a, 0x8a, 0xaa, 0xaa, 0xaa, 0xa9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x22, 0x22, 0x22, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x9a, 0x9a, 0xaa, 0xaa, 0xa2, 0xaa, 0xaa, 0xaa, 0xa5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x82, 0x22, 0x08, 0x88, 0x88, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x2a, 0xaa, 0xaa, 0xaa,
+  0x2a, 0xaa, 0xaa, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x88, 0x82, 0x22, 0x08, 0x20, 0x80, 0x08, 0x88, 0x80,
+  0x22, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x82,
+  0x22, 0x22, 0x20, 0x00, 0x82, 0x08, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0x95, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x08, 0x22, 0x08, 0x82, 0x08, 0x8a, 0x20, 0x08, 0x02, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x82, 0xa5, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x22, 0x08, 0x88, 0x22, 0x20, 0x80, 0x88,
+  0x00, 0x8a, 0x8a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20,
+  0x88, 0x22, 0x20, 0x80, 0x00, 0x00, 0x00, 0x08, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x82, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2a, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xa9, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x08, 0x22, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x80, 0x0a, 0xaa, 0xaa, 0xaa, 0xa2, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x65, 0x55, 0x88, 0x82, 0x29, 0x55, 0x55,
+  0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x65,
+  0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x59, 0x95, 0x55, 0x55, 0x95, 0x55, 0x95, 0x55, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xa6, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+  0x59, 0x55, 0x55, 0x59, 0x55, 0x59, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa5, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xaa, 0xaa, 0xaa,
+  0xa8, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x55, 0x55, 0x55, 0x95,
+  0x55, 0x95, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x99, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x65, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x95, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa,
+  0x69, 0x99, 0xaa, 0xaa, 0xaa, 0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x29, 0x55,
+  0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaa, 0x65, 0x95, 0x96, 0x59, 0xaa, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x55, 0x55, 0x55, 0x56, 0x6a,
+  0xaa, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x95, 0x55, 0x55, 0x55, 0x55, 0x95,
+  0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x95, 0x96, 0x59, 0x65, 0x95, 0x6a, 0xaa, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x55, 0x55, 0x65, 0x56, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xaa, 0x80, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x54, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x65, 0x55, 0x55, 0x55,
+  0x59, 0x56, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x55, 0x55, 0x65,
+  0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x55, 0x59, 0x59, 0x56, 0x55, 0x55, 0x6a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+  0x00, 0x09, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x00,
+  0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x65, 0x68, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
+  0x56, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x68, 0x20, 0x20, 0x88, 0x00, 0x00, 0x20, 0x00, 0x00, 0x15, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x95,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x08, 0x20, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x60, 0x80, 0x02, 0x08, 0x00, 0x02, 0x00, 0x80, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x80,
+  0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x40, 0x22, 0x20, 0x80, 0x08, 0x00, 0x00, 0x00, 0x95, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x08, 0x00, 0x02, 0x08, 0x00, 0x08,
+  0x08, 0x20, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x82, 0x22, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x08, 0x08, 0x20, 0x22, 0x02, 0x00, 0x00, 0x09, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x80, 0x82, 0x08, 0x80,
+  0x00, 0x08, 0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x54, 0x08, 0x88, 0x20, 0x88, 0x20, 0x00, 0x09, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x20, 0x80, 0x82, 0x08, 0x00, 0x80, 0x95, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x88, 0x22,
+  0x20, 0x82, 0x00, 0x09, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x56, 0x02, 0x22, 0x08, 0x88, 0x00, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65,
+  0x55, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x88, 0x20, 0x88, 0x20, 0x0a, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58,
+  0x08, 0x84, 0x84, 0x82, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x54, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0xa1, 0x08, 0x20, 0x88, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x95, 0x55, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x80, 0x88, 0x88, 0x88,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x60, 0x88, 0x88, 0x82, 0x12, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa0, 0x12, 0x08, 0x12, 0x08, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x56, 0x55, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x62, 0x22, 0x12,
+  0x22, 0x22, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x60, 0x88, 0x88, 0x88, 0x88, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x42, 0x22, 0x20, 0x81, 0x08, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
+  0x82, 0x08, 0x88, 0x88, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x58, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x24, 0x84, 0x88, 0x88, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x51, 0x55, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x81, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0x82, 0x22, 0x10, 0x82,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x50, 0x88, 0x88, 0x22, 0x12, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x85,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x21, 0x08, 0x88, 0x88, 0x09, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2a, 0x28, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x22, 0x22,
+  0x20, 0x20, 0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x88, 0x85, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x56, 0x02, 0x12, 0x00, 0x00, 0x00, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x88,
+  0xa2, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x25,
+  0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x8a, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x8a, 0x22, 0x15, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x55, 0x55, 0x55, 0x55,
+  0x05, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0xa2, 0x28, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x08, 0x88, 0x00,
+  0x08, 0x00, 0x55, 0x55, 0x55, 0x40, 0x25, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x28, 0x8a, 0x22, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x40, 0x88, 0x88, 0x00, 0x00, 0x00, 0x25, 0x55, 0x54, 0x88, 0x05, 0x55, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa2, 0x28, 0xa0, 0x15,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x22, 0x20, 0x00, 0x08, 0x80, 0x25, 0x55,
+  0x62, 0xaa, 0x85, 0x65, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xa2, 0x28, 0x88, 0x80, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0x8a,
+  0x20, 0x00, 0x00, 0x08, 0x01, 0x58, 0x2a, 0xaa, 0xa5, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8a, 0x22, 0xa2, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x58, 0x88, 0x80, 0x00, 0x08, 0x80, 0x02, 0x80, 0x00, 0xaa, 0x85, 0x65,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x88, 0x88,
+  0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x22, 0x20, 0x00, 0x00, 0x22,
+  0x00, 0x00, 0x00, 0x0a, 0xa9, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0x8a, 0x22, 0x80, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x08, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x65, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88, 0xa2, 0x88, 0x80, 0x00, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x88, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x55, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x22,
+  0x28, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x62, 0x00, 0x00,
+  0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x88, 0xa2, 0x88, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x42, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xa2, 0x88, 0x80, 0x00, 0x08, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x59, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88,
+  0x88, 0xa2, 0x00, 0x00, 0x88, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58,
+  0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x00, 0x02, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x8a, 0x22, 0x00, 0x00, 0x82, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x59,
+  0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa2, 0x22, 0x88, 0x00, 0x08,
+  0x81, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x22, 0x8a, 0x28, 0x80, 0x00, 0x22, 0x22, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x8a, 0x00, 0x00, 0x88, 0x81, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x96, 0x55, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x28, 0x88, 0x00,
+  0x02, 0x22, 0x21, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x00,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x95, 0x55, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x22, 0x8a, 0x20, 0x00, 0x08, 0x82, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x15, 0x95, 0x56,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x88, 0x88, 0x00, 0x08, 0x88, 0xa1, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x00, 0x15, 0x95, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x22, 0x8a,
+  0x80, 0x00, 0xa2, 0x22, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0xa8, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x55, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x8a, 0x22, 0x00, 0x02, 0x20, 0x88, 0x89, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x20, 0x80, 0x00, 0x20, 0x02, 0x00, 0x00, 0x25,
+  0x95, 0x56, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x28, 0xa2, 0x00, 0x08, 0x88, 0x82,
+  0x09, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95, 0x55, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x88, 0x88, 0x00, 0x08, 0x22, 0x22, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x08, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x05, 0x55, 0x56, 0x9a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xa2, 0xa0, 0x00, 0x22, 0x22, 0x20, 0x05, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x09, 0x55, 0x55, 0x6a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8a, 0x20, 0x00, 0x88,
+  0x88, 0x88, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x55, 0x55, 0x9a, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xa2, 0x22, 0x00, 0x02, 0x22, 0x20, 0x80, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20, 0x80, 0x00, 0x00, 0x88, 0x00, 0x00, 0x02, 0x55, 0x55,
+  0x5a, 0x60, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0xa8, 0x80, 0x00, 0x88, 0x22, 0x00, 0x05, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x22, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x80, 0x01, 0x55, 0x55, 0x69, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa8, 0x88, 0x00,
+  0x0a, 0x08, 0x88, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x08, 0x20, 0x00, 0x00, 0x88, 0x00, 0x00, 0x02, 0x55, 0x55, 0x56, 0xaa, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x22, 0x28, 0x00, 0x20, 0x88, 0x88, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x82, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+  0x55, 0x55, 0x5a, 0x66, 0x80, 0x00, 0x00, 0x00, 0x2a, 0x28, 0x88, 0x00, 0x22, 0x22, 0x20, 0x00,
+  0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x08, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x95, 0x55, 0x55, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x08, 0x8a,
+  0x20, 0x00, 0x88, 0x88, 0x80, 0x00, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x20, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x80, 0x95, 0x65, 0x56, 0x99,
+  0xa8, 0x00, 0x00, 0x00, 0x22, 0x88, 0x80, 0x00, 0x88, 0x88, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x95, 0x55, 0x55, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x8a, 0x22, 0x80, 0x02, 0x22, 0x22,
+  0x00, 0x02, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x20, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x80, 0x15, 0x55, 0x55, 0x69, 0x9a, 0x00, 0x00, 0x00,
+  0x88, 0xa8, 0x00, 0x08, 0x88, 0x88, 0x00, 0x08, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x08, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x25, 0x55,
+  0x55, 0x9a, 0xaa, 0x80, 0x00, 0x00, 0x8a, 0x22, 0x00, 0x02, 0x08, 0x20, 0x00, 0x0a, 0x95, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x15, 0x56, 0x55, 0x5a, 0x66, 0xa0, 0x00, 0x00, 0xa2, 0x28, 0x00, 0x22,
+  0x22, 0x20, 0x00, 0xa0, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x20, 0x25, 0x95, 0x55, 0x66, 0xaa, 0x60,
+  0x00, 0x02, 0x22, 0x88, 0x00, 0x08, 0x88, 0x80, 0x00, 0x8a, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x25, 0x55, 0x55, 0x56, 0xaa, 0xa8, 0x00, 0x00, 0xa2, 0x20, 0x00, 0x88, 0x88, 0x00, 0x02, 0x28,
+  0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x82, 0x00, 0x80, 0x09, 0x55, 0x55, 0x56, 0x66, 0x9a, 0x00, 0x02, 0x22, 0x88,
+  0x00, 0x88, 0x88, 0x80, 0x02, 0xa2, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x95, 0x56,
+  0xaa, 0x6a, 0x80, 0x02, 0x8a, 0x20, 0x00, 0x88, 0x22, 0x00, 0x08, 0x8a, 0x15, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20, 0x00, 0x02, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x09, 0x65, 0x55, 0x95, 0x66, 0xa9, 0xa0, 0x02, 0x28, 0x80, 0x02, 0x22, 0x20, 0x00,
+  0x22, 0xa8, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x00, 0x00, 0x80, 0x08, 0x00, 0x02, 0x00, 0x00, 0x02, 0x55, 0x55, 0x55, 0xaa, 0x9a, 0xa0, 0x02,
+  0x22, 0x80, 0x00, 0x88, 0x88, 0x00, 0x28, 0x88, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x55,
+  0x55, 0x55, 0x59, 0xaa, 0x68, 0x02, 0x28, 0x80, 0x02, 0x22, 0x20, 0x00, 0x88, 0xa2, 0x25, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x88,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x56, 0x59, 0x55, 0x6a, 0xa6, 0xa6, 0x02, 0x8a, 0x00, 0x08, 0x88,
+  0x80, 0x00, 0x2a, 0x28, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x95, 0x55, 0x59, 0x56, 0x6a,
+  0xaa, 0xa0, 0x88, 0x80, 0x02, 0x20, 0x80, 0x00, 0x88, 0xa0, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x55, 0x55, 0x55, 0x56, 0xa9, 0xaa, 0xa2, 0x28, 0x80, 0x08, 0x88, 0x80, 0x02, 0xaa, 0x20,
+  0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+  0x00, 0x82, 0x20, 0x00, 0x00, 0x00, 0x00, 0x95, 0x95, 0x95, 0x55, 0x9a, 0xa6, 0x68, 0x22, 0x00,
+  0x22, 0x22, 0x00, 0x02, 0x22, 0x80, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x55, 0x56,
+  0x59, 0xa9, 0xaa, 0xaa, 0x28, 0x80, 0x08, 0x88, 0x80, 0x08, 0xa2, 0x20, 0x15, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x25, 0x59, 0x55, 0x55, 0x5a, 0xa9, 0xa6, 0x82, 0x00, 0x22, 0x08, 0x00, 0x0a,
+  0x8a, 0x80, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x65, 0x55, 0x69, 0x9a, 0xaa,
+  0xa2, 0x00, 0x08, 0x88, 0x00, 0x08, 0xa2, 0x00, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x55, 0x55, 0x59, 0x56, 0xaa, 0x69, 0xa8, 0x00, 0x08, 0x88, 0x00, 0x2a, 0x22, 0x00, 0x15, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95, 0x56, 0x55, 0x5a, 0xaa, 0xaa, 0xa8, 0x00, 0x22, 0x20,
+  0x00, 0x22, 0xa8, 0x00, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x95, 0x55, 0x55,
+  0x99, 0xa6, 0x9a, 0x80, 0x08, 0x88, 0x00, 0x28, 0x88, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x82, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x55, 0x55, 0x65, 0x95, 0xaa, 0xaa, 0xaa, 0x80, 0x22, 0x20, 0x00, 0x8a, 0x20, 0x00,
+  0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x02, 0x59, 0x59, 0x55, 0x55, 0x5a, 0x9a, 0x69, 0xa0,
+  0x08, 0x20, 0x00, 0x28, 0xa0, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x55, 0x55,
+  0x55, 0x59, 0x69, 0xaa, 0xaa, 0xa8, 0x22, 0x20, 0x02, 0xa2, 0x80, 0x00, 0x25, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x95, 0x95, 0x96, 0x55, 0x56, 0xa6, 0x9a, 0x6a, 0x02, 0x20, 0x00, 0x8a,
+  0x20, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6a, 0x65, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55,
+  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x95, 0x55, 0x55, 0x55, 0x9a, 0xaa,
+  0xaa, 0xa6, 0x08, 0x80, 0x02, 0xa2, 0x80, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xaa,
+  0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00,
+  0x25, 0xa6, 0x55, 0x65, 0x55, 0x9a, 0x69, 0xaa, 0x80, 0x20, 0x02, 0x28, 0x80, 0x00, 0x05, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x99, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x02, 0x08, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x25, 0x95, 0x65, 0x55, 0x55, 0xaa, 0xaa, 0x9a, 0xa0, 0x80,
+  0x02, 0x8a, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x65, 0x56, 0x56,
+  0x59, 0x5a, 0x69, 0xaa, 0x68, 0x20, 0x08, 0xa2, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x22, 0x20, 0x08, 0x00, 0x20, 0xa2, 0x80,
+  0x00, 0x00, 0x09, 0x65, 0x55, 0x55, 0x55, 0xa6, 0xaa, 0xaa, 0xaa, 0x00, 0x02, 0x8a, 0x00, 0x00,
+  0x09, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x09, 0x65, 0x95, 0x65, 0x55, 0x5a, 0xa6, 0x99,
+  0xa6, 0x80, 0x08, 0xa2, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x28, 0x80, 0x00, 0x00, 0x01, 0x55,
+  0x59, 0x56, 0x55, 0x56, 0xaa, 0xaa, 0xaa, 0xa0, 0x02, 0x28, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x20, 0x80, 0x00, 0x00,
+  0x88, 0xa0, 0x00, 0x00, 0x02, 0x59, 0x55, 0x55, 0x56, 0x56, 0x66, 0x9a, 0x9a, 0x60, 0x02, 0x8a,
+  0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x8a, 0x20, 0x00, 0x00, 0x02, 0x55, 0x56, 0x55, 0x95, 0x65,
+  0xaa, 0xa9, 0xaa, 0xa8, 0x02, 0x28, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x22, 0x28, 0x00, 0x00,
+  0x00, 0x55, 0x65, 0x59, 0x55, 0x55, 0x6a, 0x6a, 0xa9, 0xa6, 0x00, 0x88, 0x00, 0x00, 0x05, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x08, 0x20, 0x80,
+  0x00, 0x00, 0x8a, 0x22, 0x00, 0x00, 0x00, 0x99, 0x55, 0x55, 0x65, 0x59, 0x6a, 0xa6, 0x9a, 0xaa,
+  0x82, 0xa8, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x28, 0xa2, 0x00, 0x00, 0x00, 0x15, 0x55, 0x65,
+  0x55, 0x95, 0x59, 0xaa, 0xaa, 0x69, 0xa0, 0x22, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x02, 0x08, 0x20, 0x00, 0x00, 0x08, 0x8a,
+  0x00, 0x00, 0x00, 0x25, 0x99, 0x56, 0x55, 0x55, 0x9a, 0x9a, 0xaa, 0xaa, 0xa8, 0x28, 0x00, 0x00,
+  0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+  0x20, 0x80, 0x00, 0x00, 0x0a, 0x28, 0x80, 0x00, 0x00, 0x25, 0x55, 0x55, 0x59, 0x65, 0x55, 0xaa,
+  0x99, 0xa6, 0x9a, 0x02, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x02, 0x88, 0x80, 0x00, 0x00, 0x09,
+  0x56, 0x55, 0x55, 0x55, 0x56, 0x9a, 0xaa, 0xaa, 0xa9, 0x88, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00,
+  0x02, 0x22, 0xa0, 0x00, 0x00, 0x09, 0x65, 0x66, 0x65, 0x59, 0x65, 0x6a, 0x9a, 0x9a, 0x6a, 0x82,
+  0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+};
+
+constexpr rawdisp::AssetDesc kwr_i2_152x296_desc = {
+  .width = 152,
+  .height = 296,
+  .format = rawdisp::AssetFormat::I2_RGB888,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "index",
+      .data = kwr_i2_152x296,
+      .size = sizeof(kwr_i2_152x296),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 2,
+        .pixelsPerFrag = 4,
+        .bytesPerFrag = 1,
+      },
+      .stride = 38,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
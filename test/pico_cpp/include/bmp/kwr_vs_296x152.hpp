@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 // 296x152px, Indexed2
 // Plane "white", color index=1
 // MSB First, Vertical Packing, Horizontal Adressing
@@ -718,3 +720,46 @@ const uint8_t kwr_vs_296x152_red[] = {
   0x10, 0x04, 0x00, 0x11, 0x84, 0x20, 0x09, 0x00, 0x45, 0x00, 0x10, 0x45, 0x00, 0x28, 0x01, 0x04,
   0x20, 0x01, 0x14, 0x00, 0x42, 0x08, 0x00, 0x00,
 };
+
+constexpr rawdisp::AssetDesc kwr_vs_296x152_desc = {
+  .width = 296,
+  .height = 152,
+  .format = rawdisp::AssetFormat::I2_RGB888,
+  .numPlanes = 2,
+  .planes = {
+    {
+      .id = "white",
+      .data = kwr_vs_296x152_white,
+      .size = sizeof(kwr_vs_296x152_white),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::INDEX_MATCH,
+        .matchIndex = 1,
+        .flags = 0x25,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 1,
+        .pixelsPerFrag = 8,
+        .bytesPerFrag = 1,
+      },
+      .stride = 296,
+    },
+    {
+      .id = "red",
+      .data = kwr_vs_296x152_red,
+      .size = sizeof(kwr_vs_296x152_red),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::INDEX_MATCH,
+        .matchIndex = 2,
+        .flags = 0x25,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 1,
+        .pixelsPerFrag = 8,
+        .bytesPerFrag = 1,
+      },
+      .stride = 296,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 // 184x384px, Indexed2
 // MSB First, Horizontal Packing, Horizontal Adressing
 // 17664 Bytes
@@ -1111,3 +1113,30 @@ const uint8_t kwry_hs_184x384[] = {
   0xc0, 0x43, 0x03, 0x00, 0x1c, 0xc0, 0xc3, 0x23, 0x0f, 0xf3, 0xf3, 0xcf, 0xcc, 0xf3, 0xc3, 0xbf,
   0xef, 0xbe, 0xfb, 0xbb, 0xbe, 0xee, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0x69, 0xa6, 0x55,
 };
+
+constexpr rawdisp::AssetDesc kwry_hs_184x384_desc = {
+  .width = 184,
+  .height = 384,
+  .format = rawdisp::AssetFormat::I2_RGB888,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "index",
+      .data = kwry_hs_184x384,
+      .size = sizeof(kwry_hs_184x384),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 2,
+        .pixelsPerFrag = 4,
+        .bytesPerFrag = 1,
+      },
+      .stride = 46,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 const uint8_t kwry_hs_240x416[] = {
   0xba, 0xee, 0xee, 0xea, 0xea, 0xee, 0xba, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xa6, 0x9a, 0x69,
   0xa6, 0x9a, 0x69, 0xa6, 0x9a, 0x69, 0xa6, 0x9a, 0x69, 0xa6, 0x9a, 0x69, 0xa6, 0x9a, 0x69, 0xa6,
@@ -1565,3 +1567,29 @@ const uint8_t kwry_hs_240x416[] = {
   0xed, 0xb6, 0x9e, 0x6d, 0xda, 0x79, 0xe6, 0xa9, 0xda, 0xd9, 0x9d, 0x9d, 0xb6, 0x6d, 0xe6, 0x9e,
 };
 
+constexpr rawdisp::AssetDesc kwry_hs_240x416_desc = {
+  .width = 240,
+  .height = 416,
+  .format = rawdisp::AssetFormat::I2_RGB888,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "index",
+      .data = kwry_hs_240x416,
+      .size = sizeof(kwry_hs_240x416),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 2,
+        .pixelsPerFrag = 4,
+        .bytesPerFrag = 1,
+      },
+      .stride = 60,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "rawdisp/asset_set.hpp"
+
+#include "kwry_hs_240x416.hpp"
+#include "kwry_hs_184x384.hpp"
+
+// 2 levels: 240x416, 184x384
+constexpr rawdisp::AssetSet kwry_hs_set = {
+  .numLevels = 2,
+  .levels = {
+    &kwry_hs_240x416_desc,
+    &kwry_hs_184x384_desc,
+  },
+};
@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 // 480x320px, RGB111
 // B:G:R, MSB First, Horizontal Packing, Horizontal Adressing
 // 76800 Bytes
@@ -4807,3 +4809,30 @@ const uint8_t rgb111_480x320[] = {
   0x37, 0x36, 0x3c, 0x3e, 0x37, 0x35, 0x37, 0x27, 0x37, 0x37, 0x37, 0x27, 0x35, 0x37, 0x36, 0x3e,
   0x3e, 0x37, 0x37, 0x27, 0x36, 0x3e, 0x27, 0x35, 0x37, 0x27, 0x36, 0x3c, 0x37, 0x26, 0x3e, 0x3e,
 };
+
+constexpr rawdisp::AssetDesc rgb111_480x320_desc = {
+  .width = 480,
+  .height = 320,
+  .format = rawdisp::AssetFormat::RGB111,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "color",
+      .data = rgb111_480x320,
+      .size = sizeof(rgb111_480x320),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 3,
+        .pixelsPerFrag = 2,
+        .bytesPerFrag = 1,
+      },
+      .stride = 240,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
@@ -0,0 +1,3772 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "rawdisp/asset_desc.hpp"
+
+// 480x320px, RGB111
+// B:G:R, MSB First, Horizontal Packing, Horizontal Adressing
+// 76800 Bytes
+// RLE compressed, 59727 Bytes (x1.29)
+const uint8_t rgb111_480x320_rle[] = {
+  0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0xb5, 0x1f, 0x82, 0x3f, 0x92, 0x1f, 0x01, 0x3f, 0x3f, 0x9a,
+  0x3b, 0x80, 0x3f, 0x85, 0x3b, 0x80, 0x3f, 0x85, 0x1f, 0x01, 0x3f, 0x3f, 0x8d, 0x1f, 0x01, 0x3f,
+  0x3f, 0x86, 0x1f, 0x82, 0x3f, 0x98, 0x1f, 0x81, 0x3f, 0x9c, 0x1f, 0x81, 0x3f, 0xba, 0x3b, 0x04,
+  0x1f, 0x3b, 0x3f, 0x3b, 0x3f, 0x92, 0x3b, 0x02, 0x1f, 0x3b, 0x3f, 0x96, 0x1f, 0x06, 0x1b, 0x3b,
+  0x3b, 0x1f, 0x1f, 0x3b, 0x3f, 0x85, 0x1f, 0x01, 0x3b, 0x3f, 0x83, 0x3b, 0x03, 0x1f, 0x1f, 0x3b,
+  0x3f, 0x8c, 0x3b, 0x01, 0x3f, 0x3f, 0x87, 0x3b, 0x03, 0x3f, 0x1f, 0x3f, 0x1f, 0x96, 0x3b, 0x80,
+  0x1f, 0x02, 0x3f, 0x3f, 0x1f, 0x9c, 0x3b, 0x04, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x83, 0x1f, 0x7a,
+  0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b,
+  0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b,
+  0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x3f, 0x3b, 0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f,
+  0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x1f, 0x3f, 0x3f, 0x3b, 0x3f, 0x3b, 0x3f, 0x1b, 0x2b, 0x1f,
+  0x0b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x0f, 0x1b,
+  0x3b, 0x3f, 0x3f, 0x3b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b,
+  0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x2b, 0x3b, 0x2b,
+  0x3b, 0x3f, 0x3f, 0x3b, 0x1f, 0x0b, 0x3b, 0x0f, 0x1b, 0x2b, 0x3b, 0x80, 0x3f, 0x46, 0x1f, 0x19,
+  0x3b, 0x1d, 0x1f, 0x1d, 0x1f, 0x1f, 0x3f, 0x3b, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x1d,
+  0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1f, 0x3b, 0x3f, 0x3b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b,
+  0x3b, 0x0f, 0x1f, 0x3f, 0x3f, 0x1f, 0x3f, 0x1f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x0f, 0x1b, 0x2b,
+  0x1f, 0x0b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x0f, 0x1b, 0x2b, 0x1f, 0x0b, 0x3b, 0x2b,
+  0x3b, 0x2b, 0x3f, 0x1f, 0x3f, 0x80, 0x3b, 0x25, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b,
+  0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x1d, 0x1b, 0x39, 0x1f, 0x19, 0x3b,
+  0x1d, 0x1b, 0x39, 0x1f, 0x1f, 0x3f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3b, 0x3b, 0x0f, 0x1b, 0x85, 0x3b,
+  0x00, 0x3f, 0x9c, 0x1f, 0x02, 0x3f, 0x3f, 0x1f, 0x8a, 0x3b, 0x02, 0x2b, 0x1f, 0x1f, 0x82, 0x3f,
+  0x8f, 0x1f, 0x03, 0x0f, 0x1f, 0x1f, 0x3f, 0x9a, 0x1f, 0x01, 0x3f, 0x1f, 0x85, 0x3b, 0x02, 0x3f,
+  0x1f, 0x3f, 0x81, 0x1f, 0x00, 0x1b, 0x80, 0x3b, 0x01, 0x3f, 0x3f, 0x8c, 0x3b, 0x01, 0x3f, 0x3f,
+  0x86, 0x3b, 0x82, 0x3f, 0x99, 0x1f, 0x00, 0x3f, 0x80, 0x1f, 0x00, 0x0f, 0x99, 0x1f, 0x01, 0x3f,
+  0x1f, 0x81, 0x3f, 0x0d, 0x1b, 0x3b, 0x3b, 0x39, 0x3b, 0x1f, 0x1f, 0x1d, 0x1f, 0x1d, 0x1f, 0x1f,
+  0x3f, 0x3f, 0x80, 0x3b, 0x06, 0x39, 0x3b, 0x39, 0x3b, 0x39, 0x3b, 0x39, 0x80, 0x3b, 0x06, 0x39,
+  0x3b, 0x39, 0x3b, 0x39, 0x3b, 0x39, 0x80, 0x3b, 0x06, 0x39, 0x3b, 0x39, 0x3b, 0x39, 0x3b, 0x3b,
+  0x80, 0x3f, 0x06, 0x1f, 0x1f, 0x1d, 0x1f, 0x1d, 0x1f, 0x1d, 0x85, 0x1f, 0x0d, 0x3f, 0x1f, 0x3f,
+  0x1f, 0x3f, 0x1b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x80, 0x3b, 0x04, 0x2b, 0x3b,
+  0x2b, 0x3b, 0x2b, 0x80, 0x3b, 0x80, 0x3f, 0x06, 0x3b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x80,
+  0x3b, 0x04, 0x2b, 0x3b, 0x3f, 0x3b, 0x39, 0x82, 0x3b, 0x05, 0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b,
+  0x81, 0x1f, 0x1a, 0x3f, 0x1f, 0x0f, 0x1f, 0x0f, 0x1f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x1f, 0x3b,
+  0x3b, 0x39, 0x3b, 0x39, 0x3b, 0x3b, 0x3f, 0x3b, 0x3b, 0x1d, 0x1f, 0x1d, 0x1f, 0x1d, 0x80, 0x1f,
+  0x08, 0x1d, 0x1f, 0x1d, 0x1f, 0x1d, 0x1f, 0x1f, 0x3b, 0x3f, 0x80, 0x1f, 0x02, 0x0f, 0x1f, 0x0f,
+  0x81, 0x1f, 0x09, 0x3f, 0x1f, 0x3f, 0x3b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x80, 0x3b, 0x06,
+  0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x80, 0x3b, 0x06, 0x2b, 0x3b, 0x2b, 0x3b, 0x2b, 0x1f,
+  0x1b, 0x85, 0x3b, 0x00, 0x39, 0x81, 0x3b, 0x05, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x39, 0x82, 0x3b,
+  0x04, 0x39, 0x3b, 0x39, 0x3b, 0x39, 0x82, 0x3b, 0x80, 0x3f, 0x04, 0x1f, 0x3f, 0x1f, 0x1b, 0x3f,
+  0x81, 0x1f, 0x03, 0x3b, 0x2b, 0x3b, 0x3b, 0x80, 0x1f, 0x04, 0x3f, 0x3b, 0x3f, 0x3f, 0x0f, 0x86,
+  0x1f, 0x00, 0x0f, 0x8b, 0x1f, 0x00, 0x1b, 0x80, 0x3b, 0x03, 0x3f, 0x3f, 0x3b, 0x2b, 0x85, 0x3b,
+  0x01, 0x2b, 0x39, 0x80, 0x3b, 0x02, 0x1f, 0x3f, 0x1f, 0x80, 0x3f, 0x86, 0x1f, 0x00, 0x1d, 0x83,
+  0x1f, 0x06, 0x1b, 0x2b, 0x3b, 0x3b, 0x3f, 0x1f, 0x3f, 0x84, 0x1f, 0x00, 0x1d, 0x80, 0x1f, 0x06,
+  0x3f, 0x3f, 0x1f, 0x1f, 0x0f, 0x1f, 0x1d, 0x81, 0x1f, 0x03, 0x1b, 0x3b, 0x1f, 0x1d, 0x80, 0x1f,
+  0x00, 0x3f, 0x86, 0x3b, 0x04, 0x3f, 0x3f, 0x1f, 0x0f, 0x1b, 0x82, 0x3b, 0x00, 0x3f, 0x8a, 0x3b,
+  0x06, 0x1f, 0x1b, 0x3b, 0x3f, 0x3f, 0x3b, 0x39, 0x82, 0x3b, 0x01, 0x39, 0x3b, 0x81, 0x3f, 0x85,
+  0x1f, 0x00, 0x1d, 0x86, 0x1f, 0x04, 0x1d, 0x1f, 0x1f, 0x1b, 0x3b, 0x80, 0x1f, 0x00, 0x1d, 0x82,
+  0x1f, 0x05, 0x1b, 0x3b, 0x0f, 0x1f, 0x1f, 0x0f, 0x81, 0x1f, 0x00, 0x0f, 0x81, 0x1f, 0x03, 0x1d,
+  0x1f, 0x1f, 0x0f, 0x83, 0x1f, 0x00, 0x1d, 0x80, 0x1f, 0x01, 0x3f, 0x3b, 0x80, 0x3f, 0x09, 0x3b,
+  0x3f, 0x0b, 0x3b, 0x39, 0x3b, 0x3b, 0x1f, 0x1f, 0x1b, 0x81, 0x3b, 0x80, 0x3f, 0x08, 0x1f, 0x1f,
+  0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x80, 0x3b, 0x0b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b,
+  0x1f, 0x1d, 0x1f, 0x1d, 0x1b, 0x3b, 0x80, 0x1f, 0x02, 0x1d, 0x1f, 0x1f, 0x80, 0x3f, 0x06, 0x3b,
+  0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x39, 0x80, 0x3b, 0x04, 0x1f, 0x1b, 0x2b, 0x3b, 0x3b, 0x80, 0x3f,
+  0x07, 0x1f, 0x3f, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x81, 0x1f, 0x04, 0x1b, 0x3b, 0x1f, 0x1b,
+  0x3b, 0x83, 0x1f, 0x05, 0x3f, 0x3b, 0x3b, 0x1f, 0x1b, 0x3b, 0x80, 0x1f, 0x01, 0x1b, 0x3b, 0x80,
+  0x1f, 0x01, 0x3b, 0x3b, 0x81, 0x1f, 0x01, 0x1b, 0x3b, 0x81, 0x1f, 0x00, 0x0f, 0x81, 0x1f, 0x08,
+  0x1b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1f, 0x80, 0x3f, 0x85, 0x1f, 0x0b, 0x3f, 0x1f,
+  0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x39, 0x3b, 0x39, 0x1f, 0x1b, 0x81, 0x3b, 0x14, 0x3f, 0x3f, 0x1b,
+  0x3b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x2b, 0x1f, 0x1f, 0x3f, 0x3b, 0x3f, 0x1f, 0x3b, 0x3b, 0x1f,
+  0x1b, 0x3b, 0x81, 0x1f, 0x06, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x81, 0x3b, 0x82, 0x1f,
+  0x00, 0x0f, 0x81, 0x1f, 0x01, 0x0b, 0x39, 0x80, 0x3b, 0x0a, 0x1f, 0x1b, 0x3b, 0x3b, 0x2b, 0x1f,
+  0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x81, 0x1f, 0x10, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b,
+  0x3b, 0x2b, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x3b, 0x3b, 0x80, 0x1f, 0x16, 0x1b, 0x3b, 0x0f, 0x3b,
+  0x1f, 0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x3b, 0x3f, 0x1f, 0x3f, 0x3b, 0x3f, 0x1d, 0x1f, 0x0f, 0x1d,
+  0x1f, 0x0f, 0x1d, 0x80, 0x1f, 0x06, 0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f, 0x1b, 0x80, 0x3b, 0x11,
+  0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x1f, 0x1f, 0x3b, 0x3f, 0x1f, 0x3f, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f,
+  0x1f, 0x19, 0x82, 0x3b, 0x04, 0x1d, 0x1f, 0x1f, 0x3f, 0x1f, 0x80, 0x3f, 0x2c, 0x1f, 0x0f, 0x1d,
+  0x1f, 0x0f, 0x1d, 0x1b, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x39, 0x1f,
+  0x1f, 0x3b, 0x3f, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x3f, 0x3f,
+  0x1f, 0x1f, 0x1b, 0x39, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x82, 0x3b, 0x14, 0x0f, 0x1f, 0x3b,
+  0x2b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x3f, 0x1f, 0x3b, 0x3b, 0x39, 0x3b, 0x0f, 0x19,
+  0x3b, 0x2b, 0x80, 0x1f, 0x03, 0x0f, 0x1d, 0x1f, 0x0f, 0x81, 0x1f, 0x0c, 0x0f, 0x1d, 0x1f, 0x0f,
+  0x1d, 0x1b, 0x3b, 0x3f, 0x1d, 0x1f, 0x1f, 0x0f, 0x1d, 0x81, 0x1f, 0x00, 0x3b, 0x80, 0x3f, 0x17,
+  0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f, 0x19, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x2b, 0x39,
+  0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x81, 0x3b, 0x00, 0x39, 0x81, 0x1f, 0x02, 0x0f,
+  0x1f, 0x1d, 0x82, 0x1f, 0x11, 0x0f, 0x1f, 0x1d, 0x1f, 0x0f, 0x1d, 0x1b, 0x3b, 0x39, 0x3b, 0x3b,
+  0x2b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x3b, 0x82, 0x3f, 0x82, 0x3b, 0x00, 0x39, 0x80, 0x3b, 0x81,
+  0x1f, 0x03, 0x1b, 0x3b, 0x1f, 0x1f, 0x81, 0x3f, 0x86, 0x3b, 0x01, 0x2b, 0x39, 0x84, 0x3b, 0x00,
+  0x39, 0x81, 0x1f, 0x04, 0x1b, 0x3b, 0x3b, 0x39, 0x3b, 0x81, 0x3f, 0x85, 0x3b, 0x01, 0x2b, 0x39,
+  0x81, 0x3b, 0x06, 0x3f, 0x1f, 0x3f, 0x3b, 0x3f, 0x1f, 0x0f, 0x84, 0x1f, 0x00, 0x1d, 0x84, 0x1f,
+  0x00, 0x1b, 0x80, 0x3b, 0x00, 0x3f, 0x83, 0x3b, 0x01, 0x1f, 0x1d, 0x81, 0x1f, 0x0a, 0x3b, 0x3f,
+  0x3b, 0x2b, 0x3b, 0x3b, 0x1f, 0x0f, 0x1f, 0x1f, 0x1b, 0x80, 0x3b, 0x04, 0x0f, 0x1d, 0x1f, 0x1f,
+  0x1d, 0x85, 0x1f, 0x80, 0x3f, 0x01, 0x1f, 0x1b, 0x84, 0x3b, 0x00, 0x2b, 0x82, 0x1f, 0x01, 0x1b,
+  0x39, 0x81, 0x3b, 0x81, 0x1f, 0x86, 0x3b, 0x00, 0x2b, 0x80, 0x3f, 0x02, 0x1f, 0x1b, 0x3b, 0x84,
+  0x1f, 0x00, 0x0b, 0x84, 0x3b, 0x02, 0x1f, 0x1f, 0x19, 0x81, 0x3b, 0x03, 0x1f, 0x1f, 0x3b, 0x1d,
+  0x81, 0x1f, 0x00, 0x1b, 0x82, 0x3b, 0x00, 0x2b, 0x81, 0x3b, 0x00, 0x39, 0x82, 0x3b, 0x03, 0x2b,
+  0x1f, 0x1f, 0x0f, 0x82, 0x1f, 0x0a, 0x1b, 0x2b, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x3b, 0x3b, 0x0f,
+  0x1d, 0x80, 0x1f, 0x03, 0x0f, 0x1f, 0x3b, 0x39, 0x81, 0x3b, 0x04, 0x39, 0x3b, 0x3b, 0x3f, 0x3b,
+  0x80, 0x3f, 0x01, 0x1b, 0x3b, 0x80, 0x1f, 0x01, 0x1b, 0x3b, 0x83, 0x1f, 0x02, 0x1b, 0x3b, 0x2b,
+  0x81, 0x3b, 0x80, 0x1f, 0x08, 0x0f, 0x1f, 0x1b, 0x3b, 0x3b, 0x3f, 0x1f, 0x3b, 0x3b, 0x80, 0x1f,
+  0x02, 0x1b, 0x3b, 0x3b, 0x80, 0x1f, 0x03, 0x1d, 0x1f, 0x1f, 0x1b, 0x82, 0x3f, 0x85, 0x3b, 0x01,
+  0x1f, 0x19, 0x83, 0x3b, 0x05, 0x39, 0x3b, 0x3b, 0x2b, 0x3f, 0x3f, 0x87, 0x1f, 0x00, 0x1b, 0x80,
+  0x3f, 0x01, 0x1f, 0x1d, 0x80, 0x1f, 0x00, 0x1b, 0x80, 0x3b, 0x03, 0x1d, 0x1f, 0x1f, 0x1b, 0x81,
+  0x3b, 0x0b, 0x1f, 0x1b, 0x3b, 0x3b, 0x1f, 0x1f, 0x1b, 0x3f, 0x1f, 0x3b, 0x3b, 0x39, 0x85, 0x3b,
+  0x00, 0x2b, 0x80, 0x3b, 0x01, 0x1f, 0x0f, 0x80, 0x1f, 0x84, 0x3b, 0x06, 0x2b, 0x1f, 0x1f, 0x0f,
+  0x1f, 0x1f, 0x1d, 0x80, 0x1f, 0x02, 0x3b, 0x3f, 0x3f, 0x82, 0x3b, 0x84, 0x1f, 0x01, 0x1b, 0x3b,
+  0x83, 0x1f, 0x03, 0x1d, 0x1f, 0x1b, 0x3b, 0x80, 0x3f, 0x11, 0x1f, 0x1b, 0x3b, 0x3b, 0x2b, 0x39,
+  0x3b, 0x3b, 0x1d, 0x1f, 0x1f, 0x1b, 0x39, 0x1f, 0x0f, 0x1f, 0x1b, 0x3b, 0x85, 0x1f, 0x00, 0x1b,
+  0x80, 0x3b, 0x80, 0x1f, 0x04, 0x3f, 0x3f, 0x1f, 0x3f, 0x3b, 0x81, 0x1f, 0x00, 0x1b, 0x81, 0x3b,
+  0x1c, 0x1f, 0x1f, 0x1b, 0x2b, 0x39, 0x3b, 0x3b, 0x1f, 0x1f, 0x3f, 0x3f, 0x3b, 0x3f, 0x1f, 0x39,
+  0x3b, 0x2b, 0x1d, 0x1f, 0x0f, 0x1f, 0x1f, 0x1b, 0x3b, 0x0f, 0x19, 0x3b, 0x2b, 0x3b, 0x80, 0x1f,
+  0x08, 0x0f, 0x1d, 0x1f, 0x0f, 0x1b, 0x3b, 0x3b, 0x39, 0x3b, 0x81, 0x3f, 0x1a, 0x1d, 0x1f, 0x0b,
+  0x39, 0x3b, 0x2b, 0x3b, 0x3b, 0x1f, 0x1b, 0x3b, 0x3b, 0x2b, 0x3b, 0x3b, 0x3f, 0x3f, 0x3b, 0x3f,
+  0x1f, 0x1b, 0x2b, 0x1d, 0x1b, 0x2b, 0x1f, 0x1f, 0x80, 0x3b, 0x03, 0x0f, 0x19, 0x3b, 0x0f, 0x83,
+  0x1f, 0x0d, 0x3f, 0x3b, 0x0f, 0x19, 0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x1f, 0x19, 0x3b, 0x3f, 0x1f,
+  0x83, 0x3b, 0x03, 0x2b, 0x39, 0x3b, 0x2b, 0x80, 0x3b, 0x16, 0x3f, 0x1f, 0x0f, 0x1b, 0x3b, 0x2b,
+  0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x3f, 0x1f, 0x3f, 0x3f, 0x1d, 0x1f, 0x1b, 0x2b, 0x1d, 0x1f, 0x1f,
+  0x1d, 0x80, 0x1f, 0x02, 0x19, 0x3b, 0x2b, 0x81, 0x3b, 0x10, 0x3f, 0x1f, 0x1d, 0x1f, 0x0b, 0x39,
+  0x3b, 0x1f, 0x1f, 0x3b, 0x0f, 0x1b, 0x39, 0x1f, 0x1b, 0x3b, 0x1f, 0x80, 0x3f, 0x07, 0x1f, 0x1f,
+  0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x0b, 0x80, 0x3b, 0x06, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x0f, 0x1d,
+  0x80, 0x1f, 0x08, 0x1b, 0x3b, 0x2b, 0x3f, 0x3b, 0x3f, 0x1b, 0x3b, 0x3f, 0x82, 0x1f, 0x03, 0x0f,
+  0x1f, 0x1b, 0x2b, 0x80, 0x3b, 0x06, 0x1f, 0x1d, 0x1f, 0x1f, 0x1d, 0x1b, 0x2b, 0x80, 0x3b, 0x07,
+  0x2b, 0x1f, 0x1d, 0x1b, 0x2b, 0x39, 0x3b, 0x3b, 0x81, 0x3f, 0x02, 0x1f, 0x1f, 0x1d, 0x82, 0x1f,
+  0x03, 0x0b, 0x3b, 0x3b, 0x3f, 0x81, 0x1f, 0x04, 0x1b, 0x3b, 0x39, 0x3b, 0x1f, 0x81, 0x3f, 0x81,
+  0x3b, 0x04, 0x1f, 0x1f, 0x1e, 0x3b, 0x39, 0x84, 0x3b, 0x04, 0x3e, 0x1f, 0x1b, 0x3b, 0x3b, 0x80,
+  0x1f, 0x07, 0x0f, 0x1f, 0x1e, 0x1f, 0x3b, 0x3f, 0x1f, 0x3f, 0x82, 0x1f, 0x09, 0x1e, 0x3b, 0x2b,
+  0x39, 0x3b, 0x3b, 0x1f, 0x0f, 0x1f, 0x1f, 0x80, 0x3f, 0x83, 0x3b, 0x02, 0x39, 0x3b, 0x33, 0x83,
+  0x3b, 0x05, 0x39, 0x1f, 0x1f, 0x17, 0x1f, 0x1b, 0x82, 0x3b, 0x02, 0x1f, 0x1f, 0x1e, 0x82, 0x1f,
+  0x05, 0x3f, 0x3f, 0x1f, 0x1f, 0x1e, 0x1d, 0x80, 0x1f, 0x08, 0x1b, 0x3b, 0x3b, 0x1f, 0x0f, 0x1f,
+  0x17, 0x1f, 0x1d, 0x80, 0x1f, 0x00, 0x1b, 0x80, 0x3b, 0x04, 0x33, 0x3f, 0x3f, 0x3b, 0x3b, 0x82,
+  0x1f, 0x06, 0x1e, 0x1f, 0x1b, 0x3b, 0x1f, 0x1f, 0x1b, 0x80, 0x3b, 0x03, 0x3a, 0x3b, 0x3f, 0x3f,
+  0x80, 0x1f, 0x04, 0x1b, 0x39, 0x3b, 0x3b, 0x33, 0x82, 0x3b, 0x09, 0x39, 0x3b, 0x3b, 0x3f, 0x3f,
+  0x3b, 0x0f, 0x1b, 0x3b, 0x3b, 0x80, 0x1f, 0x04, 0x0f, 0x1e, 0x1f, 0x1f, 0x1b, 0x84, 0x3b, 0x00,
+  0x33, 0x81, 0x3b, 0x80, 0x3f, 0x06, 0x1d, 0x1b, 0x33, 0x2b, 0x3b, 0x1f, 0x1b, 0x82, 0x3b, 0x02,
+  0x3e, 0x1f, 0x3b, 0x84, 0x1f, 0x00, 0x1e, 0x82, 0x1f, 0x09, 0x1b, 0x3b, 0x3b, 0x2b, 0x3f, 0x3b,
+  0x3f, 0x1f, 0x1f, 0x1b, 0x80, 0x3b, 0x02, 0x1d, 0x1f, 0x17, 0x80, 0x1f, 0x05, 0x17, 0x19, 0x3b,
+  0x3b, 0x1f, 0x1d, 0x80, 0x1f, 0x05, 0x3b, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f, 0x81, 0x3b, 0x01, 0x3a,
+  0x3a, 0x83, 0x3b, 0x04, 0x1f, 0x0f, 0x1f, 0x17, 0x33, 0x81, 0x3b, 0x01, 0x2b, 0x3b, 0x80, 0x1f,
+  0x00, 0x33, 0x80, 0x3f, 0x80, 0x1f, 0x02, 0x1b, 0x3b, 0x3a, 0x82, 0x3b, 0x00, 0x0f, 0x80, 0x1f,
+  0x82, 0x3f, 0x83, 0x1f, 0x03, 0x17, 0x3b, 0x3b, 0x0f, 0x83, 0x1f, 0x02, 0x1e, 0x3b, 0x39, 0x84,
+  0x3b, 0x03, 0x2a, 0x3f, 0x1f, 0x1d, 0x80, 0x1f, 0x06, 0x3f, 0x1f, 0x39, 0x3b, 0x37, 0x1f, 0x1b,
+  0x83, 0x3b, 0x02, 0x1f, 0x17, 0x33, 0x84, 0x3b, 0x05, 0x1f, 0x1e, 0x3f, 0x3f, 0x1f, 0x3f, 0x83,
+  0x1f, 0x04, 0x33, 0x3b, 0x39, 0x3b, 0x39, 0x80, 0x3b, 0x04, 0x2b, 0x1f, 0x33, 0x37, 0x3f, 0x84,
+  0x3b, 0x00, 0x3e, 0x81, 0x1f, 0x00, 0x1d, 0x81, 0x1f, 0x00, 0x3f, 0x82, 0x3b, 0x82, 0x1f, 0x00,
+  0x33, 0x84, 0x3b, 0x05, 0x1f, 0x1d, 0x17, 0x3b, 0x3b, 0x2b, 0x80, 0x3f, 0x06, 0x1b, 0x1b, 0x3b,
+  0x3e, 0x3b, 0x3b, 0x1d, 0x80, 0x1f, 0x11, 0x1d, 0x1f, 0x1f, 0x1e, 0x1f, 0x1f, 0x0f, 0x1f, 0x1d,
+  0x1f, 0x1b, 0x3b, 0x3b, 0x0f, 0x37, 0x17, 0x1f, 0x0f, 0x83, 0x1f, 0x0e, 0x3f, 0x3f, 0x3b, 0x3b,
+  0x39, 0x3b, 0x3b, 0x1d, 0x1f, 0x1f, 0x1e, 0x3a, 0x3b, 0x39, 0x1f, 0x81, 0x3b, 0x00, 0x2b, 0x81,
+  0x3b, 0x0b, 0x1e, 0x33, 0x3f, 0x3f, 0x1f, 0x3b, 0x3f, 0x0f, 0x1f, 0x0f, 0x1f, 0x37, 0x81, 0x1f,
+  0x01, 0x0b, 0x39, 0x80, 0x3b, 0x04, 0x3e, 0x1f, 0x1d, 0x1b, 0x39, 0x82, 0x3b, 0x0e, 0x33, 0x37,
+  0x1b, 0x3b, 0x3f, 0x3b, 0x3b, 0x1d, 0x1f, 0x0f, 0x1f, 0x36, 0x1f, 0x1f, 0x1b, 0x81, 0x3b, 0x0d,
+  0x2b, 0x1b, 0x3f, 0x3b, 0x3f, 0x1f, 0x3b, 0x2b, 0x39, 0x3b, 0x0f, 0x1f, 0x3a, 0x33, 0x81, 0x3b,
+  0x39, 0x0f, 0x19, 0x3b, 0x3b, 0x3e, 0x1e, 0x1f, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x1f,
+  0x33, 0x33, 0x3b, 0x3b, 0x39, 0x3b, 0x3f, 0x3f, 0x3b, 0x3b, 0x33, 0x37, 0x1f, 0x1d, 0x1b, 0x2b,
+  0x39, 0x3b, 0x2b, 0x3b, 0x3a, 0x3b, 0x3b, 0x1f, 0x1b, 0x2b, 0x1d, 0x1f, 0x3f, 0x3b, 0x3a, 0x3a,
+  0x3f, 0x3f, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x37, 0x17, 0x81, 0x1f, 0x00, 0x1d, 0x81,
+  0x1f, 0x0e, 0x3f, 0x3b, 0x3f, 0x1f, 0x19, 0x3b, 0x2b, 0x3b, 0x3b, 0x33, 0x3e, 0x1f, 0x1f, 0x0f,
+  0x1b, 0x80, 0x3b, 0x02, 0x3f, 0x3f, 0x1e, 0x80, 0x3b, 0x11, 0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x3b,
+  0x37, 0x17, 0x0f, 0x1d, 0x1f, 0x0b, 0x39, 0x3b, 0x2b, 0x3b, 0x3a, 0x33, 0x80, 0x3b, 0x11, 0x3f,
+  0x1f, 0x3f, 0x3d, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x1d, 0x1f, 0x0f, 0x1b, 0x3b, 0x1f, 0x1f, 0x17,
+  0x33, 0x81, 0x3b, 0x04, 0x2b, 0x39, 0x3b, 0x3b, 0x33, 0x82, 0x3b, 0x05, 0x2b, 0x39, 0x1f, 0x1b,
+  0x33, 0x33, 0x81, 0x3b, 0x05, 0x2b, 0x3b, 0x39, 0x3b, 0x3f, 0x17, 0x80, 0x3b, 0x02, 0x37, 0x1f,
+  0x1d, 0x80, 0x1f, 0x05, 0x1d, 0x1f, 0x0f, 0x3b, 0x3e, 0x1f, 0x81, 0x3f, 0x80, 0x1f, 0x04, 0x1e,
+  0x1e, 0x3b, 0x2b, 0x1d, 0x83, 0x1f, 0x01, 0x17, 0x3a, 0x81, 0x3b, 0x05, 0x1f, 0x0f, 0x1d, 0x1f,
+  0x3f, 0x17, 0x80, 0x1f, 0x01, 0x3b, 0x39, 0x80, 0x3b, 0x0b, 0x33, 0x3b, 0x33, 0x2b, 0x3b, 0x2b,
+  0x3b, 0x3b, 0x1f, 0x1f, 0x3e, 0x1f, 0x80, 0x3f, 0x01, 0x1f, 0x1b, 0x81, 0x3b, 0x04, 0x37, 0x1e,
+  0x1f, 0x1f, 0x0f, 0x81, 0x1f, 0x0c, 0x0f, 0x17, 0x33, 0x3b, 0x3b, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b,
+  0x3b, 0x3a, 0x3e, 0x82, 0x1f, 0x05, 0x3f, 0x1f, 0x3b, 0x3f, 0x17, 0x17, 0x81, 0x1f, 0x00, 0x1b,
+  0x80, 0x3b, 0x02, 0x37, 0x17, 0x1d, 0x85, 0x1f, 0x0d, 0x17, 0x3f, 0x1f, 0x3b, 0x2b, 0x1f, 0x1b,
+  0x3b, 0x1f, 0x1e, 0x1e, 0x3b, 0x3b, 0x39, 0x80, 0x3b, 0x07, 0x1f, 0x1f, 0x1e, 0x33, 0x3f, 0x3f,
+  0x3b, 0x2b, 0x80, 0x3b, 0x0f, 0x1d, 0x1f, 0x1e, 0x3b, 0x39, 0x3b, 0x1f, 0x1f, 0x19, 0x3b, 0x0f,
+  0x1b, 0x3a, 0x3a, 0x3b, 0x39, 0x81, 0x3b, 0x05, 0x1f, 0x1f, 0x1e, 0x1e, 0x3b, 0x3b, 0x84, 0x1f,
+  0x03, 0x37, 0x1e, 0x1f, 0x1f, 0x80, 0x3f, 0x04, 0x1b, 0x1b, 0x3b, 0x37, 0x17, 0x83, 0x3b, 0x07,
+  0x39, 0x3b, 0x3e, 0x3a, 0x3b, 0x1f, 0x1f, 0x3f, 0x82, 0x1f, 0x04, 0x17, 0x33, 0x3b, 0x1f, 0x0b,
+  0x81, 0x3b, 0x04, 0x3f, 0x1e, 0x3b, 0x3b, 0x0f, 0x83, 0x1f, 0x01, 0x17, 0x3a, 0x80, 0x3b, 0x80,
+  0x1f, 0x0e, 0x1b, 0x3b, 0x2b, 0x1f, 0x1b, 0x3b, 0x3a, 0x3b, 0x3b, 0x1f, 0x1f, 0x3b, 0x3f, 0x3b,
+  0x2b, 0x80, 0x3b, 0x80, 0x1f, 0x05, 0x1b, 0x3b, 0x3b, 0x39, 0x3b, 0x0f, 0x80, 0x1f, 0x02, 0x1d,
+  0x1b, 0x39, 0x80, 0x3b, 0x05, 0x1f, 0x13, 0x3b, 0x3b, 0x2b, 0x3b, 0x83, 0x1f, 0x00, 0x17, 0x83,
+  0x1f, 0x07, 0x0f, 0x1f, 0x1b, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x84, 0x1f, 0x03, 0x1d, 0x1f, 0x1b,
+  0x2b, 0x80, 0x3b, 0x8b, 0x1f, 0x01, 0x0b, 0x39, 0x80, 0x1f, 0x05, 0x3f, 0x3f, 0x1b, 0x3f, 0x1f,
+  0x1d, 0x84, 0x1f, 0x81, 0x3b, 0x02, 0x2b, 0x3b, 0x3b, 0x80, 0x3f, 0x03, 0x17, 0x3b, 0x3f, 0x3f,
+  0x86, 0x1f, 0x0e, 0x0b, 0x3b, 0x1f, 0x0b, 0x3b, 0x39, 0x1f, 0x0f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f,
+  0x1f, 0x1b, 0x81, 0x3b, 0x00, 0x33, 0x80, 0x3b, 0x00, 0x2b, 0x82, 0x3b, 0x03, 0x3f, 0x1f, 0x1b,
+  0x3b, 0x81, 0x1f, 0x00, 0x0b, 0x86, 0x3b, 0x0a, 0x1f, 0x1f, 0x1b, 0x3f, 0x0f, 0x1f, 0x3f, 0x1f,
+  0x3b, 0x39, 0x3f, 0x81, 0x1f, 0x1a, 0x0f, 0x1b, 0x3b, 0x1f, 0x0f, 0x1f, 0x1f, 0x1b, 0x3b, 0x3b,
+  0x3f, 0x3f, 0x1f, 0x3b, 0x1f, 0x1b, 0x3b, 0x3b, 0x3f, 0x1f, 0x1d, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f,
+  0x1d, 0x82, 0x1f, 0x0c, 0x1d, 0x1b, 0x3b, 0x0f, 0x1b, 0x3b, 0x3a, 0x3b, 0x3b, 0x1d, 0x1f, 0x1f,
+  0x0b, 0x88, 0x3b, 0x81, 0x3f, 0x01, 0x1f, 0x1d, 0x82, 0x1f, 0x02, 0x1d, 0x1f, 0x1b, 0x87, 0x3b,
+  0x84, 0x1f, 0x04, 0x1d, 0x1f, 0x1f, 0x1b, 0x39, 0x82, 0x3b, 0x0f, 0x2b, 0x3b, 0x0f, 0x1f, 0x1f,
+  0x19, 0x3b, 0x3b, 0x1f, 0x3f, 0x3b, 0x3b, 0x39, 0x3b, 0x0f, 0x19, 0x85, 0x3b, 0x00, 0x39, 0x80,
+  0x3b, 0x08, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x39, 0x83, 0x3b, 0x01, 0x2b, 0x3f,
+  0x83, 0x3b, 0x06, 0x1f, 0x0b, 0x3b, 0x2b, 0x39, 0x1f, 0x0b, 0x82, 0x3b, 0x0d, 0x1d, 0x1f, 0x1f,
+  0x3f, 0x19, 0x3b, 0x3f, 0x3b, 0x3f, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x8a, 0x3b, 0x06, 0x3f, 0x3f,
+  0x1f, 0x1f, 0x1d, 0x1f, 0x1d, 0x88, 0x1f, 0x08, 0x0f, 0x1f, 0x1b, 0x39, 0x3b, 0x3b, 0x2b, 0x3b,
+  0x2b, 0x82, 0x3b, 0x05, 0x0f, 0x1f, 0x0b, 0x39, 0x1f, 0x0f, 0x80, 0x1f, 0x01, 0x1b, 0x3b, 0x80,
+  0x3f, 0x03, 0x1f, 0x1f, 0x1b, 0x2b, 0x81, 0x3b, 0x00, 0x39, 0x81, 0x3b, 0x0d, 0x2b, 0x3b, 0x3b,
+  0x3f, 0x3b, 0x3f, 0x3f, 0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x1b, 0x39, 0x81, 0x3b, 0x02, 0x1d, 0x1b,
+  0x3b, 0x80, 0x1f, 0x02, 0x0f, 0x1f, 0x1b, 0x80, 0x3b, 0x03, 0x39, 0x3b, 0x3b, 0x39, 0x83, 0x3b,
+  0x00, 0x39, 0x80, 0x3b, 0x10, 0x39, 0x3b, 0x1d, 0x1f, 0x0f, 0x1d, 0x1b, 0x1f, 0x3b, 0x3f, 0x3b,
+  0x3b, 0x1f, 0x0f, 0x1d, 0x1b, 0x2b, 0x84, 0x3b, 0x01, 0x2b, 0x1d, 0x83, 0x1f, 0x04, 0x0f, 0x1d,
+  0x1f, 0x0f, 0x1b, 0x82, 0x3b, 0x06, 0x1f, 0x1f, 0x0f, 0x1d, 0x1b, 0x3b, 0x1f, 0x82, 0x3b, 0x06,
+  0x39, 0x3b, 0x3b, 0x3f, 0x3f, 0x1f, 0x1f, 0x80, 0x3b, 0x02, 0x39, 0x3b, 0x2b, 0x81, 0x1f, 0x80,
+  0x3b, 0x02, 0x2b, 0x3b, 0x3b, 0x83, 0x1f, 0x02, 0x1b, 0x3b, 0x39, 0x82, 0x3b, 0x80, 0x3f, 0x02,
+  0x1d, 0x1f, 0x1d, 0x86, 0x1f, 0x02, 0x0f, 0x1d, 0x1b, 0x80, 0x3b, 0x06, 0x3f, 0x1f, 0x3f, 0x1f,
+  0x1b, 0x3f, 0x3f, 0x82, 0x1f, 0x05, 0x0f, 0x1d, 0x1f, 0x0f, 0x1f, 0x0f, 0x84, 0x1f, 0x01, 0x3f,
+  0x3f, 0x83, 0x3b, 0x08, 0x1d, 0x1f, 0x0f, 0x19, 0x3b, 0x0f, 0x1f, 0x1f, 0x1d, 0x80, 0x1f, 0x00,
+  0x0f, 0x85, 0x1f, 0x01, 0x0f, 0x1d, 0x82, 0x1f, 0x80, 0x3b, 0x05, 0x0f, 0x1d, 0x1f, 0x1f, 0x3f,
+  0x1f, 0x84, 0x3b, 0x00, 0x2b, 0x85, 0x1f, 0x01, 0x0f, 0x1f, 0x80, 0x3f, 0x80, 0x1f, 0x03, 0x1b,
+  0x3b, 0x2b, 0x3b, 0x85, 0x1f, 0x00, 0x1d, 0x86, 0x1f, 0x0a, 0x0f, 0x1b, 0x39, 0x3b, 0x3b, 0x1f,
+  0x1f, 0x0f, 0x1f, 0x1e, 0x3a, 0x84, 0x3b, 0x03, 0x3f, 0x1f, 0x17, 0x3b, 0x85, 0x1f, 0x04, 0x17,
+  0x37, 0x1d, 0x1f, 0x0f, 0x80, 0x1f, 0x04, 0x1b, 0x2b, 0x3e, 0x1e, 0x39, 0x82, 0x3b, 0x06, 0x39,
+  0x3b, 0x3a, 0x3e, 0x3b, 0x3b, 0x39, 0x83, 0x3b, 0x01, 0x37, 0x17, 0x81, 0x1f, 0x00, 0x1b, 0x80,
+  0x3b, 0x01, 0x33, 0x33, 0x80, 0x3b, 0x80, 0x1f, 0x06, 0x1d, 0x1f, 0x1e, 0x3f, 0x3f, 0x3b, 0x0f,
+  0x81, 0x1f, 0x02, 0x1b, 0x3a, 0x3e, 0x81, 0x1f, 0x07, 0x1b, 0x3b, 0x2b, 0x1f, 0x1f, 0x17, 0x3f,
+  0x3f, 0x80, 0x3b, 0x05, 0x1f, 0x1f, 0x0f, 0x1f, 0x3a, 0x3e, 0x84, 0x1f, 0x11, 0x0f, 0x1e, 0x3e,
+  0x3f, 0x3f, 0x3b, 0x39, 0x3b, 0x3f, 0x3b, 0x39, 0x3b, 0x37, 0x17, 0x1f, 0x1b, 0x3b, 0x3b, 0x81,
+  0x1f, 0x0b, 0x33, 0x37, 0x1d, 0x1b, 0x2b, 0x3f, 0x1f, 0x3b, 0x39, 0x1f, 0x1e, 0x3a, 0x81, 0x3b,
+  0x81, 0x1f, 0x01, 0x1e, 0x3a, 0x83, 0x3b, 0x04, 0x39, 0x3b, 0x3b, 0x33, 0x33, 0x83, 0x3b, 0x03,
+  0x2b, 0x3b, 0x33, 0x37, 0x83, 0x1f, 0x18, 0x3f, 0x3f, 0x1e, 0x1e, 0x1f, 0x0f, 0x1f, 0x0b, 0x3b,
+  0x1f, 0x1d, 0x1f, 0x1e, 0x3a, 0x3b, 0x3b, 0x1f, 0x0f, 0x3f, 0x3f, 0x3b, 0x3f, 0x1f, 0x17, 0x33,
+  0x83, 0x3b, 0x10, 0x0f, 0x1f, 0x1e, 0x3e, 0x1f, 0x0f, 0x1f, 0x1b, 0x3b, 0x3b, 0x0f, 0x1f, 0x3a,
+  0x3e, 0x1f, 0x1f, 0x1b, 0x80, 0x3b, 0x16, 0x1f, 0x0f, 0x1d, 0x1f, 0x1b, 0x3b, 0x3e, 0x1f, 0x37,
+  0x1f, 0x1d, 0x1f, 0x1b, 0x3b, 0x1f, 0x1f, 0x1e, 0x3f, 0x17, 0x3b, 0x39, 0x3b, 0x3b, 0x81, 0x1f,
+  0x05, 0x33, 0x3a, 0x3b, 0x3b, 0x1f, 0x0b, 0x81, 0x3b, 0x25, 0x33, 0x37, 0x1f, 0x1f, 0x1b, 0x3b,
+  0x1f, 0x1b, 0x3b, 0x3b, 0x3e, 0x1f, 0x17, 0x0f, 0x1f, 0x1b, 0x3b, 0x1f, 0x1f, 0x0f, 0x1e, 0x3a,
+  0x3f, 0x1f, 0x0f, 0x1d, 0x1b, 0x39, 0x3b, 0x2b, 0x3b, 0x3f, 0x3e, 0x1f, 0x1f, 0x1d, 0x1f, 0x1b,
+  0x80, 0x3b, 0x00, 0x3a, 0x80, 0x3f, 0x21, 0x1f, 0x1b, 0x3b, 0x0f, 0x1d, 0x1f, 0x1e, 0x3b, 0x37,
+  0x1f, 0x0f, 0x1d, 0x1f, 0x1b, 0x3b, 0x39, 0x3b, 0x37, 0x17, 0x3b, 0x3f, 0x3b, 0x39, 0x3b, 0x3b,
+  0x1f, 0x1f, 0x17, 0x33, 0x3b, 0x39, 0x3b, 0x0f, 0x1b, 0x80, 0x3b, 0x0b, 0x3a, 0x3b, 0x3f, 0x3f,
+  0x3b, 0x1f, 0x1f, 0x3b, 0x3f, 0x1f, 0x1e, 0x1e, 0x84, 0x3b, 0x03, 0x1f, 0x1f, 0x17, 0x3a, 0x80,
+  0x3b, 0x08, 0x1f, 0x3f, 0x3f, 0x1f, 0x3b, 0x37, 0x17, 0x3b, 0x39, 0x83, 0x3b, 0x18, 0x3e, 0x1f,
+  0x33, 0x3b, 0x3b, 0x0f, 0x1f, 0x0f, 0x1f, 0x1b, 0x3a, 0x3f, 0x37, 0x1f, 0x0f, 0x1b, 0x3b, 0x1d,
+  0x1f, 0x1b, 0x3b, 0x37, 0x3a, 0x3b, 0x2b, 0x80, 0x3b, 0x04, 0x3f, 0x3f, 0x1f, 0x17, 0x3e, 0x81,
+  0x3b, 0x00, 0x2b, 0x80, 0x3b, 0x03, 0x3a, 0x3b, 0x37, 0x1d, 0x80, 0x1f, 0x0a, 0x3b, 0x3f, 0x3f,
+  0x1f, 0x33, 0x3e, 0x1f, 0x1d, 0x1f, 0x1f, 0x1d, 0x80, 0x1f, 0x0e, 0x33, 0x33, 0x3b, 0x3b, 0x39,
+  0x3b, 0x39, 0x3b, 0x3b, 0x2b, 0x3e, 0x1f, 0x33, 0x3b, 0x2b, 0x87, 0x3b, 0x0b, 0x33, 0x3b, 0x0f,
+  0x1b, 0x3b, 0x2b, 0x39, 0x3b, 0x0f, 0x1f, 0x17, 0x33, 0x80, 0x1f, 0x05, 0x0f, 0x1d, 0x1b, 0x2b,
+  0x3b, 0x3e, 0x82, 0x1f, 0x00, 0x1d, 0x80, 0x1f, 0x07, 0x3f, 0x17, 0x1f, 0x1f, 0x0f, 0x1d, 0x1f,
+  0x0f, 0x80, 0x1f, 0x00, 0x33, 0x80, 0x3b, 0x02, 0x39, 0x3b, 0x2b, 0x80, 0x3b, 0x03, 0x3e, 0x1e,
+  0x1f, 0x1b, 0x82, 0x3b, 0x11, 0x3a, 0x3a, 0x3b, 0x3b, 0x2b, 0x3b, 0x3b, 0x2b, 0x39, 0x1f, 0x1f,
+  0x37, 0x1f, 0x3f, 0x1f, 0x3b, 0x3b, 0x2b, 0x80, 0x3b, 0x0e, 0x3f, 0x17, 0x1f, 0x1f, 0x1b, 0x3b,
+  0x3b, 0x2b, 0x3b, 0x3b, 0x3f, 0x17, 0x1f, 0x3f, 0x3b, 0x80, 0x1f, 0x05, 0x0f, 0x1f, 0x1f, 0x3a,
+  0x3f, 0x17, 0x80, 0x1f, 0x00, 0x1d, 0x80, 0x1f, 0x03, 0x3f, 0x17, 0x3f, 0x1f, 0x80, 0x3b, 0x0e,
+  0x1f, 0x1b, 0x3b, 0x3f, 0x33, 0x37, 0x1f, 0x1d, 0x1b, 0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x3e, 0x81,
+  0x1f, 0x16, 0x3f, 0x1f, 0x3b, 0x3b, 0x1f, 0x1f, 0x33, 0x3b, 0x3b, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f,
+  0x1f, 0x1f, 0x33, 0x3b, 0x39, 0x1f, 0x1f, 0x1b, 0x3b, 0x80, 0x1f, 0x04, 0x33, 0x3b, 0x3b, 0x1f,
+  0x1d, 0x82, 0x1f, 0x00, 0x1e, 0x80, 0x1f, 0x06, 0x19, 0x3b, 0x0f, 0x1f, 0x1b, 0x3b, 0x3a, 0x80,
+  0x3b, 0x80, 0x1f, 0x00, 0x1d, 0x80, 0x1f, 0x00, 0x37, 0x80, 0x1f, 0x81, 0x3f, 0x02, 0x1b, 0x3a,
+  0x3e, 0x80, 0x1f, 0x00, 0x1b, 0x81, 0x3b, 0x0c, 0x2b, 0x3e, 0x1f, 0x33, 0x3b, 0x1f, 0x1f, 0x1b,
+  0x3b, 0x3b, 0x1f, 0x1e, 0x3a, 0x80, 0x3b, 0x02, 0x1d, 0x1f, 0x0f, 0x80, 0x1f, 0x04, 0x1b, 0x3b,
+  0x2b, 0x3a, 0x3e, 0x86, 0x3b, 0x04, 0x3e, 0x1f, 0x1d, 0x1b, 0x3b, 0x82, 0x1f, 0x03, 0x17, 0x33,
+  0x3b, 0x0f, 0x80, 0x1f, 0x04, 0x1b, 0x39, 0x3b, 0x1e, 0x3a, 0x84, 0x3b, 0x05, 0x0f, 0x1f, 0x17,
+  0x37, 0x1f, 0x0f, 0x81, 0x1f, 0x0f, 0x1b, 0x3b, 0x33, 0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x3b,
+  0x1f, 0x1f, 0x1e, 0x3a, 0x3b, 0x3b, 0x83, 0x1f, 0x03, 0x1a, 0x3e, 0x3f, 0x3f, 0x81, 0x1f, 0x04,
+  0x1b, 0x3b, 0x3b, 0x37, 0x33, 0x86, 0x3b, 0x05, 0x37, 0x1f, 0x3f, 0x1d, 0x1b, 0x3b, 0x81, 0x1f,
+  0x02, 0x17, 0x1f, 0x1b, 0x81, 0x3b, 0x0c, 0x39, 0x1f, 0x13, 0x37, 0x3f, 0x3f, 0x3b, 0x39, 0x3b,
+  0x2b, 0x3b, 0x2b, 0x3a, 0x80, 0x3b, 0x84, 0x1f, 0x0b, 0x17, 0x33, 0x39, 0x3b, 0x39, 0x1f, 0x3f,
+  0x3b, 0x39, 0x3b, 0x3e, 0x1e, 0x82, 0x3b, 0x04, 0x1f, 0x1b, 0x2b, 0x3a, 0x3e, 0x84, 0x1f, 0x03,
+  0x1d, 0x1f, 0x17, 0x17, 0x82, 0x1f, 0x04, 0x1b, 0x2b, 0x3b, 0x3e, 0x3a, 0x83, 0x3b, 0x06, 0x3f,
+  0x0f, 0x1e, 0x3e, 0x1f, 0x1f, 0x1d, 0x80, 0x1f, 0x14, 0x1b, 0x2b, 0x3b, 0x33, 0x33, 0x3b, 0x3b,
+  0x3f, 0x1f, 0x3f, 0x1f, 0x0f, 0x1f, 0x3b, 0x37, 0x1d, 0x1f, 0x1f, 0x19, 0x3b, 0x1d, 0x80, 0x1f,
+  0x02, 0x33, 0x3b, 0x2b, 0x83, 0x3b, 0x03, 0x3a, 0x3f, 0x1f, 0x0b, 0x83, 0x3b, 0x01, 0x1f, 0x0f,
+  0x80, 0x1f, 0x03, 0x33, 0x1f, 0x1f, 0x1d, 0x82, 0x1f, 0x00, 0x1e, 0x81, 0x3b, 0x00, 0x2b, 0x81,
+  0x3b, 0x01, 0x2b, 0x3e, 0x80, 0x1f, 0x09, 0x19, 0x3b, 0x3f, 0x3f, 0x1f, 0x1f, 0x3b, 0x37, 0x1d,
+  0x1b, 0x80, 0x3b, 0x80, 0x1f, 0x0e, 0x1e, 0x3b, 0x1b, 0x3b, 0x1f, 0x1f, 0x1b, 0x3b, 0x0f, 0x1d,
+  0x1f, 0x3e, 0x1f, 0x1f, 0x1d, 0x80, 0x1f, 0x10, 0x0f, 0x1d, 0x1f, 0x3a, 0x3f, 0x1f, 0x1f, 0x0f,
+  0x1b, 0x3b, 0x3b, 0x39, 0x3b, 0x3f, 0x17, 0x1f, 0x3f, 0x81, 0x3b, 0x10, 0x2b, 0x39, 0x3b, 0x33,
+  0x3b, 0x2b, 0x39, 0x3b, 0x1f, 0x1f, 0x0f, 0x1b, 0x3a, 0x3e, 0x1b, 0x3b, 0x3f, 0x81, 0x1f, 0x11,
+  0x0b, 0x3b, 0x37, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x1f, 0x1b, 0x3b, 0x3b, 0x3f, 0x17, 0x1f, 0x3f,
+  0x3b, 0x3b, 0x82, 0x1f, 0x0b, 0x37, 0x17, 0x0f, 0x1f, 0x1f, 0x1b, 0x3b, 0x1f, 0x1f, 0x0f, 0x3a,
+  0x3f, 0x80, 0x1f, 0x00, 0x3f, 0x82, 0x1f, 0x04, 0x33, 0x1d, 0x1f, 0x1f, 0x1b, 0x82, 0x3b, 0x06,
+  0x3a, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x80, 0x3b, 0x05, 0x3e, 0x3b, 0x2b, 0x39, 0x3b, 0x39,
+  0x81, 0x3b, 0x03, 0x33, 0x3f, 0x1f, 0x0f, 0x80, 0x1f, 0x09, 0x0f, 0x1b, 0x3b, 0x3b, 0x33, 0x39,
+  0x3b, 0x3b, 0x1f, 0x0b, 0x80, 0x3b, 0x07, 0x3e, 0x1f, 0x3b, 0x0f, 0x1f, 0x3f, 0x3f, 0x1f, 0x80,
+  0x3b, 0x04, 0x37, 0x1b, 0x3b, 0x3b, 0x2b, 0x80, 0x3b, 0x02, 0x1f, 0x1f, 0x17, 0x80, 0x1f, 0x1f,
+  0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x1d, 0x1f, 0x33, 0x3b, 0x3b, 0x39, 0x3b, 0x1f, 0x1b, 0x2b, 0x1f,
+  0x3b, 0x3b, 0x2b, 0x1f, 0x1e, 0x1f, 0x3b, 0x2b, 0x3b, 0x3b, 0x1f, 0x19, 0x3b, 0x2b, 0x3b, 0x3e,
+  0x82, 0x1f, 0x05, 0x0f, 0x1d, 0x1b, 0x3b, 0x3b, 0x37, 0x83, 0x1f, 0x02, 0x3b, 0x3b, 0x1e, 0x80,
+  0x1f, 0x0c, 0x1d, 0x1b, 0x39, 0x3b, 0x2b, 0x3b, 0x3b, 0x3e, 0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x81,
+  0x3b, 0x00, 0x3a, 0x81, 0x3b, 0x01, 0x1f, 0x1b, 0x80, 0x3b, 0x11, 0x1f, 0x33, 0x39, 0x1f, 0x1f,
+  0x1d, 0x1f, 0x0f, 0x1f, 0x1b, 0x3a, 0x3f, 0x1f, 0x3f, 0x3f, 0x0f, 0x1d, 0x1b, 0x80, 0x3b, 0x0b,
+  0x3e, 0x1f, 0x1f, 0x1b, 0x3b, 0x39, 0x3b, 0x1f, 0x1d, 0x1f, 0x1f, 0x37, 0x81, 0x1f, 0x05, 0x1d,
+  0x1f, 0x1f, 0x0f, 0x1f, 0x17, 0x83, 0x1f, 0x06, 0x0f, 0x1f, 0x1e, 0x3b, 0x3f, 0x3f, 0x1d, 0x80,
+  0x1f, 0x03, 0x0f, 0x1b, 0x3b, 0x33, 0x80, 0x3b, 0x17, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x3b, 0x1e,
+  0x3b, 0x1f, 0x19, 0x3b, 0x1f, 0x3b, 0x39, 0x3b, 0x3b, 0x3a, 0x3f, 0x1f, 0x1f, 0x0f, 0x1d, 0x1f,
+  0x0f, 0x80, 0x1f, 0x02, 0x37, 0x1f, 0x0f, 0x81, 0x1f, 0x03, 0x1d, 0x1f, 0x1f, 0x17, 0x80, 0x1f,
+  0x03, 0x1b, 0x3b, 0x1f, 0x0f, 0x80, 0x1f, 0x04, 0x17, 0x1f, 0x1b, 0x3b, 0x39, 0x81, 0x3b, 0x03,
+  0x3a, 0x3f, 0x1f, 0x1d, 0x83, 0x1f, 0x07, 0x1b, 0x3e, 0x1f, 0x3b, 0x3f, 0x3b, 0x3f, 0x3f, 0x81,
+  0x1f, 0x02, 0x33, 0x3b, 0x3b, 0x84, 0x1f, 0x06, 0x33, 0x3b, 0x3b, 0x1f, 0x1b, 0x3b, 0x3b, 0x80,
+  0x1f, 0x00, 0x1e, 0x81, 0x1f, 0x03, 0x1d, 0x1f, 0x1f, 0x3f, 0x80, 0x1f, 0x0e, 0x1d, 0x1f, 0x33,
+  0x3b, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x1b, 0x3b, 0x3b, 0x33, 0x3b, 0x39, 0x80, 0x3b, 0x81, 0x1f,
+  0x05, 0x17, 0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x80, 0x3f, 0x02, 0x3b, 0x3f, 0x33, 0x84, 0x3b, 0x05,
+  0x39, 0x3b, 0x33, 0x3b, 0x3b, 0x39, 0x83, 0x1f, 0x04, 0x17, 0x3b, 0x39, 0x1f, 0x1d, 0x82, 0x1f,
+  0x00, 0x33, 0x83, 0x3b, 0x07, 0x1f, 0x1b, 0x2f, 0x1f, 0x33, 0x3b, 0x3f, 0x1f, 0x81, 0x3b, 0x01,
+  0x1f, 0x1e, 0x81, 0x3b, 0x00, 0x39, 0x82, 0x3b, 0x04, 0x37, 0x1b, 0x2b, 0x3b, 0x39, 0x82, 0x3b,
+  0x18, 0x3a, 0x3f, 0x1f, 0x1b, 0x3b, 0x3b, 0x39, 0x3b, 0x3b, 0x39, 0x3b, 0x37, 0x3b, 0x3f, 0x3b,
+  0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x3e, 0x1f, 0x1f, 0x0b, 0x81, 0x3b, 0x03, 0x1f, 0x1f, 0x3b,
+  0x33, 0x83, 0x3b, 0x05, 0x1f, 0x0f, 0x1f, 0x17, 0x1f, 0x1b, 0x81, 0x3b, 0x09, 0x39, 0x1f, 0x1f,
+  0x17, 0x1f, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x80, 0x3b, 0x02, 0x3e, 0x1f, 0x1b, 0x82, 0x3b, 0x02,
+  0x39, 0x3b, 0x3e, 0x80, 0x3b, 0x27, 0x2b, 0x1f, 0x1b, 0x3b, 0x2b, 0x3b, 0x3f, 0x17, 0x1f, 0x1b,
+  0x3b, 0x2b, 0x3b, 0x2b, 0x39, 0x3b, 0x3f, 0x17, 0x1f, 0x1f, 0x3f, 0x3f, 0x3b, 0x1b, 0x39, 0x3b,
+  0x2b, 0x33, 0x3b, 0x39, 0x1f, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f, 0x1f, 0x1e, 0x3b, 0x39, 0x81, 0x3b,
+  0x07, 0x1f, 0x1d, 0x1f, 0x1e, 0x3f, 0x1d, 0x1f, 0x1b, 0x80, 0x3b, 0x03, 0x3f, 0x1f, 0x1f, 0x1b,
+  0x80, 0x3b, 0x05, 0x3a, 0x3b, 0x3b, 0x2b, 0x1f, 0x1d, 0x81, 0x1f, 0x1f, 0x17, 0x37, 0x1f, 0x1b,
+  0x3b, 0x0f, 0x1f, 0x1b, 0x3b, 0x3b, 0x3f, 0x17, 0x1f, 0x1f, 0x0f, 0x1f, 0x1b, 0x3f, 0x1f, 0x3f,
+  0x3e, 0x1f, 0x1f, 0x1d, 0x1f, 0x1d, 0x1f, 0x1b, 0x3b, 0x1f, 0x1f, 0x17, 0x80, 0x3b, 0x00, 0x39,
+  0x80, 0x3b, 0x02, 0x2b, 0x3b, 0x3e, 0x82, 0x1f, 0x08, 0x0f, 0x19, 0x3b, 0x0f, 0x1f, 0x33, 0x3b,
+  0x3b, 0x39, 0x82, 0x1f, 0x00, 0x1e, 0x80, 0x1f, 0x01, 0x3f, 0x3f, 0x80, 0x1f, 0x05, 0x0f, 0x1f,
+  0x1e, 0x1f, 0x1f, 0x0f, 0x80, 0x1f, 0x04, 0x1d, 0x1f, 0x1f, 0x3b, 0x37, 0x80, 0x1f, 0x01, 0x19,
+  0x3b, 0x81, 0x1f, 0x04, 0x33, 0x3b, 0x39, 0x3b, 0x0f, 0x82, 0x1f, 0x02, 0x17, 0x1f, 0x3f, 0x81,
+  0x3b, 0x80, 0x1f, 0x00, 0x17, 0x84, 0x1f, 0x08, 0x1d, 0x1f, 0x1e, 0x3f, 0x1d, 0x1f, 0x1f, 0x0f,
+  0x1d, 0x80, 0x1f, 0x0b, 0x1e, 0x3f, 0x1f, 0x0f, 0x1f, 0x1f, 0x1b, 0x3b, 0x1f, 0x1d, 0x1f, 0x1e,
+  0x80, 0x3b, 0x11, 0x39, 0x3b, 0x2b, 0x3b, 0x1d, 0x1f, 0x1e, 0x1f, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f,
+  0x1b, 0x3b, 0x1f, 0x1f, 0x3f, 0x81, 0x3b, 0x05, 0x39, 0x3b, 0x1f, 0x1d, 0x1f, 0x33, 0x83, 0x3b,
+  0x03, 0x1f, 0x1b, 0x2b, 0x3e, 0x84, 0x3b, 0x80, 0x1f, 0x00, 0x37, 0x81, 0x1f, 0x05, 0x1b, 0x3b,
+  0x3b, 0x2b, 0x3b, 0x33, 0x80, 0x3b, 0x02, 0x2b, 0x3b, 0x2b, 0x80, 0x3b, 0x05, 0x3a, 0x3b, 0x3b,
+  0x2b, 0x39, 0x3b, 0x80, 0x3f, 0x05, 0x3b, 0x2b, 0x3b, 0x3b, 0x3e, 0x3f, 0x81, 0x1f, 0x2e, 0x1b,
+  0x3b, 0x2b, 0x39, 0x3b, 0x3e, 0x1b, 0x3b, 0x39, 0x3b, 0x3f, 0x3b, 0x39, 0x3b, 0x2b, 0x33, 0x3b,
+  0x3b, 0x0f, 0x1b, 0x3b, 0x3b, 0x3f, 0x3f, 0x1f, 0x3f, 0x3a, 0x39, 0x1f, 0x1b, 0x3b, 0x3b, 0x2b,
+  0x39, 0x3b, 0x3f, 0x33, 0x3b, 0x2b, 0x3b, 0x3b, 0x1f, 0x0b, 0x3b, 0x1f, 0x1f, 0x33, 0x80, 0x3b,
+  0x83, 0x1f, 0x02, 0x17, 0x1f, 0x1d, 0x80, 0x1f, 0x11, 0x0f, 0x1d, 0x1f, 0x1b, 0x3f, 0x33, 0x3b,
+  0x3f, 0x3b, 0x3b, 0x39, 0x1f, 0x0f, 0x1f, 0x1e, 0x3e, 0x1f, 0x0b, 0x80, 0x3b, 0x07, 0x1d, 0x1b,
+  0x3b, 0x2b, 0x37, 0x1f, 0x1f, 0x0b, 0x80, 0x3b, 0x05, 0x2b, 0x39, 0x1f, 0x33, 0x3b, 0x39, 0x80,
+  0x3b, 0x0b, 0x1f, 0x19, 0x3b, 0x1f, 0x1f, 0x3a, 0x3f, 0x1f, 0x1f, 0x1b, 0x3b, 0x2b, 0x80, 0x3b,
+  0x1a, 0x3e, 0x1f, 0x0b, 0x3b, 0x39, 0x1f, 0x1f, 0x3f, 0x1f, 0x1f, 0x17, 0x1f, 0x1f, 0x1b, 0x3b,
+  0x1f, 0x1b, 0x3b, 0x2b, 0x3b, 0x3b, 0x33, 0x3b, 0x3b, 0x39, 0x1f, 0x0f, 0x80, 0x1f, 0x04, 0x1e,
+  0x3b, 0x39, 0x1f, 0x0f, 0x83, 0x1f, 0x02, 0x37, 0x3b, 0x2b, 0x81, 0x3b, 0x02, 0x39, 0x3b, 0x3b,
+  0x80, 0x3f, 0x00, 0x0f, 0x82, 0x1f, 0x06, 0x1b, 0x3a, 0x3f, 0x1d, 0x1f, 0x1f, 0x1b, 0x81, 0x3b,
+  0x02, 0x3a, 0x3b, 0x39, 0x80, 0x3b, 0x00, 0x39, 0x81, 0x3b, 0x03, 0x37, 0x1b, 0x3b, 0x39, 0x81,
+  0x3b, 0x07, 0x1f, 0x1f, 0x37, 0x3b, 0x3b, 0x1d, 0x1f, 0x3f, 0x80, 0x3b, 0x02, 0x1f, 0x1e, 0x3f,
+  0x82, 0x1f, 0x02, 0x3f, 0x1f, 0x3f, 0x80, 0x1f, 0x04, 0x0b, 0x3a, 0x3a, 0x3b, 0x2b, 0x84, 0x1f,
+  0x06, 0x33, 0x3f, 0x0f, 0x1f, 0x1f, 0x3b, 0x3f, 0x80, 0x3b, 0x01, 0x37, 0x37, 0x81, 0x1f, 0x01,
+  0x0f, 0x1b, 0x81, 0x3f, 0x81, 0x3b, 0x81, 0x1f, 0x03, 0x17, 0x1e, 0x3b, 0x3b, 0x81, 0x1f, 0x08,
+  0x0f, 0x1f, 0x1e, 0x1f, 0x37, 0x0f, 0x1d, 0x1f, 0x0b, 0x81, 0x3b, 0x0e, 0x3e, 0x3a, 0x3b, 0x3b,
+  0x1f, 0x1f, 0x1b, 0x3b, 0x39, 0x3b, 0x33, 0x3e, 0x1d, 0x1b, 0x3f, 0x83, 0x3b, 0x01, 0x33, 0x3b,
+  0x81, 0x3f, 0x81, 0x3b, 0x01, 0x33, 0x37, 0x85, 0x1f, 0x01, 0x1e, 0x3a, 0x81, 0x3b, 0x09, 0x2b,
+  0x3b, 0x39, 0x3b, 0x33, 0x37, 0x1f, 0x3f, 0x1f, 0x1d, 0x80, 0x1f, 0x02, 0x0f, 0x1f, 0x17, 0x82,
+  0x3b, 0x00, 0x3f, 0x80, 0x3b, 0x04, 0x3f, 0x17, 0x1f, 0x1f, 0x0f, 0x82, 0x1f, 0x03, 0x1e, 0x3e,
+  0x1f, 0x1b, 0x81, 0x3b, 0x03, 0x2b, 0x3b, 0x3f, 0x1e, 0x82, 0x3b, 0x0c, 0x1f, 0x1d, 0x1f, 0x1e,
+  0x1f, 0x17, 0x1f, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x3b, 0x80, 0x3f, 0x2c, 0x3b, 0x3b, 0x1f, 0x19,
+  0x3b, 0x3b, 0x2b, 0x3f, 0x1f, 0x3a, 0x3b, 0x3b, 0x0f, 0x1d, 0x1f, 0x0b, 0x39, 0x3b, 0x3f, 0x17,
+  0x33, 0x3b, 0x3b, 0x2b, 0x1f, 0x1d, 0x1f, 0x0f, 0x1f, 0x33, 0x37, 0x0f, 0x1f, 0x1f, 0x19, 0x3b,
+  0x2b, 0x3b, 0x3b, 0x1e, 0x1e, 0x1f, 0x3b, 0x3f, 0x1f, 0x80, 0x3b, 0x06, 0x2b, 0x3a, 0x3a, 0x3b,
+  0x3b, 0x1f, 0x1f, 0x81, 0x3f, 0x10, 0x1f, 0x1b, 0x3b, 0x3f, 0x1f, 0x37, 0x1f, 0x1f, 0x1d, 0x1f,
+  0x0f, 0x1b, 0x3b, 0x1f, 0x1e, 0x1f, 0x33, 0x80, 0x3b, 0x80, 0x3f, 0x06, 0x3b, 0x3b, 0x3a, 0x3a,
+  0x3b, 0x3b, 0x39, 0x81, 0x3b, 0x80, 0x3f, 0x03, 0x1f, 0x1f, 0x0f, 0x1d, 0x82, 0x1f, 0x0c, 0x33,
+  0x3b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x37, 0x17, 0x1b, 0x80, 0x3b, 0x13, 0x39,
+  0x1f, 0x0f, 0x1f, 0x33, 0x37, 0x1f, 0x1d, 0x1f, 0x0f, 0x1f, 0x1b, 0x3b, 0x3b, 0x3e, 0x1f, 0x3b,
+  0x3f, 0x1f, 0x3f, 0x82, 0x1f, 0x05, 0x3e, 0x3f, 0x3f, 0x38, 0x00, 0x2f, 0x81, 0x1f, 0x00, 0x3e,
+  0x80, 0x1f, 0x08, 0x0b, 0x3b, 0x2b, 0x3f, 0x3b, 0x3b, 0x37, 0x17, 0x3b, 0x84, 0x1f, 0x22, 0x3f,
+  0x17, 0x3b, 0x1f, 0x1d, 0x1f, 0x1b, 0x3b, 0x2b, 0x1f, 0x1e, 0x3e, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f,
+  0x3f, 0x3f, 0x19, 0x3e, 0x1e, 0x3e, 0x1f, 0x0f, 0x1f, 0x1d, 0x1f, 0x1b, 0x3b, 0x3b, 0x37, 0x1f,
+  0x1f, 0x0f, 0x80, 0x1f, 0x16, 0x0f, 0x1f, 0x1f, 0x3f, 0x37, 0x17, 0x1f, 0x1b, 0x2b, 0x3b, 0x2b,
+  0x3b, 0x3b, 0x3f, 0x17, 0x33, 0x3b, 0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x1d, 0x80, 0x3f, 0x09, 0x1f,
+  0x1f, 0x0f, 0x1f, 0x1f, 0x1b, 0x3b, 0x1f, 0x33, 0x37, 0x85, 0x1f, 0x01, 0x1e, 0x3a, 0x83, 0x3b,
+  0x06, 0x1f, 0x1b, 0x3a, 0x3f, 0x17, 0x1f, 0x1b, 0x80, 0x3b, 0x05, 0x1f, 0x1d, 0x1f, 0x37, 0x33,
+  0x3b, 0x80, 0x3f, 0x0b, 0x3b, 0x39, 0x3b, 0x3b, 0x3e, 0x3f, 0x17, 0x0f, 0x1f, 0x3f, 0x3b, 0x3f,
+  0x81, 0x1f, 0x04, 0x0f, 0x1b, 0x3e, 0x1f, 0x33, 0x80, 0x3b, 0x12, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f,
+  0x37, 0x33, 0x3b, 0x0f, 0x1f, 0x1f, 0x3f, 0x1f, 0x3f, 0x3e, 0x3e, 0x3f, 0x1f, 0x0f, 0x80, 0x1f,
+  0x01, 0x1d, 0x1f, 0x80, 0x3f, 0x81, 0x3b, 0x09, 0x39, 0x1f, 0x19, 0x3b, 0x3e, 0x1e, 0x3e, 0x1f,
+  0x1f, 0x1b, 0x81, 0x3b, 0x01, 0x37, 0x1e, 0x85, 0x3b, 0x02, 0x3a, 0x3f, 0x1e, 0x80, 0x3b, 0x01,
+  0x1f, 0x1d, 0x80, 0x1f, 0x17, 0x3b, 0x37, 0x17, 0x1f, 0x1f, 0x3f, 0x1d, 0x1f, 0x19, 0x3b, 0x3e,
+  0x1e, 0x1f, 0x3a, 0x26, 0x3f, 0x07, 0x3f, 0x1d, 0x1f, 0x17, 0x17, 0x3a, 0x39, 0x81, 0x3b, 0x09,
+  0x3f, 0x3b, 0x3e, 0x1f, 0x3e, 0x1f, 0x1d, 0x1b, 0x2b, 0x3b, 0x80, 0x1f, 0x02, 0x1e, 0x3b, 0x37,
+  0x80, 0x1f, 0x0b, 0x1d, 0x1b, 0x3b, 0x3b, 0x3f, 0x33, 0x3e, 0x3b, 0x3b, 0x39, 0x3b, 0x3f, 0x80,
+  0x3b, 0x00, 0x3e, 0x83, 0x1f, 0x10, 0x0f, 0x1d, 0x1e, 0x1f, 0x17, 0x37, 0x1f, 0x1f, 0x1d, 0x1f,
+  0x1b, 0x3b, 0x3f, 0x3f, 0x3a, 0x3f, 0x1d, 0x81, 0x1f, 0x04, 0x1b, 0x3b, 0x33, 0x3e, 0x1f, 0x84,
+  0x3b, 0x80, 0x3f, 0x82, 0x3b, 0x05, 0x2b, 0x3b, 0x3b, 0x37, 0x17, 0x33, 0x84, 0x3b, 0x04, 0x37,
+  0x1f, 0x37, 0x1f, 0x0b, 0x81, 0x3b, 0x06, 0x3f, 0x1f, 0x33, 0x3e, 0x3b, 0x3b, 0x39, 0x82, 0x3b,
+  0x00, 0x3a, 0x80, 0x3f, 0x01, 0x3b, 0x3f, 0x81, 0x1f, 0x05, 0x17, 0x1e, 0x3b, 0x3b, 0x3f, 0x3b,
+  0x80, 0x3f, 0x07, 0x3b, 0x39, 0x3b, 0x3b, 0x3e, 0x1e, 0x3a, 0x3e, 0x81, 0x1f, 0x05, 0x0f, 0x1f,
+  0x1e, 0x3a, 0x3b, 0x3e, 0x82, 0x1f, 0x80, 0x3f, 0x08, 0x3b, 0x33, 0x37, 0x1b, 0x3b, 0x1f, 0x19,
+  0x3b, 0x3b, 0x81, 0x3f, 0x00, 0x3b, 0x82, 0x1f, 0x02, 0x1e, 0x3b, 0x37, 0x80, 0x1f, 0x0b, 0x0f,
+  0x1f, 0x1b, 0x2b, 0x3b, 0x3e, 0x3b, 0x37, 0x33, 0x39, 0x1f, 0x1d, 0x81, 0x1f, 0x02, 0x33, 0x37,
+  0x1e, 0x82, 0x1f, 0x07, 0x0f, 0x1e, 0x1e, 0x3a, 0x3f, 0x1f, 0x1b, 0x3f, 0x80, 0x1f, 0x0d, 0x1e,
+  0x3a, 0x3f, 0x3c, 0x07, 0x3f, 0x3c, 0x37, 0x1b, 0x3b, 0x3b, 0x3e, 0x1e, 0x1e, 0x80, 0x3b, 0x07,
+  0x2b, 0x1f, 0x1f, 0x3f, 0x3b, 0x37, 0x17, 0x33, 0x80, 0x3b, 0x06, 0x39, 0x3b, 0x3b, 0x3a, 0x3f,
+  0x17, 0x33, 0x83, 0x3b, 0x04, 0x3e, 0x1e, 0x1f, 0x33, 0x3b, 0x80, 0x1f, 0x08, 0x3b, 0x3f, 0x1f,
+  0x37, 0x17, 0x37, 0x17, 0x1b, 0x3b, 0x82, 0x1f, 0x04, 0x37, 0x33, 0x3b, 0x3b, 0x2b, 0x81, 0x1f,
+  0x03, 0x3f, 0x3f, 0x17, 0x3a, 0x80, 0x3b, 0x0c, 0x0f, 0x1f, 0x1d, 0x1f, 0x3e, 0x1f, 0x33, 0x33,
+  0x2b, 0x1f, 0x0f, 0x1f, 0x0f, 0x80, 0x3f, 0x28, 0x3e, 0x1e, 0x1f, 0x1f, 0x1d, 0x1b, 0x3b, 0x39,
+  0x3e, 0x1f, 0x3a, 0x3f, 0x1f, 0x0b, 0x39, 0x1f, 0x0f, 0x1b, 0x3b, 0x3a, 0x3e, 0x1f, 0x17, 0x1f,
+  0x1d, 0x1b, 0x2b, 0x3b, 0x1f, 0x33, 0x3e, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x17,
+  0x33, 0x81, 0x3f, 0x08, 0x3b, 0x3b, 0x1f, 0x1f, 0x1e, 0x3e, 0x1f, 0x17, 0x3b, 0x80, 0x3f, 0x0c,
+  0x1f, 0x1b, 0x3f, 0x1f, 0x1f, 0x1e, 0x1f, 0x33, 0x3f, 0x17, 0x3b, 0x3b, 0x39, 0x80, 0x3b, 0x07,
+  0x3f, 0x1f, 0x37, 0x17, 0x37, 0x1f, 0x19, 0x3b, 0x83, 0x3f, 0x07, 0x1e, 0x3b, 0x3b, 0x2b, 0x3b,
+  0x3b, 0x3a, 0x3a, 0x81, 0x3f, 0x00, 0x1d, 0x81, 0x1f, 0x0e, 0x3b, 0x3e, 0x1f, 0x33, 0x37, 0x1f,
+  0x1f, 0x1d, 0x1f, 0x1f, 0x3f, 0x3b, 0x37, 0x1e, 0x1f, 0x81, 0x3b, 0x12, 0x1f, 0x1e, 0x3e, 0x1e,
+  0x3b, 0x37, 0x1f, 0x1d, 0x1f, 0x1b, 0x3b, 0x3a, 0x3f, 0x33, 0x3f, 0x17, 0x33, 0x2f, 0x1b, 0x80,
+  0x3b, 0x07, 0x3f, 0x17, 0x3f, 0x3c, 0x3f, 0x3f, 0x31, 0x3f, 0x80, 0x1f, 0x03, 0x33, 0x3f, 0x37,
+  0x3a, 0x81, 0x3b, 0x12, 0x3f, 0x3f, 0x3e, 0x3a, 0x3f, 0x1e, 0x3f, 0x1f, 0x1b, 0x3b, 0x39, 0x3b,
+  0x37, 0x3a, 0x3e, 0x1f, 0x37, 0x1d, 0x1b, 0x81, 0x3b, 0x05, 0x37, 0x3a, 0x3a, 0x3e, 0x1f, 0x1b,
+  0x80, 0x3f, 0x19, 0x17, 0x1e, 0x3b, 0x3a, 0x3f, 0x3f, 0x0f, 0x1d, 0x1b, 0x3b, 0x3b, 0x37, 0x3a,
+  0x3f, 0x17, 0x33, 0x3b, 0x3b, 0x39, 0x3b, 0x3f, 0x3f, 0x3e, 0x3f, 0x17, 0x33, 0x83, 0x3b, 0x03,
+  0x33, 0x3e, 0x1e, 0x3f, 0x80, 0x1f, 0x01, 0x1b, 0x3b, 0x80, 0x3f, 0x03, 0x3b, 0x37, 0x3b, 0x2b,
+  0x80, 0x1f, 0x05, 0x1e, 0x1f, 0x33, 0x37, 0x17, 0x33, 0x82, 0x3b, 0x04, 0x37, 0x37, 0x17, 0x3a,
+  0x3f, 0x81, 0x3b, 0x0c, 0x2b, 0x3e, 0x1f, 0x33, 0x3e, 0x3e, 0x1f, 0x1f, 0x1b, 0x3b, 0x2b, 0x3b,
+  0x3e, 0x81, 0x3f, 0x0b, 0x1f, 0x1b, 0x2b, 0x39, 0x3b, 0x37, 0x3b, 0x37, 0x3a, 0x3f, 0x3b, 0x3f,
+  0x80, 0x1f, 0x09, 0x17, 0x3b, 0x3b, 0x3f, 0x33, 0x3e, 0x1e, 0x3b, 0x37, 0x17, 0x80, 0x1f, 0x06,
+  0x1e, 0x3a, 0x3e, 0x1f, 0x3b, 0x33, 0x37, 0x81, 0x1f, 0x80, 0x3f, 0x02, 0x3e, 0x3b, 0x37, 0x81,
+  0x1f, 0x02, 0x3f, 0x17, 0x3a, 0x80, 0x3f, 0x81, 0x3b, 0x06, 0x3e, 0x17, 0x33, 0x3e, 0x1e, 0x3b,
+  0x33, 0x80, 0x3b, 0x80, 0x3f, 0x03, 0x3b, 0x37, 0x3a, 0x3f, 0x80, 0x1f, 0x06, 0x3b, 0x3b, 0x33,
+  0x3f, 0x1e, 0x3b, 0x37, 0x81, 0x1f, 0x05, 0x3b, 0x33, 0x3e, 0x3a, 0x3f, 0x17, 0x81, 0x1f, 0x10,
+  0x1e, 0x3a, 0x3f, 0x3f, 0x07, 0x3e, 0x2f, 0x27, 0x3b, 0x3b, 0x3a, 0x3e, 0x1f, 0x33, 0x3b, 0x37,
+  0x3a, 0x80, 0x3b, 0x2f, 0x3f, 0x3f, 0x3b, 0x3f, 0x17, 0x33, 0x3a, 0x3b, 0x3f, 0x1f, 0x1f, 0x1e,
+  0x3b, 0x37, 0x1f, 0x33, 0x3a, 0x3b, 0x3f, 0x1d, 0x1f, 0x1e, 0x3e, 0x1f, 0x17, 0x3f, 0x33, 0x3f,
+  0x1f, 0x1f, 0x3f, 0x3b, 0x3e, 0x3b, 0x37, 0x1f, 0x33, 0x33, 0x3b, 0x3b, 0x3f, 0x1f, 0x37, 0x1e,
+  0x1f, 0x1e, 0x3e, 0x1f, 0x81, 0x3b, 0x05, 0x3f, 0x3f, 0x3b, 0x3a, 0x3f, 0x1e, 0x81, 0x3b, 0x11,
+  0x3e, 0x3e, 0x1f, 0x33, 0x3f, 0x17, 0x33, 0x3b, 0x3b, 0x3f, 0x1f, 0x3f, 0x3f, 0x3e, 0x1e, 0x3b,
+  0x37, 0x1f, 0x80, 0x3b, 0x06, 0x3f, 0x33, 0x3f, 0x1f, 0x3a, 0x3f, 0x17, 0x81, 0x1f, 0x04, 0x3a,
+  0x3b, 0x3f, 0x17, 0x3a, 0x81, 0x3b, 0x06, 0x3e, 0x1f, 0x33, 0x3e, 0x1e, 0x1f, 0x33, 0x81, 0x3b,
+  0x01, 0x37, 0x17, 0x81, 0x3f, 0x0a, 0x3b, 0x3f, 0x1f, 0x1f, 0x17, 0x3a, 0x3e, 0x1f, 0x37, 0x3f,
+  0x3f, 0x80, 0x3b, 0x04, 0x3f, 0x1e, 0x3b, 0x3f, 0x17, 0x81, 0x1f, 0x06, 0x1e, 0x3b, 0x3e, 0x1f,
+  0x3a, 0x3f, 0x17, 0x80, 0x3b, 0x04, 0x3f, 0x1f, 0x3a, 0x3f, 0x1e, 0x83, 0x3f, 0x05, 0x3b, 0x37,
+  0x17, 0x3b, 0x37, 0x17, 0x80, 0x3b, 0x07, 0x3f, 0x3f, 0x33, 0x37, 0x1f, 0x17, 0x33, 0x3f, 0x80,
+  0x1f, 0x05, 0x1e, 0x3f, 0x37, 0x1f, 0x17, 0x3a, 0x80, 0x3f, 0x07, 0x1f, 0x1f, 0x33, 0x37, 0x17,
+  0x1f, 0x17, 0x37, 0x80, 0x3b, 0x06, 0x3e, 0x1f, 0x33, 0x37, 0x1f, 0x37, 0x17, 0x81, 0x3b, 0x10,
+  0x3e, 0x3a, 0x3f, 0x17, 0x3a, 0x3e, 0x3b, 0x3b, 0x38, 0x37, 0x3f, 0x3f, 0x07, 0x3f, 0x1f, 0x37,
+  0x3f, 0x81, 0x1f, 0x03, 0x17, 0x3a, 0x3f, 0x1e, 0x80, 0x3f, 0x80, 0x1f, 0x05, 0x17, 0x3f, 0x17,
+  0x1f, 0x17, 0x37, 0x81, 0x1f, 0x05, 0x17, 0x3f, 0x17, 0x1f, 0x1f, 0x37, 0x82, 0x1f, 0x04, 0x33,
+  0x37, 0x3f, 0x3f, 0x3e, 0x81, 0x1f, 0x06, 0x1e, 0x1f, 0x37, 0x17, 0x3b, 0x33, 0x3a, 0x81, 0x3b,
+  0x03, 0x3e, 0x1e, 0x3b, 0x33, 0x80, 0x3f, 0x08, 0x3b, 0x3b, 0x3a, 0x3f, 0x17, 0x37, 0x17, 0x1e,
+  0x3a, 0x81, 0x3b, 0x04, 0x3f, 0x1e, 0x3e, 0x1f, 0x17, 0x80, 0x3f, 0x08, 0x3b, 0x3b, 0x3a, 0x3b,
+  0x37, 0x17, 0x1f, 0x37, 0x17, 0x81, 0x1f, 0x05, 0x3a, 0x3f, 0x3a, 0x3f, 0x1e, 0x3e, 0x82, 0x3b,
+  0x05, 0x37, 0x17, 0x33, 0x3e, 0x1f, 0x33, 0x80, 0x3b, 0x06, 0x3e, 0x1f, 0x37, 0x17, 0x3a, 0x3e,
+  0x3b, 0x81, 0x3f, 0x05, 0x3a, 0x3e, 0x3a, 0x3b, 0x37, 0x3e, 0x80, 0x1f, 0x15, 0x1b, 0x3a, 0x3a,
+  0x3b, 0x3f, 0x1e, 0x3a, 0x3f, 0x37, 0x17, 0x3b, 0x3b, 0x39, 0x3b, 0x3b, 0x3f, 0x17, 0x33, 0x3e,
+  0x1f, 0x33, 0x3b, 0x80, 0x1f, 0x1c, 0x1e, 0x3e, 0x1f, 0x33, 0x37, 0x1e, 0x1f, 0x3b, 0x3f, 0x1f,
+  0x1f, 0x17, 0x3b, 0x37, 0x17, 0x3a, 0x3b, 0x3b, 0x2b, 0x3b, 0x3b, 0x1e, 0x1f, 0x3a, 0x3e, 0x3f,
+  0x1f, 0x1b, 0x39, 0x80, 0x3b, 0x03, 0x3a, 0x3b, 0x37, 0x3a, 0x81, 0x3f, 0x13, 0x3b, 0x3b, 0x3e,
+  0x1f, 0x3e, 0x3e, 0x3b, 0x3b, 0x1d, 0x1f, 0x0f, 0x1f, 0x3a, 0x3f, 0x3a, 0x3e, 0x1f, 0x3b, 0x3b,
+  0x39, 0x80, 0x1f, 0x03, 0x37, 0x17, 0x3a, 0x3f, 0x80, 0x1f, 0x07, 0x3c, 0x3f, 0x37, 0x34, 0x3f,
+  0x37, 0x33, 0x3a, 0x82, 0x1f, 0x0d, 0x3a, 0x3f, 0x17, 0x33, 0x3f, 0x3f, 0x3b, 0x3b, 0x2b, 0x3b,
+  0x3f, 0x17, 0x3e, 0x3e, 0x80, 0x3b, 0x0a, 0x2b, 0x3b, 0x3b, 0x3f, 0x17, 0x3e, 0x3e, 0x3a, 0x3b,
+  0x3b, 0x39, 0x80, 0x3b, 0x01, 0x3e, 0x3a, 0x80, 0x3f, 0x0c, 0x3b, 0x3b, 0x39, 0x3b, 0x3b, 0x3e,
+  0x1f, 0x3a, 0x3e, 0x3f, 0x17, 0x1f, 0x1d, 0x80, 0x1f, 0x02, 0x33, 0x37, 0x3e, 0x80, 0x3f, 0x81,
+  0x1f, 0x0c, 0x3b, 0x3b, 0x3e, 0x3b, 0x3f, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x33, 0x3f, 0x37, 0x80,
+  0x3f, 0x0b, 0x3b, 0x1f, 0x0f, 0x1f, 0x3e, 0x1f, 0x3e, 0x3a, 0x3f, 0x3b, 0x3f, 0x3f, 0x80, 0x1f,
+  0x25, 0x33, 0x37, 0x1e, 0x3b, 0x33, 0x3b, 0x2b, 0x3b, 0x3b, 0x3f, 0x1e, 0x3f, 0x1e, 0x3b, 0x37,
+  0x1f, 0x1f, 0x0f, 0x1f, 0x1b, 0x3e, 0x1f, 0x3a, 0x3f, 0x17, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f,
+  0x1f, 0x1f, 0x37, 0x1e, 0x1f, 0x1f, 0x1d, 0x80, 0x1f, 0x08, 0x3e, 0x3e, 0x1e, 0x3f, 0x1f, 0x1b,
+  0x1f, 0x33, 0x33, 0x81, 0x3b, 0x11, 0x2b, 0x3b, 0x3e, 0x1e, 0x3a, 0x3f, 0x1f, 0x1d, 0x1b, 0x2b,
+  0x3b, 0x1f, 0x33, 0x37, 0x3a, 0x3f, 0x1f, 0x1f, 0x80, 0x3f, 0x04, 0x3b, 0x37, 0x1e, 0x3f, 0x17,
+  0x81, 0x3b, 0x16, 0x2b, 0x3b, 0x37, 0x17, 0x3f, 0x17, 0x33, 0x2b, 0x3b, 0x39, 0x3b, 0x2b, 0x3b,
+  0x3e, 0x3a, 0x3f, 0x17, 0x1b, 0x3b, 0x3b, 0x3f, 0x1f, 0x1f, 0x80, 0x33, 0x00, 0x3a, 0x81, 0x3b,
+  0x06, 0x2b, 0x1f, 0x3a, 0x3e, 0x1f, 0x33, 0x33, 0x80, 0x3b, 0x08, 0x2b, 0x3b, 0x1f, 0x3a, 0x3f,
+  0x33, 0x37, 0x1d, 0x1f, 0x80, 0x3f, 0x11, 0x38, 0x3f, 0x3b, 0x3e, 0x1f, 0x3b, 0x3b, 0x2b, 0x1d,
+  0x1f, 0x1f, 0x17, 0x3a, 0x3f, 0x17, 0x3f, 0x3b, 0x3b, 0x80, 0x1f, 0x14, 0x33, 0x33, 0x3b, 0x37,
+  0x17, 0x1f, 0x1f, 0x0f, 0x1d, 0x1b, 0x3f, 0x17, 0x1e, 0x1f, 0x37, 0x0f, 0x1f, 0x1d, 0x1b, 0x2b,
+  0x3b, 0x81, 0x3f, 0x01, 0x1f, 0x0f, 0x81, 0x1f, 0x18, 0x3a, 0x3e, 0x1f, 0x17, 0x1f, 0x0f, 0x1f,
+  0x1f, 0x0f, 0x1f, 0x1f, 0x3b, 0x33, 0x3f, 0x3f, 0x1f, 0x1d, 0x1f, 0x0f, 0x1f, 0x17, 0x37, 0x33,
+  0x37, 0x17, 0x80, 0x1f, 0x07, 0x19, 0x3b, 0x1f, 0x1e, 0x1f, 0x17, 0x3f, 0x3f, 0x81, 0x1f, 0x0e,
+  0x1b, 0x3a, 0x3a, 0x3f, 0x17, 0x17, 0x3f, 0x3b, 0x3b, 0x2b, 0x3b, 0x3f, 0x1e, 0x3e, 0x1e, 0x81,
+  0x3b, 0x09, 0x39, 0x3b, 0x3b, 0x33, 0x37, 0x1e, 0x3b, 0x39, 0x3b, 0x3b, 0x80, 0x1f, 0x27, 0x33,
+  0x37, 0x3a, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x1f, 0x1a, 0x3e, 0x3e, 0x3b, 0x37, 0x1f, 0x0f, 0x1f,
+  0x1b, 0x39, 0x3b, 0x3b, 0x3a, 0x3f, 0x17, 0x33, 0x3f, 0x3e, 0x1f, 0x39, 0x3b, 0x3b, 0x1d, 0x1f,
+  0x1f, 0x1e, 0x3f, 0x3f, 0x17, 0x1f, 0x0f, 0x82, 0x1f, 0x02, 0x3e, 0x1f, 0x37, 0x81, 0x1f, 0x0f,
+  0x3f, 0x3b, 0x3f, 0x1e, 0x3f, 0x17, 0x3b, 0x1d, 0x1f, 0x1b, 0x2b, 0x3b, 0x3b, 0x3f, 0x3a, 0x3a,
+  0x81, 0x3b, 0x80, 0x1f, 0x05, 0x1e, 0x3b, 0x3f, 0x33, 0x3b, 0x3b, 0x80, 0x3f, 0x08, 0x3b, 0x3b,
+  0x3f, 0x3f, 0x1e, 0x3b, 0x2b, 0x3b, 0x3b, 0x80, 0x1f, 0x04, 0x1e, 0x3b, 0x37, 0x1f, 0x1d, 0x82,
+  0x1f, 0x0f, 0x3a, 0x3f, 0x33, 0x3f, 0x1b, 0x3b, 0x3f, 0x07, 0x37, 0x2f, 0x3e, 0x3f, 0x17, 0x33,
+  0x3b, 0x0f, 0x80, 0x1f, 0x1a, 0x1b, 0x3f, 0x3e, 0x1f, 0x33, 0x3f, 0x1f, 0x3b, 0x2b, 0x3b, 0x2b,
+  0x3b, 0x3f, 0x37, 0x17, 0x3b, 0x3b, 0x2b, 0x1f, 0x1b, 0x3b, 0x3b, 0x3a, 0x3e, 0x3b, 0x37, 0x1b,
+  0x82, 0x3b, 0x0d, 0x3a, 0x3a, 0x3f, 0x3f, 0x1b, 0x3b, 0x3b, 0x1f, 0x1d, 0x1f, 0x1f, 0x1e, 0x3f,
+  0x37, 0x82, 0x3b, 0x03, 0x1f, 0x1f, 0x33, 0x37, 0x80, 0x3f, 0x0a, 0x3b, 0x3b, 0x1f, 0x1f, 0x1d,
+  0x1f, 0x17, 0x3f, 0x1e, 0x3b, 0x2b, 0x81, 0x3b, 0x1c, 0x3f, 0x33, 0x37, 0x3f, 0x3f, 0x1b, 0x39,
+  0x3b, 0x1f, 0x0f, 0x1f, 0x3f, 0x33, 0x3e, 0x3b, 0x3f, 0x1f, 0x3b, 0x3b, 0x1f, 0x1f, 0x1e, 0x3b,
+  0x3b, 0x37, 0x1d, 0x1f, 0x1f, 0x0f, 0x80, 0x1f, 0x02, 0x3e, 0x3b, 0x37, 0x81, 0x1f, 0x07, 0x0f,
+  0x1d, 0x1f, 0x1f, 0x33, 0x37, 0x1f, 0x1f, 0x80, 0x3b, 0x04, 0x2b, 0x3b, 0x3b, 0x33, 0x37, 0x84,
+  0x3b, 0x02, 0x37, 0x37, 0x1e, 0x80, 0x3b, 0x04, 0x33, 0x3f, 0x1b, 0x3b, 0x2b, 0x81, 0x3b, 0x02,
+  0x3a, 0x3a, 0x3f, 0x82, 0x3b, 0x03, 0x1d, 0x1f, 0x1f, 0x3a, 0x80, 0x3b, 0x01, 0x2b, 0x3b, 0x81,
+  0x1f, 0x02, 0x3a, 0x3f, 0x17, 0x81, 0x3b, 0x05, 0x1f, 0x0f, 0x1e, 0x1f, 0x37, 0x3f, 0x84, 0x1f,
+  0x0c, 0x1e, 0x3a, 0x3f, 0x1f, 0x0f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x1e, 0x17, 0x37, 0x80, 0x1f,
+  0x00, 0x0f, 0x83, 0x3f, 0x17, 0x33, 0x3b, 0x39, 0x3b, 0x2b, 0x3b, 0x39, 0x1f, 0x3e, 0x1f, 0x33,
+  0x39, 0x3b, 0x3f, 0x07, 0x3f, 0x37, 0x27, 0x3f, 0x3a, 0x3f, 0x1f, 0x3b, 0x2b, 0x80, 0x1f, 0x06,
+  0x0b, 0x1f, 0x33, 0x3e, 0x3b, 0x3f, 0x3f, 0x80, 0x1f, 0x04, 0x19, 0x3b, 0x3a, 0x3f, 0x17, 0x84,
+  0x1f, 0x01, 0x3b, 0x3e, 0x81, 0x1f, 0x03, 0x1b, 0x3b, 0x3b, 0x2b, 0x81, 0x3f, 0x08, 0x0b, 0x3b,
+  0x3b, 0x3f, 0x3b, 0x3b, 0x3f, 0x17, 0x1e, 0x80, 0x1f, 0x08, 0x19, 0x3b, 0x3b, 0x2b, 0x1e, 0x3b,
+  0x37, 0x3f, 0x3f, 0x81, 0x3b, 0x0e, 0x1f, 0x1f, 0x3a, 0x3a, 0x3f, 0x1f, 0x1b, 0x3b, 0x0f, 0x1f,
+  0x1d, 0x1b, 0x3f, 0x1f, 0x17, 0x82, 0x3b, 0x04, 0x1f, 0x1f, 0x1e, 0x1f, 0x33, 0x80, 0x3f, 0x14,
+  0x3b, 0x2b, 0x3b, 0x39, 0x3b, 0x3e, 0x3e, 0x3b, 0x3b, 0x39, 0x1f, 0x1b, 0x3b, 0x1d, 0x1f, 0x17,
+  0x1e, 0x3f, 0x1f, 0x1f, 0x19, 0x81, 0x3b, 0x04, 0x3a, 0x3f, 0x1f, 0x33, 0x3b, 0x80, 0x1f, 0x12,
+  0x1b, 0x3b, 0x3f, 0x17, 0x3b, 0x33, 0x3b, 0x3b, 0x1f, 0x1d, 0x1f, 0x1f, 0x1b, 0x3a, 0x3f, 0x17,
+  0x39, 0x3b, 0x3e, 0x82, 0x1f, 0x09, 0x19, 0x3b, 0x2b, 0x37, 0x3f, 0x17, 0x1b, 0x3b, 0x0f, 0x1d,
+  0x80, 0x1f, 0x05, 0x17, 0x37, 0x3e, 0x1d, 0x1f, 0x1b, 0x81, 0x3b, 0x05, 0x3a, 0x3f, 0x33, 0x3b,
+  0x1f, 0x1d, 0x82, 0x1f, 0x0b, 0x3a, 0x3b, 0x33, 0x2b, 0x39, 0x3b, 0x2b, 0x1d, 0x1f, 0x1f, 0x37,
+  0x1e, 0x81, 0x3b, 0x80, 0x3f, 0x08, 0x39, 0x3f, 0x3a, 0x3f, 0x1d, 0x1f, 0x0f, 0x3f, 0x1f, 0x81,
+  0x3f, 0x0a, 0x3a, 0x3f, 0x1f, 0x1b, 0x3b, 0x1f, 0x0f, 0x1f, 0x1f, 0x17, 0x37, 0x80, 0x1f, 0x0b,
+  0x3f, 0x27, 0x3f, 0x3f, 0x17, 0x3a, 0x3f, 0x33, 0x3b, 0x1f, 0x1f, 0x1d, 0x80, 0x1f, 0x0c, 0x3a,
+  0x3f, 0x33, 0x3b, 0x3f, 0x1f, 0x1f, 0x1b, 0x3b, 0x3b, 0x3a, 0x3f, 0x33, 0x81, 0x3b, 0x1c, 0x2b,
+  0x39, 0x3b, 0x3b, 0x37, 0x33, 0x3f, 0x1f, 0x0b, 0x39, 0x3b, 0x39, 0x1f, 0x1f, 0x1e, 0x3f, 0x3f,
+  0x1b, 0x3b, 0x39, 0x3b, 0x3f, 0x3f, 0x0f, 0x1f, 0x3e, 0x1f, 0x3b, 0x2b, 0x83, 0x3b, 0x06, 0x3e,
+  0x3f, 0x3f, 0x1f, 0x19, 0x3b, 0x2b, 0x80, 0x3b, 0x1f, 0x3f, 0x37, 0x17, 0x1f, 0x1f, 0x0f, 0x1f,
+  0x1b, 0x3b, 0x3b, 0x37, 0x37, 0x33, 0x3b, 0x2b, 0x3b, 0x39, 0x3b, 0x3b, 0x2b, 0x3b, 0x3e, 0x1f,
+  0x3f, 0x3b, 0x3b, 0x1f, 0x1f, 0x1d, 0x1b, 0x3b, 0x33, 0x80, 0x3b, 0x81, 0x1f, 0x04, 0x3f, 0x1f,
+  0x3f, 0x33, 0x3a, 0x81, 0x3b, 0x80, 0x1f, 0x17, 0x3f, 0x33, 0x37, 0x1f, 0x0f, 0x1d, 0x1b, 0x2b,
+  0x3b, 0x2b, 0x3b, 0x3e, 0x1e, 0x3b, 0x3b, 0x2b, 0x39, 0x3b, 0x1f, 0x0f, 0x1f, 0x3f, 0x33, 0x3b,
+  0x80, 0x1f, 0x04, 0x3b, 0x39, 0x3b, 0x3b, 0x0f, 0x80, 0x1f, 0x07, 0x3a, 0x3a, 0x3f, 0x1d, 0x1f,
+  0x1f, 0x1b, 0x39, 0x81, 0x3b, 0x10, 0x33, 0x3b, 0x1f, 0x1f, 0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x3a,
+  0x3f, 0x1f, 0x0f, 0x1b, 0x3b, 0x2b, 0x3b, 0x80, 0x1f, 0x00, 0x37, 0x80, 0x1f, 0x00, 0x1b, 0x80,
+  0x3b, 0x0d, 0x2b, 0x3a, 0x3f, 0x17, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x3b, 0x3f, 0x3b, 0x37, 0x1e,
+  0x80, 0x1f, 0x0a, 0x1d, 0x30, 0x2a, 0x21, 0x30, 0x20, 0x3f, 0x3f, 0x39, 0x3b, 0x39, 0x81, 0x3b,
+  0x0d, 0x3f, 0x1f, 0x33, 0x3b, 0x2b, 0x3f, 0x07, 0x3e, 0x3f, 0x07, 0x3f, 0x3a, 0x3b, 0x39, 0x80,
+  0x3b, 0x12, 0x1f, 0x1d, 0x1f, 0x1f, 0x3a, 0x3f, 0x1f, 0x1f, 0x3f, 0x1d, 0x1f, 0x0f, 0x1f, 0x1f,
+  0x37, 0x1e, 0x3f, 0x0f, 0x1d, 0x80, 0x1f, 0x04, 0x19, 0x3b, 0x3a, 0x3f, 0x33, 0x84, 0x3b, 0x02,
+  0x3f, 0x3f, 0x3e, 0x81, 0x1f, 0x0e, 0x38, 0x3f, 0x1f, 0x1f, 0x17, 0x3a, 0x3b, 0x3b, 0x1d, 0x1f,
+  0x1f, 0x0f, 0x1f, 0x1f, 0x3b, 0x80, 0x3f, 0x80, 0x1f, 0x06, 0x0f, 0x1d, 0x1f, 0x1e, 0x1f, 0x3b,
+  0x39, 0x80, 0x3b, 0x00, 0x39, 0x80, 0x3b, 0x00, 0x3a, 0x81, 0x3b, 0x01, 0x1f, 0x1d, 0x80, 0x1f,
+  0x06, 0x37, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x1b, 0x80, 0x3b, 0x02, 0x3f, 0x37, 0x33, 0x80, 0x3b,
+  0x11, 0x2b, 0x3f, 0x1f, 0x3b, 0x17, 0x1e, 0x3f, 0x1f, 0x19, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x1b,
+  0x3e, 0x3b, 0x3b, 0x83, 0x1f, 0x05, 0x1e, 0x1f, 0x37, 0x1f, 0x1f, 0x1b, 0x80, 0x3b, 0x0a, 0x1f,
+  0x1f, 0x1e, 0x1f, 0x37, 0x3b, 0x3b, 0x3e, 0x1f, 0x1f, 0x1b, 0x82, 0x3b, 0x01, 0x3f, 0x3f, 0x83,
+  0x3b, 0x03, 0x1f, 0x0f, 0x1e, 0x3e, 0x80, 0x3b, 0x07, 0x2b, 0x3b, 0x1f, 0x1b, 0x3b, 0x3b, 0x37,
+  0x3a, 0x81, 0x3b, 0x07, 0x1f, 0x1d, 0x1f, 0x0f, 0x37, 0x1e, 0x3b, 0x3b, 0x84, 0x1f, 0x0f, 0x37,
+  0x3b, 0x2b, 0x39, 0x1f, 0x1f, 0x3f, 0x1f, 0x3b, 0x3e, 0x1e, 0x3f, 0x1f, 0x1f, 0x3f, 0x30, 0x82,
+  0x3f, 0x0e, 0x04, 0x1f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1d, 0x1f, 0x0f, 0x33, 0x37, 0x1d, 0x1f, 0x1f,
+  0x38, 0x80, 0x3f, 0x08, 0x27, 0x3a, 0x3f, 0x37, 0x1f, 0x1d, 0x1f, 0x0f, 0x1d, 0x80, 0x1f, 0x10,
+  0x37, 0x1e, 0x1d, 0x1f, 0x3f, 0x1f, 0x1f, 0x1b, 0x39, 0x3b, 0x3b, 0x37, 0x1b, 0x3b, 0x1f, 0x1b,
+  0x3b, 0x80, 0x1f, 0x01, 0x3b, 0x33, 0x81, 0x3b, 0x00, 0x1d, 0x80, 0x1f, 0x0c, 0x1e, 0x1f, 0x1f,
+  0x1d, 0x1f, 0x1b, 0x3b, 0x38, 0x27, 0x3b, 0x3b, 0x3e, 0x3f, 0x80, 0x1f, 0x11, 0x1b, 0x3b, 0x1f,
+  0x19, 0x3b, 0x37, 0x3f, 0x3f, 0x1b, 0x3b, 0x3b, 0x1f, 0x1b, 0x3b, 0x3b, 0x3f, 0x33, 0x37, 0x83,
+  0x1f, 0x0b, 0x0f, 0x1e, 0x3f, 0x37, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x1b, 0x3b, 0x3b, 0x80, 0x3f,
+  0x02, 0x3b, 0x1f, 0x0f, 0x81, 0x1f, 0x03, 0x17, 0x17, 0x1f, 0x0f, 0x80, 0x1f, 0x0f, 0x3f, 0x3f,
+  0x1f, 0x3f, 0x33, 0x3b, 0x39, 0x3b, 0x3b, 0x2b, 0x3b, 0x1f, 0x1f, 0x3e, 0x1f, 0x37, 0x83, 0x1f,
+  0x05, 0x1b, 0x3f, 0x3a, 0x3f, 0x1f, 0x0f, 0x80, 0x1f, 0x08, 0x0f, 0x1f, 0x0f, 0x1f, 0x37, 0x1b,
+  0x1d, 0x1f, 0x17, 0x80, 0x1f, 0x03, 0x0f, 0x1f, 0x1f, 0x0b, 0x81, 0x3f, 0x02, 0x1f, 0x1b, 0x39,
+  0x81, 0x3b, 0x03, 0x3f, 0x33, 0x3f, 0x1d, 0x84, 0x1f, 0x04, 0x3b, 0x37, 0x1f, 0x1f, 0x1d, 0x82,
+  0x1f, 0x0c, 0x1e, 0x3f, 0x1d, 0x1f, 0x0f, 0x1d, 0x1f, 0x0f, 0x19, 0x3b, 0x3e, 0x3b, 0x33, 0x80,
+  0x3b, 0x01, 0x39, 0x1b, 0x81, 0x3f, 0x05, 0x33, 0x3b, 0x2b, 0x3f, 0x07, 0x3f, 0x80, 0x37, 0x05,
+  0x3e, 0x3f, 0x28, 0x38, 0x3f, 0x3f, 0x81, 0x3b, 0x0b, 0x3f, 0x3e, 0x3f, 0x3b, 0x3b, 0x3c, 0x3f,
+  0x3e, 0x3f, 0x07, 0x1f, 0x3a, 0x84, 0x3b, 0x03, 0x39, 0x3b, 0x3a, 0x3f, 0x85, 0x3b, 0x02, 0x3e,
+  0x3b, 0x3f, 0x80, 0x1f, 0x00, 0x1d, 0x80, 0x1f, 0x05, 0x1e, 0x3f, 0x37, 0x1d, 0x1b, 0x2b, 0x80,
+  0x3b, 0x03, 0x1d, 0x1f, 0x37, 0x37, 0x80, 0x1f, 0x0b, 0x0f, 0x3f, 0x03, 0x3f, 0x1f, 0x33, 0x3a,
+  0x3b, 0x2b, 0x3b, 0x3b, 0x2b, 0x80, 0x3b, 0x80, 0x3f, 0x32, 0x1f, 0x0f, 0x1d, 0x1f, 0x1f, 0x1b,
+  0x3b, 0x3a, 0x3f, 0x1f, 0x1b, 0x39, 0x1f, 0x19, 0x3b, 0x3b, 0x1f, 0x1f, 0x1e, 0x1f, 0x1d, 0x1b,
+  0x3b, 0x3b, 0x1f, 0x1f, 0x19, 0x3b, 0x37, 0x3f, 0x3f, 0x1f, 0x3b, 0x1f, 0x1f, 0x0b, 0x3b, 0x2b,
+  0x3f, 0x3e, 0x3f, 0x1f, 0x0f, 0x1f, 0x3f, 0x3f, 0x3b, 0x3b, 0x1e, 0x1f, 0x37, 0x80, 0x1f, 0x00,
+  0x1b, 0x80, 0x3b, 0x0c, 0x1f, 0x3a, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x0f, 0x1d, 0x1f, 0x1f,
+  0x3e, 0x80, 0x1f, 0x00, 0x19, 0x81, 0x3b, 0x0c, 0x37, 0x3a, 0x3f, 0x3b, 0x3b, 0x3f, 0x33, 0x0f,
+  0x1f, 0x1f, 0x19, 0x3b, 0x3b, 0x81, 0x3f, 0x1a, 0x3b, 0x2b, 0x3b, 0x3b, 0x2b, 0x3b, 0x1f, 0x1e,
+  0x1f, 0x33, 0x3b, 0x3b, 0x1f, 0x1d, 0x1f, 0x0f, 0x1f, 0x1e, 0x3e, 0x1f, 0x3b, 0x2b, 0x3b, 0x3b,
+  0x2b, 0x3b, 0x3b, 0x80, 0x3f, 0x00, 0x33, 0x85, 0x3b, 0x02, 0x37, 0x3b, 0x39, 0x80, 0x3b, 0x13,
+  0x3d, 0x1f, 0x3f, 0x3a, 0x3a, 0x3f, 0x0f, 0x1f, 0x38, 0x27, 0x35, 0x3f, 0x2f, 0x3f, 0x3f, 0x3e,
+  0x3f, 0x3e, 0x00, 0x2f, 0x86, 0x3f, 0x11, 0x38, 0x3e, 0x3d, 0x3c, 0x3f, 0x3e, 0x1f, 0x3f, 0x3b,
+  0x1f, 0x0b, 0x3b, 0x3b, 0x1f, 0x1f, 0x1e, 0x3f, 0x33, 0x80, 0x1f, 0x01, 0x0b, 0x39, 0x80, 0x3b,
+  0x04, 0x37, 0x1e, 0x3b, 0x2b, 0x39, 0x80, 0x3b, 0x03, 0x2b, 0x3b, 0x3f, 0x17, 0x82, 0x1f, 0x00,
+  0x1d, 0x80, 0x1f, 0x15, 0x1e, 0x1f, 0x1f, 0x19, 0x3b, 0x3b, 0x3f, 0x04, 0x3f, 0x3a, 0x3f, 0x37,
+  0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f, 0x37, 0x3f, 0x80, 0x3b, 0x07, 0x1f, 0x1f, 0x0f,
+  0x1d, 0x1f, 0x3f, 0x17, 0x33, 0x82, 0x3b, 0x04, 0x2b, 0x3b, 0x3e, 0x3f, 0x33, 0x80, 0x3b, 0x03,
+  0x2b, 0x3b, 0x2b, 0x3b, 0x81, 0x3f, 0x03, 0x1d, 0x1f, 0x1f, 0x0f, 0x80, 0x1f, 0x0b, 0x17, 0x17,
+  0x1b, 0x3b, 0x3b, 0x3f, 0x3f, 0x1f, 0x1f, 0x0f, 0x3f, 0x3a, 0x82, 0x3b, 0x08, 0x39, 0x3b, 0x39,
+  0x3e, 0x1f, 0x37, 0x1f, 0x1f, 0x1b, 0x82, 0x3b, 0x06, 0x37, 0x17, 0x3b, 0x3b, 0x2b, 0x3b, 0x3b,
+  0x80, 0x1f, 0x08, 0x1e, 0x1f, 0x33, 0x1f, 0x1f, 0x37, 0x1f, 0x3b, 0x3b, 0x82, 0x1f, 0x81, 0x3f,
+  0x80, 0x1f, 0x08, 0x1b, 0x39, 0x3b, 0x3f, 0x3e, 0x1f, 0x3b, 0x3b, 0x2b, 0x80, 0x3b, 0x0b, 0x0f,
+  0x1f, 0x1f, 0x3e, 0x1f, 0x1b, 0x3b, 0x1f, 0x1f, 0x1b, 0x2b, 0x1f, 0x80, 0x3f, 0x22, 0x1f, 0x1d,
+  0x1f, 0x1d, 0x1b, 0x39, 0x3b, 0x3e, 0x3a, 0x3e, 0x1f, 0x1f, 0x0f, 0x0f, 0x1b, 0x3b, 0x3b, 0x3f,
+  0x37, 0x1e, 0x3b, 0x3b, 0x3f, 0x14, 0x2e, 0x3f, 0x37, 0x3e, 0x2e, 0x3f, 0x3e, 0x3f, 0x3f, 0x3c,
+  0x14, 0x80, 0x23, 0x18, 0x22, 0x20, 0x31, 0x30, 0x38, 0x26, 0x3f, 0x3f, 0x39, 0x37, 0x1f, 0x37,
+  0x37, 0x3f, 0x2b, 0x3b, 0x3b, 0x2b, 0x39, 0x3b, 0x3f, 0x3a, 0x3f, 0x3b, 0x39, 0x81, 0x1f, 0x05,
+  0x0f, 0x1f, 0x1f, 0x37, 0x3b, 0x3b, 0x83, 0x1f, 0x02, 0x3a, 0x3f, 0x37, 0x80, 0x1f, 0x06, 0x0f,
+  0x1b, 0x3b, 0x3b, 0x37, 0x37, 0x3e, 0x81, 0x3b, 0x04, 0x3f, 0x04, 0x07, 0x3f, 0x3e, 0x80, 0x1f,
+  0x00, 0x1b, 0x82, 0x3b, 0x03, 0x3f, 0x3f, 0x3b, 0x2b, 0x83, 0x3b, 0x07, 0x3a, 0x3f, 0x3f, 0x1d,
+  0x1f, 0x1d, 0x1f, 0x1b, 0x80, 0x3b, 0x03, 0x3a, 0x3f, 0x1f, 0x1d, 0x83, 0x1f, 0x04, 0x3f, 0x3f,
+  0x3b, 0x3b, 0x39, 0x80, 0x3b, 0x05, 0x2b, 0x3b, 0x3f, 0x3f, 0x33, 0x3b, 0x80, 0x3f, 0x80, 0x3b,
+  0x06, 0x3a, 0x3f, 0x33, 0x3b, 0x39, 0x1f, 0x0f, 0x81, 0x1f, 0x01, 0x37, 0x1e, 0x81, 0x3b, 0x81,
+  0x1f, 0x17, 0x17, 0x3e, 0x1f, 0x1f, 0x1b, 0x3b, 0x3b, 0x2b, 0x39, 0x3b, 0x3f, 0x37, 0x1f, 0x39,
+  0x3b, 0x3b, 0x33, 0x3b, 0x2b, 0x39, 0x3b, 0x3b, 0x0f, 0x1f, 0x81, 0x3f, 0x01, 0x3b, 0x39, 0x81,
+  0x1f, 0x02, 0x17, 0x17, 0x3e, 0x80, 0x1f, 0x00, 0x1b, 0x80, 0x3b, 0x05, 0x3e, 0x3a, 0x3f, 0x3b,
+  0x3b, 0x39, 0x81, 0x3b, 0x81, 0x3f, 0x01, 0x3b, 0x3b, 0x81, 0x1f, 0x02, 0x1e, 0x3b, 0x3e, 0x82,
+  0x3b, 0x0d, 0x2f, 0x19, 0x3b, 0x37, 0x1e, 0x3e, 0x1f, 0x0f, 0x1f, 0x3f, 0x1c, 0x04, 0x2e, 0x2f,
+  0x81, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x01, 0x27, 0x37, 0x84, 0x3f, 0x09, 0x3e, 0x3e, 0x3f, 0x37,
+  0x1f, 0x1f, 0x3f, 0x1f, 0x1f, 0x0f, 0x80, 0x1f, 0x02, 0x17, 0x17, 0x3a, 0x82, 0x3b, 0x30, 0x1f,
+  0x1f, 0x1e, 0x3e, 0x1f, 0x17, 0x1f, 0x1f, 0x19, 0x3b, 0x0f, 0x1b, 0x3a, 0x3f, 0x3a, 0x3b, 0x39,
+  0x3b, 0x3b, 0x1f, 0x1f, 0x1d, 0x1f, 0x3b, 0x3b, 0x33, 0x39, 0x3b, 0x3b, 0x0f, 0x1f, 0x2c, 0x20,
+  0x3f, 0x3b, 0x37, 0x33, 0x39, 0x3b, 0x3b, 0x0f, 0x1b, 0x3b, 0x3e, 0x3f, 0x3f, 0x33, 0x3b, 0x1d,
+  0x82, 0x1f, 0x01, 0x37, 0x3a, 0x82, 0x3b, 0x12, 0x2b, 0x3b, 0x3b, 0x37, 0x37, 0x1e, 0x3b, 0x3b,
+  0x1f, 0x1f, 0x0b, 0x3b, 0x3b, 0x3f, 0x3f, 0x3e, 0x1f, 0x1b, 0x3b, 0x81, 0x1f, 0x05, 0x1e, 0x3a,
+  0x3a, 0x3f, 0x1f, 0x3f, 0x82, 0x1f, 0x02, 0x37, 0x1e, 0x3f, 0x80, 0x1f, 0x10, 0x1b, 0x3b, 0x1d,
+  0x1f, 0x3b, 0x3e, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x2b, 0x3f, 0x3e, 0x1f, 0x82, 0x3b,
+  0x09, 0x3f, 0x1f, 0x3e, 0x1f, 0x3a, 0x3f, 0x1f, 0x1f, 0x3e, 0x3f, 0x83, 0x1f, 0x01, 0x1e, 0x1e,
+  0x81, 0x3f, 0x82, 0x1f, 0x03, 0x3f, 0x3f, 0x33, 0x3f, 0x80, 0x1f, 0x06, 0x0f, 0x1f, 0x1f, 0x3a,
+  0x3f, 0x17, 0x17, 0x80, 0x3b, 0x04, 0x0f, 0x1d, 0x1f, 0x1f, 0x17, 0x80, 0x3f, 0x15, 0x3b, 0x2b,
+  0x39, 0x3b, 0x2b, 0x3b, 0x3e, 0x3b, 0x37, 0x35, 0x1d, 0x1f, 0x0f, 0x1b, 0x3b, 0x3f, 0x1f, 0x37,
+  0x1f, 0x33, 0x3b, 0x2b, 0x80, 0x3f, 0x05, 0x1e, 0x1c, 0x30, 0x24, 0x35, 0x3e, 0x8b, 0x3f, 0x1b,
+  0x3e, 0x0f, 0x3b, 0x37, 0x37, 0x3f, 0x3b, 0x2b, 0x3b, 0x3b, 0x39, 0x3b, 0x3f, 0x3e, 0x3f, 0x37,
+  0x3b, 0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x37, 0x3b, 0x3e, 0x3f, 0x1f, 0x0f, 0x82, 0x1f, 0x0c, 0x37,
+  0x17, 0x3e, 0x3b, 0x39, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x17, 0x37, 0x3e, 0x81, 0x3b, 0x05, 0x3f,
+  0x38, 0x24, 0x07, 0x3f, 0x3f, 0x83, 0x3b, 0x04, 0x2b, 0x3b, 0x3f, 0x3b, 0x3f, 0x80, 0x1f, 0x06,
+  0x19, 0x3b, 0x0f, 0x1f, 0x1f, 0x17, 0x3e, 0x80, 0x3b, 0x11, 0x1f, 0x1f, 0x1d, 0x1f, 0x3f, 0x1f,
+  0x37, 0x3b, 0x3b, 0x39, 0x1f, 0x1f, 0x1d, 0x1f, 0x3f, 0x3f, 0x1f, 0x37, 0x80, 0x3b, 0x04, 0x0f,
+  0x1b, 0x3b, 0x3b, 0x3e, 0x83, 0x3f, 0x06, 0x1f, 0x0f, 0x1f, 0x1f, 0x37, 0x1f, 0x33, 0x80, 0x3b,
+  0x07, 0x2b, 0x3b, 0x3b, 0x3e, 0x3b, 0x37, 0x33, 0x3b, 0x80, 0x1f, 0x08, 0x1b, 0x3b, 0x37, 0x17,
+  0x3a, 0x3e, 0x3b, 0x39, 0x3b, 0x81, 0x3f, 0x02, 0x33, 0x37, 0x3e, 0x80, 0x3b, 0x00, 0x37, 0x80,
+  0x3b, 0x0c, 0x1d, 0x1f, 0x1f, 0x3f, 0x3b, 0x3e, 0x1f, 0x3b, 0x3b, 0x1f, 0x1d, 0x1f, 0x0f, 0x80,
+  0x33, 0x00, 0x3e, 0x80, 0x3f, 0x09, 0x3b, 0x3b, 0x1f, 0x1e, 0x3f, 0x3e, 0x3f, 0x3a, 0x3b, 0x2b,
+  0x80, 0x3b, 0x01, 0x3f, 0x37, 0x82, 0x3f, 0x81, 0x1f, 0x03, 0x37, 0x33, 0x37, 0x3a, 0x81, 0x3b,
+  0x0a, 0x2f, 0x0f, 0x17, 0x37, 0x17, 0x37, 0x3e, 0x0f, 0x1f, 0x0b, 0x3b, 0x82, 0x3f, 0x06, 0x04,
+  0x05, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x09, 0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x3f,
+  0x27, 0x3e, 0x3b, 0x80, 0x3f, 0x07, 0x1f, 0x19, 0x3b, 0x1f, 0x1e, 0x3a, 0x3b, 0x3a, 0x80, 0x3b,
+  0x81, 0x1f, 0x03, 0x3b, 0x37, 0x33, 0x3e, 0x82, 0x3b, 0x04, 0x2f, 0x3e, 0x1f, 0x3f, 0x17, 0x81,
+  0x1f, 0x12, 0x1b, 0x3b, 0x3e, 0x3f, 0x1e, 0x1f, 0x3e, 0x1f, 0x0f, 0x1f, 0x1f, 0x38, 0x25, 0x24,
+  0x07, 0x3f, 0x37, 0x1f, 0x1d, 0x81, 0x1f, 0x06, 0x37, 0x3f, 0x37, 0x33, 0x37, 0x1f, 0x1d, 0x80,
+  0x1f, 0x0e, 0x37, 0x37, 0x3e, 0x1f, 0x37, 0x1d, 0x1f, 0x1f, 0x1b, 0x3b, 0x3e, 0x1e, 0x3e, 0x1f,
+  0x37, 0x83, 0x1f, 0x03, 0x37, 0x3e, 0x3b, 0x3a, 0x81, 0x3b, 0x11, 0x39, 0x3e, 0x3e, 0x3b, 0x33,
+  0x37, 0x3f, 0x3b, 0x3b, 0x1b, 0x2b, 0x3b, 0x37, 0x33, 0x3e, 0x3e, 0x1f, 0x1d, 0x81, 0x1f, 0x04,
+  0x1e, 0x3b, 0x37, 0x3b, 0x3e, 0x82, 0x3b, 0x0d, 0x3f, 0x1f, 0x3e, 0x3f, 0x1f, 0x1f, 0x3f, 0x3f,
+  0x3b, 0x3f, 0x3f, 0x3b, 0x3f, 0x3a, 0x80, 0x3b, 0x02, 0x37, 0x3b, 0x37, 0x82, 0x1f, 0x05, 0x33,
+  0x37, 0x17, 0x3e, 0x3e, 0x1f, 0x81, 0x3b, 0x04, 0x3e, 0x3f, 0x3e, 0x3f, 0x1f, 0x83, 0x3f, 0x04,
+  0x33, 0x33, 0x3b, 0x37, 0x3f, 0x81, 0x1f, 0x03, 0x1e, 0x1f, 0x17, 0x17, 0x81, 0x3f, 0x17, 0x1f,
+  0x0f, 0x1f, 0x33, 0x3e, 0x3b, 0x37, 0x3e, 0x3e, 0x0f, 0x0f, 0x1f, 0x1e, 0x3e, 0x3e, 0x3f, 0x37,
+  0x17, 0x37, 0x2b, 0x3d, 0x1f, 0x2b, 0x37, 0x82, 0x3f, 0x01, 0x31, 0x24, 0x80, 0x3f, 0x02, 0x3e,
+  0x3f, 0x37, 0x82, 0x3f, 0x2f, 0x37, 0x3f, 0x07, 0x3b, 0x3e, 0x3e, 0x3f, 0x3f, 0x3b, 0x3b, 0x39,
+  0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x37, 0x1f, 0x1f, 0x0f, 0x1f, 0x3a, 0x3e, 0x3b, 0x3e, 0x3f,
+  0x17, 0x3b, 0x2b, 0x39, 0x3b, 0x3a, 0x3b, 0x3e, 0x3a, 0x3f, 0x3e, 0x3b, 0x39, 0x3b, 0x3f, 0x1f,
+  0x33, 0x3b, 0x37, 0x3f, 0x17, 0x81, 0x3b, 0x05, 0x3f, 0x26, 0x24, 0x20, 0x37, 0x3f, 0x80, 0x3b,
+  0x07, 0x2b, 0x3b, 0x3e, 0x3b, 0x33, 0x3a, 0x3f, 0x3f, 0x81, 0x3b, 0x04, 0x3f, 0x1f, 0x1e, 0x1f,
+  0x3a, 0x80, 0x3b, 0x08, 0x39, 0x3b, 0x3e, 0x1f, 0x37, 0x1f, 0x3a, 0x3b, 0x37, 0x81, 0x3b, 0x07,
+  0x37, 0x3b, 0x33, 0x3e, 0x3f, 0x37, 0x1f, 0x0f, 0x81, 0x1f, 0x00, 0x17, 0x81, 0x3f, 0x81, 0x1f,
+  0x05, 0x3b, 0x3e, 0x1f, 0x1f, 0x3e, 0x3f, 0x81, 0x1f, 0x0e, 0x33, 0x3e, 0x3b, 0x37, 0x33, 0x3f,
+  0x1f, 0x1f, 0x0f, 0x1f, 0x1e, 0x3e, 0x1f, 0x1e, 0x3e, 0x84, 0x3f, 0x1b, 0x37, 0x17, 0x3e, 0x3e,
+  0x1f, 0x3a, 0x3e, 0x3b, 0x37, 0x1f, 0x3b, 0x3e, 0x3e, 0x1f, 0x3e, 0x3f, 0x17, 0x1f, 0x3e, 0x1f,
+  0x1f, 0x3a, 0x3e, 0x3b, 0x3a, 0x3b, 0x37, 0x37, 0x82, 0x3f, 0x26, 0x17, 0x1f, 0x3e, 0x3e, 0x3b,
+  0x37, 0x33, 0x3f, 0x1f, 0x3e, 0x3f, 0x37, 0x3e, 0x3b, 0x37, 0x3f, 0x3f, 0x3b, 0x3b, 0x37, 0x37,
+  0x1e, 0x3f, 0x37, 0x33, 0x33, 0x3b, 0x37, 0x17, 0x33, 0x37, 0x1c, 0x1f, 0x15, 0x1e, 0x3f, 0x17,
+  0x37, 0x1f, 0x86, 0x3f, 0x02, 0x3b, 0x24, 0x3e, 0x83, 0x3f, 0x01, 0x3e, 0x2e, 0x80, 0x3f, 0x03,
+  0x37, 0x3e, 0x3b, 0x33, 0x81, 0x3f, 0x2e, 0x1e, 0x3b, 0x3a, 0x3b, 0x33, 0x3a, 0x3a, 0x3f, 0x37,
+  0x3b, 0x3f, 0x33, 0x3f, 0x3b, 0x37, 0x3b, 0x3a, 0x3f, 0x17, 0x3b, 0x3b, 0x3e, 0x3f, 0x37, 0x3b,
+  0x3f, 0x33, 0x33, 0x3e, 0x3b, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x3a, 0x3e, 0x3b, 0x37, 0x33, 0x3b,
+  0x3f, 0x3f, 0x05, 0x27, 0x25, 0x20, 0x80, 0x3f, 0x2a, 0x1f, 0x1f, 0x37, 0x3b, 0x3e, 0x3f, 0x37,
+  0x1e, 0x1e, 0x1f, 0x3b, 0x3f, 0x1e, 0x3e, 0x3e, 0x3f, 0x37, 0x37, 0x3e, 0x3e, 0x1f, 0x3b, 0x3f,
+  0x3b, 0x37, 0x1f, 0x37, 0x37, 0x3e, 0x3b, 0x37, 0x1f, 0x1f, 0x3f, 0x3a, 0x3e, 0x3f, 0x17, 0x1e,
+  0x3f, 0x37, 0x1f, 0x3a, 0x80, 0x3e, 0x07, 0x3f, 0x17, 0x3f, 0x3f, 0x37, 0x3b, 0x3f, 0x17, 0x80,
+  0x37, 0x14, 0x3e, 0x3a, 0x3b, 0x3a, 0x3f, 0x1f, 0x3b, 0x37, 0x3f, 0x33, 0x3e, 0x3b, 0x3f, 0x33,
+  0x37, 0x1f, 0x1f, 0x3e, 0x3f, 0x1e, 0x3e, 0x85, 0x3f, 0x1c, 0x17, 0x1f, 0x3e, 0x1f, 0x1f, 0x37,
+  0x3f, 0x3b, 0x3e, 0x3f, 0x33, 0x37, 0x37, 0x1f, 0x3e, 0x3b, 0x3b, 0x3f, 0x37, 0x17, 0x3f, 0x33,
+  0x37, 0x3f, 0x1f, 0x37, 0x3f, 0x1f, 0x1f, 0x83, 0x3f, 0x0d, 0x3e, 0x1f, 0x1f, 0x17, 0x3a, 0x3f,
+  0x3a, 0x3e, 0x3b, 0x33, 0x3a, 0x3b, 0x3e, 0x3b, 0x80, 0x3f, 0x06, 0x3e, 0x3f, 0x17, 0x37, 0x17,
+  0x1e, 0x1f, 0x80, 0x3e, 0x02, 0x3b, 0x3e, 0x2f, 0x81, 0x37, 0x0e, 0x0e, 0x3e, 0x1f, 0x37, 0x3f,
+  0x3f, 0x15, 0x06, 0x07, 0x06, 0x0e, 0x38, 0x31, 0x34, 0x07, 0x83, 0x3f, 0x01, 0x37, 0x3c, 0x81,
+  0x3f, 0x02, 0x27, 0x3b, 0x37, 0x81, 0x3f, 0x2c, 0x17, 0x37, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f,
+  0x33, 0x3b, 0x37, 0x33, 0x3e, 0x3a, 0x3e, 0x3f, 0x1e, 0x3f, 0x3e, 0x3b, 0x3e, 0x3e, 0x3b, 0x33,
+  0x3b, 0x37, 0x17, 0x1f, 0x3f, 0x33, 0x3f, 0x33, 0x3f, 0x3f, 0x1f, 0x1e, 0x1f, 0x3b, 0x3e, 0x3b,
+  0x3f, 0x3e, 0x3a, 0x3f, 0x3c, 0x80, 0x24, 0x09, 0x20, 0x26, 0x3f, 0x3f, 0x37, 0x3b, 0x3e, 0x3f,
+  0x3f, 0x1f, 0x80, 0x3f, 0x0f, 0x37, 0x17, 0x37, 0x1f, 0x1f, 0x17, 0x1f, 0x1f, 0x17, 0x1f, 0x3a,
+  0x3e, 0x3a, 0x3e, 0x3f, 0x3e, 0x80, 0x3b, 0x0e, 0x3f, 0x1e, 0x3f, 0x37, 0x17, 0x17, 0x3b, 0x3b,
+  0x3f, 0x3f, 0x17, 0x1f, 0x33, 0x37, 0x3f, 0x80, 0x1f, 0x07, 0x3f, 0x3f, 0x3b, 0x3b, 0x37, 0x17,
+  0x3f, 0x3a, 0x80, 0x3b, 0x13, 0x3f, 0x3f, 0x37, 0x3e, 0x3a, 0x3e, 0x3b, 0x3a, 0x3f, 0x3b, 0x3e,
+  0x3a, 0x3f, 0x3f, 0x37, 0x37, 0x17, 0x1e, 0x3f, 0x1f, 0x84, 0x3f, 0x0e, 0x3b, 0x3e, 0x3e, 0x3b,
+  0x3e, 0x3e, 0x1f, 0x1f, 0x1e, 0x3b, 0x3a, 0x3f, 0x3b, 0x3a, 0x3e, 0x82, 0x1f, 0x0a, 0x3e, 0x1e,
+  0x3f, 0x3b, 0x37, 0x37, 0x1b, 0x3b, 0x3f, 0x33, 0x37, 0x83, 0x3f, 0x0d, 0x3b, 0x3b, 0x3f, 0x37,
+  0x3a, 0x3f, 0x3a, 0x3f, 0x3e, 0x3f, 0x1f, 0x1f, 0x1e, 0x3a, 0x80, 0x3f, 0x16, 0x3a, 0x3f, 0x35,
+  0x39, 0x39, 0x3e, 0x1e, 0x3b, 0x37, 0x27, 0x33, 0x37, 0x17, 0x0f, 0x0f, 0x1c, 0x3f, 0x15, 0x3f,
+  0x3f, 0x00, 0x24, 0x3e, 0x80, 0x3f, 0x01, 0x3e, 0x2f, 0x80, 0x3f, 0x0f, 0x37, 0x3e, 0x3f, 0x37,
+  0x3e, 0x3f, 0x3f, 0x3e, 0x2f, 0x3f, 0x37, 0x3f, 0x38, 0x3f, 0x0f, 0x1e, 0x81, 0x3f, 0x0d, 0x1e,
+  0x1e, 0x1f, 0x15, 0x1b, 0x2b, 0x3b, 0x3e, 0x3f, 0x1f, 0x3f, 0x33, 0x3f, 0x3b, 0x80, 0x1f, 0x10,
+  0x17, 0x3e, 0x3b, 0x3f, 0x37, 0x3f, 0x37, 0x1f, 0x1f, 0x3a, 0x3f, 0x3e, 0x3a, 0x3f, 0x3f, 0x33,
+  0x37, 0x80, 0x3b, 0x03, 0x3f, 0x1e, 0x3a, 0x3b, 0x80, 0x3f, 0x05, 0x04, 0x3c, 0x2c, 0x25, 0x20,
+  0x07, 0x8a, 0x3f, 0x01, 0x37, 0x37, 0x80, 0x1f, 0x11, 0x3f, 0x37, 0x3f, 0x3b, 0x37, 0x3b, 0x3a,
+  0x3b, 0x1f, 0x1f, 0x37, 0x37, 0x3f, 0x1e, 0x3f, 0x3f, 0x3e, 0x1f, 0x80, 0x3b, 0x1a, 0x3f, 0x37,
+  0x3f, 0x3a, 0x3e, 0x3e, 0x3a, 0x3b, 0x1f, 0x1f, 0x37, 0x37, 0x3f, 0x3e, 0x1e, 0x3f, 0x3e, 0x1f,
+  0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x3f, 0x3b, 0x37, 0x37, 0x81, 0x1f, 0x06, 0x3a, 0x3b, 0x3b, 0x3f,
+  0x3f, 0x37, 0x1f, 0x85, 0x3f, 0x01, 0x37, 0x3b, 0x81, 0x1f, 0x11, 0x3e, 0x1f, 0x1f, 0x1e, 0x3f,
+  0x3a, 0x3e, 0x3f, 0x3f, 0x3b, 0x3b, 0x2b, 0x3b, 0x3e, 0x1f, 0x3f, 0x3a, 0x3e, 0x80, 0x1f, 0x03,
+  0x1d, 0x1b, 0x1f, 0x3b, 0x84, 0x3f, 0x2e, 0x39, 0x3b, 0x3b, 0x37, 0x3a, 0x3f, 0x37, 0x17, 0x19,
+  0x3b, 0x2b, 0x39, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3e, 0x1b, 0x3a, 0x3b, 0x39, 0x39, 0x37, 0x23,
+  0x3a, 0x2e, 0x3e, 0x2f, 0x1c, 0x1f, 0x0f, 0x1c, 0x3f, 0x3f, 0x04, 0x3e, 0x3f, 0x2f, 0x3f, 0x37,
+  0x3e, 0x3f, 0x3e, 0x3e, 0x3f, 0x37, 0x84, 0x3f, 0x0f, 0x3d, 0x36, 0x3f, 0x3f, 0x37, 0x3e, 0x3f,
+  0x39, 0x39, 0x1d, 0x3f, 0x3f, 0x17, 0x37, 0x3f, 0x3d, 0x80, 0x1f, 0x16, 0x1d, 0x3f, 0x17, 0x37,
+  0x33, 0x3f, 0x37, 0x1f, 0x39, 0x39, 0x3b, 0x3f, 0x3b, 0x37, 0x17, 0x1f, 0x17, 0x1b, 0x3b, 0x2b,
+  0x3b, 0x3b, 0x33, 0x81, 0x3f, 0x82, 0x3b, 0x16, 0x37, 0x3f, 0x3e, 0x3a, 0x3a, 0x3f, 0x3c, 0x24,
+  0x26, 0x24, 0x3c, 0x24, 0x20, 0x22, 0x22, 0x20, 0x30, 0x00, 0x20, 0x30, 0x20, 0x06, 0x07, 0x80,
+  0x3f, 0x02, 0x3b, 0x3b, 0x39, 0x80, 0x3b, 0x17, 0x33, 0x37, 0x3f, 0x1e, 0x3f, 0x1f, 0x1f, 0x0f,
+  0x1b, 0x3a, 0x3a, 0x3f, 0x3a, 0x3a, 0x3b, 0x3b, 0x1f, 0x1d, 0x1f, 0x1e, 0x3b, 0x33, 0x37, 0x3f,
+  0x80, 0x1f, 0x11, 0x2b, 0x3b, 0x1f, 0x1f, 0x17, 0x17, 0x3f, 0x17, 0x1f, 0x1f, 0x1d, 0x1f, 0x1f,
+  0x3f, 0x37, 0x33, 0x37, 0x3f, 0x82, 0x3b, 0x00, 0x3f, 0x80, 0x37, 0x04, 0x17, 0x1f, 0x3f, 0x3f,
+  0x1f, 0x82, 0x3f, 0x02, 0x17, 0x1e, 0x1f, 0x80, 0x3b, 0x01, 0x3a, 0x3f, 0x80, 0x3b, 0x04, 0x3e,
+  0x3f, 0x3b, 0x33, 0x33, 0x80, 0x1f, 0x06, 0x1d, 0x1f, 0x3a, 0x3a, 0x3f, 0x3f, 0x37, 0x81, 0x1f,
+  0x02, 0x2b, 0x3e, 0x3b, 0x81, 0x3f, 0x01, 0x3b, 0x3f, 0x80, 0x1f, 0x06, 0x3a, 0x3f, 0x33, 0x3f,
+  0x3b, 0x3f, 0x1d, 0x80, 0x1f, 0x09, 0x1e, 0x3e, 0x3d, 0x3f, 0x23, 0x2f, 0x0f, 0x0f, 0x07, 0x1f,
+  0x80, 0x37, 0x0f, 0x33, 0x23, 0x38, 0x3b, 0x2a, 0x39, 0x3b, 0x3f, 0x30, 0x3f, 0x3f, 0x3e, 0x3e,
+  0x2f, 0x3d, 0x37, 0x84, 0x3f, 0x04, 0x27, 0x3f, 0x3f, 0x37, 0x3e, 0x82, 0x3f, 0x2b, 0x38, 0x3f,
+  0x1f, 0x1f, 0x3b, 0x3d, 0x3f, 0x2f, 0x1e, 0x3a, 0x3b, 0x39, 0x39, 0x3b, 0x2b, 0x1f, 0x3f, 0x1f,
+  0x3e, 0x3b, 0x39, 0x39, 0x1f, 0x1f, 0x1d, 0x1f, 0x17, 0x3f, 0x3e, 0x3f, 0x3b, 0x3f, 0x0f, 0x1f,
+  0x1d, 0x1f, 0x3f, 0x33, 0x37, 0x3f, 0x3a, 0x3b, 0x2b, 0x39, 0x80, 0x3b, 0x1a, 0x33, 0x37, 0x3f,
+  0x3f, 0x1f, 0x3b, 0x25, 0x35, 0x24, 0x24, 0x3c, 0x37, 0x27, 0x27, 0x37, 0x26, 0x3e, 0x36, 0x2e,
+  0x37, 0x35, 0x30, 0x00, 0x37, 0x3f, 0x3f, 0x1d, 0x80, 0x1f, 0x06, 0x37, 0x3f, 0x3a, 0x3e, 0x3b,
+  0x3b, 0x2b, 0x80, 0x3b, 0x06, 0x3f, 0x3f, 0x33, 0x3f, 0x3f, 0x3b, 0x2b, 0x80, 0x3b, 0x0f, 0x3f,
+  0x1e, 0x3f, 0x3b, 0x33, 0x37, 0x1f, 0x1b, 0x3b, 0x39, 0x3f, 0x37, 0x3f, 0x3f, 0x17, 0x3f, 0x81,
+  0x1f, 0x09, 0x0f, 0x1e, 0x1f, 0x1f, 0x3a, 0x3a, 0x3b, 0x39, 0x1f, 0x0f, 0x81, 0x1f, 0x00, 0x1e,
+  0x82, 0x3f, 0x00, 0x1f, 0x82, 0x3f, 0x10, 0x3b, 0x3b, 0x0f, 0x1d, 0x1f, 0x1f, 0x3a, 0x39, 0x1f,
+  0x0f, 0x3b, 0x3b, 0x37, 0x3f, 0x1f, 0x3b, 0x2b, 0x80, 0x3b, 0x0b, 0x1f, 0x3f, 0x3f, 0x17, 0x1f,
+  0x1f, 0x1d, 0x1f, 0x1f, 0x1b, 0x3b, 0x3e, 0x84, 0x3f, 0x08, 0x3b, 0x3b, 0x3f, 0x37, 0x3e, 0x3e,
+  0x1f, 0x0b, 0x3b, 0x80, 0x39, 0x03, 0x3f, 0x07, 0x3e, 0x1e, 0x80, 0x3b, 0x1f, 0x2b, 0x39, 0x31,
+  0x39, 0x31, 0x37, 0x27, 0x3c, 0x3b, 0x2f, 0x0f, 0x0f, 0x07, 0x3d, 0x27, 0x3f, 0x37, 0x27, 0x3f,
+  0x3f, 0x37, 0x3f, 0x2e, 0x3e, 0x2f, 0x37, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x81, 0x3f, 0x00,
+  0x3e, 0x80, 0x3f, 0x00, 0x07, 0x80, 0x39, 0x80, 0x3f, 0x0b, 0x37, 0x2f, 0x39, 0x3b, 0x3b, 0x2b,
+  0x3b, 0x2f, 0x1e, 0x3e, 0x3b, 0x3e, 0x83, 0x3b, 0x0a, 0x3f, 0x3e, 0x1f, 0x3a, 0x3f, 0x1b, 0x3b,
+  0x1f, 0x1b, 0x3b, 0x3b, 0x81, 0x3f, 0x50, 0x1f, 0x1b, 0x3b, 0x1f, 0x0f, 0x1f, 0x3f, 0x3b, 0x33,
+  0x33, 0x3b, 0x3f, 0x3f, 0x04, 0x07, 0x00, 0x20, 0x34, 0x36, 0x34, 0x34, 0x3c, 0x34, 0x3c, 0x37,
+  0x26, 0x26, 0x34, 0x36, 0x04, 0x00, 0x07, 0x3f, 0x1f, 0x1f, 0x0b, 0x3b, 0x33, 0x37, 0x3b, 0x3f,
+  0x1f, 0x1b, 0x3b, 0x3b, 0x39, 0x3b, 0x33, 0x3e, 0x3e, 0x1e, 0x1f, 0x1f, 0x3f, 0x1f, 0x1d, 0x1b,
+  0x3f, 0x3a, 0x3e, 0x3f, 0x3b, 0x3b, 0x2f, 0x1b, 0x3b, 0x3b, 0x1f, 0x1e, 0x1e, 0x3f, 0x3b, 0x3b,
+  0x39, 0x3b, 0x3b, 0x1f, 0x1f, 0x3e, 0x3e, 0x3f, 0x82, 0x3b, 0x03, 0x39, 0x3b, 0x3e, 0x3e, 0x80,
+  0x3f, 0x01, 0x3b, 0x3b, 0x82, 0x3f, 0x01, 0x1e, 0x3a, 0x80, 0x3b, 0x01, 0x1f, 0x1d, 0x82, 0x1f,
+  0x4a, 0x1e, 0x3e, 0x3b, 0x37, 0x3b, 0x0f, 0x1b, 0x39, 0x1f, 0x1f, 0x3b, 0x37, 0x17, 0x3f, 0x3b,
+  0x39, 0x3b, 0x1f, 0x0f, 0x1f, 0x1f, 0x3b, 0x3e, 0x3f, 0x3f, 0x3b, 0x3f, 0x1f, 0x3f, 0x3f, 0x1f,
+  0x33, 0x3a, 0x3b, 0x3b, 0x39, 0x3f, 0x0f, 0x1f, 0x1f, 0x1e, 0x3e, 0x3e, 0x1e, 0x3e, 0x0e, 0x0c,
+  0x1c, 0x1f, 0x2b, 0x2b, 0x27, 0x37, 0x31, 0x37, 0x17, 0x0e, 0x0e, 0x1d, 0x31, 0x3f, 0x38, 0x3e,
+  0x3c, 0x3f, 0x3f, 0x37, 0x35, 0x3f, 0x37, 0x3f, 0x2f, 0x37, 0x2e, 0x2f, 0x80, 0x3f, 0x00, 0x37,
+  0x84, 0x3f, 0x15, 0x37, 0x3f, 0x27, 0x3f, 0x39, 0x3b, 0x2f, 0x3f, 0x3e, 0x1f, 0x17, 0x0f, 0x1d,
+  0x1f, 0x1f, 0x0f, 0x1f, 0x37, 0x1f, 0x37, 0x3b, 0x0f, 0x80, 0x1d, 0x11, 0x1f, 0x1f, 0x1e, 0x1f,
+  0x3e, 0x3f, 0x1d, 0x1f, 0x1f, 0x0f, 0x1f, 0x1b, 0x3e, 0x1e, 0x3f, 0x3f, 0x1f, 0x0f, 0x82, 0x1f,
+  0x1a, 0x17, 0x37, 0x3f, 0x3f, 0x1b, 0x3b, 0x3f, 0x3f, 0x38, 0x26, 0x37, 0x27, 0x27, 0x06, 0x3c,
+  0x36, 0x3c, 0x36, 0x26, 0x35, 0x35, 0x37, 0x27, 0x36, 0x3e, 0x20, 0x3f, 0x80, 0x3b, 0x03, 0x3f,
+  0x3f, 0x3a, 0x3e, 0x80, 0x3b, 0x00, 0x2b, 0x80, 0x1f, 0x1c, 0x3f, 0x3b, 0x3f, 0x3b, 0x3b, 0x3f,
+  0x3f, 0x3b, 0x3b, 0x3f, 0x1e, 0x3f, 0x3b, 0x3a, 0x3b, 0x1f, 0x1b, 0x39, 0x3b, 0x1f, 0x3f, 0x37,
+  0x3f, 0x1e, 0x1f, 0x0b, 0x3b, 0x1f, 0x0f, 0x80, 0x1f, 0x05, 0x3b, 0x37, 0x3b, 0x39, 0x3b, 0x3b,
+  0x80, 0x1f, 0x00, 0x33, 0x84, 0x3f, 0x07, 0x1f, 0x3b, 0x3f, 0x17, 0x37, 0x1f, 0x3b, 0x2b, 0x81,
+  0x3b, 0x06, 0x3f, 0x3b, 0x3b, 0x1f, 0x1f, 0x3b, 0x3f, 0x83, 0x3b, 0x06, 0x39, 0x1f, 0x1f, 0x3f,
+  0x3e, 0x1f, 0x1b, 0x80, 0x3b, 0x04, 0x39, 0x3b, 0x3e, 0x3f, 0x1f, 0x81, 0x3f, 0x09, 0x3b, 0x3f,
+  0x3b, 0x3e, 0x3f, 0x3e, 0x3e, 0x1f, 0x1b, 0x3b, 0x80, 0x39, 0x14, 0x1d, 0x17, 0x37, 0x27, 0x3d,
+  0x1f, 0x0f, 0x1d, 0x15, 0x33, 0x39, 0x3e, 0x2e, 0x3e, 0x2a, 0x2b, 0x2b, 0x2e, 0x0f, 0x0f, 0x30,
+  0x80, 0x3f, 0x0b, 0x3e, 0x2c, 0x0c, 0x30, 0x2e, 0x21, 0x36, 0x0f, 0x35, 0x14, 0x25, 0x37, 0x80,
+  0x3f, 0x03, 0x3e, 0x3f, 0x37, 0x3e, 0x82, 0x3f, 0x12, 0x07, 0x3f, 0x2b, 0x39, 0x3f, 0x2f, 0x2f,
+  0x3d, 0x1f, 0x0f, 0x1d, 0x1d, 0x1f, 0x1d, 0x1f, 0x27, 0x1f, 0x17, 0x39, 0x80, 0x3b, 0x04, 0x39,
+  0x39, 0x3f, 0x3f, 0x33, 0x80, 0x3b, 0x04, 0x2b, 0x3b, 0x2b, 0x39, 0x3b, 0x80, 0x3f, 0x32, 0x3b,
+  0x3b, 0x39, 0x3b, 0x2b, 0x3b, 0x3b, 0x3f, 0x3b, 0x3e, 0x1f, 0x1f, 0x3f, 0x3f, 0x0e, 0x06, 0x36,
+  0x3c, 0x36, 0x36, 0x3c, 0x36, 0x2e, 0x26, 0x35, 0x37, 0x26, 0x36, 0x34, 0x34, 0x3c, 0x34, 0x3e,
+  0x30, 0x3f, 0x3f, 0x1f, 0x1b, 0x3a, 0x3f, 0x3f, 0x1f, 0x19, 0x3b, 0x3b, 0x39, 0x3b, 0x3b, 0x3a,
+  0x3e, 0x3a, 0x80, 0x3f, 0x82, 0x1f, 0x04, 0x3b, 0x3e, 0x3f, 0x1f, 0x0f, 0x80, 0x1f, 0x04, 0x0f,
+  0x1b, 0x3f, 0x1e, 0x3f, 0x84, 0x1f, 0x07, 0x33, 0x37, 0x3e, 0x1f, 0x1f, 0x1b, 0x3b, 0x2b, 0x80,
+  0x1f, 0x0c, 0x37, 0x3f, 0x3f, 0x3b, 0x3b, 0x3f, 0x3f, 0x3b, 0x3f, 0x1f, 0x3f, 0x3f, 0x33, 0x80,
+  0x3b, 0x01, 0x2b, 0x3b, 0x80, 0x1f, 0x02, 0x1d, 0x1f, 0x1f, 0x80, 0x37, 0x83, 0x1f, 0x03, 0x3f,
+  0x37, 0x17, 0x17, 0x81, 0x3b, 0x81, 0x1f, 0x04, 0x17, 0x37, 0x1b, 0x3f, 0x1f, 0x82, 0x3f, 0x1c,
+  0x3a, 0x3f, 0x31, 0x39, 0x3c, 0x1d, 0x17, 0x1e, 0x0f, 0x3e, 0x3c, 0x3a, 0x3a, 0x2b, 0x31, 0x3c,
+  0x1c, 0x1f, 0x0c, 0x1e, 0x2f, 0x3c, 0x3c, 0x1d, 0x38, 0x3c, 0x1d, 0x1c, 0x3f, 0x80, 0x3c, 0x02,
+  0x20, 0x04, 0x1f, 0x84, 0x3f, 0x03, 0x38, 0x37, 0x3f, 0x37, 0x84, 0x3f, 0x19, 0x37, 0x3f, 0x37,
+  0x3f, 0x38, 0x3f, 0x3f, 0x0f, 0x37, 0x3e, 0x3a, 0x2b, 0x39, 0x3b, 0x2b, 0x3b, 0x2b, 0x2b, 0x3f,
+  0x3e, 0x3d, 0x3b, 0x3f, 0x1d, 0x1f, 0x0f, 0x80, 0x1f, 0x04, 0x33, 0x3f, 0x37, 0x1f, 0x0f, 0x82,
+  0x1f, 0x02, 0x3a, 0x3f, 0x3f, 0x81, 0x1f, 0x04, 0x1b, 0x39, 0x3b, 0x3e, 0x3e, 0x80, 0x3f, 0x0d,
+  0x3b, 0x20, 0x36, 0x3c, 0x3c, 0x36, 0x2e, 0x2e, 0x26, 0x3c, 0x36, 0x2a, 0x26, 0x22, 0x80, 0x2e,
+  0x0b, 0x36, 0x26, 0x3e, 0x26, 0x2e, 0x07, 0x3f, 0x1d, 0x1f, 0x3f, 0x33, 0x37, 0x82, 0x1f, 0x0d,
+  0x1b, 0x2b, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x3f, 0x3b, 0x39, 0x1f, 0x0b, 0x3e, 0x3e, 0x81, 0x3b,
+  0x00, 0x39, 0x80, 0x3b, 0x14, 0x3f, 0x33, 0x3f, 0x33, 0x3b, 0x3b, 0x2b, 0x3b, 0x1f, 0x0f, 0x1f,
+  0x3f, 0x3b, 0x3f, 0x3b, 0x3b, 0x39, 0x3b, 0x3b, 0x39, 0x3b, 0x83, 0x3f, 0x0e, 0x3b, 0x3f, 0x3b,
+  0x3b, 0x3e, 0x1e, 0x1f, 0x3f, 0x1f, 0x1b, 0x3b, 0x3b, 0x1d, 0x1f, 0x1f, 0x80, 0x3b, 0x01, 0x3f,
+  0x1f, 0x80, 0x3b, 0x18, 0x39, 0x3b, 0x2b, 0x39, 0x3b, 0x1f, 0x1f, 0x3f, 0x3f, 0x1f, 0x0f, 0x1d,
+  0x1f, 0x0f, 0x1b, 0x3b, 0x37, 0x3f, 0x3e, 0x3b, 0x3b, 0x3f, 0x3f, 0x1f, 0x3b, 0x80, 0x3f, 0x01,
+  0x3a, 0x3f, 0x80, 0x1f, 0x19, 0x0f, 0x0f, 0x1d, 0x1c, 0x1f, 0x35, 0x35, 0x17, 0x0f, 0x31, 0x39,
+  0x39, 0x31, 0x3d, 0x3e, 0x2f, 0x3e, 0x2a, 0x27, 0x05, 0x04, 0x24, 0x05, 0x3c, 0x31, 0x34, 0x80,
+  0x3f, 0x00, 0x27, 0x80, 0x25, 0x03, 0x3d, 0x3f, 0x28, 0x34, 0x81, 0x3f, 0x00, 0x3e, 0x85, 0x3f,
+  0x23, 0x3e, 0x3f, 0x30, 0x3f, 0x3f, 0x0e, 0x2a, 0x2f, 0x3f, 0x0f, 0x1d, 0x1f, 0x2f, 0x3f, 0x1f,
+  0x0e, 0x3b, 0x3e, 0x3d, 0x1f, 0x3b, 0x2b, 0x3b, 0x39, 0x39, 0x3b, 0x3f, 0x37, 0x1f, 0x2b, 0x3b,
+  0x3b, 0x2b, 0x3b, 0x2b, 0x3b, 0x80, 0x3f, 0x2c, 0x1f, 0x19, 0x3b, 0x1f, 0x1f, 0x1b, 0x3b, 0x3f,
+  0x1f, 0x3f, 0x3f, 0x38, 0x14, 0x36, 0x3e, 0x2e, 0x37, 0x20, 0x30, 0x30, 0x3c, 0x36, 0x2e, 0x34,
+  0x3e, 0x3c, 0x36, 0x30, 0x34, 0x3c, 0x3c, 0x34, 0x3c, 0x34, 0x34, 0x07, 0x3f, 0x1f, 0x17, 0x3f,
+  0x1f, 0x3d, 0x1f, 0x1f, 0x19, 0x81, 0x3b, 0x04, 0x37, 0x37, 0x3f, 0x3f, 0x1f, 0x83, 0x3b, 0x01,
+  0x3e, 0x3f, 0x83, 0x1f, 0x0f, 0x1b, 0x3f, 0x37, 0x3f, 0x1d, 0x1f, 0x1f, 0x1d, 0x1f, 0x1b, 0x3b,
+  0x3a, 0x3e, 0x3e, 0x1f, 0x0f, 0x83, 0x1f, 0x80, 0x3f, 0x0c, 0x1f, 0x3f, 0x3f, 0x3b, 0x3b, 0x39,
+  0x1f, 0x3f, 0x3f, 0x33, 0x3b, 0x3b, 0x2b, 0x80, 0x3b, 0x13, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x37,
+  0x37, 0x3f, 0x1d, 0x1b, 0x3b, 0x1f, 0x1b, 0x3b, 0x2b, 0x37, 0x33, 0x3e, 0x3b, 0x3b, 0x80, 0x1f,
+  0x08, 0x1d, 0x1f, 0x3b, 0x37, 0x1f, 0x3f, 0x0f, 0x1f, 0x1f, 0x82, 0x3f, 0x01, 0x37, 0x37, 0x80,
+  0x0f, 0x0f, 0x17, 0x0e, 0x0e, 0x1f, 0x34, 0x3e, 0x3e, 0x2b, 0x23, 0x2a, 0x2e, 0x0e, 0x2b, 0x26,
+  0x2c, 0x34, 0x81, 0x24, 0x02, 0x25, 0x24, 0x24, 0x80, 0x3f, 0x09, 0x2c, 0x24, 0x24, 0x25, 0x20,
+  0x2f, 0x3f, 0x35, 0x04, 0x37, 0x81, 0x3f, 0x06, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x83,
+  0x3f, 0x00, 0x07, 0x80, 0x3f, 0x03, 0x37, 0x0f, 0x0f, 0x2f, 0x80, 0x3f, 0x3c, 0x2b, 0x3f, 0x2e,
+  0x3b, 0x3b, 0x3f, 0x3f, 0x1f, 0x0f, 0x0f, 0x1f, 0x1e, 0x3f, 0x3f, 0x37, 0x1f, 0x1d, 0x1f, 0x1f,
+  0x0f, 0x1f, 0x1f, 0x37, 0x3f, 0x3f, 0x3b, 0x3b, 0x39, 0x3b, 0x2b, 0x3f, 0x1f, 0x3f, 0x3f, 0x3b,
+  0x20, 0x26, 0x3e, 0x2e, 0x26, 0x34, 0x00, 0x16, 0x37, 0x36, 0x36, 0x2e, 0x35, 0x37, 0x26, 0x27,
+  0x35, 0x37, 0x34, 0x36, 0x35, 0x36, 0x36, 0x2e, 0x36, 0x20, 0x80, 0x3f, 0x09, 0x17, 0x37, 0x1b,
+  0x3b, 0x2b, 0x3b, 0x3b, 0x2b, 0x3b, 0x3e, 0x81, 0x3f, 0x01, 0x3b, 0x39, 0x80, 0x3b, 0x0f, 0x3e,
+  0x3f, 0x33, 0x3f, 0x1d, 0x1b, 0x3b, 0x1f, 0x0b, 0x39, 0x3f, 0x33, 0x3b, 0x37, 0x3b, 0x3b, 0x81,
+  0x1f, 0x03, 0x0f, 0x3f, 0x3b, 0x3f, 0x81, 0x3b, 0x02, 0x2b, 0x3b, 0x3b, 0x82, 0x3f, 0x16, 0x1f,
+  0x1b, 0x1d, 0x1f, 0x1f, 0x3b, 0x37, 0x17, 0x3f, 0x1d, 0x1f, 0x1f, 0x1d, 0x1f, 0x1d, 0x3b, 0x1f,
+  0x1b, 0x39, 0x3f, 0x1f, 0x3b, 0x3e, 0x84, 0x1f, 0x01, 0x3f, 0x3e, 0x85, 0x3b, 0x08, 0x3f, 0x3f,
+  0x37, 0x33, 0x3b, 0x2b, 0x3b, 0x3f, 0x1f, 0x81, 0x3f, 0x0f, 0x1e, 0x3a, 0x3b, 0x31, 0x39, 0x3b,
+  0x39, 0x3c, 0x3e, 0x3e, 0x0e, 0x2a, 0x2e, 0x0f, 0x07, 0x21, 0x80, 0x24, 0x07, 0x25, 0x24, 0x25,
+  0x24, 0x2c, 0x24, 0x04, 0x28, 0x81, 0x24, 0x06, 0x25, 0x20, 0x2c, 0x2f, 0x3f, 0x04, 0x0e, 0x81,
+  0x3f, 0x01, 0x37, 0x37, 0x85, 0x3f, 0x01, 0x37, 0x3e, 0x80, 0x3f, 0x20, 0x3c, 0x07, 0x3f, 0x27,
+  0x2f, 0x31, 0x3f, 0x3f, 0x1c, 0x00, 0x07, 0x3f, 0x2e, 0x1f, 0x3f, 0x27, 0x3d, 0x3f, 0x2b, 0x2b,
+  0x3b, 0x3b, 0x2f, 0x3f, 0x33, 0x3f, 0x1d, 0x1f, 0x1b, 0x2b, 0x3b, 0x3b, 0x2b, 0x80, 0x3f, 0x18,
+  0x3b, 0x2b, 0x3b, 0x3b, 0x3f, 0x1f, 0x3f, 0x3d, 0x30, 0x36, 0x37, 0x3e, 0x2e, 0x37, 0x30, 0x02,
+  0x16, 0x36, 0x0e, 0x26, 0x2e, 0x35, 0x36, 0x34, 0x37, 0x80, 0x34, 0x13, 0x37, 0x23, 0x26, 0x14,
+  0x2e, 0x14, 0x3c, 0x3e, 0x07, 0x3f, 0x17, 0x3f, 0x3e, 0x3f, 0x1f, 0x1b, 0x3b, 0x3b, 0x1f, 0x1f,
+  0x82, 0x3f, 0x0b, 0x3b, 0x3b, 0x1f, 0x1f, 0x0f, 0x1f, 0x3b, 0x3f, 0x37, 0x3b, 0x3b, 0x39, 0x81,
+  0x3b, 0x01, 0x3f, 0x37, 0x80, 0x3b, 0x0e, 0x2b, 0x3b, 0x39, 0x3b, 0x3b, 0x33, 0x3e, 0x3a, 0x3b,
+  0x3b, 0x1d, 0x1b, 0x3b, 0x1d, 0x1f, 0x82, 0x3f, 0x0f, 0x1f, 0x1f, 0x3b, 0x3b, 0x1f, 0x1f, 0x3f,
+  0x3f, 0x17, 0x3b, 0x3b, 0x1f, 0x1b, 0x3b, 0x3b, 0x1f, 0x80, 0x3b, 0x80, 0x3e, 0x02, 0x3f, 0x3b,
+  0x3b, 0x80, 0x3f, 0x0e, 0x1f, 0x3e, 0x1f, 0x3f, 0x3e, 0x3b, 0x39, 0x3b, 0x0f, 0x1b, 0x3b, 0x3f,
+  0x33, 0x33, 0x3f, 0x80, 0x1f, 0x07, 0x0f, 0x1f, 0x3f, 0x1f, 0x3f, 0x3d, 0x3f, 0x27, 0x80, 0x0f,
+  0x08, 0x15, 0x31, 0x37, 0x23, 0x35, 0x15, 0x37, 0x35, 0x15, 0x80, 0x24, 0x00, 0x20, 0x83, 0x24,
+  0x19, 0x04, 0x2c, 0x24, 0x24, 0x2c, 0x24, 0x24, 0x25, 0x24, 0x25, 0x3f, 0x3e, 0x04, 0x3f, 0x3f,
+  0x3e, 0x3f, 0x3f, 0x37, 0x2f, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x83, 0x3f, 0x14, 0x37, 0x3f,
+  0x3f, 0x38, 0x3f, 0x3f, 0x15, 0x3f, 0x3f, 0x0c, 0x25, 0x3c, 0x28, 0x3f, 0x3f, 0x27, 0x37, 0x3b,
+  0x3f, 0x1f, 0x3b, 0x80, 0x39, 0x10, 0x3e, 0x1f, 0x3f, 0x37, 0x3b, 0x39, 0x3b, 0x3b, 0x0f, 0x1f,
+  0x3f, 0x33, 0x3f, 0x3e, 0x3f, 0x1f, 0x1f, 0x80, 0x3f, 0x01, 0x06, 0x06, 0x81, 0x3f, 0x1c, 0x35,
+  0x00, 0x12, 0x3e, 0x2a, 0x2e, 0x35, 0x37, 0x34, 0x3e, 0x27, 0x27, 0x34, 0x37, 0x37, 0x27, 0x26,
+  0x34, 0x3e, 0x2e, 0x34, 0x3e, 0x26, 0x34, 0x30, 0x3f, 0x3f, 0x33, 0x3f, 0x80, 0x1f, 0x00, 0x0f,
+  0x80, 0x1f, 0x00, 0x17, 0x80, 0x3f, 0x08, 0x3b, 0x1f, 0x1f, 0x1d, 0x1b, 0x3b, 0x3e, 0x3e, 0x3f,
+  0x84, 0x1f, 0x03, 0x3e, 0x3f, 0x3f, 0x37, 0x80, 0x3b, 0x81, 0x1f, 0x03, 0x3f, 0x37, 0x3f, 0x3f,
+  0x82, 0x1f, 0x82, 0x3f, 0x0c, 0x1f, 0x1d, 0x1f, 0x1b, 0x39, 0x3b, 0x3e, 0x1f, 0x37, 0x3f, 0x1f,
+  0x1f, 0x0f, 0x80, 0x1f, 0x0b, 0x3f, 0x1d, 0x1f, 0x1f, 0x3b, 0x3f, 0x1f, 0x3a, 0x3f, 0x1d, 0x1f,
+  0x1f, 0x81, 0x3f, 0x02, 0x1e, 0x1f, 0x3f, 0x81, 0x3b, 0x06, 0x2b, 0x3b, 0x3f, 0x3f, 0x37, 0x3e,
+  0x3f, 0x80, 0x1f, 0x0e, 0x0f, 0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x3e, 0x38, 0x3e, 0x0f, 0x1d, 0x38,
+  0x3e, 0x2e, 0x2e, 0x80, 0x24, 0x02, 0x20, 0x24, 0x04, 0x82, 0x24, 0x15, 0x2c, 0x24, 0x24, 0x20,
+  0x24, 0x0c, 0x24, 0x24, 0x2c, 0x24, 0x25, 0x3f, 0x3c, 0x04, 0x3f, 0x3e, 0x3e, 0x3f, 0x3f, 0x37,
+  0x2e, 0x2e, 0x81, 0x3f, 0x04, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x81, 0x3f, 0x21, 0x3e, 0x3f, 0x3f,
+  0x22, 0x2f, 0x3f, 0x35, 0x3f, 0x04, 0x0e, 0x28, 0x24, 0x07, 0x3b, 0x3f, 0x2b, 0x2e, 0x2f, 0x2f,
+  0x3d, 0x1f, 0x0f, 0x1f, 0x3f, 0x3d, 0x17, 0x3b, 0x3d, 0x1f, 0x1f, 0x0f, 0x1f, 0x0f, 0x17, 0x83,
+  0x3f, 0x27, 0x3e, 0x0e, 0x06, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x34, 0x02, 0x16, 0x16, 0x12, 0x36,
+  0x34, 0x3e, 0x36, 0x2e, 0x34, 0x3e, 0x36, 0x26, 0x3c, 0x34, 0x36, 0x36, 0x2e, 0x34, 0x34, 0x3e,
+  0x26, 0x3c, 0x3e, 0x2e, 0x07, 0x3f, 0x3f, 0x37, 0x3e, 0x39, 0x80, 0x3b, 0x00, 0x2b, 0x83, 0x3f,
+  0x22, 0x1f, 0x0f, 0x1f, 0x1f, 0x1e, 0x3f, 0x3f, 0x1f, 0x3e, 0x3b, 0x39, 0x3b, 0x3b, 0x2b, 0x3b,
+  0x3b, 0x3f, 0x17, 0x1f, 0x37, 0x1f, 0x1f, 0x1d, 0x1b, 0x3b, 0x3e, 0x3f, 0x3b, 0x37, 0x1e, 0x39,
+  0x3b, 0x3b, 0x2b, 0x3b, 0x81, 0x3f, 0x0b, 0x3e, 0x3f, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x3f, 0x37,
+  0x3b, 0x3f, 0x37, 0x80, 0x1f, 0x00, 0x1d, 0x81, 0x1f, 0x09, 0x3e, 0x3e, 0x3f, 0x37, 0x1f, 0x3e,
+  0x1f, 0x1f, 0x3f, 0x1f, 0x81, 0x3f, 0x01, 0x3e, 0x1f, 0x80, 0x3b, 0x0d, 0x2b, 0x3f, 0x37, 0x33,
+  0x3f, 0x1f, 0x33, 0x3b, 0x39, 0x3b, 0x2b, 0x3b, 0x37, 0x27, 0x80, 0x3f, 0x07, 0x23, 0x3d, 0x1d,
+  0x15, 0x15, 0x17, 0x26, 0x34, 0x8a, 0x24, 0x02, 0x2c, 0x24, 0x25, 0x80, 0x24, 0x11, 0x2c, 0x24,
+  0x27, 0x3e, 0x38, 0x27, 0x3f, 0x3e, 0x2f, 0x3f, 0x2e, 0x3d, 0x00, 0x20, 0x27, 0x3e, 0x3f, 0x3e,
+  0x83, 0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x82, 0x3f, 0x1b, 0x20, 0x3f, 0x2f, 0x38, 0x24, 0x3c, 0x0c,
+  0x3c, 0x27, 0x3c, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x0f, 0x1d, 0x1f, 0x2e, 0x3e, 0x3f, 0x3f, 0x37,
+  0x37, 0x39, 0x39, 0x3b, 0x3b, 0x83, 0x3f, 0x2a, 0x39, 0x30, 0x06, 0x3f, 0x3f, 0x3e, 0x3f, 0x3e,
+  0x3e, 0x24, 0x20, 0x16, 0x1e, 0x3f, 0x3e, 0x2e, 0x3e, 0x35, 0x35, 0x36, 0x3e, 0x27, 0x27, 0x35,
+  0x36, 0x2e, 0x3c, 0x3c, 0x37, 0x27, 0x06, 0x27, 0x34, 0x16, 0x26, 0x34, 0x30, 0x3f, 0x3b, 0x3f,
+  0x17, 0x3b, 0x3b, 0x80, 0x1f, 0x82, 0x3f, 0x81, 0x3b, 0x10, 0x3f, 0x3f, 0x1e, 0x1e, 0x3e, 0x3f,
+  0x3f, 0x1f, 0x1f, 0x1b, 0x3b, 0x3e, 0x3e, 0x3f, 0x3f, 0x37, 0x1f, 0x81, 0x3b, 0x05, 0x3f, 0x3b,
+  0x3e, 0x3f, 0x3f, 0x37, 0x82, 0x1f, 0x03, 0x3a, 0x3f, 0x33, 0x3a, 0x83, 0x3b, 0x12, 0x3e, 0x3b,
+  0x3f, 0x37, 0x33, 0x3f, 0x3b, 0x3b, 0x2b, 0x3b, 0x3f, 0x37, 0x3b, 0x3f, 0x1f, 0x3b, 0x3f, 0x1f,
+  0x3e, 0x80, 0x3f, 0x00, 0x1f, 0x83, 0x3f, 0x1a, 0x3e, 0x3e, 0x1f, 0x3b, 0x3f, 0x1f, 0x3b, 0x3f,
+  0x37, 0x37, 0x3f, 0x37, 0x33, 0x3f, 0x1f, 0x3e, 0x3e, 0x3f, 0x35, 0x37, 0x27, 0x3c, 0x37, 0x30,
+  0x3f, 0x27, 0x34, 0x8d, 0x24, 0x00, 0x2c, 0x83, 0x24, 0x0e, 0x27, 0x38, 0x27, 0x3e, 0x3f, 0x3f,
+  0x3e, 0x3f, 0x35, 0x14, 0x3f, 0x3f, 0x06, 0x3f, 0x2f, 0x81, 0x3f, 0x00, 0x3e, 0x85, 0x3f, 0x1d,
+  0x37, 0x3f, 0x3f, 0x0c, 0x3d, 0x3c, 0x2c, 0x05, 0x24, 0x2e, 0x28, 0x3f, 0x3d, 0x15, 0x3d, 0x3f,
+  0x2f, 0x3d, 0x3f, 0x2f, 0x3b, 0x3d, 0x1f, 0x23, 0x3d, 0x3b, 0x3f, 0x3f, 0x1f, 0x2f, 0x80, 0x3f,
+  0x2a, 0x3d, 0x30, 0x00, 0x22, 0x24, 0x35, 0x36, 0x3e, 0x3f, 0x37, 0x37, 0x24, 0x20, 0x12, 0x1e,
+  0x17, 0x37, 0x37, 0x3f, 0x3e, 0x2e, 0x36, 0x3e, 0x27, 0x36, 0x3c, 0x36, 0x2e, 0x37, 0x26, 0x27,
+  0x34, 0x36, 0x14, 0x06, 0x27, 0x35, 0x35, 0x37, 0x26, 0x07, 0x3f, 0x37, 0x80, 0x3f, 0x01, 0x3b,
+  0x3b, 0x82, 0x3f, 0x02, 0x3b, 0x37, 0x37, 0x80, 0x1f, 0x27, 0x1e, 0x3f, 0x3f, 0x3b, 0x3f, 0x17,
+  0x37, 0x3b, 0x3b, 0x3f, 0x3b, 0x3f, 0x1f, 0x33, 0x3f, 0x3f, 0x37, 0x1f, 0x3b, 0x3f, 0x3b, 0x37,
+  0x3f, 0x1e, 0x3b, 0x3f, 0x37, 0x3f, 0x1f, 0x1f, 0x3a, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f,
+  0x3b, 0x3b, 0x80, 0x3f, 0x14, 0x37, 0x1f, 0x3f, 0x3b, 0x37, 0x3f, 0x1f, 0x1f, 0x33, 0x3f, 0x3f,
+  0x37, 0x3e, 0x3f, 0x37, 0x3e, 0x3b, 0x3f, 0x17, 0x1f, 0x3e, 0x83, 0x3f, 0x03, 0x3b, 0x3f, 0x3e,
+  0x3f, 0x80, 0x37, 0x04, 0x3f, 0x1f, 0x3e, 0x1f, 0x3f, 0x80, 0x3e, 0x09, 0x1d, 0x3e, 0x1e, 0x3f,
+  0x37, 0x3e, 0x37, 0x31, 0x37, 0x26, 0x8b, 0x24, 0x00, 0x2c, 0x82, 0x24, 0x00, 0x25, 0x80, 0x24,
+  0x1b, 0x2f, 0x3c, 0x07, 0x3f, 0x37, 0x2e, 0x3f, 0x3d, 0x30, 0x27, 0x3f, 0x3d, 0x3c, 0x3f, 0x3f,
+  0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x2e, 0x26, 0x2f, 0x3f, 0x3f, 0x37, 0x3e, 0x80, 0x3f, 0x23,
+  0x3e, 0x3f, 0x07, 0x24, 0x25, 0x24, 0x20, 0x25, 0x24, 0x3f, 0x2f, 0x3f, 0x23, 0x3d, 0x3f, 0x3f,
+  0x38, 0x3e, 0x2f, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x17, 0x3f, 0x1e, 0x3f, 0x3f, 0x10, 0x00,
+  0x06, 0x26, 0x24, 0x17, 0x80, 0x26, 0x09, 0x3e, 0x38, 0x24, 0x24, 0x02, 0x32, 0x33, 0x37, 0x37,
+  0x3f, 0x80, 0x37, 0x1a, 0x27, 0x26, 0x3e, 0x27, 0x36, 0x3c, 0x36, 0x2e, 0x37, 0x34, 0x3e, 0x2e,
+  0x20, 0x27, 0x34, 0x36, 0x26, 0x26, 0x35, 0x30, 0x3f, 0x3b, 0x3e, 0x1e, 0x3b, 0x3f, 0x37, 0x85,
+  0x3f, 0x32, 0x37, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3b, 0x3f, 0x3e, 0x3f, 0x37,
+  0x3e, 0x3f, 0x3f, 0x33, 0x37, 0x3f, 0x37, 0x1f, 0x37, 0x3f, 0x3f, 0x17, 0x3f, 0x3e, 0x3b, 0x3f,
+  0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x17, 0x3f, 0x3e, 0x3e, 0x3b, 0x3e, 0x3f, 0x3e, 0x3a, 0x3b, 0x37,
+  0x3f, 0x3e, 0x1f, 0x37, 0x3b, 0x81, 0x3f, 0x0a, 0x37, 0x3f, 0x3f, 0x1f, 0x33, 0x3f, 0x1f, 0x3f,
+  0x37, 0x3f, 0x3e, 0x85, 0x3f, 0x16, 0x37, 0x3f, 0x3b, 0x3f, 0x1f, 0x3b, 0x3e, 0x3e, 0x3f, 0x3e,
+  0x3e, 0x3f, 0x33, 0x3e, 0x3e, 0x37, 0x3c, 0x3e, 0x2e, 0x2e, 0x0e, 0x2e, 0x3c, 0x91, 0x24, 0x11,
+  0x3c, 0x24, 0x24, 0x25, 0x24, 0x26, 0x3c, 0x3f, 0x37, 0x2f, 0x3f, 0x27, 0x22, 0x2f, 0x3f, 0x25,
+  0x37, 0x06, 0x80, 0x3f, 0x09, 0x3e, 0x3f, 0x38, 0x2c, 0x04, 0x35, 0x3d, 0x30, 0x27, 0x37, 0x81,
+  0x3f, 0x05, 0x3e, 0x3f, 0x3f, 0x3e, 0x05, 0x24, 0x80, 0x2c, 0x07, 0x20, 0x2f, 0x2c, 0x2d, 0x3c,
+  0x3f, 0x3d, 0x3d, 0x80, 0x3f, 0x10, 0x2f, 0x3c, 0x3f, 0x2f, 0x1d, 0x3d, 0x3f, 0x27, 0x3f, 0x3f,
+  0x00, 0x20, 0x22, 0x23, 0x20, 0x10, 0x20, 0x80, 0x00, 0x09, 0x04, 0x04, 0x24, 0x04, 0x12, 0x12,
+  0x3a, 0x36, 0x3f, 0x37, 0x80, 0x3f, 0x14, 0x30, 0x3e, 0x35, 0x36, 0x35, 0x36, 0x2e, 0x37, 0x26,
+  0x2e, 0x34, 0x36, 0x38, 0x22, 0x2e, 0x35, 0x37, 0x35, 0x36, 0x26, 0x07, 0x81, 0x3f, 0x00, 0x37,
+  0x83, 0x3f, 0x12, 0x17, 0x3e, 0x1f, 0x3b, 0x3f, 0x3e, 0x3e, 0x3b, 0x3f, 0x1f, 0x3f, 0x17, 0x3e,
+  0x3e, 0x3f, 0x3f, 0x1f, 0x3b, 0x3e, 0x80, 0x3f, 0x08, 0x1f, 0x3f, 0x37, 0x1f, 0x33, 0x37, 0x3f,
+  0x3f, 0x1f, 0x80, 0x3f, 0x0b, 0x3e, 0x1f, 0x3b, 0x37, 0x3f, 0x3f, 0x1f, 0x3b, 0x3f, 0x3b, 0x3e,
+  0x1f, 0x80, 0x3f, 0x00, 0x3a, 0x80, 0x3f, 0x03, 0x37, 0x3a, 0x3e, 0x1e, 0x83, 0x3f, 0x07, 0x37,
+  0x3e, 0x1f, 0x3b, 0x37, 0x3b, 0x3f, 0x17, 0x84, 0x3f, 0x14, 0x17, 0x3e, 0x3f, 0x37, 0x3e, 0x3f,
+  0x1f, 0x3a, 0x3f, 0x1e, 0x3a, 0x3f, 0x35, 0x3e, 0x1e, 0x3e, 0x1e, 0x3a, 0x3e, 0x3c, 0x34, 0x84,
+  0x24, 0x00, 0x34, 0x82, 0x24, 0x00, 0x26, 0x88, 0x24, 0x13, 0x27, 0x3d, 0x07, 0x3e, 0x2f, 0x37,
+  0x37, 0x38, 0x27, 0x3c, 0x2c, 0x3f, 0x2c, 0x3f, 0x3f, 0x37, 0x3f, 0x35, 0x04, 0x27, 0x82, 0x3f,
+  0x00, 0x2a, 0x80, 0x3f, 0x00, 0x3e, 0x82, 0x3f, 0x14, 0x04, 0x04, 0x24, 0x04, 0x2c, 0x2c, 0x07,
+  0x3d, 0x2c, 0x2d, 0x2d, 0x2f, 0x3d, 0x3c, 0x39, 0x37, 0x1c, 0x3b, 0x3d, 0x37, 0x3e, 0x81, 0x3f,
+  0x02, 0x00, 0x24, 0x06, 0x80, 0x3f, 0x01, 0x38, 0x04, 0x81, 0x24, 0x25, 0x20, 0x24, 0x02, 0x12,
+  0x1e, 0x16, 0x3f, 0x3f, 0x3e, 0x37, 0x3f, 0x37, 0x36, 0x3c, 0x3e, 0x35, 0x36, 0x3e, 0x37, 0x26,
+  0x37, 0x36, 0x2e, 0x3c, 0x36, 0x04, 0x34, 0x3e, 0x06, 0x26, 0x3c, 0x36, 0x22, 0x3f, 0x3e, 0x1f,
+  0x37, 0x3b, 0x84, 0x3f, 0x16, 0x1f, 0x3e, 0x3f, 0x33, 0x3b, 0x3f, 0x3f, 0x37, 0x3e, 0x1f, 0x3f,
+  0x3f, 0x1f, 0x3a, 0x3e, 0x3f, 0x37, 0x3f, 0x3b, 0x37, 0x3e, 0x3f, 0x17, 0x81, 0x3f, 0x02, 0x17,
+  0x37, 0x3e, 0x83, 0x3f, 0x05, 0x3b, 0x37, 0x17, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x06, 0x37, 0x3e,
+  0x1f, 0x3f, 0x3a, 0x3f, 0x1f, 0x86, 0x3f, 0x80, 0x3b, 0x81, 0x3f, 0x03, 0x37, 0x3f, 0x3b, 0x37,
+  0x84, 0x3f, 0x10, 0x1f, 0x3a, 0x3f, 0x3b, 0x37, 0x1f, 0x3f, 0x37, 0x3f, 0x3e, 0x3b, 0x37, 0x37,
+  0x2e, 0x2b, 0x27, 0x27, 0x96, 0x24, 0x04, 0x25, 0x24, 0x24, 0x3c, 0x3e, 0x80, 0x3f, 0x06, 0x38,
+  0x27, 0x3e, 0x2c, 0x25, 0x38, 0x37, 0x80, 0x3f, 0x04, 0x20, 0x3c, 0x3f, 0x3d, 0x35, 0x80, 0x2c,
+  0x11, 0x25, 0x3f, 0x24, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3e, 0x24, 0x04, 0x04, 0x25,
+  0x24, 0x25, 0x27, 0x80, 0x2d, 0x10, 0x25, 0x2d, 0x2d, 0x2f, 0x2f, 0x3d, 0x3f, 0x2f, 0x2b, 0x3b,
+  0x2f, 0x2f, 0x15, 0x3f, 0x38, 0x24, 0x00, 0x80, 0x3f, 0x01, 0x3c, 0x04, 0x82, 0x20, 0x21, 0x24,
+  0x04, 0x02, 0x12, 0x12, 0x3c, 0x3e, 0x3e, 0x37, 0x3f, 0x37, 0x36, 0x27, 0x3f, 0x34, 0x3e, 0x3c,
+  0x35, 0x34, 0x3e, 0x2e, 0x27, 0x34, 0x37, 0x27, 0x20, 0x2e, 0x34, 0x34, 0x3e, 0x26, 0x3c, 0x3c,
+  0x07, 0x82, 0x3f, 0x07, 0x3d, 0x3f, 0x3f, 0x3b, 0x3b, 0x3e, 0x3e, 0x3b, 0x80, 0x3f, 0x00, 0x37,
+  0x80, 0x3b, 0x03, 0x3e, 0x3f, 0x17, 0x3e, 0x83, 0x3f, 0x0a, 0x1f, 0x3b, 0x3f, 0x3f, 0x3e, 0x3f,
+  0x37, 0x1f, 0x3f, 0x1f, 0x1f, 0x81, 0x3f, 0x03, 0x3a, 0x3e, 0x3f, 0x3f, 0x80, 0x3b, 0x0c, 0x3f,
+  0x3a, 0x3f, 0x33, 0x3f, 0x1f, 0x3f, 0x1f, 0x1f, 0x3f, 0x3e, 0x3b, 0x37, 0x85, 0x3f, 0x80, 0x1f,
+  0x08, 0x17, 0x3a, 0x3f, 0x3b, 0x37, 0x3f, 0x3b, 0x1b, 0x3b, 0x80, 0x3f, 0x12, 0x3a, 0x3f, 0x37,
+  0x3f, 0x3b, 0x3b, 0x2b, 0x39, 0x33, 0x3e, 0x3e, 0x2e, 0x3e, 0x3d, 0x37, 0x15, 0x1c, 0x1c, 0x04,
+  0x80, 0x24, 0x04, 0x34, 0x26, 0x24, 0x26, 0x20, 0x87, 0x24, 0x24, 0x04, 0x24, 0x2c, 0x24, 0x24,
+  0x2c, 0x24, 0x34, 0x24, 0x3f, 0x07, 0x3f, 0x27, 0x35, 0x30, 0x27, 0x3d, 0x24, 0x24, 0x3f, 0x27,
+  0x3f, 0x37, 0x3e, 0x3c, 0x1f, 0x2f, 0x3c, 0x2c, 0x2c, 0x25, 0x05, 0x25, 0x25, 0x27, 0x39, 0x37,
+  0x83, 0x3f, 0x09, 0x3c, 0x04, 0x24, 0x04, 0x04, 0x25, 0x24, 0x27, 0x3d, 0x05, 0x82, 0x2d, 0x13,
+  0x25, 0x2f, 0x0f, 0x0b, 0x2b, 0x2f, 0x3b, 0x3f, 0x2f, 0x3a, 0x04, 0x04, 0x07, 0x3f, 0x1f, 0x39,
+  0x06, 0x04, 0x04, 0x20, 0x80, 0x24, 0x21, 0x06, 0x20, 0x12, 0x10, 0x14, 0x36, 0x26, 0x27, 0x3e,
+  0x3e, 0x3c, 0x38, 0x3f, 0x36, 0x3f, 0x36, 0x3e, 0x3e, 0x37, 0x30, 0x36, 0x3e, 0x27, 0x34, 0x36,
+  0x20, 0x36, 0x2e, 0x3e, 0x22, 0x3c, 0x36, 0x26, 0x37, 0x81, 0x3f, 0x80, 0x00, 0x08, 0x3b, 0x1f,
+  0x0f, 0x1f, 0x3f, 0x3f, 0x37, 0x1e, 0x3f, 0x83, 0x1f, 0x02, 0x3f, 0x3f, 0x1f, 0x80, 0x3f, 0x80,
+  0x3b, 0x07, 0x3e, 0x3f, 0x3b, 0x3f, 0x1f, 0x3f, 0x37, 0x1b, 0x82, 0x3f, 0x08, 0x3b, 0x3f, 0x3f,
+  0x1f, 0x1b, 0x3b, 0x3b, 0x3f, 0x3a, 0x80, 0x3f, 0x01, 0x37, 0x3e, 0x80, 0x1f, 0x00, 0x1b, 0x88,
+  0x3f, 0x0d, 0x3b, 0x39, 0x3b, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3b, 0x3f, 0x0f, 0x1b, 0x3b,
+  0x81, 0x3f, 0x02, 0x3e, 0x3f, 0x0f, 0x80, 0x1f, 0x0b, 0x3f, 0x3a, 0x3f, 0x27, 0x37, 0x27, 0x0e,
+  0x0e, 0x2c, 0x24, 0x24, 0x26, 0x84, 0x24, 0x00, 0x20, 0x80, 0x24, 0x00, 0x20, 0x80, 0x24, 0x03,
+  0x04, 0x24, 0x04, 0x26, 0x80, 0x24, 0x3c, 0x25, 0x24, 0x24, 0x27, 0x07, 0x27, 0x3f, 0x38, 0x27,
+  0x2f, 0x04, 0x04, 0x07, 0x2a, 0x27, 0x27, 0x3f, 0x3d, 0x07, 0x2e, 0x2c, 0x25, 0x24, 0x20, 0x2c,
+  0x2c, 0x28, 0x2c, 0x2c, 0x2f, 0x28, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x3c, 0x24, 0x04, 0x24,
+  0x04, 0x04, 0x2c, 0x28, 0x3d, 0x2d, 0x2d, 0x25, 0x2d, 0x25, 0x2d, 0x2d, 0x25, 0x2d, 0x2d, 0x39,
+  0x39, 0x2f, 0x27, 0x3f, 0x80, 0x20, 0x2e, 0x37, 0x1d, 0x3f, 0x06, 0x20, 0x20, 0x24, 0x04, 0x04,
+  0x00, 0x20, 0x24, 0x02, 0x12, 0x02, 0x26, 0x27, 0x27, 0x34, 0x35, 0x37, 0x26, 0x26, 0x3f, 0x3c,
+  0x3f, 0x3f, 0x37, 0x22, 0x26, 0x3c, 0x35, 0x34, 0x3e, 0x37, 0x37, 0x30, 0x27, 0x34, 0x34, 0x3c,
+  0x34, 0x35, 0x37, 0x20, 0x1f, 0x3f, 0x82, 0x00, 0x00, 0x3f, 0x81, 0x3b, 0x00, 0x37, 0x81, 0x3f,
+  0x06, 0x3b, 0x2b, 0x39, 0x3b, 0x3e, 0x3f, 0x3e, 0x81, 0x3f, 0x0c, 0x1f, 0x1f, 0x0f, 0x1f, 0x1e,
+  0x3f, 0x37, 0x3e, 0x3b, 0x3b, 0x3f, 0x3f, 0x1f, 0x80, 0x3f, 0x12, 0x3e, 0x3f, 0x37, 0x3f, 0x1f,
+  0x0f, 0x1d, 0x1b, 0x3f, 0x3f, 0x3e, 0x1f, 0x3f, 0x1f, 0x3b, 0x39, 0x3b, 0x2b, 0x3b, 0x86, 0x3f,
+  0x15, 0x3b, 0x3f, 0x1b, 0x3b, 0x1f, 0x3f, 0x1f, 0x3f, 0x3b, 0x3b, 0x1f, 0x1b, 0x3b, 0x39, 0x3b,
+  0x3e, 0x3f, 0x33, 0x3e, 0x1f, 0x1b, 0x3b, 0x80, 0x2b, 0x09, 0x27, 0x37, 0x37, 0x1e, 0x3a, 0x38,
+  0x3f, 0x24, 0x04, 0x34, 0x83, 0x24, 0x03, 0x20, 0x24, 0x20, 0x20, 0x83, 0x00, 0x00, 0x08, 0x81,
+  0x00, 0x82, 0x24, 0x06, 0x2c, 0x27, 0x27, 0x3e, 0x2c, 0x07, 0x3a, 0x80, 0x00, 0x0c, 0x3f, 0x07,
+  0x3f, 0x3f, 0x37, 0x26, 0x3f, 0x25, 0x24, 0x2c, 0x2c, 0x2d, 0x21, 0x81, 0x25, 0x04, 0x27, 0x3f,
+  0x27, 0x3f, 0x3e, 0x80, 0x3f, 0x48, 0x38, 0x24, 0x20, 0x24, 0x27, 0x20, 0x24, 0x25, 0x3d, 0x0d,
+  0x29, 0x2f, 0x2d, 0x3d, 0x3d, 0x2d, 0x2d, 0x29, 0x2d, 0x2d, 0x0f, 0x1d, 0x3f, 0x3a, 0x04, 0x04,
+  0x00, 0x3f, 0x3f, 0x38, 0x20, 0x04, 0x20, 0x20, 0x24, 0x14, 0x24, 0x04, 0x20, 0x02, 0x10, 0x14,
+  0x3c, 0x34, 0x34, 0x3e, 0x26, 0x34, 0x30, 0x07, 0x37, 0x27, 0x37, 0x3f, 0x3f, 0x34, 0x3e, 0x37,
+  0x26, 0x3e, 0x35, 0x34, 0x34, 0x38, 0x36, 0x2e, 0x3e, 0x34, 0x3e, 0x06, 0x26, 0x34, 0x22, 0x80,
+  0x00, 0x0e, 0x24, 0x00, 0x00, 0x3b, 0x3b, 0x1f, 0x0f, 0x1f, 0x3f, 0x1e, 0x3f, 0x17, 0x3b, 0x1f,
+  0x1b, 0x80, 0x3b, 0x01, 0x3f, 0x1f, 0x80, 0x3f, 0x82, 0x3b, 0x82, 0x3f, 0x09, 0x1f, 0x3b, 0x3f,
+  0x3f, 0x1f, 0x3b, 0x37, 0x3f, 0x3b, 0x3f, 0x83, 0x1f, 0x08, 0x3e, 0x3f, 0x3f, 0x37, 0x3b, 0x1f,
+  0x1f, 0x1b, 0x3b, 0x83, 0x3f, 0x00, 0x1b, 0x82, 0x3f, 0x09, 0x1f, 0x1f, 0x0f, 0x1f, 0x37, 0x1f,
+  0x37, 0x3f, 0x1f, 0x0f, 0x81, 0x1f, 0x03, 0x3b, 0x3e, 0x3f, 0x3f, 0x82, 0x3b, 0x0a, 0x3a, 0x3d,
+  0x37, 0x37, 0x27, 0x23, 0x24, 0x04, 0x24, 0x20, 0x26, 0x83, 0x24, 0x07, 0x20, 0x20, 0x00, 0x00,
+  0x02, 0x00, 0x10, 0x02, 0x81, 0x00, 0x03, 0x08, 0x00, 0x00, 0x04, 0x81, 0x24, 0x05, 0x27, 0x04,
+  0x37, 0x06, 0x3b, 0x20, 0x80, 0x00, 0x0a, 0x38, 0x27, 0x3e, 0x3f, 0x3c, 0x1d, 0x3d, 0x24, 0x2c,
+  0x25, 0x20, 0x84, 0x00, 0x02, 0x04, 0x38, 0x27, 0x80, 0x3f, 0x1f, 0x37, 0x3c, 0x20, 0x24, 0x24,
+  0x04, 0x26, 0x3f, 0x00, 0x3f, 0x2d, 0x25, 0x2d, 0x3f, 0x2f, 0x3f, 0x3f, 0x29, 0x2d, 0x2d, 0x0d,
+  0x2d, 0x2d, 0x2f, 0x38, 0x24, 0x04, 0x07, 0x3f, 0x3f, 0x04, 0x00, 0x83, 0x20, 0x0b, 0x24, 0x00,
+  0x12, 0x00, 0x2e, 0x26, 0x2a, 0x2e, 0x34, 0x3e, 0x28, 0x27, 0x80, 0x26, 0x1c, 0x3f, 0x3e, 0x3f,
+  0x20, 0x3e, 0x2e, 0x06, 0x37, 0x26, 0x3e, 0x3e, 0x30, 0x2e, 0x34, 0x34, 0x3e, 0x26, 0x3c, 0x3e,
+  0x27, 0x00, 0x00, 0x04, 0x04, 0x20, 0x20, 0x00, 0x3f, 0x1d, 0x80, 0x1f, 0x81, 0x3f, 0x05, 0x3b,
+  0x2b, 0x3b, 0x3b, 0x1d, 0x1f, 0x81, 0x3f, 0x80, 0x3b, 0x07, 0x2b, 0x1f, 0x0f, 0x3f, 0x1e, 0x3b,
+  0x37, 0x1f, 0x80, 0x3f, 0x12, 0x1f, 0x3f, 0x1f, 0x3f, 0x17, 0x3f, 0x37, 0x3b, 0x2b, 0x3b, 0x3b,
+  0x39, 0x3f, 0x1f, 0x3b, 0x3f, 0x3b, 0x3f, 0x1d, 0x81, 0x1f, 0x81, 0x3f, 0x25, 0x1f, 0x1f, 0x3f,
+  0x3f, 0x1b, 0x3b, 0x1f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x37, 0x3f, 0x3b, 0x2b, 0x3b, 0x39, 0x1f,
+  0x1f, 0x3f, 0x3e, 0x3f, 0x3f, 0x33, 0x2b, 0x39, 0x3b, 0x2a, 0x39, 0x3f, 0x37, 0x3c, 0x3e, 0x3e,
+  0x2c, 0x24, 0x26, 0x81, 0x24, 0x00, 0x26, 0x81, 0x24, 0x02, 0x20, 0x00, 0x08, 0x80, 0x00, 0x20,
+  0x01, 0x00, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x08, 0x10, 0x04, 0x24, 0x24, 0x25, 0x27, 0x38,
+  0x04, 0x3b, 0x20, 0x00, 0x00, 0x10, 0x0f, 0x38, 0x3f, 0x3f, 0x3e, 0x07, 0x27, 0x24, 0x25, 0x24,
+  0x28, 0x85, 0x00, 0x03, 0x02, 0x3f, 0x07, 0x37, 0x80, 0x3f, 0x1e, 0x38, 0x24, 0x20, 0x24, 0x27,
+  0x27, 0x3f, 0x3c, 0x2f, 0x3d, 0x2f, 0x3f, 0x2f, 0x10, 0x00, 0x3f, 0x2d, 0x2d, 0x0d, 0x2d, 0x29,
+  0x2d, 0x3f, 0x04, 0x00, 0x20, 0x27, 0x3f, 0x38, 0x20, 0x24, 0x81, 0x04, 0x80, 0x20, 0x29, 0x22,
+  0x10, 0x06, 0x26, 0x22, 0x24, 0x34, 0x3c, 0x30, 0x26, 0x28, 0x37, 0x30, 0x27, 0x34, 0x37, 0x3e,
+  0x06, 0x3f, 0x3e, 0x3c, 0x3e, 0x37, 0x26, 0x2e, 0x3c, 0x36, 0x2e, 0x3c, 0x14, 0x3c, 0x36, 0x22,
+  0x3c, 0x30, 0x24, 0x20, 0x24, 0x04, 0x00, 0x00, 0x3f, 0x81, 0x1f, 0x06, 0x37, 0x3e, 0x1f, 0x3e,
+  0x1f, 0x1f, 0x1d, 0x81, 0x1f, 0x81, 0x3f, 0x00, 0x1d, 0x80, 0x1f, 0x00, 0x1b, 0x82, 0x3f, 0x04,
+  0x3b, 0x3f, 0x3f, 0x3b, 0x1b, 0x80, 0x3f, 0x10, 0x37, 0x3b, 0x1f, 0x1f, 0x19, 0x3b, 0x1f, 0x1f,
+  0x3e, 0x3f, 0x37, 0x3f, 0x1f, 0x1f, 0x1b, 0x2b, 0x3b, 0x82, 0x3f, 0x03, 0x3b, 0x3b, 0x3f, 0x37,
+  0x80, 0x3b, 0x80, 0x1f, 0x00, 0x1e, 0x80, 0x3f, 0x82, 0x1f, 0x04, 0x0b, 0x3b, 0x3f, 0x3f, 0x17,
+  0x81, 0x3b, 0x0b, 0x39, 0x3a, 0x39, 0x37, 0x17, 0x35, 0x34, 0x04, 0x34, 0x04, 0x24, 0x04, 0x83,
+  0x24, 0x00, 0x20, 0x80, 0x00, 0x0a, 0x18, 0x1d, 0x1f, 0x1f, 0x33, 0x3b, 0x1b, 0x23, 0x1d, 0x18,
+  0x18, 0x80, 0x00, 0x08, 0x24, 0x2c, 0x24, 0x20, 0x3f, 0x3b, 0x38, 0x08, 0x1f, 0x80, 0x3f, 0x08,
+  0x27, 0x3e, 0x3e, 0x3d, 0x15, 0x18, 0x00, 0x3c, 0x3e, 0x87, 0x00, 0x16, 0x01, 0x33, 0x27, 0x3f,
+  0x37, 0x3f, 0x3c, 0x24, 0x04, 0x24, 0x04, 0x27, 0x3f, 0x3f, 0x30, 0x3f, 0x3d, 0x38, 0x00, 0x04,
+  0x00, 0x05, 0x3f, 0x81, 0x2d, 0x08, 0x2f, 0x3f, 0x00, 0x24, 0x04, 0x03, 0x3f, 0x04, 0x10, 0x83,
+  0x04, 0x30, 0x00, 0x20, 0x02, 0x00, 0x04, 0x30, 0x3c, 0x26, 0x2e, 0x06, 0x04, 0x27, 0x3e, 0x2e,
+  0x24, 0x34, 0x36, 0x3c, 0x37, 0x24, 0x3f, 0x3f, 0x26, 0x34, 0x3c, 0x37, 0x34, 0x30, 0x35, 0x36,
+  0x26, 0x3c, 0x36, 0x3c, 0x3c, 0x34, 0x34, 0x00, 0x24, 0x04, 0x24, 0x00, 0x00, 0x3f, 0x1f, 0x1b,
+  0x3b, 0x2b, 0x3b, 0x80, 0x3f, 0x82, 0x3b, 0x00, 0x1f, 0x81, 0x3f, 0x80, 0x3b, 0x81, 0x1f, 0x00,
+  0x37, 0x82, 0x3f, 0x07, 0x1b, 0x3b, 0x3d, 0x1f, 0x1f, 0x3f, 0x3b, 0x3f, 0x83, 0x3b, 0x04, 0x3f,
+  0x3f, 0x3b, 0x37, 0x39, 0x81, 0x1f, 0x14, 0x0f, 0x1f, 0x37, 0x3b, 0x37, 0x3f, 0x1f, 0x3f, 0x1f,
+  0x3b, 0x2b, 0x3b, 0x39, 0x3b, 0x1f, 0x3f, 0x3b, 0x3f, 0x37, 0x3b, 0x3b, 0x82, 0x1f, 0x00, 0x37,
+  0x80, 0x3f, 0x08, 0x1d, 0x1d, 0x1e, 0x1f, 0x0f, 0x1e, 0x3c, 0x3e, 0x2e, 0x81, 0x24, 0x0e, 0x06,
+  0x24, 0x04, 0x34, 0x24, 0x24, 0x34, 0x24, 0x20, 0x08, 0x00, 0x1f, 0x3f, 0x3f, 0x3e, 0x85, 0x3f,
+  0x09, 0x18, 0x00, 0x02, 0x04, 0x26, 0x20, 0x00, 0x00, 0x04, 0x1f, 0x80, 0x3f, 0x17, 0x17, 0x3a,
+  0x27, 0x3f, 0x2f, 0x22, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x0a, 0x08, 0x18, 0x0a, 0x0a,
+  0x0e, 0x0e, 0x01, 0x22, 0x3d, 0x14, 0x80, 0x3f, 0x0a, 0x38, 0x24, 0x20, 0x24, 0x04, 0x3f, 0x37,
+  0x3f, 0x3f, 0x05, 0x38, 0x81, 0x02, 0x0c, 0x10, 0x3d, 0x29, 0x2d, 0x0d, 0x3f, 0x3f, 0x01, 0x04,
+  0x00, 0x20, 0x27, 0x2b, 0x83, 0x04, 0x00, 0x00, 0x80, 0x04, 0x06, 0x10, 0x04, 0x30, 0x34, 0x04,
+  0x14, 0x34, 0x80, 0x00, 0x1b, 0x30, 0x34, 0x05, 0x37, 0x27, 0x36, 0x28, 0x20, 0x36, 0x3f, 0x31,
+  0x3e, 0x37, 0x34, 0x3e, 0x3c, 0x36, 0x27, 0x34, 0x37, 0x22, 0x26, 0x34, 0x3e, 0x2e, 0x04, 0x20,
+  0x24, 0x80, 0x00, 0x0d, 0x3b, 0x39, 0x3b, 0x2b, 0x3f, 0x3f, 0x37, 0x3e, 0x1f, 0x1f, 0x0b, 0x3b,
+  0x1d, 0x1f, 0x82, 0x3f, 0x11, 0x1f, 0x0b, 0x3b, 0x2b, 0x39, 0x3b, 0x3f, 0x3b, 0x37, 0x3f, 0x3f,
+  0x3b, 0x1f, 0x0f, 0x1f, 0x1b, 0x3f, 0x37, 0x80, 0x3f, 0x05, 0x1d, 0x1b, 0x3b, 0x39, 0x3b, 0x3b,
+  0x81, 0x3f, 0x05, 0x1f, 0x3b, 0x2b, 0x3b, 0x1f, 0x1f, 0x81, 0x3f, 0x09, 0x1f, 0x1b, 0x3f, 0x3f,
+  0x3b, 0x3b, 0x2b, 0x3b, 0x3b, 0x2b, 0x82, 0x3f, 0x09, 0x1f, 0x0f, 0x19, 0x3b, 0x3b, 0x3f, 0x3b,
+  0x3f, 0x3e, 0x3e, 0x80, 0x3b, 0x09, 0x2b, 0x39, 0x35, 0x3e, 0x3c, 0x34, 0x24, 0x34, 0x20, 0x34,
+  0x85, 0x24, 0x04, 0x00, 0x00, 0x07, 0x3f, 0x3c, 0x86, 0x24, 0x14, 0x27, 0x3f, 0x39, 0x00, 0x00,
+  0x3c, 0x08, 0x00, 0x04, 0x1f, 0x3f, 0x12, 0x10, 0x12, 0x02, 0x3c, 0x3f, 0x37, 0x3e, 0x2f, 0x3f,
+  0x82, 0x00, 0x00, 0x07, 0x88, 0x3f, 0x1f, 0x06, 0x3f, 0x37, 0x3c, 0x20, 0x24, 0x04, 0x24, 0x27,
+  0x3f, 0x37, 0x3f, 0x38, 0x02, 0x00, 0x14, 0x08, 0x30, 0x30, 0x07, 0x3d, 0x2d, 0x2f, 0x2f, 0x01,
+  0x0d, 0x00, 0x24, 0x04, 0x05, 0x38, 0x20, 0x80, 0x04, 0x02, 0x00, 0x20, 0x04, 0x80, 0x20, 0x2d,
+  0x10, 0x20, 0x34, 0x0e, 0x24, 0x31, 0x30, 0x34, 0x27, 0x3c, 0x04, 0x37, 0x04, 0x34, 0x36, 0x2e,
+  0x36, 0x26, 0x05, 0x36, 0x34, 0x3f, 0x3f, 0x37, 0x26, 0x34, 0x06, 0x3c, 0x37, 0x26, 0x26, 0x2a,
+  0x2e, 0x22, 0x26, 0x04, 0x04, 0x24, 0x20, 0x00, 0x00, 0x3f, 0x1f, 0x1f, 0x1b, 0x3b, 0x81, 0x3f,
+  0x81, 0x3b, 0x01, 0x39, 0x1f, 0x80, 0x3f, 0x01, 0x37, 0x3f, 0x80, 0x1f, 0x01, 0x1b, 0x3b, 0x81,
+  0x3f, 0x22, 0x3b, 0x39, 0x3b, 0x3b, 0x1d, 0x1f, 0x1f, 0x3f, 0x3a, 0x3f, 0x37, 0x1f, 0x1f, 0x0f,
+  0x1f, 0x1d, 0x1f, 0x3e, 0x3b, 0x37, 0x3f, 0x3b, 0x1f, 0x1b, 0x3b, 0x2b, 0x3b, 0x3f, 0x3b, 0x3e,
+  0x3f, 0x3f, 0x1f, 0x3e, 0x3f, 0x80, 0x3b, 0x80, 0x1f, 0x82, 0x3f, 0x81, 0x1f, 0x0f, 0x0f, 0x3e,
+  0x3f, 0x37, 0x3f, 0x1f, 0x1d, 0x17, 0x0f, 0x17, 0x17, 0x3e, 0x3c, 0x3c, 0x24, 0x34, 0x82, 0x24,
+  0x08, 0x34, 0x24, 0x26, 0x24, 0x24, 0x20, 0x10, 0x03, 0x3f, 0x89, 0x24, 0x14, 0x27, 0x3e, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0x1f, 0x3f, 0x10, 0x10, 0x12, 0x02, 0x02, 0x3a, 0x3f, 0x2f, 0x30, 0x3f,
+  0x1f, 0x3f, 0x80, 0x00, 0x02, 0x07, 0x3f, 0x3f, 0x85, 0x09, 0x05, 0x0f, 0x3f, 0x3d, 0x3f, 0x3f,
+  0x38, 0x80, 0x24, 0x16, 0x07, 0x27, 0x3f, 0x3f, 0x3e, 0x02, 0x00, 0x06, 0x00, 0x10, 0x03, 0x02,
+  0x07, 0x2d, 0x2f, 0x3f, 0x08, 0x0d, 0x03, 0x06, 0x00, 0x20, 0x07, 0x80, 0x04, 0x1d, 0x00, 0x00,
+  0x30, 0x04, 0x20, 0x04, 0x04, 0x00, 0x04, 0x14, 0x06, 0x20, 0x22, 0x24, 0x04, 0x2e, 0x3f, 0x3f,
+  0x06, 0x20, 0x24, 0x3e, 0x2e, 0x26, 0x28, 0x27, 0x26, 0x35, 0x04, 0x06, 0x80, 0x3e, 0x0a, 0x2e,
+  0x35, 0x36, 0x2e, 0x35, 0x36, 0x26, 0x34, 0x3c, 0x3c, 0x04, 0x80, 0x20, 0x02, 0x00, 0x00, 0x3f,
+  0x80, 0x1f, 0x0e, 0x3f, 0x37, 0x1f, 0x3f, 0x3f, 0x3b, 0x3b, 0x2b, 0x3b, 0x3b, 0x3f, 0x3f, 0x37,
+  0x3f, 0x1f, 0x82, 0x3b, 0x05, 0x3f, 0x3f, 0x37, 0x3b, 0x37, 0x3f, 0x82, 0x3b, 0x82, 0x3f, 0x80,
+  0x3b, 0x80, 0x1f, 0x80, 0x3f, 0x01, 0x3e, 0x3f, 0x82, 0x1f, 0x0e, 0x37, 0x3e, 0x3f, 0x3f, 0x33,
+  0x39, 0x3f, 0x3f, 0x37, 0x3b, 0x3b, 0x39, 0x3b, 0x3f, 0x3e, 0x82, 0x3f, 0x81, 0x1f, 0x80, 0x3f,
+  0x0f, 0x3e, 0x3f, 0x37, 0x3b, 0x3f, 0x3f, 0x2e, 0x3c, 0x3e, 0x24, 0x34, 0x24, 0x24, 0x34, 0x24,
+  0x22, 0x83, 0x24, 0x03, 0x20, 0x00, 0x07, 0x3c, 0x87, 0x24, 0x04, 0x04, 0x24, 0x24, 0x27, 0x38,
+  0x80, 0x00, 0x01, 0x01, 0x3f, 0x82, 0x10, 0x0c, 0x16, 0x1c, 0x3f, 0x37, 0x2e, 0x1a, 0x02, 0x1f,
+  0x3a, 0x00, 0x10, 0x07, 0x39, 0x88, 0x09, 0x1a, 0x3f, 0x06, 0x3f, 0x3c, 0x20, 0x20, 0x24, 0x04,
+  0x37, 0x3f, 0x3f, 0x10, 0x02, 0x02, 0x00, 0x2a, 0x04, 0x14, 0x00, 0x06, 0x39, 0x3d, 0x38, 0x0f,
+  0x09, 0x1d, 0x0c, 0x80, 0x04, 0x1d, 0x06, 0x00, 0x20, 0x04, 0x3d, 0x04, 0x20, 0x04, 0x04, 0x00,
+  0x00, 0x10, 0x20, 0x30, 0x20, 0x24, 0x02, 0x24, 0x27, 0x3f, 0x3f, 0x35, 0x30, 0x22, 0x26, 0x26,
+  0x3c, 0x34, 0x3f, 0x38, 0x80, 0x20, 0x0f, 0x35, 0x37, 0x37, 0x30, 0x26, 0x34, 0x37, 0x22, 0x34,
+  0x3c, 0x3c, 0x16, 0x26, 0x30, 0x04, 0x04, 0x80, 0x00, 0x09, 0x0f, 0x3b, 0x0f, 0x1f, 0x1f, 0x3f,
+  0x3e, 0x3b, 0x3e, 0x3f, 0x81, 0x3b, 0x83, 0x3f, 0x06, 0x3b, 0x3b, 0x2b, 0x39, 0x3b, 0x3f, 0x1f,
+  0x81, 0x3f, 0x09, 0x1f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3e, 0x3f, 0x3f, 0x1f, 0x3f, 0x81, 0x3b, 0x00,
+  0x3e, 0x80, 0x3f, 0x05, 0x1f, 0x3f, 0x39, 0x3b, 0x2b, 0x3b, 0x81, 0x3f, 0x00, 0x1f, 0x80, 0x3f,
+  0x01, 0x1f, 0x3f, 0x80, 0x3b, 0x02, 0x3f, 0x3f, 0x1f, 0x83, 0x3f, 0x14, 0x3b, 0x3b, 0x3e, 0x3f,
+  0x3e, 0x3b, 0x3f, 0x3e, 0x3f, 0x1c, 0x3f, 0x37, 0x3f, 0x3e, 0x24, 0x34, 0x24, 0x34, 0x34, 0x20,
+  0x26, 0x80, 0x24, 0x06, 0x26, 0x24, 0x24, 0x34, 0x20, 0x00, 0x3f, 0x8b, 0x24, 0x01, 0x27, 0x3f,
+  0x80, 0x00, 0x01, 0x3f, 0x1a, 0x83, 0x02, 0x0a, 0x3c, 0x3f, 0x3e, 0x07, 0x10, 0x10, 0x12, 0x3f,
+  0x00, 0x00, 0x3f, 0x89, 0x09, 0x1a, 0x0b, 0x3c, 0x3f, 0x3a, 0x24, 0x24, 0x04, 0x24, 0x3f, 0x3f,
+  0x30, 0x02, 0x00, 0x10, 0x00, 0x10, 0x30, 0x00, 0x10, 0x07, 0x2f, 0x2f, 0x01, 0x29, 0x0d, 0x1d,
+  0x18, 0x82, 0x20, 0x2e, 0x07, 0x3f, 0x20, 0x04, 0x04, 0x20, 0x07, 0x06, 0x00, 0x26, 0x04, 0x2e,
+  0x04, 0x14, 0x04, 0x30, 0x3e, 0x3f, 0x3f, 0x30, 0x34, 0x04, 0x3c, 0x15, 0x36, 0x04, 0x3f, 0x3c,
+  0x06, 0x34, 0x04, 0x06, 0x27, 0x27, 0x35, 0x37, 0x23, 0x26, 0x27, 0x20, 0x36, 0x26, 0x2e, 0x31,
+  0x30, 0x20, 0x20, 0x80, 0x00, 0x02, 0x07, 0x3b, 0x3b, 0x84, 0x3f, 0x81, 0x1f, 0x06, 0x3f, 0x33,
+  0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x80, 0x1f, 0x06, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3b, 0x3f, 0x80,
+  0x1f, 0x09, 0x3f, 0x3e, 0x1f, 0x3f, 0x37, 0x3e, 0x3b, 0x3b, 0x2b, 0x3b, 0x80, 0x3f, 0x03, 0x17,
+  0x3e, 0x3f, 0x3f, 0x80, 0x3b, 0x01, 0x3f, 0x3b, 0x82, 0x3f, 0x00, 0x3b, 0x84, 0x3f, 0x02, 0x37,
+  0x3f, 0x3e, 0x85, 0x3f, 0x0d, 0x3b, 0x3f, 0x3e, 0x3e, 0x3f, 0x3e, 0x3f, 0x17, 0x3f, 0x35, 0x35,
+  0x34, 0x24, 0x34, 0x83, 0x24, 0x00, 0x34, 0x81, 0x24, 0x02, 0x00, 0x00, 0x3f, 0x8c, 0x24, 0x04,
+  0x3f, 0x10, 0x00, 0x03, 0x3e, 0x80, 0x10, 0x0e, 0x12, 0x02, 0x10, 0x12, 0x38, 0x3e, 0x3c, 0x1f,
+  0x02, 0x10, 0x10, 0x17, 0x3d, 0x00, 0x3f, 0x8a, 0x09, 0x08, 0x1f, 0x06, 0x3d, 0x24, 0x04, 0x24,
+  0x04, 0x27, 0x38, 0x82, 0x02, 0x3f, 0x00, 0x00, 0x18, 0x10, 0x2f, 0x3f, 0x39, 0x29, 0x1d, 0x0b,
+  0x29, 0x29, 0x04, 0x04, 0x00, 0x00, 0x04, 0x3d, 0x3d, 0x10, 0x20, 0x20, 0x04, 0x3c, 0x04, 0x06,
+  0x04, 0x06, 0x04, 0x00, 0x22, 0x20, 0x1c, 0x34, 0x27, 0x37, 0x2f, 0x04, 0x04, 0x35, 0x36, 0x26,
+  0x27, 0x37, 0x3f, 0x14, 0x3e, 0x24, 0x30, 0x26, 0x36, 0x30, 0x37, 0x36, 0x27, 0x34, 0x3c, 0x34,
+  0x38, 0x35, 0x34, 0x34, 0x05, 0x20, 0x80, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x03, 0x3e, 0x3f, 0x3f,
+  0x3e, 0x86, 0x3f, 0x00, 0x1f, 0x86, 0x3f, 0x02, 0x37, 0x3f, 0x3e, 0x97, 0x3f, 0x03, 0x37, 0x3b,
+  0x37, 0x3e, 0x80, 0x3f, 0x05, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x1f, 0x88, 0x3f, 0x00, 0x3e, 0x80,
+  0x3f, 0x0c, 0x3e, 0x3f, 0x37, 0x3c, 0x3e, 0x3f, 0x24, 0x26, 0x24, 0x24, 0x34, 0x26, 0x26, 0x83,
+  0x24, 0x04, 0x34, 0x24, 0x00, 0x03, 0x3c, 0x8c, 0x24, 0x06, 0x27, 0x38, 0x00, 0x37, 0x3a, 0x02,
+  0x02, 0x82, 0x10, 0x03, 0x38, 0x3f, 0x23, 0x32, 0x80, 0x10, 0x03, 0x12, 0x3f, 0x00, 0x3b, 0x8a,
+  0x09, 0x0b, 0x0d, 0x3b, 0x26, 0x04, 0x24, 0x04, 0x27, 0x37, 0x30, 0x10, 0x00, 0x10, 0x80, 0x02,
+  0x0b, 0x00, 0x20, 0x20, 0x3f, 0x2d, 0x01, 0x0d, 0x08, 0x39, 0x39, 0x18, 0x00, 0x80, 0x20, 0x2f,
+  0x37, 0x3f, 0x38, 0x24, 0x04, 0x00, 0x3f, 0x0e, 0x06, 0x04, 0x06, 0x04, 0x14, 0x04, 0x00, 0x20,
+  0x24, 0x17, 0x20, 0x3f, 0x30, 0x27, 0x06, 0x22, 0x27, 0x20, 0x2f, 0x04, 0x3f, 0x26, 0x26, 0x00,
+  0x3e, 0x3c, 0x3c, 0x38, 0x37, 0x3e, 0x34, 0x16, 0x24, 0x0e, 0x34, 0x30, 0x35, 0x34, 0x04, 0x28,
+  0x80, 0x00, 0x00, 0x07, 0x81, 0x3f, 0x04, 0x3b, 0x3f, 0x3f, 0x3b, 0x37, 0x80, 0x3f, 0x00, 0x3e,
+  0x82, 0x3f, 0x00, 0x3a, 0x84, 0x3f, 0x00, 0x1f, 0x83, 0x3f, 0x03, 0x17, 0x3f, 0x3f, 0x3b, 0x80,
+  0x3f, 0x03, 0x37, 0x3f, 0x3f, 0x3e, 0x82, 0x3f, 0x04, 0x17, 0x3e, 0x3f, 0x1f, 0x37, 0x82, 0x3f,
+  0x00, 0x1f, 0x80, 0x3f, 0x09, 0x3b, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x1f, 0x3e, 0x85,
+  0x3f, 0x06, 0x37, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x35, 0x80, 0x34, 0x02, 0x24, 0x34, 0x26, 0x80,
+  0x24, 0x03, 0x34, 0x26, 0x24, 0x26, 0x80, 0x24, 0x02, 0x00, 0x04, 0x3c, 0x8c, 0x24, 0x06, 0x26,
+  0x39, 0x00, 0x3f, 0x10, 0x10, 0x12, 0x80, 0x02, 0x0c, 0x10, 0x12, 0x37, 0x05, 0x14, 0x3a, 0x02,
+  0x02, 0x10, 0x10, 0x17, 0x3a, 0x3d, 0x8b, 0x09, 0x06, 0x0f, 0x38, 0x24, 0x04, 0x24, 0x04, 0x28,
+  0x82, 0x02, 0x17, 0x00, 0x24, 0x2c, 0x12, 0x07, 0x3f, 0x03, 0x09, 0x39, 0x0b, 0x29, 0x28, 0x0d,
+  0x08, 0x04, 0x00, 0x01, 0x3d, 0x2f, 0x04, 0x00, 0x04, 0x07, 0x38, 0x81, 0x20, 0x23, 0x00, 0x20,
+  0x00, 0x20, 0x26, 0x01, 0x00, 0x26, 0x34, 0x3a, 0x26, 0x38, 0x34, 0x34, 0x30, 0x37, 0x22, 0x27,
+  0x38, 0x37, 0x24, 0x26, 0x26, 0x34, 0x30, 0x24, 0x34, 0x3f, 0x35, 0x34, 0x26, 0x07, 0x26, 0x26,
+  0x07, 0x26, 0x81, 0x00, 0x06, 0x07, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x81, 0x3f, 0x00, 0x3a,
+  0x80, 0x3f, 0x02, 0x3e, 0x3f, 0x3e, 0x81, 0x3f, 0x03, 0x1f, 0x3e, 0x3b, 0x3e, 0x83, 0x3f, 0x00,
+  0x17, 0x81, 0x3f, 0x02, 0x37, 0x3f, 0x37, 0x80, 0x3f, 0x04, 0x37, 0x3f, 0x3f, 0x1f, 0x3e, 0x8f,
+  0x3f, 0x00, 0x3b, 0x8d, 0x3f, 0x0c, 0x37, 0x1e, 0x3f, 0x37, 0x3e, 0x3e, 0x24, 0x24, 0x26, 0x26,
+  0x24, 0x24, 0x26, 0x85, 0x24, 0x03, 0x26, 0x00, 0x03, 0x3c, 0x8d, 0x24, 0x02, 0x3f, 0x07, 0x3a,
+  0x81, 0x02, 0x81, 0x10, 0x02, 0x13, 0x36, 0x0f, 0x82, 0x10, 0x02, 0x16, 0x3f, 0x39, 0x8c, 0x09,
+  0x4a, 0x3f, 0x04, 0x20, 0x24, 0x24, 0x10, 0x10, 0x02, 0x00, 0x10, 0x10, 0x26, 0x26, 0x27, 0x3f,
+  0x06, 0x29, 0x0d, 0x0f, 0x09, 0x39, 0x2b, 0x09, 0x39, 0x37, 0x04, 0x04, 0x07, 0x3d, 0x3d, 0x04,
+  0x04, 0x00, 0x3d, 0x38, 0x30, 0x34, 0x10, 0x20, 0x24, 0x00, 0x06, 0x26, 0x00, 0x3a, 0x3b, 0x04,
+  0x38, 0x3c, 0x07, 0x24, 0x38, 0x31, 0x30, 0x3f, 0x30, 0x30, 0x35, 0x06, 0x20, 0x07, 0x27, 0x27,
+  0x34, 0x3e, 0x27, 0x26, 0x34, 0x14, 0x26, 0x26, 0x07, 0x26, 0x34, 0x15, 0x81, 0x00, 0x04, 0x07,
+  0x3f, 0x3e, 0x3f, 0x1f, 0x85, 0x3f, 0x00, 0x3b, 0x83, 0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x81, 0x3f,
+  0x03, 0x3e, 0x3b, 0x3f, 0x3e, 0x85, 0x3f, 0x0a, 0x3b, 0x3f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x37,
+  0x3f, 0x1f, 0x37, 0x80, 0x3f, 0x07, 0x37, 0x3b, 0x3e, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x80, 0x3f,
+  0x00, 0x3e, 0x80, 0x3f, 0x07, 0x37, 0x3f, 0x3b, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x82, 0x3f, 0x07,
+  0x37, 0x17, 0x3f, 0x3f, 0x3e, 0x3f, 0x27, 0x35, 0x80, 0x34, 0x0f, 0x24, 0x24, 0x26, 0x24, 0x24,
+  0x34, 0x34, 0x26, 0x24, 0x34, 0x24, 0x34, 0x24, 0x00, 0x06, 0x3c, 0x8d, 0x24, 0x04, 0x37, 0x07,
+  0x3a, 0x02, 0x02, 0x80, 0x10, 0x00, 0x12, 0x80, 0x02, 0x01, 0x1f, 0x3a, 0x81, 0x02, 0x03, 0x10,
+  0x10, 0x3f, 0x39, 0x8c, 0x09, 0x04, 0x1f, 0x20, 0x04, 0x20, 0x20, 0x82, 0x10, 0x02, 0x04, 0x25,
+  0x27, 0x80, 0x3f, 0x11, 0x18, 0x19, 0x39, 0x05, 0x0d, 0x18, 0x0d, 0x09, 0x2f, 0x38, 0x04, 0x05,
+  0x3d, 0x3f, 0x04, 0x04, 0x05, 0x3f, 0x80, 0x20, 0x25, 0x04, 0x04, 0x02, 0x04, 0x00, 0x30, 0x20,
+  0x0f, 0x0d, 0x1b, 0x06, 0x27, 0x07, 0x38, 0x06, 0x26, 0x26, 0x3f, 0x3c, 0x26, 0x22, 0x20, 0x34,
+  0x04, 0x34, 0x36, 0x20, 0x30, 0x34, 0x14, 0x3c, 0x38, 0x20, 0x3c, 0x34, 0x14, 0x0e, 0x20, 0x81,
+  0x00, 0x00, 0x07, 0x88, 0x3f, 0x06, 0x3e, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x8d, 0x3f, 0x01,
+  0x3e, 0x1f, 0x80, 0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x00, 0x3b, 0x81, 0x3f, 0x02, 0x3b, 0x3f, 0x3b,
+  0x80, 0x3f, 0x00, 0x3b, 0x85, 0x3f, 0x01, 0x3b, 0x3b, 0x81, 0x3f, 0x00, 0x37, 0x82, 0x3f, 0x07,
+  0x17, 0x37, 0x35, 0x37, 0x37, 0x26, 0x26, 0x24, 0x80, 0x26, 0x01, 0x24, 0x26, 0x83, 0x24, 0x05,
+  0x34, 0x24, 0x24, 0x00, 0x03, 0x3c, 0x8d, 0x24, 0x01, 0x27, 0x3f, 0x81, 0x10, 0x00, 0x12, 0x80,
+  0x02, 0x05, 0x10, 0x12, 0x02, 0x10, 0x12, 0x02, 0x80, 0x10, 0x02, 0x12, 0x1f, 0x39, 0x8c, 0x09,
+  0x0b, 0x0f, 0x28, 0x20, 0x24, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x35, 0x34, 0x80, 0x3f, 0x15,
+  0x38, 0x09, 0x00, 0x0b, 0x1f, 0x19, 0x0d, 0x19, 0x07, 0x3f, 0x28, 0x06, 0x04, 0x3f, 0x28, 0x20,
+  0x04, 0x07, 0x38, 0x06, 0x04, 0x00, 0x81, 0x04, 0x21, 0x00, 0x2c, 0x17, 0x19, 0x33, 0x00, 0x2a,
+  0x27, 0x37, 0x3f, 0x24, 0x14, 0x07, 0x3f, 0x04, 0x15, 0x35, 0x30, 0x07, 0x00, 0x37, 0x27, 0x20,
+  0x35, 0x36, 0x26, 0x06, 0x24, 0x26, 0x22, 0x22, 0x2e, 0x34, 0x10, 0x82, 0x00, 0x05, 0x3f, 0x3b,
+  0x3f, 0x3f, 0x37, 0x1f, 0x84, 0x3f, 0x04, 0x3e, 0x3f, 0x3b, 0x3f, 0x3e, 0x84, 0x3f, 0x07, 0x1f,
+  0x1f, 0x3f, 0x3e, 0x1f, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x00, 0x3b, 0x83, 0x3f, 0x07, 0x37, 0x3f,
+  0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x37, 0x82, 0x3f, 0x00, 0x3b, 0x81, 0x3f, 0x09, 0x1f, 0x3b, 0x3f,
+  0x3f, 0x37, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x80, 0x3b, 0x80, 0x3f, 0x16, 0x3e, 0x3f, 0x37, 0x1f,
+  0x1f, 0x0f, 0x3e, 0x3f, 0x3f, 0x37, 0x34, 0x24, 0x34, 0x34, 0x24, 0x24, 0x34, 0x24, 0x34, 0x26,
+  0x24, 0x34, 0x26, 0x80, 0x24, 0x03, 0x04, 0x00, 0x05, 0x3c, 0x83, 0x24, 0x03, 0x2e, 0x2f, 0x3f,
+  0x3c, 0x83, 0x24, 0x05, 0x27, 0x3f, 0x02, 0x10, 0x12, 0x02, 0x80, 0x10, 0x04, 0x13, 0x3f, 0x3f,
+  0x3e, 0x3a, 0x80, 0x02, 0x80, 0x10, 0x01, 0x3f, 0x3f, 0x82, 0x09, 0x80, 0x3f, 0x00, 0x3b, 0x83,
+  0x09, 0x03, 0x0f, 0x3c, 0x00, 0x00, 0x82, 0x10, 0x02, 0x34, 0x24, 0x27, 0x80, 0x3f, 0x3b, 0x01,
+  0x08, 0x09, 0x08, 0x01, 0x1c, 0x0b, 0x28, 0x3f, 0x2f, 0x34, 0x00, 0x00, 0x07, 0x38, 0x20, 0x20,
+  0x3f, 0x38, 0x20, 0x20, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x30, 0x39, 0x3f, 0x08, 0x00, 0x00,
+  0x06, 0x3f, 0x3f, 0x30, 0x2e, 0x27, 0x3c, 0x02, 0x28, 0x02, 0x27, 0x36, 0x20, 0x24, 0x14, 0x30,
+  0x34, 0x30, 0x3c, 0x3c, 0x34, 0x02, 0x27, 0x20, 0x34, 0x27, 0x20, 0x82, 0x00, 0x81, 0x3f, 0x00,
+  0x1f, 0x81, 0x3f, 0x00, 0x3e, 0x82, 0x3f, 0x81, 0x1f, 0x08, 0x3f, 0x1f, 0x3f, 0x3f, 0x1f, 0x37,
+  0x3f, 0x1f, 0x1b, 0x85, 0x3f, 0x05, 0x3b, 0x3b, 0x1f, 0x3f, 0x3f, 0x3e, 0x81, 0x3f, 0x01, 0x1f,
+  0x1b, 0x85, 0x3f, 0x06, 0x3b, 0x3b, 0x1f, 0x1f, 0x3f, 0x3b, 0x3b, 0x82, 0x3f, 0x04, 0x3e, 0x3b,
+  0x3b, 0x0f, 0x1f, 0x84, 0x3f, 0x0e, 0x1d, 0x1f, 0x1f, 0x0f, 0x37, 0x35, 0x34, 0x26, 0x26, 0x24,
+  0x20, 0x34, 0x04, 0x24, 0x34, 0x83, 0x24, 0x05, 0x20, 0x34, 0x20, 0x10, 0x02, 0x3c, 0x82, 0x24,
+  0x00, 0x27, 0x81, 0x3f, 0x00, 0x3c, 0x82, 0x24, 0x01, 0x27, 0x3a, 0x82, 0x10, 0x01, 0x12, 0x03,
+  0x82, 0x3f, 0x00, 0x12, 0x80, 0x02, 0x03, 0x10, 0x17, 0x3f, 0x39, 0x82, 0x09, 0x81, 0x3f, 0x00,
+  0x39, 0x82, 0x09, 0x4a, 0x0f, 0x38, 0x20, 0x00, 0x02, 0x00, 0x02, 0x02, 0x04, 0x2c, 0x35, 0x3f,
+  0x37, 0x3e, 0x38, 0x19, 0x03, 0x08, 0x09, 0x08, 0x0b, 0x2b, 0x0f, 0x3d, 0x2f, 0x08, 0x20, 0x38,
+  0x04, 0x38, 0x04, 0x07, 0x3d, 0x3c, 0x06, 0x00, 0x20, 0x04, 0x00, 0x00, 0x20, 0x04, 0x20, 0x3f,
+  0x38, 0x38, 0x08, 0x08, 0x37, 0x3f, 0x3f, 0x38, 0x30, 0x07, 0x20, 0x1d, 0x1b, 0x2b, 0x04, 0x27,
+  0x04, 0x14, 0x3c, 0x30, 0x2e, 0x27, 0x22, 0x26, 0x04, 0x04, 0x34, 0x30, 0x22, 0x34, 0x30, 0x82,
+  0x00, 0x82, 0x3f, 0x02, 0x3b, 0x3f, 0x1f, 0x83, 0x3f, 0x03, 0x1f, 0x0f, 0x19, 0x3b, 0x81, 0x3f,
+  0x05, 0x37, 0x3f, 0x3b, 0x19, 0x3b, 0x3b, 0x84, 0x3f, 0x04, 0x3b, 0x39, 0x3b, 0x3f, 0x1f, 0x81,
+  0x3f, 0x04, 0x3b, 0x3b, 0x39, 0x3b, 0x3b, 0x80, 0x3f, 0x02, 0x37, 0x3f, 0x37, 0x80, 0x1f, 0x00,
+  0x3b, 0x87, 0x3f, 0x80, 0x3b, 0x02, 0x2b, 0x1f, 0x3e, 0x81, 0x3f, 0x80, 0x3b, 0x0c, 0x2a, 0x3b,
+  0x3e, 0x3e, 0x3c, 0x34, 0x34, 0x26, 0x26, 0x24, 0x34, 0x34, 0x24, 0x82, 0x26, 0x06, 0x24, 0x34,
+  0x24, 0x04, 0x00, 0x07, 0x3c, 0x82, 0x24, 0x01, 0x23, 0x3b, 0x80, 0x3f, 0x00, 0x3c, 0x82, 0x24,
+  0x01, 0x25, 0x3a, 0x83, 0x02, 0x02, 0x1f, 0x3f, 0x3b, 0x81, 0x3f, 0x06, 0x10, 0x12, 0x02, 0x02,
+  0x1f, 0x3b, 0x39, 0x81, 0x09, 0x00, 0x0b, 0x80, 0x3f, 0x01, 0x3b, 0x3f, 0x83, 0x09, 0x09, 0x3f,
+  0x00, 0x02, 0x30, 0x02, 0x02, 0x00, 0x24, 0x35, 0x26, 0x80, 0x3f, 0x07, 0x39, 0x09, 0x09, 0x0b,
+  0x01, 0x18, 0x24, 0x00, 0x80, 0x3f, 0x31, 0x30, 0x30, 0x27, 0x28, 0x20, 0x20, 0x05, 0x3f, 0x04,
+  0x00, 0x04, 0x00, 0x20, 0x04, 0x04, 0x00, 0x20, 0x06, 0x3f, 0x38, 0x07, 0x08, 0x01, 0x05, 0x3f,
+  0x3e, 0x3f, 0x06, 0x27, 0x13, 0x39, 0x38, 0x3b, 0x2b, 0x14, 0x34, 0x06, 0x22, 0x20, 0x34, 0x14,
+  0x34, 0x14, 0x24, 0x05, 0x31, 0x34, 0x06, 0x28, 0x34, 0x82, 0x00, 0x81, 0x3f, 0x09, 0x3b, 0x3f,
+  0x3b, 0x3b, 0x1f, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f, 0x82, 0x1f, 0x01, 0x3f, 0x37, 0x80, 0x3f, 0x04,
+  0x1f, 0x3b, 0x3b, 0x39, 0x3b, 0x83, 0x3f, 0x03, 0x3b, 0x3b, 0x39, 0x3b, 0x83, 0x3f, 0x82, 0x1f,
+  0x13, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x1f, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f,
+  0x1f, 0x3f, 0x3f, 0x3b, 0x39, 0x81, 0x3b, 0x14, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x1d, 0x1f, 0x0f,
+  0x1f, 0x0e, 0x3f, 0x35, 0x34, 0x26, 0x24, 0x34, 0x24, 0x26, 0x24, 0x04, 0x34, 0x82, 0x24, 0x06,
+  0x20, 0x24, 0x20, 0x34, 0x00, 0x07, 0x3c, 0x82, 0x24, 0x00, 0x27, 0x82, 0x3f, 0x82, 0x24, 0x07,
+  0x07, 0x38, 0x10, 0x12, 0x02, 0x10, 0x10, 0x17, 0x80, 0x3f, 0x00, 0x3b, 0x80, 0x3f, 0x06, 0x3a,
+  0x02, 0x02, 0x07, 0x3f, 0x3f, 0x39, 0x81, 0x09, 0x05, 0x0d, 0x3f, 0x3f, 0x1f, 0x3f, 0x3b, 0x83,
+  0x09, 0x08, 0x3f, 0x00, 0x14, 0x32, 0x00, 0x10, 0x26, 0x2c, 0x24, 0x80, 0x3f, 0x14, 0x38, 0x08,
+  0x0a, 0x08, 0x09, 0x0b, 0x04, 0x37, 0x3f, 0x04, 0x3b, 0x3f, 0x28, 0x20, 0x07, 0x3f, 0x38, 0x04,
+  0x3f, 0x2f, 0x00, 0x80, 0x04, 0x25, 0x00, 0x20, 0x04, 0x00, 0x20, 0x05, 0x3f, 0x38, 0x0a, 0x03,
+  0x03, 0x07, 0x3e, 0x3f, 0x3f, 0x20, 0x37, 0x2f, 0x07, 0x19, 0x00, 0x03, 0x28, 0x30, 0x04, 0x35,
+  0x30, 0x35, 0x34, 0x15, 0x34, 0x00, 0x34, 0x14, 0x30, 0x26, 0x06, 0x23, 0x82, 0x00, 0x82, 0x3f,
+  0x02, 0x3b, 0x3b, 0x2b, 0x80, 0x3f, 0x02, 0x37, 0x3f, 0x3f, 0x80, 0x1f, 0x01, 0x1d, 0x1f, 0x82,
+  0x3f, 0x04, 0x3b, 0x1f, 0x1d, 0x1f, 0x1f, 0x82, 0x3f, 0x0e, 0x1b, 0x1d, 0x1f, 0x1b, 0x3b, 0x3f,
+  0x3f, 0x3b, 0x3f, 0x3f, 0x3b, 0x2b, 0x3b, 0x39, 0x3b, 0x84, 0x3f, 0x03, 0x3b, 0x3f, 0x3b, 0x3b,
+  0x83, 0x3f, 0x02, 0x3e, 0x3f, 0x3f, 0x82, 0x1f, 0x82, 0x3f, 0x0f, 0x3b, 0x3b, 0x33, 0x3a, 0x3b,
+  0x2e, 0x3c, 0x34, 0x34, 0x26, 0x26, 0x06, 0x20, 0x24, 0x34, 0x24, 0x80, 0x34, 0x08, 0x26, 0x24,
+  0x34, 0x26, 0x24, 0x20, 0x00, 0x01, 0x3c, 0x82, 0x24, 0x02, 0x27, 0x3f, 0x1f, 0x80, 0x3f, 0x82,
+  0x24, 0x02, 0x27, 0x18, 0x12, 0x80, 0x02, 0x04, 0x10, 0x17, 0x3f, 0x1f, 0x1f, 0x82, 0x3f, 0x05,
+  0x10, 0x12, 0x1f, 0x3f, 0x1f, 0x39, 0x82, 0x09, 0x80, 0x3f, 0x01, 0x1f, 0x3f, 0x83, 0x09, 0x1f,
+  0x3a, 0x00, 0x22, 0x3c, 0x10, 0x10, 0x2c, 0x26, 0x2e, 0x3f, 0x3f, 0x37, 0x38, 0x19, 0x01, 0x09,
+  0x08, 0x08, 0x25, 0x27, 0x3f, 0x3f, 0x35, 0x07, 0x38, 0x14, 0x07, 0x3f, 0x3c, 0x00, 0x3f, 0x2f,
+  0x80, 0x04, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x20, 0x20, 0x02, 0x3f, 0x38, 0x03, 0x08, 0x00, 0x07,
+  0x80, 0x3f, 0x16, 0x3c, 0x07, 0x1f, 0x3f, 0x1c, 0x00, 0x00, 0x1b, 0x07, 0x20, 0x22, 0x20, 0x22,
+  0x22, 0x26, 0x20, 0x24, 0x06, 0x26, 0x26, 0x05, 0x34, 0x34, 0x82, 0x00, 0x82, 0x3f, 0x81, 0x1f,
+  0x82, 0x3f, 0x04, 0x1d, 0x1f, 0x0f, 0x1f, 0x1f, 0x82, 0x3f, 0x03, 0x3b, 0x2b, 0x3b, 0x3b, 0x84,
+  0x3f, 0x81, 0x3b, 0x01, 0x3f, 0x3e, 0x81, 0x3f, 0x04, 0x1f, 0x0b, 0x3b, 0x1f, 0x1f, 0x85, 0x3f,
+  0x02, 0x1d, 0x1f, 0x3f, 0x80, 0x1f, 0x82, 0x3f, 0x04, 0x1f, 0x19, 0x3b, 0x0f, 0x1f, 0x82, 0x3f,
+  0x05, 0x3b, 0x2b, 0x39, 0x3d, 0x1e, 0x3e, 0x81, 0x34, 0x04, 0x24, 0x26, 0x26, 0x24, 0x26, 0x81,
+  0x24, 0x02, 0x34, 0x24, 0x24, 0x80, 0x20, 0x02, 0x00, 0x07, 0x3c, 0x81, 0x24, 0x02, 0x20, 0x27,
+  0x1f, 0x81, 0x3f, 0x83, 0x24, 0x0a, 0x3a, 0x02, 0x02, 0x10, 0x10, 0x12, 0x3f, 0x1f, 0x3f, 0x3f,
+  0x1f, 0x86, 0x3f, 0x00, 0x19, 0x81, 0x09, 0x00, 0x0b, 0x82, 0x3f, 0x82, 0x09, 0x09, 0x0f, 0x38,
+  0x02, 0x04, 0x32, 0x06, 0x38, 0x10, 0x24, 0x37, 0x80, 0x3f, 0x06, 0x01, 0x09, 0x08, 0x18, 0x19,
+  0x04, 0x34, 0x81, 0x3f, 0x00, 0x38, 0x80, 0x20, 0x14, 0x3f, 0x38, 0x04, 0x3d, 0x3f, 0x00, 0x20,
+  0x04, 0x00, 0x20, 0x04, 0x04, 0x00, 0x20, 0x27, 0x3f, 0x39, 0x19, 0x04, 0x22, 0x07, 0x80, 0x3f,
+  0x16, 0x3a, 0x3f, 0x3f, 0x38, 0x07, 0x01, 0x00, 0x0d, 0x14, 0x06, 0x26, 0x06, 0x24, 0x3c, 0x22,
+  0x24, 0x06, 0x2a, 0x21, 0x30, 0x22, 0x20, 0x34, 0x82, 0x00, 0x81, 0x3f, 0x01, 0x1b, 0x2b, 0x80,
+  0x1f, 0x82, 0x3f, 0x03, 0x1f, 0x1b, 0x3b, 0x3b, 0x83, 0x3f, 0x81, 0x1f, 0x83, 0x3f, 0x04, 0x3b,
+  0x1f, 0x1b, 0x39, 0x3b, 0x80, 0x3f, 0x01, 0x3e, 0x3f, 0x81, 0x3b, 0x00, 0x39, 0x84, 0x3f, 0x81,
+  0x1f, 0x02, 0x3f, 0x3b, 0x3b, 0x84, 0x3f, 0x81, 0x1f, 0x05, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37,
+  0x80, 0x1f, 0x04, 0x07, 0x3f, 0x26, 0x26, 0x24, 0x80, 0x34, 0x02, 0x24, 0x26, 0x24, 0x81, 0x34,
+  0x00, 0x24, 0x80, 0x34, 0x04, 0x26, 0x04, 0x00, 0x06, 0x3c, 0x82, 0x24, 0x00, 0x27, 0x82, 0x3f,
+  0x82, 0x24, 0x01, 0x27, 0x18, 0x82, 0x10, 0x89, 0x3f, 0x02, 0x3b, 0x3f, 0x39, 0x81, 0x09, 0x05,
+  0x0d, 0x3f, 0x3b, 0x3f, 0x1f, 0x3b, 0x82, 0x09, 0x15, 0x0f, 0x02, 0x00, 0x02, 0x00, 0x11, 0x10,
+  0x12, 0x10, 0x3f, 0x3f, 0x37, 0x38, 0x09, 0x08, 0x19, 0x09, 0x08, 0x34, 0x27, 0x3f, 0x3e, 0x81,
+  0x3f, 0x31, 0x20, 0x14, 0x07, 0x38, 0x20, 0x3f, 0x2f, 0x04, 0x00, 0x20, 0x00, 0x04, 0x04, 0x00,
+  0x00, 0x20, 0x04, 0x3f, 0x38, 0x02, 0x14, 0x00, 0x17, 0x3e, 0x3f, 0x37, 0x3f, 0x2f, 0x3f, 0x18,
+  0x07, 0x18, 0x08, 0x03, 0x3c, 0x30, 0x1c, 0x05, 0x06, 0x06, 0x07, 0x20, 0x04, 0x14, 0x26, 0x26,
+  0x20, 0x27, 0x22, 0x24, 0x81, 0x00, 0x02, 0x07, 0x3f, 0x3f, 0x80, 0x3b, 0x01, 0x2b, 0x39, 0x83,
+  0x3f, 0x80, 0x1f, 0x01, 0x0b, 0x3b, 0x82, 0x3f, 0x01, 0x3b, 0x3b, 0x86, 0x3f, 0x03, 0x3b, 0x2b,
+  0x3b, 0x3b, 0x83, 0x3f, 0x04, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x82, 0x3f, 0x07, 0x3b, 0x3f, 0x0f,
+  0x1f, 0x1f, 0x3f, 0x1f, 0x1f, 0x83, 0x3f, 0x81, 0x1f, 0x81, 0x3f, 0x06, 0x3e, 0x3f, 0x3b, 0x39,
+  0x33, 0x3a, 0x3f, 0x83, 0x34, 0x03, 0x26, 0x06, 0x20, 0x34, 0x80, 0x24, 0x09, 0x26, 0x24, 0x24,
+  0x20, 0x24, 0x34, 0x20, 0x08, 0x07, 0x3c, 0x82, 0x24, 0x00, 0x23, 0x82, 0x3f, 0x82, 0x24, 0x15,
+  0x27, 0x1a, 0x02, 0x10, 0x12, 0x02, 0x02, 0x3f, 0x3f, 0x1f, 0x12, 0x02, 0x13, 0x17, 0x17, 0x3a,
+  0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x3b, 0x81, 0x09, 0x00, 0x0b, 0x81, 0x3f, 0x00, 0x39, 0x82, 0x09,
+  0x00, 0x3f, 0x80, 0x02, 0x13, 0x10, 0x02, 0x33, 0x30, 0x12, 0x07, 0x3f, 0x3f, 0x03, 0x08, 0x09,
+  0x01, 0x03, 0x04, 0x2c, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x05, 0x20, 0x07, 0x3f, 0x00,
+  0x3f, 0x3f, 0x82, 0x20, 0x00, 0x00, 0x80, 0x20, 0x06, 0x06, 0x07, 0x3b, 0x00, 0x10, 0x22, 0x07,
+  0x80, 0x3f, 0x02, 0x3e, 0x3f, 0x3f, 0x80, 0x01, 0x10, 0x10, 0x0f, 0x0a, 0x24, 0x06, 0x06, 0x26,
+  0x20, 0x34, 0x06, 0x26, 0x22, 0x22, 0x28, 0x14, 0x30, 0x26, 0x82, 0x00, 0x00, 0x17, 0x80, 0x3f,
+  0x81, 0x3b, 0x83, 0x3f, 0x04, 0x3b, 0x39, 0x3b, 0x3f, 0x1f, 0x84, 0x3f, 0x00, 0x3b, 0x84, 0x3f,
+  0x00, 0x3b, 0x81, 0x1f, 0x83, 0x3f, 0x81, 0x3b, 0x84, 0x3f, 0x06, 0x1b, 0x3b, 0x3b, 0x3f, 0x3f,
+  0x1f, 0x1f, 0x84, 0x3f, 0x03, 0x1f, 0x1f, 0x0f, 0x1f, 0x83, 0x3f, 0x04, 0x37, 0x1d, 0x1d, 0x3e,
+  0x3e, 0x81, 0x26, 0x03, 0x24, 0x34, 0x24, 0x34, 0x81, 0x26, 0x00, 0x24, 0x81, 0x34, 0x04, 0x20,
+  0x22, 0x00, 0x07, 0x3c, 0x82, 0x24, 0x00, 0x27, 0x81, 0x3f, 0x00, 0x3c, 0x82, 0x24, 0x01, 0x27,
+  0x30, 0x81, 0x10, 0x03, 0x17, 0x3f, 0x3f, 0x10, 0x80, 0x02, 0x00, 0x00, 0x82, 0x10, 0x02, 0x17,
+  0x1f, 0x39, 0x82, 0x09, 0x03, 0x3f, 0x3f, 0x3b, 0x3f, 0x83, 0x09, 0x13, 0x38, 0x10, 0x00, 0x02,
+  0x00, 0x3a, 0x12, 0x12, 0x1a, 0x10, 0x07, 0x3e, 0x09, 0x01, 0x0a, 0x09, 0x09, 0x26, 0x24, 0x37,
+  0x81, 0x3f, 0x18, 0x37, 0x3e, 0x3f, 0x3f, 0x30, 0x07, 0x00, 0x3f, 0x3f, 0x38, 0x00, 0x20, 0x00,
+  0x04, 0x04, 0x00, 0x04, 0x04, 0x07, 0x3f, 0x3f, 0x10, 0x10, 0x13, 0x37, 0x83, 0x3f, 0x15, 0x00,
+  0x1a, 0x08, 0x01, 0x07, 0x38, 0x26, 0x04, 0x20, 0x31, 0x26, 0x00, 0x04, 0x0e, 0x05, 0x30, 0x26,
+  0x04, 0x14, 0x30, 0x24, 0x20, 0x80, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x80, 0x3b, 0x85, 0x3f, 0x80,
+  0x1f, 0x8e, 0x3f, 0x02, 0x3b, 0x3b, 0x2b, 0x84, 0x3f, 0x80, 0x3b, 0x86, 0x3f, 0x01, 0x1f, 0x1f,
+  0x90, 0x3f, 0x02, 0x3e, 0x3f, 0x3f, 0x80, 0x37, 0x00, 0x3c, 0x80, 0x34, 0x81, 0x26, 0x05, 0x24,
+  0x34, 0x26, 0x24, 0x34, 0x26, 0x80, 0x24, 0x05, 0x26, 0x27, 0x21, 0x00, 0x07, 0x3c, 0x82, 0x24,
+  0x00, 0x27, 0x80, 0x3f, 0x00, 0x3c, 0x83, 0x24, 0x01, 0x27, 0x1a, 0x80, 0x02, 0x04, 0x10, 0x17,
+  0x3f, 0x3b, 0x02, 0x80, 0x10, 0x00, 0x12, 0x80, 0x02, 0x04, 0x10, 0x12, 0x02, 0x3f, 0x39, 0x82,
+  0x09, 0x02, 0x0f, 0x3f, 0x3f, 0x83, 0x09, 0x16, 0x0f, 0x3a, 0x02, 0x02, 0x10, 0x12, 0x12, 0x2a,
+  0x32, 0x30, 0x07, 0x38, 0x11, 0x09, 0x19, 0x01, 0x0a, 0x04, 0x25, 0x27, 0x3f, 0x3f, 0x3e, 0x84,
+  0x3f, 0x16, 0x34, 0x00, 0x2f, 0x3f, 0x38, 0x20, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x27,
+  0x07, 0x3f, 0x08, 0x12, 0x15, 0x3f, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x1a, 0x01, 0x00, 0x04, 0x03,
+  0x07, 0x3c, 0x15, 0x30, 0x06, 0x04, 0x10, 0x26, 0x26, 0x04, 0x34, 0x06, 0x20, 0x22, 0x2c, 0x14,
+  0x10, 0x20, 0x00, 0x08, 0x00, 0x00, 0x07, 0x95, 0x3f, 0x00, 0x3b, 0x91, 0x3f, 0x00, 0x1f, 0x85,
+  0x3f, 0x00, 0x1f, 0x8f, 0x3f, 0x08, 0x37, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x83,
+  0x26, 0x08, 0x24, 0x34, 0x26, 0x24, 0x34, 0x26, 0x24, 0x34, 0x24, 0x80, 0x34, 0x04, 0x25, 0x36,
+  0x00, 0x07, 0x3c, 0x8d, 0x24, 0x08, 0x3f, 0x30, 0x12, 0x02, 0x10, 0x10, 0x17, 0x3f, 0x3a, 0x83,
+  0x10, 0x00, 0x12, 0x81, 0x02, 0x01, 0x3f, 0x39, 0x8b, 0x09, 0x01, 0x0f, 0x38, 0x80, 0x10, 0x80,
+  0x12, 0x0b, 0x13, 0x02, 0x3f, 0x3f, 0x01, 0x08, 0x08, 0x09, 0x08, 0x2e, 0x26, 0x27, 0x84, 0x3f,
+  0x0a, 0x37, 0x3e, 0x3f, 0x3f, 0x3c, 0x07, 0x3f, 0x38, 0x20, 0x20, 0x00, 0x81, 0x20, 0x06, 0x04,
+  0x06, 0x3e, 0x3f, 0x3a, 0x02, 0x06, 0x83, 0x3f, 0x14, 0x39, 0x10, 0x12, 0x04, 0x01, 0x1f, 0x38,
+  0x26, 0x04, 0x04, 0x30, 0x24, 0x14, 0x06, 0x22, 0x22, 0x26, 0x06, 0x20, 0x22, 0x25, 0x80, 0x20,
+  0x04, 0x06, 0x08, 0x08, 0x00, 0x07, 0x84, 0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x00, 0x3e, 0xb7, 0x3f,
+  0x03, 0x3e, 0x3e, 0x3f, 0x37, 0x87, 0x34, 0x02, 0x26, 0x24, 0x34, 0x80, 0x26, 0x06, 0x24, 0x34,
+  0x3a, 0x21, 0x00, 0x07, 0x34, 0x8d, 0x24, 0x01, 0x3f, 0x1a, 0x81, 0x02, 0x06, 0x07, 0x3f, 0x3a,
+  0x02, 0x02, 0x10, 0x12, 0x81, 0x02, 0x80, 0x10, 0x01, 0x17, 0x3b, 0x8b, 0x09, 0x01, 0x0f, 0x39,
+  0x80, 0x02, 0x03, 0x38, 0x33, 0x30, 0x00, 0x80, 0x3f, 0x48, 0x0a, 0x01, 0x19, 0x0b, 0x04, 0x24,
+  0x2c, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x2e, 0x2e, 0x3e, 0x38, 0x27,
+  0x38, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x20, 0x20, 0x27, 0x2e, 0x2f, 0x3f, 0x3c, 0x3f, 0x3f,
+  0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x02, 0x10, 0x20, 0x12, 0x3f, 0x38, 0x30, 0x00, 0x04, 0x00,
+  0x30, 0x2e, 0x04, 0x1c, 0x24, 0x1c, 0x23, 0x20, 0x34, 0x14, 0x14, 0x04, 0x00, 0x08, 0x0a, 0x28,
+  0x08, 0x00, 0x07, 0xc8, 0x3f, 0x05, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x26, 0x81, 0x34, 0x03, 0x26,
+  0x26, 0x24, 0x34, 0x80, 0x26, 0x0a, 0x24, 0x34, 0x26, 0x24, 0x26, 0x26, 0x27, 0x36, 0x00, 0x07,
+  0x3c, 0x8c, 0x24, 0x01, 0x27, 0x3f, 0x80, 0x10, 0x06, 0x12, 0x02, 0x17, 0x3f, 0x38, 0x10, 0x12,
+  0x81, 0x02, 0x80, 0x10, 0x03, 0x12, 0x02, 0x3f, 0x3d, 0x8b, 0x09, 0x07, 0x3f, 0x3f, 0x10, 0x00,
+  0x10, 0x12, 0x12, 0x02, 0x80, 0x3f, 0x08, 0x3a, 0x0b, 0x3b, 0x00, 0x01, 0x04, 0x3c, 0x34, 0x37,
+  0x85, 0x3f, 0x05, 0x3e, 0x3f, 0x3f, 0x27, 0x2e, 0x28, 0x81, 0x00, 0x08, 0x04, 0x00, 0x20, 0x20,
+  0x04, 0x06, 0x3c, 0x3e, 0x2e, 0x86, 0x3f, 0x1d, 0x00, 0x10, 0x02, 0x00, 0x3f, 0x3e, 0x20, 0x20,
+  0x00, 0x34, 0x06, 0x20, 0x34, 0x22, 0x22, 0x24, 0x14, 0x00, 0x20, 0x20, 0x34, 0x00, 0x34, 0x00,
+  0x21, 0x11, 0x02, 0x08, 0x00, 0x07, 0xc8, 0x3f, 0x03, 0x37, 0x3e, 0x3f, 0x37, 0x86, 0x26, 0x01,
+  0x24, 0x34, 0x80, 0x26, 0x08, 0x24, 0x34, 0x34, 0x3e, 0x3c, 0x18, 0x00, 0x07, 0x3c, 0x8c, 0x24,
+  0x03, 0x27, 0x3f, 0x10, 0x12, 0x80, 0x02, 0x02, 0x07, 0x3f, 0x3a, 0x81, 0x10, 0x02, 0x12, 0x02,
+  0x02, 0x81, 0x10, 0x01, 0x17, 0x39, 0x8b, 0x09, 0x06, 0x0f, 0x3f, 0x20, 0x10, 0x12, 0x10, 0x04,
+  0x81, 0x3f, 0x00, 0x39, 0x80, 0x3b, 0x03, 0x0a, 0x25, 0x24, 0x27, 0x81, 0x3f, 0x09, 0x37, 0x3f,
+  0x37, 0x3f, 0x37, 0x2f, 0x37, 0x35, 0x3e, 0x22, 0x83, 0x00, 0x10, 0x20, 0x04, 0x00, 0x20, 0x25,
+  0x3e, 0x2e, 0x3f, 0x2e, 0x3f, 0x37, 0x3c, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x80, 0x12, 0x10, 0x07,
+  0x3f, 0x3c, 0x30, 0x00, 0x34, 0x04, 0x30, 0x22, 0x20, 0x34, 0x04, 0x14, 0x20, 0x30, 0x06, 0x22,
+  0x80, 0x20, 0x07, 0x00, 0x08, 0x05, 0x11, 0x23, 0x00, 0x00, 0x2f, 0xc4, 0x3f, 0x08, 0x37, 0x3e,
+  0x3f, 0x3e, 0x3f, 0x3e, 0x3c, 0x36, 0x26, 0x82, 0x34, 0x80, 0x26, 0x00, 0x24, 0x80, 0x34, 0x08,
+  0x26, 0x26, 0x24, 0x3c, 0x3e, 0x2e, 0x00, 0x03, 0x3c, 0x8c, 0x24, 0x16, 0x3f, 0x3f, 0x12, 0x02,
+  0x02, 0x10, 0x10, 0x17, 0x3f, 0x38, 0x10, 0x10, 0x12, 0x02, 0x10, 0x12, 0x02, 0x02, 0x10, 0x12,
+  0x02, 0x17, 0x39, 0x8c, 0x09, 0x04, 0x3f, 0x3a, 0x00, 0x00, 0x07, 0x82, 0x3f, 0x0a, 0x3e, 0x0f,
+  0x1f, 0x1f, 0x09, 0x04, 0x34, 0x27, 0x3f, 0x37, 0x3e, 0x81, 0x3f, 0x05, 0x37, 0x3f, 0x37, 0x3d,
+  0x3f, 0x21, 0x83, 0x00, 0x08, 0x04, 0x04, 0x00, 0x20, 0x20, 0x07, 0x35, 0x37, 0x2e, 0x80, 0x3f,
+  0x00, 0x3e, 0x82, 0x3f, 0x19, 0x38, 0x02, 0x0f, 0x3f, 0x3f, 0x08, 0x04, 0x14, 0x06, 0x07, 0x04,
+  0x04, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x20, 0x21, 0x24, 0x14, 0x04, 0x30, 0x05, 0x11, 0x80,
+  0x01, 0x01, 0x00, 0x00, 0xc8, 0x3f, 0x02, 0x37, 0x37, 0x36, 0x85, 0x26, 0x00, 0x24, 0x80, 0x34,
+  0x80, 0x26, 0x07, 0x24, 0x36, 0x3e, 0x2e, 0x1c, 0x00, 0x07, 0x3c, 0x8b, 0x24, 0x0c, 0x27, 0x3f,
+  0x3f, 0x18, 0x10, 0x10, 0x12, 0x02, 0x17, 0x3f, 0x3e, 0x10, 0x12, 0x86, 0x02, 0x01, 0x3f, 0x39,
+  0x8c, 0x09, 0x02, 0x0f, 0x3f, 0x38, 0x85, 0x3f, 0x05, 0x19, 0x1f, 0x19, 0x1f, 0x00, 0x2c, 0x82,
+  0x3f, 0x07, 0x3e, 0x3f, 0x3f, 0x3d, 0x3e, 0x3f, 0x27, 0x20, 0x81, 0x00, 0x0c, 0x08, 0x00, 0x00,
+  0x20, 0x04, 0x04, 0x00, 0x04, 0x37, 0x2e, 0x3d, 0x37, 0x3e, 0x82, 0x3f, 0x04, 0x37, 0x3f, 0x3f,
+  0x3b, 0x02, 0x80, 0x3f, 0x0c, 0x00, 0x08, 0x20, 0x30, 0x20, 0x30, 0x31, 0x20, 0x30, 0x2e, 0x06,
+  0x04, 0x00, 0x80, 0x06, 0x0a, 0x00, 0x22, 0x24, 0x00, 0x08, 0x31, 0x14, 0x18, 0x08, 0x00, 0x03,
+  0xc2, 0x3f, 0x00, 0x3b, 0x80, 0x3f, 0x07, 0x37, 0x3f, 0x3f, 0x3e, 0x26, 0x34, 0x36, 0x26, 0x86,
+  0x34, 0x81, 0x26, 0x05, 0x2e, 0x3e, 0x2a, 0x00, 0x06, 0x3c, 0x8a, 0x24, 0x00, 0x25, 0x80, 0x3f,
+  0x01, 0x30, 0x12, 0x80, 0x02, 0x02, 0x07, 0x3f, 0x3f, 0x88, 0x10, 0x01, 0x17, 0x3f, 0x8d, 0x09,
+  0x01, 0x3f, 0x1f, 0x86, 0x3f, 0x10, 0x03, 0x2b, 0x03, 0x3f, 0x30, 0x27, 0x37, 0x3f, 0x3f, 0x37,
+  0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x2f, 0x30, 0x84, 0x00, 0x0e, 0x04, 0x00, 0x20, 0x00, 0x20, 0x20,
+  0x0e, 0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x80, 0x3f, 0x10, 0x35, 0x37, 0x3d, 0x37,
+  0x3f, 0x00, 0x14, 0x30, 0x30, 0x24, 0x14, 0x04, 0x20, 0x30, 0x26, 0x04, 0x04, 0x80, 0x20, 0x10,
+  0x34, 0x04, 0x20, 0x00, 0x20, 0x30, 0x11, 0x01, 0x01, 0x05, 0x10, 0x00, 0x00, 0x27, 0x3f, 0x3f,
+  0x3b, 0x87, 0x3f, 0x00, 0x1f, 0x86, 0x3f, 0x00, 0x3b, 0x86, 0x3f, 0x00, 0x3b, 0x94, 0x3f, 0x02,
+  0x1b, 0x1f, 0x1f, 0x84, 0x3f, 0x80, 0x1f, 0x06, 0x37, 0x3e, 0x3f, 0x37, 0x37, 0x34, 0x36, 0x89,
+  0x26, 0x09, 0x24, 0x34, 0x34, 0x3f, 0x37, 0x27, 0x31, 0x00, 0x07, 0x3c, 0x8b, 0x24, 0x80, 0x3f,
+  0x00, 0x12, 0x81, 0x02, 0x0f, 0x12, 0x3f, 0x3f, 0x3a, 0x10, 0x12, 0x02, 0x10, 0x12, 0x02, 0x10,
+  0x12, 0x02, 0x10, 0x3f, 0x39, 0x8d, 0x09, 0x02, 0x3f, 0x00, 0x00, 0x85, 0x3f, 0x01, 0x38, 0x18,
+  0x80, 0x3f, 0x02, 0x07, 0x3f, 0x3e, 0x81, 0x3f, 0x03, 0x3d, 0x3f, 0x3e, 0x38, 0x81, 0x00, 0x11,
+  0x08, 0x00, 0x00, 0x01, 0x00, 0x20, 0x04, 0x04, 0x00, 0x04, 0x07, 0x2e, 0x2f, 0x3d, 0x3e, 0x3f,
+  0x3f, 0x37, 0x80, 0x3f, 0x06, 0x37, 0x3f, 0x3c, 0x3e, 0x3c, 0x00, 0x08, 0x80, 0x20, 0x1a, 0x30,
+  0x20, 0x30, 0x30, 0x24, 0x14, 0x06, 0x04, 0x06, 0x04, 0x00, 0x20, 0x30, 0x34, 0x00, 0x06, 0x04,
+  0x00, 0x31, 0x11, 0x03, 0x01, 0x00, 0x00, 0x07, 0x3f, 0x3f, 0x80, 0x1f, 0x84, 0x3f, 0x80, 0x1f,
+  0x84, 0x3f, 0x80, 0x1f, 0x84, 0x3f, 0x02, 0x3b, 0x3f, 0x1f, 0x85, 0x3f, 0x02, 0x1b, 0x1f, 0x1f,
+  0x88, 0x3f, 0x01, 0x1f, 0x2b, 0x85, 0x3f, 0x02, 0x39, 0x3b, 0x2b, 0x81, 0x3f, 0x08, 0x37, 0x3e,
+  0x2e, 0x34, 0x32, 0x26, 0x26, 0x34, 0x36, 0x81, 0x26, 0x0b, 0x24, 0x34, 0x14, 0x34, 0x34, 0x3e,
+  0x3e, 0x3a, 0x2e, 0x00, 0x01, 0x3c, 0x8b, 0x24, 0x80, 0x3f, 0x00, 0x38, 0x81, 0x10, 0x00, 0x02,
+  0x83, 0x3f, 0x01, 0x17, 0x1a, 0x82, 0x02, 0x01, 0x17, 0x39, 0x83, 0x09, 0x01, 0x1d, 0x19, 0x85,
+  0x09, 0x02, 0x0f, 0x38, 0x00, 0x80, 0x3f, 0x81, 0x1f, 0x83, 0x3f, 0x01, 0x3e, 0x07, 0x81, 0x3f,
+  0x03, 0x37, 0x3e, 0x3e, 0x38, 0x86, 0x00, 0x1f, 0x20, 0x04, 0x00, 0x00, 0x20, 0x20, 0x26, 0x3f,
+  0x3e, 0x3e, 0x3f, 0x28, 0x20, 0x05, 0x35, 0x30, 0x27, 0x3f, 0x3f, 0x27, 0x35, 0x31, 0x0a, 0x06,
+  0x04, 0x14, 0x14, 0x04, 0x06, 0x04, 0x04, 0x14, 0x81, 0x04, 0x13, 0x00, 0x20, 0x06, 0x04, 0x06,
+  0x01, 0x00, 0x20, 0x20, 0x00, 0x0a, 0x21, 0x05, 0x11, 0x00, 0x07, 0x3f, 0x3b, 0x3b, 0x2b, 0x84,
+  0x3f, 0x03, 0x3b, 0x3b, 0x39, 0x3b, 0x84, 0x3f, 0x02, 0x3b, 0x3b, 0x2b, 0x85, 0x3f, 0x02, 0x1b,
+  0x2b, 0x1f, 0x84, 0x3f, 0x01, 0x1f, 0x2b, 0x88, 0x3f, 0x03, 0x1b, 0x3b, 0x1f, 0x1b, 0x83, 0x3f,
+  0x00, 0x3b, 0x80, 0x1f, 0x09, 0x3f, 0x37, 0x3e, 0x3e, 0x3f, 0x34, 0x36, 0x26, 0x34, 0x36, 0x89,
+  0x26, 0x06, 0x3c, 0x3f, 0x37, 0x31, 0x00, 0x07, 0x38, 0x83, 0x24, 0x80, 0x3f, 0x00, 0x20, 0x81,
+  0x24, 0x08, 0x27, 0x3f, 0x3f, 0x3a, 0x02, 0x10, 0x12, 0x02, 0x10, 0x84, 0x3f, 0x00, 0x38, 0x82,
+  0x10, 0x01, 0x3f, 0x39, 0x82, 0x09, 0x81, 0x3f, 0x00, 0x39, 0x83, 0x09, 0x05, 0x0f, 0x38, 0x00,
+  0x17, 0x3f, 0x3f, 0x80, 0x3b, 0x85, 0x3f, 0x07, 0x38, 0x37, 0x3f, 0x37, 0x3f, 0x2f, 0x3f, 0x3d,
+  0x85, 0x00, 0x08, 0x08, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x81, 0x3f, 0x0b, 0x00,
+  0x24, 0x20, 0x04, 0x0c, 0x00, 0x27, 0x37, 0x3c, 0x3c, 0x08, 0x04, 0x81, 0x20, 0x08, 0x30, 0x20,
+  0x22, 0x20, 0x20, 0x30, 0x30, 0x20, 0x22, 0x80, 0x04, 0x0d, 0x06, 0x04, 0x00, 0x01, 0x00, 0x06,
+  0x00, 0x21, 0x03, 0x03, 0x01, 0x00, 0x00, 0x3f, 0x81, 0x1f, 0x84, 0x3f, 0x02, 0x0f, 0x1f, 0x1f,
+  0x83, 0x3f, 0x01, 0x3b, 0x1d, 0x80, 0x1f, 0x83, 0x3f, 0x02, 0x19, 0x3b, 0x3b, 0x84, 0x3f, 0x03,
+  0x1b, 0x3b, 0x1f, 0x1f, 0x83, 0x3f, 0x00, 0x3b, 0x81, 0x3f, 0x02, 0x0f, 0x1f, 0x0f, 0x84, 0x3f,
+  0x81, 0x1f, 0x80, 0x3f, 0x09, 0x37, 0x36, 0x34, 0x36, 0x26, 0x34, 0x34, 0x36, 0x26, 0x26, 0x81,
+  0x34, 0x0a, 0x14, 0x34, 0x06, 0x26, 0x3e, 0x3e, 0x2f, 0x2e, 0x00, 0x00, 0x3c, 0x83, 0x24, 0x02,
+  0x3f, 0x37, 0x1f, 0x82, 0x24, 0x03, 0x27, 0x3f, 0x3f, 0x3a, 0x82, 0x02, 0x00, 0x1f, 0x83, 0x3f,
+  0x00, 0x3a, 0x80, 0x02, 0x03, 0x12, 0x02, 0x3f, 0x39, 0x81, 0x09, 0x00, 0x0f, 0x82, 0x3f, 0x00,
+  0x39, 0x83, 0x09, 0x04, 0x38, 0x00, 0x07, 0x3f, 0x3f, 0x81, 0x1f, 0x83, 0x3f, 0x07, 0x1f, 0x3f,
+  0x38, 0x27, 0x3f, 0x3e, 0x3f, 0x37, 0x83, 0x00, 0x00, 0x08, 0x80, 0x00, 0x18, 0x04, 0x00, 0x20,
+  0x00, 0x00, 0x20, 0x24, 0x00, 0x27, 0x3e, 0x3f, 0x3f, 0x34, 0x04, 0x24, 0x3c, 0x34, 0x24, 0x20,
+  0x3d, 0x37, 0x08, 0x18, 0x22, 0x04, 0x80, 0x14, 0x04, 0x04, 0x06, 0x04, 0x04, 0x14, 0x83, 0x04,
+  0x12, 0x02, 0x20, 0x22, 0x24, 0x00, 0x14, 0x08, 0x00, 0x02, 0x01, 0x20, 0x0c, 0x18, 0x00, 0x3f,
+  0x3f, 0x0f, 0x1b, 0x2b, 0x83, 0x3f, 0x00, 0x3b, 0x81, 0x1f, 0x83, 0x3f, 0x80, 0x3b, 0x84, 0x3f,
+  0x81, 0x1f, 0x84, 0x3f, 0x02, 0x0f, 0x1f, 0x0b, 0x87, 0x3f, 0x81, 0x1f, 0x83, 0x3f, 0x04, 0x3b,
+  0x2b, 0x39, 0x3b, 0x3f, 0x80, 0x37, 0x0a, 0x3e, 0x2e, 0x36, 0x26, 0x34, 0x36, 0x34, 0x34, 0x36,
+  0x26, 0x26, 0x83, 0x34, 0x07, 0x37, 0x37, 0x3e, 0x3e, 0x3c, 0x02, 0x07, 0x3c, 0x83, 0x24, 0x05,
+  0x38, 0x00, 0x07, 0x3c, 0x24, 0x04, 0x80, 0x24, 0x02, 0x3f, 0x3f, 0x3a, 0x82, 0x02, 0x00, 0x07,
+  0x83, 0x3f, 0x07, 0x3a, 0x02, 0x02, 0x10, 0x02, 0x10, 0x3f, 0x39, 0x81, 0x09, 0x00, 0x0b, 0x82,
+  0x3f, 0x00, 0x39, 0x82, 0x09, 0x02, 0x0f, 0x38, 0x00, 0x80, 0x3f, 0x03, 0x1f, 0x1b, 0x3b, 0x3b,
+  0x83, 0x3f, 0x03, 0x3b, 0x3f, 0x3f, 0x1c, 0x80, 0x3f, 0x00, 0x28, 0x81, 0x00, 0x00, 0x08, 0x83,
+  0x00, 0x1d, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x20, 0x07, 0x3f, 0x3e, 0x3f, 0x2c, 0x35, 0x35,
+  0x24, 0x0c, 0x20, 0x27, 0x3f, 0x38, 0x01, 0x00, 0x04, 0x04, 0x00, 0x20, 0x20, 0x30, 0x20, 0x22,
+  0x80, 0x20, 0x04, 0x04, 0x06, 0x00, 0x04, 0x00, 0x80, 0x04, 0x0c, 0x02, 0x00, 0x08, 0x05, 0x01,
+  0x20, 0x0a, 0x0a, 0x08, 0x08, 0x00, 0x0f, 0x1b, 0x80, 0x3b, 0x84, 0x3f, 0x00, 0x3b, 0x85, 0x3f,
+  0x03, 0x3b, 0x1f, 0x19, 0x3b, 0x84, 0x3f, 0x01, 0x1f, 0x1f, 0x85, 0x3f, 0x81, 0x1f, 0x83, 0x3f,
+  0x00, 0x3b, 0x80, 0x3f, 0x81, 0x3b, 0x83, 0x3f, 0x80, 0x3b, 0x00, 0x39, 0x80, 0x3f, 0x04, 0x3e,
+  0x3f, 0x34, 0x34, 0x36, 0x80, 0x26, 0x11, 0x36, 0x26, 0x26, 0x34, 0x34, 0x36, 0x26, 0x26, 0x06,
+  0x26, 0x27, 0x35, 0x37, 0x3c, 0x1e, 0x08, 0x00, 0x3c, 0x83, 0x24, 0x03, 0x3b, 0x00, 0x07, 0x1c,
+  0x82, 0x24, 0x03, 0x3f, 0x3f, 0x3a, 0x12, 0x82, 0x02, 0x83, 0x3f, 0x01, 0x10, 0x12, 0x81, 0x02,
+  0x01, 0x3f, 0x3b, 0x81, 0x09, 0x00, 0x0d, 0x83, 0x3f, 0x83, 0x09, 0x07, 0x38, 0x00, 0x07, 0x3f,
+  0x3f, 0x3b, 0x2b, 0x39, 0x85, 0x3f, 0x05, 0x1b, 0x1f, 0x3f, 0x30, 0x2e, 0x3c, 0x85, 0x00, 0x03,
+  0x01, 0x00, 0x00, 0x04, 0x81, 0x00, 0x03, 0x20, 0x20, 0x04, 0x04, 0x80, 0x3f, 0x15, 0x38, 0x25,
+  0x20, 0x35, 0x34, 0x3c, 0x07, 0x37, 0x01, 0x19, 0x04, 0x06, 0x04, 0x14, 0x04, 0x14, 0x04, 0x06,
+  0x04, 0x04, 0x14, 0x00, 0x80, 0x20, 0x14, 0x00, 0x20, 0x20, 0x22, 0x22, 0x20, 0x20, 0x21, 0x00,
+  0x18, 0x00, 0x05, 0x00, 0x1c, 0x11, 0x00, 0x07, 0x3f, 0x1f, 0x0f, 0x1f, 0x8e, 0x3f, 0x00, 0x0f,
+  0x80, 0x1f, 0x8e, 0x3f, 0x80, 0x1f, 0x88, 0x3f, 0x02, 0x1d, 0x1f, 0x1f, 0x84, 0x3f, 0x12, 0x3b,
+  0x1f, 0x1f, 0x3f, 0x3f, 0x37, 0x3f, 0x37, 0x36, 0x36, 0x26, 0x16, 0x26, 0x34, 0x34, 0x36, 0x34,
+  0x34, 0x36, 0x81, 0x26, 0x08, 0x34, 0x3e, 0x3f, 0x37, 0x37, 0x3c, 0x00, 0x07, 0x3c, 0x83, 0x24,
+  0x03, 0x3c, 0x00, 0x00, 0x3f, 0x82, 0x24, 0x02, 0x27, 0x3f, 0x3f, 0x82, 0x02, 0x01, 0x10, 0x17,
+  0x81, 0x3f, 0x00, 0x18, 0x80, 0x10, 0x04, 0x12, 0x02, 0x02, 0x3f, 0x39, 0x81, 0x09, 0x00, 0x0b,
+  0x83, 0x3f, 0x82, 0x09, 0x05, 0x0f, 0x38, 0x00, 0x17, 0x3f, 0x3f, 0x80, 0x3b, 0x84, 0x3f, 0x05,
+  0x3b, 0x3d, 0x1f, 0x3f, 0x3f, 0x07, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x27, 0x20, 0x00, 0x00,
+  0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x3f, 0x3f, 0x3e, 0x3e, 0x2e, 0x25, 0x24, 0x2c, 0x25, 0x27,
+  0x38, 0x09, 0x00, 0x14, 0x00, 0x20, 0x20, 0x30, 0x04, 0x10, 0x20, 0x22, 0x04, 0x00, 0x20, 0x22,
+  0x04, 0x00, 0x20, 0x04, 0x00, 0x80, 0x04, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x01,
+  0x03, 0x00, 0x07, 0x3f, 0x1f, 0x1f, 0x86, 0x3f, 0x01, 0x1f, 0x1f, 0x84, 0x3f, 0x80, 0x3b, 0x85,
+  0x3f, 0x00, 0x3b, 0x85, 0x3f, 0x02, 0x3b, 0x39, 0x3b, 0x89, 0x3f, 0x00, 0x3b, 0x8a, 0x3f, 0x1b,
+  0x37, 0x3f, 0x37, 0x3e, 0x3e, 0x26, 0x36, 0x26, 0x34, 0x36, 0x26, 0x34, 0x34, 0x36, 0x26, 0x26,
+  0x34, 0x36, 0x26, 0x26, 0x3e, 0x3e, 0x3f, 0x3f, 0x07, 0x10, 0x00, 0x3c, 0x83, 0x24, 0x03, 0x3b,
+  0x00, 0x00, 0x3f, 0x83, 0x24, 0x01, 0x3f, 0x3f, 0x85, 0x10, 0x0b, 0x13, 0x12, 0x10, 0x12, 0x02,
+  0x02, 0x10, 0x10, 0x12, 0x02, 0x3f, 0x3d, 0x81, 0x09, 0x00, 0x0d, 0x83, 0x3f, 0x83, 0x09, 0x02,
+  0x3f, 0x00, 0x07, 0x8b, 0x3f, 0x03, 0x3b, 0x3f, 0x3f, 0x38, 0x89, 0x00, 0x00, 0x04, 0x81, 0x00,
+  0x08, 0x04, 0x00, 0x20, 0x00, 0x07, 0x37, 0x3f, 0x3f, 0x05, 0x80, 0x35, 0x0e, 0x30, 0x3f, 0x01,
+  0x0b, 0x00, 0x20, 0x22, 0x20, 0x14, 0x00, 0x20, 0x20, 0x30, 0x00, 0x00, 0x81, 0x20, 0x14, 0x00,
+  0x00, 0x20, 0x04, 0x00, 0x04, 0x02, 0x20, 0x00, 0x00, 0x05, 0x00, 0x20, 0x10, 0x0a, 0x28, 0x00,
+  0x07, 0x3f, 0x3f, 0x3b, 0xa5, 0x3f, 0x00, 0x1f, 0x95, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x19, 0x3e,
+  0x3f, 0x36, 0x36, 0x2e, 0x34, 0x36, 0x26, 0x36, 0x26, 0x36, 0x26, 0x34, 0x36, 0x26, 0x26, 0x34,
+  0x36, 0x3e, 0x3f, 0x37, 0x37, 0x35, 0x00, 0x03, 0x3f, 0x83, 0x24, 0x04, 0x3d, 0x00, 0x00, 0x07,
+  0x3c, 0x82, 0x24, 0x05, 0x3f, 0x3f, 0x12, 0x02, 0x10, 0x12, 0x82, 0x02, 0x03, 0x00, 0x10, 0x10,
+  0x12, 0x82, 0x02, 0x01, 0x3f, 0x39, 0x81, 0x09, 0x00, 0x0b, 0x83, 0x3f, 0x82, 0x09, 0x04, 0x0f,
+  0x38, 0x00, 0x2f, 0x1f, 0x8d, 0x3f, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x09, 0x20, 0x00, 0x00,
+  0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x3f, 0x16, 0x34, 0x24, 0x3c, 0x26, 0x2f, 0x38,
+  0x0b, 0x08, 0x04, 0x00, 0x20, 0x04, 0x04, 0x06, 0x04, 0x00, 0x00, 0x20, 0x20, 0x04, 0x02, 0x20,
+  0x00, 0x81, 0x20, 0x04, 0x04, 0x14, 0x04, 0x04, 0x01, 0x80, 0x00, 0x05, 0x04, 0x01, 0x00, 0x0a,
+  0x00, 0x00, 0xc4, 0x3f, 0x1a, 0x3e, 0x3f, 0x3e, 0x3e, 0x26, 0x34, 0x36, 0x26, 0x36, 0x26, 0x34,
+  0x34, 0x36, 0x26, 0x34, 0x36, 0x36, 0x26, 0x34, 0x3e, 0x2e, 0x3f, 0x35, 0x3a, 0x38, 0x00, 0x3c,
+  0x83, 0x24, 0x04, 0x3a, 0x00, 0x00, 0x07, 0x3c, 0x82, 0x24, 0x02, 0x2f, 0x3f, 0x3a, 0x81, 0x02,
+  0x05, 0x10, 0x12, 0x02, 0x10, 0x12, 0x02, 0x81, 0x10, 0x04, 0x12, 0x02, 0x10, 0x3f, 0x39, 0x81,
+  0x09, 0x00, 0x0f, 0x82, 0x3f, 0x00, 0x39, 0x82, 0x09, 0x03, 0x0f, 0x38, 0x00, 0x06, 0x8d, 0x3f,
+  0x00, 0x39, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x02, 0x08, 0x00, 0x08, 0x82, 0x00, 0x18, 0x04,
+  0x00, 0x20, 0x20, 0x00, 0x00, 0x07, 0x37, 0x3f, 0x3d, 0x15, 0x27, 0x25, 0x37, 0x03, 0x0b, 0x00,
+  0x00, 0x06, 0x04, 0x06, 0x00, 0x20, 0x20, 0x00, 0x80, 0x20, 0x15, 0x22, 0x04, 0x00, 0x20, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x20, 0x04, 0x02, 0x20, 0x05, 0x01, 0x00, 0x20, 0x04, 0x0a, 0x28, 0x08,
+  0x00, 0xc3, 0x3f, 0x04, 0x37, 0x3f, 0x37, 0x37, 0x3e, 0x81, 0x36, 0x05, 0x26, 0x36, 0x26, 0x36,
+  0x26, 0x36, 0x80, 0x26, 0x09, 0x34, 0x36, 0x3e, 0x3f, 0x37, 0x3e, 0x3c, 0x00, 0x04, 0x3f, 0x83,
+  0x24, 0x04, 0x3f, 0x00, 0x00, 0x03, 0x3c, 0x82, 0x24, 0x03, 0x27, 0x3f, 0x3a, 0x02, 0x88, 0x10,
+  0x00, 0x12, 0x81, 0x02, 0x01, 0x3f, 0x39, 0x81, 0x09, 0x00, 0x0d, 0x82, 0x3f, 0x00, 0x39, 0x82,
+  0x09, 0x03, 0x0f, 0x38, 0x00, 0x3b, 0x8d, 0x3f, 0x02, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x04,
+  0x81, 0x00, 0x00, 0x20, 0x81, 0x00, 0x01, 0x05, 0x00, 0x80, 0x3f, 0x10, 0x3c, 0x3c, 0x3f, 0x3a,
+  0x09, 0x09, 0x00, 0x26, 0x00, 0x20, 0x04, 0x06, 0x00, 0x00, 0x20, 0x04, 0x00, 0x80, 0x20, 0x10,
+  0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x04, 0x00, 0x30, 0x20, 0x00, 0x10, 0x04, 0x00, 0x20, 0x02,
+  0x01, 0x80, 0x00, 0x00, 0x07, 0xc3, 0x3f, 0x1a, 0x37, 0x3f, 0x3f, 0x36, 0x34, 0x36, 0x26, 0x26,
+  0x36, 0x26, 0x36, 0x26, 0x34, 0x34, 0x36, 0x36, 0x34, 0x36, 0x27, 0x37, 0x37, 0x3e, 0x3f, 0x37,
+  0x38, 0x00, 0x3c, 0x83, 0x24, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x83, 0x24, 0x14, 0x3f, 0x3f,
+  0x12, 0x02, 0x10, 0x12, 0x02, 0x10, 0x12, 0x02, 0x02, 0x10, 0x10, 0x12, 0x02, 0x02, 0x10, 0x12,
+  0x02, 0x3f, 0x39, 0x82, 0x09, 0x81, 0x0f, 0x84, 0x09, 0x03, 0x0f, 0x38, 0x00, 0x1c, 0x8c, 0x3f,
+  0x00, 0x38, 0x81, 0x00, 0x03, 0x08, 0x00, 0x00, 0x08, 0x87, 0x00, 0x09, 0x04, 0x00, 0x04, 0x04,
+  0x00, 0x00, 0x01, 0x06, 0x3f, 0x37, 0x80, 0x3f, 0x09, 0x38, 0x09, 0x18, 0x04, 0x00, 0x04, 0x00,
+  0x30, 0x20, 0x00, 0x81, 0x20, 0x17, 0x22, 0x04, 0x00, 0x20, 0x20, 0x04, 0x04, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x20, 0x20, 0x21, 0x11, 0x00, 0x04, 0x00, 0x28, 0x07, 0x08, 0x00, 0x07, 0xc4, 0x3f,
+  0x02, 0x37, 0x37, 0x3c, 0x81, 0x36, 0x02, 0x26, 0x36, 0x26, 0x80, 0x36, 0x80, 0x26, 0x09, 0x34,
+  0x36, 0x3e, 0x3e, 0x3f, 0x3e, 0x0e, 0x00, 0x03, 0x3f, 0x83, 0x24, 0x05, 0x38, 0x00, 0x18, 0x00,
+  0x27, 0x3c, 0x82, 0x24, 0x02, 0x3f, 0x2f, 0x38, 0x86, 0x10, 0x00, 0x12, 0x83, 0x02, 0x01, 0x3f,
+  0x39, 0x8d, 0x09, 0x02, 0x0f, 0x00, 0x00, 0x8d, 0x3f, 0x92, 0x00, 0x00, 0x20, 0x80, 0x00, 0x03,
+  0x04, 0x00, 0x2f, 0x3f, 0x80, 0x37, 0x21, 0x01, 0x19, 0x00, 0x22, 0x04, 0x20, 0x30, 0x04, 0x00,
+  0x04, 0x02, 0x04, 0x10, 0x06, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x20, 0x20, 0x04, 0x00,
+  0x06, 0x00, 0x20, 0x00, 0x04, 0x04, 0x00, 0x01, 0x11, 0x81, 0x00, 0x00, 0x07, 0xc4, 0x3f, 0x08,
+  0x3e, 0x3e, 0x36, 0x34, 0x36, 0x26, 0x36, 0x26, 0x36, 0x80, 0x26, 0x82, 0x36, 0x07, 0x3f, 0x37,
+  0x3f, 0x37, 0x3f, 0x38, 0x00, 0x3f, 0x83, 0x24, 0x05, 0x3f, 0x00, 0x20, 0x00, 0x07, 0x3c, 0x82,
+  0x24, 0x04, 0x27, 0x23, 0x3f, 0x10, 0x12, 0x80, 0x02, 0x02, 0x10, 0x12, 0x02, 0x81, 0x10, 0x00,
+  0x12, 0x80, 0x02, 0x01, 0x3f, 0x3b, 0x8d, 0x09, 0x03, 0x0f, 0x38, 0x00, 0x2a, 0x8b, 0x3f, 0x00,
+  0x39, 0x8b, 0x00, 0x00, 0x20, 0x81, 0x00, 0x06, 0x04, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x01, 0x80,
+  0x00, 0x0b, 0x04, 0x04, 0x20, 0x0b, 0x09, 0x1c, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x82, 0x20,
+  0x15, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x14, 0x01,
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x23, 0x08, 0x80, 0x00, 0x00, 0x05, 0xc0, 0x3f, 0x04, 0x37, 0x3e,
+  0x3e, 0x3f, 0x37, 0x83, 0x36, 0x02, 0x26, 0x36, 0x36, 0x83, 0x34, 0x07, 0x3e, 0x3f, 0x37, 0x3f,
+  0x31, 0x30, 0x00, 0x27, 0x83, 0x24, 0x00, 0x39, 0x80, 0x00, 0x01, 0x03, 0x3e, 0x82, 0x24, 0x06,
+  0x27, 0x18, 0x37, 0x3a, 0x02, 0x10, 0x12, 0x83, 0x02, 0x07, 0x12, 0x02, 0x02, 0x10, 0x12, 0x02,
+  0x3f, 0x3d, 0x8d, 0x09, 0x03, 0x3f, 0x00, 0x06, 0x1f, 0x8b, 0x3f, 0x80, 0x00, 0x00, 0x08, 0x83,
+  0x00, 0x02, 0x01, 0x00, 0x01, 0x8d, 0x00, 0x0e, 0x01, 0x35, 0x24, 0x08, 0x09, 0x18, 0x04, 0x04,
+  0x06, 0x04, 0x20, 0x00, 0x20, 0x10, 0x20, 0x80, 0x00, 0x15, 0x04, 0x00, 0x00, 0x20, 0x00, 0x20,
+  0x00, 0x20, 0x20, 0x04, 0x00, 0x04, 0x04, 0x00, 0x20, 0x00, 0x20, 0x20, 0x18, 0x2a, 0x01, 0x20,
+  0x81, 0x00, 0x00, 0x07, 0xc2, 0x3f, 0x06, 0x37, 0x3e, 0x34, 0x36, 0x34, 0x36, 0x34, 0x80, 0x36,
+  0x00, 0x34, 0x83, 0x36, 0x08, 0x37, 0x3e, 0x3f, 0x37, 0x3e, 0x38, 0x00, 0x07, 0x3c, 0x81, 0x24,
+  0x01, 0x27, 0x3a, 0x81, 0x00, 0x01, 0x3f, 0x2c, 0x81, 0x24, 0x04, 0x37, 0x20, 0x01, 0x3f, 0x38,
+  0x83, 0x10, 0x03, 0x12, 0x02, 0x3f, 0x02, 0x81, 0x10, 0x01, 0x3f, 0x39, 0x8d, 0x09, 0x03, 0x3f,
+  0x00, 0x00, 0x3c, 0x8b, 0x3f, 0x85, 0x00, 0x00, 0x08, 0x85, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04,
+  0x81, 0x00, 0x23, 0x08, 0x08, 0x01, 0x01, 0x3f, 0x18, 0x26, 0x03, 0x0b, 0x09, 0x30, 0x20, 0x00,
+  0x20, 0x06, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x20, 0x04, 0x00,
+  0x04, 0x00, 0x20, 0x01, 0x00, 0x00, 0x04, 0x82, 0x00, 0x02, 0x01, 0x00, 0x18, 0x82, 0x00, 0x00,
+  0x07, 0xc2, 0x3f, 0x00, 0x37, 0x80, 0x36, 0x14, 0x34, 0x36, 0x34, 0x36, 0x26, 0x36, 0x34, 0x36,
+  0x26, 0x34, 0x36, 0x27, 0x3e, 0x3e, 0x3f, 0x3e, 0x2b, 0x22, 0x00, 0x03, 0x3f, 0x81, 0x24, 0x07,
+  0x27, 0x38, 0x00, 0x10, 0x00, 0x00, 0x07, 0x3e, 0x81, 0x24, 0x14, 0x3f, 0x00, 0x00, 0x07, 0x3f,
+  0x12, 0x02, 0x10, 0x12, 0x02, 0x10, 0x10, 0x3f, 0x3f, 0x10, 0x10, 0x12, 0x02, 0x12, 0x3f, 0x39,
+  0x8c, 0x09, 0x04, 0x0f, 0x38, 0x00, 0x07, 0x0f, 0x8a, 0x3f, 0x00, 0x38, 0x81, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x8e, 0x00, 0x2b, 0x01, 0x30, 0x05, 0x1d, 0x3f, 0x3f, 0x04, 0x3c, 0x01, 0x09, 0x00,
+  0x24, 0x00, 0x20, 0x04, 0x00, 0x04, 0x02, 0x20, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x20, 0x00, 0x22, 0x20, 0x10, 0x20, 0x20, 0x01, 0x23, 0x00,
+  0x38, 0x84, 0x00, 0x00, 0x07, 0xb5, 0x3f, 0x00, 0x3b, 0x85, 0x3f, 0x05, 0x37, 0x3a, 0x3e, 0x3f,
+  0x36, 0x34, 0x83, 0x36, 0x00, 0x34, 0x83, 0x36, 0x08, 0x37, 0x37, 0x3a, 0x3b, 0x3e, 0x3c, 0x08,
+  0x00, 0x07, 0x82, 0x3f, 0x80, 0x00, 0x02, 0x28, 0x00, 0x00, 0x83, 0x3f, 0x0d, 0x38, 0x00, 0x00,
+  0x07, 0x3f, 0x3f, 0x17, 0x10, 0x16, 0x17, 0x3f, 0x3f, 0x07, 0x3a, 0x80, 0x02, 0x02, 0x07, 0x38,
+  0x3f, 0x8c, 0x09, 0x04, 0x3f, 0x10, 0x00, 0x01, 0x33, 0x84, 0x3f, 0x01, 0x3d, 0x3b, 0x81, 0x3f,
+  0x02, 0x08, 0x00, 0x01, 0x94, 0x00, 0x10, 0x01, 0x39, 0x17, 0x3f, 0x3f, 0x3c, 0x24, 0x0b, 0x0b,
+  0x0e, 0x28, 0x02, 0x20, 0x30, 0x00, 0x00, 0x20, 0x80, 0x00, 0x10, 0x20, 0x00, 0x04, 0x04, 0x00,
+  0x20, 0x20, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x20, 0x80, 0x00, 0x01, 0x08,
+  0x21, 0x80, 0x01, 0x01, 0x00, 0x04, 0x81, 0x00, 0x00, 0x1f, 0x87, 0x3f, 0x00, 0x3b, 0x86, 0x3f,
+  0x01, 0x1f, 0x1f, 0x86, 0x3f, 0x00, 0x1f, 0x85, 0x3f, 0x01, 0x3b, 0x3b, 0x80, 0x3f, 0x00, 0x1b,
+  0x85, 0x3f, 0x01, 0x1b, 0x3b, 0x85, 0x3f, 0x03, 0x3b, 0x39, 0x3b, 0x37, 0x83, 0x36, 0x0e, 0x26,
+  0x34, 0x36, 0x36, 0x26, 0x34, 0x36, 0x26, 0x36, 0x3f, 0x3e, 0x3d, 0x17, 0x07, 0x1e, 0x80, 0x00,
+  0x08, 0x1f, 0x3f, 0x1f, 0x3b, 0x08, 0x00, 0x05, 0x00, 0x02, 0x80, 0x00, 0x02, 0x3f, 0x3f, 0x3b,
+  0x80, 0x3f, 0x03, 0x02, 0x00, 0x00, 0x27, 0x83, 0x3f, 0x09, 0x00, 0x07, 0x3e, 0x12, 0x02, 0x10,
+  0x17, 0x18, 0x07, 0x3b, 0x8a, 0x09, 0x05, 0x3f, 0x3c, 0x00, 0x00, 0x1a, 0x0f, 0x80, 0x3f, 0x00,
+  0x19, 0x80, 0x01, 0x05, 0x13, 0x01, 0x11, 0x03, 0x00, 0x1f, 0x8a, 0x00, 0x02, 0x08, 0x00, 0x08,
+  0x86, 0x00, 0x02, 0x0f, 0x1f, 0x07, 0x80, 0x3f, 0x11, 0x22, 0x20, 0x09, 0x18, 0x04, 0x20, 0x20,
+  0x00, 0x20, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x20, 0x80, 0x00, 0x15, 0x04, 0x00,
+  0x04, 0x00, 0x20, 0x00, 0x05, 0x01, 0x00, 0x04, 0x00, 0x20, 0x05, 0x10, 0x01, 0x02, 0x05, 0x10,
+  0x00, 0x00, 0x25, 0x24, 0x81, 0x00, 0x86, 0x3f, 0x02, 0x1b, 0x3b, 0x3b, 0x85, 0x3f, 0x01, 0x1f,
+  0x1f, 0x85, 0x3f, 0x01, 0x1b, 0x2b, 0x85, 0x3f, 0x01, 0x3b, 0x3b, 0x81, 0x3f, 0x00, 0x1f, 0x84,
+  0x3f, 0x02, 0x3d, 0x1f, 0x0b, 0x85, 0x3f, 0x07, 0x17, 0x1e, 0x3f, 0x3e, 0x36, 0x3e, 0x36, 0x34,
+  0x80, 0x36, 0x00, 0x14, 0x83, 0x36, 0x07, 0x37, 0x37, 0x17, 0x1f, 0x1f, 0x31, 0x31, 0x30, 0x89,
+  0x00, 0x02, 0x03, 0x3f, 0x3b, 0x81, 0x3f, 0x00, 0x3c, 0x82, 0x00, 0x01, 0x01, 0x01, 0x81, 0x00,
+  0x00, 0x1f, 0x81, 0x3f, 0x01, 0x00, 0x06, 0x80, 0x3f, 0x00, 0x3b, 0x81, 0x39, 0x03, 0x0b, 0x09,
+  0x19, 0x39, 0x80, 0x3f, 0x0c, 0x08, 0x00, 0x02, 0x2f, 0x3f, 0x3f, 0x01, 0x01, 0x0d, 0x1f, 0x1b,
+  0x1b, 0x0b, 0x80, 0x1b, 0x01, 0x1f, 0x1a, 0x87, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x08, 0x82,
+  0x00, 0x0e, 0x07, 0x15, 0x18, 0x3f, 0x3f, 0x3e, 0x00, 0x1c, 0x38, 0x0b, 0x09, 0x08, 0x38, 0x00,
+  0x04, 0x80, 0x00, 0x0f, 0x01, 0x00, 0x20, 0x00, 0x00, 0x20, 0x04, 0x00, 0x04, 0x04, 0x00, 0x01,
+  0x00, 0x20, 0x00, 0x20, 0x81, 0x00, 0x10, 0x20, 0x01, 0x00, 0x01, 0x04, 0x08, 0x08, 0x01, 0x00,
+  0x00, 0x04, 0x04, 0x24, 0x20, 0x00, 0x00, 0x01, 0x86, 0x3f, 0x01, 0x1d, 0x1f, 0x85, 0x3f, 0x02,
+  0x1f, 0x0f, 0x1f, 0x84, 0x3f, 0x80, 0x1f, 0x84, 0x3f, 0x00, 0x1f, 0x81, 0x3f, 0x00, 0x1b, 0x85,
+  0x3f, 0x01, 0x1b, 0x3b, 0x84, 0x3f, 0x07, 0x37, 0x1d, 0x1f, 0x17, 0x3e, 0x3e, 0x36, 0x34, 0x80,
+  0x36, 0x00, 0x34, 0x80, 0x36, 0x0c, 0x34, 0x36, 0x34, 0x36, 0x27, 0x37, 0x3f, 0x1e, 0x0e, 0x1c,
+  0x3e, 0x0e, 0x01, 0x84, 0x00, 0x00, 0x10, 0x81, 0x00, 0x09, 0x07, 0x3f, 0x3d, 0x3b, 0x3b, 0x3f,
+  0x3f, 0x39, 0x00, 0x10, 0x86, 0x00, 0x03, 0x20, 0x2b, 0x23, 0x23, 0x80, 0x00, 0x00, 0x05, 0x89,
+  0x3f, 0x18, 0x38, 0x00, 0x00, 0x01, 0x3f, 0x3b, 0x28, 0x01, 0x0b, 0x2b, 0x1b, 0x0b, 0x2b, 0x3b,
+  0x1b, 0x0b, 0x1b, 0x1b, 0x3b, 0x1f, 0x18, 0x10, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x80,
+  0x00, 0x11, 0x01, 0x1d, 0x1f, 0x07, 0x3f, 0x38, 0x00, 0x3f, 0x07, 0x39, 0x18, 0x0a, 0x3b, 0x08,
+  0x04, 0x00, 0x00, 0x04, 0x81, 0x00, 0x05, 0x20, 0x00, 0x04, 0x00, 0x00, 0x20, 0x80, 0x00, 0x06,
+  0x20, 0x00, 0x20, 0x01, 0x00, 0x28, 0x04, 0x80, 0x00, 0x0f, 0x21, 0x04, 0x11, 0x04, 0x03, 0x04,
+  0x00, 0x00, 0x24, 0x25, 0x04, 0x0c, 0x20, 0x00, 0x00, 0x07, 0x84, 0x3f, 0x02, 0x1b, 0x3b, 0x3b,
+  0x84, 0x3f, 0x02, 0x39, 0x3b, 0x3b, 0x84, 0x3f, 0x02, 0x3b, 0x2b, 0x3b, 0x86, 0x3f, 0x00, 0x1f,
+  0x80, 0x3f, 0x00, 0x3b, 0x86, 0x3f, 0x01, 0x1f, 0x1f, 0x85, 0x3f, 0x03, 0x1f, 0x0f, 0x37, 0x3e,
+  0x83, 0x36, 0x02, 0x16, 0x36, 0x26, 0x82, 0x36, 0x08, 0x37, 0x36, 0x2b, 0x3b, 0x3f, 0x38, 0x38,
+  0x1c, 0x14, 0x82, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x00, 0x01, 0x20, 0x07, 0x3f, 0x37, 0x1c, 0x3f,
+  0x2b, 0x3f, 0x3e, 0x00, 0x01, 0x84, 0x00, 0x05, 0x07, 0x3f, 0x1f, 0x37, 0x3d, 0x38, 0x8a, 0x00,
+  0x00, 0x20, 0x82, 0x00, 0x11, 0x06, 0x3f, 0x00, 0x09, 0x0b, 0x29, 0x1d, 0x0f, 0x0f, 0x0b, 0x0f,
+  0x0f, 0x19, 0x19, 0x1f, 0x1b, 0x1b, 0x18, 0x80, 0x0a, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+  0x01, 0x88, 0x00, 0x13, 0x0f, 0x17, 0x3b, 0x3f, 0x30, 0x00, 0x21, 0x1d, 0x18, 0x38, 0x0b, 0x08,
+  0x08, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x0c, 0x80, 0x00, 0x21, 0x04, 0x00, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x01, 0x04, 0x04, 0x02, 0x08, 0x00, 0x08,
+  0x10, 0x08, 0x01, 0x00, 0x00, 0x04, 0x04, 0x34, 0x24, 0x04, 0x20, 0x00, 0x00, 0x84, 0x3f, 0x02,
+  0x3d, 0x1f, 0x1f, 0x85, 0x3f, 0x01, 0x1b, 0x3b, 0x85, 0x3f, 0x01, 0x3b, 0x3b, 0x93, 0x3f, 0x01,
+  0x3b, 0x3b, 0x85, 0x3f, 0x04, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x83, 0x36, 0x00, 0x34, 0x84, 0x36,
+  0x0a, 0x37, 0x3f, 0x37, 0x37, 0x33, 0x37, 0x22, 0x21, 0x03, 0x20, 0x10, 0x82, 0x00, 0x0b, 0x28,
+  0x04, 0x10, 0x00, 0x07, 0x3f, 0x0f, 0x3f, 0x1e, 0x3f, 0x2f, 0x39, 0x80, 0x00, 0x05, 0x11, 0x00,
+  0x10, 0x00, 0x03, 0x37, 0x83, 0x3f, 0x02, 0x39, 0x00, 0x08, 0x82, 0x00, 0x04, 0x03, 0x00, 0x01,
+  0x00, 0x08, 0x81, 0x00, 0x18, 0x10, 0x07, 0x3f, 0x08, 0x09, 0x1d, 0x09, 0x19, 0x2b, 0x09, 0x19,
+  0x39, 0x19, 0x19, 0x3b, 0x0f, 0x1b, 0x1f, 0x1f, 0x1b, 0x10, 0x02, 0x00, 0x10, 0x10, 0x8c, 0x00,
+  0x25, 0x01, 0x17, 0x1d, 0x3f, 0x07, 0x30, 0x04, 0x30, 0x1f, 0x07, 0x07, 0x38, 0x09, 0x08, 0x00,
+  0x38, 0x00, 0x20, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x20, 0x20, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01,
+  0x20, 0x00, 0x20, 0x00, 0x00, 0x01, 0x01, 0x81, 0x00, 0x0e, 0x01, 0x04, 0x08, 0x04, 0x08, 0x21,
+  0x10, 0x00, 0x00, 0x04, 0x24, 0x04, 0x24, 0x2c, 0x04, 0x80, 0x00, 0x84, 0x3f, 0x00, 0x1f, 0x87,
+  0x3f, 0x00, 0x1f, 0x85, 0x3f, 0x00, 0x3b, 0xa0, 0x3f, 0x02, 0x37, 0x37, 0x3f, 0x81, 0x36, 0x00,
+  0x34, 0x83, 0x36, 0x00, 0x26, 0x80, 0x36, 0x00, 0x3e, 0x80, 0x3f, 0x06, 0x2e, 0x1d, 0x1c, 0x14,
+  0x11, 0x00, 0x20, 0x80, 0x00, 0x00, 0x30, 0x81, 0x00, 0x0e, 0x07, 0x3f, 0x37, 0x3a, 0x2f, 0x2f,
+  0x17, 0x3e, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x00, 0x83, 0x3f, 0x00, 0x1f, 0x80, 0x3f, 0x82,
+  0x00, 0x22, 0x28, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x11, 0x00, 0x01, 0x00, 0x31, 0x38, 0x05,
+  0x0d, 0x0d, 0x1d, 0x0f, 0x09, 0x1d, 0x0f, 0x09, 0x39, 0x39, 0x1d, 0x1b, 0x0f, 0x0f, 0x1b, 0x1f,
+  0x19, 0x18, 0x0a, 0x08, 0x0a, 0x85, 0x00, 0x00, 0x01, 0x84, 0x00, 0x18, 0x39, 0x3f, 0x3f, 0x38,
+  0x26, 0x34, 0x07, 0x07, 0x18, 0x20, 0x38, 0x19, 0x18, 0x00, 0x01, 0x00, 0x00, 0x08, 0x08, 0x03,
+  0x00, 0x20, 0x20, 0x06, 0x04, 0x85, 0x00, 0x0e, 0x20, 0x01, 0x20, 0x04, 0x01, 0x21, 0x00, 0x20,
+  0x04, 0x00, 0x00, 0x01, 0x00, 0x08, 0x21, 0x80, 0x00, 0x08, 0x20, 0x04, 0x04, 0x06, 0x25, 0x24,
+  0x00, 0x00, 0x07, 0xbc, 0x3f, 0x80, 0x3e, 0x89, 0x36, 0x00, 0x26, 0x81, 0x37, 0x08, 0x3e, 0x3f,
+  0x34, 0x15, 0x11, 0x04, 0x00, 0x01, 0x31, 0x81, 0x3f, 0x13, 0x39, 0x00, 0x03, 0x27, 0x39, 0x39,
+  0x35, 0x3a, 0x3a, 0x2f, 0x39, 0x15, 0x15, 0x10, 0x04, 0x00, 0x00, 0x07, 0x3f, 0x3f, 0x80, 0x38,
+  0x01, 0x3c, 0x3a, 0x80, 0x3f, 0x03, 0x38, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x80, 0x00, 0x1e, 0x21,
+  0x31, 0x22, 0x20, 0x00, 0x20, 0x0f, 0x31, 0x29, 0x0f, 0x0d, 0x0f, 0x0d, 0x0f, 0x09, 0x19, 0x2b,
+  0x0f, 0x0b, 0x0b, 0x39, 0x1b, 0x1b, 0x2b, 0x3b, 0x1f, 0x03, 0x00, 0x10, 0x10, 0x0a, 0x8a, 0x00,
+  0x14, 0x01, 0x1f, 0x0f, 0x3f, 0x3e, 0x06, 0x36, 0x36, 0x20, 0x14, 0x06, 0x27, 0x3b, 0x09, 0x00,
+  0x05, 0x10, 0x00, 0x20, 0x01, 0x15, 0x80, 0x00, 0x0e, 0x14, 0x00, 0x20, 0x04, 0x04, 0x00, 0x04,
+  0x08, 0x00, 0x04, 0x00, 0x00, 0x20, 0x01, 0x02, 0x81, 0x00, 0x0a, 0x08, 0x08, 0x38, 0x08, 0x23,
+  0x00, 0x08, 0x00, 0x01, 0x04, 0x23, 0x80, 0x24, 0x01, 0x00, 0x04, 0x80, 0x00, 0xbb, 0x3f, 0x03,
+  0x3e, 0x3f, 0x3f, 0x3e, 0x8b, 0x36, 0x00, 0x3e, 0x80, 0x3f, 0x06, 0x37, 0x1f, 0x3a, 0x28, 0x00,
+  0x00, 0x17, 0x84, 0x3f, 0x06, 0x00, 0x07, 0x3f, 0x37, 0x1f, 0x17, 0x2f, 0x82, 0x3f, 0x10, 0x39,
+  0x10, 0x00, 0x3f, 0x3b, 0x2f, 0x07, 0x3f, 0x2f, 0x1f, 0x0f, 0x2a, 0x2a, 0x3f, 0x3f, 0x2a, 0x00,
+  0x82, 0x3f, 0x00, 0x07, 0x82, 0x3f, 0x0f, 0x38, 0x00, 0x37, 0x0c, 0x0f, 0x29, 0x39, 0x39, 0x2b,
+  0x29, 0x39, 0x29, 0x1d, 0x0b, 0x2b, 0x2b, 0x80, 0x0f, 0x09, 0x1b, 0x1f, 0x1b, 0x18, 0x03, 0x03,
+  0x01, 0x10, 0x10, 0x18, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x12, 0x08, 0x00, 0x01, 0x00, 0x03,
+  0x23, 0x3f, 0x3f, 0x06, 0x36, 0x36, 0x26, 0x26, 0x04, 0x34, 0x07, 0x38, 0x03, 0x08, 0x89, 0x00,
+  0x16, 0x20, 0x30, 0x04, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x28, 0x05, 0x00,
+  0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x28, 0x03, 0x80, 0x00, 0x09, 0x27, 0x04, 0x04, 0x01, 0x30,
+  0x26, 0x25, 0x00, 0x00, 0x07, 0xb8, 0x3f, 0x02, 0x3e, 0x3f, 0x3f, 0x80, 0x3e, 0x01, 0x36, 0x3e,
+  0x88, 0x36, 0x82, 0x37, 0x05, 0x3f, 0x35, 0x35, 0x02, 0x00, 0x07, 0x80, 0x3f, 0x0c, 0x3b, 0x2f,
+  0x1f, 0x3f, 0x3f, 0x3c, 0x07, 0x38, 0x3c, 0x3c, 0x1d, 0x17, 0x07, 0x82, 0x3f, 0x13, 0x3c, 0x00,
+  0x3f, 0x3c, 0x1e, 0x39, 0x30, 0x3a, 0x2e, 0x31, 0x37, 0x0e, 0x2a, 0x3f, 0x38, 0x07, 0x3f, 0x3b,
+  0x37, 0x1f, 0x84, 0x3f, 0x0f, 0x38, 0x07, 0x18, 0x29, 0x29, 0x2d, 0x0d, 0x2b, 0x29, 0x0f, 0x0d,
+  0x1d, 0x0b, 0x09, 0x19, 0x1d, 0x80, 0x19, 0x0a, 0x39, 0x1b, 0x3b, 0x3b, 0x01, 0x01, 0x10, 0x03,
+  0x00, 0x10, 0x18, 0x86, 0x00, 0x06, 0x01, 0x3b, 0x3f, 0x3f, 0x3a, 0x36, 0x36, 0x80, 0x34, 0x04,
+  0x24, 0x32, 0x06, 0x00, 0x01, 0x8c, 0x00, 0x08, 0x20, 0x14, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00,
+  0x20, 0x80, 0x00, 0x03, 0x04, 0x01, 0x00, 0x28, 0x80, 0x08, 0x01, 0x02, 0x28, 0x80, 0x00, 0x04,
+  0x3f, 0x04, 0x07, 0x3f, 0x20, 0x80, 0x24, 0x01, 0x00, 0x00, 0xba, 0x3f, 0x03, 0x3e, 0x3f, 0x3f,
+  0x37, 0x8b, 0x36, 0x01, 0x37, 0x3e, 0x81, 0x3f, 0x14, 0x3a, 0x00, 0x20, 0x3f, 0x3f, 0x1c, 0x1c,
+  0x15, 0x15, 0x30, 0x38, 0x3f, 0x3f, 0x1f, 0x3b, 0x23, 0x2b, 0x27, 0x31, 0x31, 0x37, 0x80, 0x07,
+  0x36, 0x3f, 0x3f, 0x18, 0x3f, 0x23, 0x35, 0x1c, 0x3b, 0x27, 0x07, 0x0e, 0x39, 0x37, 0x1d, 0x17,
+  0x39, 0x3f, 0x38, 0x3c, 0x1c, 0x38, 0x3f, 0x3f, 0x2f, 0x1e, 0x0e, 0x0e, 0x0f, 0x3f, 0x1f, 0x28,
+  0x05, 0x35, 0x0f, 0x2b, 0x2d, 0x1d, 0x39, 0x29, 0x2b, 0x0d, 0x1d, 0x0d, 0x09, 0x39, 0x39, 0x3b,
+  0x0f, 0x1d, 0x19, 0x1b, 0x1a, 0x0a, 0x08, 0x18, 0x89, 0x00, 0x04, 0x03, 0x31, 0x3f, 0x3f, 0x06,
+  0x80, 0x36, 0x03, 0x26, 0x24, 0x34, 0x04, 0x80, 0x00, 0x00, 0x08, 0x8f, 0x00, 0x05, 0x01, 0x00,
+  0x00, 0x20, 0x08, 0x04, 0x81, 0x00, 0x05, 0x18, 0x00, 0x00, 0x02, 0x20, 0x01, 0x80, 0x00, 0x0b,
+  0x07, 0x3c, 0x05, 0x3f, 0x3f, 0x3c, 0x05, 0x06, 0x20, 0x28, 0x00, 0x00, 0xba, 0x3f, 0x02, 0x3e,
+  0x3e, 0x3f, 0x88, 0x36, 0x1b, 0x37, 0x36, 0x36, 0x3e, 0x3f, 0x37, 0x37, 0x3e, 0x3f, 0x00, 0x00,
+  0x07, 0x3f, 0x23, 0x27, 0x07, 0x0e, 0x38, 0x3d, 0x17, 0x07, 0x3f, 0x3f, 0x2e, 0x1c, 0x1e, 0x0b,
+  0x27, 0x83, 0x1c, 0x80, 0x3f, 0x0e, 0x1c, 0x1c, 0x1e, 0x0e, 0x1d, 0x33, 0x23, 0x23, 0x21, 0x35,
+  0x15, 0x3f, 0x37, 0x3f, 0x07, 0x81, 0x0e, 0x1c, 0x15, 0x07, 0x0e, 0x0f, 0x15, 0x17, 0x3f, 0x05,
+  0x05, 0x2d, 0x3d, 0x2d, 0x39, 0x2d, 0x0f, 0x0f, 0x0d, 0x0f, 0x09, 0x39, 0x1d, 0x0b, 0x0f, 0x09,
+  0x39, 0x19, 0x3b, 0x2b, 0x2b, 0x80, 0x00, 0x81, 0x10, 0x84, 0x00, 0x06, 0x03, 0x3d, 0x1f, 0x3f,
+  0x3a, 0x02, 0x06, 0x81, 0x26, 0x01, 0x20, 0x39, 0x8a, 0x00, 0x00, 0x01, 0x83, 0x00, 0x03, 0x04,
+  0x00, 0x00, 0x20, 0x81, 0x00, 0x0e, 0x20, 0x20, 0x00, 0x04, 0x00, 0x0c, 0x01, 0x21, 0x01, 0x04,
+  0x08, 0x00, 0x00, 0x03, 0x38, 0x80, 0x3f, 0x06, 0x38, 0x24, 0x24, 0x04, 0x24, 0x00, 0x00, 0xb9,
+  0x3f, 0x04, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x8b, 0x36, 0x00, 0x3e, 0x81, 0x3f, 0x06, 0x00, 0x00,
+  0x3f, 0x3c, 0x1c, 0x1c, 0x1e, 0x82, 0x0e, 0x01, 0x07, 0x3f, 0x84, 0x38, 0x00, 0x3b, 0x80, 0x23,
+  0x02, 0x07, 0x3f, 0x3c, 0x85, 0x38, 0x04, 0x3a, 0x2a, 0x2a, 0x3f, 0x3f, 0x81, 0x07, 0x02, 0x23,
+  0x23, 0x2a, 0x81, 0x38, 0x18, 0x3d, 0x3f, 0x00, 0x28, 0x3d, 0x2d, 0x3d, 0x2d, 0x39, 0x3d, 0x0d,
+  0x0f, 0x0d, 0x1d, 0x0f, 0x09, 0x1d, 0x0b, 0x2b, 0x0b, 0x2b, 0x19, 0x18, 0x00, 0x00, 0x80, 0x10,
+  0x03, 0x02, 0x00, 0x02, 0x02, 0x83, 0x00, 0x06, 0x0e, 0x0a, 0x00, 0x10, 0x12, 0x12, 0x10, 0x80,
+  0x34, 0x02, 0x20, 0x27, 0x10, 0x8d, 0x00, 0x00, 0x01, 0x81, 0x00, 0x05, 0x08, 0x08, 0x00, 0x28,
+  0x08, 0x05, 0x80, 0x00, 0x03, 0x01, 0x01, 0x04, 0x01, 0x80, 0x00, 0x04, 0x08, 0x11, 0x00, 0x00,
+  0x01, 0x81, 0x3f, 0x07, 0x38, 0x24, 0x04, 0x2e, 0x24, 0x20, 0x00, 0x00, 0xb9, 0x3f, 0x02, 0x3e,
+  0x3e, 0x3f, 0x8b, 0x36, 0x00, 0x37, 0x80, 0x3e, 0x05, 0x3f, 0x30, 0x06, 0x07, 0x3f, 0x11, 0x85,
+  0x31, 0x01, 0x3c, 0x3f, 0x88, 0x1c, 0x08, 0x38, 0x3f, 0x3b, 0x23, 0x23, 0x27, 0x3f, 0x2a, 0x2b,
+  0x82, 0x23, 0x01, 0x27, 0x3f, 0x83, 0x1c, 0x82, 0x15, 0x27, 0x17, 0x3c, 0x2c, 0x05, 0x2d, 0x3d,
+  0x2b, 0x2f, 0x2d, 0x2b, 0x2f, 0x0d, 0x1d, 0x0d, 0x19, 0x2b, 0x29, 0x19, 0x0f, 0x0b, 0x09, 0x00,
+  0x02, 0x00, 0x10, 0x02, 0x00, 0x02, 0x00, 0x10, 0x10, 0x02, 0x02, 0x00, 0x10, 0x10, 0x00, 0x02,
+  0x00, 0x10, 0x80, 0x12, 0x06, 0x02, 0x12, 0x06, 0x24, 0x24, 0x17, 0x39, 0x89, 0x00, 0x00, 0x01,
+  0x87, 0x00, 0x13, 0x20, 0x08, 0x00, 0x20, 0x00, 0x01, 0x00, 0x04, 0x00, 0x20, 0x01, 0x00, 0x21,
+  0x01, 0x22, 0x00, 0x28, 0x00, 0x00, 0x07, 0x81, 0x3f, 0x07, 0x04, 0x20, 0x24, 0x04, 0x05, 0x24,
+  0x00, 0x00, 0xb7, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x03, 0x37, 0x3f, 0x36, 0x37, 0x89, 0x36, 0x00,
+  0x37, 0x80, 0x3f, 0x03, 0x3e, 0x00, 0x07, 0x3a, 0x83, 0x2a, 0x80, 0x0e, 0x01, 0x03, 0x3f, 0x88,
+  0x23, 0x04, 0x07, 0x07, 0x3f, 0x31, 0x31, 0x81, 0x3f, 0x82, 0x15, 0x02, 0x17, 0x3f, 0x28, 0x80,
+  0x38, 0x80, 0x1c, 0x80, 0x0e, 0x23, 0x07, 0x07, 0x38, 0x28, 0x28, 0x05, 0x2d, 0x3d, 0x2d, 0x29,
+  0x3d, 0x2d, 0x2b, 0x2d, 0x0f, 0x0d, 0x0d, 0x19, 0x29, 0x39, 0x09, 0x00, 0x10, 0x00, 0x02, 0x00,
+  0x00, 0x10, 0x10, 0x02, 0x02, 0x00, 0x10, 0x00, 0x10, 0x00, 0x81, 0x02, 0x83, 0x12, 0x03, 0x10,
+  0x26, 0x07, 0x3f, 0x92, 0x00, 0x00, 0x08, 0x83, 0x00, 0x0b, 0x08, 0x00, 0x04, 0x08, 0x08, 0x01,
+  0x00, 0x00, 0x10, 0x00, 0x01, 0x21, 0x80, 0x00, 0x05, 0x03, 0x3b, 0x3f, 0x1f, 0x3f, 0x20, 0x81,
+  0x24, 0x03, 0x14, 0x28, 0x00, 0x00, 0xba, 0x3f, 0x80, 0x3e, 0x8a, 0x36, 0x81, 0x3e, 0x1d, 0x08,
+  0x00, 0x3f, 0x21, 0x30, 0x30, 0x07, 0x00, 0x31, 0x06, 0x01, 0x30, 0x0c, 0x1c, 0x3f, 0x38, 0x0e,
+  0x01, 0x30, 0x0c, 0x11, 0x20, 0x1c, 0x07, 0x00, 0x38, 0x23, 0x07, 0x3f, 0x0a, 0x83, 0x3f, 0x16,
+  0x00, 0x2a, 0x05, 0x10, 0x2b, 0x3f, 0x10, 0x2a, 0x05, 0x14, 0x0a, 0x21, 0x14, 0x18, 0x23, 0x21,
+  0x30, 0x3f, 0x05, 0x2c, 0x04, 0x0f, 0x2d, 0x80, 0x2f, 0x1c, 0x2d, 0x1d, 0x3d, 0x0f, 0x29, 0x39,
+  0x39, 0x29, 0x19, 0x08, 0x00, 0x11, 0x00, 0x03, 0x01, 0x02, 0x10, 0x02, 0x02, 0x00, 0x00, 0x10,
+  0x02, 0x02, 0x00, 0x10, 0x00, 0x02, 0x02, 0x84, 0x12, 0x03, 0x10, 0x17, 0x3f, 0x38, 0x99, 0x00,
+  0x0f, 0x20, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x05, 0x01, 0x04, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x07, 0x81, 0x3f, 0x08, 0x04, 0x20, 0x20, 0x24, 0x04, 0x24, 0x24, 0x00, 0x00, 0xb8, 0x3f, 0x04,
+  0x3e, 0x3e, 0x3f, 0x3e, 0x3e, 0x8a, 0x36, 0x80, 0x37, 0x1c, 0x3f, 0x30, 0x00, 0x3f, 0x2a, 0x05,
+  0x03, 0x20, 0x1c, 0x0a, 0x21, 0x30, 0x0e, 0x0e, 0x03, 0x3f, 0x31, 0x30, 0x0e, 0x05, 0x10, 0x2a,
+  0x07, 0x04, 0x18, 0x07, 0x00, 0x1c, 0x07, 0x81, 0x3f, 0x00, 0x1f, 0x80, 0x3f, 0x2c, 0x31, 0x14,
+  0x0a, 0x21, 0x14, 0x3f, 0x05, 0x10, 0x38, 0x03, 0x20, 0x1c, 0x03, 0x20, 0x38, 0x02, 0x08, 0x2f,
+  0x04, 0x38, 0x28, 0x25, 0x27, 0x2d, 0x3d, 0x2d, 0x2f, 0x2d, 0x2d, 0x39, 0x2b, 0x2d, 0x0d, 0x1d,
+  0x00, 0x00, 0x03, 0x00, 0x02, 0x08, 0x18, 0x10, 0x00, 0x10, 0x00, 0x80, 0x02, 0x83, 0x00, 0x07,
+  0x03, 0x02, 0x12, 0x12, 0x10, 0x12, 0x12, 0x10, 0x80, 0x3f, 0x9c, 0x00, 0x09, 0x01, 0x04, 0x08,
+  0x01, 0x00, 0x04, 0x08, 0x00, 0x28, 0x0e, 0x80, 0x00, 0x00, 0x07, 0x80, 0x1f, 0x0a, 0x3f, 0x20,
+  0x24, 0x24, 0x0c, 0x24, 0x0c, 0x20, 0x20, 0x00, 0x07, 0xb9, 0x3f, 0x01, 0x3e, 0x3f, 0x8b, 0x36,
+  0x1f, 0x37, 0x3f, 0x3e, 0x3e, 0x00, 0x07, 0x3a, 0x06, 0x0a, 0x21, 0x14, 0x03, 0x27, 0x3b, 0x23,
+  0x20, 0x01, 0x27, 0x3f, 0x1c, 0x03, 0x20, 0x18, 0x23, 0x04, 0x08, 0x11, 0x22, 0x28, 0x15, 0x02,
+  0x28, 0x80, 0x3f, 0x2f, 0x04, 0x00, 0x00, 0x07, 0x3f, 0x0e, 0x01, 0x30, 0x0e, 0x07, 0x3f, 0x02,
+  0x28, 0x07, 0x04, 0x18, 0x23, 0x04, 0x18, 0x07, 0x05, 0x14, 0x3f, 0x04, 0x2c, 0x04, 0x05, 0x3d,
+  0x27, 0x2d, 0x3d, 0x3d, 0x2b, 0x2d, 0x2f, 0x2d, 0x0f, 0x0d, 0x00, 0x08, 0x00, 0x00, 0x01, 0x19,
+  0x0a, 0x01, 0x03, 0x03, 0x80, 0x02, 0x83, 0x00, 0x03, 0x03, 0x02, 0x00, 0x13, 0x80, 0x12, 0x01,
+  0x10, 0x00, 0x80, 0x3f, 0x00, 0x38, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01,
+  0x8d, 0x00, 0x00, 0x04, 0x80, 0x00, 0x06, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x80, 0x3f,
+  0x07, 0x3b, 0x24, 0x04, 0x04, 0x20, 0x24, 0x26, 0x05, 0x80, 0x00, 0xa6, 0x3f, 0x00, 0x1f, 0x86,
+  0x3f, 0x00, 0x1b, 0x82, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x01, 0x33, 0x3f, 0x8c, 0x36, 0x09, 0x3f,
+  0x37, 0x00, 0x06, 0x3d, 0x10, 0x21, 0x02, 0x21, 0x07, 0x80, 0x3f, 0x38, 0x07, 0x02, 0x07, 0x3f,
+  0x38, 0x28, 0x10, 0x21, 0x10, 0x23, 0x02, 0x20, 0x08, 0x15, 0x02, 0x21, 0x10, 0x3f, 0x3f, 0x38,
+  0x00, 0x38, 0x07, 0x00, 0x00, 0x01, 0x30, 0x0e, 0x00, 0x08, 0x3f, 0x28, 0x07, 0x00, 0x18, 0x21,
+  0x14, 0x08, 0x07, 0x00, 0x30, 0x02, 0x1c, 0x04, 0x27, 0x05, 0x04, 0x27, 0x2d, 0x2f, 0x2d, 0x2f,
+  0x2d, 0x2b, 0x2d, 0x1d, 0x3d, 0x80, 0x00, 0x09, 0x08, 0x08, 0x01, 0x03, 0x01, 0x00, 0x18, 0x02,
+  0x00, 0x0a, 0x83, 0x00, 0x0c, 0x08, 0x01, 0x3b, 0x3f, 0x3f, 0x2b, 0x38, 0x3f, 0x3f, 0x37, 0x3f,
+  0x3f, 0x39, 0x87, 0x00, 0x00, 0x08, 0x9f, 0x00, 0x0b, 0x07, 0x3f, 0x1f, 0x3b, 0x3d, 0x00, 0x31,
+  0x3f, 0x3f, 0x04, 0x04, 0x20, 0x80, 0x00, 0x00, 0x07, 0x82, 0x3f, 0x00, 0x1b, 0x86, 0x3f, 0x01,
+  0x1f, 0x1f, 0x86, 0x3f, 0x00, 0x1f, 0x89, 0x3f, 0x01, 0x3b, 0x1f, 0x86, 0x3f, 0x00, 0x1f, 0x84,
+  0x3f, 0x06, 0x37, 0x3f, 0x1f, 0x17, 0x3e, 0x36, 0x37, 0x83, 0x36, 0x00, 0x16, 0x81, 0x36, 0x0a,
+  0x3f, 0x37, 0x38, 0x02, 0x07, 0x38, 0x02, 0x06, 0x01, 0x02, 0x37, 0x80, 0x3f, 0x45, 0x38, 0x0c,
+  0x1f, 0x3f, 0x38, 0x10, 0x28, 0x10, 0x21, 0x10, 0x21, 0x02, 0x04, 0x00, 0x01, 0x00, 0x21, 0x3f,
+  0x3f, 0x00, 0x38, 0x00, 0x18, 0x07, 0x04, 0x10, 0x00, 0x00, 0x0e, 0x06, 0x3f, 0x02, 0x00, 0x04,
+  0x00, 0x10, 0x00, 0x14, 0x00, 0x01, 0x01, 0x21, 0x38, 0x20, 0x2c, 0x20, 0x21, 0x2c, 0x2e, 0x2d,
+  0x2f, 0x2d, 0x2b, 0x2d, 0x2d, 0x28, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x01, 0x09, 0x00, 0x18,
+  0x0a, 0x08, 0x18, 0x10, 0x83, 0x00, 0x02, 0x03, 0x3b, 0x2f, 0x80, 0x3f, 0x02, 0x07, 0x3f, 0x3b,
+  0x80, 0x3f, 0x00, 0x38, 0x92, 0x00, 0x00, 0x08, 0x84, 0x00, 0x00, 0x08, 0x8c, 0x00, 0x04, 0x07,
+  0x1f, 0x3f, 0x1f, 0x3a, 0x80, 0x3f, 0x02, 0x00, 0x24, 0x20, 0x81, 0x00, 0x00, 0x07, 0x82, 0x3f,
+  0x00, 0x39, 0x86, 0x3f, 0x01, 0x3b, 0x2f, 0x85, 0x3f, 0x01, 0x1b, 0x2b, 0x94, 0x3f, 0x00, 0x3b,
+  0x85, 0x3f, 0x03, 0x37, 0x37, 0x3e, 0x3e, 0x88, 0x36, 0x0b, 0x3e, 0x36, 0x36, 0x3e, 0x3e, 0x04,
+  0x06, 0x3a, 0x04, 0x08, 0x22, 0x20, 0x82, 0x3f, 0x38, 0x3a, 0x3f, 0x3f, 0x38, 0x08, 0x00, 0x21,
+  0x00, 0x21, 0x02, 0x28, 0x03, 0x01, 0x30, 0x30, 0x10, 0x3f, 0x38, 0x00, 0x00, 0x18, 0x04, 0x00,
+  0x00, 0x28, 0x1c, 0x0e, 0x00, 0x01, 0x3f, 0x00, 0x08, 0x11, 0x15, 0x01, 0x21, 0x3f, 0x01, 0x30,
+  0x30, 0x10, 0x3f, 0x20, 0x27, 0x04, 0x04, 0x27, 0x25, 0x3c, 0x3c, 0x2f, 0x2d, 0x21, 0x00, 0x04,
+  0x00, 0x00, 0x80, 0x01, 0x07, 0x00, 0x08, 0x08, 0x01, 0x01, 0x00, 0x0a, 0x08, 0x81, 0x00, 0x0e,
+  0x01, 0x00, 0x00, 0x07, 0x07, 0x1f, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f, 0x38, 0x8c,
+  0x00, 0x02, 0x08, 0x00, 0x08, 0x91, 0x00, 0x00, 0x08, 0x84, 0x00, 0x02, 0x0b, 0x3f, 0x1f, 0x82,
+  0x3f, 0x01, 0x3c, 0x04, 0x82, 0x00, 0x00, 0x07, 0x82, 0x3f, 0x00, 0x3b, 0x87, 0x3f, 0x00, 0x1f,
+  0xa9, 0x3f, 0x02, 0x37, 0x3e, 0x3e, 0x89, 0x36, 0x09, 0x37, 0x3e, 0x38, 0x00, 0x17, 0x00, 0x22,
+  0x00, 0x18, 0x07, 0x85, 0x3f, 0x14, 0x30, 0x06, 0x0a, 0x00, 0x10, 0x02, 0x3f, 0x38, 0x20, 0x00,
+  0x01, 0x01, 0x20, 0x37, 0x38, 0x2a, 0x04, 0x00, 0x0a, 0x01, 0x10, 0x80, 0x00, 0x26, 0x0e, 0x00,
+  0x3f, 0x04, 0x10, 0x20, 0x00, 0x10, 0x17, 0x3f, 0x38, 0x01, 0x00, 0x28, 0x17, 0x39, 0x24, 0x20,
+  0x04, 0x2c, 0x2e, 0x2d, 0x2d, 0x31, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09,
+  0x09, 0x01, 0x00, 0x0a, 0x08, 0x85, 0x00, 0x02, 0x01, 0x19, 0x3b, 0x80, 0x3f, 0x02, 0x07, 0x3f,
+  0x3b, 0x80, 0x3f, 0x00, 0x38, 0x81, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x04, 0x04, 0x82, 0x24,
+  0x94, 0x00, 0x04, 0x1f, 0x3b, 0x3f, 0x1f, 0x1f, 0x80, 0x3f, 0x01, 0x18, 0x20, 0x80, 0x00, 0x02,
+  0x08, 0x00, 0x1f, 0xb9, 0x3f, 0x02, 0x37, 0x3e, 0x3f, 0x8b, 0x36, 0x08, 0x3e, 0x3c, 0x10, 0x07,
+  0x2a, 0x08, 0x10, 0x20, 0x00, 0x82, 0x3f, 0x03, 0x3d, 0x3f, 0x3f, 0x39, 0x80, 0x00, 0x1e, 0x21,
+  0x05, 0x3f, 0x3f, 0x02, 0x08, 0x30, 0x00, 0x00, 0x0f, 0x38, 0x00, 0x01, 0x00, 0x20, 0x04, 0x01,
+  0x20, 0x1c, 0x02, 0x00, 0x00, 0x3f, 0x10, 0x08, 0x01, 0x00, 0x20, 0x2f, 0x3f, 0x3e, 0x81, 0x00,
+  0x0d, 0x0e, 0x3b, 0x38, 0x20, 0x2e, 0x2c, 0x2e, 0x20, 0x20, 0x21, 0x20, 0x04, 0x04, 0x00, 0x80,
+  0x08, 0x82, 0x01, 0x02, 0x00, 0x0a, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x01, 0x01, 0x33,
+  0x80, 0x3f, 0x00, 0x1f, 0x82, 0x3f, 0x00, 0x3b, 0x8c, 0x00, 0x00, 0x04, 0x80, 0x24, 0x09, 0x20,
+  0x20, 0x3c, 0x04, 0x14, 0x24, 0x08, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00,
+  0x01, 0x81, 0x00, 0x08, 0x0f, 0x1f, 0x3b, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x20, 0x83, 0x00, 0xb8,
+  0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x01, 0x37, 0x3e, 0x8a, 0x36, 0x08, 0x37, 0x10, 0x04, 0x17, 0x30,
+  0x04, 0x00, 0x00, 0x38, 0x82, 0x3f, 0x0a, 0x00, 0x07, 0x3f, 0x20, 0x00, 0x05, 0x10, 0x02, 0x07,
+  0x3f, 0x3f, 0x80, 0x00, 0x2d, 0x30, 0x02, 0x27, 0x00, 0x00, 0x30, 0x03, 0x33, 0x38, 0x10, 0x00,
+  0x00, 0x0c, 0x00, 0x0e, 0x3f, 0x00, 0x04, 0x10, 0x03, 0x00, 0x3f, 0x3f, 0x39, 0x02, 0x20, 0x10,
+  0x20, 0x00, 0x3f, 0x3f, 0x06, 0x04, 0x27, 0x20, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x00,
+  0x08, 0x01, 0x01, 0x80, 0x08, 0x01, 0x01, 0x01, 0x86, 0x00, 0x01, 0x0f, 0x0f, 0x80, 0x3f, 0x00,
+  0x2f, 0x82, 0x3f, 0x00, 0x38, 0x8b, 0x00, 0x05, 0x08, 0x04, 0x22, 0x20, 0x30, 0x2e, 0x81, 0x24,
+  0x03, 0x20, 0x04, 0x00, 0x01, 0x90, 0x00, 0x07, 0x3f, 0x1f, 0x1f, 0x3b, 0x3b, 0x3f, 0x3b, 0x08,
+  0x80, 0x00, 0x03, 0x08, 0x00, 0x00, 0x0f, 0xbb, 0x3f, 0x02, 0x37, 0x3f, 0x37, 0x8b, 0x36, 0x07,
+  0x3c, 0x10, 0x07, 0x30, 0x00, 0x00, 0x10, 0x00, 0x81, 0x3f, 0x19, 0x38, 0x00, 0x00, 0x3f, 0x38,
+  0x02, 0x00, 0x01, 0x00, 0x06, 0x3f, 0x3f, 0x00, 0x20, 0x08, 0x01, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x07, 0x3f, 0x3f, 0x3d, 0x10, 0x81, 0x00, 0x15, 0x3f, 0x01, 0x00, 0x00, 0x20, 0x00, 0x3f, 0x3f,
+  0x3e, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x07, 0x07, 0x3f, 0x39, 0x00, 0x00, 0x04, 0x00, 0x80, 0x04,
+  0x0a, 0x00, 0x00, 0x08, 0x01, 0x00, 0x08, 0x09, 0x01, 0x00, 0x08, 0x08, 0x84, 0x00, 0x02, 0x01,
+  0x00, 0x0a, 0x80, 0x3f, 0x00, 0x3a, 0x83, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x81, 0x00, 0x03, 0x04,
+  0x01, 0x24, 0x25, 0x80, 0x24, 0x07, 0x04, 0x1c, 0x21, 0x26, 0x00, 0x0c, 0x00, 0x20, 0x8c, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x3b, 0x3b, 0x3f, 0x1f, 0x3f, 0x18, 0x85, 0x00, 0xbb, 0x3f, 0x06, 0x37,
+  0x3f, 0x37, 0x3e, 0x3e, 0x36, 0x37, 0x88, 0x36, 0x08, 0x38, 0x04, 0x07, 0x38, 0x02, 0x21, 0x00,
+  0x00, 0x27, 0x80, 0x3f, 0x80, 0x00, 0x02, 0x3f, 0x38, 0x01, 0x80, 0x00, 0x02, 0x07, 0x3f, 0x3f,
+  0x82, 0x00, 0x03, 0x27, 0x00, 0x10, 0x00, 0x81, 0x3f, 0x0d, 0x00, 0x02, 0x00, 0x02, 0x00, 0x3f,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x3f, 0x3f, 0x39, 0x82, 0x00, 0x02, 0x2f, 0x3f, 0x01, 0x81, 0x00,
+  0x80, 0x04, 0x0a, 0x00, 0x00, 0x08, 0x01, 0x00, 0x01, 0x09, 0x00, 0x08, 0x08, 0x01, 0x84, 0x00,
+  0x02, 0x01, 0x00, 0x20, 0x81, 0x3f, 0x00, 0x1f, 0x82, 0x3f, 0x00, 0x38, 0x8d, 0x00, 0x06, 0x04,
+  0x34, 0x26, 0x2e, 0x39, 0x35, 0x34, 0x80, 0x24, 0x80, 0x00, 0x02, 0x01, 0x00, 0x08, 0x86, 0x00,
+  0x00, 0x01, 0x82, 0x00, 0x04, 0x03, 0x39, 0x3f, 0x0b, 0x2a, 0x86, 0x00, 0xbe, 0x3f, 0x02, 0x3e,
+  0x3f, 0x37, 0x8b, 0x36, 0x09, 0x02, 0x07, 0x30, 0x00, 0x00, 0x04, 0x00, 0x02, 0x3f, 0x3f, 0x81,
+  0x00, 0x12, 0x07, 0x38, 0x00, 0x20, 0x00, 0x20, 0x01, 0x3f, 0x3f, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x0f, 0x00, 0x20, 0x00, 0x2f, 0x80, 0x3f, 0x07, 0x00, 0x20, 0x00, 0x20, 0x08, 0x3f, 0x04, 0x02,
+  0x80, 0x00, 0x09, 0x3f, 0x3f, 0x3e, 0x00, 0x00, 0x20, 0x00, 0x20, 0x17, 0x38, 0x81, 0x00, 0x80,
+  0x04, 0x80, 0x00, 0x08, 0x05, 0x00, 0x08, 0x09, 0x01, 0x01, 0x00, 0x08, 0x08, 0x84, 0x00, 0x03,
+  0x04, 0x00, 0x01, 0x1f, 0x80, 0x3f, 0x01, 0x2f, 0x3b, 0x81, 0x3f, 0x8d, 0x00, 0x10, 0x01, 0x04,
+  0x27, 0x3d, 0x3e, 0x2e, 0x3e, 0x3c, 0x3c, 0x06, 0x21, 0x00, 0x08, 0x01, 0x04, 0x00, 0x20, 0x8c,
+  0x00, 0x02, 0x03, 0x2b, 0x08, 0x87, 0x00, 0x00, 0x01, 0xbc, 0x3f, 0x04, 0x3e, 0x3f, 0x3f, 0x3e,
+  0x3e, 0x8a, 0x36, 0x1d, 0x30, 0x04, 0x06, 0x38, 0x30, 0x02, 0x00, 0x10, 0x00, 0x0e, 0x08, 0x00,
+  0x00, 0x02, 0x00, 0x07, 0x38, 0x00, 0x00, 0x10, 0x00, 0x07, 0x3f, 0x3f, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x37, 0x80, 0x00, 0x80, 0x3f, 0x02, 0x38, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3f, 0x82, 0x00,
+  0x02, 0x3f, 0x3f, 0x39, 0x80, 0x00, 0x02, 0x01, 0x17, 0x3f, 0x82, 0x00, 0x80, 0x20, 0x0a, 0x00,
+  0x02, 0x00, 0x28, 0x00, 0x01, 0x08, 0x09, 0x00, 0x08, 0x01, 0x82, 0x00, 0x80, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x80, 0x3f, 0x02, 0x38, 0x3f, 0x3a, 0x80, 0x3f, 0x00, 0x38, 0x83, 0x00, 0x03, 0x08,
+  0x00, 0x00, 0x08, 0x82, 0x00, 0x13, 0x08, 0x20, 0x07, 0x3c, 0x3e, 0x2e, 0x3d, 0x35, 0x3e, 0x2e,
+  0x24, 0x04, 0x00, 0x20, 0x04, 0x00, 0x08, 0x01, 0x00, 0x08, 0x94, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0xbc, 0x3f, 0x06, 0x37, 0x3f, 0x3f, 0x37, 0x37, 0x3f, 0x3f, 0x8a, 0x36, 0x02, 0x02, 0x06, 0x3a,
+  0x88, 0x00, 0x01, 0x07, 0x38, 0x81, 0x00, 0x02, 0x06, 0x3f, 0x3f, 0x82, 0x00, 0x00, 0x0f, 0x80,
+  0x00, 0x02, 0x17, 0x3f, 0x3d, 0x83, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x09, 0x10, 0x00, 0x3f, 0x3f,
+  0x38, 0x00, 0x02, 0x00, 0x06, 0x3d, 0x82, 0x00, 0x80, 0x04, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x05, 0x08, 0x29, 0x81, 0x08, 0x81, 0x00, 0x06, 0x01, 0x00, 0x04, 0x00, 0x20, 0x00, 0x07, 0x80,
+  0x3f, 0x00, 0x3b, 0x82, 0x3f, 0x00, 0x08, 0x8d, 0x00, 0x11, 0x08, 0x35, 0x37, 0x2e, 0x3d, 0x37,
+  0x2e, 0x3d, 0x37, 0x2c, 0x20, 0x08, 0x01, 0x00, 0x08, 0x04, 0x00, 0x04, 0x97, 0x00, 0x00, 0x01,
+  0xc1, 0x3f, 0x00, 0x37, 0x8b, 0x36, 0x04, 0x10, 0x00, 0x3f, 0x00, 0x20, 0x86, 0x00, 0x01, 0x07,
+  0x38, 0x81, 0x00, 0x02, 0x01, 0x3f, 0x3f, 0x82, 0x00, 0x00, 0x3f, 0x81, 0x00, 0x00, 0x38, 0x84,
+  0x00, 0x00, 0x3f, 0x82, 0x00, 0x06, 0x3f, 0x3f, 0x38, 0x00, 0x00, 0x0e, 0x39, 0x83, 0x00, 0x00,
+  0x20, 0x80, 0x00, 0x14, 0x02, 0x00, 0x00, 0x21, 0x00, 0x0d, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x20, 0x81, 0x3f, 0x00, 0x1f, 0x81, 0x3f, 0x00,
+  0x3a, 0x8f, 0x00, 0x11, 0x3f, 0x37, 0x37, 0x3e, 0x3e, 0x3f, 0x27, 0x3c, 0x30, 0x20, 0x00, 0x04,
+  0x00, 0x00, 0x08, 0x05, 0x00, 0x08, 0x96, 0x00, 0x04, 0x3f, 0x3f, 0x3d, 0x3f, 0x2f, 0xba, 0x3f,
+  0x08, 0x3e, 0x3f, 0x37, 0x3e, 0x3f, 0x3e, 0x36, 0x36, 0x3e, 0x82, 0x36, 0x07, 0x3e, 0x36, 0x36,
+  0x16, 0x22, 0x20, 0x37, 0x30, 0x80, 0x00, 0x03, 0x20, 0x00, 0x00, 0x10, 0x80, 0x00, 0x01, 0x07,
+  0x38, 0x81, 0x00, 0x02, 0x07, 0x3f, 0x3f, 0x82, 0x00, 0x00, 0x3f, 0x88, 0x00, 0x01, 0x04, 0x3f,
+  0x81, 0x00, 0x07, 0x07, 0x3f, 0x3f, 0x38, 0x00, 0x00, 0x31, 0x38, 0x8a, 0x00, 0x05, 0x04, 0x04,
+  0x00, 0x04, 0x01, 0x20, 0x83, 0x00, 0x0a, 0x21, 0x00, 0x08, 0x08, 0x00, 0x01, 0x3f, 0x3f, 0x1f,
+  0x3f, 0x07, 0x81, 0x3f, 0x00, 0x28, 0x8e, 0x00, 0x0e, 0x04, 0x2e, 0x2f, 0x2f, 0x27, 0x2f, 0x2e,
+  0x3f, 0x37, 0x2f, 0x20, 0x05, 0x00, 0x08, 0x0c, 0x81, 0x00, 0x01, 0x20, 0x08, 0x8f, 0x00, 0x00,
+  0x08, 0x80, 0x00, 0x04, 0x02, 0x3f, 0x39, 0x3f, 0x1f, 0xbe, 0x3f, 0x02, 0x37, 0x3e, 0x3e, 0x89,
+  0x36, 0x04, 0x32, 0x00, 0x07, 0x30, 0x02, 0x86, 0x00, 0x01, 0x07, 0x38, 0x81, 0x00, 0x02, 0x07,
+  0x3f, 0x38, 0x82, 0x00, 0x01, 0x3f, 0x38, 0x87, 0x00, 0x01, 0x03, 0x3f, 0x82, 0x00, 0x05, 0x3f,
+  0x3f, 0x38, 0x00, 0x05, 0x1c, 0x82, 0x00, 0x1e, 0x08, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x04, 0x04, 0x05, 0x04, 0x08, 0x20, 0x05, 0x00, 0x00, 0x21, 0x04, 0x08, 0x21, 0x00, 0x00, 0x20,
+  0x04, 0x01, 0x07, 0x3b, 0x3f, 0x3f, 0x3b, 0x81, 0x3f, 0x00, 0x3b, 0x8e, 0x00, 0x14, 0x01, 0x07,
+  0x3f, 0x37, 0x37, 0x3e, 0x3e, 0x3f, 0x2e, 0x3f, 0x34, 0x01, 0x00, 0x01, 0x04, 0x00, 0x08, 0x28,
+  0x01, 0x20, 0x08, 0x85, 0x00, 0x00, 0x08, 0x85, 0x00, 0x00, 0x08, 0x82, 0x00, 0x05, 0x2f, 0x3d,
+  0x3f, 0x3d, 0x3f, 0x1d, 0xbc, 0x3f, 0x04, 0x37, 0x3f, 0x37, 0x3e, 0x3e, 0x87, 0x36, 0x08, 0x32,
+  0x34, 0x16, 0x06, 0x3f, 0x00, 0x20, 0x00, 0x10, 0x82, 0x00, 0x02, 0x07, 0x3f, 0x3a, 0x82, 0x00,
+  0x01, 0x3f, 0x3b, 0x82, 0x00, 0x01, 0x3f, 0x38, 0x88, 0x00, 0x01, 0x3f, 0x08, 0x80, 0x00, 0x06,
+  0x07, 0x3f, 0x3f, 0x38, 0x00, 0x1e, 0x08, 0x81, 0x00, 0x03, 0x08, 0x04, 0x00, 0x20, 0x80, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0x04, 0x00, 0x20, 0x20, 0x21, 0x20, 0x28, 0x01, 0x82, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x00, 0x3b, 0x80, 0x3f, 0x01, 0x1f, 0x38, 0x8b, 0x00, 0x00,
+  0x01, 0x80, 0x00, 0x0d, 0x04, 0x3e, 0x3d, 0x3e, 0x2f, 0x3f, 0x2e, 0x3f, 0x35, 0x3c, 0x00, 0x00,
+  0x04, 0x01, 0x81, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x01, 0x8d, 0x00, 0x01, 0x01, 0x3f, 0x80,
+  0x0f, 0x03, 0x1d, 0x3f, 0x3f, 0x2f, 0xb8, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x01, 0x3e, 0x3f, 0x81,
+  0x36, 0x00, 0x37, 0x81, 0x36, 0x07, 0x32, 0x36, 0x36, 0x32, 0x20, 0x00, 0x37, 0x30, 0x85, 0x00,
+  0x02, 0x07, 0x3f, 0x38, 0x81, 0x00, 0x02, 0x07, 0x3f, 0x38, 0x82, 0x00, 0x01, 0x3f, 0x38, 0x87,
+  0x00, 0x02, 0x07, 0x3f, 0x30, 0x81, 0x00, 0x0f, 0x3f, 0x3f, 0x00, 0x05, 0x31, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x20, 0x08, 0x08, 0x00, 0x00, 0x08, 0x81, 0x00, 0x81, 0x20, 0x0d, 0x28, 0x20, 0x00,
+  0x20, 0x00, 0x08, 0x21, 0x00, 0x21, 0x04, 0x01, 0x01, 0x20, 0x1f, 0x82, 0x3f, 0x02, 0x3b, 0x3f,
+  0x3f, 0x90, 0x00, 0x14, 0x0f, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x3d, 0x3f, 0x31, 0x01, 0x07,
+  0x00, 0x02, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x28, 0x0c, 0x92, 0x00, 0x06, 0x0f, 0x19, 0x0f, 0x3f,
+  0x3f, 0x2f, 0x3b, 0xbd, 0x3f, 0x04, 0x3e, 0x3f, 0x37, 0x3e, 0x3e, 0x81, 0x36, 0x0b, 0x16, 0x36,
+  0x16, 0x36, 0x36, 0x32, 0x36, 0x32, 0x30, 0x02, 0x3f, 0x10, 0x83, 0x00, 0x03, 0x07, 0x3f, 0x07,
+  0x3d, 0x81, 0x00, 0x02, 0x07, 0x3f, 0x3c, 0x81, 0x00, 0x02, 0x06, 0x3f, 0x3f, 0x83, 0x00, 0x00,
+  0x10, 0x80, 0x00, 0x02, 0x07, 0x3f, 0x28, 0x80, 0x00, 0x0b, 0x07, 0x3f, 0x3f, 0x00, 0x07, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x28, 0x08, 0x83, 0x00, 0x03, 0x01, 0x00, 0x00, 0x20, 0x80, 0x04, 0x05,
+  0x00, 0x00, 0x01, 0x00, 0x08, 0x20, 0x82, 0x00, 0x01, 0x20, 0x00, 0x85, 0x3f, 0x00, 0x3b, 0x90,
+  0x00, 0x15, 0x27, 0x37, 0x2f, 0x3e, 0x3f, 0x27, 0x3f, 0x3f, 0x37, 0x38, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x1c, 0x00, 0x18, 0x28, 0x00, 0x00, 0x01, 0x91, 0x00, 0x08, 0x3d, 0x29, 0x09, 0x09, 0x39,
+  0x3b, 0x3d, 0x3d, 0x3b, 0xba, 0x3f, 0x08, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x36, 0x16, 0x36, 0x16,
+  0x84, 0x36, 0x06, 0x32, 0x34, 0x10, 0x30, 0x37, 0x38, 0x10, 0x81, 0x00, 0x04, 0x22, 0x3f, 0x38,
+  0x00, 0x3f, 0x81, 0x00, 0x02, 0x07, 0x3f, 0x38, 0x81, 0x00, 0x03, 0x07, 0x38, 0x07, 0x3f, 0x81,
+  0x00, 0x01, 0x07, 0x38, 0x80, 0x00, 0x02, 0x07, 0x3f, 0x38, 0x80, 0x00, 0x04, 0x07, 0x3f, 0x3f,
+  0x00, 0x3b, 0x80, 0x00, 0x04, 0x21, 0x00, 0x00, 0x05, 0x01, 0x82, 0x00, 0x00, 0x08, 0x84, 0x00,
+  0x14, 0x08, 0x04, 0x00, 0x20, 0x01, 0x04, 0x08, 0x04, 0x01, 0x00, 0x00, 0x08, 0x3f, 0x3b, 0x3f,
+  0x1f, 0x3f, 0x1f, 0x3f, 0x3f, 0x18, 0x90, 0x00, 0x02, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x0e, 0x3e,
+  0x3f, 0x3f, 0x20, 0x0c, 0x08, 0x04, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0c, 0x01, 0x86, 0x00,
+  0x00, 0x01, 0x87, 0x00, 0x09, 0x0f, 0x39, 0x09, 0x09, 0x2b, 0x2f, 0x3d, 0x3b, 0x3b, 0x3d, 0xbb,
+  0x3f, 0x05, 0x37, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x85, 0x36, 0x11, 0x32, 0x36, 0x32, 0x36, 0x00,
+  0x00, 0x37, 0x3f, 0x35, 0x32, 0x2e, 0x3f, 0x3f, 0x3e, 0x00, 0x00, 0x17, 0x38, 0x80, 0x00, 0x03,
+  0x3f, 0x07, 0x3f, 0x38, 0x80, 0x00, 0x06, 0x3f, 0x08, 0x00, 0x3f, 0x3d, 0x00, 0x00, 0x80, 0x3f,
+  0x05, 0x00, 0x00, 0x07, 0x3f, 0x02, 0x3a, 0x80, 0x00, 0x0b, 0x07, 0x38, 0x3f, 0x3f, 0x38, 0x00,
+  0x00, 0x28, 0x0a, 0x01, 0x31, 0x02, 0x82, 0x00, 0x0c, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+  0x00, 0x08, 0x04, 0x00, 0x08, 0x01, 0x80, 0x00, 0x03, 0x01, 0x00, 0x21, 0x00, 0x86, 0x3f, 0x91,
+  0x00, 0x16, 0x3f, 0x27, 0x3f, 0x3c, 0x3f, 0x3e, 0x3f, 0x3c, 0x3f, 0x31, 0x02, 0x00, 0x0a, 0x08,
+  0x0c, 0x08, 0x05, 0x00, 0x28, 0x03, 0x00, 0x04, 0x08, 0x8e, 0x00, 0x01, 0x01, 0x3f, 0x81, 0x09,
+  0x06, 0x0b, 0x2b, 0x3f, 0x2f, 0x3f, 0x3f, 0x2f, 0xbb, 0x3f, 0x02, 0x37, 0x37, 0x3e, 0x81, 0x36,
+  0x0c, 0x32, 0x36, 0x32, 0x36, 0x16, 0x36, 0x32, 0x22, 0x30, 0x30, 0x14, 0x06, 0x37, 0x80, 0x3f,
+  0x01, 0x3e, 0x38, 0x80, 0x00, 0x0f, 0x23, 0x3f, 0x38, 0x01, 0x37, 0x3f, 0x00, 0x07, 0x3f, 0x38,
+  0x38, 0x3f, 0x3f, 0x00, 0x00, 0x07, 0x81, 0x3f, 0x00, 0x38, 0x81, 0x3f, 0x11, 0x38, 0x05, 0x3f,
+  0x39, 0x20, 0x3f, 0x3f, 0x00, 0x07, 0x3f, 0x00, 0x00, 0x2a, 0x00, 0x05, 0x00, 0x01, 0x21, 0x81,
+  0x00, 0x02, 0x0c, 0x00, 0x01, 0x80, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x20, 0x08, 0x08, 0x00, 0x00,
+  0x21, 0x00, 0x28, 0x80, 0x00, 0x02, 0x03, 0x3f, 0x1f, 0x80, 0x3f, 0x03, 0x1f, 0x3f, 0x3b, 0x38,
+  0x85, 0x00, 0x00, 0x08, 0x87, 0x00, 0x03, 0x07, 0x3e, 0x3f, 0x3e, 0x83, 0x3f, 0x0b, 0x00, 0x0c,
+  0x08, 0x21, 0x00, 0x11, 0x00, 0x0a, 0x01, 0x00, 0x20, 0x05, 0x90, 0x00, 0x00, 0x3f, 0x80, 0x09,
+  0x07, 0x29, 0x09, 0x2b, 0x3d, 0x1d, 0x3b, 0x2f, 0x1f, 0xbb, 0x3f, 0x07, 0x37, 0x3f, 0x3f, 0x37,
+  0x3e, 0x16, 0x36, 0x16, 0x83, 0x36, 0x03, 0x16, 0x36, 0x16, 0x16, 0x81, 0x00, 0x00, 0x10, 0x80,
+  0x00, 0x04, 0x01, 0x04, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x80, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x81,
+  0x00, 0x02, 0x02, 0x07, 0x07, 0x80, 0x00, 0x04, 0x38, 0x3f, 0x07, 0x07, 0x38, 0x81, 0x3f, 0x0a,
+  0x38, 0x00, 0x00, 0x3f, 0x00, 0x08, 0x01, 0x03, 0x00, 0x08, 0x08, 0x86, 0x00, 0x0f, 0x08, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x08, 0x21, 0x00, 0x20, 0x00, 0x00, 0x28, 0x03, 0x80, 0x3f,
+  0x02, 0x3b, 0x3f, 0x1f, 0x80, 0x3f, 0x00, 0x38, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x04,
+  0x81, 0x3f, 0x12, 0x3e, 0x3f, 0x27, 0x3e, 0x3f, 0x00, 0x01, 0x02, 0x08, 0x05, 0x00, 0x08, 0x20,
+  0x04, 0x11, 0x01, 0x00, 0x08, 0x01, 0x8d, 0x00, 0x01, 0x07, 0x1d, 0x83, 0x09, 0x05, 0x0d, 0x3b,
+  0x3f, 0x3f, 0x2f, 0x3b, 0xbb, 0x3f, 0x03, 0x3e, 0x3f, 0x3e, 0x3f, 0x81, 0x36, 0x17, 0x32, 0x36,
+  0x36, 0x32, 0x36, 0x36, 0x16, 0x22, 0x22, 0x30, 0x10, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,
+  0x02, 0x08, 0x00, 0x20, 0x06, 0x08, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x02, 0x87, 0x00,
+  0x00, 0x07, 0x80, 0x38, 0x01, 0x3f, 0x1f, 0x80, 0x3f, 0x08, 0x07, 0x20, 0x00, 0x05, 0x00, 0x28,
+  0x07, 0x04, 0x11, 0x81, 0x00, 0x06, 0x0c, 0x00, 0x08, 0x00, 0x01, 0x00, 0x01, 0x81, 0x00, 0x08,
+  0x0c, 0x00, 0x00, 0x08, 0x00, 0x08, 0x05, 0x00, 0x01, 0x85, 0x3f, 0x01, 0x1f, 0x3f, 0x91, 0x00,
+  0x02, 0x07, 0x3f, 0x3e, 0x84, 0x3f, 0x0d, 0x01, 0x20, 0x0c, 0x03, 0x00, 0x0c, 0x11, 0x01, 0x01,
+  0x00, 0x04, 0x02, 0x04, 0x08, 0x8c, 0x00, 0x01, 0x01, 0x3d, 0x82, 0x09, 0x08, 0x0d, 0x09, 0x0b,
+  0x2f, 0x0f, 0x0f, 0x3f, 0x2f, 0x3d, 0xbb, 0x3f, 0x29, 0x3e, 0x3f, 0x37, 0x3e, 0x1e, 0x36, 0x3a,
+  0x36, 0x3e, 0x32, 0x36, 0x36, 0x16, 0x32, 0x36, 0x16, 0x16, 0x04, 0x00, 0x22, 0x04, 0x00, 0x20,
+  0x10, 0x04, 0x0c, 0x14, 0x10, 0x00, 0x00, 0x06, 0x00, 0x01, 0x10, 0x04, 0x10, 0x00, 0x08, 0x00,
+  0x00, 0x05, 0x07, 0x86, 0x00, 0x00, 0x3f, 0x84, 0x00, 0x0e, 0x15, 0x3b, 0x38, 0x00, 0x0a, 0x01,
+  0x10, 0x08, 0x01, 0x05, 0x00, 0x00, 0x05, 0x27, 0x27, 0x84, 0x00, 0x0a, 0x08, 0x01, 0x00, 0x00,
+  0x18, 0x28, 0x00, 0x28, 0x01, 0x00, 0x01, 0x80, 0x3f, 0x07, 0x3b, 0x3f, 0x1f, 0x3f, 0x1f, 0x1f,
+  0x3f, 0x39, 0x91, 0x00, 0x16, 0x07, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3c, 0x02,
+  0x01, 0x10, 0x08, 0x21, 0x10, 0x08, 0x02, 0x28, 0x04, 0x18, 0x08, 0x08, 0x8d, 0x00, 0x01, 0x2f,
+  0x39, 0x80, 0x09, 0x00, 0x0d, 0x81, 0x09, 0x04, 0x2b, 0x2f, 0x3f, 0x1f, 0x1f, 0xb9, 0x3f, 0x01,
+  0x37, 0x3e, 0x80, 0x3f, 0x06, 0x3e, 0x3e, 0x36, 0x32, 0x36, 0x36, 0x32, 0x81, 0x36, 0x0e, 0x16,
+  0x32, 0x26, 0x06, 0x12, 0x22, 0x00, 0x02, 0x02, 0x00, 0x2a, 0x22, 0x02, 0x08, 0x08, 0x81, 0x00,
+  0x15, 0x20, 0x05, 0x10, 0x00, 0x02, 0x20, 0x02, 0x00, 0x10, 0x00, 0x2a, 0x05, 0x00, 0x00, 0x07,
+  0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0f, 0x01, 0x20,
+  0x0c, 0x08, 0x31, 0x02, 0x08, 0x00, 0x07, 0x37, 0x35, 0x35, 0x34, 0x00, 0x01, 0x00, 0x80, 0x08,
+  0x83, 0x00, 0x03, 0x08, 0x00, 0x20, 0x01, 0x80, 0x3f, 0x00, 0x1f, 0x80, 0x3f, 0x04, 0x1f, 0x3f,
+  0x3f, 0x3b, 0x38, 0x91, 0x00, 0x16, 0x2f, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x38,
+  0x08, 0x0c, 0x01, 0x00, 0x18, 0x21, 0x04, 0x08, 0x01, 0x01, 0x00, 0x20, 0x05, 0x8c, 0x00, 0x04,
+  0x0f, 0x19, 0x09, 0x09, 0x0d, 0x83, 0x09, 0x05, 0x0f, 0x1d, 0x1d, 0x3d, 0x3f, 0x1f, 0xba, 0x3f,
+  0x08, 0x3e, 0x3f, 0x37, 0x37, 0x3f, 0x3f, 0x36, 0x36, 0x32, 0x80, 0x36, 0x05, 0x16, 0x16, 0x32,
+  0x36, 0x16, 0x16, 0x82, 0x14, 0x19, 0x0e, 0x02, 0x05, 0x15, 0x06, 0x06, 0x0e, 0x03, 0x00, 0x0a,
+  0x03, 0x22, 0x01, 0x00, 0x28, 0x02, 0x05, 0x15, 0x05, 0x15, 0x10, 0x2a, 0x02, 0x2a, 0x28, 0x02,
+  0x80, 0x07, 0x04, 0x39, 0x00, 0x00, 0x08, 0x08, 0x81, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x10, 0x0a,
+  0x01, 0x00, 0x08, 0x00, 0x27, 0x3e, 0x80, 0x2e, 0x01, 0x2c, 0x20, 0x81, 0x00, 0x09, 0x10, 0x00,
+  0x08, 0x00, 0x08, 0x00, 0x08, 0x14, 0x08, 0x03, 0x80, 0x3f, 0x08, 0x1f, 0x3f, 0x3f, 0x3b, 0x3f,
+  0x3b, 0x3b, 0x3f, 0x3f, 0x92, 0x00, 0x01, 0x37, 0x37, 0x83, 0x3f, 0x0e, 0x3e, 0x38, 0x05, 0x02,
+  0x08, 0x15, 0x00, 0x08, 0x03, 0x01, 0x14, 0x0a, 0x21, 0x01, 0x10, 0x8b, 0x00, 0x02, 0x01, 0x3f,
+  0x29, 0x84, 0x09, 0x08, 0x0d, 0x09, 0x09, 0x0f, 0x2b, 0x3f, 0x1f, 0x2f, 0x39, 0xbd, 0x3f, 0x00,
+  0x37, 0x82, 0x36, 0x01, 0x16, 0x32, 0x80, 0x36, 0x24, 0x16, 0x32, 0x34, 0x16, 0x10, 0x38, 0x07,
+  0x02, 0x22, 0x0c, 0x18, 0x22, 0x21, 0x14, 0x01, 0x04, 0x15, 0x04, 0x08, 0x05, 0x14, 0x1c, 0x11,
+  0x21, 0x00, 0x07, 0x02, 0x00, 0x2a, 0x00, 0x28, 0x10, 0x07, 0x05, 0x00, 0x10, 0x2f, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0x00, 0x0a, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x07, 0x3f, 0x3f, 0x27,
+  0x81, 0x3c, 0x04, 0x35, 0x34, 0x00, 0x08, 0x00, 0x80, 0x01, 0x81, 0x00, 0x10, 0x08, 0x00, 0x00,
+  0x03, 0x3f, 0x3b, 0x3f, 0x1f, 0x3f, 0x3b, 0x3b, 0x3f, 0x3f, 0x38, 0x3f, 0x3b, 0x3b, 0x92, 0x00,
+  0x05, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x0b, 0x20, 0x0a, 0x01, 0x21, 0x00, 0x0e,
+  0x08, 0x28, 0x05, 0x01, 0x00, 0x0a, 0x8c, 0x00, 0x01, 0x0f, 0x3f, 0x84, 0x09, 0x00, 0x0d, 0x81,
+  0x09, 0x02, 0x0f, 0x1d, 0x39, 0xbe, 0x3f, 0x01, 0x37, 0x3e, 0x80, 0x3f, 0x2c, 0x32, 0x36, 0x16,
+  0x36, 0x37, 0x36, 0x36, 0x16, 0x36, 0x16, 0x32, 0x32, 0x36, 0x02, 0x30, 0x22, 0x0e, 0x06, 0x06,
+  0x1c, 0x1a, 0x2a, 0x0e, 0x10, 0x2a, 0x02, 0x23, 0x22, 0x0c, 0x03, 0x20, 0x1c, 0x15, 0x10, 0x28,
+  0x3d, 0x10, 0x2a, 0x2a, 0x28, 0x38, 0x02, 0x2a, 0x28, 0x3f, 0x82, 0x00, 0x01, 0x08, 0x08, 0x82,
+  0x00, 0x0b, 0x01, 0x00, 0x00, 0x3f, 0x38, 0x3c, 0x3e, 0x3e, 0x2e, 0x2e, 0x3c, 0x3c, 0x80, 0x00,
+  0x0b, 0x08, 0x10, 0x08, 0x01, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1f, 0x3b, 0x80, 0x3f, 0x00,
+  0x3b, 0x80, 0x3f, 0x04, 0x1f, 0x3b, 0x3f, 0x3f, 0x38, 0x92, 0x00, 0x84, 0x3f, 0x0e, 0x3e, 0x3f,
+  0x38, 0x01, 0x01, 0x10, 0x2a, 0x08, 0x01, 0x10, 0x0a, 0x00, 0x11, 0x04, 0x08, 0x8a, 0x00, 0x02,
+  0x0f, 0x3f, 0x3d, 0x80, 0x09, 0x00, 0x0d, 0x82, 0x09, 0x00, 0x19, 0x80, 0x09, 0x04, 0x2b, 0x3f,
+  0x2f, 0x0f, 0x0f, 0xbd, 0x3f, 0x80, 0x3e, 0x80, 0x36, 0x1c, 0x16, 0x16, 0x32, 0x36, 0x32, 0x32,
+  0x36, 0x16, 0x14, 0x16, 0x14, 0x1c, 0x1c, 0x14, 0x1c, 0x1c, 0x15, 0x14, 0x1c, 0x15, 0x07, 0x00,
+  0x38, 0x1c, 0x15, 0x10, 0x38, 0x07, 0x02, 0x80, 0x2a, 0x80, 0x23, 0x00, 0x04, 0x80, 0x1c, 0x16,
+  0x15, 0x17, 0x38, 0x00, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x03, 0x34, 0x3f, 0x35, 0x2e, 0x81, 0x3c, 0x81, 0x00, 0x01, 0x08, 0x03, 0x81, 0x00,
+  0x09, 0x01, 0x00, 0x01, 0x3f, 0x3f, 0x3b, 0x3b, 0x3f, 0x3f, 0x3b, 0x80, 0x3f, 0x03, 0x1f, 0x3b,
+  0x3f, 0x08, 0x91, 0x00, 0x15, 0x05, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x20,
+  0x0e, 0x00, 0x08, 0x01, 0x06, 0x08, 0x21, 0x01, 0x21, 0x04, 0x08, 0x8a, 0x00, 0x80, 0x3f, 0x00,
+  0x0f, 0x82, 0x09, 0x00, 0x0d, 0x81, 0x09, 0x08, 0x0d, 0x09, 0x09, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f,
+  0x0f, 0xba, 0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x16, 0x16, 0x1e, 0x36, 0x32, 0x36, 0x32,
+  0x36, 0x36, 0x16, 0x32, 0x36, 0x32, 0x36, 0x06, 0x17, 0x15, 0x17, 0x17, 0x3a, 0x3f, 0x23, 0x23,
+  0x22, 0x84, 0x0e, 0x07, 0x05, 0x15, 0x07, 0x07, 0x1c, 0x1d, 0x15, 0x33, 0x82, 0x23, 0x00, 0x38,
+  0x83, 0x00, 0x02, 0x01, 0x00, 0x08, 0x80, 0x00, 0x08, 0x01, 0x00, 0x08, 0x00, 0x05, 0x3e, 0x2e,
+  0x3e, 0x2e, 0x80, 0x3c, 0x19, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x07, 0x1f, 0x3f, 0x3f, 0x1f, 0x3b, 0x3f, 0x3b, 0x3f, 0x1f, 0x3b, 0x3f, 0x3f, 0x92,
+  0x00, 0x05, 0x02, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x81, 0x3f, 0x0a, 0x38, 0x00, 0x08, 0x28, 0x1c,
+  0x01, 0x03, 0x01, 0x30, 0x0a, 0x08, 0x89, 0x00, 0x00, 0x01, 0x80, 0x3f, 0x04, 0x1d, 0x3b, 0x39,
+  0x09, 0x29, 0x88, 0x09, 0x05, 0x39, 0x3d, 0x39, 0x3f, 0x3f, 0x1d, 0xbc, 0x3f, 0x80, 0x37, 0x09,
+  0x36, 0x36, 0x16, 0x36, 0x32, 0x36, 0x32, 0x36, 0x32, 0x36, 0x81, 0x16, 0x08, 0x0e, 0x33, 0x35,
+  0x31, 0x37, 0x23, 0x37, 0x15, 0x15, 0x80, 0x31, 0x1a, 0x33, 0x2e, 0x1c, 0x1d, 0x1e, 0x0e, 0x1f,
+  0x3c, 0x3f, 0x37, 0x0e, 0x0f, 0x15, 0x3a, 0x2f, 0x1c, 0x3f, 0x28, 0x00, 0x00, 0x08, 0x08, 0x01,
+  0x00, 0x08, 0x00, 0x01, 0x81, 0x00, 0x05, 0x01, 0x00, 0x00, 0x07, 0x35, 0x3e, 0x81, 0x2e, 0x00,
+  0x2c, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x07, 0x08, 0x00, 0x00, 0x01, 0x10, 0x08, 0x00, 0x2b,
+  0x83, 0x3f, 0x04, 0x3b, 0x3f, 0x07, 0x3f, 0x1a, 0x91, 0x00, 0x01, 0x08, 0x0f, 0x83, 0x3f, 0x0b,
+  0x3e, 0x3f, 0x37, 0x38, 0x0a, 0x2a, 0x01, 0x01, 0x10, 0x20, 0x08, 0x01, 0x89, 0x00, 0x00, 0x01,
+  0x81, 0x3f, 0x03, 0x2f, 0x3f, 0x0f, 0x2b, 0x8a, 0x09, 0x03, 0x0f, 0x3b, 0x3f, 0x39, 0xbd, 0x3f,
+  0x00, 0x37, 0x80, 0x3f, 0x2a, 0x37, 0x16, 0x36, 0x32, 0x36, 0x32, 0x36, 0x32, 0x36, 0x32, 0x36,
+  0x16, 0x32, 0x36, 0x32, 0x2e, 0x3a, 0x3e, 0x3f, 0x3e, 0x39, 0x37, 0x33, 0x37, 0x17, 0x37, 0x2f,
+  0x33, 0x2f, 0x3a, 0x3c, 0x3f, 0x3c, 0x3b, 0x3f, 0x1f, 0x3f, 0x35, 0x3b, 0x3f, 0x3c, 0x3b, 0x3f,
+  0x80, 0x00, 0x00, 0x04, 0x82, 0x00, 0x03, 0x08, 0x01, 0x00, 0x08, 0x80, 0x00, 0x19, 0x08, 0x27,
+  0x3e, 0x3c, 0x3d, 0x37, 0x27, 0x27, 0x30, 0x00, 0x08, 0x01, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x02, 0x3f, 0x1f, 0x81, 0x3b, 0x04, 0x3f, 0x3f, 0x1f, 0x1f, 0x38,
+  0x91, 0x00, 0x05, 0x08, 0x07, 0x3e, 0x3f, 0x3f, 0x37, 0x82, 0x3f, 0x07, 0x38, 0x21, 0x01, 0x00,
+  0x1c, 0x01, 0x01, 0x03, 0x8b, 0x00, 0x82, 0x3f, 0x06, 0x0f, 0x3b, 0x3d, 0x39, 0x19, 0x09, 0x19,
+  0x85, 0x09, 0x03, 0x0d, 0x09, 0x1d, 0x39, 0xbb, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x80, 0x37, 0x0d,
+  0x3e, 0x3e, 0x16, 0x36, 0x32, 0x36, 0x32, 0x36, 0x16, 0x16, 0x32, 0x36, 0x16, 0x32, 0x80, 0x37,
+  0x0f, 0x3f, 0x33, 0x3f, 0x37, 0x3b, 0x2f, 0x2a, 0x3d, 0x1f, 0x37, 0x3f, 0x37, 0x2f, 0x3b, 0x3d,
+  0x1f, 0x82, 0x3f, 0x01, 0x3e, 0x2f, 0x80, 0x3f, 0x03, 0x00, 0x00, 0x08, 0x01, 0x81, 0x00, 0x01,
+  0x08, 0x03, 0x80, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x27, 0x3f, 0x27, 0x27, 0x35, 0x35,
+  0x30, 0x08, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x81, 0x00, 0x05, 0x01, 0x00, 0x00, 0x1f,
+  0x3f, 0x1f, 0x80, 0x3f, 0x00, 0x3b, 0x80, 0x3f, 0x00, 0x18, 0x8f, 0x00, 0x80, 0x01, 0x00, 0x07,
+  0x81, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x06, 0x38, 0x18, 0x07, 0x01, 0x01, 0x15, 0x02, 0x8c, 0x00,
+  0x0a, 0x07, 0x3f, 0x3f, 0x39, 0x3f, 0x3d, 0x3d, 0x3b, 0x29, 0x09, 0x0d, 0x81, 0x09, 0x03, 0x0d,
+  0x09, 0x09, 0x0d, 0x80, 0x09, 0x05, 0x2b, 0x3d, 0x39, 0x3d, 0x1f, 0x3d, 0xb9, 0x3f, 0x00, 0x37,
+  0x80, 0x3f, 0x17, 0x3e, 0x3f, 0x37, 0x36, 0x32, 0x3e, 0x32, 0x3e, 0x16, 0x36, 0x32, 0x36, 0x32,
+  0x36, 0x16, 0x32, 0x32, 0x3e, 0x3e, 0x3f, 0x37, 0x3f, 0x3e, 0x3e, 0x82, 0x3f, 0x01, 0x3b, 0x3e,
+  0x89, 0x3f, 0x07, 0x39, 0x00, 0x00, 0x05, 0x00, 0x21, 0x00, 0x08, 0x80, 0x00, 0x15, 0x01, 0x00,
+  0x08, 0x00, 0x00, 0x08, 0x00, 0x3f, 0x3c, 0x3c, 0x3e, 0x3e, 0x2e, 0x3c, 0x38, 0x00, 0x08, 0x08,
+  0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x0f, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x1f, 0x3f, 0x3f,
+  0x1f, 0x3b, 0x3f, 0x3f, 0x1f, 0x1f, 0x28, 0x8f, 0x00, 0x80, 0x01, 0x03, 0x07, 0x3f, 0x3f, 0x37,
+  0x80, 0x3f, 0x06, 0x3e, 0x3f, 0x37, 0x3f, 0x01, 0x00, 0x0e, 0x90, 0x00, 0x81, 0x3f, 0x04, 0x1f,
+  0x3b, 0x3d, 0x1f, 0x29, 0x80, 0x09, 0x00, 0x19, 0x81, 0x09, 0x00, 0x0b, 0x80, 0x09, 0x05, 0x0b,
+  0x2b, 0x3f, 0x1f, 0x3f, 0x3b, 0xbb, 0x3f, 0x1c, 0x3e, 0x3f, 0x3f, 0x37, 0x3e, 0x3a, 0x36, 0x16,
+  0x36, 0x16, 0x32, 0x32, 0x36, 0x32, 0x36, 0x32, 0x36, 0x16, 0x37, 0x37, 0x3f, 0x37, 0x3f, 0x37,
+  0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x8d, 0x3f, 0x00, 0x38, 0x85, 0x00, 0x12, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x07, 0x3e, 0x3f, 0x3e, 0x2f, 0x25, 0x35, 0x35, 0x30, 0x08, 0x10, 0x82,
+  0x00, 0x02, 0x01, 0x00, 0x08, 0x80, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x3f, 0x1f, 0x1f, 0x3f, 0x1f,
+  0x3b, 0x3b, 0x3f, 0x3f, 0x10, 0x8e, 0x00, 0x0a, 0x01, 0x08, 0x0a, 0x08, 0x3f, 0x3e, 0x3f, 0x3f,
+  0x3e, 0x3f, 0x3e, 0x81, 0x3f, 0x93, 0x00, 0x80, 0x3f, 0x05, 0x3d, 0x3f, 0x0f, 0x2b, 0x3d, 0x19,
+  0x89, 0x09, 0x04, 0x0d, 0x1d, 0x39, 0x3d, 0x39, 0xbb, 0x3f, 0x1a, 0x37, 0x3f, 0x3f, 0x37, 0x3f,
+  0x37, 0x3f, 0x16, 0x36, 0x16, 0x32, 0x36, 0x3e, 0x32, 0x36, 0x16, 0x16, 0x32, 0x36, 0x16, 0x16,
+  0x1e, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x90, 0x3f, 0x19, 0x38, 0x00, 0x00, 0x08, 0x08, 0x0c, 0x08,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x11, 0x00, 0x27, 0x3f, 0x2f, 0x27, 0x3c, 0x3e,
+  0x3e, 0x2e, 0x28, 0x80, 0x01, 0x03, 0x00, 0x08, 0x00, 0x01, 0x80, 0x00, 0x01, 0x08, 0x01, 0x80,
+  0x00, 0x0a, 0x08, 0x03, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f, 0x38, 0x3b, 0x3f, 0x08, 0x8e, 0x00, 0x04,
+  0x08, 0x01, 0x01, 0x00, 0x37, 0x81, 0x3f, 0x00, 0x3d, 0x81, 0x3f, 0x01, 0x37, 0x38, 0x92, 0x00,
+  0x00, 0x01, 0x82, 0x3f, 0x02, 0x3d, 0x3b, 0x2f, 0x80, 0x09, 0x00, 0x29, 0x86, 0x09, 0x02, 0x0b,
+  0x2f, 0x3b, 0xc0, 0x3f, 0x06, 0x37, 0x3f, 0x37, 0x3e, 0x16, 0x32, 0x36, 0x80, 0x16, 0x0b, 0x17,
+  0x32, 0x37, 0x16, 0x32, 0x36, 0x36, 0x3f, 0x37, 0x3f, 0x1f, 0x3e, 0x91, 0x3f, 0x04, 0x18, 0x00,
+  0x01, 0x22, 0x04, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x0d, 0x01, 0x00, 0x08, 0x3f, 0x37, 0x37,
+  0x3e, 0x2f, 0x35, 0x2e, 0x3c, 0x38, 0x00, 0x08, 0x83, 0x00, 0x01, 0x08, 0x08, 0x80, 0x00, 0x00,
+  0x01, 0x80, 0x00, 0x07, 0x1f, 0x3f, 0x3f, 0x1f, 0x1f, 0x01, 0x3f, 0x3b, 0x8e, 0x00, 0x10, 0x08,
+  0x08, 0x18, 0x08, 0x08, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x30,
+  0x80, 0x04, 0x90, 0x00, 0x07, 0x3f, 0x3f, 0x0f, 0x39, 0x3f, 0x1f, 0x3d, 0x1f, 0x8a, 0x09, 0x05,
+  0x0f, 0x1d, 0x3d, 0x3b, 0x2f, 0x1d, 0xbb, 0x3f, 0x03, 0x3e, 0x3f, 0x3f, 0x37, 0x80, 0x3e, 0x08,
+  0x16, 0x32, 0x36, 0x32, 0x36, 0x36, 0x16, 0x32, 0x36, 0x81, 0x16, 0x05, 0x3a, 0x3e, 0x3e, 0x3f,
+  0x3f, 0x3e, 0x8f, 0x3f, 0x80, 0x00, 0x07, 0x01, 0x00, 0x08, 0x01, 0x00, 0x08, 0x00, 0x01, 0x81,
+  0x00, 0x23, 0x01, 0x06, 0x3f, 0x3d, 0x3e, 0x2f, 0x37, 0x2e, 0x3e, 0x2e, 0x08, 0x01, 0x00, 0x18,
+  0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0x00, 0x08, 0x00, 0x08, 0x01, 0x00, 0x07, 0x1f,
+  0x1f, 0x3b, 0x20, 0x00, 0x3b, 0x3f, 0x8d, 0x00, 0x82, 0x01, 0x05, 0x00, 0x3f, 0x37, 0x3f, 0x3f,
+  0x3e, 0x83, 0x3f, 0x03, 0x38, 0x00, 0x20, 0x20, 0x90, 0x00, 0x00, 0x07, 0x81, 0x3f, 0x03, 0x2b,
+  0x2b, 0x3d, 0x1d, 0x8a, 0x09, 0x02, 0x0f, 0x1f, 0x0f, 0xc1, 0x3f, 0x16, 0x37, 0x3f, 0x37, 0x36,
+  0x16, 0x32, 0x36, 0x16, 0x16, 0x32, 0x36, 0x16, 0x37, 0x16, 0x16, 0x32, 0x37, 0x3e, 0x3f, 0x3e,
+  0x3f, 0x3f, 0x3e, 0x8e, 0x3f, 0x08, 0x00, 0x01, 0x07, 0x00, 0x23, 0x04, 0x06, 0x00, 0x01, 0x80,
+  0x00, 0x0f, 0x08, 0x00, 0x01, 0x00, 0x07, 0x3f, 0x37, 0x3f, 0x3e, 0x2e, 0x3d, 0x35, 0x37, 0x20,
+  0x18, 0x01, 0x83, 0x00, 0x02, 0x18, 0x08, 0x08, 0x82, 0x00, 0x09, 0x08, 0x00, 0x3f, 0x19, 0x04,
+  0x24, 0x24, 0x3f, 0x1f, 0x18, 0x8c, 0x00, 0x81, 0x08, 0x01, 0x00, 0x00, 0x80, 0x3f, 0x05, 0x3e,
+  0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x00, 0x04, 0x93, 0x00, 0x80, 0x3f, 0x05, 0x3b, 0x3f,
+  0x3f, 0x0f, 0x39, 0x19, 0x86, 0x09, 0x07, 0x39, 0x09, 0x09, 0x0f, 0x2b, 0x3f, 0x0f, 0x3b, 0xba,
+  0x3f, 0x08, 0x3e, 0x3f, 0x3f, 0x37, 0x37, 0x3f, 0x3e, 0x3f, 0x17, 0x80, 0x32, 0x02, 0x36, 0x16,
+  0x16, 0x81, 0x32, 0x07, 0x36, 0x16, 0x32, 0x3f, 0x37, 0x37, 0x1e, 0x3e, 0x8b, 0x3f, 0x13, 0x3a,
+  0x04, 0x04, 0x34, 0x35, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x39, 0x00, 0x08, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x80, 0x3f, 0x0a, 0x37, 0x27, 0x3d, 0x37, 0x37, 0x2e, 0x08, 0x01, 0x00, 0x08,
+  0x01, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x80, 0x00, 0x02, 0x08, 0x00, 0x08, 0x80, 0x00, 0x04,
+  0x25, 0x20, 0x1f, 0x1f, 0x28, 0x8b, 0x00, 0x09, 0x01, 0x00, 0x08, 0x11, 0x01, 0x00, 0x07, 0x3f,
+  0x3f, 0x37, 0x84, 0x3f, 0x01, 0x37, 0x3f, 0x80, 0x20, 0x91, 0x00, 0x80, 0x3f, 0x05, 0x3d, 0x3f,
+  0x0f, 0x3d, 0x1f, 0x29, 0x8a, 0x09, 0x04, 0x3f, 0x0f, 0x3f, 0x2f, 0x3d, 0xbe, 0x3f, 0x07, 0x37,
+  0x3f, 0x37, 0x3e, 0x36, 0x3e, 0x16, 0x16, 0x80, 0x32, 0x02, 0x36, 0x16, 0x36, 0x80, 0x16, 0x07,
+  0x32, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x87, 0x3f, 0x01, 0x3c, 0x05, 0x81, 0x3f, 0x17,
+  0x37, 0x2f, 0x37, 0x3d, 0x3e, 0x3c, 0x3e, 0x01, 0x10, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x3f,
+  0x37, 0x2f, 0x3f, 0x3f, 0x37, 0x3c, 0x3c, 0x3e, 0x82, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x02, 0x08, 0x08, 0x00, 0x01, 0x00, 0x00, 0x08, 0x82, 0x00, 0x03, 0x24, 0x1f, 0x1f, 0x18, 0x8b,
+  0x00, 0x82, 0x08, 0x01, 0x00, 0x06, 0x82, 0x3f, 0x02, 0x37, 0x3f, 0x3e, 0x81, 0x3f, 0x01, 0x38,
+  0x20, 0x92, 0x00, 0x02, 0x07, 0x3f, 0x3d, 0x80, 0x3f, 0x04, 0x0f, 0x39, 0x39, 0x09, 0x0b, 0x88,
+  0x09, 0x04, 0x0f, 0x3b, 0x2b, 0x3f, 0x1f, 0xbb, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x15, 0x37, 0x3f,
+  0x37, 0x3a, 0x32, 0x36, 0x3a, 0x32, 0x36, 0x16, 0x32, 0x36, 0x12, 0x32, 0x36, 0x16, 0x16, 0x32,
+  0x3e, 0x3f, 0x3f, 0x37, 0x89, 0x3f, 0x29, 0x06, 0x3f, 0x37, 0x27, 0x35, 0x3e, 0x2f, 0x37, 0x2e,
+  0x3f, 0x35, 0x3f, 0x3f, 0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x07, 0x3f, 0x3f, 0x37, 0x3e,
+  0x3c, 0x3f, 0x27, 0x3f, 0x27, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08,
+  0x0a, 0x81, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x02, 0x07, 0x3f, 0x38, 0x8b, 0x00, 0x06,
+  0x08, 0x0a, 0x08, 0x08, 0x00, 0x00, 0x05, 0x80, 0x3f, 0x03, 0x3e, 0x3f, 0x3f, 0x37, 0x81, 0x3f,
+  0x01, 0x37, 0x3c, 0x93, 0x00, 0x08, 0x07, 0x3f, 0x3f, 0x3b, 0x3f, 0x0f, 0x39, 0x3f, 0x0f, 0x80,
+  0x09, 0x00, 0x0b, 0x86, 0x09, 0x05, 0x0d, 0x1d, 0x3f, 0x3d, 0x3f, 0x1f, 0xbc, 0x3f, 0x08, 0x37,
+  0x3f, 0x3f, 0x37, 0x3f, 0x37, 0x36, 0x16, 0x16, 0x82, 0x32, 0x01, 0x36, 0x1e, 0x80, 0x16, 0x07,
+  0x17, 0x37, 0x3a, 0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x85, 0x3f, 0x0e, 0x38, 0x3d, 0x37, 0x2e, 0x3f,
+  0x2e, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x35, 0x35, 0x30, 0x81, 0x00, 0x02, 0x08, 0x00, 0x07,
+  0x80, 0x3f, 0x05, 0x3d, 0x3f, 0x3e, 0x3d, 0x37, 0x35, 0x82, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00,
+  0x08, 0x81, 0x00, 0x01, 0x08, 0x08, 0x82, 0x00, 0x02, 0x0f, 0x1f, 0x3b, 0x8a, 0x00, 0x82, 0x08,
+  0x04, 0x00, 0x02, 0x06, 0x3f, 0x37, 0x83, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x93, 0x00, 0x00, 0x07,
+  0x83, 0x3f, 0x02, 0x1d, 0x3b, 0x29, 0x89, 0x09, 0x05, 0x0b, 0x2b, 0x39, 0x3b, 0x3f, 0x2f, 0xbe,
+  0x3f, 0x04, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x80, 0x32, 0x01, 0x36, 0x17, 0x80, 0x32, 0x0d, 0x36,
+  0x16, 0x16, 0x32, 0x32, 0x33, 0x37, 0x37, 0x3f, 0x1f, 0x37, 0x3f, 0x3f, 0x37, 0x83, 0x3f, 0x23,
+  0x24, 0x3e, 0x2f, 0x37, 0x27, 0x37, 0x3e, 0x2f, 0x3c, 0x3e, 0x3d, 0x3c, 0x3f, 0x37, 0x28, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x35, 0x3e, 0x3d, 0x37, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x81, 0x00, 0x80, 0x08, 0x05, 0x01, 0x00, 0x08, 0x00, 0x00, 0x11, 0x83,
+  0x00, 0x02, 0x03, 0x3b, 0x3f, 0x89, 0x00, 0x80, 0x01, 0x13, 0x00, 0x08, 0x00, 0x00, 0x10, 0x07,
+  0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x20, 0x92, 0x00,
+  0x00, 0x07, 0x80, 0x3f, 0x07, 0x39, 0x3f, 0x0f, 0x2b, 0x3d, 0x19, 0x09, 0x0d, 0x88, 0x09, 0x01,
+  0x1d, 0x1f, 0xa0, 0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x00, 0x37, 0x86, 0x3f, 0x00, 0x3e, 0x86, 0x3f,
+  0x04, 0x37, 0x37, 0x3f, 0x37, 0x37, 0x80, 0x3e, 0x01, 0x32, 0x37, 0x84, 0x16, 0x00, 0x1e, 0x80,
+  0x16, 0x24, 0x37, 0x33, 0x37, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x37, 0x3f, 0x38,
+  0x3f, 0x37, 0x37, 0x2f, 0x3e, 0x2f, 0x27, 0x3e, 0x3f, 0x3d, 0x3e, 0x3f, 0x3c, 0x3f, 0x30, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x3f, 0x37, 0x82, 0x3f, 0x02, 0x35, 0x37, 0x2e, 0x82, 0x00, 0x80,
+  0x08, 0x80, 0x00, 0x09, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x08, 0x80, 0x00,
+  0x03, 0x07, 0x1f, 0x3b, 0x38, 0x89, 0x00, 0x07, 0x08, 0x18, 0x08, 0x08, 0x00, 0x00, 0x02, 0x07,
+  0x83, 0x3f, 0x00, 0x37, 0x81, 0x3f, 0x02, 0x3e, 0x3f, 0x38, 0x92, 0x00, 0x00, 0x07, 0x81, 0x3f,
+  0x04, 0x3d, 0x3f, 0x1f, 0x2b, 0x39, 0x82, 0x09, 0x00, 0x19, 0x80, 0x09, 0x00, 0x0b, 0x80, 0x09,
+  0x04, 0x2b, 0x3d, 0x1d, 0x15, 0x3b, 0x85, 0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x00, 0x37, 0x80, 0x3f,
+  0x00, 0x37, 0x86, 0x3f, 0x00, 0x26, 0x85, 0x3f, 0x01, 0x3e, 0x2e, 0x85, 0x3f, 0x01, 0x3e, 0x3c,
+  0x86, 0x3f, 0x01, 0x37, 0x36, 0x80, 0x3f, 0x07, 0x37, 0x3f, 0x37, 0x1e, 0x32, 0x32, 0x36, 0x16,
+  0x83, 0x32, 0x08, 0x36, 0x16, 0x12, 0x3e, 0x3f, 0x3f, 0x33, 0x3f, 0x3e, 0x80, 0x3f, 0x12, 0x37,
+  0x37, 0x3b, 0x26, 0x3e, 0x2e, 0x2f, 0x36, 0x2f, 0x37, 0x3e, 0x3d, 0x3f, 0x3e, 0x3f, 0x3f, 0x37,
+  0x3c, 0x39, 0x81, 0x00, 0x10, 0x01, 0x07, 0x3f, 0x3f, 0x3e, 0x2f, 0x3e, 0x2e, 0x3c, 0x3f, 0x2f,
+  0x37, 0x00, 0x08, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02, 0x08, 0x08, 0x01, 0x83, 0x00, 0x02, 0x08,
+  0x00, 0x08, 0x81, 0x00, 0x03, 0x03, 0x3d, 0x1f, 0x39, 0x88, 0x00, 0x80, 0x08, 0x09, 0x0a, 0x00,
+  0x00, 0x02, 0x02, 0x07, 0x37, 0x3e, 0x3f, 0x3e, 0x82, 0x3f, 0x00, 0x37, 0x81, 0x3f, 0x92, 0x00,
+  0x00, 0x07, 0x82, 0x3f, 0x04, 0x17, 0x2f, 0x1f, 0x2f, 0x0b, 0x87, 0x09, 0x07, 0x0b, 0x09, 0x09,
+  0x2b, 0x3f, 0x27, 0x37, 0x2f, 0x84, 0x3f, 0x01, 0x37, 0x37, 0x85, 0x3f, 0x01, 0x37, 0x37, 0x89,
+  0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x00, 0x37, 0x86, 0x3f, 0x01, 0x37, 0x37, 0x85, 0x3f, 0x02, 0x3c,
+  0x3f, 0x3e, 0x80, 0x3f, 0x02, 0x37, 0x3e, 0x3e, 0x81, 0x16, 0x00, 0x17, 0x82, 0x16, 0x1e, 0x12,
+  0x32, 0x36, 0x16, 0x3a, 0x3f, 0x3e, 0x3e, 0x3f, 0x3e, 0x3f, 0x3f, 0x34, 0x3f, 0x34, 0x3f, 0x27,
+  0x3f, 0x35, 0x3f, 0x37, 0x2e, 0x3f, 0x3e, 0x3e, 0x3f, 0x3c, 0x3c, 0x3f, 0x27, 0x3e, 0x80, 0x00,
+  0x02, 0x01, 0x00, 0x07, 0x80, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x02, 0x37, 0x35, 0x3c, 0x80, 0x00,
+  0x03, 0x08, 0x00, 0x00, 0x03, 0x81, 0x00, 0x0a, 0x01, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x02, 0x3b, 0x3f, 0x1b, 0x87, 0x00, 0x81, 0x01, 0x05, 0x00, 0x00,
+  0x02, 0x02, 0x00, 0x17, 0x82, 0x3f, 0x08, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37,
+  0x92, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x08, 0x2f, 0x3f, 0x3f, 0x39, 0x3d, 0x1f, 0x09, 0x09, 0x0b,
+  0x85, 0x09, 0x06, 0x29, 0x09, 0x0b, 0x2f, 0x0f, 0x1c, 0x3b, 0x85, 0x3f, 0x00, 0x3c, 0x86, 0x3f,
+  0x01, 0x3e, 0x2f, 0x80, 0x3f, 0x00, 0x37, 0x86, 0x3f, 0x00, 0x37, 0x86, 0x3f, 0x00, 0x3e, 0x91,
+  0x3f, 0x08, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x3e, 0x86, 0x32, 0x00, 0x36, 0x80,
+  0x16, 0x1c, 0x17, 0x37, 0x37, 0x3f, 0x3b, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x0e, 0x2e, 0x3e, 0x3c,
+  0x3e, 0x3e, 0x2f, 0x37, 0x3d, 0x37, 0x2f, 0x3d, 0x37, 0x3f, 0x37, 0x3f, 0x27, 0x08, 0x01, 0x80,
+  0x00, 0x02, 0x17, 0x3f, 0x37, 0x81, 0x3f, 0x04, 0x27, 0x3d, 0x37, 0x37, 0x08, 0x81, 0x00, 0x05,
+  0x01, 0x00, 0x08, 0x08, 0x00, 0x08, 0x81, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x08, 0x81, 0x00,
+  0x03, 0x3b, 0x3b, 0x3f, 0x08, 0x87, 0x00, 0x04, 0x08, 0x08, 0x01, 0x00, 0x00, 0x80, 0x10, 0x03,
+  0x07, 0x3f, 0x3f, 0x3e, 0x88, 0x3f, 0x00, 0x38, 0x91, 0x00, 0x0a, 0x07, 0x2b, 0x20, 0x00, 0x22,
+  0x20, 0x2f, 0x3f, 0x1f, 0x39, 0x39, 0x83, 0x09, 0x00, 0x0b, 0x83, 0x09, 0x05, 0x0b, 0x3d, 0x3b,
+  0x2f, 0x3f, 0x1f, 0x84, 0x3f, 0x00, 0x37, 0xb8, 0x3f, 0x07, 0x37, 0x3f, 0x37, 0x37, 0x16, 0x32,
+  0x32, 0x36, 0x81, 0x16, 0x01, 0x17, 0x12, 0x81, 0x32, 0x1a, 0x3a, 0x3f, 0x17, 0x37, 0x37, 0x3f,
+  0x3e, 0x3f, 0x31, 0x37, 0x3e, 0x2f, 0x37, 0x3c, 0x3f, 0x37, 0x2e, 0x3e, 0x3f, 0x37, 0x37, 0x3f,
+  0x35, 0x3d, 0x37, 0x37, 0x20, 0x80, 0x00, 0x00, 0x08, 0x80, 0x3f, 0x10, 0x3e, 0x3f, 0x3e, 0x3f,
+  0x3f, 0x37, 0x3d, 0x37, 0x20, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x01, 0x80, 0x00, 0x06,
+  0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x08, 0x83, 0x00, 0x03, 0x3b, 0x3f, 0x3b, 0x18, 0x86, 0x00,
+  0x02, 0x09, 0x03, 0x01, 0x81, 0x00, 0x03, 0x10, 0x02, 0x07, 0x3e, 0x80, 0x3f, 0x0a, 0x37, 0x3f,
+  0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3c, 0x30, 0x92, 0x00, 0x09, 0x34, 0x3f, 0x3e, 0x2f,
+  0x3f, 0x37, 0x3d, 0x39, 0x3f, 0x0f, 0x8a, 0x09, 0x04, 0x0f, 0x1f, 0x2f, 0x3b, 0x2f, 0xc0, 0x3f,
+  0x05, 0x37, 0x3f, 0x17, 0x3e, 0x3f, 0x3f, 0x81, 0x32, 0x00, 0x33, 0x83, 0x32, 0x22, 0x16, 0x16,
+  0x17, 0x37, 0x3e, 0x3f, 0x3f, 0x33, 0x3f, 0x3a, 0x2e, 0x3f, 0x37, 0x37, 0x35, 0x37, 0x3e, 0x2f,
+  0x37, 0x3f, 0x27, 0x3f, 0x3f, 0x37, 0x3f, 0x37, 0x3e, 0x2f, 0x38, 0x00, 0x00, 0x08, 0x05, 0x3f,
+  0x37, 0x80, 0x3f, 0x08, 0x3d, 0x3f, 0x37, 0x3c, 0x3e, 0x2f, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80,
+  0x08, 0x02, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0a, 0x01, 0x00, 0x08, 0x08,
+  0x00, 0x00, 0x1f, 0x0b, 0x3f, 0x0f, 0x08, 0x84, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x08, 0x08, 0x00,
+  0x02, 0x02, 0x00, 0x10, 0x17, 0x84, 0x3f, 0x08, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f,
+  0x2f, 0x8e, 0x00, 0x0c, 0x15, 0x37, 0x3f, 0x3f, 0x3e, 0x2f, 0x3e, 0x3e, 0x0c, 0x3b, 0x3f, 0x1d,
+  0x1f, 0x80, 0x09, 0x00, 0x19, 0x84, 0x09, 0x04, 0x0b, 0x09, 0x09, 0x39, 0x3b, 0xc5, 0x3f, 0x03,
+  0x37, 0x1e, 0x3e, 0x3a, 0x8a, 0x32, 0x28, 0x16, 0x3b, 0x37, 0x17, 0x3f, 0x37, 0x06, 0x3e, 0x3c,
+  0x3d, 0x37, 0x2e, 0x3c, 0x3e, 0x3e, 0x2f, 0x37, 0x3f, 0x35, 0x3f, 0x2f, 0x37, 0x2e, 0x2f, 0x35,
+  0x30, 0x08, 0x00, 0x00, 0x07, 0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x2f, 0x37, 0x3d, 0x37,
+  0x83, 0x00, 0x03, 0x03, 0x00, 0x01, 0x01, 0x80, 0x00, 0x04, 0x08, 0x01, 0x00, 0x08, 0x01, 0x84,
+  0x00, 0x03, 0x07, 0x3f, 0x1f, 0x1b, 0x86, 0x00, 0x80, 0x08, 0x01, 0x00, 0x00, 0x80, 0x10, 0x07,
+  0x00, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x3f, 0x3d, 0x86, 0x3f, 0x02, 0x3e, 0x3f, 0x38, 0x8a, 0x00,
+  0x10, 0x27, 0x3f, 0x3f, 0x3d, 0x37, 0x2e, 0x3f, 0x3e, 0x3d, 0x3f, 0x30, 0x3f, 0x3d, 0x3f, 0x2b,
+  0x09, 0x19, 0x83, 0x09, 0x02, 0x19, 0x09, 0x19, 0x80, 0x09, 0x04, 0x2b, 0x3d, 0x1f, 0x3b, 0x2f,
+  0xbd, 0x3f, 0x0a, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x1e, 0x84, 0x16,
+  0x21, 0x12, 0x32, 0x16, 0x12, 0x32, 0x17, 0x37, 0x3f, 0x37, 0x39, 0x37, 0x37, 0x3e, 0x3e, 0x3f,
+  0x37, 0x3f, 0x35, 0x3f, 0x37, 0x2f, 0x37, 0x3f, 0x37, 0x37, 0x3f, 0x3f, 0x35, 0x3e, 0x3c, 0x00,
+  0x01, 0x00, 0x07, 0x84, 0x3f, 0x04, 0x37, 0x3d, 0x3e, 0x3e, 0x28, 0x81, 0x00, 0x0a, 0x08, 0x00,
+  0x08, 0x08, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x81, 0x00, 0x01, 0x08, 0x01, 0x80, 0x00,
+  0x04, 0x03, 0x3b, 0x3f, 0x39, 0x3b, 0x84, 0x00, 0x0a, 0x08, 0x08, 0x0a, 0x08, 0x00, 0x02, 0x02,
+  0x00, 0x02, 0x00, 0x37, 0x82, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x00, 0x37,
+  0x81, 0x3f, 0x00, 0x30, 0x86, 0x00, 0x12, 0x07, 0x3f, 0x3f, 0x3e, 0x2f, 0x37, 0x3e, 0x3f, 0x3f,
+  0x27, 0x3f, 0x35, 0x35, 0x3f, 0x1f, 0x1d, 0x1f, 0x39, 0x0d, 0x80, 0x09, 0x00, 0x19, 0x85, 0x09,
+  0x05, 0x1d, 0x1f, 0x3b, 0x2f, 0x3f, 0x1f, 0xc1, 0x3f, 0x04, 0x37, 0x37, 0x3f, 0x37, 0x33, 0x82,
+  0x32, 0x03, 0x16, 0x12, 0x32, 0x33, 0x82, 0x32, 0x03, 0x3a, 0x3e, 0x1f, 0x16, 0x81, 0x3e, 0x22,
+  0x2e, 0x3e, 0x2e, 0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x27, 0x37, 0x3e, 0x3d, 0x35,
+  0x00, 0x00, 0x01, 0x3f, 0x37, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x3d, 0x37, 0x35, 0x3d, 0x30,
+  0x08, 0x00, 0x01, 0x80, 0x00, 0x02, 0x01, 0x10, 0x08, 0x81, 0x00, 0x02, 0x08, 0x08, 0x01, 0x81,
+  0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x07, 0x3f, 0x1f, 0x3b, 0x0f, 0x84, 0x00, 0x09, 0x08, 0x08,
+  0x01, 0x00, 0x00, 0x10, 0x00, 0x10, 0x10, 0x00, 0x82, 0x3f, 0x04, 0x37, 0x3f, 0x3f, 0x37, 0x3e,
+  0x80, 0x3f, 0x00, 0x37, 0x84, 0x3f, 0x00, 0x3c, 0x83, 0x00, 0x15, 0x06, 0x3f, 0x3f, 0x37, 0x3e,
+  0x3f, 0x3e, 0x3d, 0x3f, 0x27, 0x37, 0x3f, 0x27, 0x3f, 0x07, 0x3f, 0x2f, 0x3b, 0x2b, 0x29, 0x09,
+  0x19, 0x86, 0x09, 0x05, 0x0b, 0x09, 0x0f, 0x2b, 0x2f, 0x3b, 0xc1, 0x3f, 0x00, 0x3e, 0x80, 0x3f,
+  0x2b, 0x33, 0x3e, 0x3f, 0x37, 0x16, 0x16, 0x12, 0x32, 0x3a, 0x32, 0x32, 0x16, 0x12, 0x32, 0x16,
+  0x12, 0x32, 0x32, 0x37, 0x3a, 0x26, 0x3e, 0x2f, 0x35, 0x37, 0x3e, 0x3f, 0x37, 0x3e, 0x3c, 0x3f,
+  0x37, 0x37, 0x2f, 0x37, 0x3e, 0x3f, 0x3d, 0x35, 0x3e, 0x2e, 0x00, 0x01, 0x02, 0x82, 0x3f, 0x07,
+  0x3e, 0x3f, 0x2f, 0x3e, 0x3d, 0x3e, 0x3e, 0x38, 0x82, 0x00, 0x04, 0x01, 0x00, 0x08, 0x00, 0x08,
+  0x82, 0x00, 0x03, 0x08, 0x01, 0x00, 0x08, 0x82, 0x00, 0x05, 0x03, 0x1f, 0x3b, 0x3f, 0x11, 0x19,
+  0x82, 0x00, 0x03, 0x01, 0x00, 0x18, 0x08, 0x80, 0x00, 0x08, 0x10, 0x10, 0x00, 0x00, 0x3f, 0x3f,
+  0x3e, 0x3f, 0x37, 0x86, 0x3f, 0x05, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x00, 0x38,
+  0x80, 0x00, 0x00, 0x27, 0x82, 0x3f, 0x14, 0x3c, 0x3f, 0x3f, 0x37, 0x3f, 0x2f, 0x2e, 0x3f, 0x37,
+  0x07, 0x3f, 0x3b, 0x2f, 0x39, 0x3b, 0x09, 0x09, 0x0b, 0x09, 0x09, 0x0b, 0x85, 0x09, 0x01, 0x1f,
+  0x3b, 0xc7, 0x3f, 0x09, 0x37, 0x3e, 0x3f, 0x33, 0x32, 0x33, 0x32, 0x32, 0x16, 0x1e, 0x80, 0x16,
+  0x1d, 0x12, 0x32, 0x16, 0x16, 0x17, 0x06, 0x3f, 0x17, 0x33, 0x37, 0x3e, 0x3c, 0x3e, 0x3e, 0x2f,
+  0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3d, 0x3f, 0x3e, 0x3e, 0x3f, 0x35, 0x3c, 0x20, 0x0a, 0x07, 0x80,
+  0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x0a, 0x37, 0x3f, 0x3e, 0x3d, 0x35, 0x00, 0x08, 0x01, 0x00, 0x01,
+  0x01, 0x80, 0x00, 0x15, 0x08, 0x00, 0x08, 0x00, 0x00, 0x01, 0x11, 0x02, 0x08, 0x00, 0x00, 0x01,
+  0x03, 0x00, 0x00, 0x08, 0x04, 0x3b, 0x3f, 0x1f, 0x1d, 0x1b, 0x83, 0x00, 0x80, 0x08, 0x08, 0x00,
+  0x02, 0x10, 0x10, 0x02, 0x00, 0x00, 0x3f, 0x37, 0x81, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x01, 0x37,
+  0x3e, 0x80, 0x3f, 0x00, 0x3e, 0x84, 0x3f, 0x02, 0x37, 0x38, 0x27, 0x80, 0x3f, 0x0c, 0x3e, 0x3e,
+  0x2e, 0x3d, 0x3f, 0x3c, 0x3f, 0x3c, 0x3e, 0x3e, 0x3f, 0x3c, 0x3c, 0x80, 0x3f, 0x02, 0x1f, 0x2f,
+  0x1d, 0x84, 0x09, 0x02, 0x0b, 0x09, 0x0b, 0x81, 0x09, 0x05, 0x39, 0x3d, 0x39, 0x3b, 0x2f, 0x1f,
+  0xc0, 0x3f, 0x16, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x3a, 0x32, 0x32, 0x16, 0x16, 0x12,
+  0x32, 0x16, 0x12, 0x33, 0x32, 0x32, 0x12, 0x32, 0x17, 0x17, 0x80, 0x37, 0x16, 0x17, 0x37, 0x35,
+  0x37, 0x3e, 0x3e, 0x3f, 0x27, 0x37, 0x3f, 0x3f, 0x37, 0x37, 0x2f, 0x3c, 0x3f, 0x37, 0x20, 0x01,
+  0x07, 0x3e, 0x3f, 0x37, 0x82, 0x3f, 0x04, 0x37, 0x35, 0x3e, 0x3f, 0x38, 0x84, 0x00, 0x00, 0x08,
+  0x81, 0x00, 0x03, 0x01, 0x00, 0x00, 0x08, 0x81, 0x00, 0x01, 0x08, 0x01, 0x80, 0x00, 0x05, 0x1f,
+  0x3b, 0x3f, 0x39, 0x15, 0x18, 0x81, 0x00, 0x80, 0x01, 0x04, 0x00, 0x00, 0x10, 0x00, 0x02, 0x80,
+  0x00, 0x84, 0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x84, 0x3f, 0x04, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x83,
+  0x3f, 0x07, 0x3e, 0x2f, 0x3f, 0x3f, 0x3e, 0x3e, 0x3f, 0x3c, 0x80, 0x3f, 0x0d, 0x3e, 0x3f, 0x27,
+  0x3f, 0x3f, 0x1f, 0x2f, 0x1f, 0x0f, 0x19, 0x19, 0x09, 0x09, 0x19, 0x82, 0x09, 0x06, 0x0b, 0x09,
+  0x0b, 0x09, 0x0f, 0x1f, 0x1f, 0xc6, 0x3f, 0x04, 0x37, 0x17, 0x3b, 0x37, 0x3e, 0x80, 0x16, 0x0c,
+  0x12, 0x32, 0x16, 0x12, 0x32, 0x16, 0x12, 0x32, 0x32, 0x12, 0x32, 0x36, 0x1e, 0x80, 0x3e, 0x00,
+  0x3f, 0x80, 0x3e, 0x04, 0x3f, 0x3e, 0x3f, 0x3e, 0x3e, 0x80, 0x3f, 0x05, 0x37, 0x37, 0x27, 0x24,
+  0x04, 0x00, 0x82, 0x3f, 0x12, 0x3e, 0x3f, 0x37, 0x3d, 0x3f, 0x3f, 0x35, 0x3c, 0x00, 0x00, 0x08,
+  0x01, 0x00, 0x08, 0x01, 0x00, 0x00, 0x08, 0x01, 0x82, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x08, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x3b, 0x3f, 0x1f, 0x1f, 0x0b, 0x0f, 0x81, 0x00, 0x80, 0x01, 0x0d,
+  0x00, 0x00, 0x02, 0x10, 0x10, 0x00, 0x00, 0x24, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x83, 0x3f,
+  0x01, 0x37, 0x3e, 0x81, 0x3f, 0x00, 0x3e, 0x84, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x00, 0x3e, 0x80,
+  0x3f, 0x10, 0x3e, 0x3f, 0x3e, 0x2e, 0x2e, 0x2f, 0x3e, 0x0f, 0x3f, 0x39, 0x3f, 0x1f, 0x2b, 0x39,
+  0x09, 0x09, 0x19, 0x80, 0x09, 0x00, 0x19, 0x84, 0x09, 0x03, 0x0f, 0x2f, 0x3f, 0x1f, 0xc1, 0x3f,
+  0x02, 0x37, 0x3f, 0x3e, 0x80, 0x3f, 0x05, 0x3e, 0x3f, 0x17, 0x3f, 0x16, 0x12, 0x83, 0x32, 0x01,
+  0x16, 0x13, 0x80, 0x16, 0x16, 0x12, 0x3e, 0x1e, 0x1e, 0x2a, 0x3e, 0x17, 0x3e, 0x3f, 0x37, 0x37,
+  0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x2e, 0x3f, 0x2f, 0x3e, 0x3d, 0x34, 0x00, 0x81, 0x3f, 0x00, 0x37,
+  0x80, 0x3f, 0x07, 0x3e, 0x3f, 0x35, 0x3f, 0x37, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x08, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x06, 0x0f, 0x3b, 0x3f, 0x1f,
+  0x1d, 0x11, 0x08, 0x80, 0x00, 0x0b, 0x08, 0x08, 0x18, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x04,
+  0x00, 0x3e, 0x83, 0x3f, 0x03, 0x37, 0x3f, 0x3f, 0x3e, 0x80, 0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x83,
+  0x3f, 0x11, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x35, 0x3e, 0x3d, 0x3f, 0x37,
+  0x3f, 0x3f, 0x3e, 0x38, 0x81, 0x3f, 0x03, 0x2b, 0x3b, 0x3f, 0x2b, 0x84, 0x09, 0x0b, 0x19, 0x09,
+  0x09, 0x0b, 0x09, 0x0b, 0x09, 0x1f, 0x1d, 0x3d, 0x3f, 0x1f, 0xc2, 0x3f, 0x21, 0x3e, 0x3f, 0x37,
+  0x3f, 0x3e, 0x3f, 0x37, 0x33, 0x32, 0x32, 0x16, 0x12, 0x33, 0x16, 0x16, 0x12, 0x32, 0x32, 0x12,
+  0x32, 0x16, 0x16, 0x3e, 0x3e, 0x3f, 0x37, 0x3e, 0x3b, 0x27, 0x3e, 0x3f, 0x37, 0x3e, 0x3e, 0x80,
+  0x3f, 0x08, 0x37, 0x37, 0x27, 0x30, 0x24, 0x07, 0x3f, 0x37, 0x3e, 0x80, 0x3f, 0x06, 0x3c, 0x3f,
+  0x3f, 0x3c, 0x3f, 0x35, 0x3f, 0x80, 0x00, 0x01, 0x01, 0x00, 0x80, 0x08, 0x08, 0x00, 0x01, 0x00,
+  0x08, 0x00, 0x08, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x07,
+  0x1f, 0x3b, 0x3f, 0x19, 0x1f, 0x11, 0x80, 0x00, 0x0a, 0x01, 0x00, 0x08, 0x00, 0x02, 0x02, 0x00,
+  0x10, 0x00, 0x04, 0x07, 0x85, 0x3f, 0x00, 0x37, 0x85, 0x3f, 0x04, 0x37, 0x3f, 0x3e, 0x3f, 0x37,
+  0x81, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x16, 0x2f, 0x37, 0x3f, 0x37, 0x3e, 0x3d, 0x3f, 0x37, 0x35,
+  0x3c, 0x27, 0x3f, 0x3f, 0x1f, 0x3f, 0x3f, 0x2f, 0x0f, 0x19, 0x09, 0x0b, 0x09, 0x19, 0x84, 0x09,
+  0x06, 0x29, 0x09, 0x0f, 0x2b, 0x3f, 0x1f, 0x1f, 0x96, 0x3f, 0x00, 0x37, 0x85, 0x3f, 0x01, 0x3e,
+  0x3e, 0x86, 0x3f, 0x00, 0x3e, 0x90, 0x3f, 0x03, 0x37, 0x37, 0x3f, 0x37, 0x81, 0x3f, 0x17, 0x3e,
+  0x3f, 0x37, 0x32, 0x3e, 0x1e, 0x12, 0x32, 0x16, 0x12, 0x32, 0x12, 0x32, 0x32, 0x12, 0x16, 0x12,
+  0x32, 0x12, 0x16, 0x17, 0x33, 0x37, 0x17, 0x80, 0x37, 0x0c, 0x3e, 0x0e, 0x3f, 0x3f, 0x37, 0x3e,
+  0x3e, 0x3d, 0x3e, 0x3d, 0x3c, 0x24, 0x07, 0x82, 0x3f, 0x0c, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f,
+  0x3e, 0x3c, 0x00, 0x01, 0x01, 0x02, 0x08, 0x80, 0x00, 0x00, 0x08, 0x83, 0x00, 0x03, 0x08, 0x00,
+  0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x06, 0x07, 0x3b, 0x3f, 0x1f, 0x1f, 0x11, 0x0b,
+  0x80, 0x00, 0x18, 0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x3e,
+  0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x81, 0x3f, 0x00, 0x37,
+  0x82, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x0b, 0x37, 0x3f, 0x37, 0x2f, 0x3f, 0x3d, 0x3f, 0x3e, 0x3e,
+  0x3d, 0x3f, 0x23, 0x81, 0x3f, 0x05, 0x39, 0x3b, 0x3b, 0x39, 0x39, 0x0b, 0x80, 0x09, 0x0e, 0x19,
+  0x0b, 0x09, 0x09, 0x19, 0x0b, 0x09, 0x09, 0x19, 0x09, 0x0f, 0x1d, 0x3f, 0x3f, 0x3c, 0x87, 0x3f,
+  0x00, 0x37, 0x88, 0x3f, 0x02, 0x3e, 0x37, 0x27, 0x85, 0x3f, 0x01, 0x35, 0x37, 0x85, 0x3f, 0x02,
+  0x36, 0x27, 0x37, 0x85, 0x3f, 0x00, 0x37, 0x86, 0x3f, 0x01, 0x34, 0x3e, 0x81, 0x3f, 0x04, 0x3e,
+  0x3f, 0x37, 0x1e, 0x3e, 0x80, 0x37, 0x0e, 0x17, 0x16, 0x12, 0x32, 0x16, 0x16, 0x12, 0x12, 0x32,
+  0x32, 0x16, 0x12, 0x32, 0x12, 0x32, 0x81, 0x3e, 0x21, 0x3b, 0x37, 0x22, 0x20, 0x20, 0x30, 0x2e,
+  0x05, 0x00, 0x22, 0x2e, 0x0e, 0x20, 0x30, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x3e,
+  0x3f, 0x3e, 0x3c, 0x3d, 0x38, 0x01, 0x00, 0x00, 0x08, 0x00, 0x08, 0x80, 0x00, 0x0b, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x01, 0x80, 0x00, 0x0a, 0x01, 0x00, 0x03,
+  0x3f, 0x1f, 0x3f, 0x1d, 0x0b, 0x39, 0x18, 0x00, 0x80, 0x01, 0x05, 0x00, 0x00, 0x10, 0x10, 0x02,
+  0x00, 0x80, 0x04, 0x81, 0x3f, 0x00, 0x2f, 0x81, 0x3f, 0x00, 0x2f, 0x81, 0x3f, 0x00, 0x3e, 0x83,
+  0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x0a, 0x37, 0x3f, 0x3e, 0x3e, 0x3f, 0x37,
+  0x2f, 0x3d, 0x3e, 0x3c, 0x37, 0x82, 0x3f, 0x06, 0x3d, 0x34, 0x1c, 0x39, 0x09, 0x09, 0x19, 0x85,
+  0x09, 0x08, 0x19, 0x09, 0x0b, 0x2f, 0x3b, 0x3d, 0x3f, 0x27, 0x17, 0x84, 0x3f, 0x02, 0x3e, 0x36,
+  0x2e, 0x89, 0x3f, 0x02, 0x2e, 0x3e, 0x37, 0x84, 0x3f, 0x02, 0x3e, 0x3c, 0x37, 0x85, 0x3f, 0x01,
+  0x37, 0x27, 0x86, 0x3f, 0x00, 0x3e, 0x85, 0x3f, 0x80, 0x37, 0x02, 0x3f, 0x3f, 0x3e, 0x81, 0x3f,
+  0x19, 0x37, 0x36, 0x36, 0x3f, 0x3e, 0x32, 0x1e, 0x16, 0x12, 0x32, 0x12, 0x32, 0x32, 0x16, 0x12,
+  0x32, 0x16, 0x16, 0x12, 0x16, 0x1e, 0x3a, 0x3a, 0x3e, 0x3f, 0x07, 0x81, 0x3f, 0x02, 0x38, 0x00,
+  0x01, 0x80, 0x00, 0x03, 0x04, 0x3f, 0x3f, 0x37, 0x81, 0x3f, 0x0d, 0x3e, 0x3f, 0x3f, 0x3d, 0x3f,
+  0x3e, 0x38, 0x04, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x08, 0x83, 0x00, 0x00, 0x18, 0x82, 0x00, 0x07,
+  0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x81, 0x3b, 0x0a, 0x38, 0x18, 0x39, 0x00, 0x00,
+  0x08, 0x08, 0x00, 0x00, 0x10, 0x02, 0x80, 0x00, 0x01, 0x20, 0x20, 0x80, 0x3f, 0x00, 0x3e, 0x80,
+  0x3f, 0x03, 0x37, 0x3e, 0x3f, 0x3e, 0x82, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x03, 0x37, 0x3f, 0x3f,
+  0x37, 0x80, 0x3f, 0x00, 0x37, 0x84, 0x3f, 0x80, 0x37, 0x00, 0x07, 0x81, 0x3f, 0x07, 0x1f, 0x3b,
+  0x3b, 0x2a, 0x2e, 0x0f, 0x09, 0x19, 0x81, 0x09, 0x02, 0x0b, 0x09, 0x08, 0x80, 0x09, 0x07, 0x0b,
+  0x09, 0x0f, 0x0f, 0x3b, 0x38, 0x3e, 0x3c, 0x85, 0x3f, 0x01, 0x2e, 0x3e, 0x88, 0x3f, 0x02, 0x3e,
+  0x37, 0x37, 0x84, 0x3f, 0x00, 0x3e, 0x80, 0x37, 0x84, 0x3f, 0x02, 0x34, 0x3e, 0x3e, 0x84, 0x3f,
+  0x02, 0x3e, 0x3e, 0x37, 0x84, 0x3f, 0x02, 0x37, 0x26, 0x3c, 0x82, 0x3f, 0x17, 0x3e, 0x3f, 0x37,
+  0x34, 0x37, 0x33, 0x3e, 0x1f, 0x3a, 0x32, 0x16, 0x16, 0x1a, 0x32, 0x12, 0x16, 0x12, 0x32, 0x16,
+  0x12, 0x12, 0x32, 0x32, 0x33, 0x80, 0x37, 0x01, 0x14, 0x1f, 0x81, 0x3f, 0x06, 0x3a, 0x00, 0x00,
+  0x03, 0x01, 0x01, 0x07, 0x80, 0x3f, 0x02, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x14, 0x35, 0x3e, 0x3f,
+  0x35, 0x20, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01,
+  0x00, 0x08, 0x82, 0x00, 0x00, 0x08, 0x81, 0x00, 0x08, 0x02, 0x3f, 0x1f, 0x3f, 0x1f, 0x19, 0x39,
+  0x1b, 0x00, 0x80, 0x01, 0x0d, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x24, 0x04, 0x06, 0x3f, 0x37,
+  0x3f, 0x3f, 0x3e, 0x84, 0x3f, 0x06, 0x37, 0x3e, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x84, 0x3f, 0x0b,
+  0x37, 0x3f, 0x3c, 0x3f, 0x37, 0x3e, 0x2f, 0x35, 0x3f, 0x3f, 0x2e, 0x28, 0x84, 0x3f, 0x0d, 0x2e,
+  0x3c, 0x1d, 0x11, 0x19, 0x09, 0x0b, 0x0b, 0x09, 0x19, 0x09, 0x08, 0x09, 0x19, 0x80, 0x09, 0x06,
+  0x0b, 0x0b, 0x3f, 0x0f, 0x37, 0x27, 0x27, 0x84, 0x3f, 0x00, 0x3e, 0x80, 0x37, 0x83, 0x3f, 0x00,
+  0x3e, 0x81, 0x3f, 0x01, 0x37, 0x34, 0x85, 0x3f, 0x01, 0x37, 0x26, 0x85, 0x3f, 0x01, 0x3e, 0x3e,
+  0x86, 0x3f, 0x01, 0x36, 0x2e, 0x84, 0x3f, 0x80, 0x3e, 0x00, 0x37, 0x83, 0x3f, 0x02, 0x3e, 0x3e,
+  0x3c, 0x81, 0x37, 0x0b, 0x3a, 0x32, 0x12, 0x32, 0x16, 0x16, 0x12, 0x32, 0x16, 0x12, 0x16, 0x16,
+  0x80, 0x12, 0x17, 0x16, 0x3a, 0x3f, 0x16, 0x3e, 0x1e, 0x3a, 0x3e, 0x1e, 0x3f, 0x08, 0x00, 0x08,
+  0x06, 0x00, 0x07, 0x3e, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x08, 0x37, 0x3f,
+  0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x01, 0x80, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x01, 0x00, 0x08,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x01, 0x80, 0x00, 0x16, 0x1f, 0x3b, 0x3b, 0x3f,
+  0x3b, 0x1d, 0x11, 0x39, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x04, 0x04, 0x00,
+  0x3f, 0x3f, 0x3e, 0x80, 0x3f, 0x03, 0x37, 0x3f, 0x3f, 0x3e, 0x86, 0x3f, 0x05, 0x3e, 0x3f, 0x3f,
+  0x37, 0x3f, 0x3e, 0x86, 0x3f, 0x02, 0x3e, 0x20, 0x27, 0x83, 0x3f, 0x07, 0x3b, 0x3f, 0x1f, 0x0e,
+  0x38, 0x3f, 0x09, 0x0b, 0x82, 0x09, 0x0c, 0x0b, 0x09, 0x09, 0x0b, 0x09, 0x19, 0x09, 0x0b, 0x2b,
+  0x3f, 0x3c, 0x3e, 0x3e, 0x85, 0x3f, 0x01, 0x37, 0x37, 0x89, 0x3f, 0x01, 0x35, 0x37, 0x85, 0x3f,
+  0x02, 0x3e, 0x3f, 0x37, 0x8f, 0x3f, 0x01, 0x27, 0x37, 0x85, 0x3f, 0x00, 0x3e, 0x82, 0x3f, 0x00,
+  0x3e, 0x80, 0x3f, 0x80, 0x37, 0x0e, 0x3f, 0x1e, 0x3e, 0x3f, 0x17, 0x16, 0x12, 0x32, 0x16, 0x12,
+  0x16, 0x12, 0x16, 0x12, 0x12, 0x81, 0x32, 0x01, 0x17, 0x30, 0x83, 0x3f, 0x07, 0x3e, 0x38, 0x00,
+  0x00, 0x08, 0x08, 0x3f, 0x37, 0x84, 0x3f, 0x0c, 0x37, 0x3e, 0x3f, 0x3d, 0x30, 0x00, 0x20, 0x00,
+  0x08, 0x03, 0x01, 0x10, 0x01, 0x81, 0x00, 0x03, 0x01, 0x02, 0x01, 0x10, 0x81, 0x00, 0x02, 0x01,
+  0x10, 0x01, 0x82, 0x00, 0x0f, 0x0f, 0x1f, 0x3b, 0x3b, 0x39, 0x11, 0x1d, 0x1b, 0x01, 0x08, 0x08,
+  0x00, 0x10, 0x10, 0x00, 0x00, 0x80, 0x04, 0x00, 0x05, 0x84, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x0c,
+  0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x80, 0x3f, 0x07,
+  0x37, 0x3f, 0x37, 0x2e, 0x25, 0x14, 0x00, 0x00, 0x88, 0x3f, 0x09, 0x31, 0x3f, 0x0f, 0x0b, 0x09,
+  0x09, 0x19, 0x0b, 0x09, 0x0b, 0x83, 0x09, 0x06, 0x19, 0x0d, 0x3f, 0x1f, 0x1f, 0x15, 0x37, 0xbd,
+  0x3f, 0x00, 0x37, 0x85, 0x3f, 0x11, 0x3b, 0x37, 0x3b, 0x37, 0x37, 0x3b, 0x3e, 0x3f, 0x32, 0x12,
+  0x16, 0x12, 0x32, 0x32, 0x12, 0x32, 0x16, 0x16, 0x81, 0x12, 0x02, 0x32, 0x13, 0x37, 0x81, 0x17,
+  0x0e, 0x3a, 0x3f, 0x3f, 0x01, 0x10, 0x20, 0x10, 0x37, 0x3f, 0x37, 0x3e, 0x3e, 0x3f, 0x37, 0x3e,
+  0x81, 0x3f, 0x08, 0x37, 0x39, 0x00, 0x01, 0x20, 0x01, 0x00, 0x08, 0x01, 0x84, 0x00, 0x0a, 0x08,
+  0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 0x00, 0x1c, 0x07, 0x3b, 0x3d,
+  0x1f, 0x3f, 0x1f, 0x0b, 0x07, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x20, 0x20,
+  0x00, 0x37, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x81, 0x3f, 0x00, 0x3e, 0x89, 0x3f,
+  0x02, 0x37, 0x3f, 0x3c, 0x82, 0x00, 0x00, 0x07, 0x84, 0x3f, 0x1b, 0x3b, 0x3f, 0x3f, 0x0f, 0x1f,
+  0x2b, 0x3b, 0x09, 0x09, 0x19, 0x09, 0x09, 0x0b, 0x09, 0x09, 0x0b, 0x09, 0x19, 0x0b, 0x09, 0x09,
+  0x19, 0x19, 0x3f, 0x2f, 0x3f, 0x3f, 0x1f, 0xc3, 0x3f, 0x02, 0x37, 0x3f, 0x37, 0x81, 0x3f, 0x0c,
+  0x37, 0x3f, 0x33, 0x22, 0x32, 0x32, 0x16, 0x12, 0x16, 0x16, 0x12, 0x32, 0x12, 0x80, 0x16, 0x0e,
+  0x12, 0x12, 0x32, 0x3a, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3a, 0x3f, 0x10, 0x00, 0x08, 0x0f, 0x86,
+  0x3f, 0x05, 0x37, 0x3e, 0x3d, 0x3f, 0x00, 0x20, 0x80, 0x00, 0x0b, 0x01, 0x00, 0x08, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x08, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x0f, 0x03, 0x3f,
+  0x1f, 0x3b, 0x3b, 0x39, 0x11, 0x19, 0x1d, 0x01, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x80, 0x20,
+  0x00, 0x03, 0x87, 0x3f, 0x0d, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3e, 0x3f,
+  0x3e, 0x3f, 0x35, 0x87, 0x00, 0x00, 0x07, 0x85, 0x3f, 0x09, 0x3b, 0x3f, 0x3f, 0x3b, 0x3b, 0x2f,
+  0x0b, 0x09, 0x09, 0x19, 0x85, 0x09, 0x06, 0x0b, 0x09, 0x09, 0x3f, 0x1f, 0x1f, 0x3b, 0xc9, 0x3f,
+  0x0b, 0x3e, 0x3f, 0x33, 0x3f, 0x37, 0x38, 0x37, 0x3f, 0x12, 0x32, 0x12, 0x32, 0x80, 0x12, 0x12,
+  0x32, 0x32, 0x12, 0x12, 0x32, 0x32, 0x12, 0x12, 0x32, 0x3b, 0x33, 0x33, 0x3a, 0x3f, 0x37, 0x38,
+  0x00, 0x00, 0x06, 0x81, 0x3e, 0x04, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x09, 0x3c, 0x00,
+  0x01, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x05, 0x01, 0x00, 0x00, 0x01, 0x02,
+  0x01, 0x81, 0x00, 0x02, 0x08, 0x08, 0x01, 0x81, 0x00, 0x00, 0x01, 0x80, 0x3b, 0x12, 0x3f, 0x1f,
+  0x1d, 0x1e, 0x0b, 0x18, 0x08, 0x00, 0x10, 0x10, 0x00, 0x00, 0x04, 0x04, 0x00, 0x04, 0x3f, 0x3f,
+  0x3e, 0x80, 0x3f, 0x01, 0x37, 0x3e, 0x85, 0x3f, 0x00, 0x3e, 0x82, 0x3f, 0x01, 0x3c, 0x20, 0x87,
+  0x00, 0x87, 0x3f, 0x16, 0x3b, 0x39, 0x3f, 0x0f, 0x3b, 0x09, 0x19, 0x19, 0x09, 0x19, 0x19, 0x0b,
+  0x0b, 0x09, 0x19, 0x0b, 0x0b, 0x09, 0x09, 0x0b, 0x2b, 0x3d, 0x3b, 0xc9, 0x3f, 0x00, 0x37, 0x80,
+  0x3f, 0x02, 0x37, 0x1f, 0x16, 0x80, 0x3e, 0x01, 0x12, 0x32, 0x80, 0x16, 0x12, 0x12, 0x12, 0x16,
+  0x16, 0x12, 0x12, 0x02, 0x32, 0x32, 0x17, 0x17, 0x37, 0x3e, 0x3f, 0x3b, 0x3f, 0x3f, 0x00, 0x00,
+  0x82, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x07, 0x2e, 0x3f, 0x37, 0x30, 0x00, 0x00, 0x20, 0x04, 0x80,
+  0x00, 0x02, 0x08, 0x00, 0x01, 0x81, 0x00, 0x03, 0x08, 0x00, 0x08, 0x08, 0x81, 0x00, 0x01, 0x02,
+  0x08, 0x83, 0x00, 0x0d, 0x3f, 0x1f, 0x3b, 0x3b, 0x3f, 0x0b, 0x0b, 0x0e, 0x0b, 0x00, 0x00, 0x02,
+  0x02, 0x00, 0x80, 0x04, 0x06, 0x00, 0x00, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x06, 0x3e,
+  0x3f, 0x3f, 0x37, 0x3f, 0x37, 0x3e, 0x84, 0x3f, 0x01, 0x26, 0x20, 0x86, 0x00, 0x00, 0x07, 0x89,
+  0x3f, 0x05, 0x1f, 0x3b, 0x0f, 0x09, 0x09, 0x0b, 0x84, 0x09, 0x09, 0x19, 0x09, 0x0b, 0x0b, 0x09,
+  0x1f, 0x3b, 0x3d, 0x3f, 0x1f, 0xc5, 0x3f, 0x17, 0x3e, 0x3f, 0x3f, 0x3e, 0x3b, 0x37, 0x3f, 0x3a,
+  0x27, 0x3b, 0x37, 0x17, 0x3f, 0x12, 0x32, 0x12, 0x12, 0x16, 0x16, 0x12, 0x12, 0x16, 0x12, 0x32,
+  0x81, 0x12, 0x07, 0x1e, 0x1f, 0x17, 0x17, 0x37, 0x17, 0x3a, 0x00, 0x82, 0x3e, 0x04, 0x3f, 0x3f,
+  0x37, 0x37, 0x3e, 0x80, 0x3f, 0x09, 0x08, 0x01, 0x20, 0x08, 0x00, 0x08, 0x01, 0x00, 0x00, 0x08,
+  0x81, 0x00, 0x02, 0x08, 0x00, 0x08, 0x80, 0x00, 0x03, 0x01, 0x00, 0x08, 0x01, 0x84, 0x00, 0x0b,
+  0x3b, 0x3b, 0x3f, 0x0f, 0x3b, 0x38, 0x1c, 0x19, 0x19, 0x18, 0x00, 0x02, 0x80, 0x00, 0x03, 0x20,
+  0x20, 0x00, 0x00, 0x86, 0x3f, 0x00, 0x3e, 0x84, 0x3f, 0x05, 0x3e, 0x3f, 0x37, 0x3e, 0x3f, 0x35,
+  0x87, 0x00, 0x86, 0x3f, 0x09, 0x3b, 0x3f, 0x3b, 0x3b, 0x3f, 0x0f, 0x1f, 0x0b, 0x0b, 0x09, 0x81,
+  0x0b, 0x04, 0x09, 0x19, 0x19, 0x09, 0x0b, 0x80, 0x09, 0x06, 0x0f, 0x0f, 0x3f, 0x1f, 0x3f, 0x3f,
+  0x1f, 0xc5, 0x3f, 0x00, 0x3b, 0x80, 0x3f, 0x01, 0x37, 0x26, 0x81, 0x3e, 0x02, 0x33, 0x37, 0x12,
+  0x80, 0x32, 0x06, 0x12, 0x16, 0x12, 0x32, 0x12, 0x12, 0x32, 0x80, 0x16, 0x09, 0x12, 0x37, 0x3e,
+  0x3b, 0x33, 0x3f, 0x3f, 0x02, 0x3f, 0x37, 0x80, 0x3f, 0x07, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x3e,
+  0x3e, 0x3c, 0x81, 0x00, 0x00, 0x28, 0x80, 0x00, 0x03, 0x08, 0x00, 0x08, 0x08, 0x82, 0x00, 0x02,
+  0x08, 0x01, 0x01, 0x81, 0x00, 0x03, 0x01, 0x00, 0x00, 0x08, 0x80, 0x00, 0x0f, 0x0f, 0x3b, 0x3b,
+  0x3f, 0x1f, 0x3b, 0x39, 0x1e, 0x0f, 0x0a, 0x00, 0x10, 0x10, 0x00, 0x04, 0x04, 0x80, 0x00, 0x07,
+  0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x27, 0x81, 0x3f, 0x00, 0x37, 0x86, 0x3f, 0x00, 0x24,
+  0x87, 0x00, 0x89, 0x3f, 0x06, 0x2f, 0x1f, 0x3b, 0x2b, 0x09, 0x19, 0x0b, 0x81, 0x09, 0x04, 0x0b,
+  0x09, 0x09, 0x0b, 0x09, 0x80, 0x0b, 0x01, 0x0f, 0x3b, 0xc5, 0x3f, 0x00, 0x3e, 0x83, 0x3f, 0x13,
+  0x37, 0x3f, 0x3a, 0x17, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x33, 0x37, 0x16, 0x12, 0x1a, 0x16, 0x13,
+  0x32, 0x12, 0x12, 0x32, 0x83, 0x12, 0x0e, 0x17, 0x1e, 0x3f, 0x37, 0x17, 0x07, 0x3e, 0x1f, 0x33,
+  0x37, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x03, 0x38, 0x00, 0x20, 0x08, 0x87, 0x00, 0x04,
+  0x08, 0x00, 0x08, 0x00, 0x01, 0x81, 0x00, 0x01, 0x08, 0x01, 0x84, 0x00, 0x14, 0x07, 0x1d, 0x1f,
+  0x3b, 0x3f, 0x1f, 0x0b, 0x0b, 0x0a, 0x2b, 0x08, 0x00, 0x10, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00,
+  0x3f, 0x37, 0x82, 0x3f, 0x09, 0x27, 0x27, 0x3f, 0x3f, 0x35, 0x3f, 0x3e, 0x3f, 0x37, 0x3e, 0x82,
+  0x3f, 0x00, 0x38, 0x86, 0x00, 0x00, 0x07, 0x87, 0x3f, 0x08, 0x3b, 0x3f, 0x1f, 0x3f, 0x0f, 0x1f,
+  0x0b, 0x09, 0x19, 0x81, 0x0b, 0x04, 0x09, 0x09, 0x0b, 0x09, 0x0b, 0x80, 0x09, 0x05, 0x0f, 0x1f,
+  0x39, 0x3b, 0x3f, 0x1f, 0xc6, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x0b, 0x07, 0x3f, 0x37, 0x3e, 0x1f,
+  0x33, 0x3e, 0x3e, 0x3a, 0x3a, 0x16, 0x16, 0x80, 0x12, 0x06, 0x30, 0x13, 0x12, 0x33, 0x16, 0x12,
+  0x16, 0x80, 0x12, 0x03, 0x33, 0x33, 0x3e, 0x3a, 0x81, 0x37, 0x1a, 0x3e, 0x3f, 0x37, 0x3e, 0x3f,
+  0x3f, 0x37, 0x3e, 0x3f, 0x00, 0x01, 0x00, 0x04, 0x01, 0x04, 0x08, 0x01, 0x00, 0x00, 0x01, 0x10,
+  0x08, 0x08, 0x00, 0x08, 0x00, 0x08, 0x85, 0x00, 0x02, 0x08, 0x00, 0x08, 0x80, 0x00, 0x01, 0x03,
+  0x3f, 0x80, 0x3b, 0x0a, 0x3f, 0x1c, 0x19, 0x39, 0x19, 0x31, 0x02, 0x00, 0x00, 0x20, 0x20, 0x80,
+  0x00, 0x80, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x00, 0x3c, 0x80, 0x24, 0x83, 0x3f, 0x05, 0x3e, 0x3f,
+  0x37, 0x3e, 0x3f, 0x30, 0x86, 0x00, 0x8b, 0x3f, 0x06, 0x1f, 0x3b, 0x2b, 0x09, 0x19, 0x09, 0x19,
+  0x80, 0x09, 0x04, 0x0b, 0x0b, 0x09, 0x0b, 0x09, 0x80, 0x0b, 0x01, 0x0f, 0x39, 0xcd, 0x3f, 0x04,
+  0x3c, 0x37, 0x37, 0x3e, 0x3f, 0x80, 0x37, 0x80, 0x3e, 0x07, 0x3a, 0x12, 0x12, 0x32, 0x32, 0x12,
+  0x32, 0x32, 0x81, 0x12, 0x13, 0x16, 0x12, 0x32, 0x12, 0x17, 0x33, 0x38, 0x3b, 0x33, 0x3e, 0x1f,
+  0x33, 0x3e, 0x1f, 0x3f, 0x37, 0x37, 0x3e, 0x3f, 0x38, 0x83, 0x00, 0x02, 0x04, 0x00, 0x08, 0x81,
+  0x00, 0x01, 0x02, 0x08, 0x82, 0x00, 0x80, 0x08, 0x04, 0x01, 0x00, 0x08, 0x00, 0x01, 0x82, 0x00,
+  0x0c, 0x19, 0x3b, 0x3d, 0x1f, 0x3b, 0x3b, 0x2a, 0x0b, 0x03, 0x0b, 0x00, 0x10, 0x00, 0x80, 0x20,
+  0x0e, 0x00, 0x00, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x27, 0x3f, 0x3f, 0x37,
+  0x86, 0x3f, 0x00, 0x38, 0x85, 0x00, 0x00, 0x07, 0x87, 0x3f, 0x06, 0x3b, 0x3f, 0x3b, 0x39, 0x3f,
+  0x0f, 0x3b, 0x80, 0x0b, 0x00, 0x09, 0x81, 0x19, 0x07, 0x09, 0x0b, 0x09, 0x0b, 0x09, 0x1d, 0x09,
+  0x0f, 0x80, 0x1f, 0x00, 0x3b, 0xa3, 0x3f, 0x00, 0x3e, 0x90, 0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x00,
+  0x37, 0x84, 0x3f, 0x0d, 0x07, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x3e, 0x3a, 0x3f, 0x17, 0x37, 0x37,
+  0x32, 0x32, 0x82, 0x12, 0x02, 0x32, 0x16, 0x16, 0x81, 0x12, 0x03, 0x32, 0x12, 0x1e, 0x3a, 0x81,
+  0x37, 0x07, 0x3e, 0x3f, 0x37, 0x33, 0x3f, 0x3f, 0x37, 0x3e, 0x80, 0x00, 0x03, 0x28, 0x01, 0x20,
+  0x01, 0x82, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02, 0x08, 0x08, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00,
+  0x08, 0x81, 0x00, 0x02, 0x3f, 0x0f, 0x1f, 0x80, 0x3b, 0x08, 0x19, 0x3b, 0x2b, 0x07, 0x08, 0x00,
+  0x00, 0x04, 0x04, 0x80, 0x00, 0x00, 0x37, 0x89, 0x3f, 0x03, 0x3e, 0x3f, 0x37, 0x3e, 0x82, 0x3f,
+  0x00, 0x38, 0x85, 0x00, 0x86, 0x3f, 0x0c, 0x3b, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x1f, 0x1f, 0x09,
+  0x19, 0x09, 0x19, 0x0b, 0x80, 0x09, 0x10, 0x0b, 0x0b, 0x09, 0x0b, 0x09, 0x0b, 0x09, 0x19, 0x1f,
+  0x2f, 0x3f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x3e, 0x94, 0x3f, 0x02, 0x3e, 0x36, 0x37, 0x84, 0x3f,
+  0x02, 0x3e, 0x37, 0x37, 0x85, 0x3f, 0x01, 0x36, 0x36, 0x85, 0x3f, 0x80, 0x37, 0x84, 0x3f, 0x80,
+  0x37, 0x01, 0x3f, 0x37, 0x80, 0x3f, 0x12, 0x3a, 0x3e, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x37, 0x3f,
+  0x37, 0x37, 0x3a, 0x3a, 0x3e, 0x3a, 0x32, 0x16, 0x12, 0x32, 0x82, 0x12, 0x0d, 0x32, 0x16, 0x12,
+  0x12, 0x16, 0x12, 0x12, 0x3e, 0x3a, 0x3b, 0x33, 0x33, 0x37, 0x17, 0x80, 0x3e, 0x01, 0x3f, 0x39,
+  0x83, 0x00, 0x06, 0x04, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x01, 0x00, 0x10, 0x80, 0x00,
+  0x09, 0x01, 0x00, 0x01, 0x01, 0x00, 0x08, 0x00, 0x00, 0x01, 0x01, 0x81, 0x00, 0x82, 0x1f, 0x09,
+  0x3f, 0x39, 0x11, 0x15, 0x19, 0x1b, 0x10, 0x00, 0x20, 0x20, 0x80, 0x00, 0x0b, 0x27, 0x3f, 0x3f,
+  0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x83, 0x3f, 0x04, 0x3e, 0x3f, 0x37, 0x3e,
+  0x3d, 0x84, 0x00, 0x02, 0x07, 0x3f, 0x37, 0x85, 0x3f, 0x02, 0x37, 0x34, 0x3f, 0x81, 0x3b, 0x05,
+  0x39, 0x19, 0x19, 0x0b, 0x09, 0x09, 0x80, 0x19, 0x03, 0x09, 0x0b, 0x09, 0x0b, 0x80, 0x09, 0x03,
+  0x0f, 0x1f, 0x1f, 0x0f, 0x80, 0x3f, 0x80, 0x3e, 0x85, 0x3f, 0x02, 0x3e, 0x37, 0x37, 0x87, 0x3f,
+  0x02, 0x3e, 0x27, 0x2e, 0x84, 0x3f, 0x03, 0x3e, 0x2e, 0x2e, 0x3e, 0x84, 0x3f, 0x02, 0x34, 0x3d,
+  0x37, 0x84, 0x3f, 0x02, 0x37, 0x27, 0x26, 0x84, 0x3f, 0x03, 0x3e, 0x2e, 0x3c, 0x37, 0x81, 0x3f,
+  0x03, 0x3e, 0x07, 0x3f, 0x3e, 0x81, 0x3f, 0x18, 0x3e, 0x3e, 0x3f, 0x37, 0x37, 0x3e, 0x3b, 0x37,
+  0x12, 0x02, 0x12, 0x12, 0x32, 0x16, 0x12, 0x12, 0x32, 0x12, 0x12, 0x13, 0x16, 0x12, 0x12, 0x16,
+  0x13, 0x80, 0x37, 0x07, 0x3e, 0x3f, 0x37, 0x17, 0x3a, 0x3f, 0x37, 0x30, 0x81, 0x00, 0x03, 0x28,
+  0x01, 0x00, 0x04, 0x84, 0x00, 0x03, 0x08, 0x01, 0x00, 0x08, 0x80, 0x00, 0x02, 0x02, 0x00, 0x08,
+  0x81, 0x00, 0x00, 0x18, 0x81, 0x00, 0x03, 0x07, 0x1f, 0x3b, 0x3d, 0x80, 0x1f, 0x07, 0x0b, 0x0b,
+  0x15, 0x19, 0x08, 0x00, 0x04, 0x04, 0x80, 0x00, 0x01, 0x3f, 0x37, 0x81, 0x3f, 0x00, 0x37, 0x82,
+  0x3f, 0x02, 0x3e, 0x3f, 0x3d, 0x85, 0x3f, 0x84, 0x00, 0x02, 0x07, 0x3e, 0x3e, 0x84, 0x3f, 0x07,
+  0x3e, 0x2e, 0x3a, 0x3c, 0x1f, 0x3f, 0x0f, 0x1f, 0x80, 0x0b, 0x0e, 0x08, 0x19, 0x19, 0x0b, 0x09,
+  0x0b, 0x0b, 0x09, 0x19, 0x19, 0x0a, 0x0a, 0x0b, 0x0f, 0x1f, 0x82, 0x3f, 0x03, 0x3c, 0x3c, 0x3e,
+  0x3e, 0x83, 0x3f, 0x02, 0x3e, 0x35, 0x36, 0x80, 0x3f, 0x01, 0x37, 0x37, 0x83, 0x3f, 0x03, 0x3e,
+  0x3e, 0x37, 0x26, 0x84, 0x3f, 0x03, 0x37, 0x37, 0x35, 0x37, 0x83, 0x3f, 0x03, 0x37, 0x36, 0x35,
+  0x36, 0x83, 0x3f, 0x03, 0x37, 0x36, 0x3e, 0x3e, 0x83, 0x3f, 0x01, 0x3e, 0x3e, 0x80, 0x37, 0x80,
+  0x3f, 0x04, 0x3c, 0x3f, 0x3e, 0x3f, 0x3f, 0x80, 0x3e, 0x04, 0x3f, 0x37, 0x1e, 0x3f, 0x1e, 0x80,
+  0x3e, 0x03, 0x0e, 0x3a, 0x32, 0x3a, 0x80, 0x12, 0x04, 0x32, 0x12, 0x16, 0x12, 0x16, 0x83, 0x12,
+  0x82, 0x1e, 0x03, 0x3f, 0x37, 0x3e, 0x1f, 0x80, 0x00, 0x00, 0x01, 0x81, 0x00, 0x09, 0x08, 0x05,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x10, 0x08, 0x82, 0x00, 0x05, 0x01, 0x03, 0x00, 0x00, 0x01,
+  0x00, 0x80, 0x08, 0x80, 0x00, 0x0e, 0x05, 0x1f, 0x1f, 0x3b, 0x3f, 0x1f, 0x1f, 0x1c, 0x1d, 0x19,
+  0x11, 0x33, 0x00, 0x20, 0x20, 0x80, 0x00, 0x85, 0x3f, 0x00, 0x3e, 0x83, 0x3f, 0x03, 0x37, 0x3e,
+  0x3f, 0x37, 0x81, 0x3f, 0x84, 0x00, 0x03, 0x3f, 0x36, 0x2e, 0x37, 0x82, 0x3f, 0x1a, 0x1f, 0x37,
+  0x37, 0x35, 0x37, 0x3b, 0x3b, 0x3f, 0x1f, 0x0b, 0x09, 0x19, 0x0b, 0x09, 0x03, 0x09, 0x19, 0x19,
+  0x09, 0x0b, 0x09, 0x09, 0x19, 0x09, 0x08, 0x0b, 0x39, 0x81, 0x3b, 0x04, 0x3f, 0x3e, 0x3e, 0x37,
+  0x27, 0x83, 0x3f, 0x07, 0x37, 0x37, 0x35, 0x36, 0x3f, 0x3f, 0x3e, 0x3e, 0x83, 0x3f, 0x81, 0x37,
+  0x83, 0x3f, 0x04, 0x3e, 0x3e, 0x27, 0x37, 0x37, 0x83, 0x3f, 0x02, 0x37, 0x37, 0x3e, 0x84, 0x3f,
+  0x03, 0x3c, 0x3e, 0x3c, 0x37, 0x83, 0x3f, 0x03, 0x3e, 0x27, 0x35, 0x37, 0x80, 0x3f, 0x05, 0x3e,
+  0x07, 0x3f, 0x3f, 0x3e, 0x3e, 0x80, 0x3f, 0x0d, 0x37, 0x3f, 0x37, 0x3e, 0x3f, 0x33, 0x3e, 0x1e,
+  0x17, 0x3a, 0x1a, 0x12, 0x32, 0x1e, 0x81, 0x12, 0x10, 0x16, 0x12, 0x12, 0x16, 0x12, 0x12, 0x32,
+  0x16, 0x16, 0x1e, 0x3e, 0x3f, 0x37, 0x17, 0x3a, 0x3f, 0x30, 0x83, 0x00, 0x03, 0x21, 0x10, 0x00,
+  0x10, 0x81, 0x00, 0x0c, 0x08, 0x00, 0x01, 0x02, 0x08, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x01, 0x80, 0x00, 0x01, 0x08, 0x08, 0x80, 0x00, 0x0d, 0x03, 0x3b, 0x2b, 0x3b, 0x3b, 0x2f, 0x3b,
+  0x39, 0x18, 0x1d, 0x19, 0x19, 0x00, 0x04, 0x81, 0x00, 0x04, 0x3f, 0x3e, 0x3f, 0x37, 0x3e, 0x81,
+  0x3f, 0x04, 0x3e, 0x3f, 0x37, 0x3f, 0x3e, 0x82, 0x3f, 0x04, 0x37, 0x3e, 0x3f, 0x37, 0x30, 0x82,
+  0x00, 0x00, 0x07, 0x80, 0x3e, 0x84, 0x3f, 0x19, 0x3c, 0x38, 0x3e, 0x38, 0x3f, 0x3b, 0x39, 0x3b,
+  0x0b, 0x0b, 0x09, 0x19, 0x0b, 0x09, 0x19, 0x09, 0x0b, 0x0b, 0x09, 0x19, 0x19, 0x09, 0x19, 0x19,
+  0x3f, 0x3b, 0x82, 0x3f, 0x03, 0x34, 0x3e, 0x2e, 0x3e, 0x83, 0x3f, 0x00, 0x3c, 0x80, 0x3e, 0x03,
+  0x3f, 0x3f, 0x37, 0x37, 0x83, 0x3f, 0x04, 0x3d, 0x34, 0x3e, 0x27, 0x37, 0x83, 0x3f, 0x02, 0x27,
+  0x37, 0x26, 0x84, 0x3f, 0x03, 0x27, 0x27, 0x34, 0x37, 0x83, 0x3f, 0x03, 0x37, 0x34, 0x3e, 0x3e,
+  0x83, 0x3f, 0x81, 0x3e, 0x06, 0x37, 0x3f, 0x3f, 0x38, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x0d, 0x3e,
+  0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x37, 0x3e, 0x3e, 0x05, 0x33, 0x37, 0x37, 0x32, 0x80, 0x12, 0x02,
+  0x16, 0x12, 0x32, 0x82, 0x12, 0x00, 0x32, 0x81, 0x12, 0x80, 0x17, 0x0e, 0x3a, 0x3e, 0x3e, 0x18,
+  0x00, 0x07, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x21, 0x00, 0x08, 0x81, 0x00, 0x04, 0x08, 0x08,
+  0x01, 0x00, 0x08, 0x81, 0x00, 0x01, 0x08, 0x01, 0x81, 0x00, 0x01, 0x08, 0x08, 0x81, 0x00, 0x03,
+  0x1f, 0x3b, 0x3f, 0x1f, 0x80, 0x3b, 0x06, 0x1d, 0x19, 0x1c, 0x1d, 0x1b, 0x04, 0x04, 0x80, 0x00,
+  0x00, 0x37, 0x82, 0x3f, 0x01, 0x37, 0x3e, 0x81, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x00, 0x3d, 0x83,
+  0x3f, 0x82, 0x00, 0x04, 0x3f, 0x3f, 0x27, 0x35, 0x36, 0x83, 0x3f, 0x03, 0x37, 0x37, 0x35, 0x37,
+  0x81, 0x3b, 0x05, 0x0b, 0x0b, 0x0a, 0x09, 0x11, 0x19, 0x80, 0x0b, 0x0a, 0x09, 0x19, 0x0b, 0x09,
+  0x11, 0x0a, 0x09, 0x07, 0x0f, 0x3b, 0x3b, 0x80, 0x3f, 0x81, 0x37, 0x83, 0x3f, 0x07, 0x3e, 0x35,
+  0x36, 0x2e, 0x3f, 0x3f, 0x35, 0x37, 0x83, 0x3f, 0x81, 0x37, 0x83, 0x3f, 0x81, 0x3e, 0x84, 0x3f,
+  0x03, 0x37, 0x36, 0x3f, 0x37, 0x83, 0x3f, 0x02, 0x3e, 0x3e, 0x3c, 0x84, 0x3f, 0x1e, 0x3e, 0x2e,
+  0x35, 0x37, 0x3f, 0x3f, 0x3a, 0x27, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f,
+  0x3e, 0x3f, 0x3e, 0x3f, 0x06, 0x3e, 0x3e, 0x3b, 0x3a, 0x3f, 0x16, 0x12, 0x32, 0x81, 0x12, 0x01,
+  0x16, 0x13, 0x83, 0x12, 0x0a, 0x32, 0x12, 0x33, 0x37, 0x37, 0x33, 0x31, 0x30, 0x07, 0x3e, 0x18,
+  0x80, 0x00, 0x03, 0x11, 0x21, 0x00, 0x04, 0x83, 0x00, 0x01, 0x10, 0x08, 0x80, 0x00, 0x04, 0x08,
+  0x00, 0x00, 0x01, 0x10, 0x81, 0x00, 0x01, 0x08, 0x08, 0x81, 0x00, 0x0d, 0x2b, 0x3f, 0x1f, 0x3b,
+  0x3b, 0x3d, 0x1f, 0x0a, 0x0f, 0x0b, 0x0a, 0x0f, 0x00, 0x20, 0x80, 0x00, 0x8b, 0x3f, 0x03, 0x3e,
+  0x3f, 0x37, 0x3e, 0x83, 0x3f, 0x00, 0x3c, 0x80, 0x00, 0x04, 0x07, 0x3f, 0x36, 0x3e, 0x37, 0x82,
+  0x3f, 0x08, 0x3b, 0x3f, 0x1e, 0x3c, 0x3a, 0x3b, 0x3f, 0x1d, 0x1f, 0x82, 0x19, 0x00, 0x09, 0x80,
+  0x19, 0x80, 0x0b, 0x0f, 0x09, 0x19, 0x0b, 0x09, 0x19, 0x1f, 0x1f, 0x3d, 0x3f, 0x3b, 0x3f, 0x3f,
+  0x3c, 0x3c, 0x37, 0x27, 0x83, 0x3f, 0x81, 0x3e, 0x02, 0x3f, 0x3f, 0x3e, 0x85, 0x3f, 0x02, 0x37,
+  0x35, 0x37, 0x84, 0x3f, 0x02, 0x3e, 0x27, 0x37, 0x85, 0x3f, 0x01, 0x37, 0x26, 0x85, 0x3f, 0x80,
+  0x37, 0x84, 0x3f, 0x80, 0x37, 0x02, 0x3f, 0x3f, 0x27, 0x84, 0x3f, 0x17, 0x37, 0x3e, 0x3f, 0x3e,
+  0x3f, 0x3f, 0x37, 0x38, 0x33, 0x3e, 0x3b, 0x37, 0x37, 0x1e, 0x3b, 0x3a, 0x13, 0x12, 0x16, 0x12,
+  0x16, 0x12, 0x12, 0x32, 0x80, 0x12, 0x00, 0x16, 0x82, 0x12, 0x1e, 0x3a, 0x3e, 0x1e, 0x1f, 0x3e,
+  0x1f, 0x30, 0x00, 0x00, 0x08, 0x00, 0x10, 0x02, 0x08, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+  0x10, 0x0a, 0x08, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x80, 0x00, 0x02, 0x01, 0x11, 0x08,
+  0x80, 0x00, 0x1c, 0x03, 0x3b, 0x3b, 0x2b, 0x3b, 0x3b, 0x3f, 0x1d, 0x18, 0x18, 0x1d, 0x19, 0x18,
+  0x04, 0x00, 0x00, 0x04, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x3e,
+  0x84, 0x3f, 0x03, 0x37, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x80, 0x3f, 0x02, 0x37,
+  0x27, 0x37, 0x84, 0x3f, 0x05, 0x33, 0x37, 0x27, 0x3b, 0x3f, 0x1f, 0x83, 0x0b, 0x0b, 0x09, 0x0b,
+  0x09, 0x19, 0x0b, 0x09, 0x0b, 0x0b, 0x09, 0x39, 0x03, 0x0f, 0x80, 0x3b, 0x02, 0x3f, 0x3f, 0x3b,
+  0x80, 0x3e, 0x85, 0x3f, 0x01, 0x37, 0x26, 0x8a, 0x3f, 0x00, 0x37, 0x86, 0x3f, 0x00, 0x3e, 0x85,
+  0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x00, 0x3e, 0x87, 0x3f, 0x0a, 0x37, 0x3f, 0x3f, 0x3a, 0x2f, 0x3f,
+  0x3f, 0x3e, 0x3f, 0x37, 0x3e, 0x80, 0x3f, 0x13, 0x3e, 0x3f, 0x3e, 0x3e, 0x1e, 0x07, 0x3f, 0x33,
+  0x3e, 0x3b, 0x3e, 0x3e, 0x1e, 0x3e, 0x1e, 0x12, 0x12, 0x16, 0x12, 0x1a, 0x80, 0x12, 0x00, 0x16,
+  0x81, 0x12, 0x11, 0x32, 0x16, 0x12, 0x17, 0x17, 0x06, 0x3b, 0x33, 0x3e, 0x18, 0x00, 0x00, 0x06,
+  0x08, 0x00, 0x08, 0x00, 0x14, 0x82, 0x00, 0x00, 0x01, 0x85, 0x00, 0x07, 0x08, 0x00, 0x01, 0x02,
+  0x00, 0x01, 0x00, 0x01, 0x80, 0x00, 0x0c, 0x07, 0x1d, 0x1f, 0x1f, 0x3b, 0x3f, 0x1f, 0x1b, 0x0f,
+  0x1d, 0x18, 0x1d, 0x19, 0x80, 0x00, 0x00, 0x03, 0x83, 0x3f, 0x00, 0x3e, 0x83, 0x3f, 0x00, 0x37,
+  0x89, 0x3f, 0x05, 0x3c, 0x07, 0x2f, 0x3f, 0x3f, 0x3e, 0x81, 0x3f, 0x05, 0x3b, 0x3f, 0x3f, 0x3b,
+  0x3f, 0x3f, 0x82, 0x3b, 0x8a, 0x19, 0x05, 0x0b, 0x0b, 0x09, 0x19, 0x3b, 0x3d, 0x80, 0x3f, 0x03,
+  0x1f, 0x3f, 0x3f, 0x3e, 0xc1, 0x3f, 0x03, 0x07, 0x3f, 0x37, 0x3e, 0x82, 0x3f, 0x12, 0x37, 0x3e,
+  0x3f, 0x3e, 0x3f, 0x3f, 0x2e, 0x3f, 0x3f, 0x3e, 0x3b, 0x3e, 0x3f, 0x17, 0x3f, 0x17, 0x33, 0x33,
+  0x32, 0x82, 0x12, 0x02, 0x32, 0x12, 0x1a, 0x85, 0x12, 0x04, 0x33, 0x3a, 0x3f, 0x17, 0x3f, 0x81,
+  0x00, 0x03, 0x08, 0x10, 0x20, 0x01, 0x81, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x01, 0x00, 0x08, 0x00,
+  0x00, 0x08, 0x01, 0x10, 0x08, 0x80, 0x00, 0x02, 0x01, 0x01, 0x08, 0x81, 0x00, 0x09, 0x1f, 0x3b,
+  0x3f, 0x1d, 0x3b, 0x3b, 0x3f, 0x19, 0x11, 0x1d, 0x80, 0x18, 0x0a, 0x00, 0x00, 0x04, 0x3f, 0x37,
+  0x3e, 0x3f, 0x2f, 0x3f, 0x3f, 0x3e, 0x84, 0x3f, 0x03, 0x37, 0x3e, 0x3f, 0x37, 0x81, 0x3f, 0x06,
+  0x37, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x07, 0x85, 0x3f, 0x0a, 0x3b, 0x3f, 0x3b, 0x3b, 0x3f, 0x1f,
+  0x3b, 0x3b, 0x39, 0x19, 0x1b, 0x83, 0x0b, 0x03, 0x09, 0x19, 0x0b, 0x09, 0x80, 0x19, 0x01, 0x0b,
+  0x09, 0x82, 0x1f, 0xa3, 0x3f, 0x02, 0x1d, 0x1c, 0x1f, 0x9b, 0x3f, 0x00, 0x38, 0x82, 0x3f, 0x00,
+  0x3e, 0x84, 0x3f, 0x19, 0x3e, 0x38, 0x33, 0x3f, 0x37, 0x3f, 0x3e, 0x3b, 0x33, 0x3e, 0x1e, 0x3b,
+  0x37, 0x33, 0x33, 0x12, 0x16, 0x12, 0x32, 0x12, 0x13, 0x12, 0x16, 0x12, 0x12, 0x32, 0x81, 0x12,
+  0x01, 0x02, 0x12, 0x80, 0x33, 0x0d, 0x37, 0x10, 0x00, 0x00, 0x18, 0x20, 0x01, 0x10, 0x00, 0x03,
+  0x00, 0x01, 0x00, 0x08, 0x86, 0x00, 0x07, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x01, 0x80,
+  0x00, 0x02, 0x39, 0x3b, 0x3f, 0x80, 0x1f, 0x0a, 0x2b, 0x3b, 0x2b, 0x0b, 0x03, 0x0f, 0x0b, 0x28,
+  0x00, 0x00, 0x07, 0x81, 0x3f, 0x01, 0x37, 0x3e, 0x80, 0x3f, 0x05, 0x37, 0x3e, 0x3f, 0x37, 0x3f,
+  0x37, 0x81, 0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x84, 0x3f, 0x01, 0x3c, 0x07, 0x81, 0x3f, 0x02, 0x1f,
+  0x3f, 0x3b, 0x81, 0x3f, 0x00, 0x1f, 0x80, 0x3b, 0x01, 0x19, 0x1b, 0x86, 0x0b, 0x02, 0x09, 0x19,
+  0x19, 0x80, 0x0b, 0x01, 0x0f, 0x39, 0xa6, 0x3f, 0x03, 0x00, 0x2a, 0x0f, 0x08, 0x9b, 0x3f, 0x0f,
+  0x27, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x3e, 0x07,
+  0x80, 0x3f, 0x0a, 0x1e, 0x3b, 0x37, 0x3f, 0x37, 0x3b, 0x37, 0x3a, 0x3f, 0x17, 0x37, 0x82, 0x12,
+  0x03, 0x32, 0x12, 0x12, 0x1a, 0x80, 0x12, 0x00, 0x16, 0x81, 0x12, 0x03, 0x16, 0x1f, 0x33, 0x38,
+  0x80, 0x00, 0x04, 0x03, 0x00, 0x01, 0x11, 0x04, 0x82, 0x00, 0x07, 0x01, 0x10, 0x08, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x80, 0x00, 0x0b, 0x10, 0x10, 0x00, 0x01, 0x11, 0x01, 0x00, 0x3f, 0x3f, 0x07,
+  0x1b, 0x2b, 0x80, 0x3b, 0x09, 0x3f, 0x1f, 0x15, 0x1d, 0x11, 0x11, 0x18, 0x38, 0x00, 0x06, 0x96,
+  0x3f, 0x00, 0x3e, 0x82, 0x3f, 0x00, 0x04, 0x81, 0x3f, 0x02, 0x3b, 0x3f, 0x3f, 0x80, 0x3b, 0x00,
+  0x3f, 0x80, 0x1f, 0x03, 0x0b, 0x19, 0x1b, 0x0b, 0x88, 0x19, 0x80, 0x0b, 0x00, 0x1f, 0x80, 0x3b,
+  0x04, 0x3f, 0x1f, 0x3b, 0x3f, 0x1f, 0x87, 0x3f, 0x00, 0x37, 0x91, 0x3f, 0x06, 0x3b, 0x00, 0x03,
+  0x1f, 0x1e, 0x1d, 0x03, 0x99, 0x3f, 0x08, 0x1c, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37,
+  0x82, 0x3f, 0x01, 0x3e, 0x07, 0x83, 0x3f, 0x06, 0x3b, 0x37, 0x1f, 0x37, 0x3a, 0x3f, 0x17, 0x80,
+  0x3a, 0x83, 0x12, 0x03, 0x16, 0x12, 0x12, 0x16, 0x85, 0x12, 0x11, 0x1e, 0x3a, 0x00, 0x00, 0x02,
+  0x00, 0x22, 0x04, 0x00, 0x00, 0x08, 0x02, 0x08, 0x02, 0x08, 0x00, 0x00, 0x02, 0x80, 0x00, 0x07,
+  0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x10, 0x00, 0x80, 0x01, 0x06, 0x17, 0x3f, 0x3f, 0x1f, 0x0f,
+  0x3b, 0x3f, 0x80, 0x1f, 0x0b, 0x1d, 0x19, 0x1b, 0x08, 0x39, 0x17, 0x39, 0x00, 0x07, 0x3f, 0x37,
+  0x3e, 0x80, 0x3f, 0x02, 0x3e, 0x3f, 0x3e, 0x81, 0x3f, 0x0a, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x3e,
+  0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x01, 0x37, 0x3e, 0x80, 0x3f, 0x00, 0x06, 0x82, 0x3f,
+  0x02, 0x1f, 0x3f, 0x3f, 0x81, 0x1f, 0x00, 0x0b, 0x8e, 0x19, 0x02, 0x1f, 0x3f, 0x1f, 0x94, 0x3f,
+  0x00, 0x3e, 0x80, 0x3f, 0x00, 0x37, 0x87, 0x3f, 0x07, 0x38, 0x00, 0x07, 0x2a, 0x2b, 0x2b, 0x39,
+  0x07, 0x88, 0x3f, 0x04, 0x37, 0x3f, 0x37, 0x3f, 0x37, 0x84, 0x3f, 0x04, 0x37, 0x3f, 0x3f, 0x3a,
+  0x27, 0x86, 0x3f, 0x04, 0x3e, 0x3f, 0x3e, 0x3f, 0x31, 0x81, 0x3f, 0x0f, 0x3e, 0x3f, 0x17, 0x37,
+  0x3f, 0x3e, 0x3b, 0x37, 0x1e, 0x3b, 0x37, 0x3b, 0x37, 0x3f, 0x12, 0x17, 0x87, 0x12, 0x00, 0x16,
+  0x82, 0x12, 0x09, 0x17, 0x18, 0x00, 0x00, 0x03, 0x00, 0x08, 0x03, 0x00, 0x10, 0x82, 0x00, 0x03,
+  0x08, 0x01, 0x00, 0x01, 0x84, 0x00, 0x17, 0x10, 0x10, 0x00, 0x01, 0x00, 0x2f, 0x3f, 0x3f, 0x23,
+  0x39, 0x1f, 0x3b, 0x2b, 0x3f, 0x0f, 0x3b, 0x39, 0x1c, 0x19, 0x18, 0x3f, 0x3f, 0x00, 0x07, 0x80,
+  0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x81, 0x3f, 0x02, 0x3e, 0x3f, 0x37, 0x84, 0x3f, 0x00, 0x3e, 0x81,
+  0x3f, 0x00, 0x37, 0x81, 0x3f, 0x03, 0x3e, 0x3f, 0x3f, 0x20, 0x82, 0x3f, 0x0b, 0x3b, 0x3b, 0x3f,
+  0x3b, 0x3f, 0x1f, 0x1b, 0x0b, 0x1b, 0x0b, 0x19, 0x1b, 0x89, 0x0b, 0x01, 0x0f, 0x0f, 0xa4, 0x3f,
+  0x07, 0x38, 0x00, 0x0b, 0x39, 0x3b, 0x31, 0x33, 0x23, 0x84, 0x3f, 0x00, 0x3e, 0x8f, 0x3f, 0x00,
+  0x27, 0x80, 0x3f, 0x06, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x01, 0x38, 0x27,
+  0x84, 0x3f, 0x12, 0x3b, 0x37, 0x17, 0x3e, 0x3f, 0x37, 0x3e, 0x1f, 0x37, 0x1e, 0x18, 0x3a, 0x12,
+  0x12, 0x32, 0x1e, 0x12, 0x12, 0x33, 0x88, 0x12, 0x00, 0x32, 0x80, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0x21, 0x00, 0x08, 0x02, 0x08, 0x84, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x10,
+  0x00, 0x0a, 0x08, 0x1f, 0x3f, 0x3f, 0x39, 0x80, 0x3b, 0x01, 0x3f, 0x1f, 0x80, 0x3b, 0x06, 0x03,
+  0x0f, 0x07, 0x3f, 0x3f, 0x38, 0x07, 0x84, 0x3f, 0x00, 0x3e, 0x83, 0x3f, 0x00, 0x37, 0x81, 0x3f,
+  0x00, 0x3e, 0x80, 0x3f, 0x06, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x81, 0x3f, 0x06, 0x06,
+  0x0f, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x80, 0x1f, 0x06, 0x1b, 0x0b, 0x19, 0x19, 0x1b, 0x0b, 0x0b,
+  0x89, 0x19, 0x04, 0x3b, 0x3f, 0x1f, 0x1f, 0x3b, 0x81, 0x3f, 0x08, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e,
+  0x3f, 0x3e, 0x3f, 0x3e, 0x87, 0x3f, 0x01, 0x37, 0x37, 0x86, 0x3f, 0x09, 0x37, 0x3f, 0x28, 0x00,
+  0x1e, 0x0f, 0x15, 0x1f, 0x0f, 0x18, 0x82, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x00, 0x37, 0x86, 0x3f,
+  0x01, 0x3e, 0x3e, 0x80, 0x3f, 0x0f, 0x38, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x3f,
+  0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x07, 0x83, 0x3f, 0x0f, 0x3a, 0x3f, 0x37, 0x3f, 0x3e, 0x3b, 0x3b,
+  0x3f, 0x1f, 0x3e, 0x1f, 0x37, 0x3a, 0x3f, 0x3b, 0x3a, 0x83, 0x12, 0x00, 0x16, 0x83, 0x12, 0x00,
+  0x32, 0x81, 0x12, 0x0a, 0x00, 0x00, 0x01, 0x02, 0x0a, 0x02, 0x04, 0x10, 0x00, 0x00, 0x01, 0x80,
+  0x00, 0x04, 0x01, 0x02, 0x08, 0x00, 0x01, 0x81, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x80,
+  0x3f, 0x02, 0x3a, 0x1f, 0x15, 0x83, 0x1f, 0x02, 0x1d, 0x18, 0x1f, 0x80, 0x3f, 0x03, 0x07, 0x3e,
+  0x3f, 0x37, 0x80, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x00, 0x37, 0x81, 0x3f, 0x07, 0x37, 0x3e, 0x3f,
+  0x37, 0x3f, 0x2f, 0x3f, 0x37, 0x82, 0x3f, 0x08, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x36,
+  0x07, 0x80, 0x3f, 0x05, 0x1f, 0x1f, 0x3b, 0x3b, 0x2b, 0x19, 0x80, 0x1b, 0x03, 0x0b, 0x1b, 0x0b,
+  0x0b, 0x87, 0x19, 0x01, 0x1f, 0x1f, 0x84, 0x3f, 0x05, 0x3b, 0x3f, 0x3b, 0x3f, 0x3f, 0x3e, 0x84,
+  0x3f, 0x00, 0x37, 0x81, 0x3f, 0x03, 0x3e, 0x3f, 0x37, 0x37, 0x83, 0x3f, 0x80, 0x3e, 0x09, 0x3f,
+  0x00, 0x00, 0x39, 0x3b, 0x0f, 0x0b, 0x39, 0x39, 0x06, 0x85, 0x3f, 0x81, 0x37, 0x83, 0x3f, 0x80,
+  0x37, 0x03, 0x3f, 0x1f, 0x3f, 0x07, 0x82, 0x3f, 0x00, 0x37, 0x83, 0x3f, 0x01, 0x3d, 0x07, 0x83,
+  0x3f, 0x03, 0x17, 0x3f, 0x3b, 0x3f, 0x81, 0x37, 0x00, 0x32, 0x81, 0x00, 0x0f, 0x03, 0x3a, 0x3e,
+  0x1f, 0x12, 0x12, 0x13, 0x12, 0x12, 0x10, 0x12, 0x12, 0x32, 0x12, 0x12, 0x3a, 0x83, 0x12, 0x01,
+  0x10, 0x10, 0x80, 0x00, 0x08, 0x08, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x08, 0x83, 0x00,
+  0x02, 0x02, 0x00, 0x00, 0x80, 0x10, 0x01, 0x00, 0x08, 0x81, 0x3f, 0x0e, 0x07, 0x1f, 0x1f, 0x2b,
+  0x3b, 0x3b, 0x2f, 0x1f, 0x0a, 0x0e, 0x3f, 0x37, 0x3f, 0x3f, 0x07, 0x80, 0x3f, 0x09, 0x3e, 0x3f,
+  0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3e, 0x83, 0x3f, 0x05, 0x3c, 0x30, 0x27, 0x3f, 0x3f,
+  0x3e, 0x82, 0x3f, 0x07, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x38, 0x37, 0x80, 0x3f, 0x80, 0x3b,
+  0x09, 0x1b, 0x1b, 0x0b, 0x09, 0x19, 0x1b, 0x0b, 0x19, 0x19, 0x1b, 0x85, 0x0b, 0x03, 0x0f, 0x3b,
+  0x3f, 0x1f, 0x87, 0x3f, 0x06, 0x3e, 0x3f, 0x37, 0x37, 0x3f, 0x3f, 0x3e, 0x80, 0x3f, 0x07, 0x3e,
+  0x3f, 0x3e, 0x3f, 0x37, 0x36, 0x2e, 0x3e, 0x83, 0x3f, 0x17, 0x3c, 0x3e, 0x2e, 0x3f, 0x00, 0x00,
+  0x2b, 0x31, 0x3b, 0x31, 0x31, 0x3a, 0x39, 0x07, 0x3f, 0x3e, 0x3f, 0x3b, 0x3f, 0x3b, 0x3f, 0x35,
+  0x37, 0x26, 0x85, 0x3f, 0x06, 0x35, 0x35, 0x36, 0x3f, 0x38, 0x38, 0x3e, 0x84, 0x3f, 0x04, 0x37,
+  0x3f, 0x3e, 0x3f, 0x32, 0x87, 0x3f, 0x04, 0x3a, 0x3e, 0x3e, 0x3f, 0x38, 0x82, 0x00, 0x0b, 0x02,
+  0x3b, 0x3b, 0x33, 0x3f, 0x3f, 0x12, 0x16, 0x12, 0x12, 0x10, 0x13, 0x87, 0x12, 0x81, 0x10, 0x05,
+  0x02, 0x02, 0x00, 0x03, 0x00, 0x10, 0x81, 0x00, 0x0a, 0x10, 0x00, 0x08, 0x01, 0x00, 0x00, 0x1f,
+  0x3c, 0x00, 0x02, 0x02, 0x80, 0x00, 0x12, 0x3f, 0x1f, 0x37, 0x37, 0x39, 0x39, 0x3b, 0x3b, 0x39,
+  0x3f, 0x19, 0x3b, 0x38, 0x3f, 0x3e, 0x3e, 0x37, 0x3f, 0x2e, 0x8e, 0x3f, 0x0b, 0x3e, 0x3f, 0x3f,
+  0x24, 0x20, 0x27, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x07, 0x37, 0x3f, 0x3f, 0x2e,
+  0x3f, 0x38, 0x07, 0x3f, 0x80, 0x1f, 0x05, 0x19, 0x1b, 0x0b, 0x19, 0x13, 0x1b, 0x80, 0x0b, 0x10,
+  0x1b, 0x19, 0x19, 0x1b, 0x0a, 0x0b, 0x03, 0x0b, 0x0b, 0x19, 0x1b, 0x1f, 0x3b, 0x3d, 0x15, 0x36,
+  0x3e, 0x83, 0x3f, 0x04, 0x3e, 0x3e, 0x2e, 0x35, 0x37, 0x86, 0x3f, 0x01, 0x3e, 0x3c, 0x80, 0x3e,
+  0x13, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x3e, 0x3e, 0x37, 0x37, 0x38, 0x00, 0x01, 0x1f, 0x0f, 0x15,
+  0x1f, 0x1f, 0x09, 0x3f, 0x00, 0x82, 0x3f, 0x00, 0x37, 0x80, 0x3e, 0x87, 0x3f, 0x0b, 0x36, 0x3f,
+  0x3d, 0x17, 0x3f, 0x27, 0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x3e, 0x81, 0x3f, 0x02, 0x38, 0x2f, 0x3f,
+  0x81, 0x3e, 0x0a, 0x3f, 0x37, 0x3f, 0x37, 0x3e, 0x3f, 0x36, 0x3f, 0x10, 0x00, 0x01, 0x82, 0x00,
+  0x08, 0x3a, 0x3f, 0x1e, 0x1a, 0x3a, 0x3a, 0x12, 0x1a, 0x32, 0x85, 0x12, 0x02, 0x1a, 0x12, 0x13,
+  0x80, 0x12, 0x0f, 0x02, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x01, 0x02, 0x00, 0x01,
+  0x02, 0x00, 0x10, 0x80, 0x3f, 0x80, 0x00, 0x08, 0x10, 0x10, 0x00, 0x00, 0x3f, 0x3f, 0x37, 0x37,
+  0x31, 0x81, 0x1f, 0x0c, 0x18, 0x3f, 0x1d, 0x17, 0x3f, 0x35, 0x37, 0x37, 0x3f, 0x17, 0x3f, 0x37,
+  0x3e, 0x80, 0x3f, 0x03, 0x37, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x0c, 0x37, 0x3e, 0x3f, 0x37, 0x3f,
+  0x3f, 0x34, 0x23, 0x3f, 0x38, 0x35, 0x3f, 0x3e, 0x82, 0x3f, 0x12, 0x37, 0x2f, 0x3e, 0x3f, 0x3f,
+  0x3e, 0x3f, 0x3c, 0x15, 0x3f, 0x3f, 0x1b, 0x1b, 0x19, 0x1b, 0x0b, 0x19, 0x19, 0x1b, 0x81, 0x19,
+  0x00, 0x1b, 0x82, 0x0b, 0x09, 0x19, 0x19, 0x3f, 0x39, 0x3f, 0x37, 0x36, 0x3d, 0x37, 0x37, 0x80,
+  0x3f, 0x02, 0x37, 0x3f, 0x3f, 0x81, 0x37, 0x08, 0x33, 0x3f, 0x3b, 0x3f, 0x3f, 0x3e, 0x36, 0x3f,
+  0x3f, 0x80, 0x3e, 0x02, 0x37, 0x27, 0x37, 0x82, 0x3f, 0x18, 0x37, 0x37, 0x26, 0x3b, 0x00, 0x01,
+  0x15, 0x1f, 0x0f, 0x1d, 0x15, 0x1e, 0x3f, 0x00, 0x07, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x37,
+  0x26, 0x3f, 0x38, 0x80, 0x3f, 0x81, 0x00, 0x80, 0x3f, 0x03, 0x07, 0x3f, 0x3f, 0x3e, 0x81, 0x3f,
+  0x00, 0x37, 0x80, 0x3f, 0x04, 0x37, 0x3c, 0x07, 0x3f, 0x3e, 0x80, 0x3f, 0x08, 0x37, 0x3f, 0x3b,
+  0x3f, 0x3b, 0x3f, 0x3e, 0x3c, 0x3f, 0x83, 0x00, 0x08, 0x10, 0x00, 0x07, 0x1e, 0x1f, 0x3f, 0x1f,
+  0x1f, 0x3f, 0x83, 0x12, 0x00, 0x32, 0x84, 0x12, 0x05, 0x32, 0x12, 0x12, 0x10, 0x12, 0x02, 0x80,
+  0x00, 0x00, 0x02, 0x82, 0x00, 0x1f, 0x04, 0x1f, 0x3f, 0x3b, 0x3f, 0x37, 0x30, 0x20, 0x00, 0x10,
+  0x02, 0x00, 0x00, 0x3f, 0x37, 0x3e, 0x37, 0x38, 0x23, 0x15, 0x1f, 0x18, 0x1f, 0x1b, 0x07, 0x3f,
+  0x3e, 0x3e, 0x37, 0x26, 0x3f, 0x27, 0x81, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x04, 0x3d, 0x3f, 0x3e,
+  0x3f, 0x2f, 0x83, 0x3f, 0x04, 0x24, 0x3f, 0x3f, 0x3a, 0x27, 0x80, 0x3f, 0x0e, 0x27, 0x3f, 0x35,
+  0x3f, 0x3f, 0x3d, 0x3f, 0x3e, 0x3f, 0x2f, 0x37, 0x3e, 0x07, 0x3f, 0x39, 0x81, 0x1b, 0x0b, 0x19,
+  0x13, 0x0b, 0x0b, 0x1b, 0x19, 0x1b, 0x0b, 0x0a, 0x0b, 0x0b, 0x0a, 0x80, 0x0b, 0x80, 0x1f, 0x13,
+  0x1e, 0x3d, 0x36, 0x3e, 0x2e, 0x3f, 0x17, 0x3f, 0x1f, 0x3f, 0x37, 0x27, 0x34, 0x3e, 0x2e, 0x3f,
+  0x3e, 0x3f, 0x3f, 0x1e, 0x80, 0x3f, 0x1b, 0x3b, 0x3e, 0x2e, 0x35, 0x36, 0x3e, 0x3f, 0x1f, 0x3f,
+  0x1f, 0x3f, 0x3e, 0x3c, 0x3e, 0x3f, 0x38, 0x00, 0x07, 0x1f, 0x07, 0x1d, 0x17, 0x0f, 0x19, 0x38,
+  0x00, 0x03, 0x2f, 0x81, 0x3f, 0x06, 0x3e, 0x27, 0x37, 0x38, 0x00, 0x00, 0x08, 0x82, 0x00, 0x02,
+  0x06, 0x3f, 0x38, 0x80, 0x3f, 0x00, 0x39, 0x80, 0x3f, 0x06, 0x35, 0x15, 0x07, 0x27, 0x3f, 0x3f,
+  0x07, 0x80, 0x3f, 0x0b, 0x3e, 0x3e, 0x36, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x37, 0x38,
+  0x81, 0x00, 0x00, 0x18, 0x80, 0x00, 0x0a, 0x03, 0x3b, 0x3a, 0x3a, 0x3e, 0x1e, 0x1e, 0x3b, 0x12,
+  0x12, 0x32, 0x84, 0x12, 0x00, 0x32, 0x83, 0x12, 0x81, 0x02, 0x0c, 0x03, 0x00, 0x00, 0x02, 0x00,
+  0x03, 0x37, 0x3b, 0x3e, 0x1f, 0x37, 0x16, 0x3f, 0x80, 0x00, 0x80, 0x02, 0x13, 0x00, 0x3b, 0x3b,
+  0x37, 0x27, 0x18, 0x03, 0x2b, 0x1c, 0x1f, 0x3b, 0x00, 0x07, 0x3e, 0x26, 0x3c, 0x3e, 0x3e, 0x3f,
+  0x37, 0x80, 0x3f, 0x00, 0x3e, 0x81, 0x3f, 0x00, 0x3e, 0x85, 0x3f, 0x03, 0x37, 0x3f, 0x3f, 0x3b,
+  0x80, 0x3f, 0x20, 0x38, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x37, 0x3e, 0x3d, 0x3e,
+  0x3f, 0x3d, 0x3f, 0x34, 0x1f, 0x1f, 0x1b, 0x0b, 0x19, 0x1b, 0x0b, 0x19, 0x1b, 0x1b, 0x0b, 0x0b,
+  0x19, 0x1b, 0x0b, 0x0a, 0x80, 0x0b, 0x00, 0x19, 0x80, 0x1f, 0x05, 0x3b, 0x27, 0x26, 0x3c, 0x3e,
+  0x3e, 0x82, 0x3f, 0x80, 0x3e, 0x01, 0x37, 0x36, 0x80, 0x3f, 0x03, 0x37, 0x3f, 0x3e, 0x34, 0x80,
+  0x3f, 0x80, 0x37, 0x16, 0x35, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x35, 0x36, 0x38, 0x00,
+  0x00, 0x39, 0x3b, 0x23, 0x39, 0x1f, 0x0e, 0x39, 0x00, 0x07, 0x00, 0x81, 0x3f, 0x03, 0x3e, 0x3e,
+  0x3f, 0x38, 0x85, 0x00, 0x02, 0x01, 0x38, 0x1f, 0x81, 0x3f, 0x02, 0x27, 0x37, 0x38, 0x80, 0x00,
+  0x02, 0x18, 0x00, 0x00, 0x82, 0x3f, 0x06, 0x37, 0x37, 0x27, 0x37, 0x3f, 0x3f, 0x37, 0x80, 0x3f,
+  0x84, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x3a, 0x3f, 0x1f, 0x3b, 0x3f, 0x3b, 0x3f, 0x07, 0x3a, 0x12,
+  0x12, 0x32, 0x86, 0x12, 0x16, 0x16, 0x12, 0x16, 0x12, 0x12, 0x10, 0x10, 0x12, 0x00, 0x02, 0x04,
+  0x1f, 0x3e, 0x3b, 0x3e, 0x1f, 0x33, 0x3a, 0x3f, 0x17, 0x04, 0x04, 0x00, 0x81, 0x02, 0x05, 0x3f,
+  0x3e, 0x3e, 0x37, 0x30, 0x03, 0x80, 0x1f, 0x1e, 0x08, 0x00, 0x07, 0x3f, 0x37, 0x37, 0x36, 0x3e,
+  0x3f, 0x35, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f,
+  0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3c, 0x81, 0x3f, 0x01, 0x38, 0x2f, 0x81, 0x3f, 0x00, 0x37,
+  0x80, 0x3f, 0x08, 0x3e, 0x3f, 0x3f, 0x37, 0x37, 0x3f, 0x20, 0x3b, 0x3b, 0x83, 0x1b, 0x13, 0x0b,
+  0x0b, 0x1b, 0x0b, 0x19, 0x1b, 0x0b, 0x19, 0x1b, 0x07, 0x0b, 0x1f, 0x0f, 0x3a, 0x3f, 0x3f, 0x33,
+  0x37, 0x36, 0x2e, 0x82, 0x3f, 0x05, 0x3e, 0x3c, 0x37, 0x27, 0x35, 0x37, 0x82, 0x3f, 0x0c, 0x37,
+  0x3f, 0x37, 0x3e, 0x3c, 0x3e, 0x2e, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x3a, 0x80, 0x3e, 0x19, 0x3f,
+  0x38, 0x01, 0x03, 0x2a, 0x1d, 0x1f, 0x0e, 0x1d, 0x15, 0x3a, 0x00, 0x07, 0x00, 0x03, 0x3f, 0x3f,
+  0x1f, 0x37, 0x27, 0x38, 0x00, 0x00, 0x0f, 0x3f, 0x3f, 0x82, 0x00, 0x00, 0x1f, 0x82, 0x3f, 0x01,
+  0x17, 0x3f, 0x81, 0x00, 0x03, 0x03, 0x3b, 0x38, 0x38, 0x80, 0x3f, 0x17, 0x36, 0x3c, 0x3e, 0x3e,
+  0x3f, 0x1f, 0x3f, 0x3f, 0x38, 0x18, 0x23, 0x00, 0x0f, 0x1f, 0x3f, 0x38, 0x00, 0x08, 0x00, 0x02,
+  0x03, 0x3f, 0x1f, 0x17, 0x80, 0x1e, 0x07, 0x1a, 0x3f, 0x17, 0x32, 0x32, 0x12, 0x12, 0x32, 0x8b,
+  0x12, 0x26, 0x02, 0x12, 0x13, 0x33, 0x36, 0x1e, 0x1e, 0x1f, 0x33, 0x3e, 0x1f, 0x33, 0x37, 0x00,
+  0x20, 0x00, 0x00, 0x02, 0x00, 0x10, 0x3f, 0x17, 0x37, 0x3f, 0x00, 0x00, 0x3b, 0x2a, 0x08, 0x00,
+  0x00, 0x3f, 0x36, 0x3c, 0x37, 0x27, 0x37, 0x3f, 0x0f, 0x83, 0x3f, 0x00, 0x2f, 0x89, 0x3f, 0x1a,
+  0x3e, 0x3f, 0x07, 0x3f, 0x1f, 0x3f, 0x3f, 0x30, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x27,
+  0x3f, 0x3c, 0x3f, 0x2f, 0x3d, 0x37, 0x3f, 0x22, 0x3f, 0x1b, 0x0b, 0x80, 0x19, 0x80, 0x1b, 0x16,
+  0x0b, 0x1b, 0x0b, 0x19, 0x19, 0x13, 0x0b, 0x0b, 0x19, 0x3b, 0x3b, 0x3f, 0x1f, 0x36, 0x2e, 0x2e,
+  0x3c, 0x3e, 0x1f, 0x3f, 0x17, 0x3e, 0x1f, 0x82, 0x3e, 0x83, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x01,
+  0x36, 0x3e, 0x80, 0x37, 0x82, 0x3f, 0x11, 0x3c, 0x3c, 0x37, 0x38, 0x00, 0x05, 0x1f, 0x0f, 0x19,
+  0x3b, 0x2b, 0x3b, 0x3d, 0x00, 0x01, 0x38, 0x00, 0x07, 0x80, 0x3f, 0x03, 0x37, 0x38, 0x00, 0x01,
+  0x80, 0x3f, 0x05, 0x08, 0x01, 0x00, 0x08, 0x00, 0x2f, 0x82, 0x3f, 0x01, 0x3c, 0x38, 0x81, 0x00,
+  0x12, 0x05, 0x1d, 0x1d, 0x1f, 0x38, 0x07, 0x3f, 0x3e, 0x3e, 0x37, 0x37, 0x3f, 0x3e, 0x3f, 0x3f,
+  0x18, 0x00, 0x00, 0x07, 0x81, 0x3f, 0x00, 0x18, 0x81, 0x00, 0x0a, 0x1b, 0x3b, 0x3b, 0x3f, 0x1f,
+  0x3b, 0x35, 0x17, 0x3a, 0x3e, 0x1e, 0x81, 0x12, 0x00, 0x32, 0x85, 0x12, 0x02, 0x13, 0x12, 0x16,
+  0x83, 0x12, 0x00, 0x16, 0x81, 0x17, 0x0d, 0x1e, 0x1f, 0x37, 0x00, 0x00, 0x20, 0x00, 0x02, 0x02,
+  0x00, 0x1f, 0x3b, 0x3a, 0x37, 0x84, 0x00, 0x0c, 0x3f, 0x3f, 0x37, 0x37, 0x36, 0x2e, 0x3f, 0x37,
+  0x37, 0x3f, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x03, 0x37, 0x3e, 0x3f, 0x3e, 0x81, 0x3f, 0x00, 0x3e,
+  0x81, 0x3f, 0x17, 0x3a, 0x3f, 0x3f, 0x3e, 0x37, 0x3f, 0x25, 0x3f, 0x37, 0x3d, 0x3e, 0x3d, 0x3f,
+  0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x37, 0x3f, 0x3e, 0x3d, 0x07, 0x3b, 0x81, 0x1b, 0x80, 0x19, 0x0d,
+  0x1b, 0x19, 0x1b, 0x19, 0x13, 0x0b, 0x0b, 0x19, 0x1f, 0x1f, 0x17, 0x3b, 0x3f, 0x1f, 0x81, 0x37,
+  0x83, 0x3f, 0x0a, 0x37, 0x27, 0x34, 0x3e, 0x3f, 0x3f, 0x33, 0x3f, 0x3e, 0x3f, 0x3e, 0x80, 0x3f,
+  0x06, 0x3e, 0x2e, 0x3c, 0x3f, 0x3b, 0x3f, 0x33, 0x80, 0x3f, 0x80, 0x37, 0x0f, 0x38, 0x00, 0x03,
+  0x31, 0x3a, 0x2a, 0x39, 0x33, 0x28, 0x3f, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x06,
+  0x00, 0x01, 0x3f, 0x3c, 0x3f, 0x3f, 0x38, 0x81, 0x00, 0x00, 0x1f, 0x83, 0x3f, 0x00, 0x30, 0x81,
+  0x00, 0x09, 0x03, 0x38, 0x3b, 0x27, 0x3f, 0x00, 0x07, 0x3f, 0x35, 0x37, 0x80, 0x3f, 0x06, 0x3b,
+  0x3f, 0x00, 0x00, 0x07, 0x3f, 0x27, 0x80, 0x3f, 0x00, 0x38, 0x81, 0x00, 0x0f, 0x3f, 0x1e, 0x3b,
+  0x33, 0x3f, 0x1f, 0x07, 0x3a, 0x3f, 0x17, 0x36, 0x3e, 0x16, 0x12, 0x12, 0x1a, 0x80, 0x12, 0x00,
+  0x16, 0x83, 0x12, 0x00, 0x13, 0x84, 0x12, 0x00, 0x1a, 0x80, 0x33, 0x0d, 0x37, 0x17, 0x17, 0x00,
+  0x20, 0x04, 0x00, 0x00, 0x10, 0x12, 0x3e, 0x3f, 0x37, 0x3b, 0x84, 0x00, 0x09, 0x3b, 0x3a, 0x3e,
+  0x2e, 0x3e, 0x3b, 0x3f, 0x3d, 0x3f, 0x3e, 0x81, 0x3f, 0x00, 0x37, 0x82, 0x3f, 0x02, 0x3e, 0x3f,
+  0x37, 0x80, 0x3f, 0x0a, 0x37, 0x3f, 0x3e, 0x3c, 0x3f, 0x3b, 0x3f, 0x37, 0x37, 0x3a, 0x27, 0x80,
+  0x3f, 0x10, 0x3e, 0x3e, 0x3f, 0x27, 0x3e, 0x2e, 0x3f, 0x2e, 0x3c, 0x3f, 0x37, 0x30, 0x3f, 0x19,
+  0x1b, 0x1b, 0x19, 0x80, 0x1b, 0x12, 0x19, 0x1b, 0x19, 0x1b, 0x0b, 0x1b, 0x19, 0x1b, 0x1f, 0x1f,
+  0x3b, 0x3f, 0x1f, 0x3f, 0x35, 0x37, 0x27, 0x3f, 0x3e, 0x83, 0x3f, 0x80, 0x37, 0x00, 0x3b, 0x80,
+  0x3f, 0x09, 0x1f, 0x3f, 0x37, 0x3f, 0x37, 0x1e, 0x3f, 0x3e, 0x3f, 0x37, 0x81, 0x3f, 0x0e, 0x37,
+  0x3f, 0x3f, 0x3e, 0x3f, 0x38, 0x00, 0x00, 0x0f, 0x1d, 0x1f, 0x0f, 0x1d, 0x1b, 0x3f, 0x84, 0x00,
+  0x08, 0x3f, 0x3f, 0x00, 0x07, 0x3f, 0x3a, 0x0f, 0x3f, 0x39, 0x81, 0x00, 0x01, 0x3b, 0x3b, 0x82,
+  0x3f, 0x82, 0x00, 0x1b, 0x07, 0x0f, 0x1d, 0x1b, 0x3f, 0x00, 0x00, 0x2f, 0x3f, 0x3f, 0x37, 0x3a,
+  0x3f, 0x3f, 0x38, 0x00, 0x00, 0x3f, 0x3c, 0x21, 0x1f, 0x3f, 0x3f, 0x38, 0x00, 0x00, 0x08, 0x00,
+  0x81, 0x1f, 0x80, 0x3a, 0x00, 0x3f, 0x82, 0x17, 0x00, 0x1f, 0x8c, 0x12, 0x00, 0x33, 0x83, 0x12,
+  0x06, 0x13, 0x17, 0x17, 0x1e, 0x1f, 0x00, 0x04, 0x80, 0x00, 0x05, 0x02, 0x00, 0x3b, 0x3a, 0x3b,
+  0x38, 0x83, 0x00, 0x08, 0x03, 0x3e, 0x3f, 0x3b, 0x37, 0x33, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x00,
+  0x3e, 0x80, 0x3f, 0x03, 0x37, 0x3f, 0x3f, 0x3e, 0x81, 0x3f, 0x00, 0x3e, 0x80, 0x3f, 0x0f, 0x37,
+  0x3f, 0x3f, 0x0e, 0x3f, 0x3b, 0x3b, 0x3f, 0x3f, 0x38, 0x2e, 0x3f, 0x37, 0x3f, 0x3d, 0x37, 0x80,
+  0x3f, 0x24, 0x2e, 0x3f, 0x3f, 0x27, 0x3d, 0x3f, 0x23, 0x3b, 0x1b, 0x19, 0x1b, 0x1b, 0x0b, 0x19,
+  0x1b, 0x19, 0x1b, 0x0b, 0x19, 0x1d, 0x1b, 0x1d, 0x1f, 0x3b, 0x3f, 0x1f, 0x37, 0x1f, 0x1f, 0x3e,
+  0x3f, 0x33, 0x3f, 0x1f, 0x37, 0x1f, 0x37, 0x83, 0x3f, 0x02, 0x37, 0x3f, 0x3e, 0x86, 0x3f, 0x01,
+  0x1f, 0x3e, 0x80, 0x3f, 0x00, 0x1f, 0x81, 0x3f, 0x0d, 0x38, 0x00, 0x01, 0x3a, 0x2b, 0x38, 0x3b,
+  0x23, 0x38, 0x3f, 0x38, 0x00, 0x00, 0x07, 0x82, 0x00, 0x0a, 0x03, 0x3f, 0x3a, 0x17, 0x0f, 0x3f,
+  0x38, 0x00, 0x08, 0x01, 0x00, 0x83, 0x3f, 0x00, 0x3d, 0x81, 0x00, 0x08, 0x08, 0x01, 0x33, 0x2a,
+  0x39, 0x3f, 0x38, 0x00, 0x00, 0x82, 0x3f, 0x05, 0x37, 0x38, 0x00, 0x01, 0x3f, 0x3b, 0x80, 0x3f,
+  0x00, 0x39, 0x82, 0x00, 0x11, 0x3b, 0x3b, 0x3f, 0x1f, 0x1f, 0x0e, 0x3f, 0x1e, 0x3b, 0x37, 0x17,
+  0x33, 0x37, 0x17, 0x17, 0x12, 0x12, 0x13, 0x87, 0x12, 0x00, 0x13, 0x81, 0x12, 0x00, 0x1a, 0x82,
+  0x12, 0x0c, 0x33, 0x33, 0x10, 0x00, 0x04, 0x00, 0x00, 0x02, 0x02, 0x3f, 0x17, 0x1e, 0x38, 0x83,
+  0x00, 0x09, 0x07, 0x3b, 0x3a, 0x3f, 0x3a, 0x3f, 0x1f, 0x1f, 0x31, 0x3e, 0x81, 0x3f, 0x03, 0x37,
+  0x3f, 0x3f, 0x3e, 0x83, 0x3f, 0x02, 0x3d, 0x3f, 0x37, 0x81, 0x3f, 0x18, 0x35, 0x1f, 0x3f, 0x3f,
+  0x3b, 0x3f, 0x3f, 0x35, 0x3e, 0x2f, 0x37, 0x3f, 0x3f, 0x35, 0x37, 0x3e, 0x3f, 0x3c, 0x3f, 0x3e,
+  0x3e, 0x3d, 0x33, 0x3b, 0x19, 0x82, 0x1b, 0x00, 0x19, 0x80, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x1f,
+  0x3b, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x37, 0x1f, 0x83, 0x3f, 0x00, 0x3b, 0x87, 0x3f, 0x07, 0x33,
+  0x3f, 0x3f, 0x1f, 0x3f, 0x3e, 0x3b, 0x37, 0x80, 0x3f, 0x16, 0x33, 0x3e, 0x3f, 0x3e, 0x3b, 0x37,
+  0x3f, 0x38, 0x08, 0x00, 0x0f, 0x1c, 0x1f, 0x0f, 0x19, 0x39, 0x3f, 0x38, 0x01, 0x00, 0x0f, 0x00,
+  0x18, 0x80, 0x00, 0x83, 0x3f, 0x00, 0x38, 0x80, 0x00, 0x00, 0x01, 0x80, 0x1f, 0x80, 0x3f, 0x00,
+  0x38, 0x82, 0x00, 0x08, 0x03, 0x39, 0x1f, 0x0f, 0x07, 0x39, 0x00, 0x08, 0x00, 0x82, 0x3f, 0x04,
+  0x38, 0x08, 0x07, 0x3f, 0x3a, 0x80, 0x3f, 0x02, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x39, 0x80,
+  0x3b, 0x0d, 0x3f, 0x17, 0x1f, 0x37, 0x17, 0x3a, 0x3f, 0x17, 0x3a, 0x3a, 0x3e, 0x1f, 0x37, 0x16,
+  0x81, 0x12, 0x02, 0x32, 0x1a, 0x16, 0x83, 0x12, 0x00, 0x13, 0x80, 0x12, 0x09, 0x13, 0x12, 0x12,
+  0x13, 0x12, 0x12, 0x10, 0x00, 0x20, 0x04, 0x80, 0x00, 0x03, 0x1e, 0x1f, 0x37, 0x18, 0x83, 0x00,
+  0x08, 0x07, 0x3e, 0x3f, 0x3e, 0x1f, 0x3b, 0x37, 0x37, 0x3c, 0x89, 0x3f, 0x04, 0x37, 0x3e, 0x3f,
+  0x26, 0x27, 0x80, 0x3f, 0x35, 0x3e, 0x3f, 0x3f, 0x26, 0x3b, 0x3b, 0x3f, 0x3b, 0x3f, 0x3f, 0x07,
+  0x3f, 0x2f, 0x3f, 0x35, 0x3f, 0x3c, 0x3f, 0x2e, 0x3f, 0x3e, 0x2f, 0x3d, 0x37, 0x20, 0x3f, 0x1b,
+  0x1b, 0x19, 0x1b, 0x0b, 0x19, 0x1b, 0x1b, 0x0b, 0x0b, 0x1b, 0x0b, 0x19, 0x1f, 0x1f, 0x3f, 0x1f,
+  0x3f, 0x3b, 0x3f, 0x1f, 0x3f, 0x3a, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x86, 0x3f, 0x00, 0x3b, 0x81,
+  0x3f, 0x01, 0x37, 0x3b, 0x80, 0x3f, 0x01, 0x3e, 0x3b, 0x81, 0x3f, 0x00, 0x1f, 0x81, 0x3f, 0x0e,
+  0x00, 0x00, 0x03, 0x2b, 0x39, 0x33, 0x2a, 0x38, 0x3f, 0x3b, 0x00, 0x00, 0x01, 0x00, 0x38, 0x80,
+  0x00, 0x00, 0x0f, 0x81, 0x3f, 0x00, 0x38, 0x81, 0x00, 0x00, 0x03, 0x80, 0x3f, 0x03, 0x1f, 0x3f,
+  0x3f, 0x38, 0x82, 0x00, 0x05, 0x01, 0x33, 0x2b, 0x33, 0x3b, 0x3f, 0x80, 0x00, 0x00, 0x03, 0x81,
+  0x3f, 0x01, 0x38, 0x00, 0x82, 0x3f, 0x00, 0x39, 0x82, 0x00, 0x00, 0x03, 0x80, 0x1f, 0x10, 0x3b,
+  0x38, 0x3f, 0x3a, 0x3b, 0x3e, 0x1f, 0x33, 0x3a, 0x3e, 0x1f, 0x17, 0x17, 0x13, 0x33, 0x16, 0x13,
+  0x81, 0x12, 0x00, 0x13, 0x86, 0x12, 0x06, 0x13, 0x12, 0x12, 0x1a, 0x12, 0x12, 0x1a, 0x80, 0x10,
+  0x07, 0x00, 0x20, 0x00, 0x02, 0x3f, 0x17, 0x1f, 0x10, 0x83, 0x00, 0x12, 0x1f, 0x13, 0x3a, 0x1f,
+  0x3a, 0x3f, 0x1f, 0x1f, 0x38, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x37, 0x3e, 0x82,
+  0x3f, 0x03, 0x24, 0x07, 0x3f, 0x37, 0x81, 0x3f, 0x16, 0x38, 0x3f, 0x3f, 0x1f, 0x3f, 0x1f, 0x1f,
+  0x3c, 0x17, 0x37, 0x37, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x2e, 0x3f, 0x37, 0x37, 0x3f, 0x38, 0x07,
+  0x83, 0x1b, 0x00, 0x19, 0x82, 0x1b, 0x03, 0x1f, 0x3b, 0x3f, 0x1f, 0x82, 0x3f, 0x08, 0x37, 0x3f,
+  0x3a, 0x3f, 0x1f, 0x3a, 0x3f, 0x3f, 0x37, 0x84, 0x3f, 0x00, 0x3e, 0x82, 0x3f, 0x00, 0x3e, 0x80,
+  0x3f, 0x0a, 0x1f, 0x3f, 0x37, 0x3f, 0x3b, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x80, 0x00, 0x06,
+  0x1f, 0x07, 0x19, 0x3b, 0x2b, 0x3f, 0x3f, 0x80, 0x00, 0x01, 0x01, 0x38, 0x80, 0x00, 0x00, 0x07,
+  0x80, 0x3f, 0x00, 0x39, 0x82, 0x00, 0x00, 0x07, 0x80, 0x1f, 0x80, 0x3f, 0x00, 0x38, 0x82, 0x00,
+  0x06, 0x07, 0x0f, 0x15, 0x1d, 0x1d, 0x3f, 0x38, 0x80, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x01, 0x00,
+  0x0f, 0x82, 0x3f, 0x00, 0x38, 0x80, 0x00, 0x16, 0x01, 0x00, 0x05, 0x1f, 0x0f, 0x1d, 0x1f, 0x13,
+  0x3b, 0x37, 0x3f, 0x33, 0x3e, 0x3b, 0x37, 0x33, 0x3e, 0x1e, 0x3a, 0x3f, 0x17, 0x33, 0x1e, 0x84,
+  0x12, 0x00, 0x1a, 0x80, 0x12, 0x00, 0x16, 0x86, 0x12, 0x80, 0x10, 0x06, 0x12, 0x02, 0x04, 0x00,
+  0x3a, 0x3b, 0x37, 0x84, 0x00, 0x08, 0x3f, 0x3e, 0x1f, 0x3e, 0x1f, 0x33, 0x37, 0x17, 0x3e, 0x81,
+  0x3f, 0x00, 0x3e, 0x83, 0x3f, 0x0d, 0x3e, 0x3f, 0x3f, 0x37, 0x26, 0x20, 0x3f, 0x3f, 0x3e, 0x3f,
+  0x37, 0x3e, 0x3f, 0x27, 0x80, 0x3b, 0x12, 0x3f, 0x3b, 0x3f, 0x38, 0x27, 0x3d, 0x37, 0x3d, 0x37,
+  0x35, 0x3f, 0x37, 0x3c, 0x3f, 0x2f, 0x2e, 0x38, 0x27, 0x3b, 0x81, 0x1b, 0x03, 0x0b, 0x1b, 0x1b,
+  0x0b, 0x80, 0x19, 0x03, 0x1f, 0x1f, 0x17, 0x3b, 0x82, 0x3f, 0x01, 0x1f, 0x1f, 0x83, 0x3f, 0x01,
+  0x1f, 0x3b, 0x84, 0x3f, 0x13, 0x3e, 0x1f, 0x37, 0x3f, 0x3b, 0x3f, 0x3a, 0x3f, 0x37, 0x3f, 0x3f,
+  0x3b, 0x37, 0x37, 0x3f, 0x3f, 0x17, 0x3b, 0x3f, 0x3f, 0x81, 0x00, 0x06, 0x0b, 0x27, 0x1c, 0x1b,
+  0x07, 0x3f, 0x39, 0x80, 0x00, 0x04, 0x38, 0x08, 0x00, 0x00, 0x04, 0x80, 0x3f, 0x08, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x01, 0x1d, 0x1f, 0x1f, 0x81, 0x3f, 0x00, 0x38, 0x82, 0x00, 0x06, 0x01, 0x3b,
+  0x2b, 0x38, 0x1e, 0x0f, 0x38, 0x84, 0x00, 0x00, 0x07, 0x82, 0x3f, 0x07, 0x39, 0x00, 0x00, 0x08,
+  0x3f, 0x00, 0x00, 0x0b, 0x81, 0x3b, 0x0b, 0x07, 0x3e, 0x3b, 0x37, 0x1e, 0x3b, 0x37, 0x1e, 0x1f,
+  0x33, 0x3b, 0x37, 0x80, 0x17, 0x02, 0x33, 0x3a, 0x3a, 0x84, 0x12, 0x03, 0x13, 0x12, 0x12, 0x13,
+  0x82, 0x12, 0x02, 0x1a, 0x13, 0x12, 0x84, 0x10, 0x02, 0x1e, 0x1e, 0x1f, 0x83, 0x00, 0x05, 0x02,
+  0x3a, 0x3b, 0x3a, 0x3b, 0x33, 0x80, 0x3b, 0x01, 0x38, 0x3e, 0x83, 0x3f, 0x03, 0x37, 0x3f, 0x3f,
+  0x3e, 0x80, 0x3f, 0x03, 0x3c, 0x21, 0x3f, 0x27, 0x83, 0x3f, 0x19, 0x33, 0x3f, 0x33, 0x3f, 0x1f,
+  0x1f, 0x1b, 0x3f, 0x1c, 0x3f, 0x3f, 0x37, 0x3d, 0x3f, 0x35, 0x3f, 0x37, 0x3c, 0x3e, 0x3f, 0x3c,
+  0x3a, 0x3b, 0x19, 0x1b, 0x0b, 0x80, 0x1b, 0x00, 0x0b, 0x80, 0x1b, 0x15, 0x3b, 0x33, 0x3b, 0x3b,
+  0x3e, 0x1f, 0x1f, 0x3f, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x3e, 0x1f, 0x3e, 0x3f,
+  0x3f, 0x1f, 0x85, 0x3f, 0x80, 0x37, 0x05, 0x3f, 0x3f, 0x1f, 0x37, 0x1e, 0x3f, 0x80, 0x3e, 0x0f,
+  0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x39, 0x00, 0x08, 0x00, 0x00, 0x1d, 0x1b, 0x2f, 0x0f, 0x3f, 0x3f,
+  0x81, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0x3f, 0x3f, 0x38, 0x83, 0x00, 0x01, 0x1f, 0x1d, 0x80,
+  0x3b, 0x01, 0x3f, 0x3b, 0x83, 0x00, 0x06, 0x01, 0x15, 0x1e, 0x0f, 0x1d, 0x1f, 0x3b, 0x85, 0x00,
+  0x82, 0x3f, 0x0c, 0x38, 0x00, 0x00, 0x03, 0x3f, 0x38, 0x00, 0x01, 0x3b, 0x39, 0x3b, 0x38, 0x3f,
+  0x81, 0x37, 0x08, 0x3e, 0x1f, 0x33, 0x3e, 0x1e, 0x3e, 0x3a, 0x3e, 0x37, 0x81, 0x17, 0x05, 0x1e,
+  0x1a, 0x12, 0x1e, 0x12, 0x16, 0x80, 0x12, 0x00, 0x1a, 0x81, 0x12, 0x00, 0x1a, 0x80, 0x12, 0x01,
+  0x13, 0x12, 0x83, 0x02, 0x80, 0x12, 0x83, 0x00, 0x0f, 0x07, 0x3a, 0x3a, 0x3b, 0x33, 0x3b, 0x33,
+  0x37, 0x17, 0x3f, 0x27, 0x3f, 0x37, 0x3e, 0x3f, 0x3e, 0x80, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x0d,
+  0x37, 0x3c, 0x07, 0x3f, 0x1e, 0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x3c, 0x27, 0x3f, 0x82, 0x1b,
+  0x0e, 0x3f, 0x04, 0x37, 0x2f, 0x3e, 0x3e, 0x3f, 0x35, 0x3d, 0x37, 0x3f, 0x35, 0x37, 0x38, 0x3b,
+  0x82, 0x1b, 0x1a, 0x0b, 0x1b, 0x1b, 0x0b, 0x1b, 0x1f, 0x3b, 0x3f, 0x1f, 0x3f, 0x27, 0x37, 0x33,
+  0x3f, 0x3f, 0x1f, 0x3f, 0x3b, 0x3f, 0x1e, 0x3e, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x85, 0x3f,
+  0x04, 0x37, 0x37, 0x3f, 0x3f, 0x37, 0x80, 0x3f, 0x03, 0x36, 0x3c, 0x3e, 0x3e, 0x80, 0x3f, 0x02,
+  0x3a, 0x3f, 0x38, 0x81, 0x00, 0x06, 0x1e, 0x0f, 0x13, 0x07, 0x3f, 0x3f, 0x38, 0x80, 0x00, 0x14,
+  0x07, 0x08, 0x00, 0x00, 0x0f, 0x3f, 0x00, 0x08, 0x00, 0x01, 0x00, 0x01, 0x00, 0x2b, 0x3b, 0x3f,
+  0x1f, 0x3f, 0x3b, 0x39, 0x38, 0x82, 0x00, 0x0f, 0x03, 0x3b, 0x2b, 0x39, 0x3a, 0x2b, 0x3f, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x81, 0x3f, 0x80, 0x00, 0x04, 0x07, 0x3f, 0x3b,
+  0x00, 0x00, 0x80, 0x1f, 0x10, 0x0f, 0x3f, 0x37, 0x36, 0x3e, 0x1f, 0x17, 0x3e, 0x1f, 0x33, 0x3b,
+  0x33, 0x36, 0x33, 0x36, 0x3a, 0x3e, 0x80, 0x1e, 0x01, 0x3e, 0x1e, 0x85, 0x12, 0x03, 0x13, 0x32,
+  0x12, 0x32, 0x81, 0x12, 0x84, 0x10, 0x01, 0x1a, 0x13, 0x80, 0x10, 0x81, 0x00, 0x0a, 0x17, 0x17,
+  0x33, 0x33, 0x3a, 0x3e, 0x1f, 0x1e, 0x1e, 0x3f, 0x17, 0x8a, 0x3f, 0x03, 0x38, 0x3f, 0x3f, 0x38,
+  0x82, 0x3f, 0x03, 0x37, 0x3f, 0x1e, 0x1f, 0x82, 0x1b, 0x0e, 0x1f, 0x3b, 0x27, 0x37, 0x3d, 0x3f,
+  0x2e, 0x3f, 0x37, 0x3c, 0x3e, 0x2f, 0x3c, 0x38, 0x3b, 0x80, 0x1b, 0x1f, 0x0b, 0x11, 0x1a, 0x19,
+  0x1b, 0x1b, 0x3f, 0x17, 0x1f, 0x17, 0x37, 0x17, 0x37, 0x27, 0x3f, 0x33, 0x3f, 0x3e, 0x1f, 0x3e,
+  0x3f, 0x37, 0x27, 0x36, 0x3f, 0x37, 0x1f, 0x3f, 0x3f, 0x17, 0x3e, 0x3e, 0x80, 0x37, 0x0a, 0x33,
+  0x3f, 0x35, 0x37, 0x33, 0x37, 0x1f, 0x37, 0x1f, 0x3e, 0x3d, 0x80, 0x37, 0x02, 0x3e, 0x3f, 0x17,
+  0x80, 0x3f, 0x06, 0x00, 0x00, 0x08, 0x00, 0x01, 0x1d, 0x1d, 0x81, 0x3f, 0x01, 0x08, 0x01, 0x80,
+  0x00, 0x03, 0x01, 0x00, 0x07, 0x39, 0x80, 0x00, 0x0b, 0x1f, 0x38, 0x00, 0x00, 0x01, 0x3b, 0x39,
+  0x3f, 0x1f, 0x11, 0x37, 0x38, 0x83, 0x00, 0x08, 0x2b, 0x31, 0x1e, 0x0f, 0x1c, 0x3f, 0x38, 0x00,
+  0x08, 0x83, 0x00, 0x80, 0x3f, 0x00, 0x3b, 0x80, 0x00, 0x80, 0x3f, 0x0d, 0x38, 0x00, 0x05, 0x19,
+  0x3b, 0x07, 0x37, 0x34, 0x3e, 0x27, 0x36, 0x3f, 0x1f, 0x33, 0x80, 0x3e, 0x0d, 0x37, 0x34, 0x33,
+  0x36, 0x3a, 0x3b, 0x37, 0x17, 0x17, 0x3a, 0x3a, 0x32, 0x12, 0x16, 0x86, 0x12, 0x00, 0x32, 0x80,
+  0x12, 0x83, 0x02, 0x80, 0x12, 0x00, 0x00, 0x82, 0x10, 0x1f, 0x13, 0x32, 0x17, 0x33, 0x33, 0x3b,
+  0x33, 0x33, 0x3a, 0x3f, 0x27, 0x3f, 0x3f, 0x3d, 0x3e, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x37,
+  0x3e, 0x3f, 0x38, 0x3f, 0x33, 0x3f, 0x27, 0x3f, 0x3d, 0x3e, 0x80, 0x3f, 0x02, 0x3d, 0x07, 0x3b,
+  0x82, 0x1b, 0x0d, 0x1f, 0x39, 0x04, 0x3e, 0x3e, 0x3f, 0x37, 0x3c, 0x3f, 0x3f, 0x3e, 0x3f, 0x31,
+  0x3b, 0x82, 0x1b, 0x03, 0x19, 0x1f, 0x13, 0x1b, 0x80, 0x3b, 0x07, 0x3f, 0x1e, 0x2e, 0x2e, 0x3e,
+  0x36, 0x3f, 0x3a, 0x80, 0x3f, 0x80, 0x37, 0x10, 0x27, 0x26, 0x3f, 0x3f, 0x3a, 0x3f, 0x3f, 0x1f,
+  0x37, 0x35, 0x36, 0x2e, 0x3f, 0x37, 0x37, 0x35, 0x37, 0x80, 0x3f, 0x03, 0x37, 0x3e, 0x36, 0x3e,
+  0x86, 0x3f, 0x00, 0x08, 0x80, 0x00, 0x02, 0x3a, 0x39, 0x15, 0x80, 0x3f, 0x00, 0x38, 0x83, 0x00,
+  0x06, 0x02, 0x28, 0x00, 0x00, 0x0f, 0x3f, 0x39, 0x80, 0x00, 0x80, 0x1f, 0x03, 0x0d, 0x3f, 0x3f,
+  0x38, 0x82, 0x00, 0x0a, 0x01, 0x1f, 0x0f, 0x1d, 0x1b, 0x2b, 0x0f, 0x39, 0x00, 0x00, 0x01, 0x82,
+  0x00, 0x06, 0x07, 0x3f, 0x3f, 0x38, 0x00, 0x08, 0x01, 0x80, 0x3f, 0x1d, 0x38, 0x00, 0x0b, 0x3b,
+  0x39, 0x17, 0x3e, 0x3e, 0x37, 0x36, 0x2e, 0x3e, 0x3f, 0x3f, 0x17, 0x1e, 0x3e, 0x0e, 0x37, 0x34,
+  0x3a, 0x3e, 0x3a, 0x3b, 0x33, 0x3f, 0x17, 0x36, 0x1e, 0x32, 0x81, 0x12, 0x00, 0x1a, 0x83, 0x12,
+  0x02, 0x13, 0x12, 0x18, 0x83, 0x10, 0x01, 0x13, 0x13, 0x84, 0x02, 0x06, 0x1a, 0x13, 0x12, 0x13,
+  0x12, 0x1a, 0x1f, 0x80, 0x17, 0x02, 0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x00, 0x37, 0x80, 0x3f, 0x00,
+  0x37, 0x80, 0x3f, 0x0f, 0x35, 0x37, 0x1f, 0x3f, 0x15, 0x37, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x3e,
+  0x38, 0x3b, 0x1b, 0x13, 0x81, 0x1b, 0x0c, 0x1f, 0x3a, 0x2f, 0x2f, 0x35, 0x3d, 0x37, 0x3c, 0x3c,
+  0x3f, 0x27, 0x27, 0x3b, 0x80, 0x1b, 0x0e, 0x11, 0x1a, 0x1b, 0x13, 0x0f, 0x33, 0x3b, 0x3f, 0x17,
+  0x3b, 0x35, 0x37, 0x37, 0x27, 0x2e, 0x80, 0x3f, 0x04, 0x17, 0x3b, 0x3c, 0x37, 0x36, 0x80, 0x3e,
+  0x80, 0x3f, 0x0f, 0x37, 0x37, 0x27, 0x36, 0x3e, 0x3e, 0x37, 0x3f, 0x3e, 0x37, 0x37, 0x3f, 0x37,
+  0x1f, 0x3f, 0x37, 0x80, 0x3f, 0x0e, 0x37, 0x37, 0x3a, 0x3f, 0x33, 0x37, 0x3e, 0x3f, 0x3f, 0x20,
+  0x08, 0x00, 0x07, 0x0f, 0x18, 0x81, 0x3f, 0x02, 0x38, 0x00, 0x08, 0x84, 0x00, 0x80, 0x3f, 0x09,
+  0x08, 0x08, 0x00, 0x05, 0x1f, 0x09, 0x37, 0x3e, 0x3e, 0x38, 0x83, 0x00, 0x06, 0x31, 0x3a, 0x2b,
+  0x31, 0x3a, 0x3f, 0x3f, 0x80, 0x00, 0x07, 0x18, 0x01, 0x00, 0x07, 0x00, 0x00, 0x07, 0x3f, 0x80,
+  0x00, 0x00, 0x06, 0x81, 0x3f, 0x1f, 0x08, 0x00, 0x01, 0x18, 0x3f, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e,
+  0x3f, 0x17, 0x17, 0x3e, 0x3f, 0x36, 0x36, 0x3a, 0x3e, 0x36, 0x1e, 0x1f, 0x33, 0x37, 0x17, 0x3e,
+  0x1e, 0x36, 0x1e, 0x3a, 0x3a, 0x33, 0x88, 0x12, 0x83, 0x02, 0x01, 0x12, 0x12, 0x80, 0x10, 0x11,
+  0x02, 0x00, 0x10, 0x13, 0x12, 0x12, 0x13, 0x12, 0x1a, 0x13, 0x12, 0x1a, 0x1a, 0x17, 0x1c, 0x3f,
+  0x3f, 0x3e, 0x80, 0x3f, 0x01, 0x3d, 0x35, 0x83, 0x3f, 0x08, 0x07, 0x1a, 0x1b, 0x38, 0x3f, 0x3f,
+  0x37, 0x3f, 0x3d, 0x80, 0x3f, 0x12, 0x17, 0x3b, 0x1b, 0x13, 0x13, 0x1a, 0x1a, 0x1b, 0x3f, 0x38,
+  0x36, 0x3f, 0x3e, 0x3d, 0x37, 0x3f, 0x37, 0x27, 0x07, 0x84, 0x1b, 0x2e, 0x0b, 0x3a, 0x3b, 0x3a,
+  0x3b, 0x3f, 0x1e, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x3b, 0x37, 0x3f, 0x3e, 0x3e, 0x2e, 0x35,
+  0x37, 0x35, 0x37, 0x3a, 0x3f, 0x33, 0x3f, 0x3f, 0x36, 0x2e, 0x3c, 0x3e, 0x2e, 0x3f, 0x35, 0x36,
+  0x3e, 0x3b, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x3e, 0x81, 0x3f, 0x09, 0x37, 0x3f,
+  0x3f, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x3b, 0x80, 0x3f, 0x01, 0x38, 0x08, 0x83, 0x00, 0x01,
+  0x08, 0x07, 0x80, 0x3f, 0x00, 0x38, 0x81, 0x00, 0x04, 0x06, 0x3f, 0x3e, 0x3e, 0x3f, 0x82, 0x00,
+  0x12, 0x08, 0x00, 0x01, 0x3b, 0x2b, 0x39, 0x38, 0x3f, 0x38, 0x08, 0x00, 0x20, 0x03, 0x00, 0x00,
+  0x39, 0x00, 0x01, 0x3f, 0x80, 0x00, 0x00, 0x0f, 0x81, 0x3f, 0x00, 0x38, 0x80, 0x00, 0x1e, 0x07,
+  0x3e, 0x37, 0x36, 0x3e, 0x37, 0x33, 0x3f, 0x3e, 0x1f, 0x17, 0x27, 0x35, 0x36, 0x37, 0x27, 0x37,
+  0x33, 0x3e, 0x1f, 0x3f, 0x37, 0x30, 0x3e, 0x26, 0x16, 0x33, 0x32, 0x33, 0x12, 0x13, 0x82, 0x12,
+  0x02, 0x32, 0x12, 0x12, 0x83, 0x02, 0x03, 0x13, 0x10, 0x02, 0x00, 0x80, 0x10, 0x0c, 0x02, 0x12,
+  0x1a, 0x1a, 0x12, 0x13, 0x13, 0x12, 0x1a, 0x12, 0x12, 0x1e, 0x38, 0x81, 0x3f, 0x1a, 0x37, 0x3f,
+  0x26, 0x24, 0x37, 0x3d, 0x3e, 0x3f, 0x37, 0x3f, 0x33, 0x3b, 0x1b, 0x3f, 0x07, 0x3f, 0x3d, 0x3e,
+  0x3f, 0x37, 0x3e, 0x3d, 0x35, 0x3f, 0x13, 0x1b, 0x1a, 0x81, 0x1b, 0x09, 0x3f, 0x0c, 0x27, 0x35,
+  0x3e, 0x3d, 0x35, 0x38, 0x22, 0x3f, 0x80, 0x1b, 0x14, 0x19, 0x13, 0x38, 0x1b, 0x33, 0x27, 0x1f,
+  0x3b, 0x3f, 0x1f, 0x3e, 0x2e, 0x3c, 0x3c, 0x3e, 0x27, 0x33, 0x3f, 0x3f, 0x1e, 0x3f, 0x80, 0x37,
+  0x02, 0x34, 0x3e, 0x3e, 0x80, 0x3f, 0x81, 0x3e, 0x07, 0x37, 0x36, 0x3e, 0x3f, 0x37, 0x35, 0x37,
+  0x3e, 0x84, 0x3f, 0x18, 0x37, 0x36, 0x3f, 0x33, 0x3e, 0x1f, 0x3e, 0x3e, 0x3f, 0x08, 0x00, 0x01,
+  0x18, 0x19, 0x19, 0x08, 0x01, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x01, 0x80, 0x00, 0x82,
+  0x3f, 0x01, 0x00, 0x01, 0x80, 0x00, 0x03, 0x07, 0x3e, 0x2e, 0x3f, 0x85, 0x00, 0x05, 0x0a, 0x39,
+  0x31, 0x3b, 0x3f, 0x3f, 0x80, 0x00, 0x0a, 0x04, 0x38, 0x00, 0x3f, 0x38, 0x00, 0x00, 0x01, 0x00,
+  0x08, 0x07, 0x81, 0x3f, 0x00, 0x3b, 0x81, 0x00, 0x21, 0x3f, 0x3e, 0x27, 0x35, 0x35, 0x37, 0x3e,
+  0x3b, 0x37, 0x3f, 0x36, 0x3e, 0x37, 0x27, 0x36, 0x36, 0x1f, 0x33, 0x37, 0x33, 0x3a, 0x3e, 0x37,
+  0x17, 0x37, 0x36, 0x1f, 0x17, 0x33, 0x32, 0x12, 0x16, 0x12, 0x32, 0x80, 0x12, 0x00, 0x1a, 0x83,
+  0x10, 0x02, 0x02, 0x10, 0x10, 0x82, 0x02, 0x0d, 0x1a, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12,
+  0x1a, 0x1a, 0x13, 0x38, 0x3f, 0x3e, 0x80, 0x3f, 0x04, 0x3e, 0x25, 0x24, 0x07, 0x37, 0x81, 0x3f,
+  0x06, 0x38, 0x3f, 0x1a, 0x1f, 0x3c, 0x3f, 0x3e, 0x80, 0x3f, 0x14, 0x2f, 0x3f, 0x3e, 0x03, 0x3f,
+  0x1a, 0x1b, 0x1a, 0x1b, 0x13, 0x1b, 0x1f, 0x3b, 0x38, 0x06, 0x27, 0x3e, 0x3c, 0x04, 0x1f, 0x3b,
+  0x83, 0x1b, 0x07, 0x1c, 0x1e, 0x3a, 0x37, 0x1e, 0x3b, 0x33, 0x3a, 0x83, 0x3e, 0x02, 0x3f, 0x1e,
+  0x3f, 0x80, 0x3e, 0x0c, 0x2e, 0x3e, 0x3e, 0x37, 0x3f, 0x33, 0x3e, 0x1f, 0x3c, 0x35, 0x37, 0x27,
+  0x35, 0x82, 0x37, 0x81, 0x3f, 0x0c, 0x3e, 0x3f, 0x37, 0x37, 0x27, 0x27, 0x3b, 0x3f, 0x3f, 0x3e,
+  0x3f, 0x37, 0x37, 0x80, 0x00, 0x0f, 0x21, 0x04, 0x02, 0x28, 0x18, 0x19, 0x01, 0x00, 0x08, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x08, 0x01, 0x82, 0x3f, 0x00, 0x38, 0x82, 0x00, 0x03, 0x3f, 0x37, 0x37,
+  0x38, 0x82, 0x00, 0x07, 0x01, 0x00, 0x07, 0x0f, 0x1f, 0x07, 0x0f, 0x3f, 0x81, 0x00, 0x03, 0x08,
+  0x00, 0x07, 0x39, 0x82, 0x00, 0x82, 0x3f, 0x2a, 0x3c, 0x08, 0x00, 0x00, 0x01, 0x3e, 0x27, 0x37,
+  0x36, 0x3e, 0x3b, 0x33, 0x3f, 0x3b, 0x36, 0x3e, 0x27, 0x36, 0x36, 0x1e, 0x3b, 0x37, 0x1f, 0x3b,
+  0x3f, 0x37, 0x32, 0x26, 0x32, 0x2a, 0x33, 0x33, 0x3a, 0x3a, 0x3b, 0x36, 0x1a, 0x12, 0x13, 0x12,
+  0x12, 0x1a, 0x12, 0x83, 0x02, 0x00, 0x12, 0x80, 0x02, 0x2e, 0x00, 0x10, 0x02, 0x02, 0x12, 0x1a,
+  0x1e, 0x12, 0x13, 0x13, 0x12, 0x1a, 0x1a, 0x13, 0x12, 0x3f, 0x27, 0x3f, 0x3f, 0x37, 0x3f, 0x20,
+  0x22, 0x03, 0x38, 0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x3c, 0x1f, 0x13, 0x1a, 0x3a, 0x2e, 0x3f, 0x3f,
+  0x37, 0x3e, 0x3f, 0x37, 0x3f, 0x3c, 0x1f, 0x1b, 0x1a, 0x82, 0x1b, 0x07, 0x1f, 0x1f, 0x3b, 0x2a,
+  0x21, 0x17, 0x3b, 0x3f, 0x81, 0x1b, 0x1d, 0x1a, 0x19, 0x17, 0x37, 0x35, 0x17, 0x3b, 0x3b, 0x3f,
+  0x3f, 0x3e, 0x2e, 0x27, 0x35, 0x37, 0x27, 0x37, 0x3e, 0x3f, 0x3b, 0x3f, 0x34, 0x3e, 0x37, 0x26,
+  0x3c, 0x3e, 0x1f, 0x3f, 0x3f, 0x80, 0x3e, 0x08, 0x37, 0x36, 0x3e, 0x3e, 0x3b, 0x3e, 0x2e, 0x37,
+  0x33, 0x81, 0x3f, 0x01, 0x3e, 0x3f, 0x82, 0x37, 0x17, 0x3e, 0x3b, 0x3e, 0x3e, 0x3f, 0x20, 0x08,
+  0x00, 0x08, 0x03, 0x09, 0x0a, 0x0c, 0x0c, 0x18, 0x38, 0x18, 0x19, 0x11, 0x03, 0x01, 0x00, 0x00,
+  0x17, 0x82, 0x3f, 0x09, 0x39, 0x00, 0x00, 0x08, 0x01, 0x00, 0x3e, 0x3e, 0x37, 0x39, 0x85, 0x00,
+  0x07, 0x3b, 0x15, 0x1f, 0x1f, 0x3f, 0x3b, 0x00, 0x08, 0x87, 0x00, 0x82, 0x3f, 0x04, 0x3a, 0x39,
+  0x00, 0x08, 0x04, 0x80, 0x3e, 0x16, 0x27, 0x37, 0x37, 0x3f, 0x33, 0x37, 0x3b, 0x27, 0x37, 0x35,
+  0x37, 0x34, 0x3e, 0x1f, 0x33, 0x37, 0x3f, 0x3e, 0x37, 0x33, 0x37, 0x36, 0x3e, 0x82, 0x1e, 0x01,
+  0x16, 0x3e, 0x83, 0x12, 0x82, 0x02, 0x00, 0x00, 0x83, 0x10, 0x0d, 0x13, 0x13, 0x12, 0x12, 0x1a,
+  0x13, 0x12, 0x1a, 0x13, 0x12, 0x1a, 0x13, 0x17, 0x17, 0x81, 0x3f, 0x03, 0x3c, 0x1f, 0x3f, 0x3c,
+  0x81, 0x3f, 0x14, 0x37, 0x3f, 0x07, 0x1a, 0x1b, 0x1f, 0x07, 0x3f, 0x3f, 0x3c, 0x3f, 0x3f, 0x3e,
+  0x3f, 0x37, 0x07, 0x3e, 0x1b, 0x1b, 0x13, 0x13, 0x81, 0x1b, 0x04, 0x1f, 0x3f, 0x3f, 0x3b, 0x3b,
+  0x83, 0x1b, 0x09, 0x1e, 0x3a, 0x2a, 0x3a, 0x3c, 0x3a, 0x3b, 0x33, 0x3a, 0x3b, 0x80, 0x37, 0x09,
+  0x36, 0x3e, 0x3b, 0x3f, 0x1f, 0x3f, 0x37, 0x3e, 0x3c, 0x3e, 0x80, 0x37, 0x0c, 0x3e, 0x1f, 0x37,
+  0x1f, 0x37, 0x37, 0x27, 0x35, 0x36, 0x2e, 0x3f, 0x37, 0x37, 0x83, 0x3f, 0x0c, 0x37, 0x26, 0x3c,
+  0x37, 0x37, 0x3b, 0x3f, 0x1f, 0x3f, 0x3f, 0x37, 0x37, 0x38, 0x81, 0x00, 0x14, 0x22, 0x0c, 0x18,
+  0x18, 0x0b, 0x01, 0x21, 0x21, 0x07, 0x01, 0x03, 0x01, 0x11, 0x01, 0x01, 0x15, 0x17, 0x3f, 0x3f,
+  0x38, 0x18, 0x80, 0x00, 0x05, 0x01, 0x3f, 0x27, 0x37, 0x37, 0x3b, 0x84, 0x00, 0x09, 0x0f, 0x0f,
+  0x0e, 0x0e, 0x3f, 0x3f, 0x28, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x08, 0x21, 0x01, 0x15, 0x15,
+  0x19, 0x3a, 0x08, 0x00, 0x03, 0x3e, 0x3e, 0x27, 0x36, 0x3e, 0x3b, 0x3f, 0x3f, 0x3a, 0x3e, 0x3e,
+  0x36, 0x3e, 0x3c, 0x3e, 0x3b, 0x37, 0x17, 0x3f, 0x3f, 0x1e, 0x2e, 0x36, 0x2e, 0x17, 0x17, 0x80,
+  0x33, 0x08, 0x37, 0x17, 0x32, 0x33, 0x36, 0x3a, 0x32, 0x12, 0x1a, 0x84, 0x10, 0x02, 0x02, 0x00,
+  0x10, 0x80, 0x02, 0x0e, 0x12, 0x12, 0x13, 0x13, 0x12, 0x12, 0x1a, 0x13, 0x12, 0x1a, 0x12, 0x1a,
+  0x3f, 0x07, 0x3e, 0x80, 0x3f, 0x19, 0x33, 0x3b, 0x1b, 0x3b, 0x27, 0x37, 0x3f, 0x37, 0x3f, 0x3f,
+  0x37, 0x3b, 0x1a, 0x1f, 0x3c, 0x3e, 0x3f, 0x3f, 0x3e, 0x3d, 0x3f, 0x2e, 0x3f, 0x3c, 0x1f, 0x1a,
+  0x8e, 0x1b, 0x19, 0x3b, 0x37, 0x27, 0x37, 0x37, 0x3b, 0x3b, 0x3f, 0x1f, 0x3b, 0x3f, 0x37, 0x35,
+  0x36, 0x2e, 0x3c, 0x3e, 0x3f, 0x37, 0x17, 0x3b, 0x37, 0x37, 0x35, 0x37, 0x26, 0x80, 0x3f, 0x01,
+  0x1f, 0x37, 0x82, 0x3e, 0x04, 0x3f, 0x3e, 0x34, 0x3e, 0x3a, 0x82, 0x3f, 0x81, 0x3e, 0x04, 0x3b,
+  0x3e, 0x3f, 0x37, 0x33, 0x80, 0x37, 0x19, 0x3f, 0x00, 0x08, 0x00, 0x00, 0x01, 0x11, 0x01, 0x03,
+  0x05, 0x03, 0x0a, 0x0a, 0x08, 0x18, 0x38, 0x2b, 0x05, 0x07, 0x07, 0x01, 0x01, 0x00, 0x08, 0x03,
+  0x39, 0x80, 0x00, 0x05, 0x04, 0x3e, 0x3e, 0x2e, 0x3f, 0x3f, 0x85, 0x00, 0x02, 0x03, 0x03, 0x39,
+  0x80, 0x3f, 0x01, 0x00, 0x08, 0x82, 0x00, 0x1f, 0x08, 0x09, 0x11, 0x03, 0x07, 0x03, 0x07, 0x01,
+  0x01, 0x33, 0x2b, 0x38, 0x00, 0x04, 0x3f, 0x37, 0x3e, 0x3f, 0x33, 0x3e, 0x3e, 0x3a, 0x3f, 0x3f,
+  0x3e, 0x3f, 0x26, 0x3e, 0x33, 0x3e, 0x3b, 0x3e, 0x80, 0x3f, 0x12, 0x33, 0x37, 0x36, 0x3e, 0x3e,
+  0x1f, 0x33, 0x3e, 0x1f, 0x17, 0x17, 0x26, 0x3e, 0x17, 0x33, 0x3b, 0x32, 0x12, 0x00, 0x86, 0x10,
+  0x31, 0x02, 0x02, 0x1a, 0x13, 0x32, 0x12, 0x12, 0x1a, 0x13, 0x12, 0x1a, 0x13, 0x13, 0x12, 0x13,
+  0x2e, 0x3f, 0x3f, 0x3e, 0x3f, 0x27, 0x3b, 0x12, 0x1f, 0x07, 0x3f, 0x3d, 0x3f, 0x3f, 0x37, 0x38,
+  0x3f, 0x1b, 0x13, 0x3b, 0x27, 0x3d, 0x37, 0x3f, 0x3e, 0x3e, 0x3f, 0x3f, 0x37, 0x07, 0x3f, 0x1a,
+  0x1a, 0x1b, 0x1a, 0x84, 0x1b, 0x00, 0x13, 0x81, 0x1b, 0x0c, 0x1f, 0x17, 0x1f, 0x1e, 0x1f, 0x15,
+  0x17, 0x17, 0x3f, 0x3f, 0x1f, 0x37, 0x1f, 0x81, 0x37, 0x06, 0x3b, 0x3f, 0x1f, 0x3f, 0x3f, 0x3e,
+  0x3e, 0x80, 0x37, 0x42, 0x3e, 0x3b, 0x37, 0x37, 0x3f, 0x1f, 0x3e, 0x35, 0x36, 0x2e, 0x3e, 0x1f,
+  0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x1f, 0x33, 0x3a, 0x3f, 0x37, 0x27, 0x37, 0x3e, 0x3f, 0x1f, 0x3b,
+  0x3f, 0x3b, 0x3f, 0x37, 0x37, 0x38, 0x00, 0x01, 0x00, 0x01, 0x07, 0x0a, 0x28, 0x18, 0x1c, 0x08,
+  0x1d, 0x03, 0x21, 0x01, 0x11, 0x03, 0x01, 0x01, 0x15, 0x11, 0x03, 0x07, 0x39, 0x38, 0x08, 0x01,
+  0x00, 0x07, 0x3f, 0x37, 0x3f, 0x3f, 0x3c, 0x83, 0x00, 0x3d, 0x08, 0x00, 0x08, 0x08, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x08, 0x08, 0x09, 0x19, 0x38, 0x1c, 0x1c, 0x0c, 0x18, 0x08, 0x1c, 0x08,
+  0x18, 0x1f, 0x0f, 0x15, 0x1d, 0x00, 0x0f, 0x3f, 0x3f, 0x37, 0x37, 0x3f, 0x3b, 0x3b, 0x3f, 0x3a,
+  0x3a, 0x3b, 0x36, 0x3e, 0x3e, 0x3f, 0x33, 0x3e, 0x3b, 0x3f, 0x3f, 0x33, 0x37, 0x30, 0x3a, 0x3a,
+  0x3b, 0x33, 0x3e, 0x1f, 0x17, 0x33, 0x3a, 0x3a, 0x80, 0x33, 0x04, 0x32, 0x3f, 0x18, 0x02, 0x00,
+  0x82, 0x10, 0x82, 0x02, 0x01, 0x12, 0x12, 0x80, 0x13, 0x14, 0x12, 0x1a, 0x13, 0x12, 0x1a, 0x12,
+  0x1a, 0x1f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x17, 0x1a, 0x1a, 0x1f, 0x37, 0x3e, 0x3f, 0x3e, 0x80,
+  0x3f, 0x0f, 0x07, 0x1a, 0x1b, 0x3b, 0x27, 0x3e, 0x3f, 0x27, 0x3f, 0x3f, 0x3c, 0x3f, 0x3f, 0x34,
+  0x1f, 0x3b, 0x85, 0x1b, 0x00, 0x13, 0x82, 0x1b, 0x80, 0x1f, 0x06, 0x17, 0x33, 0x27, 0x3e, 0x3b,
+  0x3f, 0x1f, 0x80, 0x3f, 0x0a, 0x3e, 0x1e, 0x2e, 0x3e, 0x3b, 0x37, 0x37, 0x3e, 0x3a, 0x3f, 0x3f,
+  0x80, 0x3e, 0x07, 0x3f, 0x1f, 0x3e, 0x3f, 0x1f, 0x37, 0x3e, 0x3f, 0x80, 0x37, 0x14, 0x3f, 0x3f,
+  0x37, 0x3b, 0x3e, 0x1f, 0x1f, 0x37, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3b, 0x3f, 0x1f, 0x37, 0x37,
+  0x3e, 0x3f, 0x37, 0x80, 0x3f, 0x00, 0x08, 0x80, 0x00, 0x17, 0x18, 0x08, 0x18, 0x28, 0x08, 0x1c,
+  0x0a, 0x08, 0x08, 0x18, 0x0e, 0x08, 0x2a, 0x0a, 0x08, 0x0e, 0x08, 0x3b, 0x2b, 0x3b, 0x38, 0x00,
+  0x00, 0x07, 0x80, 0x3f, 0x01, 0x37, 0x3b, 0x85, 0x00, 0x07, 0x38, 0x38, 0x0b, 0x0a, 0x0b, 0x03,
+  0x03, 0x0b, 0x80, 0x03, 0x14, 0x20, 0x01, 0x01, 0x03, 0x03, 0x01, 0x31, 0x01, 0x18, 0x08, 0x39,
+  0x3b, 0x2b, 0x3b, 0x18, 0x07, 0x3f, 0x3f, 0x3e, 0x3f, 0x17, 0x81, 0x37, 0x80, 0x3f, 0x05, 0x17,
+  0x3b, 0x3a, 0x3f, 0x3b, 0x37, 0x80, 0x3f, 0x11, 0x3a, 0x3f, 0x37, 0x37, 0x3a, 0x3e, 0x1e, 0x1e,
+  0x3a, 0x3b, 0x37, 0x17, 0x33, 0x37, 0x17, 0x17, 0x1e, 0x3a, 0x81, 0x00, 0x06, 0x10, 0x10, 0x02,
+  0x02, 0x00, 0x10, 0x10, 0x80, 0x13, 0x0b, 0x12, 0x13, 0x32, 0x1a, 0x13, 0x12, 0x1a, 0x13, 0x13,
+  0x12, 0x17, 0x0e, 0x81, 0x3f, 0x06, 0x2e, 0x3b, 0x13, 0x17, 0x1c, 0x3f, 0x3e, 0x81, 0x3f, 0x04,
+  0x37, 0x3b, 0x13, 0x17, 0x38, 0x80, 0x3f, 0x07, 0x37, 0x3c, 0x3f, 0x3f, 0x35, 0x3f, 0x30, 0x3f,
+  0x8a, 0x1b, 0x02, 0x1f, 0x17, 0x1e, 0x80, 0x1f, 0x04, 0x1e, 0x1f, 0x1f, 0x3b, 0x37, 0x83, 0x3f,
+  0x21, 0x3b, 0x3f, 0x3f, 0x1e, 0x3b, 0x3f, 0x3e, 0x1e, 0x1f, 0x3f, 0x3f, 0x1e, 0x3e, 0x3f, 0x1f,
+  0x3f, 0x1e, 0x3b, 0x3f, 0x1f, 0x3f, 0x3b, 0x3b, 0x37, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x1f, 0x1f,
+  0x3a, 0x3a, 0x3b, 0x80, 0x3e, 0x06, 0x3f, 0x1f, 0x3b, 0x37, 0x1f, 0x3b, 0x37, 0x80, 0x3f, 0x19,
+  0x38, 0x00, 0x00, 0x0c, 0x18, 0x0b, 0x03, 0x23, 0x01, 0x11, 0x23, 0x0e, 0x08, 0x18, 0x0b, 0x01,
+  0x21, 0x11, 0x01, 0x1f, 0x0e, 0x1c, 0x1d, 0x19, 0x00, 0x01, 0x83, 0x3f, 0x84, 0x00, 0x1a, 0x0b,
+  0x01, 0x03, 0x20, 0x0c, 0x08, 0x38, 0x08, 0x31, 0x05, 0x15, 0x01, 0x11, 0x1c, 0x18, 0x08, 0x0c,
+  0x19, 0x03, 0x23, 0x01, 0x37, 0x1e, 0x0f, 0x15, 0x1c, 0x38, 0x80, 0x3f, 0x0e, 0x1f, 0x3e, 0x3f,
+  0x1f, 0x3b, 0x3b, 0x3f, 0x17, 0x33, 0x3f, 0x3f, 0x17, 0x3f, 0x33, 0x37, 0x80, 0x3f, 0x12, 0x17,
+  0x17, 0x3a, 0x3b, 0x3a, 0x3f, 0x1e, 0x3b, 0x33, 0x3e, 0x1e, 0x1e, 0x1f, 0x17, 0x1e, 0x1f, 0x17,
+  0x17, 0x1f, 0x82, 0x00, 0x05, 0x02, 0x00, 0x10, 0x10, 0x02, 0x02, 0x80, 0x12, 0x14, 0x1a, 0x12,
+  0x1a, 0x12, 0x1a, 0x13, 0x12, 0x1a, 0x13, 0x13, 0x17, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x33, 0x3a,
+  0x1a, 0x1b, 0x38, 0x80, 0x3f, 0x17, 0x27, 0x37, 0x37, 0x28, 0x3f, 0x1b, 0x13, 0x3a, 0x27, 0x3e,
+  0x3f, 0x2f, 0x37, 0x3e, 0x2e, 0x3f, 0x3d, 0x3c, 0x1f, 0x3b, 0x13, 0x1a, 0x1b, 0x13, 0x83, 0x1b,
+  0x01, 0x1e, 0x1f, 0x80, 0x3b, 0x08, 0x3a, 0x3b, 0x3f, 0x3b, 0x3b, 0x37, 0x17, 0x3b, 0x37, 0x80,
+  0x3f, 0x12, 0x3a, 0x3a, 0x3e, 0x3e, 0x1f, 0x3f, 0x3e, 0x3b, 0x3f, 0x3f, 0x3e, 0x1e, 0x3e, 0x3f,
+  0x1f, 0x1e, 0x3e, 0x3f, 0x3f, 0x80, 0x3e, 0x07, 0x1e, 0x3e, 0x3f, 0x3b, 0x33, 0x3f, 0x1e, 0x3b,
+  0x80, 0x3e, 0x29, 0x3f, 0x3f, 0x3e, 0x3b, 0x3b, 0x3f, 0x1e, 0x3f, 0x37, 0x3f, 0x37, 0x37, 0x1f,
+  0x33, 0x37, 0x3f, 0x38, 0x01, 0x00, 0x0a, 0x0c, 0x1c, 0x08, 0x08, 0x19, 0x21, 0x11, 0x01, 0x11,
+  0x28, 0x1c, 0x0a, 0x0a, 0x28, 0x0f, 0x23, 0x39, 0x1d, 0x1f, 0x07, 0x18, 0x03, 0x81, 0x3f, 0x02,
+  0x1e, 0x3f, 0x38, 0x84, 0x00, 0x20, 0x08, 0x18, 0x0b, 0x03, 0x03, 0x01, 0x31, 0x08, 0x18, 0x08,
+  0x18, 0x0e, 0x08, 0x0f, 0x07, 0x03, 0x01, 0x31, 0x01, 0x01, 0x39, 0x1d, 0x1b, 0x2b, 0x3b, 0x0b,
+  0x3f, 0x3f, 0x3e, 0x3e, 0x1f, 0x1e, 0x3b, 0x80, 0x37, 0x08, 0x3b, 0x3e, 0x3e, 0x1e, 0x3f, 0x37,
+  0x1f, 0x3e, 0x1f, 0x80, 0x3f, 0x14, 0x3e, 0x3b, 0x37, 0x17, 0x3a, 0x3f, 0x17, 0x3e, 0x3a, 0x3f,
+  0x17, 0x3a, 0x3e, 0x1e, 0x1e, 0x3a, 0x3a, 0x3f, 0x00, 0x00, 0x02, 0x83, 0x00, 0x01, 0x10, 0x12,
+  0x80, 0x1a, 0x10, 0x12, 0x1a, 0x12, 0x1a, 0x13, 0x12, 0x13, 0x12, 0x1a, 0x12, 0x1f, 0x07, 0x3f,
+  0x3f, 0x3e, 0x3f, 0x27, 0x80, 0x1a, 0x02, 0x3f, 0x27, 0x37, 0x82, 0x3f, 0x07, 0x07, 0x1a, 0x1b,
+  0x1f, 0x1c, 0x3f, 0x2f, 0x37, 0x80, 0x3f, 0x04, 0x3e, 0x3e, 0x3f, 0x30, 0x3f, 0x85, 0x1b, 0x0f,
+  0x1f, 0x3b, 0x3b, 0x3a, 0x3a, 0x3b, 0x33, 0x3b, 0x3e, 0x1e, 0x1f, 0x17, 0x3b, 0x3f, 0x17, 0x3b,
+  0x83, 0x3f, 0x0f, 0x1f, 0x3e, 0x3e, 0x3b, 0x3e, 0x3e, 0x3a, 0x3f, 0x3f, 0x1f, 0x1f, 0x3e, 0x3f,
+  0x3f, 0x3a, 0x3e, 0x80, 0x1f, 0x34, 0x3f, 0x3f, 0x1f, 0x37, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f,
+  0x3b, 0x3e, 0x3b, 0x3f, 0x3e, 0x3e, 0x3f, 0x3f, 0x33, 0x3e, 0x3b, 0x3f, 0x1f, 0x37, 0x3f, 0x3f,
+  0x37, 0x38, 0x00, 0x00, 0x08, 0x01, 0x03, 0x07, 0x01, 0x03, 0x01, 0x23, 0x05, 0x03, 0x01, 0x03,
+  0x05, 0x08, 0x18, 0x3b, 0x1d, 0x17, 0x1f, 0x07, 0x1d, 0x18, 0x2f, 0x80, 0x3f, 0x03, 0x17, 0x3f,
+  0x1f, 0x38, 0x85, 0x00, 0x41, 0x05, 0x11, 0x21, 0x05, 0x18, 0x0a, 0x0e, 0x09, 0x31, 0x07, 0x01,
+  0x03, 0x01, 0x03, 0x08, 0x2a, 0x08, 0x18, 0x3f, 0x1f, 0x07, 0x1c, 0x1d, 0x15, 0x17, 0x3f, 0x3f,
+  0x3b, 0x3f, 0x3e, 0x3f, 0x3e, 0x3f, 0x3e, 0x1f, 0x37, 0x3b, 0x3f, 0x3f, 0x1e, 0x1f, 0x37, 0x1f,
+  0x37, 0x3f, 0x3a, 0x3a, 0x3b, 0x3e, 0x3b, 0x3e, 0x1e, 0x3a, 0x3e, 0x1e, 0x1f, 0x33, 0x3e, 0x1f,
+  0x17, 0x3a, 0x3b, 0x37, 0x17, 0x37, 0x18, 0x86, 0x00, 0x00, 0x17, 0x80, 0x12, 0x0b, 0x1a, 0x13,
+  0x12, 0x13, 0x12, 0x13, 0x12, 0x1a, 0x13, 0x13, 0x37, 0x07, 0x81, 0x3f, 0x1e, 0x3a, 0x3b, 0x13,
+  0x13, 0x1f, 0x17, 0x3f, 0x37, 0x3f, 0x3d, 0x3e, 0x3f, 0x37, 0x3b, 0x13, 0x1f, 0x38, 0x3e, 0x3f,
+  0x3d, 0x37, 0x27, 0x35, 0x3d, 0x3f, 0x35, 0x3e, 0x07, 0x3b, 0x1b, 0x13, 0x80, 0x1b, 0x03, 0x1f,
+  0x1f, 0x3b, 0x3f, 0x80, 0x1f, 0x0b, 0x33, 0x3f, 0x17, 0x1f, 0x1f, 0x3e, 0x3b, 0x3e, 0x1f, 0x3f,
+  0x37, 0x37, 0x82, 0x3f, 0x0f, 0x37, 0x1f, 0x3b, 0x37, 0x37, 0x1f, 0x3f, 0x3a, 0x3e, 0x3f, 0x37,
+  0x3b, 0x3e, 0x1e, 0x3f, 0x3f, 0x80, 0x3e, 0x07, 0x1f, 0x17, 0x37, 0x1f, 0x17, 0x3b, 0x33, 0x37,
+  0x80, 0x36, 0x07, 0x3b, 0x3e, 0x3a, 0x3f, 0x1f, 0x3a, 0x3e, 0x3e, 0x81, 0x37, 0x04, 0x3f, 0x17,
+  0x33, 0x3f, 0x3b, 0x81, 0x00, 0x13, 0x08, 0x18, 0x0a, 0x0c, 0x0a, 0x08, 0x18, 0x1c, 0x0a, 0x28,
+  0x0a, 0x07, 0x39, 0x38, 0x3b, 0x2b, 0x2b, 0x39, 0x3b, 0x23, 0x80, 0x3f, 0x00, 0x37, 0x80, 0x3e,
+  0x01, 0x3f, 0x08, 0x83, 0x00, 0x34, 0x08, 0x00, 0x01, 0x11, 0x11, 0x03, 0x05, 0x01, 0x11, 0x03,
+  0x01, 0x0a, 0x09, 0x31, 0x11, 0x21, 0x11, 0x01, 0x02, 0x2b, 0x07, 0x1d, 0x1d, 0x1f, 0x1f, 0x07,
+  0x3f, 0x3f, 0x37, 0x3a, 0x3f, 0x3a, 0x3f, 0x36, 0x3e, 0x3e, 0x3a, 0x3e, 0x3e, 0x1e, 0x3f, 0x3e,
+  0x3f, 0x36, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x17, 0x1f, 0x33, 0x3f, 0x80, 0x37, 0x0a, 0x36, 0x1f,
+  0x33, 0x3a, 0x3e, 0x1f, 0x37, 0x17, 0x37, 0x37, 0x38, 0x85, 0x00, 0x28, 0x03, 0x3e, 0x1e, 0x3b,
+  0x3a, 0x13, 0x12, 0x13, 0x12, 0x13, 0x16, 0x12, 0x13, 0x12, 0x1a, 0x1b, 0x27, 0x3e, 0x3f, 0x37,
+  0x3f, 0x27, 0x3a, 0x1a, 0x1a, 0x13, 0x3c, 0x3f, 0x2f, 0x3e, 0x3e, 0x3f, 0x3f, 0x38, 0x1f, 0x1b,
+  0x13, 0x3f, 0x07, 0x3f, 0x37, 0x80, 0x3f, 0x19, 0x37, 0x35, 0x3e, 0x3f, 0x38, 0x1f, 0x13, 0x1b,
+  0x13, 0x13, 0x33, 0x33, 0x3b, 0x3f, 0x1f, 0x3f, 0x1e, 0x3a, 0x3e, 0x3a, 0x3f, 0x1f, 0x3a, 0x3b,
+  0x3f, 0x1f, 0x81, 0x37, 0x00, 0x17, 0x82, 0x3f, 0x01, 0x37, 0x36, 0x80, 0x3e, 0x04, 0x3a, 0x3f,
+  0x3b, 0x37, 0x3b, 0x80, 0x37, 0x22, 0x36, 0x33, 0x37, 0x3b, 0x3f, 0x37, 0x3f, 0x3e, 0x3e, 0x3f,
+  0x37, 0x3e, 0x3c, 0x3d, 0x37, 0x2e, 0x3e, 0x3f, 0x3f, 0x37, 0x37, 0x1e, 0x3e, 0x2e, 0x3c, 0x37,
+  0x37, 0x1f, 0x33, 0x3f, 0x3f, 0x37, 0x3f, 0x20, 0x08, 0x80, 0x00, 0x1b, 0x29, 0x15, 0x03, 0x05,
+  0x18, 0x29, 0x03, 0x01, 0x11, 0x31, 0x3f, 0x3e, 0x1f, 0x0e, 0x1d, 0x15, 0x1f, 0x03, 0x07, 0x3f,
+  0x3f, 0x3b, 0x3b, 0x3f, 0x1e, 0x3e, 0x3f, 0x3f, 0x85, 0x00, 0x16, 0x08, 0x2a, 0x08, 0x38, 0x0a,
+  0x08, 0x2a, 0x0c, 0x18, 0x38, 0x0a, 0x08, 0x2a, 0x0a, 0x0c, 0x1c, 0x19, 0x3b, 0x2b, 0x23, 0x3a,
+  0x2b, 0x28, 0x80, 0x3f, 0x1a, 0x1f, 0x37, 0x3b, 0x3f, 0x35, 0x35, 0x34, 0x3e, 0x3f, 0x3b, 0x3f,
+  0x3f, 0x17, 0x1f, 0x36, 0x3c, 0x3f, 0x3f, 0x36, 0x1e, 0x1f, 0x3e, 0x3e, 0x1f, 0x36, 0x3e, 0x26,
+  0x80, 0x3e, 0x01, 0x1e, 0x3f, 0x80, 0x1e, 0x04, 0x3e, 0x16, 0x3a, 0x3f, 0x10, 0x83, 0x00, 0x11,
+  0x10, 0x3e, 0x3a, 0x33, 0x32, 0x3b, 0x37, 0x17, 0x1a, 0x33, 0x16, 0x13, 0x13, 0x12, 0x13, 0x12,
+  0x3f, 0x17, 0x81, 0x3f, 0x31, 0x17, 0x1a, 0x13, 0x13, 0x1f, 0x38, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e,
+  0x3e, 0x3c, 0x3f, 0x13, 0x13, 0x1f, 0x3c, 0x3e, 0x2f, 0x35, 0x37, 0x3c, 0x3f, 0x3f, 0x35, 0x3e,
+  0x2e, 0x2f, 0x3b, 0x17, 0x3e, 0x3e, 0x1f, 0x1f, 0x17, 0x1f, 0x3b, 0x3f, 0x37, 0x27, 0x35, 0x37,
+  0x33, 0x37, 0x1f, 0x3a, 0x3a, 0x3f, 0x3e, 0x80, 0x27, 0x00, 0x37, 0x82, 0x3f, 0x00, 0x3e, 0x80,
+  0x2e, 0x02, 0x3e, 0x3f, 0x3e, 0x81, 0x3f, 0x23, 0x37, 0x27, 0x27, 0x35, 0x37, 0x3e, 0x3b, 0x3f,
+  0x17, 0x3f, 0x37, 0x37, 0x1f, 0x35, 0x37, 0x36, 0x37, 0x36, 0x3e, 0x3f, 0x17, 0x1f, 0x1f, 0x3e,
+  0x2e, 0x37, 0x37, 0x35, 0x37, 0x37, 0x3f, 0x3e, 0x1e, 0x1f, 0x37, 0x3f, 0x82, 0x00, 0x07, 0x0a,
+  0x09, 0x11, 0x03, 0x03, 0x01, 0x31, 0x07, 0x80, 0x3f, 0x05, 0x01, 0x3b, 0x2b, 0x3b, 0x39, 0x15,
+  0x80, 0x3f, 0x82, 0x37, 0x02, 0x36, 0x37, 0x3f, 0x85, 0x00, 0x15, 0x01, 0x38, 0x08, 0x19, 0x23,
+  0x01, 0x11, 0x01, 0x01, 0x15, 0x01, 0x11, 0x01, 0x08, 0x3f, 0x38, 0x1c, 0x1f, 0x1d, 0x1d, 0x1e,
+  0x19, 0x80, 0x3f, 0x01, 0x37, 0x3b, 0x80, 0x3e, 0x80, 0x37, 0x04, 0x26, 0x37, 0x37, 0x17, 0x3f,
+  0x84, 0x37, 0x17, 0x3f, 0x33, 0x3b, 0x3e, 0x3e, 0x2e, 0x3e, 0x3e, 0x26, 0x3e, 0x3b, 0x33, 0x37,
+  0x3b, 0x37, 0x37, 0x27, 0x37, 0x37, 0x3f, 0x3f, 0x3b, 0x33, 0x33, 0x80, 0x3f, 0x1e, 0x3b, 0x36,
+  0x3e, 0x1f, 0x17, 0x13, 0x3a, 0x3e, 0x1e, 0x3e, 0x1e, 0x16, 0x17, 0x12, 0x1a, 0x1f, 0x27, 0x3f,
+  0x37, 0x3f, 0x37, 0x2e, 0x3a, 0x1a, 0x13, 0x12, 0x38, 0x3e, 0x3f, 0x3f, 0x2f, 0x80, 0x3f, 0x29,
+  0x23, 0x3a, 0x1b, 0x13, 0x3a, 0x27, 0x3f, 0x3f, 0x3c, 0x3f, 0x3f, 0x27, 0x3e, 0x3f, 0x3f, 0x32,
+  0x3f, 0x3e, 0x17, 0x17, 0x3a, 0x3b, 0x3b, 0x3a, 0x3f, 0x3b, 0x3e, 0x1e, 0x3a, 0x3e, 0x2e, 0x3b,
+  0x3e, 0x1f, 0x3f, 0x3e, 0x37, 0x37, 0x36, 0x3e, 0x2e, 0x3a, 0x81, 0x3f, 0x08, 0x37, 0x37, 0x36,
+  0x3e, 0x35, 0x33, 0x37, 0x1f, 0x17, 0x81, 0x3f, 0x80, 0x37, 0x0f, 0x33, 0x3f, 0x37, 0x3a, 0x3e,
+  0x3e, 0x3f, 0x37, 0x37, 0x36, 0x2f, 0x35, 0x37, 0x27, 0x17, 0x3f, 0x81, 0x37, 0x16, 0x34, 0x3e,
+  0x3e, 0x37, 0x33, 0x37, 0x1f, 0x3f, 0x36, 0x3e, 0x3f, 0x11, 0x01, 0x00, 0x00, 0x03, 0x05, 0x11,
+  0x21, 0x15, 0x01, 0x11, 0x03, 0x81, 0x3f, 0x82, 0x00, 0x0b, 0x0f, 0x3f, 0x36, 0x3a, 0x3b, 0x3f,
+  0x1f, 0x37, 0x27, 0x37, 0x37, 0x3f, 0x83, 0x00, 0x1e, 0x01, 0x00, 0x03, 0x01, 0x15, 0x01, 0x11,
+  0x2a, 0x0d, 0x11, 0x31, 0x01, 0x15, 0x0a, 0x2a, 0x07, 0x3f, 0x3f, 0x0f, 0x1c, 0x1b, 0x33, 0x0f,
+  0x07, 0x3f, 0x37, 0x33, 0x3f, 0x37, 0x33, 0x3c, 0x80, 0x3e, 0x13, 0x27, 0x37, 0x3e, 0x1f, 0x3e,
+  0x1f, 0x3e, 0x2e, 0x37, 0x3f, 0x3f, 0x35, 0x37, 0x17, 0x3e, 0x3e, 0x3b, 0x37, 0x36, 0x3c, 0x81,
+  0x37, 0x26, 0x1e, 0x3a, 0x3e, 0x3e, 0x06, 0x3e, 0x3f, 0x3e, 0x3f, 0x17, 0x17, 0x3f, 0x3f, 0x33,
+  0x32, 0x36, 0x36, 0x3a, 0x36, 0x33, 0x33, 0x3e, 0x1e, 0x1e, 0x32, 0x31, 0x37, 0x3a, 0x3e, 0x37,
+  0x17, 0x1f, 0x07, 0x3f, 0x3d, 0x37, 0x3f, 0x31, 0x3a, 0x80, 0x13, 0x23, 0x3f, 0x27, 0x3f, 0x37,
+  0x37, 0x35, 0x3f, 0x37, 0x38, 0x3b, 0x1a, 0x1b, 0x1f, 0x07, 0x37, 0x37, 0x3f, 0x37, 0x37, 0x3f,
+  0x27, 0x2e, 0x3c, 0x3c, 0x2f, 0x3a, 0x3e, 0x0e, 0x3e, 0x1f, 0x17, 0x1f, 0x1e, 0x3e, 0x3f, 0x35,
+  0x81, 0x37, 0x0a, 0x17, 0x3a, 0x3b, 0x37, 0x27, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3a, 0x80, 0x3f,
+  0x0c, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x3e, 0x3f, 0x37, 0x3f, 0x3f, 0x3e, 0x3e, 0x3f, 0x80, 0x3e,
+  0x29, 0x3f, 0x33, 0x3f, 0x3f, 0x37, 0x27, 0x17, 0x1e, 0x3e, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3f,
+  0x1e, 0x3b, 0x3e, 0x3e, 0x2e, 0x3e, 0x3c, 0x37, 0x35, 0x37, 0x1e, 0x3e, 0x3e, 0x3f, 0x37, 0x37,
+  0x3f, 0x3f, 0x38, 0x08, 0x00, 0x18, 0x08, 0x18, 0x08, 0x18, 0x28, 0x82, 0x3f, 0x10, 0x0a, 0x0b,
+  0x0b, 0x01, 0x0a, 0x3f, 0x3e, 0x37, 0x37, 0x3f, 0x17, 0x37, 0x37, 0x36, 0x2e, 0x2e, 0x3f, 0x85,
+  0x00, 0x11, 0x08, 0x38, 0x08, 0x1c, 0x0a, 0x08, 0x0a, 0x08, 0x0b, 0x07, 0x01, 0x11, 0x01, 0x3f,
+  0x3f, 0x39, 0x31, 0x3b, 0x80, 0x2b, 0x44, 0x07, 0x3f, 0x3e, 0x3e, 0x3a, 0x3b, 0x3e, 0x3e, 0x37,
+  0x27, 0x26, 0x3e, 0x3c, 0x37, 0x3e, 0x1f, 0x3e, 0x1e, 0x3e, 0x2e, 0x37, 0x37, 0x36, 0x3e, 0x3f,
+  0x33, 0x3b, 0x3e, 0x3e, 0x27, 0x37, 0x35, 0x37, 0x37, 0x17, 0x37, 0x1f, 0x3b, 0x37, 0x37, 0x36,
+  0x36, 0x3f, 0x17, 0x37, 0x3e, 0x1e, 0x1a, 0x3e, 0x37, 0x37, 0x33, 0x36, 0x2a, 0x3e, 0x1f, 0x17,
+  0x17, 0x1e, 0x0e, 0x3e, 0x37, 0x17, 0x32, 0x3a, 0x3a, 0x3f, 0x27, 0x37, 0x80, 0x3f, 0x07, 0x3e,
+  0x3e, 0x1e, 0x1a, 0x1a, 0x1f, 0x07, 0x3d, 0x80, 0x3f, 0x5d, 0x37, 0x3f, 0x3f, 0x37, 0x1b, 0x1a,
+  0x1f, 0x38, 0x3f, 0x2f, 0x35, 0x3f, 0x2f, 0x27, 0x3f, 0x35, 0x3f, 0x3f, 0x06, 0x3f, 0x17, 0x37,
+  0x17, 0x33, 0x3b, 0x3e, 0x1f, 0x1e, 0x2a, 0x37, 0x35, 0x37, 0x27, 0x33, 0x3f, 0x1f, 0x3f, 0x37,
+  0x35, 0x36, 0x2e, 0x2e, 0x3c, 0x37, 0x3f, 0x3b, 0x33, 0x37, 0x37, 0x27, 0x27, 0x37, 0x37, 0x27,
+  0x37, 0x1f, 0x3a, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x37, 0x33, 0x3f, 0x37, 0x17, 0x37, 0x36,
+  0x3f, 0x37, 0x27, 0x27, 0x34, 0x3e, 0x27, 0x36, 0x3e, 0x3f, 0x3e, 0x3f, 0x36, 0x3e, 0x27, 0x37,
+  0x35, 0x36, 0x3f, 0x3f, 0x1f, 0x1f, 0x36, 0x2e, 0x80, 0x37, 0x07, 0x00, 0x00, 0x01, 0x21, 0x15,
+  0x03, 0x21, 0x03, 0x83, 0x3f, 0x05, 0x38, 0x0c, 0x01, 0x31, 0x07, 0x3e, 0x81, 0x37, 0x06, 0x3f,
+  0x1f, 0x37, 0x37, 0x36, 0x3e, 0x3f, 0x85, 0x00, 0x1d, 0x11, 0x01, 0x11, 0x03, 0x05, 0x11, 0x21,
+  0x15, 0x01, 0x01, 0x11, 0x21, 0x17, 0x3f, 0x3f, 0x3a, 0x3b, 0x2a, 0x39, 0x3a, 0x08, 0x3f, 0x3e,
+  0x37, 0x37, 0x3f, 0x3e, 0x3f, 0x37, 0x26, 0x80, 0x3e, 0x29, 0x37, 0x37, 0x3f, 0x37, 0x17, 0x3e,
+  0x37, 0x37, 0x3f, 0x3e, 0x2e, 0x37, 0x33, 0x3f, 0x37, 0x37, 0x27, 0x36, 0x3e, 0x36, 0x3f, 0x35,
+  0x37, 0x1e, 0x3a, 0x37, 0x26, 0x3e, 0x2e, 0x3f, 0x37, 0x3f, 0x33, 0x33, 0x3a, 0x3f, 0x33, 0x37,
+  0x16, 0x2e, 0x3e, 0x3e, 0x80, 0x33, 0x23, 0x3a, 0x3e, 0x3e, 0x17, 0x17, 0x3e, 0x1c, 0x37, 0x17,
+  0x3f, 0x17, 0x3f, 0x37, 0x3f, 0x37, 0x28, 0x3f, 0x16, 0x3f, 0x17, 0x3f, 0x37, 0x37, 0x3e, 0x2f,
+  0x3f, 0x3d, 0x37, 0x27, 0x07, 0x3e, 0x1f, 0x37, 0x3e, 0x27, 0x37, 0x80, 0x3e, 0x0c, 0x3f, 0x27,
+  0x3e, 0x3c, 0x3e, 0x3c, 0x3f, 0x3c, 0x1e, 0x3e, 0x1f, 0x33, 0x3b, 0x81, 0x37, 0x06, 0x36, 0x1e,
+  0x3e, 0x3f, 0x33, 0x37, 0x17, 0x80, 0x37, 0x1e, 0x36, 0x3e, 0x37, 0x37, 0x17, 0x37, 0x3f, 0x35,
+  0x36, 0x3e, 0x3e, 0x34, 0x3e, 0x3e, 0x3b, 0x37, 0x37, 0x3e, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f,
+  0x37, 0x3a, 0x3f, 0x3e, 0x2e, 0x3e, 0x37, 0x80, 0x3e, 0x80, 0x37, 0x08, 0x35, 0x37, 0x3f, 0x17,
+  0x1f, 0x35, 0x36, 0x3e, 0x3e, 0x85, 0x37, 0x09, 0x35, 0x37, 0x37, 0x38, 0x00, 0x00, 0x11, 0x03,
+  0x08, 0x18, 0x84, 0x3f, 0x11, 0x39, 0x11, 0x18, 0x08, 0x37, 0x37, 0x27, 0x35, 0x37, 0x1f, 0x1e,
+  0x3e, 0x3c, 0x3c, 0x3e, 0x2e, 0x37, 0x38, 0x86, 0x00, 0x09, 0x02, 0x29, 0x11, 0x01, 0x11, 0x03,
+  0x03, 0x07, 0x01, 0x07, 0x81, 0x3f, 0x0b, 0x05, 0x1b, 0x2a, 0x00, 0x07, 0x3f, 0x3e, 0x3c, 0x3e,
+  0x3a, 0x3f, 0x1f, 0x80, 0x37, 0x09, 0x36, 0x2e, 0x3c, 0x3e, 0x1e, 0x1f, 0x3f, 0x35, 0x37, 0x26,
+  0x80, 0x3e, 0x32, 0x2e, 0x3f, 0x33, 0x33, 0x3e, 0x37, 0x37, 0x27, 0x27, 0x37, 0x3e, 0x3e, 0x3a,
+  0x3f, 0x1e, 0x3e, 0x2e, 0x37, 0x36, 0x3f, 0x37, 0x37, 0x1e, 0x1f, 0x33, 0x36, 0x3c, 0x37, 0x16,
+  0x27, 0x14, 0x3e, 0x3e, 0x1f, 0x17, 0x17, 0x16, 0x2e, 0x37, 0x17, 0x3e, 0x3a, 0x3a, 0x3f, 0x27,
+  0x3f, 0x3f, 0x3d, 0x3f, 0x3a, 0x3e, 0x80, 0x3a, 0x45, 0x1f, 0x38, 0x3e, 0x3f, 0x3f, 0x27, 0x37,
+  0x3f, 0x3f, 0x2e, 0x3f, 0x1e, 0x1e, 0x3f, 0x15, 0x3e, 0x2f, 0x3d, 0x3f, 0x27, 0x3e, 0x3d, 0x37,
+  0x3d, 0x3f, 0x07, 0x3f, 0x37, 0x07, 0x37, 0x1f, 0x17, 0x3b, 0x35, 0x37, 0x35, 0x37, 0x27, 0x34,
+  0x3e, 0x1f, 0x3b, 0x3f, 0x35, 0x36, 0x2e, 0x3c, 0x3e, 0x3c, 0x3e, 0x3f, 0x1f, 0x33, 0x37, 0x35,
+  0x37, 0x34, 0x3f, 0x36, 0x2e, 0x3e, 0x3b, 0x3b, 0x3e, 0x2e, 0x3e, 0x3e, 0x3f, 0x3f, 0x37, 0x80,
+  0x3f, 0x15, 0x1e, 0x3e, 0x27, 0x3b, 0x37, 0x37, 0x27, 0x35, 0x37, 0x34, 0x3e, 0x3a, 0x3a, 0x3f,
+  0x37, 0x37, 0x35, 0x37, 0x27, 0x35, 0x36, 0x2e, 0x80, 0x1f, 0x0a, 0x35, 0x36, 0x3e, 0x37, 0x37,
+  0x3c, 0x01, 0x00, 0x08, 0x00, 0x01, 0x85, 0x3f, 0x06, 0x38, 0x28, 0x18, 0x18, 0x3f, 0x3e, 0x3e,
+  0x81, 0x37, 0x01, 0x1e, 0x3e, 0x80, 0x37, 0x01, 0x27, 0x3f, 0x83, 0x00, 0x00, 0x08, 0x80, 0x00,
+  0x07, 0x01, 0x07, 0x03, 0x28, 0x1c, 0x08, 0x19, 0x03, 0x82, 0x3f, 0x0f, 0x0a, 0x01, 0x01, 0x0b,
+  0x05, 0x3e, 0x37, 0x37, 0x33, 0x3f, 0x33, 0x37, 0x27, 0x35, 0x36, 0x2e, 0x80, 0x3e, 0x02, 0x3f,
+  0x3e, 0x1e, 0x81, 0x3e, 0x0f, 0x2e, 0x37, 0x37, 0x33, 0x3f, 0x3e, 0x3e, 0x3c, 0x37, 0x36, 0x3e,
+  0x3f, 0x37, 0x33, 0x3f, 0x33, 0x80, 0x37, 0x08, 0x34, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x33, 0x3e,
+  0x3e, 0x80, 0x37, 0x1c, 0x36, 0x3e, 0x33, 0x33, 0x37, 0x1e, 0x3e, 0x3e, 0x1e, 0x3e, 0x3f, 0x17,
+  0x36, 0x1f, 0x3a, 0x2f, 0x37, 0x2e, 0x3f, 0x37, 0x3c, 0x3f, 0x37, 0x17, 0x1f, 0x17, 0x38, 0x3f,
+  0x3e, 0x80, 0x3f, 0x1b, 0x37, 0x37, 0x38, 0x3f, 0x3b, 0x33, 0x37, 0x3c, 0x3f, 0x37, 0x27, 0x37,
+  0x3f, 0x27, 0x3f, 0x3e, 0x3e, 0x3c, 0x3c, 0x3f, 0x37, 0x37, 0x1e, 0x1f, 0x3a, 0x3e, 0x3e, 0x3c,
+  0x81, 0x3e, 0x08, 0x3b, 0x37, 0x37, 0x17, 0x37, 0x37, 0x36, 0x3e, 0x3c, 0x80, 0x3e, 0x09, 0x3f,
+  0x1f, 0x37, 0x36, 0x3c, 0x3e, 0x36, 0x2e, 0x37, 0x3f, 0x83, 0x37, 0x00, 0x3e, 0x80, 0x3f, 0x0a,
+  0x3a, 0x3a, 0x3f, 0x37, 0x36, 0x3f, 0x3f, 0x26, 0x3e, 0x3e, 0x35, 0x80, 0x37, 0x06, 0x3f, 0x3e,
+  0x1f, 0x37, 0x37, 0x36, 0x3e, 0x80, 0x37, 0x82, 0x3e, 0x04, 0x2e, 0x3c, 0x3e, 0x3f, 0x38, 0x81,
+  0x00, 0x01, 0x02, 0x2f, 0x83, 0x3f, 0x13, 0x39, 0x11, 0x05, 0x07, 0x3e, 0x2e, 0x37, 0x27, 0x37,
+  0x1f, 0x1e, 0x3f, 0x3e, 0x3e, 0x35, 0x36, 0x3e, 0x37, 0x3f, 0x18, 0x82, 0x00, 0x0a, 0x01, 0x00,
+  0x08, 0x00, 0x01, 0x01, 0x03, 0x01, 0x03, 0x21, 0x07, 0x82, 0x3f, 0x0d, 0x01, 0x07, 0x03, 0x04,
+  0x0a, 0x3f, 0x3e, 0x35, 0x37, 0x3a, 0x3f, 0x3f, 0x3e, 0x3e, 0x80, 0x37, 0x0a, 0x3e, 0x3e, 0x3b,
+  0x33, 0x3f, 0x3e, 0x3c, 0x37, 0x27, 0x36, 0x3c, 0x80, 0x3e, 0x03, 0x1f, 0x1e, 0x3e, 0x3c, 0x80,
+  0x37, 0x06, 0x3e, 0x3f, 0x1e, 0x1f, 0x3f, 0x36, 0x3c, 0x82, 0x37, 0x58, 0x1e, 0x1f, 0x17, 0x1e,
+  0x2e, 0x37, 0x26, 0x1e, 0x3e, 0x3e, 0x3b, 0x3b, 0x33, 0x3a, 0x27, 0x36, 0x27, 0x17, 0x3e, 0x1e,
+  0x3a, 0x3d, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x38, 0x3f, 0x06, 0x3a, 0x3a, 0x3b, 0x3f, 0x27, 0x3d,
+  0x3e, 0x3e, 0x3c, 0x3f, 0x2f, 0x37, 0x07, 0x3f, 0x17, 0x37, 0x3f, 0x06, 0x2f, 0x3f, 0x3f, 0x27,
+  0x3f, 0x35, 0x35, 0x3c, 0x3f, 0x3e, 0x07, 0x3f, 0x37, 0x33, 0x3e, 0x1f, 0x3b, 0x36, 0x3e, 0x37,
+  0x35, 0x36, 0x2e, 0x3e, 0x3b, 0x3b, 0x3f, 0x37, 0x35, 0x37, 0x27, 0x36, 0x3e, 0x37, 0x1f, 0x17,
+  0x37, 0x3e, 0x2e, 0x3e, 0x37, 0x80, 0x3e, 0x00, 0x1e, 0x80, 0x1f, 0x05, 0x26, 0x3c, 0x3e, 0x3f,
+  0x37, 0x3e, 0x80, 0x3f, 0x80, 0x37, 0x03, 0x3f, 0x37, 0x37, 0x34, 0x80, 0x3e, 0x18, 0x37, 0x3a,
+  0x3e, 0x1f, 0x3e, 0x3c, 0x37, 0x27, 0x35, 0x36, 0x2e, 0x3b, 0x33, 0x3b, 0x3f, 0x37, 0x35, 0x36,
+  0x3e, 0x37, 0x37, 0x3f, 0x00, 0x00, 0x08, 0x82, 0x00, 0x12, 0x0c, 0x1d, 0x17, 0x3f, 0x38, 0x2a,
+  0x08, 0x0f, 0x3e, 0x3e, 0x2e, 0x3e, 0x3f, 0x37, 0x3f, 0x17, 0x35, 0x37, 0x36, 0x80, 0x3e, 0x01,
+  0x3f, 0x3f, 0x86, 0x00, 0x05, 0x0a, 0x2a, 0x0c, 0x0b, 0x21, 0x03, 0x83, 0x3f, 0x06, 0x01, 0x11,
+  0x05, 0x11, 0x07, 0x3e, 0x27, 0x80, 0x37, 0x0b, 0x3a, 0x3a, 0x3e, 0x27, 0x35, 0x36, 0x3f, 0x3f,
+  0x37, 0x3e, 0x3f, 0x33, 0x80, 0x37, 0x06, 0x36, 0x3e, 0x3e, 0x37, 0x1f, 0x1f, 0x37, 0x80, 0x3e,
+  0x6b, 0x3c, 0x37, 0x3f, 0x3f, 0x37, 0x37, 0x3a, 0x3a, 0x3e, 0x37, 0x37, 0x26, 0x3f, 0x3f, 0x3a,
+  0x3f, 0x37, 0x1e, 0x3e, 0x3e, 0x2e, 0x3e, 0x27, 0x26, 0x1e, 0x1e, 0x33, 0x3e, 0x1e, 0x3e, 0x3a,
+  0x3e, 0x37, 0x37, 0x3e, 0x1f, 0x3a, 0x2f, 0x37, 0x3f, 0x3f, 0x37, 0x3c, 0x3e, 0x3e, 0x1f, 0x17,
+  0x1e, 0x3f, 0x07, 0x37, 0x3d, 0x3f, 0x3f, 0x3e, 0x3f, 0x3f, 0x27, 0x1f, 0x3a, 0x2e, 0x3f, 0x3c,
+  0x3e, 0x2e, 0x2e, 0x3f, 0x27, 0x3f, 0x3e, 0x3f, 0x35, 0x37, 0x27, 0x3e, 0x2a, 0x3f, 0x17, 0x3a,
+  0x3e, 0x3d, 0x37, 0x35, 0x36, 0x3e, 0x3e, 0x3b, 0x37, 0x37, 0x33, 0x3e, 0x37, 0x37, 0x36, 0x2e,
+  0x3c, 0x3e, 0x3f, 0x3b, 0x3e, 0x1e, 0x3e, 0x35, 0x36, 0x2e, 0x3c, 0x3e, 0x3f, 0x81, 0x37, 0x01,
+  0x36, 0x3c, 0x80, 0x37, 0x07, 0x3f, 0x3f, 0x3a, 0x3f, 0x35, 0x36, 0x3f, 0x3b, 0x80, 0x3e, 0x06,
+  0x3c, 0x37, 0x27, 0x37, 0x1f, 0x3f, 0x33, 0x84, 0x3e, 0x0b, 0x3f, 0x3e, 0x1e, 0x1f, 0x36, 0x3e,
+  0x2e, 0x3c, 0x3e, 0x3f, 0x3f, 0x08, 0x89, 0x00, 0x12, 0x02, 0x3f, 0x37, 0x37, 0x36, 0x3e, 0x3e,
+  0x1f, 0x17, 0x3f, 0x37, 0x37, 0x27, 0x35, 0x35, 0x37, 0x37, 0x3f, 0x08, 0x83, 0x00, 0x07, 0x01,
+  0x00, 0x23, 0x01, 0x03, 0x01, 0x11, 0x37, 0x83, 0x3f, 0x04, 0x18, 0x28, 0x18, 0x08, 0x18, 0x80,
+  0x3e, 0x03, 0x3f, 0x1f, 0x17, 0x3f, 0x81, 0x37, 0x80, 0x3e, 0x02, 0x1f, 0x1e, 0x1f, 0x80, 0x3e,
+  0x14, 0x2e, 0x3c, 0x3c, 0x3f, 0x37, 0x37, 0x3a, 0x3b, 0x37, 0x26, 0x3e, 0x2e, 0x3e, 0x3f, 0x17,
+  0x1f, 0x17, 0x3f, 0x35, 0x3e, 0x2e, 0x80, 0x37, 0x57, 0x3f, 0x3a, 0x3b, 0x37, 0x1e, 0x3e, 0x37,
+  0x36, 0x3e, 0x37, 0x33, 0x37, 0x1f, 0x17, 0x3a, 0x3e, 0x27, 0x35, 0x37, 0x3e, 0x3b, 0x33, 0x3c,
+  0x37, 0x3c, 0x3f, 0x37, 0x2f, 0x38, 0x3f, 0x17, 0x1e, 0x1f, 0x17, 0x1f, 0x3c, 0x3f, 0x3e, 0x3e,
+  0x2e, 0x3d, 0x3e, 0x2e, 0x38, 0x3f, 0x1e, 0x3a, 0x3e, 0x3b, 0x27, 0x3e, 0x3f, 0x2e, 0x3f, 0x27,
+  0x35, 0x3c, 0x3f, 0x3f, 0x0e, 0x3e, 0x3e, 0x3b, 0x3e, 0x1f, 0x1f, 0x17, 0x34, 0x3e, 0x3e, 0x3c,
+  0x3e, 0x3e, 0x3f, 0x1f, 0x1f, 0x37, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x3b, 0x33, 0x37, 0x17, 0x3e,
+  0x3c, 0x80, 0x3e, 0x80, 0x37, 0x24, 0x1f, 0x1e, 0x1f, 0x37, 0x35, 0x37, 0x37, 0x35, 0x37, 0x3f,
+  0x3b, 0x37, 0x3b, 0x37, 0x37, 0x3a, 0x3e, 0x3e, 0x2e, 0x35, 0x37, 0x37, 0x33, 0x3e, 0x3e, 0x1e,
+  0x3f, 0x37, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x1f, 0x1e, 0x3f, 0x37, 0x80, 0x3e, 0x81, 0x37, 0x80,
+  0x3f, 0x03, 0x00, 0x08, 0x00, 0x01, 0x84, 0x00, 0x02, 0x05, 0x3e, 0x3c, 0x80, 0x37, 0x0c, 0x1f,
+  0x37, 0x3a, 0x3a, 0x3f, 0x36, 0x3e, 0x3e, 0x37, 0x37, 0x3f, 0x37, 0x30, 0x85, 0x00, 0x04, 0x08,
+  0x1c, 0x18, 0x2a, 0x0f, 0x84, 0x3f, 0x20, 0x01, 0x11, 0x23, 0x07, 0x07, 0x3e, 0x2e, 0x3e, 0x1e,
+  0x3f, 0x3e, 0x1f, 0x3f, 0x37, 0x26, 0x3e, 0x3f, 0x3f, 0x1f, 0x37, 0x3f, 0x37, 0x1f, 0x35, 0x36,
+  0x3e, 0x37, 0x37, 0x33, 0x3b, 0x33, 0x3f, 0x37, 0x80, 0x3e, 0x31, 0x37, 0x3f, 0x3f, 0x3e, 0x3e,
+  0x3f, 0x17, 0x1e, 0x37, 0x37, 0x35, 0x37, 0x3f, 0x3a, 0x3f, 0x17, 0x3a, 0x3e, 0x1e, 0x3e, 0x2e,
+  0x3e, 0x3e, 0x1f, 0x3a, 0x3e, 0x3a, 0x3f, 0x17, 0x36, 0x3e, 0x1e, 0x3f, 0x3f, 0x37, 0x38, 0x3f,
+  0x3f, 0x3e, 0x2f, 0x37, 0x34, 0x3f, 0x37, 0x17, 0x3a, 0x3b, 0x37, 0x3e, 0x3c, 0x80, 0x3f, 0x19,
+  0x3e, 0x3f, 0x3f, 0x3c, 0x37, 0x3b, 0x37, 0x37, 0x3f, 0x27, 0x35, 0x3e, 0x3f, 0x27, 0x3e, 0x2f,
+  0x37, 0x3c, 0x3e, 0x38, 0x3f, 0x17, 0x1e, 0x3b, 0x3e, 0x3f, 0x82, 0x3e, 0x05, 0x3b, 0x3b, 0x33,
+  0x37, 0x37, 0x1f, 0x80, 0x37, 0x48, 0x34, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x1f, 0x37, 0x37, 0x27,
+  0x35, 0x37, 0x3b, 0x3e, 0x3e, 0x3f, 0x3e, 0x1e, 0x3e, 0x3c, 0x3c, 0x3e, 0x3a, 0x3e, 0x3e, 0x3b,
+  0x37, 0x3e, 0x3c, 0x37, 0x1f, 0x3b, 0x37, 0x3e, 0x37, 0x37, 0x3e, 0x3f, 0x17, 0x3b, 0x3a, 0x3b,
+  0x3f, 0x37, 0x37, 0x27, 0x17, 0x3e, 0x3f, 0x33, 0x3a, 0x3b, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x3b,
+  0x3e, 0x3f, 0x3f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x08, 0x07, 0x80,
+  0x3e, 0x0e, 0x2e, 0x3b, 0x37, 0x3b, 0x37, 0x3f, 0x17, 0x3e, 0x3e, 0x2e, 0x3e, 0x3f, 0x33, 0x3f,
+  0x3f, 0x86, 0x00, 0x02, 0x01, 0x0a, 0x08, 0x85, 0x3f, 0x2b, 0x1c, 0x08, 0x19, 0x01, 0x07, 0x3f,
+  0x37, 0x17, 0x3f, 0x17, 0x17, 0x3a, 0x3a, 0x3f, 0x37, 0x37, 0x3f, 0x3f, 0x37, 0x3a, 0x3a, 0x3b,
+  0x37, 0x1e, 0x3e, 0x3c, 0x3e, 0x3e, 0x1f, 0x37, 0x3e, 0x3a, 0x3b, 0x33, 0x3e, 0x2e, 0x3e, 0x3f,
+  0x3f, 0x3b, 0x3b, 0x33, 0x3e, 0x3b, 0x80, 0x3e, 0x1a, 0x37, 0x3f, 0x3f, 0x17, 0x3a, 0x3e, 0x3b,
+  0x3e, 0x3e, 0x37, 0x37, 0x17, 0x3a, 0x3f, 0x17, 0x1f, 0x33, 0x3e, 0x1f, 0x37, 0x36, 0x3f, 0x3f,
+  0x1f, 0x38, 0x3f, 0x3e, 0x80, 0x3f, 0x35, 0x38, 0x3f, 0x3a, 0x3b, 0x33, 0x3e, 0x1f, 0x38, 0x3f,
+  0x3d, 0x37, 0x27, 0x35, 0x3e, 0x2e, 0x3f, 0x07, 0x3e, 0x1f, 0x17, 0x3f, 0x38, 0x2e, 0x3f, 0x27,
+  0x3e, 0x2f, 0x37, 0x3c, 0x3f, 0x35, 0x3c, 0x3f, 0x3e, 0x3b, 0x3e, 0x1f, 0x17, 0x17, 0x1f, 0x37,
+  0x35, 0x33, 0x37, 0x37, 0x3e, 0x3b, 0x3b, 0x37, 0x1e, 0x3c, 0x3e, 0x3e, 0x3f, 0x80, 0x17, 0x01,
+  0x1f, 0x37, 0x80, 0x3e, 0x80, 0x37, 0x2f, 0x17, 0x1f, 0x1f, 0x17, 0x3f, 0x37, 0x37, 0x36, 0x3e,
+  0x3f, 0x3b, 0x3b, 0x3f, 0x3a, 0x3b, 0x37, 0x3f, 0x37, 0x17, 0x3e, 0x3f, 0x3a, 0x3b, 0x33, 0x3b,
+  0x3e, 0x3e, 0x3f, 0x3e, 0x1e, 0x3e, 0x3e, 0x3f, 0x3f, 0x17, 0x1e, 0x1f, 0x3f, 0x37, 0x1f, 0x37,
+  0x3e, 0x3f, 0x1f, 0x17, 0x33, 0x3e, 0x3f, 0x86, 0x00, 0x15, 0x08, 0x00, 0x07, 0x3f, 0x37, 0x37,
+  0x3f, 0x17, 0x3a, 0x3e, 0x3b, 0x37, 0x3f, 0x17, 0x3e, 0x3e, 0x3f, 0x33, 0x3e, 0x3b, 0x3f, 0x38,
+  0x8b, 0x00, 0x01, 0x2a, 0x2f, 0x80, 0x3f, 0x0d, 0x2a, 0x0a, 0x28, 0x18, 0x07, 0x3e, 0x3f, 0x3f,
+  0x17, 0x3f, 0x3e, 0x3f, 0x37, 0x1e, 0x80, 0x3f, 0x44, 0x3a, 0x3b, 0x37, 0x3f, 0x37, 0x3a, 0x3f,
+  0x1e, 0x3f, 0x37, 0x1f, 0x37, 0x1e, 0x1f, 0x3f, 0x37, 0x3e, 0x3b, 0x37, 0x37, 0x3f, 0x3f, 0x37,
+  0x37, 0x3e, 0x1f, 0x37, 0x33, 0x37, 0x17, 0x1e, 0x3f, 0x17, 0x3e, 0x1f, 0x3b, 0x37, 0x33, 0x3a,
+  0x3e, 0x3a, 0x3f, 0x17, 0x33, 0x3e, 0x1e, 0x1e, 0x3b, 0x37, 0x17, 0x33, 0x3b, 0x3f, 0x3e, 0x38,
+  0x3e, 0x2f, 0x3c, 0x3f, 0x35, 0x3c, 0x3f, 0x1f, 0x33, 0x3e, 0x1f, 0x33, 0x3c, 0x3e, 0x81, 0x3f,
+  0x05, 0x37, 0x3f, 0x27, 0x37, 0x3b, 0x3e, 0x80, 0x3f, 0x61, 0x37, 0x2e, 0x3f, 0x37, 0x3e, 0x2f,
+  0x37, 0x3c, 0x3f, 0x34, 0x1f, 0x3b, 0x3f, 0x3f, 0x33, 0x3f, 0x1e, 0x3e, 0x1e, 0x3e, 0x3f, 0x3a,
+  0x3b, 0x33, 0x3e, 0x3e, 0x3b, 0x37, 0x3e, 0x3e, 0x1f, 0x33, 0x3f, 0x3e, 0x3f, 0x33, 0x3a, 0x3b,
+  0x3e, 0x3f, 0x3e, 0x1f, 0x1e, 0x3f, 0x37, 0x37, 0x3e, 0x1f, 0x3e, 0x3e, 0x3f, 0x17, 0x1e, 0x3e,
+  0x3e, 0x1e, 0x3f, 0x3e, 0x3f, 0x37, 0x17, 0x3e, 0x3b, 0x33, 0x37, 0x3e, 0x3f, 0x3e, 0x3e, 0x1f,
+  0x17, 0x17, 0x37, 0x3b, 0x3b, 0x33, 0x33, 0x3e, 0x3f, 0x37, 0x37, 0x1e, 0x3e, 0x3b, 0x37, 0x1e,
+  0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x08, 0x00, 0x00, 0x08, 0x01, 0x00, 0x01, 0x81, 0x00, 0x14, 0x3f,
+  0x17, 0x3b, 0x3e, 0x1e, 0x3f, 0x37, 0x3b, 0x3e, 0x3f, 0x17, 0x3f, 0x17, 0x3b, 0x3f, 0x3f, 0x3b,
+  0x37, 0x37, 0x3f, 0x38, 0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x10, 0x3f, 0x3f, 0x31, 0x01, 0x01,
+  0x07, 0x07, 0x3f, 0x17, 0x17, 0x3a, 0x3e, 0x1f, 0x17, 0x1e, 0x3f, 0x17, 0x80, 0x3f, 0x7f, 0x3e,
+  0x3f, 0x17, 0x3a, 0x3f, 0x37, 0x37, 0x3a, 0x3b, 0x37, 0x3a, 0x3f, 0x37, 0x17, 0x1e, 0x1f, 0x1e,
+  0x3f, 0x1f, 0x3f, 0x3f, 0x1e, 0x1f, 0x17, 0x3e, 0x1f, 0x1f, 0x3b, 0x3e, 0x3f, 0x17, 0x3f, 0x17,
+  0x3e, 0x37, 0x1e, 0x1f, 0x37, 0x3b, 0x3f, 0x17, 0x33, 0x3f, 0x17, 0x37, 0x3b, 0x3e, 0x1f, 0x33,
+  0x3a, 0x3e, 0x3f, 0x1f, 0x3c, 0x3f, 0x3e, 0x3f, 0x37, 0x3f, 0x33, 0x37, 0x1e, 0x1f, 0x33, 0x3e,
+  0x1f, 0x3f, 0x07, 0x3c, 0x3e, 0x2e, 0x3c, 0x3f, 0x2e, 0x3f, 0x28, 0x3f, 0x33, 0x1e, 0x1f, 0x3f,
+  0x38, 0x3f, 0x37, 0x2e, 0x2f, 0x37, 0x3c, 0x3f, 0x35, 0x3f, 0x27, 0x1e, 0x3f, 0x3f, 0x3e, 0x1e,
+  0x3f, 0x17, 0x3b, 0x3b, 0x3a, 0x3f, 0x17, 0x3e, 0x3f, 0x33, 0x3e, 0x3f, 0x17, 0x1f, 0x33, 0x3f,
+  0x37, 0x17, 0x3a, 0x3f, 0x37, 0x3e, 0x3b, 0x33, 0x33, 0x3e, 0x3f, 0x33, 0x3e, 0x1e, 0x1f, 0x13,
+  0x37, 0x17, 0x1f, 0x1e, 0x3f, 0x3e, 0x1f, 0x17, 0x37, 0x1e, 0x1f, 0x17, 0x3e, 0x3e, 0x1f, 0x17,
+  0x3f, 0x1e, 0x1f, 0x17, 0x81, 0x37, 0x10, 0x3b, 0x3a, 0x3e, 0x3e, 0x3f, 0x3e, 0x3b, 0x36, 0x3e,
+  0x3e, 0x3f, 0x1f, 0x17, 0x3a, 0x3f, 0x17, 0x1e, 0x80, 0x37, 0x00, 0x38, 0x84, 0x00, 0x0a, 0x08,
+  0x00, 0x01, 0x3f, 0x3f, 0x17, 0x3b, 0x3f, 0x17, 0x1e, 0x36, 0x80, 0x3e, 0x09, 0x1e, 0x3f, 0x37,
+  0x3f, 0x3f, 0x37, 0x3e, 0x3e, 0x3f, 0x3f, 0x85, 0x00, 0x03, 0x01, 0x00, 0x08, 0x01, 0x82, 0x00,
+  0x0e, 0x01, 0x18, 0x1c, 0x18, 0x08, 0x3f, 0x3a, 0x3f, 0x3e, 0x3f, 0x37, 0x36, 0x3e, 0x3f, 0x1e,
+  0x80, 0x3f, 0x01, 0x17, 0x17, 0x80, 0x37, 0x06, 0x33, 0x3b, 0x3a, 0x3f, 0x3e, 0x3b, 0x37, 0x80,
+  0x3e, 0x08, 0x3f, 0x37, 0x37, 0x1e, 0x3e, 0x3f, 0x3f, 0x37, 0x36, 0x81, 0x3e, 0x03, 0x1e, 0x3b,
+  0x3e, 0x3b, 0x82, 0x37, 0x05, 0x3a, 0x3b, 0x37, 0x17, 0x3f, 0x1e, 0x80, 0x37, 0x10, 0x36, 0x1f,
+  0x33, 0x3e, 0x3f, 0x17, 0x3f, 0x3f, 0x38, 0x3f, 0x35, 0x3f, 0x2f, 0x37, 0x2c, 0x3f, 0x33, 0x80,
+  0x37, 0x0d, 0x36, 0x3f, 0x27, 0x37, 0x3f, 0x3f, 0x2f, 0x37, 0x37, 0x3e, 0x3c, 0x3f, 0x3f, 0x33,
+  0x80, 0x3f, 0x09, 0x25, 0x3c, 0x3f, 0x3e, 0x2f, 0x27, 0x3c, 0x3f, 0x35, 0x37, 0x81, 0x3f, 0x06,
+  0x37, 0x17, 0x3e, 0x1e, 0x3e, 0x3f, 0x17, 0x81, 0x3e, 0x11, 0x3b, 0x3a, 0x3f, 0x37, 0x1e, 0x3a,
+  0x3f, 0x37, 0x37, 0x36, 0x3b, 0x33, 0x3e, 0x3f, 0x3e, 0x3b, 0x33, 0x3e, 0x80, 0x37, 0x05, 0x1e,
+  0x3f, 0x37, 0x33, 0x3a, 0x3f, 0x82, 0x37, 0x00, 0x3b, 0x80, 0x3e, 0x0e, 0x3f, 0x33, 0x37, 0x3e,
+  0x3f, 0x37, 0x35, 0x37, 0x27, 0x36, 0x3f, 0x37, 0x1f, 0x17, 0x17, 0x80, 0x37, 0x0c, 0x26, 0x3e,
+  0x37, 0x3e, 0x3f, 0x1e, 0x3f, 0x37, 0x37, 0x36, 0x3e, 0x3f, 0x39, 0x80, 0x00, 0x00, 0x01, 0x81,
+  0x00, 0x16, 0x07, 0x3f, 0x1e, 0x3f, 0x37, 0x17, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x3e, 0x3f, 0x1f,
+  0x3f, 0x3f, 0x3e, 0x3e, 0x37, 0x35, 0x36, 0x3f, 0x3f, 0x89, 0x00, 0x01, 0x08, 0x01, 0x82, 0x00,
+  0x0c, 0x0c, 0x18, 0x3f, 0x37, 0x3e, 0x1e, 0x3c, 0x37, 0x27, 0x27, 0x37, 0x37, 0x1f, 0x80, 0x3f,
+  0x3c, 0x37, 0x27, 0x34, 0x3c, 0x3e, 0x3e, 0x3f, 0x37, 0x17, 0x1e, 0x3f, 0x34, 0x3e, 0x27, 0x26,
+  0x3e, 0x1f, 0x3a, 0x3b, 0x3f, 0x3f, 0x37, 0x27, 0x35, 0x37, 0x37, 0x1e, 0x3b, 0x37, 0x33, 0x3e,
+  0x3e, 0x37, 0x36, 0x2e, 0x3e, 0x1f, 0x37, 0x17, 0x3e, 0x1e, 0x3e, 0x3c, 0x3e, 0x2e, 0x37, 0x33,
+  0x3e, 0x1f, 0x17, 0x3a, 0x3e, 0x37, 0x3c, 0x35, 0x3f, 0x37, 0x35, 0x3e, 0x3d, 0x17, 0x80, 0x3e,
+  0x5e, 0x36, 0x3e, 0x3f, 0x1c, 0x3f, 0x2e, 0x2e, 0x3e, 0x2f, 0x3d, 0x35, 0x3f, 0x07, 0x17, 0x1e,
+  0x3a, 0x3f, 0x3f, 0x38, 0x37, 0x3e, 0x3d, 0x37, 0x3e, 0x3f, 0x37, 0x3e, 0x2f, 0x1e, 0x36, 0x3e,
+  0x3f, 0x3e, 0x3f, 0x33, 0x3f, 0x33, 0x3a, 0x3f, 0x35, 0x37, 0x27, 0x35, 0x36, 0x3f, 0x37, 0x1e,
+  0x3f, 0x37, 0x3e, 0x3c, 0x37, 0x27, 0x36, 0x3f, 0x33, 0x3a, 0x3b, 0x37, 0x3e, 0x35, 0x37, 0x27,
+  0x27, 0x37, 0x3b, 0x33, 0x3f, 0x37, 0x1e, 0x3c, 0x3e, 0x2e, 0x27, 0x33, 0x37, 0x35, 0x37, 0x37,
+  0x1e, 0x1f, 0x3a, 0x3b, 0x36, 0x2e, 0x37, 0x36, 0x3e, 0x3e, 0x3a, 0x3b, 0x37, 0x3f, 0x37, 0x35,
+  0x80, 0x37, 0x0d, 0x27, 0x3a, 0x3b, 0x37, 0x33, 0x3e, 0x3e, 0x2e, 0x3c, 0x37, 0x37, 0x3f, 0x38,
+  0x01, 0x80, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x3f, 0x36, 0x3f, 0x17, 0x1e, 0x3e, 0x3e, 0x3c, 0x3e,
+  0x37, 0x37, 0x27, 0x37, 0x80, 0x3f, 0x02, 0x3e, 0x3c, 0x3e, 0x80, 0x37, 0x01, 0x3f, 0x3f, 0x8b,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x04, 0x03, 0x01, 0x3f, 0x1f, 0x17, 0x82, 0x3e, 0x04, 0x27, 0x33,
+  0x37, 0x3f, 0x3a, 0x81, 0x3e, 0x07, 0x37, 0x37, 0x33, 0x33, 0x3b, 0x3e, 0x3f, 0x36, 0x83, 0x3e,
+  0x02, 0x1f, 0x37, 0x3f, 0x80, 0x3e, 0x37, 0x37, 0x34, 0x3e, 0x3f, 0x17, 0x3b, 0x3e, 0x3e, 0x3c,
+  0x3c, 0x3e, 0x37, 0x27, 0x37, 0x1f, 0x3a, 0x3f, 0x3e, 0x3c, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x3b,
+  0x37, 0x1e, 0x1f, 0x37, 0x37, 0x3e, 0x3f, 0x37, 0x2f, 0x3f, 0x37, 0x3e, 0x2f, 0x17, 0x35, 0x35,
+  0x37, 0x27, 0x37, 0x38, 0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x27, 0x3f, 0x37, 0x27, 0x3f, 0x33, 0x81,
+  0x3f, 0x27, 0x25, 0x35, 0x3e, 0x3d, 0x35, 0x3c, 0x3d, 0x31, 0x37, 0x37, 0x3e, 0x3f, 0x3e, 0x3f,
+  0x3e, 0x3f, 0x17, 0x1e, 0x3f, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x3a, 0x3b, 0x37, 0x1e, 0x1e,
+  0x37, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x3f, 0x37, 0x3e, 0x1f, 0x80, 0x37, 0x07, 0x36, 0x3e, 0x3e,
+  0x1e, 0x3f, 0x17, 0x1e, 0x3e, 0x83, 0x37, 0x05, 0x36, 0x3e, 0x27, 0x37, 0x33, 0x37, 0x80, 0x3e,
+  0x0a, 0x2e, 0x3c, 0x3e, 0x27, 0x37, 0x3e, 0x3b, 0x33, 0x37, 0x37, 0x3f, 0x80, 0x3e, 0x06, 0x37,
+  0x3e, 0x3b, 0x3f, 0x37, 0x27, 0x36, 0x80, 0x3e, 0x02, 0x37, 0x3f, 0x38, 0x81, 0x00, 0x0e, 0x01,
+  0x00, 0x3f, 0x37, 0x3a, 0x3f, 0x37, 0x1f, 0x35, 0x36, 0x3e, 0x3c, 0x3e, 0x37, 0x37, 0x80, 0x3f,
+  0x08, 0x3e, 0x3e, 0x3c, 0x3c, 0x37, 0x26, 0x37, 0x3f, 0x3f, 0x86, 0x00, 0x00, 0x08, 0x83, 0x00,
+  0x09, 0x01, 0x00, 0x06, 0x3f, 0x3e, 0x3f, 0x37, 0x27, 0x36, 0x2e, 0x80, 0x37, 0x80, 0x3f, 0x28,
+  0x35, 0x37, 0x26, 0x3c, 0x3e, 0x3c, 0x37, 0x3e, 0x3e, 0x3f, 0x17, 0x27, 0x35, 0x37, 0x27, 0x36,
+  0x2e, 0x3b, 0x37, 0x3a, 0x3f, 0x37, 0x34, 0x3e, 0x2e, 0x3e, 0x3e, 0x37, 0x3a, 0x3e, 0x3b, 0x37,
+  0x37, 0x36, 0x3c, 0x3e, 0x3e, 0x37, 0x33, 0x37, 0x3f, 0x80, 0x37, 0x01, 0x35, 0x36, 0x80, 0x3e,
+  0x0b, 0x3b, 0x37, 0x3e, 0x3c, 0x3e, 0x39, 0x37, 0x2f, 0x37, 0x37, 0x3d, 0x31, 0x80, 0x37, 0x00,
+  0x36, 0x81, 0x3e, 0x57, 0x27, 0x3c, 0x3f, 0x2e, 0x2f, 0x3f, 0x37, 0x2e, 0x2e, 0x3f, 0x1e, 0x3a,
+  0x3a, 0x3f, 0x3f, 0x3e, 0x07, 0x35, 0x3e, 0x3f, 0x3f, 0x35, 0x34, 0x3f, 0x3e, 0x35, 0x36, 0x3f,
+  0x3e, 0x3f, 0x3a, 0x3f, 0x37, 0x3a, 0x3c, 0x3e, 0x3c, 0x37, 0x27, 0x35, 0x37, 0x37, 0x3a, 0x3f,
+  0x37, 0x3c, 0x35, 0x37, 0x27, 0x37, 0x37, 0x1e, 0x1f, 0x17, 0x3e, 0x27, 0x35, 0x36, 0x2e, 0x3e,
+  0x27, 0x37, 0x3a, 0x3f, 0x37, 0x37, 0x35, 0x36, 0x2e, 0x37, 0x27, 0x37, 0x3e, 0x2e, 0x3e, 0x3f,
+  0x3e, 0x1f, 0x17, 0x27, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x27, 0x17, 0x3e, 0x80, 0x3f, 0x12, 0x37,
+  0x3e, 0x2e, 0x37, 0x37, 0x17, 0x17, 0x33, 0x37, 0x36, 0x3c, 0x3e, 0x2e, 0x35, 0x37, 0x37, 0x3f,
+  0x08, 0x01, 0x80, 0x00, 0x00, 0x07, 0x80, 0x3f, 0x00, 0x33, 0x81, 0x3e, 0x03, 0x2e, 0x37, 0x37,
+  0x27, 0x80, 0x3f, 0x02, 0x3a, 0x35, 0x36, 0x82, 0x3e, 0x01, 0x3f, 0x3f, 0x87, 0x00, 0x04, 0x01,
+  0x00, 0x08, 0x00, 0x08, 0x80, 0x00, 0x6b, 0x07, 0x3a, 0x3b, 0x37, 0x36, 0x3e, 0x2e, 0x37, 0x27,
+  0x34, 0x3e, 0x3f, 0x3f, 0x17, 0x37, 0x36, 0x3e, 0x3e, 0x35, 0x37, 0x37, 0x33, 0x3a, 0x3a, 0x3e,
+  0x3e, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x3e, 0x3b, 0x37, 0x3e, 0x3c, 0x3e, 0x37, 0x36, 0x2e, 0x3c,
+  0x3e, 0x3f, 0x17, 0x17, 0x35, 0x36, 0x3e, 0x3e, 0x35, 0x37, 0x27, 0x37, 0x1f, 0x3f, 0x3c, 0x3e,
+  0x3c, 0x37, 0x37, 0x26, 0x3c, 0x1f, 0x17, 0x3a, 0x3e, 0x37, 0x37, 0x3c, 0x3f, 0x37, 0x2f, 0x27,
+  0x37, 0x3c, 0x3f, 0x3c, 0x37, 0x37, 0x26, 0x3e, 0x27, 0x3f, 0x07, 0x37, 0x3c, 0x3f, 0x37, 0x27,
+  0x3c, 0x3f, 0x31, 0x3e, 0x3f, 0x17, 0x3f, 0x37, 0x3f, 0x3f, 0x3c, 0x2e, 0x3d, 0x37, 0x27, 0x22,
+  0x28, 0x3f, 0x35, 0x80, 0x37, 0x10, 0x3f, 0x3e, 0x3f, 0x33, 0x3a, 0x3f, 0x37, 0x35, 0x37, 0x37,
+  0x36, 0x3e, 0x3e, 0x1f, 0x37, 0x1e, 0x3e, 0x80, 0x37, 0x11, 0x36, 0x3c, 0x37, 0x37, 0x3a, 0x3f,
+  0x37, 0x37, 0x36, 0x3e, 0x3e, 0x27, 0x37, 0x33, 0x37, 0x3a, 0x3e, 0x2e, 0x80, 0x3e, 0x07, 0x2e,
+  0x37, 0x37, 0x3e, 0x37, 0x37, 0x36, 0x1f, 0x80, 0x37, 0x03, 0x26, 0x3e, 0x2e, 0x3c, 0x80, 0x3e,
+  0x03, 0x1f, 0x3f, 0x3f, 0x37, 0x81, 0x3e, 0x07, 0x27, 0x37, 0x3b, 0x3e, 0x3e, 0x3c, 0x3e, 0x3e,
+  0x81, 0x37, 0x06, 0x3f, 0x3f, 0x38, 0x00, 0x08, 0x00, 0x07, 0x80, 0x3e, 0x0b, 0x3f, 0x17, 0x1e,
+  0x3e, 0x37, 0x37, 0x35, 0x36, 0x3f, 0x37, 0x3f, 0x3f, 0x80, 0x3e, 0x07, 0x2e, 0x37, 0x27, 0x35,
+  0x36, 0x3a, 0x3f, 0x38, 0x84, 0x00, 0x00, 0x08, 0x83, 0x00, 0x08, 0x01, 0x00, 0x00, 0x03, 0x3f,
+  0x3e, 0x1e, 0x3c, 0x3e, 0x82, 0x37, 0x16, 0x3f, 0x3f, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x3e, 0x3e,
+  0x27, 0x37, 0x37, 0x3f, 0x3e, 0x3e, 0x2e, 0x35, 0x37, 0x36, 0x3e, 0x37, 0x1e, 0x3b, 0x81, 0x37,
+  0x49, 0x27, 0x37, 0x36, 0x3e, 0x1e, 0x3f, 0x3f, 0x37, 0x35, 0x37, 0x27, 0x37, 0x36, 0x3e, 0x1e,
+  0x3a, 0x3f, 0x3e, 0x3c, 0x37, 0x37, 0x27, 0x37, 0x37, 0x36, 0x3f, 0x17, 0x3e, 0x3c, 0x3e, 0x38,
+  0x37, 0x2e, 0x3e, 0x3f, 0x3c, 0x3f, 0x07, 0x3e, 0x3e, 0x27, 0x37, 0x26, 0x3e, 0x3f, 0x35, 0x3d,
+  0x37, 0x3e, 0x3f, 0x3c, 0x3f, 0x37, 0x3c, 0x3f, 0x17, 0x3a, 0x3a, 0x3e, 0x37, 0x3f, 0x3f, 0x3c,
+  0x06, 0x3d, 0x30, 0x3d, 0x17, 0x3f, 0x37, 0x36, 0x3e, 0x2e, 0x37, 0x80, 0x3f, 0x50, 0x37, 0x3e,
+  0x37, 0x36, 0x3e, 0x3e, 0x27, 0x34, 0x3e, 0x3e, 0x1f, 0x3e, 0x3e, 0x2e, 0x3e, 0x2e, 0x35, 0x37,
+  0x37, 0x33, 0x37, 0x3a, 0x3e, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e, 0x3c, 0x3e, 0x3f, 0x17, 0x3f, 0x36,
+  0x3e, 0x35, 0x36, 0x3e, 0x3c, 0x3e, 0x35, 0x36, 0x2e, 0x3e, 0x3b, 0x3b, 0x37, 0x36, 0x3e, 0x2e,
+  0x37, 0x37, 0x34, 0x3e, 0x1f, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x2e, 0x35, 0x37, 0x37, 0x33, 0x37,
+  0x37, 0x35, 0x37, 0x36, 0x2e, 0x3c, 0x3e, 0x2e, 0x3a, 0x3e, 0x3f, 0x3f, 0x38, 0x00, 0x01, 0x80,
+  0x3f, 0x05, 0x3e, 0x1e, 0x3f, 0x37, 0x27, 0x26, 0x80, 0x3e, 0x80, 0x3f, 0x0b, 0x3a, 0x3e, 0x3c,
+  0x37, 0x37, 0x26, 0x3e, 0x37, 0x35, 0x37, 0x37, 0x38, 0x85, 0x00, 0x00, 0x01, 0x80, 0x00, 0x52,
+  0x08, 0x00, 0x00, 0x01, 0x00, 0x07, 0x3a, 0x3f, 0x37, 0x37, 0x35, 0x37, 0x26, 0x3c, 0x3e, 0x27,
+  0x37, 0x3a, 0x3e, 0x3c, 0x37, 0x36, 0x3e, 0x27, 0x37, 0x37, 0x33, 0x3a, 0x3e, 0x35, 0x36, 0x3e,
+  0x3e, 0x35, 0x37, 0x27, 0x37, 0x37, 0x1e, 0x3e, 0x2e, 0x35, 0x37, 0x36, 0x3c, 0x3e, 0x3e, 0x3b,
+  0x33, 0x36, 0x2e, 0x37, 0x36, 0x3e, 0x2e, 0x3c, 0x37, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x36, 0x3e,
+  0x37, 0x34, 0x3e, 0x3f, 0x17, 0x3e, 0x35, 0x36, 0x3f, 0x3c, 0x3d, 0x37, 0x2f, 0x2e, 0x3f, 0x35,
+  0x37, 0x37, 0x27, 0x82, 0x37, 0x0e, 0x2e, 0x3e, 0x3d, 0x35, 0x3e, 0x3f, 0x35, 0x3c, 0x3c, 0x37,
+  0x3e, 0x1f, 0x37, 0x37, 0x3e, 0x80, 0x3f, 0x08, 0x3c, 0x04, 0x07, 0x26, 0x3f, 0x3e, 0x27, 0x35,
+  0x36, 0x80, 0x3e, 0x28, 0x3f, 0x3f, 0x1e, 0x1e, 0x2e, 0x3c, 0x37, 0x27, 0x37, 0x37, 0x35, 0x33,
+  0x3e, 0x1e, 0x2e, 0x3e, 0x27, 0x37, 0x37, 0x34, 0x3c, 0x3f, 0x3a, 0x3f, 0x34, 0x3e, 0x37, 0x36,
+  0x3c, 0x3e, 0x37, 0x37, 0x1e, 0x3e, 0x3e, 0x2e, 0x27, 0x37, 0x35, 0x37, 0x36, 0x81, 0x3e, 0x04,
+  0x27, 0x17, 0x37, 0x37, 0x35, 0x80, 0x37, 0x02, 0x26, 0x3e, 0x3e, 0x81, 0x3f, 0x29, 0x37, 0x36,
+  0x3e, 0x3e, 0x37, 0x27, 0x37, 0x3e, 0x1f, 0x36, 0x3e, 0x27, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x1f,
+  0x17, 0x37, 0x3f, 0x39, 0x07, 0x3f, 0x3f, 0x3e, 0x3e, 0x3f, 0x33, 0x37, 0x36, 0x3e, 0x3e, 0x27,
+  0x37, 0x3f, 0x37, 0x3f, 0x17, 0x3e, 0x3e, 0x3c, 0x80, 0x37, 0x04, 0x27, 0x37, 0x37, 0x1f, 0x3b,
+  0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x05, 0x07, 0x3f, 0x3a, 0x3f, 0x26, 0x3e, 0x80, 0x37, 0x0e,
+  0x36, 0x3e, 0x3a, 0x3f, 0x17, 0x37, 0x37, 0x35, 0x37, 0x37, 0x26, 0x3c, 0x3e, 0x3f, 0x17, 0x80,
+  0x3e, 0x06, 0x2e, 0x3e, 0x3e, 0x35, 0x37, 0x3a, 0x3f, 0x80, 0x37, 0x3b, 0x36, 0x3c, 0x3e, 0x37,
+  0x27, 0x37, 0x3e, 0x3f, 0x37, 0x35, 0x37, 0x27, 0x36, 0x3e, 0x3e, 0x3b, 0x33, 0x3f, 0x3f, 0x37,
+  0x37, 0x27, 0x35, 0x37, 0x34, 0x3e, 0x3a, 0x3b, 0x37, 0x37, 0x36, 0x38, 0x37, 0x3e, 0x3e, 0x3f,
+  0x35, 0x3f, 0x07, 0x27, 0x36, 0x3e, 0x3c, 0x37, 0x35, 0x37, 0x3c, 0x3d, 0x3e, 0x3f, 0x35, 0x3c,
+  0x3f, 0x37, 0x3f, 0x07, 0x3f, 0x37, 0x1e, 0x3c, 0x80, 0x37, 0x82, 0x3f, 0x80, 0x3e, 0x04, 0x37,
+  0x35, 0x37, 0x27, 0x37, 0x80, 0x3f, 0x81, 0x37, 0x30, 0x36, 0x3e, 0x2e, 0x3e, 0x3e, 0x1f, 0x37,
+  0x37, 0x36, 0x3e, 0x3e, 0x27, 0x37, 0x37, 0x32, 0x3f, 0x17, 0x37, 0x35, 0x37, 0x27, 0x37, 0x36,
+  0x2e, 0x37, 0x33, 0x3b, 0x36, 0x3e, 0x3e, 0x2e, 0x3e, 0x3e, 0x27, 0x37, 0x37, 0x27, 0x37, 0x37,
+  0x3a, 0x3b, 0x35, 0x36, 0x3e, 0x27, 0x37, 0x37, 0x27, 0x37, 0x80, 0x3f, 0x08, 0x37, 0x3e, 0x2e,
+  0x3c, 0x3e, 0x2e, 0x37, 0x33, 0x33, 0x81, 0x3e, 0x0a, 0x2e, 0x3c, 0x3e, 0x2e, 0x3e, 0x3f, 0x3e,
+  0x3e, 0x37, 0x3f, 0x3f, 0x81, 0x3e, 0x17, 0x1f, 0x1e, 0x3e, 0x2e, 0x3c, 0x37, 0x37, 0x3f, 0x37,
+  0x3f, 0x33, 0x3e, 0x1e, 0x2e, 0x3e, 0x3e, 0x3c, 0x37, 0x36, 0x3e, 0x3e, 0x3a, 0x3f, 0x38, 0x89,
+  0x00, 0x62, 0x08, 0x01, 0x00, 0x00, 0x3f, 0x33, 0x37, 0x36, 0x3e, 0x2e, 0x3c, 0x3e, 0x27, 0x35,
+  0x37, 0x37, 0x1e, 0x3e, 0x2e, 0x3c, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x33, 0x33, 0x3e, 0x37, 0x27,
+  0x26, 0x3e, 0x27, 0x37, 0x36, 0x3e, 0x1f, 0x33, 0x3c, 0x37, 0x27, 0x35, 0x37, 0x37, 0x26, 0x3e,
+  0x1e, 0x1f, 0x16, 0x3e, 0x3e, 0x37, 0x36, 0x3c, 0x3e, 0x2e, 0x3e, 0x3b, 0x37, 0x3f, 0x3e, 0x2e,
+  0x37, 0x36, 0x3e, 0x3e, 0x3a, 0x3f, 0x37, 0x35, 0x37, 0x27, 0x3c, 0x3d, 0x35, 0x3f, 0x27, 0x2e,
+  0x3e, 0x2f, 0x3e, 0x3c, 0x37, 0x37, 0x34, 0x3e, 0x37, 0x38, 0x37, 0x35, 0x3e, 0x2f, 0x37, 0x3c,
+  0x3f, 0x27, 0x27, 0x3a, 0x3b, 0x81, 0x37, 0x24, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3f, 0x1f, 0x37,
+  0x27, 0x37, 0x36, 0x3e, 0x37, 0x27, 0x37, 0x3f, 0x3b, 0x37, 0x26, 0x3c, 0x3e, 0x2e, 0x37, 0x36,
+  0x3e, 0x3f, 0x33, 0x3e, 0x3c, 0x3e, 0x3c, 0x37, 0x37, 0x36, 0x3e, 0x3f, 0x33, 0x81, 0x3e, 0x04,
+  0x37, 0x26, 0x3f, 0x37, 0x27, 0x82, 0x3e, 0x09, 0x37, 0x34, 0x3e, 0x3e, 0x2e, 0x3e, 0x3e, 0x27,
+  0x33, 0x37, 0x80, 0x3e, 0x04, 0x2e, 0x3e, 0x35, 0x36, 0x3e, 0x81, 0x3f, 0x03, 0x3e, 0x27, 0x36,
+  0x3e, 0x81, 0x37, 0x0b, 0x3e, 0x1e, 0x2e, 0x35, 0x37, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x33, 0x33,
+  0x80, 0x3e, 0x06, 0x3f, 0x3f, 0x3e, 0x3c, 0x3e, 0x3e, 0x3f, 0x80, 0x37, 0x0a, 0x35, 0x37, 0x37,
+  0x3f, 0x3e, 0x3e, 0x3b, 0x37, 0x37, 0x36, 0x3c, 0x80, 0x37, 0x05, 0x26, 0x3a, 0x3f, 0x37, 0x3f,
+  0x28, 0x86, 0x00, 0x00, 0x01, 0x82, 0x00, 0x03, 0x3f, 0x3e, 0x1f, 0x1f, 0x80, 0x37, 0x00, 0x36,
+  0x80, 0x3e, 0x1b, 0x1f, 0x37, 0x1e, 0x3e, 0x37, 0x37, 0x27, 0x35, 0x37, 0x27, 0x37, 0x3f, 0x17,
+  0x3e, 0x3e, 0x37, 0x37, 0x3e, 0x3e, 0x2e, 0x3e, 0x3e, 0x1f, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x80,
+  0x37, 0x0d, 0x33, 0x3e, 0x3f, 0x35, 0x36, 0x2e, 0x3c, 0x3e, 0x3e, 0x37, 0x37, 0x1e, 0x3f, 0x3f,
+  0x80, 0x37, 0x14, 0x35, 0x37, 0x27, 0x37, 0x3a, 0x3b, 0x37, 0x36, 0x3e, 0x3f, 0x26, 0x3f, 0x35,
+  0x3e, 0x3e, 0x3f, 0x07, 0x3e, 0x37, 0x37, 0x34, 0x80, 0x3e, 0x15, 0x3f, 0x25, 0x3e, 0x2f, 0x3e,
+  0x3d, 0x37, 0x2e, 0x3f, 0x17, 0x3f, 0x3e, 0x1f, 0x3e, 0x3c, 0x3e, 0x37, 0x3f, 0x3f, 0x36, 0x3e,
+  0x3a, 0x80, 0x3e, 0x07, 0x27, 0x35, 0x37, 0x27, 0x36, 0x3e, 0x3f, 0x3f, 0x80, 0x37, 0x24, 0x36,
+  0x3e, 0x3c, 0x37, 0x27, 0x33, 0x3e, 0x1e, 0x3e, 0x35, 0x37, 0x37, 0x27, 0x35, 0x34, 0x3e, 0x1f,
+  0x37, 0x3e, 0x3c, 0x37, 0x27, 0x37, 0x34, 0x3e, 0x3a, 0x3b, 0x33, 0x3f, 0x26, 0x2e, 0x3c, 0x37,
+  0x36, 0x3e, 0x37, 0x36, 0x80, 0x3e, 0x05, 0x3b, 0x33, 0x3e, 0x3e, 0x37, 0x35, 0x80, 0x37, 0x80,
+  0x3f, 0x35, 0x3e, 0x37, 0x37, 0x35, 0x37, 0x26, 0x3c, 0x3e, 0x1f, 0x17, 0x3f, 0x37, 0x36, 0x3c,
+  0x37, 0x27, 0x35, 0x37, 0x33, 0x3e, 0x1e, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x36, 0x3e, 0x1f,
+  0x17, 0x1e, 0x3c, 0x37, 0x36, 0x3e, 0x3f, 0x36, 0x37, 0x1e, 0x1e, 0x3f, 0x34, 0x3e, 0x3e, 0x3c,
+  0x3c, 0x3e, 0x3e, 0x3f, 0x17, 0x1e, 0x3f, 0x3a, 0x8a, 0x00, 0x1d, 0x01, 0x01, 0x3f, 0x17, 0x3e,
+  0x3e, 0x2e, 0x34, 0x3e, 0x3c, 0x3e, 0x27, 0x37, 0x37, 0x1e, 0x3f, 0x37, 0x27, 0x36, 0x3e, 0x37,
+  0x36, 0x3e, 0x3a, 0x3e, 0x3b, 0x34, 0x3e, 0x3c, 0x37, 0x80, 0x3e, 0x0d, 0x3a, 0x3b, 0x37, 0x17,
+  0x27, 0x35, 0x36, 0x2e, 0x2e, 0x3c, 0x3e, 0x3f, 0x17, 0x1e, 0x80, 0x37, 0x31, 0x36, 0x3e, 0x27,
+  0x37, 0x33, 0x37, 0x1e, 0x3f, 0x3e, 0x3c, 0x3e, 0x37, 0x36, 0x3e, 0x3a, 0x3f, 0x37, 0x3e, 0x2e,
+  0x3e, 0x3f, 0x07, 0x2e, 0x3e, 0x3d, 0x3d, 0x37, 0x27, 0x37, 0x27, 0x35, 0x37, 0x37, 0x27, 0x37,
+  0x3f, 0x17, 0x3f, 0x37, 0x27, 0x3e, 0x3f, 0x35, 0x3c, 0x2e, 0x3a, 0x3f, 0x33, 0x34, 0x3e, 0x81,
+  0x37, 0x12, 0x3f, 0x33, 0x3f, 0x17, 0x17, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x37, 0x17, 0x33,
+  0x3e, 0x3c, 0x37, 0x27, 0x35, 0x80, 0x37, 0x01, 0x17, 0x33, 0x80, 0x3e, 0x01, 0x37, 0x36, 0x81,
+  0x3e, 0x01, 0x3a, 0x3f, 0x83, 0x3e, 0x02, 0x37, 0x37, 0x33, 0x80, 0x3e, 0x80, 0x37, 0x15, 0x27,
+  0x27, 0x37, 0x3c, 0x3e, 0x27, 0x33, 0x3e, 0x1e, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e, 0x35, 0x37, 0x3f,
+  0x3f, 0x37, 0x17, 0x3e, 0x3c, 0x81, 0x3e, 0x05, 0x37, 0x37, 0x3a, 0x3a, 0x3e, 0x2e, 0x82, 0x3e,
+  0x24, 0x3f, 0x33, 0x3f, 0x37, 0x3f, 0x37, 0x3f, 0x37, 0x37, 0x27, 0x37, 0x1e, 0x3b, 0x37, 0x37,
+  0x35, 0x37, 0x27, 0x37, 0x35, 0x33, 0x37, 0x3f, 0x33, 0x37, 0x37, 0x27, 0x37, 0x36, 0x35, 0x37,
+  0x33, 0x3e, 0x3f, 0x36, 0x3f, 0x38, 0x86, 0x00, 0x28, 0x01, 0x00, 0x08, 0x00, 0x07, 0x3e, 0x3f,
+  0x17, 0x17, 0x37, 0x37, 0x3f, 0x37, 0x36, 0x3e, 0x2e, 0x1f, 0x33, 0x3a, 0x3e, 0x3e, 0x3c, 0x3e,
+  0x2e, 0x3c, 0x3e, 0x3f, 0x33, 0x3e, 0x3f, 0x37, 0x37, 0x3e, 0x3f, 0x27, 0x34, 0x3f, 0x37, 0x17,
+  0x3e, 0x3e, 0x80, 0x37, 0x24, 0x36, 0x3e, 0x33, 0x3a, 0x3f, 0x37, 0x37, 0x27, 0x34, 0x3e, 0x2e,
+  0x3e, 0x2e, 0x1e, 0x3b, 0x37, 0x3f, 0x3e, 0x3e, 0x35, 0x35, 0x37, 0x27, 0x37, 0x1e, 0x1f, 0x17,
+  0x37, 0x26, 0x3f, 0x27, 0x37, 0x2f, 0x2e, 0x3e, 0x3f, 0x07, 0x80, 0x3e, 0x10, 0x37, 0x27, 0x36,
+  0x3e, 0x1f, 0x3c, 0x27, 0x27, 0x3d, 0x35, 0x3c, 0x3f, 0x37, 0x37, 0x3f, 0x1e, 0x1e, 0x80, 0x3e,
+  0x24, 0x2e, 0x3e, 0x3f, 0x3e, 0x3e, 0x3a, 0x3f, 0x3e, 0x2e, 0x35, 0x37, 0x27, 0x34, 0x3e, 0x3f,
+  0x33, 0x3e, 0x1e, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x3c, 0x3e, 0x3b, 0x3e, 0x1f, 0x37, 0x35, 0x37,
+  0x27, 0x27, 0x34, 0x3e, 0x1f, 0x17, 0x81, 0x3f, 0x0b, 0x36, 0x3c, 0x37, 0x27, 0x33, 0x3e, 0x1e,
+  0x1e, 0x3e, 0x3c, 0x37, 0x27, 0x84, 0x37, 0x06, 0x17, 0x3b, 0x33, 0x37, 0x36, 0x3e, 0x27, 0x80,
+  0x37, 0x16, 0x3a, 0x3b, 0x37, 0x37, 0x36, 0x35, 0x36, 0x2e, 0x3c, 0x3a, 0x3a, 0x3f, 0x33, 0x3e,
+  0x3e, 0x27, 0x34, 0x3e, 0x27, 0x37, 0x17, 0x1e, 0x3a, 0x80, 0x3f, 0x07, 0x37, 0x37, 0x26, 0x3e,
+  0x1e, 0x3b, 0x37, 0x3a, 0x81, 0x3e, 0x09, 0x3c, 0x3e, 0x3e, 0x1e, 0x1e, 0x1f, 0x37, 0x36, 0x3e,
+  0x27, 0x80, 0x37, 0x07, 0x1e, 0x3b, 0x33, 0x3e, 0x3f, 0x3f, 0x38, 0x08, 0x88, 0x00, 0x31, 0x07,
+  0x3f, 0x17, 0x3a, 0x3f, 0x37, 0x37, 0x3f, 0x37, 0x27, 0x36, 0x3e, 0x3a, 0x3e, 0x3f, 0x37, 0x34,
+  0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x1e, 0x1f, 0x17, 0x17, 0x34, 0x3e, 0x3f, 0x3f, 0x36, 0x3f, 0x17,
+  0x1f, 0x3e, 0x1f, 0x37, 0x26, 0x3c, 0x37, 0x35, 0x37, 0x3e, 0x3f, 0x17, 0x1f, 0x37, 0x36, 0x3e,
+  0x3e, 0x80, 0x37, 0x0c, 0x3f, 0x17, 0x3a, 0x3f, 0x3f, 0x37, 0x37, 0x36, 0x3e, 0x37, 0x1e, 0x3e,
+  0x1e, 0x80, 0x3e, 0x01, 0x3f, 0x3c, 0x80, 0x3e, 0x20, 0x2f, 0x27, 0x27, 0x37, 0x26, 0x3c, 0x3e,
+  0x37, 0x27, 0x33, 0x37, 0x38, 0x3f, 0x3e, 0x3e, 0x3f, 0x37, 0x2e, 0x2f, 0x21, 0x3e, 0x3f, 0x3b,
+  0x37, 0x35, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x1f, 0x17, 0x33, 0x80, 0x37, 0x16, 0x36, 0x3e, 0x3e,
+  0x37, 0x17, 0x1e, 0x3b, 0x37, 0x37, 0x27, 0x37, 0x27, 0x34, 0x3e, 0x33, 0x37, 0x33, 0x3e, 0x1e,
+  0x3e, 0x3e, 0x37, 0x36, 0x80, 0x3e, 0x04, 0x3b, 0x33, 0x3f, 0x3e, 0x3f, 0x82, 0x3e, 0x1d, 0x3b,
+  0x3f, 0x33, 0x35, 0x37, 0x37, 0x36, 0x3e, 0x37, 0x33, 0x3e, 0x2e, 0x3e, 0x1f, 0x3e, 0x1e, 0x3f,
+  0x3e, 0x3c, 0x3e, 0x3e, 0x2e, 0x3e, 0x1f, 0x17, 0x3e, 0x1f, 0x17, 0x27, 0x3e, 0x81, 0x37, 0x03,
+  0x3f, 0x1e, 0x1f, 0x33, 0x82, 0x37, 0x05, 0x33, 0x3e, 0x3e, 0x1f, 0x3f, 0x3f, 0x82, 0x3e, 0x1c,
+  0x3b, 0x37, 0x17, 0x17, 0x37, 0x37, 0x26, 0x3c, 0x37, 0x37, 0x17, 0x3f, 0x1f, 0x37, 0x1e, 0x3f,
+  0x26, 0x3e, 0x3c, 0x3e, 0x3a, 0x3e, 0x3a, 0x3f, 0x17, 0x37, 0x3f, 0x3f, 0x38, 0x88, 0x00, 0x1e,
+  0x3f, 0x1e, 0x3b, 0x37, 0x1e, 0x1e, 0x3f, 0x37, 0x3e, 0x3e, 0x3f, 0x33, 0x3e, 0x3b, 0x3a, 0x3a,
+  0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x1e, 0x3b, 0x37, 0x37, 0x3e, 0x3f, 0x36, 0x3f, 0x37, 0x3f, 0x80,
+  0x37, 0x01, 0x17, 0x3a, 0x80, 0x3e, 0x26, 0x3c, 0x3e, 0x3e, 0x3a, 0x3a, 0x3e, 0x3e, 0x1e, 0x3c,
+  0x3e, 0x2e, 0x3c, 0x3e, 0x1e, 0x1e, 0x3b, 0x37, 0x3f, 0x37, 0x3e, 0x2e, 0x3e, 0x2e, 0x3f, 0x33,
+  0x33, 0x3e, 0x3b, 0x37, 0x35, 0x36, 0x38, 0x3c, 0x3d, 0x35, 0x3e, 0x3d, 0x17, 0x3f, 0x83, 0x37,
+  0x46, 0x1f, 0x3f, 0x26, 0x2e, 0x2f, 0x2e, 0x2f, 0x37, 0x3e, 0x3e, 0x3f, 0x1e, 0x1e, 0x3b, 0x37,
+  0x37, 0x27, 0x35, 0x37, 0x37, 0x3e, 0x3f, 0x1e, 0x3b, 0x3e, 0x2e, 0x3c, 0x3e, 0x27, 0x3e, 0x3f,
+  0x37, 0x1e, 0x3f, 0x1e, 0x3e, 0x3f, 0x3f, 0x37, 0x37, 0x3f, 0x33, 0x3e, 0x1e, 0x3f, 0x35, 0x36,
+  0x2e, 0x3e, 0x2e, 0x3e, 0x1f, 0x1e, 0x3e, 0x3f, 0x3f, 0x3e, 0x3f, 0x37, 0x35, 0x37, 0x17, 0x1e,
+  0x3e, 0x1f, 0x3e, 0x3e, 0x3c, 0x37, 0x27, 0x27, 0x80, 0x37, 0x05, 0x33, 0x37, 0x17, 0x3e, 0x1e,
+  0x1e, 0x81, 0x3e, 0x0b, 0x3f, 0x37, 0x3a, 0x3f, 0x37, 0x1e, 0x3e, 0x37, 0x2e, 0x37, 0x33, 0x3a,
+  0x80, 0x3e, 0x15, 0x1f, 0x37, 0x37, 0x27, 0x36, 0x3e, 0x3e, 0x1f, 0x17, 0x37, 0x3f, 0x3e, 0x3e,
+  0x3c, 0x37, 0x37, 0x3a, 0x3e, 0x3f, 0x3e, 0x3b, 0x3a, 0x81, 0x3e, 0x06, 0x3f, 0x33, 0x36, 0x3a,
+  0x3a, 0x3f, 0x17, 0x81, 0x37, 0x08, 0x1e, 0x3b, 0x37, 0x33, 0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x85,
+  0x00, 0x06, 0x01, 0x00, 0x00, 0x3f, 0x37, 0x17, 0x3e, 0x81, 0x3f, 0x07, 0x34, 0x3e, 0x3a, 0x3f,
+  0x17, 0x17, 0x37, 0x1f, 0x82, 0x37, 0x0f, 0x33, 0x3e, 0x3b, 0x33, 0x33, 0x37, 0x37, 0x3f, 0x3f,
+  0x36, 0x1f, 0x17, 0x17, 0x37, 0x17, 0x3a, 0x80, 0x3e, 0x08, 0x37, 0x33, 0x3f, 0x37, 0x1e, 0x1f,
+  0x3e, 0x1e, 0x3e, 0x80, 0x37, 0x2c, 0x3e, 0x3b, 0x37, 0x33, 0x37, 0x3f, 0x37, 0x36, 0x3e, 0x3a,
+  0x3a, 0x3f, 0x3e, 0x1f, 0x17, 0x3e, 0x3e, 0x3f, 0x3f, 0x27, 0x37, 0x3e, 0x3d, 0x36, 0x2f, 0x33,
+  0x37, 0x34, 0x3e, 0x2e, 0x1e, 0x1f, 0x37, 0x37, 0x38, 0x3f, 0x37, 0x37, 0x3c, 0x3d, 0x35, 0x27,
+  0x3e, 0x3e, 0x3a, 0x83, 0x3e, 0x05, 0x1e, 0x1f, 0x17, 0x37, 0x17, 0x33, 0x81, 0x37, 0x80, 0x17,
+  0x0c, 0x37, 0x17, 0x33, 0x37, 0x3e, 0x3f, 0x3e, 0x3a, 0x3a, 0x3f, 0x37, 0x3b, 0x33, 0x82, 0x37,
+  0x04, 0x1f, 0x37, 0x33, 0x3a, 0x3e, 0x81, 0x3f, 0x06, 0x3e, 0x3b, 0x3e, 0x3a, 0x3a, 0x3e, 0x1e,
+  0x81, 0x3e, 0x05, 0x3b, 0x3a, 0x37, 0x33, 0x3f, 0x3f, 0x80, 0x37, 0x01, 0x3e, 0x3b, 0x80, 0x37,
+  0x15, 0x17, 0x17, 0x37, 0x36, 0x1e, 0x3f, 0x17, 0x1f, 0x37, 0x3a, 0x3b, 0x37, 0x33, 0x37, 0x37,
+  0x3e, 0x3b, 0x3a, 0x3e, 0x3f, 0x1e, 0x1f, 0x81, 0x37, 0x07, 0x33, 0x3e, 0x3e, 0x3f, 0x37, 0x17,
+  0x3e, 0x3e, 0x80, 0x37, 0x0e, 0x3a, 0x3e, 0x3e, 0x3a, 0x3a, 0x3e, 0x3f, 0x37, 0x37, 0x1e, 0x3e,
+  0x1e, 0x3e, 0x3e, 0x3b, 0x81, 0x37, 0x05, 0x33, 0x3f, 0x3f, 0x37, 0x37, 0x3f, 0x86, 0x00, 0x0b,
+  0x03, 0x3f, 0x37, 0x3e, 0x37, 0x37, 0x17, 0x3f, 0x3e, 0x3f, 0x37, 0x17, 0x82, 0x3e, 0x04, 0x3b,
+  0x33, 0x37, 0x37, 0x33, 0x81, 0x3e, 0x02, 0x3f, 0x1e, 0x1f, 0x80, 0x3f, 0x01, 0x1e, 0x3f, 0x81,
+  0x37, 0x05, 0x3b, 0x37, 0x37, 0x3e, 0x1f, 0x32, 0x80, 0x3e, 0x03, 0x33, 0x3f, 0x37, 0x3e, 0x80,
+  0x3a, 0x80, 0x3e, 0x26, 0x3f, 0x3f, 0x3e, 0x3f, 0x33, 0x37, 0x3e, 0x3e, 0x37, 0x37, 0x33, 0x33,
+  0x3a, 0x3e, 0x37, 0x1c, 0x2f, 0x27, 0x2e, 0x38, 0x3f, 0x17, 0x3e, 0x1f, 0x37, 0x33, 0x37, 0x3e,
+  0x3e, 0x3f, 0x3f, 0x25, 0x3c, 0x3d, 0x37, 0x3e, 0x3f, 0x17, 0x3f, 0x80, 0x37, 0x05, 0x1f, 0x17,
+  0x17, 0x37, 0x17, 0x1e, 0x80, 0x3e, 0x01, 0x3f, 0x17, 0x80, 0x3e, 0x07, 0x3a, 0x3e, 0x3f, 0x37,
+  0x37, 0x33, 0x3e, 0x1f, 0x81, 0x3f, 0x80, 0x3e, 0x0b, 0x37, 0x37, 0x3e, 0x1f, 0x37, 0x37, 0x33,
+  0x37, 0x17, 0x37, 0x37, 0x33, 0x82, 0x3f, 0x82, 0x37, 0x01, 0x3e, 0x3b, 0x80, 0x37, 0x05, 0x17,
+  0x37, 0x3f, 0x3f, 0x3e, 0x34, 0x80, 0x3e, 0x07, 0x1e, 0x1e, 0x3b, 0x33, 0x3a, 0x3f, 0x37, 0x35,
+  0x80, 0x37, 0x03, 0x3a, 0x3e, 0x1e, 0x1f, 0x80, 0x37, 0x0a, 0x27, 0x36, 0x3a, 0x3e, 0x3f, 0x17,
+  0x17, 0x37, 0x37, 0x27, 0x35, 0x80, 0x37, 0x1a, 0x17, 0x1f, 0x17, 0x1e, 0x3e, 0x3e, 0x2e, 0x3c,
+  0x3e, 0x3a, 0x3f, 0x17, 0x1f, 0x17, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x37, 0x1f, 0x33, 0x3a, 0x3b,
+  0x37, 0x37, 0x35, 0x81, 0x37, 0x04, 0x33, 0x3e, 0x3f, 0x3f, 0x39, 0x85, 0x00, 0x05, 0x0f, 0x3e,
+  0x3e, 0x37, 0x27, 0x37, 0x80, 0x3f, 0x56, 0x17, 0x1e, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x3a, 0x3e,
+  0x3f, 0x17, 0x1e, 0x1f, 0x37, 0x35, 0x37, 0x27, 0x36, 0x3f, 0x37, 0x3f, 0x3f, 0x3a, 0x3e, 0x3e,
+  0x2e, 0x3c, 0x3e, 0x1e, 0x3e, 0x1f, 0x17, 0x17, 0x37, 0x37, 0x27, 0x35, 0x37, 0x3e, 0x1e, 0x1e,
+  0x1f, 0x17, 0x3e, 0x3e, 0x3c, 0x37, 0x27, 0x33, 0x3f, 0x1e, 0x1e, 0x1f, 0x3a, 0x3e, 0x3c, 0x3e,
+  0x2e, 0x3e, 0x3e, 0x3f, 0x17, 0x3f, 0x3a, 0x26, 0x3c, 0x37, 0x2c, 0x3f, 0x3e, 0x1f, 0x33, 0x3a,
+  0x3f, 0x3a, 0x37, 0x36, 0x3e, 0x3f, 0x30, 0x37, 0x3e, 0x2f, 0x27, 0x2e, 0x2f, 0x36, 0x80, 0x3e,
+  0x15, 0x3a, 0x3f, 0x33, 0x3a, 0x3f, 0x37, 0x37, 0x35, 0x37, 0x36, 0x3e, 0x1f, 0x17, 0x1e, 0x1f,
+  0x3e, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e, 0x3a, 0x82, 0x3f, 0x0e, 0x37, 0x27, 0x37, 0x33, 0x33, 0x37,
+  0x1e, 0x1f, 0x1e, 0x3e, 0x3c, 0x3e, 0x2e, 0x3e, 0x33, 0x82, 0x3f, 0x09, 0x37, 0x27, 0x37, 0x37,
+  0x17, 0x17, 0x3a, 0x3b, 0x3a, 0x3e, 0x81, 0x3f, 0x48, 0x37, 0x37, 0x26, 0x2e, 0x37, 0x33, 0x3a,
+  0x3f, 0x17, 0x37, 0x34, 0x3e, 0x37, 0x34, 0x3e, 0x37, 0x33, 0x37, 0x3a, 0x3e, 0x3e, 0x27, 0x36,
+  0x3e, 0x2e, 0x3e, 0x1e, 0x3b, 0x37, 0x1e, 0x2e, 0x37, 0x36, 0x3e, 0x3c, 0x3e, 0x3f, 0x33, 0x37,
+  0x33, 0x37, 0x27, 0x37, 0x36, 0x3c, 0x37, 0x37, 0x3a, 0x3e, 0x3b, 0x37, 0x35, 0x36, 0x3e, 0x37,
+  0x37, 0x32, 0x3f, 0x33, 0x3e, 0x1e, 0x3c, 0x3e, 0x35, 0x36, 0x2e, 0x3e, 0x1f, 0x33, 0x3a, 0x3e,
+  0x3f, 0x39, 0x84, 0x00, 0x05, 0x3f, 0x37, 0x37, 0x27, 0x37, 0x36, 0x80, 0x3f, 0x12, 0x3b, 0x37,
+  0x1e, 0x3c, 0x37, 0x36, 0x3e, 0x27, 0x33, 0x3a, 0x3f, 0x17, 0x3e, 0x35, 0x36, 0x3e, 0x37, 0x27,
+  0x32, 0x80, 0x3f, 0x16, 0x3e, 0x3e, 0x2e, 0x37, 0x37, 0x35, 0x37, 0x33, 0x3e, 0x1e, 0x3b, 0x3e,
+  0x3f, 0x37, 0x36, 0x3c, 0x36, 0x3e, 0x3b, 0x37, 0x3a, 0x3e, 0x3c, 0x80, 0x3e, 0x26, 0x2e, 0x37,
+  0x33, 0x37, 0x3a, 0x3e, 0x3c, 0x3e, 0x3e, 0x37, 0x34, 0x3a, 0x3a, 0x3e, 0x1e, 0x3f, 0x0c, 0x04,
+  0x3d, 0x37, 0x3e, 0x37, 0x33, 0x37, 0x17, 0x3a, 0x3e, 0x3c, 0x3e, 0x2e, 0x37, 0x3f, 0x20, 0x04,
+  0x04, 0x3f, 0x3e, 0x07, 0x3f, 0x80, 0x27, 0x16, 0x37, 0x3e, 0x1f, 0x37, 0x3e, 0x3e, 0x3c, 0x37,
+  0x36, 0x2e, 0x3e, 0x3e, 0x1e, 0x3b, 0x37, 0x37, 0x26, 0x3e, 0x37, 0x34, 0x3e, 0x3f, 0x37, 0x80,
+  0x3f, 0x10, 0x3e, 0x3f, 0x36, 0x3e, 0x2e, 0x3e, 0x3b, 0x37, 0x1e, 0x3e, 0x3c, 0x3e, 0x37, 0x36,
+  0x3c, 0x3e, 0x3e, 0x81, 0x3f, 0x09, 0x3e, 0x3e, 0x35, 0x34, 0x3e, 0x3e, 0x1f, 0x33, 0x37, 0x3e,
+  0x80, 0x3f, 0x3e, 0x37, 0x27, 0x36, 0x3e, 0x3e, 0x2e, 0x3e, 0x3e, 0x1e, 0x3f, 0x34, 0x3e, 0x3e,
+  0x2e, 0x3e, 0x3e, 0x3b, 0x37, 0x1e, 0x1e, 0x3c, 0x3e, 0x3e, 0x3c, 0x3e, 0x37, 0x37, 0x33, 0x37,
+  0x1e, 0x3e, 0x3e, 0x3c, 0x3e, 0x27, 0x37, 0x37, 0x17, 0x17, 0x3a, 0x3e, 0x3e, 0x37, 0x34, 0x3e,
+  0x3e, 0x3c, 0x3a, 0x3f, 0x17, 0x37, 0x37, 0x36, 0x3e, 0x27, 0x35, 0x34, 0x3f, 0x33, 0x3e, 0x1e,
+  0x3e, 0x3e, 0x80, 0x37, 0x08, 0x36, 0x3e, 0x3e, 0x1e, 0x3a, 0x3e, 0x37, 0x37, 0x38, 0x82, 0x00,
+  0x0e, 0x0f, 0x3f, 0x35, 0x36, 0x3e, 0x35, 0x37, 0x3e, 0x3f, 0x3a, 0x3e, 0x1e, 0x37, 0x37, 0x35,
+  0x82, 0x37, 0x00, 0x17, 0x81, 0x3e, 0x03, 0x27, 0x36, 0x3e, 0x2f, 0x80, 0x3f, 0x04, 0x3e, 0x37,
+  0x37, 0x26, 0x3e, 0x80, 0x37, 0x25, 0x17, 0x3b, 0x36, 0x35, 0x37, 0x3e, 0x2e, 0x3e, 0x3d, 0x33,
+  0x37, 0x1e, 0x3f, 0x37, 0x36, 0x3c, 0x37, 0x36, 0x3e, 0x2e, 0x3f, 0x1e, 0x1e, 0x3e, 0x37, 0x36,
+  0x2e, 0x3c, 0x3e, 0x3e, 0x3f, 0x1f, 0x33, 0x3f, 0x3e, 0x2e, 0x22, 0x2f, 0x80, 0x37, 0x1a, 0x3a,
+  0x3e, 0x1e, 0x3e, 0x3e, 0x37, 0x37, 0x3e, 0x3f, 0x3c, 0x3c, 0x3f, 0x35, 0x26, 0x3f, 0x36, 0x3e,
+  0x37, 0x36, 0x2e, 0x1e, 0x3a, 0x3a, 0x3e, 0x27, 0x37, 0x36, 0x80, 0x3e, 0x0b, 0x1f, 0x33, 0x37,
+  0x3a, 0x3e, 0x3e, 0x3c, 0x3e, 0x3e, 0x35, 0x33, 0x3a, 0x81, 0x3f, 0x0b, 0x3e, 0x3f, 0x26, 0x3e,
+  0x3e, 0x1e, 0x3a, 0x3e, 0x3e, 0x37, 0x37, 0x26, 0x80, 0x3e, 0x06, 0x1e, 0x1e, 0x3f, 0x3f, 0x37,
+  0x37, 0x27, 0x80, 0x37, 0x06, 0x33, 0x37, 0x1e, 0x3e, 0x37, 0x37, 0x3f, 0x80, 0x3e, 0x01, 0x2e,
+  0x3c, 0x80, 0x37, 0x01, 0x17, 0x3b, 0x80, 0x37, 0x29, 0x27, 0x37, 0x35, 0x37, 0x26, 0x3b, 0x37,
+  0x3e, 0x3e, 0x37, 0x35, 0x36, 0x3c, 0x3e, 0x2e, 0x3e, 0x3b, 0x37, 0x37, 0x35, 0x36, 0x3e, 0x3e,
+  0x37, 0x26, 0x3e, 0x3f, 0x17, 0x3e, 0x2e, 0x3c, 0x37, 0x37, 0x27, 0x36, 0x3e, 0x3a, 0x3f, 0x17,
+  0x35, 0x37, 0x27, 0x82, 0x37, 0x0b, 0x17, 0x37, 0x37, 0x26, 0x3e, 0x2e, 0x35, 0x37, 0x27, 0x37,
+  0x3a, 0x3f, 0x80, 0x37, 0x0b, 0x3f, 0x3f, 0x08, 0x00, 0x00, 0x3f, 0x3f, 0x37, 0x36, 0x3e, 0x3c,
+  0x3e, 0x80, 0x3f, 0x40, 0x3e, 0x1e, 0x3f, 0x37, 0x26, 0x3e, 0x3e, 0x3c, 0x37, 0x26, 0x1f, 0x33,
+  0x33, 0x35, 0x37, 0x27, 0x37, 0x35, 0x37, 0x36, 0x37, 0x3f, 0x3f, 0x3e, 0x3c, 0x37, 0x37, 0x27,
+  0x35, 0x36, 0x2e, 0x3f, 0x17, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x37, 0x36, 0x3e, 0x3b, 0x37, 0x17,
+  0x36, 0x2e, 0x3e, 0x3e, 0x3c, 0x3e, 0x37, 0x33, 0x37, 0x3e, 0x3c, 0x3e, 0x2e, 0x3e, 0x3e, 0x37,
+  0x35, 0x37, 0x32, 0x3f, 0x36, 0x81, 0x3f, 0x52, 0x37, 0x35, 0x33, 0x37, 0x17, 0x3e, 0x3e, 0x27,
+  0x35, 0x36, 0x3f, 0x3e, 0x3f, 0x3b, 0x20, 0x00, 0x3f, 0x3f, 0x27, 0x34, 0x3e, 0x37, 0x37, 0x33,
+  0x37, 0x1e, 0x3e, 0x3e, 0x35, 0x37, 0x27, 0x27, 0x34, 0x3e, 0x1e, 0x3b, 0x37, 0x26, 0x3c, 0x37,
+  0x36, 0x2e, 0x3e, 0x3e, 0x37, 0x3f, 0x3f, 0x3e, 0x3e, 0x3f, 0x3f, 0x37, 0x36, 0x2e, 0x3f, 0x17,
+  0x3a, 0x3e, 0x3c, 0x37, 0x37, 0x27, 0x27, 0x34, 0x3e, 0x3f, 0x17, 0x37, 0x3f, 0x3f, 0x36, 0x3c,
+  0x3e, 0x35, 0x37, 0x3a, 0x3e, 0x1f, 0x37, 0x37, 0x3f, 0x3e, 0x2e, 0x80, 0x37, 0x0a, 0x34, 0x3e,
+  0x2e, 0x3a, 0x3e, 0x3c, 0x3e, 0x37, 0x36, 0x3c, 0x36, 0x80, 0x3e, 0x03, 0x1e, 0x3e, 0x2e, 0x3c,
+  0x80, 0x37, 0x0f, 0x36, 0x3e, 0x3b, 0x37, 0x17, 0x26, 0x3e, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e, 0x2e,
+  0x1e, 0x3e, 0x3e, 0x80, 0x37, 0x13, 0x26, 0x3e, 0x3e, 0x37, 0x37, 0x17, 0x37, 0x36, 0x3e, 0x3e,
+  0x2e, 0x37, 0x34, 0x3e, 0x3a, 0x3f, 0x1e, 0x2e, 0x3e, 0x2e, 0x80, 0x3e, 0x07, 0x37, 0x33, 0x37,
+  0x17, 0x37, 0x26, 0x3e, 0x37, 0x82, 0x3f, 0x03, 0x3e, 0x3c, 0x3e, 0x2e, 0x80, 0x37, 0x08, 0x3e,
+  0x3e, 0x3b, 0x37, 0x37, 0x27, 0x37, 0x26, 0x3c, 0x81, 0x37, 0x07, 0x1e, 0x3e, 0x3e, 0x37, 0x37,
+  0x35, 0x37, 0x36, 0x81, 0x3f, 0x2a, 0x35, 0x37, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x1e, 0x3e,
+  0x3c, 0x37, 0x3e, 0x3e, 0x3c, 0x37, 0x27, 0x37, 0x37, 0x17, 0x37, 0x27, 0x37, 0x26, 0x3c, 0x37,
+  0x37, 0x35, 0x37, 0x17, 0x17, 0x37, 0x36, 0x3e, 0x27, 0x37, 0x26, 0x3e, 0x37, 0x1f, 0x33, 0x37,
+  0x37, 0x80, 0x3f, 0x0c, 0x35, 0x36, 0x3e, 0x3f, 0x3a, 0x37, 0x27, 0x37, 0x36, 0x3c, 0x3f, 0x3f,
+  0x37, 0x81, 0x3f, 0x09, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x35, 0x37, 0x3a, 0x3e, 0x2e, 0x81, 0x3e,
+  0x80, 0x37, 0x02, 0x3f, 0x17, 0x36, 0x80, 0x3e, 0x0a, 0x2e, 0x3e, 0x3e, 0x37, 0x1e, 0x1e, 0x3f,
+  0x37, 0x3f, 0x3e, 0x3f, 0x80, 0x3e, 0x0c, 0x37, 0x3a, 0x3e, 0x2e, 0x3e, 0x3c, 0x3e, 0x37, 0x36,
+  0x3e, 0x3e, 0x1e, 0x3f, 0x81, 0x37, 0x17, 0x36, 0x3c, 0x3e, 0x37, 0x37, 0x1e, 0x3c, 0x3e, 0x2e,
+  0x3e, 0x37, 0x36, 0x2e, 0x3e, 0x27, 0x37, 0x37, 0x36, 0x3f, 0x33, 0x37, 0x36, 0x2e, 0x35, 0x80,
+  0x37, 0x0c, 0x26, 0x3e, 0x3b, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x27, 0x35, 0x36, 0x1f, 0x80,
+  0x37, 0x27, 0x26, 0x3e, 0x37, 0x35, 0x36, 0x3e, 0x3e, 0x1f, 0x27, 0x35, 0x37, 0x27, 0x37, 0x36,
+  0x2e, 0x2e, 0x3a, 0x3f, 0x37, 0x27, 0x34, 0x3e, 0x37, 0x35, 0x37, 0x35, 0x37, 0x1e, 0x37, 0x36,
+  0x3e, 0x3e, 0x35, 0x37, 0x26, 0x3c, 0x37, 0x17, 0x3e, 0x2e, 0x80, 0x3e, 0x05, 0x36, 0x36, 0x3e,
+  0x3f, 0x3e, 0x1e, 0x80, 0x3e, 0x18, 0x3c, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x3a, 0x3e, 0x3e, 0x37,
+  0x37, 0x3e, 0x3e, 0x2e, 0x3c, 0x37, 0x33, 0x37, 0x37, 0x27, 0x34, 0x3e, 0x37, 0x37, 0x26, 0x80,
+  0x3f, 0x16, 0x37, 0x37, 0x35, 0x35, 0x37, 0x27, 0x35, 0x37, 0x33, 0x33, 0x3e, 0x3e, 0x3f, 0x3f,
+  0x3e, 0x3e, 0x37, 0x34, 0x3e, 0x3b, 0x37, 0x37, 0x36, 0x80, 0x3e, 0x1c, 0x35, 0x36, 0x3e, 0x3f,
+  0x37, 0x37, 0x35, 0x37, 0x37, 0x26, 0x3e, 0x2e, 0x3e, 0x33, 0x37, 0x36, 0x2e, 0x36, 0x3f, 0x37,
+  0x3e, 0x37, 0x37, 0x33, 0x37, 0x3e, 0x3e, 0x37, 0x27, 0x80, 0x37, 0x68, 0x3e, 0x37, 0x37, 0x3f,
+  0x36, 0x2e, 0x3e, 0x27, 0x37, 0x35, 0x37, 0x37, 0x17, 0x37, 0x37, 0x26, 0x2e, 0x35, 0x36, 0x3c,
+  0x3e, 0x2e, 0x33, 0x37, 0x27, 0x35, 0x37, 0x27, 0x37, 0x36, 0x2e, 0x2e, 0x37, 0x33, 0x37, 0x3f,
+  0x3e, 0x3f, 0x3e, 0x3f, 0x3f, 0x35, 0x37, 0x17, 0x37, 0x37, 0x26, 0x3e, 0x37, 0x37, 0x27, 0x35,
+  0x37, 0x37, 0x1e, 0x27, 0x34, 0x3e, 0x27, 0x27, 0x37, 0x37, 0x27, 0x33, 0x37, 0x37, 0x36, 0x3e,
+  0x3e, 0x3c, 0x3e, 0x3e, 0x27, 0x37, 0x35, 0x36, 0x3e, 0x3a, 0x3e, 0x3e, 0x2e, 0x3e, 0x3e, 0x37,
+  0x27, 0x36, 0x3e, 0x3a, 0x3e, 0x3e, 0x2e, 0x3e, 0x27, 0x36, 0x3e, 0x3e, 0x37, 0x37, 0x33, 0x37,
+  0x35, 0x36, 0x3e, 0x3c, 0x3e, 0x80, 0x37, 0x06, 0x17, 0x37, 0x36, 0x3e, 0x37, 0x36, 0x3c, 0x80,
+  0x3e, 0x10, 0x3f, 0x3f, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x3b, 0x37, 0x27,
+  0x37, 0x37, 0x36, 0x81, 0x3e, 0x27, 0x3b, 0x37, 0x36, 0x3c, 0x35, 0x37, 0x2e, 0x3f, 0x37, 0x36,
+  0x3b, 0x37, 0x37, 0x26, 0x3c, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x3a, 0x3f, 0x35, 0x37, 0x27, 0x3f,
+  0x37, 0x36, 0x3e, 0x37, 0x37, 0x3e, 0x3c, 0x37, 0x36, 0x3e, 0x3e, 0x2e, 0x2e, 0x3e, 0x80, 0x3f,
+  0x01, 0x37, 0x26, 0x81, 0x3e, 0x04, 0x37, 0x34, 0x3f, 0x37, 0x34, 0x80, 0x3e, 0x0b, 0x37, 0x27,
+  0x37, 0x37, 0x33, 0x37, 0x35, 0x36, 0x2e, 0x3c, 0x37, 0x27, 0x80, 0x37, 0x02, 0x17, 0x15, 0x36,
+  0x82, 0x3e, 0x01, 0x37, 0x27, 0x81, 0x3e, 0x80, 0x3f, 0x09, 0x37, 0x27, 0x26, 0x3e, 0x1e, 0x35,
+  0x37, 0x27, 0x37, 0x36, 0x80, 0x3f, 0x0b, 0x3a, 0x3e, 0x36, 0x3e, 0x3e, 0x27, 0x37, 0x36, 0x3e,
+  0x3e, 0x37, 0x3a, 0x82, 0x3e, 0x0a, 0x3c, 0x3e, 0x37, 0x37, 0x3e, 0x1e, 0x3e, 0x37, 0x36, 0x3e,
+  0x35, 0x80, 0x37, 0x02, 0x3a, 0x3e, 0x3e, 0x81, 0x3f, 0x81, 0x3e, 0x0a, 0x3b, 0x37, 0x36, 0x3e,
+  0x2e, 0x3c, 0x3e, 0x37, 0x36, 0x3e, 0x1f, 0x82, 0x37, 0x01, 0x36, 0x2e, 0x80, 0x37, 0x04, 0x1e,
+  0x3c, 0x3e, 0x37, 0x17, 0x81, 0x37, 0x06, 0x35, 0x36, 0x3e, 0x2e, 0x3e, 0x1f, 0x26, 0x80, 0x3e,
+  0x2d, 0x2e, 0x37, 0x27, 0x35, 0x37, 0x33, 0x37, 0x36, 0x2e, 0x3e, 0x37, 0x27, 0x35, 0x37, 0x27,
+  0x17, 0x3c, 0x3e, 0x37, 0x35, 0x36, 0x3e, 0x3c, 0x3e, 0x2e, 0x3f, 0x17, 0x37, 0x35, 0x37, 0x27,
+  0x37, 0x35, 0x37, 0x37, 0x3f, 0x3e, 0x3e, 0x2e, 0x3c, 0x37, 0x37, 0x34, 0x3e, 0x2e, 0x3a, 0x80,
+  0x3e, 0x05, 0x3f, 0x27, 0x35, 0x36, 0x2e, 0x3c, 0x84, 0x3e, 0x02, 0x37, 0x26, 0x3c, 0x80, 0x3e,
+  0x0a, 0x2e, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3f, 0x3c, 0x3e, 0x3a, 0x3e, 0x80, 0x37, 0x0d, 0x3c,
+  0x37, 0x27, 0x35, 0x33, 0x33, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x37, 0x36, 0x3e, 0x80, 0x3f, 0x0d,
+  0x37, 0x37, 0x26, 0x3e, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x1e, 0x3e, 0x3e, 0x3f, 0x3f, 0x80, 0x3e,
+  0x02, 0x27, 0x37, 0x1e, 0x83, 0x3e, 0x13, 0x3c, 0x3e, 0x2e, 0x1f, 0x37, 0x37, 0x26, 0x3c, 0x35,
+  0x36, 0x3c, 0x3e, 0x3e, 0x17, 0x17, 0x35, 0x37, 0x26, 0x37, 0x37, 0x80, 0x3e, 0x2f, 0x3a, 0x3f,
+  0x37, 0x36, 0x3e, 0x37, 0x35, 0x36, 0x37, 0x3e, 0x3f, 0x33, 0x3f, 0x35, 0x36, 0x3e, 0x3e, 0x3c,
+  0x3c, 0x37, 0x27, 0x17, 0x37, 0x27, 0x37, 0x26, 0x3c, 0x37, 0x36, 0x3c, 0x3e, 0x17, 0x3e, 0x3e,
+  0x3c, 0x37, 0x26, 0x3e, 0x35, 0x36, 0x3c, 0x37, 0x1e, 0x3c, 0x37, 0x37, 0x3e, 0x3e, 0x80, 0x3f,
+  0x03, 0x37, 0x17, 0x37, 0x35, 0x80, 0x37, 0x09, 0x36, 0x3c, 0x3e, 0x2e, 0x3e, 0x1e, 0x3e, 0x3c,
+  0x37, 0x26, 0x80, 0x3e, 0x13, 0x27, 0x33, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x2e, 0x34, 0x3e, 0x37,
+  0x36, 0x3e, 0x2e, 0x3e, 0x3b, 0x37, 0x37, 0x34, 0x3c, 0x80, 0x37, 0x1f, 0x36, 0x3e, 0x3e, 0x1f,
+  0x35, 0x37, 0x37, 0x35, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x3e, 0x1e, 0x37, 0x2e, 0x3e, 0x3e, 0x2e,
+  0x37, 0x36, 0x3e, 0x3a, 0x3e, 0x2e, 0x3e, 0x37, 0x36, 0x2e, 0x36, 0x3e, 0x80, 0x3f, 0x04, 0x27,
+  0x36, 0x3e, 0x3e, 0x27, 0x80, 0x37, 0x03, 0x27, 0x33, 0x37, 0x37, 0x81, 0x3e, 0x80, 0x37, 0x1c,
+  0x17, 0x17, 0x27, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x37, 0x37, 0x33, 0x3e, 0x3e, 0x3c, 0x37, 0x35,
+  0x3f, 0x3f, 0x3e, 0x37, 0x33, 0x37, 0x35, 0x37, 0x3f, 0x3f, 0x37, 0x37, 0x36, 0x81, 0x3e, 0x06,
+  0x2e, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x80, 0x3f, 0x1a, 0x35, 0x37, 0x37, 0x27, 0x36, 0x3e,
+  0x3e, 0x27, 0x33, 0x3e, 0x3c, 0x3e, 0x3f, 0x3f, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x3a, 0x3e, 0x27,
+  0x34, 0x3e, 0x2e, 0x37, 0x36, 0x81, 0x37, 0x22, 0x27, 0x37, 0x37, 0x36, 0x3c, 0x3e, 0x37, 0x37,
+  0x3f, 0x37, 0x36, 0x3e, 0x3e, 0x2e, 0x3f, 0x3e, 0x37, 0x27, 0x37, 0x17, 0x37, 0x27, 0x35, 0x34,
+  0x3e, 0x3f, 0x3f, 0x37, 0x3f, 0x3e, 0x36, 0x3e, 0x3e, 0x2e, 0x35, 0x82, 0x37, 0x02, 0x1e, 0x37,
+  0x26, 0x80, 0x3e, 0x05, 0x2e, 0x3e, 0x35, 0x3e, 0x1e, 0x3c, 0x80, 0x3e, 0x02, 0x2e, 0x3e, 0x3c,
+  0x81, 0x37, 0x0e, 0x36, 0x3f, 0x37, 0x3f, 0x3e, 0x3f, 0x3f, 0x3e, 0x3b, 0x34, 0x3e, 0x3c, 0x36,
+  0x2e, 0x3c, 0x80, 0x3e, 0x02, 0x1e, 0x3c, 0x35, 0x80, 0x37, 0x01, 0x27, 0x35, 0x80, 0x37, 0x0e,
+  0x1e, 0x3c, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x3c, 0x3c, 0x3e, 0x2e, 0x3e, 0x37, 0x37, 0x17, 0x81,
+  0x37, 0x0f, 0x35, 0x37, 0x27, 0x35, 0x33, 0x3e, 0x3e, 0x37, 0x34, 0x3e, 0x3e, 0x37, 0x27, 0x34,
+  0x3e, 0x1e, 0x80, 0x3e, 0x0a, 0x3f, 0x36, 0x3e, 0x2e, 0x35, 0x37, 0x37, 0x17, 0x37, 0x26, 0x3c,
+  0x80, 0x3e, 0x80, 0x3f, 0x22, 0x33, 0x37, 0x35, 0x36, 0x2e, 0x3e, 0x2e, 0x3c, 0x36, 0x3a, 0x3f,
+  0x37, 0x3f, 0x3f, 0x3c, 0x37, 0x27, 0x35, 0x36, 0x2e, 0x3f, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x36,
+  0x3c, 0x3e, 0x27, 0x37, 0x17, 0x36, 0x3e, 0x3c, 0x80, 0x37, 0x03, 0x3e, 0x3e, 0x37, 0x1e, 0x80,
+  0x3e, 0x0e, 0x3f, 0x37, 0x37, 0x27, 0x34, 0x3e, 0x1e, 0x1e, 0x37, 0x27, 0x37, 0x26, 0x3c, 0x37,
+  0x37, 0x80, 0x3f, 0x05, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x35, 0x80, 0x37, 0x0a, 0x17, 0x36, 0x3e,
+  0x3f, 0x37, 0x3e, 0x37, 0x37, 0x34, 0x3a, 0x3f, 0x81, 0x37, 0x09, 0x36, 0x3e, 0x27, 0x3c, 0x37,
+  0x17, 0x17, 0x36, 0x3e, 0x35, 0x81, 0x37, 0x04, 0x26, 0x1e, 0x1e, 0x2e, 0x3c, 0x81, 0x37, 0x05,
+  0x2e, 0x37, 0x37, 0x3e, 0x2e, 0x3e, 0x80, 0x37, 0x07, 0x26, 0x37, 0x3f, 0x3f, 0x3b, 0x3d, 0x36,
+  0x2e, 0x80, 0x3e, 0x05, 0x37, 0x34, 0x3e, 0x3a, 0x3e, 0x3e, 0x80, 0x37, 0x12, 0x27, 0x37, 0x36,
+  0x3e, 0x3a, 0x3e, 0x3e, 0x37, 0x35, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3a, 0x3b, 0x37, 0x37, 0x26,
+  0x80, 0x3f, 0x3a, 0x3e, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x37, 0x36, 0x2e,
+  0x3e, 0x1f, 0x37, 0x36, 0x3c, 0x37, 0x36, 0x3e, 0x37, 0x27, 0x33, 0x37, 0x37, 0x34, 0x3e, 0x3e,
+  0x3d, 0x37, 0x36, 0x3e, 0x37, 0x36, 0x3c, 0x3e, 0x3a, 0x3e, 0x3c, 0x3e, 0x35, 0x36, 0x3e, 0x37,
+  0x36, 0x3e, 0x3e, 0x1e, 0x3e, 0x2e, 0x3e, 0x37, 0x27, 0x27, 0x36, 0x3e, 0x3e, 0x3b, 0x80, 0x37,
+  0x01, 0x3f, 0x35, 0x81, 0x37, 0x00, 0x17, 0x81, 0x3e, 0x06, 0x35, 0x37, 0x37, 0x3e, 0x3e, 0x3f,
+  0x1e, 0x81, 0x3e, 0x01, 0x37, 0x36, 0x80, 0x3e, 0x01, 0x3b, 0x3f, 0x80, 0x37, 0x00, 0x36, 0x80,
+  0x3e, 0x07, 0x37, 0x17, 0x1e, 0x2e, 0x35, 0x37, 0x26, 0x2e, 0x80, 0x3e, 0x02, 0x1e, 0x3a, 0x3c,
+  0x80, 0x3e, 0x0b, 0x3f, 0x3f, 0x37, 0x27, 0x3a, 0x3e, 0x3e, 0x37, 0x3f, 0x3f, 0x37, 0x26, 0x80,
+  0x3e, 0x04, 0x3b, 0x37, 0x37, 0x36, 0x2e, 0x80, 0x3e, 0x2b, 0x27, 0x37, 0x3f, 0x3f, 0x34, 0x3e,
+  0x2e, 0x3c, 0x3c, 0x3e, 0x37, 0x37, 0x17, 0x3a, 0x3e, 0x2e, 0x3f, 0x3f, 0x37, 0x27, 0x36, 0x3e,
+  0x3e, 0x1e, 0x3c, 0x3e, 0x2e, 0x35, 0x37, 0x3e, 0x3e, 0x37, 0x37, 0x3a, 0x3e, 0x3c, 0x3e, 0x3e,
+  0x3c, 0x3e, 0x27, 0x27, 0x37, 0x37, 0x80, 0x3e, 0x00, 0x3c, 0x80, 0x3e, 0x2d, 0x37, 0x37, 0x33,
+  0x33, 0x37, 0x35, 0x37, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x3f, 0x3e, 0x37, 0x37, 0x36, 0x3c, 0x37,
+  0x27, 0x34, 0x3e, 0x3e, 0x1f, 0x37, 0x27, 0x35, 0x34, 0x3e, 0x37, 0x34, 0x3c, 0x3e, 0x3f, 0x17,
+  0x35, 0x37, 0x36, 0x3c, 0x37, 0x27, 0x37, 0x27, 0x37, 0x17, 0x35, 0x82, 0x37, 0x80, 0x3f, 0x15,
+  0x3b, 0x36, 0x2e, 0x3c, 0x3e, 0x2e, 0x3e, 0x27, 0x37, 0x37, 0x17, 0x37, 0x36, 0x2e, 0x3e, 0x3c,
+  0x3e, 0x27, 0x36, 0x3e, 0x3e, 0x1e, 0x80, 0x3e, 0x18, 0x33, 0x36, 0x3e, 0x27, 0x37, 0x27, 0x35,
+  0x37, 0x37, 0x17, 0x3a, 0x3e, 0x35, 0x37, 0x37, 0x27, 0x35, 0x37, 0x27, 0x33, 0x37, 0x1e, 0x3e,
+  0x3e, 0x2e, 0x80, 0x37, 0x12, 0x27, 0x33, 0x33, 0x37, 0x3f, 0x3f, 0x3e, 0x3e, 0x37, 0x34, 0x3e,
+  0x2e, 0x3b, 0x33, 0x37, 0x36, 0x2e, 0x3e, 0x3e, 0x80, 0x3f, 0x0b, 0x3a, 0x3e, 0x3e, 0x3c, 0x37,
+  0x27, 0x35, 0x37, 0x27, 0x35, 0x37, 0x37, 0x80, 0x3f, 0x06, 0x37, 0x35, 0x36, 0x2e, 0x35, 0x37,
+  0x17, 0x84, 0x37, 0x19, 0x34, 0x3e, 0x3b, 0x37, 0x3e, 0x3e, 0x27, 0x37, 0x3f, 0x3e, 0x2e, 0x3e,
+  0x3e, 0x3a, 0x3c, 0x3f, 0x37, 0x3e, 0x3e, 0x37, 0x37, 0x27, 0x37, 0x17, 0x37, 0x35, 0x80, 0x37,
+  0x02, 0x35, 0x37, 0x37, 0x80, 0x3f, 0x08, 0x37, 0x37, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x2e, 0x3a,
+  0x80, 0x3e, 0x09, 0x3f, 0x37, 0x3f, 0x37, 0x27, 0x27, 0x37, 0x3a, 0x3e, 0x3e, 0x80, 0x37, 0x1e,
+  0x3f, 0x37, 0x27, 0x37, 0x17, 0x37, 0x37, 0x35, 0x34, 0x3e, 0x37, 0x37, 0x36, 0x3e, 0x3a, 0x3a,
+  0x3e, 0x27, 0x36, 0x3e, 0x27, 0x35, 0x37, 0x27, 0x37, 0x1e, 0x3e, 0x37, 0x36, 0x3c, 0x35, 0x80,
+  0x37, 0x06, 0x3f, 0x3f, 0x1e, 0x3e, 0x3c, 0x3e, 0x3e, 0x80, 0x37, 0x02, 0x33, 0x37, 0x17, 0x80,
+  0x37, 0x01, 0x36, 0x3c, 0x80, 0x3e, 0x00, 0x3a, 0x80, 0x3e, 0x00, 0x2e, 0x80, 0x3e, 0x1b, 0x2e,
+  0x37, 0x17, 0x3a, 0x3e, 0x3c, 0x37, 0x26, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x37,
+  0x37, 0x36, 0x2e, 0x3e, 0x3c, 0x3e, 0x3e, 0x1f, 0x37, 0x37, 0x27, 0x80, 0x37, 0x09, 0x35, 0x37,
+  0x33, 0x3f, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x2e, 0x80, 0x3e, 0x14, 0x37, 0x34, 0x3e, 0x3a, 0x3f,
+  0x37, 0x37, 0x36, 0x2e, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x1e, 0x3e, 0x35, 0x37, 0x37, 0x36, 0x3c,
+  0x80, 0x37, 0x23, 0x3e, 0x3f, 0x3e, 0x3f, 0x37, 0x27, 0x35, 0x37, 0x36, 0x3a, 0x3e, 0x1e, 0x3c,
+  0x3e, 0x3e, 0x27, 0x37, 0x3e, 0x3f, 0x3e, 0x3f, 0x17, 0x17, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x36,
+  0x3e, 0x3b, 0x3f, 0x3f, 0x37, 0x36, 0x2e, 0x81, 0x3e, 0x07, 0x3b, 0x33, 0x37, 0x35, 0x37, 0x26,
+  0x3e, 0x2e, 0x80, 0x3e, 0x03, 0x1e, 0x1e, 0x3e, 0x27, 0x81, 0x37, 0x38, 0x36, 0x3e, 0x1f, 0x17,
+  0x3e, 0x3f, 0x3f, 0x37, 0x35, 0x37, 0x26, 0x3e, 0x3b, 0x37, 0x1e, 0x3e, 0x3c, 0x37, 0x26, 0x3e,
+  0x35, 0x37, 0x3f, 0x3f, 0x3e, 0x3c, 0x3e, 0x2e, 0x3c, 0x3e, 0x2e, 0x2e, 0x37, 0x1e, 0x3b, 0x37,
+  0x36, 0x3f, 0x3f, 0x36, 0x3e, 0x37, 0x37, 0x17, 0x17, 0x37, 0x27, 0x35, 0x36, 0x3f, 0x37, 0x3e,
+  0x3e, 0x3a, 0x3f, 0x1e, 0x3e, 0x80, 0x37, 0x04, 0x27, 0x36, 0x3c, 0x3e, 0x1f, 0x80, 0x37, 0x2f,
+  0x27, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x17, 0x33, 0x37, 0x27, 0x35, 0x37, 0x37, 0x36, 0x3e, 0x3e,
+  0x3f, 0x3f, 0x3e, 0x27, 0x37, 0x35, 0x37, 0x26, 0x3c, 0x3e, 0x3e, 0x1f, 0x37, 0x35, 0x36, 0x3e,
+  0x2e, 0x3e, 0x37, 0x36, 0x3a, 0x3f, 0x17, 0x37, 0x26, 0x3e, 0x27, 0x36, 0x3e, 0x37, 0x37, 0x33,
+  0x82, 0x37, 0x00, 0x26, 0x83, 0x3f, 0x0e, 0x35, 0x37, 0x26, 0x3e, 0x3e, 0x35, 0x36, 0x3b, 0x33,
+  0x37, 0x35, 0x36, 0x3e, 0x27, 0x34, 0x80, 0x3e, 0x01, 0x1e, 0x1e, 0x80, 0x3e, 0x1e, 0x33, 0x37,
+  0x36, 0x3e, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x1f, 0x33, 0x37, 0x37, 0x27, 0x37, 0x37, 0x27, 0x35,
+  0x37, 0x33, 0x37, 0x17, 0x37, 0x36, 0x2e, 0x3c, 0x3e, 0x3e, 0x2e, 0x3e, 0x1f, 0x80, 0x3f, 0x09,
+  0x37, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x3a, 0x3f, 0x37, 0x34, 0x80, 0x3e, 0x0c, 0x3f, 0x3f, 0x33,
+  0x33, 0x37, 0x3c, 0x37, 0x27, 0x35, 0x36, 0x2e, 0x3c, 0x3e, 0x81, 0x3f, 0x12, 0x27, 0x37, 0x36,
+  0x3c, 0x37, 0x27, 0x37, 0x37, 0x1e, 0x3e, 0x3e, 0x37, 0x27, 0x36, 0x3f, 0x3f, 0x37, 0x37, 0x3a,
+  0x80, 0x3e, 0x0a, 0x2e, 0x3f, 0x3e, 0x3e, 0x2e, 0x3a, 0x3e, 0x1e, 0x3f, 0x37, 0x3f, 0x80, 0x37,
+  0x0a, 0x36, 0x1e, 0x3b, 0x37, 0x27, 0x36, 0x3e, 0x37, 0x27, 0x37, 0x37, 0x80, 0x3f, 0x04, 0x3e,
+  0x37, 0x37, 0x36, 0x3e, 0x81, 0x37, 0x29, 0x1e, 0x3c, 0x3c, 0x3e, 0x3e, 0x3d, 0x36, 0x2e, 0x3e,
+  0x3b, 0x37, 0x1e, 0x3e, 0x37, 0x35, 0x37, 0x3f, 0x3e, 0x27, 0x17, 0x3a, 0x3e, 0x3e, 0x2e, 0x3e,
+  0x2e, 0x37, 0x35, 0x37, 0x37, 0x3a, 0x3a, 0x3c, 0x3e, 0x3e, 0x35, 0x37, 0x27, 0x34, 0x3e, 0x1f,
+  0x17, 0x80, 0x3e, 0x1b, 0x37, 0x37, 0x35, 0x34, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x2e, 0x37, 0x36,
+  0x3e, 0x3e, 0x35, 0x37, 0x3a, 0x3b, 0x37, 0x37, 0x26, 0x3e, 0x3e, 0x3c, 0x3c, 0x3e, 0x1e, 0x3a,
+  0x81, 0x3e, 0x0d, 0x2e, 0x2e, 0x3c, 0x3e, 0x3e, 0x1f, 0x17, 0x36, 0x3c, 0x37, 0x37, 0x36, 0x3f,
+  0x37, 0x80, 0x3f, 0x04, 0x3e, 0x3e, 0x37, 0x37, 0x34, 0x80, 0x3e, 0x12, 0x1e, 0x3b, 0x37, 0x37,
+  0x36, 0x3e, 0x37, 0x37, 0x34, 0x3a, 0x3e, 0x3a, 0x3e, 0x3c, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x80,
+  0x3e, 0x0a, 0x27, 0x37, 0x36, 0x1e, 0x3c, 0x37, 0x36, 0x3c, 0x3e, 0x37, 0x36, 0x80, 0x3e, 0x0f,
+  0x3c, 0x3e, 0x3e, 0x37, 0x37, 0x36, 0x2e, 0x37, 0x37, 0x3f, 0x3f, 0x37, 0x37, 0x26, 0x3c, 0x3e,
+  0x80, 0x37, 0x06, 0x17, 0x36, 0x3e, 0x3e, 0x3c, 0x3f, 0x3f, 0x81, 0x3e, 0x03, 0x3a, 0x37, 0x37,
+  0x36, 0x80, 0x3e, 0x01, 0x37, 0x37, 0x80, 0x3f, 0x19, 0x37, 0x37, 0x34, 0x3c, 0x3e, 0x3e, 0x37,
+  0x33, 0x37, 0x37, 0x34, 0x3e, 0x3e, 0x37, 0x37, 0x3e, 0x3c, 0x3e, 0x1e, 0x3e, 0x3c, 0x3e, 0x27,
+  0x36, 0x3e, 0x27, 0x82, 0x37, 0x06, 0x3e, 0x3f, 0x37, 0x26, 0x3c, 0x3e, 0x2e, 0x80, 0x3e, 0x12,
+  0x37, 0x27, 0x35, 0x37, 0x36, 0x3e, 0x3f, 0x37, 0x3f, 0x3e, 0x35, 0x36, 0x2e, 0x3c, 0x3e, 0x3e,
+  0x35, 0x37, 0x17, 0x81, 0x37, 0x20, 0x3f, 0x36, 0x3e, 0x3e, 0x27, 0x36, 0x3e, 0x37, 0x27, 0x36,
+  0x3e, 0x3f, 0x37, 0x3f, 0x36, 0x3e, 0x37, 0x37, 0x26, 0x3e, 0x37, 0x37, 0x34, 0x3e, 0x3e, 0x3a,
+  0x37, 0x3e, 0x3e, 0x35, 0x37, 0x37, 0x36, 0x82, 0x3e, 0x04, 0x37, 0x26, 0x3c, 0x3e, 0x27, 0x81,
+  0x37, 0x07, 0x3f, 0x3e, 0x3e, 0x37, 0x26, 0x3c, 0x3e, 0x2e, 0x81, 0x3e, 0x05, 0x35, 0x37, 0x37,
+  0x26, 0x2e, 0x3e, 0x81, 0x37, 0x10, 0x35, 0x36, 0x2e, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x1e, 0x3e,
+  0x3c, 0x3c, 0x3e, 0x3c, 0x3e, 0x2e, 0x3e, 0x80, 0x3f, 0x03, 0x3e, 0x3e, 0x27, 0x3c, 0x80, 0x3e,
+  0x00, 0x27, 0x81, 0x37, 0x0c, 0x35, 0x37, 0x27, 0x35, 0x36, 0x3e, 0x3e, 0x3b, 0x37, 0x37, 0x36,
+  0x3e, 0x35, 0x80, 0x37, 0x18, 0x26, 0x3c, 0x3e, 0x3e, 0x37, 0x27, 0x35, 0x37, 0x37, 0x27, 0x37,
+  0x36, 0x2e, 0x3c, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e, 0x27, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x81, 0x3f,
+  0x46, 0x27, 0x37, 0x36, 0x3e, 0x3c, 0x3e, 0x35, 0x37, 0x35, 0x37, 0x26, 0x3e, 0x37, 0x37, 0x3f,
+  0x37, 0x27, 0x27, 0x35, 0x37, 0x37, 0x27, 0x35, 0x36, 0x2e, 0x3c, 0x37, 0x3e, 0x3f, 0x37, 0x3e,
+  0x3e, 0x37, 0x37, 0x36, 0x3c, 0x3e, 0x3c, 0x3e, 0x35, 0x37, 0x37, 0x35, 0x37, 0x3f, 0x3f, 0x3e,
+  0x35, 0x37, 0x35, 0x37, 0x36, 0x3e, 0x37, 0x27, 0x36, 0x3c, 0x36, 0x3c, 0x3e, 0x3e, 0x3f, 0x3f,
+  0x37, 0x37, 0x36, 0x3e, 0x37, 0x35, 0x36, 0x3c, 0x82, 0x3e, 0x04, 0x3c, 0x37, 0x3f, 0x37, 0x3c,
+  0x80, 0x3e, 0x02, 0x37, 0x36, 0x3c, 0x80, 0x3e, 0x06, 0x3c, 0x37, 0x36, 0x3e, 0x3f, 0x3e, 0x3c,
+  0x81, 0x3e, 0x2a, 0x2e, 0x3e, 0x3e, 0x2e, 0x37, 0x3f, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x3e, 0x3e,
+  0x2e, 0x35, 0x37, 0x37, 0x36, 0x2e, 0x3e, 0x35, 0x37, 0x37, 0x36, 0x3c, 0x3e, 0x2e, 0x35, 0x37,
+  0x27, 0x37, 0x27, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x37, 0x34, 0x3e, 0x36, 0x3e, 0x3c, 0x81, 0x3e,
+  0x06, 0x37, 0x37, 0x3f, 0x37, 0x34, 0x3e, 0x3c, 0x80, 0x37, 0x0e, 0x26, 0x3e, 0x3c, 0x3e, 0x3c,
+  0x3e, 0x37, 0x37, 0x35, 0x36, 0x3e, 0x2e, 0x35, 0x37, 0x27, 0x80, 0x37, 0x10, 0x36, 0x3e, 0x37,
+  0x27, 0x37, 0x37, 0x3e, 0x3f, 0x3f, 0x3e, 0x36, 0x3c, 0x37, 0x26, 0x3e, 0x2e, 0x3e, 0x80, 0x3f,
+  0x81, 0x37, 0x09, 0x27, 0x35, 0x36, 0x27, 0x34, 0x3e, 0x2e, 0x37, 0x36, 0x2e, 0x80, 0x3e, 0x06,
+  0x37, 0x27, 0x37, 0x37, 0x36, 0x3e, 0x2e, 0x82, 0x37, 0x04, 0x36, 0x3e, 0x37, 0x36, 0x2e, 0x81,
+  0x3e, 0x01, 0x35, 0x37, 0x82, 0x3e, 0x00, 0x3c, 0x80, 0x3e, 0x10, 0x35, 0x37, 0x35, 0x37, 0x36,
+  0x3e, 0x2e, 0x3f, 0x3f, 0x37, 0x27, 0x36, 0x3e, 0x3e, 0x3c, 0x37, 0x36, 0x81, 0x3e, 0x80, 0x3f,
+  0x02, 0x3e, 0x3c, 0x3c, 0x81, 0x3e, 0x01, 0x35, 0x36, 0x80, 0x3e, 0x0a, 0x27, 0x37, 0x37, 0x3f,
+  0x37, 0x37, 0x36, 0x3c, 0x37, 0x36, 0x2e, 0x82, 0x3e, 0x2d, 0x3c, 0x3e, 0x35, 0x37, 0x3f, 0x3e,
+  0x3c, 0x3e, 0x3e, 0x2e, 0x3e, 0x37, 0x35, 0x37, 0x36, 0x2e, 0x37, 0x27, 0x35, 0x37, 0x37, 0x3f,
+  0x3f, 0x37, 0x37, 0x27, 0x35, 0x37, 0x35, 0x37, 0x36, 0x2e, 0x35, 0x37, 0x34, 0x3e, 0x2e, 0x3e,
+  0x37, 0x37, 0x34, 0x3e, 0x2e, 0x3e, 0x3e, 0x35, 0x80, 0x37, 0x06, 0x3e, 0x3f, 0x35, 0x37, 0x36,
+  0x3e, 0x27, 0x81, 0x37, 0x07, 0x34, 0x3e, 0x37, 0x27, 0x36, 0x3c, 0x3e, 0x2e, 0x80, 0x37, 0x14,
+  0x36, 0x3e, 0x37, 0x27, 0x36, 0x3c, 0x3e, 0x2e, 0x3e, 0x37, 0x35, 0x37, 0x35, 0x37, 0x35, 0x36,
+  0x3e, 0x2e, 0x3e, 0x3e, 0x2e, 0x80, 0x3f, 0x01, 0x37, 0x36, 0x82, 0x3e, 0x09, 0x2e, 0x37, 0x35,
+  0x37, 0x37, 0x27, 0x36, 0x3e, 0x3e, 0x2e, 0x80, 0x3e, 0x03, 0x37, 0x26, 0x3e, 0x27, 0x80, 0x37,
+  0x06, 0x36, 0x2e, 0x3e, 0x3f, 0x3e, 0x3e, 0x35, 0x81, 0x37, 0x0c, 0x36, 0x3e, 0x27, 0x37, 0x37,
+  0x3e, 0x3f, 0x37, 0x37, 0x35, 0x36, 0x3e, 0x3f, 0x81, 0x37, 0x80, 0x3e, 0x18, 0x2e, 0x3b, 0x33,
+  0x3e, 0x3e, 0x2e, 0x3c, 0x37, 0x27, 0x36, 0x3c, 0x3a, 0x3b, 0x37, 0x26, 0x3c, 0x3e, 0x2e, 0x3f,
+  0x3e, 0x3c, 0x37, 0x3f, 0x17, 0x3e, 0x82, 0x3f, 0x0d, 0x37, 0x37, 0x33, 0x33, 0x35, 0x37, 0x37,
+  0x36, 0x3e, 0x35, 0x37, 0x37, 0x3f, 0x3f, 0x80, 0x37, 0x09, 0x36, 0x2e, 0x37, 0x37, 0x35, 0x37,
+  0x33, 0x37, 0x37, 0x3f, 0x81, 0x3e, 0x0b, 0x37, 0x37, 0x17, 0x17, 0x27, 0x37, 0x37, 0x35, 0x37,
+  0x26, 0x3e, 0x3e, 0x80, 0x3f, 0x0a, 0x3e, 0x2e, 0x3e, 0x3e, 0x37, 0x37, 0x35, 0x37, 0x17, 0x17,
+  0x34, 0x80, 0x3e, 0x0f, 0x37, 0x3e, 0x3f, 0x37, 0x33, 0x37, 0x36, 0x2e, 0x2e, 0x3e, 0x3e, 0x27,
+  0x37, 0x37, 0x17, 0x17, 0x80, 0x37, 0x0b, 0x3e, 0x3e, 0x27, 0x36, 0x3e, 0x3a, 0x3a, 0x3e, 0x27,
+  0x37, 0x37, 0x36, 0x80, 0x3e, 0x01, 0x3a, 0x3b, 0x80, 0x37, 0x05, 0x36, 0x2e, 0x35, 0x37, 0x34,
+  0x3e, 0x80, 0x3f, 0x02, 0x37, 0x36, 0x3c, 0x80, 0x3e, 0x12, 0x27, 0x37, 0x17, 0x37, 0x35, 0x37,
+  0x37, 0x27, 0x36, 0x3e, 0x37, 0x3a, 0x3a, 0x3e, 0x2e, 0x3c, 0x3e, 0x37, 0x35, 0x80, 0x37, 0x0c,
+  0x17, 0x1e, 0x3e, 0x3e, 0x37, 0x35, 0x37, 0x37, 0x36, 0x3e, 0x1e, 0x1e, 0x3e, 0x80, 0x37, 0x26,
+  0x3f, 0x35, 0x37, 0x27, 0x33, 0x33, 0x37, 0x37, 0x27, 0x36, 0x3e, 0x37, 0x37, 0x27, 0x33, 0x33,
+  0x37, 0x36, 0x2e, 0x35, 0x37, 0x37, 0x36, 0x3e, 0x2e, 0x1e, 0x1e, 0x3e, 0x3e, 0x2e, 0x3e, 0x3f,
+  0x3f, 0x37, 0x37, 0x17, 0x1e, 0x3e, 0x3c, 0x80, 0x3e, 0x81, 0x3f, 0x09, 0x3a, 0x3e, 0x37, 0x27,
+  0x34, 0x3e, 0x27, 0x34, 0x3e, 0x35, 0x81, 0x37, 0x06, 0x3e, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x36,
+  0x80, 0x3e, 0x00, 0x3a, 0x80, 0x3e, 0x02, 0x37, 0x37, 0x26, 0x81, 0x3e, 0x09, 0x3f, 0x37, 0x3e,
+  0x3f, 0x37, 0x36, 0x27, 0x27, 0x37, 0x3f, 0x80, 0x3e, 0x3a, 0x2e, 0x3e, 0x2e, 0x3e, 0x3e, 0x37,
+  0x33, 0x33, 0x37, 0x26, 0x3c, 0x3e, 0x3e, 0x2e, 0x3c, 0x37, 0x33, 0x3e, 0x1e, 0x3f, 0x37, 0x3f,
+  0x3f, 0x35, 0x37, 0x34, 0x3e, 0x3b, 0x37, 0x37, 0x26, 0x3c, 0x37, 0x36, 0x3e, 0x2e, 0x37, 0x3f,
+  0x3f, 0x3e, 0x37, 0x37, 0x27, 0x35, 0x37, 0x26, 0x3e, 0x1e, 0x3b, 0x35, 0x37, 0x36, 0x2e, 0x3e,
+  0x3f, 0x37, 0x3e, 0x3a, 0x3b, 0x80, 0x37, 0x1e, 0x36, 0x2e, 0x37, 0x37, 0x34, 0x3e, 0x3a, 0x3e,
+  0x3e, 0x2f, 0x3f, 0x37, 0x37, 0x36, 0x3c, 0x37, 0x37, 0x1e, 0x3e, 0x3e, 0x35, 0x36, 0x2e, 0x3c,
+  0x37, 0x26, 0x3e, 0x3a, 0x3e, 0x2e, 0x35, 0x80, 0x37, 0x02, 0x36, 0x3e, 0x3a, 0x80, 0x3f, 0x37,
+  0x3e, 0x2e, 0x3e, 0x35, 0x36, 0x2e, 0x3e, 0x1f, 0x17, 0x37, 0x37, 0x34, 0x3e, 0x3e, 0x2e, 0x35,
+  0x36, 0x3f, 0x3f, 0x3e, 0x3e, 0x37, 0x37, 0x36, 0x3e, 0x37, 0x26, 0x3a, 0x3e, 0x3e, 0x2e, 0x35,
+  0x37, 0x36, 0x3e, 0x2e, 0x2e, 0x3e, 0x3b, 0x37, 0x37, 0x27, 0x3f, 0x3f, 0x37, 0x37, 0x36, 0x3e,
+  0x1e, 0x3e, 0x3e, 0x37, 0x36, 0x3c, 0x37, 0x26, 0x80, 0x3e, 0x00, 0x1f, 0x81, 0x37, 0x1d, 0x34,
+  0x3e, 0x2e, 0x3e, 0x3a, 0x3f, 0x37, 0x27, 0x36, 0x3e, 0x27, 0x36, 0x35, 0x36, 0x2e, 0x3e, 0x1e,
+  0x3c, 0x3e, 0x35, 0x37, 0x27, 0x37, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x37, 0x36, 0x81, 0x3e, 0x2f,
+  0x37, 0x36, 0x3e, 0x3c, 0x3e, 0x3e, 0x3b, 0x37, 0x27, 0x35, 0x37, 0x27, 0x35, 0x37, 0x27, 0x37,
+  0x17, 0x37, 0x37, 0x27, 0x35, 0x3e, 0x3e, 0x2e, 0x2e, 0x3e, 0x1f, 0x27, 0x3c, 0x3f, 0x3f, 0x3c,
+  0x3f, 0x37, 0x3e, 0x3f, 0x22, 0x3e, 0x3d, 0x37, 0x36, 0x2e, 0x37, 0x35, 0x36, 0x2e, 0x3e, 0x1f,
+  0x80, 0x37, 0x02, 0x35, 0x36, 0x3e, 0x80, 0x37, 0x03, 0x17, 0x37, 0x37, 0x3f, 0x80, 0x37, 0x05,
+  0x34, 0x3e, 0x3a, 0x3e, 0x1e, 0x3e, 0x80, 0x37, 0x02, 0x35, 0x37, 0x36, 0x80, 0x3f, 0x03, 0x37,
+  0x35, 0x36, 0x3e, 0x82, 0x37, 0x00, 0x17, 0x81, 0x37, 0x08, 0x36, 0x2e, 0x3f, 0x34, 0x3e, 0x1e,
+  0x3e, 0x3e, 0x2e, 0x80, 0x37, 0x00, 0x35, 0x80, 0x37, 0x0c, 0x1e, 0x3e, 0x37, 0x37, 0x3f, 0x37,
+  0x35, 0x37, 0x37, 0x33, 0x37, 0x37, 0x35, 0x84, 0x37, 0x0b, 0x17, 0x37, 0x36, 0x3e, 0x37, 0x34,
+  0x3e, 0x2e, 0x3c, 0x3e, 0x3a, 0x3f, 0x80, 0x37, 0x0b, 0x27, 0x37, 0x37, 0x36, 0x3e, 0x3a, 0x3e,
+  0x3e, 0x27, 0x37, 0x37, 0x36, 0x80, 0x3e, 0x23, 0x1e, 0x3f, 0x3e, 0x3e, 0x2e, 0x3c, 0x3c, 0x3e,
+  0x2e, 0x3e, 0x3e, 0x3b, 0x37, 0x36, 0x3e, 0x3e, 0x2e, 0x3e, 0x37, 0x36, 0x3a, 0x3e, 0x1e, 0x2e,
+  0x3e, 0x37, 0x37, 0x3f, 0x3e, 0x3c, 0x3e, 0x3a, 0x3b, 0x37, 0x27, 0x35, 0x80, 0x37, 0x07, 0x34,
+  0x3e, 0x3f, 0x33, 0x35, 0x37, 0x26, 0x3c, 0x80, 0x37, 0x08, 0x27, 0x37, 0x17, 0x17, 0x36, 0x2e,
+  0x3e, 0x3e, 0x3c, 0x80, 0x3e, 0x07, 0x3b, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x81, 0x3f,
+  0x23, 0x37, 0x27, 0x35, 0x37, 0x27, 0x34, 0x3e, 0x2e, 0x3e, 0x2e, 0x2f, 0x37, 0x3e, 0x3e, 0x3c,
+  0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x3f, 0x34, 0x3e, 0x37, 0x37, 0x27, 0x3f, 0x37,
+  0x37, 0x3c, 0x3f, 0x37, 0x37, 0x80, 0x3e, 0x05, 0x3c, 0x3e, 0x3c, 0x3e, 0x3f, 0x37, 0x81, 0x3e,
+  0x00, 0x3c, 0x80, 0x37, 0x2e, 0x33, 0x37, 0x34, 0x3e, 0x27, 0x36, 0x3c, 0x3e, 0x2e, 0x3c, 0x3e,
+  0x3a, 0x3f, 0x3f, 0x37, 0x3f, 0x35, 0x36, 0x3e, 0x3e, 0x2e, 0x3a, 0x3e, 0x2e, 0x3c, 0x3e, 0x3c,
+  0x37, 0x35, 0x37, 0x3e, 0x3f, 0x3f, 0x3c, 0x37, 0x35, 0x37, 0x26, 0x3c, 0x3e, 0x27, 0x37, 0x37,
+  0x36, 0x2e, 0x2e, 0x35, 0x82, 0x37, 0x5e, 0x33, 0x35, 0x36, 0x3e, 0x2e, 0x35, 0x36, 0x3e, 0x3e,
+  0x2e, 0x1e, 0x3e, 0x27, 0x37, 0x3e, 0x3e, 0x27, 0x37, 0x37, 0x27, 0x37, 0x1e, 0x3e, 0x3e, 0x3c,
+  0x37, 0x26, 0x3c, 0x3e, 0x2e, 0x3a, 0x3f, 0x35, 0x37, 0x27, 0x35, 0x37, 0x36, 0x3e, 0x37, 0x37,
+  0x17, 0x3f, 0x3f, 0x3e, 0x37, 0x36, 0x2e, 0x3c, 0x3e, 0x2e, 0x3e, 0x1e, 0x2e, 0x3e, 0x3c, 0x37,
+  0x27, 0x35, 0x37, 0x27, 0x37, 0x3f, 0x3f, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x36, 0x3c, 0x3e, 0x1e,
+  0x3e, 0x2e, 0x3e, 0x37, 0x36, 0x2e, 0x3e, 0x2e, 0x3e, 0x3a, 0x3e, 0x37, 0x37, 0x3f, 0x3f, 0x37,
+  0x3f, 0x37, 0x35, 0x37, 0x36, 0x2e, 0x80, 0x3e, 0x06, 0x2e, 0x3c, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e,
+  0x81, 0x37, 0x04, 0x26, 0x3e, 0x37, 0x37, 0x33, 0x80, 0x37, 0x0e, 0x27, 0x36, 0x3e, 0x3c, 0x37,
+  0x37, 0x17, 0x37, 0x27, 0x35, 0x37, 0x26, 0x3c, 0x3e, 0x3e, 0x81, 0x3f, 0x03, 0x36, 0x3e, 0x37,
+  0x36, 0x84, 0x3e, 0x28, 0x3c, 0x3f, 0x3e, 0x3c, 0x3e, 0x3d, 0x36, 0x2e, 0x3c, 0x3e, 0x3f, 0x3f,
+  0x37, 0x3f, 0x35, 0x37, 0x36, 0x3c, 0x37, 0x3e, 0x3f, 0x37, 0x37, 0x3e, 0x27, 0x27, 0x2e, 0x3f,
+  0x35, 0x37, 0x37, 0x3e, 0x3f, 0x34, 0x35, 0x37, 0x26, 0x3e, 0x3e, 0x2e, 0x3c, 0x82, 0x3e, 0x80,
+  0x37, 0x01, 0x36, 0x3e, 0x81, 0x37, 0x00, 0x3f, 0x80, 0x3e, 0x01, 0x3c, 0x3e, 0x80, 0x37, 0x08,
+  0x36, 0x3e, 0x3c, 0x37, 0x37, 0x36, 0x3e, 0x3f, 0x3f, 0x80, 0x3e, 0x03, 0x37, 0x36, 0x3e, 0x3e,
+  0x80, 0x37, 0x08, 0x17, 0x27, 0x37, 0x36, 0x3e, 0x3c, 0x37, 0x26, 0x3c, 0x80, 0x3e, 0x00, 0x3c,
+  0x80, 0x3e, 0x04, 0x3c, 0x3e, 0x27, 0x36, 0x3a, 0x80, 0x3e, 0x04, 0x37, 0x27, 0x37, 0x36, 0x2e,
+  0x80, 0x37, 0x01, 0x36, 0x2e, 0x80, 0x37, 0x05, 0x36, 0x3e, 0x37, 0x27, 0x17, 0x36, 0x81, 0x3e,
+  0x0b, 0x3c, 0x3e, 0x2e, 0x35, 0x37, 0x37, 0x3e, 0x3f, 0x35, 0x37, 0x36, 0x3e, 0x82, 0x37, 0x2c,
+  0x35, 0x36, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x37, 0x3e, 0x3f, 0x3f, 0x37, 0x26, 0x3e, 0x2e, 0x3c,
+  0x3e, 0x37, 0x37, 0x27, 0x37, 0x35, 0x35, 0x37, 0x36, 0x2e, 0x37, 0x34, 0x3e, 0x3e, 0x3c, 0x3e,
+  0x26, 0x37, 0x3f, 0x3f, 0x37, 0x36, 0x3a, 0x3f, 0x36, 0x3c, 0x37, 0x26, 0x3e, 0x81, 0x37, 0x13,
+  0x3f, 0x3e, 0x2e, 0x3c, 0x37, 0x27, 0x37, 0x34, 0x3e, 0x2e, 0x3e, 0x2e, 0x3c, 0x37, 0x36, 0x2e,
+  0x2e, 0x37, 0x37, 0x26, 0x81, 0x3e, 0x81, 0x37, 0x11, 0x27, 0x37, 0x37, 0x3f, 0x3f, 0x3e, 0x2e,
+  0x3c, 0x37, 0x27, 0x34, 0x3e, 0x37, 0x3c, 0x3e, 0x3e, 0x3f, 0x34, 0x81, 0x3e, 0x01, 0x3f, 0x37,
+  0x80, 0x3f, 0x16, 0x3e, 0x3e, 0x27, 0x3e, 0x3e, 0x3d, 0x37, 0x3e, 0x2e, 0x27, 0x3f, 0x27, 0x37,
+  0x3e, 0x37, 0x37, 0x27, 0x3e, 0x27, 0x3e, 0x2e, 0x2e, 0x3f, 0x80, 0x37, 0x2c, 0x27, 0x36, 0x3e,
+  0x37, 0x35, 0x37, 0x27, 0x35, 0x37, 0x27, 0x34, 0x3e, 0x2e, 0x35, 0x37, 0x35, 0x37, 0x3f, 0x3e,
+  0x3c, 0x37, 0x27, 0x37, 0x35, 0x37, 0x37, 0x27, 0x35, 0x36, 0x3e, 0x3e, 0x2e, 0x3c, 0x3e, 0x3f,
+  0x3f, 0x3e, 0x27, 0x35, 0x37, 0x27, 0x35, 0x37, 0x27, 0x34, 0x80, 0x3e, 0x01, 0x37, 0x27, 0x81,
+  0x37, 0x27, 0x36, 0x3c, 0x3e, 0x3e, 0x37, 0x34, 0x3e, 0x2e, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3c,
+  0x3e, 0x27, 0x36, 0x3e, 0x2e, 0x3e, 0x3e, 0x3c, 0x37, 0x35, 0x37, 0x37, 0x27, 0x34, 0x3e, 0x2e,
+  0x35, 0x37, 0x37, 0x35, 0x37, 0x26, 0x3c, 0x37, 0x34, 0x3e, 0x82, 0x37, 0x18, 0x3f, 0x3e, 0x37,
+  0x35, 0x37, 0x27, 0x34, 0x3e, 0x3e, 0x3c, 0x37, 0x36, 0x3e, 0x2e, 0x35, 0x37, 0x27, 0x35, 0x37,
+  0x3f, 0x3e, 0x3f, 0x37, 0x37, 0x27, 0x80, 0x37, 0x12, 0x27, 0x36, 0x3e, 0x35, 0x36, 0x3e, 0x3c,
+  0x3e, 0x3e, 0x3c, 0x3e, 0x3e, 0x2e, 0x3e, 0x37, 0x3e, 0x3f, 0x37, 0x3f, 0x82, 0x3e, 0x80, 0x37,
+  0x0d, 0x35, 0x36, 0x3c, 0x3f, 0x3f, 0x3e, 0x3f, 0x36, 0x3e, 0x3e, 0x37, 0x35, 0x37, 0x36, 0x80,
+  0x3e, 0x82, 0x37, 0x00, 0x27, 0x80, 0x37, 0x0c, 0x27, 0x34, 0x3e, 0x2e, 0x3c, 0x3e, 0x27, 0x37,
+  0x37, 0x3f, 0x37, 0x37, 0x3f, 0x82, 0x37, 0x1e, 0x35, 0x2e, 0x3e, 0x3e, 0x2e, 0x27, 0x27, 0x3e,
+  0x3f, 0x27, 0x27, 0x26, 0x2e, 0x3e, 0x3e, 0x3c, 0x3f, 0x3e, 0x3f, 0x26, 0x3c, 0x3e, 0x3e, 0x3f,
+  0x37, 0x3e, 0x37, 0x37, 0x3e, 0x3f, 0x35, 0x80, 0x37, 0x01, 0x3e, 0x3f, 0x80, 0x37, 0x0a, 0x27,
+  0x34, 0x3e, 0x3e, 0x27, 0x36, 0x2e, 0x3e, 0x37, 0x36, 0x3e, 0x80, 0x37, 0x06, 0x36, 0x3e, 0x3e,
+  0x3c, 0x3e, 0x3f, 0x3f, 0x80, 0x37, 0x05, 0x36, 0x2e, 0x37, 0x36, 0x2e, 0x3e, 0x80, 0x37, 0x03,
+  0x26, 0x3e, 0x37, 0x37, 0x83, 0x3e, 0x02, 0x37, 0x36, 0x3e, 0x80, 0x37, 0x21, 0x26, 0x3e, 0x2e,
+  0x37, 0x37, 0x26, 0x3c, 0x37, 0x27, 0x36, 0x3c, 0x37, 0x27, 0x37, 0x36, 0x3e, 0x2e, 0x37, 0x27,
+  0x35, 0x34, 0x3e, 0x37, 0x37, 0x35, 0x37, 0x36, 0x2e, 0x35, 0x37, 0x35, 0x36, 0x3c, 0x3e, 0x83,
+  0x37, 0x01, 0x3f, 0x36, 0x80, 0x3e, 0x00, 0x3c, 0x80, 0x37, 0x08, 0x27, 0x35, 0x36, 0x2e, 0x3f,
+  0x37, 0x35, 0x36, 0x3e, 0x80, 0x37, 0x04, 0x34, 0x3e, 0x3c, 0x3e, 0x2e, 0x81, 0x3e, 0x0a, 0x37,
+  0x36, 0x3e, 0x3f, 0x3f, 0x3e, 0x2e, 0x3e, 0x37, 0x36, 0x2e, 0x82, 0x37, 0x03, 0x36, 0x3e, 0x37,
+  0x27, 0x81, 0x37, 0x3d, 0x36, 0x2e, 0x34, 0x3e, 0x3f, 0x3e, 0x3f, 0x35, 0x35, 0x34, 0x3c, 0x3e,
+  0x2e, 0x3c, 0x37, 0x35, 0x37, 0x36, 0x3e, 0x3f, 0x3f, 0x3e, 0x3e, 0x2e, 0x3c, 0x3e, 0x37, 0x35,
+  0x37, 0x26, 0x3e, 0x2e, 0x3c, 0x3e, 0x27, 0x36, 0x3e, 0x3c, 0x37, 0x26, 0x3e, 0x37, 0x37, 0x36,
+  0x3e, 0x37, 0x37, 0x36, 0x3c, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x2e, 0x3c, 0x37, 0x26, 0x3e, 0x36,
+  0x3f, 0x27, 0x80, 0x37, 0x04, 0x35, 0x3e, 0x3f, 0x37, 0x37, 0x81, 0x3f, 0x01, 0x3e, 0x3d, 0x81,
+  0x37, 0x27, 0x27, 0x37, 0x27, 0x35, 0x3c, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e, 0x2e, 0x3c, 0x3c, 0x3e,
+  0x3f, 0x27, 0x3e, 0x3f, 0x37, 0x36, 0x3e, 0x3e, 0x2e, 0x3e, 0x27, 0x35, 0x37, 0x27, 0x34, 0x3e,
+  0x2e, 0x3c, 0x3e, 0x2e, 0x37, 0x36, 0x3e, 0x3e, 0x2e, 0x35, 0x80, 0x37, 0x1a, 0x35, 0x37, 0x36,
+  0x3c, 0x3e, 0x2e, 0x37, 0x37, 0x35, 0x36, 0x3f, 0x3f, 0x3e, 0x2e, 0x3c, 0x37, 0x27, 0x35, 0x37,
+  0x27, 0x34, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x3c, 0x82, 0x37, 0x08, 0x27, 0x37, 0x37, 0x36, 0x2e,
+  0x3e, 0x37, 0x37, 0x27, 0x81, 0x37, 0x02, 0x27, 0x34, 0x3e, 0x80, 0x37, 0x00, 0x36, 0x80, 0x3e,
+  0x0b, 0x37, 0x35, 0x36, 0x2e, 0x35, 0x37, 0x26, 0x3f, 0x37, 0x37, 0x26, 0x3c, 0x80, 0x37, 0x30,
+  0x26, 0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x3f, 0x3c, 0x3e, 0x3e, 0x2e, 0x3c, 0x3e, 0x27, 0x37, 0x37,
+  0x36, 0x3e, 0x37, 0x27, 0x34, 0x3e, 0x27, 0x35, 0x35, 0x37, 0x3e, 0x3f, 0x3f, 0x36, 0x3c, 0x3c,
+  0x3e, 0x37, 0x35, 0x34, 0x3c, 0x3e, 0x2e, 0x2e, 0x3e, 0x3e, 0x37, 0x26, 0x3c, 0x37, 0x26, 0x3f,
+  0x37, 0x80, 0x3e, 0x02, 0x3f, 0x3f, 0x3e, 0x80, 0x37, 0x01, 0x36, 0x3e, 0x80, 0x37, 0x13, 0x36,
+  0x3f, 0x3f, 0x3e, 0x3e, 0x3f, 0x37, 0x36, 0x3e, 0x37, 0x35, 0x36, 0x3e, 0x3e, 0x27, 0x37, 0x36,
+  0x3e, 0x3e, 0x2e, 0x81, 0x37, 0x0e, 0x27, 0x35, 0x36, 0x2e, 0x3c, 0x3e, 0x3c, 0x3e, 0x3e, 0x3c,
+  0x37, 0x37, 0x3f, 0x37, 0x36, 0x80, 0x3e, 0x2d, 0x27, 0x37, 0x26, 0x3e, 0x3f, 0x27, 0x34, 0x3e,
+  0x37, 0x37, 0x27, 0x27, 0x3e, 0x3e, 0x3c, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x27, 0x37, 0x37, 0x3f,
+  0x37, 0x3e, 0x3e, 0x3f, 0x37, 0x3e, 0x3f, 0x35, 0x37, 0x3e, 0x3e, 0x3f, 0x35, 0x37, 0x37, 0x27,
+  0x27, 0x35, 0x35, 0x37, 0x37, 0x36, 0x80, 0x3e, 0x1a, 0x37, 0x37, 0x36, 0x3e, 0x37, 0x36, 0x3e,
+  0x3e, 0x37, 0x35, 0x37, 0x36, 0x3e, 0x3e, 0x27, 0x34, 0x3e, 0x37, 0x35, 0x37, 0x37, 0x36, 0x2e,
+  0x3c, 0x37, 0x35, 0x37, 0x80, 0x3e, 0x1e, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x37, 0x37, 0x36, 0x3e,
+  0x37, 0x37, 0x34, 0x3e, 0x3c, 0x3e, 0x2e, 0x35, 0x36, 0x3e, 0x3e, 0x35, 0x37, 0x37, 0x35, 0x35,
+  0x37, 0x37, 0x36, 0x2e, 0x37, 0x26, 0x80, 0x3e, 0x08, 0x3c, 0x3e, 0x27, 0x35, 0x36, 0x2e, 0x37,
+  0x27, 0x36, 0x80, 0x3e, 0x80, 0x37, 0x00, 0x3f, 0x81, 0x3e, 0x15, 0x37, 0x27, 0x37, 0x35, 0x37,
+  0x27, 0x35, 0x37, 0x26, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x26, 0x3c, 0x37, 0x35, 0x37,
+  0x36, 0x81, 0x3e, 0x09, 0x37, 0x37, 0x3f, 0x3e, 0x3e, 0x3f, 0x36, 0x3e, 0x37, 0x35, 0x80, 0x37,
+  0x1c, 0x36, 0x3e, 0x37, 0x34, 0x3c, 0x3e, 0x37, 0x36, 0x3e, 0x37, 0x34, 0x3e, 0x27, 0x35, 0x37,
+  0x3f, 0x37, 0x3e, 0x3e, 0x37, 0x34, 0x3e, 0x2e, 0x3c, 0x3e, 0x27, 0x37, 0x26, 0x36, 0x80, 0x3f,
+  0x06, 0x35, 0x37, 0x27, 0x35, 0x37, 0x37, 0x34, 0x80, 0x3e, 0x08, 0x35, 0x36, 0x2e, 0x37, 0x35,
+  0x34, 0x3e, 0x27, 0x36, 0x81, 0x3e, 0x03, 0x35, 0x36, 0x3e, 0x27, 0x81, 0x37, 0x03, 0x3e, 0x37,
+  0x27, 0x34, 0x82, 0x3e, 0x1d, 0x3c, 0x3f, 0x37, 0x3d, 0x3c, 0x3e, 0x37, 0x37, 0x3d, 0x3f, 0x3e,
+  0x3c, 0x3c, 0x35, 0x34, 0x3e, 0x3e, 0x3c, 0x3c, 0x34, 0x3c, 0x37, 0x35, 0x37, 0x3e, 0x27, 0x37,
+  0x27, 0x3e, 0x3c, 0x81, 0x3e, 0x17, 0x2e, 0x3e, 0x3e, 0x37, 0x36, 0x3c, 0x37, 0x27, 0x37, 0x34,
+  0x3e, 0x2e, 0x3c, 0x3e, 0x2e, 0x3c, 0x3e, 0x35, 0x37, 0x2e, 0x37, 0x34, 0x3e, 0x2e, 0x81, 0x37,
+  0x03, 0x26, 0x3e, 0x3e, 0x27, 0x84, 0x37, 0x13, 0x27, 0x35, 0x37, 0x26, 0x3c, 0x3e, 0x27, 0x35,
+  0x37, 0x27, 0x37, 0x35, 0x36, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x80, 0x37, 0x05, 0x34,
+  0x3e, 0x37, 0x36, 0x3e, 0x27, 0x81, 0x37, 0x02, 0x34, 0x3e, 0x2e, 0x84, 0x37, 0x25, 0x36, 0x2e,
+  0x3c, 0x3e, 0x2e, 0x3c, 0x3e, 0x3f, 0x37, 0x3e, 0x2e, 0x35, 0x35, 0x37, 0x36, 0x3c, 0x3e, 0x37,
+  0x37, 0x36, 0x3e, 0x3f, 0x27, 0x35, 0x37, 0x27, 0x35, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x3e,
+  0x2e, 0x3c, 0x37, 0x27, 0x80, 0x37, 0x20, 0x3e, 0x3f, 0x3f, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x37,
+  0x37, 0x34, 0x3e, 0x37, 0x27, 0x37, 0x37, 0x35, 0x37, 0x27, 0x37, 0x2e, 0x3e, 0x37, 0x36, 0x3e,
+  0x34, 0x3e, 0x3f, 0x3e, 0x2e, 0x3c, 0x3e, 0x3e, 0x80, 0x37, 0x10, 0x36, 0x2e, 0x3f, 0x37, 0x3f,
+  0x37, 0x3f, 0x3f, 0x37, 0x36, 0x3e, 0x37, 0x27, 0x37, 0x37, 0x34, 0x3c, 0x80, 0x3e, 0x00, 0x3c,
+  0x81, 0x3e, 0x03, 0x3c, 0x37, 0x27, 0x34, 0x80, 0x3e, 0x2f, 0x27, 0x36, 0x2e, 0x3e, 0x2e, 0x3e,
+  0x27, 0x37, 0x36, 0x3e, 0x3c, 0x3e, 0x3e, 0x35, 0x37, 0x27, 0x37, 0x3e, 0x3e, 0x3f, 0x35, 0x3e,
+  0x3f, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x3e, 0x3f, 0x37, 0x35, 0x37, 0x37, 0x3f, 0x3f, 0x3e, 0x3f,
+  0x3f, 0x37, 0x3e, 0x2e, 0x3e, 0x36, 0x3e, 0x3e, 0x2e, 0x3f, 0x81, 0x37, 0x00, 0x35, 0x81, 0x37,
+  0x0b, 0x27, 0x17, 0x37, 0x37, 0x36, 0x3e, 0x37, 0x37, 0x35, 0x37, 0x36, 0x1e, 0x81, 0x3e, 0x10,
+  0x2e, 0x3c, 0x3e, 0x27, 0x37, 0x37, 0x36, 0x3e, 0x2e, 0x35, 0x36, 0x2e, 0x35, 0x36, 0x2e, 0x3e,
+  0x3e, 0x83, 0x37, 0x2b, 0x36, 0x3e, 0x2e, 0x3e, 0x3e, 0x2e, 0x3e, 0x2e, 0x35, 0x37, 0x26, 0x3e,
+  0x3c, 0x1e, 0x3c, 0x3e, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x27, 0x34, 0x3e, 0x3c, 0x3e, 0x3e, 0x37,
+  0x27, 0x34, 0x3e, 0x2e, 0x35, 0x37, 0x17, 0x27, 0x37, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x37, 0x3f,
+  0x82, 0x3e, 0x09, 0x3c, 0x3e, 0x37, 0x37, 0x26, 0x3f, 0x35, 0x36, 0x37, 0x36, 0x80, 0x3e, 0x1f,
+  0x37, 0x35, 0x33, 0x37, 0x36, 0x3e, 0x27, 0x36, 0x3e, 0x3e, 0x37, 0x26, 0x2e, 0x3e, 0x3f, 0x3f,
+  0x3e, 0x3f, 0x37, 0x27, 0x36, 0x3e, 0x2e, 0x1e, 0x3e, 0x3e, 0x2e, 0x3e, 0x3c, 0x3e, 0x37, 0x37,
+  0x80, 0x3e, 0x04, 0x27, 0x35, 0x37, 0x26, 0x3f, 0x82, 0x37, 0x11, 0x36, 0x3e, 0x2e, 0x35, 0x36,
+  0x2e, 0x3e, 0x37, 0x27, 0x37, 0x3e, 0x3f, 0x37, 0x3e, 0x3c, 0x3e, 0x2e, 0x3e, 0x82, 0x37, 0x06,
+  0x27, 0x34, 0x3e, 0x3e, 0x37, 0x26, 0x3a, 0x80, 0x3e, 0x10, 0x37, 0x35, 0x36, 0x2e, 0x3e, 0x3e,
+  0x3a, 0x3e, 0x3e, 0x27, 0x37, 0x37, 0x27, 0x35, 0x36, 0x3e, 0x35, 0x85, 0x37, 0x05, 0x3f, 0x3e,
+  0x3f, 0x3f, 0x36, 0x37, 0x80, 0x3e, 0x00, 0x3c, 0x80, 0x37, 0x04, 0x36, 0x36, 0x2e, 0x3e, 0x34,
+  0x81, 0x3e, 0x0c, 0x2e, 0x3e, 0x3e, 0x37, 0x27, 0x37, 0x37, 0x27, 0x34, 0x3e, 0x35, 0x36, 0x2e,
+  0x80, 0x37, 0x15, 0x26, 0x3c, 0x3e, 0x2e, 0x3c, 0x37, 0x36, 0x3e, 0x2e, 0x3e, 0x3c, 0x37, 0x26,
+  0x3e, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x3c, 0x3e, 0x81, 0x37, 0x01, 0x36, 0x3e, 0x80, 0x37,
+  0x0c, 0x27, 0x34, 0x3e, 0x27, 0x34, 0x3e, 0x2e, 0x37, 0x37, 0x17, 0x37, 0x36, 0x2e, 0x81, 0x3e,
+  0x08, 0x2e, 0x37, 0x37, 0x36, 0x3e, 0x27, 0x37, 0x37, 0x36, 0x83, 0x3e, 0x04, 0x27, 0x37, 0x36,
+  0x3e, 0x3f, 0x82, 0x37, 0x1d, 0x35, 0x37, 0x27, 0x35, 0x37, 0x27, 0x3f, 0x37, 0x3e, 0x3c, 0x37,
+  0x34, 0x3e, 0x37, 0x37, 0x27, 0x26, 0x3e, 0x3a, 0x37, 0x35, 0x3e, 0x2e, 0x35, 0x36, 0x2e, 0x3c,
+  0x3e, 0x3e, 0x3c, 0x80, 0x3e, 0x02, 0x3c, 0x37, 0x27, 0x80, 0x37, 0x07, 0x17, 0x37, 0x3e, 0x3f,
+  0x3f, 0x36, 0x3e, 0x3c, 0x80, 0x37, 0x10, 0x27, 0x37, 0x37, 0x36, 0x3e, 0x35, 0x37, 0x37, 0x3f,
+  0x33, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x26, 0x3c, 0x81, 0x3e, 0x00, 0x3c, 0x82, 0x3e, 0x03, 0x3c,
+  0x3e, 0x37, 0x37, 0x80, 0x3f, 0x0d, 0x37, 0x37, 0x36, 0x3e, 0x35, 0x37, 0x33, 0x27, 0x36, 0x3e,
+  0x37, 0x37, 0x36, 0x2e, 0x81, 0x3e, 0x07, 0x2e, 0x35, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x81,
+  0x37, 0x00, 0x34, 0x81, 0x3e, 0x0b, 0x2e, 0x3e, 0x3e, 0x27, 0x37, 0x27, 0x35, 0x37, 0x27, 0x37,
+  0x3f, 0x3f, 0x80, 0x3e, 0x09, 0x2e, 0x36, 0x2e, 0x3c, 0x3e, 0x3e, 0x37, 0x35, 0x37, 0x27, 0x80,
+  0x37, 0x0b, 0x36, 0x2e, 0x3e, 0x27, 0x37, 0x34, 0x3c, 0x3e, 0x3e, 0x37, 0x26, 0x3e, 0x82, 0x37,
+  0x01, 0x35, 0x36, 0x80, 0x3e, 0x07, 0x37, 0x36, 0x3e, 0x3c, 0x3e, 0x2e, 0x37, 0x35, 0x81, 0x37,
+  0x04, 0x35, 0x37, 0x27, 0x34, 0x3e, 0x81, 0x37, 0x06, 0x27, 0x34, 0x3e, 0x2e, 0x3c, 0x3e, 0x3c,
+  0x83, 0x37, 0x33, 0x36, 0x3e, 0x3e, 0x27, 0x36, 0x3c, 0x37, 0x37, 0x36, 0x2e, 0x35, 0x36, 0x3e,
+  0x3e, 0x35, 0x37, 0x27, 0x37, 0x36, 0x3c, 0x37, 0x27, 0x34, 0x3e, 0x2e, 0x3e, 0x37, 0x37, 0x27,
+  0x37, 0x27, 0x37, 0x3f, 0x35, 0x36, 0x2e, 0x35, 0x36, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x37, 0x3f,
+  0x3f, 0x37, 0x35, 0x37, 0x34, 0x3e, 0x2e, 0x80, 0x37, 0x0e, 0x36, 0x2e, 0x3e, 0x36, 0x3e, 0x3e,
+  0x37, 0x37, 0x36, 0x3e, 0x27, 0x37, 0x37, 0x27, 0x34, 0x80, 0x3e, 0x03, 0x3c, 0x37, 0x36, 0x2e,
+  0x80, 0x3f, 0x0b, 0x37, 0x3f, 0x35, 0x37, 0x37, 0x36, 0x2e, 0x37, 0x34, 0x3e, 0x27, 0x27, 0x80,
+  0x37, 0x16, 0x3e, 0x3f, 0x26, 0x3e, 0x3c, 0x3e, 0x2e, 0x3f, 0x37, 0x34, 0x3e, 0x27, 0x35, 0x37,
+  0x37, 0x34, 0x3e, 0x27, 0x35, 0x36, 0x3e, 0x2e, 0x3e, 0x80, 0x37, 0x11, 0x3f, 0x3e, 0x2e, 0x3c,
+  0x3e, 0x3e, 0x2e, 0x3e, 0x35, 0x37, 0x27, 0x35, 0x37, 0x37, 0x26, 0x3c, 0x3e, 0x2e, 0x81, 0x37,
+  0x0d, 0x27, 0x34, 0x3e, 0x37, 0x35, 0x36, 0x2e, 0x35, 0x37, 0x36, 0x2e, 0x35, 0x36, 0x3e, 0x80,
+  0x37, 0x09, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x3f, 0x37, 0x3f, 0x37, 0x35, 0x81, 0x37, 0x03, 0x36,
+  0x3e, 0x2e, 0x2e, 0x80, 0x37, 0x01, 0x34, 0x3c, 0x80, 0x3e, 0x17, 0x27, 0x37, 0x35, 0x37, 0x37,
+  0x34, 0x3e, 0x2e, 0x3e, 0x3c, 0x3e, 0x2e, 0x3c, 0x37, 0x34, 0x3e, 0x3c, 0x37, 0x26, 0x3c, 0x3e,
+  0x2e, 0x37, 0x36, 0x80, 0x3e, 0x06, 0x37, 0x34, 0x3e, 0x2e, 0x27, 0x36, 0x3e, 0x80, 0x37, 0x11,
+  0x27, 0x34, 0x3e, 0x2e, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x37, 0x35, 0x36, 0x2e, 0x35, 0x36,
+  0x2e, 0x3c, 0x80, 0x3e, 0x09, 0x2e, 0x37, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x3c, 0x3e, 0x2e, 0x80,
+  0x3e, 0x01, 0x3c, 0x3c, 0x81, 0x37, 0x09, 0x36, 0x3e, 0x27, 0x27, 0x36, 0x3e, 0x2e, 0x3e, 0x3f,
+  0x36, 0x81, 0x3e, 0x05, 0x3c, 0x37, 0x27, 0x35, 0x37, 0x27, 0x80, 0x3e, 0x01, 0x27, 0x36, 0x80,
+  0x3e, 0x18, 0x37, 0x37, 0x27, 0x34, 0x3e, 0x3e, 0x35, 0x3e, 0x27, 0x35, 0x37, 0x26, 0x3c, 0x3e,
+  0x3e, 0x27, 0x36, 0x3e, 0x3e, 0x35, 0x37, 0x26, 0x3e, 0x3c, 0x3e, 0x80, 0x37, 0x17, 0x3f, 0x3f,
+  0x37, 0x36, 0x3e, 0x2e, 0x2e, 0x3e, 0x3c, 0x3e, 0x37, 0x37, 0x36, 0x2e, 0x35, 0x37, 0x3f, 0x3e,
+  0x3e, 0x2e, 0x37, 0x36, 0x3e, 0x34, 0x81, 0x3e, 0x01, 0x37, 0x34, 0x81, 0x3e, 0x20, 0x37, 0x37,
+  0x27, 0x37, 0x27, 0x37, 0x3f, 0x3f, 0x37, 0x36, 0x3e, 0x37, 0x34, 0x3e, 0x37, 0x35, 0x37, 0x36,
+  0x3e, 0x37, 0x34, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x2e, 0x3c, 0x35, 0x37, 0x36, 0x3e, 0x3c, 0x80,
+  0x3e, 0x02, 0x37, 0x37, 0x35, 0x80, 0x37, 0x14, 0x35, 0x37, 0x34, 0x3e, 0x27, 0x35, 0x37, 0x27,
+  0x35, 0x36, 0x3f, 0x3f, 0x37, 0x27, 0x36, 0x3e, 0x37, 0x27, 0x34, 0x3e, 0x2e, 0x80, 0x37, 0x0b,
+  0x26, 0x3c, 0x37, 0x36, 0x3c, 0x35, 0x37, 0x37, 0x35, 0x36, 0x3e, 0x3e, 0x80, 0x37, 0x07, 0x35,
+  0x36, 0x3e, 0x37, 0x36, 0x3c, 0x3e, 0x3e, 0x83, 0x37, 0x1a, 0x35, 0x37, 0x27, 0x34, 0x3e, 0x2e,
+  0x37, 0x37, 0x36, 0x3e, 0x3e, 0x2e, 0x3c, 0x3e, 0x2e, 0x3e, 0x37, 0x37, 0x36, 0x3e, 0x3c, 0x3e,
+  0x2e, 0x35, 0x36, 0x3e, 0x3e, 0x84, 0x37, 0x03, 0x3f, 0x37, 0x37, 0x27, 0x81, 0x37, 0x0d, 0x34,
+  0x3e, 0x37, 0x36, 0x3c, 0x37, 0x37, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x27, 0x35, 0x80, 0x37, 0x12,
+  0x35, 0x36, 0x3e, 0x37, 0x3f, 0x3e, 0x2e, 0x35, 0x37, 0x26, 0x3e, 0x3e, 0x37, 0x36, 0x3e, 0x3e,
+  0x37, 0x3f, 0x3f, 0x80, 0x37, 0x08, 0x27, 0x35, 0x37, 0x27, 0x36, 0x3e, 0x3e, 0x3c, 0x3e, 0x83,
+  0x37, 0x1a, 0x36, 0x3e, 0x3e, 0x35, 0x36, 0x2e, 0x3e, 0x3e, 0x37, 0x27, 0x36, 0x3e, 0x3c, 0x37,
+  0x3f, 0x37, 0x37, 0x3f, 0x37, 0x27, 0x36, 0x3e, 0x37, 0x36, 0x3e, 0x2e, 0x3c, 0x80, 0x3e, 0x26,
+  0x37, 0x3e, 0x3f, 0x3f, 0x36, 0x3c, 0x3e, 0x2e, 0x3e, 0x3c, 0x37, 0x34, 0x3e, 0x2e, 0x37, 0x34,
+  0x3e, 0x27, 0x35, 0x37, 0x26, 0x3e, 0x37, 0x36, 0x3c, 0x37, 0x37, 0x3f, 0x3d, 0x37, 0x27, 0x37,
+  0x36, 0x3c, 0x3e, 0x37, 0x35, 0x37, 0x27, 0x80, 0x37, 0x14, 0x27, 0x35, 0x37, 0x36, 0x3e, 0x3e,
+  0x37, 0x37, 0x27, 0x36, 0x3e, 0x27, 0x35, 0x37, 0x27, 0x36, 0x3c, 0x37, 0x26, 0x3e, 0x3e,
+};
+
+constexpr rawdisp::AssetDesc rgb111_480x320_rle_desc = {
+  .width = 480,
+  .height = 320,
+  .format = rawdisp::AssetFormat::RGB111,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "color",
+      .data = rgb111_480x320_rle,
+      .size = sizeof(rgb111_480x320_rle),
+      .compression = rawdisp::Compression::RLE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x21,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 3,
+        .pixelsPerFrag = 2,
+        .bytesPerFrag = 1,
+      },
+      .stride = 240,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
+
 // 240x240px, RGB444
 // B:G:R, MSB First, Horizontal Packing, Big Endian, Horizontal Adressing
 // 86400 Bytes
@@ -5407,3 +5409,30 @@ const uint8_t rgb444_be_240x240[] = {
   0xaf, 0xea, 0xfd, 0xaf, 0xda, 0xfd, 0xaf, 0xda, 0xfd, 0xaf, 0xda, 0xfd, 0xaf, 0xea, 0xfd, 0xaf,
   0xd9, 0xfe, 0xaf, 0xda, 0xfd, 0xaf, 0xea, 0xfd, 0xaf, 0xd9, 0xfe, 0xaf, 0xda, 0xfd, 0xaf, 0xda,
 };
+
+constexpr rawdisp::AssetDesc rgb444_be_240x240_desc = {
+  .width = 240,
+  .height = 240,
+  .format = rawdisp::AssetFormat::RGB444,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "color",
+      .data = rgb444_be_240x240,
+      .size = sizeof(rgb444_be_240x240),
+      .compression = rawdisp::Compression::NONE,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x23,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 12,
+        .pixelsPerFrag = 2,
+        .bytesPerFrag = 3,
+      },
+      .stride = 360,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
@@ -0,0 +1,3123 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "rawdisp/asset_desc.hpp"
+
+// 240x240px, RGB444
+// B:G:R, MSB First, Horizontal Packing, Big Endian, Horizontal Adressing
+// 86400 Bytes
+// LZ77 compressed (window 4096 Bytes), 49343 Bytes (x1.75)
+const uint8_t rgb444_be_240x240_lz77[] = {
+  0x02, 0x0c, 0x80, 0x51, 0x01, 0x00, 0x18, 0xae, 0xfa, 0xdf, 0x02, 0xf0, 0x02, 0xa0, 0xfb, 0xef,
+  0xdf, 0x04, 0xfd, 0xff, 0x02, 0x40, 0xfc, 0xff, 0xad, 0xfa, 0xef, 0xff, 0x02, 0xf0, 0x02, 0xf0,
+  0x02, 0x40, 0x35, 0x30, 0x53, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0x80, 0xfa, 0xcf, 0x47, 0x20,
+  0xcf, 0x17, 0xe0, 0x95, 0x30, 0x17, 0xd0, 0xb0, 0x30, 0xaa, 0xf0, 0xdb, 0x02, 0xe0, 0x56, 0x30,
+  0xbe, 0x1a, 0xf0, 0xf2, 0x90, 0xfb, 0x38, 0xf0, 0x02, 0xf0, 0x7f, 0x02, 0xf0, 0xfe, 0x80, 0x65,
+  0x30, 0x47, 0x00, 0x02, 0xf0, 0x02, 0x90, 0xe6, 0x50, 0xdf, 0xbe, 0xfe, 0x2f, 0x30, 0xc8, 0x00,
+  0x02, 0xf0, 0x02, 0xf0, 0x02, 0x20, 0xfc, 0xaa, 0x50, 0x2f, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xf0,
+  0x02, 0x50, 0xbe, 0x7d, 0x20, 0xcf, 0xfa, 0xec, 0xef, 0xbd, 0x02, 0xb0, 0x5c, 0x00, 0xef, 0x67,
+  0x01, 0x2f, 0xe0, 0x67, 0x21, 0xf0, 0xef, 0xbe, 0xfa, 0xdf, 0x02, 0xf0, 0x02, 0x90, 0xd1, 0xf0,
+  0x02, 0x40, 0xff, 0xef, 0x20, 0x59, 0x00, 0x74, 0x20, 0xbb, 0x11, 0x3b, 0xf0, 0x02, 0xf0, 0x02,
+  0xf0, 0xb6, 0x30, 0x8f, 0x69, 0x22, 0x92, 0x10, 0xd0, 0x61, 0x15, 0x92, 0xbe, 0xfa, 0xee, 0x11,
+  0x40, 0xdf, 0xb9, 0x00, 0x74, 0x30, 0xdf, 0x51, 0x20, 0x20, 0x00, 0xc2, 0xee, 0x14, 0xf0, 0x02,
+  0x00, 0x98, 0xbd, 0xfb, 0xee, 0x35, 0x30, 0x87, 0xc2, 0xbe, 0xea, 0x6e, 0x60, 0xb3, 0x0d, 0x11,
+  0x87, 0x62, 0xae, 0xea, 0xcc, 0xf2, 0x17, 0x00, 0xee, 0xb0, 0x10, 0x38, 0xfd, 0xff, 0xce, 0x44,
+  0xe0, 0x92, 0x40, 0x17, 0xa0, 0xef, 0xbe, 0xfe, 0xeb, 0x17, 0x20, 0xa7, 0xb0, 0x44, 0x00, 0xb4,
+  0xf2, 0xf6, 0xf2, 0x02, 0x30, 0x6e, 0x00, 0x7f, 0xef, 0x60, 0x1c, 0x01, 0xd0, 0x01, 0xe6, 0xf0,
+  0x2f, 0xa0, 0x2b, 0x21, 0x02, 0xf0, 0xbe, 0x7a, 0xed, 0x31, 0x51, 0xfb, 0xd3, 0x21, 0x6b, 0x20,
+  0x24, 0x62, 0x8b, 0x21, 0xef, 0xf8, 0xbe, 0xdb, 0xed, 0xdc, 0x41, 0x89, 0x53, 0xdf, 0x31, 0x05,
+  0x00, 0x11, 0x20, 0x83, 0x02, 0x60, 0xb0, 0x10, 0xae, 0xfb, 0xed, 0xbe, 0xda, 0x41, 0xd0, 0x39,
+  0x08, 0x10, 0xeb, 0xfd, 0x33, 0x42, 0xd7, 0x20, 0x2f, 0x60, 0xbf, 0xcb, 0xf2, 0xee, 0x7b, 0x42,
+  0xfc, 0xef, 0x7d, 0x10, 0x1a, 0x40, 0x44, 0x70, 0x41, 0x70, 0xe1, 0x08, 0x00, 0xeb, 0xfd, 0xbd,
+  0xec, 0x44, 0x30, 0x14, 0x80, 0x05, 0x00, 0x8e, 0xcb, 0xc4, 0x41, 0x2d, 0x02, 0x5c, 0x80, 0xed,
+  0xbe, 0xdb, 0x67, 0x71, 0x39, 0x5a, 0x72, 0xfb, 0xec, 0x97, 0x01, 0xb0, 0x80, 0x6b, 0x43, 0xef,
+  0xfc, 0x5e, 0xfd, 0x0e, 0x10, 0x26, 0x40, 0x5c, 0x40, 0xbf, 0x03, 0xef, 0x87, 0x32, 0xfc, 0x63,
+  0xac, 0x51, 0x5f, 0x40, 0xfc, 0xbe, 0xea, 0xb1, 0x92, 0x8c, 0x50, 0xdb, 0x87, 0x44, 0x10, 0xe0,
+  0x90, 0x08, 0x20, 0xee, 0xbf, 0xcb, 0xef, 0x6b, 0x43, 0xef, 0xcf, 0x02, 0x3a, 0x21, 0x0e, 0x10,
+  0x8b, 0xc1, 0xeb, 0xbb, 0x31, 0x6a, 0x41, 0x3a, 0x34, 0xfb, 0x29, 0x00, 0x02, 0x00, 0xce, 0xb2,
+  0xf4, 0x72, 0x02, 0x8a, 0xf2, 0x22, 0x11, 0x8a, 0x42, 0xfe, 0xcf, 0xaf, 0x31, 0x8a, 0x72, 0x5c,
+  0x50, 0xec, 0x20, 0xd2, 0x42, 0x44, 0x10, 0x15, 0xf2, 0xff, 0xc8, 0x00, 0xf1, 0x01, 0x77, 0xa3,
+  0xa1, 0x60, 0x9f, 0x45, 0x5c, 0x90, 0x72, 0x02, 0xcf, 0x22, 0xd3, 0x53, 0x10, 0x17, 0xc0, 0xfb,
+  0xdf, 0x59, 0xa0, 0xfc, 0xf8, 0x30, 0x8a, 0x22, 0xdf, 0xd1, 0x90, 0x54, 0x82, 0xc1, 0x31, 0x1d,
+  0x60, 0x9e, 0x03, 0xae, 0xa1, 0xf0, 0x89, 0x20, 0xfb, 0x14, 0xf0, 0xee, 0x14, 0xea, 0x13, 0x54,
+  0x4a, 0x56, 0x54, 0x02, 0x52, 0x61, 0xac, 0x31, 0xff, 0x7d, 0x40, 0x62, 0x30, 0xa0, 0x01, 0xd2,
+  0x85, 0x1a, 0x46, 0x30, 0xa2, 0x10, 0x31, 0xe4, 0x52, 0xff, 0x17, 0x50, 0x49, 0x31, 0xb3, 0x10,
+  0xcb, 0x50, 0xae, 0x32, 0x3e, 0x73, 0xc0, 0x35, 0x13, 0x81, 0x7f, 0x44, 0xf0, 0x1f, 0x31, 0xbc,
+  0x63, 0x08, 0x10, 0x24, 0x62, 0xf7, 0x31, 0x5c, 0xe0, 0xce, 0xff, 0xce, 0x00, 0xa4, 0x50, 0x17,
+  0x30, 0xca, 0x51, 0x7a, 0xd0, 0x7d, 0x06, 0x7a, 0xe0, 0x04, 0x77, 0xff, 0xa9, 0x91, 0x41, 0x20,
+  0x02, 0x76, 0x2c, 0x93, 0xf3, 0x32, 0x7d, 0x40, 0xd7, 0x76, 0x05, 0x00, 0xff, 0x1a, 0x10, 0x17,
+  0x30, 0xa8, 0x12, 0xab, 0x45, 0xbd, 0x72, 0x35, 0x30, 0xd7, 0x70, 0x74, 0x36, 0xff, 0x26, 0x20,
+  0xb8, 0x34, 0x4f, 0x54, 0x86, 0xc0, 0x70, 0x41, 0x00, 0x72, 0x03, 0x12, 0x2d, 0x85, 0xff, 0xd1,
+  0x90, 0x85, 0x41, 0x1d, 0xf0, 0x7a, 0x50, 0x63, 0xb2, 0xa3, 0xc1, 0x15, 0x98, 0x6f, 0x48, 0xff,
+  0x2e, 0xb1, 0x35, 0x60, 0x17, 0x30, 0x35, 0x90, 0x53, 0x60, 0x38, 0x20, 0x33, 0x72, 0x3b, 0x40,
+  0xff, 0x92, 0x00, 0xe9, 0x30, 0x95, 0x60, 0xb6, 0xf0, 0xfb, 0xe0, 0x1a, 0x60, 0x76, 0x34, 0x02,
+  0x59, 0xff, 0x59, 0x70, 0x3e, 0x33, 0x11, 0x46, 0x03, 0x72, 0x07, 0x17, 0x3e, 0x60, 0x05, 0x40,
+  0x85, 0x67, 0x7f, 0x42, 0x82, 0xf6, 0x52, 0x07, 0x14, 0x33, 0x52, 0x05, 0x70, 0x44, 0x00, 0x6b,
+  0x00, 0xce, 0xff, 0x5c, 0xd0, 0x50, 0x03, 0xfc, 0x62, 0xd4, 0x20, 0x1d, 0x50, 0x17, 0x00, 0x0d,
+  0xa1, 0x5e, 0x31, 0xff, 0x5c, 0x10, 0x5b, 0x87, 0x19, 0x61, 0xef, 0x36, 0xc7, 0x34, 0xd9, 0x81,
+  0xc1, 0x44, 0xa6, 0xb1, 0xe7, 0x07, 0x37, 0xa3, 0x84, 0x61, 0x41, 0xbd, 0xeb, 0x88, 0x41, 0xbf,
+  0x70, 0xe6, 0x50, 0xff, 0xe3, 0xa0, 0xab, 0x42, 0x13, 0x11, 0xb6, 0x86, 0xd6, 0x61, 0x37, 0x44,
+  0x23, 0x00, 0x3e, 0x30, 0x8a, 0xbf, 0x7c, 0x31, 0xeb, 0x95, 0x80, 0xeb, 0xfc, 0xcf, 0x16, 0x07,
+  0xc7, 0xc1, 0x21, 0x9e, 0x60, 0x05, 0x00, 0xbe, 0xdb, 0xec, 0x89, 0x40, 0xad, 0x83, 0xe7, 0xcc,
+  0x15, 0xa8, 0x58, 0x71, 0xa0, 0xfc, 0xfc, 0xc2, 0x06, 0x04, 0xa1, 0x4a, 0x20, 0x1f, 0x44, 0x00,
+  0xf5, 0x10, 0xa1, 0x03, 0xb1, 0x72, 0xad, 0x10, 0xbf, 0xcb, 0xed, 0x9f, 0x53, 0x70, 0xd6, 0x47,
+  0xaa, 0x26, 0x44, 0x50, 0xaf, 0x91, 0xbe, 0xdb, 0x7d, 0x76, 0xdb, 0xf0, 0x72, 0xf2, 0x00, 0xcb,
+  0x64, 0x87, 0xbd, 0x72, 0xed, 0x7d, 0x06, 0xa6, 0x71, 0xf3, 0x28, 0x51, 0xe6, 0x00, 0xbe, 0xdc,
+  0x3f, 0xb8, 0x1a, 0x20, 0x89, 0x00, 0xa9, 0xd4, 0xff, 0xee, 0x37, 0x48, 0x35, 0xec, 0x56, 0x32,
+  0x30, 0x44, 0x10, 0xa9, 0x27, 0x09, 0xc2, 0xa1, 0x10, 0x1f, 0x70, 0x41, 0xce, 0x70, 0x07, 0x27,
+  0x7f, 0x11, 0x3b, 0x40, 0xdc, 0xfb, 0xce, 0x06, 0xcb, 0x80, 0x53, 0xda, 0x50, 0xad, 0xfa, 0xee,
+  0xcf, 0xbc, 0x83, 0x53, 0x70, 0x13, 0x64, 0xbe, 0xfe, 0xff, 0xff, 0xee, 0x94, 0x21, 0x47, 0x88,
+  0x47, 0x15, 0x42, 0x68, 0x00, 0xcf, 0xbb, 0xee, 0x80, 0xe0, 0xee, 0x38, 0xbf, 0xcc, 0xfb, 0xfd,
+  0x07, 0x03, 0x45, 0x36, 0x62, 0xfb, 0xed, 0x1c, 0xcf, 0xbb, 0x98, 0x10, 0x3e, 0x30, 0x2b, 0x61,
+  0xae, 0xec, 0xfb, 0xfc, 0xcf, 0xcb, 0xe4, 0x28, 0x64, 0x71, 0x0a, 0x21, 0x44, 0x40, 0x89, 0x40,
+  0x16, 0x51, 0x30, 0xed, 0xcf, 0xcc, 0xfc, 0x5c, 0x33, 0xf2, 0x96, 0xbe, 0xec, 0x07, 0x89, 0x00,
+  0xc4, 0x11, 0x6e, 0xb3, 0xef, 0xbe, 0xcc, 0xfb, 0xcf, 0x6e, 0xde, 0x2c, 0x80, 0x5f, 0x40, 0x44,
+  0x00, 0xfb, 0xc1, 0x87, 0x5c, 0x5c, 0xff, 0x30, 0xfe, 0xdf, 0xdb, 0xfd, 0x5e, 0x61, 0x7a, 0x70,
+  0xdc, 0xfb, 0xff, 0x3a, 0x01, 0x0e, 0x93, 0x61, 0x37, 0x44, 0x10, 0x21, 0x22, 0xf2, 0x43, 0x86,
+  0x43, 0x89, 0x00, 0x02, 0xec, 0x10, 0x64, 0xcf, 0xcb, 0xfb, 0xcf, 0xba, 0xee, 0x87, 0x3d, 0x04,
+  0xe8, 0x24, 0x15, 0x52, 0xfc, 0xed, 0xbf, 0xbc, 0xdd, 0x40, 0x3f, 0x12, 0x95, 0xc5, 0x00, 0xd0,
+  0x02, 0x23, 0x76, 0xda, 0x59, 0xc5, 0x10, 0xbb, 0xed, 0xe7, 0x2c, 0xa6, 0xd0, 0x17, 0x4f, 0x11,
+  0xbf, 0xca, 0xf2, 0xb0, 0x41, 0x33, 0xc4, 0x01, 0x85, 0x22, 0x24, 0xbd, 0xeb, 0x6d, 0xfb, 0xdf,
+  0xbf, 0xcc, 0x22, 0x11, 0x1f, 0x79, 0xc4, 0x0a, 0x31, 0xdd, 0x30, 0xd7, 0x73, 0x1d, 0x03, 0xfc,
+  0xfc, 0xbf, 0xee, 0xbc, 0x67, 0x41, 0x17, 0x46, 0x4f, 0x31, 0xdb, 0xac, 0x01, 0xc4, 0x51, 0x4f,
+  0x71, 0xfd, 0x0a, 0x11, 0xef, 0xcd, 0x2a, 0xb4, 0x78, 0x2f, 0x10, 0x71, 0x00, 0x22, 0x11, 0x5c,
+  0x9c, 0xff, 0x02, 0x29, 0x22, 0x21, 0x5a, 0x28, 0x6d, 0x71, 0x44, 0x10, 0x4e, 0x12, 0xbe, 0x91,
+  0x4f, 0x21, 0xf9, 0xe6, 0x00, 0xfb, 0xce, 0x93, 0x02, 0xa8, 0x58, 0x46, 0x01, 0x4a, 0x10, 0x36,
+  0x12, 0xc3, 0xc4, 0x01, 0xa6, 0x51, 0xcc, 0xfc, 0xbf, 0xdb, 0xdb, 0x58, 0xe0, 0x60, 0xdb, 0x3b,
+  0x00, 0xad, 0x00, 0xda, 0xe3, 0xc6, 0x70, 0x04, 0xfc, 0x15, 0x12, 0x81, 0x42, 0x71, 0x06, 0x62,
+  0xde, 0xcf, 0xdb, 0x44, 0x40, 0xb7, 0x92, 0x38, 0x13, 0xcc, 0x98, 0xfc, 0xbe, 0xdb, 0xe9, 0x63,
+  0x0d, 0x54, 0xec, 0xec, 0xad, 0x03, 0xc6, 0xbd, 0x80, 0x60, 0x03, 0x5b, 0xbe, 0xdc, 0xfc, 0x57,
+  0x4b, 0x14, 0x93, 0x4f, 0x44, 0x30, 0x89, 0x30, 0xda, 0x33, 0xed, 0x25, 0xbe, 0xeb, 0x7f, 0x01,
+  0xfd, 0xf9, 0x67, 0x11, 0xfc, 0xff, 0x75, 0xa2, 0x59, 0x03, 0x94, 0x24, 0x80, 0x56, 0x76, 0x5a,
+  0xbc, 0xcb, 0xfc, 0xf1, 0x34, 0x97, 0x44, 0x4a, 0x30, 0xe6, 0x30, 0xeb, 0x73, 0xba, 0xff, 0xe6,
+  0x20, 0xa1, 0x00, 0xf8, 0x96, 0xb1, 0x5b, 0x89, 0x00, 0x1f, 0x1a, 0x73, 0xb7, 0x44, 0x20, 0x07,
+  0x14, 0x03, 0xe6, 0x56, 0xad, 0x39, 0xbe, 0xeb, 0xec, 0xcf, 0xcb, 0xfe, 0xfd, 0xa9, 0x61, 0xcf,
+  0x78, 0x8a, 0x92, 0x7e, 0x45, 0x5f, 0xa6, 0xf8, 0x40, 0x85, 0x5d, 0xff, 0x05, 0x9f, 0xd9, 0x97,
+  0xbf, 0x20, 0xc8, 0x50, 0x3d, 0x8d, 0x26, 0x60, 0x01, 0x21, 0x77, 0x50, 0xff, 0x9f, 0x32, 0xa9,
+  0x3a, 0x99, 0xa5, 0x7a, 0xa0, 0x7a, 0x96, 0x97, 0x31, 0xc0, 0x32, 0x64, 0x6a, 0xf7, 0x8c, 0x9f,
+  0x5e, 0xb4, 0x4d, 0x40, 0xbe, 0xd8, 0x38, 0x04, 0x21, 0x98, 0x90, 0xd7, 0x70, 0xff, 0x47, 0x50,
+  0xc3, 0x72, 0x7d, 0x33, 0x52, 0x87, 0x1f, 0x7a, 0x2c, 0xb6, 0x62, 0x30, 0x5f, 0x10, 0xcf, 0xc8,
+  0x10, 0x04, 0xba, 0xbe, 0xc7, 0x57, 0x3b, 0xdb, 0xfd, 0x06, 0x1e, 0x79, 0xa1, 0xaf, 0x3e, 0x2c,
+  0x17, 0x10, 0xc7, 0x21, 0xed, 0x85, 0xcf, 0x79, 0x1d, 0xfd, 0xdc, 0x74, 0xbf, 0x4a, 0x59, 0x14,
+  0x00, 0x39, 0x02, 0xac, 0x07, 0xc2, 0xa0, 0x96, 0x02, 0xdb, 0xee, 0x0d, 0x07, 0x44, 0x40, 0x55,
+  0x3a, 0xc5, 0x10, 0xfb, 0xed, 0xce, 0xdc, 0xfe, 0x7d, 0x96, 0x12, 0xfb, 0x5f, 0xa6, 0xae, 0x02,
+  0x2f, 0x10, 0x9d, 0x91, 0x40, 0x37, 0xdb, 0xfc, 0xed, 0xcf, 0x20, 0x06, 0xb5, 0x44, 0xda, 0x20,
+  0x44, 0x20, 0x89, 0x10, 0x21, 0x25, 0xff, 0xd1, 0x90, 0x44, 0x40, 0xa1, 0x20, 0x18, 0x35, 0x94,
+  0x11, 0xce, 0x50, 0x10, 0x84, 0x66, 0x45, 0x7f, 0x44, 0x30, 0x35, 0xa9, 0x8d, 0x2e, 0x13, 0x01,
+  0x44, 0x10, 0xc3, 0x82, 0xdb, 0x12, 0xdc, 0xf7, 0x5c, 0x10, 0xfd, 0x7a, 0x01, 0x67, 0xdc, 0x2f,
+  0x00, 0x48, 0x12, 0x8b, 0x9a, 0x89, 0x00, 0xe3, 0x0e, 0x8c, 0x09, 0x15, 0xcf, 0xbc, 0xfd, 0x22,
+  0xaa, 0x83, 0x00, 0x59, 0x06, 0xf0, 0xbc, 0xfb, 0xcf, 0xca, 0xf2, 0x7c, 0x40, 0x67, 0x17, 0x00,
+  0x29, 0x6f, 0x33, 0x34, 0x54, 0x09, 0x25, 0xee, 0xfe, 0x60, 0x28, 0xf2, 0x80, 0xfb, 0xec, 0xff,
+  0x93, 0x05, 0xdc, 0x04, 0x36, 0x95, 0x59, 0x36, 0x2f, 0x10, 0x72, 0x35, 0x4e, 0xb5, 0x2f, 0x00,
+  0xc6, 0xae, 0xc4, 0x81, 0xe6, 0x43, 0xbc, 0xfb, 0xdf, 0xb8, 0x24, 0xcf, 0x62, 0xfe, 0xce, 0xfb,
+  0x36, 0xa1, 0x10, 0x94, 0x71, 0x08, 0x30, 0x35, 0x16, 0x08, 0x56, 0x45, 0x38, 0xf5, 0x2e, 0x2d,
+  0xfd, 0x5c, 0x10, 0xbb, 0xe6, 0x40, 0x55, 0x61, 0x44, 0x40, 0x21, 0x88, 0xff, 0xf0, 0x45, 0xe6,
+  0x10, 0x12, 0x58, 0xf1, 0x81, 0xce, 0x20, 0x08, 0x26, 0xb3, 0x30, 0xe3, 0x33, 0xfe, 0xfc, 0xf0,
+  0x15, 0xc3, 0x25, 0x6c, 0xab, 0x12, 0x05, 0xda, 0x73, 0xdd, 0x30, 0xdc, 0x04, 0xe7, 0xd1, 0x9c,
+  0x6e, 0x29, 0xff, 0x05, 0xce, 0xca, 0x8c, 0x33, 0x83, 0x70, 0xe7, 0x15, 0xed, 0x39, 0x05, 0xea,
+  0x78, 0x58, 0xee, 0x41, 0xde, 0x1e, 0x08, 0x0a, 0x01, 0x3a, 0x01, 0xff, 0x71, 0x36, 0x83, 0x53,
+  0xdd, 0x20, 0xce, 0x06, 0xde, 0x7b, 0x58, 0x47, 0xb0, 0x10, 0xa2, 0x02, 0xf7, 0x42, 0x0b, 0xc7,
+  0x81, 0x22, 0x11, 0xcb, 0xac, 0x07, 0xd1, 0xa3, 0x63, 0x38, 0x67, 0x11, 0x7f, 0x5c, 0x00, 0x79,
+  0x41, 0xcd, 0x11, 0x35, 0x16, 0xc3, 0x35, 0x06, 0x58, 0xa1, 0x30, 0xbf, 0xbf, 0x22, 0x01, 0x39,
+  0x35, 0x07, 0x51, 0x2f, 0x00, 0xe6, 0x70, 0x5a, 0xbe, 0xae, 0x44, 0x10, 0xfc, 0xfb, 0xbf, 0x92,
+  0x56, 0x48, 0x65, 0x22, 0x01, 0xac, 0x31, 0x7b, 0x82, 0x7a, 0x36, 0x8f, 0x44, 0x40, 0x47, 0x40,
+  0x2a, 0x42, 0x09, 0x02, 0xfc, 0xcf, 0xca, 0xaf, 0x5d, 0xef, 0xc1, 0x44, 0x2b, 0x11, 0xa8, 0x95,
+  0x4f, 0x17, 0xca, 0x72, 0x22, 0xdc, 0xad, 0xbb, 0x01, 0xdf, 0x80, 0x80, 0x16, 0x67, 0x36, 0x28,
+  0x66, 0xbe, 0x00, 0x52, 0xcd, 0x60, 0x4e, 0xcd, 0x74, 0xdf, 0x00, 0x22, 0xda, 0x43, 0x32, 0x80,
+  0x2c, 0x03, 0xe6, 0x16, 0xec, 0x28, 0x2a, 0x3e, 0x23, 0x9f, 0xc4, 0x41, 0xdd, 0x00, 0xfc, 0x22,
+  0x82, 0xbd, 0x22, 0x11, 0xdf, 0xdd, 0x36, 0xa8, 0xf9, 0xb1, 0x08, 0xae, 0xfc, 0x2c, 0x13, 0xd9,
+  0x47, 0x5c, 0x80, 0x44, 0x20, 0xb0, 0x53, 0xff, 0x99, 0x58, 0x9d, 0x37, 0xfc, 0x32, 0xb9, 0x93,
+  0x1d, 0x19, 0xa1, 0x10, 0x16, 0x44, 0x9f, 0x75, 0xff, 0x28, 0x1a, 0xce, 0x06, 0xf4, 0xad, 0x2f,
+  0x00, 0x44, 0x10, 0x36, 0x72, 0x7e, 0x32, 0x71, 0x23, 0xff, 0xe3, 0x59, 0x16, 0x9a, 0x44, 0x00,
+  0x5f, 0x9f, 0x22, 0x11, 0x80, 0x20, 0xf0, 0x75, 0x0a, 0x44, 0xbf, 0x86, 0x69, 0x3a, 0x87, 0x23,
+  0x03, 0x94, 0x27, 0x40, 0xd7, 0xdd, 0x00, 0xcc, 0x74, 0x46, 0xdf, 0xcf, 0x82, 0x36, 0x48, 0xc5,
+  0x30, 0x1a, 0x89, 0x98, 0x00, 0xec, 0x02, 0x1f, 0xfb, 0xc9, 0xfd, 0xdd, 0x00, 0xcb, 0x90, 0x4b,
+  0x07, 0x77, 0xdd, 0x30, 0x9e, 0x59, 0xaf, 0x84, 0xf1, 0x57, 0xff, 0x0b, 0x8f, 0xd8, 0x28, 0x44,
+  0x10, 0x0d, 0x9a, 0x2c, 0x53, 0x9e, 0x03, 0x18, 0x75, 0xc4, 0x57, 0xff, 0xe6, 0x40, 0x7b, 0x88,
+  0x30, 0x3e, 0xe6, 0x10, 0xf5, 0x96, 0x1f, 0x41, 0x2b, 0x11, 0x13, 0xd7, 0xcf, 0x77, 0x1c, 0x44,
+  0x10, 0x91, 0xa1, 0xc4, 0x11, 0xfb, 0xfc, 0xf5, 0x96, 0x46, 0x14, 0xff, 0x4c, 0x0d, 0x79, 0x81,
+  0x22, 0x31, 0x7d, 0x73, 0x20, 0x96, 0x4f, 0x04, 0x80, 0x20, 0xe8, 0x71, 0xff, 0x53, 0x20, 0x22,
+  0x01, 0x9e, 0x09, 0x63, 0x4b, 0x6e, 0x80, 0x11, 0x2c, 0x7b, 0xd8, 0xa8, 0x0b, 0x37, 0x2a, 0x15,
+  0x61, 0x77, 0x6e, 0x7c, 0xbf, 0x59, 0x23, 0xf8, 0x9f, 0xae, 0xfa, 0xfc, 0xee, 0xce, 0x67, 0x01,
+  0xcf, 0x42, 0x95, 0x86, 0x4f, 0x24, 0x45, 0x9b, 0xb3, 0x7c, 0x77, 0x56, 0x26, 0x39, 0x72, 0x5f,
+  0x20, 0xcf, 0x6e, 0x0c, 0xd6, 0x6d, 0xf1, 0x71, 0xee, 0xff, 0x90, 0x0b, 0xd9, 0x1a, 0x02, 0x90,
+  0x44, 0x00, 0x72, 0x15, 0x89, 0x50, 0x95, 0x69, 0x4e, 0x32, 0x8e, 0xdc, 0xc6, 0x2e, 0x1c, 0x77,
+  0xb6, 0x23, 0xcc, 0xfb, 0xae, 0x78, 0xcb, 0xeb, 0xa9, 0x27, 0x3a, 0x9d, 0xbf, 0x3b, 0x00, 0xca,
+  0x59, 0x59, 0x6f, 0x88, 0x95, 0x23, 0xe3, 0x07, 0xb1, 0xcf, 0x12, 0xfd, 0xcf, 0xbc, 0xcf, 0x02,
+  0xaa, 0x70, 0xd0, 0x54, 0x7b, 0x14, 0x13, 0xa7, 0x33, 0xbf, 0x30, 0x72, 0xe8, 0x21, 0xef, 0x2f,
+  0x50, 0x96, 0xbd, 0xff, 0xb7, 0x05, 0x87, 0x15, 0xfd, 0x7d, 0x72, 0x42, 0xe4, 0x1b, 0xcf, 0x72,
+  0x17, 0x60, 0x44, 0x10, 0xff, 0x67, 0x21, 0xf2, 0x79, 0xc1, 0x47, 0x60, 0x6e, 0x87, 0x28, 0x79,
+  0x04, 0x08, 0x00, 0xf2, 0x13, 0xff, 0xcf, 0x32, 0x52, 0xa1, 0x32, 0x2c, 0x6c, 0x95, 0x10, 0x6d,
+  0xcf, 0xc2, 0x4e, 0x32, 0xcf, 0x12, 0xf3, 0x72, 0x6b, 0x12, 0x62, 0xcf, 0xde, 0x56, 0x19, 0x5c,
+  0x30, 0xb2, 0x81, 0xcf, 0xc2, 0x19, 0x6d, 0x51, 0xfc, 0xfc, 0x3e, 0x70, 0x72, 0x22, 0xcf, 0xcb,
+  0xde, 0xff, 0x61, 0x81, 0x98, 0x30, 0x80, 0x20, 0x73, 0x54, 0xfd, 0x74, 0xc5, 0x10, 0x76, 0x14,
+  0xb8, 0x61, 0x7f, 0xe5, 0x47, 0xac, 0x01, 0x20, 0x06, 0xaf, 0x3a, 0x5a, 0x95, 0xac, 0x01, 0x7f,
+  0x01, 0xfe, 0xfa, 0xef, 0x9e, 0x00, 0xee, 0x60, 0x6b, 0x44, 0x00, 0x94, 0x54, 0x04, 0x41, 0x6d,
+  0x24, 0xef, 0x44, 0x30, 0x3b, 0xac, 0x9f, 0x45, 0x94, 0x24, 0xfc, 0x8d, 0x5e, 0x45, 0x42, 0xa9,
+  0x17, 0x7f, 0xdd, 0x30, 0x8a, 0x45, 0xed, 0x05, 0x5c, 0x30, 0x6e, 0x5c, 0x77, 0x73, 0x44, 0x20,
+  0xce, 0xf7, 0x2c, 0x03, 0x91, 0x97, 0x60, 0x1e, 0xfe, 0x83, 0x3f, 0xe3, 0x70, 0x9f, 0x85, 0x19,
+  0x1a, 0x81, 0xfc, 0xa2, 0xef, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x86, 0x00, 0xff, 0xfb, 0xc3, 0x9f,
+  0x55, 0xe0, 0x50, 0x59, 0x63, 0x40, 0x9a, 0xc5, 0x10, 0x07, 0x6d, 0xc2, 0x73, 0x7f, 0xb7, 0x02,
+  0xe7, 0x12, 0x18, 0x92, 0x64, 0x34, 0xe5, 0x47, 0xf0, 0xab, 0xcd, 0x27, 0xcc, 0x27, 0x44, 0x10,
+  0x50, 0x1f, 0xb0, 0x50, 0xae, 0xec, 0xac, 0x11, 0xcf, 0xcd, 0x00, 0xef, 0xef, 0xfc, 0xdd, 0xa8,
+  0x89, 0x87, 0xcc, 0xfe, 0xce, 0x90, 0x42, 0x6f, 0x38, 0xee, 0x9d, 0x35, 0x00, 0x7d, 0x33, 0x6f,
+  0x38, 0x29, 0x56, 0xff, 0xf1, 0x51, 0x89, 0x00, 0x72, 0x05, 0xff, 0x8b, 0x44, 0x40, 0x7d, 0x56,
+  0x60, 0x4e, 0xac, 0x01, 0x7f, 0xf3, 0x05, 0x71, 0x00, 0x89, 0x23, 0x72, 0xa5, 0x6f, 0x58, 0x2d,
+  0x75, 0x02, 0x20, 0xdf, 0xf8, 0xff, 0xff, 0xdf, 0x1f, 0x27, 0x48, 0xbe, 0x9e, 0x23, 0x89, 0x13,
+  0x98, 0x43, 0xf3, 0x93, 0x6e, 0x65, 0x11, 0xfd, 0xfe, 0x9f, 0xb5, 0x64, 0x24, 0x43, 0x11, 0x14,
+  0x73, 0xff, 0x6c, 0x5b, 0xcf, 0x82, 0xad, 0x20, 0x5d, 0x32, 0xba, 0x92, 0x4f, 0x21, 0x3a, 0x41,
+  0x18, 0x72, 0xff, 0x94, 0x31, 0xf5, 0x10, 0x6c, 0xa8, 0x4c, 0x14, 0xdd, 0x30, 0xf0, 0x0b, 0xd2,
+  0x02, 0x2a, 0x95, 0x00, 0xbc, 0xfc, 0xef, 0xee, 0xed, 0xa8, 0x7f, 0xdd, 0xe0, 0xfd, 0xcf, 0xdc,
+  0xb9, 0x9d, 0x07, 0x11, 0xf2, 0x20, 0x98, 0x30, 0xf7, 0x5d, 0x52, 0x01, 0x5d, 0x44, 0x40, 0xdb,
+  0x2d, 0xa2, 0x4f, 0x31, 0x2c, 0x16, 0xf2, 0x93, 0xff, 0x5f, 0x0c, 0x0a, 0x21, 0x2c, 0x66, 0x82,
+  0x47, 0x44, 0x30, 0xf8, 0x1f, 0x9f, 0x82, 0x8e, 0x1a, 0xff, 0x71, 0x20, 0xcf, 0x05, 0xff, 0x12,
+  0xac, 0x51, 0x37, 0x21, 0x66, 0x62, 0x2c, 0x73, 0x89, 0x50, 0x07, 0xd6, 0x0a, 0xcf, 0x92, 0x94,
+  0x01, 0xff, 0xef, 0xff, 0xef, 0xec, 0x7f, 0x22, 0x64, 0xac, 0x47, 0x78, 0x15, 0x13, 0x11, 0xb6,
+  0xc6, 0xe6, 0x10, 0xd7, 0x63, 0xce, 0xff, 0x23, 0x30, 0xf5, 0x20, 0xf3, 0x78, 0xb3, 0x00, 0x17,
+  0x50, 0xe6, 0x2c, 0x08, 0x73, 0x94, 0x31, 0xff, 0xb0, 0x33, 0xfc, 0x52, 0x44, 0x00, 0x77, 0x1c,
+  0x44, 0x30, 0x3d, 0x2a, 0x1f, 0x21, 0x01, 0x3d, 0x00, 0xce, 0xfe, 0xde, 0xdc, 0x98, 0xfd, 0xdf,
+  0xed, 0xf8, 0xfd, 0xdc, 0xba, 0xdb, 0x04, 0x29, 0x43, 0x2c, 0x10, 0xdc, 0x51, 0xaf, 0x11, 0xf8,
+  0xdf, 0xcf, 0xfe, 0x7b, 0x0b, 0x41, 0x23, 0x3a, 0x81, 0xbc, 0x7c, 0x3a, 0x41, 0xef, 0x7c, 0x3a,
+  0x82, 0x21, 0x44, 0x10, 0x21, 0x52, 0xeb, 0x4e, 0x1b, 0x67, 0x21, 0x6b, 0x26, 0xfd, 0x5c, 0x30,
+  0xcb, 0xb4, 0x6e, 0x3f, 0x45, 0x5c, 0x10, 0x02, 0x00, 0x44, 0x30, 0x30, 0x35, 0xbe, 0xfe, 0x66,
+  0x01, 0x37, 0x14, 0x97, 0x41, 0x26, 0x76, 0x13, 0x61, 0xfd, 0xd2, 0x22, 0xfd, 0x02, 0x20, 0xfd,
+  0x63, 0x01, 0x97, 0x11, 0xff, 0x12, 0x21, 0x02, 0x0a, 0x67, 0xe6, 0x30, 0xf7, 0x21, 0x52, 0x00,
+  0x68, 0x1b, 0x45, 0xeb, 0xe7, 0x0b, 0x12, 0x02, 0xe5, 0x31, 0xe8, 0x14, 0x91, 0x02, 0x00, 0xbf,
+  0xdb, 0xee, 0x17, 0x30, 0xcf, 0xcf, 0x51, 0x10, 0xaf, 0x6a, 0x11, 0xe0, 0x30, 0x29, 0x00, 0x3f,
+  0x02, 0xeb, 0xda, 0x30, 0xfc, 0x9a, 0x11, 0xfd, 0x0d, 0x31, 0xeb, 0x90, 0x02, 0x44, 0x00, 0x17,
+  0x30, 0x1d, 0x40, 0x83, 0x10, 0x9b, 0x00, 0x03, 0x44, 0x00, 0x26, 0x20, 0xdf, 0xde, 0xfe, 0xb9,
+  0x8f, 0xed, 0x00, 0xfd, 0xdf, 0xdc, 0xfd, 0xcb, 0xaa, 0xef, 0xfa, 0xb7, 0x44, 0x00, 0x6f, 0x42,
+  0x44, 0x40, 0xcc, 0xdb, 0x0e, 0x5c, 0x10, 0xcf, 0xc3, 0x00, 0xfe, 0xfe, 0x41, 0x50, 0x44, 0x20,
+  0x82, 0x01, 0x5f, 0x00, 0x26, 0x50, 0xa1, 0x20, 0xc8, 0x10, 0xfd, 0x2c, 0x00, 0xde, 0x44, 0x60,
+  0x2c, 0x50, 0x89, 0x10, 0xff, 0x05, 0xa9, 0x11, 0xa1, 0xa0, 0x5f, 0xce, 0x40, 0x6b, 0x60, 0x1d,
+  0x40, 0x44, 0x00, 0x5c, 0x00, 0xec, 0x65, 0x01, 0xff, 0xf0, 0xff, 0xfd, 0xfd, 0xce, 0xb9, 0x40,
+  0x38, 0x1f, 0x8c, 0x10, 0xc1, 0x41, 0xdf, 0x13, 0x31, 0x6a, 0x24, 0x89, 0x20, 0x12, 0x11, 0xa4,
+  0x00, 0xfc, 0x2f, 0x00, 0x44, 0x40, 0xff, 0xe3, 0x00, 0x17, 0x10, 0x0e, 0x30, 0x8c, 0x50, 0x2b,
+  0xb1, 0x44, 0x00, 0x5b, 0x41, 0xdf, 0x01, 0xa7, 0x7f, 0x24, 0x3b, 0x29, 0x2f, 0x60, 0xce, 0xfe,
+  0x14, 0x1f, 0xfc, 0xa1, 0x1f, 0x67, 0x47, 0xa0, 0xd1, 0x10, 0xc0, 0x12, 0xbe, 0xec, 0x3e, 0x30,
+  0x44, 0x40, 0xce, 0x1d, 0xaf, 0x1a, 0xde, 0x10, 0x04, 0xd1, 0x50, 0x02, 0x40, 0xce, 0xea, 0xee,
+  0x0c, 0xee, 0xfc, 0xc6, 0x00, 0x67, 0x01, 0xed, 0xdb, 0xae, 0xfe, 0xff, 0xb8, 0x41, 0x44, 0x40,
+  0xe9, 0x00, 0x83, 0x50, 0x8e, 0x01, 0x93, 0x03, 0x4e, 0x08, 0x55, 0x24, 0xfb, 0xfd, 0x51, 0xb9,
+  0x50, 0xdb, 0x68, 0x13, 0xd1, 0x10, 0x17, 0xc0, 0x01, 0x37, 0x02, 0x46, 0xfd, 0x02, 0x14, 0xff,
+  0xdb, 0x1b, 0xe5, 0x21, 0x44, 0xf0, 0x44, 0x20, 0xe6, 0x60, 0xe3, 0x30, 0xff, 0x4b, 0x12, 0xe2,
+  0x24, 0xe6, 0xe0, 0x88, 0x11, 0x89, 0x10, 0x73, 0x41, 0x02, 0x10, 0x64, 0x11, 0xbf, 0xc0, 0x2b,
+  0x04, 0xa4, 0x5b, 0x41, 0xe9, 0x29, 0xb2, 0x54, 0x2b, 0x71, 0xea, 0x2c, 0x26, 0xef, 0x0b, 0x20,
+  0xdd, 0x36, 0xd3, 0x4a, 0x1f, 0x61, 0xcb, 0x86, 0x23, 0xdc, 0x3d, 0x0d, 0x11, 0x4d, 0xb9, 0x33,
+  0xec, 0x89, 0x43, 0x81, 0x0b, 0xfa, 0xef, 0x52, 0x41, 0xcd, 0x6f, 0x27, 0x12, 0x41, 0x30, 0x3f,
+  0x25, 0x44, 0x60, 0xfb, 0x7c, 0x01, 0xa0, 0x17, 0xfb, 0x90, 0x98, 0xfe, 0xdf, 0xdd, 0x62, 0x01,
+  0xa9, 0x9e, 0x09, 0x15, 0xff, 0x74, 0x03, 0xe6, 0x39, 0x2b, 0x04, 0xde, 0x4e, 0xf5, 0x40, 0xb3,
+  0x1f, 0x45, 0x7e, 0xd8, 0x82, 0x2f, 0xb5, 0x84, 0xa1, 0x70, 0xfe, 0x66, 0x44, 0x40, 0xce, 0x67,
+  0x11, 0xef, 0xec, 0xff, 0xda, 0x00, 0xce, 0x63, 0xf4, 0x81, 0x44, 0x50, 0x97, 0x2a, 0x44, 0x40,
+  0xd9, 0x01, 0xa1, 0x49, 0xb7, 0xc0, 0xb5, 0xe6, 0x40, 0x38, 0x46, 0xde, 0xdc, 0x41, 0x94, 0x01,
+  0xfe, 0xf2, 0x3c, 0x7b, 0x2d, 0x38, 0x2b, 0xd1, 0xcf, 0x3d, 0x37, 0x39, 0x82, 0x4b, 0x22, 0x6b,
+  0x2f, 0xcd, 0xef, 0x4f, 0x24, 0xb6, 0x1c, 0x05, 0x20, 0x3a, 0x31, 0xbd, 0x2a, 0x52, 0x8e, 0x04,
+  0x74, 0x3c, 0xf3, 0xf5, 0x00, 0x4c, 0x11, 0xfb, 0xdf, 0x37, 0x01, 0x22, 0x01, 0x6b, 0x50, 0x64,
+  0x17, 0xe2, 0xcd, 0x7f, 0x11, 0xce, 0xda, 0xde, 0xa1, 0x36, 0x3d, 0x31, 0x44, 0x00, 0x06, 0xde,
+  0x4f, 0x11, 0x1e, 0x25, 0xfb, 0xef, 0xdd, 0xed, 0xba, 0x00, 0xfe, 0xdf, 0xed, 0xfe, 0xde, 0xcb,
+  0xdd, 0xce, 0x7e, 0xfd, 0xd9, 0x14, 0x94, 0x01, 0x70, 0x27, 0x32, 0x46, 0xf6, 0x2e, 0x17, 0x00,
+  0xce, 0xff, 0xb3, 0x2f, 0xff, 0x7b, 0xf5, 0x20, 0x94, 0x11, 0xc0, 0x45, 0xa0, 0x47, 0x14, 0x30,
+  0x44, 0x10, 0xf7, 0xe3, 0x76, 0x3a, 0x21, 0x67, 0x21, 0xdf, 0xc7, 0x04, 0x55, 0x8d, 0x44, 0x10,
+  0xb9, 0x10, 0xf7, 0x90, 0x6e, 0xae, 0x45, 0x6f, 0x12, 0xcd, 0x9f, 0x12, 0xdd, 0x20, 0xe6, 0x66,
+  0x3a, 0x11, 0xd7, 0x7b, 0x45, 0xe2, 0x67, 0x05, 0x00, 0xec, 0x14, 0x20, 0xcf, 0xe0, 0x13, 0x40,
+  0x8d, 0xd8, 0xef, 0xce, 0xdd, 0x5c, 0x40, 0x90, 0x32, 0xbe, 0x97, 0x41, 0x21, 0x42, 0xfe, 0xdf,
+  0xc0, 0x22, 0x02, 0x00, 0x80, 0x40, 0xfc, 0x98, 0xba, 0x55, 0xe4, 0x32, 0x5e, 0x17, 0x55, 0x41,
+  0x20, 0xde, 0x83, 0x33, 0xcd, 0x7c, 0x17, 0xbd, 0xe2, 0x21, 0xdf, 0xff, 0x09, 0x05, 0x0c, 0x0b,
+  0x05, 0x00, 0x0f, 0x04, 0x10, 0x57, 0x32, 0x20, 0xc0, 0x98, 0x44, 0x10, 0x10, 0xbd, 0xfd, 0xef,
+  0xcd, 0x34, 0x24, 0xfd, 0xdc, 0xbb, 0x9f, 0x3c, 0x45, 0x78, 0x1e, 0xad, 0x10, 0xdd, 0x50, 0x98,
+  0x40, 0xbe, 0xdc, 0x6e, 0x10, 0xff, 0x09, 0x38, 0x66, 0x18, 0xb0, 0x03, 0xc4, 0x11, 0x9f, 0x12,
+  0x8d, 0xae, 0x78, 0x55, 0xe0, 0x99, 0x25, 0x44, 0x10, 0xde, 0x67, 0x01, 0xfe, 0xce, 0x94, 0x31,
+  0xfb, 0xef, 0xfd, 0x7d, 0x02, 0xde, 0x88, 0x67, 0xcb, 0x1c, 0xc0, 0xe8, 0x97, 0x01, 0x9f, 0x42,
+  0x53, 0x5f, 0xff, 0x10, 0x3a, 0x36, 0x12, 0x6b, 0x23, 0x5f, 0x7c, 0xa1, 0x10, 0xe6, 0x10, 0x4b,
+  0x9b, 0x05, 0x49, 0xef, 0x86, 0x13, 0x25, 0x11, 0xac, 0x71, 0xab, 0x12, 0xdf, 0x8f, 0x69, 0x53,
+  0x40, 0x87, 0x1b, 0xbb, 0x2c, 0x79, 0x53, 0x13, 0xec, 0x7f, 0x11, 0x6c, 0x15, 0x17, 0x00, 0xde,
+  0xd2, 0x02, 0xc4, 0xde, 0xed, 0x2c, 0x19, 0xce, 0xdc, 0xec, 0x68, 0x10, 0x4c, 0x0d, 0x04, 0xea,
+  0xdf, 0xc2, 0x00, 0xdd, 0xdb, 0xaa, 0xa8, 0x7a, 0x00, 0x87, 0xa8, 0x7a, 0x88, 0xcc, 0xbe, 0xed,
+  0xef, 0x68, 0xee, 0xfe, 0xde, 0x07, 0x14, 0xdf, 0xea, 0x1b, 0xa8, 0x12, 0xdf, 0x1a, 0xbd, 0x5d,
+  0x02, 0xcd, 0x9b, 0x1f, 0x7c, 0x11, 0xfd, 0xff, 0xcb, 0xc2, 0xbf, 0x34, 0x04, 0xed, 0xfe, 0xdb,
+  0xa9, 0x0e, 0x09, 0xc5, 0x30, 0x3f, 0xdd, 0x9c, 0x22, 0x11, 0x98, 0x00, 0xb7, 0x22, 0xcf, 0x92,
+  0xdd, 0x43, 0xcb, 0xfd, 0x3f, 0x38, 0x6c, 0xd6, 0x4a, 0xa2, 0x32, 0xa9, 0x0a, 0xdd, 0x49, 0xf7,
+  0x4a, 0xcf, 0xdd, 0x0e, 0xfd, 0xd1, 0x06, 0xaa, 0x33, 0x02, 0x00, 0xdf, 0xfa, 0x99, 0xee, 0x9e,
+  0xfc, 0x5c, 0x20, 0xd6, 0x24, 0x6e, 0xa9, 0x89, 0x23, 0xdf, 0xce, 0x08, 0x1b, 0xf2, 0xdf, 0xd3,
+  0xad, 0xef, 0xbe, 0xa2, 0x22, 0xe3, 0x33, 0xc5, 0x3c, 0xc4, 0x31, 0x9f, 0x41, 0x33, 0x12, 0x3b,
+  0xd8, 0x3b, 0x7f, 0x34, 0x17, 0x00, 0xff, 0xee, 0x67, 0x11, 0xf6, 0xcf, 0xff, 0x7e, 0x09, 0x45,
+  0xce, 0x1a, 0x3c, 0x98, 0x00, 0x80, 0x20, 0xe5, 0x61, 0xf7, 0xd6, 0x41, 0x06, 0x0b, 0x22, 0x11,
+  0xde, 0x2e, 0x01, 0x9c, 0x02, 0x62, 0x10, 0x6a, 0x01, 0xc8, 0xfd, 0xff, 0xce, 0x3b, 0x03, 0xbc,
+  0xec, 0x3b, 0x00, 0x14, 0x00, 0x70, 0xef, 0xfb, 0x99, 0xed, 0xd5, 0x00, 0xa2, 0x02, 0xa8, 0x02,
+  0xde, 0x00, 0xdc, 0xb8, 0x7b, 0xaa, 0xde, 0xee, 0xef, 0xef, 0x3e, 0xfd, 0x15, 0x32, 0x6a, 0x21,
+  0x67, 0x11, 0x19, 0x17, 0x7c, 0x11, 0xfe, 0xff, 0x10, 0xb9, 0x9f, 0xed, 0xfe, 0xf7, 0x02, 0xdb,
+  0xa9, 0xee, 0xbd, 0xdd, 0x00, 0xcc, 0x44, 0x10, 0xc9, 0x9e, 0x05, 0x00, 0x45, 0x25, 0xfd, 0xd2,
+  0x1e, 0xff, 0x7d, 0x13, 0x95, 0x26, 0x80, 0x33, 0xf1, 0x21, 0x84, 0x45, 0xd9, 0x6a, 0x44, 0x10,
+  0x72, 0x32, 0x1f, 0x02, 0x70, 0x7a, 0x00, 0x45, 0x12, 0xa9, 0x14, 0x45, 0x42, 0xde, 0xfb, 0xab,
+  0xbc, 0xcb, 0xbd, 0xf8, 0x2c, 0x44, 0x10, 0x60, 0x6e, 0x0e, 0x6f, 0xfd, 0x76, 0x47, 0xdf, 0xf1,
+  0x91, 0x44, 0x00, 0xa5, 0x4e, 0x9e, 0x90, 0x71, 0x43, 0xdf, 0xf1, 0x01, 0x41, 0x93, 0xb9, 0xff,
+  0x12, 0xfd, 0xdf, 0x82, 0x08, 0x84, 0x5e, 0x9e, 0x7c, 0xed, 0xac, 0x11, 0xf6, 0xbf, 0xa5, 0x3b,
+  0x9e, 0x06, 0xee, 0xf2, 0x13, 0x2d, 0x52, 0x86, 0x09, 0x14, 0x03, 0x3e, 0xde, 0xcf, 0x02, 0x5a,
+  0x05, 0x48, 0x2b, 0x02, 0x10, 0x6d, 0x11, 0xfd, 0xef, 0x1c, 0xdf, 0xed, 0x1f, 0x04, 0x3f, 0x05,
+  0xb2, 0x17, 0xad, 0xfc, 0xee, 0x78, 0xdd, 0xea, 0x87, 0xa4, 0x09, 0xd7, 0x06, 0x6a, 0x11, 0x02,
+  0x30, 0xcb, 0xc0, 0x97, 0xba, 0xad, 0xee, 0xee, 0xee, 0xcf, 0x05, 0xaa, 0x03, 0x01, 0x7c, 0x04,
+  0xee, 0xef, 0xdd, 0xfd, 0xef, 0xed, 0xfe, 0x32, 0xee, 0xa3, 0x11, 0xdd, 0xc9, 0x67, 0x01, 0x23,
+  0x00, 0xdb, 0xbb, 0xfc, 0xdf, 0xed, 0x2c, 0x23, 0x44, 0x00, 0xc4, 0x11, 0x74, 0x10, 0x05, 0x20,
+  0xcf, 0x32, 0xff, 0x7a, 0x16, 0x64, 0x01, 0xe0, 0x43, 0xdd, 0x20, 0x9e, 0x00, 0x11, 0x06, 0x42,
+  0x32, 0x75, 0x62, 0xe7, 0x79, 0x4d, 0x6f, 0x55, 0x53, 0x5f, 0xdf, 0xbf, 0x8a, 0x02, 0x22, 0x41,
+  0x31, 0x21, 0xe0, 0xfd, 0xdd, 0xa4, 0x4d, 0xee, 0xf1, 0x04, 0xb6, 0x33, 0x53, 0x7f, 0xfd, 0x44,
+  0x40, 0xec, 0xa1, 0x29, 0xde, 0x38, 0x36, 0x8b, 0xcf, 0x32, 0x04, 0x77, 0x6a, 0x41, 0xa7, 0x93,
+  0x22, 0xa5, 0x0e, 0x74, 0xb0, 0xfc, 0xed, 0x84, 0x1f, 0xfe, 0x01, 0x07, 0xbf, 0x64, 0x71, 0x94,
+  0x17, 0x67, 0x01, 0xcf, 0x52, 0x39, 0x02, 0x71, 0x2b, 0xfe, 0x73, 0x14, 0xde, 0xea, 0x8a, 0x42,
+  0x6a, 0x01, 0x2e, 0x17, 0x8a, 0x12, 0xed, 0xcc, 0x12, 0x79, 0x01, 0x0b, 0x02, 0x20, 0x1b, 0x14,
+  0xec, 0xda, 0x16, 0xce, 0xdb, 0xde, 0xad, 0x80, 0xfc, 0xef, 0xde, 0xea, 0x77, 0xed, 0xbf, 0xcf,
+  0x52, 0x03, 0x7b, 0x35, 0x16, 0x04, 0xdf, 0xdd, 0xca, 0x9a, 0x98, 0xcb, 0x20, 0xbe, 0xed, 0xde,
+  0xee, 0xee, 0x02, 0x00, 0xee, 0xde, 0x00, 0xed, 0xdd, 0xcc, 0xcc, 0xcc, 0xbc, 0xbb, 0xcc, 0x10,
+  0xca, 0x87, 0xfb, 0xbf, 0x67, 0x11, 0xed, 0xcc, 0xcd, 0xde, 0xdf, 0x44, 0x20, 0x8e, 0x01, 0xa7,
+  0x30, 0x6a, 0x31, 0xbd, 0x15, 0x08, 0x22, 0x71, 0xf7, 0xeb, 0x01, 0x68, 0x56, 0x37, 0x24, 0xdf,
+  0xc9, 0x28, 0xc9, 0x8e, 0x2d, 0x42, 0x9f, 0xf5, 0x0f, 0x7c, 0x34, 0x9f, 0x05, 0x52, 0x31, 0x47,
+  0x03, 0xb6, 0x7b, 0x77, 0xde, 0x5e, 0xfe, 0x53, 0x1c, 0x44, 0x20, 0xa9, 0x51, 0xda, 0x33, 0xed,
+  0x9c, 0x28, 0xeb, 0xff, 0x44, 0x50, 0xbd, 0x3e, 0x5a, 0x35, 0xc4, 0x11, 0x4c, 0x84, 0xcf, 0x32,
+  0x67, 0x11, 0x2c, 0x23, 0xbd, 0x17, 0x80, 0xbe, 0x9f, 0x06, 0x49, 0x1a, 0xb0, 0x4c, 0x1f, 0x57,
+  0xdf, 0x89, 0x30, 0xcf, 0x44, 0x00, 0x75, 0x05, 0xba, 0x15, 0x43, 0x1e, 0xff, 0xef, 0xf3, 0x02,
+  0x52, 0x01, 0x9f, 0xe3, 0x00, 0xcf, 0x12, 0xc2, 0x13, 0x5a, 0x02, 0x98, 0x00, 0xbe, 0xea, 0x3a,
+  0x14, 0x16, 0xbd, 0x72, 0x15, 0x6a, 0x01, 0xde, 0xcc, 0x02, 0xde, 0xcc, 0xeb, 0x42, 0xde, 0x4f,
+  0x04, 0xeb, 0xde, 0xde, 0xfe, 0x6a, 0x01, 0x98, 0xe0, 0xa8, 0x7c, 0x99, 0xdc, 0xbe, 0xf7, 0x0b,
+  0xd5, 0x12, 0xb6, 0x29, 0x83, 0x4c, 0x11, 0x02, 0x00, 0xec, 0xcd, 0xba, 0xdc, 0xbe, 0xed, 0x02,
+  0x16, 0xee, 0x02, 0x50, 0x17, 0x20, 0xef, 0x17, 0x00, 0xdd, 0xdf, 0xdd, 0xf5, 0x59, 0x00, 0xec,
+  0xd0, 0x04, 0xde, 0xbc, 0x00, 0x59, 0x00, 0x6f, 0x1b, 0xe5, 0x17, 0xff, 0x0a, 0x11, 0xdc, 0x01,
+  0x26, 0x1f, 0xa7, 0x23, 0xb6, 0x30, 0x2a, 0x48, 0x72, 0x45, 0x2a, 0x32, 0xfb, 0xbe, 0x17, 0xe5,
+  0x47, 0xfe, 0x1c, 0x31, 0x5c, 0x56, 0xfc, 0x22, 0x0b, 0x1c, 0x5a, 0x35, 0x01, 0xbb, 0x0d, 0xef,
+  0xa7, 0x8f, 0x78, 0xa6, 0x6e, 0xee, 0xfb, 0xa9, 0x57, 0x1e, 0xa5, 0xce, 0xcc, 0x05, 0x9c, 0x05,
+  0xb4, 0x18, 0x71, 0x30, 0x4f, 0x81, 0x9f, 0x71, 0x23, 0x83, 0xaf, 0x4b, 0x15, 0xe7, 0x42, 0xcb,
+  0x86, 0xef, 0xce, 0x1c, 0x1e, 0x3f, 0xa9, 0x0a, 0xb7, 0x05, 0x11, 0x73, 0xf1, 0x61, 0x89, 0x03,
+  0x18, 0x4b, 0xcd, 0xed, 0x62, 0xff, 0xf3, 0x00, 0xfe, 0xfe, 0xce, 0x62, 0x10, 0x55, 0x01, 0xde,
+  0x08, 0xbe, 0xfb, 0xdd, 0x4f, 0x21, 0xfb, 0xde, 0xcd, 0xec, 0x18, 0xbe, 0xdb, 0xde, 0x07, 0x01,
+  0x67, 0x21, 0xde, 0xbd, 0xec, 0x09, 0x4c, 0x04, 0xeb, 0xde, 0x0a, 0x01, 0xbc, 0xec, 0xbd, 0xeb,
+  0x09, 0x6a, 0x51, 0xfe, 0xfe, 0x3c, 0x00, 0xdd, 0xcb, 0xa9, 0xa8, 0xf0, 0x7c, 0xa9, 0xed, 0xce,
+  0x6d, 0x31, 0x55, 0x21, 0x2f, 0x04, 0x02, 0x60, 0x15, 0x6d, 0x81, 0xed, 0x6f, 0x08, 0xec, 0x67,
+  0x11, 0xef, 0xdf, 0xef, 0x3f, 0xdc, 0x01, 0x99, 0x38, 0x77, 0x00, 0x5a, 0x02, 0x74, 0x00, 0x02,
+  0x00, 0xcf, 0xdc, 0xe7, 0x9f, 0x28, 0x1f, 0x3a, 0xad, 0x00, 0xdd, 0xfc, 0xd4, 0x0c, 0xa2, 0x12,
+  0x0e, 0x8f, 0xff, 0x61, 0x17, 0xc2, 0x00, 0x37, 0x47, 0xef, 0x40, 0x3f, 0x28, 0x4c, 0x11, 0xdd,
+  0x20, 0xad, 0x16, 0x01, 0x23, 0x2f, 0xef, 0xde, 0xed, 0x66, 0xf7, 0x8b, 0x56, 0xdd, 0xab, 0x00,
+  0xdf, 0x9a, 0x01, 0xac, 0x14, 0xf9, 0x85, 0xce, 0xd6, 0x04, 0xc4, 0x11, 0xff, 0xe7, 0x45, 0xe4,
+  0x32, 0x44, 0x60, 0x3a, 0x51, 0xe4, 0x32, 0x4c, 0x04, 0xc4, 0x41, 0x6b, 0x4f, 0xff, 0x1c, 0x57,
+  0x16, 0x0a, 0xa1, 0x30, 0xba, 0x02, 0x64, 0x44, 0x91, 0x04, 0x44, 0x20, 0x17, 0x00, 0x2f, 0x9c,
+  0x0b, 0xba, 0x15, 0x67, 0x01, 0x0b, 0x00, 0xfe, 0xfa, 0x02, 0xef, 0xfd, 0x5d, 0xca, 0x1d, 0xbd,
+  0xf2, 0x00, 0x6f, 0x22, 0x56, 0x01, 0xdf, 0x55, 0x01, 0xcc, 0x5e, 0xed, 0x52, 0x01, 0x64, 0x11,
+  0xcc, 0x12, 0x14, 0x10, 0xce, 0x09, 0x00, 0xcd, 0x80, 0xec, 0xdd, 0xcb, 0xdd, 0xbc, 0xeb, 0xde,
+  0x02, 0x00, 0x00, 0xbd, 0xec, 0xdd, 0xde, 0xce, 0xfd, 0xee, 0xee, 0x02, 0xfe, 0x6f, 0x08, 0xef,
+  0xed, 0xdd, 0xba, 0x9a, 0x98, 0xb8, 0xec, 0xce, 0xdd, 0x5b, 0x21, 0x61, 0x61, 0x08, 0x00, 0xfd,
+  0x7c, 0x71, 0xcc, 0xdb, 0xa8, 0xda, 0x00, 0x41, 0x00, 0xde, 0xcf, 0xdb, 0x01, 0xde, 0x0e, 0x91,
+  0x2c, 0x23, 0xeb, 0xee, 0xdf, 0xc9, 0x08, 0xcd, 0xec, 0x98, 0x00, 0xef, 0x97, 0x34, 0xc8, 0x00,
+  0x6a, 0x01, 0xf2, 0x00, 0xde, 0x59, 0x33, 0xd2, 0x42, 0x3c, 0x5b, 0xfb, 0x14, 0x00, 0xcf, 0x32,
+  0xcd, 0x22, 0x0a, 0xb2, 0x0d, 0xd4, 0x5c, 0x14, 0x30, 0x9a, 0x21, 0x03, 0x0e, 0x0f, 0x3a, 0x31,
+  0xef, 0xfb, 0x77, 0xf7, 0x8f, 0x88, 0x68, 0xc5, 0x6c, 0xaa, 0xa1, 0x10, 0xdc, 0x17, 0x13, 0x92,
+  0x3c, 0xbe, 0xff, 0xf3, 0x04, 0xde, 0x2b, 0x5c, 0x20, 0x20, 0x0f, 0x44, 0x50, 0x87, 0x32, 0x05,
+  0x00, 0x97, 0x07, 0xef, 0x3c, 0x2e, 0xc1, 0x21, 0xf3, 0x07, 0x6e, 0x20, 0xcd, 0x2f, 0x00, 0x44,
+  0x00, 0xea, 0x32, 0xde, 0xee, 0x1e, 0x02, 0x71, 0x00, 0x2f, 0x10, 0x1d, 0x00, 0xdc, 0x1c, 0x3d,
+  0x7c, 0x11, 0x5f, 0x03, 0x15, 0x8c, 0x20, 0x96, 0x25, 0x21, 0x15, 0xc5, 0x20, 0xec, 0x0e, 0x07,
+  0xff, 0x2c, 0xef, 0xef, 0x46, 0x0d, 0xb9, 0x09, 0xde, 0x64, 0x01, 0xcd, 0xeb, 0x06, 0xce, 0x02,
+  0x20, 0xc0, 0x12, 0xcc, 0xdc, 0xcd, 0xdc, 0xdc, 0x36, 0xcd, 0x64, 0x41, 0x05, 0x00, 0xdc, 0x74,
+  0x01, 0x73, 0x01, 0xcd, 0xcc, 0x50, 0xdd, 0xcd, 0xdd, 0xed, 0x61, 0x01, 0xff, 0x6a, 0x05, 0xee,
+  0x21, 0x33, 0x01, 0xff, 0xee, 0xef, 0xfe, 0x0e, 0x00, 0xee, 0xeb, 0x6c, 0x98, 0xea, 0x5a, 0x28,
+  0xc3, 0x32, 0xff, 0xc9, 0x42, 0x43, 0x54, 0xdc, 0x50, 0xba, 0xee, 0xed, 0xec, 0xb2, 0x11, 0xce,
+  0xf6, 0x00, 0xff, 0xf6, 0xee, 0x71, 0x00, 0x02, 0x00, 0xdd, 0x76, 0x17, 0x02, 0x10, 0x47, 0x03,
+  0xa1, 0x10, 0xf9, 0x86, 0x00, 0xed, 0xbe, 0x1c, 0x03, 0xbb, 0x14, 0xd7, 0x10, 0xdd, 0x00, 0xf2,
+  0x2c, 0x7b, 0x14, 0x00, 0x07, 0x01, 0xec, 0xc2, 0x30, 0x0a, 0x11, 0x55, 0x21, 0xe0, 0x00, 0xcf,
+  0x3d, 0xdb, 0x01, 0xfd, 0xef, 0x50, 0xf5, 0x33, 0x17, 0x10, 0x2c, 0x00, 0xed, 0xdf, 0x00, 0xed,
+  0xdd, 0xd6, 0x7f, 0x88, 0xf7, 0x8f, 0x78, 0xc8, 0xb5, 0x5c, 0xbb, 0x0f, 0x12, 0xec, 0xfd, 0x76,
+  0x03, 0x79, 0x13, 0x7f, 0xa6, 0x14, 0x0a, 0x34, 0x05, 0x20, 0x14, 0x20, 0x30, 0x15, 0x22, 0x21,
+  0xd2, 0x52, 0xfd, 0xdd, 0x41, 0x00, 0xce, 0xc3, 0x0b, 0x11, 0x30, 0x5c, 0x60, 0xcc, 0xa1, 0x00,
+  0x5c, 0x20, 0x9f, 0xa9, 0x61, 0x47, 0x30, 0xc7, 0x01, 0x8c, 0x10, 0x64, 0x41, 0xdf, 0xde, 0xd1,
+  0x2f, 0xa7, 0x89, 0x10, 0x59, 0x00, 0x5b, 0x21, 0xce, 0xfd, 0x91, 0x22, 0xee, 0x69, 0x12, 0x71,
+  0x61, 0x11, 0xec, 0xce, 0xcc, 0xc2, 0x06, 0xba, 0x02, 0xb2, 0x02, 0xeb, 0xc1, 0x5e, 0x21, 0xeb,
+  0xdd, 0xbd, 0xdb, 0xdd, 0x73, 0x01, 0x02, 0x00, 0x14, 0xcd, 0xdb, 0x0b, 0x10, 0xce, 0x2e, 0x00,
+  0xdd, 0xdc, 0xbb, 0x00, 0xa9, 0xb8, 0x8a, 0x97, 0xa8, 0x8b, 0x87, 0xa9, 0x02, 0x8a, 0x02, 0x00,
+  0x99, 0xb9, 0x8a, 0x88, 0xa8, 0x7a, 0x38, 0x97, 0xec, 0xcf, 0xbd, 0x42, 0xa0, 0x08, 0x3a, 0x34,
+  0xfd, 0xce, 0x0c, 0xcc, 0xfe, 0x35, 0x03, 0x14, 0x00, 0xed, 0xcb, 0xef, 0xed, 0x24, 0xee, 0xcd,
+  0x74, 0x00, 0xdd, 0xed, 0xe5, 0x1c, 0xed, 0xed, 0xfb, 0x73, 0x11, 0x61, 0x11, 0xec, 0xb9, 0x00,
+  0x8c, 0x00, 0xd8, 0x02, 0x6d, 0x01, 0x55, 0x0a, 0xfd, 0x04, 0x01, 0xce, 0x3c, 0x02, 0xd1, 0x10,
+  0x02, 0x10, 0xce, 0x10, 0xd1, 0x40, 0x05, 0x20, 0xfd, 0xb9, 0x30, 0xdd, 0x28, 0x51, 0x59, 0x19,
+  0x0d, 0x11, 0x17, 0x30, 0x6f, 0x1a, 0x2f, 0x10, 0xc1, 0x1c, 0x21, 0xdf, 0xfe, 0xba, 0x9e, 0x78,
+  0xd2, 0x02, 0x6a, 0x11, 0x38, 0x5b, 0x88, 0xed, 0xec, 0x04, 0x9d, 0x00, 0x20, 0x00, 0xde, 0xfd,
+  0xff, 0xf6, 0x01, 0xf4, 0x20, 0x11, 0x50, 0x26, 0x63, 0x41, 0x00, 0xc0, 0x32, 0x70, 0x71, 0x23,
+  0x23, 0xfc, 0xdc, 0xfe, 0xa0, 0x21, 0xfa, 0x31, 0x5b, 0x41, 0x8b, 0x21, 0x73, 0x01, 0x6d, 0x41,
+  0xdf, 0xa6, 0x31, 0xb8, 0x51, 0xac, 0x24, 0x02, 0x20, 0x13, 0x34, 0xbe, 0x6a, 0x11, 0x93, 0x02,
+  0x18, 0xee, 0xfe, 0xec, 0x0b, 0x14, 0x48, 0x01, 0xbc, 0xea, 0xcd, 0x58, 0xbc, 0xeb, 0xdd, 0x52,
+  0x11, 0x55, 0x31, 0xbc, 0x64, 0x11, 0xbc, 0x00, 0xdb, 0xcd, 0xbc, 0xdb, 0xce, 0xbc, 0xdc, 0xdc,
+  0x00, 0xdd, 0xce, 0xed, 0xff, 0xed, 0xcb, 0xa8, 0x7f, 0xff, 0x5d, 0x00, 0xfb, 0x06, 0x75, 0x28,
+  0x01, 0x57, 0x02, 0x50, 0xfb, 0x36, 0x05, 0x00, 0x5e, 0x01, 0x10, 0xee, 0xfd, 0xce, 0xba, 0xab,
+  0x45, 0xee, 0xdc, 0xcc, 0x00, 0xcd, 0xee, 0xbc, 0xfb, 0xde, 0xbc, 0xec, 0xdd, 0xd1, 0x6e, 0x0b,
+  0xfe, 0xfe, 0xed, 0xd9, 0x11, 0xdd, 0x64, 0x11, 0x40, 0x14, 0x59, 0xb8, 0x04, 0xec, 0xed, 0x0e,
+  0x00, 0x2b, 0x07, 0xcf, 0xbe, 0x14, 0xed, 0xe3, 0xfe, 0x03, 0x40, 0x14, 0xfb, 0xde, 0xce, 0xd5,
+  0x05, 0xbf, 0x10, 0x42, 0x12, 0xf0, 0xde, 0xdc, 0xfd, 0xbd, 0x13, 0x1d, 0x3d, 0x0a, 0xc0, 0x55,
+  0x06, 0x1b, 0x3e, 0xfd, 0xfe, 0x29, 0x13, 0x24, 0x25, 0x01, 0x01, 0x21, 0x0b, 0x33, 0xef, 0xfb,
+  0x0c, 0x88, 0xe7, 0x67, 0x11, 0x02, 0x10, 0xe7, 0x8b, 0x55, 0xb9, 0x04, 0x9d, 0xdd, 0x08, 0x09,
+  0xde, 0xde, 0xdd, 0xde, 0xdc, 0x00, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xba, 0xdd, 0xf0, 0xcd,
+  0xed, 0xee, 0xdd, 0x9e, 0x19, 0x70, 0x11, 0x4a, 0x03, 0x0a, 0x4d, 0xf7, 0x10, 0x07, 0x3e, 0x10,
+  0x4c, 0x41, 0xdb, 0x5c, 0x60, 0x52, 0x11, 0x94, 0x31, 0x05, 0x00, 0xbf, 0xcd, 0x04, 0xea, 0x58,
+  0xdc, 0x51, 0x2f, 0x00, 0x43, 0x24, 0xab, 0x15, 0xfc, 0x55, 0x17, 0x17, 0x17, 0x00, 0xb3, 0x19,
+  0x21, 0x15, 0xdd, 0xba, 0x12, 0xce, 0xed, 0xfe, 0xc1, 0xc2, 0x03, 0xbb, 0xdd, 0xbc, 0xda, 0xce,
+  0x4f, 0x11, 0x55, 0x01, 0x86, 0xdc, 0x25, 0x04, 0x67, 0x21, 0xbd, 0xdb, 0xcd, 0xcb, 0x64, 0x01,
+  0x04, 0xcd, 0xbb, 0x02, 0x20, 0xee, 0xee, 0xed, 0xa8, 0x8f, 0xff, 0x57, 0x00, 0x02, 0x00, 0x75,
+  0x00, 0x45, 0x1b, 0x02, 0x20, 0x73, 0x11, 0x8a, 0x75, 0x2e, 0x12, 0x07, 0x26, 0x03, 0x0d, 0x97,
+  0xd2, 0x12, 0xba, 0x9e, 0xef, 0xbc, 0xeb, 0xea, 0xcf, 0x02, 0x00, 0xcd, 0x45, 0x07, 0xee, 0xee,
+  0x00, 0xc0, 0x02, 0x58, 0x07, 0x80, 0xdf, 0xac, 0xfb, 0xce, 0xad, 0xfb, 0xcf, 0x20, 0x06, 0xe7,
+  0xea, 0x02, 0xe4, 0x12, 0x17, 0x00, 0xdc, 0xed, 0xf2, 0x1c, 0xe6, 0x29, 0xa6, 0x0a, 0xbb, 0x52,
+  0x04, 0xae, 0x15, 0xdd, 0x7b, 0x35, 0xb3, 0x3f, 0xc3, 0x05, 0xed, 0x11, 0x00, 0xbe, 0xef, 0x67,
+  0x21, 0xf2, 0x40, 0xc3, 0x45, 0x60, 0x22, 0x0a, 0x11, 0xfd, 0xba, 0x0e, 0x00, 0xb9, 0xad, 0x77,
+  0xe7, 0x8f, 0x78, 0xf8, 0x8f, 0x00, 0x78, 0xe7, 0x8d, 0x97, 0xea, 0x8e, 0xb8, 0xdb, 0x00, 0x7d,
+  0xb8, 0xdb, 0x8e, 0xc8, 0xeb, 0x8e, 0xc8, 0x0a, 0xec, 0x05, 0x00, 0x8d, 0x05, 0x10, 0xdb, 0x8c,
+  0xa7, 0xa8, 0xd0, 0x5a, 0x97, 0xcc, 0xbd, 0x09, 0x05, 0xff, 0x12, 0x18, 0x7e, 0x3b, 0xff, 0x41,
+  0x02, 0x90, 0x25, 0x7a, 0x29, 0x58, 0x4a, 0x82, 0x0a, 0x20, 0x36, 0x6a, 0x11, 0x7c, 0x21, 0xff,
+  0x55, 0x4d, 0x18, 0x0e, 0xcf, 0x22, 0xd8, 0x15, 0x58, 0x07, 0x44, 0x60, 0x21, 0x01, 0xcf, 0x42,
+  0xf4, 0xce, 0xad, 0x2a, 0x04, 0xdd, 0x19, 0x04, 0xc1, 0x02, 0x4f, 0x41, 0x02, 0x30, 0x08, 0xbb,
+  0xdc, 0xcc, 0x64, 0x31, 0xdd, 0xbd, 0xcb, 0xcc, 0x10, 0xcb, 0xbd, 0xbb, 0xdb, 0x02, 0x20, 0xdc,
+  0xcd, 0xee, 0xfc, 0xfa, 0x76, 0x64, 0x21, 0x06, 0x06, 0xba, 0x03, 0xcc, 0x02, 0x61, 0x31, 0xd7,
+  0x19, 0x4f, 0xd8, 0x52, 0xcf, 0x92, 0xd2, 0x12, 0x43, 0x64, 0xcb, 0xae, 0xa6, 0x0d, 0xce, 0x05,
+  0x6a, 0x11, 0xee, 0x62, 0x0e, 0xee, 0xdd, 0xcd, 0xdc, 0xdd, 0x00, 0xdc, 0xdd, 0xbc, 0xfb, 0xce,
+  0xbd, 0xfa, 0xcf, 0xc8, 0xbd, 0xea, 0xcf, 0x05, 0x00, 0xcd, 0xed, 0x64, 0x11, 0xd2, 0x02, 0xdf,
+  0xa8, 0x1b, 0x75, 0x18, 0x02, 0x40, 0xf5, 0x20, 0xcb, 0x00, 0xed, 0xb3, 0x36, 0x5c, 0x4c, 0xf5,
+  0x30, 0x12, 0xfd, 0x29, 0x1c, 0xfc, 0x63, 0x58, 0xc1, 0x3a, 0x94, 0x10, 0xc5, 0x23, 0x01, 0x55,
+  0x1d, 0xef, 0xdf, 0xfe, 0xff, 0xcc, 0xda, 0x99, 0x20, 0xa9, 0x98, 0x75, 0xa8, 0x5e, 0x55, 0x11,
+  0xec, 0x9e, 0x01, 0x05, 0x10, 0xdc, 0x9e, 0xb8, 0xec, 0x8e, 0xc9, 0xec, 0x0e, 0x8e, 0x05, 0x00,
+  0x02, 0x00, 0x76, 0x21, 0x8d, 0xb8, 0xb9, 0x5a, 0xdc, 0xa9, 0xde, 0xdb, 0x2b, 0x8d, 0x22, 0xa2,
+  0x32, 0xfd, 0x4f, 0x41, 0xc3, 0x3b, 0xfd, 0x60, 0x0b, 0xed, 0xcf, 0x42, 0x63, 0x18, 0xb6, 0x29,
+  0x19, 0x3a, 0x6a, 0x44, 0x6e, 0x03, 0x47, 0xa5, 0x48, 0x02, 0x4c, 0x41, 0x00, 0xbc, 0xea, 0xde,
+  0x02, 0x10, 0xeb, 0xd8, 0xcd, 0xbd, 0xdd, 0xba, 0x12, 0x02, 0x00, 0xcc, 0x61, 0x31, 0x02, 0x10,
+  0x00, 0xbd, 0xbc, 0xdb, 0xbd, 0xdc, 0xbd, 0xcb, 0xdc, 0x22, 0xad, 0x02, 0x10, 0xbb, 0xdb, 0xbc,
+  0x02, 0x40, 0xdd, 0xde, 0x1c, 0xdd, 0xdb, 0x0c, 0x0e, 0xc9, 0x12, 0x02, 0x00, 0xec, 0xce, 0xcb,
+  0x20, 0xcb, 0xac, 0xa9, 0xb8, 0x7a, 0x9f, 0x05, 0x88, 0xa9, 0x80, 0x8b, 0x99, 0xba, 0x9b, 0xa9,
+  0xb6, 0x6e, 0x25, 0x24, 0x07, 0x04, 0x77, 0x42, 0x5b, 0xb1, 0x35, 0xeb, 0xa8, 0xdd, 0xde, 0xef,
+  0x4a, 0xcd, 0x6a, 0x11, 0xde, 0x76, 0x09, 0xdd, 0xdd, 0xbd, 0x08, 0xde, 0x08, 0xbc, 0xfa, 0xce,
+  0x6a, 0x01, 0xbc, 0xfb, 0xcf, 0xac, 0x0c, 0xeb, 0xcf, 0x3a, 0x34, 0x02, 0x00, 0xcd, 0xeb, 0xdf,
+  0xbc, 0x7f, 0xcf, 0x22, 0x02, 0x30, 0x3a, 0x24, 0x93, 0x08, 0x4f, 0x11, 0x52, 0x3d, 0x4b, 0x2e,
+  0xee, 0x7d, 0xef, 0x00, 0xee, 0x67, 0x11, 0x6e, 0x3c, 0xa6, 0x7d, 0x37, 0x34, 0x0a, 0x11, 0xfc,
+  0xc1, 0x83, 0x15, 0xcd, 0xca, 0x97, 0xca, 0x7e, 0x55, 0x01, 0x02, 0x30, 0x64, 0xb8, 0xec, 0x64,
+  0x11, 0xc8, 0xdc, 0x08, 0x00, 0xcf, 0x02, 0x9e, 0x0e, 0xc8, 0xde, 0x02, 0x08, 0x00, 0xe1, 0x22,
+  0xb8, 0xb9, 0x6c, 0xcc, 0xff, 0xc3, 0x0e, 0xa8, 0x22, 0x5c, 0x10, 0xac, 0x21, 0x53, 0x5f, 0x3a,
+  0x31, 0x3a, 0x14, 0x78, 0x28, 0xfe, 0xec, 0x1b, 0x2b, 0x71, 0x5f, 0x17, 0x16, 0xfc, 0x22, 0x75,
+  0x7b, 0x96, 0x28, 0xcf, 0x12, 0x50, 0xeb, 0xcd, 0xac, 0xeb, 0x75, 0x25, 0xdd, 0x1f, 0x44, 0xbc,
+  0x73, 0xb7, 0x32, 0x05, 0x00, 0xcb, 0xbc, 0x02, 0x00, 0x25, 0x05, 0x19, 0x0e, 0xec, 0x14, 0xbc,
+  0xbb, 0x0b, 0x00, 0xcb, 0x11, 0x00, 0xcc, 0xbc, 0xba, 0x02, 0xcd, 0x92, 0x01, 0xcb, 0xed, 0xce,
+  0xcc, 0xdb, 0xab, 0x60, 0x98, 0xa8, 0x7b, 0xaa, 0xdc, 0xf8, 0x3d, 0x02, 0x20, 0xee, 0xc2, 0xef,
+  0x0b, 0x00, 0xee, 0xa8, 0x7d, 0x99, 0x42, 0x6b, 0xc6, 0x32, 0x03, 0x05, 0x20, 0x43, 0x74, 0xed,
+  0xcb, 0xaa, 0xee, 0xed, 0xef, 0xc6, 0xbb, 0x02, 0x0a, 0x66, 0x01, 0xcd, 0xdd, 0xdd, 0x7d, 0x00,
+  0xde, 0x02, 0x66, 0xea, 0x4c, 0x14, 0xd2, 0x02, 0xbc, 0xfc, 0xc4, 0x04, 0x02, 0x00, 0xed, 0x25,
+  0x67, 0x01, 0xce, 0x4f, 0x14, 0xde, 0xac, 0xcf, 0x22, 0xbd, 0xed, 0xff, 0x7f, 0x01, 0x78, 0x08,
+  0x4c, 0x54, 0xcf, 0x32, 0xe7, 0x22, 0xd6, 0x4d, 0xcc, 0x52, 0xa1, 0x39, 0x0b, 0x22, 0x21, 0xec,
+  0x06, 0xef, 0xb2, 0x0a, 0xbc, 0xba, 0x96, 0xec, 0xb6, 0x8f, 0x61, 0x21, 0xc9, 0x02, 0x9e, 0x4f,
+  0x31, 0x0e, 0x00, 0xb9, 0x05, 0x00, 0x37, 0x0b, 0x00, 0x0e, 0x10, 0xdb, 0x32, 0x8d, 0x7f, 0x01,
+  0xd5, 0x12, 0xaa, 0x7e, 0xfc, 0xee, 0xef, 0xf5, 0x3f, 0x4f, 0x21, 0x3e, 0x1f, 0x98, 0x5c, 0x17,
+  0x16, 0x0b, 0x06, 0xff, 0x5c, 0x20, 0x1b, 0x1b, 0x02, 0x00, 0xce, 0x5f, 0x71, 0x13, 0xcf, 0x12,
+  0xf5, 0x29, 0x52, 0x5d, 0x1f, 0x67, 0x04, 0x29, 0x00, 0x8a, 0x25, 0x25, 0x24, 0xef, 0x06, 0xbe,
+  0xcb, 0xdd, 0x4e, 0xad, 0x1f, 0x04, 0x5e, 0x11, 0x02, 0x60, 0xdc, 0xbf, 0x9a, 0x0b, 0xbb, 0x00,
+  0xfb, 0xbd, 0xaa, 0xc8, 0xac, 0x79, 0xd7, 0x9d, 0x00, 0x68, 0xd5, 0x8d, 0x58, 0xd5, 0x8d, 0x79,
+  0xfd, 0x30, 0xdd, 0xbb, 0xda, 0xae, 0x2e, 0x02, 0x31, 0x05, 0xcc, 0xea, 0x00, 0xce, 0x8a, 0xe6,
+  0x9d, 0x59, 0xd6, 0x9e, 0x7a, 0x00, 0xea, 0xce, 0xde, 0xfc, 0xdd, 0xbc, 0xb9, 0x8b, 0xfe, 0x98,
+  0x3a, 0x44, 0xda, 0xd9, 0x02, 0x30, 0x43, 0x14, 0xa5, 0x15, 0x8c, 0x06, 0x1d, 0x0b, 0x88, 0xcd,
+  0xcc, 0xec, 0x35, 0x0a, 0xcc, 0xce, 0xbb, 0xcc, 0x02, 0x02, 0xed, 0x02, 0x08, 0xef, 0xde, 0xfc,
+  0xdf, 0xbc, 0xed, 0xc6, 0xdd, 0x00, 0x00, 0x6a, 0x01, 0xcd, 0xdc, 0xdf, 0x0e, 0x00, 0x4f, 0x14,
+  0xea, 0xfa, 0x55, 0x14, 0xce, 0x67, 0x01, 0xcd, 0x6a, 0x01, 0x67, 0x11, 0x4f, 0x84, 0x3f, 0xdd,
+  0x10, 0x22, 0x1a, 0x3e, 0x3f, 0x79, 0x21, 0x80, 0x36, 0xc4, 0x12, 0xef, 0xfe, 0x01, 0xec, 0x06,
+  0x98, 0x6d, 0xb7, 0xfc, 0x9f, 0xc9, 0xfc, 0x02, 0x9e, 0x64, 0x01, 0xb8, 0xcb, 0x7a, 0x95, 0xaa,
+  0x5b, 0xfc, 0xb7, 0xdc, 0xc3, 0x22, 0x3d, 0x34, 0x5e, 0x41, 0xa2, 0x05, 0x3a, 0x54, 0x43, 0x14,
+  0x80, 0x8a, 0x96, 0xcc, 0xce, 0xff, 0xbe, 0xfc, 0xac, 0x51, 0xef, 0x83, 0x8f, 0x4a, 0x13, 0x72,
+  0x15, 0xac, 0x14, 0xef, 0x4e, 0x0e, 0x34, 0x04, 0xdc, 0x51, 0x1f, 0x44, 0x15, 0x04, 0x27, 0x83,
+  0x6f, 0xcf, 0x62, 0x8a, 0x55, 0xbd, 0xcc, 0xcd, 0x80, 0xdb, 0xdc, 0xad, 0xda, 0xdc, 0xbe, 0xca,
+  0x83, 0x17, 0x01, 0x61, 0x11, 0xac, 0xca, 0xbc, 0x9b, 0xc8, 0xad, 0x78, 0x00, 0xe6, 0x7f, 0x66,
+  0xf5, 0x7f, 0x67, 0xf6, 0x7f, 0x00, 0x67, 0xe6, 0x7e, 0x57, 0xd5, 0x7d, 0x57, 0xd5, 0x01, 0x05,
+  0x10, 0x58, 0xe7, 0x9e, 0xab, 0xfb, 0xbe, 0xab, 0x20, 0xf8, 0x9e, 0x57, 0xe6, 0x7e, 0x76, 0x01,
+  0x59, 0xd7, 0x08, 0x9e, 0xac, 0xfd, 0xcc, 0x06, 0xcb, 0x99, 0xb9, 0x8f, 0x1f, 0x7a, 0x5f, 0x37,
+  0x44, 0x08, 0x60, 0xa8, 0x75, 0x02, 0x40, 0xde, 0xcc, 0xba, 0x12, 0xae, 0xfb, 0x02, 0xdd, 0xdc,
+  0x1d, 0x03, 0xcc, 0xcd, 0xbb, 0x00, 0xed, 0xef, 0xee, 0xfd, 0xdd, 0xdb, 0xcc, 0xab, 0xf0, 0xcb,
+  0xce, 0xef, 0xcd, 0x67, 0x01, 0xe4, 0x02, 0xb5, 0x05, 0xbf, 0x12, 0xd1, 0x9c, 0x08, 0xcf, 0xbc,
+  0xfb, 0xd5, 0x12, 0xcd, 0xcf, 0x12, 0x6a, 0x11, 0x67, 0x34, 0x07, 0x61, 0x11, 0x4f, 0x34, 0xfb,
+  0xee, 0x24, 0x00, 0xcf, 0x02, 0xde, 0x67, 0xb1, 0x08, 0x4f, 0x24, 0x6a, 0x01, 0xbd, 0xfc, 0xca,
+  0x18, 0x75, 0x1a, 0x9b, 0x00, 0xb8, 0xed, 0xbf, 0xeb, 0xfd, 0xaf, 0xc9, 0xed, 0x00, 0x9e, 0xc9,
+  0xdc, 0x89, 0xa5, 0x7a, 0x4a, 0xc6, 0xf0, 0xbd, 0x7c, 0xc8, 0xed, 0x61, 0x11, 0x40, 0x64, 0x43,
+  0x34, 0x73, 0x31, 0x0c, 0xc9, 0xdc, 0x6a, 0x11, 0xb1, 0x35, 0xc8, 0xda, 0x7b, 0xcb, 0xfe, 0xee,
+  0x60, 0x0d, 0x0a, 0x24, 0x48, 0x3e, 0xa2, 0x65, 0xfc, 0x15, 0xf1, 0x05, 0xdc, 0x1d, 0xef, 0xcc,
+  0x12, 0xcb, 0x3c, 0x7c, 0x17, 0xcf, 0x42, 0xfd, 0xc9, 0x45, 0x2c, 0x30, 0xac, 0x11, 0x02, 0xfd,
+  0x8a, 0x45, 0xcb, 0xcc, 0xdc, 0xbd, 0xca, 0xec, 0x02, 0xad, 0x02, 0x10, 0xdb, 0xac, 0xab, 0xc9,
+  0xad, 0x78, 0x00, 0xd6, 0x7d, 0x56, 0xd5, 0x6d, 0x56, 0xd5, 0x6e, 0x80, 0x66, 0xe5, 0x6e, 0x66,
+  0xf6, 0x6f, 0x57, 0x02, 0x00, 0x18, 0xf5, 0x7e, 0x67, 0x64, 0x21, 0x02, 0x10, 0xe5, 0x7e, 0x67,
+  0x21, 0x02, 0x50, 0x68, 0xe9, 0xbf, 0xdd, 0xc6, 0x12, 0x9b, 0x98, 0x1f, 0x13, 0x07, 0x07, 0x87,
+  0x63, 0x98, 0x89, 0xbf, 0x70, 0x61, 0xdb, 0xa8, 0xdd, 0x0a, 0xdf, 0x6a, 0x01, 0xcd, 0x91, 0x0b,
+  0xdd, 0xfe, 0xde, 0xa6, 0x00, 0x7c, 0x8a, 0xd9, 0xbd, 0x8a, 0xc7, 0x9b, 0x99, 0xc0, 0xfe, 0xfd,
+  0xdd, 0xed, 0xdd, 0xdc, 0xd4, 0x32, 0x4e, 0x00, 0xfe, 0xcd, 0x67, 0x01, 0x4c, 0x14, 0x62, 0x04,
+  0xcf, 0x42, 0x4f, 0x04, 0xcc, 0x42, 0x58, 0x01, 0x39, 0x87, 0x05, 0xdd, 0xed, 0xf1, 0x00, 0x05,
+  0x00, 0xf7, 0x07, 0xbe, 0xfd, 0x01, 0xc5, 0x02, 0xff, 0xde, 0xed, 0xed, 0xcc, 0xba, 0xa7, 0x20,
+  0xdd, 0xaf, 0xfd, 0xff, 0xcf, 0xd8, 0x13, 0xfe, 0xce, 0x00, 0xdb, 0xb9, 0x66, 0xa4, 0x7d, 0x59,
+  0xd6, 0xad, 0x00, 0x7c, 0xd8, 0xec, 0x8e, 0xd9, 0xec, 0x9f, 0xc9, 0xf8, 0xed, 0x9f, 0xc8, 0x05,
+  0x00, 0x6a, 0x81, 0x64, 0x01, 0x43, 0x04, 0x5e, 0x01, 0x67, 0x05, 0x00, 0x81, 0x38, 0xe4, 0x12,
+  0xbb, 0xae, 0x67, 0x21, 0x5a, 0x1b, 0xfe, 0xff, 0xcf, 0x62, 0x4f, 0x01, 0xe5, 0x00, 0xe8, 0x1d,
+  0x00, 0x00, 0xc6, 0x25, 0xb7, 0x45, 0xfc, 0x62, 0x0e, 0xdd, 0xf9, 0x48, 0x4b, 0x4e, 0x4c, 0x07,
+  0xcd, 0xfd, 0xbc, 0xcb, 0x02, 0xbc, 0x02, 0x00, 0xbb, 0xcd, 0xcb, 0xdc, 0xae, 0xca, 0x00, 0xdc,
+  0xae, 0xb9, 0xe9, 0x8e, 0x76, 0xe6, 0x5e, 0x06, 0x65, 0x61, 0x21, 0x02, 0x10, 0xe5, 0x6e, 0x65,
+  0xe5, 0x5f, 0x20, 0x65, 0xe5, 0x6f, 0x66, 0xf5, 0x02, 0x00, 0x7f, 0x66, 0x0b, 0x58, 0x01, 0x6a,
+  0x11, 0x7e, 0x67, 0x01, 0x56, 0xf6, 0x7e, 0x56, 0xc9, 0x79, 0x01, 0xf9, 0xaf, 0xc6, 0x02, 0x9a,
+  0xb9, 0xe3, 0x19, 0x64, 0x61, 0x80, 0xdd, 0xec, 0xcb, 0x98, 0xd8, 0x7e, 0xa9, 0x2b, 0xc4, 0x07,
+  0xd2, 0x22, 0xb9, 0x7c, 0xae, 0x35, 0xed, 0xcb, 0x99, 0xec, 0xdf, 0x02, 0xde, 0xd8, 0x09, 0xee,
+  0xeb, 0x79, 0xd8, 0xad, 0x9b, 0x00, 0xd9, 0xcb, 0x78, 0xd8, 0xbc, 0x78, 0xdd, 0xde, 0x18, 0xee,
+  0xdc, 0xde, 0xe7, 0x12, 0xe3, 0x0a, 0xed, 0xfe, 0xde, 0x12, 0xdd, 0x22, 0x17, 0xcf, 0xbc, 0x60,
+  0x01, 0xdd, 0xed, 0xed, 0x61, 0xe2, 0x12, 0xed, 0xde, 0xdc, 0xde, 0xe1, 0x22, 0xcc, 0x02, 0xdf,
+  0x0b, 0x4c, 0x14, 0x67, 0x01, 0xee, 0x25, 0x14, 0xff, 0xfe, 0xef, 0xde, 0x00, 0xed, 0xdd, 0xbc,
+  0xba, 0xa7, 0xdc, 0x9f, 0xfc, 0x04, 0xff, 0xcf, 0x02, 0x20, 0xdf, 0xfc, 0xfe, 0xce, 0x99, 0x00,
+  0xd7, 0x66, 0x94, 0x9e, 0x8b, 0xf9, 0xcf, 0xac, 0x04, 0xe8, 0xdd, 0x64, 0x11, 0xd9, 0xfc, 0x9e,
+  0xd9, 0xfc, 0xfc, 0x9f, 0xd9, 0xc0, 0x02, 0x49, 0x14, 0xb1, 0x55, 0xcf, 0x32, 0x34, 0x14, 0x52,
+  0x14, 0xf3, 0x05, 0x00, 0x3d, 0x24, 0x8c, 0xba, 0x66, 0x03, 0x3d, 0x31, 0x3a, 0x11, 0x84, 0x25,
+  0xd7, 0x3f, 0x08, 0xde, 0x18, 0x00, 0x30, 0xfc, 0x87, 0x68, 0xef, 0xe1, 0x28, 0x02, 0x50, 0x3c,
+  0xdb, 0xee, 0xf9, 0x48, 0x83, 0x1f, 0x11, 0x10, 0x8d, 0x05, 0xcb, 0xcc, 0x00, 0xbb, 0xdc, 0xad,
+  0xba, 0xea, 0x8e, 0x76, 0xf6, 0x28, 0x5e, 0x55, 0xe6, 0x02, 0x00, 0x5f, 0x05, 0x00, 0x56, 0xd5,
+  0x03, 0x02, 0x20, 0x0b, 0x00, 0xe5, 0x6e, 0x55, 0xf5, 0x5e, 0x56, 0x94, 0xf5, 0x6f, 0x02, 0x00,
+  0x57, 0x02, 0x00, 0xe5, 0x6e, 0x64, 0x21, 0x01, 0x82, 0x01, 0x6f, 0x57, 0xe6, 0x7f, 0xcc, 0xec,
+  0xdc, 0x28, 0x99, 0xdb, 0xaf, 0x48, 0x6b, 0xec, 0x71, 0x05, 0xca, 0x9b, 0xf2, 0x98, 0x16, 0x08,
+  0xb8, 0x9c, 0x67, 0x31, 0x58, 0x91, 0x0b, 0x60, 0x10, 0x27, 0x03, 0x82, 0x31, 0x6a, 0x01, 0xbb,
+  0x99, 0xec, 0xef, 0xde, 0xeb, 0x00, 0xcd, 0x58, 0xe6, 0x9b, 0x58, 0xe7, 0xbb, 0x67, 0x80, 0xe8,
+  0xae, 0x9a, 0xb8, 0x9f, 0xee, 0xdc, 0x66, 0x0a, 0x08, 0xde, 0xcc, 0xdd, 0xa6, 0x0e, 0xee, 0xcf,
+  0xed, 0xec, 0x7c, 0xcf, 0xcc, 0x31, 0x07, 0xdd, 0x12, 0x04, 0x10, 0xe7, 0x02, 0x6d, 0x01, 0xcd,
+  0x73, 0x1c, 0x09, 0x49, 0x04, 0xec, 0xdd, 0x8a, 0x01, 0x23, 0x04, 0x7e, 0x07, 0xdd, 0x00, 0xcb,
+  0xba, 0x98, 0x69, 0x74, 0xca, 0x6e, 0xda, 0x40, 0xfe, 0xbf, 0xeb, 0xff, 0xbf, 0xfb, 0x67, 0x31,
+  0xed, 0x00, 0xbe, 0x87, 0xd6, 0x6b, 0x75, 0x6c, 0x69, 0xf8, 0x60, 0xaf, 0x9d, 0xfa, 0xef, 0xbf,
+  0x76, 0x01, 0x43, 0x04, 0xd9, 0x60, 0xfd, 0x9f, 0xc9, 0xfd, 0x9e, 0x02, 0x00, 0x70, 0x21, 0x9e,
+  0xec, 0xc9, 0xfc, 0x6a, 0x91, 0x45, 0x0b, 0x5e, 0x61, 0x11, 0x1f, 0x37, 0x73, 0x01, 0x0c, 0xcb,
+  0xae, 0x38, 0x0f, 0xd2, 0x32, 0xee, 0xbe, 0xeb, 0xee, 0x3f, 0x19, 0x1d, 0x4d, 0x2f, 0x00, 0x30,
+  0x17, 0x00, 0x0c, 0x0e, 0x82, 0x01, 0xce, 0xec, 0xc7, 0x1c, 0x14, 0x02, 0x40, 0xa2, 0x05, 0xdd,
+  0xfd, 0xce, 0x2c, 0x20, 0x91, 0x0c, 0x03, 0x14, 0x30, 0xc6, 0x02, 0xdb, 0xae, 0xa8, 0xe6, 0x5f,
+  0x65, 0x23, 0xc6, 0x02, 0xba, 0x02, 0xe6, 0x5f, 0x54, 0x6a, 0x01, 0xf5, 0x5e, 0xe4, 0x64, 0xf5,
+  0x0e, 0x00, 0x5e, 0x55, 0x02, 0x00, 0x7c, 0x01, 0xd2, 0x52, 0x0e, 0x56, 0x3d, 0x14, 0x6a, 0x11,
+  0x64, 0x21, 0x6e, 0x67, 0xfc, 0xce, 0x18, 0xcc, 0xb8, 0x7f, 0x3f, 0x2b, 0x42, 0x2b, 0xfd, 0xcd,
+  0xcb, 0x08, 0xb8, 0x8d, 0xbb, 0xfb, 0x11, 0xde, 0xbc, 0xca, 0x9f, 0x03, 0xa5, 0x95, 0x8d, 0x05,
+  0xec, 0xed, 0xcd, 0xcb, 0xdb, 0xbd, 0x1c, 0xca, 0xed, 0x92, 0x1f, 0x4c, 0x64, 0x81, 0x48, 0xcb,
+  0xac, 0xab, 0x00, 0xc8, 0x9f, 0x59, 0xf6, 0x9d, 0x58, 0xe6, 0x9c, 0x00, 0x47, 0xf6, 0x9f, 0x69,
+  0xc5, 0x8f, 0xee, 0xec, 0xf5, 0x4c, 0x04, 0xde, 0x06, 0x07, 0xcd, 0x91, 0x22, 0x73, 0x01, 0x64,
+  0x21, 0x02, 0x40, 0x0d, 0x51, 0x14, 0xee, 0x72, 0x11, 0x64, 0x01, 0xee, 0xff, 0xee, 0xef, 0x00,
+  0xdd, 0xca, 0x98, 0x96, 0x4a, 0x85, 0xc9, 0x6c, 0x00, 0xa7, 0xca, 0x6d, 0xa7, 0xca, 0x7d, 0xa7,
+  0xdb, 0x00, 0x7d, 0xb7, 0xdb, 0x8e, 0xc9, 0xed, 0xae, 0xea, 0x00, 0xca, 0x8c, 0x65, 0xd6, 0x6d,
+  0x65, 0x98, 0x47, 0x00, 0xe7, 0x8f, 0x8a, 0xf9, 0xcf, 0x9e, 0xfa, 0xfe, 0x62, 0xbf, 0x1c, 0x38,
+  0xec, 0xfd, 0xae, 0x6a, 0x21, 0x3d, 0x14, 0xc9, 0x04, 0xed, 0x8f, 0x43, 0xb4, 0x9e, 0xc8, 0xb6,
+  0x5b, 0x85, 0x0c, 0xec, 0x9d, 0x6a, 0x21, 0xd2, 0x12, 0xb8, 0xdb, 0x8d, 0xcb, 0xaa, 0xff, 0xdc,
+  0x20, 0xef, 0x46, 0x51, 0xff, 0xcc, 0x52, 0xef, 0x17, 0x00, 0x1f, 0xbc, 0x0f, 0x5e, 0x61, 0x0b,
+  0x20, 0x26, 0x60, 0x17, 0xc0, 0xea, 0x8e, 0x75, 0x18, 0xf6, 0x5e, 0x65, 0x02, 0x00, 0x4c, 0x11,
+  0x4f, 0x65, 0xe5, 0x80, 0x4e, 0x55, 0xf5, 0x4e, 0x65, 0xf5, 0x4e, 0x5b, 0x01, 0x7a, 0x55, 0x0e,
+  0x00, 0xf5, 0x73, 0x11, 0x02, 0x50, 0xd2, 0x12, 0x02, 0x10, 0xf6, 0x92, 0x7f, 0x67, 0x01, 0x66,
+  0xe5, 0xcc, 0x02, 0xcc, 0x99, 0x42, 0x3b, 0x21, 0x02, 0x10, 0xdd, 0xca, 0xb8, 0x8e, 0xc8, 0x01,
+  0xbc, 0xe9, 0x20, 0xbf, 0xce, 0xdb, 0xbc, 0xba, 0x33, 0x6b, 0xee, 0xde, 0x00, 0xcc, 0xdb, 0xaa,
+  0x98, 0xb9, 0x9d, 0xbb, 0xfc, 0x61, 0x4a, 0x08, 0xef, 0xde, 0xdb, 0xcb, 0x4f, 0x64, 0x13, 0x87,
+  0xdf, 0x00, 0xed, 0xb4, 0x5d, 0x58, 0xe5, 0x9f, 0x69, 0xe5, 0x00, 0x9d, 0x58, 0xe5, 0xaf, 0x69,
+  0xe5, 0x9c, 0x9b, 0x00, 0xfb, 0xee, 0x6c, 0xe6, 0xde, 0x7c, 0xea, 0xde, 0xe1, 0xf9, 0x0a, 0xce,
+  0xfc, 0xff, 0xce, 0x73, 0x11, 0xea, 0x29, 0x70, 0xb1, 0x00, 0xee, 0xfe, 0xee, 0xfe, 0xcb, 0xb9,
+  0x74, 0xb8, 0x00, 0x6a, 0x85, 0x87, 0x6a, 0xa9, 0xcb, 0xab, 0xba, 0x00, 0xa9, 0x88, 0x76, 0x75,
+  0x38, 0x63, 0x95, 0x49, 0x00, 0x53, 0x95, 0x49, 0x64, 0xa5, 0x4c, 0x65, 0xd6, 0x00, 0x5d, 0x65,
+  0xd6, 0x68, 0x74, 0x6e, 0x78, 0xf7, 0xc0, 0x9f, 0x8b, 0xf8, 0xcd, 0x9f, 0xeb, 0xb1, 0x01, 0x02,
+  0x20, 0xf1, 0x6a, 0x01, 0xeb, 0xca, 0x7f, 0x5e, 0x01, 0x3d, 0x14, 0xd2, 0x22, 0x02, 0x10, 0x63,
+  0x6a, 0x11, 0xd2, 0x22, 0xca, 0x7a, 0x54, 0xf2, 0x69, 0x6d, 0x11, 0x8c, 0xf0, 0xa7, 0xdd, 0xce,
+  0xff, 0x3d, 0x31, 0x05, 0x10, 0xcc, 0x62, 0xbe, 0x00, 0x9f, 0x64, 0xe1, 0x02, 0x30, 0x26, 0x00,
+  0x02, 0x30, 0x7c, 0x71, 0xef, 0xfe, 0xc9, 0x32, 0x0c, 0xf6, 0x4e, 0x02, 0x00, 0x34, 0x14, 0xe5,
+  0x5f, 0x54, 0xe5, 0x98, 0x5e, 0x54, 0xf5, 0x02, 0x00, 0x70, 0x01, 0x5e, 0x54, 0x6d, 0x11, 0x2d,
+  0xd5, 0x12, 0x56, 0x08, 0x10, 0x64, 0x11, 0x67, 0x3d, 0x34, 0xf5, 0x6e, 0x00, 0x56, 0xf9, 0xae,
+  0xcc, 0xb8, 0x8f, 0xdc, 0xfe, 0x0b, 0x0f, 0x3e, 0xc9, 0x02, 0x7e, 0x73, 0x0e, 0xab, 0xe6, 0x8f,
+  0x89, 0x20, 0xfd, 0xdc, 0xab, 0xdc, 0xbf, 0x0a, 0x47, 0xdc, 0xbb, 0x20, 0x98, 0xca, 0xaf, 0xdd,
+  0xec, 0x94, 0x0c, 0xde, 0xbd, 0x00, 0xe9, 0xce, 0x7b, 0xe6, 0xae, 0x7a, 0xfb, 0xdf, 0x30, 0xde,
+  0xb9, 0x9e, 0xdb, 0x49, 0x94, 0x4c, 0x14, 0xee, 0xdd, 0x00, 0xc4, 0x4c, 0x24, 0x92, 0x3d, 0x58,
+  0xd4, 0x7e, 0x00, 0x58, 0xf6, 0x9e, 0x69, 0xf6, 0xab, 0x68, 0xfd, 0x00, 0xee, 0x6d, 0xe6, 0xde,
+  0x6d, 0xe6, 0xdf, 0x6d, 0xc0, 0xf6, 0xef, 0x6e, 0xf9, 0xef, 0xbe, 0xa6, 0x0e, 0xb7, 0x0c, 0x38,
+  0xdc, 0xdd, 0xce, 0x14, 0x0d, 0x20, 0x07, 0xa6, 0x15, 0xed, 0xdd, 0x01, 0x41, 0x07, 0xed, 0xd9,
+  0x76, 0xb8, 0x5b, 0x65, 0x96, 0x06, 0x5e, 0x2b, 0x0f, 0x62, 0x09, 0xee, 0xa8, 0x7b, 0x85, 0xc6,
+  0x20, 0x5b, 0x55, 0xc5, 0x5c, 0x65, 0x02, 0x30, 0xd5, 0x6d, 0x00, 0x65, 0x96, 0x43, 0xd3, 0x4d,
+  0x34, 0xe4, 0x7d, 0x88, 0x6c, 0xc8, 0xfe, 0x34, 0x04, 0xcf, 0xeb, 0xfd, 0xd2, 0x12, 0x80, 0xec,
+  0xfd, 0x9c, 0xb8, 0xee, 0xcf, 0xfd, 0x84, 0x08, 0x64, 0xfd, 0x9f, 0xd8, 0x72, 0xfd, 0x8e, 0x40,
+  0x14, 0x43, 0x14, 0x8b, 0x48, 0x65, 0xdb, 0x7e, 0xef, 0x39, 0xb8, 0xdc, 0x6a, 0x21, 0xb9, 0xdc,
+  0x6e, 0xed, 0xba, 0x02, 0x3a, 0x11, 0x64, 0x31, 0xfe, 0x6d, 0x00, 0x46, 0x00, 0xcf, 0xd1, 0x04,
+  0x46, 0x21, 0x61, 0x51, 0x58, 0x21, 0xed, 0xcf, 0x40, 0x64, 0x1a, 0x50, 0xb3, 0xff, 0x32, 0x64,
+  0x11, 0x5e, 0x64, 0x02, 0x00, 0x4f, 0x01, 0xd5, 0x02, 0x20, 0x9d, 0x67, 0x31, 0xf6, 0x6a, 0x31,
+  0xd8, 0x02, 0x14, 0x00, 0x6e, 0x45, 0x13, 0x07, 0x35, 0xab, 0x15, 0x5f, 0x3a, 0x04, 0x56, 0x10,
+  0x07, 0xe9, 0x09, 0xec, 0xdc, 0x46, 0xa9, 0x74, 0x2f, 0x89, 0x04, 0xbb, 0xa8, 0x7e, 0xc9, 0x02,
+  0xab, 0x00, 0xe6, 0x8e, 0x67, 0xf8, 0xae, 0xcd, 0xca, 0xae, 0x41, 0x8f, 0x2f, 0xdf, 0xed, 0xed,
+  0xdb, 0x98, 0x24, 0x0f, 0xfb, 0x00, 0xde, 0x9b, 0xf6, 0xae, 0x69, 0xe5, 0xad, 0x5a, 0x01, 0x02,
+  0x00, 0xd5, 0xae, 0x5b, 0xe5, 0xaf, 0x9c, 0xfd, 0x10, 0xed, 0xbc, 0xcb, 0xaf, 0x2d, 0xbe, 0xde,
+  0xcb, 0xd4, 0x00, 0x5c, 0x34, 0xc3, 0x4c, 0x34, 0xc4, 0x5a, 0x35, 0x00, 0xe6, 0x9f, 0x5a, 0xf5,
+  0x9c, 0x58, 0xed, 0xfe, 0x00, 0x7e, 0xd5, 0xdd, 0x5e, 0xe5, 0xde, 0x6d, 0xf6, 0x04, 0xdf, 0x6e,
+  0x6a, 0x01, 0xe6, 0xee, 0x7d, 0xe8, 0xee, 0x00, 0xad, 0xdb, 0xec, 0xbe, 0xbb, 0xfb, 0xbe, 0xbb,
+  0x10, 0xfc, 0xbe, 0xdc, 0xee, 0xd8, 0x02, 0xde, 0xfe, 0xed, 0x00, 0xcc, 0x97, 0x4b, 0x75, 0xb4,
+  0x49, 0x76, 0xee, 0x00, 0xfd, 0xef, 0xcd, 0xfe, 0xef, 0xcb, 0xb9, 0x75, 0x00, 0xc7, 0x5b, 0x54,
+  0xb5, 0x5c, 0x54, 0xb5, 0x4c, 0x04, 0x55, 0xc5, 0x02, 0x00, 0x5c, 0x55, 0xc6, 0x5b, 0x64, 0xc0,
+  0x3b, 0x34, 0xd3, 0x4d, 0x47, 0xc5, 0xad, 0x09, 0xc8, 0x19, 0x20, 0x9e, 0xda, 0xfe, 0xcf, 0xfc,
+  0x34, 0x04, 0xfc, 0x9d, 0x02, 0xca, 0xd8, 0x02, 0xfb, 0x9f, 0xfc, 0xfd, 0xbe, 0xc9, 0x3f, 0xae,
+  0x05, 0x19, 0x07, 0xae, 0x05, 0x05, 0x00, 0x46, 0x14, 0xd2, 0x02, 0x9a, 0x85, 0x2a, 0xda, 0xb6,
+  0x2c, 0xdc, 0xce, 0x2c, 0xeb, 0x3d, 0x04, 0x8a, 0x85, 0x0c, 0xee, 0xfe, 0x8a, 0x0b, 0x11, 0x02,
+  0xdd, 0xaa, 0xb6, 0x57, 0xc0, 0x32, 0x43, 0x24, 0x88, 0xae, 0xff, 0x13, 0x37, 0x0f, 0x19, 0xf3,
+  0x4f, 0x31, 0x52, 0x21, 0xce, 0xeb, 0x18, 0x1e, 0xc8, 0x39, 0xcf, 0x32, 0x64, 0x11, 0x60, 0xfe,
+  0xff, 0xef, 0xfc, 0xff, 0x64, 0x11, 0x28, 0x14, 0x65, 0xa8, 0xe5, 0x5d, 0x55, 0x02, 0x00, 0xd5,
+  0x02, 0x00, 0x4d, 0xa7, 0x00, 0x20, 0x54, 0xc5, 0x4b, 0x54, 0xc5, 0xb6, 0x00, 0x4b, 0x55, 0x90,
+  0xa4, 0x5b, 0x45, 0xb5, 0x02, 0x00, 0x6c, 0x45, 0x16, 0x07, 0x43, 0x10, 0x37, 0xa5, 0x15, 0x6e,
+  0x67, 0xfd, 0xda, 0x7a, 0x0f, 0xdc, 0x00, 0xfd, 0xde, 0xcb, 0xa8, 0x8d, 0xcc, 0xdc, 0xcb, 0x00,
+  0xaa, 0x75, 0x56, 0x55, 0x75, 0x59, 0x77, 0xdc, 0x04, 0xdc, 0xaa, 0xdd, 0x39, 0xfe, 0xdd, 0xbb,
+  0xca, 0xaf, 0x10, 0xcd, 0xfa, 0xce, 0x69, 0x6f, 0x05, 0xe6, 0x9e, 0x5a, 0x02, 0xd5, 0x64, 0x01,
+  0xbe, 0x5a, 0xd5, 0xbd, 0x5a, 0xe6, 0x00, 0xbe, 0x5a, 0xe6, 0xaf, 0xce, 0xfc, 0xdb, 0x98, 0x06,
+  0xee, 0xe9, 0x49, 0xa2, 0x25, 0xed, 0xba, 0xe4, 0x5d, 0x24, 0x40, 0xc3, 0x4d, 0x34, 0xd5, 0x6d,
+  0x87, 0x40, 0x04, 0xe6, 0xa0, 0xad, 0x48, 0xeb, 0xde, 0x9e, 0x67, 0x21, 0x5d, 0x64, 0x01, 0x03,
+  0x02, 0x10, 0x70, 0x01, 0xed, 0x6e, 0xd5, 0xed, 0x6e, 0xd7, 0x00, 0xfc, 0xaf, 0xca, 0xeb, 0xbf,
+  0xcc, 0xed, 0xce, 0x00, 0xed, 0xdf, 0xef, 0xbb, 0xaa, 0x85, 0xb5, 0x4b, 0x90, 0x54, 0x95, 0x4e,
+  0xee, 0xf3, 0x1d, 0xfa, 0xa8, 0xd8, 0x02, 0x03, 0x0e, 0x00, 0x67, 0x11, 0x5c, 0x54, 0xb6, 0x5c,
+  0x54, 0xc6, 0x01, 0x67, 0x01, 0x54, 0x93, 0x3d, 0x33, 0xd3, 0x7a, 0x4d, 0x0e, 0xb8, 0xf1, 0x4d,
+  0x87, 0x05, 0xf5, 0x06, 0x9d, 0xb7, 0xa8, 0x5f, 0x20, 0xfc, 0xff, 0xde, 0xb9, 0xfe, 0xf2, 0x29,
+  0xfd, 0xad, 0xb2, 0xb8, 0x81, 0x18, 0x9d, 0xb8, 0x1c, 0x37, 0x87, 0x38, 0xca, 0xcf, 0x02, 0x0f,
+  0x7e, 0x18, 0xcf, 0x02, 0x38, 0x10, 0xbf, 0x0c, 0xaa, 0x9e, 0xee, 0xcd, 0x00, 0xd7, 0x78, 0x32,
+  0x44, 0x34, 0x63, 0x48, 0x34, 0xe0, 0xa3, 0x55, 0x34, 0x32, 0x4e, 0xce, 0x39, 0x18, 0x2e, 0xea,
+  0x12, 0xee, 0xfe, 0x55, 0x11, 0x28, 0x1d, 0x6e, 0x4f, 0xce, 0x3e, 0x02, 0x74, 0x0d, 0xc9, 0x35,
+  0x40, 0xfd, 0xff, 0xce, 0xfa, 0xef, 0xf6, 0xfb, 0x16, 0x64, 0x08, 0xe6, 0x5e, 0x54, 0x61, 0x01,
+  0xe5, 0x5c, 0x45, 0x94, 0x00, 0x45, 0x55, 0x45, 0x65, 0x66, 0x56, 0x56, 0x65, 0x08, 0x56, 0x66,
+  0x65, 0x05, 0x10, 0x64, 0x56, 0x46, 0x64, 0x20, 0x56, 0x45, 0x64, 0x66, 0x55, 0x08, 0x00, 0x67,
+  0x55, 0x16, 0xc5, 0x8a, 0x08, 0x3d, 0x14, 0x66, 0xd1, 0x09, 0xfc, 0xdb, 0x88, 0x89, 0x6b, 0x07,
+  0xb9, 0x8b, 0x12, 0x0a, 0xbb, 0x67, 0x65, 0x2f, 0x10, 0x30, 0x67, 0x6d, 0xdd, 0xba, 0xcc, 0x22,
+  0x62, 0x07, 0xca, 0x9e, 0x09, 0x46, 0x04, 0x8a, 0xe6, 0x64, 0x01, 0x9f, 0x5a, 0xe6, 0xac, 0x00,
+  0x59, 0xb5, 0x9a, 0x58, 0xa4, 0x89, 0x58, 0xa5, 0x00, 0x89, 0x59, 0xa5, 0x8a, 0x69, 0xb5, 0x8b,
+  0x68, 0x1c, 0xcb, 0xbe, 0x3d, 0x04, 0x48, 0x3b, 0x6a, 0x21, 0xed, 0xaa, 0xe4, 0x01, 0xcf, 0x02,
+  0x3c, 0x24, 0xd5, 0x5e, 0x88, 0xe8, 0x8e, 0x00, 0xcb, 0xb6, 0x7c, 0x58, 0xca, 0xbe, 0xae, 0xe6,
+  0x04, 0xed, 0x5d, 0x58, 0x01, 0xe7, 0xef, 0xae, 0xfc, 0xef, 0x01, 0x72, 0x1d, 0xe6, 0xde, 0x5e,
+  0xd6, 0xfd, 0x5e, 0xd5, 0x00, 0xed, 0x5e, 0xd5, 0xfd, 0x6e, 0xd7, 0xfd, 0xbe, 0x00, 0xed, 0xed,
+  0xdc, 0xa7, 0x5b, 0x55, 0xb5, 0x4a, 0x08, 0x44, 0xa9, 0x8e, 0xcc, 0x12, 0xa9, 0x8a, 0x85, 0x94,
+  0x38, 0x4b, 0x54, 0xb4, 0x67, 0x01, 0x02, 0x20, 0x21, 0x02, 0xc5, 0x5c, 0x00, 0x54, 0x76, 0x33,
+  0xc3, 0x3d, 0x35, 0x73, 0xda, 0x80, 0x7d, 0xb8, 0xdb, 0x7e, 0xb8, 0xd9, 0x7e, 0x80, 0x4c, 0x88,
+  0xa7, 0x5e, 0x98, 0x9c, 0x05, 0xec, 0x9d, 0x98, 0x5a, 0x3b, 0x00, 0xff, 0xdc, 0x86, 0xed, 0xaf,
+  0xda, 0xfd, 0x9c, 0x06, 0xa7, 0x7e, 0x18, 0xd8, 0x22, 0xfc, 0x9e, 0xc8, 0xda, 0x7e, 0x0b, 0xaa,
+  0x3c, 0x05, 0x20, 0x8d, 0x6a, 0x11, 0xca, 0x73, 0x23, 0x42, 0x00, 0x46, 0x35, 0x93, 0x4c, 0x35,
+  0xc3, 0x5c, 0x45, 0xe0, 0x93, 0x44, 0x24, 0x33, 0x4e, 0xb7, 0x22, 0x96, 0x0e, 0x9c, 0x00, 0x59,
+  0xcf, 0x52, 0xcf, 0xeb, 0x64, 0x01, 0x63, 0x4b, 0xbe, 0x3e, 0x02, 0xde, 0x3d, 0x93, 0x58, 0xfb,
+  0x2c, 0x10, 0x67, 0x01, 0x02, 0x00, 0x5d, 0x18, 0x5d, 0x54, 0x90, 0x94, 0x44, 0x66, 0x45, 0x58,
+  0x21, 0x56, 0x56, 0x6a, 0x01, 0xe4, 0x66, 0x66, 0x70, 0x01, 0x65, 0x66, 0x0e, 0x00, 0x02, 0x40,
+  0x7f, 0x21, 0x03, 0xd5, 0x02, 0x3a, 0x04, 0xe6, 0x7f, 0x56, 0xeb, 0xbd, 0xcc, 0x00, 0xa8, 0x7a,
+  0x99, 0xcd, 0xdb, 0xbc, 0x67, 0x76, 0x00, 0x65, 0x67, 0x67, 0x77, 0x78, 0x77, 0x87, 0xcc, 0x20,
+  0xdc, 0xbb, 0xdc, 0xbf, 0xdc, 0x64, 0x01, 0xfe, 0xdb, 0x40, 0x99, 0xcd, 0xcb, 0xbc, 0xd6, 0x8e,
+  0xc9, 0x02, 0x69, 0x78, 0xe6, 0x9a, 0x57, 0x47, 0x00, 0x56, 0x30, 0xaf, 0x01, 0xc4, 0x21, 0x66,
+  0x40, 0x56, 0x59, 0x99, 0xdd, 0xcb, 0xa9, 0x7b, 0x58, 0xee, 0x80, 0xfe, 0xdd, 0xaa, 0xd4, 0x5d,
+  0x34, 0xc2, 0xcf, 0x02, 0x90, 0x5e, 0x88, 0xe9, 0x8f, 0x2a, 0x1e, 0xb8, 0x9e, 0x28, 0x09, 0x08,
+  0x7e, 0xe8, 0xef, 0x1d, 0x0b, 0xbd, 0xba, 0xa7, 0x87, 0x70, 0x89, 0x8e, 0xce, 0xfc, 0x64, 0x21,
+  0x6a, 0x01, 0x02, 0x10, 0xfe, 0x00, 0x9e, 0xfd, 0xfa, 0x76, 0xb7, 0x5a, 0x44, 0xa5, 0x04, 0x4a,
+  0x44, 0x3f, 0x0e, 0xee, 0xfa, 0x97, 0xa8, 0x59, 0x46, 0x43, 0x5e, 0x01, 0x67, 0x01, 0xb4, 0x4b,
+  0x55, 0xd5, 0x42, 0x4a, 0x00, 0x54, 0x39, 0x23, 0xc3, 0x66, 0x2b, 0x96, 0xdb, 0x21, 0x81, 0x18,
+  0x76, 0xdb, 0x8e, 0xb8, 0x01, 0x04, 0xb9, 0x6d, 0x10, 0x87, 0xea, 0xac, 0xb9, 0xd5, 0x02, 0xb7,
+  0x5f, 0xb8, 0x01, 0xfb, 0x06, 0xfd, 0xbf, 0xfc, 0xfe, 0xbc, 0x87, 0xed, 0xde, 0xbf, 0xc8, 0x0c,
+  0xd5, 0x12, 0xec, 0x29, 0x02, 0x10, 0xcb, 0xcf, 0x32, 0x45, 0x4b, 0x01, 0xd5, 0x02, 0xb8, 0xdc,
+  0x87, 0x44, 0xc4, 0x5c, 0x44, 0x01, 0x64, 0x01, 0xc4, 0x4c, 0x34, 0x52, 0x34, 0x34, 0x55, 0x3c,
+  0x7e, 0xff, 0x4f, 0x31, 0x53, 0x1f, 0x60, 0x0b, 0x02, 0x20, 0xce, 0xea, 0x2b, 0xc5, 0x4c, 0x05,
+  0x10, 0xfd, 0x2e, 0x67, 0xff, 0xe0, 0x3c, 0xf6, 0x5f, 0x26, 0x64, 0x6a, 0x11, 0x9f, 0x05, 0x58,
+  0x55, 0x4c, 0x11, 0x66, 0x78, 0xe8, 0x8a, 0xac, 0xcd, 0xc9, 0x07, 0xff, 0xdb, 0x0a, 0x02, 0x00,
+  0xfb, 0x05, 0x04, 0xfd, 0xff, 0x01, 0x03, 0xcd, 0xea, 0xbb, 0x78, 0x96, 0x80, 0x66, 0x66, 0x55,
+  0x66, 0x66, 0x5c, 0x65, 0x21, 0x0e, 0x00, 0xd5, 0x7d, 0x56, 0x66, 0x6b, 0xbc, 0xcc, 0xcb, 0xc0,
+  0xcc, 0xab, 0xb8, 0x9a, 0xbc, 0xce, 0x20, 0x0c, 0x2c, 0x20, 0x04, 0xeb, 0x97, 0x99, 0x35, 0xca,
+  0x9c, 0xdd, 0xab, 0xb5, 0x90, 0x56, 0x56, 0x58, 0x88, 0x8b, 0x01, 0x87, 0x76, 0xaf, 0x51, 0x10,
+  0x75, 0x67, 0x56, 0x65, 0x02, 0x00, 0x66, 0x67, 0x66, 0x81, 0x02, 0x10, 0x99, 0x8c, 0xcd, 0xbb,
+  0xad, 0xcb, 0x78, 0x48, 0x01, 0x67, 0x01, 0x5c, 0x23, 0xd3, 0x4c, 0x34, 0xc5, 0x5e, 0x08, 0x88,
+  0xea, 0x9f, 0x79, 0x21, 0xdc, 0xb9, 0xdb, 0xde, 0x00, 0xdf, 0xec, 0xea, 0xaa, 0x57, 0x48, 0x97,
+  0x89, 0x00, 0x77, 0x85, 0x8a, 0x76, 0x85, 0xec, 0xde, 0xbf, 0x84, 0xd6, 0xee, 0xcc, 0x02, 0x5e,
+  0xd5, 0xee, 0x8f, 0xe0, 0x1d, 0x00, 0xe9, 0x74, 0xb5, 0x4a, 0x53, 0xb4, 0x49, 0x43, 0x00, 0xdc,
+  0xde, 0xef, 0xa9, 0x9a, 0x85, 0x95, 0x4b, 0x24, 0x54, 0xa4, 0x02, 0x20, 0xb5, 0x4b, 0x7c, 0x01,
+  0x43, 0x84, 0x00, 0x39, 0x43, 0xa5, 0x47, 0x63, 0x3c, 0x27, 0x63, 0x04, 0xa6, 0x4d, 0xe9, 0x19,
+  0xc7, 0x6d, 0xa7, 0xdb, 0x8d, 0x00, 0xb7, 0xdb, 0x79, 0x64, 0xb6, 0x5c, 0x98, 0xfd, 0x64, 0xdb,
+  0x97, 0x3d, 0x01, 0xd6, 0x5e, 0x90, 0x05, 0x01, 0x17, 0xdb, 0x08, 0x7d, 0x87, 0xdb, 0xd4, 0x0c,
+  0xdf, 0xeb, 0xdb, 0x8f, 0x7e, 0xda, 0x13, 0x67, 0xf0, 0x12, 0xb3, 0x1c, 0x45, 0x1b, 0x34, 0x04,
+  0x02, 0x00, 0xeb, 0x00, 0x8c, 0xb7, 0xb3, 0x4c, 0x35, 0xc4, 0x5d, 0x34, 0x00, 0xc4, 0x5c, 0x35,
+  0x43, 0x45, 0x24, 0x78, 0x9e, 0x33, 0x3d, 0x11, 0x02, 0x10, 0xfb, 0xdf, 0x37, 0x14, 0x3a, 0x24,
+  0xce, 0xea, 0x9f, 0x34, 0x44, 0x05, 0x10, 0x64, 0x51, 0x17, 0x00, 0xf9, 0x32, 0xe6, 0x4f, 0x67,
+  0x01, 0x40, 0x64, 0xf5, 0x5f, 0x65, 0x95, 0x45, 0x0d, 0x01, 0x67, 0x08, 0xbd, 0xdd, 0xef, 0x20,
+  0x0c, 0xea, 0x9f, 0x88, 0xe8, 0x20, 0x8f, 0x77, 0xf7, 0x6f, 0x77, 0x24, 0x0b, 0xe7, 0x7e, 0x40,
+  0x78, 0xd8, 0x8e, 0x88, 0xda, 0xbd, 0x46, 0x09, 0xff, 0x04, 0x9a, 0x96, 0x1f, 0x14, 0xc6, 0x6e,
+  0x88, 0xb7, 0x84, 0x41, 0xda, 0x02, 0x66, 0x77, 0x7b, 0xcc, 0xde, 0x0a, 0x0c, 0xc9, 0x00, 0xd9,
+  0x5c, 0x54, 0xb3, 0x3b, 0x3b, 0xda, 0xbc, 0x92, 0xbf, 0x7b, 0x28, 0xce, 0xcb, 0x2a, 0x00, 0x78,
+  0x94, 0x5e, 0x01, 0x80, 0x65, 0x77, 0x68, 0x77, 0x56, 0x55, 0x65, 0x26, 0x00, 0xec, 0xdd, 0xde,
+  0xac, 0x01, 0xaf, 0x11, 0xdf, 0xe7, 0x01, 0xc1, 0x31, 0xbc, 0x0d, 0x15, 0x24, 0x0d, 0xaf, 0x9f,
+  0x35, 0xa9, 0xcf, 0x12, 0x4c, 0x33, 0xd4, 0x10, 0x6e, 0x87, 0xeb, 0xaf, 0x1f, 0x47, 0xed, 0xb7,
+  0x97, 0x00, 0x57, 0x47, 0x97, 0x89, 0x78, 0x97, 0x89, 0x76, 0x00, 0x85, 0x8b, 0x78, 0xa7, 0x68,
+  0x6e, 0xce, 0xe9, 0x01, 0x64, 0x11, 0x6f, 0xeb, 0xfe, 0xce, 0xaa, 0xc7, 0x6c, 0x00, 0x99, 0xe8,
+  0x76, 0xa5, 0x4b, 0x44, 0xa4, 0x49, 0x00, 0x53, 0xec, 0xdd, 0xbd, 0xa7, 0x59, 0x74, 0xa4, 0x43,
+  0x5e, 0x01, 0x02, 0x00, 0x49, 0x43, 0x74, 0x39, 0xd8, 0x02, 0x44, 0x01, 0xd2, 0x12, 0x44, 0x83,
+  0x58, 0x3b, 0x64, 0xa8, 0x5c, 0x00, 0xa7, 0xda, 0x6c, 0x76, 0xc8, 0x6d, 0xa7, 0xda, 0x00, 0x7c,
+  0x96, 0xc7, 0x6e, 0x88, 0xdb, 0xab, 0x86, 0x00, 0xa7, 0x5b, 0xa6, 0xeb, 0x9a, 0x84, 0xd7, 0x6e,
+  0x2b, 0x1f, 0x04, 0x6a, 0x11, 0xb8, 0xcb, 0x00, 0x5e, 0x0d, 0x07, 0xda, 0xb8, 0xa0, 0x6f, 0xed,
+  0xfe, 0xbe, 0xda, 0x37, 0x34, 0xca, 0x37, 0x14, 0x1d, 0xa7, 0x0c, 0xc9, 0x04, 0x17, 0x42, 0x0b,
+  0x02, 0x20, 0x84, 0x3c, 0x45, 0x00, 0xc3, 0x4c, 0x45, 0xc3, 0x57, 0x23, 0x43, 0x44, 0xcc, 0x24,
+  0x66, 0xcf, 0x22, 0x52, 0x11, 0xfc, 0xee, 0x84, 0x08, 0xec, 0x09, 0xed, 0x02, 0x10, 0xea, 0x79,
+  0x11, 0xcf, 0x32, 0xcf, 0xf8, 0x29, 0xa3, 0x02, 0x85, 0x01, 0x67, 0xc9, 0x35, 0x67, 0x01, 0x6a,
+  0x11, 0x4d, 0x55, 0x75, 0x02, 0x3e, 0x00, 0xdd, 0x00, 0xde, 0x56, 0xe3, 0x4e, 0x44, 0xf3, 0x3f,
+  0x43, 0x00, 0xf4, 0x3e, 0x44, 0xf4, 0x3e, 0x43, 0xf4, 0x4e, 0x10, 0x43, 0xd3, 0x4e, 0x44, 0x11,
+  0x00, 0xe3, 0x4e, 0x34, 0x40, 0xe4, 0x4e, 0x99, 0xff, 0xeb, 0xcb, 0x3d, 0x01, 0x66, 0x04, 0x6c,
+  0xa9, 0xb7, 0x15, 0x68, 0x9a, 0xdf, 0xfd, 0xed, 0x00, 0x6c, 0x73, 0xb4, 0x3b, 0x44, 0xb3, 0x3b,
+  0x34, 0x40, 0xb4, 0x3b, 0x4c, 0xec, 0xba, 0x8f, 0x01, 0x07, 0xdd, 0x00, 0xfd, 0xca, 0x98, 0xce,
+  0xdb, 0xec, 0xde, 0xfd, 0x08, 0xed, 0x77, 0x76, 0xe4, 0x25, 0x68, 0x87, 0xef, 0xed, 0x10, 0xdf,
+  0xab, 0xf8, 0x8f, 0x7c, 0x2b, 0x5f, 0x56, 0xf5, 0x08, 0x6e, 0x66, 0xf6, 0x02, 0x00, 0x7f, 0x77,
+  0xe7, 0x8f, 0xa0, 0xbb, 0xfd, 0xef, 0xee, 0xeb, 0x4e, 0x2b, 0xdd, 0x9f, 0x05, 0x36, 0x23, 0x07,
+  0x07, 0xcf, 0x02, 0xec, 0x13, 0x0a, 0x79, 0x11, 0xdc, 0x49, 0x00, 0x31, 0xa0, 0x27, 0x27, 0x86,
+  0x89, 0x68, 0x97, 0x00, 0x68, 0x58, 0xa7, 0x9a, 0x78, 0xa6, 0x8a, 0x7a, 0x20, 0xa9, 0xea, 0xfe,
+  0x5e, 0xd7, 0x4b, 0x0b, 0xe7, 0x7c, 0x00, 0x97, 0xf7, 0x7c, 0xa9, 0xe8, 0x77, 0xb6, 0x5a, 0x00,
+  0x53, 0xa4, 0x49, 0x43, 0xdb, 0xc9, 0x76, 0xb8, 0x00, 0x59, 0x43, 0xb4, 0x4a, 0x53, 0x94, 0x49,
+  0x65, 0x18, 0xa9, 0x89, 0x74, 0x61, 0x01, 0xd5, 0x12, 0x49, 0x44, 0x75, 0x00, 0x33, 0x82, 0xb9,
+  0x59, 0x75, 0xc9, 0x6c, 0x96, 0x00, 0xc9, 0x6c, 0x55, 0xca, 0x6b, 0x85, 0xb9, 0x6c, 0x06, 0x87,
+  0xf9, 0x05, 0x13, 0x2d, 0x96, 0xeb, 0x8a, 0x64, 0xe9, 0x42, 0x7e, 0xf4, 0x4d, 0xc8, 0x6e, 0xbb,
+  0xea, 0x95, 0x0c, 0x8c, 0x90, 0xa7, 0xb7, 0x5d, 0xb8, 0xfb, 0x09, 0xfe, 0xcf, 0x7e, 0x18, 0x6c,
+  0xca, 0x7f, 0x37, 0x24, 0x99, 0x25, 0xeb, 0x05, 0x00, 0x02, 0x20, 0x86, 0x04, 0x5c, 0x34, 0xcf,
+  0x12, 0x54, 0x34, 0x52, 0x44, 0x34, 0xc8, 0x32, 0x4d, 0xef, 0x6e, 0x3f, 0xbe, 0xfc, 0x52, 0x00,
+  0xef, 0x19, 0xcd, 0x0a, 0x17, 0xdb, 0x79, 0x21, 0xcf, 0x22, 0xce, 0xfe, 0xdb, 0x00, 0x4c, 0x04,
+  0x91, 0x6a, 0x01, 0xfe, 0xce, 0xeb, 0x29, 0x10, 0xf6, 0x4e, 0xd4, 0x19, 0x18, 0xf6, 0x47, 0x65,
+  0x67, 0x01, 0x91, 0x0a, 0xf4, 0x4e, 0x44, 0x00, 0xf4, 0x3f, 0x43, 0xe4, 0x4f, 0x43, 0xe3, 0x4f,
+  0x00, 0x43, 0xf3, 0x3f, 0x44, 0xe4, 0x3f, 0x44, 0xe3, 0x08, 0x3e, 0x34, 0xe4, 0x02, 0x20, 0xf4,
+  0x3f, 0x44, 0xe6, 0x10, 0x6f, 0xfe, 0xab, 0xb6, 0x3d, 0x21, 0x55, 0x66, 0xab, 0x00, 0xbd, 0xef,
+  0x8d, 0x92, 0xb4, 0x3b, 0x43, 0xb3, 0x00, 0x4b, 0x33, 0xb4, 0x3c, 0x33, 0xb3, 0x4b, 0x4c, 0x08,
+  0xec, 0xaa, 0x8f, 0xe6, 0x19, 0xba, 0x8c, 0xed, 0x7c, 0x00, 0x83, 0xb4, 0x4b, 0x5c, 0xec, 0xef,
+  0xe8, 0x98, 0x01, 0x8a, 0x05, 0x67, 0x6e, 0xee, 0xcc, 0xf3, 0x4f, 0x44, 0x40, 0xf3, 0x4f, 0x34,
+  0xf3, 0x4f, 0x33, 0x05, 0x00, 0xf4, 0x18, 0x4f, 0x34, 0xe3, 0x0e, 0x00, 0xcb, 0x01, 0x4e, 0x33,
+  0xf4, 0x20, 0x4f, 0xbb, 0xfe, 0xef, 0xba, 0x39, 0x0e, 0xdd, 0xbb, 0x21, 0xcf, 0x42, 0x5e, 0x88,
+  0xfc, 0xbf, 0xb6, 0x1c, 0x9c, 0x81, 0x00, 0x91, 0x0a, 0x00, 0xa0, 0x0a, 0x01, 0x71, 0x79, 0x00,
+  0x68, 0x96, 0x8a, 0x68, 0xa7, 0x79, 0x66, 0x75, 0x00, 0x57, 0x5b, 0xaa, 0xea, 0xfe, 0x9e, 0xed,
+  0xfb, 0x00, 0xad, 0x77, 0xc9, 0x7f, 0x97, 0xd9, 0x8d, 0xa9, 0x00, 0xf8, 0x8a, 0xa7, 0x5a, 0x44,
+  0xa4, 0x3a, 0x44, 0x00, 0x86, 0x5a, 0x85, 0x96, 0x3a, 0x44, 0x94, 0x39, 0x00, 0x66, 0xec, 0xec,
+  0xbc, 0xa6, 0x5a, 0x54, 0xb4, 0x04, 0x4a, 0x44, 0x64, 0x01, 0x97, 0x69, 0x75, 0x88, 0x48, 0x00,
+  0x84, 0xb9, 0x6a, 0x74, 0xca, 0x6c, 0x97, 0xb6, 0x00, 0x5b, 0x75, 0xca, 0x6a, 0x86, 0xb8, 0x5c,
+  0x76, 0x03, 0x29, 0x03, 0xa3, 0x14, 0xdc, 0xa7, 0xca, 0x79, 0x54, 0xd9, 0x03, 0x67, 0x11, 0x89,
+  0x0c, 0xb8, 0xd8, 0x7f, 0xed, 0xfe, 0xdb, 0x41, 0xe4, 0x02, 0x85, 0xa6, 0x48, 0x63, 0x97, 0xd8,
+  0x02, 0x9f, 0x10, 0xec, 0xfe, 0xae, 0xc9, 0xcf, 0x22, 0xb8, 0xeb, 0x9e, 0x48, 0xc8, 0xdb, 0x8d,
+  0xd5, 0x15, 0xdb, 0x8e, 0x60, 0x0e, 0xb8, 0x00, 0xdb, 0x7b, 0x34, 0x93, 0x4b, 0x44, 0x92, 0x44,
+  0x80, 0x24, 0x53, 0x44, 0x24, 0x43, 0x4d, 0xde, 0x42, 0x08, 0x78, 0xad, 0xfb, 0xee, 0x60, 0x05,
+  0xc9, 0x02, 0x6a, 0x11, 0x5c, 0x0a, 0xed, 0x3e, 0xee, 0xd7, 0x09, 0xcf, 0x02, 0xe4, 0x02, 0xb1,
+  0x35, 0x17, 0x30, 0xdf, 0xec, 0xa2, 0xfe, 0xe7, 0x02, 0xe6, 0x4f, 0x74, 0x6a, 0x01, 0xe6, 0x9f,
+  0x06, 0xc0, 0x67, 0x87, 0xff, 0xff, 0x44, 0xf4, 0x5e, 0x01, 0xcf, 0x12, 0x37, 0xcc, 0x42, 0x08,
+  0x20, 0x6a, 0x01, 0x44, 0x76, 0x01, 0x7c, 0x01, 0xf4, 0x3f, 0x00, 0x88, 0xef, 0xe6, 0x77, 0x66,
+  0x55, 0x65, 0x66, 0x60, 0x6a, 0xba, 0xef, 0xe6, 0xc7, 0x64, 0x01, 0xcc, 0x12, 0x44, 0x00, 0xb3,
+  0x4b, 0x43, 0xc4, 0x4b, 0x3c, 0xec, 0xaa, 0x22, 0x9f, 0xe6, 0x19, 0xbd, 0xba, 0xda, 0x17, 0x00,
+  0x3c, 0x34, 0x00, 0xb4, 0xad, 0xaf, 0xff, 0x89, 0x85, 0x65, 0x88, 0xf0, 0x8e, 0xfe, 0x34, 0xf4,
+  0xa4, 0x01, 0x3c, 0x00, 0x6a, 0x01, 0x5b, 0x01, 0x31, 0x5e, 0x11, 0x33, 0xe4, 0x4f, 0x05, 0x00,
+  0x54, 0x00, 0x34, 0xe9, 0x80, 0xaf, 0xdd, 0xfb, 0xa9, 0xee, 0xdd, 0xbb, 0x6f, 0x18, 0x00, 0x4d,
+  0x34, 0xc4, 0x5e, 0x87, 0xec, 0xcf, 0xed, 0x10, 0xee, 0xd5, 0xa4, 0x1a, 0x64, 0x01, 0x00, 0xa0,
+  0x09, 0x00, 0x00, 0xa0, 0x08, 0x07, 0x96, 0x78, 0x66, 0x85, 0x11, 0x3d, 0x04, 0x68, 0x6f, 0xde,
+  0x69, 0x0c, 0x99, 0xb9, 0x7e, 0x00, 0x97, 0xf9, 0x8e, 0x87, 0xda, 0xae, 0xa9, 0xfa, 0x20, 0x9e,
+  0x76, 0x6b, 0x64, 0xa4, 0x8a, 0x05, 0x3a, 0x85, 0x00, 0x94, 0x39, 0x54, 0xdb, 0xdf, 0xdf, 0xec,
+  0xd9, 0x02, 0x75, 0x3a, 0x14, 0x3a, 0x44, 0x96, 0x4d, 0xcd, 0xa8, 0x00, 0x6b, 0x95, 0x66, 0x3b,
+  0x85, 0xb9, 0x6a, 0x85, 0x00, 0xc9, 0x6b, 0x85, 0x95, 0x3b, 0x86, 0xc9, 0x69, 0x80, 0x64, 0xb9,
+  0x6e, 0xb8, 0xba, 0x6d, 0xb9, 0xde, 0x18, 0x60, 0xec, 0x96, 0xb9, 0x6a, 0x64, 0x84, 0x08, 0x13,
+  0x14, 0x8b, 0x00, 0x86, 0xec, 0xbe, 0xdc, 0xfe, 0xee, 0xcb, 0xdb, 0x00, 0x7e, 0xc9, 0xeb, 0x8b,
+  0x55, 0xec, 0x8b, 0x85, 0x31, 0xc6, 0x12, 0x9f, 0xc9, 0xdc, 0x6c, 0x1b, 0xd7, 0x19, 0xeb, 0x8d,
+  0x1c, 0x86, 0xdb, 0xcc, 0x02, 0xb1, 0x08, 0xde, 0x05, 0x88, 0x44, 0xd7, 0x00, 0x99, 0x44, 0x42,
+  0x45, 0x34, 0x42, 0x44, 0x34, 0x80, 0x52, 0x4c, 0xdc, 0xef, 0xfc, 0xee, 0xde, 0x31, 0x09, 0xe7,
+  0x64, 0x01, 0x34, 0x24, 0x3d, 0x44, 0xed, 0xfe, 0xbf, 0x07, 0xc6, 0x32, 0x02, 0x30, 0x51, 0x1a,
+  0x40, 0xec, 0xee, 0xf7, 0x37, 0x04, 0x5e, 0x67, 0x01, 0x66, 0x60, 0x66, 0x5a, 0xaa, 0xef, 0xef,
+  0x61, 0x21, 0x52, 0x01, 0x3f, 0x1f, 0xbd, 0x02, 0xc0, 0x12, 0xcf, 0x12, 0x11, 0x00, 0x46, 0x04,
+  0x3f, 0x44, 0xf3, 0x41, 0x49, 0x04, 0x3f, 0x44, 0xed, 0xde, 0xed, 0xa5, 0x02, 0x9a, 0xd0, 0x9e,
+  0xfe, 0x8c, 0x84, 0x61, 0x11, 0x3c, 0x02, 0x00, 0xd2, 0x12, 0x00, 0xb3, 0x4b, 0x4a, 0xda, 0xcd,
+  0xbe, 0xcb, 0xfd, 0x60, 0xca, 0x97, 0xce, 0xc4, 0xc4, 0xe1, 0x02, 0x02, 0x10, 0x3a, 0x80, 0xda,
+  0xef, 0xe8, 0x88, 0x99, 0x9d, 0xde, 0xcc, 0x02, 0x97, 0x45, 0x20, 0x6a, 0x21, 0x02, 0x00, 0xe4,
+  0x05, 0x00, 0x4e, 0x34, 0x4e, 0x00, 0x65, 0x6c, 0x10, 0x4e, 0xba, 0x0f, 0xca, 0x9d, 0xa7, 0x0c,
+  0x07, 0x07, 0x24, 0x00, 0xd4, 0x5d, 0x87, 0xfc, 0xbd, 0xdc, 0x39, 0x20, 0x05, 0x64, 0x01, 0x90,
+  0x02, 0x20, 0xa0, 0x2a, 0x17, 0x83, 0x77, 0x02, 0x57, 0x67, 0x01, 0x96, 0xba, 0xaf, 0xdf, 0xec,
+  0xe8, 0x00, 0x8b, 0x98, 0xea, 0x8f, 0x98, 0xe8, 0x7c, 0xa9, 0x00, 0xea, 0x9f, 0xb9, 0xe9, 0x8e,
+  0x56, 0xa9, 0x75, 0x41, 0x6f, 0x08, 0x84, 0x29, 0x64, 0x96, 0x7e, 0x4e, 0x1f, 0x97, 0x02, 0x7b,
+  0x76, 0x11, 0xa4, 0x4a, 0x88, 0xfd, 0xfa, 0x87, 0x00, 0xb8, 0x5b, 0x96, 0xa7, 0x5b, 0x96, 0xb8,
+  0x5a, 0x00, 0x75, 0xb9, 0x6b, 0x64, 0x64, 0x2b, 0x95, 0x86, 0x80, 0x4a, 0x74, 0xb7, 0x5c, 0x96,
+  0xda, 0x8d, 0xd9, 0x0d, 0x00, 0xdc, 0xfe, 0xdb, 0x97, 0xa7, 0x5c, 0x98, 0xd9, 0x08, 0x7d, 0xb7,
+  0xdb, 0x3d, 0x01, 0x7b, 0x86, 0xfe, 0xda, 0xa0, 0x86, 0xdd, 0xbf, 0xed, 0xb9, 0xf5, 0x19, 0x76,
+  0x96, 0x35, 0x81, 0x4f, 0x04, 0xca, 0x7f, 0xea, 0xfe, 0xbe, 0xc9, 0x61, 0x11, 0x2c, 0x8d, 0x76,
+  0x13, 0x0a, 0x64, 0x01, 0xeb, 0x02, 0x00, 0x8a, 0x85, 0x08, 0xd7, 0xaa, 0x57, 0x64, 0x11, 0x44,
+  0x35, 0x42, 0x49, 0xfe, 0x9a, 0xfa, 0x47, 0x52, 0x31, 0x22, 0x54, 0x0b, 0x20, 0xde, 0x32, 0x0e,
+  0x15, 0xe4, 0x12, 0x01, 0x05, 0x50, 0xf6, 0x4e, 0x74, 0xf7, 0x4e, 0x64, 0xd6, 0xe1, 0x67, 0x01,
+  0x5c, 0xdd, 0xfc, 0xcf, 0x61, 0x01, 0x5b, 0x01, 0x74, 0x02, 0x3f, 0xcc, 0x12, 0xcf, 0x12, 0xc3,
+  0x12, 0xd2, 0x12, 0x64, 0x21, 0x86, 0x02, 0x43, 0xf5, 0x00, 0x5e, 0xff, 0x77, 0x76, 0x76, 0xff,
+  0xea, 0xda, 0x70, 0x3b, 0x33, 0xb4, 0x4c, 0x5e, 0x01, 0x37, 0x24, 0x02, 0x10, 0x34, 0x00, 0xc4,
+  0xce, 0xca, 0xba, 0xca, 0x9b, 0xcb, 0xad, 0x0a, 0xa4, 0xe4, 0x32, 0xc3, 0x20, 0x00, 0xbe, 0xae,
+  0xfe, 0xbb, 0xfc, 0xbc, 0xde, 0x55, 0x11, 0x61, 0x31, 0x02, 0x10, 0xdb, 0x02, 0x02, 0x30, 0x70,
+  0x21, 0x00, 0xe3, 0x3f, 0x34, 0xe8, 0x8f, 0xde, 0xfc, 0xbb, 0x04, 0xb3, 0x4d, 0x3f, 0x0b, 0x34,
+  0xd4, 0x5d, 0x77, 0xc9, 0x0c, 0x92, 0xa1, 0x61, 0x31, 0xcc, 0x02, 0x1a, 0x07, 0x84, 0xd8, 0x22,
+  0x7e, 0x51, 0x1b, 0x9a, 0x87, 0x86, 0x94, 0x03, 0x87, 0xba, 0x00, 0x8e, 0x98, 0xfa, 0x7e, 0x77,
+  0xca, 0x9e, 0xaa, 0x00, 0xea, 0x9f, 0x77, 0xc8, 0x7d, 0x87, 0xca, 0x78, 0x00, 0xa7, 0x4a, 0x54,
+  0x94, 0x38, 0x66, 0xfd, 0xff, 0x20, 0xaf, 0xfa, 0xed, 0xbd, 0x97, 0x64, 0x11, 0x43, 0xb9, 0x00,
+  0x9f, 0xdf, 0xa8, 0x8b, 0x85, 0xb8, 0x6b, 0x95, 0x00, 0xb8, 0x5a, 0x64, 0x94, 0x39, 0x64, 0xb9,
+  0x67, 0x00, 0x43, 0x74, 0x2a, 0x75, 0xc8, 0x5c, 0x85, 0x97, 0x00, 0x58, 0x9a, 0x9a, 0xca, 0x97,
+  0xdb, 0x8b, 0x96, 0x80, 0xee, 0xcb, 0x97, 0xb9, 0x7e, 0xdc, 0xb9, 0x19, 0x07, 0x89, 0xef, 0x09,
+  0x8d, 0xa9, 0x67, 0x01, 0xca, 0x7d, 0xb9, 0x8c, 0x0b, 0x39, 0x52, 0x01, 0x96, 0x4e, 0xd1, 0x0c,
+  0xf8, 0x26, 0xed, 0x02, 0x8e, 0xd9, 0xd4, 0xfd, 0xae, 0x8d, 0x08, 0x76, 0x7e, 0x1b, 0x7c, 0x19,
+  0x0a, 0x05, 0x10, 0x18, 0xd8, 0x94, 0x35, 0x34, 0x04, 0x02, 0x10, 0x46, 0x67, 0xef, 0x7f, 0x81,
+  0x25, 0x61, 0x71, 0x73, 0x31, 0x5b, 0x61, 0xcc, 0x62, 0x3d, 0x14, 0x0b, 0x10, 0xf7, 0x00, 0x4f,
+  0x75, 0xe6, 0x4e, 0x74, 0xd6, 0x46, 0x65, 0xe0, 0x56, 0x6d, 0xed, 0xfb, 0xbf, 0x7a, 0x02, 0x5e,
+  0x41, 0x6b, 0x02, 0x1f, 0x83, 0x12, 0x61, 0x21, 0x77, 0x12, 0xdb, 0x22, 0x05, 0x20, 0xdd, 0xde,
+  0xda, 0xe0, 0xaa, 0xef, 0xe3, 0xb3, 0x4c, 0x61, 0x01, 0x02, 0x20, 0x08, 0x20, 0x02, 0xc3, 0x08,
+  0x00, 0x6c, 0x6b, 0xeb, 0xce, 0xcc, 0xec, 0x0c, 0x5c, 0x53, 0x76, 0x01, 0xd2, 0x52, 0x4d, 0xfd,
+  0xef, 0xec, 0xfe, 0xcf, 0x3f, 0x10, 0x4b, 0x00, 0x3f, 0x30, 0xab, 0x25, 0xe1, 0x42, 0x6c, 0x10,
+  0x79, 0x11, 0x20, 0x77, 0xff, 0xff, 0x94, 0x59, 0x07, 0x17, 0xd4, 0x5a, 0x44, 0x64, 0x19, 0x31,
+  0x54, 0x0a, 0x03, 0x91, 0x21, 0x08, 0xe8, 0x02, 0x7e, 0x28, 0x27, 0xdf, 0xee, 0x9a, 0xa6, 0x8b,
+  0x89, 0x20, 0xea, 0x9f, 0x98, 0xe8, 0x7d, 0xcc, 0x02, 0xa9, 0xe7, 0x00, 0x6c, 0x97, 0xe8, 0x7d,
+  0xca, 0xde, 0xdf, 0xa7, 0x00, 0x7a, 0x74, 0xa4, 0x49, 0x76, 0xfc, 0xfe, 0x8e, 0x03, 0xc3, 0x02,
+  0xdb, 0x02, 0xa4, 0x3a, 0x88, 0xfd, 0xfd, 0xac, 0x41, 0x6c, 0x05, 0xb9, 0x5a, 0x75, 0x74, 0x2a,
+  0xa8, 0x05, 0x53, 0x00, 0xb8, 0x5a, 0x43, 0x85, 0x3b, 0x96, 0xc8, 0x69, 0x00, 0x75, 0x9a, 0xca,
+  0xbd, 0x9b, 0xc9, 0xbd, 0x99, 0x00, 0x9d, 0xb8, 0xba, 0x8d, 0xcb, 0xba, 0x8f, 0xed, 0x12, 0xb8,
+  0x3a, 0x11, 0xa7, 0xca, 0xde, 0x02, 0xed, 0xcb, 0xc9, 0x00, 0x6e, 0xc8, 0xb9, 0x6b, 0x97, 0xca,
+  0x7c, 0x86, 0xf8, 0x96, 0x4c, 0xa7, 0xf2, 0x09, 0x4f, 0x04, 0x5b, 0x01, 0x08, 0x00, 0xc6, 0x12,
+  0x00, 0x8c, 0x66, 0xc9, 0x6d, 0xb7, 0xdb, 0x8b, 0x95, 0x41, 0x37, 0x14, 0x8d, 0xa7, 0xb7, 0x74,
+  0x24, 0xd4, 0x09, 0x43, 0xf9, 0x3a, 0x04, 0x43, 0x35, 0x35, 0x49, 0x02, 0x60, 0xfa, 0x2d, 0x11,
+  0xa0, 0x02, 0x30, 0x03, 0x1f, 0x07, 0x08, 0x20, 0xe7, 0x4e, 0x75, 0xe6, 0x4d, 0x64, 0xc2, 0xc6,
+  0xcf, 0x02, 0x5e, 0xee, 0xfa, 0xae, 0x66, 0x18, 0xfe, 0x36, 0x24, 0xe4, 0x4e, 0x90, 0x05, 0x55,
+  0xe5, 0x5a, 0x0b, 0x6f, 0x54, 0x07, 0xc6, 0x02, 0x50, 0x15, 0x5c, 0x35, 0x4e, 0x66, 0xef, 0xee,
+  0xff, 0xc8, 0x9d, 0x94, 0xb4, 0x63, 0x18, 0x34, 0xb4, 0x87, 0x05, 0x08, 0x10, 0x00, 0x33, 0xb4,
+  0x5c, 0x56, 0xc7, 0x7d, 0x77, 0xc7, 0x1c, 0x6c, 0x64, 0x0e, 0x00, 0xb4, 0x45, 0x02, 0x10, 0x4c,
+  0xec, 0xef, 0x0c, 0xfc, 0xce, 0xcf, 0x42, 0x04, 0x27, 0x66, 0xf7, 0x7f, 0x67, 0x78, 0xe6, 0x6f,
+  0x45, 0xc6, 0x02, 0xa5, 0x05, 0x17, 0x10, 0x1a, 0x20, 0xee, 0x00, 0xef, 0xb9, 0x9a, 0x66, 0x93,
+  0x3c, 0x24, 0xb3, 0x46, 0x32, 0xfe, 0x06, 0x31, 0x44, 0x68, 0x3e, 0x87, 0x4f, 0x0a, 0xea, 0x01,
+  0xbc, 0x16, 0xee, 0xff, 0xde, 0xdd, 0x47, 0xb2, 0x7d, 0x00, 0x26, 0xa5, 0x7a, 0x79, 0xc9, 0xbe,
+  0xac, 0xe9, 0x80, 0x9e, 0x76, 0xc9, 0x8e, 0x97, 0xea, 0xac, 0x1c, 0x08, 0x00, 0xdb, 0xc7, 0x53,
+  0x96, 0x49, 0x43, 0xba, 0xbf, 0x10, 0xdf, 0xfc, 0xf9, 0x75, 0xcc, 0x02, 0x96, 0x6f, 0xdf, 0x10,
+  0xfd, 0xf9, 0x75, 0xb8, 0x19, 0x07, 0x49, 0x43, 0x94, 0x00, 0x3a, 0x53, 0xa4, 0x47, 0x42, 0x86,
+  0x3a, 0x54, 0x00, 0x96, 0x4b, 0x85, 0xc9, 0x69, 0xaa, 0xab, 0xda, 0x00, 0xcd, 0xab, 0xd6, 0x89,
+  0x67, 0x98, 0x99, 0xca, 0x04, 0x7e, 0xdc, 0x79, 0x07, 0xed, 0xcb, 0x85, 0xca, 0x7c, 0x00, 0xa7,
+  0xa8, 0x5f, 0xed, 0xdd, 0xcc, 0x96, 0xb8, 0x04, 0x6b, 0x96, 0x21, 0x0b, 0xa8, 0x5b, 0x96, 0xa8,
+  0x5a, 0xb2, 0x74, 0xf5, 0x26, 0xb8, 0xca, 0xbd, 0x02, 0x02, 0x40, 0x65, 0x87, 0x08, 0x40, 0xda,
+  0x7b, 0x96, 0xda, 0x7d, 0xb7, 0x02, 0x00, 0x64, 0x04, 0x35, 0x25, 0x67, 0x11, 0x54, 0x24, 0x53,
+  0x43, 0x24, 0xff, 0x31, 0x64, 0xae, 0x02, 0xa0, 0x00, 0x00, 0x30, 0xcc, 0x32, 0x93, 0x45, 0xab,
+  0x65, 0x29, 0x20, 0x80, 0xe7, 0x5d, 0x64, 0xd7, 0x5d, 0x64, 0xc6, 0xcf, 0x32, 0x86, 0xaf, 0x8d,
+  0x35, 0x63, 0x18, 0xe3, 0x4e, 0x88, 0xde, 0x66, 0x0b, 0xe1, 0x3b, 0x00, 0xef, 0xff, 0xf6, 0x6f,
+  0x04, 0x27, 0x84, 0x08, 0xe0, 0x19, 0x30, 0x45, 0xef, 0xfd, 0xee, 0x90, 0x05, 0xcf, 0x62, 0x4b,
+  0x43, 0x90, 0xb4, 0x6c, 0x7c, 0xee, 0xcd, 0x4f, 0xfb, 0xeb, 0xcf, 0x02, 0x0a, 0x4c, 0xcc, 0x12,
+  0xc4, 0x7c, 0x11, 0x7d, 0xef, 0xde, 0xfb, 0xa1, 0xcf, 0x62, 0x4f, 0x44, 0xe9, 0x9f, 0x22, 0x00,
+  0xee, 0x48, 0x0b, 0x13, 0x14, 0x10, 0x61, 0x11, 0x33, 0xf3, 0x3c, 0x13, 0x44, 0xfa, 0xaf, 0x00,
+  0xdc, 0xca, 0x56, 0x95, 0x68, 0x44, 0x38, 0x13, 0xc1, 0x64, 0x41, 0x1a, 0x08, 0x84, 0xe8, 0x8e,
+  0xcc, 0x02, 0xc8, 0x0c, 0x01, 0xe6, 0x19, 0xed, 0xd4, 0x8b, 0x27, 0xd2, 0x7c, 0x27, 0x00, 0xd1,
+  0x7c, 0x26, 0xb3, 0x7a, 0x8a, 0xd7, 0x8b, 0x00, 0x9b, 0xf9, 0xae, 0x89, 0xce, 0xdf, 0xe9, 0xee,
+  0x00, 0xbf, 0xa8, 0x9a, 0x85, 0x86, 0x59, 0x75, 0x74, 0x00, 0x2c, 0xac, 0xdc, 0xd9, 0x54, 0xa4,
+  0x39, 0x43, 0x00, 0xdc, 0xdf, 0xcf, 0xba, 0xba, 0x75, 0xa8, 0x58, 0x01, 0xef, 0x19, 0xa4, 0x4a,
+  0x44, 0x74, 0x28, 0x33, 0x84, 0x04, 0x2a, 0x44, 0xcf, 0x02, 0xb8, 0x5c, 0xde, 0xcd, 0xec, 0x00,
+  0xcd, 0x79, 0xa3, 0x57, 0x25, 0x83, 0x57, 0x99, 0x00, 0x7d, 0xcb, 0xed, 0xcf, 0xed, 0xfe, 0xeb,
+  0xa8, 0x00, 0xc9, 0x6c, 0xa7, 0xb9, 0x8f, 0xed, 0xb9, 0x68, 0x80, 0x89, 0x9b, 0xca, 0xbd, 0x99,
+  0xa9, 0x98, 0x6a, 0x01, 0x10, 0xb9, 0x6a, 0x54, 0xca, 0xb7, 0x25, 0xca, 0x6d, 0xb7, 0x04, 0xda,
+  0x8d, 0x58, 0x01, 0xb8, 0xda, 0x7c, 0x55, 0xa7, 0xc6, 0x5d, 0xf9, 0x22, 0x64, 0x14, 0xa7, 0x87,
+  0x44, 0x04, 0x27, 0x05, 0x10, 0xa4, 0x24, 0xee, 0xb1, 0x52, 0xdf, 0xed, 0xbe, 0x1f, 0xef, 0x2b,
+  0x01, 0x47, 0xc6, 0x92, 0x64, 0x01, 0x86, 0x2f, 0xbe, 0xfd, 0xee, 0x11, 0x30, 0xd7, 0x40, 0x4e,
+  0x75, 0xd7, 0x5c, 0x65, 0xa5, 0xcf, 0x02, 0x6e, 0xb8, 0xee, 0xea, 0xaf, 0x4c, 0x01, 0x84, 0x15,
+  0x4f, 0x11, 0x4d, 0x59, 0x1c, 0x3c, 0xee, 0xef, 0x67, 0x11, 0x87, 0x08, 0x3d, 0x14, 0x75, 0x08,
+  0x4e, 0x33, 0x48, 0xd4, 0x4e, 0x44, 0x9b, 0x0c, 0x3c, 0x44, 0xcc, 0x62, 0xc4, 0x68, 0x3b, 0x39,
+  0xda, 0x83, 0x2c, 0xff, 0x97, 0x11, 0x2f, 0x00, 0xe7, 0x22, 0xc7, 0xd2, 0x42, 0x45, 0xb6, 0xdf,
+  0x98, 0x0c, 0xfb, 0xcf, 0xc3, 0xce, 0x09, 0x28, 0x34, 0x34, 0xfb, 0xcf, 0xff, 0x85, 0x0c, 0x14,
+  0x00, 0x0f, 0x60, 0x0e, 0xe6, 0x19, 0x44, 0x0a, 0xa5, 0x25, 0xe7, 0x7f, 0xff, 0xf9, 0x80, 0x55,
+  0x95, 0x64, 0x83, 0x8a, 0x66, 0x81, 0x31, 0x14, 0x84, 0x02, 0xa1, 0x3e, 0x0c, 0xe8, 0x8e, 0x87,
+  0xeb, 0x4b, 0x1b, 0x00, 0xfd, 0xfe, 0xee, 0xed, 0x58, 0xb2, 0x8d, 0x27, 0x00, 0xc1, 0x7c, 0x27,
+  0xc2, 0x7d, 0x27, 0xc4, 0x8d, 0xc0, 0x87, 0x88, 0x78, 0x89, 0xc8, 0x9b, 0xbb, 0x00, 0x83, 0x01,
+  0x00, 0xb8, 0x8a, 0x85, 0x96, 0x4e, 0xce, 0xba, 0xb7, 0x00, 0x54, 0xca, 0xa9, 0x54, 0xa4, 0x3a,
+  0x89, 0xfd, 0x00, 0xff, 0xdf, 0xa7, 0x6a, 0x85, 0x85, 0x3a, 0x43, 0x00, 0xa4, 0x48, 0x42, 0xa4,
+  0x38, 0x43, 0x84, 0x29, 0x08, 0x43, 0x94, 0x39, 0x37, 0x04, 0x85, 0xb9, 0x8e, 0xff, 0x00, 0xee,
+  0xf8, 0x9a, 0xbc, 0xc8, 0xab, 0x37, 0xa4, 0x10, 0x79, 0x46, 0x8e, 0xdc, 0x88, 0x34, 0xb9, 0x6c,
+  0x96, 0x00, 0xdc, 0xac, 0xba, 0xab, 0xba, 0xbd, 0xab, 0xd9, 0x81, 0x02, 0x10, 0x9a, 0xbb, 0xa7,
+  0xdb, 0x8b, 0x54, 0x25, 0x04, 0x87, 0xb7, 0x05, 0x55, 0x11, 0x02, 0x20, 0xc7, 0x6c, 0x65, 0xb8,
+  0x11, 0x10, 0x90, 0xb7, 0xb8, 0x5d, 0xb7, 0x14, 0x00, 0xb9, 0x65, 0x37, 0x24, 0x15, 0xa2, 0x15,
+  0x34, 0x67, 0x61, 0xef, 0x75, 0x00, 0xfd, 0xff, 0xcf, 0xe8, 0xfa, 0xdf, 0xce, 0x9f, 0x95, 0xec,
+  0x4b, 0x4b, 0xe6, 0x09, 0xe0, 0x19, 0x01, 0x37, 0x04, 0x5d, 0x75, 0xd7, 0x4c, 0x65, 0xa6, 0x45,
+  0xc0, 0x56, 0x66, 0x5e, 0xfe, 0xf9, 0x9f, 0x44, 0x25, 0x30, 0x3b, 0xea, 0x4d, 0x0d, 0x11, 0xdf,
+  0x10, 0x43, 0xaa, 0x85, 0x09, 0x17, 0x10, 0xad, 0x1c, 0x10, 0x44, 0xde, 0xf9, 0xdb, 0x1c, 0x74,
+  0x34, 0xb4, 0x8d, 0x9e, 0x9d, 0x91, 0x21, 0x67, 0x21, 0x46, 0x01, 0x02, 0x00, 0x9d, 0x83, 0xd2,
+  0x12, 0xc4, 0x5c, 0x6d, 0x41, 0x10, 0xde, 0xfa, 0xbf, 0xce, 0x09, 0xb4, 0x12, 0x99, 0x55, 0x01,
+  0xfc, 0xce, 0x05, 0x0e, 0x94, 0x41, 0xf5, 0x6f, 0xe0, 0x19, 0x01, 0xe6, 0x29, 0x34, 0xf6, 0x6e,
+  0xef, 0xfa, 0xa9, 0x37, 0x00, 0x27, 0xa5, 0xcc, 0x7d, 0xc7, 0x58, 0x21, 0x91, 0x90, 0x39, 0x1c,
+  0x87, 0xe8, 0xfe, 0x06, 0x7e, 0xaa, 0x18, 0x3e, 0x40, 0xfe, 0xd6, 0x9b, 0x37, 0xd2, 0x7d, 0x64,
+  0x11, 0xc2, 0x10, 0x7c, 0x38, 0xd9, 0x78, 0x17, 0x00, 0xfe, 0xdb, 0xbb, 0x08, 0xba, 0xad, 0xdd,
+  0xcd, 0x00, 0xa9, 0x8a, 0x85, 0xa7, 0x04, 0x5b, 0x98, 0xe8, 0x00, 0xdb, 0xc9, 0x54, 0x84, 0x3e,
+  0xe4, 0xcd, 0xea, 0x75, 0x08, 0x58, 0x43, 0x54, 0x0b, 0x64, 0x01, 0x61, 0x01, 0x00, 0x94, 0x38,
+  0x43, 0xa4, 0x39, 0x53, 0xa5, 0x47, 0x00, 0x43, 0xba, 0x8f, 0xff, 0xff, 0xf5, 0x78, 0x48, 0x80,
+  0x94, 0x8b, 0x58, 0xa4, 0x8a, 0x36, 0x8e, 0x45, 0x2b, 0x00, 0xdf, 0xee, 0xee, 0xdb, 0x86, 0xdc,
+  0xbc, 0xde, 0x00, 0xbc, 0xeb, 0xcd, 0xbd, 0xd9, 0xab, 0x57, 0x86, 0x02, 0x79, 0xbd, 0x05, 0xca,
+  0x7a, 0x85, 0x96, 0x4d, 0xa7, 0x8d, 0x25, 0x04, 0xca, 0x25, 0x27, 0x58, 0x01, 0xc6, 0x5a, 0x53,
+  0x05, 0x00, 0x09, 0x61, 0x04, 0x97, 0x4c, 0x51, 0x0e, 0xa7, 0xda, 0x75, 0x33, 0xe5, 0x67, 0x11,
+  0x55, 0x6a, 0x11, 0xdd, 0xdf, 0xc0, 0x12, 0x1a, 0x01, 0x64, 0x01, 0x62, 0xde, 0x4b, 0x0b, 0xfa,
+  0xef, 0xbe, 0x81, 0x68, 0x02, 0x00, 0xeb, 0x2e, 0xee, 0x98, 0x3f, 0xb3, 0x0c, 0x3a, 0x34, 0xd8,
+  0x67, 0x01, 0x5c, 0x74, 0x42, 0x95, 0x3f, 0x0b, 0x6f, 0xff, 0xe8, 0x8f, 0x60, 0x28, 0x4e, 0x9e,
+  0x33, 0x4f, 0x11, 0x67, 0x21, 0x49, 0x00, 0xa2, 0x12, 0xef, 0xee, 0xe6, 0x19, 0x09, 0xb1, 0x05,
+  0x4e, 0x33, 0x1e, 0x0e, 0xdf, 0xf6, 0xc7, 0x3b, 0xe2, 0x44, 0xcc, 0x52, 0x35, 0xc5, 0xef, 0x9f,
+  0x22, 0x52, 0x11, 0x67, 0x14, 0x81, 0x7a, 0x00, 0xfe, 0xff, 0xfa, 0xea, 0x6c, 0x6a, 0xe4, 0x52,
+  0xce, 0xfa, 0xcf, 0x02, 0x3c, 0x10, 0x29, 0x1a, 0xfc, 0xcf, 0xdb, 0x05, 0x80, 0x4f, 0x0c, 0xf5,
+  0x5f, 0x7f, 0x01, 0x13, 0x27, 0x3e, 0x44, 0xf8, 0x8f, 0x00, 0xee, 0xe4, 0x84, 0x38, 0x3a, 0x94,
+  0xcc, 0x6c, 0x80, 0xc7, 0x8a, 0x57, 0xc7, 0x89, 0x7b, 0x76, 0x67, 0x01, 0x86, 0xea, 0xbf, 0x0c,
+  0xaa, 0x17, 0xed, 0x8a, 0xb3, 0x7d, 0x31, 0x04, 0x01, 0x64, 0x01, 0x27, 0xd3, 0x8d, 0x97, 0x8e,
+  0x88, 0xe9, 0x02, 0x9f, 0x98, 0x2f, 0xde, 0xdc, 0xb9, 0x8c, 0xcb, 0xa9, 0x00, 0xaa, 0x74, 0xa8,
+  0x58, 0x64, 0xed, 0xef, 0xef, 0x00, 0xdc, 0xd9, 0x53, 0x84, 0x4f, 0xdf, 0xf9, 0xfe, 0x0a, 0xdf,
+  0x99, 0x05, 0xa4, 0xcf, 0x02, 0x38, 0x33, 0x94, 0x3a, 0x04, 0x43, 0x83, 0x6a, 0x01, 0x39, 0x64,
+  0xa4, 0x48, 0x53, 0x02, 0xcb, 0xae, 0x04, 0xf5, 0x9a, 0x5a, 0xc5, 0xbc, 0x95, 0x20, 0x56, 0x63,
+  0x37, 0x6e, 0xec, 0x56, 0x30, 0xfe, 0xda, 0x00, 0x97, 0xdd, 0xcd, 0xde, 0xde, 0xee, 0xef, 0x67,
+  0x00, 0x9b, 0xcc, 0x24, 0x72, 0x57, 0x24, 0x6a, 0xbd, 0x00, 0x99, 0xad, 0xc8, 0x95, 0x3c, 0xa7,
+  0xca, 0x7a, 0x8e, 0x74, 0x58, 0x01, 0x02, 0x00, 0xaa, 0x0f, 0xc5, 0x5a, 0x85, 0x73, 0x01, 0x91,
+  0x6a, 0x01, 0x97, 0x4c, 0xa6, 0x70, 0x11, 0x69, 0x54, 0x37, 0x04, 0x21, 0x3a, 0x14, 0x54, 0x34,
+  0xbb, 0xbf, 0xe9, 0x33, 0xff, 0xdf, 0x5f, 0x68, 0x2f, 0x55, 0x11, 0x67, 0xa1, 0xcf, 0x02, 0x83,
+  0x4f, 0xde, 0x17, 0x20, 0xe8, 0x01, 0x67, 0x11, 0x75, 0x95, 0x45, 0x66, 0x56, 0x5f, 0xff, 0x0c,
+  0xf7, 0x6f, 0xcf, 0x12, 0x4d, 0x15, 0x4d, 0x43, 0xe3, 0x4d, 0x7b, 0x78, 0x12, 0x37, 0x11, 0xfe,
+  0xa6, 0x12, 0xcf, 0x02, 0xfa, 0x13, 0x83, 0x2f, 0xde, 0x86, 0xf3, 0x04, 0x47, 0x02, 0x10, 0x49,
+  0xd9, 0xef, 0xed, 0xa2, 0x52, 0xff, 0xcf, 0x32, 0x2f, 0x00, 0x02, 0x20, 0x7f, 0x01, 0x11, 0x00,
+  0x67, 0x11, 0x54, 0x18, 0x54, 0x00, 0xf0, 0x4f, 0x44, 0xfd, 0xde, 0x4f, 0x00, 0xfc, 0x42, 0x7c,
+  0x11, 0x7f, 0x31, 0x01, 0x17, 0x00, 0xdf, 0x9b, 0x93, 0x93, 0x39, 0x33, 0x83, 0x00, 0x7a, 0x5a,
+  0xb6, 0x6b, 0x7b, 0xcb, 0x7a, 0x67, 0x10, 0xd6, 0x58, 0x4a, 0x86, 0x99, 0x25, 0xfd, 0xfe, 0xeb,
+  0x0c, 0xbb, 0x38, 0x99, 0x05, 0xcc, 0x12, 0x7d, 0x38, 0xd9, 0x77, 0x0d, 0x4c, 0x04, 0xfd, 0xb1,
+  0x25, 0x19, 0x25, 0xee, 0xdd, 0xba, 0x86, 0x10, 0xa7, 0x5a, 0x74, 0xa9, 0xa2, 0x02, 0xf8, 0x53,
+  0x96, 0xc0, 0x6f, 0xef, 0xe9, 0xff, 0xdf, 0x86, 0x67, 0x01, 0x04, 0x07, 0x04, 0x37, 0x42, 0xd5,
+  0x02, 0x94, 0x38, 0x32, 0x85, 0x3a, 0x00, 0x54, 0xa4, 0x38, 0x54, 0xdc, 0xbf, 0xff, 0xff, 0x00,
+  0xf7, 0x9a, 0x5b, 0xc4, 0xa6, 0xb7, 0x58, 0x64, 0x4c, 0x4a, 0x4e, 0xb7, 0x26, 0xa9, 0x01, 0xee,
+  0xdc, 0x93, 0x02, 0xff, 0x00, 0xfa, 0xbb, 0x25, 0x7d, 0xde, 0x48, 0x94, 0x69, 0x40, 0x37, 0x98,
+  0x9b, 0xbc, 0xdc, 0xb8, 0x10, 0x0a, 0xca, 0x10, 0x79, 0x74, 0xca, 0x7d, 0x55, 0x01, 0xa6, 0xca,
+  0x7b, 0x18, 0x65, 0x96, 0x3c, 0x6d, 0x01, 0x61, 0x11, 0xb8, 0x5c, 0xa7, 0x00, 0xca, 0x6c, 0xa7,
+  0xda, 0x69, 0x53, 0x53, 0x33, 0x84, 0x24, 0x32, 0x0f, 0x0e, 0x44, 0x24, 0x88, 0x9e, 0xe8, 0x23,
+  0x6c, 0xfe, 0xfe, 0x68, 0x2f, 0xcf, 0xe2, 0xec, 0x11, 0x00, 0x83, 0x3f, 0xef, 0x03, 0x33, 0x0e,
+  0xcf, 0x22, 0x85, 0xd8, 0x5c, 0x75, 0x87, 0x55, 0xf2, 0x66, 0xcf, 0x02, 0xe5, 0x5f, 0x6c, 0x58,
+  0x37, 0x54, 0xde, 0x05, 0x6b, 0x01, 0x30, 0xef, 0xff, 0xdc, 0xe3, 0xaa, 0x0c, 0x0a, 0x27, 0xe4,
+  0x4e, 0x56, 0x54, 0x67, 0x01, 0xd1, 0x79, 0x3e, 0x52, 0x01, 0xff, 0xb1, 0x05, 0x8c, 0x00, 0x96,
+  0xc7, 0x6c, 0x77, 0xc7, 0x8d, 0x89, 0xd9, 0x20, 0xad, 0xaa, 0xea, 0xad, 0xab, 0xe0, 0x09, 0xed,
+  0xce, 0x54, 0xdd, 0xee, 0x9f, 0x25, 0xbf, 0x9b, 0x5c, 0x3f, 0x57, 0x08, 0xef, 0xc4, 0xfe, 0xfe,
+  0x64, 0x11, 0xfd, 0xef, 0x9b, 0xe4, 0x42, 0x18, 0x1e, 0x00, 0x89, 0xfd, 0xdd, 0x5a, 0x53, 0x93,
+  0x39, 0x34, 0x02, 0xa4, 0x58, 0x03, 0x6a, 0x68, 0xd7, 0x8d, 0x88, 0xe7, 0x20, 0x8d, 0x77, 0xd6,
+  0x7a, 0x6d, 0x48, 0x15, 0xdd, 0xc3, 0x10, 0x7c, 0x17, 0xc2, 0x7d, 0x02, 0x00, 0x27, 0xc3, 0x8d,
+  0x3a, 0x97, 0x4b, 0x1b, 0xba, 0x7c, 0x11, 0x28, 0x21, 0x55, 0x34, 0xee, 0xdb, 0x00, 0x98, 0x97,
+  0x5a, 0x98, 0xfe, 0xe9, 0x76, 0x96, 0x22, 0x5f, 0xf0, 0x01, 0xef, 0x97, 0x7a, 0x69, 0x08, 0x43,
+  0x84, 0xc4, 0x38, 0x33, 0x2a, 0x1e, 0x28, 0x43, 0x95, 0x54, 0x0b, 0xdd, 0x09, 0x00, 0x6d, 0xdc,
+  0xff, 0xf9, 0xbb, 0x49, 0xa4, 0xc5, 0xe0, 0xa8, 0x57, 0x96, 0x59, 0x5f, 0x26, 0x43, 0x48, 0x2c,
+  0xe7, 0x02, 0x00, 0x89, 0x48, 0xa5, 0x9c, 0x48, 0xb4, 0x8a, 0x37, 0x00, 0xa6, 0x89, 0xcd, 0xea,
+  0x87, 0xec, 0x89, 0x74, 0x7e, 0xc9, 0xad, 0x2f, 0x55, 0x01, 0x81, 0x0b, 0x2b, 0x07, 0x02, 0x00,
+  0x0b, 0x00, 0xc9, 0x00, 0x6b, 0x96, 0xca, 0x7c, 0x96, 0xca, 0x79, 0x64, 0x00, 0xa4, 0x45, 0x35,
+  0x43, 0x45, 0x45, 0x34, 0x53, 0x98, 0x24, 0x55, 0x6f, 0x54, 0x02, 0x40, 0x11, 0xce, 0xfb, 0x4f,
+  0xa1, 0x13, 0x02, 0x14, 0x07, 0x17, 0xee, 0xbe, 0x79, 0x01, 0xfa, 0xdf, 0xbe, 0x16, 0xfc, 0x0c,
+  0x04, 0xcf, 0x22, 0x5e, 0x67, 0x01, 0x98, 0x87, 0x76, 0xb1, 0x37, 0x04, 0xfe, 0xf5, 0x5f, 0x57,
+  0x18, 0x3c, 0x1b, 0x4e, 0x0a, 0x07, 0x06, 0xdd, 0x13, 0x01, 0xb0, 0x01, 0xef, 0xff, 0xee, 0xfc,
+  0xcf, 0x67, 0xaf, 0x06, 0xbd, 0x3d, 0x9a, 0x19, 0xef, 0xf3, 0x61, 0x21, 0x9f, 0x15, 0xb4, 0xc4,
+  0x4c, 0x4f, 0x3e, 0x13, 0xbe, 0xc3, 0xb4, 0x83, 0x3f, 0x7b, 0x08, 0x0c, 0x4b, 0x34, 0x85, 0x21,
+  0x05, 0x00, 0x33, 0xb4, 0x9d, 0xae, 0x27, 0x5a, 0x28, 0x2a, 0x3b, 0x6a, 0x01, 0xf9, 0x8f, 0x85,
+  0x14, 0xfe, 0xef, 0x18, 0xcd, 0xf9, 0xaf, 0xe4, 0x42, 0x0a, 0x17, 0x4e, 0xcc, 0xf9, 0x00, 0xc9,
+  0x5b, 0x53, 0x82, 0x28, 0x25, 0xb6, 0x4a, 0x00, 0x56, 0xc6, 0x7d, 0x78, 0xd7, 0x8e, 0x78, 0xd8,
+  0x00, 0x8d, 0x78, 0xe7, 0x7b, 0x68, 0xa8, 0xcb, 0xae, 0x18, 0xdd, 0x48, 0xb2, 0x96, 0x15, 0x6c,
+  0x08, 0x38, 0xd8, 0x68, 0x1d, 0xcc, 0x02, 0xe9, 0x4c, 0x54, 0x02, 0x70, 0xde, 0x02, 0xdc, 0xba,
+  0xa9, 0x00, 0x8a, 0x98, 0x74, 0x3f, 0xee, 0xed, 0xff, 0xee, 0x34, 0xaa, 0x9a, 0xcf, 0x12, 0x83,
+  0x01, 0x07, 0x37, 0x04, 0x38, 0x53, 0x21, 0x43, 0x24, 0x44, 0xfd, 0xcd, 0xb9, 0x7a, 0x02, 0x58,
+  0x94, 0x70, 0xb5, 0x5c, 0x66, 0xc7, 0x96, 0x06, 0x9f, 0x35, 0xa9, 0x11, 0xff, 0x00, 0xff, 0xde,
+  0xe4, 0x79, 0x4a, 0xb4, 0x99, 0x56, 0x00, 0x66, 0x45, 0x5a, 0xd7, 0x9a, 0xde, 0xea, 0x97, 0x10,
+  0xda, 0x7a, 0x86, 0xc9, 0xad, 0x0f, 0x6c, 0xa6, 0xc9, 0x38, 0x6a, 0x75, 0xa8, 0xc3, 0x12, 0x5e,
+  0x11, 0x0e, 0x00, 0xca, 0x6b, 0x02, 0x86, 0x0b, 0x10, 0x6b, 0x96, 0xb5, 0x47, 0x44, 0x74, 0x00,
+  0x76, 0x57, 0x56, 0x75, 0x56, 0x34, 0x59, 0x9a, 0xeb, 0x24, 0x28, 0x82, 0x00, 0xff, 0x4c, 0x01,
+  0xce, 0xe3, 0x01, 0x0b, 0x00, 0x02, 0x00, 0x31, 0x6a, 0x61, 0xfc, 0xee, 0xbe, 0x7c, 0x31, 0x17,
+  0x20, 0xf9, 0x5e, 0xc0, 0x95, 0xea, 0x7c, 0xb9, 0x98, 0x66, 0xcf, 0x12, 0x64, 0x31, 0x01, 0xb7,
+  0x32, 0xf4, 0x4e, 0x55, 0xfb, 0xbf, 0xaa, 0xfa, 0x70, 0xaf, 0x88, 0xf6, 0x6f, 0x89, 0x2f, 0xb7,
+  0x25, 0x1a, 0x20, 0xcc, 0x38, 0xef, 0xe4, 0xb4, 0x52, 0x01, 0x6a, 0x01, 0x02, 0x00, 0x5b, 0x5f,
+  0x3d, 0x88, 0x01, 0xfe, 0xcb, 0x09, 0x49, 0x64, 0xb7, 0x45, 0x92, 0x2f, 0x4b, 0x4d, 0xfc, 0xee,
+  0xff, 0xa7, 0x1c, 0x64, 0x21, 0x71, 0x5f, 0xb3, 0x11, 0x43, 0x04, 0x9c, 0x15, 0x03, 0x02, 0x00,
+  0x8f, 0x1f, 0xee, 0xf9, 0xb8, 0x4a, 0x34, 0xb3, 0x80, 0x5b, 0x35, 0xb5, 0x6c, 0x57, 0xd7, 0x8d,
+  0x67, 0x01, 0x40, 0x88, 0xd7, 0x7d, 0x77, 0xa7, 0xde, 0xd4, 0x03, 0xf5, 0x44, 0x79, 0x38, 0x01,
+  0x37, 0xc3, 0x8d, 0x77, 0xe6, 0x09, 0x7d, 0xf0, 0x88, 0xfc, 0xcf, 0xfd, 0xd8, 0x10, 0x61, 0x11,
+  0xd5, 0x12, 0xf5, 0x39, 0x00, 0xfe, 0xdf, 0xdd, 0xfd, 0xde, 0xcb, 0x96, 0x59, 0x92, 0x88, 0x8a,
+  0x00, 0xed, 0xe8, 0x61, 0x11, 0x73, 0x3a, 0x05, 0x10, 0x10, 0x75, 0x3a, 0x54, 0x94, 0x13, 0x17,
+  0x53, 0xfc, 0xcf, 0x00, 0xdc, 0xfd, 0xcf, 0xee, 0xcd, 0xd4, 0x95, 0x5c, 0x1c, 0x55, 0xa6, 0x32,
+  0x40, 0x02, 0x20, 0x67, 0x01, 0xbc, 0xc3, 0x88, 0x00, 0x4a, 0x54, 0xb5, 0xc6, 0x57, 0x54, 0x6b,
+  0xdb, 0x80, 0xdd, 0xff, 0xfa, 0x87, 0xc9, 0x6d, 0xa7, 0x48, 0x0b, 0xe0, 0xc9, 0x6b, 0x86, 0x97,
+  0x4c, 0x5e, 0x01, 0x61, 0x11, 0x05, 0x00, 0x07, 0xde, 0x02, 0x76, 0x01, 0x05, 0x10, 0x6c, 0x96,
+  0xa5, 0x4b, 0x65, 0x00, 0x65, 0x67, 0x47, 0x78, 0xa7, 0x8a, 0x66, 0x85, 0xf0, 0x56, 0x44, 0x6b,
+  0xbb, 0x9b, 0x9c, 0xb9, 0x4c, 0x55, 0x11, 0x14, 0x30, 0x07, 0x05, 0x20, 0xab, 0x02, 0x08, 0x20,
+  0xf9, 0x5e, 0xa7, 0xec, 0xad, 0x00, 0xba, 0x88, 0x76, 0x65, 0x56, 0x6f, 0xff, 0xf5, 0xff, 0x54,
+  0x08, 0x1a, 0x08, 0x09, 0x01, 0x46, 0x1c, 0x7a, 0x2f, 0x61, 0x31, 0xdc, 0x13, 0x64, 0x31, 0x70,
+  0x33, 0xf5, 0x5f, 0xff, 0x67, 0x01, 0xeb, 0x1d, 0xd2, 0x22, 0x5c, 0x7e, 0x5e, 0xa3, 0x14, 0xdb,
+  0x32, 0x61, 0x01, 0x51, 0x4b, 0x0e, 0x20, 0x73, 0x11, 0x3b, 0xf0, 0xeb, 0xff, 0xfc, 0xcf, 0x5e,
+  0x21, 0x3f, 0x20, 0x2a, 0x13, 0x0f, 0x3e, 0x03, 0xa6, 0x1b, 0xcf, 0x42, 0xfa, 0xaf, 0xff, 0xfb,
+  0xcb, 0x38, 0x00, 0x34, 0xa3, 0x5b, 0x45, 0xa4, 0x7c, 0x68, 0xd7, 0x80, 0x7e, 0x78, 0xe7, 0x7c,
+  0x77, 0xb6, 0xcc, 0x51, 0x05, 0x00, 0xff, 0xfe, 0xcd, 0xd8, 0xac, 0x69, 0xb3, 0x7a, 0xc1, 0xd1,
+  0x09, 0x37, 0xd5, 0x7a, 0xe8, 0x8d, 0x34, 0x04, 0x1b, 0x4e, 0x07, 0x02, 0x50, 0x96, 0x02, 0xcf,
+  0x12, 0xed, 0xdf, 0xdc, 0xed, 0xce, 0x01, 0x02, 0x00, 0xcb, 0xa8, 0x8c, 0xbc, 0xdd, 0xd7, 0x54,
+  0x00, 0x53, 0x46, 0x33, 0x73, 0x29, 0x43, 0xa4, 0x37, 0x14, 0x43, 0xa5, 0xcc, 0x02, 0x39, 0xe3,
+  0x09, 0x43, 0xfd, 0xcf, 0x62, 0xcb, 0x6a, 0x21, 0xdd, 0xcc, 0xaf, 0x9c, 0x55, 0xd2, 0x32, 0xef,
+  0x00, 0xff, 0xbc, 0xc4, 0xa5, 0x5c, 0x65, 0x94, 0xd7, 0x20, 0x65, 0x95, 0x4a, 0x9e, 0xee, 0x67,
+  0x11, 0x69, 0x63, 0xc0, 0x86, 0x3a, 0x75, 0x87, 0x4a, 0x85, 0x28, 0x14, 0x67, 0x11, 0x31, 0x6a,
+  0x41, 0xc9, 0x67, 0x63, 0x05, 0x00, 0x0a, 0x0a, 0x85, 0x3b, 0x80, 0x54, 0xa7, 0x56, 0x47, 0x78,
+  0x98, 0x8a, 0x6a, 0x01, 0xc0, 0x67, 0x95, 0x57, 0x45, 0x6b, 0xbb, 0x62, 0x1c, 0x49, 0x00, 0x3f,
+  0x5b, 0x11, 0x6e, 0x49, 0x73, 0x21, 0xea, 0x22, 0x7c, 0x51, 0x0e, 0x00, 0xfa, 0x5e, 0xfc, 0xca,
+  0xdc, 0x67, 0x11, 0xcf, 0x12, 0x6b, 0x02, 0x5f, 0x22, 0x12, 0x01, 0x10, 0x47, 0x4f, 0x19, 0x5f,
+  0xd2, 0x32, 0x86, 0x1f, 0x9a, 0x09, 0xef, 0xe4, 0x46, 0x01, 0xc3, 0x71, 0xd7, 0x29, 0xb4, 0x5c,
+  0x5f, 0x67, 0x21, 0xab, 0x35, 0xc3, 0x22, 0x4c, 0xc7, 0x3a, 0x04, 0x77, 0x0f, 0xd8, 0x22, 0x4b,
+  0x4a, 0xda, 0x77, 0x0f, 0x61, 0x31, 0x1f, 0xa7, 0x0c, 0xf5, 0x46, 0x8b, 0x1b, 0xd2, 0x22, 0x0e,
+  0x30, 0xfc, 0xce, 0xef, 0x00, 0xfe, 0xdd, 0x7a, 0x73, 0x93, 0x38, 0x36, 0xc6, 0x80, 0x7d, 0x67,
+  0xd7, 0x7c, 0x67, 0xb6, 0xbc, 0x64, 0x01, 0x41, 0x53, 0x06, 0xef, 0xff, 0x9a, 0xc8, 0xbd, 0xb5,
+  0x07, 0x7a, 0x10, 0xc2, 0x7b, 0x58, 0xcd, 0xe6, 0x09, 0x88, 0xe8, 0x7f, 0x0e, 0xcb, 0x87, 0x22,
+  0x9f, 0x45, 0xc2, 0x4c, 0xdf, 0xed, 0xfd, 0xde, 0x00, 0xdd, 0xfd, 0xce, 0xdc, 0xfc, 0xce, 0xcb,
+  0xca, 0x00, 0xa7, 0x67, 0x44, 0x55, 0x56, 0x45, 0x65, 0x56, 0xc0, 0x44, 0x56, 0x33, 0x83, 0x39,
+  0x54, 0xda, 0x09, 0xb0, 0x1c, 0x00, 0x39, 0x54, 0xfc, 0xbf, 0xbb, 0xfb, 0xaf, 0xcc, 0x1c, 0xfd,
+  0xcf, 0xf0, 0x05, 0x96, 0x25, 0xd2, 0x72, 0xff, 0xee, 0xe4, 0x02, 0xb5, 0x3d, 0x0c, 0x69, 0x54,
+  0xc6, 0xab, 0xaf, 0xff, 0x00, 0xff, 0xfc, 0xa7, 0xda, 0x79, 0x74, 0x75, 0x39, 0x36, 0x85, 0x4f,
+  0x01, 0x02, 0x10, 0x6b, 0xd8, 0x02, 0x08, 0x50, 0x67, 0x42, 0x03, 0x08, 0x00, 0x0e, 0x00, 0xa7,
+  0x5b, 0x44, 0xb9, 0x68, 0x65, 0x80, 0x75, 0x87, 0x8a, 0x78, 0xa8, 0x8a, 0x79, 0x6a, 0x01, 0xf9,
+  0xd5, 0x02, 0x5b, 0xbc, 0x10, 0x17, 0xd2, 0x62, 0xcf, 0x52, 0x0b, 0x20, 0x7c, 0x61, 0x00, 0xfe,
+  0xfc, 0xae, 0xda, 0xec, 0xbd, 0xca, 0x98, 0xfd, 0x9f, 0x05, 0x6e, 0x9f, 0x05, 0x0c, 0x1e, 0x42,
+  0x1b, 0x6b, 0x22, 0x2b, 0x84, 0x4d, 0x35, 0xa5, 0x15, 0x01, 0x98, 0xb1, 0x15, 0xe3, 0xb4, 0xb1,
+  0x22, 0xc4, 0xd5, 0x02, 0x9f, 0x67, 0x41, 0xbd, 0x22, 0x79, 0x31, 0x08, 0x50, 0x02, 0x20, 0x4a,
+  0xea, 0xcf, 0x92, 0x0f, 0x70, 0x21, 0x9b, 0x2c, 0x60, 0x20, 0x02, 0x50, 0x4f, 0xab, 0xff, 0xff,
+  0x00, 0xdd, 0xc4, 0x83, 0x38, 0x25, 0xa4, 0x6b, 0x67, 0x18, 0xa7, 0xdd, 0xcf, 0xc3, 0x5e, 0x6c,
+  0x02, 0xc9, 0xce, 0xae, 0x00, 0xea, 0xef, 0xae, 0xe8, 0xbe, 0x67, 0xad, 0x87, 0x60, 0xe8, 0x8d,
+  0x87, 0xe9, 0x8f, 0x87, 0x42, 0x02, 0x80, 0xed, 0x02, 0xfe, 0x64, 0x21, 0xfd, 0xce, 0xcc, 0xb9,
+  0x95, 0x56, 0x02, 0x54, 0x64, 0x01, 0x64, 0x46, 0x55, 0x64, 0x56, 0x55, 0x14, 0x64, 0x45, 0x78,
+  0x18, 0x39, 0xdd, 0x19, 0x94, 0x49, 0x54, 0xea, 0xfc, 0xcf, 0x02, 0xbf, 0x67, 0x01, 0xdd, 0xab,
+  0x38, 0xfc, 0x02, 0x47, 0x50, 0x00, 0xed, 0xff, 0xf7, 0xb8, 0x5c, 0x55, 0xd6, 0xce, 0x04, 0xc9,
+  0xca, 0x2a, 0x11, 0xeb, 0x86, 0xa9, 0x68, 0x76, 0x40, 0xa8, 0x6b, 0x96, 0xc8, 0x6b, 0x95, 0x55,
+  0x01, 0xb8, 0x02, 0x5c, 0x6d, 0x61, 0x86, 0xb9, 0x59, 0x43, 0xb8, 0x5b, 0x8c, 0x96, 0xb9, 0x11,
+  0x00, 0x08, 0x20, 0x75, 0x57, 0x79, 0xcf, 0x02, 0x01, 0x6a, 0x01, 0x78, 0xb7, 0x8a, 0x55, 0x74,
+  0x56, 0x66, 0x3c, 0x7d, 0xdd, 0xcf, 0x1a, 0xd5, 0x72, 0x61, 0x61, 0xb1, 0x55, 0xff, 0xfe, 0xd0,
+  0xfd, 0xae, 0xdb, 0xdc, 0x67, 0x01, 0x75, 0xcf, 0x12, 0x07, 0x27, 0x3f, 0x0f, 0x41, 0x20, 0x38,
+  0x6d, 0x01, 0x21, 0x2e, 0xc9, 0x12, 0x02, 0x00, 0xf9, 0x9f, 0x9d, 0x89, 0x2f, 0xe3, 0x07, 0x67,
+  0x9f, 0x05, 0x13, 0x11, 0x6c, 0x53, 0x79, 0x11, 0x38, 0x4b, 0x43, 0xc3, 0xd2, 0x32, 0x08, 0x20,
+  0xcf, 0x22, 0x49, 0xd9, 0x7f, 0x9f, 0x25, 0xbc, 0x11, 0x6d, 0x01, 0x90, 0x25, 0x68, 0x47, 0x09,
+  0x4e, 0x42, 0x33, 0xeb, 0x80, 0xbf, 0xff, 0xfc, 0xdc, 0x9a, 0x9b, 0xbb, 0x5d, 0x10, 0x03, 0xc0,
+  0x2e, 0x32, 0x39, 0xff, 0xfa, 0xbc, 0x8b, 0xda, 0xdf, 0x00, 0xad, 0xf7, 0xac, 0x9b, 0xd7, 0x8a,
+  0xc8, 0x7e, 0x3c, 0x88, 0xeb, 0xf5, 0x03, 0x87, 0x42, 0xa5, 0x15, 0x64, 0x21, 0xed, 0xfd, 0x81,
+  0x34, 0x14, 0xcc, 0xa8, 0x84, 0x45, 0x44, 0x65, 0x64, 0x01, 0x04, 0x56, 0x55, 0x05, 0x00, 0x65,
+  0x45, 0x45, 0x66, 0x44, 0x08, 0xa5, 0x39, 0x33, 0x34, 0x14, 0x49, 0x43, 0x93, 0x3a, 0xf8, 0x76,
+  0xfd, 0xcf, 0x64, 0x01, 0xcf, 0x92, 0x18, 0x2f, 0x41, 0x20, 0x79, 0x01, 0x10, 0xab, 0x98, 0xa8,
+  0xee, 0x8f, 0x2d, 0x77, 0x67, 0x89, 0x18, 0x97, 0x6a, 0x84, 0xda, 0x09, 0x02, 0x30, 0xb9, 0x6b,
+  0x85, 0x05, 0x02, 0x10, 0x6c, 0x05, 0x00, 0x64, 0xb8, 0x69, 0x53, 0x96, 0x00, 0x4b, 0x86, 0xb9,
+  0x5b, 0x86, 0xb9, 0x67, 0x53, 0x40, 0xb6, 0x4b, 0x96, 0xb8, 0x56, 0x55, 0x64, 0x11, 0xa7, 0x04,
+  0x8a, 0x79, 0x05, 0x00, 0xa5, 0x67, 0x55, 0x63, 0x45, 0x7e, 0xcc, 0x1e, 0x02, 0x8a, 0x15, 0x52,
+  0x11, 0xc3, 0x62, 0xdf, 0x2a, 0x0b, 0x40, 0xed, 0x80, 0xbf, 0xdb, 0xec, 0xbc, 0xca, 0x99, 0x86,
+  0x77, 0x0f, 0xf8, 0xff, 0xe5, 0x5e, 0xd0, 0x13, 0xcf, 0x12, 0x6a, 0x41, 0xcf, 0x22, 0x33, 0x0b,
+  0x7a, 0x3e, 0x8f, 0x32, 0x65, 0x35, 0x10, 0xa9, 0x01, 0x07, 0x07, 0xb4, 0x02, 0x43, 0x87, 0x02,
+  0x10, 0x6f, 0x08, 0x09, 0x12, 0xe5, 0xc5, 0x4b, 0x43, 0xde, 0x12, 0xcf, 0x40, 0x04, 0x17, 0x10,
+  0xd2, 0x22, 0x4c, 0x14, 0x4a, 0xda, 0xcf, 0x12, 0x52, 0x01, 0x3f, 0x65, 0x1f, 0xb6, 0x41, 0x63,
+  0x28, 0xae, 0x45, 0x64, 0x01, 0x1a, 0x00, 0x43, 0xf4, 0x00, 0x5f, 0xee, 0xfd, 0xdd, 0xbb, 0xba,
+  0xba, 0xcc, 0x1e, 0xce, 0x00, 0x22, 0xfb, 0x09, 0x2b, 0x0a, 0x6b, 0x20, 0xdd, 0xd7, 0xac, 0xa0,
+  0x7a, 0xc8, 0xac, 0xbc, 0xdf, 0x6c, 0x02, 0x98, 0x86, 0x0f, 0x17, 0x01, 0x17, 0x96, 0x35, 0x25,
+  0x41, 0xdd, 0x9c, 0x02, 0xb9, 0xa5, 0x55, 0xdb, 0x2b, 0x04, 0xc6, 0x02, 0x54, 0x31, 0x04, 0x37,
+  0x34, 0x49, 0x34, 0x14, 0x02, 0x00, 0x9a, 0xa5, 0xd5, 0x12, 0x55, 0x61, 0x01, 0x02, 0x10, 0xdf,
+  0xdd, 0x38, 0x30, 0x2f, 0x44, 0x00, 0x69, 0x4e, 0x41, 0x10, 0x1a, 0x00, 0xcc, 0x73, 0x04, 0x99,
+  0xa8, 0x80, 0x87, 0x78, 0x7b, 0x86, 0xb8, 0x5b, 0x85, 0x02, 0x00, 0x1d, 0x4f, 0x01, 0xb8, 0x52,
+  0x01, 0x02, 0x20, 0xbd, 0x02, 0xb7, 0x5b, 0x54, 0xc0, 0xb8, 0x5a, 0x54, 0x84, 0x2b, 0x96, 0x0b,
+  0x00, 0x1d, 0x00, 0x44, 0x64, 0x5a, 0x23, 0x10, 0x75, 0x67, 0x89, 0x6a, 0x41, 0xb8, 0x24, 0x8a,
+  0x34, 0x71, 0x00, 0x5d, 0xee, 0xcf, 0x12, 0xfd, 0xef, 0x3c, 0xce, 0xec, 0xbb, 0x1a, 0x70, 0x41,
+  0x40, 0x34, 0x03, 0x05, 0xfc, 0xef, 0x00, 0xfd, 0xbe, 0xdb, 0xed, 0xbd, 0xcb, 0x99, 0x86, 0xf1,
+  0x37, 0x04, 0xff, 0xe7, 0x7e, 0x56, 0x0f, 0x22, 0x24, 0xbd, 0x02, 0x3d, 0x34, 0xfd, 0x47, 0x05,
+  0x3e, 0x9b, 0x0c, 0xe6, 0x09, 0x11, 0x10, 0x70, 0x1a, 0xfd, 0x00, 0x07, 0x07, 0xc5, 0x4f, 0x01,
+  0x42, 0x52, 0x01, 0xb3, 0x3b, 0x4d, 0xb5, 0x17, 0x20, 0x19, 0x20, 0xdb, 0xeb, 0x9d, 0x99, 0xd9,
+  0x02, 0x00, 0x7c, 0x83, 0xec, 0xb4, 0x2b, 0xa2, 0x35, 0xf3, 0x02, 0x4b, 0x07, 0x17, 0xcc, 0x12,
+  0x4f, 0x11, 0x01, 0x4e, 0x10, 0x67, 0xf7, 0x7f, 0x76, 0xf6, 0x6f, 0x55, 0x15, 0x72, 0x48, 0x3e,
+  0x14, 0x00, 0x23, 0x82, 0x01, 0xf4, 0x4f, 0x99, 0x44, 0xfe, 0xee, 0xf2, 0x08, 0x89, 0x8e, 0xee,
+  0x0c, 0x12, 0xec, 0x80, 0xef, 0xbd, 0xfc, 0xff, 0xcf, 0xfb, 0xdf, 0x0b, 0x10, 0x87, 0x0d, 0x07,
+  0x6c, 0x12, 0x61, 0x1a, 0xcc, 0xcc, 0xba, 0xee, 0xa4, 0x7c, 0x53, 0x66, 0x18, 0x0e, 0x00, 0xdb,
+  0xb6, 0xc6, 0x12, 0x54, 0x02, 0x20, 0x55, 0xc2, 0x54, 0x6d, 0x11, 0x55, 0x64, 0x46, 0x75, 0xaa,
+  0x0c, 0xf6, 0x0c, 0xcc, 0x38, 0x63, 0x05, 0x00, 0x6d, 0x01, 0xdc, 0xbf, 0x31, 0x04, 0x67, 0x01,
+  0x01, 0xff, 0x02, 0xcc, 0xca, 0x9b, 0x87, 0xca, 0xad, 0xbb, 0x60, 0xdc, 0xbd, 0xcc, 0xed, 0xcf,
+  0xa9, 0x31, 0x52, 0x04, 0xba, 0x00, 0xdb, 0xb5, 0x79, 0x68, 0xaa, 0x86, 0xa7, 0x4b, 0x3c, 0x85,
+  0xa9, 0x61, 0x21, 0x6a, 0x21, 0x4c, 0x11, 0x08, 0x20, 0x75, 0xa4, 0x80, 0x3b, 0x75, 0xa7, 0x5a,
+  0x43, 0xa4, 0x4a, 0x82, 0x41, 0x90, 0x64, 0x46, 0x46, 0x97, 0x6a, 0x01, 0x57, 0x55, 0x3a, 0x14,
+  0x08, 0xa7, 0x8a, 0x88, 0x05, 0x00, 0xa4, 0x46, 0x45, 0x65, 0xea, 0x57, 0x47, 0x1c, 0xeb, 0x18,
+  0x1e, 0xbe, 0x60, 0x11, 0x67, 0x21, 0x02, 0x30, 0x06, 0xfe, 0x4b, 0x1b, 0x67, 0x11, 0xcd, 0xcb,
+  0xba, 0x96, 0x66, 0xa0, 0x56, 0x6d, 0xef, 0xd9, 0x9e, 0x67, 0x01, 0x34, 0xcf, 0x22, 0x01, 0x83,
+  0x12, 0xfc, 0xbf, 0xee, 0xfd, 0xde, 0xed, 0xec, 0x66, 0xde, 0x14, 0x20, 0x7f, 0x11, 0x44, 0xe7,
+  0x9c, 0x0b, 0x6a, 0x01, 0xf4, 0x8e, 0xb4, 0xec, 0x06, 0xb7, 0x02, 0x4f, 0x01, 0x3b, 0x36, 0xc7,
+  0x11, 0x10, 0x53, 0x00, 0x60, 0x83, 0x0c, 0xf4, 0xb5, 0x82, 0x11, 0x44, 0x48, 0x1b, 0x3b, 0x24,
+  0x4c, 0xec, 0xcf, 0x32, 0x33, 0xf2, 0x02, 0x10, 0x23, 0xfc, 0xe2, 0xdf, 0x2c, 0x40, 0xfe, 0xef,
+  0xbb, 0x77, 0x1f, 0x17, 0x30, 0xd2, 0x12, 0x00, 0x56, 0xef, 0xff, 0x78, 0x76, 0x66, 0x77, 0x7e,
+  0xe9, 0xc9, 0x1c, 0xde, 0xfb, 0xb4, 0x1e, 0xce, 0x02, 0x00, 0x77, 0x33, 0xaa, 0x10, 0x33, 0x15,
+  0x22, 0x35, 0x00, 0xad, 0xcb, 0xc8, 0x66, 0x64, 0x01, 0xed, 0xc9, 0x9a, 0x88, 0xc0, 0x02, 0x55,
+  0x28, 0x04, 0x2e, 0x04, 0x55, 0x56, 0x3a, 0x04, 0x80, 0x44, 0x65, 0x55, 0x44, 0x64, 0x44, 0x95,
+  0x5e, 0x01, 0x10, 0x38, 0x33, 0x43, 0x2a, 0xd5, 0x12, 0x93, 0x39, 0x43, 0x2c, 0xa7, 0x6f, 0x64,
+  0x24, 0x02, 0x00, 0xd8, 0xb9, 0x07, 0x56, 0xb6, 0x00, 0x6b, 0x77, 0xb8, 0x8b, 0x77, 0xa4, 0x4b,
+  0x45, 0x08, 0xc9, 0x9f, 0xdd, 0xe7, 0x02, 0xfb, 0xb9, 0x9a, 0x48, 0x80, 0xb6, 0x8a, 0xa8, 0x5a,
+  0x85, 0xa8, 0x5b, 0x02, 0x70, 0x06, 0xb8, 0xb4, 0x12, 0x70, 0x11, 0xa7, 0x5a, 0x44, 0xa6, 0x4b,
+  0x68, 0x85, 0x75, 0x3a, 0x1a, 0x03, 0x63, 0x79, 0x11, 0x26, 0x00, 0x57, 0x00, 0x47, 0x76, 0x86,
+  0x67, 0x86, 0x59, 0x74, 0x75, 0x04, 0x47, 0x79, 0x0d, 0x37, 0x89, 0xb7, 0x8a, 0x34, 0x54, 0xce,
+  0x45, 0x4e, 0x0b, 0x4f, 0x01, 0x18, 0x0e, 0xad, 0xfc, 0x5f, 0x07, 0x3a, 0x84, 0x42, 0xfc, 0xce,
+  0x00, 0xdf, 0xfe, 0xce, 0xeb, 0x67, 0x11, 0xa6, 0xc0, 0x66, 0x66, 0x6d, 0xee, 0xeb, 0xbe, 0x22,
+  0x14, 0x99, 0x25, 0x01, 0xbd, 0x12, 0xef, 0xfb, 0xbb, 0xaa, 0xaa, 0xba, 0xde, 0x0e, 0xfd, 0xcf,
+  0x32, 0x3a, 0x34, 0xf0, 0x25, 0xf9, 0xd9, 0x3b, 0x33, 0xc4, 0xb4, 0x2b, 0x02, 0x30, 0x44, 0xb4,
+  0xde, 0xe1, 0x03, 0xd1, 0x1c, 0x61, 0x40, 0x31, 0xff, 0xdf, 0xe3, 0xb3, 0x7f, 0x11, 0xe0, 0x19,
+  0xb4, 0x40, 0x4c, 0x3d, 0xed, 0xff, 0xfb, 0xce, 0x8c, 0x04, 0x33, 0x68, 0xf3, 0x4f, 0x23, 0xcf,
+  0x02, 0xfd, 0xde, 0x01, 0x29, 0x50, 0xfd, 0x1e, 0xde, 0x34, 0x04, 0x17, 0x20, 0x52, 0x14, 0x2a,
+  0x03, 0xaa, 0x96, 0x66, 0xd0, 0x77, 0x7d, 0xed, 0xee, 0x71, 0x03, 0xfa, 0x15, 0x02, 0x64, 0x1d,
+  0x1e, 0xce, 0x0d, 0x17, 0x7d, 0x23, 0x02, 0x20, 0x0e, 0x0c, 0xee, 0xfd, 0xee, 0x08, 0xba, 0x9d,
+  0xdb, 0x9c, 0x45, 0xdd, 0xbb, 0x55, 0x65, 0x5d, 0x48, 0x02, 0x46, 0xcf, 0x02, 0x2b, 0x14, 0x9f,
+  0x15, 0x45, 0xcf, 0x12, 0x67, 0x41, 0x5b, 0x0e, 0x43, 0x83, 0x34, 0x23, 0x64, 0x3a, 0x04, 0x3a,
+  0x21, 0xcf, 0x02, 0x33, 0x94, 0x3d, 0xbb, 0x67, 0x41, 0xeb, 0x98, 0x20, 0xd7, 0x7d, 0x88, 0xd8,
+  0x9e, 0x02, 0x00, 0x89, 0xd7, 0x10, 0x8c, 0x55, 0xa4, 0x4e, 0xe4, 0x02, 0xdc, 0x78, 0xa5, 0x00,
+  0x8c, 0x47, 0xa9, 0x74, 0xa7, 0x5b, 0x75, 0xa8, 0x70, 0x5a, 0x75, 0xb8, 0x5a, 0x05, 0x00, 0x4c,
+  0x21, 0x52, 0x31, 0x5a, 0x4e, 0x64, 0x57, 0x0e, 0x08, 0x00, 0x87, 0x2b, 0x43, 0xa7, 0x1a, 0x20,
+  0xb8, 0x00, 0x56, 0x44, 0x74, 0x77, 0x79, 0x77, 0x97, 0x79, 0x30, 0x75, 0x67, 0x63, 0x76, 0x78,
+  0x08, 0xd5, 0x22, 0x55, 0x75, 0xf8, 0x56, 0xaa, 0xbe, 0x67, 0x01, 0x1b, 0x2e, 0x03, 0x0e, 0xb3,
+  0x50, 0x02, 0x10, 0x44, 0xec, 0xef, 0xb0, 0x0c, 0xfd, 0xbe, 0xec, 0x67, 0x01, 0xcb, 0x3d, 0x67,
+  0x11, 0xdd, 0x67, 0x01, 0xf2, 0x16, 0xce, 0x09, 0xc8, 0x19, 0x44, 0xff, 0x44, 0xe7, 0x87, 0xcb,
+  0x03, 0xee, 0xfd, 0xaa, 0x64, 0x01, 0xd4, 0x4b, 0x4b, 0x1b, 0x1a, 0x00, 0x55, 0x4a, 0x11, 0xfd,
+  0xed, 0x43, 0x01, 0x3b, 0x20, 0x42, 0xa4, 0x3b, 0x43, 0xa4, 0x70, 0x01, 0x5c, 0x5e, 0x4f, 0x3a,
+  0x51, 0x67, 0x21, 0x37, 0x04, 0x1b, 0x2e, 0xb4, 0x4c, 0xcf, 0x02, 0x4e, 0xf3, 0xcd, 0x01, 0x77,
+  0x0f, 0x3e, 0x34, 0xb4, 0x02, 0x02, 0x00, 0x67, 0x01, 0x24, 0x30, 0x1d, 0x00, 0x20, 0x78, 0xcf,
+  0x12, 0x17, 0x20, 0xa8, 0x05, 0xfd, 0xdf, 0xaa, 0x40, 0xa6, 0x66, 0x67, 0x6d, 0xdd, 0xee, 0x58,
+  0x01, 0xfb, 0x7b, 0x15, 0x12, 0x80, 0x03, 0xde, 0x94, 0x21, 0xaa, 0x00, 0x1e, 0x32, 0xe1, 0x1e,
+  0xfd, 0x00, 0xef, 0xef, 0xfd, 0xdd, 0xba, 0x9e, 0xdc, 0xee, 0x90, 0xdf, 0xdd, 0xba, 0xa4, 0x55,
+  0x21, 0x64, 0x55, 0x96, 0x55, 0x0b, 0x73, 0x01, 0x6d, 0x11, 0x43, 0x9c, 0x15, 0x33, 0x42, 0x34,
+  0x34, 0x02, 0x85, 0x3d, 0x24, 0x94, 0x29, 0x33, 0x94, 0x37, 0x54, 0x01, 0xfb, 0x46, 0xee, 0xcc,
+  0xc7, 0x8e, 0x89, 0xe8, 0x9e, 0x02, 0x99, 0x02, 0x10, 0x9d, 0x89, 0xb7, 0x7f, 0xed, 0xfd, 0x40,
+  0xd6, 0x8a, 0x49, 0xd5, 0x8b, 0x76, 0x5e, 0x01, 0x4a, 0xa7, 0x02, 0x40, 0x6a, 0x01, 0x4f, 0x01,
+  0xb7, 0x5a, 0xc9, 0x02, 0x74, 0x64, 0x01, 0x00, 0xa5, 0x3a, 0x85, 0xa7, 0x58, 0x63, 0x83, 0x2a,
+  0x40, 0x43, 0x94, 0x4a, 0x43, 0x96, 0x4a, 0x14, 0x00, 0x85, 0x00, 0xa7, 0x59, 0x74, 0x74, 0x77,
+  0x57, 0x77, 0x97, 0x80, 0x7a, 0x78, 0x97, 0x67, 0x96, 0x46, 0x67, 0x37, 0x04, 0x00, 0x88, 0xa7,
+  0x9a, 0x78, 0xa4, 0x56, 0x33, 0x5f, 0x1f, 0x67, 0x11, 0x6b, 0x3f, 0xb0, 0x10, 0x64, 0x21, 0xd9,
+  0x37, 0xdf, 0xfd, 0xff, 0x24, 0xfe, 0xce, 0x67, 0x01, 0xdb, 0xbb, 0x67, 0x21, 0xed, 0xdf, 0x47,
+  0x9e, 0x1c, 0xf4, 0x00, 0x65, 0x3f, 0xff, 0xf7, 0x88, 0x67, 0x01, 0xab, 0xdc, 0xad, 0xee, 0xcf,
+  0x12, 0x11, 0x20, 0x05, 0x00, 0xfd, 0x64, 0x02, 0xc8, 0x09, 0x8c, 0x33, 0xb4, 0xd2, 0x32, 0xc8,
+  0x19, 0x45, 0xb4, 0xce, 0xbf, 0x06, 0x61, 0x0e, 0x17, 0xff, 0xde, 0xd7, 0xc7, 0x0a, 0xa7, 0x67,
+  0x01, 0xeb, 0xef, 0xb4, 0x1f, 0x07, 0x47, 0x60, 0x31, 0x96, 0x51, 0xaa, 0x00, 0x06, 0xea, 0x22,
+  0x92, 0x14, 0x28, 0xfe, 0xef, 0x9a, 0xcf, 0x12, 0xdd, 0xcf, 0x02, 0xff, 0xed, 0x5e, 0xef, 0x80,
+  0x03, 0xad, 0x00, 0x61, 0x61, 0xb6, 0x40, 0xeb, 0x17, 0x00, 0xdf, 0x82, 0xce, 0x3e, 0x00, 0xfc,
+  0xcc, 0xca, 0xa9, 0x88, 0xc0, 0x12, 0x2f, 0x31, 0x14, 0xcf, 0x12, 0x93, 0x05, 0x9c, 0x05, 0x54,
+  0x9f, 0x15, 0x55, 0x65, 0xc1, 0x63, 0x08, 0x34, 0x23, 0x43, 0x44, 0x24, 0xda, 0x09, 0xd8, 0x02,
+  0x0b, 0xb3, 0x0c, 0x0e, 0x00, 0x98, 0xb0, 0x5f, 0xc8, 0x8e, 0x99, 0xe9, 0x04, 0x9e, 0x89, 0x02,
+  0x10, 0x9d, 0x88, 0xec, 0xbe, 0xed, 0x00, 0x68, 0xa4, 0x9d, 0x59, 0xc5, 0x55, 0xa7, 0x5a, 0x1e,
+  0x84, 0x55, 0x01, 0x43, 0x11, 0x6a, 0x31, 0x05, 0x00, 0x49, 0x64, 0x95, 0x40, 0x4a, 0x43, 0xa4,
+  0x3a, 0x54, 0xa7, 0x76, 0x01, 0x47, 0x84, 0x42, 0x73, 0xba, 0x08, 0x3a, 0x43, 0x74, 0x2a, 0x1d,
+  0x40, 0x40, 0x64, 0x47, 0x47, 0x75, 0x77, 0x69, 0x6a, 0x01, 0x94, 0x30, 0x39, 0x64, 0x77, 0x97,
+  0xa5, 0x25, 0xa2, 0x05, 0x5e, 0xee, 0x5f, 0x21, 0x02, 0x1e, 0x02, 0xa1, 0x00, 0xc9, 0x32, 0x00,
+  0x60, 0xef, 0xf1, 0x03, 0xce, 0x00, 0xdb, 0xee, 0xcd, 0xcb, 0xcc, 0xb6, 0x66, 0x66, 0x30, 0x6b,
+  0xbb, 0xfe, 0xef, 0x09, 0x4e, 0x6a, 0x31, 0xff, 0xf8, 0xe6, 0x77, 0x67, 0x01, 0xef, 0x09, 0xe8,
+  0x8f, 0x16, 0x27, 0x8f, 0x2f, 0x0f, 0x0e, 0x69, 0x00, 0x00, 0x7c, 0x74, 0x27, 0x6b, 0xc3, 0xdb,
+  0x02, 0x8a, 0x05, 0x5c, 0xf0, 0x56, 0xc6, 0x5c, 0x54, 0x1f, 0x07, 0xd1, 0x19, 0x02, 0x20, 0xc8,
+  0x0c, 0x80, 0xb4, 0x4b, 0x4f, 0xfe, 0xff, 0xfb, 0xbf, 0xf0, 0x2c, 0xef, 0xb4, 0x22, 0x2f, 0x11,
+  0xe2, 0x21, 0x00, 0x20, 0xbb, 0x77, 0x2f, 0x17, 0x10, 0x45, 0x03, 0xc8, 0xff, 0xfe, 0x99, 0x67,
+  0x01, 0x7c, 0xdc, 0x37, 0x14, 0x90, 0x05, 0xf8, 0xfd, 0xef, 0xee, 0x2b, 0x00, 0xcf, 0x12, 0xc1,
+  0x21, 0xb6, 0x30, 0xc7, 0x01, 0x06, 0xfd, 0x0a, 0x00, 0xb4, 0x00, 0xee, 0x77, 0x84, 0x46, 0x45,
+  0xc2, 0x55, 0x61, 0x31, 0x55, 0x54, 0x64, 0x55, 0xd8, 0x02, 0x76, 0x21, 0x00, 0x46, 0x45, 0x54,
+  0x46, 0x85, 0x39, 0x33, 0x63, 0x98, 0x24, 0x34, 0x42, 0x67, 0x01, 0x04, 0x17, 0x32, 0x83, 0xcf,
+  0x02, 0xa7, 0x43, 0x04, 0xdd, 0x00, 0xdd, 0x2c, 0xdb, 0xad, 0x64, 0x01, 0x9a, 0x02, 0x00, 0x10,
+  0xe8, 0x9c, 0x99, 0xfe, 0xcc, 0x02, 0xd4, 0x8d, 0x45, 0x3c, 0x79, 0x74, 0x5e, 0x01, 0x02, 0x20,
+  0x6a, 0x01, 0x02, 0x10, 0x97, 0x48, 0x04, 0x53, 0x84, 0x51, 0x0e, 0x39, 0x43, 0xa6, 0x4a, 0x74,
+  0x80, 0xa8, 0x5a, 0x74, 0x74, 0x38, 0x32, 0x73, 0xcf, 0x02, 0x20, 0x39, 0x43, 0xa3, 0x38, 0x53,
+  0x20, 0x40, 0x47, 0x57, 0x91, 0xd2, 0x02, 0x76, 0x87, 0x79, 0x14, 0x00, 0x65, 0x47, 0x0a, 0x37,
+  0xd0, 0x45, 0x55, 0x69, 0x9a, 0x98, 0x00, 0xdf, 0xe7, 0x04, 0xb0, 0x96, 0x15, 0xe8, 0x63, 0xcf,
+  0xcf, 0x12, 0xcc, 0xcf, 0x02, 0x69, 0xa9, 0xff, 0x4e, 0xff, 0x1c, 0x24, 0x02, 0x10, 0x08, 0x10,
+  0xff, 0xf7, 0x67, 0x21, 0x6c, 0x58, 0xcc, 0xfe, 0xef, 0x67, 0x6c, 0x08, 0x00, 0xcc, 0x5d, 0x18,
+  0xd4, 0x7f, 0x5e, 0x41, 0x65, 0x3f, 0x03, 0x1e, 0x0b, 0x00, 0xfb, 0x36, 0x7c, 0x31, 0x6a, 0x11,
+  0xb3, 0xfc, 0x4c, 0x4e, 0x7b, 0x02, 0x37, 0x04, 0xfa, 0x1d, 0xaf, 0x28, 0xcc, 0x52, 0x10, 0x24,
+  0x86, 0x77, 0xde, 0x4f, 0xcf, 0x22, 0xff, 0xff, 0x88, 0x86, 0xcf, 0x02, 0xf8, 0xdc, 0xde, 0xef,
+  0x0a, 0x07, 0xfb, 0x26, 0x5e, 0x31, 0x26, 0x23, 0x2f, 0x30, 0xe3, 0x61, 0x11, 0x3f, 0x20, 0xee,
+  0xe6, 0x68, 0xf5, 0x06, 0xfb, 0x16, 0xcf, 0x32, 0x07, 0xfe, 0x26, 0x05, 0x10, 0xa7, 0x1c, 0x34,
+  0x95, 0x38, 0x33, 0x42, 0x0a, 0x44, 0x67, 0x01, 0x34, 0x70, 0x01, 0x94, 0x36, 0x22, 0x84, 0x01,
+  0x05, 0x00, 0x34, 0x24, 0x64, 0x66, 0x47, 0xcc, 0xbf, 0x09, 0xcb, 0x29, 0xdd, 0xaa, 0x34, 0x04,
+  0xe9, 0xae, 0x99, 0xda, 0x00, 0xaf, 0xee, 0x79, 0xa4, 0x9e, 0x49, 0xd4, 0x7b, 0x8e, 0x65, 0x5e,
+  0x31, 0x05, 0x00, 0x6d, 0x31, 0x48, 0x53, 0x83, 0x13, 0x2a, 0x72, 0xa6, 0x0e, 0x30, 0x47, 0x53,
+  0x0b, 0x00, 0x14, 0x13, 0xf2, 0x0c, 0x38, 0x04, 0x43, 0x97, 0x2c, 0x30, 0x56, 0x54, 0x76, 0x97,
+  0x58, 0x48, 0x74, 0x87, 0x68, 0x29, 0x00, 0x85, 0x37, 0xa2, 0x25, 0xa3, 0xf0, 0x46, 0x45, 0x63,
+  0x35, 0xa0, 0x20, 0x45, 0x85, 0xd0, 0x72, 0x37, 0x14, 0x08, 0xee, 0xce, 0xdc, 0xcf, 0x12, 0x68,
+  0x88, 0xff, 0xff, 0xe7, 0xa2, 0x6d, 0x1b, 0x11, 0x67, 0x41, 0x66, 0x76, 0x12, 0x11, 0xb7, 0x25,
+  0x15, 0x11, 0x84, 0x4e, 0x54, 0x37, 0x10, 0xf7, 0xc7, 0x3b, 0x34, 0xb9, 0x09, 0xbd, 0x4f, 0x11,
+  0x4c, 0x36, 0x0b, 0xb3, 0x2c, 0xa1, 0x0c, 0x24, 0x1e, 0x34, 0x8d, 0x18, 0xf7, 0x58, 0x04, 0x05,
+  0x10, 0x37, 0x04, 0xfb, 0xd7, 0x29, 0x51, 0x30, 0x17, 0x3a, 0x00, 0x20, 0x38, 0xee, 0xfa, 0xaf,
+  0x7f, 0x21, 0xad, 0x1c, 0x05, 0x00, 0x66, 0xff, 0x04, 0xff, 0x67, 0x6f, 0x08, 0x7c, 0xdd, 0xee,
+  0xde, 0xee, 0x3f, 0xa5, 0x3b, 0xe4, 0x4b, 0x73, 0x21, 0xa5, 0x45, 0x76, 0x11, 0xcc, 0x12, 0x55,
+  0x74, 0x7f, 0xc0, 0x02, 0x28, 0x04, 0xfa, 0x1d, 0xcc, 0x02, 0x6a, 0x21, 0xdb, 0x02, 0xae, 0x15,
+  0x54, 0x00, 0x64, 0x44, 0x94, 0x35, 0x33, 0x42, 0x45, 0x45, 0x88, 0x43, 0x54, 0x24, 0xdd, 0x09,
+  0x93, 0x34, 0x22, 0xa2, 0x15, 0x80, 0x24, 0x24, 0x64, 0x67, 0x47, 0x64, 0x7b, 0xb0, 0x03, 0x01,
+  0x0f, 0x2e, 0xcf, 0xbc, 0xfc, 0xbe, 0xdc, 0xfe, 0xda, 0x00, 0xbb, 0x48, 0xd4, 0x9d, 0x48, 0xd3,
+  0x44, 0x96, 0x34, 0x4a, 0x74, 0x3d, 0x01, 0x97, 0xa5, 0x02, 0x43, 0x01, 0x48, 0x53, 0x91, 0x52,
+  0x01, 0x95, 0x3a, 0x64, 0x4c, 0x11, 0x49, 0x74, 0x8a, 0x15, 0xb2, 0x29, 0x64, 0x01, 0x33, 0x84,
+  0x14, 0x03, 0xcf, 0x02, 0x39, 0x3a, 0x14, 0x89, 0x91, 0x11, 0x49, 0x64, 0xcc, 0x02, 0x76, 0x87,
+  0x57, 0x97, 0x04, 0xc8, 0x96, 0x47, 0x79, 0xa2, 0x15, 0xa5, 0x68, 0x8f, 0x00, 0x72, 0x08, 0x8f,
+  0xae, 0x73, 0x63, 0x61, 0xb6, 0x20, 0xcf, 0x02, 0xee, 0xcd, 0xdc, 0xcf, 0x12, 0x7c, 0x67, 0x77,
+  0xcf, 0x52, 0x1f, 0x14, 0x37, 0x24, 0x9f, 0x15, 0x00, 0x00, 0xcc, 0x8c, 0xcf, 0xee, 0x31, 0x4f,
+  0x30, 0x21, 0xfa, 0x9f, 0xff, 0xdd, 0x03, 0xfc, 0x4c, 0x54, 0xbc, 0x59, 0x05, 0x00, 0x55, 0x01,
+  0x2e, 0x34, 0x74, 0x5f, 0x0b, 0x30, 0x03, 0x37, 0x54, 0x5c, 0x57, 0xf6, 0x6f, 0x67, 0xf7, 0x7e,
+  0x77, 0xe0, 0xf7, 0x8f, 0x77, 0xf6, 0x6f, 0x14, 0x20, 0x1b, 0x2e, 0x05, 0x20, 0xc2, 0x77, 0x3f,
+  0x2b, 0x88, 0x8d, 0xdc, 0xdd, 0x0c, 0x1e, 0x61, 0xd1, 0xf3, 0xc9, 0x22, 0x05, 0x40, 0xee, 0xe5,
+  0x5d, 0x28, 0x93, 0x25, 0xcf, 0x12, 0x6a, 0x21, 0x33, 0x3d, 0x04, 0x37, 0x44, 0x65, 0x43, 0x25,
+  0x04, 0xd8, 0x02, 0x43, 0x44, 0x02, 0x34, 0x6f, 0x18, 0x33, 0x22, 0x93, 0x39, 0x33, 0x73, 0x01,
+  0x37, 0x04, 0x77, 0x47, 0x75, 0x76, 0x47, 0x99, 0xaf, 0x03, 0xe9, 0x2c, 0x81, 0x2b, 0xed, 0xd4,
+  0x8c, 0x49, 0xe4, 0x9d, 0x68, 0x56, 0x98, 0x54, 0x4f, 0x01, 0xa6, 0x52, 0x01, 0x02, 0x10, 0x64,
+  0x0c, 0x64, 0x29, 0xec, 0x06, 0xd8, 0x02, 0x64, 0xa7, 0x49, 0x75, 0x91, 0x0e, 0x00, 0x85, 0x37,
+  0x32, 0x87, 0x1b, 0x29, 0x43, 0xb7, 0x02, 0x63, 0x52, 0x01, 0x02, 0x00, 0x85, 0x37, 0x53, 0x1a,
+  0x00, 0x91, 0x01, 0x65, 0x20, 0x57, 0x68, 0x76, 0x96, 0x57, 0x1d, 0x00, 0x85, 0x37, 0x14, 0x79,
+  0x78, 0xa2, 0x15, 0x79, 0x89, 0x00, 0x44, 0x5b, 0xbc, 0xa3, 0x64, 0xf1, 0xc5, 0x30, 0xfe, 0xcf,
+  0xed, 0xcf, 0x42, 0x66, 0x53, 0x02, 0x3f, 0x16, 0x1f, 0x7a, 0x12, 0x15, 0x01, 0xcf, 0x12, 0x6f,
+  0x18, 0x00, 0x00, 0x67, 0x7f, 0x18, 0xff, 0xf7, 0x7f, 0x15, 0x31, 0xd5, 0x32, 0xff, 0xaa, 0xae,
+  0xf8, 0xee, 0xde, 0xd4, 0x5b, 0x01, 0xc0, 0x42, 0x6b, 0x2f, 0x3d, 0x24, 0xe1, 0x32, 0xc7, 0x1c,
+  0x07, 0x9f, 0x25, 0x2d, 0x0e, 0xef, 0xec, 0xbf, 0xfd, 0x3d, 0x8f, 0x74, 0x47, 0x0e, 0x30, 0xe4,
+  0x62, 0x70, 0x21, 0xaa, 0xfd, 0xdd, 0x68, 0x00, 0x99, 0x7e, 0x9c, 0x9f, 0x05, 0xcf, 0x62, 0x31,
+  0x24, 0x68, 0x34, 0x6a, 0x61, 0x8e, 0x01, 0x74, 0xff, 0x58, 0x31, 0x31, 0x04, 0x2a, 0x0b, 0x9b,
+  0x0c, 0xd8, 0x12, 0x61, 0x11, 0x3f, 0x0b, 0x0a, 0x07, 0x20, 0x56, 0x44, 0x73, 0x34, 0x35, 0xae,
+  0x15, 0x55, 0x24, 0x00, 0x43, 0x49, 0x53, 0x83, 0x33, 0x23, 0x83, 0x38, 0x40, 0x42, 0x42, 0x33,
+  0x35, 0x64, 0x67, 0x51, 0x15, 0x74, 0x00, 0x76, 0x57, 0x77, 0x89, 0x89, 0xa9, 0x7c, 0x98, 0x20,
+  0xc8, 0x7b, 0x86, 0x46, 0x94, 0x34, 0x04, 0x8c, 0xb8, 0x20, 0x79, 0x54, 0x97, 0x4a, 0x64, 0x02,
+  0x30, 0x96, 0x47, 0x02, 0x42, 0xdb, 0x22, 0x64, 0x97, 0x59, 0x74, 0x96, 0x48, 0x00, 0x53, 0x74,
+  0x37, 0x32, 0x73, 0x27, 0x32, 0x93, 0x09, 0x6a, 0x21, 0x94, 0x28, 0x1f, 0x2a, 0x39, 0x33, 0x96,
+  0x46, 0x06, 0x45, 0x23, 0x00, 0x02, 0x00, 0x85, 0x37, 0x68, 0x77, 0x96, 0x02, 0x33, 0x79, 0x01,
+  0x65, 0x47, 0x7a, 0x77, 0xa8, 0x89, 0x83, 0x3a, 0x04, 0xf6, 0x08, 0x33, 0x44, 0x56, 0x55, 0x6b,
+  0x6a, 0x11, 0x27, 0xb7, 0x17, 0x0a, 0x57, 0x69, 0x21, 0xfe, 0xff, 0xcf, 0x02, 0xce, 0xec, 0xc4,
+  0xcc, 0xb8, 0x52, 0x11, 0xff, 0xff, 0x99, 0x69, 0x38, 0xdd, 0x39, 0x33, 0x37, 0x54, 0xa2, 0x25,
+  0xff, 0x54, 0x80, 0x52, 0x05, 0x00, 0xee, 0xbb, 0xe4, 0xb7, 0x77, 0x7f, 0x03, 0x6c, 0x63, 0x31,
+  0x34, 0xcf, 0x12, 0x5e, 0x01, 0x31, 0xc6, 0x32, 0x6c, 0x6a, 0xd9, 0xd2, 0x22, 0xcf, 0x32, 0xff,
+  0xdd, 0xfc, 0xdc, 0xcf, 0x64, 0x31, 0xe2, 0x35, 0x05, 0x30, 0x5b, 0x11, 0xb3, 0x41, 0x8c, 0x4f,
+  0x88, 0xee, 0xfb, 0xba, 0x67, 0x00, 0xbb, 0xac, 0xcc, 0x6f, 0x18, 0x8f, 0x64, 0x31, 0x7f, 0x53,
+  0x1c, 0x39, 0x1b, 0x42, 0xf7, 0x78, 0x45, 0x5a, 0x28, 0x3f, 0xbd, 0x52, 0xc6, 0x22, 0x11, 0x00,
+  0xcf, 0x02, 0x79, 0x11, 0x17, 0x00, 0x43, 0x63, 0x04, 0x34, 0x55, 0xcf, 0x02, 0x44, 0x54, 0x24,
+  0x44, 0x57, 0x00, 0x54, 0x84, 0x24, 0x24, 0x73, 0x25, 0x23, 0x43, 0x10, 0x43, 0x35, 0x77, 0x97,
+  0x21, 0x08, 0x47, 0x64, 0x76, 0x00, 0x57, 0x55, 0x87, 0x8a, 0x99, 0x9d, 0x87, 0xe8, 0x00, 0x8a,
+  0x67, 0x49, 0xd4, 0x9d, 0x49, 0xe6, 0x68, 0x0c, 0xc7, 0x79, 0xba, 0x02, 0x02, 0x20, 0x48, 0x54,
+  0x74, 0x29, 0x19, 0x40, 0x01, 0x64, 0x97, 0xc6, 0x22, 0x61, 0x41, 0x37, 0x32, 0x83, 0x22, 0x28,
+  0x67, 0x11, 0x73, 0x29, 0x32, 0xcf, 0x12, 0x29, 0x43, 0x20, 0x86, 0x37, 0x47, 0x64, 0x39, 0x2f,
+  0x10, 0x97, 0x46, 0x58, 0x56, 0x76, 0x88, 0x79, 0x01, 0x40, 0x14, 0x78, 0xe3, 0x09, 0xa7, 0xc0,
+  0x8a, 0x44, 0x54, 0x55, 0x23, 0x44, 0xca, 0x14, 0x6a, 0x31, 0x03, 0x98, 0x65, 0xb1, 0x35, 0xfe,
+  0xce, 0xfd, 0xfe, 0xdd, 0xdc, 0x88, 0xdd, 0xba, 0xa9, 0xe6, 0x10, 0xbe, 0xfe, 0xf8, 0x5a, 0x08,
+  0xc1, 0x6a, 0x21, 0xf4, 0x4e, 0xbb, 0xee, 0xe6, 0x66, 0x41, 0x45, 0x1b, 0x50, 0xef, 0xed, 0xf5,
+  0x5f, 0x18, 0x11, 0xe4, 0x72, 0x08, 0x6f, 0x84, 0xff, 0x89, 0xb3, 0x16, 0xdd, 0xff, 0xfb, 0xeb,
+  0x63, 0x68, 0x03, 0xa5, 0x15, 0xb1, 0x05, 0x49, 0xd9, 0xff, 0xfc, 0xec, 0x4b, 0xf3, 0xe4, 0x02,
+  0x9f, 0x25, 0x5c, 0x5f, 0x67, 0x11, 0x24, 0x13, 0x27, 0x23, 0x2d, 0x33, 0x3c, 0x44, 0xf3, 0x8b,
+  0x1b, 0x36, 0x23, 0xfc, 0x1c, 0x0e, 0x00, 0x44, 0xf9, 0x88, 0xaf, 0xfe, 0xe6, 0xd3, 0x01, 0x76,
+  0xbb, 0xcd, 0xd7, 0x09, 0xf7, 0xcf, 0xb2, 0x9f, 0x95, 0x0a, 0x0a, 0xb4, 0x4c, 0x31, 0x5e, 0x01,
+  0x58, 0x01, 0x69, 0x08, 0x33, 0xcb, 0x19, 0x02, 0x00, 0x44, 0x53, 0xc3, 0x12, 0x08, 0x10, 0x54,
+  0x33, 0x06, 0x54, 0xec, 0x10, 0xae, 0x05, 0x34, 0x44, 0x54, 0x34, 0x84, 0x00, 0x34, 0x24, 0x53,
+  0x34, 0x23, 0x42, 0x44, 0x45, 0x00, 0x78, 0xa7, 0x58, 0x65, 0x76, 0x79, 0x8a, 0xb9, 0x00, 0xab,
+  0xde, 0xee, 0xee, 0x99, 0x9e, 0x88, 0xe8, 0x00, 0x74, 0x7a, 0x49, 0xe4, 0x9e, 0x48, 0xcc, 0x88,
+  0xa0, 0xa6, 0x59, 0x63, 0x96, 0x49, 0x9f, 0x22, 0x36, 0xcc, 0x02, 0x02, 0x64, 0x69, 0x08, 0x74,
+  0x28, 0x32, 0x73, 0x26, 0x32, 0xe0, 0x94, 0x27, 0x32, 0x73, 0x28, 0x64, 0x01, 0x61, 0x01, 0x2e,
+  0x04, 0x18, 0x32, 0x53, 0x38, 0x64, 0x01, 0xbd, 0x02, 0x53, 0x64, 0x37, 0x10, 0x47, 0x75, 0x78,
+  0x53, 0x8b, 0x01, 0xa6, 0x46, 0x44, 0x91, 0x97, 0x04, 0x96, 0x36, 0x45, 0xb0, 0x0c, 0x77, 0x98,
+  0x4b, 0x0b, 0x40, 0x8a, 0x44, 0x55, 0x46, 0x34, 0x55, 0x2c, 0x26, 0x64, 0x1c, 0x55, 0x66, 0x1c,
+  0x01, 0x49, 0x16, 0x6d, 0x68, 0xfe, 0xee, 0xcd, 0x40, 0xed, 0xde, 0xcd, 0xdc, 0xdd, 0xbb, 0x4e,
+  0x12, 0x66, 0x04, 0x6c, 0xbb, 0x7f, 0x01, 0xfc, 0xcf, 0xbb, 0xfb, 0xbf, 0x30, 0xbb, 0xed, 0xde,
+  0xef, 0x4c, 0x01, 0x00, 0x60, 0x77, 0x6d, 0x01, 0x33, 0x00, 0xdd, 0xea, 0xbf, 0xaa, 0xea, 0xae,
+  0xbc, 0x27, 0x23, 0x00, 0x83, 0x09, 0xe6, 0x13, 0x9e, 0xed, 0xb3, 0x0c, 0xae, 0xa8, 0x00, 0xc7,
+  0x6c, 0x75, 0xc6, 0x5c, 0x67, 0xc7, 0x8d, 0xc4, 0x9b, 0xeb, 0x5a, 0x00, 0xcd, 0xde, 0xfe, 0x4f,
+  0x24, 0xea, 0x12, 0x80, 0x7c, 0x8d, 0xee, 0x9a, 0xae, 0xef, 0x55, 0x25, 0x14, 0xfb, 0x64, 0x31,
+  0x55, 0x4e, 0x34, 0xe9, 0x19, 0x99, 0x45, 0x05, 0x00, 0x80, 0x07, 0xa4, 0x0c, 0xc0, 0x66, 0x67,
+  0x89, 0xab, 0xbb, 0xcd, 0xcf, 0x12, 0x00, 0x80, 0x70, 0xee, 0xed, 0xee, 0xde, 0x02, 0x00, 0xe4,
+  0x19, 0xad, 0x00, 0xee, 0xdf, 0xa8, 0x12, 0x2e, 0x54, 0x60, 0x58, 0xcb, 0x09, 0x5e, 0x01, 0x45,
+  0x4c, 0x04, 0x77, 0x1f, 0x30, 0x54, 0x24, 0x33, 0x45, 0x40, 0x14, 0x20, 0x00, 0x53, 0x44, 0x08,
+  0x56, 0x64, 0x34, 0x7b, 0x08, 0x24, 0x34, 0x56, 0x68, 0x00, 0x68, 0x97, 0x9b, 0xac, 0xd9, 0xab,
+  0xbc, 0xdf, 0x81, 0x46, 0x10, 0xa9, 0x9e, 0x88, 0xc8, 0x74, 0x8d, 0xcf, 0x02, 0x40, 0x56, 0x9e,
+  0x88, 0x95, 0x49, 0x64, 0xc3, 0x32, 0x53, 0x76, 0x28, 0x64, 0x11, 0xf2, 0x06, 0x83, 0xc3, 0x02,
+  0xcf, 0x22, 0xc6, 0x02, 0x63, 0x03, 0xd5, 0x02, 0x31, 0x04, 0x28, 0x33, 0x64, 0x59, 0x33, 0x83,
+  0x80, 0x39, 0x42, 0x93, 0x39, 0x64, 0x64, 0x57, 0x7c, 0x04, 0x04, 0x45, 0x96, 0xcf, 0x02, 0x47,
+  0x42, 0x84, 0x38, 0x53, 0xd0, 0x64, 0x67, 0x78, 0x76, 0x67, 0x01, 0x97, 0xd2, 0x12, 0x74, 0x00,
+  0x20, 0x44, 0x6c, 0x66, 0x96, 0x66, 0xcc, 0x2b, 0x63, 0x45, 0x1c, 0x99, 0xae, 0xe5, 0x04, 0xce,
+  0x0e, 0xcf, 0x42, 0xce, 0xcb, 0xdd, 0x80, 0xbd, 0xdb, 0xdc, 0xdc, 0xcb, 0xca, 0xa9, 0x3a, 0x21,
+  0x00, 0x66, 0x7a, 0xaa, 0xbc, 0xcc, 0xcc, 0xbc, 0xcb, 0x40, 0xbc, 0x9b, 0xb6, 0x78, 0x45, 0x65,
+  0x11, 0x20, 0x56, 0x69, 0x6a, 0x41, 0xbb, 0xbf, 0x43, 0x06, 0xef, 0xf5, 0x00, 0x55, 0x17, 0xfc,
+  0x02, 0xcc, 0x14, 0x30, 0x89, 0x9c, 0xbb, 0xdd, 0xde, 0xee, 0x00, 0xde, 0xfd, 0xef, 0xde, 0xfd,
+  0xee, 0xdd, 0xdd, 0x00, 0xdc, 0xaa, 0xa6, 0x76, 0x76, 0x7e, 0xee, 0xee, 0x00, 0xe8, 0xd9, 0x7d,
+  0x77, 0xc7, 0x8d, 0x78, 0xd9, 0x00, 0xde, 0xfa, 0xbc, 0x56, 0x6d, 0xde, 0xee, 0xf9, 0xf8, 0x9f,
+  0x66, 0xf4, 0x0c, 0x03, 0xa2, 0x45, 0x64, 0x01, 0x6b, 0x1f, 0x43, 0x24, 0x00, 0x45, 0xf6, 0x6f,
+  0x88, 0xfc, 0xcf, 0xff, 0xfa, 0x82, 0xaa, 0x67, 0x10, 0x67, 0xaa, 0x9b, 0xcc, 0xde, 0xc8, 0x12,
+  0x00, 0xfc, 0xdd, 0xbb, 0xc9, 0xbc, 0x8a, 0xb6, 0x9b, 0x00, 0x69, 0xb6, 0x9b, 0x6b, 0xc6, 0xbd,
+  0x5b, 0xc5, 0x00, 0xcd, 0x5b, 0xc5, 0xcc, 0x6b, 0xa7, 0xbb, 0x9c, 0x7c, 0xb6, 0x88, 0x9b, 0x03,
+  0x64, 0x01, 0xb7, 0x12, 0xcf, 0x22, 0x43, 0x34, 0x54, 0x30, 0x64, 0x45, 0x34, 0x54, 0x48, 0x22,
+  0x0b, 0x10, 0x34, 0x32, 0x26, 0x34, 0xc0, 0x15, 0x18, 0x1e, 0x44, 0x46, 0xd2, 0x02, 0x43, 0x44,
+  0x00, 0x55, 0x45, 0x67, 0x8a, 0xac, 0xda, 0xbc, 0x9b, 0x02, 0xbe, 0xac, 0x21, 0xfd, 0xdd, 0xb9,
+  0x8d, 0x87, 0x76, 0x04, 0x84, 0x9d, 0xcf, 0x02, 0x97, 0x7c, 0x87, 0x85, 0x48, 0x00, 0x53, 0x96,
+  0x39, 0x74, 0x96, 0x45, 0x33, 0x43, 0x40, 0x39, 0x64, 0x74, 0x47, 0x57, 0x53, 0x2a, 0x0b, 0x29,
+  0x01, 0xc9, 0x12, 0x73, 0x28, 0x33, 0x93, 0x28, 0x32, 0x63, 0x42, 0x29, 0x07, 0x27, 0x26, 0x45,
+  0x63, 0x48, 0x08, 0x10, 0x84, 0x98, 0x29, 0x53, 0x74, 0x4f, 0x07, 0x7f, 0x04, 0x39, 0x64, 0xc0,
+  0x05, 0x0c, 0x75, 0x36, 0x42, 0x0b, 0xad, 0x0c, 0x69, 0x87, 0x97, 0x7a, 0x03, 0xad, 0x0c, 0x9c,
+  0x25, 0x56, 0xd6, 0x6d, 0x67, 0xc6, 0x67, 0x81, 0xd3, 0x24, 0x64, 0x46, 0xbc, 0xce, 0xff, 0xde,
+  0x30, 0x52, 0x00, 0xbd, 0xcb, 0xdc, 0xad, 0xdb, 0xdc, 0xcd, 0xcc, 0x10, 0xcb, 0xab, 0xa9, 0x98,
+  0xbe, 0x72, 0x65, 0x66, 0x45, 0x2c, 0x64, 0x66, 0x67, 0x31, 0x66, 0x51, 0x66, 0x4c, 0x0e, 0xde,
+  0xed, 0x74, 0xdd, 0xdd, 0x60, 0x12, 0xde, 0x6a, 0x01, 0xd2, 0x32, 0x00, 0x30, 0x46, 0x10, 0x64,
+  0x66, 0x55, 0x64, 0x29, 0x60, 0x76, 0xcc, 0xce, 0x81, 0x8c, 0x01, 0xee, 0xee, 0xec, 0xdd, 0x9b,
+  0xb4, 0x44, 0x00, 0x1c, 0x76, 0xbb, 0xe0, 0x30, 0x9c, 0x02, 0xe6, 0x07, 0xfe, 0xdf, 0xde, 0x68,
+  0xfc, 0xdf, 0xbd, 0x02, 0x00, 0xfd, 0x09, 0x1f, 0xb1, 0x22, 0xdc, 0x23, 0x39, 0x0b, 0x35, 0x00,
+  0x9a, 0xbc, 0xde, 0x59, 0x00, 0xaa, 0xc7, 0x00, 0x8b, 0x67, 0xb7, 0x9d, 0x9b, 0xf8, 0xbf, 0x9b,
+  0x00, 0xf8, 0xcf, 0x9c, 0xe8, 0xcf, 0x9d, 0xe7, 0xdf, 0x00, 0x7d, 0xf6, 0xdf, 0x6d, 0xe7, 0xef,
+  0x8f, 0xf9, 0x00, 0xee, 0x8f, 0xe7, 0xdc, 0x19, 0x81, 0x87, 0x16, 0xbc, 0x53, 0x55, 0x55, 0x01,
+  0x31, 0x04, 0xa7, 0x1c, 0x6f, 0x18, 0x45, 0x3c, 0x02, 0x0e, 0x44, 0xe3, 0x19, 0x52, 0x04, 0x0e,
+  0x00, 0x34, 0x43, 0x54, 0x45, 0x17, 0xad, 0x0c, 0x0e, 0x10, 0xe9, 0x19, 0x45, 0xcc, 0x02, 0xab,
+  0xca, 0xcd, 0x04, 0xac, 0xda, 0xf6, 0x1b, 0xee, 0xdb, 0x99, 0x97, 0x69, 0x00, 0xaa, 0xba, 0x9c,
+  0xcc, 0x57, 0xa4, 0x9d, 0x49, 0x00, 0xe3, 0x7b, 0x8a, 0xba, 0xbd, 0x88, 0x77, 0x43, 0x25, 0x9c,
+  0x02, 0x75, 0x0d, 0x04, 0x37, 0x44, 0x40, 0x01, 0x63, 0x38, 0x58, 0x32, 0x94, 0x38, 0xc6, 0x22,
+  0xe0, 0x0c, 0x36, 0x37, 0x14, 0x93, 0x20, 0x38, 0x32, 0x63, 0x47, 0x47, 0xe7, 0x12, 0x39, 0x32,
+  0x00, 0x95, 0x46, 0x44, 0x65, 0x77, 0x57, 0x75, 0x87, 0x00, 0x47, 0x74, 0x78, 0x53, 0x96, 0x47,
+  0x53, 0x76, 0xe0, 0x87, 0x68, 0x76, 0x97, 0x68, 0x9f, 0x05, 0xcf, 0x02, 0x6a, 0x01, 0x02, 0x33,
+  0xaf, 0x04, 0x58, 0x45, 0xd6, 0x6d, 0x76, 0xd6, 0x20, 0x6d, 0x77, 0xc6, 0x68, 0x66, 0x09, 0x12,
+  0x68, 0x99, 0x07, 0xf9, 0x30, 0xe7, 0x00, 0xcf, 0x12, 0xcb, 0xdd, 0xdd, 0xcc, 0xcb, 0xa0, 0xbb,
+  0xaa, 0xa9, 0x99, 0x88, 0x60, 0x48, 0x66, 0x64, 0x01, 0x18, 0x64, 0x56, 0x46, 0x48, 0x71, 0xf5,
+  0x29, 0xfd, 0xdd, 0xdd, 0x40, 0xec, 0xdd, 0xcd, 0xdd, 0xdd, 0xdd, 0x6e, 0x01, 0xde, 0x98, 0xff,
+  0xee, 0xd6, 0x94, 0x71, 0x1b, 0x05, 0x46, 0x64, 0x66, 0x11, 0x00, 0x77, 0x78, 0x88, 0xaa, 0xab,
+  0xab, 0xab, 0xbb, 0x80, 0xab, 0xab, 0xaa, 0x9a, 0x88, 0x86, 0x77, 0x44, 0x00, 0x02, 0x56, 0x14,
+  0x33, 0x68, 0x88, 0x88, 0x89, 0x99, 0x99, 0x00, 0x99, 0xa9, 0xa9, 0x9a, 0xaa, 0x9a, 0x99, 0x9a,
+  0x20, 0x8a, 0xa8, 0x9a, 0x9a, 0xaa, 0x00, 0x00, 0xa9, 0x88, 0x04, 0x97, 0x76, 0x97, 0x44, 0x7d,
+  0xdd, 0xdd, 0xda, 0xac, 0x00, 0x77, 0xb5, 0x6c, 0x88, 0xe9, 0x9f, 0x99, 0xf9, 0x00, 0xaf, 0x8a,
+  0xe9, 0xaf, 0x9b, 0xe9, 0xbf, 0x8b, 0x02, 0xf9, 0x6a, 0x11, 0x6c, 0xe6, 0xcf, 0x7d, 0xf7, 0xdf,
+  0x00, 0x9e, 0xe8, 0xef, 0x9f, 0xf9, 0xee, 0x4a, 0xa2, 0x00, 0x98, 0x2a, 0x81, 0x98, 0x29, 0x71,
+  0x75, 0x25, 0x7c, 0x54, 0x45, 0x40, 0x34, 0xba, 0x12, 0x9c, 0x15, 0xb1, 0x35, 0x40, 0x14, 0x43,
+  0x07, 0x5b, 0x44, 0x27, 0x1e, 0xd5, 0x02, 0x8a, 0xba, 0xcd, 0xbc, 0xed, 0x00, 0xdd, 0xbc, 0xcf,
+  0xff, 0xdc, 0xca, 0x96, 0x85, 0x00, 0x28, 0x76, 0xac, 0xda, 0xcd, 0x9a, 0xbd, 0xdd, 0x04, 0x69,
+  0xb4, 0x6c, 0x08, 0x7a, 0x9b, 0xc7, 0x79, 0x55, 0x00, 0x66, 0x44, 0x96, 0x49, 0x63, 0x64, 0x57,
+  0x68, 0x01, 0x6a, 0x01, 0x64, 0x77, 0x57, 0x63, 0x57, 0x32, 0x73, 0x84, 0x25, 0x31, 0x55, 0x11,
+  0x29, 0x43, 0x63, 0x28, 0x6d, 0x01, 0x80, 0x42, 0x83, 0x36, 0x44, 0x74, 0x76, 0x46, 0xda, 0x19,
+  0x04, 0x29, 0x43, 0x23, 0x00, 0x74, 0x77, 0x58, 0x76, 0x86, 0x41, 0x22, 0x0a, 0x35, 0x96, 0x37,
+  0x53, 0x75, 0x67, 0x01, 0x87, 0x16, 0x69, 0xd2, 0x22, 0x6a, 0x11, 0x33, 0x4d, 0x03, 0x65, 0x33,
+  0xd5, 0x90, 0x6c, 0x66, 0xd6, 0x7d, 0x02, 0x10, 0xc6, 0x76, 0xd5, 0x22, 0x84, 0x6c, 0xdd, 0x5b,
+  0x4d, 0xcc, 0xed, 0xce, 0xdd, 0x42, 0x0b, 0x8c, 0xcb, 0xcc, 0xf7, 0x00, 0x09, 0x01, 0x99, 0x98,
+  0x88, 0xfa, 0x20, 0xed, 0x1f, 0x01, 0x55, 0x67, 0xf1, 0x00, 0x00, 0xec, 0x05, 0x20, 0x31, 0x05,
+  0x25, 0x87, 0x29, 0x2c, 0x30, 0x78, 0x8c, 0x33, 0x12, 0xfe, 0x00, 0x00, 0xee, 0xfe, 0xe1, 0xb1,
+  0x2b, 0xff, 0xbc, 0xd7, 0x88, 0x44, 0xa0, 0x97, 0x61, 0x7c, 0x31, 0x01, 0x00, 0x60, 0x68, 0x88,
+  0xdd, 0xdb, 0xbc, 0x75, 0xa7, 0x00, 0x7d, 0x87, 0xe8, 0x8e, 0x98, 0xf9, 0x9e, 0x99, 0x00, 0xf8,
+  0x9e, 0x99, 0xf9, 0x9e, 0x8a, 0xf9, 0xae, 0x08, 0x9b, 0xf8, 0xbe, 0xd8, 0x02, 0x8c, 0xf7, 0xcf,
+  0x7c, 0x20, 0xf9, 0xde, 0x8d, 0xf9, 0xef, 0x6a, 0x11, 0xe4, 0xaa, 0x20, 0x19, 0x92, 0x98, 0x1a,
+  0x82, 0x6a, 0x01, 0x96, 0x26, 0xfc, 0x53, 0x45, 0x4c, 0x01, 0xa2, 0x05, 0xe0, 0x00, 0x83, 0x06,
+  0xc3, 0x02, 0x1e, 0x2e, 0x58, 0x45, 0x43, 0x44, 0x9f, 0x15, 0xc9, 0x15, 0x64, 0x30, 0x04, 0xcd,
+  0x00, 0xac, 0xdd, 0xde, 0xef, 0xfb, 0xca, 0xcc, 0xa9, 0x40, 0x93, 0x86, 0x1b, 0x92, 0x87, 0x5a,
+  0xd8, 0x02, 0xcd, 0x09, 0x56, 0x06, 0x68, 0xb4, 0x37, 0x04, 0x68, 0x65, 0x77, 0x79, 0x50, 0x78,
+  0x96, 0x45, 0x86, 0x31, 0x11, 0x79, 0x6a, 0x01, 0x76, 0x10, 0x96, 0x56, 0x74, 0x38, 0x16, 0x07,
+  0x64, 0x86, 0x37, 0x06, 0x42, 0x0a, 0x07, 0xb0, 0x0f, 0x83, 0x27, 0x33, 0x64, 0x57, 0x88, 0x47,
+  0x65, 0x77, 0x7b, 0x18, 0x84, 0x37, 0x53, 0x88, 0x01, 0x03, 0x5b, 0x01, 0x02, 0x00, 0x74, 0x76,
+  0x47, 0x96, 0x36, 0x43, 0x18, 0x76, 0x87, 0x58, 0xd2, 0x12, 0x6a, 0x41, 0x8a, 0x33, 0x45, 0x01,
+  0x83, 0x00, 0x34, 0xc5, 0x6d, 0x56, 0xa4, 0x4c, 0x66, 0x80, 0xd6, 0x6c, 0x67, 0xd7, 0x6d, 0x66,
+  0xa6, 0xe7, 0x1b, 0x08, 0x45, 0x99, 0xaf, 0xd3, 0x22, 0xcf, 0xfc, 0xfe, 0xdf, 0x92, 0xfd, 0xaa,
+  0x1c, 0xbb, 0xba, 0x60, 0x02, 0x99, 0x87, 0xcb, 0x49, 0x40, 0x77, 0x79, 0x99, 0xaa, 0xab, 0xbb,
+  0x13, 0x00, 0x89, 0x43, 0x11, 0x30, 0x67, 0x31, 0xdc, 0xdc, 0xdd, 0xdc, 0xd1, 0x12, 0xdc, 0x38,
+  0xde, 0xee, 0xdd, 0xcf, 0x12, 0x8d, 0x42, 0x00, 0x10, 0x6b, 0xbb, 0x97, 0xa7, 0x06, 0x2b, 0x04,
+  0xf1, 0x02, 0xcc, 0x8a, 0x21, 0xcd, 0xce, 0x5e, 0x14, 0xa4, 0xbc, 0xc6, 0x1f, 0x40, 0x99, 0x8a,
+  0x5e, 0x00, 0xaa, 0x22, 0x24, 0x07, 0xb8, 0x41, 0x00, 0x00, 0x0a, 0x30, 0x88, 0x8c, 0xcc, 0xcc,
+  0xc8, 0x00, 0x5b, 0xa7, 0xda, 0x7d, 0xa8, 0xea, 0x9e, 0xa9, 0x80, 0xea, 0x8f, 0x99, 0xf9, 0x9f,
+  0x99, 0xf8, 0x02, 0x00, 0x40, 0xaf, 0x9a, 0xe9, 0xaf, 0x8b, 0xf9, 0x6a, 0x01, 0xbe, 0xc0, 0x9c,
+  0xf8, 0xcf, 0x9d, 0xe9, 0xdf, 0x6a, 0x11, 0xd2, 0x12, 0x00, 0x99, 0x19, 0x92, 0xa8, 0x19, 0x82,
+  0x98, 0x19, 0x08, 0x72, 0x96, 0x27, 0x43, 0x04, 0x53, 0x34, 0x34, 0x55, 0x0f, 0xad, 0x2c, 0x78,
+  0x38, 0x39, 0x1b, 0x40, 0x34, 0x45, 0x44, 0x57, 0x8a, 0x08, 0xac, 0xdb, 0xcd, 0xb9, 0x13, 0xea,
+  0xb7, 0xcc, 0x2e, 0x00, 0xe3, 0xed, 0x2c, 0xa2, 0xa9, 0x7a, 0xbc, 0x9a, 0x40, 0x9b, 0x84, 0xa6,
+  0x2e, 0xee, 0x8a, 0x67, 0x01, 0xe5, 0x01, 0x9c, 0x02, 0x8a, 0x78, 0xa5, 0x46, 0x85, 0x46, 0x44,
+  0xc4, 0x78, 0xa7, 0x00, 0x1b, 0x76, 0x69, 0x64, 0x64, 0x01, 0x02, 0x40, 0x91, 0x78, 0x08, 0x27,
+  0x42, 0x63, 0xc0, 0x02, 0x76, 0x47, 0x13, 0x07, 0x10, 0x74, 0x28, 0x63, 0x74, 0x5b, 0x04, 0x77,
+  0x58, 0x75, 0x8a, 0x87, 0x02, 0x00, 0x68, 0x61, 0x04, 0x86, 0x46, 0x44, 0xcf, 0x42, 0x04, 0x88,
+  0x68, 0xcf, 0x72, 0x64, 0x45, 0xc5, 0x5c, 0x45, 0x0c, 0x84, 0x5d, 0xa5, 0x05, 0x6a, 0x11, 0xb5,
+  0x5d, 0x76, 0x75, 0x09, 0x98, 0x00, 0x67, 0x78, 0x67, 0x21, 0xec, 0xff, 0xcf, 0xfd, 0x41, 0x79,
+  0x15, 0xcd, 0xdb, 0xbb, 0xaa, 0xaa, 0xf9, 0x20, 0x76, 0x34, 0xaa, 0x9e, 0x9d, 0x10, 0xef, 0x64,
+  0x15, 0x08, 0x10, 0xee, 0xe9, 0x02, 0x99, 0x67, 0x11, 0xfc, 0xcc, 0xcc, 0xcc, 0xcd, 0xcc, 0x9b,
+  0x91, 0x01, 0x00, 0x00, 0xce, 0x7d, 0x09, 0xb2, 0x22, 0xfd, 0xdd, 0xa8, 0x35, 0x98, 0xab, 0xbf,
+  0xff, 0x7d, 0x04, 0x00, 0x10, 0xdc, 0xcc, 0x07, 0x50, 0x48, 0xcc, 0xcd, 0xcd, 0xde, 0x08, 0xee,
+  0x77, 0x8d, 0x01, 0x6d, 0x11, 0x08, 0x00, 0xef, 0xee, 0xef, 0xeb, 0x18, 0x88, 0x88, 0x88, 0x44,
+  0xbb, 0xbd, 0x1f, 0x46, 0xdd, 0xd9, 0x99, 0x82, 0x11, 0x9d, 0x00, 0xdd, 0x95, 0xaa, 0x7d, 0xb7,
+  0xdb, 0x8e, 0xb8, 0x00, 0xeb, 0x8e, 0xb9, 0xfa, 0x9f, 0xa8, 0xea, 0x9f, 0x26, 0xa8, 0x3d, 0x04,
+  0x02, 0x00, 0xf8, 0x9f, 0x6a, 0x21, 0xbf, 0x9b, 0x40, 0xe9, 0xcf, 0x9c, 0xf8, 0xce, 0x9d, 0xd5,
+  0x22, 0x8e, 0x00, 0xf3, 0x99, 0x29, 0xa1, 0xaa, 0x29, 0x91, 0xa8, 0x00, 0x29, 0x81, 0xa8, 0x19,
+  0x72, 0x97, 0x18, 0x51, 0xbf, 0xbf, 0x09, 0x61, 0x01, 0xcf, 0x22, 0xb3, 0x1c, 0x93, 0x15, 0xe7,
+  0x12, 0x64, 0x31, 0x24, 0x01, 0x67, 0x00, 0xfd, 0xed, 0xbb, 0x4e, 0xe2, 0xfe, 0x2e, 0x00, 0xc2,
+  0xfc, 0x2e, 0xb3, 0xea, 0x29, 0x72, 0xeb, 0x00, 0x2e, 0xa2, 0x87, 0x2f, 0xee, 0xab, 0xc4, 0x8c,
+  0x00, 0x49, 0xd4, 0x35, 0x53, 0x55, 0x56, 0x55, 0x73, 0x20, 0x45, 0x54, 0x45, 0x34, 0x34, 0x0b,
+  0x13, 0x44, 0x64, 0xd8, 0x35, 0x33, 0x54, 0xa5, 0x05, 0x19, 0x17, 0x73, 0xec, 0x19, 0x48, 0x1b,
+  0x00, 0x53, 0x64, 0x36, 0x42, 0x75, 0x39, 0x64, 0x85, 0x04, 0x36, 0x45, 0xe6, 0x0c, 0x75, 0x87,
+  0x57, 0x75, 0x77, 0x81, 0x64, 0x01, 0x58, 0x75, 0x86, 0x45, 0x96, 0x47, 0x04, 0x07, 0x4b, 0xcf,
+  0x02, 0xd2, 0x22, 0x98, 0xa8, 0x05, 0x79, 0x33, 0xd4, 0x09, 0x64, 0x00, 0x45, 0xc4, 0x5b, 0xaa,
+  0xa4, 0x4c, 0x55, 0xd5, 0x00, 0x6b, 0x55, 0xb6, 0x79, 0x66, 0xc6, 0x6d, 0x67, 0x44, 0xd7, 0x69,
+  0x11, 0x09, 0x56, 0x55, 0x6f, 0xcf, 0x12, 0xff, 0x38, 0xdf, 0xed, 0xff, 0xb9, 0x06, 0x40, 0x01,
+  0xad, 0x2c, 0x88, 0x7e, 0x4d, 0x43, 0x01, 0xee, 0x4d, 0x21, 0x00, 0x20, 0xcd, 0xcc, 0x96, 0x02,
+  0xbb, 0x0c, 0xb8, 0x88, 0x67, 0x21, 0x14, 0x60, 0xdd, 0xee, 0xed, 0xed, 0xe6, 0xdc, 0x40, 0x24,
+  0x49, 0x11, 0x77, 0x66, 0x70, 0x01, 0x1e, 0x80, 0x00, 0x80, 0xe2, 0xcf, 0x61, 0x14, 0xcc, 0xcf,
+  0xff, 0x0e, 0x40, 0xa0, 0x01, 0xc1, 0x21, 0x0a, 0xdd, 0x86, 0x11, 0xdd, 0x59, 0x00, 0xcc, 0xc6,
+  0x66, 0xcd, 0x00, 0xda, 0x8a, 0xb6, 0xcc, 0x7d, 0xc8, 0xec, 0x8e, 0x40, 0xc8, 0xec, 0x9f, 0xb8,
+  0xfb, 0x9e, 0x6a, 0x01, 0xa9, 0x20, 0xfa, 0x8e, 0x99, 0xf9, 0x8f, 0x6a, 0x01, 0x89, 0xf9, 0x18,
+  0xae, 0x9a, 0xf8, 0x40, 0x04, 0x6a, 0x11, 0x8c, 0xf9, 0xcf, 0x00, 0x9d, 0xe8, 0xdf, 0x9d, 0xf8,
+  0xde, 0x28, 0x92, 0x00, 0x9a, 0x19, 0xa2, 0x99, 0x2a, 0x91, 0x98, 0x29, 0x80, 0x81, 0xa7, 0x29,
+  0x71, 0x97, 0x28, 0x52, 0xf8, 0x26, 0xc3, 0x6a, 0x51, 0x76, 0x21, 0x56, 0x55, 0x69, 0xbc, 0xcc,
+  0x02, 0x6b, 0x00, 0x10, 0xcd, 0xac, 0xc3, 0xee, 0xcc, 0x02, 0x2e, 0xc3, 0xfb, 0x00, 0x2e, 0xa2,
+  0xe9, 0x3e, 0x82, 0xca, 0x2c, 0xa2, 0x00, 0x88, 0x49, 0x9a, 0x44, 0x63, 0x57, 0x49, 0xe3, 0xb8,
+  0x24, 0x32, 0x44, 0x38, 0x00, 0x43, 0x07, 0xfc, 0x22, 0x54, 0xaf, 0x01, 0x00, 0x45, 0x44, 0x53,
+  0x34, 0x44, 0x55, 0x36, 0x53, 0x80, 0x56, 0x44, 0x74, 0x48, 0x53, 0x85, 0x38, 0xd8, 0x22, 0x1a,
+  0x38, 0x57, 0x08, 0x44, 0x64, 0x11, 0x5e, 0x01, 0x77, 0x58, 0x53, 0x00, 0x36, 0x45, 0x65, 0x67,
+  0x47, 0x64, 0x56, 0x32, 0x2c, 0x64, 0x37, 0xd8, 0x22, 0xa2, 0x85, 0x33, 0x47, 0x00, 0x65, 0x56,
+  0x00, 0x94, 0x5e, 0xff, 0xa4, 0x4b, 0x45, 0xb8, 0x8d, 0x10, 0xdd, 0xff, 0xfa, 0x88, 0xd5, 0x02,
+  0xc6, 0x7d, 0x76, 0x2a, 0xb6, 0x3d, 0x14, 0x46, 0xcf, 0x32, 0xff, 0x3a, 0x04, 0xde, 0xed, 0x40,
+  0x99, 0x96, 0x65, 0x77, 0x68, 0x88, 0x37, 0x01, 0xcb, 0x00, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb,
+  0xbc, 0xbc, 0x26, 0xbb, 0x01, 0x00, 0x07, 0x00, 0xcc, 0xcc, 0x64, 0x01, 0xef, 0xfc, 0x9c, 0xbb,
+  0xbb, 0x15, 0x10, 0x13, 0x10, 0x08, 0x20, 0xbc, 0xcc, 0x10, 0x00, 0xa4, 0xbb, 0xbb, 0x3a, 0x01,
+  0xef, 0xf8, 0x85, 0x11, 0xbc, 0x00, 0x00, 0x3f, 0x14, 0x40, 0x05, 0x00, 0x23, 0x00, 0x5c, 0x07,
+  0x3d, 0x00, 0x3b, 0x10, 0xff, 0xfc, 0x8c, 0xdc, 0xcb, 0x00, 0x00, 0x11, 0x10, 0xcc, 0xed, 0xec,
+  0x0b, 0x00, 0x0e, 0xbb, 0x0b, 0x30, 0x28, 0x00, 0x6e, 0x00, 0xcc, 0xc9, 0x39, 0xa5, 0x00, 0xbc,
+  0x8d, 0xd8, 0xed, 0x9e, 0xc8, 0xfd, 0x9e, 0x00, 0xc9, 0xfc, 0x9f, 0xc8, 0xfb, 0x9e, 0xb8, 0xfb,
+  0x78, 0x9f, 0xa9, 0xea, 0x10, 0x07, 0xab, 0x05, 0x16, 0x57, 0x6a, 0x01, 0xf9, 0x02, 0xce, 0x6a,
+  0x11, 0xe9, 0xdf, 0x8c, 0xe3, 0x9a, 0x17, 0x00, 0x81, 0x88, 0x18, 0x61, 0x85, 0x18, 0x42, 0x74,
+  0x88, 0x28, 0x42, 0x84, 0x02, 0x00, 0x16, 0x42, 0x54, 0x5e, 0x31, 0x29, 0x3d, 0x44, 0x55, 0x57,
+  0x63, 0x08, 0xbc, 0xd2, 0x01, 0xfe, 0xee, 0x40, 0x9b, 0x2b, 0xc2, 0xee, 0x2e, 0xd2, 0xcc, 0x12,
+  0x2f, 0x80, 0x93, 0xe9, 0x2e, 0x82, 0xa7, 0x48, 0xa9, 0xf3, 0x02, 0x20, 0x33, 0x53, 0x23, 0x36,
+  0xa3, 0xf2, 0x09, 0x24, 0x32, 0x7c, 0x33, 0x35, 0x2b, 0x0a, 0x31, 0x17, 0x22, 0x1a, 0xa3, 0x11,
+  0x02, 0x10, 0x53, 0x48, 0x44, 0x33, 0x54, 0xed, 0x02, 0x45, 0x63, 0x8c, 0x02, 0x67, 0x67, 0x5e,
+  0x04, 0xb0, 0x1f, 0x05, 0x10, 0x87, 0x57, 0x9b, 0x0c, 0x21, 0x0e, 0x73, 0xdc, 0x26, 0x43, 0x73,
+  0x01, 0xcc, 0x02, 0x6a, 0x51, 0x79, 0x02, 0x00, 0xcf, 0x02, 0xc1, 0x47, 0x03, 0xcc, 0xdd, 0xef,
+  0xa7, 0x7e, 0x36, 0x0b, 0xfa, 0x0a, 0x84, 0xbc, 0xc5, 0x3d, 0x04, 0x6d, 0x67, 0xd6, 0x7d, 0x3d,
+  0x14, 0x03, 0xcf, 0x12, 0x67, 0x11, 0xed, 0xef, 0xdd, 0xdc, 0x77, 0x57, 0xc0, 0x66, 0x77, 0x6f,
+  0xfe, 0xee, 0xdb, 0x3e, 0x21, 0x00, 0xb0, 0xfa, 0xdd, 0xe1, 0x0b, 0xfb, 0x16, 0xf0, 0x00, 0x40,
+  0xf5, 0x16, 0x1d, 0xf0, 0x3b, 0xf0, 0x03, 0x00, 0xf0, 0x8c, 0x01, 0xcf, 0xff, 0xb9, 0xaa, 0x4a,
+  0xa4, 0x00, 0xad, 0x6d, 0xe8, 0xee, 0x8f, 0xd9, 0xed, 0x9f, 0x02, 0xd8, 0x6a, 0x21, 0xb9, 0xeb,
+  0x8f, 0xb9, 0xfb, 0x8f, 0x87, 0xab, 0x25, 0xd8, 0x02, 0x40, 0x04, 0xae, 0x9a, 0xf9, 0xae, 0x40,
+  0x34, 0x00, 0x7b, 0xd6, 0x9b, 0x39, 0x71, 0x75, 0x29, 0x42, 0x00, 0x93, 0x29, 0x31, 0x92, 0x29,
+  0x22, 0xa1, 0x29, 0x00, 0x23, 0x91, 0x49, 0x24, 0xa2, 0x48, 0x22, 0x83, 0x80, 0x17, 0x52, 0x64,
+  0x25, 0x53, 0x44, 0x34, 0x1c, 0x07, 0x01, 0x57, 0x02, 0x69, 0xbc, 0x9c, 0xc9, 0xbb, 0xbc, 0xa9,
+  0x00, 0xc9, 0x6c, 0x55, 0xc2, 0x6d, 0x27, 0xd2, 0x8a, 0x00, 0x2e, 0xc2, 0xeb, 0x3e, 0xa2, 0xfa,
+  0x2e, 0x92, 0xc0, 0xd7, 0x3b, 0x97, 0xcc, 0xd4, 0x57, 0x46, 0x01, 0xfb, 0x09, 0x08, 0x33, 0x42,
+  0x24, 0xc2, 0x0c, 0x42, 0x44, 0x34, 0x32, 0x78, 0x33, 0x24, 0x34, 0x6d, 0x24, 0x07, 0x3a, 0xab,
+  0x28, 0x1d, 0x33, 0x35, 0xe0, 0x33, 0x45, 0x35, 0x64, 0x67, 0x61, 0x41, 0xce, 0x09, 0x5b, 0x01,
+  0x00, 0x64, 0x77, 0x43, 0x85, 0x38, 0x43, 0x64, 0x47, 0x3f, 0x0e, 0x00, 0xde, 0x02, 0x64, 0x31,
+  0xdd, 0x29, 0x9f, 0x25, 0x7c, 0x07, 0xbc, 0xdd, 0x33, 0x9e, 0x0c, 0x02, 0x20, 0xfa, 0x77, 0x7b,
+  0x18, 0x6a, 0x01, 0x7d, 0x66, 0x00, 0xd7, 0x77, 0x56, 0xff, 0xbf, 0xfc, 0xfe, 0xce, 0x01, 0x3a,
+  0x04, 0xfd, 0xfe, 0xd7, 0x86, 0x76, 0x66, 0x76, 0xc0, 0xee, 0xde, 0xfe, 0xba, 0xaa, 0xba, 0xa8,
+  0x05, 0x02, 0x40, 0xca, 0xba, 0x02, 0x50, 0xbf, 0x4d, 0x06, 0xab, 0xbb, 0x1a, 0x07, 0x0b, 0x00,
+  0x27, 0x06, 0x10, 0x02, 0xa0, 0x1d, 0x10, 0xfc, 0xbb, 0x0b, 0x10, 0xbc, 0xbb, 0x31, 0x4a, 0x04,
+  0xdd, 0xcb, 0xbc, 0x19, 0x50, 0x06, 0x20, 0xbf, 0xff, 0xec, 0xfe, 0xea, 0x37, 0x00, 0xf0, 0x09,
+  0xab, 0x52, 0x20, 0x14, 0x20, 0x59, 0x50, 0x01, 0x0e, 0x03, 0xb5, 0xab, 0x59, 0xa4, 0x9b, 0x5a,
+  0xe9, 0x80, 0xef, 0x9f, 0xe8, 0xfe, 0x9e, 0xe9, 0xfd, 0x6d, 0x01, 0x02, 0x8f, 0x6a, 0x01, 0xb8,
+  0xeb, 0x9f, 0xb9, 0xfb, 0x9e, 0x0c, 0xa9, 0xfa, 0xa8, 0x05, 0x40, 0x34, 0x9f, 0x9a, 0xf8, 0x9d,
+  0x00, 0x58, 0xb2, 0x78, 0x18, 0x71, 0x86, 0x18, 0x51, 0x00, 0x85, 0x18, 0x51, 0x95, 0x2a, 0x41,
+  0x93, 0x2a, 0x01, 0x6a, 0x11, 0xa2, 0x29, 0x13, 0xa2, 0x49, 0x14, 0x92, 0x00, 0x48, 0x12, 0x84,
+  0x18, 0x52, 0xa6, 0x19, 0x52, 0x00, 0x94, 0x18, 0x41, 0x83, 0x1a, 0x41, 0xa3, 0x1a, 0x00, 0x32,
+  0xd2, 0x2e, 0x33, 0xf2, 0x4e, 0x24, 0xe2, 0x00, 0x4c, 0x25, 0xf2, 0x7e, 0x27, 0xa2, 0xea, 0x2e,
+  0xf0, 0xa3, 0xd8, 0x2b, 0x85, 0xe7, 0x04, 0x4c, 0x01, 0x5e, 0x24, 0xc3, 0x05, 0xff, 0xdd, 0x0c,
+  0xd2, 0x12, 0x6d, 0x11, 0x6a, 0x21, 0xd5, 0x25, 0x6d, 0x11, 0x23, 0x50, 0x02, 0x10, 0x40, 0x34,
+  0x53, 0x35, 0x53, 0x65, 0x46, 0xf8, 0x06, 0x75, 0xe2, 0x76, 0xa1, 0x1c, 0x75, 0x77, 0x57, 0x75,
+  0x28, 0x02, 0x30, 0xd2, 0x32, 0x07, 0x05, 0x00, 0x3a, 0x04, 0xcf, 0x42, 0xbc, 0xdd, 0xef, 0xdf,
+  0xfd, 0x81, 0xcf, 0x12, 0xef, 0xf9, 0x44, 0xc5, 0x5d, 0x56, 0xd2, 0x02, 0x0f, 0xa5, 0x05, 0x51,
+  0x0b, 0x67, 0x01, 0xa2, 0x25, 0xfd, 0xdd, 0xc7, 0x75, 0x60, 0x77, 0x69, 0x98, 0xff, 0xeb, 0xd7,
+  0x1a, 0x00, 0xf0, 0xaa, 0xcd, 0x9c, 0x08, 0xfa, 0x15, 0xf0, 0x00, 0x50, 0xad, 0xdd, 0x1c, 0x04,
+  0x3e, 0x01, 0x9b, 0xce, 0x39, 0x3a, 0x17, 0xeb, 0x63, 0x01, 0x00, 0x50, 0xae, 0xee, 0x3b, 0xf0,
+  0x01, 0x00, 0x60, 0xdd, 0xdc, 0xab, 0xe9, 0xcc, 0x6a, 0xa4, 0x00, 0x9b, 0x59, 0xe8, 0xde, 0x8e,
+  0xf9, 0xef, 0x9f, 0x82, 0xe9, 0x6a, 0x41, 0x9f, 0xc9, 0xfc, 0x8f, 0xc9, 0xd5, 0x12, 0x06, 0x8e,
+  0x6a, 0x01, 0xec, 0x19, 0xe7, 0x7c, 0x36, 0xa1, 0x89, 0x00, 0x18, 0x81, 0x97, 0x16, 0x61, 0x76,
+  0x29, 0x91, 0x00, 0x97, 0x18, 0x62, 0xa5, 0x19, 0x52, 0x95, 0x19, 0x10, 0x42, 0xa3, 0x19, 0x32,
+  0x6a, 0x01, 0x91, 0x2a, 0x23, 0x02, 0x92, 0x6a, 0x21, 0x73, 0x28, 0x51, 0x96, 0x18, 0x42, 0x00,
+  0xb6, 0x2b, 0x52, 0xc5, 0x2e, 0x53, 0xf4, 0x2e, 0x00, 0x43, 0xf3, 0x2e, 0x33, 0xc2, 0x4e, 0x24,
+  0xe3, 0x00, 0x5f, 0x25, 0xc2, 0xa8, 0x2c, 0x97, 0xdc, 0xce, 0xf0, 0xff, 0xbc, 0xc4, 0x46, 0xef,
+  0x39, 0xbd, 0x12, 0x99, 0x15, 0x6f, 0x2b, 0x04, 0x44, 0x24, 0x6d, 0x11, 0x32, 0x24, 0x44, 0x43,
+  0x45, 0xba, 0x43, 0xea, 0x02, 0x53, 0x11, 0x00, 0x14, 0x13, 0x76, 0x21, 0x55, 0x23, 0x30, 0xa0,
+  0x33, 0x54, 0x46, 0x54, 0x66, 0x64, 0x01, 0x48, 0xa5, 0x25, 0x6f, 0xab, 0x45, 0x6a, 0x21, 0xcf,
+  0x22, 0xd2, 0x12, 0x79, 0xa7, 0x0c, 0x97, 0x01, 0xbd, 0x40, 0xdd, 0xff, 0xde, 0xfe, 0xff, 0xdf,
+  0x71, 0x0f, 0xfb, 0x40, 0x44, 0xc4, 0x5d, 0x56, 0xd5, 0x5c, 0xd2, 0x32, 0x76, 0x04, 0xfe, 0x9f,
+  0x67, 0x21, 0xcf, 0xfc, 0x99, 0x77, 0x76, 0x00, 0x77, 0x5f, 0xfe, 0xdd, 0xca, 0xa9, 0x9a, 0x9a,
+  0x7d, 0x02, 0x00, 0x99, 0x02, 0x20, 0x04, 0x00, 0x08, 0x10, 0x5f, 0x1c, 0x67, 0x01, 0xf9, 0x99,
+  0x5e, 0x1b, 0xa9, 0xa9, 0x04, 0x00, 0x1b, 0x00, 0x99, 0x9a, 0x08, 0x00, 0xe5, 0x20, 0x20, 0xa9,
+  0x12, 0x00, 0x9a, 0xaa, 0x4e, 0x08, 0x01, 0x04, 0x61, 0x11, 0x67, 0x00, 0x00, 0x6d, 0x21, 0x25,
+  0x1a, 0xa9, 0x99, 0x04, 0x00, 0x4e, 0x08, 0xff, 0x72, 0xe9, 0x29, 0x20, 0x99, 0xaa, 0x3a, 0x50,
+  0x33, 0x10, 0x5d, 0x20, 0xaa, 0x00, 0xed, 0xea, 0x67, 0xe8, 0xbd, 0x7b, 0xa4, 0x8a, 0x24, 0x48,
+  0xd7, 0x7a, 0x05, 0xef, 0x8e, 0xf6, 0x0d, 0xe9, 0xee, 0x90, 0x9f, 0xe8, 0xfd, 0x9e, 0x40, 0x34,
+  0xc8, 0xfb, 0x43, 0x04, 0x00, 0x9f, 0xa8, 0xe6, 0x6c, 0x24, 0x81, 0x58, 0x16, 0x00, 0x71, 0x87,
+  0x29, 0x81, 0x88, 0x28, 0x91, 0xab, 0x00, 0x19, 0xa1, 0x87, 0x2a, 0x71, 0x97, 0x29, 0x61, 0x04,
+  0xa6, 0x29, 0xd5, 0x22, 0x1a, 0x32, 0x92, 0x19, 0x12, 0x00, 0x72, 0x27, 0x23, 0x72, 0x37, 0x23,
+  0x72, 0x47, 0x00, 0x22, 0x72, 0x29, 0x51, 0xb7, 0x2c, 0x72, 0xe7, 0x00, 0x3e, 0x62, 0xe5, 0x2f,
+  0x52, 0xe4, 0x2c, 0x32, 0x80, 0xe3, 0x3e, 0x33, 0xe2, 0x5b, 0x4c, 0xdc, 0x2b, 0x1c, 0x3c, 0xfa,
+  0xbb, 0xf2, 0x56, 0x3a, 0x11, 0xd4, 0x3c, 0x01, 0x37, 0x42, 0x34, 0xb0, 0x34, 0x33, 0x43, 0x34,
+  0xc8, 0x06, 0x1a, 0x50, 0x45, 0xc6, 0x02, 0xff, 0xed, 0x02, 0x34, 0x0a, 0x5d, 0x3e, 0xff, 0x32,
+  0x6d, 0x31, 0xaa, 0x0c, 0x7b, 0x48, 0xd2, 0x22, 0x4d, 0xcf, 0x52, 0x69, 0xe7, 0x05, 0x73, 0x04,
+  0xbd, 0xed, 0xcf, 0x22, 0xfd, 0x80, 0xff, 0xef, 0xfc, 0x45, 0xc4, 0x5d, 0x45, 0xd2, 0x62, 0x00,
+  0xff, 0x6f, 0xfb, 0xee, 0xcf, 0xfc, 0xee, 0xce, 0xc2, 0xec, 0x3a, 0x00, 0x88, 0x6e, 0xfe, 0x99,
+  0xb5, 0x0d, 0xb8, 0x1d, 0x81, 0x00, 0x10, 0xbb, 0xbd, 0xdd, 0xdd, 0xdb, 0xbb, 0x0c, 0x40, 0x3e,
+  0x9f, 0x67, 0x41, 0x00, 0x90, 0x28, 0x50, 0x00, 0x10, 0xc6, 0x32, 0xbb, 0xb9, 0x98, 0x99, 0x89,
+  0x98, 0x16, 0x10, 0x3b, 0x00, 0xbb, 0xb9, 0x1f, 0x50, 0x68, 0x9c, 0xcc, 0xee, 0x3b, 0x00, 0x98,
+  0x3e, 0xd0, 0x00, 0x10, 0x9a, 0x00, 0xbb, 0xdd, 0xca, 0x46, 0xd7, 0x9e, 0x8b, 0xb4, 0x00, 0x7a,
+  0x48, 0xc6, 0x9e, 0x8d, 0xf9, 0xdf, 0x9d, 0x02, 0xe8, 0x23, 0x0b, 0xfe, 0x8f, 0xe9, 0xed, 0x8f,
+  0xd9, 0x40, 0xfd, 0x9f, 0xd8, 0xec, 0x9f, 0xc9, 0x81, 0x08, 0xe6, 0x00, 0x5a, 0x23, 0x71, 0x37,
+  0x14, 0x71, 0x68, 0x28, 0x00, 0x91, 0x78, 0x17, 0x91, 0x8b, 0x29, 0xc1, 0x9c, 0x08, 0x28, 0x81,
+  0x99, 0xd7, 0x19, 0x71, 0x97, 0x2a, 0x61, 0x80, 0x96, 0x29, 0x51, 0x94, 0x26, 0x42, 0x44, 0x31,
+  0x41, 0x01, 0xa5, 0x02, 0x68, 0xaa, 0x8a, 0x96, 0x98, 0x6b, 0x94, 0x00, 0xc8, 0x4c, 0x73, 0xc7,
+  0x3c, 0x54, 0xc6, 0x4c, 0x20, 0x65, 0xc6, 0x6b, 0x79, 0xc9, 0x64, 0x11, 0xfe, 0xff, 0xfc, 0x99,
+  0xa4, 0xa2, 0x22, 0x34, 0x21, 0x60, 0x1b, 0x01, 0x3a, 0x58, 0x11, 0xcf, 0x02, 0xbf, 0x14, 0x20,
+  0x31, 0x24, 0x11, 0x20, 0x26, 0x00, 0xcb, 0x1f, 0x13, 0x27, 0x35, 0x82, 0x01, 0x47, 0x35, 0x60,
+  0xdb, 0x22, 0xc3, 0x05, 0x46, 0x54, 0x76, 0xd5, 0x12, 0x76, 0x26, 0x87, 0xdd, 0x09, 0xcf, 0x12,
+  0x65, 0x74, 0x29, 0x43, 0xce, 0xfc, 0x13, 0x67, 0x11, 0x02, 0x00, 0xdd, 0xdc, 0xe3, 0x09, 0x45,
+  0xb4, 0x5b, 0x10, 0x66, 0xc6, 0x7a, 0x44, 0xd2, 0x02, 0xff, 0x5f, 0xf9, 0x01, 0x3a, 0x14, 0xce,
+  0xec, 0x78, 0x57, 0x76, 0xab, 0x9e, 0x80, 0xed, 0x89, 0x89, 0x98, 0x99, 0x88, 0x88, 0x02, 0x10,
+  0x83, 0xdc, 0x2d, 0xdf, 0x1d, 0xe9, 0xaa, 0x88, 0x98, 0x88, 0xab, 0x12, 0x52, 0xf8, 0xf9, 0x0a,
+  0x88, 0x89, 0x04, 0x10, 0x98, 0x04, 0x10, 0x87, 0x4c, 0x88, 0x78, 0x06, 0x10, 0x00, 0x20, 0x89,
+  0x98, 0xc3, 0x12, 0xf9, 0x0f, 0x37, 0x00, 0x17, 0x10, 0x16, 0x70, 0x06, 0x30, 0x8b, 0xcc, 0xfe,
+  0xe8, 0x0c, 0x88, 0x78, 0x17, 0x80, 0x00, 0x70, 0x8b, 0xbb, 0xba, 0xbb, 0x00, 0x57, 0xc6, 0x8e,
+  0x9b, 0xb5, 0x7a, 0x57, 0xb5, 0x0c, 0x8e, 0x8c, 0x23, 0x1b, 0x8e, 0x2c, 0xe9, 0xec, 0x8f, 0xc8,
+  0x01, 0xd8, 0x02, 0xfd, 0x8e, 0xc8, 0xe9, 0x5a, 0x52, 0x52, 0x00, 0x17, 0x12, 0x81, 0x38, 0x25,
+  0x81, 0x69, 0x15, 0x01, 0xd2, 0x02, 0xb2, 0x7c, 0x18, 0xc1, 0x68, 0x19, 0xa2, 0x89, 0xd7, 0x19,
+  0x1a, 0x92, 0xaa, 0x0c, 0x86, 0x25, 0x43, 0xf8, 0x26, 0x01, 0x6f, 0x22, 0x44, 0x54, 0x57, 0x9b,
+  0xca, 0xcd, 0xac, 0xd3, 0x1e, 0x1d, 0x4e, 0x02, 0xed, 0xcd, 0x3c, 0x1b, 0xee, 0x05, 0x10, 0x67,
+  0x01, 0xf4, 0xf8, 0x9a, 0xab, 0x52, 0x55, 0x6c, 0x0b, 0x43, 0x21, 0x02, 0x00, 0x90, 0x15, 0xff,
+  0xd1, 0x19, 0x7f, 0x21, 0x5b, 0x21, 0xaf, 0x51, 0x0a, 0x17, 0xae, 0x25, 0x11, 0x20, 0xd8, 0x02,
+  0xa7, 0x20, 0x30, 0xba, 0x35, 0x0b, 0x30, 0x34, 0x54, 0xf3, 0x02, 0x35, 0x76, 0x0b, 0x63, 0x6a,
+  0x04, 0x4a, 0x20, 0x55, 0x44, 0x53, 0x67, 0x11, 0xee, 0x06, 0xde, 0x40, 0xfd, 0xff, 0x99, 0xab,
+  0x88, 0xcc, 0x24, 0x0d, 0xfe, 0x08, 0xff, 0xa7, 0x7c, 0xb6, 0x1c, 0xff, 0x5f, 0xf6, 0xff, 0x20,
+  0xbe, 0xfc, 0xee, 0xbd, 0xdb, 0x04, 0x03, 0xde, 0xcc, 0xc6, 0xdc, 0x0e, 0x11, 0x02, 0x10, 0x88,
+  0x99, 0x8f, 0x69, 0x45, 0x29, 0x00, 0x78, 0xab, 0xba, 0xbb, 0x08, 0x10, 0x67, 0x21, 0x00, 0x60,
+  0xa0, 0x0f, 0x77, 0x73, 0x3a, 0x81, 0x54, 0x08, 0xcc, 0xc8, 0x08, 0x10, 0x3d, 0x20, 0x4c, 0xd1,
+  0xee, 0x63, 0x67, 0x11, 0x16, 0x60, 0x89, 0xbb, 0xa9, 0x91, 0x21, 0x1a, 0x20, 0xcc, 0x00, 0xc9,
+  0x56, 0xb5, 0x6f, 0x9a, 0xb5, 0x7a, 0x46, 0x44, 0xb5, 0x7e, 0xfc, 0x0d, 0x8c, 0xf9, 0xde, 0x20,
+  0x0b, 0x9d, 0x00, 0xe8, 0xed, 0x8e, 0xb7, 0xcb, 0x5b, 0x93, 0xa6, 0x00, 0x16, 0x82, 0x48, 0x24,
+  0x21, 0x71, 0x18, 0x12, 0x00, 0x72, 0x39, 0x13, 0x91, 0x38, 0x14, 0x82, 0x4a, 0x00, 0x15, 0xc2,
+  0x6c, 0x15, 0x92, 0x7a, 0x17, 0xa2, 0xc4, 0x89, 0x18, 0x6a, 0x01, 0x91, 0x88, 0x25, 0xe9, 0x43,
+  0x02, 0x00, 0x29, 0x6f, 0x22, 0x7a, 0xcc, 0x56, 0x0f, 0xee, 0xbd, 0x22, 0xcd, 0xec, 0xcd, 0x19,
+  0x0d, 0xff, 0xa1, 0x0b, 0xcc, 0x32, 0x88, 0x94, 0x43, 0x41, 0x25, 0x21, 0xf7, 0x55, 0x01, 0x16,
+  0x21, 0x0e, 0x20, 0x33, 0x45, 0x1b, 0x73, 0x31, 0x76, 0x31, 0x1d, 0x13, 0x7f, 0x3a, 0x21, 0xd2,
+  0x32, 0x7f, 0x31, 0x26, 0x60, 0x0e, 0x63, 0x17, 0x20, 0xc0, 0x45, 0x46, 0x7b, 0x9d, 0x11, 0xa8,
+  0x18, 0x56, 0x67, 0x11, 0xcf, 0x22, 0xed, 0x0a, 0x0d, 0x17, 0xfb, 0x02, 0xab, 0x67, 0x01, 0xc5,
+  0x55, 0x35, 0xff, 0x6e, 0xf5, 0x00, 0xff, 0x8f, 0xfb, 0xee, 0xbd, 0xda, 0x78, 0x57, 0x10, 0x75,
+  0xff, 0xdb, 0xba, 0x67, 0x51, 0x87, 0xcd, 0xcf, 0x4b, 0x9f, 0x20, 0x00, 0x90, 0xf7, 0x28, 0x0f,
+  0x78, 0x87, 0x04, 0x10, 0x78, 0x04, 0x77, 0x7b, 0x65, 0x0f, 0xfe, 0x77, 0x88, 0x77, 0x78, 0xa9,
+  0x11, 0x30, 0x87, 0x77, 0x72, 0x08, 0x88, 0x0e, 0x00, 0x87, 0x0a, 0x00, 0x03, 0x00, 0x30, 0x09,
+  0x50, 0x78, 0x77, 0x77, 0x7a, 0xaa, 0xff, 0x92, 0xf8, 0x0e, 0x20, 0x78, 0x88, 0x10, 0x00, 0x88,
+  0x8e, 0xaa, 0x1c, 0x14, 0x88, 0x87, 0x39, 0x20, 0x78, 0xf4, 0x01, 0xdd, 0xb9, 0x9b, 0x00, 0x78,
+  0xb5, 0x6a, 0x45, 0xb5, 0x7e, 0x8a, 0xe8, 0x00, 0xbf, 0x9b, 0xf8, 0xcf, 0x9c, 0xe9, 0xcd, 0x7b,
+  0x00, 0xb4, 0x99, 0x27, 0x92, 0x98, 0x18, 0x82, 0x5a, 0x00, 0x34, 0x93, 0x44, 0x28, 0x31, 0x83,
+  0x28, 0x22, 0x08, 0x92, 0x29, 0x12, 0x02, 0x00, 0xa2, 0x4c, 0x14, 0xc1, 0x00, 0x4a, 0x15, 0xa1,
+  0x5a, 0x26, 0xa1, 0x7a, 0x27, 0x30, 0x91, 0x8a, 0x26, 0x73, 0x4e, 0x75, 0xfb, 0x00, 0x33, 0x55,
+  0x14, 0x46, 0x8a, 0xcc, 0x12, 0xef, 0xcc, 0x22, 0xdd, 0xce, 0xef, 0xcd, 0x05, 0x00, 0xde, 0x45,
+  0x0d, 0x0e, 0x10, 0xf8, 0x89, 0x8a, 0x55, 0x2c, 0x30, 0x07, 0x3d, 0x71, 0x98, 0x1c, 0x0b, 0x20,
+  0x54, 0x57, 0x45, 0x84, 0x59, 0x20, 0x55, 0xa5, 0x5b, 0x55, 0xc6, 0x4e, 0x05, 0x6c, 0x65, 0xf1,
+  0x02, 0x10, 0x6a, 0x56, 0x53, 0xe1, 0x22, 0x82, 0x41, 0x62, 0x00, 0x1f, 0x07, 0x97, 0xf9, 0x62,
+  0x99, 0x68, 0x7e, 0x3e, 0x55, 0x22, 0x2d, 0x56, 0x89, 0xcf, 0x22, 0x4b, 0x6a, 0x01, 0xd2, 0x12,
+  0xdf, 0xe0, 0x29, 0xb4, 0x47, 0x46, 0x0a, 0x55, 0x00, 0xff, 0x5f, 0xf5, 0xff, 0x6e, 0xea, 0xee,
+  0xbc, 0x00, 0xc9, 0x78, 0x58, 0x75, 0xff, 0xda, 0xa8, 0x88, 0xf0, 0x67, 0x86, 0x78, 0x67, 0x1e,
+  0x11, 0xf4, 0x1a, 0xce, 0x16, 0x6a, 0x11, 0xbf, 0x75, 0x05, 0x0e, 0x10, 0x67, 0x11, 0x00, 0x50,
+  0x33, 0x0e, 0x2b, 0x01, 0x97, 0x10, 0x70, 0xc3, 0x54, 0x08, 0x0a, 0x50, 0x78, 0x99, 0x88, 0x89,
+  0x6d, 0x51, 0x00, 0x20, 0x28, 0x7a, 0xaa, 0xee, 0x3b, 0x80, 0x88, 0x29, 0x23, 0xcc, 0xc7, 0x09,
+  0x0f, 0x50, 0x79, 0x99, 0x94, 0x04, 0xdc, 0xca, 0x78, 0x95, 0x00, 0x6c, 0x67, 0xe8, 0xaf, 0x9b,
+  0xe8, 0xab, 0x58, 0x00, 0x92, 0x69, 0x16, 0x92, 0x78, 0x16, 0x82, 0x59, 0x00, 0x34, 0xb3, 0x4a,
+  0x44, 0x61, 0x65, 0x1a, 0x42, 0x10, 0x84, 0x29, 0x32, 0x93, 0x53, 0x08, 0x1a, 0x22, 0xc1, 0x00,
+  0x3d, 0x23, 0xc1, 0x3a, 0x24, 0x92, 0x5a, 0x15, 0x70, 0xa2, 0x5a, 0x16, 0x92, 0x25, 0x11, 0x2e,
+  0x24, 0x4b, 0x35, 0x35, 0x18, 0x75, 0x76, 0x79, 0xcc, 0x32, 0xda, 0x00, 0xde, 0xec, 0xdd, 0xe3,
+  0xc4, 0x2a, 0x40, 0x24, 0xfe, 0xff, 0x89, 0x99, 0x05, 0xf5, 0x53, 0x97, 0x61, 0x01, 0xdb, 0x22,
+  0x45, 0x45, 0x63, 0x34, 0x45, 0x53, 0x35, 0x00, 0x44, 0x66, 0x45, 0xd6, 0x6d, 0x76, 0xd7, 0x6d,
+  0x80, 0x66, 0xd7, 0x6d, 0x76, 0xd6, 0x6c, 0x76, 0xe6, 0x03, 0x11, 0x0b, 0x00, 0xc7, 0x6d, 0x66,
+  0xa4, 0x2c, 0x47, 0x54, 0x64, 0xff, 0xcb, 0x0c, 0x97, 0x24, 0x16, 0x07, 0x8a, 0x18, 0x41, 0x33,
+  0x70, 0x41, 0x16, 0x1d, 0x89, 0x60, 0x50, 0x69, 0xbc, 0xce, 0xfb, 0x67, 0x11, 0xcf, 0xa5, 0x25,
+  0xef, 0x40, 0xfd, 0xef, 0xcd, 0xe7, 0x67, 0x43, 0x2f, 0x20, 0xff, 0x02, 0x5e, 0x67, 0x01, 0xf6,
+  0xee, 0xac, 0xc9, 0x88, 0x57, 0x00, 0x85, 0xff, 0xca, 0xb9, 0x78, 0x68, 0x76, 0x77, 0x52, 0x67,
+  0x02, 0x10, 0x99, 0x8f, 0xcf, 0x52, 0xf9, 0x89, 0x08, 0x66, 0x00, 0x77, 0x7f, 0xff, 0xff, 0xe6,
+  0x67, 0x77, 0x66, 0x9a, 0x66, 0x03, 0x00, 0x67, 0x0e, 0x00, 0x67, 0x21, 0xbb, 0xa7, 0x0c, 0x20,
+  0x44, 0x76, 0x76, 0x10, 0x00, 0xaa, 0xac, 0xcb, 0x08, 0x00, 0x66, 0x88, 0x67, 0x67, 0x78, 0x1a,
+  0x20, 0xef, 0xfa, 0xaa, 0x2a, 0x20, 0x61, 0x02, 0x20, 0x69, 0x99, 0xff, 0xf7, 0x1a, 0x00, 0x3d,
+  0x00, 0x66, 0xc3, 0x4a, 0x00, 0x52, 0x17, 0xff, 0xff, 0xdc, 0xc6, 0x0a, 0x00, 0x1e, 0x10, 0x19,
+  0x41, 0x10, 0x6f, 0xff, 0xd5, 0x02, 0x00, 0x00, 0x75, 0x68, 0x45, 0x01, 0x75, 0x0c, 0x91, 0x59,
+  0x25, 0x71, 0x49, 0x34, 0xa3, 0x00, 0x4b, 0x34, 0xa3, 0x46, 0x34, 0x51, 0x76, 0x29, 0x00, 0x52,
+  0x95, 0x29, 0x42, 0x83, 0x19, 0x31, 0xa3, 0x00, 0x2c, 0x22, 0xc2, 0x1c, 0x12, 0xa2, 0x2a, 0x13,
+  0x60, 0xa1, 0x3a, 0x24, 0x91, 0x48, 0xfa, 0x07, 0xd7, 0x53, 0x45, 0x81, 0x12, 0x08, 0x64, 0x77,
+  0x47, 0x64, 0x79, 0xbc, 0x99, 0x15, 0x61, 0x5e, 0x01, 0xfd, 0xee, 0xbc, 0xde, 0xc6, 0x22, 0x73,
+  0x21, 0xff, 0x7c, 0xf9, 0xab, 0x8a, 0x45, 0x99, 0x42, 0xcc, 0x65, 0x3a, 0x31, 0x02, 0x00, 0x35,
+  0x38, 0x74, 0x75, 0x47, 0x55, 0x01, 0x67, 0x21, 0x02, 0x30, 0x76, 0xc6, 0x19, 0x70, 0x01, 0x6d,
+  0x76, 0xa4, 0x0c, 0x33, 0x2b, 0x47, 0x64, 0x75, 0xe4, 0x46, 0x33, 0x41, 0x20, 0x32, 0x34, 0x34,
+  0x07, 0x42, 0x1e, 0xae, 0x75, 0xc7, 0x44, 0x00, 0x39, 0x1b, 0x08, 0x20, 0x5b, 0xdf, 0xbe, 0x67,
+  0x21, 0x02, 0x10, 0x60, 0xfb, 0xdd, 0x89, 0xa5, 0x67, 0x3b, 0x26, 0xf5, 0x1c, 0xef, 0x80, 0x5f,
+  0xf6, 0xef, 0x5f, 0xf5, 0xee, 0x8c, 0xcf, 0x02, 0x10, 0x85, 0xee, 0xcd, 0xdb, 0x1b, 0x1a, 0x67,
+  0x75, 0x77, 0x09, 0x32, 0x01, 0x6d, 0xdc, 0x0e, 0x11, 0xef, 0xff, 0xaa, 0x96, 0x81, 0x1e, 0x01,
+  0x66, 0x66, 0x6d, 0xdd, 0xff, 0xf6, 0x08, 0x20, 0xf5, 0x00, 0x30, 0x6f, 0x93, 0x22, 0xd6, 0x10,
+  0x70, 0x09, 0x0b, 0x08, 0x30, 0xb3, 0x1c, 0x85, 0x07, 0x13, 0xee, 0x1b, 0x70, 0x6a, 0xaa, 0xee,
+  0xe6, 0x0d, 0x70, 0x05, 0x67, 0x31, 0xcd, 0x3b, 0x80, 0x66, 0x7f, 0xfe, 0xdd, 0xdc, 0x06, 0xcc,
+  0x42, 0x05, 0xd1, 0x23, 0x34, 0x62, 0x38, 0x23, 0xb3, 0x00, 0x4b, 0x44, 0xb3, 0x49, 0x34, 0x53,
+  0x43, 0x44, 0x00, 0x62, 0x87, 0x29, 0x62, 0x95, 0x17, 0x51, 0x94, 0x00, 0x2a, 0x42, 0xc4, 0x1d,
+  0x32, 0xb2, 0x19, 0x22, 0xf4, 0x92, 0x1a, 0x2c, 0x0b, 0x22, 0x31, 0x14, 0xd9, 0x4a, 0x02, 0x00,
+  0x64, 0x01, 0x31, 0x0a, 0x01, 0x67, 0x9a, 0xcd, 0xb8, 0x0a, 0x5e, 0x11, 0xfa, 0xcc, 0x73, 0x91,
+  0x4d, 0x6a, 0x21, 0xbb, 0xc4, 0x69, 0x65, 0x2f, 0x40, 0x6a, 0xb1, 0x44, 0x08, 0x33, 0x56, 0x46,
+  0x83, 0x0c, 0xc6, 0x6d, 0x77, 0xd9, 0x00, 0x9e, 0xa9, 0xda, 0xae, 0xbb, 0xeb, 0xbe, 0xba, 0x88,
+  0xd9, 0x9d, 0x88, 0xd8, 0x12, 0x7d, 0x76, 0x54, 0xcf, 0x02, 0x36, 0x87, 0x0f, 0x2e, 0x02, 0x00,
+  0x74, 0xf5, 0x06, 0x67, 0x14, 0x42, 0x34, 0x7e, 0x24, 0x02, 0x00, 0xdc, 0x01, 0x5e, 0x11, 0x4c,
+  0x57, 0x50, 0x00, 0xd8, 0x02, 0x34, 0x01, 0x67, 0x01, 0xfc, 0xdf, 0xbe, 0xf9, 0xbc, 0x8a, 0xb6,
+  0x16, 0x78, 0x81, 0x5b, 0xed, 0x32, 0x46, 0xcf, 0x22, 0xf5, 0xee, 0x5d, 0x22, 0xd8, 0x37, 0x04,
+  0xbc, 0x9e, 0xfc, 0x67, 0x11, 0x56, 0x75, 0x42, 0x66, 0x02, 0x10, 0x76, 0xcc, 0xce, 0xed, 0xdd,
+  0x03, 0x66, 0xa4, 0x66, 0x65, 0x0a, 0x11, 0x68, 0x88, 0x67, 0xa1, 0x6e, 0xb4, 0x12, 0x62, 0xdd,
+  0x67, 0xf1, 0x66, 0x66, 0xed, 0x61, 0x04, 0x00, 0x00, 0xfc, 0xb2, 0xbb, 0x1b, 0x70, 0x69, 0x99,
+  0x67, 0x91, 0x37, 0x44, 0xc6, 0x0f, 0x50, 0x02, 0x67, 0xdb, 0x15, 0xaa, 0xa4, 0x46, 0x45, 0x55,
+  0x46, 0x05, 0x98, 0x10, 0x58, 0xc9, 0x12, 0xa4, 0x4a, 0x34, 0x73, 0x43, 0x80, 0x44, 0x36, 0x33,
+  0x73, 0x82, 0x88, 0x29, 0x97, 0x0c, 0x00, 0x51, 0xa6, 0x2c, 0x51, 0xc4, 0x2c, 0x41, 0x94, 0x80,
+  0x2a, 0x31, 0xa3, 0x2a, 0x21, 0xa2, 0x28, 0xbb, 0x2d, 0x61, 0x25, 0x11, 0x43, 0x55, 0x46, 0x64,
+  0x3b, 0x1c, 0xac, 0x1d, 0x8a, 0x06, 0xbd, 0xcc, 0x22, 0xfb, 0x06, 0xed, 0xee, 0xef, 0xfb, 0xdc,
+  0xff, 0x40, 0x34, 0xa8, 0x05, 0x1f, 0x34, 0xcf, 0x52, 0x64, 0x51, 0x5a, 0x38, 0x05, 0x00, 0xcf,
+  0x02, 0x00, 0x56, 0x47, 0x74, 0x76, 0x46, 0xd8, 0x8e, 0xcb, 0xa0, 0xec, 0xbe, 0xcb, 0xec, 0xce,
+  0x05, 0x00, 0xcc, 0x08, 0x00, 0xf8, 0xea, 0xad, 0x77, 0x6a, 0x01, 0xfa, 0x1d, 0x00, 0x1e, 0x30,
+  0x1b, 0x02, 0x00, 0x44, 0x64, 0x63, 0x40, 0x14, 0x32, 0x43, 0x23, 0xda, 0x2c, 0x23, 0x0f, 0xb3,
+  0x0f, 0x78, 0x05, 0x7b, 0x58, 0x05, 0x00, 0x44, 0x34, 0x67, 0x89, 0xb8, 0x57, 0x85, 0x67, 0x9e,
+  0x10, 0xd6, 0x41, 0x4f, 0x14, 0x54, 0x5e, 0x27, 0x08, 0xef, 0x5e, 0xf5, 0x02, 0x00, 0xee, 0x5d,
+  0xe5, 0x88, 0x40, 0x47, 0x85, 0x99, 0x6f, 0xfc, 0x67, 0x61, 0x01, 0x57, 0x15, 0x64, 0x01, 0x65,
+  0x02, 0x10, 0x55, 0x02, 0x10, 0x55, 0x55, 0x66, 0xd2, 0x65, 0x05, 0x00, 0x56, 0x66, 0x9f, 0x05,
+  0x55, 0x0c, 0x00, 0x03, 0x00, 0xc8, 0x56, 0x65, 0x55, 0xcf, 0x22, 0xdd, 0xd5, 0x0b, 0x00, 0x0d,
+  0x10, 0x91, 0x1e, 0x00, 0xbb, 0xbc, 0xbb, 0x08, 0x20, 0x66, 0xbb, 0xad, 0x2c, 0xbc, 0xbb, 0xb5,
+  0x0a, 0x00, 0x1c, 0x00, 0x3d, 0x20, 0x37, 0x04, 0xf5, 0x36, 0x10, 0x22, 0x56, 0x0f, 0x00, 0x65,
+  0x65, 0xa9, 0xcf, 0x22, 0xba, 0xa5, 0x67, 0x2c, 0x00, 0x56, 0x10, 0xc5, 0x0c, 0xbb, 0xb5, 0x5f,
+  0x03, 0xc7, 0x37, 0x34, 0x08, 0x93, 0x4a, 0x44, 0xcc, 0x02, 0x93, 0x45, 0x34, 0x34, 0x80, 0x43,
+  0x83, 0x3a, 0x43, 0x73, 0x92, 0x87, 0x02, 0x0e, 0x80, 0x1a, 0x72, 0xc7, 0x1d, 0x62, 0xc5, 0x19,
+  0x02, 0x1e, 0xf0, 0xa4, 0x19, 0x32, 0x83, 0xec, 0x10, 0x50, 0x09, 0x6c, 0x12, 0x69, 0x32, 0x31,
+  0x67, 0x01, 0x86, 0x58, 0xce, 0xf2, 0x06, 0x5b, 0x21, 0xac, 0xce, 0xe5, 0xe5, 0x07, 0xcd, 0x0b,
+  0x30, 0xdd, 0xe4, 0xc3, 0x32, 0xb3, 0x49, 0x64, 0x71, 0x83, 0xce, 0x66, 0x9c, 0x05, 0x57, 0x57,
+  0x75, 0x79, 0x78, 0x5e, 0x01, 0xc0, 0xfc, 0xce, 0xcc, 0xed, 0xce, 0xcc, 0x6a, 0x01, 0x08, 0x00,
+  0xe0, 0xec, 0xbd, 0x98, 0xd7, 0x7d, 0x67, 0x11, 0xcf, 0x02, 0x8f, 0x0c, 0xf3, 0x9b, 0x3c, 0x02,
+  0x00, 0x43, 0x63, 0xa5, 0x15, 0xa7, 0x0f, 0xda, 0x0c, 0xab, 0x25, 0xf1, 0x1c, 0x5a, 0x53, 0x45,
+  0x33, 0x61, 0x1a, 0x84, 0x68, 0xe4, 0x22, 0x39, 0x02, 0x09, 0x72, 0x3e, 0x43, 0x24, 0x34, 0x04,
+  0xef, 0x5e, 0xe5, 0xef, 0x00, 0x5d, 0xe4, 0xab, 0x48, 0x84, 0x78, 0x5f, 0xfc, 0x00, 0xbc, 0x97,
+  0x74, 0x67, 0x46, 0x65, 0x66, 0x46, 0xbc, 0x65, 0x56, 0x35, 0x01, 0x02, 0x00, 0x58, 0x31, 0x24,
+  0x11, 0x66, 0xd7, 0x09, 0xe3, 0x08, 0x10, 0x13, 0x10, 0x55, 0x55, 0x5f, 0x4c, 0x31, 0x1b, 0x30,
+  0x00, 0x10, 0x83, 0x60, 0x05, 0x08, 0x30, 0x66, 0x58, 0x88, 0x9a, 0x97, 0x34, 0x40, 0x59, 0x00,
+  0x40, 0x59, 0x99, 0x0b, 0x03, 0x0d, 0x60, 0xaa, 0x58, 0x24, 0x89, 0xc2, 0x85, 0x84, 0x21, 0x6b,
+  0xbb, 0xcc, 0xc7, 0x62, 0x13, 0xe8, 0x34, 0x00, 0x43, 0x57, 0x34, 0x73, 0x47, 0x35, 0x73, 0x54,
+  0x00, 0x24, 0x33, 0x42, 0x34, 0x27, 0x32, 0x83, 0x38, 0x00, 0x33, 0x63, 0x92, 0x78, 0x17, 0x72,
+  0x88, 0x1b, 0x00, 0x82, 0xb7, 0x1b, 0x72, 0xb6, 0x19, 0x61, 0x96, 0x00, 0x19, 0x52, 0x94, 0x19,
+  0x32, 0x44, 0x45, 0x43, 0x9c, 0x66, 0x46, 0x5e, 0x41, 0x02, 0x20, 0x69, 0x12, 0x78, 0xab, 0x2b,
+  0x44, 0xcc, 0xfd, 0xee, 0x70, 0x61, 0x07, 0x07, 0x56, 0x74, 0xba, 0x42, 0xb7, 0x12, 0x07, 0xc6,
+  0x52, 0x02, 0xa0, 0x6f, 0x08, 0x57, 0x48, 0x74, 0x7c, 0xba, 0x41, 0x64, 0x11, 0xcf, 0xdc, 0xec,
+  0xbf, 0xdc, 0x05, 0x00, 0xed, 0x80, 0xce, 0xdc, 0xec, 0xcf, 0xcc, 0xd7, 0x79, 0x5f, 0x5f, 0x2f,
+  0x02, 0x00, 0x95, 0x0c, 0x70, 0x11, 0x38, 0x03, 0x46, 0xae, 0x02, 0x22, 0x44, 0x7e, 0x23, 0x86,
+  0x00, 0xa2, 0x45, 0x45, 0x8e, 0xa7, 0x6f, 0x6e, 0x23, 0xcf, 0x42, 0x43, 0x05, 0x6f, 0x0e, 0x44,
+  0xcf, 0x72, 0xcd, 0x49, 0xa3, 0x88, 0x5a, 0x00, 0xb8, 0xfe, 0xc7, 0x75, 0x66, 0x46, 0x64, 0x66,
+  0xf2, 0x45, 0x02, 0x00, 0x54, 0x56, 0xa9, 0x0b, 0x56, 0x41, 0xc3, 0x12, 0x10, 0x07, 0xf3, 0x3a,
+  0x71, 0x67, 0x21, 0x88, 0x85, 0x10, 0x70, 0x42, 0x09, 0x08, 0x30, 0xb5, 0x04, 0xe9, 0x00, 0xd0,
+  0x5a, 0xaa, 0x67, 0x91, 0xcc, 0x67, 0x21, 0xe6, 0x02, 0xbb, 0x01, 0x18, 0xcc, 0xcb, 0xbb, 0x11,
+  0x0c, 0xce, 0x46, 0x55, 0x46, 0x65, 0x01, 0xcf, 0x2e, 0x43, 0x63, 0x46, 0x34, 0x74, 0x47, 0x45,
+  0x00, 0x75, 0x46, 0x64, 0x76, 0x36, 0xa1, 0x6a, 0x16, 0x00, 0x91, 0x7a, 0x17, 0x91, 0x79, 0x18,
+  0x91, 0x88, 0x80, 0x18, 0x81, 0x87, 0x18, 0x61, 0x85, 0x36, 0xc3, 0x72, 0x76, 0x76, 0x64, 0x41,
+  0x67, 0x11, 0x7d, 0x34, 0x44, 0x9c, 0x75, 0x02, 0x00, 0xf5, 0x3f, 0x86, 0x16, 0x61, 0x51, 0x9c,
+  0x55, 0xdb, 0x62, 0x7e, 0x38, 0x67, 0x11, 0x57, 0x54, 0x12, 0x7e, 0x64, 0x11, 0xed, 0xcf, 0x05,
+  0x80, 0xce, 0xdc, 0xe8, 0xbc, 0x76, 0x56, 0x56, 0x2f, 0x5f, 0x5f, 0x70, 0x11, 0x6a, 0x11, 0x54,
+  0x35, 0x10, 0x9f, 0x34, 0x04, 0x8b, 0x34, 0x22, 0x6a, 0xc3, 0x22, 0x61, 0x71, 0x56, 0x54, 0x82,
+  0x21, 0x21, 0x64, 0x21, 0x23, 0x44, 0x5e, 0xef, 0x67, 0x31, 0xdf, 0x5d, 0x00, 0xe4, 0xde, 0x4b,
+  0xb3, 0x89, 0x47, 0x85, 0xee, 0x40, 0xbd, 0xeb, 0x67, 0x46, 0x64, 0x56, 0x02, 0x10, 0x54, 0x10,
+  0x56, 0x45, 0x54, 0x55, 0x02, 0x60, 0x5d, 0xdd, 0xff, 0x10, 0xf9, 0xa9, 0x44, 0x55, 0xc4, 0x1b,
+  0x54, 0x54, 0x44, 0x47, 0x67, 0x31, 0x0d, 0x00, 0x02, 0x30, 0x45, 0x45, 0x45, 0x0e, 0x10, 0x65,
+  0x8a, 0x54, 0xa3, 0x04, 0x55, 0x0c, 0x00, 0x45, 0x45, 0x44, 0x2a, 0x20, 0x64, 0x45, 0x55, 0x07,
+  0x20, 0x4c, 0xcc, 0x73, 0x04, 0x38, 0x40, 0x44, 0x12, 0x45, 0x22, 0x1a, 0xfe, 0xee, 0xc2, 0x01,
+  0x66, 0x6c, 0xcc, 0x84, 0xaa, 0xb4, 0x98, 0x10, 0x34, 0x55, 0x45, 0x55, 0xc3, 0x1e, 0x01, 0xd4,
+  0x00, 0x58, 0x65, 0x73, 0x36, 0x33, 0x53, 0x36, 0x00, 0x43, 0x53, 0x47, 0x35, 0x74, 0x58, 0x34,
+  0x64, 0x10, 0x35, 0xa1, 0x5a, 0x15, 0x6a, 0x01, 0xa1, 0x7a, 0x17, 0x80, 0xa1, 0x8a, 0x18, 0x91,
+  0x89, 0x18, 0x62, 0xc0, 0x62, 0x0d, 0xd1, 0x23, 0x74, 0x9c, 0x05, 0x6d, 0x01, 0x87, 0x47, 0x89,
+  0xae, 0x53, 0xac, 0x1a, 0xaf, 0x1a, 0xfb, 0xdd, 0x05, 0x10, 0xfd, 0x67, 0x11, 0x78, 0xbb, 0x9b,
+  0x2c, 0xcf, 0x92, 0x35, 0x70, 0x14, 0x02, 0x70, 0x14, 0x10, 0x52, 0x67, 0x11, 0x00, 0x87, 0x8e,
+  0xdc, 0xfd, 0xce, 0xdc, 0xfd, 0xde, 0x40, 0xdc, 0xfd, 0xdf, 0xdd, 0xed, 0xdf, 0x08, 0x20, 0xcf,
+  0x78, 0xdc, 0xd8, 0x87, 0x92, 0x10, 0x95, 0x30, 0x64, 0x11, 0x6d, 0x61, 0x74, 0xfa, 0x35, 0x38,
+  0x00, 0x32, 0xca, 0x00, 0xcf, 0x72, 0x70, 0x61, 0xbf, 0x4f, 0x74, 0x30, 0x81, 0x64, 0x31, 0x42,
+  0x43, 0x34, 0xdc, 0xfc, 0xcf, 0x67, 0x21, 0x01, 0x37, 0x14, 0xcd, 0x4c, 0xd3, 0xbc, 0x28, 0x85,
+  0x89, 0x00, 0x5e, 0xfc, 0xcd, 0xa6, 0x64, 0x56, 0x45, 0x64, 0x23, 0x61, 0x61, 0x48, 0x00, 0x44,
+  0x56, 0x65, 0xae, 0x02, 0xee, 0xeb, 0x3e, 0xbb, 0x65, 0x21, 0xc8, 0x01, 0x67, 0x41, 0x47, 0x21,
+  0x4d, 0x01, 0x45, 0x44, 0xf4, 0x45, 0x65, 0x3a, 0x01, 0xdd, 0xd9, 0x07, 0x2c, 0x00, 0x24, 0x00,
+  0x13, 0x20, 0xc3, 0x57, 0x21, 0x2c, 0x00, 0x45, 0x44, 0x4e, 0xee, 0x73, 0x04, 0x8c, 0x11, 0x11,
+  0x18, 0x00, 0x54, 0x54, 0xfe, 0x07, 0x08, 0xfd, 0xdd, 0x45, 0xb0, 0x46, 0x66, 0xcc, 0xc9, 0x0b,
+  0x0f, 0xb5, 0x07, 0x47, 0xcb, 0x20, 0x02, 0x68, 0x02, 0x10, 0x86, 0x57, 0x33, 0x64, 0x46, 0x53,
+  0x00, 0x64, 0x36, 0x53, 0x63, 0x46, 0x56, 0x83, 0x47, 0x40, 0x34, 0x63, 0x36, 0x91, 0x49, 0x14,
+  0x6a, 0x11, 0x6b, 0x79, 0x6a, 0x21, 0x88, 0x17, 0xbd, 0x22, 0x2a, 0x25, 0xc2, 0x03, 0xd2, 0x62,
+  0x76, 0xe8, 0x47, 0xcd, 0xed, 0x58, 0x11, 0xee, 0x5e, 0x01, 0xb5, 0x0a, 0xd8, 0x42, 0x7e, 0xbc,
+  0xb3, 0x29, 0xef, 0x10, 0x98, 0x26, 0x02, 0xb0, 0x0a, 0x51, 0x67, 0x11, 0x56, 0x00, 0x58, 0xca,
+  0xaf, 0xdd, 0xed, 0xcf, 0xdd, 0xfd, 0x00, 0xcf, 0xed, 0xee, 0xdf, 0xdc, 0xfe, 0xde, 0xdd, 0x80,
+  0xfd, 0xdf, 0xdc, 0xed, 0xde, 0xdc, 0x97, 0x64, 0x11, 0xe7, 0x95, 0x10, 0x05, 0x30, 0xdb, 0x82,
+  0x57, 0x33, 0xb3, 0x3c, 0x1d, 0x63, 0x4d, 0x10, 0x67, 0xcc, 0x12, 0x61, 0x57, 0x14, 0x10, 0x42,
+  0x44, 0x96, 0x18, 0x2b, 0x07, 0x33, 0x20, 0x4d, 0xcf, 0xcc, 0xf7, 0x5f, 0xcf, 0x52, 0xe5, 0xde,
+  0x00, 0x4c, 0xd4, 0xbc, 0x3a, 0xb3, 0x78, 0x49, 0x96, 0x00, 0xee, 0xcd, 0xeb, 0x88, 0x56, 0x54,
+  0x56, 0x35, 0x03, 0xcf, 0x12, 0xca, 0x2b, 0x55, 0x99, 0x8e, 0xee, 0xee, 0xd7, 0xf0, 0x77, 0xcb,
+  0xbe, 0xee, 0x28, 0x01, 0x2b, 0x11, 0x67, 0x51, 0xb2, 0x12, 0x01, 0x00, 0x30, 0x49, 0x89, 0xef,
+  0xe8, 0x78, 0xff, 0xfc, 0x02, 0xcc, 0x0f, 0x50, 0x44, 0x44, 0x47, 0x77, 0xcc, 0xc4, 0x93, 0x0a,
+  0x40, 0x04, 0x0a, 0xee, 0xec, 0x1a, 0x50, 0x45, 0x55, 0x8d, 0x28, 0x40, 0xcc, 0x55, 0x5b, 0xbc,
+  0xaa, 0xa3, 0x64, 0x01, 0x57, 0x0b, 0xc5, 0x00, 0x02, 0x70, 0x83, 0xa6, 0x0a, 0x26, 0x43, 0x53,
+  0x35, 0x40, 0x53, 0x65, 0x47, 0x56, 0x84, 0x58, 0x67, 0x01, 0x53, 0x10, 0x57, 0x14, 0x81, 0x48,
+  0x02, 0x00, 0x15, 0x71, 0x67, 0x88, 0x26, 0x73, 0x66, 0x55, 0x01, 0x58, 0x74, 0x76, 0x68, 0x49,
+  0xe3, 0xd2, 0x12, 0x40, 0x24, 0x65, 0x75, 0x67, 0xd1, 0x19, 0xc3, 0x22, 0x82, 0x3d, 0xe0, 0xdf,
+  0xfe, 0xef, 0xce, 0xe4, 0x49, 0x41, 0x64, 0x31, 0xc3, 0xa2, 0xab, 0x08, 0x60, 0x02, 0x10, 0x34,
+  0xca, 0x0d, 0xec, 0xcc, 0x02, 0xdf, 0x64, 0x01, 0x02, 0xdd, 0x64, 0x01, 0xfe, 0xdf, 0xed, 0xfe,
+  0xde, 0xed, 0x75, 0xd8, 0x02, 0x66, 0x98, 0x70, 0x69, 0x08, 0x50, 0xdb, 0x22, 0x6a, 0x01, 0x83,
+  0x3a, 0x34, 0xa0, 0x11, 0x53, 0x58, 0x41, 0x05, 0x20, 0x70, 0x61, 0x45, 0x43, 0x2a, 0x44, 0xfb,
+  0x19, 0x43, 0x02, 0x00, 0x43, 0x93, 0x18, 0xcc, 0xec, 0x80, 0xcf, 0x75, 0xf7, 0x6f, 0xef, 0x5d,
+  0xf5, 0x02, 0x00, 0x00, 0xee, 0x5d, 0xf4, 0xce, 0x4c, 0xe4, 0xcd, 0x3b, 0x00, 0xc3, 0xab, 0x37,
+  0x85, 0x89, 0x5d, 0xda, 0xef, 0x00, 0xdd, 0xeb, 0xab, 0x99, 0x97, 0x88, 0x68, 0x87, 0x00, 0x89,
+  0x7a, 0xa9, 0xcc, 0xbe, 0xee, 0xff, 0xeb, 0x34, 0xbb, 0x67, 0x62, 0x0c, 0x6f, 0xf8, 0x06, 0x2d,
+  0x41, 0xaa, 0xaf, 0x92, 0xff, 0xc4, 0x0d, 0xcc, 0xc5, 0xcf, 0x22, 0x44, 0x44, 0xc5, 0x0c, 0x88,
+  0xbb, 0xb6, 0x66, 0x50, 0x0f, 0xee, 0xe8, 0x88, 0x78, 0x05, 0x0f, 0xe2, 0x0d, 0x1c, 0x14, 0x37,
+  0x27, 0x10, 0x0a, 0xee, 0xed, 0xdd, 0x99, 0x10, 0x9f, 0xfe, 0x66, 0x64, 0x91, 0x31, 0x99, 0xff,
+  0xfb, 0x80, 0xcc, 0xdd, 0xde, 0xee, 0xaa, 0xab, 0xbb, 0x9b, 0x00, 0x08, 0x76, 0x97, 0x69, 0x02,
+  0x70, 0x87, 0x69, 0x33, 0x53, 0xb0, 0x25, 0x22, 0x43, 0x25, 0xd0, 0x0a, 0x68, 0x09, 0x45, 0x67,
+  0x01, 0xe4, 0x73, 0x46, 0x02, 0x10, 0x74, 0x47, 0x55, 0x04, 0xb9, 0x53, 0x8f, 0x56, 0xc7, 0xcf,
+  0x12, 0xd1, 0x29, 0x34, 0x04, 0xad, 0xff, 0xdf, 0xc9, 0x32, 0x05, 0x10, 0xfd, 0xd5, 0x32, 0xff,
+  0x01, 0x17, 0xfb, 0x56, 0xcf, 0x92, 0x0b, 0x60, 0x08, 0x40, 0x27, 0x08, 0x7c, 0x56, 0x56, 0x5b,
+  0x11, 0x64, 0x01, 0x05, 0x10, 0x08, 0x30, 0x70, 0x01, 0xdc, 0x27, 0x5e, 0x11, 0x98, 0x50, 0x6a,
+  0xd1, 0x76, 0x47, 0x1b, 0x2e, 0x35, 0x43, 0x7e, 0x43, 0xfc, 0x08, 0x02, 0x20, 0xe3, 0x09, 0x5e,
+  0x01, 0xc3, 0x42, 0x2b, 0x04, 0x24, 0x01, 0x93, 0x28, 0x24, 0x55, 0x7c, 0xcf, 0xcb, 0xf7, 0x6f,
+  0x30, 0x65, 0xf7, 0x6f, 0xdf, 0xcc, 0x02, 0xcf, 0x42, 0xe4, 0xcd, 0x00, 0x4b, 0xd3, 0xbc, 0x29,
+  0xa3, 0x78, 0x57, 0x85, 0x00, 0x99, 0x7b, 0xc9, 0xdd, 0xbe, 0xec, 0xee, 0xde, 0x64, 0xfd, 0xee,
+  0x3f, 0x0c, 0xba, 0xa9, 0x06, 0x1e, 0x42, 0x3b, 0xfe, 0x40, 0xee, 0xbb, 0xba, 0xaa, 0xaa, 0xad,
+  0xab, 0x05, 0x99, 0x89, 0x40, 0x11, 0xef, 0xff, 0xc8, 0x06, 0xbc, 0xbd, 0xdd, 0x9f, 0x02, 0xc7,
+  0x09, 0x3b, 0xe3, 0x36, 0x26, 0x00, 0xcc, 0xc8, 0x88, 0xb0, 0x4c, 0x62, 0x3f, 0x60, 0x7d, 0xdd,
+  0xfe, 0xfb, 0xcc, 0x3a, 0x00, 0x9d, 0x01, 0xba, 0x00, 0xb6, 0x66, 0x77, 0x6e, 0xee, 0xee, 0xf6,
+  0x67, 0x14, 0x44, 0x57, 0xc5, 0x00, 0x78, 0x02, 0x00, 0x77, 0x97, 0x79, 0x00, 0x77, 0x87, 0x69,
+  0x77, 0x93, 0x46, 0x32, 0x52, 0x30, 0x24, 0x32, 0x44, 0x35, 0x77, 0x0c, 0xa0, 0x0d, 0x46, 0x84,
+  0x01, 0xa2, 0x15, 0x33, 0x63, 0x46, 0x44, 0x74, 0x58, 0x56, 0x5e, 0x84, 0x5b, 0x01, 0xb9, 0x33,
+  0x00, 0x58, 0x92, 0x26, 0x65, 0xcc, 0x02, 0x77, 0x38, 0x8a, 0xcd, 0xee, 0xc0, 0x12, 0x9f, 0x25,
+  0x05, 0x30, 0xff, 0xdf, 0x3c, 0xf9, 0xaa, 0x64, 0xf1, 0xcf, 0x42, 0x08, 0x80, 0x23, 0x30, 0x33,
+  0x4a, 0x3a, 0x9a, 0xc6, 0x12, 0xde, 0x64, 0x31, 0xd5, 0x02, 0xcf, 0x12, 0xfe, 0xdb, 0xb0, 0xab,
+  0x76, 0x87, 0x79, 0x98, 0x20, 0x05, 0x00, 0x69, 0x02, 0x00, 0x07, 0x76, 0x21, 0x6a, 0x41, 0x02,
+  0x00, 0x22, 0x44, 0x45, 0x32, 0x33, 0x63, 0xae, 0x02, 0x78, 0x08, 0x23, 0x32, 0x34, 0x05, 0x00,
+  0xb9, 0x00, 0x24, 0x98, 0x33, 0x34, 0x24, 0x30, 0x0e, 0x02, 0x10, 0x44, 0x33, 0x1a, 0x00, 0x00,
+  0x43, 0x46, 0x68, 0xdd, 0xfb, 0xaf, 0x75, 0xf6, 0x10, 0x5f, 0x65, 0xf6, 0x5f, 0xcf, 0x32, 0xdf,
+  0x5d, 0xf5, 0x01, 0x67, 0x01, 0xce, 0x4c, 0xd4, 0xbd, 0x3b, 0xc3, 0x9a, 0x00, 0x37, 0x85, 0x78,
+  0x47, 0x85, 0x78, 0x57, 0x75, 0x01, 0x02, 0x00, 0x67, 0x57, 0x76, 0x67, 0x56, 0x76, 0x67, 0x0c,
+  0x67, 0x75, 0x1d, 0x0f, 0xd2, 0x12, 0x6a, 0xba, 0xcc, 0xcd, 0x12, 0xdc, 0x5b, 0x01, 0x88, 0x86,
+  0x80, 0x3c, 0xa9, 0xbb, 0xbc, 0xe0, 0xbc, 0xbc, 0xbb, 0xab, 0x89, 0x0e, 0x30, 0x6b, 0x31, 0x00,
+  0x00, 0x62, 0x76, 0x0a, 0x40, 0x87, 0x87, 0x87, 0xdb, 0x02, 0x53, 0x3f, 0xee, 0x05, 0x00, 0x10,
+  0xff, 0xdb, 0x02, 0xaa, 0x98, 0x99, 0x87, 0x8a, 0xa0, 0xaa, 0xcc, 0xc3, 0x45, 0x66, 0xc8, 0x20,
+  0x87, 0xcb, 0x00, 0x02, 0x98, 0x08, 0x10, 0x65, 0x72, 0x35, 0x32, 0x53, 0x25, 0x08, 0x32, 0x45,
+  0x47, 0x10, 0x14, 0x75, 0x46, 0x34, 0x63, 0x01, 0x3a, 0x34, 0x46, 0x35, 0x74, 0x57, 0x45, 0x85,
+  0x68, 0x5c, 0x44, 0x75, 0x65, 0x09, 0x6a, 0x01, 0x8c, 0x46, 0x65, 0x6d, 0x21, 0x64, 0xb4, 0x77,
+  0x89, 0x99, 0x15, 0xfd, 0x04, 0x47, 0xd5, 0x62, 0xcd, 0x34, 0x24, 0x8f, 0x28, 0x74, 0xa8, 0x55,
+  0xdd, 0x79, 0x11, 0x80, 0x33, 0x4d, 0xcb, 0x61, 0x21, 0xb2, 0xee, 0x02, 0x10, 0xef, 0xed, 0x02,
+  0x10, 0x0e, 0x00, 0xd7, 0xfd, 0x11, 0x3e, 0x76, 0x9b, 0x00, 0x64, 0x11, 0x06, 0x22, 0xd8, 0x42,
+  0xae, 0x45, 0x22, 0x43, 0xff, 0x83, 0x1f, 0x02, 0x00, 0xb7, 0x12, 0x6d, 0x11, 0x8a, 0x0a, 0x0b,
+  0x10, 0xbf, 0x0c, 0xc2, 0x1c, 0x81, 0x31, 0x04, 0x43, 0x34, 0x88, 0xbd, 0xdf, 0x99, 0x64, 0x11,
+  0x1e, 0x6f, 0x6a, 0x01, 0xcc, 0x22, 0x6a, 0x31, 0x67, 0x21, 0x4b, 0xd3, 0xbd, 0x90, 0x39, 0xa4,
+  0x88, 0x57, 0x67, 0x21, 0x56, 0x76, 0x35, 0x02, 0x81, 0x64, 0x01, 0x77, 0x67, 0x87, 0x99, 0x88,
+  0x88, 0x8c, 0x0f, 0x33, 0x10, 0x8e, 0x00, 0xe0, 0x68, 0x88, 0x5e, 0x41, 0x00, 0xb0, 0x88, 0x8d,
+  0x00, 0xcd, 0x89, 0x95, 0x68, 0x44, 0x64, 0x57, 0x45, 0x00, 0x75, 0x57, 0x56, 0x76, 0x68, 0x78,
+  0x99, 0x9a, 0x88, 0xaa, 0xbc, 0xcc, 0x76, 0x01, 0x88, 0x95, 0x56, 0x64, 0x41, 0x05, 0x02, 0x00,
+  0xa7, 0x05, 0x10, 0x34, 0x63, 0x25, 0x32, 0x47, 0x40, 0x56, 0xb8, 0x8d, 0xaa, 0xc9, 0x97, 0xe4,
+  0x0e, 0x36, 0x12, 0x23, 0x32, 0x00, 0x83, 0x57, 0x3d, 0x14, 0x74, 0x58, 0x45, 0x72, 0x73, 0x02,
+  0x00, 0x47, 0x44, 0x93, 0x18, 0x92, 0x66, 0x6a, 0x01, 0x79, 0x0c, 0xbc, 0xdd, 0x64, 0x21, 0x5b,
+  0x21, 0xde, 0xfd, 0xff, 0xce, 0xf4, 0xfd, 0xee, 0x73, 0x31, 0x66, 0x98, 0x0f, 0x34, 0xf4, 0x99,
+  0x55, 0xcf, 0xd2, 0x9c, 0x4f, 0xdd, 0x5e, 0x41, 0x64, 0x41, 0x70, 0x21, 0xd7, 0x68, 0x98, 0x10,
+  0x47, 0x02, 0xe0, 0x49, 0x24, 0xd2, 0x12, 0x33, 0x43, 0x34, 0x18, 0x0e, 0x42, 0x74, 0x43, 0x33,
+  0x52, 0x01, 0x43, 0x22, 0x24, 0x76, 0x71, 0x6d, 0x01, 0x34, 0x80, 0x24, 0x44, 0x6c, 0xbe, 0xdd,
+  0xf8, 0x7f, 0xc9, 0x02, 0x47, 0x02, 0x30, 0x64, 0x01, 0x02, 0x30, 0xde, 0x5c, 0xf5, 0xa2, 0x05,
+  0xbd, 0x02, 0x3b, 0xd2, 0x12, 0xab, 0x59, 0xa6, 0x89, 0x68, 0x96, 0x00, 0x89, 0x68, 0x86, 0x89,
+  0x78, 0x87, 0x89, 0x79, 0xc8, 0x98, 0x99, 0x89, 0x02, 0x20, 0x88, 0x87, 0xd2, 0x02, 0x02, 0x40,
+  0x18, 0x67, 0x77, 0x98, 0x79, 0x01, 0x58, 0x61, 0x67, 0x77, 0x88, 0xe8, 0x88, 0x88, 0x99, 0x12,
+  0x00, 0x87, 0xce, 0x12, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x08, 0x30, 0xcc, 0xca, 0xab, 0x45, 0x73,
+  0x46, 0x46, 0x25, 0x6c, 0x15, 0x57, 0x9c, 0x02, 0x44, 0x73, 0x3a, 0x11, 0x56, 0x76, 0x00, 0x78,
+  0x33, 0x56, 0x67, 0x77, 0xa7, 0x7a, 0x78, 0x20, 0x97, 0x7a, 0x87, 0xa7, 0x89, 0x67, 0x11, 0x94,
+  0x47, 0x00, 0x65, 0x7b, 0x98, 0xeb, 0xbf, 0xcb, 0xeb, 0xbf, 0x00, 0xba, 0xeb, 0xae, 0x99, 0x84,
+  0x53, 0x35, 0x34, 0x0a, 0x64, 0x37, 0x04, 0x47, 0xc9, 0x02, 0x46, 0x94, 0x47, 0x45, 0x62, 0x84,
+  0x7b, 0x08, 0x57, 0x56, 0x83, 0x60, 0x0b, 0x4e, 0x42, 0x65, 0xf0, 0x77, 0x78, 0xab, 0xcd, 0xc0,
+  0x12, 0x64, 0x01, 0x05, 0x20, 0x70, 0x11, 0xa3, 0xc0, 0x04, 0x6d, 0x01, 0xdf, 0xfa, 0xbc, 0x46,
+  0x21, 0x35, 0xcf, 0xb2, 0xcf, 0x45, 0x3e, 0x6a, 0x21, 0xcc, 0x07, 0x8a, 0x88, 0x76, 0x7f, 0xc0,
+  0x22, 0x61, 0x61, 0xe9, 0x0b, 0x20, 0xed, 0xd7, 0xfd, 0x11, 0x87, 0x02, 0x00, 0xa1, 0x00, 0x71,
+  0x53, 0xe3, 0xdb, 0x22, 0xe8, 0x04, 0x68, 0x76, 0x94, 0xfd, 0x0d, 0x34, 0x54, 0xbd, 0x42, 0x03,
+  0x73, 0x41, 0x14, 0x40, 0x47, 0x89, 0xdd, 0xfb, 0xbf, 0x66, 0x1b, 0x64, 0x51, 0x67, 0x21, 0xf6,
+  0x6a, 0x81, 0xd2, 0x32, 0xd4, 0xbd, 0x4a, 0x10, 0xb5, 0x9a, 0x79, 0xa7, 0x02, 0x20, 0x97, 0x9a,
+  0x79, 0x08, 0x98, 0x9a, 0x89, 0x02, 0x00, 0xa9, 0x99, 0x89, 0x99, 0x87, 0x6d, 0x01, 0x40, 0x01,
+  0x00, 0x00, 0x98, 0x89, 0x98, 0x89, 0x56, 0x11, 0x29, 0x03, 0x10, 0x88, 0x89, 0x00, 0x10, 0x99,
+  0x00, 0x20, 0x89, 0x99, 0x02, 0x88, 0x02, 0x80, 0x99, 0x88, 0x8a, 0xaa, 0xdd, 0xd4, 0x81, 0x77,
+  0x0c, 0x25, 0x34, 0x65, 0x79, 0x56, 0x94, 0xd7, 0x46, 0x12, 0x45, 0x6f, 0x05, 0x94, 0x68, 0xf8,
+  0x0d, 0x34, 0x65, 0x57, 0x00, 0x77, 0x95, 0x68, 0x78, 0x98, 0x8a, 0x9a, 0xaa, 0x00, 0xab, 0x87,
+  0x8c, 0xaa, 0xfc, 0xbf, 0xcb, 0xfb, 0x04, 0xbe, 0xba, 0x02, 0x20, 0xa9, 0xd6, 0x63, 0x36, 0x45,
+  0x00, 0x72, 0x36, 0x34, 0x74, 0x57, 0x56, 0x95, 0x69, 0x01, 0x2c, 0x10, 0x74, 0x57, 0x23, 0x63,
+  0x46, 0x55, 0x83, 0x10, 0x57, 0x34, 0x75, 0x57, 0xe6, 0x10, 0x86, 0x78, 0xac, 0xf6, 0xdd, 0x5e,
+  0x31, 0x05, 0x20, 0xfe, 0x5e, 0x11, 0x02, 0x00, 0xde, 0x02, 0x0e, 0x00, 0x64, 0xde, 0xf4, 0x55,
+  0x21, 0x53, 0x44, 0x49, 0x11, 0xa7, 0x06, 0x44, 0xb9, 0x70, 0x01, 0x34, 0x34, 0x1a, 0x09, 0x14,
+  0x00, 0x0b, 0x00, 0x44, 0xfd, 0x1a, 0x4e, 0x43, 0x23, 0x1f, 0x14, 0x10, 0xa1, 0x09, 0xaa, 0x9f,
+  0x5e, 0x31, 0xfe, 0x05, 0x05, 0x00, 0xff, 0x6a, 0x51, 0xea, 0xa7, 0x79, 0x78, 0x97, 0x7c, 0x79,
+  0x78, 0x05, 0x00, 0x02, 0x20, 0x09, 0x12, 0x73, 0x11, 0x6d, 0x31, 0x68, 0xf8, 0x44, 0x63, 0x34,
+  0xbd, 0x12, 0xba, 0x12, 0x64, 0x61, 0x61, 0x41, 0x6d, 0x01, 0xb8, 0x32, 0x48, 0x89, 0xea, 0x0c,
+  0x31, 0x24, 0x02, 0x20, 0xf5, 0x67, 0xb1, 0x82, 0x5c, 0x02, 0x00, 0xe5, 0xce, 0x4b, 0xe4, 0xce,
+  0x3a, 0x04, 0x00, 0x4b, 0xd4, 0xac, 0x5a, 0xa7, 0x9a, 0x8a, 0xa7, 0x00, 0x9a, 0x89, 0xa8, 0xaa,
+  0x89, 0xa8, 0xab, 0x9a, 0x82, 0xa9, 0x02, 0x00, 0xaa, 0x99, 0xa9, 0x99, 0x99, 0xd8, 0x22, 0x33,
+  0x00, 0xf0, 0x00, 0x20, 0xaa, 0xa9, 0x21, 0x10, 0x00, 0xa0, 0x9d, 0xdd, 0x08, 0xab, 0xb4, 0x47,
+  0x45, 0x08, 0x64, 0x74, 0x68, 0x56, 0x80, 0x95, 0x68, 0x45, 0x83, 0x47, 0x44, 0x72, 0x48, 0x08,
+  0x22, 0x57, 0x37, 0x01, 0x34, 0x75, 0x58, 0x78, 0x05, 0x23, 0x66, 0x00, 0x68, 0xbb, 0xbe, 0xee,
+  0xee, 0xec, 0xbb, 0xeb, 0x80, 0xaf, 0xcb, 0xfc, 0xce, 0xcb, 0xfb, 0xbf, 0x08, 0x00, 0x2a, 0xba,
+  0x02, 0x00, 0xc6, 0x12, 0x0e, 0x63, 0x3a, 0x04, 0x58, 0x46, 0x14, 0x85, 0x79, 0x6a, 0x01, 0x35,
+  0x78, 0x58, 0x46, 0x94, 0x58, 0xe0, 0x45, 0x76, 0x58, 0x9a, 0xbd, 0xb7, 0x22, 0x64, 0x21, 0x61,
+  0x31, 0x99, 0x6d, 0x11, 0xfc, 0xee, 0xab, 0x05, 0x14, 0x00, 0x79, 0x94, 0xa5, 0x02, 0x9f, 0x55,
+  0x21, 0xd2, 0xd2, 0x79, 0x21, 0x3d, 0x84, 0xd7, 0x39, 0xdc, 0xcf, 0xc0, 0x02, 0x2a, 0xfd, 0x37,
+  0x64, 0xff, 0x05, 0x20, 0xb7, 0x3b, 0x06, 0xa7, 0x89, 0xc1, 0x6b, 0x33, 0x88, 0x97, 0x7a, 0x78,
+  0x98, 0x7a, 0x03, 0x6a, 0x41, 0xb0, 0x65, 0x74, 0x45, 0x23, 0xfe, 0x46, 0xf5, 0x56, 0x34, 0x01,
+  0x67, 0x00, 0x23, 0x33, 0x48, 0x8a, 0xee, 0xee, 0xef, 0xdc, 0x5c, 0xf7, 0x6f, 0xcc, 0x02, 0x02,
+  0x10, 0x64, 0x21, 0x55, 0x67, 0x01, 0x6d, 0xa6, 0xf5, 0x02, 0x40, 0x6a, 0x11, 0xf4, 0xcf, 0x6a,
+  0x21, 0xbe, 0xd2, 0x02, 0x00, 0x4b, 0xd6, 0xab, 0x8a, 0xb8, 0xab, 0x8a, 0xb9, 0x00, 0xab, 0x9b,
+  0xb9, 0xbb, 0x9b, 0xca, 0xbb, 0xab, 0x00, 0xca, 0xbb, 0xaa, 0xba, 0xaa, 0x9a, 0xa9, 0x9a, 0x31,
+  0x4f, 0x01, 0x99, 0xa9, 0x9a, 0x76, 0x01, 0x00, 0x00, 0x9a, 0x9a, 0xdb, 0x0e, 0x00, 0x11, 0x10,
+  0xaa, 0x1b, 0x00, 0x89, 0x08, 0xbb, 0x14, 0x10, 0x00, 0x80, 0x00, 0xab, 0xbe, 0xee, 0x55, 0x74,
+  0x36, 0x32, 0x54, 0xf0, 0x46, 0x75, 0x75, 0x47, 0x96, 0x02, 0x31, 0x04, 0x66, 0x05, 0x67, 0x01,
+  0x03, 0x70, 0x01, 0x7e, 0x05, 0x34, 0x75, 0x69, 0x56, 0x84, 0x68, 0x00, 0x23, 0x65, 0x57, 0xbb,
+  0xbb, 0x98, 0xfd, 0xcf, 0x1a, 0xcc, 0xcf, 0x02, 0xec, 0x67, 0x01, 0x37, 0x04, 0xbe, 0xba, 0xa5,
+  0x4c, 0x53, 0x36, 0xc0, 0x02, 0x6a, 0x04, 0x56, 0x95, 0x67, 0x01, 0x68, 0x04, 0x46, 0x83, 0x73,
+  0x11, 0x33, 0x62, 0x46, 0x56, 0x85, 0x39, 0xde, 0x02, 0x57, 0xbd, 0x4f, 0x21, 0x34, 0x94, 0x08,
+  0x10, 0xfa, 0xcc, 0xa9, 0x76, 0x11, 0xfc, 0xee, 0x28, 0x0d, 0x34, 0x61, 0x21, 0x44, 0xb4, 0x02,
+  0xf7, 0xcc, 0x12, 0xb4, 0x02, 0x61, 0x01, 0x34, 0x8a, 0x15, 0x5e, 0x11, 0xd2, 0x12, 0xd5, 0x12,
+  0xe3, 0xea, 0x02, 0x14, 0x00, 0x53, 0x34, 0xee, 0xc3, 0x42, 0x02, 0x10, 0xcf, 0x52, 0x38, 0xee,
+  0x97, 0x77, 0xc6, 0x32, 0x6a, 0x41, 0x0b, 0x10, 0xa8, 0x89, 0x00, 0x77, 0x97, 0x8a, 0x66, 0x85,
+  0x56, 0x33, 0x52, 0xb6, 0x23, 0xc6, 0x12, 0x87, 0x25, 0x42, 0x69, 0x18, 0x70, 0x31, 0x23, 0xae,
+  0x05, 0x08, 0x66, 0x7a, 0xbb, 0x4a, 0x17, 0xfc, 0xcf, 0xcc, 0xfa, 0xde, 0x9f, 0x67, 0x31, 0xcc,
+  0x12, 0x02, 0x20, 0x61, 0x11, 0x6c, 0xcc, 0x22, 0x05, 0x10, 0x12, 0xe5, 0x02, 0x00, 0xcf, 0x4c,
+  0x6a, 0x51, 0x6c, 0xd9, 0xbc, 0x00, 0x9c, 0xc9, 0xbd, 0xac, 0xda, 0xcd, 0xbc, 0xdb, 0x31, 0x02,
+  0x00, 0xcc, 0xbb, 0xcb, 0x6a, 0x01, 0x6d, 0x11, 0xab, 0xba, 0xa6, 0xbb, 0x00, 0x30, 0x07, 0x00,
+  0xab, 0xab, 0x0a, 0x30, 0xcc, 0x00, 0x30, 0x0e, 0xcb, 0x19, 0x40, 0x07, 0x30, 0x15, 0x0a, 0x33,
+  0x63, 0x36, 0x33, 0xc4, 0x57, 0x57, 0xe8, 0x0d, 0x44, 0x74, 0x68, 0x31, 0x04, 0x34, 0x34, 0x23,
+  0x67, 0x01, 0x4e, 0x08, 0x34, 0x64, 0x58, 0xab, 0x02, 0x45, 0x72, 0x40, 0x46, 0x44, 0x6e, 0xcc,
+  0xfc, 0xcf, 0x64, 0x11, 0xfc, 0x03, 0x64, 0x01, 0x02, 0x00, 0xaf, 0xaa, 0x85, 0x62, 0x46, 0x33,
+  0xe8, 0x63, 0x47, 0x45, 0x69, 0x18, 0x69, 0x23, 0x10, 0x2f, 0x10, 0x76, 0x01, 0xcc, 0x36, 0x45,
+  0xde, 0x02, 0x46, 0x04, 0x6b, 0xcd, 0xc9, 0x82, 0x6a, 0x01, 0x85, 0xd8, 0x22, 0xfa, 0x14, 0x00,
+  0xef, 0xdf, 0xf7, 0x89, 0x4c, 0x01, 0x7f, 0xba, 0x22, 0x1f, 0x14, 0x3a, 0x44, 0x28, 0x04, 0xcf,
+  0x32, 0x28, 0x24, 0x81, 0x78, 0x43, 0xbe, 0x35, 0x64, 0x07, 0x25, 0x04, 0xc3, 0x22, 0xd2, 0x22,
+  0x40, 0x54, 0xaa, 0x5b, 0x11, 0x0f, 0x61, 0x01, 0x02, 0x10, 0x6a, 0x21, 0x44, 0x26, 0x95, 0x56,
+  0x34, 0x53, 0x0b, 0xc6, 0x62, 0xce, 0x39, 0x33, 0x40, 0x24, 0x23, 0x54, 0x68, 0x88, 0x80, 0xbb,
+  0xce, 0xee, 0xfe, 0xfe, 0xef, 0xee, 0x4c, 0x0e, 0x41, 0x67, 0x01, 0xfc, 0xcf, 0x88, 0xf6, 0x6f,
+  0xc9, 0x02, 0x56, 0x35, 0xcc, 0x22, 0x55, 0x67, 0x01, 0x6c, 0x37, 0x04, 0x02, 0x10, 0xcf, 0x5d,
+  0x6a, 0xf5, 0x02, 0x10, 0x5c, 0x02, 0x00, 0xe5, 0xd5, 0x12, 0x02, 0x10, 0xe7, 0x00, 0xce, 0xac,
+  0xda, 0xdd, 0xac, 0xeb, 0xdd, 0xbd, 0x00, 0xec, 0xde, 0xcd, 0xec, 0xdd, 0xcd, 0xdb, 0xcd, 0x40,
+  0xcc, 0xcb, 0xbc, 0xbc, 0xcb, 0xcc, 0x02, 0x00, 0xcc, 0xf0, 0xcc, 0xcd, 0xcc, 0xdc, 0x58, 0x21,
+  0x5f, 0x31, 0xb9, 0x19, 0x00, 0x40, 0x06, 0xdc, 0x0c, 0x10, 0xca, 0x29, 0xdd, 0xee, 0xf7, 0x78,
+  0x44, 0xd0, 0x63, 0x35, 0x54, 0x67, 0x62, 0x1c, 0x54, 0x58, 0x21, 0x31, 0x04, 0x8e, 0x57, 0x72,
+  0x05, 0xb0, 0x19, 0x6a, 0x11, 0x45, 0x75, 0x69, 0xe3, 0x06, 0x08, 0x55, 0x7f, 0xdc, 0xcf, 0x12,
+  0xcf, 0xcb, 0xfc, 0xbe, 0x36, 0xbb, 0x9f, 0x05, 0xcf, 0x02, 0x65, 0x1d, 0x00, 0xf9, 0x02, 0x74,
+  0x58, 0xa9, 0x9d, 0x11, 0x84, 0x68, 0x3d, 0x17, 0x73, 0x81, 0x18, 0x34, 0x7f, 0x24, 0x39, 0x43,
+  0x04, 0xab, 0xcc, 0x28, 0x04, 0xd2, 0x72, 0x73, 0x11, 0xfa, 0xdd, 0x7d, 0x08, 0x10, 0xf3, 0x0a,
+  0x14, 0xb4, 0x22, 0xef, 0x06, 0xba, 0x22, 0xd8, 0x32, 0x43, 0x1f, 0x93, 0x15, 0x6d, 0x11, 0x08,
+  0x20, 0x7c, 0x11, 0x64, 0x01, 0x63, 0x6a, 0x36, 0x3c, 0xa8, 0x9a, 0xcc, 0x62, 0x64, 0x61, 0x79,
+  0x01, 0x07, 0x07, 0x78, 0xa8, 0x03, 0x02, 0x20, 0xcc, 0x22, 0x88, 0xa7, 0x79, 0x66, 0x85, 0x57,
+  0x80, 0x34, 0x43, 0x24, 0x31, 0x32, 0x23, 0x32, 0x02, 0x00, 0x90, 0x33, 0x23, 0x22, 0x33, 0x08,
+  0x20, 0x32, 0x13, 0x0b, 0x00, 0xe9, 0x02, 0x00, 0x9a, 0xaf, 0xef, 0x0f, 0xef, 0x39, 0x00, 0xb4,
+  0x0f, 0xc0, 0x0f, 0xc5, 0xcc, 0x00, 0xcc, 0x3a, 0x14, 0x6f, 0x65, 0xf5, 0x02, 0x00, 0xcf, 0x12,
+  0xf0, 0xef, 0xad, 0xf6, 0xcf, 0xc9, 0x02, 0xcc, 0x12, 0x6a, 0x01, 0x6d, 0x21, 0x03, 0x6a, 0x11,
+  0x70, 0x41, 0xce, 0x7d, 0xeb, 0xdf, 0xbe, 0xec, 0x00, 0xde, 0xce, 0xfc, 0xee, 0xce, 0xfd, 0xde,
+  0xcd, 0x00, 0xed, 0xde, 0xcd, 0xdc, 0xde, 0xcd, 0xdd, 0xcd, 0x88, 0xcd, 0xdd, 0xde, 0x43, 0x01,
+  0xde, 0xdd, 0xde, 0x06, 0x00, 0xbd, 0x4f, 0x31, 0xde, 0x1d, 0x2b, 0x00, 0x50, 0xee, 0x0d, 0x00,
+  0x00, 0xed, 0x05, 0x00, 0x60, 0xe3, 0x36, 0x33, 0x53, 0x36, 0x89, 0x19, 0xee, 0x0a, 0x72, 0xda,
+  0x36, 0x74, 0x0c, 0x23, 0x15, 0x0b, 0xda, 0x26, 0x44, 0xda, 0x16, 0x7b, 0x08, 0x00, 0x57, 0x35,
+  0x73, 0x47, 0xa9, 0xaf, 0xdc, 0xfc, 0x04, 0xce, 0xdb, 0x9f, 0x15, 0xbe, 0xcb, 0xfb, 0xae, 0xbb,
+  0xd9, 0x02, 0x00, 0x44, 0x65, 0xf3, 0x02, 0x02, 0x03, 0x58, 0x1d, 0x00, 0xb0, 0x3c, 0xc0, 0x45,
+  0x83, 0x46, 0x24, 0x64, 0x47, 0x76, 0x04, 0x0e, 0x43, 0x3c, 0x79, 0xbc, 0x25, 0x24, 0x02, 0x10,
+  0x70, 0x11, 0x05, 0x30, 0xfd, 0xef, 0xfc, 0x9b, 0xc4, 0x34, 0x04, 0x4c, 0x21, 0x90, 0x55, 0x5e,
+  0x31, 0x0e, 0x50, 0xe4, 0x32, 0x01, 0xba, 0x05, 0x44, 0x33, 0x53, 0x58, 0x36, 0xa3, 0x6a, 0x38,
+  0x36, 0xab, 0xbc, 0x5b, 0x21, 0xd2, 0x82, 0x05, 0x20, 0xff, 0xe6, 0x05, 0xef, 0x06, 0x8a, 0x64,
+  0x11, 0xa8, 0x79, 0x77, 0x96, 0x68, 0xfc, 0x55, 0x64, 0x60, 0x18, 0x52, 0x11, 0x99, 0x35, 0x34,
+  0x34, 0x02, 0x20, 0xde, 0x42, 0xe8, 0x38, 0x8a, 0xff, 0x67, 0x11, 0xef, 0x67, 0x21, 0xd2, 0x32,
+  0x6f, 0x18, 0x63, 0xcc, 0x32, 0x05, 0x00, 0xef, 0xce, 0xfa, 0xd2, 0x12, 0x64, 0x01, 0x5c, 0x1f,
+  0x05, 0x00, 0x5e, 0x31, 0x0b, 0x00, 0x05, 0x30, 0x02, 0x00, 0xf7, 0xdf, 0xbe, 0x40, 0xfb, 0xef,
+  0xce, 0xfc, 0xef, 0xde, 0x02, 0x00, 0xfd, 0x21, 0x21, 0x0e, 0xde, 0xde, 0xed, 0xee, 0x02, 0x10,
+  0xfe, 0xee, 0x42, 0xee, 0x02, 0x80, 0xef, 0xee, 0xef, 0xef, 0xfa, 0x1d, 0xef, 0x1a, 0xff, 0x8c,
+  0x1c, 0xfe, 0x02, 0x10, 0x2c, 0x0e, 0xff, 0xcc, 0xc3, 0x0c, 0x36, 0x33, 0x5c, 0x0f, 0xee, 0x1a,
+  0x57, 0x75, 0x85, 0x46, 0xef, 0xe0, 0x09, 0xc3, 0x02, 0x77, 0x1c, 0x18, 0x0b, 0x74, 0x6a, 0x11,
+  0xb1, 0x02, 0xe1, 0x02, 0x3c, 0xfd, 0xcf, 0xcf, 0x02, 0x9a, 0x00, 0xcf, 0x12, 0x02, 0x00, 0xeb,
+  0xae, 0xde, 0xaa, 0xce, 0x09, 0x9f, 0x28, 0x20, 0x00, 0xf6, 0x22, 0x85, 0x34, 0x07, 0xe1, 0x22,
+  0x07, 0x97, 0x01, 0x0b, 0x10, 0xde, 0x02, 0x47, 0x9a, 0xbd, 0xef, 0xcf, 0x96, 0xfd, 0x02, 0x00,
+  0x40, 0x44, 0xce, 0xd8, 0x22, 0x68, 0x84, 0x84, 0x05, 0xdf, 0x1c, 0x14, 0xcc, 0x52, 0xdb, 0x02,
+  0xc8, 0x19, 0x02, 0x00, 0x33, 0x02, 0x20, 0x17, 0x20, 0x10, 0x44, 0x34, 0x53, 0x35, 0x64, 0x11,
+  0xa3, 0x6b, 0x36, 0x2c, 0xad, 0xcc, 0xcf, 0xb2, 0x02, 0x50, 0xd8, 0x28, 0x04, 0x78, 0x66, 0x84,
+  0x85, 0x67, 0x61, 0x01, 0x34, 0x53, 0x34, 0x22, 0x64, 0x61, 0x8f, 0x2e, 0x14, 0x37, 0x54, 0x09,
+  0x4e, 0x9f, 0x45, 0xaa, 0xbf, 0xff, 0x67, 0x01, 0x43, 0xd2, 0x42, 0x3a, 0x24, 0xaa, 0xf6, 0x6f,
+  0x66, 0xcf, 0x02, 0xf6, 0xc6, 0x6f, 0x6a, 0x01, 0x43, 0x11, 0xbd, 0xf7, 0xcf, 0x6a, 0x51, 0x64,
+  0x81, 0x76, 0xf5, 0xe7, 0x02, 0x02, 0x10, 0x6d, 0x67, 0x21, 0x6a, 0x51, 0x02, 0x10, 0xee, 0xd2,
+  0xfe, 0x51, 0x00, 0xff, 0xef, 0x02, 0x00, 0xff, 0x2d, 0x03, 0x5d, 0x4f, 0x61, 0x00, 0xf0, 0xff,
+  0xff, 0x67, 0x83, 0x9c, 0x05, 0x59, 0x5c, 0x76, 0xb0, 0x47, 0x23, 0x63, 0x36, 0x3a, 0x04, 0x6f,
+  0x18, 0x73, 0xb3, 0x09, 0x4c, 0x58, 0x35, 0x07, 0x07, 0x4c, 0x01, 0x6b, 0xaa, 0x6a, 0x33, 0xed,
+  0x08, 0xcf, 0xcc, 0xec, 0x3f, 0x1b, 0xbb, 0xec, 0xbc, 0x99, 0xd8, 0x46, 0x85, 0x69, 0x5e, 0x04,
+  0x9f, 0x18, 0x73, 0xd1, 0x19, 0xdb, 0x32, 0x9f, 0x84, 0x0b, 0xd8, 0x02, 0x11, 0x00, 0x0b, 0x00,
+  0x44, 0x10, 0x79, 0xcc, 0x61, 0x11, 0x44, 0xfc, 0xff, 0x6d, 0x21, 0xef, 0x9c, 0xcd, 0x6a, 0x01,
+  0xff, 0xfc, 0x56, 0x74, 0x52, 0x21, 0x0a, 0x17, 0x05, 0x50, 0x0e, 0x20, 0x0b, 0x20, 0x13, 0x47,
+  0x05, 0x85, 0x01, 0x24, 0x31, 0x04, 0xa4, 0x6b, 0x36, 0xa4, 0x6a, 0x7c, 0x25, 0x9e, 0xea, 0x0c,
+  0xc3, 0x52, 0x61, 0x11, 0x08, 0x20, 0x11, 0x00, 0xee, 0x00, 0xdd, 0x34, 0x43, 0x34, 0x33, 0x44,
+  0x23, 0x62, 0x7f, 0x16, 0x24, 0xc0, 0x02, 0x87, 0x35, 0xbf, 0x09, 0x5b, 0x11, 0x08, 0x40, 0x70,
+  0x91, 0x24, 0xc8, 0x32, 0x3c, 0xcd, 0xd2, 0x02, 0xed, 0xfd, 0xd2, 0x32, 0x3a, 0x24, 0x3c, 0xf9,
+  0x9f, 0xa2, 0x15, 0xcf, 0x02, 0x67, 0x01, 0x6f, 0x03, 0xce, 0xfb, 0x7c, 0xdf, 0x7c, 0x3d, 0x14,
+  0x02, 0x40, 0x64, 0x61, 0x76, 0x31, 0x82, 0x01, 0x9d, 0xcf, 0x67, 0x21, 0x31, 0x02, 0x64, 0x01,
+  0x9c, 0x03, 0xee, 0xfd, 0x67, 0x11, 0x02, 0x00, 0x36, 0xfe, 0x6a, 0x11, 0x02, 0x10, 0xee, 0x57,
+  0x31, 0x73, 0xb1, 0xfe, 0xfe, 0x60, 0x22, 0x53, 0x46, 0x43, 0x67, 0x59, 0x3c, 0xd2, 0x12, 0x44,
+  0x5e, 0x63, 0x37, 0x01, 0x75, 0x15, 0x1b, 0x1b, 0xdb, 0x02, 0x75, 0x4c, 0x11, 0x66, 0x40, 0x8f,
+  0xed, 0xfe, 0xcf, 0xdd, 0xed, 0xcf, 0x32, 0xce, 0xe1, 0xd2, 0x02, 0xca, 0xeb, 0xba, 0x89, 0x17,
+  0x00, 0xc6, 0x15, 0x30, 0x0b, 0x2b, 0x91, 0x01, 0x35, 0x30, 0x84, 0x99, 0x05, 0x69, 0x02, 0x13,
+  0x83, 0x47, 0xc6, 0x24, 0xac, 0x11, 0x52, 0x07, 0x57, 0xac, 0xdc, 0x5b, 0x11, 0x6a, 0x01, 0x00,
+  0xcd, 0xd9, 0x88, 0x87, 0x7c, 0xff, 0xce, 0xed, 0x38, 0xef, 0x56, 0x63, 0x45, 0x38, 0x84, 0x75,
+  0x90, 0x75, 0x53, 0x44, 0x62, 0x43, 0x3a, 0x24, 0x34, 0x43, 0x48, 0x64, 0x11, 0xcf, 0x02, 0xb3,
+  0x18, 0x6a, 0x45, 0x7f, 0x98, 0x4c, 0x02, 0xd0, 0xdf, 0xee, 0x54, 0x00, 0x47, 0x13, 0xa2, 0x3a,
+  0x23, 0xa2, 0x34, 0x13, 0x77, 0x5d, 0x28, 0x02, 0x10, 0xcc, 0x52, 0x14, 0x73, 0x61, 0x14, 0x20,
+  0x0b, 0x60, 0x34, 0x77, 0xcf, 0x22, 0x6a, 0x01, 0x3a, 0x74, 0x77, 0x9f, 0x15, 0xa2, 0x15, 0xa5,
+  0x00, 0xef, 0x60, 0xcf, 0xfc, 0xef, 0xcd, 0xf8, 0x64, 0xa1, 0x05, 0x00, 0x5b, 0xc5, 0x0e, 0x10,
+  0xbf, 0x6a, 0x41, 0xf8, 0xef, 0xcd, 0x67, 0x21, 0x6a, 0x31, 0xe0, 0xde, 0xfe, 0xef, 0xdf, 0xfe,
+  0xf7, 0x15, 0x02, 0x00, 0xc2, 0x01, 0x07, 0x5e, 0x31, 0x6a, 0x41, 0x00, 0x80, 0xfd, 0xcd, 0x34,
+  0x74, 0x36, 0x00, 0x34, 0x66, 0x58, 0x65, 0x76, 0x58, 0x66, 0x76, 0xe0, 0x57, 0x65, 0x77, 0x58,
+  0x65, 0x6c, 0x15, 0x6c, 0x48, 0xd7, 0x06, 0xc1, 0x6f, 0x18, 0x84, 0x68, 0xbb, 0xbf, 0xdd, 0x6a,
+  0x13, 0x6a, 0x21, 0x78, 0xec, 0xbf, 0xcc, 0x12, 0x1e, 0x67, 0x21, 0x55, 0x01, 0xc0, 0x02, 0x23,
+  0x0e, 0x52, 0xad, 0x1c, 0xd2, 0x12, 0x49, 0x04, 0x95, 0x79, 0x46, 0x83, 0x31, 0xa2, 0x15, 0x33,
+  0x54, 0x57, 0xb1, 0x15, 0x6a, 0x01, 0x7b, 0xde, 0x01, 0x26, 0x02, 0xbd, 0xda, 0x99, 0xb6, 0x7b,
+  0x56, 0xa6, 0x80, 0x6d, 0xef, 0xbd, 0xec, 0xff, 0x66, 0x83, 0xba, 0x32, 0xf9, 0x2e, 0x04, 0x34,
+  0x34, 0x6d, 0x21, 0x0e, 0x10, 0x90, 0x05, 0x08, 0x00, 0x34, 0x04, 0x89, 0x79, 0x21, 0x35, 0x83,
+  0x31, 0x04, 0x6a, 0x36, 0xb4, 0x05, 0x00, 0x3c, 0x47, 0x77, 0xe5, 0x01, 0xcc, 0x32, 0x39, 0x4b,
+  0x0b, 0x70, 0xcb, 0xaa, 0xf9, 0x67, 0x01, 0x13, 0xa2, 0xbd, 0x12, 0x87, 0x55, 0x05, 0x00, 0x70,
+  0x61, 0xa5, 0x75, 0x73, 0x64, 0x31, 0x08, 0x10, 0x55, 0x6f, 0x3a, 0x24, 0x67, 0x21, 0x3a, 0x34,
+  0xbb, 0xcf, 0x0a, 0x27, 0xcf, 0x02, 0xdd, 0x24, 0xae, 0x12, 0xdf, 0x9c, 0xba, 0x12, 0xc3, 0x42,
+  0x29, 0x64, 0x01, 0x6b, 0xf5, 0x05, 0x50, 0xf6, 0x6d, 0x11, 0x7e, 0xfc, 0x7e, 0xdf, 0xd2, 0xb2,
+  0x3d, 0x44, 0xd8, 0x62, 0x6d, 0x11, 0x73, 0x01, 0xde, 0x12, 0xdc, 0x00, 0xcc, 0xaa, 0xca, 0x9c,
+  0xa9, 0xca, 0xac, 0x99, 0xc0, 0xcb, 0xad, 0xbb, 0xec, 0xce, 0xdd, 0xae, 0x02, 0x46, 0x01, 0xd1,
+  0x81, 0x05, 0xec, 0xc5, 0x67, 0x04, 0x17, 0x93, 0x80, 0x0f, 0xcf, 0x22, 0xa0, 0x74, 0x47, 0x35,
+  0x86, 0x68, 0x4e, 0x02, 0xfd, 0x02, 0x10, 0x03, 0xa2, 0x25, 0xcf, 0x02, 0xce, 0xcb, 0xec, 0xb8,
+  0x78, 0x56, 0x3f, 0xbf, 0x29, 0x2a, 0x0b, 0x29, 0x30, 0x40, 0x07, 0x49, 0x34, 0x54, 0x3e, 0x23,
+  0x64, 0x06, 0x47, 0x76, 0x04, 0x10, 0x17, 0x74, 0x57, 0x9b, 0xc5, 0x57, 0x00, 0x54, 0x78, 0x57,
+  0xd6, 0x8e, 0x78, 0xb6, 0x7c, 0xf2, 0xee, 0x57, 0x0b, 0x78, 0x93, 0x2a, 0x1b, 0x22, 0x14, 0xfe,
+  0x16, 0xc0, 0x32, 0x63, 0x73, 0x31, 0x30, 0x4b, 0x34, 0x53, 0x59, 0xc6, 0x02, 0x64, 0x21, 0x6b,
+  0x60, 0x24, 0x63, 0x45, 0xa9, 0x9f, 0x60, 0x38, 0x02, 0xf0, 0xee, 0xc8, 0xfe, 0xd9, 0x34, 0xcf,
+  0x02, 0x71, 0x23, 0x28, 0x54, 0x5e, 0x21, 0xf7, 0x05, 0x10, 0x61, 0x01, 0x58, 0x11, 0x13, 0x9f,
+  0x45, 0x64, 0x21, 0x43, 0x44, 0x3a, 0x24, 0xf3, 0x0d, 0x67, 0x3a, 0x14, 0xfa, 0xaf, 0xaa, 0x0c,
+  0x02, 0x00, 0x7d, 0x2a, 0xd2, 0x22, 0xdc, 0xce, 0xfa, 0x67, 0x11, 0x58, 0x01, 0x02, 0x30, 0x5b,
+  0x6d, 0x01, 0x70, 0x11, 0xc6, 0xbf, 0xd5, 0x02, 0x11, 0x10, 0xf6, 0xdf, 0xae, 0x6a, 0x81, 0x9d,
+  0x01, 0x1f, 0x6a, 0x01, 0xd2, 0x12, 0x58, 0x11, 0x05, 0x30, 0x00, 0x30, 0xee, 0xdb, 0x99, 0x8e,
+  0xeb, 0x3f, 0x08, 0xda, 0x26, 0x02, 0x20, 0xdd, 0xfd, 0xce, 0x02, 0x00, 0x80, 0xdc, 0xed, 0xce,
+  0xdc, 0xfc, 0xca, 0x9a, 0x2b, 0x41, 0x49, 0x0f, 0x0e, 0x62, 0x36, 0x93, 0x12, 0x7b, 0xab, 0x47,
+  0x39, 0xfd, 0x60, 0xde, 0xed, 0xfd, 0xce, 0xcc, 0x02, 0x00, 0xa2, 0x05, 0xec, 0x7e, 0xb7, 0x22,
+  0x14, 0x58, 0x01, 0xba, 0x02, 0x29, 0x30, 0x04, 0x1a, 0xcc, 0x05, 0x95, 0x9c, 0x79, 0x57, 0xd4,
+  0x09, 0x73, 0x34, 0x7b, 0x3b, 0x83, 0x46, 0xa1, 0x06, 0x00, 0x22, 0x33, 0x24, 0x43, 0x57, 0x47,
+  0xb6, 0x7b, 0x40, 0xde, 0xbd, 0xec, 0xef, 0xbd, 0xe3, 0xf8, 0x16, 0x33, 0x6f, 0x2b, 0x54, 0x0d,
+  0x47, 0x01, 0x37, 0xcc, 0x32, 0x93, 0x99, 0x05, 0x31, 0x14, 0x36, 0x80, 0xa3, 0x46, 0x43, 0x53,
+  0x34, 0xbb, 0xaf, 0x03, 0x6e, 0xb3, 0xd5, 0x92, 0x14, 0x20, 0xec, 0xba, 0x67, 0x01, 0x58, 0x01,
+  0x31, 0x8a, 0x05, 0xf6, 0x44, 0x05, 0x10, 0x4f, 0x01, 0x31, 0x73, 0x61, 0xcf, 0x12, 0x3a, 0x44,
+  0x05, 0x70, 0xb4, 0x34, 0x46, 0x67, 0x21, 0xdf, 0xd2, 0x32, 0x67, 0x11, 0xfb, 0x3a, 0x44, 0xf7,
+  0xad, 0x37, 0xe3, 0x16, 0x43, 0x01, 0xbc, 0xd2, 0x12, 0x58, 0x11, 0x5b, 0x31, 0x64, 0x01, 0xae,
+  0x6b, 0x64, 0x31, 0x11, 0x00, 0x17, 0x00, 0xf9, 0x3d, 0x14, 0xcd, 0x3d, 0x64, 0x07, 0xd2, 0x42,
+  0xd8, 0x52, 0x3a, 0x24, 0xed, 0xcc, 0xca, 0x9f, 0xdb, 0x3c, 0xfc, 0xcf, 0x02, 0x00, 0x6a, 0x21,
+  0xa5, 0x02, 0x02, 0x10, 0xec, 0xed, 0x69, 0xe9, 0x36, 0xcd, 0xbb, 0x30, 0x0b, 0x46, 0x0f, 0x0e,
+  0x66, 0x08, 0x73, 0x39, 0xe3, 0x16, 0x66, 0x8f, 0x1e, 0x25, 0x02, 0x10, 0x29, 0x20, 0xce, 0xcc,
+  0x72, 0xfc, 0x6a, 0x01, 0xb6, 0x67, 0x5e, 0x01, 0x63, 0x1b, 0x29, 0x00, 0x84, 0xf4, 0x57, 0x33,
+  0x67, 0x01, 0x64, 0x48, 0x1b, 0x0b, 0x13, 0xa2, 0x05, 0xd7, 0x0c, 0x85, 0xd2, 0x12, 0x58, 0xf3,
+  0x12, 0x93, 0x46, 0x24, 0x62, 0xcb, 0x13, 0x01, 0x6a, 0x01, 0x23, 0x59, 0xab, 0xcf, 0xfb, 0xde,
+  0xcf, 0xfc, 0xf5, 0x67, 0xf5, 0x56, 0xba, 0x02, 0xa8, 0x05, 0xd2, 0x02, 0x63, 0x28, 0x30, 0x3b,
+  0x04, 0x43, 0x59, 0x64, 0x51, 0x6a, 0x34, 0x73, 0x34, 0x34, 0xf0, 0x43, 0x83, 0xcc, 0xbf, 0x03,
+  0x3e, 0x93, 0x45, 0x08, 0x30, 0x11, 0x00, 0xf1, 0x18, 0x3e, 0x84, 0x47, 0x12, 0x8f, 0x4c, 0x5b,
+  0x81, 0xcf, 0x52, 0x0e, 0x50, 0xd3, 0x31, 0x24, 0xa5, 0x45, 0x42, 0x23, 0xcf, 0x32, 0xde, 0x75,
+  0x88, 0x3a, 0x04, 0xcf, 0xcf, 0x02, 0x96, 0x02, 0x6a, 0x41, 0x54, 0x28, 0xcf, 0x8c, 0x52, 0x21,
+  0xc9, 0x32, 0xa7, 0x6a, 0x31, 0x37, 0x04, 0x02, 0x50, 0xcf, 0x8d, 0x7b, 0x18, 0xdf, 0xa5, 0x65,
+  0x87, 0x05, 0x00, 0xa5, 0x35, 0x78, 0x48, 0xfe, 0xdc, 0xcd, 0xb9, 0x5b, 0x00, 0x58, 0xed, 0xbf,
+  0xcc, 0x55, 0x01, 0xcc, 0x42, 0xcf, 0x13, 0x24, 0xde, 0xc1, 0x43, 0x01, 0xdc, 0xec, 0xcf, 0xcc,
+  0x66, 0x30, 0x18, 0xd4, 0x06, 0x21, 0x18, 0x2e, 0x84, 0x58, 0xcb, 0xbf, 0xe0, 0x30, 0xdd, 0xfe,
+  0x84, 0xde, 0xdd, 0x23, 0x40, 0xbf, 0xcc, 0xec, 0xb5, 0xfe, 0x06, 0xea, 0x47, 0xc6, 0x05, 0x45,
+  0x77, 0x0f, 0x93, 0xce, 0x09, 0x09, 0x0e, 0x0e, 0x00, 0xee, 0x57, 0x74, 0x0f, 0xde, 0x05, 0xe0,
+  0x19, 0x63, 0x2d, 0x1e, 0xf0, 0x02, 0x1d, 0x10, 0x06, 0x63, 0xd2, 0x02, 0x2c, 0x1c, 0x31, 0x37,
+  0x89, 0xce, 0xfb, 0xf0, 0xde, 0xdf, 0xf9, 0xbc, 0xcc, 0x02, 0x52, 0x21, 0x58, 0x31, 0x0a, 0x37,
+  0x07, 0xd5, 0x22, 0x99, 0x45, 0x66, 0x18, 0x36, 0xb3, 0x46, 0x33, 0x43, 0xc0, 0x44, 0x39, 0x33,
+  0x93, 0xcd, 0xbf, 0x6e, 0x6f, 0x40, 0x14, 0x93, 0x77, 0x6f, 0x02, 0x30, 0xed, 0xc4, 0x52, 0x11,
+  0x32, 0x33, 0xf8, 0x06, 0xdd, 0x52, 0x11, 0x31, 0xba, 0x52, 0xd5, 0x12, 0x08, 0x20, 0x41, 0x05,
+  0x00, 0x78, 0x38, 0x31, 0x89, 0x4f, 0x23, 0xee, 0xff, 0x67, 0x11, 0x3a, 0x94, 0xbb, 0xf8, 0x00,
+  0x8f, 0x56, 0xf6, 0x6f, 0xfe, 0xcf, 0xeb, 0xee, 0x67, 0x15, 0x09, 0x3d, 0x04, 0x6a, 0x31, 0xcd,
+  0xf9, 0x22, 0x04, 0xcf, 0x12, 0x4b, 0x06, 0xe5, 0x61, 0x81, 0xd8, 0x42, 0xbf, 0x6b, 0xf6, 0xde,
+  0x8e, 0x1e, 0xeb, 0x3d, 0x04, 0x40, 0x14, 0x6a, 0x61, 0x3f, 0x0b, 0xdf, 0xeb, 0xee, 0x81, 0x19,
+  0x07, 0xec, 0xcb, 0xdb, 0xaf, 0xcb, 0xed, 0xcc, 0x32, 0x46, 0xbf, 0x37, 0x54, 0x34, 0x04, 0xcf,
+  0xed, 0xed, 0x6a, 0x41, 0xdb, 0x2c, 0xa9, 0xa3, 0xaa, 0x0c, 0x48, 0x0b, 0x47, 0xd4, 0x19, 0x96,
+  0x78, 0xc7, 0xdf, 0x87, 0x6d, 0x11, 0x3a, 0x24, 0xcb, 0xec, 0xc5, 0x66, 0x1b, 0x68, 0x1f, 0x7c,
+  0x75, 0x59, 0x55, 0x01, 0x2d, 0x0b, 0xde, 0x02, 0x97, 0x01, 0x67, 0x04, 0x56, 0x9c, 0x94, 0x48,
+  0x0b, 0x13, 0x73, 0x04, 0x79, 0x01, 0x75, 0x79, 0xa9, 0x01, 0x12, 0x33, 0xab, 0x05, 0x72, 0x24,
+  0x01, 0x01, 0x32, 0x35, 0x56, 0x81, 0xcf, 0x02, 0xce, 0xfb, 0xee, 0x57, 0x83, 0x34, 0xd2, 0x32,
+  0x15, 0x02, 0x40, 0x53, 0x08, 0x60, 0x46, 0x64, 0x51, 0x6a, 0x34, 0x63, 0x00, 0x34, 0x25, 0x43,
+  0x93, 0x3a, 0x32, 0x83, 0xed, 0x96, 0xcf, 0x99, 0xf5, 0xb1, 0x45, 0xff, 0x92, 0x00, 0xe8, 0x67,
+  0x59, 0x10, 0xfd, 0x64, 0x11, 0x13, 0x58, 0x11, 0x45, 0x2b, 0x64, 0x31, 0x99, 0x35, 0xba, 0x95,
+  0x19, 0x37, 0xc7, 0x36, 0x0c, 0x0a, 0x27, 0x75, 0x08, 0xdd, 0xdc, 0xcd, 0x9f, 0x03, 0x3a, 0x04,
+  0x02, 0xcf, 0x45, 0x0b, 0xfe, 0xbe, 0xd9, 0xfe, 0xae, 0xfe, 0x07, 0xcf, 0x12, 0xa5, 0x05, 0x10,
+  0x37, 0xbc, 0xf6, 0xbf, 0x6b, 0xe5, 0x58, 0xbe, 0x4b, 0xe4, 0x5e, 0x41, 0x05, 0x20, 0xaf, 0x64,
+  0x21, 0xaf, 0xc0, 0x5b, 0xe4, 0xbe, 0x4c, 0xf8, 0xdf, 0x3d, 0xa4, 0x24, 0x13, 0x81, 0x44, 0x00,
+  0xee, 0xbf, 0xfe, 0xcb, 0xbd, 0xba, 0x49, 0x01, 0xbd, 0x9e, 0x09, 0xed, 0x02, 0x10, 0xd4, 0x06,
+  0x0a, 0x14, 0x10, 0x04, 0xfe, 0x61, 0x01, 0xcc, 0xdf, 0xdc, 0x4e, 0x18, 0x13, 0x04, 0xb3, 0x36,
+  0x6f, 0x15, 0xd4, 0x19, 0xf0, 0x68, 0x46, 0x9b, 0xbb, 0xe7, 0x6e, 0xcf, 0x12, 0xc6, 0x25, 0x37,
+  0x14, 0xe0, 0xb5, 0x67, 0x45, 0x82, 0x35, 0x8e, 0x11, 0x37, 0x04, 0xd1, 0x29, 0xbf, 0x3f, 0x3b,
+  0x0b, 0x00, 0x6f, 0x18, 0x16, 0x2a, 0xe0, 0x09, 0x0a, 0x07, 0x46, 0x28, 0x07, 0x09, 0x4f, 0x17,
+  0x57, 0x22, 0xff, 0x1e, 0x24, 0xce, 0xfa, 0xdd, 0xf1, 0x94, 0x00, 0x8b, 0xd4, 0x55, 0x5b, 0x01,
+  0x01, 0x07, 0x05, 0x00, 0x04, 0x57, 0x2f, 0x02, 0x00, 0x0e, 0x00, 0x99, 0x25, 0x6a, 0x01, 0xa3,
+  0xcc, 0x32, 0xa4, 0x39, 0x78, 0x33, 0x83, 0xee, 0x09, 0x8e, 0x99, 0x65, 0x18, 0x5e, 0x02, 0x10,
+  0x43, 0xff, 0x5b, 0x21, 0xc2, 0x49, 0x36, 0x3b, 0xd2, 0x32, 0x11, 0x30, 0x7c, 0x11, 0x10, 0x27,
+  0xa2, 0x55, 0x87, 0x67, 0x01, 0xb1, 0x3d, 0x6f, 0x01, 0xed, 0xdd, 0xdd, 0xcd, 0x3a, 0x24, 0x00,
+  0x89, 0xf6, 0x6f, 0xff, 0xdf, 0xeb, 0xfe, 0xce, 0x07, 0x67, 0x11, 0xa5, 0x25, 0x3d, 0x34, 0xfb,
+  0xcf, 0x8b, 0xf6, 0xbf, 0x6a, 0x4b, 0x31, 0x74, 0xaf, 0x05, 0x00, 0x5a, 0x02, 0x00, 0x70, 0x11,
+  0xae, 0x39, 0x76, 0x01, 0x7d, 0xfb, 0xd2, 0x32, 0x40, 0x54, 0x02, 0x00, 0xeb, 0xef, 0x40, 0xec,
+  0xca, 0xdc, 0xaf, 0xdb, 0xed, 0xc6, 0x02, 0xbe, 0x9c, 0xdc, 0xfd, 0x05, 0x00, 0x64, 0x01, 0x37,
+  0x24, 0xed, 0xcf, 0xb6, 0x19, 0x03, 0x6a, 0x11, 0xcf, 0x12, 0xcc, 0xec, 0xc7, 0x67, 0x34, 0x64,
+  0xdd, 0x72, 0x05, 0x35, 0x30, 0x18, 0x53, 0x19, 0x18, 0x85, 0xdf, 0xda, 0x19, 0x2e, 0x17, 0x3a,
+  0xc6, 0x66, 0x08, 0x47, 0x63, 0x08, 0x2e, 0x04, 0x12, 0x0e, 0x56, 0x95, 0xf7, 0x1b, 0x1e, 0xc0,
+  0x12, 0x10, 0x0a, 0x64, 0x3f, 0x0b, 0xaa, 0x1c, 0x3e, 0x00, 0x85, 0x11, 0x03, 0x57, 0x0e, 0x0b,
+  0x10, 0x57, 0x23, 0x52, 0x13, 0x22, 0x33, 0x10, 0x23, 0xac, 0xdb, 0xde, 0xcf, 0x07, 0xad, 0xe7,
+  0x9b, 0x8f, 0x62, 0x0c, 0x9c, 0x25, 0x64, 0x41, 0x51, 0x2b, 0x34, 0x35, 0x94, 0x99, 0x25, 0x98,
+  0xb4, 0x6a, 0x24, 0xcc, 0x32, 0x02, 0x00, 0x33, 0x83, 0x93, 0x65, 0x87, 0xfb, 0x46, 0x6d, 0x61,
+  0x46, 0x54, 0xb9, 0x93, 0x24, 0x41, 0xaa, 0x4c, 0xbf, 0x48, 0x1b, 0x3a, 0x14, 0x48, 0x4b, 0x5b,
+  0x01, 0x11, 0x10, 0x0b, 0x40, 0x34, 0xf0, 0x12, 0x01, 0x08, 0x00, 0xdd, 0xde, 0xdd, 0xcb, 0xbc,
+  0xaa, 0xa8, 0x00, 0x7b, 0x98, 0xcb, 0xac, 0xaa, 0xdc, 0xcf, 0xee, 0xc4, 0xdd, 0xfc, 0x3a, 0x14,
+  0xbc, 0xf6, 0x6f, 0x60, 0x55, 0x31, 0x51, 0xef, 0x24, 0x1b, 0x3d, 0x14, 0xbd, 0x02, 0xcc, 0x12,
+  0x6a, 0x02, 0x20, 0x61, 0x01, 0x67, 0x11, 0x04, 0xf6, 0xaf, 0x08, 0x30, 0x6a, 0xf6, 0xcf, 0x9d,
+  0xfc, 0x05, 0xd5, 0x12, 0xdd, 0x21, 0x5e, 0xde, 0xfe, 0xbb, 0x9d, 0xca, 0xf8, 0xed, 0xce, 0xdb,
+  0xc9, 0x22, 0x02, 0x10, 0x31, 0x24, 0x01, 0x17, 0xcf, 0x02, 0x0a, 0xee, 0xd2, 0x32, 0xde, 0x9f,
+  0x05, 0xdb, 0xec, 0xcb, 0xaa, 0xc3, 0xaa, 0x19, 0x16, 0x04, 0x74, 0x57, 0xa9, 0xaf, 0x0f, 0x65,
+  0xcf, 0x02, 0xdf, 0xc6, 0x05, 0x2e, 0x07, 0xc3, 0x15, 0x07, 0x07, 0x64, 0x11, 0x74, 0x01, 0x47,
+  0x96, 0x05, 0xfb, 0x5a, 0x18, 0x00, 0x0e, 0x64, 0x51, 0x0e, 0x7a, 0x1f, 0x0b, 0x03, 0x61, 0x11,
+  0x76, 0x01, 0x08, 0x74, 0x57, 0x44, 0x17, 0x10, 0x58, 0x45, 0x71, 0x24, 0x20, 0x22, 0x42, 0x23,
+  0x89, 0xac, 0x42, 0x0b, 0xef, 0xbe, 0x70, 0xe9, 0xbd, 0x57, 0x84, 0x90, 0x35, 0x6a, 0x21, 0x08,
+  0x20, 0x34, 0xac, 0x53, 0x47, 0x68, 0x2f, 0x02, 0x00, 0x58, 0xcc, 0x22, 0xa3, 0xcf, 0x12, 0x1c,
+  0x35, 0x85, 0x99, 0xe5, 0x7e, 0x68, 0x02, 0x20, 0xed, 0xdb, 0xdb, 0xfc, 0xa5, 0x45, 0x64, 0x11,
+  0x25, 0x34, 0xf2, 0x36, 0xae, 0x05, 0xdb, 0x32, 0x13, 0x57, 0x01, 0xda, 0x59, 0x34, 0x75, 0x6a,
+  0x89, 0xca, 0xae, 0xcb, 0x0a, 0xec, 0x2d, 0x12, 0xbb, 0x01, 0x01, 0xdb, 0xae, 0xee, 0xee, 0xf1,
+  0xcf, 0x22, 0xbc, 0xf9, 0x9f, 0x41, 0x3f, 0x6a, 0x41, 0xa5, 0x15, 0x3d, 0x54, 0x2c, 0xbb, 0xf7,
+  0xc9, 0x12, 0x31, 0x24, 0xaf, 0x31, 0x04, 0x5a, 0xf5, 0x0e, 0xaf, 0x70, 0x11, 0x08, 0x00, 0xde,
+  0x12, 0xaf, 0x6b, 0xf8, 0xdf, 0x06, 0xbd, 0x6a, 0x11, 0x6d, 0x21, 0xfd, 0xef, 0xdb, 0xb9, 0xed,
+  0xe0, 0xae, 0xdc, 0xed, 0xbf, 0xdb, 0x6a, 0x01, 0xcf, 0x12, 0x02, 0x00, 0x7d, 0xcf, 0x22, 0xfe,
+  0x9c, 0x25, 0x1e, 0x0b, 0x6f, 0x18, 0x11, 0x00, 0xcf, 0x02, 0xbe, 0x36, 0xcb, 0xc2, 0x06, 0x2e,
+  0x11, 0x74, 0x39, 0x1b, 0xd4, 0x80, 0xdd, 0xee, 0x81, 0x23, 0x50, 0xed, 0xb7, 0x68, 0x24, 0x63,
+  0x36, 0x25, 0x04, 0xf7, 0xa4, 0x1c, 0x43, 0x01, 0x57, 0x08, 0x95, 0x5a, 0x08, 0x87, 0x05, 0xb7,
+  0x05, 0x13, 0x27, 0xfc, 0x74, 0x69, 0x99, 0x05, 0x3c, 0x0b, 0x34, 0x04, 0x70, 0x01, 0xdb, 0x02,
+  0x14, 0x00, 0x20, 0x32, 0x54, 0x35, 0x66, 0x8c, 0xaa, 0x1c, 0xce, 0xf9, 0x70, 0xcd, 0x8b, 0xd4,
+  0x56, 0x2b, 0x14, 0x61, 0x41, 0x6d, 0x11, 0x33, 0x14, 0x53, 0x69, 0xcc, 0x02, 0x46, 0x69, 0x18,
+  0x35, 0x33, 0x43, 0x00, 0x83, 0x3a, 0x33, 0x94, 0x3a, 0x34, 0xa3, 0x3a, 0x3c, 0x47, 0x96, 0x03,
+  0x9e, 0x73, 0x61, 0xa8, 0x95, 0x9e, 0x00, 0xed, 0xdc, 0xf0, 0xbb, 0x87, 0x84, 0x34, 0xc9, 0x72,
+  0xf2, 0x46, 0x1c, 0x57, 0xcc, 0x12, 0xc0, 0x34, 0x87, 0x7b, 0x9a, 0xec, 0xbf, 0x05, 0x1e, 0x08,
+  0x2c, 0x81, 0x2f, 0x3c, 0xdd, 0xfd, 0xdb, 0x9a, 0xef, 0xfd, 0x21, 0x01, 0x7e, 0xce, 0xa2, 0x05,
+  0x5c, 0x1c, 0x67, 0x61, 0xbe, 0x05, 0xe3, 0x39, 0xfd, 0x1d, 0xfc, 0xcf, 0x3d, 0x04, 0x61, 0x11,
+  0x55, 0x01, 0xc6, 0x02, 0x6a, 0xf5, 0x61, 0x11, 0x02, 0x90, 0x0c, 0x6c, 0xf9, 0x3a, 0x14, 0xa8,
+  0x05, 0xcd, 0xfd, 0xba, 0x8d, 0x00, 0xdb, 0xee, 0xbe, 0xeb, 0xed, 0xbe, 0xdc, 0xed, 0x6e, 0xbe,
+  0x6a, 0x21, 0xd8, 0x12, 0x90, 0x05, 0xed, 0x64, 0x01, 0x00, 0x05, 0xee, 0x9d, 0x3a, 0x04, 0xce,
+  0x1e, 0x0b, 0xab, 0x02, 0xa2, 0x05, 0xcb, 0x75, 0x64, 0x11, 0x70, 0x57, 0x34, 0x79, 0x9a, 0xd1,
+  0x80, 0x07, 0x47, 0x64, 0x04, 0xed, 0xb9, 0xcf, 0x02, 0xb9, 0x78, 0x36, 0x1b, 0xa1, 0x1c, 0x02,
+  0x00, 0x47, 0xcf, 0x22, 0x53, 0xb6, 0x0c, 0x83, 0x1f, 0x33, 0x64, 0x1b, 0x6e, 0x69, 0xf0, 0x32,
+  0x45, 0x06, 0x84, 0x96, 0x08, 0xba, 0x15, 0x34, 0x64, 0x25, 0x33, 0x5c, 0x61, 0xf6, 0x34, 0xdf,
+  0x8b, 0xd7, 0xab, 0x01, 0x77, 0x05, 0x00, 0x43, 0xa8, 0x45, 0x34, 0x73, 0x9c, 0x35, 0x6a, 0x0e,
+  0x00, 0x27, 0x99, 0x15, 0xf1, 0x02, 0x10, 0x36, 0x3a, 0x99, 0x99, 0xe5, 0xab, 0x85, 0x98, 0x40,
+  0xa4, 0x40, 0xe0, 0xdc, 0xb9, 0x89, 0x54, 0x53, 0xd8, 0x28, 0xce, 0x49, 0xde, 0x12, 0x21, 0x64,
+  0x01, 0x76, 0x7a, 0x99, 0xdc, 0x52, 0x01, 0xdf, 0xec, 0x07, 0x6d, 0x1d, 0xf2, 0x10, 0x6d, 0x51,
+  0xdf, 0xec, 0xb9, 0x8a, 0x87, 0xdf, 0x48, 0x0b, 0xa2, 0x15, 0x67, 0x01, 0x92, 0x39, 0x03, 0x3b,
+  0xde, 0x10, 0x27, 0xa8, 0x55, 0x78, 0xdf, 0xcd, 0xfa, 0xfb, 0x16, 0x3a, 0x24, 0x05, 0x00, 0x02,
+  0xe0, 0xf6, 0x06, 0xaf, 0xa8, 0x05, 0xd2, 0x02, 0xca, 0xb7, 0xde, 0xbe, 0xeb, 0x34, 0xde, 0xbe,
+  0x6a, 0x31, 0xec, 0x6d, 0x21, 0xcf, 0x22, 0xce, 0xec, 0xb8, 0xfd, 0xce, 0xed, 0x0c, 0x0e, 0x13,
+  0x04, 0x9f, 0x55, 0xdb, 0x67, 0x01, 0x7e, 0xb7, 0xce, 0x06, 0x3a, 0x01, 0x9c, 0x25, 0xce, 0x20,
+  0x0a, 0x47, 0xcf, 0x72, 0xc9, 0xea, 0x89, 0x1c, 0x04, 0x23, 0x34, 0x14, 0x57, 0x96, 0x15, 0x39,
+  0x2b, 0x32, 0x00, 0xeb, 0x40, 0x47, 0xea, 0x02, 0x84, 0x79, 0x11, 0x46, 0xd4, 0x19, 0x11, 0x00,
+  0x63, 0x0b, 0xc6, 0x68, 0x51, 0x0b, 0xc8, 0x0f, 0x22, 0x5a, 0xcc, 0x67, 0x01, 0xa2, 0x05, 0xe0,
+  0x9c, 0xd8, 0xbd, 0x79, 0xa3, 0x3a, 0x14, 0x61, 0x01, 0xa1, 0x0c, 0x08, 0x33, 0x43, 0x34, 0x36,
+  0x4b, 0xb3, 0x47, 0x33, 0x43, 0x18, 0x54, 0x3a, 0x33, 0x9c, 0x05, 0x37, 0x04, 0x73, 0x33, 0x4b,
+  0x3f, 0x88, 0x07, 0x2e, 0x64, 0x70, 0x81, 0x6f, 0x48, 0x05, 0x20, 0x16, 0x97, 0xed, 0xdc, 0x18,
+  0xb9, 0xa6, 0x56, 0x46, 0x24, 0x70, 0x11, 0x42, 0x48, 0x67, 0xfc, 0xcb, 0xaf, 0x55, 0x01, 0xfc,
+  0x1b, 0x83, 0x16, 0x5e, 0x51, 0x33, 0x15, 0xd5, 0x22, 0xf8, 0x96, 0x5e, 0xee, 0xb0, 0x1c, 0xa2,
+  0x05, 0x67, 0x01, 0x32, 0x2f, 0xd2, 0x42, 0xe7, 0x4d, 0x1f, 0xd2, 0x52, 0x3d, 0x34, 0xcc, 0xf8,
+  0xd2, 0x12, 0x52, 0x01, 0xc6, 0x42, 0x05, 0xd5, 0x42, 0x9f, 0x0e, 0x30, 0x6a, 0xf6, 0xbf, 0x9d,
+  0xfc, 0x98, 0xbb, 0x7d, 0xdb, 0x67, 0x21, 0x02, 0x00, 0xdc, 0xee, 0x6d, 0x11, 0x84, 0xdc, 0xfe,
+  0x08, 0x00, 0xce, 0xec, 0xfe, 0xce, 0x96, 0x05, 0xaa, 0xec, 0x64, 0x11, 0xcf, 0x13, 0x14, 0xee,
+  0xb5, 0x14, 0xcc, 0x67, 0x01, 0xc8, 0xd8, 0x74, 0x46, 0x37, 0x01, 0x99, 0x9f, 0xa4, 0xc3, 0x5e,
+  0x34, 0x21, 0x05, 0x03, 0xcc, 0xec, 0xba, 0x99, 0x9f, 0x12, 0x63, 0x36, 0xd6, 0x23, 0xf5, 0x06,
+  0x67, 0x11, 0x58, 0x1b, 0x1e, 0x84, 0x0a, 0x17, 0x1b, 0x2e, 0x7f, 0xab, 0x18, 0xe1, 0x32, 0xdb,
+  0x02, 0xea, 0x05, 0xf0, 0x02, 0x18, 0x0e, 0xde, 0x12, 0x57, 0x02, 0x8a, 0x04, 0x2c, 0xef, 0xbd,
+  0xe8, 0xcd, 0x8b, 0xd5, 0xb2, 0x89, 0x87, 0x05, 0x33, 0x44, 0x8c, 0x0c, 0x3d, 0x04, 0x36, 0x99,
+  0x25, 0x28, 0x6b, 0x35, 0x93, 0x73, 0x01, 0x93, 0xc9, 0x02, 0x49, 0x33, 0x80, 0xa3, 0x37, 0x33,
+  0x45, 0x33, 0x4c, 0xcb, 0x0c, 0x9e, 0x3f, 0x0a, 0x67, 0x0e, 0x60, 0xd5, 0x52, 0xaa, 0x60, 0x14,
+  0x10, 0x06, 0x02, 0x64, 0x55, 0x78, 0x45, 0x98, 0x8c, 0xa3, 0x01, 0x86, 0x33, 0xb9, 0x10, 0xcf,
+  0x22, 0xdd, 0x87, 0xe9, 0x00, 0xcf, 0x42, 0x5d, 0x02, 0xcf, 0xdd, 0xa8, 0x7f, 0xb6, 0x02, 0xf9,
+  0xad, 0x4c, 0xef, 0xff, 0xca, 0x3d, 0xcf, 0x22, 0xd8, 0x02, 0x13, 0x97, 0xe6, 0x06, 0x6d, 0xf4,
+  0x02, 0xab, 0xd2, 0x12, 0x02, 0x70, 0x69, 0x02, 0x20, 0x6a, 0x01, 0x59, 0x04, 0xf6, 0xaf, 0x02,
+  0x00, 0x69, 0xd4, 0xce, 0x9d, 0xeb, 0x80, 0xde, 0xad, 0xeb, 0xde, 0xbd, 0xeb, 0xee, 0x02, 0x00,
+  0x11, 0xcf, 0x12, 0xeb, 0xed, 0xce, 0x02, 0x00, 0xec, 0xed, 0xcf, 0x4c, 0xec, 0xee, 0x67, 0x11,
+  0x6a, 0x21, 0xde, 0xec, 0x6f, 0x38, 0xfd, 0xe0, 0xbe, 0xcc, 0xd8, 0x79, 0x56, 0x3e, 0x0f, 0x4f,
+  0x04, 0x36, 0x82, 0xc7, 0xbf, 0x10, 0x2e, 0x07, 0x23, 0x30, 0xed, 0xc9, 0x78, 0x28, 0x17, 0x48,
+  0x08, 0xf7, 0xa5, 0x02, 0x5e, 0x21, 0xde, 0x02, 0x46, 0x1f, 0x04, 0x87, 0x05, 0x7c, 0x11, 0xb6,
+  0x1f, 0x09, 0x1b, 0x1e, 0x83, 0x58, 0xf0, 0x02, 0x23, 0x63, 0x36, 0x46, 0x05, 0xed, 0x02, 0x83,
+  0xd8, 0x12, 0x44, 0x74, 0x56, 0xce, 0xfc, 0x02, 0xff, 0x6a, 0x11, 0xf9, 0xbd, 0x8b, 0xd8, 0xbd,
+  0x46, 0xe6, 0x84, 0x96, 0x05, 0x3a, 0x24, 0x43, 0x58, 0x67, 0x01, 0x9c, 0x05, 0xab, 0x05, 0x8b,
+  0x34, 0x04, 0xcf, 0x22, 0x83, 0xba, 0x05, 0x83, 0x3e, 0xcc, 0x3c, 0xcb, 0xff, 0x33, 0x1b, 0x43,
+  0xa4, 0x16, 0xa7, 0x5e, 0xb4, 0x64, 0x21, 0x64, 0x3d, 0x6a, 0x81, 0xd2, 0x42, 0x29, 0x05, 0x00,
+  0xdb, 0x98, 0xbf, 0x02, 0xde, 0x99, 0x06, 0xfc, 0xde, 0xff, 0x45, 0x01, 0xcc, 0x12, 0x6a, 0x01,
+  0x02, 0x20, 0xd5, 0x42, 0x71, 0x0c, 0xd2, 0x52, 0x81, 0x25, 0xf8, 0xfb, 0xcf, 0x8a, 0x6a, 0x51,
+  0x64, 0x31, 0x61, 0x21, 0xd2, 0x02, 0x02, 0x00, 0xc0, 0x8d, 0x49, 0xe5, 0x9f, 0x5b, 0xf7, 0x67,
+  0x11, 0xcf, 0x02, 0x8c, 0xbd, 0xdb, 0x6a, 0x31, 0x02, 0x40, 0xce, 0xec, 0xee, 0x9f, 0x05, 0x63,
+  0x3a, 0x04, 0x02, 0x10, 0xdd, 0xee, 0xce, 0xb3, 0x19, 0xcf, 0x02, 0xd7, 0xe0, 0x7c, 0x66, 0x34,
+  0x78, 0x89, 0x2d, 0xb2, 0xd7, 0x49, 0x6a, 0x01, 0x7d, 0x9f, 0x25, 0x79, 0x5a, 0x08, 0x9e, 0x0c,
+  0x12, 0x1e, 0xbf, 0x19, 0xaa, 0x4c, 0x35, 0xee, 0x85, 0xef, 0x06, 0xe6, 0x0c, 0x1b, 0x1e, 0x45,
+  0x1b, 0x1e, 0x8b, 0x01, 0xf6, 0x12, 0x75, 0x28, 0x17, 0x82, 0x64, 0x04, 0x48, 0x75, 0x0b, 0x6f,
+  0x08, 0x6a, 0x01, 0xbe, 0xc4, 0xfa, 0xde, 0x67, 0x01, 0x8b, 0xd3, 0x55, 0x64, 0x21, 0x3d, 0x04,
+  0x61, 0x36, 0x3b, 0x58, 0x33, 0x53, 0x43, 0x69, 0x18, 0x34, 0x14, 0x44, 0xc0, 0x33, 0x46, 0x34,
+  0x93, 0x3e, 0xdc, 0xba, 0x12, 0xeb, 0x41, 0xff, 0xc3, 0x82, 0x14, 0x10, 0x84, 0xa8, 0x6a, 0xd1,
+  0x1b, 0x52, 0x34, 0x24, 0xcf, 0xc2, 0xa2, 0x25, 0x40, 0xcf, 0xdd, 0xdb, 0xae, 0xdd, 0xff, 0x1e,
+  0x14, 0xdf, 0x7c, 0xdd, 0xec, 0xa2, 0x15, 0x4f, 0x0b, 0xcf, 0x42, 0x40, 0x04, 0x3d, 0xb4, 0xdf,
+  0x8f, 0x6d, 0x31, 0xa8, 0x25, 0x3a, 0x14, 0x5e, 0x01, 0x6a, 0xf5, 0x9f, 0x02, 0x30, 0x01, 0x70,
+  0x21, 0x9f, 0x68, 0xe3, 0x9e, 0x59, 0xf5, 0x9f, 0x60, 0x5a, 0xe5, 0x9f, 0x6c, 0xe8, 0x6a, 0x11,
+  0x6d, 0x11, 0xdb, 0x71, 0xd8, 0x02, 0xde, 0xce, 0xdb, 0x64, 0x11, 0x02, 0x10, 0x04, 0x07, 0xed,
+  0x07, 0xd5, 0x02, 0x02, 0x00, 0x56, 0x3f, 0xed, 0xbe, 0xcb, 0xd7, 0x6d, 0xf8, 0x76, 0x54, 0x5d,
+  0x03, 0x12, 0xe0, 0xa0, 0xf3, 0x02, 0xad, 0x00, 0xaa, 0x2c, 0xd0, 0xed, 0xc7, 0x57, 0x44, 0x4c,
+  0x01, 0x75, 0x2b, 0x14, 0xa7, 0x2c, 0x7f, 0xc6, 0x02, 0x52, 0x11, 0xd5, 0x02, 0x3a, 0x14, 0x46,
+  0x17, 0xb6, 0x1f, 0xbc, 0x1c, 0x73, 0x1e, 0x57, 0x01, 0x0a, 0x5a, 0x1e, 0xe3, 0x09, 0x89, 0x0f,
+  0x82, 0x24, 0xac, 0x18, 0xdc, 0xef, 0xbe, 0x3a, 0x24, 0xa2, 0x05, 0x8b, 0xd8, 0xac, 0x0b, 0xc0,
+  0x02, 0xd2, 0x12, 0x53, 0x06, 0x2e, 0xa3, 0x36, 0x34, 0x43, 0x02, 0x73, 0x36, 0x2b, 0x94, 0x36,
+  0x33, 0x34, 0x43, 0x4b, 0xbf, 0x67, 0x01, 0x86, 0x00, 0x09, 0xfe, 0x02, 0xd0, 0x8c, 0x6f, 0x08,
+  0x50, 0xfe, 0x6a, 0x91, 0x07, 0xcf, 0x32, 0x9f, 0x55, 0x64, 0x41, 0xfd, 0xce, 0xbb, 0xcc, 0xbf,
+  0x89, 0x18, 0x1e, 0xde, 0xed, 0x80, 0x1f, 0xcd, 0xec, 0xdf, 0xba, 0x3c, 0xc1, 0x6a, 0x11, 0xef,
+  0xfe, 0xee, 0xcf, 0xec, 0xcc, 0x12, 0x6a, 0x01, 0x43, 0x50, 0x3f, 0x02, 0x00, 0xcd, 0xfd, 0xdf,
+  0xce, 0x40, 0x01, 0xfb, 0x38, 0xdf, 0xcc, 0xf9, 0x64, 0x21, 0xc6, 0x22, 0xcc, 0x12, 0xf5, 0x9f,
+  0x60, 0x59, 0xf5, 0x8d, 0x49, 0xe4, 0x05, 0x00, 0x6a, 0x11, 0x59, 0x80, 0xf5, 0xae, 0x7c, 0xe9,
+  0xde, 0xbd, 0xea, 0x64, 0x11, 0xc5, 0xa8, 0x15, 0xec, 0x02, 0x00, 0xee, 0xcd, 0xdb, 0x16, 0x07,
+  0x6a, 0x41, 0x27, 0x7a, 0x0f, 0x49, 0x04, 0x13, 0x04, 0xce, 0xba, 0x67, 0x01, 0xb8, 0x7f, 0x6e,
+  0xed, 0x2d, 0x0d, 0x2b, 0x24, 0xce, 0x70, 0xfd, 0x42, 0x1b, 0xcf, 0x12, 0xdb, 0x20, 0xb6, 0x47,
+  0x54, 0x64, 0x57, 0x9b, 0x0c, 0x56, 0x94, 0xbf, 0x09, 0x3e, 0x69, 0x18, 0xab, 0x65, 0x98, 0x0c,
+  0x1b, 0x3e, 0x82, 0x21, 0x57, 0x17, 0x00, 0x63, 0xb3, 0x3c, 0xea, 0x02, 0x56, 0x92, 0x24, 0x42,
+  0x0b, 0x72, 0x28, 0xef, 0xa4, 0xad, 0xe8, 0x3a, 0x14, 0x79, 0xb3, 0x90, 0x05, 0x44, 0x6c, 0x18,
+  0x59, 0x9c, 0x15, 0x44, 0x23, 0x64, 0x11, 0x69, 0x08, 0x93, 0x19, 0x07, 0xa3, 0xf0, 0x4a, 0x34,
+  0x92, 0x3e, 0x90, 0xd5, 0x0d, 0x87, 0x08, 0x40, 0xc0, 0x32, 0xff, 0x08, 0x10, 0xa7, 0x40, 0x29,
+  0x20, 0x8a, 0x78, 0x64, 0x61, 0xcc, 0x12, 0x0a, 0x37, 0x05, 0x00, 0xc8, 0xca, 0x9d, 0xcc, 0x1e,
+  0x04, 0xee, 0xed, 0x7d, 0x25, 0xcf, 0x02, 0x0c, 0xec, 0xbd, 0x64, 0x51, 0x6d, 0x01, 0xeb, 0xfd,
+  0xaf, 0xda, 0x6c, 0xfe, 0xbe, 0x01, 0x01, 0xab, 0x05, 0xfd, 0x02, 0x00, 0x6a, 0x31, 0xee, 0x00,
+  0xbe, 0xe9, 0xee, 0x8e, 0xd9, 0xee, 0xad, 0xfb, 0x98, 0xcf, 0xba, 0xf7, 0x37, 0x24, 0x6a, 0x51,
+  0x58, 0xd3, 0x61, 0x21, 0x32, 0xe5, 0x6a, 0x71, 0x7d, 0xfa, 0xa8, 0x35, 0xab, 0x15, 0xcd, 0xeb,
+  0x00, 0xcc, 0xab, 0xb9, 0xcc, 0xbc, 0xca, 0xbc, 0xac, 0x00, 0xca, 0xcb, 0xab, 0xb9, 0x77, 0x76,
+  0x77, 0x66, 0x00, 0x78, 0x89, 0x99, 0x9b, 0xa9, 0xca, 0xac, 0x77, 0xb0, 0xc7, 0x6c, 0x66, 0xee,
+  0xbd, 0x22, 0x8f, 0x43, 0xde, 0xb9, 0x30, 0x87, 0x02, 0x10, 0x07, 0x07, 0xf6, 0x02, 0xa9, 0x97,
+  0x47, 0x64, 0xfb, 0x16, 0x1c, 0x68, 0x57, 0x84, 0x05, 0xcc, 0x02, 0x4f, 0x01, 0x72, 0x46, 0x33,
+  0xfa, 0x53, 0xd2, 0x12, 0x44, 0x7b, 0x08, 0x11, 0x10, 0xa4, 0x2c, 0xb3, 0x3c, 0x6d, 0x11, 0x84,
+  0x47, 0x35, 0x08, 0x30, 0x83, 0x23, 0x55, 0x6b, 0x64, 0x11, 0x15, 0xa2, 0x25, 0xcd, 0x3a, 0x14,
+  0xd6, 0x0d, 0x07, 0x34, 0x25, 0x84, 0x41, 0x34, 0x04, 0x6a, 0x34, 0x73, 0x34, 0x37, 0x34, 0x34,
+  0x43, 0x20, 0x53, 0x33, 0x47, 0x34, 0xa4, 0xcf, 0x02, 0x4e, 0xdc, 0xff, 0xab, 0x62, 0xec, 0xc6,
+  0xa8, 0xae, 0x8f, 0xff, 0xa2, 0xa5, 0x9f, 0x65, 0x27, 0x12, 0x70, 0x01, 0x68, 0xfd, 0xcb, 0x98,
+  0x7d, 0x1f, 0xee, 0xcf, 0x12, 0x6a, 0x21, 0xde, 0xa8, 0xcc, 0xcc, 0xbb, 0x9f, 0x45, 0xfe, 0x0b,
+  0x03, 0xda, 0x67, 0x01, 0x0c, 0xfd, 0xae, 0x61, 0x01, 0xd2, 0xa2, 0xee, 0xae, 0xd9, 0xed, 0x10,
+  0x8d, 0xe9, 0xee, 0xad, 0x13, 0x07, 0xfb, 0xcf, 0xa9, 0x73, 0x99, 0x25, 0x02, 0x20, 0x8d, 0x39,
+  0x64, 0x41, 0x6a, 0x51, 0x14, 0x10, 0xae, 0x94, 0x8d, 0xfa, 0x67, 0x21, 0xfb, 0x05, 0x00, 0xbc,
+  0x9d, 0x79, 0x24, 0x01, 0xc5, 0x0c, 0xee, 0xfe, 0xab, 0xa4, 0x56, 0x34, 0x56, 0x00, 0x78, 0x77,
+  0x86, 0x79, 0x66, 0x86, 0x68, 0x66, 0xc4, 0x79, 0x88, 0x04, 0x07, 0xff, 0xde, 0xee, 0x2b, 0x24,
+  0xe0, 0x20, 0x0b, 0x08, 0x00, 0x80, 0x33, 0xde, 0x37, 0x14, 0x65, 0x77, 0x47, 0x75, 0xff, 0x01,
+  0x07, 0x36, 0x4b, 0xb3, 0x09, 0x52, 0x11, 0xdd, 0x0c, 0x05, 0x00, 0x22, 0x14, 0x1b, 0x3e, 0x3f,
+  0x6b, 0x0f, 0x99, 0x05, 0xa4, 0x1c, 0x7d, 0x1f, 0xce, 0x1c, 0xf2, 0x19, 0x23, 0x22, 0x34, 0x4b,
+  0xde, 0xcf, 0x32, 0xce, 0xa2, 0x35, 0x0d, 0x07, 0x73, 0x35, 0x44, 0x35, 0x83, 0x6e, 0x2f, 0x53,
+  0x34, 0x39, 0x9e, 0x2c, 0x28, 0x01, 0x34, 0x04, 0x4a, 0x34, 0xb3, 0x4a, 0x44, 0xa3, 0x4e, 0xff,
+  0x9f, 0x05, 0x8d, 0x65, 0x02, 0x00, 0x9f, 0x95, 0xd7, 0x59, 0x4f, 0xe4, 0x11, 0x00, 0xbb, 0x67,
+  0x87, 0x29, 0x69, 0x37, 0x34, 0x64, 0x11, 0xcc, 0xa9, 0xcb, 0xbf, 0xee, 0x16, 0x40, 0xee, 0xfe,
+  0xfe, 0xee, 0xfd, 0xee, 0x00, 0x11, 0xed, 0x30, 0xde, 0xcb, 0xbc, 0xcb, 0x64, 0x21, 0xcf, 0x52,
+  0x9f, 0xda, 0xbc, 0xfe, 0xae, 0xcf, 0x32, 0x89, 0x01, 0x02, 0x20, 0xcf, 0x12, 0xd9, 0xcf, 0x02,
+  0x84, 0xde, 0xae, 0xfd, 0x3d, 0xfb, 0xaf, 0x8a, 0xf6, 0x3d, 0x14, 0x04, 0x68, 0xd3, 0x64, 0xa1,
+  0x58, 0xf5, 0x9f, 0x58, 0xe5, 0x01, 0x02, 0x10, 0x59, 0xe6, 0xbf, 0x8d, 0xea, 0xdf, 0xbd, 0x70,
+  0xeb, 0xdd, 0xab, 0xc9, 0x38, 0x1a, 0x9b, 0x04, 0xe7, 0x25, 0xee, 0x00, 0xd5, 0x77, 0x35, 0x64,
+  0x56, 0x77, 0x87, 0x79, 0xe0, 0x77, 0x87, 0x78, 0x67, 0x8e, 0x89, 0x0f, 0xbf, 0x1c, 0xad, 0x00,
+  0x38, 0xee, 0xdf, 0xfd, 0x08, 0x10, 0x9f, 0x35, 0x76, 0x11, 0xdd, 0xed, 0x00, 0xcb, 0xaa, 0x74,
+  0x77, 0x47, 0x74, 0x75, 0x47, 0x3f, 0xcc, 0x02, 0xcf, 0x12, 0x55, 0x01, 0x18, 0x2e, 0x46, 0x01,
+  0xa1, 0x1c, 0x84, 0x58, 0xed, 0x14, 0x00, 0x46, 0xb3, 0x1c, 0x76, 0x01, 0x46, 0x2e, 0x07, 0x3c,
+  0x0b, 0x4c, 0x04, 0xcb, 0xbf, 0x0c, 0x11, 0x00, 0x22, 0x02, 0x0f, 0x39, 0xab, 0x9f, 0x05, 0xa2,
+  0x85, 0x92, 0xbd, 0x1b, 0x0e, 0x35, 0x94, 0xa1, 0x2c, 0x43, 0x43, 0x9c, 0x35, 0x00, 0x35, 0x33,
+  0x35, 0x73, 0x3b, 0x44, 0xa3, 0x4b, 0xfc, 0x34, 0x72, 0x07, 0x17, 0x5a, 0xf8, 0x0e, 0xf0, 0xcc,
+  0x52, 0xab, 0x85, 0x61, 0xcd, 0xe1, 0x05, 0x10, 0xde, 0xcc, 0xca, 0x9c, 0x64, 0x01, 0x40, 0x01,
+  0xb6, 0x22, 0x05, 0xad, 0x02, 0xee, 0xe8, 0x06, 0xee, 0xde, 0xfc, 0xde, 0xdc, 0x02, 0xbc, 0xcf,
+  0x72, 0xff, 0xff, 0xed, 0xee, 0xbf, 0xeb, 0x1c, 0xfe, 0xce, 0xb3, 0x5c, 0x3a, 0x34, 0x3d, 0x14,
+  0xeb, 0xee, 0xae, 0x0e, 0xea, 0xa8, 0x05, 0xe3, 0x09, 0x6a, 0x11, 0xcc, 0xfa, 0xaf, 0x79, 0x03,
+  0xcc, 0x02, 0x2e, 0x44, 0x8e, 0x59, 0xf5, 0x8f, 0x59, 0xe5, 0x06, 0x8f, 0x05, 0x10, 0x02, 0x40,
+  0x8e, 0x69, 0xf6, 0xbe, 0x9c, 0x38, 0xea, 0xbc, 0x9d, 0x95, 0x4f, 0x6a, 0x11, 0xd2, 0x02, 0xdd,
+  0xec, 0x00, 0x45, 0x64, 0x68, 0x46, 0x77, 0x88, 0x77, 0x97, 0xf8, 0x78, 0x78, 0x9e, 0xcc, 0x02,
+  0x55, 0x11, 0xda, 0x29, 0xa5, 0x35, 0x83, 0x43, 0x00, 0xed, 0xdf, 0xec, 0xed, 0xc6, 0x57, 0x74,
+  0x77, 0x18, 0x57, 0x74, 0x76, 0x07, 0x07, 0x6e, 0x2f, 0x94, 0x68, 0x46, 0x3c, 0x83, 0x47, 0xf7,
+  0x1d, 0xa2, 0x05, 0xc0, 0x02, 0xb3, 0x2c, 0x57, 0x95, 0x67, 0x78, 0x48, 0x02, 0x00, 0x5a, 0x2b,
+  0x57, 0x24, 0x1c, 0x27, 0xac, 0x1d, 0x35, 0x26, 0x68, 0x61, 0x01, 0x6a, 0x31, 0xbd, 0xf8, 0x67,
+  0x21, 0xd7, 0xbc, 0x84, 0x35, 0x83, 0x37, 0x04, 0x59, 0x33, 0x42, 0x63, 0x6e, 0x1f, 0xf5, 0x9c,
+  0x35, 0x4b, 0x37, 0x14, 0x33, 0xcf, 0x12, 0x0a, 0xd4, 0x4e, 0xfb, 0x7e, 0x68, 0x03, 0xd1, 0xac,
+  0xa2, 0x55, 0xfd, 0xdd, 0xbb, 0xa9, 0x98, 0x77, 0xc0, 0x75, 0x65, 0x45, 0x43, 0x47, 0x77, 0x5c,
+  0x01, 0x2f, 0x00, 0x8f, 0x0d, 0x14, 0x68, 0x01, 0xcf, 0x52, 0xda, 0x09, 0xcd, 0xdc, 0xcc, 0x9c,
+  0x55, 0xbf, 0x0a, 0x47, 0x73, 0x01, 0x02, 0x10, 0x78, 0x48, 0x10, 0x87, 0x96, 0x02, 0xce, 0x02,
+  0x00, 0xf1, 0x51, 0x1b, 0xdf, 0xc9, 0xb5, 0x25, 0x24, 0x5e, 0x11, 0xcf, 0x12, 0xcc, 0x12, 0x43,
+  0xd2, 0x12, 0x02, 0x00, 0x8e, 0x58, 0xf5, 0x8f, 0x05, 0x10, 0xd5, 0x70, 0xbf, 0xac, 0xfc, 0xcf,
+  0xcd, 0x08, 0x6a, 0x31, 0x4c, 0x07, 0xdd, 0x00, 0xfd, 0xac, 0xb4, 0x56, 0x46, 0x74, 0x56, 0x78,
+  0xf8, 0x86, 0x78, 0xdd, 0x19, 0x07, 0x02, 0x00, 0xc9, 0x12, 0xcc, 0x12, 0x87, 0x00, 0x03, 0xb5,
+  0x1a, 0xcf, 0x52, 0x98, 0xa7, 0x47, 0x75, 0x76, 0x47, 0xa8, 0x75, 0x77, 0x47, 0x8c, 0x5c, 0x58,
+  0x4b, 0x28, 0x46, 0x57, 0x08, 0x4e, 0x24, 0xa1, 0x1c, 0xb3, 0x1c, 0xd2, 0x02, 0x35, 0x72, 0x83,
+  0x2f, 0x53, 0x6e, 0x36, 0x5a, 0x1e, 0x20, 0x00, 0x34, 0x04, 0x73, 0xc3, 0x05, 0x0b, 0x0f, 0x34,
+  0x0c, 0xbd, 0xeb, 0x0a, 0x47, 0xa2, 0x45, 0xd8, 0xbd, 0x8a, 0xc3, 0x00, 0x59, 0x36, 0xa2, 0x58,
+  0x33, 0x43, 0x83, 0x39, 0x00, 0x44, 0xa3, 0x39, 0x32, 0x63, 0x33, 0x46, 0x33, 0xc1, 0x34, 0x04,
+  0xb3, 0x47, 0x23, 0x33, 0x4e, 0x6f, 0x38, 0x34, 0x34, 0x2f, 0x3d, 0x01, 0x73, 0xa1, 0x04, 0x67,
+  0x73, 0xb1, 0xfe, 0xdb, 0x0e, 0xdc, 0xcd, 0x00, 0xcc, 0xba, 0xaa, 0x99, 0x87, 0x87, 0x67, 0x54,
+  0xc4, 0x54, 0x34, 0x83, 0x5f, 0x23, 0x44, 0x5f, 0xb3, 0x02, 0xa2, 0x22, 0xbf, 0x01, 0x00, 0x47,
+  0x0e, 0x9f, 0x05, 0x02, 0x00, 0x6a, 0x11, 0x3f, 0x0b, 0xde, 0x1a, 0x10, 0x7f, 0x02, 0x60, 0xb0,
+  0x6c, 0xf6, 0x02, 0x3d, 0x44, 0xe3, 0x89, 0x96, 0x02, 0xde, 0x2c, 0xab, 0xe0, 0x7d, 0xeb, 0xdf,
+  0xab, 0xe8, 0xa5, 0x25, 0x6a, 0x11, 0xd2, 0x02, 0x0d, 0x5e, 0x21, 0xe5, 0x61, 0x01, 0x6d, 0x31,
+  0x7d, 0x48, 0xf6, 0x8f, 0xf0, 0x69, 0xf7, 0xcf, 0xac, 0xfc, 0x02, 0x6a, 0x01, 0xd6, 0x08, 0x02,
+  0x10, 0x00, 0xef, 0xd9, 0xb9, 0x35, 0x63, 0x45, 0x46, 0x67, 0xc0, 0x88, 0xef, 0xce, 0xed, 0xef,
+  0xcf, 0x5e, 0x11, 0xd2, 0x32, 0xc7, 0x02, 0x10, 0xd2, 0x32, 0x08, 0x00, 0xdd, 0xcb, 0x64, 0xcc,
+  0x02, 0x02, 0x20, 0xd6, 0x54, 0xe8, 0x2d, 0xae, 0x12, 0x83, 0x3f, 0x0b, 0x58, 0x86, 0x1f, 0xbc,
+  0x2c, 0x7c, 0x56, 0x84, 0x7f, 0x01, 0x87, 0x08, 0x8d, 0x05, 0x02, 0x10, 0xc6, 0x15, 0x93, 0x19,
+  0xdd, 0x19, 0x34, 0x62, 0xc2, 0x09, 0xef, 0x00, 0x13, 0x8b, 0xcc, 0x0b, 0xcf, 0x42, 0x6a, 0x01,
+  0x9b, 0x3a, 0x34, 0xd7, 0xac, 0x35, 0x93, 0xaa, 0x48, 0x09, 0x3e, 0x3a, 0x39, 0x0b, 0x4a, 0xcf,
+  0x22, 0x44, 0xcf, 0x22, 0x0f, 0xf8, 0xd6, 0x36, 0xab, 0x11, 0x60, 0x14, 0x70, 0xde, 0xba, 0xd8,
+  0x74, 0xd2, 0x33, 0x5b, 0x61, 0x32, 0x34, 0x05, 0x60, 0x13, 0x55, 0x01, 0x40, 0x11, 0xb3, 0x4c,
+  0x41, 0x9f, 0x15, 0xde, 0xfe, 0x64, 0x01, 0x37, 0x04, 0xef, 0xd7, 0x09, 0x7f, 0xc9, 0x42, 0xc6,
+  0x32, 0x02, 0x60, 0xcf, 0x52, 0x02, 0x2a, 0x6d, 0x21, 0x6a, 0x41, 0xfc, 0x08, 0xef, 0xda, 0xa7,
+  0x92, 0x2c, 0xeb, 0xce, 0xaa, 0xe7, 0x3d, 0x3a, 0x14, 0x68, 0xcc, 0x12, 0x9c, 0x25, 0x61, 0x11,
+  0x6a, 0x01, 0x8f, 0x57, 0x10, 0xd4, 0x8f, 0x58, 0xf6, 0x02, 0x10, 0x69, 0xf7, 0xbf, 0x0e, 0xbc,
+  0x6a, 0x11, 0x02, 0x10, 0x40, 0x24, 0x79, 0x93, 0x55, 0x35, 0xbe, 0x5d, 0x92, 0x1f, 0x51, 0x1b,
+  0xd5, 0x22, 0x40, 0x04, 0x43, 0x24, 0xfd, 0xcf, 0x32, 0x58, 0xfd, 0xd6, 0x68, 0xcc, 0x32, 0x0a,
+  0x07, 0x64, 0xc5, 0x39, 0x85, 0xd6, 0x68, 0xe9, 0x16, 0xf8, 0x06, 0x63, 0x89, 0x0c, 0x58, 0xe3,
+  0x19, 0x0a, 0x07, 0x16, 0x84, 0x68, 0x2f, 0xd2, 0x02, 0x63, 0x81, 0x28, 0x94, 0x58, 0x23, 0x48,
+  0x64, 0x47, 0x23, 0x67, 0x01, 0x43, 0x24, 0xf5, 0x00, 0x56, 0x2a, 0x7b, 0x76, 0x13, 0xbd, 0x6a,
+  0x21, 0xad, 0x3a, 0x34, 0xd8, 0xbd, 0xcc, 0x69, 0xb2, 0xcf, 0x02, 0x06, 0x0e, 0x93, 0x38, 0x39,
+  0x2b, 0x6c, 0x18, 0xe0, 0x43, 0x34, 0x23, 0x4e, 0xcc, 0xe6, 0x96, 0x7b, 0x85, 0x3a, 0x64, 0xc3,
+  0xbc, 0x9c, 0x98, 0x2c, 0xce, 0x88, 0x95, 0x63, 0x55, 0x11, 0xa3, 0x14, 0xf3, 0x6a, 0x11, 0x08,
+  0x50, 0x3a, 0xab, 0x21, 0x3b, 0x02, 0x40, 0x51, 0x21, 0x45, 0x04, 0xfd, 0x37, 0x34, 0xce, 0x3f,
+  0x0b, 0xc9, 0x72, 0x02, 0x90, 0x61, 0x21, 0x3a, 0x34, 0x3d, 0x84, 0x01, 0x6a, 0x01, 0xaa, 0x8e,
+  0xeb, 0xef, 0xcd, 0xeb, 0xef, 0x44, 0xbd, 0xeb, 0xec, 0x06, 0xce, 0x99, 0xf7, 0x61, 0x11, 0x68,
+  0x07, 0x64, 0x11, 0xcf, 0x32, 0xd8, 0x02, 0x7e, 0x47, 0xe5, 0x8f, 0x67, 0xa2, 0xf5, 0x02, 0x20,
+  0xf6, 0x8f, 0x59, 0x6a, 0x01, 0xfb, 0xde, 0x0f, 0x41, 0x6a, 0x41, 0xd8, 0xa9, 0x67, 0x7d, 0xec,
+  0x75, 0x00, 0xef, 0x3d, 0x02, 0x00, 0xde, 0x02, 0x10, 0xe0, 0x09, 0x3a, 0x14, 0xd5, 0x32, 0xdf,
+  0xed, 0x1c, 0x9a, 0x97, 0x64, 0x01, 0x9c, 0x05, 0xcf, 0x12, 0x75, 0x73, 0x36, 0xd3, 0x71, 0x1f,
+  0xc2, 0x09, 0x73, 0x47, 0x19, 0x14, 0x72, 0x19, 0x04, 0x09, 0x1e, 0x01, 0x3c, 0x0b, 0x46, 0x85,
+  0x58, 0x35, 0x74, 0x47, 0x35, 0xcf, 0x54, 0x2b, 0xea, 0x02, 0xe9, 0x19, 0xab, 0x05, 0x53, 0x35,
+  0x95, 0x0c, 0xf2, 0x20, 0x8e, 0xde, 0xda, 0x39, 0xd2, 0x12, 0x3a, 0x54, 0x8b, 0xd5, 0x79, 0x37,
+  0x04, 0x00, 0x3a, 0x33, 0xa3, 0x26, 0x33, 0x34, 0x73, 0x3a, 0xc1, 0x6c, 0x18, 0x52, 0x43, 0x34,
+  0x33, 0x4d, 0x07, 0x67, 0x0c, 0xbe, 0xc7, 0x31, 0xa4, 0x30, 0x6b, 0x8e, 0x11, 0xec, 0xbd, 0x87,
+  0xc9, 0xa2, 0x08, 0x50, 0xfc, 0x66, 0x7f, 0x5e, 0x01, 0xa5, 0x42, 0x69, 0x18, 0x5e, 0x5f, 0xa1,
+  0x12, 0xcf, 0x42, 0x3f, 0xc9, 0xe2, 0x37, 0x34, 0x67, 0x1b, 0x13, 0x47, 0x6d, 0x21, 0x40, 0x24,
+  0xdb, 0xa8, 0x39, 0x50, 0x0f, 0xde, 0xce, 0x1e, 0x1b, 0x62, 0x0f, 0x6a, 0x01, 0xbe, 0x99, 0x23,
+  0x48, 0x0b, 0x4f, 0x01, 0xe5, 0x8f, 0x68, 0x3d, 0x44, 0x7e, 0x48, 0xc2, 0xf5, 0x0b, 0x00, 0x7f,
+  0x58, 0xf6, 0x7f, 0x0e, 0x00, 0x6a, 0x01, 0x1c, 0x69, 0xf8, 0x40, 0x04, 0x6a, 0x01, 0x6d, 0x21,
+  0xdb, 0xcd, 0xad, 0xf8, 0xfc, 0xee, 0xcd, 0x41, 0x00, 0x02, 0x10, 0xd8, 0x02, 0x6d, 0x11, 0xae,
+  0x65, 0xa0, 0xdc, 0xcb, 0x64, 0x76, 0x57, 0xcf, 0x22, 0x57, 0xd2, 0x02, 0xfc, 0x75, 0x75, 0x64,
+  0x01, 0x75, 0x15, 0x86, 0x4c, 0x7a, 0x2f, 0xe1, 0x02, 0x7c, 0x11, 0x7b, 0x58, 0x01, 0x14, 0x00,
+  0x82, 0x37, 0x04, 0x79, 0x01, 0x55, 0x14, 0x16, 0x17, 0x62, 0x05, 0xb1, 0x02, 0x35, 0x5d, 0x12,
+  0x37, 0x9a, 0xce, 0xfb, 0xdf, 0xa5, 0x6a, 0x01, 0xcd, 0x6d, 0x01, 0xfb, 0xef, 0x64, 0x01, 0x7b,
+  0xe0, 0x39, 0x04, 0x83, 0x83, 0xcf, 0x02, 0x35, 0x43, 0x34, 0x93, 0x4b, 0x08, 0x45, 0xb3, 0x4a,
+  0xfc, 0x02, 0x44, 0x33, 0x4d, 0xcc, 0xd3, 0x52, 0x81, 0x4f, 0x11, 0xea, 0xaf, 0x49, 0x34, 0xee,
+  0x3e, 0x0f, 0x6d, 0xf1, 0x59, 0x02, 0x10, 0xe8, 0x55, 0xc0, 0x32, 0xcc, 0x42, 0x34, 0x0b, 0x20,
+  0x44, 0xee, 0x45, 0x30, 0x0b, 0xb1, 0x62, 0xcf, 0x12, 0xee, 0x6a, 0x08, 0x6d, 0x11, 0xa1, 0x32,
+  0x7f, 0x52, 0x0f, 0x5b, 0x21, 0x8b, 0x21, 0xf3, 0x62, 0x0e, 0x40, 0xcf, 0xb2, 0x6a, 0x21, 0xaa,
+  0x66, 0x8e, 0x8a, 0x22, 0x06, 0x03, 0xce, 0xeb, 0x27, 0x1e, 0x6a, 0x11, 0xea, 0x1c, 0xbe, 0x99,
+  0x61, 0x01, 0x28, 0x04, 0xcf, 0x02, 0xf6, 0x8e, 0x56, 0x7a, 0xd3, 0xc9, 0x02, 0x7f, 0x67, 0x01,
+  0x02, 0x00, 0x08, 0x00, 0x02, 0x00, 0x57, 0x0c, 0xf6, 0x7f, 0x40, 0x04, 0x16, 0x27, 0xdf, 0xd9,
+  0xb7, 0xde, 0xf8, 0xcd, 0xeb, 0xdf, 0x0e, 0x03, 0xe0, 0x01, 0x6a, 0x01, 0x3d, 0x54, 0xd8, 0x32,
+  0x80, 0xdd, 0xc4, 0x45, 0x65, 0x67, 0x57, 0x65, 0xcf, 0x32, 0x81, 0x70, 0x01, 0x77, 0x57, 0x33,
+  0x64, 0x58, 0x34, 0x96, 0x05, 0x3f, 0x1b, 0x1b, 0x61, 0x11, 0x6d, 0x21, 0x71, 0x0f, 0x73, 0x31,
+  0x12, 0x1e, 0x34, 0x74, 0x43, 0xaa, 0x2c, 0x7f, 0x01, 0x73, 0x36, 0x24, 0x73, 0xb9, 0x09, 0x45,
+  0x82, 0x32, 0xda, 0x09, 0x34, 0x45, 0xbe, 0xfb, 0xde, 0xa2, 0x35, 0x07, 0x75, 0x18, 0x18, 0x2e,
+  0xe0, 0x29, 0x76, 0x39, 0x33, 0xa3, 0x34, 0x2d, 0x09, 0x2e, 0xb4, 0x04, 0x07, 0xcf, 0x12, 0xcb,
+  0x31, 0xc4, 0xfd, 0xbe, 0x80, 0x88, 0xe9, 0x8e, 0x99, 0xea, 0x9e, 0xaa, 0x3a, 0xf4, 0xdd, 0x2e,
+  0x47, 0xd5, 0xf8, 0x06, 0x2b, 0x14, 0xd2, 0xa2, 0x4e, 0xc9, 0x19, 0x61, 0x51, 0xb3, 0xa5, 0x22,
+  0x02, 0x10, 0xee, 0xdf, 0x9f, 0x35, 0x3e, 0x18, 0xdf, 0xb1, 0x42, 0xef, 0x6d, 0x01, 0x2b, 0x37,
+  0x34, 0x24, 0x61, 0x01, 0xee, 0x64, 0x31, 0xa5, 0x45, 0x6b, 0x1c, 0x60, 0xef, 0xdb, 0xa9, 0xee,
+  0xdf, 0x5a, 0x35, 0x02, 0x20, 0xbe, 0x4c, 0xfc, 0xde, 0xcf, 0x00, 0xfd, 0x2d, 0xbf, 0x88, 0x3a,
+  0x44, 0x7e, 0x7d, 0x01, 0x07, 0x57, 0x02, 0x00, 0x37, 0x14, 0x61, 0x01, 0x08, 0x40, 0x79, 0x11,
+  0xf7, 0x40, 0xbf, 0xad, 0xfc, 0xbe, 0xbb, 0xd9, 0xc2, 0x2c, 0xec, 0x3f, 0x02, 0x00, 0xd5, 0x02,
+  0xb6, 0x14, 0xb5, 0x21, 0x2a, 0x06, 0x56, 0x00, 0x56, 0x63, 0x38, 0x24, 0x44, 0x56, 0x31, 0x14,
+  0x6a, 0x01, 0x02, 0x00, 0x75, 0x87, 0xa1, 0x0a, 0x07, 0x57, 0x34, 0x62, 0x46, 0x1c, 0x24, 0x48,
+  0xa1, 0x1c, 0xfc, 0x84, 0x68, 0xf7, 0x0d, 0x09, 0x1e, 0xe4, 0x02, 0x82, 0x01, 0xb7, 0x25, 0xcc,
+  0x32, 0x21, 0x14, 0x10, 0x83, 0x6a, 0x34, 0x63, 0x0a, 0x27, 0x32, 0x13, 0x20, 0xac, 0xdb, 0xdf,
+  0xac, 0xec, 0xa2, 0x35, 0xdf, 0xbe, 0x04, 0xf9, 0xce, 0x67, 0x41, 0xd8, 0xbd, 0x37, 0x53, 0x93,
+  0x00, 0x34, 0x43, 0x33, 0xb3, 0x4b, 0x44, 0xa3, 0x45, 0x80, 0x33, 0x33, 0x53, 0x44, 0x33, 0x4c,
+  0xbb, 0x16, 0x84, 0x71, 0x4f, 0x41, 0xfd, 0xce, 0xcc, 0x53, 0x5f, 0xab, 0x95, 0x6d, 0x51, 0xe6,
+  0x96, 0x56, 0x61, 0x31, 0xcf, 0x42, 0x43, 0x08, 0x10, 0xdd, 0xdf, 0x61, 0x31, 0x87, 0x3a, 0x21,
+  0x69, 0x18, 0x05, 0x10, 0xee, 0xed, 0xfe, 0xee, 0x14, 0x25, 0x81, 0x98, 0x32, 0xfe, 0xbf, 0xdb,
+  0xfd, 0xbf, 0xed, 0x4c, 0x21, 0xf3, 0x29, 0x10, 0x46, 0x44, 0xef, 0xec, 0x17, 0x00, 0x4b, 0x0b,
+  0xcf, 0x42, 0x1d, 0x10, 0xe8, 0xee, 0xba, 0x8f, 0x78, 0x12, 0xff, 0xe9, 0x13, 0x02, 0x10, 0xf8,
+  0x13, 0x03, 0x99, 0x12, 0x3d, 0x14, 0xde, 0xbc, 0xfb, 0xae, 0x88, 0xf6, 0xd0, 0x8e, 0x57, 0xe4,
+  0x7e, 0x2e, 0x14, 0xf6, 0xc3, 0x12, 0x61, 0x11, 0x40, 0xf4, 0x7e, 0x47, 0xf4, 0x7e, 0x57, 0xd2,
+  0x22, 0x67, 0x82, 0xf6, 0x6a, 0x01, 0x8c, 0x6c, 0xeb, 0xdf, 0xbc, 0x2c, 0x10, 0x18, 0xde, 0xbd,
+  0xfc, 0x02, 0x20, 0x40, 0x74, 0xee, 0xd7, 0x88, 0x48, 0x23, 0x43, 0x35, 0x67, 0x01, 0x75, 0x66,
+  0xc9, 0x12, 0x75, 0x00, 0x76, 0x57, 0x76, 0x76, 0x58, 0x75, 0x72, 0x35, 0xbf, 0x54, 0x38, 0x68,
+  0x1f, 0x66, 0x18, 0x2a, 0x1b, 0x58, 0x11, 0xe4, 0x02, 0x74, 0x99, 0x55, 0x07, 0xdb, 0x02, 0x5e,
+  0x24, 0x89, 0x0c, 0x24, 0x83, 0x44, 0x33, 0x53, 0xb9, 0x68, 0x19, 0x67, 0x9b, 0x40, 0x06, 0x34,
+  0x14, 0x3a, 0x24, 0xdf, 0x3a, 0x14, 0x82, 0xc8, 0x67, 0x11, 0x7a, 0xd3, 0x74, 0x34, 0x34, 0x6c,
+  0x58, 0xe0, 0x43, 0x34, 0x34, 0x57, 0x55, 0xb7, 0x82, 0x68, 0x8f, 0xe1, 0x42, 0xb3, 0xa8, 0xc5,
+  0x02, 0x20, 0xec, 0xaa, 0xcf, 0x72, 0x02, 0x30, 0x3b, 0xac, 0x01, 0x0f, 0x77, 0x4c, 0xcf, 0x32,
+  0x9f, 0x05, 0xa7, 0x02, 0xee, 0xde, 0xdb, 0xed, 0x40, 0xbd, 0xdc, 0xde, 0xdd, 0xee, 0xce, 0x29,
+  0x05, 0xfb, 0xc2, 0xee, 0x6b, 0x0f, 0xfe, 0xaf, 0xda, 0xff, 0x91, 0x01, 0xf0, 0x22, 0x91, 0x6d,
+  0x21, 0xfe, 0xfe, 0xcf, 0x83, 0x2f, 0xaf, 0xec, 0x40, 0x74, 0xbc, 0xeb, 0xa9, 0xe5, 0x7a, 0xbc,
+  0x06, 0x3c, 0x00, 0x02, 0x20, 0xde, 0xae, 0x05, 0xc1, 0x65, 0x2f, 0xde, 0xbc, 0xfa, 0x9d, 0x67,
+  0x01, 0x07, 0xcf, 0x92, 0x28, 0xe4, 0x8e, 0x47, 0x02, 0x00, 0xf4, 0x40, 0x44, 0x67, 0xe5, 0xa0,
+  0x6e, 0x48, 0xe6, 0x9f, 0x8c, 0x6a, 0x61, 0xeb, 0x43, 0x24, 0x02, 0xec, 0x02, 0x10, 0xce, 0xec,
+  0xac, 0xa3, 0x34, 0x34, 0x05, 0x67, 0x61, 0x66, 0xcf, 0x02, 0x67, 0x65, 0x87, 0x67, 0x75, 0xc2,
+  0x74, 0x03, 0x2e, 0x72, 0x36, 0x24, 0x53, 0xe3, 0x09, 0x4e, 0x1b, 0xc4, 0x46, 0x84, 0x2e, 0x24,
+  0x72, 0x35, 0x44, 0xb7, 0x15, 0x79, 0x21, 0x81, 0x22, 0x17, 0x36, 0x45, 0x72, 0x46, 0x36, 0xb3,
+  0xf4, 0x0d, 0x72, 0x35, 0xa2, 0x25, 0x13, 0x33, 0x7d, 0x0f, 0x9f, 0x55, 0x02, 0x00, 0xad, 0x45,
+  0x3a, 0x14, 0xad, 0xe0, 0x39, 0x23, 0x44, 0x23, 0x6c, 0x08, 0xa3, 0xc1, 0x64, 0x01, 0x53, 0x34,
+  0x33, 0x4a, 0x98, 0xb7, 0x82, 0xd1, 0x99, 0x2f, 0x02, 0xf0, 0x20, 0x30, 0x79, 0x11, 0x69, 0x58,
+  0x14, 0xd5, 0x32, 0x87, 0x8f, 0x78, 0xfe, 0xfd, 0xbf, 0x2b, 0x51, 0x0f, 0x1b, 0x40, 0x11, 0x81,
+  0x04, 0xed, 0x80, 0xbe, 0xdb, 0xed, 0xae, 0xda, 0xdd, 0xcc, 0xfa, 0x23, 0xe4, 0xfb, 0xde, 0x4f,
+  0x21, 0xda, 0xee, 0x06, 0x5e, 0x0a, 0x37, 0x38, 0x20, 0x85, 0x02, 0x00, 0xdb, 0xcc, 0x42, 0xfe,
+  0xee, 0xcb, 0x9f, 0x5e, 0x11, 0xc3, 0x6a, 0x01, 0xfa, 0x0a, 0xee, 0xce, 0xfd, 0xfe, 0x57, 0x15,
+  0xfb, 0x13, 0x05, 0x6a, 0x31, 0xdf, 0xe9, 0x09, 0xbb, 0xc8, 0xcd, 0xac, 0xfb, 0x04, 0xaf, 0x88,
+  0x99, 0x75, 0x8f, 0x47, 0xe4, 0x7f, 0x47, 0x9c, 0xe3, 0x7f, 0x05, 0x00, 0xcc, 0x02, 0x11, 0x00,
+  0x66, 0xe4, 0xe4, 0x02, 0x80, 0x7f, 0x57, 0xe5, 0x8f, 0x7c, 0xea, 0xcf, 0xab, 0x08, 0x07, 0x9d,
+  0x11, 0xd2, 0x22, 0x02, 0x00, 0xcc, 0xdb, 0x45, 0x53, 0x45, 0x00, 0x23, 0x42, 0x34, 0x44, 0x55,
+  0x56, 0x65, 0x76, 0x22, 0x56, 0xcc, 0x12, 0x87, 0x68, 0x76, 0x05, 0x00, 0x86, 0x57, 0x88, 0x23,
+  0x43, 0x46, 0x71, 0x3f, 0x46, 0x85, 0x79, 0x86, 0x1f, 0xcc, 0x94, 0x68, 0xbd, 0x12, 0xe1, 0x02,
+  0x72, 0x36, 0xd1, 0x19, 0x79, 0x01, 0x08, 0x83, 0x47, 0x44, 0x2d, 0x0e, 0x72, 0x25, 0x36, 0xa4,
+  0x10, 0x6a, 0x36, 0xb2, 0x47, 0xac, 0x01, 0x33, 0x43, 0x23, 0xf0, 0x22, 0x49, 0xac, 0xbe, 0x61,
+  0x21, 0x6a, 0x01, 0x02, 0x10, 0xdd, 0x29, 0x39, 0x0d, 0x37, 0x7a, 0xb2, 0xcf, 0x12, 0xd4, 0x09,
+  0xcf, 0x12, 0x5c, 0xbb, 0xbf, 0x5b, 0x51, 0xee, 0x6d, 0x0e, 0x10, 0x11, 0x60, 0x08, 0x50, 0xbf,
+  0xac, 0x65, 0xd7, 0x19, 0x01, 0x6a, 0x31, 0x23, 0x32, 0x36, 0x67, 0xfe, 0xef, 0xec, 0x07, 0x2b,
+  0x91, 0x6a, 0x21, 0x71, 0x0f, 0xed, 0xed, 0xad, 0xda, 0xed, 0x20, 0xbd, 0xca, 0xdd, 0xbd, 0xdd,
+  0x21, 0x11, 0xeb, 0xdf, 0x59, 0x67, 0x31, 0xfe, 0xcf, 0xba, 0x35, 0x5d, 0x48, 0xfe, 0x67, 0x41,
+  0xda, 0xf1, 0x1f, 0x37, 0xee, 0xdc, 0xba, 0x17, 0x3f, 0x4d, 0x1c, 0xeb, 0x4a, 0x54, 0x25, 0x0d,
+  0xd2, 0x12, 0xec, 0xd4, 0x06, 0x40, 0x04, 0xab, 0x7c, 0xea, 0xdf, 0xc0, 0xbc, 0xfc, 0xcf, 0xbc,
+  0xfb, 0x9f, 0x6a, 0x11, 0x3a, 0x24, 0x18, 0x48, 0xe4, 0x7e, 0x6a, 0x11, 0x0d, 0x47, 0x6e, 0x56,
+  0xe4, 0x08, 0x7e, 0x56, 0xf5, 0x46, 0x14, 0x67, 0xf5, 0x8e, 0x7a, 0x20, 0xf9, 0xce, 0xbc, 0xfb,
+  0xce, 0x6d, 0x61, 0xb4, 0x66, 0x00, 0x45, 0x64, 0x55, 0xac, 0xa4, 0x65, 0x44, 0x54, 0x00, 0x45,
+  0x76, 0x76, 0x56, 0x66, 0x77, 0x67, 0x67, 0x20, 0x77, 0x68, 0x66, 0x77, 0x68, 0xd5, 0x02, 0x44,
+  0x63, 0x0e, 0x56, 0x06, 0x1e, 0xd5, 0x02, 0x55, 0x11, 0x78, 0x57, 0x95, 0x78, 0xe3, 0x39, 0x0b,
+  0xb1, 0x05, 0x24, 0x63, 0x35, 0x37, 0x04, 0x79, 0x11, 0x74, 0x1f, 0x29, 0xa4, 0x1c, 0x35, 0x93,
+  0xcf, 0x02, 0x6a, 0x75, 0x15, 0x53, 0x23, 0xf8, 0x22, 0x45, 0x57, 0x9c, 0x05, 0x42, 0x3b, 0x02,
+  0x10, 0x3a, 0x24, 0xd2, 0x42, 0xa8, 0xd6, 0x9b, 0x93, 0x67, 0x21, 0x34, 0x3a, 0x04, 0x4c, 0x8a,
+  0x05, 0x4f, 0xb4, 0xa2, 0xcf, 0xf2, 0x1a, 0xb0, 0x8e, 0x21, 0xd9, 0x88, 0x64, 0x41, 0x33, 0xf0,
+  0x23, 0x54, 0x6e, 0xff, 0xfb, 0x53, 0x67, 0x21, 0x64, 0x11, 0x69, 0x18, 0x00, 0xdf, 0xee, 0xdc,
+  0xed, 0xbe, 0xda, 0xdd, 0xad, 0x30, 0xdb, 0xdc, 0xbc, 0xed, 0x9d, 0x09, 0xcf, 0x52, 0xea, 0xee,
+  0xd7, 0xf2, 0x36, 0xf9, 0x22, 0xc9, 0x1c, 0xcf, 0x4c, 0x14, 0xfe, 0x0b, 0x03, 0xcc, 0x02, 0xf0,
+  0xfd, 0xdd, 0xdc, 0xaf, 0x6d, 0x37, 0x6a, 0x91, 0xd2, 0x22, 0x13, 0x57, 0xc8, 0xde, 0xaa, 0xb8,
+  0x6a, 0x01, 0xdf, 0xbd, 0xbc, 0x09, 0x2d, 0x0b, 0x88, 0xfb, 0x9f, 0x87, 0x37, 0x44, 0x7f, 0x48,
+  0xf4, 0xc3, 0x22, 0x00, 0xf6, 0x6f, 0x57, 0xf6, 0x5d, 0x36, 0xe4, 0x6e, 0x60, 0x56, 0xe5, 0x5d,
+  0x46, 0xf5, 0x6d, 0x01, 0xd5, 0x02, 0x7f, 0x20, 0x69, 0xe8, 0xcf, 0xac, 0xeb, 0xd8, 0x22, 0xeb,
+  0xab, 0x00, 0x8b, 0xeb, 0xac, 0xac, 0xec, 0xdf, 0xc8, 0x98, 0x00, 0x24, 0x43, 0x45, 0x45, 0x56,
+  0x56, 0x76, 0x76, 0x30, 0x78, 0x67, 0x87, 0x67, 0x02, 0x00, 0x6a, 0x11, 0x73, 0x46, 0x20, 0x24,
+  0x52, 0x46, 0x35, 0x63, 0x8d, 0x05, 0x68, 0x56, 0xcc, 0x85, 0x79, 0xc0, 0x02, 0xde, 0x02, 0x24,
+  0x64, 0x1f, 0x07, 0x87, 0x08, 0x0b, 0x11, 0x00, 0xe1, 0x02, 0x58, 0xed, 0x02, 0x23, 0x53, 0x44,
+  0x34, 0x80, 0x73, 0x6a, 0x46, 0xb3, 0x6a, 0x34, 0x73, 0x10, 0x14, 0x60, 0x32, 0x53, 0x34, 0x9c,
+  0xdc, 0x5e, 0x11, 0x3d, 0x64, 0xac, 0xe6, 0xe8, 0xcf, 0x32, 0x6a, 0x11, 0x77, 0x9a, 0xcf, 0x42,
+  0x0f, 0x3e, 0x8a, 0x55, 0x8f, 0xb4, 0x62, 0x96, 0x45, 0x4b, 0xfb, 0x02, 0x50, 0xee, 0xdc, 0xc7,
+  0x0d, 0x07, 0x28, 0x13, 0x32, 0x35, 0xce, 0x19, 0xee, 0x67, 0x01, 0xae, 0xda, 0x1c, 0xfe, 0xae,
+  0x2b, 0x11, 0x6a, 0x31, 0x01, 0x23, 0xed, 0xed, 0xbd, 0x00, 0xdb, 0xec, 0xad, 0xdb, 0xdd, 0xbc,
+  0xee, 0xce, 0xea, 0xfb, 0x02, 0x0b, 0xef, 0xef, 0x16, 0xbf, 0x4e, 0x18, 0x27, 0x5b, 0x02, 0x30,
+  0x83, 0x07, 0x17, 0x4c, 0x14, 0xff, 0xff, 0xcc, 0xbd, 0xcb, 0x5f, 0x40, 0x3e, 0xde, 0x4a, 0x23,
+  0xcc, 0x02, 0xa8, 0x45, 0x13, 0x27, 0x02, 0x00, 0xcb, 0xb9, 0xb8, 0xcd, 0xae, 0xed, 0x0d, 0x07,
+  0x89, 0x0c, 0xbc, 0x09, 0xcf, 0xd5, 0x32, 0x06, 0x98, 0x0a, 0x17, 0x02, 0x40, 0x66, 0xf5, 0x7f,
+  0x56, 0xf5, 0x10, 0x5e, 0x56, 0xf6, 0x7f, 0x02, 0x10, 0xe5, 0x6e, 0x46, 0x02, 0xe5, 0x08, 0x20,
+  0xf5, 0x7e, 0x68, 0xf7, 0xbe, 0x9c, 0x20, 0xfb, 0xce, 0xba, 0xc8, 0xce, 0x5d, 0x4b, 0xeb, 0x34,
+  0x10, 0x43, 0x44, 0x34, 0x46, 0xcc, 0x02, 0x78, 0x67, 0x76, 0x02, 0x78, 0x6d, 0x01, 0x76, 0x76,
+  0x67, 0x76, 0x74, 0x56, 0x20, 0x34, 0x62, 0x45, 0x34, 0x63, 0xb9, 0x09, 0x57, 0x46, 0x80, 0x85,
+  0x78, 0x57, 0x94, 0x68, 0x46, 0x83, 0x1b, 0x0e, 0x17, 0x3a, 0x24, 0xb0, 0x1c, 0xb1, 0x05, 0x68,
+  0x0b, 0x00, 0x26, 0x42, 0x63, 0x54, 0x23, 0x53, 0xcf, 0x12, 0x36, 0x49, 0x08, 0x42, 0x67, 0x01,
+  0x25, 0xe8, 0x68, 0x9b, 0xdf, 0xd4, 0x19, 0xfb, 0xda, 0x29, 0xd2, 0x02, 0x3a, 0x14, 0x08, 0xad,
+  0x8b, 0xd7, 0x78, 0x28, 0xd6, 0x67, 0xa3, 0x44, 0x7f, 0x0e, 0x06, 0x67, 0x01, 0x40, 0xc1, 0x65,
+  0x7f, 0x77, 0x8f, 0x9c, 0xa5, 0x7c, 0x41, 0xdf, 0x60, 0xed, 0xdc, 0xc9, 0x78, 0x43, 0xce, 0x09,
+  0x03, 0x1e, 0xec, 0x1c, 0xee, 0xbf, 0x07, 0x17, 0x3a, 0x31, 0x2b, 0x00, 0xef, 0xed, 0xee, 0x41,
+  0x2d, 0x11, 0xdd, 0xec, 0xdd, 0xbd, 0xdc, 0x9c, 0x15, 0xeb, 0xf0, 0xef, 0xbe, 0xea, 0xde, 0x58,
+  0x41, 0xbf, 0x19, 0x06, 0x4e, 0xfe, 0x19, 0xe1, 0xd4, 0x59, 0xff, 0xfc, 0xba, 0xed, 0xb1, 0x3b,
+  0x88, 0x47, 0x02, 0x10, 0x0d, 0x6a, 0x21, 0xfd, 0xc1, 0x3d, 0xd2, 0x02, 0xba, 0x8d, 0xed, 0xef,
+  0x70, 0xdd, 0xfd, 0xdf, 0xcd, 0x02, 0x00, 0x65, 0x4f, 0xd5, 0x12, 0xbc, 0x38, 0xfb, 0xaf, 0x97,
+  0x6a, 0x21, 0x64, 0x01, 0x43, 0x04, 0x65, 0xd4, 0x0d, 0x08, 0x10, 0x66, 0x6a, 0x11, 0x40, 0x04,
+  0x6e, 0x57, 0xf5, 0x6e, 0x01, 0xe4, 0x02, 0x56, 0xf5, 0x6e, 0x67, 0xf6, 0x8d, 0x6b, 0x06, 0xea,
+  0xc5, 0x2c, 0x36, 0x1e, 0x7a, 0x93, 0x44, 0x24, 0x44, 0x40, 0x55, 0x68, 0x86, 0x77, 0x67, 0x86,
+  0x6a, 0x11, 0x66, 0x00, 0x77, 0x78, 0x66, 0x76, 0x67, 0x34, 0x52, 0x56, 0x78, 0x35, 0x64, 0x57,
+  0x5e, 0x01, 0x3a, 0x04, 0x67, 0x01, 0x4b, 0x1b, 0x72, 0x37, 0xb1, 0x05, 0x6d, 0x01, 0x79, 0x01,
+  0x68, 0x19, 0x07, 0xad, 0x0c, 0x36, 0x33, 0x90, 0x93, 0x33, 0x43, 0x57, 0x0a, 0x17, 0xb3, 0x59,
+  0xa8, 0x02, 0xe0, 0x32, 0x54, 0x35, 0x44, 0x6b, 0x42, 0x0b, 0x6a, 0x41, 0xd5, 0x12, 0x14, 0xfa,
+  0xde, 0xda, 0x39, 0x8a, 0x6a, 0x01, 0xd7, 0x9b, 0x65, 0xe1, 0x01, 0x0a, 0x43, 0x34, 0x43, 0x4f,
+  0xb1, 0x92, 0xcf, 0x82, 0xa2, 0xd5, 0x07, 0x90, 0xc8, 0x1a, 0x01, 0xff, 0x22, 0xdd, 0xcb, 0xba,
+  0x9c, 0xba, 0x7f, 0x6a, 0x11, 0x9f, 0x52, 0x69, 0x18, 0x21, 0x21, 0x1b, 0x31, 0xeb, 0x13, 0x34,
+  0x14, 0xee, 0x38, 0xbd, 0xe7, 0xcf, 0xc3, 0x82, 0x02, 0xb0, 0x99, 0x25, 0xba, 0x9e, 0x1b, 0x59,
+  0x63, 0x77, 0x40, 0xef, 0x70, 0x31, 0xd5, 0x22, 0xef, 0xdf, 0xec, 0xd8, 0xdd, 0xbb, 0xba, 0xbf,
+  0x0c, 0x8f, 0x0f, 0xdf, 0x6a, 0x51, 0x8f, 0x1c, 0x4b, 0x9f, 0x22, 0x6a, 0x21, 0xf7, 0x34, 0x34,
+  0x6e, 0x55, 0x64, 0x21, 0x66, 0x40, 0xf5, 0x6f, 0x67, 0xf6, 0x6f, 0x66, 0xd2, 0x02, 0xf5, 0x15,
+  0x64, 0x11, 0x57, 0x05, 0x00, 0xe4, 0xe7, 0x12, 0x7a, 0xf9, 0xbf, 0x02, 0xbb, 0x08, 0x13, 0xce,
+  0xc4, 0x65, 0x34, 0x42, 0x54, 0x00, 0x56, 0x76, 0x87, 0x78, 0x86, 0x87, 0x67, 0x87, 0x41, 0x6d,
+  0x01, 0x77, 0x76, 0x86, 0x77, 0x55, 0x34, 0x04, 0x63, 0x80, 0x57, 0x36, 0x74, 0x67, 0x35, 0x74,
+  0x67, 0xbd, 0x02, 0xd0, 0x35, 0x74, 0x57, 0x46, 0x09, 0x0e, 0x53, 0xe1, 0x12, 0x79, 0x01, 0x01,
+  0x67, 0x11, 0x73, 0x46, 0x28, 0x33, 0xa3, 0x25, 0x32, 0x02, 0x35, 0xcf, 0x22, 0x6a, 0x25, 0x83,
+  0x35, 0x33, 0x49, 0x70, 0xab, 0xee, 0xe9, 0xbc, 0x37, 0x04, 0x02, 0x10, 0xd5, 0x52, 0x9c, 0x10,
+  0xe7, 0xbd, 0x8a, 0xc7, 0x6a, 0x11, 0x69, 0xb8, 0xbd, 0xe4, 0x69, 0xb3, 0x0f, 0x1e, 0x65, 0x6f,
+  0xb7, 0x82, 0x6a, 0x41, 0xf2, 0xa6, 0xc7, 0x02, 0xc0, 0x8e, 0x51, 0x23, 0xa0, 0xcb, 0xab, 0xa9,
+  0x3d, 0x08, 0x99, 0x15, 0xc3, 0xf4, 0x63, 0x64, 0x11, 0xff, 0xce, 0xec, 0xfe, 0x02, 0x10, 0x67,
+  0x01, 0xf0, 0xeb, 0xef, 0x9d, 0xe5, 0x67, 0x11, 0xf8, 0x39, 0x00, 0x30, 0x9b, 0x6c, 0xb1, 0x11,
+  0x10, 0xfb, 0x98, 0xee, 0x06, 0x23, 0x59, 0xb3, 0xed, 0x82, 0x1b, 0x63, 0xe2, 0x01, 0x6a, 0x01,
+  0xdb, 0xa8, 0xdd, 0x2f, 0x63, 0x67, 0x01, 0xdd, 0x9e, 0xfc, 0x02, 0x10, 0x3d, 0x34, 0x9f, 0x22,
+  0x6a, 0x11, 0xa8, 0xf7, 0xf8, 0x06, 0xa0, 0x4d, 0x47, 0xf6, 0x6f, 0x67, 0x64, 0x21, 0x56, 0x02,
+  0x10, 0x87, 0xd2, 0x12, 0x0e, 0x00, 0x43, 0x04, 0x55, 0xe4, 0x6f, 0x66, 0x14, 0x20, 0x00, 0x68,
+  0xf8, 0xaf, 0xac, 0xfb, 0xcf, 0xc9, 0xca, 0x00, 0x36, 0x53, 0x55, 0x36, 0x55, 0x77, 0x68, 0x76,
+  0x22, 0x78, 0x02, 0x00, 0x67, 0x76, 0x77, 0x02, 0x00, 0x66, 0x84, 0x00, 0x65, 0x46, 0x73, 0x67,
+  0x35, 0x64, 0x68, 0x36, 0x9f, 0x3a, 0x04, 0x6d, 0x11, 0xd2, 0x02, 0x1c, 0x17, 0xe1, 0x22, 0x58,
+  0x46, 0x51, 0x0b, 0x00, 0x73, 0x45, 0x39, 0x33, 0xa4, 0x39, 0x33, 0x34, 0x04, 0x25, 0x74, 0x67,
+  0x01, 0x6b, 0x46, 0xa8, 0x9a, 0xee, 0xc1, 0x9b, 0x03, 0xe9, 0xbb, 0xbd, 0xfa, 0xcd, 0x04, 0x37,
+  0xa5, 0x35, 0x04, 0xbe, 0xf9, 0x34, 0x34, 0x9b, 0x8b, 0xd7, 0xad, 0xab, 0xe4, 0xbd, 0xdd, 0xc6,
+  0x05, 0x77, 0x7f, 0xb7, 0xc2, 0xf2, 0xd6, 0x1d, 0xf0, 0xc3, 0x97, 0xb1, 0xe0, 0x23, 0xef, 0xed,
+  0xdc, 0xbb, 0x28, 0x01, 0x6a, 0x11, 0x07, 0x28, 0x00, 0xfa, 0x13, 0x53, 0x15, 0xfe, 0xcf, 0xec,
+  0xee, 0xcf, 0x82, 0xfb, 0xcc, 0x12, 0xbe, 0xea, 0xee, 0x5c, 0xf5, 0xcf, 0x22, 0xc7, 0x64, 0x51,
+  0x31, 0x14, 0x98, 0x6c, 0xfe, 0xee, 0xba, 0xcb, 0x09, 0x29, 0x23, 0x0d, 0x3b, 0x43, 0xee, 0x50,
+  0x63, 0x02, 0x20, 0xdd, 0xcb, 0xcc, 0xbe, 0xfd, 0x9e, 0x6f, 0xfd, 0xc6, 0x0f, 0x6a, 0x21, 0x6d,
+  0x21, 0x3d, 0x24, 0xd5, 0x12, 0xab, 0x25, 0x78, 0xbf, 0xb7, 0xe7, 0x4c, 0x01, 0xcf, 0x02, 0x05,
+  0x30, 0x08, 0x10, 0x65, 0x06, 0xe4, 0x64, 0x01, 0xd2, 0x02, 0x5d, 0x46, 0xf6, 0x6f, 0x55, 0x08,
+  0xf5, 0x6f, 0x65, 0xde, 0x12, 0x6f, 0x66, 0xf7, 0x8f, 0x20, 0x8b, 0xfc, 0x69, 0x73, 0x66, 0x6a,
+  0x01, 0x47, 0x66, 0x9c, 0x88, 0x68, 0xdb, 0x09, 0xd5, 0x02, 0x43, 0x04, 0x76, 0x67, 0xcc, 0x02,
+  0x00, 0x36, 0x73, 0x66, 0x46, 0x73, 0x57, 0x35, 0x64, 0xc9, 0x70, 0x01, 0x78, 0x35, 0x08, 0x00,
+  0x73, 0x56, 0xd8, 0x02, 0x08, 0x00, 0x01, 0x46, 0x24, 0x35, 0x28, 0x33, 0x93, 0x3a, 0x32, 0x63,
+  0x90, 0x33, 0x53, 0x69, 0x37, 0xd2, 0x02, 0xab, 0xcc, 0xc2, 0x20, 0x40, 0xee, 0x9c, 0xcb, 0xdf,
+  0xad, 0xdb, 0xcf, 0x02, 0xee, 0xad, 0xcf, 0x12, 0xeb, 0xdb, 0x12, 0x9f, 0x05, 0x7a, 0xb0, 0x1c,
+  0xab, 0xf1, 0x00, 0xe0, 0xbb, 0xb3, 0x34, 0x98, 0x8f, 0x31, 0x91, 0x40, 0x41, 0xe0, 0x50, 0x3f,
+  0x13, 0x77, 0xcc, 0x62, 0x5e, 0x84, 0x6d, 0x24, 0x29, 0x60, 0xae, 0x05, 0xcc, 0xa9, 0x0c, 0xcc,
+  0xcf, 0x6a, 0x01, 0x02, 0x10, 0xee, 0xfd, 0xff, 0xdf, 0x02, 0xfc, 0xcc, 0x32, 0xfe, 0xbe, 0xeb,
+  0xee, 0xae, 0xe6, 0x70, 0xcf, 0x5c, 0xf5, 0xce, 0x62, 0x51, 0x64, 0xa1, 0xcb, 0x19, 0xdd, 0x0e,
+  0xba, 0x59, 0x30, 0x6d, 0xe7, 0xcc, 0x42, 0xba, 0x8d, 0xdd, 0xff, 0xbf, 0xa0, 0x31, 0x38, 0x10,
+  0x61, 0x11, 0xa5, 0x45, 0xd5, 0x52, 0x02, 0x10, 0xdc, 0x6d, 0x11, 0xc0, 0xce, 0xb8, 0xca, 0xbf,
+  0xb9, 0xf9, 0x37, 0x44, 0x02, 0x20, 0x29, 0x0b, 0x00, 0x5d, 0x36, 0x5e, 0x01, 0xd3, 0x0e, 0x30,
+  0x5f, 0x56, 0x18, 0xf6, 0x5f, 0x55, 0xae, 0x15, 0x88, 0x11, 0x74, 0xa5, 0x36, 0x80, 0x53, 0x65,
+  0x36, 0x64, 0x76, 0x68, 0x76, 0x6a, 0x01, 0x42, 0x77, 0xab, 0x25, 0x77, 0x46, 0x64, 0x77, 0xd2,
+  0x02, 0x46, 0xf0, 0x73, 0x66, 0x35, 0x72, 0x5e, 0x01, 0x08, 0x00, 0xd8, 0x02, 0x81, 0x08, 0x06,
+  0x67, 0x6d, 0x11, 0x0b, 0x00, 0x83, 0x34, 0x26, 0x43, 0xa3, 0x20, 0x3a, 0x43, 0x93, 0x24, 0x32,
+  0x15, 0x1e, 0x36, 0x9d, 0x83, 0xde, 0x1e, 0x11, 0x02, 0x9a, 0xbb, 0xef, 0x9c, 0xdb, 0xcf, 0x12,
+  0x85, 0x0a, 0x47, 0xeb, 0x75, 0x28, 0xc8, 0xbd, 0x8a, 0xbe, 0x15, 0x0f, 0xc0, 0xfe, 0xef, 0xf6,
+  0x67, 0xa9, 0x9f, 0x2d, 0xfb, 0xc2, 0xb9, 0x0f, 0x2d, 0x6e, 0xb0, 0xdc, 0xae, 0xb5, 0x6a, 0x21,
+  0xec, 0xcc, 0xa9, 0xbb, 0xa2, 0xaf, 0x67, 0x11, 0xdf, 0xfd, 0xef, 0x02, 0x00, 0xcf, 0x71, 0x10,
+  0x01, 0xcc, 0x02, 0xef, 0x7d, 0xe5, 0xcf, 0x5c, 0xe5, 0xcf, 0x0f, 0x65, 0x61, 0x5a, 0x0b, 0xeb,
+  0x02, 0x37, 0x37, 0xff, 0xfd, 0xcb, 0xdc, 0xc6, 0xbf, 0x3d, 0xfa, 0x14, 0x66, 0xee, 0xdc, 0xbc,
+  0x85, 0x01, 0xbc, 0x01, 0xb3, 0x3a, 0x07, 0xd4, 0x2f, 0xed, 0xfd, 0x02, 0x10, 0x67, 0x01, 0xde,
+  0x94, 0x1b, 0x02, 0xde, 0x6d, 0x11, 0xfd, 0xce, 0xc9, 0xba, 0x79, 0x86, 0x00, 0x87, 0x69, 0x79,
+  0xba, 0x8b, 0x9c, 0xfd, 0xbf, 0x80, 0xcb, 0xfc, 0xbe, 0xca, 0xfa, 0x7f, 0x76, 0xd2, 0x42, 0x91,
+  0x3a, 0x24, 0xf5, 0x5e, 0x46, 0xd2, 0x12, 0x5e, 0x46, 0x67, 0x01, 0x0d, 0x02, 0x20, 0x55, 0x6d,
+  0x01, 0x7c, 0x01, 0xf6, 0x4c, 0x41, 0x92, 0x0c, 0x28, 0x43, 0x6a, 0x61, 0xb1, 0x0c, 0x87, 0x68,
+  0x73, 0x66, 0x00, 0x47, 0x83, 0x66, 0x36, 0x63, 0x67, 0x35, 0x62, 0x82, 0x55, 0x43, 0x14, 0x63,
+  0x67, 0x46, 0x74, 0x78, 0x46, 0x14, 0x01, 0x67, 0x21, 0x36, 0x76, 0x33, 0x34, 0x43, 0x93, 0x3a,
+  0x00, 0x33, 0xa3, 0x28, 0x33, 0x44, 0x35, 0x83, 0x6a, 0x04, 0x25, 0x8e, 0x03, 0x21, 0xde, 0xfe,
+  0xde, 0xd9, 0xcd, 0x38, 0xbd, 0xea, 0xce, 0x56, 0x19, 0xbf, 0x13, 0x70, 0x21, 0xf8, 0xcd, 0x00,
+  0x8a, 0xd8, 0xaa, 0xee, 0xee, 0xfd, 0xee, 0xde, 0x72, 0xfd, 0x1e, 0x02, 0xbb, 0xaf, 0xf1, 0xfd,
+  0x40, 0xf4, 0x08, 0x50, 0xde, 0x1c, 0xba, 0xca, 0xe0, 0x03, 0x90, 0xf8, 0x73, 0x71, 0xed, 0xed,
+  0xcd, 0x10, 0xba, 0xb9, 0x8f, 0xee, 0x6a, 0x21, 0xff, 0xce, 0xfc, 0x00, 0xff, 0xce, 0xfb, 0xff,
+  0xbe, 0xe7, 0xdf, 0x5d, 0x30, 0xe4, 0xdf, 0x5c, 0xe5, 0xcf, 0x42, 0x9b, 0x1c, 0xdf, 0xeb, 0xe3,
+  0x6b, 0x3f, 0x3d, 0x01, 0x9a, 0xad, 0xdc, 0x34, 0x04, 0xc9, 0x52, 0x3b, 0x43, 0xc1, 0xd8, 0x62,
+  0xee, 0xdb, 0xa9, 0xed, 0xdf, 0x64, 0x01, 0xb6, 0x11, 0x1b, 0x0d, 0x2a, 0x5e, 0x01, 0xfe, 0x64,
+  0x01, 0x6a, 0x01, 0xee, 0xce, 0xda, 0x44, 0xee, 0x9e, 0xb9, 0x0c, 0xdc, 0x67, 0x74, 0x7a, 0x0c,
+  0x66, 0x02, 0x46, 0x02, 0x00, 0x63, 0x65, 0x47, 0x6b, 0xfd, 0xbe, 0x82, 0xcc, 0x6a, 0x11, 0xbf,
+  0xcb, 0xeb, 0x8f, 0x86, 0x6a, 0x11, 0x09, 0x02, 0x10, 0x55, 0xd4, 0x34, 0x14, 0x46, 0xe4, 0x6e,
+  0x46, 0x1e, 0xe4, 0x3a, 0x44, 0x05, 0x00, 0x6a, 0x01, 0xd5, 0x02, 0x64, 0xe5, 0x1a, 0x80, 0x21,
+  0xa2, 0x2a, 0x32, 0x84, 0x47, 0x65, 0x64, 0x01, 0x01, 0x6a, 0x01, 0x78, 0x68, 0x74, 0x66, 0x48,
+  0x84, 0x77, 0x00, 0x36, 0x63, 0x66, 0x36, 0x62, 0x55, 0x36, 0x63, 0x42, 0x56, 0x46, 0x04, 0x47,
+  0x84, 0x68, 0x36, 0x1f, 0x07, 0x62, 0x00, 0x45, 0x57, 0x7a, 0xba, 0xcd, 0xc8, 0x43, 0x54, 0x08,
+  0x42, 0x73, 0x3a, 0xd2, 0x02, 0x42, 0x63, 0x24, 0x43, 0x10, 0x68, 0x46, 0x8e, 0xfe, 0x97, 0x07,
+  0xef, 0xde, 0xeb, 0x40, 0xee, 0xd8, 0xab, 0xbe, 0xe9, 0xcd, 0x56, 0x19, 0xfb, 0x01, 0x0a, 0x07,
+  0xee, 0x9b, 0xdb, 0xee, 0xbd, 0xf9, 0xcd, 0x22, 0x9b, 0x3f, 0x02, 0xcf, 0xda, 0xed, 0xee, 0x0a,
+  0xdf, 0xff, 0x1c, 0xdc, 0xbf, 0xdd, 0x96, 0xef, 0xf6, 0xf5, 0xa0, 0xfe, 0xee, 0x87, 0x78, 0xd8,
+  0x7b, 0xa9, 0x4b, 0x15, 0x61, 0x21, 0x17, 0x10, 0x6a, 0x81, 0xfd, 0x05, 0xd2, 0x12, 0xdd, 0x08,
+  0x10, 0xdd, 0xba, 0xba, 0x9e, 0xef, 0x06, 0xef, 0x67, 0x21, 0x77, 0x00, 0x7e, 0xf5, 0xdf, 0x5d,
+  0xf5, 0xd8, 0xce, 0x5c, 0xd5, 0x67, 0x21, 0x9b, 0x0c, 0xff, 0x37, 0x01, 0xb5, 0x01, 0x80, 0xda,
+  0xfe, 0xbf, 0xed, 0xee, 0xe9, 0xbb, 0xa4, 0x12, 0x0c, 0xee, 0xdc, 0x64, 0x71, 0xe5, 0x91, 0xde,
+  0xdc, 0xcb, 0xae, 0x67, 0x2f, 0x00, 0x83, 0x04, 0x02, 0x10, 0xfe, 0xbe, 0x64, 0x31, 0x02, 0x20,
+  0xde, 0x10, 0xfd, 0xee, 0xaf, 0xd9, 0xcd, 0x08, 0x67, 0x73, 0x56, 0x07, 0x64, 0x01, 0x02, 0x30,
+  0x6a, 0x11, 0x66, 0x87, 0xbf, 0xdb, 0xfd, 0xa0, 0xbf, 0xdc, 0xec, 0xbf, 0xdc, 0x6a, 0x01, 0xfc,
+  0x84, 0x18, 0xb5, 0x67, 0x01, 0x64, 0x34, 0x04, 0xf4, 0x64, 0x11, 0xbf, 0x0c, 0x45, 0x61, 0x21,
+  0x07, 0x64, 0x21, 0xd2, 0x02, 0xea, 0x12, 0x54, 0xd4, 0x1a, 0x31, 0xa2, 0x80, 0x1a, 0x31, 0x93,
+  0x28, 0x44, 0x86, 0x58, 0xcf, 0x02, 0x00, 0x74, 0x76, 0x48, 0x83, 0x77, 0x36, 0x62, 0x66, 0x80,
+  0x35, 0x63, 0x66, 0x25, 0x63, 0x65, 0x36, 0xcc, 0x02, 0x40, 0x63, 0x56, 0x69, 0x8a, 0xcb, 0xce,
+  0x38, 0x13, 0xec, 0x40, 0xdd, 0xc8, 0x44, 0x84, 0x32, 0x44, 0x0a, 0x07, 0x3a, 0x80, 0x33, 0x93,
+  0x24, 0x43, 0x44, 0x46, 0x6e, 0xee, 0x10, 0x00, 0xee, 0xbe, 0xda, 0xfe, 0xcc, 0xdc, 0x9c, 0xca,
+  0x10, 0xde, 0xac, 0xeb, 0xef, 0x26, 0x0c, 0x9c, 0xc9, 0xcd, 0x81, 0x6a, 0x01, 0x8a, 0xbc, 0xdd,
+  0xfe, 0xde, 0xeb, 0x56, 0x0c, 0x7d, 0x9a, 0x1d, 0xce, 0x67, 0x11, 0x2e, 0x51, 0x2e, 0xf4, 0xba,
+  0x62, 0x76, 0x51, 0xee, 0xe8, 0x98, 0xa7, 0x6f, 0x0a, 0x00, 0xcc, 0xb6, 0x66, 0xcf, 0xa2, 0x6a,
+  0xb1, 0x64, 0xb9, 0x8e, 0x86, 0x12, 0xbf, 0xf6, 0x64, 0x01, 0x02, 0x00, 0xde, 0x00, 0x5d, 0xe5,
+  0xcd, 0x89, 0xa5, 0x67, 0x45, 0x64, 0x24, 0x46, 0x34, 0x02, 0x00, 0x65, 0x57, 0x8e, 0x18, 0xed,
+  0xdc, 0x64, 0xbc, 0xdf, 0xe2, 0x22, 0xfc, 0xba, 0x4d, 0x93, 0xa9, 0x64, 0xa9, 0xfc, 0x8d, 0xdc,
+  0x00, 0x23, 0xeb, 0x25, 0x9e, 0x0f, 0x07, 0x1d, 0xe6, 0x0c, 0x02, 0x10, 0x00, 0xdf, 0xde, 0xec,
+  0xfd, 0xae, 0xeb, 0xfe, 0xd5, 0x09, 0x50, 0x00, 0x56, 0x46, 0x02, 0x90, 0x63, 0x65, 0xad, 0xcc,
+  0x46, 0xed, 0x6a, 0x11, 0x05, 0x00, 0xcc, 0xfc, 0xbe, 0xd8, 0x02, 0xb8, 0xe6, 0xf8, 0xce, 0x09,
+  0xd4, 0x09, 0x6e, 0x46, 0x6a, 0x41, 0x31, 0x14, 0xd5, 0x22, 0x14, 0x5f, 0x66, 0x49, 0x04, 0xf4,
+  0x6a, 0x01, 0x6f, 0x55, 0xe5, 0x40, 0x4d, 0x41, 0xb3, 0x2b, 0x31, 0xa3, 0xd8, 0x02, 0x27, 0x30,
+  0x54, 0x87, 0x48, 0x73, 0x67, 0x01, 0xcc, 0x02, 0x66, 0x25, 0x40, 0x43, 0x55, 0x7a, 0x8a, 0xcb,
+  0xbe, 0x9a, 0x24, 0xcf, 0x04, 0xdc, 0xfd, 0xa6, 0x04, 0xbc, 0xa9, 0x43, 0xa4, 0x44, 0x00, 0x44,
+  0x26, 0x33, 0xa3, 0x3a, 0x33, 0xa4, 0x29, 0x10, 0x32, 0x63, 0x46, 0x5e, 0xee, 0x00, 0xec, 0xee,
+  0xae, 0x00, 0xda, 0xee, 0xcc, 0xdc, 0x34, 0x5b, 0xde, 0x8c, 0x00, 0xca, 0xcd, 0x8b, 0xca, 0xcd,
+  0xad, 0xeb, 0xef, 0x10, 0x9b, 0xc3, 0x45, 0xde, 0x31, 0x04, 0xbf, 0xda, 0xed, 0x88, 0xaf, 0xe9,
+  0xed, 0x1d, 0x00, 0xcf, 0xfe, 0xcb, 0x37, 0x24, 0xc7, 0x21, 0xdb, 0x03, 0xfe, 0x55, 0x31, 0xde,
+  0xcb, 0xdc, 0xe9, 0x06, 0x51, 0x18, 0xbe, 0xcb, 0x6a, 0xa1, 0x61, 0x21, 0x64, 0x51, 0x02, 0x00,
+  0x09, 0x0b, 0xdd, 0xd5, 0x12, 0x40, 0xad, 0xff, 0xce, 0xf6, 0xef, 0x6d, 0x67, 0x31, 0xf4, 0x00,
+  0xce, 0x44, 0x64, 0x46, 0x44, 0x74, 0x57, 0x45, 0x00, 0x64, 0x47, 0x45, 0x74, 0x56, 0x44, 0x6f,
+  0xee, 0x58, 0x9a, 0xac, 0xde, 0x74, 0x05, 0xdf, 0x36, 0xcb, 0x3a, 0x24, 0x87, 0x00, 0x83, 0x45,
+  0x44, 0x64, 0x56, 0x44, 0x67, 0x8a, 0x40, 0x8a, 0xa8, 0x9a, 0x9a, 0xac, 0xca, 0xff, 0x59, 0xfd,
+  0xec, 0xff, 0xcf, 0x67, 0x24, 0x67, 0x01, 0xde, 0xa7, 0x03, 0x02, 0x10, 0xe3, 0x1c, 0x10, 0xde,
+  0xed, 0xaa, 0xa4, 0xcc, 0x02, 0x56, 0x34, 0x63, 0x18, 0x45, 0x35, 0x64, 0x5f, 0x0c, 0xd2, 0x32,
+  0x56, 0x58, 0x8b, 0x28, 0xfd, 0xbe, 0xdc, 0x02, 0x10, 0xbf, 0x02, 0x10, 0xfc, 0xce, 0xc0, 0xca,
+  0xeb, 0xad, 0xaa, 0xfa, 0x7f, 0x67, 0x11, 0x02, 0x30, 0x07, 0x9f, 0x25, 0x64, 0x01, 0xcf, 0x32,
+  0x46, 0xe4, 0x5f, 0x46, 0xe4, 0x09, 0xbd, 0x15, 0x65, 0xe6, 0xd8, 0x02, 0x1b, 0x31, 0xb4, 0x2c,
+  0x00, 0x42, 0xb5, 0x2a, 0x52, 0x74, 0x25, 0x43, 0x75, 0xf0, 0x7a, 0x89, 0xc9, 0xbd, 0xc3, 0x08,
+  0x9f, 0x3b, 0x02, 0x20, 0xb6, 0x1f, 0x00, 0x98, 0x54, 0x95, 0x47, 0x43, 0x35, 0x42, 0x83, 0x42,
+  0x2a, 0x3a, 0x04, 0x33, 0xa4, 0x59, 0x5d, 0xe8, 0x10, 0xed, 0x00, 0xae, 0xd9, 0xee, 0xc8, 0x99,
+  0x33, 0x37, 0xab, 0x01, 0x8b, 0x0d, 0xae, 0xeb, 0xef, 0xad, 0xd4, 0x66, 0x33, 0xd0, 0x44, 0x55,
+  0xef, 0xee, 0xcc, 0x02, 0xd9, 0x64, 0x01, 0xd2, 0x02, 0xe0, 0xee, 0xbf, 0xff, 0xcb, 0xaf, 0x1e,
+  0xeb, 0xe3, 0x96, 0x2d, 0x8b, 0x09, 0x76, 0x31, 0xba, 0x9e, 0x13, 0x20, 0xef, 0xfe, 0xee, 0xdc,
+  0xde, 0xba, 0xbf, 0x26, 0xcc, 0x62, 0xd7, 0x1a, 0x70, 0x21, 0xec, 0x73, 0x21, 0x6a, 0x01, 0x42,
+  0xdc, 0x16, 0x07, 0xbd, 0xdd, 0xff, 0x9e, 0x67, 0x01, 0xe4, 0x10, 0xdf, 0x5d, 0xe5, 0xde, 0xbf,
+  0x09, 0x44, 0x64, 0x57, 0xe3, 0x02, 0x00, 0x6a, 0x01, 0x44, 0x67, 0x9a, 0x2d, 0x01, 0xc6, 0x05,
+  0x45, 0x04, 0x01, 0x00, 0x00, 0xdc, 0xcf, 0xee, 0xfe, 0xd5, 0x57, 0x43, 0x10, 0x54, 0x24, 0x23,
+  0x54, 0xa9, 0x0a, 0x56, 0xac, 0xda, 0x80, 0xcd, 0xab, 0xd8, 0x9b, 0xab, 0xc9, 0x9a, 0xd4, 0x0f,
+  0x08, 0xff, 0xff, 0xec, 0xcc, 0x25, 0xea, 0xfd, 0xae, 0xfc, 0x03, 0x9f, 0x18, 0x3a, 0x04, 0xde,
+  0xff, 0x9a, 0xa6, 0x67, 0x56, 0x21, 0xbe, 0x0d, 0x58, 0x99, 0xcd, 0xdd, 0xd0, 0x17, 0xde, 0xd8,
+  0x86, 0x99, 0xd8, 0x32, 0x6a, 0x11, 0x6b, 0xed, 0xbe, 0xdb, 0x6a, 0x41, 0x40, 0xcf, 0xcb, 0xfd,
+  0xbe, 0xc8, 0xca, 0x60, 0x0b, 0xce, 0xe0, 0xab, 0xe7, 0x9e, 0x66, 0xe4, 0xa2, 0x15, 0x37, 0x34,
+  0x6a, 0x61, 0x9d, 0xb4, 0x35, 0x45, 0xb7, 0x35, 0x04, 0x0a, 0x6d, 0x01, 0xe5, 0x5e, 0x08, 0x00,
+  0x00, 0x67, 0xf7, 0x9e, 0x9b, 0xfa, 0xce, 0x9c, 0xe9, 0x28, 0xce, 0xbb, 0xfc, 0xd7, 0x0c, 0xbf,
+  0x70, 0x31, 0xbd, 0xeb, 0x00, 0x9a, 0x88, 0x44, 0x95, 0x49, 0x54, 0x54, 0x42, 0x62, 0x54, 0x0a,
+  0x07, 0x3a, 0x43, 0xb3, 0x67, 0x01, 0xc0, 0x0b, 0xde, 0x00, 0xbe, 0xda, 0xef, 0xd5, 0x66, 0x33,
+  0x33, 0x55, 0x00, 0xad, 0xe9, 0xcc, 0x68, 0x93, 0x56, 0x33, 0x43, 0xc0, 0x23, 0x23, 0x38, 0x99,
+  0xef, 0xed, 0xe7, 0x22, 0x6a, 0x11, 0x79, 0x37, 0x14, 0xca, 0x9f, 0x24, 0xab, 0x0d, 0xc7, 0x33,
+  0xbb, 0x02, 0x20, 0xdb, 0x12, 0xa9, 0x2c, 0x1e, 0xdd, 0xed, 0x0b, 0x03, 0xed, 0xca, 0x98, 0x37,
+  0x64, 0x31, 0x2e, 0x74, 0x02, 0x40, 0xdc, 0x6d, 0x21, 0x6a, 0x11, 0xeb, 0xba, 0x00, 0x98, 0xcf,
+  0xfb, 0xef, 0x5e, 0xf5, 0xde, 0x4d, 0x1c, 0xf5, 0xde, 0x32, 0x01, 0x34, 0x04, 0xcc, 0x12, 0x74,
+  0x56, 0x45, 0x1c, 0x7c, 0xee, 0x90, 0x08, 0x0e, 0x0b, 0x67, 0x31, 0xff, 0xfb, 0xa9, 0x00, 0x88,
+  0x94, 0x25, 0x42, 0x44, 0x35, 0x42, 0x44, 0x62, 0x47, 0x85, 0x01, 0xac, 0xdb, 0xcd, 0x6a, 0x01,
+  0xee, 0x02, 0x67, 0x28, 0x86, 0x67, 0xde, 0x94, 0x0b, 0xcf, 0x67, 0x01, 0xda, 0xee, 0x22, 0xbe,
+  0xcc, 0x42, 0xef, 0xed, 0xdd, 0x1a, 0x03, 0x45, 0x75, 0x8c, 0x67, 0xde, 0x24, 0x1c, 0x42, 0x20,
+  0xfe, 0xfe, 0x89, 0xdb, 0x22, 0x01, 0x3a, 0x14, 0x6b, 0xee, 0xbe, 0xec, 0xed, 0xbf, 0xeb, 0x00,
+  0xed, 0xcf, 0xdb, 0xfd, 0xce, 0xdc, 0xfd, 0x8c, 0x04, 0xad, 0xfd, 0x67, 0x01, 0xbf, 0xbc, 0xe9,
+  0xce, 0x8c, 0x60, 0xd8, 0xae, 0x78, 0xe5, 0x6f, 0xcf, 0x52, 0x3a, 0x34, 0x5e, 0x14, 0x56, 0xf4,
+  0x3a, 0x04, 0x5e, 0x1f, 0x17, 0xf6, 0x5f, 0x65, 0x18, 0xf6, 0x5f, 0x66, 0x02, 0x10, 0x3d, 0x27,
+  0xe5, 0x6e, 0x56, 0xc0, 0xe5, 0x7e, 0x57, 0xe7, 0x9f, 0x9b, 0x3b, 0x00, 0x6a, 0x21, 0x11, 0x45,
+  0x2e, 0x8b, 0x95, 0x53, 0x67, 0x01, 0x95, 0x43, 0x53, 0xd0, 0x25, 0x43, 0xa3, 0x2b, 0xcf, 0x02,
+  0x6d, 0x4f, 0x04, 0x2b, 0x0d, 0x80, 0xeb, 0xde, 0xc3, 0x44, 0x33, 0x42, 0x33, 0x5f, 0x0f, 0x00,
+  0x23, 0x33, 0x33, 0x33, 0x32, 0x34, 0x33, 0x3b, 0xc6, 0xcc, 0xb7, 0x25, 0x64, 0x11, 0xed, 0xae,
+  0xeb, 0xb3, 0x00, 0xd4, 0x56, 0x0f, 0x9f, 0xf5, 0x51, 0x78, 0x13, 0x67, 0x08, 0x20, 0xdc, 0xcc,
+  0xcf, 0xfe, 0x10, 0xcf, 0xed, 0xfd, 0xde, 0xe6, 0x0d, 0xdf, 0xfd, 0xcb, 0x7c, 0xbd, 0xbb, 0x37,
+  0x64, 0x34, 0x64, 0x64, 0x21, 0xd1, 0x04, 0x02, 0x30, 0xdc, 0x50, 0xa8, 0x8c, 0xff, 0xae, 0x37,
+  0x04, 0xe4, 0x67, 0x11, 0x55, 0xe8, 0x74, 0x57, 0x55, 0x37, 0x34, 0x7c, 0xca, 0x06, 0x67, 0x01,
+  0xd2, 0x02, 0x01, 0x6a, 0x21, 0xfc, 0xcc, 0x42, 0x44, 0x34, 0x42, 0x53, 0x80, 0x24, 0x43, 0x54,
+  0x46, 0x45, 0x73, 0x46, 0x67, 0x11, 0x00, 0xdb, 0xcd, 0x9b, 0xcf, 0xff, 0xdd, 0xe4, 0x56, 0x78,
+  0x44, 0x68, 0x9a, 0x24, 0x00, 0xf2, 0x06, 0x99, 0x45, 0x9a, 0x0b, 0xf5, 0x04, 0x68, 0x45, 0x47,
+  0x00, 0x7f, 0xfe, 0xfe, 0xfd, 0x77, 0x08, 0x9b, 0xda, 0xce, 0x5b, 0x17, 0xfe, 0xfe, 0x67, 0x83,
+  0x9b, 0x3d, 0x14, 0x6a, 0x01, 0x35, 0x67, 0x01, 0x4c, 0x0a, 0xdc, 0xfe, 0x02, 0x00, 0x10, 0xcf,
+  0xda, 0xdc, 0xce, 0x98, 0x5f, 0xce, 0xac, 0xe9, 0xc0, 0xce, 0x9c, 0xea, 0xaf, 0xa9, 0xf9, 0x46,
+  0x01, 0xcf, 0x52, 0xfd, 0x08, 0x10, 0x5e, 0xe9, 0x39, 0x79, 0x11, 0x1f, 0x27, 0x6d, 0x01, 0x70,
+  0x11, 0x14, 0x00, 0x02, 0xe6, 0x76, 0x11, 0x75, 0xf6, 0x6f, 0x77, 0xf8, 0x9f, 0x84, 0xab, 0xfb,
+  0xd5, 0x32, 0x9b, 0x92, 0x54, 0x85, 0x67, 0x01, 0x00, 0x48, 0x54, 0x25, 0x42, 0x63, 0x3a, 0x42,
+  0xa3, 0x02, 0x6a, 0x67, 0x01, 0xcc, 0xfd, 0xcf, 0xcd, 0xfd, 0x9b, 0x12, 0xa2, 0x5e, 0x01, 0x33,
+  0x34, 0x6a, 0x11, 0x33, 0x23, 0x43, 0x08, 0x33, 0x34, 0x4d, 0x06, 0x21, 0xcd, 0xec, 0xde, 0xbd,
+  0x00, 0xeb, 0xde, 0xbd, 0xfd, 0xcf, 0xde, 0xfe, 0xbb, 0x1f, 0x66, 0x15, 0x43, 0x51, 0x70, 0xd1,
+  0xa2, 0x85, 0x33, 0x7b, 0xfd, 0xec, 0xcd, 0x48, 0xed, 0xef, 0xec, 0x0a, 0x10, 0xde, 0xcd, 0xcb,
+  0x06, 0xed, 0x7c, 0xb9, 0x8f, 0xc9, 0x12, 0x34, 0xc4, 0xcf, 0x32, 0x02, 0x10, 0x6a, 0x01, 0xca,
+  0xe0, 0x87, 0xcf, 0xf6, 0xef, 0x4d, 0x37, 0x04, 0x67, 0x11, 0xcc, 0x02, 0xe1, 0x3a, 0x14, 0x44,
+  0x6c, 0xef, 0xce, 0xd8, 0x1d, 0x20, 0x1e, 0x1b, 0x14, 0xa0, 0xf8, 0x89, 0x42, 0x54, 0x34, 0x02,
+  0x10, 0x53, 0xa2, 0x05, 0x12, 0x46, 0xcc, 0x02, 0xbc, 0xda, 0x6a, 0x01, 0xcc, 0xff, 0xf6, 0x62,
+  0x68, 0xb7, 0x02, 0x44, 0x6c, 0xcb, 0xa1, 0x1c, 0x69, 0x48, 0xfe, 0x18, 0xee, 0xe3, 0x46, 0x4f,
+  0x01, 0x52, 0x04, 0xee, 0xe9, 0xd8, 0x32, 0xdd, 0x3f, 0x20, 0xde, 0xe5, 0x10, 0x17, 0xa8, 0x05,
+  0x45, 0x64, 0x88, 0x57, 0x46, 0x6a, 0x67, 0x21, 0xeb, 0xee, 0xcf, 0x05, 0x00, 0x8c, 0xc9, 0xcb,
+  0xbf, 0x0c, 0x2a, 0x1e, 0xcb, 0xfc, 0xcf, 0x90, 0x02, 0xc4, 0xbb, 0xfb, 0x02, 0x00, 0xbf, 0xba,
+  0xfa, 0xf2, 0x19, 0x58, 0x01, 0x3f, 0x6a, 0x01, 0x05, 0x30, 0x61, 0x51, 0x1c, 0x27, 0x6a, 0x61,
+  0x05, 0x30, 0xf7, 0x5f, 0x0a, 0x76, 0x6d, 0x01, 0xf7, 0x6d, 0x01, 0x8f, 0xab, 0xfb, 0xad, 0x00,
+  0xb2, 0x54, 0x35, 0x38, 0x54, 0x96, 0x48, 0x54, 0x00, 0x85, 0x43, 0x54, 0x26, 0x32, 0xa3, 0x6a,
+  0x7c, 0x03, 0x70, 0x07, 0xcf, 0x02, 0xfd, 0x57, 0x73, 0x44, 0x24, 0x33, 0x20, 0x34, 0x24, 0x33,
+  0x33, 0x24, 0x67, 0x01, 0x33, 0x44, 0x78, 0x79, 0x9d, 0xfe, 0x7f, 0x11, 0x3a, 0x0d, 0x02, 0x10,
+  0x67, 0x11, 0xcc, 0x3e, 0xce, 0x1f, 0x01, 0x06, 0x5e, 0x01, 0xb7, 0xd3, 0xba, 0x25, 0x87, 0xdc,
+  0xba, 0x29, 0xaf, 0x03, 0xcf, 0xdd, 0x5c, 0x0f, 0xff, 0x56, 0x05, 0xef, 0xfb, 0xe8, 0xba, 0xdb,
+  0xbf, 0x31, 0x64, 0xed, 0xc3, 0x22, 0x05, 0x30, 0xa4, 0x27, 0x01, 0x66, 0x10, 0xcc, 0xbc, 0xcc,
+  0xef, 0x4e, 0xe4, 0xef, 0x00, 0xff, 0xf9, 0xab, 0x44, 0x53, 0x46, 0x33, 0x54, 0x00, 0x56, 0x45,
+  0x74, 0x46, 0x56, 0x8c, 0xef, 0xce, 0x1c, 0xfc, 0xef, 0x1a, 0x0b, 0xd0, 0x06, 0x2a, 0x11, 0xf3,
+  0x24, 0x42, 0xc2, 0x53, 0x67, 0x01, 0x24, 0x43, 0x52, 0x24, 0xcf, 0x02, 0x64, 0x21, 0x05, 0x3a,
+  0x04, 0xbd, 0xd2, 0x35, 0x88, 0x92, 0x35, 0x66, 0x7e, 0x83, 0xb4, 0x12, 0x67, 0x31, 0xcd, 0xd4,
+  0x46, 0x45, 0x7e, 0xb5, 0x11, 0x6c, 0xbe, 0xbe, 0x14, 0x00, 0xf7, 0x09, 0xdd, 0x5e, 0x01, 0x02,
+  0x20, 0x56, 0xc0, 0x34, 0x64, 0x56, 0x56, 0x7a, 0xdf, 0xe6, 0x0f, 0xd2, 0x32, 0x6c, 0x8b, 0xad,
+  0x7f, 0x00, 0xc5, 0x36, 0xfb, 0x3d, 0x14, 0x02, 0x00, 0xcb, 0xc1, 0x6a, 0x21, 0xbb, 0xfb, 0xaf,
+  0xa8, 0xf8, 0x6a, 0x41, 0xba, 0x02, 0xef, 0x02, 0x10, 0x64, 0x21, 0x61, 0x11, 0x6a, 0x91, 0xf7,
+  0x05, 0x10, 0xd2, 0x02, 0x67, 0x01, 0x01, 0x02, 0x30, 0x71, 0x94, 0x29, 0x45, 0x73, 0x86, 0x49,
+  0x00, 0x54, 0x86, 0x48, 0x54, 0x35, 0x42, 0x54, 0x58, 0x03, 0x67, 0x01, 0xc1, 0x01, 0xcc, 0xfd,
+  0x35, 0x42, 0x43, 0x34, 0x20, 0x32, 0x44, 0x34, 0x32, 0x34, 0x05, 0x20, 0x44, 0xbd, 0x97, 0x64,
+  0x21, 0xfd, 0x00, 0x6d, 0x31, 0xcf, 0xb6, 0x00, 0xee, 0xcb, 0x3c, 0xab, 0xe3, 0x71, 0xaf, 0x6a,
+  0x41, 0xe9, 0x8c, 0x87, 0xb1, 0x22, 0xf5, 0x36, 0x05, 0x10, 0x00, 0xba, 0x9e, 0xee, 0xdf, 0xec,
+  0xfe, 0xcf, 0xfc, 0xe3, 0x02, 0x00, 0xc5, 0x15, 0xde, 0xda, 0x98, 0x5b, 0x11, 0x2e, 0x24, 0x30,
+  0x23, 0x03, 0x5e, 0x31, 0x05, 0x70, 0x75, 0x4c, 0xef, 0x9e, 0xf4, 0xde, 0x13, 0x34, 0x04, 0xc9,
+  0x12, 0x63, 0x35, 0x05, 0x00, 0xbd, 0xeb, 0xdf, 0x8b, 0x67, 0x01, 0xcf, 0x02, 0xdf, 0x54, 0x17,
+  0xff, 0xee, 0xe4, 0xcc, 0x22, 0x2b, 0x02, 0x00, 0x67, 0x01, 0x74, 0x37, 0x24, 0xea, 0xd2, 0x12,
+  0xab, 0xcf, 0x00, 0xff, 0xaa, 0xb4, 0x47, 0x34, 0x54, 0x47, 0x23, 0x30, 0x43, 0x35, 0x77, 0x8e,
+  0xba, 0x12, 0x00, 0x03, 0x9a, 0xa4, 0x4c, 0x46, 0xdd, 0x10, 0x3a, 0x00, 0x20, 0xee, 0xe5, 0x3a,
+  0x17, 0x44, 0x02, 0x73, 0x08, 0x03, 0x57, 0x34, 0x53, 0x46, 0x8b, 0xca, 0x08, 0xde, 0xad, 0xeb,
+  0x82, 0x09, 0xee, 0xbe, 0xe9, 0xcc, 0x9a, 0xde, 0x36, 0x0e, 0xcc, 0x8f, 0x1f, 0x33, 0x58, 0xfb,
+  0xcf, 0x67, 0x01, 0xff, 0x6a, 0x51, 0xd8, 0x32, 0xd2, 0x22, 0x8c, 0x2f, 0x2e, 0x34, 0x61, 0x31,
+  0xdb, 0x12, 0x08, 0x30, 0x38, 0xf7, 0x6f, 0x65, 0x6d, 0x01, 0x02, 0x20, 0x67, 0x11, 0xa3, 0x1a,
+  0x00, 0x41, 0xa4, 0x3a, 0x35, 0xa4, 0x59, 0x36, 0x84, 0x20, 0x77, 0x48, 0x54, 0x79, 0x6c, 0xb7,
+  0x25, 0xda, 0xdb, 0xa6, 0x24, 0x5e, 0x21, 0x02, 0x40, 0x45, 0x87, 0x5b, 0x01, 0xbf, 0x2e, 0x0d,
+  0x3d, 0x71, 0x00, 0xcb, 0x58, 0x44, 0xa1, 0x09, 0x9c, 0xf5, 0xa5, 0xa5, 0xde, 0xbb, 0x20, 0xe8,
+  0x8b, 0x76, 0xa9, 0x8f, 0x30, 0xbb, 0xdb, 0x98, 0x25, 0x3a, 0x04, 0xbf, 0x6a, 0x81, 0xcd, 0xcb,
+  0x13, 0x07, 0xdd, 0xfe, 0x07, 0xc6, 0x22, 0x05, 0x30, 0xcf, 0x82, 0xdc, 0xa7, 0x6a, 0x98, 0xcf,
+  0x0c, 0xf4, 0xef, 0x40, 0x01, 0x04, 0x27, 0x57, 0x23, 0x58, 0x9b, 0x1a, 0xbd, 0x99, 0x0e, 0xfc,
+  0x3a, 0x14, 0x67, 0x31, 0xdd, 0xe4, 0x25, 0xb4, 0x43, 0x44, 0x07, 0x27, 0x43, 0x67, 0x21, 0x37,
+  0x14, 0xbd, 0x75, 0x18, 0x80, 0xde, 0xfe, 0xfe, 0xf3, 0x46, 0x45, 0x63, 0x05, 0x13, 0x01, 0x4f,
+  0x04, 0x55, 0x75, 0x57, 0x45, 0x65, 0x56, 0x44, 0x26, 0x6e, 0x64, 0x71, 0x00, 0x00, 0x66, 0x84,
+  0x58, 0x17, 0x55, 0x7e, 0x08, 0xee, 0xbc, 0xc4, 0x9f, 0x15, 0xad, 0xfa, 0xdf, 0xbd, 0x02, 0xfa,
+  0x2f, 0x1c, 0xad, 0xea, 0xbb, 0xef, 0xed, 0xfc, 0x3c, 0xde, 0xcd, 0x67, 0x11, 0x6a, 0x71, 0x43,
+  0x04, 0xd1, 0x16, 0xeb, 0xbf, 0xfe, 0xac, 0x6a, 0x21, 0xd8, 0x42, 0x39, 0x4e, 0x6d, 0x11, 0xa5,
+  0x95, 0xcc, 0x22, 0x73, 0x31, 0x02, 0x6f, 0x08, 0x00, 0x76, 0xf7, 0x5f, 0x81, 0xb4, 0x2b, 0x00,
+  0x31, 0xb4, 0x1a, 0x43, 0xa3, 0x4b, 0x44, 0xb4, 0x00, 0x4a, 0x44, 0xb4, 0x4b, 0x57, 0xf9, 0x8f,
+  0xa9, 0xa0, 0xfa, 0xbf, 0xc5, 0x97, 0x34, 0xb7, 0x00, 0x43, 0x02, 0x40, 0x20, 0x25, 0x59, 0xcb,
+  0xcf, 0xdb, 0xa9, 0x14, 0xbf, 0xcb, 0x83, 0x6a, 0x11, 0x9c, 0x1e, 0xdb, 0xfc, 0xef, 0xfc, 0xb9,
+  0x2a, 0xfb, 0x81, 0x45, 0xab, 0xde, 0x99, 0xa7, 0x6d, 0xed, 0xee, 0x8e, 0x71, 0x45, 0xc8, 0x29,
+  0xee, 0xd2, 0x02, 0xff, 0xcf, 0xdb, 0x6a, 0x01, 0xff, 0x00, 0xbf, 0xe9, 0xff, 0x7f, 0xe7, 0xff,
+  0xcf, 0xec, 0xf0, 0xee, 0xaa, 0x9e, 0xcc, 0x01, 0x87, 0xcc, 0x52, 0xce, 0x01, 0xe0, 0x29, 0x68,
+  0xce, 0xf5, 0xee, 0xda, 0x03, 0x44, 0x04, 0x07, 0x02, 0x00, 0x65, 0x40, 0x79, 0xad, 0xfb, 0xdf,
+  0xbd, 0xfc, 0xd2, 0x32, 0xff, 0xa0, 0xee, 0xf8, 0xab, 0xcc, 0xc4, 0x34, 0x14, 0x33, 0x37, 0x04,
+  0x06, 0x53, 0xcf, 0x52, 0xa2, 0x25, 0xbc, 0xd9, 0xbc, 0xff, 0xfb, 0x80, 0xbb, 0x45, 0x73, 0x35,
+  0x44, 0x63, 0x36, 0x13, 0x04, 0xe5, 0x81, 0x05, 0x44, 0x73, 0x01, 0x56, 0x78, 0x65, 0x71, 0x8b,
+  0x04, 0x34, 0x24, 0x20, 0xab, 0xbf, 0xff, 0xff, 0xfa, 0x0b, 0x10, 0x56, 0x8a, 0x00, 0xde, 0xad,
+  0xfa, 0xde, 0xad, 0xfb, 0xde, 0x8b, 0x04, 0xbe, 0xfe, 0xa9, 0x0d, 0xee, 0x9e, 0xda, 0xde, 0xbd,
+  0x06, 0xec, 0x27, 0x15, 0x6a, 0x61, 0xcd, 0xea, 0xce, 0x9d, 0xe9, 0x8e, 0xdd, 0xb3, 0x09, 0x6a,
+  0x51, 0xd8, 0x02, 0x9f, 0x97, 0xf8, 0x63, 0x28, 0x1e, 0xe4, 0x66, 0x08, 0x37, 0x34, 0xcf, 0x42,
+  0x81, 0x18, 0xe5, 0x6e, 0x65, 0x13, 0x02, 0x00, 0xa5, 0x25, 0x72, 0xb4, 0xcf, 0x02, 0x2b, 0x41,
+  0xb4, 0x00, 0x3a, 0x34, 0xa4, 0x4b, 0x44, 0xa4, 0x3b, 0x56, 0x00, 0xf8, 0x5f, 0x75, 0xf8, 0x6f,
+  0x91, 0xa4, 0x19, 0x00, 0x42, 0x94, 0x28, 0x42, 0x74, 0x25, 0x42, 0x53, 0x81, 0x4c, 0x04, 0x37,
+  0x5c, 0xfc, 0xce, 0xac, 0xea, 0xfb, 0x2f, 0xe3, 0x64, 0x41, 0x73, 0x01, 0xef, 0xda, 0xa9, 0xcc,
+  0xf2, 0x08, 0x20, 0x45, 0x5b, 0xc8, 0xed, 0x87, 0xde, 0x4a, 0x09, 0xeb, 0xba, 0xc1, 0x0d, 0x57,
+  0x7b, 0x00, 0xdf, 0xed, 0xed, 0xcb, 0xa9, 0xef, 0xfb, 0xfe, 0x00, 0x7f, 0xd6, 0xfe, 0x5f, 0xe6,
+  0xff, 0x6f, 0xe5, 0x00, 0xfe, 0x6e, 0xe9, 0xfe, 0xdf, 0xec, 0xdd, 0xa9, 0x0e, 0x7f, 0x61, 0x51,
+  0x37, 0x64, 0x08, 0x30, 0xce, 0xcb, 0xcf, 0xf5, 0x80, 0xee, 0x44, 0x74, 0x46, 0xde, 0xec, 0xcc,
+  0xd7, 0x39, 0x20, 0x79, 0xbb, 0xdf, 0xbd, 0xfb, 0xa2, 0x15, 0xde, 0xf9, 0xc0, 0xbc, 0xbc, 0xcf,
+  0xed, 0xee, 0xd4, 0xcf, 0x12, 0x02, 0x30, 0x3b, 0x34, 0x01, 0x67, 0x11, 0xeb, 0x6a, 0x11, 0xa2,
+  0x05, 0xef, 0x06, 0x55, 0x72, 0x10, 0x24, 0x34, 0x55, 0x67, 0xcf, 0x02, 0x33, 0x54, 0x46, 0x92,
+  0x23, 0x90, 0x28, 0x66, 0x7f, 0x66, 0x41, 0xdd, 0xd4, 0xed, 0x05, 0x30, 0x56, 0x44, 0x75, 0x57,
+  0x0e, 0x30, 0xdd, 0x19, 0x68, 0xac, 0x01, 0xd2, 0x02, 0xad, 0xea, 0xde, 0xac, 0xcf, 0xed, 0xed,
+  0xc2, 0xaf, 0x59, 0x09, 0xd9, 0xed, 0x9e, 0xea, 0xd2, 0x32, 0x6a, 0x31, 0x80, 0xde, 0xad, 0xd9,
+  0xdd, 0x9d, 0xd9, 0xde, 0x02, 0x00, 0x30, 0x9c, 0xea, 0xbf, 0xbc, 0x6a, 0x41, 0x17, 0x00, 0xbf,
+  0xaa, 0x70, 0xe7, 0x7e, 0x56, 0xe5, 0x39, 0x0e, 0xd2, 0x12, 0x6a, 0x41, 0xf7, 0x07, 0x64, 0x11,
+  0x9e, 0x3f, 0x52, 0x14, 0xf7, 0x5f, 0x72, 0xb4, 0x1b, 0x80, 0x41, 0xb3, 0x1a, 0x41, 0xb4, 0x2a,
+  0x43, 0xcf, 0x22, 0x00, 0x46, 0xf8, 0x6e, 0x76, 0xf8, 0x3c, 0x61, 0xa4, 0x01, 0x7c, 0x01, 0x19,
+  0x41, 0xa4, 0x1a, 0x51, 0x94, 0x19, 0x00, 0x52, 0x95, 0x5d, 0x98, 0xfa, 0xae, 0x9a, 0xd9, 0x06,
+  0xbe, 0xa2, 0x08, 0x6a, 0x61, 0xcb, 0xeb, 0xee, 0xdc, 0xcb, 0x0c, 0xed, 0xcf, 0x54, 0x98, 0xcf,
+  0xd2, 0xfe, 0xe9, 0x75, 0xef, 0x64, 0xfb, 0xfd, 0xef, 0x06, 0xb9, 0x8f, 0xcc, 0x52, 0x92, 0x3c,
+  0xef, 0x00, 0xdc, 0xaa, 0x9c, 0xfe, 0x8f, 0xe5, 0xfe, 0x5f, 0x08, 0xe5, 0xfd, 0x5f, 0x05, 0x00,
+  0xd5, 0xfe, 0x7e, 0xdc, 0xc0, 0xfe, 0xce, 0xfa, 0xba, 0xec, 0xbf, 0x6a, 0x21, 0xd2, 0x22, 0x01,
+  0x09, 0x56, 0xcc, 0xfd, 0xcc, 0x99, 0xdf, 0xf4, 0xee, 0x44, 0x45, 0x6e, 0xee, 0x0a, 0xff, 0xaa,
+  0xb5, 0xd2, 0x02, 0x57, 0x08, 0x44, 0x69, 0xce, 0x3a, 0x04, 0xbd, 0xf9, 0xbd, 0xaa, 0x82, 0xbe,
+  0x4d, 0x03, 0xec, 0xfe, 0xd3, 0x24, 0x32, 0x9f, 0x15, 0x90, 0x25, 0x33, 0x44, 0x25, 0x4f, 0x01,
+  0x9a, 0xca, 0x6f, 0x28, 0x03, 0x6a, 0x01, 0xdd, 0x69, 0x66, 0x78, 0x44, 0x75, 0x67, 0x35, 0x20,
+  0x65, 0x57, 0x45, 0x63, 0x35, 0x84, 0x1b, 0x64, 0x46, 0x24, 0xbc, 0xcf, 0x58, 0x11, 0x56, 0x84,
+  0x8b, 0x04, 0x47, 0x45, 0x0c, 0x6a, 0xbb, 0x3b, 0x4e, 0x9f, 0x08, 0x74, 0x57, 0xac, 0xea, 0x00,
+  0xdf, 0xad, 0xf8, 0x9b, 0xff, 0xee, 0xeb, 0xfe, 0xaa, 0x9e, 0x8e, 0x0d, 0xe9, 0x91, 0x0d, 0xde,
+  0x3c, 0x03, 0xdd, 0x8f, 0x06, 0x01, 0xcc, 0x02, 0xfb, 0xdd, 0x9e, 0xe9, 0xed, 0x9d, 0xe9, 0x74,
+  0xed, 0x8d, 0x6d, 0x01, 0xe9, 0xab, 0x15, 0x5d, 0x1b, 0x18, 0x28, 0xac, 0xc2, 0xd8, 0x63, 0x0b,
+  0xbe, 0x78, 0xe6, 0x6e, 0xd1, 0x09, 0xa5, 0x75, 0x27, 0x64, 0x01, 0x2d, 0x0e, 0xea, 0x02, 0xe6,
+  0x6e, 0xab, 0x05, 0x73, 0xc5, 0x20, 0x2b, 0x31, 0xa4, 0x1b, 0x41, 0xd5, 0x02, 0xb4, 0x2a, 0x00,
+  0x34, 0xb4, 0x3a, 0x45, 0xe7, 0x5f, 0x86, 0xf8, 0x11, 0x64, 0x01, 0x1a, 0x41, 0xa5, 0x02, 0x30,
+  0x1b, 0x52, 0xb6, 0x00, 0x6f, 0x96, 0xf8, 0x6e, 0x86, 0xe7, 0x6e, 0x85, 0x00, 0xf9, 0x6f, 0x96,
+  0xfa, 0x6f, 0xa6, 0xfa, 0x7f, 0x00, 0xa8, 0xfb, 0x9e, 0xba, 0xe9, 0xce, 0xbe, 0xfd, 0x1c, 0xdc,
+  0xcf, 0x69, 0xc8, 0x87, 0x0c, 0x12, 0x6e, 0xfd, 0xfe, 0xde, 0x20, 0xcc, 0xde, 0xdc, 0xfe, 0xaf,
+  0x73, 0x0c, 0xec, 0xb9, 0x03, 0x3a, 0x54, 0xc8, 0x39, 0xed, 0xfd, 0xca, 0x99, 0xdf, 0xf8, 0x61,
+  0x61, 0x01, 0xed, 0x6e, 0xc5, 0xfd, 0xd2, 0x02, 0x08, 0x00, 0x8f, 0x60, 0xdd, 0xff, 0xbd, 0xda,
+  0x87, 0x37, 0x44, 0x05, 0x80, 0xfc, 0x10, 0xc9, 0x76, 0xdf, 0xf4, 0x61, 0x3f, 0xff, 0xff, 0xf7,
+  0x06, 0x89, 0xcf, 0x02, 0xaa, 0x1c, 0x77, 0x9a, 0x46, 0x8e, 0xed, 0xe3, 0xb5, 0x08, 0x83, 0x0c,
+  0xff, 0xe7, 0x78, 0x0c, 0x0e, 0x02, 0x00, 0x0a, 0x07, 0x62, 0x33, 0xce, 0x06, 0x66, 0x78, 0xab,
+  0x37, 0x34, 0x6d, 0x01, 0xde, 0x0e, 0xee, 0x10, 0x04, 0x4c, 0x04, 0x92, 0x1f, 0x64, 0x46, 0x78,
+  0x94, 0x00, 0x46, 0x33, 0x5c, 0xcd, 0x77, 0x94, 0x57, 0x44, 0x89, 0x5b, 0x01, 0xfb, 0xcc, 0x34,
+  0x14, 0x65, 0x47, 0x55, 0xde, 0x52, 0x2f, 0x9f, 0x08, 0x3a, 0x0a, 0xe1, 0x02, 0x02, 0x00, 0xdd,
+  0xcf, 0x12, 0xda, 0xfd, 0x39, 0x6a, 0x11, 0xd9, 0xee, 0x78, 0x08, 0xc0, 0x04, 0xd2, 0x02, 0xdd,
+  0xeb, 0x24, 0xed, 0x9e, 0xe1, 0x02, 0xd9, 0xde, 0x02, 0x00, 0x9d, 0xd9, 0x26, 0xce, 0xae, 0x45,
+  0x17, 0x00, 0xfb, 0xce, 0x0e, 0x00, 0x9c, 0xd8, 0x00, 0xcd, 0x9c, 0xe8, 0xcd, 0x8b, 0xe9, 0x9f,
+  0x96, 0x3b, 0xfe, 0x16, 0x3a, 0x04, 0x6e, 0xcf, 0x42, 0x6a, 0x11, 0x49, 0x14, 0x74, 0xe6, 0x03,
+  0x61, 0x01, 0x6a, 0x11, 0x42, 0xb4, 0x1a, 0x42, 0xb4, 0x2a, 0xa0, 0x45, 0xe7, 0x6f, 0x83, 0xc6,
+  0x67, 0x11, 0x42, 0x6a, 0x21, 0x00, 0x42, 0xa5, 0x1a, 0x55, 0xe8, 0x5f, 0x96, 0xf9, 0x00, 0x5f,
+  0x86, 0xe8, 0x6f, 0x86, 0xe8, 0x5f, 0x95, 0x10, 0xf9, 0x5f, 0x95, 0xfa, 0x02, 0x00, 0x6f, 0x96,
+  0xe8, 0x20, 0x7e, 0x9d, 0xfe, 0xcb, 0x9f, 0xf1, 0xad, 0xec, 0xbe, 0x08, 0x99, 0xe9, 0x9e, 0xdb,
+  0xa2, 0xab, 0xad, 0xfe, 0x5f, 0xe0, 0xc5, 0xfc, 0xcf, 0xec, 0xdd, 0xf9, 0x12, 0xcf, 0x62, 0x02,
+  0x00, 0x00, 0xde, 0xdc, 0xa9, 0x9d, 0xfe, 0xaf, 0xe5, 0xed, 0x00, 0x5f, 0xc5, 0xed, 0x5e, 0xc5,
+  0xfd, 0x5e, 0xd5, 0x88, 0xed, 0x5e, 0xd6, 0xb1, 0x15, 0xbc, 0xcb, 0x97, 0x4e, 0x29, 0x05, 0x64,
+  0x01, 0xcd, 0xcc, 0x12, 0xcb, 0x88, 0xda, 0x9c, 0xee, 0x3c, 0xbf, 0xf5, 0xcc, 0x12, 0x00, 0x30,
+  0x1c, 0x11, 0x13, 0x17, 0x57, 0x44, 0x20, 0x65, 0x57, 0xa9, 0xaf, 0xfe, 0x67, 0x01, 0xfe, 0xce,
+  0x80, 0xed, 0x32, 0x44, 0x25, 0x32, 0x43, 0x24, 0x0a, 0x07, 0xe4, 0x32, 0x44, 0x96, 0x28, 0x65,
+  0x68, 0x37, 0x14, 0x40, 0x04, 0xa2, 0x05, 0x30, 0xff, 0xff, 0x67, 0x84, 0x72, 0x18, 0xc6, 0x02,
+  0xdd, 0xe6, 0x80, 0x68, 0x34, 0x65, 0x67, 0xff, 0xfa, 0xbb, 0x73, 0x01, 0x24, 0x99, 0xa4, 0x5d,
+  0x4e, 0x89, 0xaf, 0xb0, 0x75, 0xcd, 0xd3, 0x02, 0x45, 0xc4, 0x11, 0x74, 0x57, 0x56, 0x7f, 0xed,
+  0xfd, 0x04, 0x9f, 0xea, 0x6a, 0x01, 0xfe, 0x9f, 0xda, 0xed, 0xbd, 0x3d, 0xe5, 0x1a, 0xdf, 0x02,
+  0x10, 0x67, 0x01, 0xb4, 0x15, 0x6d, 0x11, 0x9d, 0xd9, 0x0c, 0xdf, 0xbc, 0x31, 0x14, 0x1a, 0x10,
+  0xdd, 0xfc, 0xde, 0x9d, 0x0e, 0xd8, 0x02, 0x30, 0x6e, 0x0f, 0x1f, 0x17, 0xaa, 0xfa, 0x8f, 0x96,
+  0x16, 0xf6, 0x2e, 0x04, 0x64, 0x01, 0x6e, 0xd5, 0x12, 0xe6, 0x6e, 0x55, 0x19, 0x72, 0x08, 0xe7,
+  0x1a, 0x07, 0x07, 0xcf, 0x22, 0x1b, 0x41, 0xa4, 0x60, 0x1b, 0x44, 0xd6, 0x5e, 0x71, 0x34, 0x14,
+  0x02, 0x10, 0x51, 0x01, 0x6a, 0x11, 0x3c, 0x65, 0xf9, 0x6f, 0x86, 0xf9, 0x6f, 0x10, 0x85, 0xf7,
+  0x6e, 0x85, 0x67, 0x31, 0xf9, 0x5f, 0xa5, 0x00, 0xf9, 0x5e, 0x96, 0xf9, 0x5e, 0x9c, 0xfd, 0xaa,
+  0x03, 0x4b, 0x28, 0x96, 0x45, 0xde, 0xcb, 0xe8, 0x7e, 0x88, 0xc7, 0x0c, 0x6b, 0x97, 0xaa, 0x6c,
+  0x08, 0x00, 0xdb, 0xac, 0xed, 0xaf, 0x80, 0xe5, 0xfc, 0x6f, 0xdc, 0xfe, 0xaa, 0x9e, 0x2e, 0x04,
+  0x07, 0x92, 0x4c, 0x02, 0x30, 0x7a, 0x0f, 0xdf, 0xeb, 0xfe, 0x6e, 0xd5, 0x36, 0xec, 0xcc, 0x02,
+  0x6a, 0x11, 0xd4, 0xae, 0x05, 0x81, 0x08, 0xee, 0xbd, 0x20, 0xda, 0x98, 0xc9, 0x9e, 0xbb, 0xc9,
+  0x02, 0xec, 0xbc, 0x00, 0x98, 0x87, 0x6b, 0xaa, 0xce, 0xdc, 0xff, 0x5e, 0x76, 0xe4, 0x60, 0x3f,
+  0x89, 0x29, 0xe4, 0xf8, 0x03, 0x4c, 0x11, 0x05, 0x10, 0x6f, 0x08, 0xfe, 0xfd, 0xbf, 0x56, 0x0f,
+  0xfe, 0x77, 0x84, 0x34, 0xc4, 0x32, 0x53, 0x16, 0x09, 0x25, 0x43, 0x42, 0x0a, 0x07, 0x1a, 0x00,
+  0x80, 0x47, 0x9a, 0xba, 0xcd, 0xbc, 0xea, 0xcd, 0xd8, 0x02, 0x09, 0x8c, 0x1c, 0xe5, 0x67, 0xe0,
+  0x1c, 0x62, 0x35, 0x44, 0x65, 0x00, 0x67, 0x33, 0x53, 0x35, 0xcc, 0xda, 0xbb, 0x77, 0x38, 0x93,
+  0x35, 0x34, 0x22, 0x2a, 0xb2, 0x01, 0x7e, 0x98, 0xcc, 0xd8, 0xa3, 0x0d, 0x17, 0x02, 0x00, 0x66,
+  0x7f, 0xfd, 0xc1, 0x01, 0xfd, 0xa2, 0x05, 0xc7, 0xb3, 0x0f, 0xcf, 0x02, 0x37, 0x34, 0xde, 0xeb,
+  0xee, 0xb1, 0x05, 0xe1, 0x02, 0xd7, 0x6d, 0x21, 0x7e, 0x18, 0xec, 0x09, 0xce, 0xd3, 0x00, 0xfc,
+  0x46, 0x04, 0xb7, 0x05, 0x14, 0xdd, 0x8c, 0x22, 0x07, 0xea, 0x1f, 0x57, 0xfb, 0xbe, 0x9b, 0x38,
+  0xe8, 0x8e, 0x76, 0x34, 0x24, 0xa2, 0x05, 0xe1, 0x02, 0x75, 0xf7, 0x19, 0x04, 0x07, 0x1a, 0x32,
+  0x64, 0x11, 0x08, 0x10, 0x43, 0xd6, 0x2b, 0x07, 0x64, 0x31, 0xd2, 0x12, 0x37, 0x04, 0xb5, 0x5e,
+  0x85, 0xf8, 0x6f, 0xc4, 0x95, 0xf8, 0xc0, 0x02, 0x5e, 0x86, 0xf8, 0x67, 0x41, 0xd2, 0x02, 0x61,
+  0x0e, 0x00, 0x8a, 0xfc, 0xce, 0xdd, 0x42, 0x3b, 0x02, 0x20, 0xec, 0x00, 0x87, 0xa7, 0x6b, 0xcb,
+  0xce, 0xdb, 0xdc, 0xed, 0x03, 0x91, 0x05, 0xab, 0x65, 0xda, 0x98, 0xcf, 0xe6, 0xfc, 0x5f, 0x70,
+  0xc8, 0xfd, 0xdf, 0xeb, 0xbc, 0x29, 0x92, 0x6c, 0x02, 0x10, 0xdd, 0x60, 0xba, 0x9c, 0xee, 0xcf,
+  0xe5, 0xcf, 0x32, 0x6d, 0x01, 0xfd, 0x04, 0x4f, 0xe4, 0x6a, 0x11, 0xbf, 0xfc, 0xff, 0xce, 0xec,
+  0x00, 0xed, 0xcd, 0xdc, 0xdd, 0xcd, 0xdc, 0xee, 0xdf, 0x00, 0xfc, 0xff, 0xae, 0xe5, 0xff, 0x5f,
+  0xe5, 0xef, 0x06, 0xcc, 0x01, 0x04, 0x00, 0x30, 0xf4, 0x57, 0x34, 0x65, 0x57, 0x21, 0x3d, 0x34,
+  0x34, 0x6f, 0xee, 0xfe, 0x0d, 0x11, 0xec, 0xff, 0x30, 0xec, 0xcc, 0x44, 0x63, 0x87, 0x1a, 0x7d,
+  0x0f, 0x32, 0x43, 0x71, 0x40, 0x11, 0x44, 0x6a, 0xbd, 0x80, 0x3f, 0x45, 0x0b, 0x00, 0x00, 0x77,
+  0x04, 0x94, 0x56, 0x78, 0x08, 0x34, 0x54, 0x57, 0x44, 0x61, 0x36, 0x24, 0x51, 0x0b, 0xdb, 0x02,
+  0x12, 0x91, 0x11, 0x7e, 0x18, 0x9a, 0xb9, 0x00, 0x9a, 0x89, 0xb9, 0xaa, 0xbc, 0xcd, 0xde, 0xee,
+  0x24, 0xec, 0xdd, 0x97, 0x01, 0x89, 0xb4, 0xc7, 0x11, 0x66, 0x7e, 0xa3, 0x91, 0x14, 0x3a, 0x14,
+  0xae, 0xea, 0xee, 0xcc, 0x32, 0xdd, 0xa5, 0x15, 0xe5, 0x67, 0x01, 0xfe, 0x6a, 0x21, 0xed, 0xad,
+  0x1f, 0x17, 0xcf, 0x02, 0x22, 0x09, 0xcd, 0x01, 0x0a, 0xee, 0x64, 0x01, 0x6a, 0x21, 0xce, 0x9c,
+  0x87, 0x58, 0x02, 0x00, 0x00, 0xac, 0xd9, 0xce, 0x8c, 0xd9, 0xce, 0x8a, 0xe7, 0x08, 0x8e, 0x76,
+  0xe6, 0x37, 0x14, 0x76, 0xf8, 0x2c, 0x51, 0x2e, 0xa3, 0xc9, 0x12, 0x02, 0x50, 0x64, 0x31, 0x2a,
+  0x9c, 0x15, 0xa4, 0x1a, 0x40, 0x53, 0xc6, 0x5f, 0x96, 0xe7, 0x6f, 0x99, 0x05, 0x85, 0x38, 0xf8,
+  0x6e, 0x85, 0x67, 0x31, 0x37, 0x04, 0x6d, 0x11, 0x6e, 0x87, 0x10, 0xea, 0xdf, 0xdd, 0xcb, 0x95,
+  0x7c, 0xeb, 0xca, 0xcf, 0xc0, 0xec, 0xfe, 0x9f, 0xdd, 0xfe, 0xba, 0x8f, 0x0f, 0x98, 0x6c, 0x10,
+  0xde, 0xdc, 0xce, 0xdb, 0x3a, 0x04, 0xeb, 0xbf, 0xec, 0x1c, 0xed, 0xdc, 0xfa, 0x2d, 0x68, 0x5f,
+  0x02, 0x00, 0xec, 0xfd, 0xdc, 0xe0, 0xa9, 0xce, 0xdc, 0xfe, 0x6f, 0xcf, 0x62, 0x67, 0x01, 0x6a,
+  0x21, 0x00, 0x6f, 0xe8, 0xee, 0x8f, 0xd8, 0xee, 0x8f, 0xe7, 0x10, 0xee, 0x6e, 0xd5, 0xed, 0x11,
+  0x00, 0x5e, 0xe5, 0xfe, 0x00, 0x79, 0xb7, 0x8a, 0x78, 0xb7, 0x9a, 0x78, 0xa7, 0xf2, 0x9a, 0xa8,
+  0x02, 0x9a, 0xc4, 0xd2, 0x22, 0xf7, 0x0a, 0xcf, 0x02, 0x67, 0x11, 0x20, 0xeb, 0xde, 0xdf, 0xff,
+  0xde, 0x75, 0x08, 0x53, 0x24, 0x1c, 0x22, 0x44, 0xa8, 0x15, 0x3d, 0x04, 0x13, 0x04, 0x79, 0xb8,
+  0xab, 0xc0, 0xab, 0xca, 0xcd, 0xac, 0xdc, 0xcd, 0x68, 0x11, 0xb6, 0x29, 0x11, 0xa8, 0x15, 0x63,
+  0x45, 0x33, 0xe0, 0x09, 0x74, 0x67, 0x67, 0x00, 0x96, 0x79, 0x78, 0xa7, 0x8b, 0x79, 0xb7, 0x9b,
+  0x20, 0x78, 0xb7, 0x9b, 0x89, 0xb7, 0x08, 0x00, 0x8a, 0x68, 0x22, 0x9a, 0x75, 0x1b, 0xac, 0xd7,
+  0x89, 0x26, 0x00, 0x78, 0x9f, 0xe6, 0xfe, 0xef, 0x01, 0x94, 0x14, 0xae, 0xeb, 0x61, 0x21, 0x6a,
+  0x11, 0x22, 0x04, 0x94, 0xde, 0xce, 0x4c, 0x04, 0xd9, 0x6d, 0x01, 0xee, 0xad, 0x64, 0x21, 0x08,
+  0xcc, 0xfc, 0xef, 0xd5, 0x0e, 0xed, 0xfd, 0xde, 0xae, 0x6b, 0xb4, 0x15, 0x6a, 0x01, 0xce, 0x84,
+  0x08, 0xcb, 0x02, 0x20, 0x67, 0x01, 0xbc, 0x18, 0xea, 0xce, 0x9c, 0x79, 0x01, 0x02, 0x00, 0xe9,
+  0xaf, 0xb9, 0x51, 0x49, 0x04, 0xf7, 0x4d, 0x61, 0xc9, 0x02, 0xa3, 0xc6, 0x02, 0x1b, 0x06, 0x42,
+  0x67, 0x71, 0x0a, 0x37, 0x1b, 0x55, 0xf8, 0x6f, 0x85, 0x84, 0xe7, 0x6e, 0xe9, 0x09, 0x95, 0xf8,
+  0x5f, 0x85, 0xcc, 0x32, 0x19, 0x3a, 0x64, 0xf8, 0xcf, 0xe0, 0x26, 0x25, 0x44, 0xec, 0xdc, 0xaf,
+  0xc0, 0xc5, 0xfb, 0x5f, 0xbc, 0xfe, 0xaa, 0x67, 0x01, 0x81, 0x68, 0x00, 0xdf, 0xed, 0xb9, 0x8c,
+  0xfe, 0x8f, 0xd5, 0xfc, 0x60, 0x5f, 0xcc, 0xfe, 0xbb, 0xaf, 0xcf, 0xb2, 0x95, 0x0c, 0xdf, 0x40,
+  0xdd, 0xdb, 0xac, 0xdc, 0xcf, 0xe7, 0xa5, 0x15, 0x4f, 0xa0, 0xd5, 0xfe, 0x4f, 0xe4, 0xfd, 0x67,
+  0x11, 0xf5, 0xc0, 0x02, 0x10, 0xfe, 0x5e, 0xd6, 0xed, 0xb4, 0x05, 0x5f, 0xd5, 0xee, 0xc9, 0x90,
+  0x18, 0xf5, 0xfe, 0x0d, 0x21, 0x9b, 0x67, 0x0a, 0x01, 0xa5, 0x02, 0x84, 0xd7, 0x8a, 0x27, 0x08,
+  0x55, 0x64, 0x57, 0xdd, 0x89, 0x0c, 0x00, 0xcf, 0xfd, 0xff, 0xef, 0xfe, 0xdf, 0xde, 0xfe, 0x50,
+  0x77, 0x83, 0x34, 0x42, 0xad, 0x2c, 0x32, 0xa5, 0x45, 0x46, 0x00, 0x79, 0xb7, 0x8b, 0x78, 0xa6,
+  0x8b, 0x78, 0xa7, 0x85, 0xa0, 0x01, 0x8a, 0x05, 0x00, 0x68, 0xa7, 0x7a, 0x68, 0x0b, 0x10, 0x70,
+  0x9a, 0x78, 0xb8, 0x9b, 0x1a, 0x00, 0x61, 0x01, 0x02, 0x00, 0x88, 0x45, 0x56, 0x10, 0x8a, 0x08,
+  0x00, 0x89, 0xb6, 0x8a, 0x3d, 0x67, 0x67, 0xf0, 0x94, 0x46, 0xcd, 0xde, 0x93, 0x1f, 0x81, 0x0f,
+  0xaa, 0x1c, 0x64, 0x01, 0x63, 0x51, 0x08, 0x6a, 0x21, 0xdf, 0xcd, 0xfc, 0x96, 0x1f, 0x54, 0x0b,
+  0xcd, 0xcf, 0x99, 0x15, 0xac, 0x1d, 0x67, 0x11, 0x0b, 0x00, 0xeb, 0xde, 0x0e, 0x1a, 0x30, 0x2e,
+  0x35, 0xa7, 0x9f, 0xac, 0x6a, 0x01, 0xea, 0xa7, 0x19, 0xe1, 0x12, 0xfc, 0xbf, 0xe0, 0xc2, 0x64,
+  0x28, 0x42, 0x94, 0x04, 0x07, 0xa5, 0x25, 0x5e, 0x01, 0x86, 0xa3, 0x04, 0x27, 0x02, 0x10, 0x4d,
+  0x75, 0xf9, 0x5f, 0xc6, 0x02, 0x57, 0x3a, 0x04, 0x0a, 0x07, 0x5e, 0x01, 0x94, 0x05, 0x10, 0x4f,
+  0x6d, 0x41, 0xe9, 0x08, 0xdf, 0xdb, 0xba, 0xe8, 0x8d, 0xdc, 0x9f, 0xd5, 0xfa, 0x60, 0x5f, 0xba,
+  0xfd, 0xce, 0xdd, 0x61, 0x08, 0xc8, 0x79, 0xfd, 0x00, 0xdb, 0xba, 0xcf, 0xe5, 0xfc, 0x5f, 0xc7,
+  0xfd, 0x3c, 0xdf, 0xe9, 0x83, 0x0f, 0xc9, 0x32, 0x62, 0x3f, 0x6d, 0x01, 0xdc, 0xfd, 0xc0, 0xde,
+  0xcb, 0xbb, 0xbd, 0xff, 0x7f, 0x64, 0x01, 0x02, 0x30, 0x1f, 0xec, 0x19, 0x6a, 0x11, 0x84, 0x28,
+  0x64, 0x21, 0x60, 0x0b, 0xe8, 0xfe, 0x79, 0xbc, 0xb8, 0x9b, 0x1f, 0x01, 0x15, 0x2b, 0x0a, 0x31,
+  0x37, 0x04, 0x46, 0x4a, 0x0f, 0x89, 0x00, 0x10, 0xfd, 0xfd, 0x67, 0x01, 0xcc, 0xc3, 0x25, 0x37,
+  0x14, 0x7f, 0xe0, 0x19, 0xb3, 0x0c, 0x28, 0x17, 0x49, 0x11, 0x52, 0x11, 0x02, 0x90, 0x5e, 0x31,
+  0x8b, 0xe3, 0xb2, 0x01, 0x61, 0x01, 0x88, 0xb7, 0x9a, 0xcf, 0x12, 0x76, 0x21, 0xcc, 0x42, 0xd1,
+  0xe3, 0x2c, 0xab, 0xd7, 0x88, 0x7e, 0x28, 0xfe, 0x2e, 0x24, 0x5e, 0x31, 0x1f, 0x37, 0x34, 0x6a,
+  0x41, 0x64, 0x11, 0xb1, 0x35, 0x94, 0x0e, 0xfe, 0xfe, 0xef, 0xfe, 0xec, 0x9b, 0x6f, 0x02, 0x20,
+  0x9e, 0x1f, 0x8a, 0x28, 0x58, 0x01, 0x5d, 0x0b, 0x46, 0x64, 0x00, 0xbb, 0xfb, 0xdf, 0xd5, 0x87,
+  0x26, 0x43, 0x54, 0x00, 0x26, 0x42, 0x64, 0x27, 0x52, 0x84, 0x29, 0x41, 0xe6, 0xb5, 0x39, 0x4b,
+  0x6a, 0x01, 0x52, 0xb5, 0x64, 0x31, 0x02, 0x10, 0x67, 0x11, 0x73, 0x37, 0x04, 0xa2, 0x45, 0x4f,
+  0xa5, 0xd2, 0x12, 0xcf, 0x12, 0x9f, 0x75, 0xec, 0x00, 0x9f, 0xc4, 0xfa, 0x5f, 0xb6, 0xfb, 0xdf,
+  0xea, 0x17, 0x8a, 0x05, 0xcf, 0x32, 0x6d, 0x21, 0xdd, 0xb4, 0x05, 0xfe, 0x5f, 0xc4, 0xc0, 0xfc,
+  0xaf, 0xec, 0xfe, 0xca, 0x9f, 0xc9, 0x32, 0x02, 0x20, 0x03, 0x6a, 0x11, 0x03, 0x0e, 0xdc, 0xec,
+  0xba, 0xaa, 0xcf, 0xe8, 0x9c, 0xfe, 0x5f, 0x37, 0x04, 0x02, 0x00, 0x6a, 0x21, 0x6f, 0xf5, 0x02,
+  0x00, 0x26, 0xff, 0x05, 0x00, 0x64, 0x01, 0x8f, 0xe9, 0x1b, 0x14, 0x79, 0xb4, 0x86, 0x68, 0x04,
+  0x14, 0x83, 0x5c, 0xbc, 0xd6, 0x79, 0x34, 0x51, 0x2b, 0x03, 0x0d, 0x11, 0x01, 0x01, 0xde, 0xfd,
+  0xef, 0xe4, 0x46, 0x42, 0x52, 0x43, 0xaa, 0x1c, 0x32, 0x42, 0xa2, 0x05, 0x34, 0xfb, 0x13, 0xa7,
+  0x0f, 0x4c, 0x11, 0x08, 0x03, 0x05, 0x10, 0xa6, 0x21, 0x78, 0xb8, 0x9a, 0x79, 0xf4, 0xb8, 0x8b,
+  0xb2, 0x11, 0xa7, 0x5b, 0x01, 0x0b, 0x00, 0x88, 0x01, 0x79, 0x11, 0x18, 0x89, 0xb6, 0x79, 0x42,
+  0x4e, 0x6a, 0x21, 0x9b, 0xcb, 0xcc, 0xff, 0x59, 0x10, 0x40, 0x16, 0x61, 0xa1, 0x5a, 0x18, 0xe0,
+  0x19, 0xb8, 0x20, 0x0b, 0x10, 0x77, 0x00, 0x7f, 0xf9, 0x0f, 0xc2, 0x0b, 0x9e, 0x8f, 0x1c, 0x17,
+  0x05, 0x30, 0xd2, 0x22, 0xc2, 0x0c, 0xbc, 0x03, 0x6d, 0x01, 0x02, 0x30, 0xfb, 0xcf, 0xd9, 0xca,
+  0x35, 0x52, 0x08, 0x54, 0x36, 0x53, 0x02, 0x10, 0x26, 0x53, 0x64, 0x26, 0x20, 0x42, 0x53, 0x27,
+  0x32, 0x84, 0xcf, 0x12, 0x55, 0xe8, 0x8f, 0x2e, 0x44, 0x02, 0x60, 0xd2, 0x52, 0xa8, 0x35, 0xdf,
+  0xec, 0xca, 0x22, 0x24, 0x11, 0x33, 0x2b, 0xdc, 0xdc, 0x9f, 0x37, 0x04, 0xa4, 0xfb, 0xbf, 0x0e,
+  0xdc, 0xc5, 0x09, 0xcf, 0x62, 0xbd, 0x12, 0xa8, 0x8c, 0xfe, 0x6f, 0xf2, 0xc5, 0x3a, 0x14, 0xcd,
+  0xde, 0x83, 0x0f, 0xd2, 0x42, 0x6d, 0x21, 0x68, 0x3f, 0x20, 0xcc, 0xa9, 0x8c, 0xff, 0x8f, 0x34,
+  0x04, 0xe5, 0xfd, 0x06, 0x4f, 0xb9, 0x1c, 0x02, 0x00, 0xff, 0x6f, 0xe6, 0xff, 0x7f, 0x10, 0xea,
+  0xff, 0xbf, 0xea, 0x50, 0x08, 0xed, 0xbf, 0xdb, 0x30, 0xfd, 0xcc, 0xd6, 0x8a, 0x50, 0x7f, 0x0d,
+  0x01, 0xd8, 0xab, 0x4c, 0xcc, 0xdf, 0x5c, 0x2c, 0x0d, 0x51, 0xef, 0xee, 0xdd, 0x09, 0x35, 0x4c,
+  0x42, 0x43, 0x9c, 0x05, 0xbf, 0x0e, 0x24, 0x34, 0x48, 0x0b, 0x64, 0xe0, 0x46, 0x34, 0x67, 0x9b,
+  0x89, 0x52, 0x01, 0xb1, 0x12, 0x1c, 0x24, 0x2f, 0x8d, 0x35, 0x96, 0x05, 0x76, 0x31, 0x0e, 0x10,
+  0x9a, 0x9c, 0x05, 0x57, 0x8a, 0x49, 0x61, 0x41, 0xac, 0xea, 0x08, 0x00, 0xce, 0x8a, 0x86, 0x0f,
+  0xff, 0xe7, 0x9b, 0x0b, 0xf8, 0x16, 0x02, 0x30, 0xde, 0xce, 0x2b, 0x44, 0x11, 0x40, 0xcf, 0x22,
+  0x20, 0xdf, 0xcd, 0xec, 0xee, 0xbe, 0xf9, 0x0f, 0xfe, 0xef, 0x07, 0xc1, 0x10, 0x3a, 0x04, 0xcf,
+  0x52, 0xbd, 0xeb, 0xde, 0xbd, 0xea, 0x1f, 0x5d, 0x1b, 0x40, 0x04, 0xdb, 0x12, 0x02, 0x10, 0x64,
+  0x01, 0xce, 0xbc, 0xea, 0x01, 0xa7, 0x00, 0x47, 0x63, 0x54, 0x25, 0x53, 0x54, 0x25, 0x40, 0x43,
+  0x65, 0x25, 0x43, 0x55, 0x36, 0xa8, 0x00, 0x32, 0x00, 0x43, 0x25, 0x42, 0x64, 0x9d, 0xaa, 0xfb,
+  0x7f, 0x2e, 0x96, 0x01, 0x17, 0xcf, 0x12, 0xcc, 0x42, 0xf8, 0x75, 0x78, 0x96, 0xfa, 0x06, 0xcf,
+  0x07, 0x07, 0x37, 0x64, 0xeb, 0xdb, 0xaf, 0xd5, 0xfa, 0xa0, 0x4f, 0xa5, 0xfb, 0x6f, 0xbd, 0x0a,
+  0x37, 0xde, 0x4f, 0x21, 0x31, 0x1d, 0x10, 0xfd, 0xcb, 0xdc, 0x3a, 0x14, 0x48, 0x0b, 0xea, 0xa9,
+  0x2f, 0x5e, 0x51, 0xcf, 0x32, 0x02, 0x40, 0xe3, 0x09, 0xcf, 0xb6, 0x2c, 0x5e, 0xd5, 0x91, 0x7b,
+  0x08, 0xfe, 0x6f, 0xd8, 0xdc, 0x06, 0xff, 0xcf, 0x78, 0x08, 0x00, 0xfc, 0xff, 0xaf, 0xdb, 0xfd,
+  0xbe, 0xcc, 0xec, 0x78, 0xff, 0xf7, 0x9a, 0x0a, 0x41, 0x72, 0x92, 0x31, 0x04, 0xf8, 0x30, 0xde,
+  0x80, 0xeb, 0xfd, 0xaf, 0xee, 0xee, 0xd7, 0x78, 0x9c, 0x15, 0x6a, 0x42, 0x48, 0x3b, 0x46, 0x09,
+  0x2b, 0x46, 0xb1, 0x12, 0x58, 0x41, 0x9a, 0x0f, 0xf2, 0x46, 0x61, 0x21, 0xfb, 0x26, 0x79, 0x21,
+  0xa8, 0x9a, 0x56, 0x9b, 0xf3, 0xc1, 0x41, 0x5f, 0x30, 0x9a, 0xbf, 0x46, 0x1a, 0x2e, 0x44, 0xfb,
+  0x16, 0x5c, 0x00, 0x39, 0x6d, 0x07, 0xda, 0xfd, 0x6a, 0x11, 0xcf, 0x32, 0x7b, 0x28, 0xbf, 0xda,
+  0x80, 0xee, 0xaf, 0xfd, 0xff, 0xdf, 0xfd, 0xee, 0x60, 0x3b, 0x93, 0x9e, 0x3f, 0x63, 0x0b, 0xae,
+  0xea, 0x66, 0x0b, 0xed, 0x9d, 0x6a, 0x31, 0x23, 0x02, 0x10, 0xd2, 0x02, 0xcf, 0xcd, 0xea, 0x25,
+  0x07, 0xde, 0xbd, 0xc0, 0xfd, 0xbd, 0xb3, 0x55, 0x25, 0x43, 0x6a, 0x11, 0xd8, 0x02, 0x00, 0x35,
+  0x52, 0x55, 0x25, 0x42, 0x54, 0x35, 0x5a, 0x00, 0xdb, 0xce, 0xcc, 0xea, 0xce, 0xab, 0xfb, 0xaf,
+  0x80, 0xba, 0xfb, 0xaf, 0xb9, 0xfb, 0x8f, 0xa7, 0x37, 0x14, 0x0d, 0xaa, 0x0c, 0x6e, 0x02, 0x00,
+  0x48, 0x3b, 0xa7, 0xfa, 0xdf, 0xed, 0x03, 0x6f, 0x28, 0x6a, 0x31, 0xdc, 0xdc, 0xae, 0xc5, 0xfa,
+  0x5f, 0xc0, 0xa5, 0xfa, 0x5f, 0xbc, 0xfd, 0xab, 0xf2, 0x26, 0x5a, 0x78, 0x01, 0x57, 0x08, 0xd9,
+  0xfd, 0x4f, 0xc5, 0xfc, 0x8f, 0xdc, 0x78, 0xfe, 0xa9, 0x8f, 0x99, 0x55, 0x34, 0x24, 0x02, 0x10,
+  0x62, 0x2f, 0xa9, 0x00, 0x8d, 0xfe, 0x8f, 0xd6, 0xec, 0x8e, 0xca, 0xec, 0x70, 0xbe, 0xbb, 0xec,
+  0xae, 0xd6, 0x20, 0x67, 0x01, 0x02, 0x00, 0xdf, 0xe0, 0xfc, 0xeb, 0xdd, 0xbd, 0xdb, 0xbe, 0x0d,
+  0xa7, 0x16, 0x6f, 0x22, 0x00, 0xbc, 0xd8, 0xac, 0xbb, 0xcf, 0xfe, 0xff, 0xef, 0x03, 0x64, 0x51,
+  0xf2, 0x20, 0xfd, 0xaf, 0xea, 0xfe, 0xcf, 0xee, 0x58, 0xee, 0xd4, 0x45, 0x72, 0x08, 0x48, 0x1b,
+  0x43, 0xbf, 0x39, 0x47, 0x7f, 0xd2, 0x12, 0x3a, 0x24, 0xae, 0x25, 0x73, 0x01, 0x08, 0x10, 0xfb,
+  0x16, 0x6d, 0x01, 0xa8, 0x81, 0x70, 0x01, 0x8a, 0xcc, 0xde, 0xff, 0x79, 0xaa, 0x56, 0x10, 0xe9,
+  0x2f, 0x43, 0xd8, 0x9b, 0x58, 0x07, 0xff, 0x31, 0x34, 0x4f, 0x21, 0x3a, 0x2a, 0x7d, 0x02, 0x30,
+  0xea, 0x16, 0x07, 0xc9, 0x22, 0xb3, 0x1c, 0x92, 0x0f, 0x93, 0x08, 0xef, 0xf8, 0xdf, 0xec, 0xed,
+  0x93, 0x08, 0xb0, 0x2c, 0xd2, 0x02, 0x90, 0x18, 0xf8, 0x19, 0x1e, 0xe9, 0x66, 0x1b, 0x16, 0x07,
+  0x43, 0x54, 0x90, 0x08, 0xdd, 0xae, 0xe9, 0x04, 0xde, 0xbe, 0x82, 0x14, 0xce, 0xcb, 0xdc, 0x9c,
+  0xa8, 0x00, 0xb9, 0x8b, 0x9a, 0xdb, 0xbd, 0xbb, 0xdb, 0xbd, 0x20, 0xbc, 0xec, 0xcf, 0xcd, 0xec,
+  0x4e, 0x0e, 0xcd, 0x9c, 0x1c, 0xea, 0xaf, 0xe0, 0x0c, 0x6a, 0x01, 0x78, 0x0b, 0xbc, 0xea, 0xbd,
+  0x80, 0x9b, 0xe9, 0xae, 0x9a, 0xe9, 0x8e, 0x98, 0x6a, 0x01, 0xc0, 0xf9, 0x5f, 0x97, 0xfb, 0xcf,
+  0xee, 0xcf, 0x02, 0x5d, 0x58, 0x00, 0xdb, 0xcb, 0xbf, 0xc6, 0xe9, 0x5f, 0xa5, 0xfb, 0x78, 0x5f,
+  0xa8, 0xfc, 0x7f, 0x01, 0x54, 0x38, 0x60, 0x38, 0x6a, 0x01, 0xaa, 0x82, 0x9d, 0x3a, 0x24, 0xca,
+  0xfe, 0xce, 0xec, 0xa9, 0x04, 0x17, 0x03, 0x31, 0x44, 0x08, 0x70, 0xec, 0xcb, 0xa9, 0xee, 0xec,
+  0xeb, 0x04, 0xcd, 0xbc, 0x02, 0x10, 0xce, 0xbb, 0xfd, 0xbf, 0xdb, 0x05, 0x2e, 0x14, 0xcf, 0xc7,
+  0x0f, 0xdd, 0xed, 0xde, 0xad, 0xdb, 0x0b, 0x60, 0x02, 0x2d, 0x18, 0xa7, 0x3f, 0x18, 0x45, 0x8a,
+  0xbb, 0xff, 0x18, 0xff, 0xfc, 0xfd, 0xdd, 0x00, 0x5d, 0x32, 0xcd, 0xec, 0xfe, 0x93, 0x67, 0x11,
+  0xe0, 0x19, 0xee, 0xd3, 0xcc, 0x02, 0x25, 0x33, 0x6a, 0x01, 0xeb, 0x10, 0x47, 0x59, 0x0f, 0x68,
+  0xfe, 0x16, 0xa7, 0x28, 0x44, 0xc6, 0x02, 0xd2, 0x62, 0xa5, 0x04, 0x17, 0xad, 0xe4, 0x15, 0xab,
+  0xcb, 0x61, 0x11, 0xbb, 0x29, 0x33, 0x44, 0xdb, 0xbb, 0xc1, 0x01, 0xfe, 0xbe, 0xec, 0x59, 0x20,
+  0xfd, 0x9e, 0xdf, 0xcc, 0x52, 0x6d, 0x31, 0xba, 0x02, 0xb3, 0x3c, 0xde, 0xcf, 0x14, 0x20, 0xba,
+  0xbf, 0xcf, 0x02, 0xea, 0x63, 0x0b, 0x96, 0x18, 0x94, 0x01, 0xcc, 0xf1, 0x01, 0xcd, 0xda, 0x0c,
+  0xd9, 0x7b, 0x1b, 0x4e, 0x0e, 0xad, 0xeb, 0x49, 0x44, 0x48, 0x1e, 0x7b, 0xe4, 0x02, 0x0d, 0x1a,
+  0xef, 0x29, 0x00, 0xf6, 0x02, 0x5f, 0x32, 0xa5, 0x08, 0xbd, 0x10, 0xea, 0xdd, 0xad, 0xe9, 0x02,
+  0x10, 0xac, 0xe9, 0xce, 0x16, 0xba, 0xa2, 0x08, 0xc9, 0x15, 0xce, 0x78, 0x0b, 0x9c, 0xd9, 0xcf,
+  0x80, 0xbc, 0xfb, 0xce, 0xac, 0xe9, 0xcd, 0xab, 0x7f, 0x01, 0x0c, 0xfc, 0xef, 0xcf, 0x42, 0x02,
+  0x20, 0xdb, 0xca, 0xcf, 0xd6, 0xd4, 0xea, 0x6e, 0x5d, 0x0b, 0xa5, 0xf0, 0x05, 0x88, 0x27, 0x8b,
+  0x6a, 0x11, 0x14, 0xec, 0xcc, 0x3a, 0x04, 0xfb, 0x83, 0x2f, 0xdc, 0xec, 0xbf, 0x0b, 0x6f, 0x38,
+  0x02, 0x50, 0xcf, 0x68, 0x2f, 0xce, 0xcb, 0xcb, 0xbe, 0x82, 0xfe, 0x67, 0x11, 0xac, 0xdb, 0xce,
+  0xbb, 0xec, 0x2e, 0x04, 0x21, 0x67, 0x01, 0xbf, 0xdd, 0xec, 0xde, 0xa4, 0x00, 0xbd, 0xda, 0xf3,
+  0x67, 0x21, 0x36, 0x48, 0x9a, 0xaf, 0xdc, 0x0a, 0xe6, 0x10, 0x30, 0x55, 0xd7, 0x53, 0x60, 0xaf,
+  0xdb, 0xfe, 0xe8, 0x88, 0x18, 0x4e, 0x10, 0x07, 0x44, 0xb2, 0x35, 0x67, 0x01, 0x44, 0x67, 0x99,
+  0x05, 0x60, 0x18, 0x89, 0xf8, 0x16, 0x4d, 0x6f, 0x28, 0xa8, 0x05, 0x20, 0x0b, 0x10, 0x8a, 0xee,
+  0xb1, 0x28, 0xdd, 0x83, 0x26, 0x13, 0x76, 0x10, 0xac, 0xda, 0xbd, 0x89, 0xaf, 0x29, 0x03, 0xb7,
+  0xab, 0x02, 0xc4, 0x21, 0x67, 0x11, 0xdb, 0x5c, 0x50, 0x02, 0x20, 0xad, 0xcc, 0x32, 0xce, 0xfd,
+  0x41, 0x23, 0x67, 0x21, 0x70, 0x21, 0xee, 0xbc, 0x3d, 0x01, 0xf1, 0x11, 0x0a, 0xee, 0xda, 0x2c,
+  0xed, 0xad, 0x0f, 0xaf, 0xfb, 0xee, 0xbe, 0x0e, 0xea, 0x67, 0x51, 0xe4, 0x32, 0x05, 0x00, 0xfc,
+  0xef, 0xce, 0xfc, 0x08, 0xef, 0xcc, 0xeb, 0xb4, 0x35, 0xce, 0xbd, 0xd9, 0xde, 0x63, 0xe0, 0x1c,
+  0xe3, 0x3c, 0xda, 0xce, 0xab, 0x2b, 0x17, 0x0d, 0x0a, 0xce, 0x40, 0xad, 0xd9, 0xde, 0xad, 0xd9,
+  0xce, 0x8e, 0x04, 0xbc, 0xc0, 0xd9, 0xde, 0xac, 0xea, 0xbe, 0xbc, 0x0a, 0x0d, 0xcf, 0x82, 0x00,
+  0xdc, 0xaa, 0xef, 0xdb, 0xea, 0xbe, 0xaa, 0xeb, 0xe4, 0xaf, 0xc9, 0xcf, 0x02, 0xec, 0xec, 0x81,
+  0x15, 0x02, 0x30, 0xe6, 0x09, 0x04, 0xdd, 0xfe, 0x65, 0x1f, 0xfd, 0x9f, 0xca, 0xfc, 0xbe, 0x3e,
+  0xbe, 0xbd, 0x05, 0xc6, 0x32, 0x05, 0x50, 0xde, 0x22, 0x6a, 0x01, 0xeb, 0xad, 0x00, 0xdc, 0xff,
+  0xed, 0xda, 0xde, 0xbd, 0xda, 0xdd, 0xa0, 0xbc, 0xeb, 0xbf, 0xdb, 0xfc, 0x02, 0x00, 0xce, 0x64,
+  0x01, 0x90, 0xad, 0xda, 0xee, 0xae, 0xcf, 0x12, 0x56, 0x88, 0x87, 0x02, 0x30, 0x8b, 0x79, 0xb5,
+  0x68, 0x48, 0x09, 0xf5, 0x30, 0xee, 0xbc, 0x07, 0xcf, 0x22, 0x3f, 0x65, 0xf8, 0x00, 0xcf, 0xee,
+  0x44, 0x54, 0x24, 0x51, 0x15, 0x0e, 0x42, 0x52, 0x24, 0x6a, 0x01, 0x23, 0x48, 0x1b, 0x68, 0xe0,
+  0x66, 0x83, 0x46, 0x56, 0x87, 0xcf, 0x32, 0xc8, 0x09, 0x73, 0x11, 0x8b, 0x05, 0x10, 0xe1, 0x02,
+  0xae, 0x63, 0x4e, 0xee, 0xe9, 0xbc, 0x39, 0x1e, 0x84, 0xd7, 0x9a, 0xbc, 0x0c, 0xde, 0xdf, 0xfe,
+  0xff, 0x43, 0x01, 0x6c, 0xae, 0xdb, 0x75, 0x22, 0xb7, 0x02, 0xea, 0x2e, 0x04, 0x5c, 0x10, 0x9f,
+  0xbd, 0xd2, 0x22, 0xad, 0xe7, 0x22, 0xb7, 0x12, 0x14, 0x10, 0x67, 0x01, 0xfe, 0xe3, 0x24, 0x33,
+  0x67, 0x11, 0xcf, 0x02, 0xcd, 0xfb, 0xc9, 0x22, 0x89, 0x20, 0xae, 0xfd, 0x70, 0xff, 0xce, 0xea,
+  0xde, 0x67, 0x31, 0x4c, 0x14, 0x49, 0x14, 0xed, 0x9a, 0x9e, 0x67, 0x21, 0xcd, 0xe7, 0x12, 0x8a,
+  0x08, 0xde, 0xbe, 0x14, 0x00, 0xd8, 0xda, 0xdd, 0x9e, 0xd2, 0x02, 0x58, 0x11, 0xde, 0x66, 0x0b,
+  0xe3, 0x2c, 0x00, 0xdd, 0x9d, 0xea, 0xcd, 0x9d, 0xda, 0xde, 0x9d, 0x01, 0xed, 0x15, 0xdd, 0x9c,
+  0xda, 0xbf, 0xbc, 0xfd, 0xdd, 0x84, 0xce, 0xcc, 0xb7, 0x72, 0xdb, 0xa9, 0xef, 0xec, 0x7d, 0x0a,
+  0xc0, 0xeb, 0xaf, 0xca, 0xfc, 0xbf, 0xce, 0x4c, 0x01, 0x27, 0x4b, 0x11, 0x2d, 0x5b, 0xdd, 0xbb,
+  0xae, 0x86, 0x02, 0xfc, 0xce, 0xbd, 0xf0, 0xec, 0xef, 0xea, 0x87, 0x5e, 0x41, 0x9c, 0x45, 0xcf,
+  0x22, 0x02, 0x00, 0x80, 0xcc, 0xa9, 0xee, 0xee, 0xfd, 0xdd, 0xbd, 0x6a, 0x01, 0x20, 0xeb, 0xbf,
+  0xdc, 0xfc, 0xbf, 0x59, 0x13, 0xdb, 0xed, 0xde, 0xae, 0x02, 0x00, 0xcf, 0x12, 0x39, 0x18, 0xe9,
+  0x03, 0xbc, 0xd7, 0x03, 0x2d, 0x75, 0x1d, 0x6e, 0x19, 0xce, 0x76, 0x01, 0x0a, 0x21, 0x02, 0x10,
+  0xed, 0xee, 0xd6, 0x86, 0x68, 0x37, 0x14, 0x78, 0x18, 0x25, 0x42, 0x42, 0x35, 0x0a, 0x07, 0x21,
+  0x02, 0x10, 0x64, 0x46, 0x68, 0xa7, 0x36, 0x4b, 0x79, 0xb8, 0x0d, 0x9c, 0x25, 0xb9, 0x87, 0x05,
+  0xca, 0x4f, 0xef, 0xf4, 0x68, 0x67, 0xe6, 0xa6, 0x94, 0x04, 0xae, 0x15, 0xdd, 0xcf, 0xc4, 0x21,
+  0xcf, 0x12, 0xba, 0x22, 0xe1, 0xcf, 0x82, 0xff, 0xbf, 0xec, 0xfe, 0xcf, 0x12, 0x37, 0x14, 0xcf,
+  0x32, 0x57, 0x77, 0x60, 0x0a, 0x27, 0x17, 0x00, 0xec, 0x76, 0x41, 0x9f, 0x22, 0x27, 0xde, 0x1b,
+  0xb7, 0x15, 0x02, 0x10, 0xce, 0xc2, 0x1f, 0x3a, 0x14, 0xae, 0xfb, 0xef, 0x66, 0xde, 0xcf, 0x02,
+  0xcb, 0x4c, 0xce, 0xbe, 0x2e, 0x17, 0x34, 0x07, 0xee, 0x96, 0x9e, 0x6d, 0x01, 0x21, 0x06, 0xfc,
+  0x37, 0x14, 0xbc, 0xfc, 0x49, 0x44, 0x04, 0xad, 0xfb, 0x6b, 0x00, 0xce, 0xad, 0xea, 0xbf, 0xbd,
+  0x18, 0xfd, 0xcd, 0xce, 0xd4, 0x36, 0x87, 0x25, 0xdb, 0x98, 0xff, 0x20, 0xdd, 0xda, 0xde, 0xab,
+  0xeb, 0x61, 0x04, 0xaf, 0xce, 0x0f, 0x15, 0x0e, 0x61, 0x01, 0x64, 0x21, 0x5d, 0x58, 0xda, 0xad,
+  0xed, 0xdf, 0x04, 0xeb, 0xfc, 0xa2, 0x03, 0xee, 0xde, 0xee, 0xc9, 0x8f, 0x3b, 0xcf, 0x32, 0x3e,
+  0x00, 0xcc, 0xd5, 0x32, 0x6a, 0x01, 0x02, 0x00, 0xa7, 0x7f, 0x40, 0xfe, 0xde, 0xbd, 0xdb, 0xdd,
+  0xad, 0x67, 0x01, 0xfd, 0x81, 0xf1, 0x01, 0xcf, 0xce, 0xdb, 0xee, 0xae, 0xda, 0x6a, 0x01, 0x09,
+  0x0d, 0x01, 0xcd, 0xd7, 0x28, 0x01, 0x8a, 0x57, 0x8f, 0xee, 0x3f, 0x98, 0x56, 0x72, 0x42, 0x45,
+  0x32, 0xf2, 0x30, 0x1a, 0x00, 0x64, 0x0a, 0xde, 0xeb, 0x94, 0xcc, 0x22, 0x67, 0x01, 0x43, 0x83,
+  0x1f, 0x33, 0x44, 0x0d, 0x07, 0x19, 0xa4, 0x0f, 0x57, 0x44, 0xa8, 0x15, 0xa4, 0x4c, 0x78, 0xb6,
+  0x8a, 0x66, 0xcd, 0x16, 0x2a, 0x00, 0x40, 0xf6, 0x79, 0xde, 0x12, 0x1d, 0x00, 0xb6, 0x7c, 0x8a,
+  0xed, 0x9d, 0x07, 0x67, 0x31, 0xb7, 0x22, 0x2c, 0x53, 0x5c, 0x00, 0xeb, 0xbd, 0x92, 0x07, 0xed,
+  0x9f, 0x05, 0x1f, 0x14, 0xef, 0x16, 0x4c, 0x74, 0xae, 0xc1, 0x14, 0x67, 0x91, 0x13, 0x2d, 0x0e,
+  0x59, 0x63, 0xbf, 0xfc, 0x67, 0x01, 0xec, 0x49, 0xcd, 0x58, 0xeb, 0xee, 0xaf, 0xb7, 0x05, 0x6d,
+  0x01, 0xea, 0x67, 0x01, 0xff, 0xfb, 0xe8, 0x00, 0xe7, 0x32, 0xbe, 0x79, 0x01, 0x64, 0x41, 0x85,
+  0x01, 0x9f, 0x08, 0x6c, 0x1b, 0x00, 0xcb, 0xfb, 0xde, 0xbd, 0xd9, 0xed, 0xad, 0xd9, 0x14, 0xdd,
+  0xad, 0x07, 0x0a, 0xfc, 0xc0, 0x05, 0xbf, 0xcd, 0xfe, 0xcc, 0xcc, 0xbe, 0x49, 0x01, 0xcf, 0x62,
+  0x98, 0xef, 0xf5, 0x03, 0x9f, 0x08, 0x3d, 0x94, 0x01, 0xcc, 0xd0, 0x0a, 0x0a, 0x07, 0x64, 0x21,
+  0xcf, 0x42, 0xdc, 0xfd, 0x10, 0xda, 0x98, 0xef, 0xeb, 0xcf, 0x02, 0xea, 0xdd, 0xae, 0xf0, 0xfd,
+  0xee, 0xdd, 0xbb, 0x31, 0x54, 0x6c, 0x18, 0x02, 0x10, 0x0b, 0x30, 0xd0, 0xcc, 0xba, 0xff, 0xee,
+  0x86, 0x03, 0xec, 0x52, 0x1d, 0x29, 0x26, 0x01, 0x89, 0x10, 0xae, 0xda, 0x45, 0x75, 0x56, 0x55,
+  0x74, 0xf0, 0x57, 0x56, 0x85, 0x79, 0xd0, 0x11, 0xf8, 0x30, 0xee, 0x01, 0x7a, 0x16, 0xcd, 0x2d,
+  0x75, 0xfd, 0x80, 0x26, 0x5a, 0x02, 0xef, 0xdd, 0x4b, 0x2b, 0xe3, 0x29, 0x71, 0x02, 0x00, 0x33,
+  0x53, 0x24, 0x6a, 0x11, 0xa8, 0x05, 0x76, 0x04, 0xa8, 0x59, 0x6a, 0x11, 0x78, 0x9e, 0x31, 0x44,
+  0x00, 0x40, 0xf7, 0xc3, 0x45, 0x88, 0xd0, 0xb6, 0x8a, 0xff, 0xef, 0xc0, 0x02, 0xea, 0x9f, 0x52,
+  0x05, 0x10, 0xfd, 0xd6, 0x31, 0xfe, 0xc2, 0x19, 0xf5, 0x00, 0x54, 0x18, 0x72, 0x18, 0x7f, 0x21,
+  0x1a, 0x40, 0x0b, 0x6f, 0x28, 0xf4, 0x31, 0xee, 0x7f, 0x51, 0xef, 0xcf, 0xfd, 0xff, 0x47, 0x3e,
+  0x20, 0x02, 0x30, 0x64, 0x01, 0xfd, 0xae, 0xd9, 0x91, 0x01, 0xff, 0xfc, 0xcf, 0xfd, 0x3f, 0x7e,
+  0x1f, 0x17, 0x45, 0x02, 0x3d, 0x04, 0x34, 0x07, 0xcc, 0x25, 0x07, 0xb6, 0x1f, 0x81, 0x0b, 0x7f,
+  0x01, 0xea, 0xed, 0x9d, 0xda, 0xef, 0x01, 0x9f, 0x08, 0xdc, 0xfb, 0xbf, 0xce, 0xfd, 0xbb, 0xaf,
+  0x6b, 0x46, 0x31, 0x67, 0x31, 0x87, 0x67, 0x01, 0xce, 0xf8, 0x0c, 0x67, 0x01, 0xcb, 0xd0, 0xfc,
+  0xef, 0xea, 0x88, 0x64, 0x21, 0xdc, 0xcf, 0x22, 0xd2, 0x22, 0xc0, 0xcd, 0xbb, 0xde, 0xdd, 0xfe,
+  0xbf, 0x73, 0x04, 0x3f, 0x08, 0x1e, 0xdc, 0x47, 0x11, 0x02, 0x20, 0xd8, 0x42, 0x0e, 0x40, 0xcb,
+  0x87, 0xee, 0xb8, 0xee, 0xea, 0xde, 0x0b, 0x09, 0xf4, 0x11, 0xd4, 0x00, 0xec, 0x43, 0x01, 0x03,
+  0xa4, 0x00, 0xa1, 0x09, 0x45, 0x74, 0x56, 0x44, 0x75, 0x67, 0x6f, 0x34, 0x54, 0x5b, 0x04, 0xbf,
+  0x10, 0x98, 0x53, 0xeb, 0xe4, 0x42, 0xf2, 0x30, 0xdf, 0x18, 0xfe, 0x56, 0x74, 0x3a, 0x34, 0x4b,
+  0x1b, 0x42, 0x43, 0x35, 0xf2, 0x44, 0x3e, 0x00, 0x65, 0x68, 0xa7, 0x3c, 0x48, 0x0b, 0x64, 0xa1,
+  0x00, 0x00, 0x2c, 0xf9, 0xab, 0xcb, 0x1c, 0x97, 0x14, 0x79, 0x5f, 0x10, 0xae, 0xeb, 0xaf, 0x57,
+  0x05, 0x57, 0x18, 0x65, 0x2f, 0xba, 0x32, 0xfe, 0x37, 0x01, 0xde, 0x6b, 0x20, 0xff, 0x3d, 0x51,
+  0xdc, 0x51, 0x34, 0x44, 0x6f, 0x38, 0x89, 0x00, 0xb4, 0x02, 0xcc, 0x15, 0x2f, 0x00, 0x57, 0xde,
+  0x0b, 0x9e, 0x30, 0x17, 0x10, 0xea, 0xea, 0x02, 0xfe, 0x4f, 0x04, 0xcf, 0x1b, 0xcd, 0x06, 0xa4,
+  0x7f, 0xde, 0xd2, 0x02, 0x34, 0x07, 0xae, 0xda, 0xde, 0xe7, 0x04, 0x0a, 0x64, 0x31, 0x18, 0x01,
+  0xcc, 0xeb, 0x07, 0x0a, 0x5d, 0x02, 0x90, 0x02, 0x19, 0x88, 0x0d, 0xcf, 0xcd, 0xd1, 0x26, 0x47,
+  0x6f, 0xcb, 0x88, 0xff, 0x86, 0xed, 0x49, 0x07, 0x67, 0x51, 0xec, 0xcb, 0xed, 0xcf, 0x34, 0x34,
+  0x01, 0xc2, 0x59, 0xdf, 0xdc, 0xb9, 0x8e, 0xfe, 0xbf, 0xcc, 0xf2, 0xec, 0x7e, 0x05, 0xef, 0xdf,
+  0x48, 0x0b, 0x47, 0x01, 0x61, 0x71, 0xd5, 0x22, 0xe1, 0x75, 0x08, 0xcc, 0xfe, 0xde, 0xed, 0xe0,
+  0x32, 0x74, 0x10, 0x89, 0x06, 0x5a, 0xbe, 0xb9, 0x00, 0xda, 0x64, 0x11, 0x02, 0x00, 0x7e, 0xa4,
+  0x00, 0xeb, 0x7c, 0xee, 0xbe, 0x9d, 0x0d, 0xc9, 0x22, 0xda, 0x33, 0x02, 0x20, 0xb2, 0x1d, 0xbe,
+  0x04, 0xeb, 0xdf, 0x87, 0x32, 0xce, 0xfe, 0xef, 0xea, 0xbb, 0x37, 0xd2, 0x32, 0x4e, 0x1b, 0x43,
+  0x14, 0x45, 0xa5, 0x05, 0x24, 0x0e, 0x56, 0x74, 0x00, 0x57, 0x45, 0x68, 0x89, 0x88, 0xa9, 0x9a,
+  0xbb, 0x12, 0xce, 0xd2, 0x82, 0xfa, 0xab, 0x9e, 0x3f, 0x89, 0xb6, 0x78, 0x7c, 0xff, 0xee, 0x6b,
+  0x09, 0x84, 0x25, 0x02, 0x80, 0x59, 0x00, 0x54, 0x1b, 0xfd, 0xef, 0x11, 0x50, 0x6a, 0x41, 0x51,
+  0x08, 0x89, 0x00, 0xfb, 0x29, 0x90, 0x70, 0x11, 0x25, 0x04, 0x9e, 0xbe, 0xe0, 0x00, 0x46, 0x1d,
+  0x27, 0x6e, 0xa1, 0x10, 0xbe, 0xeb, 0x02, 0x00, 0xde, 0xdf, 0x9b, 0x00, 0xcf, 0x62, 0xd7, 0x2c,
+  0x17, 0x10, 0xad, 0x61, 0x21, 0x02, 0x40, 0x47, 0x0b, 0x20, 0xf2, 0x29, 0x3e, 0x03, 0xef, 0xee,
+  0xff, 0xce, 0x00, 0xa9, 0xee, 0x8f, 0xdc, 0x1d, 0x44, 0x2f, 0x37, 0x24, 0xec, 0x46, 0x17, 0x02,
+  0x10, 0x94, 0x01, 0x30, 0xde, 0xfe, 0xda, 0xaf, 0xbc, 0x89, 0x54, 0x28, 0xec, 0xbd, 0x06, 0xed,
+  0x3a, 0x04, 0xaf, 0x01, 0xef, 0xee, 0xfe, 0xff, 0xfa, 0x8f, 0x0d, 0x07, 0x6a, 0x31, 0x05, 0x10,
+  0x6a, 0x61, 0xcc, 0xce, 0xfe, 0x45, 0x24, 0x67, 0xcf, 0x22, 0x71, 0x00, 0xac, 0x0a, 0xbe, 0xeb,
+  0xcf, 0x12, 0x02, 0x00, 0x6e, 0xfe, 0xfe, 0x58, 0x61, 0xd4, 0x30, 0x0a, 0x27, 0xe3, 0x70, 0x56,
+  0x00, 0xb1, 0x25, 0x27, 0x08, 0x90, 0xff, 0xde, 0xd4, 0x56, 0x4b, 0x0b, 0x43, 0x53, 0xb6, 0x2c,
+  0xb0, 0x44, 0x25, 0x22, 0x44, 0x0d, 0x07, 0x7e, 0x08, 0x57, 0x19, 0x27, 0x81, 0x2a, 0x1e, 0x45,
+  0x74, 0x57, 0x55, 0x77, 0x89, 0xbf, 0x1f, 0x84, 0xfa, 0xbc, 0x9b, 0x2f, 0x9b, 0x78, 0xa9, 0xab,
+  0x6c, 0x12, 0xf7, 0x19, 0x31, 0x5c, 0x20, 0x59, 0x40, 0xce, 0x21, 0x1e, 0xdd, 0x00, 0xf1, 0x2d,
+  0x74, 0x20, 0xef, 0x86, 0xb0, 0x5e, 0x21, 0x8a, 0x08, 0x11, 0x70, 0xef, 0x64, 0x07, 0xcf, 0x02,
+  0x17, 0x80, 0xc3, 0x1d, 0x60, 0x44, 0x20, 0xfb, 0xde, 0xcc, 0xfb, 0x0e, 0x10, 0x02, 0xa0, 0x0f,
+  0x1c, 0x27, 0x45, 0x5e, 0x88, 0x41, 0xd1, 0x00, 0xde, 0xfe, 0xb9, 0x8f, 0xcd, 0x09, 0x8b, 0xdc,
+  0x68, 0x0c, 0x61, 0x34, 0xfb, 0xce, 0x32, 0x00, 0x85, 0x11, 0x33, 0x8f, 0x9c, 0x23, 0x20, 0xca,
+  0x87, 0x94, 0x09, 0x1a, 0x13, 0xce, 0xff, 0xe0, 0xff, 0xfe, 0xff, 0xb8, 0x7f, 0xce, 0x19, 0x61,
+  0x61, 0x75, 0x38, 0x3f, 0xf3, 0x02, 0x90, 0x12, 0xc6, 0x0a, 0x89, 0x23, 0x0c, 0x32, 0x13, 0x11,
+  0x64, 0x46, 0xde, 0xee, 0x74, 0x00, 0xb3, 0x60, 0xb9, 0x23, 0x8c, 0x03, 0xed, 0x24, 0x02, 0x11,
+  0x20, 0x0f, 0x42, 0x12, 0x2f, 0x0f, 0xb9, 0x03, 0xd1, 0x13, 0xeb, 0xfe, 0xde, 0xfe, 0x00, 0xcc,
+  0xc2, 0x24, 0x42, 0x54, 0x34, 0x32, 0x53, 0xe6, 0x24, 0xd5, 0x02, 0x13, 0x07, 0x32, 0x54, 0x7b,
+  0x28, 0x13, 0x07, 0x19, 0x17, 0x03, 0x20, 0x23, 0x02, 0x00, 0x64, 0x57, 0x55, 0x67, 0x79, 0x56,
+  0xe2, 0x87, 0x34, 0x1a, 0x68, 0xae, 0xed, 0x16, 0x34, 0x09, 0x1b, 0x63, 0x2e, 0x3f, 0xf8, 0x26,
+  0x88, 0x14, 0x59, 0x10, 0xf1, 0x01, 0x96, 0x05, 0x06, 0x0e, 0xae, 0xdb, 0xd3, 0xc0, 0x45, 0xde,
+  0x52, 0xee, 0xbe, 0x96, 0x18, 0xfe, 0x99, 0x02, 0x11, 0x30, 0xeb, 0x8c, 0x00, 0x67, 0x01, 0xed,
+  0x4e, 0x3b, 0xda, 0xde, 0x02, 0xc5, 0x30, 0xc1, 0x41, 0x7b, 0x5b, 0x14, 0x13, 0x17, 0xde, 0x0b,
+  0x03, 0x33, 0x92, 0x44, 0x00, 0x8c, 0x16, 0xeb, 0xcf, 0x6a, 0x11, 0x6d, 0x31, 0x05, 0x00, 0x0a,
+  0x01, 0xcf, 0xed, 0x09, 0x5b, 0xd5, 0x12, 0x70, 0xfd, 0xcd, 0xba, 0xee, 0x2a, 0x01, 0xf0, 0x02,
+  0x21, 0x18, 0xea, 0xe0, 0xde, 0xbe, 0xfd, 0xde, 0xde, 0x0a, 0x07, 0x61, 0x51, 0x08, 0x30, 0x58,
+  0xde, 0xcb, 0xee, 0x2e, 0x00, 0x3d, 0x11, 0xfd, 0x88, 0x00, 0xee, 0x67, 0xe0, 0x29, 0x6a, 0x81,
+  0x76, 0x11, 0xb9, 0x8e, 0x29, 0x03, 0xdc, 0x07, 0xfd, 0xe0, 0xef, 0xdf, 0xfd, 0xee, 0xbd, 0x0c,
+  0x12, 0x27, 0x05, 0x10, 0x11, 0x3e, 0x76, 0xd4, 0x13, 0xf1, 0x84, 0x3e, 0x7c, 0x0d, 0x11, 0x72,
+  0x22, 0xff, 0xfe, 0x03, 0x13, 0x37, 0x8c, 0x36, 0xdb, 0xff, 0xee, 0xfe, 0xbc, 0xc3, 0x85, 0x3d,
+  0x04, 0x34, 0x3a, 0x14, 0x42, 0x24, 0x22, 0x32, 0x43, 0x14, 0x7c, 0x22, 0x43, 0xbf, 0x2c, 0xd8,
+  0x02, 0x02, 0x10, 0xf6, 0x05, 0x73, 0x21, 0x63, 0xfa, 0x46, 0xd7, 0x19, 0xae, 0x0e, 0x23, 0x1e,
+  0x1b, 0x5c, 0x70, 0xa3, 0x14, 0xc1, 0x11, 0xfe, 0xfe, 0x2c, 0x16, 0x63, 0x78, 0xed, 0x08, 0xb5,
+  0x44, 0x7c, 0x11, 0x66, 0x68, 0x60, 0x1b, 0xfd, 0xf4, 0x51, 0xef, 0x93, 0x78, 0x97, 0x11, 0x52,
+  0x51, 0x13, 0x17, 0xa8, 0x68, 0x10, 0x47, 0x74, 0xfd, 0xcf, 0x1e, 0x15, 0xea, 0x1a, 0x40, 0x48,
+  0x6e, 0xc0, 0x35, 0xaf, 0xd8, 0xee, 0xca, 0x9f, 0x7b, 0x75, 0x67, 0x01, 0xde, 0xe3, 0x13, 0x10,
+  0x2d, 0x99, 0x8c, 0x39, 0xeb, 0x98, 0x54, 0x88, 0x8a, 0x45, 0xca, 0xae, 0x16, 0x04, 0x33, 0xf1,
+  0x21, 0x20, 0x15, 0xfe, 0xa8, 0xa5, 0x45, 0x3a, 0x74, 0xba, 0x9e, 0x6e, 0xfe, 0xfb, 0x26, 0xdf,
+  0x07, 0x02, 0x00, 0xfb, 0x21, 0x12, 0xcf, 0x02, 0x64, 0x00, 0x47, 0x44, 0x6f, 0xed, 0xfe, 0xcf,
+  0xdb, 0xef, 0x4d, 0xd6, 0x44, 0xfc, 0xb4, 0x22, 0x11, 0x5f, 0xae, 0xeb, 0x09, 0x4b, 0xee, 0x93,
+  0xf2, 0x70, 0xdd, 0x10, 0xae, 0xec, 0x49, 0x04, 0x88, 0x94, 0x1b, 0x1e, 0x5d, 0x43, 0x14, 0x54,
+  0xd5, 0x12, 0x02, 0x00, 0xbf, 0x0c, 0x55, 0x61, 0x01, 0x75, 0xe7, 0x40, 0x14, 0x70, 0x41, 0x08,
+  0x20, 0x78, 0x9e, 0x2f, 0x13, 0x90, 0xbb, 0xf5, 0x10, 0xf9, 0x04, 0x24, 0xfc, 0xdf, 0xb3, 0x1c,
+  0x74, 0x70, 0x44, 0x0f, 0x7e, 0x35, 0x1b, 0x4e, 0xff, 0x3a, 0x81, 0x02, 0x33, 0xb4, 0x3e, 0x44,
+  0x60, 0x34, 0x44, 0x1e, 0x82, 0xa1, 0x10, 0x44, 0x00, 0xf1, 0x14, 0x00, 0xdf, 0xff, 0xee, 0x57,
+  0x2e, 0x11, 0x10, 0xea, 0x32, 0x3d, 0x44, 0x32, 0xfb, 0x79, 0x21, 0xfd, 0xca, 0xcf, 0x12, 0x02,
+  0x50, 0xdd, 0xba, 0x38, 0xee, 0xde, 0xec, 0x11, 0x23, 0x02, 0x20, 0xc3, 0x08, 0xdb, 0xaa, 0x8f,
+  0x80, 0x4c, 0x6d, 0x15, 0xab, 0x02, 0x91, 0x11, 0xa7, 0x7f, 0xee, 0x25, 0x5d, 0x84, 0xfd, 0xef,
+  0x1d, 0x04, 0xec, 0xba, 0xda, 0xaf, 0x34, 0x74, 0xf1, 0xd2, 0x05, 0xcc, 0xcf, 0xfe, 0xd6, 0x31,
+  0xcf, 0x02, 0x6a, 0x11, 0x53, 0x23, 0xf1, 0x72, 0x02, 0xab, 0xbf, 0xfe, 0x0e, 0x10, 0x83, 0x46,
+  0xd6, 0x6a, 0xff, 0x5e, 0x19, 0x0a, 0x01, 0xfe, 0xfe, 0xd6, 0xaa, 0x7e, 0x38, 0xce, 0xfd, 0xde,
+  0xde, 0xe3, 0x1b, 0x1e, 0x02, 0x30, 0x7e, 0x18, 0xef, 0x09, 0x54, 0x31, 0x04, 0x3d, 0x24, 0x8d,
+  0x61, 0x01, 0x75, 0xf9, 0x25, 0xd8, 0x12, 0x46, 0xaa, 0xbe, 0x03, 0x12, 0xd7, 0x1b, 0x08, 0x4f,
+  0x91, 0xc4, 0x11, 0xef, 0x9c, 0x15, 0xde, 0x9b, 0xbc, 0x75, 0x12, 0xff, 0x89, 0x10, 0xe4, 0x82,
+  0xba, 0x92, 0x78, 0x7b, 0x44, 0x30, 0x63, 0x2b, 0x9f, 0x02, 0x6e, 0x33, 0x7f, 0x7c, 0x04, 0xa1,
+  0x50, 0x2c, 0x10, 0xfc, 0x02, 0x7f, 0x21, 0x4b, 0x2e, 0x9d, 0x2a, 0xac, 0x67, 0x34, 0x34, 0x44,
+  0x00, 0xcf, 0x02, 0xed, 0xc9, 0x41, 0x6f, 0xb4, 0x02, 0xce, 0x38, 0xbb, 0xed, 0xde, 0xbe, 0x14,
+  0x02, 0x30, 0xf1, 0x11, 0xcf, 0xfe, 0xce, 0xdb, 0xd4, 0x1d, 0xee, 0x5d, 0x22, 0x34, 0xce, 0xec,
+  0x5e, 0x14, 0x52, 0x27, 0x65, 0x4c, 0x0a, 0xff, 0xca, 0x01, 0xda, 0x88, 0x96, 0x1c, 0x1a, 0x00,
+  0xdc, 0x60, 0x98, 0xec, 0xbc, 0x98, 0xef, 0x56, 0x2f, 0x86, 0x20, 0xfc, 0x83, 0xd2, 0x22, 0x63,
+  0x12, 0x45, 0x75, 0x57, 0xff, 0xef, 0x76, 0x51, 0x8f, 0xc5, 0x70, 0x02, 0x30, 0x47, 0x20, 0x0a,
+  0x01, 0xed, 0xfc, 0xdf, 0x5a, 0x72, 0xe3, 0x0d, 0x31, 0x94, 0x1a, 0xef, 0xe6, 0x67, 0xa5, 0x05,
+  0x8c, 0x0f, 0xcc, 0x32, 0x7c, 0x42, 0x54, 0xae, 0x05, 0x34, 0x54, 0xd2, 0x32, 0x02, 0x20, 0x67,
+  0x01, 0xcc, 0x86, 0xce, 0x1e, 0x1b, 0x4f, 0xd1, 0xaf, 0xea, 0xff, 0xde, 0x34, 0x04, 0xff, 0x83,
+  0x7c, 0xc4, 0x61, 0x2d, 0x22, 0x48, 0x7b, 0xa2, 0x72, 0xa1, 0x00, 0xb1, 0x25, 0x02, 0x80, 0xef,
+  0xa2, 0x22, 0x0d, 0x8a, 0x44, 0x70, 0x97, 0x04, 0xcf, 0x42, 0x02, 0x52, 0x11, 0x11, 0x33, 0xc7,
+  0x70, 0x11, 0x44, 0x60, 0x0e, 0x10, 0xfd, 0xb9, 0x9f, 0xf7, 0x5a, 0x92, 0x19, 0x38, 0xcb, 0xdd,
+  0xcf, 0x74, 0x40, 0xfc, 0x22, 0x20, 0x00, 0xfe, 0xa8, 0x86, 0x7f, 0x21, 0x4b, 0x84, 0x55, 0xdc,
+  0xfc, 0xcc, 0xa9, 0xfe, 0x19, 0x11, 0xa1, 0x20, 0xed, 0xaf, 0xec, 0xb4, 0x12, 0xef, 0xfe, 0xee,
+  0x00, 0xdc, 0xaa, 0xa7, 0x69, 0x55, 0xca, 0x8e, 0xbb, 0xf0, 0xa7, 0x7e, 0xed, 0xef, 0x21, 0x5b,
+  0xb3, 0x10, 0xa8, 0x02, 0x20, 0x00, 0xf0, 0xed, 0xfd, 0x55, 0x7f, 0x17, 0x07, 0x0b, 0x10, 0x80,
+  0x43, 0xc2, 0x23, 0x1f, 0x41, 0x8c, 0xdc, 0x0a, 0xf6, 0x15, 0xc5, 0xd0, 0x66, 0x0b, 0xbc, 0xfc,
+  0xef, 0x10, 0xed, 0xed, 0x32, 0x43, 0x3a, 0x44, 0x32, 0x43, 0x35, 0x84, 0x32, 0x44, 0x73, 0x11,
+  0x44, 0x64, 0x56, 0x54, 0xe3, 0x09, 0xdf, 0x6d, 0x31, 0x0a, 0x07, 0x84, 0x28, 0x68, 0x00, 0xdd,
+  0x10, 0xbf, 0x37, 0xa1, 0xab, 0x4b, 0xfc, 0xcc, 0xeb, 0x07, 0x24, 0x41, 0x53, 0x22, 0x31, 0x8a,
+  0x18, 0xf1, 0x61, 0x87, 0x12, 0xf3, 0x17, 0x10, 0x5d, 0x25, 0xde, 0xbf, 0x59, 0xb3, 0x44, 0x40,
+  0x9c, 0x05, 0x2c, 0xc3, 0x7b, 0x9e, 0x2c, 0x67, 0x11, 0xfc, 0xdc, 0x81, 0x85, 0x0d, 0x22, 0x31,
+  0x0e, 0x30, 0xed, 0xe6, 0xb9, 0x03, 0x5b, 0xef, 0x3a, 0xdd, 0xcf, 0x8a, 0x12, 0xe7, 0x65, 0xf0,
+  0x02, 0x8e, 0xcb, 0x13, 0x24, 0xbf, 0x59, 0x6a, 0x21, 0xca, 0x76, 0xfe, 0xa8, 0x3b, 0x87, 0xff,
+  0x3b, 0x49, 0x31, 0x5e, 0x18, 0xed, 0xee, 0xee, 0xed, 0x4e, 0x05, 0xff, 0x2b, 0x11, 0xd3, 0x21,
+  0x02, 0x30, 0xab, 0x32, 0x02, 0x10, 0x26, 0x00, 0xc4, 0x04, 0x6a, 0x2a, 0xe7, 0xe5, 0x64, 0xaa,
+  0x00, 0xf3, 0x22, 0xfd, 0xff, 0x35, 0x36, 0x67, 0x31, 0x7d, 0x13, 0xc3, 0xd5, 0x42, 0x31, 0x27,
+  0xfe, 0xee, 0xe6, 0x67, 0xda, 0x29, 0x61, 0x11, 0x31, 0x8f, 0x3f, 0x32, 0x53, 0x34, 0xc6, 0x22,
+  0x7b, 0x68, 0x57, 0x45, 0xfc, 0x66, 0x68, 0x11, 0x0f, 0xd7, 0x16, 0xf9, 0x95, 0xf8, 0x20, 0x5a,
+  0x35, 0x53, 0x7f, 0xff, 0x8a, 0x62, 0xda, 0x23, 0xee, 0x51, 0x72, 0xb5, 0xa1, 0x10, 0x0c, 0x62,
+  0x08, 0x10, 0xf1, 0x01, 0xad, 0x61, 0x67, 0xfe, 0x94, 0x21, 0x58, 0x6d, 0xcf, 0xd7, 0x13, 0xfd,
+  0x11, 0x40, 0x9d, 0xbc, 0x20, 0xed, 0xe6, 0x30, 0xec, 0x06, 0x9f, 0x25, 0xcb, 0xae, 0xd6, 0x6d,
+  0x39, 0x4c, 0x11, 0xed, 0xcf, 0x9f, 0x15, 0x6a, 0x51, 0x85, 0x04, 0xec, 0xef, 0x0c, 0xed, 0xaa,
+  0xe3, 0x66, 0x54, 0x48, 0xcc, 0xa9, 0xfe, 0xdd, 0xba, 0xec, 0x2b, 0x61, 0xfe, 0xf5, 0x03, 0x28,
+  0x21, 0x2d, 0x02, 0xee, 0xd5, 0x0e, 0x7f, 0x4e, 0x22, 0xfb, 0xb3, 0xe3, 0x26, 0x23, 0x10, 0xf1,
+  0x21, 0xd2, 0x3b, 0x00, 0x6e, 0xaf, 0xf6, 0xfb, 0x7f, 0x31, 0xc5, 0x30, 0xdf, 0x45, 0x12, 0xea,
+  0x72, 0xaf, 0x01, 0x73, 0x37, 0x80, 0xff, 0xcf, 0xee, 0xbb, 0xb3, 0x24, 0x42, 0x21, 0x1e, 0x14,
+  0x35, 0x42, 0x78, 0x08, 0x34, 0xab, 0x15, 0x32, 0x43, 0x46, 0x13, 0x7b, 0x08, 0xce, 0x0f, 0x45,
+  0x65, 0xd2, 0x12, 0x44, 0x6c, 0xcc, 0x8e, 0xfe, 0xd0, 0x24, 0x9f, 0x35, 0xd2, 0x72, 0xae, 0xea,
+  0xdf, 0x95, 0x26, 0x75, 0x2c, 0xc3, 0xfe, 0xda, 0x46, 0xfb, 0x11, 0x50, 0x65, 0x00, 0x67, 0x21,
+  0xbc, 0xf7, 0x09, 0x32, 0xcf, 0xd2, 0x44, 0x20, 0xfb, 0x37, 0xf4, 0xac, 0x21, 0x01, 0x41, 0xd2,
+  0x75, 0x86, 0xac, 0x9c, 0x28, 0x2c, 0x43, 0xec, 0xfe, 0xee, 0xba, 0xc9, 0x32, 0x8f, 0x49, 0x31,
+  0xcf, 0x32, 0x41, 0x03, 0xf1, 0x61, 0xef, 0xea, 0x98, 0x88, 0x61, 0xf9, 0x02, 0x50, 0xcb, 0xee,
+  0xe3, 0x13, 0x46, 0x0d, 0x71, 0x63, 0x87, 0x35, 0x64, 0x47, 0xde, 0xde, 0xd6, 0x87, 0xe6, 0x40,
+  0x28, 0x01, 0x86, 0x50, 0xee, 0xad, 0x20, 0xdd, 0x80, 0xe7, 0x11, 0x03, 0x5b, 0x11, 0xe4, 0x3b,
+  0xdf, 0xce, 0x15, 0x65, 0xc5, 0x23, 0x7d, 0x13, 0x01, 0xf5, 0x10, 0xde, 0xbf, 0xeb, 0xfe, 0xee,
+  0xed, 0x34, 0xbc, 0x54, 0x25, 0x64, 0x01, 0xda, 0x29, 0x02, 0x10, 0x40, 0x24, 0x45, 0x0d, 0x47,
+  0xe0, 0x64, 0x47, 0x55, 0x6f, 0xee, 0xda, 0x10, 0x7d, 0x46, 0x68, 0x13, 0xff, 0xaa, 0x96, 0x17,
+  0x00, 0x0a, 0x54, 0x8a, 0x42, 0xb7, 0x12, 0x3a, 0x81, 0x98, 0x13, 0x67, 0x11, 0xbf, 0xc5, 0x30,
+  0xdd, 0x90, 0x1d, 0x20, 0x44, 0x50, 0x7f, 0x51, 0xca, 0x41, 0xee, 0x1f, 0x34, 0x7c, 0xcd, 0xfc,
+  0x15, 0x15, 0x72, 0x58, 0x1e, 0x02, 0x44, 0x10, 0x02, 0x00, 0xbd, 0xbf, 0x4e, 0x42, 0xb9, 0x09,
+  0x3d, 0x51, 0x37, 0x74, 0x09, 0x62, 0xfc, 0x02, 0xef, 0x15, 0x0e, 0x1f, 0xc3, 0x25, 0x8e, 0xa1,
+  0xf1, 0x1d, 0xb7, 0x2e, 0xfc, 0x52, 0xfe, 0xbf, 0xfc, 0xf8, 0xff, 0xde, 0xeb, 0xf1, 0x11, 0xe6,
+  0x10, 0x67, 0x51, 0x41, 0x23, 0xa9, 0x34, 0xff, 0x83, 0x40, 0xfd, 0x31, 0x22, 0x54, 0x72, 0x72,
+  0x70, 0x6a, 0x53, 0x50, 0xb5, 0xba, 0x34, 0x0d, 0x63, 0x5d, 0x05, 0xaf, 0x0b, 0xed, 0xcc, 0xc3,
+  0x07, 0x17, 0x0d, 0x27, 0x34, 0x87, 0x10, 0x27, 0x4b, 0x0b, 0xcc, 0x22, 0x74, 0x56, 0x78, 0x9f,
+  0x70, 0x4a, 0xfd, 0x62, 0x00, 0xee, 0x26, 0x23, 0xd9, 0x41, 0xfa, 0x27, 0xba, 0x22, 0xf5, 0x30,
+  0x28, 0x41, 0xff, 0x4f, 0x41, 0xdd, 0x23, 0xbe, 0x14, 0xfb, 0x13, 0x06, 0x08, 0xb4, 0x05, 0x38,
+  0x3f, 0xff, 0x32, 0xfe, 0xea, 0xc5, 0x00, 0x1d, 0x00, 0x07, 0x14, 0x8c, 0x20, 0x44, 0x50, 0x3e,
+  0x76, 0x71, 0x30, 0x3e, 0xef, 0x67, 0x11, 0x8c, 0x43, 0x4c, 0x14, 0x34, 0x27, 0xe7, 0x65, 0xfe,
+  0xdd, 0x78, 0xbb, 0xec, 0xbf, 0x40, 0x91, 0xe4, 0x78, 0x08, 0x00, 0x7b, 0x12, 0xce, 0x98, 0xfe,
+  0xcb, 0xbe, 0x5b, 0x44, 0x6a, 0x61, 0xca, 0x9e, 0xd1, 0x00, 0x77, 0x66, 0x32, 0x61, 0xaa, 0xe6,
+  0x40, 0xbd, 0x09, 0x45, 0xd4, 0x30, 0x44, 0x10, 0xbc, 0x6f, 0x31, 0x14, 0xb2, 0x4a, 0xf2, 0x00,
+  0x8e, 0x31, 0xcd, 0x5b, 0x1a, 0x14, 0x00, 0xfe, 0xdf, 0x13, 0x0d, 0xfa, 0x11, 0x43, 0x4d, 0xa4,
+  0x0f, 0x38, 0x30, 0xed, 0x50, 0x00, 0x58, 0x6d, 0x02, 0xbd, 0x32, 0x33, 0xed, 0xff, 0xe6, 0x67,
+  0x22, 0x42, 0x93, 0x40, 0x14, 0xcf, 0x12, 0x43, 0x24, 0x54, 0x1b, 0x43, 0x35, 0x69, 0x08, 0xf1,
+  0x07, 0x07, 0xef, 0xee, 0xfd, 0x5c, 0x40, 0x53, 0x13, 0x43, 0x1a, 0x5c, 0x10, 0xff, 0x1c, 0x34,
+  0x2c, 0x23, 0x71, 0x00, 0x35, 0x0c, 0x64, 0x31, 0x87, 0x42, 0xc4, 0x31, 0xdc, 0x01, 0x32, 0xbf,
+  0xfd, 0x34, 0xeb, 0xde, 0x34, 0x24, 0x2f, 0x40, 0xbe, 0xeb, 0x5f, 0x0d, 0x41, 0x1e, 0x62, 0x8f,
+  0x20, 0x44, 0xd0, 0x7f, 0x11, 0xfb, 0x72, 0x1e, 0xee, 0x67, 0xbf, 0x43, 0x79, 0x34, 0x2c, 0x30,
+  0xdf, 0xbd, 0x44, 0x10, 0x2c, 0x03, 0xb8, 0x40, 0x7f, 0xcc, 0xfd, 0xbf, 0xcc, 0xfc, 0x6d, 0x01,
+  0xce, 0xe0, 0xba, 0xdd, 0xdd, 0xfd, 0xdf, 0xbf, 0x1c, 0xc9, 0x55, 0xfe, 0x20, 0xf6, 0xef, 0xf3,
+  0x72, 0x02, 0x40, 0xcb, 0xa6, 0x0a, 0xac, 0x01, 0x2b, 0x21, 0x89, 0x20, 0xff, 0xc9, 0x05, 0x1c,
+  0x14, 0xe6, 0x70, 0x2b, 0x41, 0x84, 0x1e, 0xa1, 0x30, 0x6e, 0x00, 0xa5, 0x3e, 0xc2, 0xde, 0x77,
+  0x00, 0xae, 0xeb, 0xee, 0xbd, 0xfe, 0x00, 0xe0, 0x20, 0xdf, 0x17, 0x00, 0xfa, 0x21, 0x32, 0x00,
+  0x17, 0x00, 0xe6, 0x20, 0xfb, 0x29, 0x00, 0x26, 0x00, 0xd9, 0xbf, 0x10, 0xcd, 0xeb, 0xf3, 0x0e,
+  0x17, 0x20, 0xfc, 0x5d, 0x0b, 0xb3, 0x10, 0xc0, 0xcf, 0xfe, 0xde, 0xd4, 0x46, 0x33, 0xc9, 0x22,
+  0x48, 0x1b, 0xca, 0x43, 0xd5, 0x12, 0x33, 0x4e, 0x0b, 0x77, 0x88, 0x21, 0x1b, 0x2c, 0x00, 0xe9,
+  0x3b, 0x0f, 0xbd, 0xfb, 0x79, 0x27, 0xfd, 0x47, 0x10, 0xbc, 0x23, 0x44, 0x60, 0x6f, 0xe0, 0x16,
+  0x89, 0x10, 0xf4, 0x2a, 0x17, 0x10, 0xea, 0x80, 0x00, 0x26, 0x1f, 0xbe, 0xf7, 0xca, 0x27, 0xdf,
+  0x27, 0x89, 0x30, 0xee, 0x53, 0x3f, 0x2c, 0x20, 0x9c, 0x22, 0xa3, 0x11, 0xff, 0x5c, 0x30, 0xc5,
+  0x20, 0xa1, 0x20, 0x46, 0x31, 0x44, 0x20, 0xcf, 0x1e, 0x97, 0x0a, 0xe6, 0x60, 0x07, 0x44, 0x40,
+  0x68, 0x20, 0x62, 0x0f, 0xbe, 0xfd, 0xee, 0xec, 0xa9, 0xe1, 0x34, 0x24, 0xdc, 0xfc, 0xcb, 0x87,
+  0xc1, 0x0a, 0x13, 0x61, 0x5c, 0x00, 0xc3, 0x20, 0x00, 0xa1, 0x10, 0xce, 0xfe, 0xa9, 0x7f, 0x2e,
+  0xa7, 0xce, 0x0c, 0xff, 0x5c, 0x40, 0x23, 0x10, 0x71, 0x10, 0x1f, 0x11, 0x89, 0x10, 0xe6, 0x20,
+  0x2b, 0x21, 0x44, 0x30, 0xdf, 0xda, 0x20, 0x89, 0x10, 0xff, 0x32, 0x21, 0x02, 0xa6, 0x8a, 0xec,
+  0x1e, 0x35, 0x58, 0x11, 0x3f, 0x21, 0x42, 0xce, 0xa3, 0x43, 0x94, 0x1e, 0x25, 0x69, 0x32, 0x11,
+  0x0f, 0xfe, 0xdc, 0x17, 0x8c, 0x1f, 0xb6, 0x2c, 0x19, 0x27, 0x32, 0x1e, 0x0e, 0x6e, 0xfe, 0xee,
+  0xea, 0xde, 0x44, 0x60, 0xec, 0x34, 0x11, 0xfd, 0x94, 0x17, 0x43, 0x14, 0x74, 0x63, 0x6f, 0xf4,
+  0x11, 0x69, 0x52, 0x39, 0x55, 0x9d, 0x24, 0xeb, 0x98, 0x19, 0x9a, 0x01, 0xed, 0xff, 0x66, 0x12,
+  0x63, 0x65, 0x96, 0x42, 0xa1, 0x20, 0x44, 0x10, 0xc6, 0x35, 0x0c, 0x52, 0x43, 0x34, 0xfd, 0xa1,
+  0x60, 0xed, 0xcb, 0x06, 0x1e, 0x01, 0xc3, 0x32, 0xe6, 0x70, 0xdb, 0x02, 0x69, 0x42, 0x00, 0xef,
+  0xed, 0xdc, 0xa7, 0x6e, 0xba, 0xc9, 0x8e, 0x1a, 0xbb, 0x48, 0x18, 0xee, 0xe6, 0x90, 0x44, 0x60,
+  0xec, 0xfe, 0xea, 0x40, 0x88, 0xca, 0x8f, 0xcb, 0xfd, 0xcf, 0x6d, 0x21, 0xcb, 0xfc, 0x98, 0xfe,
+  0x93, 0x1b, 0x44, 0x90, 0xc1, 0x31, 0x9a, 0xc7, 0xf0, 0x92, 0x36, 0x08, 0xff, 0xad, 0x50, 0x06,
+  0xc8, 0x88, 0x21, 0x06, 0xc8, 0x9e, 0xb3, 0xc8, 0x50, 0x27, 0x12, 0x44, 0x40, 0x99, 0x43, 0x0a,
+  0xbb, 0xb2, 0x3a, 0x04, 0xcc, 0x02, 0x35, 0x32, 0x46, 0x14, 0xf0, 0x45, 0xcd, 0xde, 0xfe, 0xd6,
+  0x8a, 0x1c, 0x1d, 0x9c, 0x22, 0x58, 0x07, 0x7f, 0x44, 0xa0, 0x60, 0x22, 0x12, 0x02, 0xf1, 0xb4,
+  0xdc, 0x01, 0xfc, 0x05, 0x67, 0x01, 0xee, 0xff, 0x9b, 0x59, 0x2e, 0x94, 0xed, 0x12, 0xa1, 0x00,
+  0x62, 0x06, 0x4a, 0x40, 0x40, 0x67, 0x63, 0xbb, 0x1f, 0x3a, 0x01, 0xc4, 0x31, 0x60, 0xbe, 0xab,
+  0x35, 0x1a, 0x00, 0xcf, 0xfe, 0xec, 0x02, 0xbc, 0xd2, 0x02, 0xdb, 0xa7, 0x7f, 0xed, 0xfe, 0xcf,
+  0x07, 0xe6, 0x50, 0xa1, 0x00, 0x37, 0x71, 0xfc, 0xfe, 0xcf, 0xfe, 0xdc, 0x10, 0xbb, 0x88, 0xec,
+  0xce, 0x6a, 0x01, 0xdc, 0xeb, 0xad, 0xe4, 0xcc, 0xff, 0x89, 0x6c, 0xae, 0xdb, 0x2b, 0x81, 0x74,
+  0x80, 0x27, 0x58, 0xff, 0x44, 0x60, 0x0e, 0x10, 0xc9, 0x8e, 0xb0, 0x40, 0xf9, 0x32, 0x56, 0xdc,
+  0x82, 0x04, 0x94, 0x71, 0x0f, 0x2b, 0xa7, 0x87, 0x22, 0x2b, 0x4a, 0x1f, 0x02, 0xc8, 0x88, 0x44,
+  0x64, 0x80, 0x46, 0x66, 0x79, 0xaa, 0xee, 0xee, 0xfe, 0x1c, 0x9d, 0xfe, 0xff, 0xd2, 0x2b, 0x5d,
+  0x32, 0x4f, 0x81, 0xa1, 0x46, 0x44, 0x20, 0xed, 0x78, 0xf3, 0x58, 0xf2, 0xfe, 0xf6, 0x0f, 0xff,
+  0xff, 0xf1, 0xa1, 0xe6, 0x46, 0x11, 0x43, 0x25, 0x27, 0x7f, 0x21, 0x52, 0x32, 0xd9, 0xa1, 0x40,
+  0x09, 0x22, 0xea, 0xae, 0x44, 0x30, 0xcb, 0x36, 0xea, 0xf1, 0x32, 0x09, 0xdd, 0xce, 0xdd, 0x6b,
+  0x03, 0x7f, 0x81, 0xf8, 0x0c, 0x1e, 0x92, 0x01, 0xd7, 0x10, 0xdd, 0xca, 0x77, 0xa7, 0x69, 0x76,
+  0xee, 0xdf, 0x90, 0x6b, 0x2b, 0x31, 0xcd, 0x37, 0xd9, 0x71, 0xcd, 0x87, 0xbc, 0xc0, 0x72, 0x4d,
+  0x23, 0xbf, 0xfd, 0xa1, 0x3a, 0x61, 0x23, 0x60, 0x52, 0x61, 0x85, 0x34, 0x0a, 0xd1, 0xae, 0x26,
+  0x23, 0x21, 0x92, 0x73, 0xeb, 0xfe, 0xdf, 0xee, 0x84, 0x05, 0xfe, 0xee, 0xff, 0xd7, 0x1f, 0xbd,
+  0x58, 0x56, 0x10, 0xcf, 0x3b, 0xc4, 0x11, 0x44, 0x70, 0x0d, 0x74, 0x44, 0x90, 0xed, 0x32, 0x60,
+  0xfe, 0x6c, 0x08, 0x67, 0x01, 0xef, 0x83, 0x7f, 0x5f, 0x46, 0x3a, 0x21, 0xff, 0xc8, 0x36, 0x89,
+  0x7c, 0x7f, 0x31, 0xf1, 0x41, 0xd4, 0x80, 0xc4, 0x21, 0x3e, 0xec, 0x7f, 0x21, 0x7b, 0x02, 0x19,
+  0xd0, 0x54, 0xef, 0x39, 0x3e, 0x44, 0x40, 0x29, 0x80, 0xfd, 0x2a, 0xbe, 0xf2, 0xec, 0xeb, 0x0d,
+  0xef, 0xef, 0x8d, 0x06, 0xf8, 0x7f, 0xa5, 0x5e, 0xbd, 0xeb, 0x0f, 0x2b, 0xa1, 0x91, 0x2d, 0x5a,
+  0xa2, 0xa2, 0x62, 0xfb, 0xef, 0xed, 0xfd, 0xff, 0xd0, 0x61, 0x22, 0x74, 0xbb, 0x01, 0xc5, 0x20,
+  0xa9, 0xcd, 0x44, 0x50, 0x9f, 0xcb, 0xac, 0x21, 0x9f, 0x11, 0x70, 0xf8, 0x2c, 0x13, 0x0d, 0x44,
+  0x50, 0x2f, 0x00, 0xff, 0xcf, 0xda, 0x40, 0xff, 0x98, 0x40, 0xeb, 0x5d, 0x02, 0x73, 0xb4, 0x3e,
+  0xb1, 0x62, 0xa1, 0x80, 0xd6, 0x34, 0x6c, 0x22, 0xfe, 0xfc, 0xd2, 0x75, 0x44, 0x10, 0xc8, 0xdc,
+  0x55, 0x1d, 0xe6, 0xe0, 0x22, 0x41, 0xf1, 0x51, 0xff, 0xaf, 0x31, 0x70, 0x5a, 0xfc, 0xc2, 0xf3,
+  0x48, 0x2b, 0x81, 0x70, 0x8d, 0x93, 0x22, 0x3f, 0x4e, 0x67, 0xbd, 0x9e, 0xe6, 0x70, 0x02, 0x10,
+  0xce, 0xbc, 0xcd, 0x04, 0x0b, 0x30, 0xe9, 0xfd, 0x26, 0x60, 0xff, 0x7d, 0x06, 0x12, 0x15, 0x38,
+  0x90, 0xe7, 0x32, 0x53, 0x19, 0x20, 0x20, 0x7f, 0x1f, 0x41, 0x1d, 0x30, 0x00, 0x02, 0x12, 0xb5,
+  0xc5, 0x63, 0xd3, 0x9a, 0xc5, 0x2f, 0xdf, 0xfe, 0xeb, 0x00, 0x15, 0x80, 0x40, 0x27, 0x22, 0x47,
+  0x50, 0x98, 0x00, 0x44, 0xa0, 0xe4, 0x2b, 0xfd, 0x32, 0x10, 0xee, 0x67, 0x01, 0x59, 0xa3, 0x22,
+  0x41, 0xf1, 0x31, 0x1f, 0x71, 0x3b, 0x10, 0xff, 0xdd, 0x10, 0xf1, 0x81, 0xe0, 0x8f, 0xfc, 0x22,
+  0x56, 0x50, 0x41, 0x8c, 0xff, 0xde, 0x35, 0x10, 0x18, 0xac, 0xec, 0xcf, 0x83, 0xb6, 0xc3, 0x2b,
+  0xfd, 0xdf, 0xbc, 0xff, 0x4b, 0x15, 0xe6, 0xf0, 0xcf, 0x02, 0xe6, 0x80, 0x6d, 0x0d, 0x3b, 0x20,
+  0xac, 0x01, 0x5d, 0x88, 0xc7, 0xa3, 0x31, 0x87, 0x95, 0x21, 0x22, 0xfd, 0xff, 0xfd, 0x1f, 0x94,
+  0x68, 0x56, 0xf9, 0xc5, 0x00, 0xbe, 0xeb, 0x66, 0x25, 0x67, 0x21, 0xad, 0x30, 0x68, 0x36, 0x64,
+  0xa4, 0xff, 0x72, 0x35, 0x80, 0x10, 0xcc, 0x65, 0x10, 0x21, 0x50, 0x06, 0x97, 0x2a, 0x53, 0x2c,
+  0x11, 0x30, 0xff, 0xcf, 0xa2, 0x2d, 0xd2, 0xf0, 0x02, 0xce, 0x03, 0x72, 0x0b, 0xc2, 0x60, 0x94,
+  0x87, 0x8a, 0x22, 0xfb, 0x87, 0x92, 0xcf, 0x42, 0xbe, 0xd7, 0x43, 0x55, 0x71, 0x08, 0x2c, 0x8a,
+  0xf2, 0xf1, 0x21, 0xff, 0xe6, 0x70, 0x3c, 0x02, 0xe0, 0x4f, 0xcf, 0x12, 0x64, 0xc4, 0x13, 0x21,
+  0xa0, 0x0a, 0xc4, 0x71, 0xff, 0x8c, 0x30, 0x39, 0x0b, 0x2c, 0x19, 0x7c, 0xd1, 0xac, 0x31, 0x59,
+  0x23, 0x6b, 0x30, 0x23, 0x00, 0xbd, 0xa3, 0xb1, 0xea, 0x75, 0x22, 0x5a, 0x15, 0xf2, 0x83, 0xe0,
+  0x40, 0xed, 0x80, 0x00, 0xff, 0xd9, 0x21, 0xc8, 0xc3, 0x84, 0xf8, 0x37, 0x44, 0x45, 0x22, 0xc5,
+  0x40, 0x10, 0x31, 0x0b, 0x00, 0xff, 0x0a, 0x01, 0xdd, 0x20, 0x46, 0x44, 0x15, 0x98, 0xf2, 0xe3,
+  0x23, 0x10, 0x37, 0x14, 0x1c, 0x81, 0x7b, 0x1a, 0x30, 0x89, 0x00, 0xbc, 0x4f, 0x2d, 0xf0, 0x0e,
+  0x67, 0x81, 0x44, 0xc0, 0xfe, 0xdf, 0x20, 0x33, 0xf1, 0x01, 0x8a, 0xf2, 0x86, 0x66, 0xb3, 0x73,
+  0xdb, 0xfc, 0x45, 0x6e, 0xa6, 0xf9, 0x3a, 0x84, 0xee, 0xfd, 0x71, 0x93, 0x37, 0x74, 0x2b, 0x51,
+  0xfc, 0x95, 0xf1, 0x11, 0xcf, 0x37, 0x84, 0x5e, 0x2d, 0x22, 0x47, 0x0d, 0x61, 0xff, 0xde, 0xc1,
+  0x1d, 0xe7, 0x42, 0xfe, 0x9f, 0x83, 0x73, 0x15, 0x02, 0x08, 0x06, 0x1f, 0x21, 0x18, 0x82, 0xc5,
+  0x20, 0xbb, 0x71, 0xff, 0xe4, 0x52, 0x65, 0x36, 0x15, 0x65, 0x3e, 0x4f, 0x44, 0x00, 0xa0, 0x17,
+  0x22, 0x01, 0xf4, 0x44, 0x7d, 0x35, 0x20, 0xd9, 0x07, 0x97, 0x0e, 0x10, 0x71, 0x40, 0x23, 0x00,
+  0xc1, 0x04, 0xff, 0xbc, 0xff, 0xde, 0xf2, 0x80, 0x5f, 0x20, 0x11, 0x39, 0x6f, 0x58, 0xfc, 0x67,
+  0x01, 0xdf, 0xe3, 0x30, 0x7d, 0x26, 0x0a, 0x94, 0xc7, 0x21, 0xf1, 0x21, 0xce, 0xd9, 0xb4, 0xa9,
+  0x24, 0xbf, 0xd3, 0xea, 0xac, 0x61, 0xe7, 0x62, 0x6e, 0x10, 0x19, 0x31, 0x89, 0x00, 0xfe, 0x8e,
+  0x5a, 0xff, 0x4a, 0x50, 0xfb, 0x0f, 0xf1, 0x21, 0xe6, 0x40, 0xfb, 0x40, 0x44, 0x20, 0xe6, 0x20,
+  0x2c, 0x60, 0xac, 0xcf, 0xbb, 0x2a, 0xa8, 0x12, 0x38, 0xef, 0x7c, 0x01, 0xbb, 0x00, 0xf2, 0xfc,
+  0xda, 0xcf, 0x6b, 0x00, 0x67, 0x21, 0x3f, 0x62, 0x15, 0x62, 0xbb, 0x91, 0xe0, 0x10, 0xdb, 0x1f,
+  0x04, 0x80, 0x20, 0xcf, 0xdd, 0x10, 0xa7, 0x20, 0xcf, 0x35, 0x40, 0xe5, 0x04, 0xef, 0xdd, 0x20,
+  0xb0, 0x3f, 0xfa, 0x67, 0x0a, 0x11, 0xbf, 0xa4, 0x7c, 0x17, 0x30, 0x67, 0x11, 0xfd, 0xd9, 0x01,
+  0xef, 0xa2, 0x52, 0x1d, 0x60, 0x92, 0x3c, 0x45, 0x22, 0xcf, 0x82, 0xd7, 0x39, 0xb5, 0x22, 0x21,
+  0xfe, 0xf2, 0x10, 0xec, 0x1a, 0x30, 0xa9, 0x04, 0xbf, 0xc4, 0x11, 0xbf, 0x8e, 0x74, 0xa1, 0x33,
+  0x7a, 0x39, 0x09, 0x62, 0x5c, 0x40, 0x36, 0x32, 0xcc, 0x09, 0x02, 0xc9, 0xd7, 0xa6, 0xfd, 0xae,
+  0xf9, 0x18, 0xef, 0xee, 0x34, 0x94, 0xf1, 0x71, 0xdf, 0x2b, 0x21, 0xb6, 0xa9, 0x44, 0x10, 0x06,
+  0x88, 0x1f, 0x01, 0xcf, 0x4b, 0x2b, 0x45, 0x02, 0xb7, 0xbb, 0x37, 0x63, 0x02, 0xe8, 0x01, 0xce,
+  0x45, 0x0e, 0x9f, 0xd5, 0xea, 0xfc, 0x28, 0xef, 0x67, 0x01, 0xec, 0x63, 0x6e, 0x20, 0x67, 0x11,
+  0xeb, 0x1c, 0x6a, 0x98, 0x00, 0xba, 0x22, 0xed, 0x2b, 0x3d, 0xeb, 0xc5, 0xf0, 0x22, 0x01, 0xce,
+  0x14, 0x0f, 0x9c, 0x25, 0x0f, 0x35, 0xdf, 0xdd, 0x60, 0xb7, 0x0e, 0xd9, 0xb1, 0xc4, 0x04, 0x0f,
+  0x1e, 0xee, 0x26, 0x60, 0x8c, 0x50, 0xf9, 0x44, 0x20, 0xfb, 0xed, 0x5c, 0x10, 0x1b, 0x12, 0x67,
+  0x61, 0xd6, 0x07, 0xf1, 0x81, 0xff, 0xda, 0x46, 0x7a, 0x2c, 0x62, 0x0f, 0x22, 0xe1, 0xe6, 0x00,
+  0xe2, 0x0a, 0xc1, 0xb1, 0x59, 0x23, 0xe7, 0xa9, 0x67, 0x4e, 0xa2, 0xf0, 0x0e, 0xff, 0xee, 0x51,
+  0x7e, 0x67, 0x61, 0x44, 0x10, 0xff, 0xe6, 0x70, 0x07, 0x47, 0x61, 0x6a, 0x83, 0xbc, 0x0c, 0x55,
+  0xab, 0xc2, 0x23, 0x93, 0x39, 0x22, 0xff, 0x34, 0xd4, 0xf4, 0xc1, 0x26, 0x70, 0xdf, 0xc1, 0xcb,
+  0x90, 0x16, 0x67, 0x6b, 0x60, 0x29, 0x40, 0xff, 0x49, 0xea, 0x5f, 0x33, 0xb6, 0x49, 0x4f, 0x64,
+  0x8b, 0xe1, 0xd7, 0x79, 0x89, 0xb0, 0x9a, 0x74, 0xff, 0x8c, 0xf0, 0xfe, 0xe0, 0x5c, 0x90, 0x61,
+  0xd4, 0x5f, 0x63, 0xb0, 0x30, 0x74, 0x83, 0xca, 0x11, 0xf7, 0x31, 0xe1, 0x5f, 0xf0, 0x11, 0x90,
+  0xfb, 0x5c, 0x0c, 0xc8, 0x63, 0x74, 0x76, 0x81, 0x02, 0xdc, 0xbd, 0xea, 0xf4, 0x01, 0xdb, 0x38,
+  0x89, 0x69, 0xee, 0x17, 0x00, 0xfb, 0xd6, 0xdf, 0x1f, 0x34, 0xc0, 0x25, 0x81, 0xa2, 0xcb, 0x0c,
+  0x44, 0x00, 0xeb, 0xf6, 0x9e, 0x4d, 0x20, 0x32, 0xfc, 0x24, 0x02, 0xde, 0xae, 0x2b, 0xc4, 0x5e,
+  0x0a, 0xea, 0xee, 0xd6, 0xad, 0x5c, 0x30, 0x28, 0x31, 0xec, 0xf3, 0x62, 0xee, 0x89, 0x00, 0x6e,
+  0xfc, 0x9c, 0xae, 0xeb, 0xa1, 0x00, 0xd7, 0xc0, 0x7e, 0x15, 0xae, 0xfc, 0xd1, 0x20, 0xf7, 0x3e,
+  0x50, 0x89, 0x40, 0xe3, 0x0f, 0xfa, 0x7b, 0x98, 0xe6, 0xc0, 0x5e, 0xc1, 0xe6, 0xf0, 0x3f, 0x7e,
+  0x45, 0xb9, 0x00, 0x09, 0x82, 0x44, 0x80, 0xe6, 0x90, 0x41, 0x43, 0xee, 0xae, 0x31, 0x7f, 0x9d,
+  0xeb, 0xef, 0xed, 0x67, 0xf7, 0xd9, 0x47, 0xde, 0xbf, 0x66, 0xeb, 0x67, 0x51, 0x20, 0x40, 0xee,
+  0xab, 0x57, 0x2e, 0xac, 0xd1, 0xeb, 0xff, 0x2c, 0x06, 0x5b, 0x04, 0x3a, 0x91, 0xee, 0x4a, 0x09,
+  0x45, 0xda, 0x50, 0x44, 0x09, 0xa0, 0x04, 0xff, 0xc4, 0x14, 0x36, 0x18, 0x71, 0xa0, 0x56, 0x1c,
+  0xa8, 0x5b, 0x2b, 0x77, 0x44, 0x40, 0xe5, 0x04, 0xff, 0x52, 0xc1, 0xce, 0x16, 0x89, 0x80, 0x62,
+  0x60, 0x5b, 0x04, 0xe5, 0x34, 0x02, 0xbc, 0x44, 0x30, 0xe3, 0x3a, 0xd1, 0x44, 0x00, 0xdf, 0xde,
+  0xfd, 0xc4, 0x21, 0x1a, 0xa0, 0x44, 0x00, 0xff, 0x35, 0xc6, 0xb5, 0x27, 0x44, 0x70, 0x16, 0x41,
+  0x57, 0x32, 0x13, 0x97, 0xe5, 0xb4, 0xdd, 0x80, 0xfd, 0x21, 0x15, 0xce, 0x17, 0xa3, 0xe6, 0x66,
+  0xb6, 0x66, 0x00, 0x1b, 0xdd, 0x70, 0x91, 0x2d, 0x7f, 0x45, 0xb2, 0x42, 0x02, 0x67, 0x01, 0x42,
+  0xa2, 0x85, 0x17, 0x44, 0x40, 0xf6, 0x82, 0xbf, 0xef, 0x6e, 0x13, 0x44, 0x30, 0x9c, 0x82, 0xe3,
+  0x40, 0xdf, 0x9d, 0x17, 0xc5, 0x50, 0xc3, 0x85, 0x2f, 0xce, 0x06, 0x35, 0x86, 0x2f, 0x40, 0x70,
+  0x17, 0xcc, 0x09, 0xf5, 0xea, 0xde, 0xf8, 0xbb, 0xfb, 0xef, 0xcf, 0x12, 0x95, 0x1f, 0xce, 0x86,
+  0xe6, 0x00, 0x05, 0x79, 0xff, 0x17, 0x70, 0x02, 0x0f, 0x94, 0x11, 0x70, 0xc7, 0x36, 0x28, 0x7b,
+  0x32, 0x77, 0x59, 0x44, 0xc0, 0xff, 0x00, 0x35, 0xd2, 0x42, 0xe6, 0x30, 0x6e, 0xc3, 0x7b, 0x02,
+  0x67, 0x11, 0x3e, 0x70, 0xba, 0x05, 0xff, 0x38, 0xb3, 0xd2, 0x25, 0xbb, 0x01, 0xd0, 0x01, 0x4d,
+  0x40, 0x13, 0x81, 0x44, 0x06, 0x29, 0x59, 0xef, 0x1e, 0x75, 0x26, 0x00, 0x67, 0x11, 0x4b, 0xfb,
+  0xea, 0x44, 0x00, 0x5c, 0x90, 0xc4, 0x71, 0x7f, 0x95, 0xf3, 0xc4, 0x21, 0xc5, 0x50, 0x7b, 0x75,
+  0x43, 0x37, 0x8a, 0xa5, 0xd6, 0x6d, 0xbe, 0xfb, 0x7c, 0xc4, 0x44, 0x40, 0xef, 0x6c, 0x22, 0x7f,
+  0x81, 0x5d, 0x42, 0x89, 0x20, 0x29, 0x60, 0xff, 0x63, 0x3b, 0xe6, 0x26, 0x2c, 0xa0, 0x62, 0x20,
+  0xe6, 0x00, 0xa1, 0xf0, 0x44, 0x30, 0xfc, 0x42, 0xff, 0x81, 0x02, 0x84, 0x22, 0x0e, 0x00, 0xe6,
+  0x10, 0xb3, 0xbc, 0xa1, 0x10, 0x8f, 0x1c, 0x28, 0x91, 0xff, 0x8b, 0x04, 0x05, 0xf6, 0x17, 0x30,
+  0x22, 0xf7, 0x2d, 0x15, 0x9e, 0xa6, 0xb6, 0x1f, 0x44, 0x33, 0xff, 0xf3, 0x32, 0x25, 0xc7, 0x5c,
+  0x50, 0x7f, 0xd1, 0xef, 0xf3, 0x17, 0x30, 0x4c, 0xb4, 0xdc, 0x57, 0xfa, 0xae, 0xeb, 0x3d, 0xea,
+  0xa9, 0x8a, 0x37, 0x1a, 0xe4, 0xa2, 0xd3, 0x0a, 0xb7, 0x55, 0xce, 0xee, 0xc7, 0x2d, 0xb6, 0x50,
+  0xe9, 0x46, 0xee, 0xae, 0xb6, 0xf6, 0xac, 0x14, 0x9f, 0x18, 0x55, 0x3e, 0x50, 0x4b, 0x5e, 0x7b,
+  0xa2, 0x4e, 0x5b, 0xfe, 0xad, 0xad, 0x70, 0xfb, 0x1e, 0x58, 0xf6, 0x12, 0xee, 0xbc, 0x29, 0x3e,
+  0x60, 0x4a, 0x20, 0x85, 0x11, 0x14, 0x90, 0xff, 0x02, 0xb0, 0xe0, 0xbf, 0xeb, 0x9a, 0x02, 0xf0,
+  0x32, 0x50, 0xe2, 0xbd, 0xda, 0x70, 0x21, 0xa2, 0xff, 0x91, 0x21, 0xb6, 0xf6, 0x83, 0x20, 0x2f,
+  0x10, 0x3c, 0xf8, 0x95, 0xf0, 0x20, 0x80, 0x74, 0x00, 0xff, 0xa6, 0x64, 0xa1, 0xf0, 0xf5, 0x29,
+  0x1d, 0xf0, 0x94, 0x71, 0x14, 0x20, 0x05, 0x20, 0x01, 0x94, 0xff, 0x2f, 0xe0, 0x56, 0xf9, 0xa1,
+  0x90, 0x89, 0x49, 0x98, 0xc0, 0x16, 0x91, 0x7a, 0xf0, 0x79, 0x81, 0xf9, 0xbc, 0x79, 0xfe, 0xbf,
+  0x1d, 0x79, 0xd3, 0x61, 0xfe, 0xe0, 0x7c, 0x27, 0xcc, 0x72, 0xff, 0x02, 0xf0, 0x34, 0xf1, 0x11,
+  0xf0, 0x26, 0xf0, 0x56, 0x3c, 0xf0, 0xee, 0x49, 0xf1, 0xa6, 0xb1, 0xfd, 0x21, 0x42, 0xcf, 0x37,
+  0x31, 0xe2, 0x94, 0xce, 0x56, 0xb5, 0xd1, 0x50, 0x59, 0x5c, 0xff, 0xdf, 0x02, 0xf0, 0x9e, 0xa0,
+  0x60, 0x22, 0x4a, 0x96, 0x8e, 0xc1, 0xbf, 0x67, 0x01, 0x09, 0x8b, 0xff, 0xda, 0x23, 0x8b, 0xb1,
+  0x68, 0x23, 0x3b, 0xf0, 0x17, 0x80, 0xfd, 0x94, 0x5a, 0x12, 0x1f, 0xa4, 0xff, 0x50, 0x70, 0x5e,
+  0x3d, 0xea, 0xf2, 0x17, 0x80, 0x37, 0xa4, 0x58, 0x7a, 0x02, 0x80, 0x2c, 0x20, 0xef, 0x95, 0x6f,
+  0x4b, 0x72, 0xc1, 0xea, 0x32, 0x23, 0xae, 0x25, 0xf1, 0xce, 0xf0, 0x77, 0x70, 0xfe, 0xed, 0x69,
+  0x65, 0xfc, 0x9b, 0x44, 0x90, 0xf5, 0x43, 0xd4, 0x20, 0x5c, 0xd0, 0x38, 0x20, 0xde, 0xcf, 0x5c,
+  0x10, 0xe7, 0x9b, 0xa4, 0x60, 0x80, 0xa0, 0xad, 0xc3, 0xb5, 0x59, 0x50, 0xb7, 0xaa, 0x56, 0x28,
+  0xb1, 0xe2, 0x0a, 0xbf, 0x8c, 0x86, 0x44, 0x60, 0xac, 0xef, 0x46, 0xff, 0xf6, 0x22, 0x44, 0x70,
+  0x85, 0x3a, 0x45, 0x62, 0xe4, 0x7e, 0xe1, 0xd8, 0xfd, 0x34, 0x34, 0xc7, 0x9f, 0x80, 0x40, 0xb5,
+  0x0a, 0xbf, 0x50, 0xcb, 0x60, 0xe0, 0x10, 0xef, 0xde, 0xd7, 0xf3, 0xcf, 0x42, 0x18, 0x44, 0x80,
+  0xea, 0x32, 0x05, 0x10, 0xee, 0xad, 0x34, 0x67, 0x01, 0xa4, 0xfe, 0xcf, 0xbb, 0x0a, 0x69, 0x45,
+  0x16, 0x41, 0x4c, 0x2a, 0xe6, 0x10, 0xeb, 0x84, 0x1a, 0x16, 0x78, 0xff, 0xcf, 0xea, 0xcb, 0x0f,
+  0x41, 0x26, 0xf9, 0x82, 0x92, 0x09, 0xcf, 0xff, 0x2b, 0xb1, 0xa2, 0x65, 0xb6, 0x40, 0xb3, 0x50,
+  0xdb, 0x65, 0xc3, 0x75, 0x11, 0x10, 0xad, 0xb0, 0xff, 0xd1, 0x50, 0xc2, 0xe6, 0x3a, 0x61, 0x42,
+  0xf2, 0x44, 0x10, 0x17, 0xf0, 0xe4, 0x2e, 0x44, 0x50, 0xff, 0xc9, 0xb5, 0x65, 0x86, 0xaf, 0x21,
+  0x4c, 0x01, 0xc2, 0x29, 0x44, 0x10, 0xd4, 0xc3, 0x81, 0x62, 0x1f, 0x18, 0xe5, 0x4c, 0xa7, 0x35,
+  0x70, 0x44, 0x20, 0x72, 0xf5, 0xda, 0xee, 0xbf, 0x3e, 0xea, 0x8b, 0x7d, 0x5b, 0x11, 0x92, 0x20,
+  0x07, 0xb7, 0xb6, 0x53, 0xfd, 0xff, 0xfe, 0xce, 0xce, 0xf0, 0x2c, 0xd3, 0x29, 0x99, 0x28, 0xe4,
+  0x18, 0xf2, 0xbf, 0xf3, 0x02, 0xf0, 0xff, 0x78, 0xd2, 0x34, 0xc4, 0x29, 0xf0, 0x5c, 0xf0, 0x1a,
+  0x23, 0xe6, 0xf6, 0x39, 0x65, 0x40, 0xed, 0xff, 0x0f, 0x42, 0xb0, 0x43, 0xda, 0xb3, 0x4c, 0xc7,
+  0xca, 0xd4, 0x41, 0xb0, 0xab, 0x12, 0x2c, 0x40, 0xff, 0xa5, 0x2e, 0x50, 0x20, 0xb3, 0xf0, 0x02,
+  0x70, 0x2e, 0xf7, 0x02, 0xf0, 0x02, 0xf0, 0x2f, 0xf0, 0xff, 0xe2, 0x64, 0x23, 0xf0, 0x10, 0x51,
+  0x11, 0xf0, 0x2c, 0xf0, 0x14, 0x60, 0x8d, 0x42, 0xe9, 0xb9, 0xf7, 0x5f, 0x30, 0xe8, 0x37, 0xaf,
+  0x94, 0xd9, 0x9a, 0xf1, 0x09, 0x28, 0x23, 0x10, 0xdc, 0xda, 0xfd, 0x02, 0x10, 0xec, 0x0b, 0x69,
+  0x0d, 0x97, 0x02, 0xf0, 0x2d, 0xf2, 0xfb, 0xf0, 0x0a, 0x67, 0xff, 0xd6, 0x51, 0x3d, 0xf7, 0x67,
+  0x21, 0xf6, 0x32, 0x4f, 0x54, 0xa6, 0xc7, 0xb8, 0x37, 0x32, 0x50, 0x01, 0x08, 0x30, 0xda,
+};
+
+constexpr rawdisp::AssetDesc rgb444_be_240x240_lz77_desc = {
+  .width = 240,
+  .height = 240,
+  .format = rawdisp::AssetFormat::RGB444,
+  .numPlanes = 1,
+  .planes = {
+    {
+      .id = "color",
+      .data = rgb444_be_240x240_lz77,
+      .size = sizeof(rgb444_be_240x240_lz77),
+      .compression = rawdisp::Compression::LZ77,
+      .layout = {
+        .type = rawdisp::PlaneType::DIRECT,
+        .matchIndex = 0,
+        .flags = 0x23,
+        .packUnit = rawdisp::PackUnit::ALIGNMENT,
+        .pixelStride = 12,
+        .pixelsPerFrag = 2,
+        .bytesPerFrag = 3,
+      },
+      .stride = 360,
+    },
+  },
+  .palette = nullptr,
+  .paletteColors = 0,
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/pixel_format.hpp"
+#include "rawdisp/rawdisp_common.hpp"
+
+namespace rawdisp {
+
+// Alpha blending of ARGB8888 sources onto RGB565 and RGB444 rows, integer
+// only. Sources are little endian 0xAARRGGBB words (bytes B, G, R, A) as
+// the ARGB8888-LE preset emits. Destination channels are spread apart in
+// a 32-bit word with room for the product, so one multiply scales all
+// the channels of a word. Alpha is reduced to 2^ALPHA_BITS levels.
+template <PixelFormat F>
+struct BlendTraits;
+
+// Blends channels spread apart in s and d by al / 2^AB. MASK has the bits
+// of every channel.
+template <int AB, uint32_t MASK, bool PREMULTIPLIED>
+static RAWDISP_INLINE uint32_t mixLanes(uint32_t s, uint32_t d, uint32_t al) {
+  constexpr uint32_t FULL = 1u << AB;
+  // half an LSB in every channel
+  constexpr uint32_t ROUND = (MASK & ~(MASK << 1)) << (AB - 1);
+  if (PREMULTIPLIED) return s + (((d * (FULL - al) + ROUND) >> AB) & MASK);
+  return ((s * al + d * (FULL - al) + ROUND) >> AB) & MASK;
+}
+
+template <>
+struct BlendTraits<PixelFormat::RGB565> {
+  static constexpr int ALPHA_BITS = 6;
+  static constexpr int PAIR_BYTES = 4;
+
+  static RAWDISP_INLINE uint32_t fromArgb(uint32_t w) {
+    return ((w >> 8) & 0xF800) | ((w >> 5) & 0x07E0) | ((w >> 3) & 0x001F);
+  }
+
+  // R and B share a word and G takes another, three channels scaled by
+  // 6 bits of alpha need more than 32 bits
+  template <bool PREMULTIPLIED>
+  static RAWDISP_INLINE uint32_t mix(uint32_t s, uint32_t d, uint32_t al) {
+    uint32_t rb = mixLanes<ALPHA_BITS, 0x001F001F, PREMULTIPLIED>(
+        spreadRb(s), spreadRb(d), al);
+    uint32_t g = mixLanes<ALPHA_BITS, 0x3F, PREMULTIPLIED>(
+        (s >> 5) & 0x3F, (d >> 5) & 0x3F, al);
+    return ((rb >> 5) & 0xF800) | (g << 5) | (rb & 0x001F);
+  }
+  // -----------RRRRR-----------BBBBB
+  static RAWDISP_INLINE uint32_t spreadRb(uint32_t c) {
+    return ((c & 0xF800) << 5) | (c & 0x001F);
+  }
+
+  // one big endian word holds the pair
+  static RAWDISP_INLINE void loadPair(const uint8_t *p, uint32_t *c0,
+                                      uint32_t *c1) {
+    uint32_t w = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+                 ((uint32_t)p[2] << 8) | p[3];
+    *c0 = w >> 16;
+    *c1 = w & 0xFFFF;
+  }
+  static RAWDISP_INLINE void storePair(uint8_t *p, uint32_t c0, uint32_t c1) {
+    uint32_t w = (c0 << 16) | c1;
+    p[0] = w >> 24;
+    p[1] = w >> 16;
+    p[2] = w >> 8;
+    p[3] = w;
+  }
+  static RAWDISP_INLINE uint32_t loadFirst(const uint8_t *p) {
+    return ((uint32_t)p[0] << 8) | p[1];
+  }
+  static RAWDISP_INLINE void storeFirst(uint8_t *p, uint32_t c) {
+    p[0] = c >> 8;
+    p[1] = c;
+  }
+};
+
+template <>
+struct BlendTraits<PixelFormat::RGB444> {
+  static constexpr int ALPHA_BITS = 4;
+  static constexpr int PAIR_BYTES = 3;
+
+  static RAWDISP_INLINE uint32_t fromArgb(uint32_t w) {
+    return ((w >> 12) & 0xF00) | ((w >> 8) & 0x0F0) | ((w >> 4) & 0x00F);
+  }
+
+  // all three channels in one word: ----RRRR----GGGG----BBBB
+  template <bool PREMULTIPLIED>
+  static RAWDISP_INLINE uint32_t mix(uint32_t s, uint32_t d, uint32_t al) {
+    uint32_t x = mixLanes<ALPHA_BITS, 0x000F0F0F, PREMULTIPLIED>(
+        spread(s), spread(d), al);
+    return ((x >> 8) & 0xF00) | ((x >> 4) & 0x0F0) | (x & 0x00F);
+  }
+  static RAWDISP_INLINE uint32_t spread(uint32_t c) {
+    return ((c & 0xF00) << 8) | ((c & 0x0F0) << 4) | (c & 0x00F);
+  }
+
+  // the pair is one 3 byte unit
+  static RAWDISP_INLINE void loadPair(const uint8_t *p, uint32_t *c0,
+                                      uint32_t *c1) {
+    uint32_t w = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    *c0 = w >> 12;
+    *c1 = w & 0xFFF;
+  }
+  static RAWDISP_INLINE void storePair(uint8_t *p, uint32_t c0, uint32_t c1) {
+    uint32_t w = (c0 << 12) | c1;
+    p[0] = w >> 16;
+    p[1] = w >> 8;
+    p[2] = w;
+  }
+  static RAWDISP_INLINE uint32_t loadFirst(const uint8_t *p) {
+    return ((uint32_t)p[0] << 4) | (p[1] >> 4);
+  }
+  static RAWDISP_INLINE void storeFirst(uint8_t *p, uint32_t c) {
+    p[0] = c >> 4;
+    p[1] = (p[1] & 0x0F) | ((c << 4) & 0xF0);
+  }
+};
+
+// Blends one source pixel onto a destination pixel value of F.
+template <PixelFormat F, bool PREMULTIPLIED>
+static RAWDISP_INLINE uint32_t blendArgbPixel(uint32_t argb, uint32_t dst) {
+  using B = BlendTraits<F>;
+  // ceil(a * 2^ALPHA_BITS / 255), rounding up keeps a premultiplied sum
+  // from overflowing into the next channel
+  uint32_t a = argb >> 24;
+  uint32_t al = (((a * 257) << B::ALPHA_BITS) + 65535) >> 16;
+  return B::template mix<PREMULTIPLIED>(B::fromArgb(argb), dst, al);
+}
+
+static RAWDISP_INLINE uint32_t readArgb(const uint8_t *p, bool aligned) {
+  if (aligned) return readWordLe(p);
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+// Blends `numPixels` ARGB8888 pixels onto a row of F in place, the row
+// starting on a unit boundary. Pixels are taken in pairs: a pair that is
+// fully transparent leaves the destination untouched, a fully opaque
+// one is converted without reading the destination. With PREMULTIPLIED
+// the source color is already scaled by alpha, and only all-zero pixels
+// count as transparent.
+template <PixelFormat F, bool PREMULTIPLIED = false>
+static inline void blendArgb8888(const uint8_t *src, uint8_t *dst,
+                                 int numPixels) {
+  using B = BlendTraits<F>;
+  const bool aligned = isWordAligned(src);
+  int i = 0;
+  for (; i + 2 <= numPixels; i += 2, src += 8, dst += B::PAIR_BYTES) {
+    uint32_t s0 = readArgb(src, aligned);
+    uint32_t s1 = readArgb(src + 4, aligned);
+    if (PREMULTIPLIED ? (s0 | s1) == 0 : ((s0 | s1) >> 24) == 0) continue;
+    uint32_t d0, d1;
+    if ((s0 & s1) >= 0xFF000000) {
+      d0 = B::fromArgb(s0);
+      d1 = B::fromArgb(s1);
+    } else {
+      B::loadPair(dst, &d0, &d1);
+      d0 = blendArgbPixel<F, PREMULTIPLIED>(s0, d0);
+      d1 = blendArgbPixel<F, PREMULTIPLIED>(s1, d1);
+    }
+    B::storePair(dst, d0, d1);
+  }
+  if (i < numPixels) {
+    uint32_t s = readArgb(src, aligned);
+    uint32_t d = blendArgbPixel<F, PREMULTIPLIED>(s, B::loadFirst(dst));
+    B::storeFirst(dst, d);
+  }
+}
+
+}  // namespace rawdisp
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rawdisp/asset_format.hpp"
+#include "rawdisp/compression.hpp"
+#include "rawdisp/pixel_format.hpp"
+
+namespace rawdisp {
+
+// Read-only view of an asset generated with the container option. The
+// data is parsed in place, e.g. from XIP flash, nothing is copied and no
+// alignment is assumed. Layout, little endian:
+//   header (24 bytes):
+//     [0..3]   magic "RDAS"
+//     [4]      version
+//     [5]      number of planes
+//     [6]      AssetFormat
+//     [8..9]   width
+//     [10..11] height
+//     [12..15] palette offset, 0 if none
+//     [16..17] number of palette colors
+//     [20..23] size of the whole container
+//   plane table (24 bytes per plane):
+//     [0..7]   id, zero padded
+//     [8..11]  data offset
+//     [12..15] data size
+//     [16]     PlaneType
+//     [17]     matched index
+//     [18]     PlaneLayout flags
+//     [19]     Compression
+//     [20]     PackUnit
+//     [21]     pixel stride in bits
+//     [22]     pixels per fragment
+//     [23]     bytes per fragment
+// Offsets are from the start of the container. The palette is RGB888.
+class AssetContainer {
+ public:
+  static constexpr uint8_t VERSION = 1;
+  static constexpr size_t HEADER_SIZE = 24;
+  static constexpr size_t PLANE_ENTRY_SIZE = 24;
+  static constexpr size_t PLANE_ID_SIZE = 8;
+
+  struct Plane {
+    const char *id;  // not terminated if PLANE_ID_SIZE long
+    size_t idLength;
+    const uint8_t *data;
+    size_t size;
+    Compression compression;
+    PlaneLayout layout;
+  };
+
+  const uint8_t *const data;
+
+  AssetContainer(const uint8_t *data, size_t size) : data(data) {
+    isValid = validate(size);
+  }
+
+  inline bool valid() const { return isValid; }
+  inline AssetFormat format() const {
+    return (AssetFormat)(isValid ? data[6] : 0);
+  }
+  inline int width() const { return isValid ? read16(data + 8) : 0; }
+  inline int height() const { return isValid ? read16(data + 10) : 0; }
+  inline int numPlanes() const { return isValid ? data[5] : 0; }
+  inline size_t size() const { return isValid ? read32(data + 20) : 0; }
+
+  inline int paletteColors() const {
+    return isValid && read32(data + 12) ? read16(data + 16) : 0;
+  }
+  // RGB888 palette, nullptr if none
+  inline const uint8_t *palette() const {
+    return paletteColors() > 0 ? data + read32(data + 12) : nullptr;
+  }
+
+  Plane plane(int i) const {
+    const uint8_t *e = data + HEADER_SIZE + PLANE_ENTRY_SIZE * i;
+    Plane p;
+    p.id = (const char *)e;
+    p.idLength = 0;
+    while (p.idLength < PLANE_ID_SIZE && e[p.idLength] != 0) p.idLength++;
+    p.data = data + read32(e + 8);
+    p.size = read32(e + 12);
+    p.compression = (Compression)e[19];
+    p.layout.type = (PlaneType)e[16];
+    p.layout.matchIndex = e[17];
+    p.layout.flags = e[18];
+    p.layout.packUnit = (PackUnit)e[20];
+    p.layout.pixelStride = e[21];
+    p.layout.pixelsPerFrag = e[22];
+    p.layout.bytesPerFrag = e[23];
+    return p;
+  }
+
+  // Returns the index of the plane, or -1 if not found.
+  int findPlane(const char *id) const {
+    size_t len = strlen(id);
+    if (len > PLANE_ID_SIZE) return -1;
+    for (int i = 0; i < numPlanes(); i++) {
+      Plane p = plane(i);
+      if (p.idLength == len && memcmp(p.id, id, len) == 0) return i;
+    }
+    return -1;
+  }
+
+  // Size of the plane after decompression.
+  size_t decodedSize(int i) const {
+    Plane p = plane(i);
+    if (p.compression == Compression::NONE) return p.size;
+    CompressedHeader hdr;
+    if (!CompressedHeader::parse(p.data, p.size, &hdr)) return 0;
+    return hdr.originalSize;
+  }
+
+  // Whether all planes can be sent to a display of `fmt` without
+  // conversion, after decompression.
+  bool isNativeTo(PixelFormat fmt) const {
+    if (!isValid) return false;
+    int planesNeeded = dispatchPixelFormat(
+        fmt, [](auto t) { return decltype(t)::NUM_PLANES; }, 0);
+    if (numPlanes() != planesNeeded) return false;
+    for (int i = 0; i < numPlanes(); i++) {
+      if (!isNativeLayout(fmt, format(), plane(i).layout)) return false;
+    }
+    return true;
+  }
+
+ private:
+  bool isValid;
+
+  static inline uint32_t read16(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+  }
+  static inline uint32_t read32(const uint8_t *p) {
+    return read16(p) | (read16(p + 2) << 16);
+  }
+
+  bool validate(size_t size) const {
+    if (size < HEADER_SIZE) return false;
+    if (memcmp(data, "RDAS", 4) != 0 || data[4] != VERSION) return false;
+    size_t total = read32(data + 20);
+    if (total > size) return false;
+    int n = data[5];
+    if (HEADER_SIZE + PLANE_ENTRY_SIZE * n > total) return false;
+
+    int w = read16(data + 8), h = read16(data + 10);
+    for (int i = 0; i < n; i++) {
+      const uint8_t *e = data + HEADER_SIZE + PLANE_ENTRY_SIZE * i;
+      size_t offset = read32(e + 8), len = read32(e + 12);
+      if (offset > total || len > total - offset) return false;
+
+      // the decoded size has to match the dimensions
+      int ppf = e[22], bpf = e[23];
+      if (ppf == 0 || bpf == 0) return false;
+      bool vertPack = e[18] & PlaneLayout::FLAG_VERT_PACK;
+      int fragW = vertPack ? 1 : ppf;
+      int fragH = vertPack ? ppf : 1;
+      size_t expected =
+          (size_t)((w + fragW - 1) / fragW) * ((h + fragH - 1) / fragH) * bpf;
+      Compression comp = (Compression)e[19];
+      if (comp == Compression::NONE) {
+        if (len != expected) return false;
+      } else if (comp == Compression::RLE || comp == Compression::LZ77) {
+        CompressedHeader hdr;
+        if (!CompressedHeader::parse(data + offset, len, &hdr)) return false;
+        if (hdr.method != comp || hdr.originalSize != expected) return false;
+      } else {
+        return false;
+      }
+    }
+
+    size_t palOffset = read32(data + 12);
+    if (palOffset != 0) {
+      size_t palSize = read16(data + 16) * 3;
+      if (palOffset > total || palSize > total - palOffset) return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/asset_format.hpp"
+#include "rawdisp/compression.hpp"
+#include "rawdisp/pixel_format.hpp"
+
+namespace rawdisp {
+
+struct AssetPlaneDesc {
+  const char *id;
+  const uint8_t *data;
+  size_t size;  // compressed size if compressed
+  Compression compression;
+  PlaneLayout layout;
+  // bytes from one row of fragments to the next, or from one column to
+  // the next with FLAG_VERT_ADDR
+  int stride;
+};
+
+// Compile time description of a generated asset, emitted by the generator
+// next to the arrays as `<name>_desc`.
+struct AssetDesc {
+  static constexpr int MAX_PLANES = 4;
+
+  int width;
+  int height;
+  AssetFormat format;
+  int numPlanes;
+  AssetPlaneDesc planes[MAX_PLANES];
+  const uint8_t *palette;  // RGB888, nullptr if none
+  int paletteColors;
+
+  constexpr bool fitsIn(int w, int h) const {
+    return width <= w && height <= h;
+  }
+
+  // Whether all planes can be sent to a display of `fmt` without
+  // conversion, after decompression.
+  constexpr bool isNativeTo(PixelFormat fmt) const {
+    int planesNeeded = dispatchPixelFormat(
+        fmt, [](auto t) { return decltype(t)::NUM_PLANES; }, 0);
+    if (numPlanes != planesNeeded) return false;
+    for (int i = 0; i < numPlanes; i++) {
+      if (!isNativeLayout(fmt, format, planes[i].layout)) return false;
+    }
+    return true;
+  }
+
+  constexpr bool uses(Compression comp) const {
+    for (int i = 0; i < numPlanes; i++) {
+      if (planes[i].compression == comp) return true;
+    }
+    return false;
+  }
+
+  // Returns the index of the plane, or -1 if not found.
+  constexpr int findPlane(const char *id) const {
+    for (int i = 0; i < numPlanes; i++) {
+      const char *a = planes[i].id, *b = id;
+      while (*a && *a == *b) {
+        a++;
+        b++;
+      }
+      if (*a == *b) return i;
+    }
+    return -1;
+  }
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "rawdisp/pixel_format.hpp"
+
+namespace rawdisp {
+
+// Pixel format of a generated asset, same values as PixelFormat of the
+// generator.
+enum class AssetFormat : uint8_t {
+  RGBA8888 = 0,
+  RGB888 = 1,
+  RGB666 = 2,
+  RGB565 = 3,
+  RGB444 = 4,
+  RGB332 = 5,
+  RGB111 = 6,
+  GRAY4 = 7,
+  GRAY2 = 8,
+  BW = 9,
+  I2_RGB888 = 10,
+  I4_RGB888 = 11,
+  I6_RGB888 = 12,
+};
+
+enum class PackUnit : uint8_t {
+  UNPACKED = 0,
+  PIXEL = 1,
+  ALIGNMENT = 2,
+};
+
+enum class PlaneType : uint8_t {
+  DIRECT = 0,
+  INDEX_MATCH = 1,
+};
+
+// How the generator laid out the pixels of one plane.
+struct PlaneLayout {
+  static constexpr uint8_t FLAG_FAR_PIXEL_FIRST = 0x01;
+  static constexpr uint8_t FLAG_BIG_ENDIAN = 0x02;
+  static constexpr uint8_t FLAG_VERT_PACK = 0x04;
+  static constexpr uint8_t FLAG_VERT_ADDR = 0x08;
+  static constexpr uint8_t FLAG_ALIGN_LEFT = 0x10;
+  static constexpr uint8_t FLAG_COLOR_DESCENDING = 0x20;
+  static constexpr uint8_t FLAG_ALPHA_FIRST = 0x40;
+  static constexpr uint8_t FLAG_POST_INVERT = 0x80;
+
+  PlaneType type;
+  uint8_t matchIndex;
+  uint8_t flags;
+  PackUnit packUnit;
+  uint8_t pixelStride;  // bits per pixel including padding
+  uint8_t pixelsPerFrag;
+  uint8_t bytesPerFrag;
+
+  constexpr bool has(uint8_t flag) const { return (flags & flag) != 0; }
+};
+
+// Whether a plane can be sent as it is to a display of format F.
+template <PixelFormat F>
+static constexpr bool isNativeLayout(AssetFormat fmt, const PlaneLayout &l) {
+  using T = PixelFormatTraits<F>;
+  bool fmtOk = false;
+  switch (F) {
+    case PixelFormat::RGB111:
+      fmtOk = fmt == AssetFormat::RGB111;
+      break;
+    case PixelFormat::RGB444:
+      fmtOk = fmt == AssetFormat::RGB444;
+      break;
+    case PixelFormat::RGB565:
+      fmtOk = fmt == AssetFormat::RGB565;
+      break;
+    case PixelFormat::RGB666:
+      fmtOk = fmt == AssetFormat::RGB666;
+      break;
+    case PixelFormat::BW:
+      fmtOk = fmt == AssetFormat::BW;
+      break;
+    case PixelFormat::KR11:
+      // one of the two planes of the black/white/red preset
+      fmtOk = fmt == AssetFormat::I2_RGB888 &&
+              l.type == PlaneType::INDEX_MATCH;
+      break;
+  }
+  if (!fmtOk) return false;
+  if (l.pixelStride != T::PIXEL_STRIDE ||
+      l.pixelsPerFrag != T::PIXELS_PER_UNIT ||
+      l.bytesPerFrag != T::BYTES_PER_UNIT) {
+    return false;
+  }
+  if (l.has(PlaneLayout::FLAG_VERT_PACK) ||
+      l.has(PlaneLayout::FLAG_VERT_ADDR)) {
+    return false;
+  }
+  if (T::PIXELS_PER_UNIT > 1 &&
+      l.has(PlaneLayout::FLAG_FAR_PIXEL_FIRST) != T::FAR_PIXEL_FIRST) {
+    return false;
+  }
+  if (T::BYTES_PER_UNIT > 1 &&
+      l.has(PlaneLayout::FLAG_BIG_ENDIAN) != T::UNIT_BIG_ENDIAN) {
+    return false;
+  }
+  if (T::IS_RGB && !l.has(PlaneLayout::FLAG_COLOR_DESCENDING)) return false;
+  // the only formats with padding in a unit
+  if (F == PixelFormat::RGB666 && !l.has(PlaneLayout::FLAG_ALIGN_LEFT)) {
+    return false;
+  }
+  if (F == PixelFormat::RGB111 && l.has(PlaneLayout::FLAG_ALIGN_LEFT)) {
+    return false;
+  }
+  return true;
+}
+
+static constexpr bool isNativeLayout(PixelFormat dispFmt, AssetFormat fmt,
+                                     const PlaneLayout &l) {
+  return dispatchPixelFormat(
+      dispFmt,
+      [&](auto t) { return isNativeLayout<decltype(t)::FORMAT>(fmt, l); },
+      false);
+}
+
+}  // namespace rawdisp
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "rawdisp/asset_container.hpp"
+#include "rawdisp/asset_desc.hpp"
+#include "rawdisp/compressed_pixels.hpp"
+#include "rawdisp/display.hpp"
+#include "rawdisp/rle_decoder.hpp"
+
+namespace rawdisp {
+
+// Draws an asset container at (x, y) if its layout is native to the
+// display and it fits on the screen. Plain and RLE planes are supported.
+// LZ77 planes need a window buffer and are left to the caller. Returns
+// false without touching the display if the asset can't be drawn.
+template <typename TDisplay>
+static inline bool writeAsset(TDisplay &display, const AssetContainer &asset,
+                              int x, int y) {
+  if (!asset.isNativeTo(display.format)) return false;
+  int w = asset.width(), h = asset.height();
+  if (x < 0 || y < 0 || x + w > display.width || y + h > display.height) {
+    return false;
+  }
+  for (int i = 0; i < asset.numPlanes(); i++) {
+    Compression comp = asset.plane(i).compression;
+    if (comp != Compression::NONE && comp != Compression::RLE) return false;
+  }
+
+  display.setWindow(x, y, w, h);
+  for (int i = 0; i < asset.numPlanes(); i++) {
+    AssetContainer::Plane p = asset.plane(i);
+    if (p.compression == Compression::NONE) {
+      display.writePixels(p.data, p.size, i);
+    } else {
+      RleDecoder decoder(p.data, p.size);
+      writeDecodedPixels(display, decoder, i);
+    }
+  }
+  return true;
+}
+
+template <typename TDisplay>
+static inline void writeAssetPlanes(TDisplay &display, const AssetDesc &asset,
+                                    int x, int y) {
+  display.setWindow(x, y, asset.width, asset.height);
+  for (int i = 0; i < asset.numPlanes; i++) {
+    const AssetPlaneDesc &p = asset.planes[i];
+    if (p.compression == Compression::NONE) {
+      display.writePixels(p.data, p.size, i);
+    } else if (p.compression == Compression::RLE) {
+      RleDecoder decoder(p.data, p.size);
+      writeDecodedPixels(display, decoder, i);
+    }
+  }
+}
+
+// Draws a generated asset at (x, y). Whether the layout is native to the
+// display and whether the asset fits are checked at compile time.
+template <const DisplayConfig &CFG, const AssetDesc &A, typename TDisplay>
+static inline void writeAsset(TDisplay &display, int x, int y) {
+  static_assert(TDisplay::isNativeAsset(CFG, A),
+                "asset layout doesn't match the display");
+  static_assert(!A.uses(Compression::LZ77),
+                "LZ77 planes need a window buffer, use Lz77Decoder");
+  writeAssetPlanes(display, A, x, y);
+}
+
+// Same as above with the checks at run time, for assets picked at run
+// time such as a level of an AssetSet. Returns false without touching the
+// display if the asset can't be drawn.
+template <typename TDisplay>
+static inline bool writeAsset(TDisplay &display, const AssetDesc &asset,
+                              int x, int y) {
+  if (x < 0 || y < 0) return false;
+  DisplayConfig cfg = {
+      .width = display.width - x,
+      .height = display.height - y,
+      .format = display.format,
+      .resetPort = display.resetPort,
+  };
+  if (!TDisplay::isNativeAsset(cfg, asset)) return false;
+  if (asset.uses(Compression::LZ77)) return false;
+  writeAssetPlanes(display, asset, x, y);
+  return true;
+}
+
+}  // namespace rawdisp
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "rawdisp/asset_desc.hpp"
+
+namespace rawdisp {
+
+// One artwork generated at several resolutions, emitted by the generator
+// as `<name>_set` next to the level headers.
+struct AssetSet {
+  static constexpr int MAX_LEVELS = 8;
+
+  int numLevels;
+  const AssetDesc *levels[MAX_LEVELS];
+
+  // Returns the largest level accepted by `pred`, or nullptr if none is.
+  template <typename TPred>
+  constexpr const AssetDesc *pickIf(TPred pred) const {
+    const AssetDesc *best = nullptr;
+    for (int i = 0; i < numLevels; i++) {
+      const AssetDesc *a = levels[i];
+      if (!pred(*a)) continue;
+      if (!best || a->width * a->height > best->width * best->height) {
+        best = a;
+      }
+    }
+    return best;
+  }
+
+  // Returns the largest level that fits in w x h, or nullptr.
+  constexpr const AssetDesc *pick(int w, int h) const {
+    return pickIf([w, h](const AssetDesc &a) { return a.fitsIn(w, h); });
+  }
+};
+
+// Returns the largest level that TDisplay can draw as it is on a display
+// of `cfg`, or nullptr. Usable at compile time with a constexpr config.
+template <typename TDisplay, typename TConfig>
+static constexpr const AssetDesc *pickAsset(const AssetSet &set,
+                                            const TConfig &cfg) {
+  return set.pickIf(
+      [&cfg](const AssetDesc &a) { return TDisplay::isNativeAsset(cfg, a); });
+}
+
+}  // namespace rawdisp
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rawdisp/pixel_format.hpp"
+
+namespace rawdisp {
+
+// Part of a sprite that shows through a clip rect.
+struct BlitRect {
+  int x;  // top left on the display
+  int y;
+  int width;
+  int height;
+  int srcX;  // top left in the sprite
+  int srcY;
+
+  inline bool empty() const { return width <= 0 || height <= 0; }
+};
+
+// Intersects a w x h sprite placed at (x, y) with the clip rect.
+static inline BlitRect clipBlit(int x, int y, int w, int h, int clipX,
+                                int clipY, int clipW, int clipH) {
+  int left = x > clipX ? x : clipX;
+  int top = y > clipY ? y : clipY;
+  int right = x + w < clipX + clipW ? x + w : clipX + clipW;
+  int bottom = y + h < clipY + clipH ? y + h : clipY + clipH;
+  BlitRect r;
+  r.x = left;
+  r.y = top;
+  r.width = right > left ? right - left : 0;
+  r.height = bottom > top ? bottom - top : 0;
+  r.srcX = left - x;
+  r.srcY = top - y;
+  return r;
+}
+
+// Reads k (<= 8) bits starting `bit` (< 8) bits into src, right aligned.
+static RAWDISP_INLINE uint32_t readBits(const uint8_t *src, int bit, int k) {
+  uint32_t v = (uint32_t)src[0] << 8;
+  if (bit + k > 8) v |= src[1];
+  return (v >> (16 - bit - k)) & ((1u << k) - 1);
+}
+
+// Writes k (<= 8) bits `bit` (< 8) bits into dst, keeping the others.
+static RAWDISP_INLINE void writeBits(uint8_t *dst, int bit, int k,
+                                     uint32_t v) {
+  uint8_t mask = ((1u << k) - 1) << (8 - bit - k);
+  *dst = (*dst & ~mask) | ((v << (8 - bit - k)) & mask);
+}
+
+// Copies n bits of an MSB first bit stream. The destination bits around
+// the copied range are kept.
+static inline void copyBits(const uint8_t *src, size_t srcBit, uint8_t *dst,
+                            size_t dstBit, size_t n) {
+  src += srcBit >> 3;
+  dst += dstBit >> 3;
+  int s = srcBit & 7, d = dstBit & 7;
+
+  // head: up to the first whole byte of dst
+  if (d != 0 && n > 0) {
+    int k = 8 - d < (int)n ? 8 - d : (int)n;
+    writeBits(dst++, d, k, readBits(src, s, k));
+    s += k;
+    src += s >> 3;
+    s &= 7;
+    n -= k;
+  }
+
+  // body: whole bytes of dst, shifted when src is at another bit offset
+  size_t numBytes = n >> 3;
+  if (s == 0) {
+    memcpy(dst, src, numBytes);
+  } else {
+    for (size_t i = 0; i < numBytes; i++) {
+      dst[i] = (src[i] << s) | (src[i + 1] >> (8 - s));
+    }
+  }
+  src += numBytes;
+  dst += numBytes;
+
+  // tail
+  n &= 7;
+  if (n > 0) writeBits(dst, 0, n, readBits(src, s, n));
+}
+
+// Copies n pixels of RGB111, whose 2 pixels per byte sit in bits 5..3 and
+// 2..0. Positions are in bits, 4 per pixel.
+static inline void copyRgb111(const uint8_t *src, size_t srcBit, uint8_t *dst,
+                              size_t dstBit, size_t n) {
+  size_t sp = srcBit >> 2, dp = dstBit >> 2;
+  src += sp >> 1;
+  dst += dp >> 1;
+  bool srcOdd = sp & 1;
+
+  // head: second pixel of a dst byte
+  if ((dp & 1) && n > 0) {
+    uint8_t px = srcOdd ? (*src++ & 7) : ((*src >> 3) & 7);
+    *dst = (*dst & 0x38) | px;
+    dst++;
+    srcOdd = !srcOdd;
+    n--;
+  }
+
+  // body: whole dst bytes, re-paired when src starts mid byte
+  size_t numBytes = n >> 1;
+  if (!srcOdd) {
+    memcpy(dst, src, numBytes);
+  } else {
+    for (size_t i = 0; i < numBytes; i++) {
+      dst[i] = ((src[i] & 7) << 3) | ((src[i + 1] >> 3) & 7);
+    }
+  }
+  src += numBytes;
+  dst += numBytes;
+
+  // tail: first pixel of a dst byte
+  if (n & 1) {
+    uint8_t px = srcOdd ? (*src & 7) : ((*src >> 3) & 7);
+    *dst = (*dst & 0x07) | (px << 3);
+  }
+}
+
+// Row copy kernel of a PixelFormat: `copy(src, srcBit, dst, dstBit, n)`
+// copies n pixels of one plane, positions in bits of the packed layout.
+template <PixelFormat F>
+struct BlitKernel;
+
+template <>
+struct BlitKernel<PixelFormat::RGB111> {
+  static RAWDISP_INLINE void copy(const uint8_t *src, size_t srcBit,
+                                  uint8_t *dst, size_t dstBit, size_t n) {
+    copyRgb111(src, srcBit, dst, dstBit, n);
+  }
+};
+
+// 12 bits per pixel, so every other pixel is nibble shifted
+template <>
+struct BlitKernel<PixelFormat::RGB444> {
+  static RAWDISP_INLINE void copy(const uint8_t *src, size_t srcBit,
+                                  uint8_t *dst, size_t dstBit, size_t n) {
+    copyBits(src, srcBit, dst, dstBit, n * 12);
+  }
+};
+
+template <>
+struct BlitKernel<PixelFormat::RGB565> {
+  static RAWDISP_INLINE void copy(const uint8_t *src, size_t srcBit,
+                                  uint8_t *dst, size_t dstBit, size_t n) {
+    memcpy(dst + (dstBit >> 3), src + (srcBit >> 3), n * 2);
+  }
+};
+
+template <>
+struct BlitKernel<PixelFormat::RGB666> {
+  static RAWDISP_INLINE void copy(const uint8_t *src, size_t srcBit,
+                                  uint8_t *dst, size_t dstBit, size_t n) {
+    memcpy(dst + (dstBit >> 3), src + (srcBit >> 3), n * 3);
+  }
+};
+
+// one bit per pixel in each plane
+template <>
+struct BlitKernel<PixelFormat::KR11> {
+  static RAWDISP_INLINE void copy(const uint8_t *src, size_t srcBit,
+                                  uint8_t *dst, size_t dstBit, size_t n) {
+    copyBits(src, srcBit, dst, dstBit, n);
+  }
+};
+
+template <>
+struct BlitKernel<PixelFormat::BW> {
+  static RAWDISP_INLINE void copy(const uint8_t *src, size_t srcBit,
+                                  uint8_t *dst, size_t dstBit, size_t n) {
+    copyBits(src, srcBit, dst, dstBit, n);
+  }
+};
+
+// Packs the visible part of one plane of a sprite into a pixel stream for
+// the window of the BlitRect, in chunks through the decoder interface so
+// that it can be sent with writeDecodedPixels(). The rows are joined
+// without a gap, or each padded to a whole byte with `padRows` for
+// displays that address X in bytes.
+template <PixelFormat F>
+class BlitReader {
+  using Traits = PixelFormatTraits<F>;
+  static constexpr int BITS = Traits::BITS_PER_PIXEL / Traits::NUM_PLANES;
+
+ public:
+  // smallest buffer read() always makes progress with
+  static constexpr size_t MIN_CAPACITY = 4;
+
+  // `data` and `stride` are those of the plane, stride in bytes per row.
+  BlitReader(const uint8_t *data, int stride, const BlitRect &rect,
+             bool padRows)
+      : rowData(data + (size_t)stride * rect.srcY),
+        stride(stride),
+        srcBit((size_t)rect.srcX * BITS),
+        width(rect.width),
+        height(rect.height),
+        padRows(padRows) {}
+
+  size_t read(uint8_t *dst, size_t capacity) {
+    size_t bit = 0;
+    if (carryBits > 0) {
+      dst[0] = carry;
+      bit = carryBits;
+    }
+    const size_t capBits = capacity * 8;
+    while (row < height) {
+      size_t room = (capBits - bit) / BITS;
+      if (room == 0) break;
+      int n = width - col < (int)room ? width - col : (int)room;
+      BlitKernel<F>::copy(rowData, srcBit + (size_t)col * BITS, dst, bit, n);
+      bit += (size_t)n * BITS;
+      col += n;
+      if (col == width) {
+        col = 0;
+        row++;
+        rowData += stride;
+        if (padRows || row == height) bit = padToByte(dst, bit);
+      }
+    }
+    // a byte only partly filled goes out with the next chunk
+    carryBits = bit & 7;
+    carry = carryBits > 0 ? dst[bit >> 3] : 0;
+    return bit >> 3;
+  }
+
+ private:
+  const uint8_t *rowData;
+  const int stride;
+  const size_t srcBit;
+  const int width;
+  const int height;
+  const bool padRows;
+  int row = 0;
+  int col = 0;
+  uint8_t carry = 0;
+  int carryBits = 0;
+
+  static RAWDISP_INLINE size_t padToByte(uint8_t *dst, size_t bit) {
+    int used = bit & 7;
+    if (used == 0) return bit;
+    // the first pixel of RGB111 is in bits 5..3
+    dst[bit >> 3] &= F == PixelFormat::RGB111 ? 0x38 : 0xFF << (8 - used);
+    return bit + 8 - used;
+  }
+};
+
+}  // namespace rawdisp
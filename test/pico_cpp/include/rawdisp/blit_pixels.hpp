@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/asset_desc.hpp"
+#include "rawdisp/blit.hpp"
+#include "rawdisp/compressed_pixels.hpp"
+#include "rawdisp/display.hpp"
+
+namespace rawdisp {
+
+template <PixelFormat F, size_t BUFF_SIZE, typename TDisplay>
+static inline bool blitPlanes(TDisplay &display, const AssetDesc &asset,
+                              const BlitRect &r) {
+  constexpr int PPU = PixelFormatTraits<F>::PIXELS_PER_UNIT;
+  if (TDisplay::BYTE_ADDRESSED_ROWS && PPU > 1) {
+    // the window can't start or end inside a byte of display RAM
+    int right = r.x + r.width;
+    if (r.x % PPU != 0 || (right % PPU != 0 && right != display.width)) {
+      return false;
+    }
+  }
+  display.setWindow(r.x, r.y, r.width, r.height);
+  for (int i = 0; i < asset.numPlanes; i++) {
+    const AssetPlaneDesc &p = asset.planes[i];
+    BlitReader<F> reader(p.data, p.stride, r, TDisplay::BYTE_ADDRESSED_ROWS);
+    writeDecodedPixels<BUFF_SIZE>(display, reader, i);
+  }
+  return true;
+}
+
+// Draws the part of an uncompressed asset placed at (x, y) that lies in
+// the clip rect, with the window set to just that part, so a sprite
+// crossing a screen edge costs only its visible pixels. Returns true if
+// nothing is visible, and false without touching the display if the
+// asset can't be drawn, the display is rotated to scan columns, or on a
+// display addressing X in bytes, if the visible part doesn't start and
+// end on a byte of display RAM.
+template <size_t BUFF_SIZE = 512, typename TDisplay>
+static inline bool blitAsset(TDisplay &display, const AssetDesc &asset, int x,
+                             int y, int clipX, int clipY, int clipW,
+                             int clipH) {
+  static_assert(BUFF_SIZE >= BlitReader<PixelFormat::RGB666>::MIN_CAPACITY,
+                "buffer too small");
+  DisplayConfig cfg = {
+      .width = asset.width,
+      .height = asset.height,
+      .format = display.format,
+      .resetPort = display.resetPort,
+  };
+  if (!asset.isNativeTo(display.format)) return false;
+  if (!TDisplay::isNativeAsset(cfg, asset)) return false;
+  if (display.scansColumns()) return false;
+  for (int i = 0; i < asset.numPlanes; i++) {
+    if (asset.planes[i].compression != Compression::NONE) return false;
+  }
+
+  display.clipRect(&clipX, &clipY, &clipW, &clipH);
+  BlitRect r = clipBlit(x, y, asset.width, asset.height, clipX, clipY, clipW,
+                        clipH);
+  if (r.empty()) return true;
+  return dispatchPixelFormat(
+      display.format,
+      [&](auto t) {
+        return blitPlanes<decltype(t)::FORMAT, BUFF_SIZE>(display, asset, r);
+      },
+      false);
+}
+
+// Same as above, clipped by the screen only.
+template <size_t BUFF_SIZE = 512, typename TDisplay>
+static inline bool blitAsset(TDisplay &display, const AssetDesc &asset, int x,
+                             int y) {
+  return blitAsset<BUFF_SIZE>(display, asset, x, y, 0, 0, display.width,
+                              display.height);
+}
+
+}  // namespace rawdisp
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rawdisp/command_data_display.hpp"
+#include "rawdisp/timer.hpp"
+
+namespace rawdisp {
+
+// Brings up several panels at once: every reset/init is started together
+// and their command phases are interleaved while the others wait.
+class BootOrchestrator {
+ public:
+  static constexpr int MAX_PANELS = 8;
+
+  typedef void (*FirstFrameFunc)(CommandDataDisplay &display);
+
+  struct Panel {
+    const char *name;
+    CommandDataDisplay *display;
+    FirstFrameFunc firstFrame;
+    uint32_t readyUs;       // from start of run()
+    uint32_t firstPixelUs;  // from start of run()
+    bool done;
+  };
+
+  Panel panels[MAX_PANELS];
+  int numPanels = 0;
+  uint32_t totalUs = 0;
+
+  bool add(const char *name, CommandDataDisplay &display,
+           FirstFrameFunc firstFrame = nullptr) {
+    if (numPanels >= MAX_PANELS) return false;
+    panels[numPanels++] = {name, &display, firstFrame, 0, 0, false};
+    return true;
+  }
+
+  // Panels with a non-blocking init should be added first, those that fall
+  // back to a blocking init() then run while the others are waiting.
+  void run() {
+    uint64_t startUs = timer::nowUs();
+    for (int i = 0; i < numPanels; i++) {
+      panels[i].done = false;
+      panels[i].display->beginInit();
+    }
+
+    int remaining = numPanels;
+    while (remaining > 0) {
+      uint64_t nextUs = UINT64_MAX;
+      for (int i = 0; i < numPanels; i++) {
+        Panel &p = panels[i];
+        if (p.done) continue;
+        if (!p.display->poll()) {
+          uint64_t deadline = p.display->initDeadlineUs();
+          if (deadline < nextUs) nextUs = deadline;
+          continue;
+        }
+        p.readyUs = timer::nowUs() - startUs;
+        if (p.firstFrame) p.firstFrame(*p.display);
+        p.firstPixelUs = timer::nowUs() - startUs;
+        p.done = true;
+        remaining--;
+      }
+
+      if (remaining > 0) {
+        uint64_t now = timer::nowUs();
+        if (nextUs > now) {
+          sleep_us(nextUs - now);
+        } else {
+          // waiting for BUSY
+          sleep_us(100);
+        }
+      }
+    }
+    totalUs = timer::nowUs() - startUs;
+  }
+
+  void printReport() const {
+    for (int i = 0; i < numPanels; i++) {
+      const Panel &p = panels[i];
+      printf("%-8s ready %7lu us, first pixel %7lu us\n", p.name,
+             (unsigned long)p.readyUs, (unsigned long)p.firstPixelUs);
+    }
+    printf("all panels up in %lu us\n", (unsigned long)totalUs);
+  }
+};
+
+}  // namespace rawdisp
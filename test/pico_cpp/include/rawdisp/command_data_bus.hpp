@@ -3,6 +3,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "rawdisp/init_sequence.hpp"
+
 namespace rawdisp {
 
 class CommandDataBus {
@@ -16,6 +18,34 @@ class CommandDataBus {
   virtual void writeBytes(const uint8_t *data, size_t length) = 0;
   virtual void writeCommand(uint8_t cmd, const uint8_t *params,
                             size_t size) = 0;
+
+  // Identifies the peripheral behind the bus. Buses that share one cannot
+  // transfer at the same time.
+  virtual const void *peripheral() const { return this; }
+
+  // Starts sending data without waiting for it to complete, the buffer must
+  // stay valid until isWriteBusy() returns false.
+  virtual void writeBytesAsync(const uint8_t *data, size_t length) {
+    writeBytes(data, length);
+  }
+
+  virtual bool isWriteBusy() { return false; }
+
+  virtual bool canRead() const { return false; }
+
+  // Sends a command and switches to reading its response. `dummyBits`
+  // clocks the controller inserts before the data are discarded. End the
+  // transaction with writeEnd().
+  virtual void readStart(uint8_t cmd, int dummyBits) {}
+  virtual void readBytes(uint8_t *data, size_t length) {}
+
+  // Sends a run of commands that need no wait in between. Buses that can
+  // keep the transaction open across commands override this.
+  virtual void writeCommandList(const InitCommand *cmds, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+      writeCommand(cmds[i].cmd, cmds[i].params, cmds[i].numParams);
+    }
+  }
 };
 
 }  // namespace rawdisp
@@ -2,11 +2,16 @@
 
 #include "command_data_bus.hpp"
 #include "display.hpp"
+#include "init_sequence.hpp"
+#include "pixel_convert.hpp"
+#include "timer.hpp"
 
 namespace rawdisp {
 
 class CommandDataDisplay : public Display {
  public:
+  static constexpr int MAX_INIT_SEGMENTS = 4;
+
   CommandDataBus &bus;
 
   CommandDataDisplay(CommandDataBus &bus, const DisplayConfig &cfg)
@@ -14,5 +19,179 @@ class CommandDataDisplay : public Display {
 
   void init() override { Display::init(); }
 
+  // Starts initialization without blocking. Drivers that support it queue
+  // their init tables here, others just run the blocking init().
+  virtual void beginInit() {
+    init();
+    clearInitSequence();
+  }
+
+  // Advances the sequence queued by beginInit() as far as possible without
+  // waiting. Returns true once the display is ready.
+  bool poll() {
+    if (initDone) return true;
+    if (initBusyWait && isBusy()) return false;
+    initBusyWait = false;
+    if ((int64_t)(timer::nowUs() - initWaitUntilUs) < 0) return false;
+
+    while (initSegment < numInitSegments) {
+      const InitSegment &seg = initSegments[initSegment];
+      if (initIndex >= seg.size) {
+        initSegment++;
+        initIndex = 0;
+        continue;
+      }
+      const InitCommand *wait;
+      initIndex += writeInitRun(seg.seq + initIndex, seg.size - initIndex,
+                                &wait);
+      if (wait) {
+        initWaitUntilUs = timer::nowUs() + wait->delayMs * 1000;
+        initBusyWait = wait->busyWait;
+        return false;
+      }
+    }
+    initDone = true;
+    return true;
+  }
+
+  inline bool isReady() const { return initDone; }
+
+  // time at which poll() has something to do next
+  inline uint64_t initDeadlineUs() const { return initWaitUntilUs; }
+
+  // Blocks until the sequence queued by beginInit() completes.
+  void finishInit() {
+    while (!poll()) {
+      int64_t remaining = initWaitUntilUs - timer::nowUs();
+      if (remaining > 0) {
+        sleep_us(remaining);
+      } else {
+        sleep_ms(1);
+      }
+    }
+  }
+
+  void pushPixels(const void *data, size_t length) override {
+    bus.writeBytes(static_cast<const uint8_t *>(data), length);
+  }
+
+  void endPixels() override { bus.writeEnd(); }
+
+  virtual bool isBusy() { return false; }
+
+  virtual bool waitBusy() { return true; }
+
+  template <size_t N>
+  inline void writeInitSequence(const InitCommand (&seq)[N]) {
+    writeInitSequence(seq, N);
+  }
+
+  // Runs an init table, blocking on every delay.
+  void writeInitSequence(const InitCommand *seq, size_t size) {
+    while (size > 0) {
+      const InitCommand *wait;
+      size_t n = writeInitRun(seq, size, &wait);
+      seq += n;
+      size -= n;
+      if (wait) {
+        if (wait->delayMs > 0) sleep_ms(wait->delayMs);
+        if (wait->busyWait) waitBusy();
+      }
+    }
+  }
+
+ protected:
+  struct InitSegment {
+    const InitCommand *seq;
+    size_t size;
+  };
+
+  InitSegment initSegments[MAX_INIT_SEGMENTS];
+  int numInitSegments = 0;
+  int initSegment = 0;
+  size_t initIndex = 0;
+  uint64_t initWaitUntilUs = 0;
+  bool initBusyWait = false;
+  bool initDone = false;
+
+  // starts a memory write of pixel data following a command
+  void beginPixelsWithCommand(uint8_t cmd) {
+    bus.writeStart(true);
+    bus.writeBytes(&cmd, 1);
+    bus.writeStart(false);
+  }
+
+  // Reads a window of a controller that returns its memory as RGB666 (MIPI
+  // DCS memory read over SPI) and converts it to the panel format.
+  bool readPixelsRgb666(uint8_t cmd, int dummyBits, int x, int y, int w, int h,
+                        void *data, size_t length) {
+    constexpr int CHUNK_PIXELS = 16;
+    if (!bus.canRead()) return false;
+    size_t numPixels = (size_t)w * h;
+    if (length < (numPixels * memBitsPerPixel(format) + 7) / 8) return false;
+
+    setWindow(x, y, w, h);
+    bus.readStart(cmd, dummyBits);
+    uint8_t *dst = static_cast<uint8_t *>(data);
+    uint8_t buff[CHUNK_PIXELS * 3];
+    while (numPixels > 0) {
+      int n = numPixels < CHUNK_PIXELS ? numPixels : CHUNK_PIXELS;
+      bus.readBytes(buff, n * 3);
+      dst += convertFromRgb666(format, buff, n, dst);
+      numPixels -= n;
+    }
+    bus.writeEnd();
+    return true;
+  }
+
+  void clearInitSequence() {
+    numInitSegments = 0;
+    initSegment = 0;
+    initIndex = 0;
+    initWaitUntilUs = timer::nowUs();
+    initBusyWait = false;
+    initDone = false;
+  }
+
+  template <size_t N>
+  inline void appendInitSequence(const InitCommand (&seq)[N]) {
+    appendInitSequence(seq, N);
+  }
+
+  void appendInitSequence(const InitCommand *seq, size_t size) {
+    if (numInitSegments >= MAX_INIT_SEGMENTS) return;
+    initSegments[numInitSegments++] = {seq, size};
+  }
+
+  // Sends entries up to the first one that needs a wait. Commands between two
+  // waits are handed to the bus as one list so that it can send them in a
+  // single transaction. Returns the number of entries consumed.
+  size_t writeInitRun(const InitCommand *seq, size_t size,
+                      const InitCommand **wait) {
+    *wait = nullptr;
+    size_t n = 0;
+    while (n < size) {
+      const InitCommand &c = seq[n++];
+      if (c.op == InitOp::COMMAND) {
+        size_t start = n - 1;
+        while (!seq[n - 1].needsWait() && n < size &&
+               seq[n].op == InitOp::COMMAND) {
+          n++;
+        }
+        bus.writeCommandList(seq + start, n - start);
+        if (seq[n - 1].needsWait()) {
+          *wait = &seq[n - 1];
+          break;
+        }
+      } else if (resetPort >= 0) {
+        gpio::write(resetPort, c.op == InitOp::RESET_RELEASE);
+        if (c.needsWait()) {
+          *wait = &c;
+          break;
+        }
+      }
+    }
+    return n;
+  }
 };
-}  // namespace rawdisp
\ No newline at end of file
+}  // namespace rawdisp
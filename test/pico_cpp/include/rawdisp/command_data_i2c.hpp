@@ -17,6 +17,8 @@ class CommandDataI2c : public CommandDataBus {
 
   void init() override { CommandDataBus::init(); }
 
+  const void *peripheral() const override { return i2c; }
+
   void writeStart(bool command) override {
     uint8_t firstByte = command ? 0x80 : 0x40;
     i2c_write_burst_blocking(i2c, devAddr, &firstByte, 1);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <hardware/dma.h>
 #include <hardware/spi.h>
 
 #include "rawdisp/command_data_bus.hpp"
@@ -9,25 +10,84 @@ namespace rawdisp {
 
 class CommandDataSpi : public CommandDataBus {
  public:
+  static constexpr uint32_t DEFAULT_READ_FREQ = 6000000;
+
   spi_inst_t *spi;
   const int CS_PORT;
   const int DC_PORT;
+  const int MISO_PORT;
+  // controllers read back much slower than they accept writes
+  uint32_t readFreq = DEFAULT_READ_FREQ;
+
+  CommandDataSpi(spi_inst_t *spi, int csPort, int dcPort, int misoPort = -1)
+      : spi(spi), CS_PORT(csPort), DC_PORT(dcPort), MISO_PORT(misoPort) {}
+
+  // owns the DMA channel
+  CommandDataSpi(const CommandDataSpi &) = delete;
+  CommandDataSpi &operator=(const CommandDataSpi &) = delete;
 
-  CommandDataSpi(spi_inst_t *spi, int csPort, int dcPort)
-      : spi(spi), CS_PORT(csPort), DC_PORT(dcPort) {}
+  ~CommandDataSpi() { deinit(); }
 
   void init() override {
     CommandDataBus::init();
     gpio::initMulti((1 << CS_PORT) | (1 << DC_PORT));
     gpio::writeMulti((1 << CS_PORT) | (1 << DC_PORT), ~0);
     gpio::setDirMulti((1 << CS_PORT) | (1 << DC_PORT), true);
+    if (MISO_PORT >= 0) {
+      gpio_set_function(MISO_PORT, GPIO_FUNC_SPI);
+    }
+
+    if (dmaCh < 0) {
+      // falls back to blocking writes when no channel is left
+      dmaCh = dma_claim_unused_channel(false);
+    }
+    if (dmaCh >= 0) {
+      dma_channel_config c = dma_channel_get_default_config(dmaCh);
+      channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+      channel_config_set_dreq(&c, spi_get_dreq(spi, true));
+      channel_config_set_read_increment(&c, true);
+      channel_config_set_write_increment(&c, false);
+      dma_channel_configure(dmaCh, &c, &spi_get_hw(spi)->dr, nullptr, 0,
+                            false);
+    }
   }
 
+  // Releases the DMA channel after the transfer in flight, init() claims
+  // one again.
+  void deinit() {
+    if (dmaCh < 0) return;
+    waitWrite();
+    dma_channel_abort(dmaCh);
+    dma_channel_unclaim(dmaCh);
+    dmaCh = -1;
+  }
+
+  const void *peripheral() const override { return spi; }
+
   void writeBytes(const uint8_t *data, size_t length) override {
+    waitWrite();
     spi_write_blocking(spi, data, length);
   }
 
+  void writeBytesAsync(const uint8_t *data, size_t length) override {
+    if (dmaCh < 0) {
+      writeBytes(data, length);
+      return;
+    }
+    waitWrite();
+    dmaActive = true;
+    dma_channel_transfer_from_buffer_now(dmaCh, data, length);
+  }
+
+  bool isWriteBusy() override {
+    if (!dmaActive) return false;
+    if (dma_channel_is_busy(dmaCh) || spi_is_busy(spi)) return true;
+    finishDma();
+    return false;
+  }
+
   void writeStart(bool command) override {
+    waitWrite();
     if (command) {
       gpio::write(DC_PORT, false);
     } else {
@@ -37,6 +97,11 @@ class CommandDataSpi : public CommandDataBus {
   }
 
   void writeEnd() override {
+    waitWrite();
+    if (writeFreq) {
+      spi_set_baudrate(spi, writeFreq);
+      writeFreq = 0;
+    }
     gpio::writeMulti((1 << CS_PORT) | (1 << DC_PORT), ~0);
   }
 
@@ -47,6 +112,72 @@ class CommandDataSpi : public CommandDataBus {
     writeBytes(params, size);
     writeEnd();
   }
+
+  bool canRead() const override { return MISO_PORT >= 0; }
+
+  void readStart(uint8_t cmd, int dummyBits) override {
+    writeStart(true);
+    writeBytes(&cmd, 1);
+    writeStart(false);
+    writeFreq = spi_get_baudrate(spi);
+    spi_set_baudrate(spi, readFreq);
+
+    uint8_t dummy;
+    for (int i = 0; i < dummyBits / 8; i++) {
+      spi_read_blocking(spi, 0, &dummy, 1);
+    }
+    // the data is not byte aligned, keep the partial byte
+    readShift = dummyBits % 8;
+    if (readShift) {
+      spi_read_blocking(spi, 0, &readCarry, 1);
+    }
+  }
+
+  void readBytes(uint8_t *data, size_t length) override {
+    spi_read_blocking(spi, 0, data, length);
+    if (readShift == 0) return;
+    for (size_t i = 0; i < length; i++) {
+      uint8_t b = data[i];
+      data[i] = (readCarry << readShift) | (b >> (8 - readShift));
+      readCarry = b;
+    }
+  }
+
+  void writeCommandList(const InitCommand *cmds, size_t size) override {
+    // CS stays asserted, only DC toggles between opcode and parameters
+    for (size_t i = 0; i < size; i++) {
+      writeStart(true);
+      writeBytes(&cmds[i].cmd, 1);
+      writeStart(false);
+      writeBytes(cmds[i].params, cmds[i].numParams);
+    }
+    writeEnd();
+  }
+
+ private:
+  int dmaCh = -1;
+  bool dmaActive = false;
+  uint32_t writeFreq = 0;  // to be restored after a read
+  int readShift = 0;
+  uint8_t readCarry = 0;
+
+  void waitWrite() {
+    if (!dmaActive) return;
+    dma_channel_wait_for_finish_blocking(dmaCh);
+    while (spi_is_busy(spi)) {
+      tight_loop_contents();
+    }
+    finishDma();
+  }
+
+  void finishDma() {
+    // discard what was received during the transfer
+    while (spi_is_readable(spi)) {
+      (void)spi_get_hw(spi)->dr;
+    }
+    spi_get_hw(spi)->icr = SPI_SSPICR_RORIC_BITS;
+    dmaActive = false;
+  }
 };
 
 }  // namespace rawdisp
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/compression.hpp"
+#include "rawdisp/staged_pixels.hpp"
+
+namespace rawdisp {
+
+// Decodes into a staging buffer and sends it to the current window.
+// TDecoder needs `size_t read(uint8_t *dst, size_t capacity)`.
+template <size_t BUFF_SIZE = 512, typename TDisplay, typename TDecoder>
+static inline void writeDecodedPixels(TDisplay &display, TDecoder &decoder,
+                                      int plane = 0) {
+  writeStagedPixels<BUFF_SIZE>(
+      display,
+      [&decoder](uint8_t *dst, size_t capacity) {
+        return decoder.read(dst, capacity);
+      },
+      plane);
+}
+
+}  // namespace rawdisp
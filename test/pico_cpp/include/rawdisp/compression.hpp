@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rawdisp {
+
+// Compression method of an asset generated with a compression option.
+enum class Compression : uint8_t {
+  NONE = 0,
+  RLE = 1,
+  LZ77 = 2,
+};
+
+// Header preceding compressed data:
+//   [0]    method
+//   [1]    method specific parameter (LZ77: window size in bits)
+//   [2..5] decompressed size, little endian
+struct CompressedHeader {
+  static constexpr size_t SIZE = 6;
+
+  Compression method;
+  uint8_t param;
+  uint32_t originalSize;
+
+  static bool parse(const uint8_t *data, size_t size, CompressedHeader *hdr) {
+    if (size < SIZE) return false;
+    hdr->method = static_cast<Compression>(data[0]);
+    hdr->param = data[1];
+    hdr->originalSize = (uint32_t)data[2] | ((uint32_t)data[3] << 8) |
+                        ((uint32_t)data[4] << 16) | ((uint32_t)data[5] << 24);
+    return true;
+  }
+};
+
+}  // namespace rawdisp
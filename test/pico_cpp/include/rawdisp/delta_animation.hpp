@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace rawdisp {
+
+// Read-only view of a delta animation generated with the animation
+// option. Frame 0 is a keyframe covering the whole area, every later
+// frame holds only the rectangle that changed since the previous one.
+// Layout, little endian:
+//   header (12 bytes):
+//     [0..3]   magic "RDAN"
+//     [4]      version
+//     [5]      number of planes
+//     [6..7]   number of frames
+//     [8..9]   width
+//     [10..11] height
+//   frame table (16 bytes per frame):
+//     [0..7]   x, y, width, height of the rectangle, 16 bits each,
+//              width and height are 0 if nothing changed
+//     [8..11]  data offset from the start of the animation
+//     [12..15] data size per plane
+// The planes of a rectangle follow each other, each packed as a plain
+// asset of the rectangle size.
+class DeltaAnimation {
+ public:
+  static constexpr uint8_t VERSION = 1;
+  static constexpr size_t HEADER_SIZE = 12;
+  static constexpr size_t FRAME_ENTRY_SIZE = 16;
+
+  struct Frame {
+    int x;
+    int y;
+    int width;
+    int height;
+    const uint8_t *data;
+    size_t planeSize;
+
+    inline bool changed() const { return width > 0 && height > 0; }
+  };
+
+  const uint8_t *const data;
+
+  DeltaAnimation(const uint8_t *data, size_t size) : data(data) {
+    isValid = validate(size);
+  }
+
+  inline bool valid() const { return isValid; }
+  inline int numPlanes() const { return isValid ? data[5] : 0; }
+  inline int numFrames() const { return isValid ? read16(data + 6) : 0; }
+  inline int width() const { return isValid ? read16(data + 8) : 0; }
+  inline int height() const { return isValid ? read16(data + 10) : 0; }
+
+  Frame frame(int i) const {
+    const uint8_t *e = data + HEADER_SIZE + FRAME_ENTRY_SIZE * i;
+    Frame f;
+    f.x = read16(e);
+    f.y = read16(e + 2);
+    f.width = read16(e + 4);
+    f.height = read16(e + 6);
+    f.data = data + read32(e + 8);
+    f.planeSize = read32(e + 12);
+    return f;
+  }
+
+  // Sends frame `i` with the animation placed at (x, y). The display has
+  // to show frame i - 1 already, unless i is 0. Returns the number of
+  // bytes sent.
+  template <typename TDisplay>
+  size_t drawFrame(TDisplay &display, int i, int x, int y) const {
+    Frame f = frame(i);
+    if (!f.changed()) return 0;
+    display.setWindow(x + f.x, y + f.y, f.width, f.height);
+    for (int p = 0; p < numPlanes(); p++) {
+      display.writePixels(f.data + f.planeSize * p, f.planeSize, p);
+    }
+    return f.planeSize * numPlanes();
+  }
+
+ private:
+  bool isValid;
+
+  static inline uint32_t read16(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+  }
+  static inline uint32_t read32(const uint8_t *p) {
+    return read16(p) | (read16(p + 2) << 16);
+  }
+
+  bool validate(size_t size) const {
+    if (size < HEADER_SIZE) return false;
+    if (memcmp(data, "RDAN", 4) != 0 || data[4] != VERSION) return false;
+    int n = read16(data + 6);
+    if (n == 0 || data[5] == 0) return false;
+    if (HEADER_SIZE + FRAME_ENTRY_SIZE * n > size) return false;
+
+    int w = read16(data + 8), h = read16(data + 10);
+    for (int i = 0; i < n; i++) {
+      const uint8_t *e = data + HEADER_SIZE + FRAME_ENTRY_SIZE * i;
+      int fx = read16(e), fy = read16(e + 2);
+      int fw = read16(e + 4), fh = read16(e + 6);
+      if (fx + fw > w || fy + fh > h) return false;
+      // the keyframe has to cover everything
+      if (i == 0 && (fw != w || fh != h)) return false;
+      size_t offset = read32(e + 8);
+      size_t len = (size_t)read32(e + 12) * data[5];
+      if (offset > size || len > size - offset) return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/delta_animation.hpp"
+#include "rawdisp/frame_scheduler.hpp"
+
+namespace rawdisp {
+
+// Plays a DeltaAnimation on a display with the animation placed at
+// (x, y). Deltas only make sense in order, so when the scheduler drops
+// frames the skipped deltas are sent together in the next slot. Looping
+// starts over from the keyframe.
+template <typename TDisplay>
+class DeltaPlayer {
+ public:
+  TDisplay &display;
+  const DeltaAnimation &anim;
+  const int x;
+  const int y;
+  bool loop = true;
+
+  uint64_t bytesSent = 0;
+  uint32_t framesDrawn = 0;
+
+  DeltaPlayer(TDisplay &display, const DeltaAnimation &anim, int x, int y)
+      : display(display), anim(anim), x(x), y(y) {}
+
+  // Forgets what is on the screen, the next seek() starts from the
+  // keyframe.
+  inline void reset() { current = -1; }
+
+  // Brings the display to frame `frame` of the timeline, which is wrapped
+  // when looping and held at the last frame otherwise.
+  void seek(uint32_t frame) {
+    int n = anim.numFrames();
+    if (n == 0) return;
+    int target = loop ? frame % n : (frame < (uint32_t)n ? frame : n - 1);
+    if (current < 0 || target < current) {
+      draw(0);
+      current = 0;
+    }
+    while (current < target) {
+      draw(++current);
+    }
+  }
+
+  // Plays `numFrames` frame slots at the scheduler's frame rate.
+  void play(FrameScheduler &sched, uint32_t numFrames) {
+    reset();
+    sched.run(numFrames, render, transfer, this);
+  }
+
+ private:
+  int current = -1;
+  uint32_t target = 0;
+
+  inline void draw(int i) {
+    bytesSent += anim.drawFrame(display, i, x, y);
+    framesDrawn++;
+  }
+
+  // nothing to render, the frames are stored ready to send
+  static void render(void *ctx, uint32_t frame) {
+    static_cast<DeltaPlayer *>(ctx)->target = frame;
+  }
+
+  static void transfer(void *ctx) {
+    DeltaPlayer *self = static_cast<DeltaPlayer *>(ctx);
+    self->seek(self->target);
+  }
+};
+
+}  // namespace rawdisp
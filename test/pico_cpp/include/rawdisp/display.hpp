@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 
+#include "rawdisp/asset_desc.hpp"
 #include "rawdisp/gpio.hpp"
 #include "rawdisp/rawdisp_common.hpp"
 
@@ -27,6 +28,24 @@ class Display {
         format(cfg.format),
         resetPort(cfg.resetPort) {}
 
+  // Whether every row of a window starts on a new byte of display RAM, as
+  // on controllers addressing X in bytes. Otherwise the rows of a window
+  // are one continuous pixel stream.
+  static constexpr bool BYTE_ADDRESSED_ROWS = false;
+
+  // Whether the current rotation fills display RAM a column at a time,
+  // which row-ordered blitting can't follow. Drivers that rotate that way
+  // hide this.
+  bool scansColumns() const { return false; }
+
+  // Whether the asset can be drawn on a display of `cfg` as it is. Drivers
+  // whose memory layout differs from PixelFormatTraits hide this.
+  static constexpr bool isNativeAsset(const DisplayConfig &cfg,
+                                      const AssetDesc &asset) {
+    return asset.isNativeTo(cfg.format) &&
+           asset.fitsIn(cfg.width, cfg.height);
+  }
+
   virtual void init() {
     if (resetPort >= 0) {
       gpio::init(resetPort);
@@ -35,7 +54,25 @@ class Display {
   }
 
   virtual void setWindow(int x, int y, int w, int h) = 0;
-  virtual void writePixels(const void *data, size_t length, int plane = 0) = 0;
+
+  // Streaming pixel write. The data of one beginPixels() ... endPixels()
+  // span is sent as a single memory write, in as many pushes as needed.
+  virtual void beginPixels(int plane = 0) = 0;
+  virtual void pushPixels(const void *data, size_t length) = 0;
+  virtual void endPixels() = 0;
+
+  void writePixels(const void *data, size_t length, int plane = 0) {
+    beginPixels(plane);
+    pushPixels(data, length);
+    endPixels();
+  }
+
+  // Reads back the window from the display memory in the same layout as
+  // writePixels() takes. Returns false if the display or bus can't read.
+  virtual bool readPixels(int x, int y, int w, int h, void *data,
+                          size_t length) {
+    return false;
+  }
 
   inline void clipRect(int *x, int *y, int *w, int *h) {
     clipCoord(x, w, width);
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rawdisp/command_data_display.hpp"
+#include "rawdisp/rawdisp_common.hpp"
+#include "rawdisp/timer.hpp"
+
+namespace rawdisp {
+
+// Drives several displays on independent buses at the same time. Each
+// frame is sent in slices, so a DMA transfer on one SPI keeps running while
+// another bus is served. Displays sharing a peripheral take turns in
+// priority order.
+class DisplayManager {
+ public:
+  static constexpr int MAX_PANELS = 8;
+  static constexpr size_t DEFAULT_SLICE_BYTES = 4096;
+
+  struct Panel {
+    const char *name;
+    CommandDataDisplay *display;
+    int priority;       // higher is served first
+    size_t sliceBytes;  // bytes per bus transfer
+
+    // current frame
+    const uint8_t *data;
+    size_t length;
+    size_t sent;
+    int plane;
+    int x, y, w, h;
+    bool pending;
+    bool active;
+
+    // statistics
+    uint32_t frames;
+    uint64_t bytes;
+    uint64_t busyUs;
+    uint64_t frameStartUs;
+  };
+
+  Panel panels[MAX_PANELS];
+  int numPanels = 0;
+  uint64_t totalBytes = 0;
+  uint64_t totalUs = 0;
+
+  // Returns the panel id, or -1 when full. Use a small slice for slow
+  // buses that have no DMA (I2C) so that they don't hold up the others.
+  int add(const char *name, CommandDataDisplay &display, int priority = 0,
+          size_t sliceBytes = DEFAULT_SLICE_BYTES) {
+    if (numPanels >= MAX_PANELS) return -1;
+    Panel p = {};
+    p.name = name;
+    p.display = &display;
+    p.priority = priority;
+    p.sliceBytes = sliceBytes;
+    panels[numPanels] = p;
+    return numPanels++;
+  }
+
+  // Queues a frame. Returns false if the panel still has one queued.
+  bool submit(int id, int x, int y, int w, int h, const void *data,
+              size_t length, int plane = 0) {
+    if (id < 0 || id >= numPanels) return false;
+    Panel &p = panels[id];
+    if (p.pending) return false;
+    p.data = static_cast<const uint8_t *>(data);
+    p.length = length;
+    p.sent = 0;
+    p.plane = plane;
+    p.x = x;
+    p.y = y;
+    p.w = w;
+    p.h = h;
+    p.pending = true;
+    return true;
+  }
+
+  // Advances all buses without waiting. Returns true when all are idle.
+  bool poll() {
+    bool idle = true;
+    const void *served[MAX_PANELS];
+    int numServed = 0;
+    // buses of high priority panels are kicked first
+    while (true) {
+      const Panel *best = nullptr;
+      for (int i = 0; i < numPanels; i++) {
+        const Panel &p = panels[i];
+        if (contains(served, numServed, p.display->bus.peripheral())) continue;
+        if (!best || p.priority > best->priority) best = &p;
+      }
+      if (!best) break;
+      const void *periph = best->display->bus.peripheral();
+      served[numServed++] = periph;
+      idle &= pollBus(periph);
+    }
+    return idle;
+  }
+
+  // Sends all queued frames.
+  void run() {
+    uint64_t startUs = timer::nowUs();
+    uint64_t startBytes = queuedBytes();
+    while (!poll()) {
+      tight_loop_contents();
+    }
+    totalUs = timer::nowUs() - startUs;
+    totalBytes = startBytes;
+  }
+
+  void printReport() const {
+    for (int i = 0; i < numPanels; i++) {
+      const Panel &p = panels[i];
+      uint32_t kbps = p.busyUs ? p.bytes * 1000 / p.busyUs : 0;
+      printf("%-8s prio %d: %lu frames, %llu bytes, %llu us busy, %lu KB/s\n",
+             p.name, p.priority, (unsigned long)p.frames,
+             (unsigned long long)p.bytes, (unsigned long long)p.busyUs,
+             (unsigned long)kbps);
+    }
+    uint32_t kbps = totalUs ? totalBytes * 1000 / totalUs : 0;
+    printf("total: %llu bytes in %llu us, %lu KB/s\n",
+           (unsigned long long)totalBytes, (unsigned long long)totalUs,
+           (unsigned long)kbps);
+  }
+
+ private:
+  static bool contains(const void *const *list, int size, const void *item) {
+    for (int i = 0; i < size; i++) {
+      if (list[i] == item) return true;
+    }
+    return false;
+  }
+
+  uint64_t queuedBytes() const {
+    uint64_t bytes = 0;
+    for (int i = 0; i < numPanels; i++) {
+      const Panel &p = panels[i];
+      if (p.pending || p.active) bytes += p.length - p.sent;
+    }
+    return bytes;
+  }
+
+  void sendSlice(Panel &p) {
+    size_t n = p.length - p.sent;
+    if (n > p.sliceBytes) n = p.sliceBytes;
+    p.display->bus.writeBytesAsync(p.data + p.sent, n);
+    p.sent += n;
+    p.bytes += n;
+  }
+
+  // Serves the displays on one peripheral. Returns true when it is idle.
+  bool pollBus(const void *periph) {
+    Panel *active = nullptr;
+    for (int i = 0; i < numPanels; i++) {
+      Panel &p = panels[i];
+      if (p.active && p.display->bus.peripheral() == periph) active = &p;
+    }
+
+    if (active) {
+      if (active->display->bus.isWriteBusy()) return false;
+      if (active->sent < active->length) {
+        sendSlice(*active);
+        return false;
+      }
+      active->display->endPixels();
+      active->busyUs += timer::nowUs() - active->frameStartUs;
+      active->frames++;
+      active->active = false;
+    }
+
+    Panel *next = nullptr;
+    for (int i = 0; i < numPanels; i++) {
+      Panel &p = panels[i];
+      if (!p.pending || p.display->bus.peripheral() != periph) continue;
+      if (!next || p.priority > next->priority) next = &p;
+    }
+    if (!next) return true;
+
+    next->pending = false;
+    next->active = true;
+    next->frameStartUs = timer::nowUs();
+    next->display->setWindow(next->x, next->y, next->w, next->h);
+    next->display->beginPixels(next->plane);
+    sendSlice(*next);
+    return false;
+  }
+};
+
+}  // namespace rawdisp
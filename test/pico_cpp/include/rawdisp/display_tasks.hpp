@@ -0,0 +1,44 @@
+#pragma once
+
+#include "rawdisp/command_data_display.hpp"
+#include "rawdisp/power_managed_epd.hpp"
+#include "rawdisp/ssd1680.hpp"
+#include "rawdisp/task.hpp"
+
+namespace rawdisp {
+
+// Coroutine versions of the blocking display operations. Resets, sleeps
+// and BUSY waits suspend the task instead of the core.
+
+// Runs the init sequence of the display, same as init() when the driver
+// does not support beginInit().
+inline Task initTask(CommandDataDisplay &display) {
+  display.beginInit();
+  while (!display.poll()) {
+    if (display.isBusy()) {
+      co_await waitUntil([&display]() { return !display.isBusy(); });
+    } else {
+      co_await sleepUntilUs(display.initDeadlineUs());
+    }
+  }
+}
+
+// Refreshes the panel and waits for BUSY to be released.
+inline Task refreshTask(SSD1680 &display) {
+  display.startUpdateDisplay();
+  if (display.busyPort < 0) {
+    co_await sleepMs(500);
+    co_return;
+  }
+  co_await waitUntil([&display]() { return !display.isBusy(); });
+  co_await sleepMs(50);
+}
+
+inline Task refreshTask(PowerManagedEpd &display) {
+  display.startUpdateDisplay();
+  co_await sleepMs(100);
+  co_await waitUntil([&display]() { return !display.isBusy(); });
+  display.service();
+}
+
+}  // namespace rawdisp
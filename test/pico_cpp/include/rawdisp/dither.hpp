@@ -0,0 +1,244 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rawdisp/rawdisp_common.hpp"
+
+namespace rawdisp {
+
+// Same values as the generator.
+enum class DitherMethod : uint8_t {
+  NONE = 0,
+  DIFFUSION = 1,
+  PATTERN = 2,
+};
+
+enum class DiffusionKernel : uint8_t {
+  FLOYD_STEINBERG = 0,
+  JARVIS_JUDICE_NINKE = 1,
+  STUCKI = 2,
+  SIERRA = 3,
+};
+
+// Error diffusion weights of rows y .. y + 2 and columns x - 2 .. x + 2
+// in the scan direction, the same kernels as Reducer.ts.
+struct DiffusionWeights {
+  uint8_t weights[15];
+  uint8_t divisor;
+  uint8_t numRows;
+};
+
+static constexpr DiffusionWeights DIFFUSION_WEIGHTS[] = {
+    {{0, 0, 0, 7, 0, 0, 3, 5, 1, 0, 0, 0, 0, 0, 0}, 16, 2},
+    {{0, 0, 0, 7, 5, 3, 5, 7, 5, 3, 1, 3, 5, 3, 1}, 48, 3},
+    {{0, 0, 0, 8, 4, 2, 4, 8, 4, 2, 1, 2, 4, 2, 1}, 42, 3},
+    {{0, 0, 0, 5, 3, 2, 4, 5, 4, 2, 0, 2, 3, 2, 0}, 32, 3},
+};
+
+// 4x4 ordered pattern, threshold k stands for (k + 0.5) / 16
+static constexpr uint8_t DITHER_PATTERN_4X4[16] = {
+    0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5,
+};
+
+// Packs palette indices, BITS each, the first pixel in the MSBs. BW with
+// a black and white palette and the 2 bpp KWRY panels take this.
+template <int BITS>
+static inline void packIndices(const uint8_t *indices, int n, uint8_t *dst) {
+  constexpr int PER_BYTE = 8 / BITS;
+  for (int i = 0; i < n; i += PER_BYTE) {
+    uint8_t b = 0;
+    for (int k = 0; k < PER_BYTE; k++) {
+      b <<= BITS;
+      if (i + k < n) b |= indices[i + k];
+    }
+    *(dst++) = b;
+  }
+}
+
+// Packs a 1 bpp plane with the bits set where the index is `match`, as the
+// INDEX_MATCH planes of the black/white/red preset.
+static inline void packIndexMatch(const uint8_t *indices, int n,
+                                  uint8_t match, uint8_t *dst) {
+  for (int i = 0; i < n; i += 8) {
+    uint8_t b = 0;
+    for (int k = 0; k < 8; k++) {
+      b <<= 1;
+      if (i + k < n && indices[i + k] == match) b |= 1;
+    }
+    *(dst++) = b;
+  }
+}
+
+// Streaming ditherer of RGB888 rows to the nearest colors of a small
+// palette, for content drawn at run time. Rows are fed top to bottom and
+// scanned in alternating directions like reduce() of the generator. The
+// diffused error is kept in fixed point, scaled by the kernel divisor,
+// for only the rows the kernel reaches.
+template <int MAX_WIDTH, int MAX_COLORS = 16>
+class Ditherer {
+ public:
+  // strength in 1/256, 205 is the generator default of 0.8
+  static constexpr int DEFAULT_STRENGTH = 205;
+
+  const int width;
+  const int numColors;
+  const DitherMethod method;
+  const DiffusionWeights &diffusion;
+  const int strength;
+
+  // `palette` is RGB888, 3 bytes per color.
+  Ditherer(const uint8_t *palette, int numColors, int width,
+           DitherMethod method = DitherMethod::DIFFUSION,
+           DiffusionKernel kernel = DiffusionKernel::STUCKI,
+           int strength = DEFAULT_STRENGTH)
+      : width(width < MAX_WIDTH ? width : MAX_WIDTH),
+        numColors(numColors < MAX_COLORS ? numColors : MAX_COLORS),
+        method(method),
+        diffusion(DIFFUSION_WEIGHTS[(int)kernel]),
+        strength(strength) {
+    for (int i = 0; i < this->numColors; i++) {
+      for (int ch = 0; ch < 3; ch++) {
+        colors[i][ch] = palette[i * 3 + ch];
+      }
+    }
+    // round(65536 / divisor)
+    recip = (65536 + diffusion.divisor / 2) / diffusion.divisor;
+    if (method == DitherMethod::PATTERN) initPattern();
+    reset();
+  }
+
+  // Starts over from the top row.
+  void reset() {
+    memset(errors, 0, sizeof(errors));
+    row = 0;
+  }
+
+  // Dithers one row, returns one palette index per pixel, valid until the
+  // next call.
+  const uint8_t *ditherRow(const uint8_t *rgb) {
+    if (method == DitherMethod::DIFFUSION) {
+      diffuseRow(rgb);
+    } else {
+      int py = (row & 3) * 4;
+      for (int x = 0; x < width; x++) {
+        const uint8_t *p = rgb + x * 3;
+        int v[3] = {p[0], p[1], p[2]};
+        if (method == DitherMethod::PATTERN) {
+          const int16_t *ofs = patternOffsets[py + (x & 3)];
+          for (int ch = 0; ch < 3; ch++) v[ch] = clamp(v[ch] + ofs[ch]);
+        }
+        indices[x] = nearest(v);
+      }
+    }
+    row++;
+    return indices;
+  }
+
+  // Same as above, packed BITS per pixel into `dst`.
+  template <int BITS>
+  void ditherRow(const uint8_t *rgb, uint8_t *dst) {
+    packIndices<BITS>(ditherRow(rgb), width, dst);
+  }
+
+  // Same as above, split into the white and red planes of KR11.
+  void ditherRowKr11(const uint8_t *rgb, uint8_t *white, uint8_t *red,
+                     uint8_t whiteIndex = 1, uint8_t redIndex = 2) {
+    const uint8_t *idx = ditherRow(rgb);
+    packIndexMatch(idx, width, whiteIndex, white);
+    packIndexMatch(idx, width, redIndex, red);
+  }
+
+ private:
+  // 2 pixels of margin on both sides take the error that falls outside
+  static constexpr int PAD = 2;
+  static constexpr int ROWS = 3;
+
+  int16_t colors[MAX_COLORS][3];
+  int16_t patternOffsets[16][3];
+  int16_t errors[ROWS][MAX_WIDTH + PAD * 2][3];
+  uint8_t indices[MAX_WIDTH];
+  int32_t recip;
+  int row = 0;
+
+  static RAWDISP_INLINE int clamp(int v) {
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+  }
+
+  int nearest(const int *v) const {
+    int best = 0;
+    int32_t bestDist = INT32_MAX;
+    for (int i = 0; i < numColors; i++) {
+      int dr = v[0] - colors[i][0];
+      int dg = v[1] - colors[i][1];
+      int db = v[2] - colors[i][2];
+      int32_t dist = dr * dr + dg * dg + db * db;
+      if (dist < bestDist) {
+        bestDist = dist;
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  // Pattern amplitude per channel: the palette range divided by the
+  // levels per channel, as getAverageStep() of IndexedPalette.
+  void initPattern() {
+    int levels = 2;
+    while ((levels + 1) * (levels + 1) * (levels + 1) <= numColors) levels++;
+    for (int ch = 0; ch < 3; ch++) {
+      int lo = 255, hi = 0;
+      for (int i = 0; i < numColors; i++) {
+        if (colors[i][ch] < lo) lo = colors[i][ch];
+        if (colors[i][ch] > hi) hi = colors[i][ch];
+      }
+      int step = (hi - lo > 26 ? hi - lo : 26) / (levels - 1);
+      for (int k = 0; k < 16; k++) {
+        int t = 2 * DITHER_PATTERN_4X4[k] + 1 - 16;  // in 1/32
+        patternOffsets[k][ch] = step * t * strength / (32 * 256);
+      }
+    }
+  }
+
+  void diffuseRow(const uint8_t *rgb) {
+    const int rows = diffusion.numRows;
+    const bool fwd = (row & 1) == 0;
+    const int dir = fwd ? 1 : -1;
+    int16_t(*cur)[3] = errors[row % rows] + PAD;
+    for (int i = 0; i < width; i++) {
+      int x = fwd ? i : width - 1 - i;
+      const uint8_t *p = rgb + x * 3;
+      int v[3];
+      for (int ch = 0; ch < 3; ch++) {
+        int e = (cur[x][ch] * recip + 32768) >> 16;
+        v[ch] = clamp(p[ch] + e);
+      }
+      int idx = nearest(v);
+      indices[x] = idx;
+
+      int e[3];
+      bool any = false;
+      for (int ch = 0; ch < 3; ch++) {
+        e[ch] = (v[ch] - colors[idx][ch]) * strength / 256;
+        any |= e[ch] != 0;
+      }
+      if (!any) continue;
+      for (int ky = 0; ky < rows; ky++) {
+        int16_t(*target)[3] = errors[(row + ky) % rows] + PAD + x;
+        for (int kx = -2; kx <= 2; kx++) {
+          int w = diffusion.weights[ky * 5 + kx + 2];
+          if (w == 0) continue;
+          int16_t *t = target[kx * dir];
+          t[0] += e[0] * w;
+          t[1] += e[1] * w;
+          t[2] += e[2] * w;
+        }
+      }
+    }
+    // this row's slot takes the row after the last one reached
+    memset(errors[row % rows], 0, sizeof(errors[0]));
+  }
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rawdisp/timer.hpp"
+
+namespace rawdisp {
+
+struct FrameStats {
+  static constexpr int HISTOGRAM_BINS = 64;
+  static constexpr uint32_t BIN_US = 1000;
+
+  uint32_t frames = 0;
+  uint32_t drops = 0;  // frames skipped because the previous one was late
+  uint32_t late = 0;   // frames that took longer than the period
+  uint64_t renderUsSum = 0;
+  uint64_t transferUsSum = 0;
+  uint32_t maxFrameUs = 0;
+  // frame times in BIN_US steps, the last bin collects everything above
+  uint32_t histogram[HISTOGRAM_BINS] = {};
+
+  void add(uint32_t renderUs, uint32_t transferUs, uint32_t periodUs) {
+    uint32_t frameUs = renderUs + transferUs;
+    frames++;
+    renderUsSum += renderUs;
+    transferUsSum += transferUs;
+    if (frameUs > maxFrameUs) maxFrameUs = frameUs;
+    if (frameUs > periodUs) late++;
+    uint32_t bin = frameUs / BIN_US;
+    if (bin >= HISTOGRAM_BINS) bin = HISTOGRAM_BINS - 1;
+    histogram[bin]++;
+  }
+
+  inline uint32_t meanRenderUs() const {
+    return frames ? renderUsSum / frames : 0;
+  }
+
+  inline uint32_t meanTransferUs() const {
+    return frames ? transferUsSum / frames : 0;
+  }
+
+  inline uint32_t meanFrameUs() const {
+    return frames ? (renderUsSum + transferUsSum) / frames : 0;
+  }
+
+  // upper edge of the bin containing the given percentile
+  uint32_t percentileUs(int percent) const {
+    uint32_t target = ((uint64_t)frames * percent + 99) / 100;
+    uint32_t count = 0;
+    for (int i = 0; i < HISTOGRAM_BINS; i++) {
+      count += histogram[i];
+      if (count >= target && count > 0) {
+        uint32_t edge = (i + 1) * BIN_US;
+        return edge < maxFrameUs ? edge : maxFrameUs;
+      }
+    }
+    return 0;
+  }
+
+  void print(const char *name) const {
+    printf("%s: %lu frames, %lu dropped, %lu late\n", name,
+           (unsigned long)frames, (unsigned long)drops, (unsigned long)late);
+    printf("  render %lu us, transfer %lu us (mean)\n",
+           (unsigned long)meanRenderUs(), (unsigned long)meanTransferUs());
+    printf("  frame mean %lu us, p99 %lu us, max %lu us\n",
+           (unsigned long)meanFrameUs(), (unsigned long)percentileUs(99),
+           (unsigned long)maxFrameUs);
+  }
+};
+
+// Runs render/transfer callbacks at a fixed frame rate. When a frame runs
+// late, the frames whose slots have already passed are dropped and the
+// next one is rendered for the current time, so animation keeps its speed.
+class FrameScheduler {
+ public:
+  // draws frame number `frame` of the animation into a buffer
+  typedef void (*RenderFunc)(void *ctx, uint32_t frame);
+  // sends the rendered frame to the display
+  typedef void (*TransferFunc)(void *ctx);
+
+  uint32_t periodUs;
+  FrameStats stats;
+
+  FrameScheduler(uint32_t fps) { setFps(fps); }
+
+  void setFps(uint32_t fps) { periodUs = 1000000 / fps; }
+
+  void start() {
+    stats = FrameStats();
+    frame = 0;
+    nextUs = timer::nowUs();
+  }
+
+  // Waits for the next slot and runs one frame. Returns the frame number.
+  uint32_t step(RenderFunc render, TransferFunc transfer, void *ctx) {
+    uint64_t now = timer::nowUs();
+    if ((int64_t)(now - nextUs) >= (int64_t)periodUs) {
+      // coalesce all frames whose slot has passed
+      uint32_t missed = (now - nextUs) / periodUs;
+      stats.drops += missed;
+      frame += missed;
+      nextUs += (uint64_t)missed * periodUs;
+    } else if (now < nextUs) {
+      timer::sleepUs(nextUs - now);
+    }
+
+    uint64_t t0 = timer::nowUs();
+    render(ctx, frame);
+    uint64_t t1 = timer::nowUs();
+    if (transfer) transfer(ctx);
+    uint64_t t2 = timer::nowUs();
+    stats.add(t1 - t0, t2 - t1, periodUs);
+
+    nextUs += periodUs;
+    return frame++;
+  }
+
+  // Runs until `numFrames` frame slots have elapsed, dropped ones included.
+  void run(uint32_t numFrames, RenderFunc render, TransferFunc transfer,
+           void *ctx) {
+    start();
+    while (frame < numFrames) {
+      step(render, transfer, ctx);
+    }
+  }
+
+ private:
+  uint32_t frame = 0;
+  uint64_t nextUs = 0;
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/palette_expander.hpp"
+#include "rawdisp/staged_pixels.hpp"
+
+namespace rawdisp {
+
+// Expands indexed pixels through a staging buffer and sends them to the
+// current window. Rows must fill whole source bytes.
+template <size_t BUFF_SIZE = 512, typename TDisplay, PixelFormat F,
+          int INDEX_BITS>
+static inline void writeIndexedPixels(
+    TDisplay &display, const PaletteExpander<F, INDEX_BITS> &expander,
+    const uint8_t *data, size_t size) {
+  using TExpander = PaletteExpander<F, INDEX_BITS>;
+  constexpr size_t SRC_CHUNK = TExpander::srcChunkFor(BUFF_SIZE);
+  static_assert(SRC_CHUNK > 0, "BUFF_SIZE is smaller than a group");
+
+  writeStagedPixels<BUFF_SIZE>(display, [&](uint8_t *dst, size_t) {
+    size_t n = size < SRC_CHUNK ? size : SRC_CHUNK;
+    size_t len = n > 0 ? expander.expand(data, n, dst) : 0;
+    data += n;
+    size -= n;
+    return len;
+  });
+}
+
+}  // namespace rawdisp
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rawdisp {
+
+static constexpr int INIT_MAX_PARAMS = 7;
+
+enum class InitOp : uint8_t {
+  COMMAND,
+  RESET_ASSERT,
+  RESET_RELEASE,
+};
+
+// One entry of a controller initialization table. Tables are declared
+// constexpr so that they are placed in flash.
+struct InitCommand {
+  InitOp op = InitOp::COMMAND;
+  uint8_t cmd = 0;
+  uint8_t numParams = 0;
+  uint8_t params[INIT_MAX_PARAMS] = {};
+  bool busyWait = false;
+  uint16_t delayMs = 0;
+
+  constexpr InitCommand() {}
+
+  template <typename TCommand, typename... TParams>
+  constexpr InitCommand(TCommand cmd, TParams... params)
+      : cmd(static_cast<uint8_t>(cmd)),
+        numParams(sizeof...(params)),
+        params{static_cast<uint8_t>(params)...} {
+    static_assert(sizeof...(params) <= INIT_MAX_PARAMS, "too many params");
+  }
+
+  // drives the reset pin instead of sending a command, skipped (including
+  // its delay) when the display has no reset pin
+  static constexpr InitCommand reset(bool assert) {
+    InitCommand ret;
+    ret.op = assert ? InitOp::RESET_ASSERT : InitOp::RESET_RELEASE;
+    return ret;
+  }
+
+  // delay after the command
+  constexpr InitCommand wait(uint16_t ms) const {
+    InitCommand ret = *this;
+    ret.delayMs = ms;
+    return ret;
+  }
+
+  // wait for BUSY to be released after the command
+  constexpr InitCommand waitBusy() const {
+    InitCommand ret = *this;
+    ret.busyWait = true;
+    return ret;
+  }
+
+  inline bool needsWait() const { return busyWait || delayMs > 0; }
+};
+
+}  // namespace rawdisp
@@ -2,13 +2,13 @@
 
 #include <stdint.h>
 
-#include "rawdisp/command_data_display.hpp"
 #include "rawdisp/command_data_spi.hpp"
 #include "rawdisp/gpio.hpp"
+#include "rawdisp/power_managed_epd.hpp"
 
 namespace rawdisp {
 
-class IST7163 : public CommandDataDisplay {
+class IST7163 : public PowerManagedEpd {
  public:
   enum class Command : uint8_t {
     PANEL_SETTING = 0x00,
@@ -55,16 +55,50 @@ class IST7163 : public CommandDataDisplay {
     TEST_MODE = 0xFF,
   };
 
-  const int busyPort;
-  const int pwrPort;
-  const int rotation;
+  // settable, the driver outlives a single update
+  int rotation;
+
+  static constexpr InitCommand INIT_SEQ_POWER[] = {
+      InitCommand(Command::PANEL_SETTING, 0x0F, 0x29),
+      InitCommand(Command::POWER_SETTING, 0x07, 0x00, 0x22, 0x78, 0x0A, 0x22),
+      InitCommand(Command::POWER_SEQUENCE_SETTING, 0x10, 0x54, 0x44),
+      InitCommand(Command::BOOSTER_SOFT_START, 0xC0, 0xC0, 0xC0),
+      InitCommand(Command::PLL_CONTROL, 0x08),
+      InitCommand(Command::TEMPERATURE_SENSOR_ENABLE, 0x00),
+      InitCommand(Command::VCOM_AND_DATA_INTERVAL_SETTING, 0x37),
+      InitCommand(Command::TCON_SETTING, 0x02, 0x02),
+  };
+
+  // after RESOLUTION_SETTING
+  static constexpr InitCommand INIT_SEQ_POWER_ON[] = {
+      InitCommand(Command::GATE_SOURCE_START_SETTING, 0x00, 0x00, 0x00, 0x00),
+      InitCommand(static_cast<Command>(0xE7), 0x1C),  // Unknown
+      InitCommand(Command::POWER_SAVING, 0x22),       // Unknown
+      InitCommand(Command::TEST_MODE, 0xA5),
+      InitCommand(Command::TEST_POWER_PWM, 0x01, 0x1E, 0x0A, 0x1B, 0x0B, 0x17),
+      InitCommand(static_cast<Command>(0xC3), 0xFD),  // Unknown
+      InitCommand(static_cast<Command>(0xDC), 0x01),  // Unknown
+      InitCommand(static_cast<Command>(0xDD), 0x08),  // Unknown
+      InitCommand(static_cast<Command>(0xDE), 0x41),  // Unknown
+      InitCommand(Command::VDHOS_EN, 0x01),
+      InitCommand(Command::VDHOS_SELECT, 0x03),
+      InitCommand(static_cast<Command>(0xDA), 0x07),  // Unknown
+      InitCommand(Command::GDROTP, 0x00),
+      InitCommand(Command::VDHROS_EN, 0x0F),
+      InitCommand(Command::TEST_MODE, 0xE3),
+      InitCommand(static_cast<Command>(0xE9), 0x01),  // Unknown
+      InitCommand(Command::POWER_ON).waitBusy(),
+      InitCommand(Command::TEST_MODE, 0xA5),
+      InitCommand(Command::TEST_POWER_PWM, 0x03, 0x1E, 0x0A, 0x1B, 0x0E, 0x15),
+      InitCommand(Command::CPCK_SET_ENABLE, 0x01),
+      InitCommand(Command::CPCK_PWH_SET, 0x08),
+      InitCommand(Command::CPCK_PWL_SET, 0x41),
+      InitCommand(Command::TEST_MODE, 0xE3),
+  };
 
   IST7163(const DisplayConfig& cfg, CommandDataSpi& bus, int busyPort,
           int pwrPort, int rotation)
-      : CommandDataDisplay(bus, cfg),
-        busyPort(busyPort),
-        pwrPort(pwrPort),
-        rotation(rotation) {}
+      : PowerManagedEpd(bus, cfg, busyPort, pwrPort), rotation(rotation) {}
 
   inline void writeCommandArray(Command cmd, const uint8_t* data, size_t size) {
     bus.writeCommand(static_cast<uint8_t>(cmd), data, size);
@@ -92,25 +126,16 @@ class IST7163 : public CommandDataDisplay {
     writeCommandArray(cmd, params, sizeof(params));
   }
 
-  bool waitBusy() {
-    sleep_ms(100);
-    while (!gpio::read(busyPort)) {
-      sleep_ms(10);
-    }
-    return true;
+  void setWindow(int x, int y, int w, int h) override {
+    // none
   }
 
-  void init() override {
-    CommandDataDisplay::init();
-
-    gpio::init(busyPort);
-    gpio::setDir(busyPort, false);
-
-    gpio::init(pwrPort);
-    gpio::setDir(pwrPort, true);
-    gpio::write(pwrPort, true);
-    sleep_ms(100);
+  void beginPixels(int plane = 0) override {
+    beginPixelsWithCommand(static_cast<uint8_t>(Command::DATA_START_TRANS));
+  }
 
+ protected:
+  void hardReset() override {
     if (resetPort >= 0) {
       sleep_ms(200);
       gpio::write(resetPort, false);
@@ -119,23 +144,10 @@ class IST7163 : public CommandDataDisplay {
       sleep_ms(200);
       waitBusy();
     }
+  }
 
-    writeCommand(Command::PANEL_SETTING, 0x0F, 0x29);
-    {
-      const uint8_t params[] = {0x07, 0x00, 0x22, 0x78, 0x0A, 0x22};
-      writeCommandArray(Command::POWER_SETTING, params, sizeof(params));
-    }
-
-    writeCommand(Command::POWER_SEQUENCE_SETTING, 0x10, 0x54, 0x44);
-    writeCommand(Command::BOOSTER_SOFT_START, 0xC0, 0xC0, 0xC0);
-
-    writeCommand(Command::PLL_CONTROL, 0x08);
-
-    writeCommand(Command::TEMPERATURE_SENSOR_ENABLE, 0x00);
-
-    writeCommand(Command::VCOM_AND_DATA_INTERVAL_SETTING, 0x37);
-
-    writeCommand(Command::TCON_SETTING, 0x02, 0x02);
+  void configure() override {
+    writeInitSequence(INIT_SEQ_POWER);
 
     {
       const uint8_t wh = width >> 8;
@@ -145,48 +157,7 @@ class IST7163 : public CommandDataDisplay {
       writeCommand(Command::RESOLUTION_SETTING, wh, wl, hh, hl);
     }
 
-    writeCommand(Command::GATE_SOURCE_START_SETTING, 0x00, 0x00, 0x00, 0x00);
-
-    writeCommand(static_cast<Command>(0xE7), 0x1C);  // Unknown
-    writeCommand(Command::POWER_SAVING, 0x22);  // Unknown
-
-    writeCommand(Command::TEST_MODE, 0xA5);
-    {
-      const uint8_t params[] = {0x01, 0x1E, 0x0A, 0x1B, 0x0B, 0x17};
-      writeCommandArray(Command::TEST_POWER_PWM, params, sizeof(params));
-    }
-
-    writeCommand(static_cast<Command>(0xC3), 0xFD);  // Unknown
-    writeCommand(static_cast<Command>(0xDC), 0x01);  // Unknown
-    writeCommand(static_cast<Command>(0xDD), 0x08);  // Unknown
-    writeCommand(static_cast<Command>(0xDE), 0x41);  // Unknown
-
-    writeCommand(Command::VDHOS_EN, 0x01);
-    writeCommand(Command::VDHOS_SELECT, 0x03);
-
-    writeCommand(static_cast<Command>(0xDA), 0x07);  // Unknown
-
-    writeCommand(Command::GDROTP, 0x00);
-    writeCommand(Command::VDHROS_EN, 0x0F);
-
-    writeCommand(Command::TEST_MODE, 0xE3);
-
-    writeCommand(static_cast<Command>(0xE9), 0x01);  // Unknown
-
-    writeCommand(Command::POWER_ON);
-    waitBusy();
-
-    writeCommand(Command::TEST_MODE, 0xA5);
-    {
-      const uint8_t params[] = {0x03, 0x1E, 0x0A, 0x1B, 0x0E, 0x15};
-      writeCommandArray(Command::TEST_POWER_PWM, params, sizeof(params));
-    }
-
-    writeCommand(Command::CPCK_SET_ENABLE, 0x01);
-    writeCommand(Command::CPCK_PWH_SET, 0x08);
-    writeCommand(Command::CPCK_PWL_SET, 0x41);
-
-    writeCommand(Command::TEST_MODE, 0xE3);
+    writeInitSequence(INIT_SEQ_POWER_ON);
 
 #if 0
      writeCommand(Command::CHIP_TEMPERATURE_INPUT_SELECT, 0x02);
@@ -196,29 +167,12 @@ class IST7163 : public CommandDataDisplay {
 #endif
   }
 
-  void setWindow(int x, int y, int w, int h) override {
-    // none
-  }
-
-  void writePixels(const void* data, size_t length, int plane = -1) override {
-    uint8_t cmd = static_cast<uint8_t>(Command::DATA_START_TRANS);
-    bus.writeStart(true);
-    bus.writeBytes(&cmd, 1);
-    bus.writeStart(false);
-    bus.writeBytes(static_cast<const uint8_t*>(data), length);
-    bus.writeEnd();
-  }
-
-  void startUpdateDisplay() {
-    writeCommand(Command::DISPLAY_REFRESH, 0x00);
-  }
+  void refresh() override { writeCommand(Command::DISPLAY_REFRESH, 0x00); }
 
-  void powerOff() {
+  void enterDeepSleep() override {
     writeCommand(Command::POWER_OFF, 0x00);
     waitBusy();
     writeCommand(Command::DEEP_SLEEP, 0xA5);
-    sleep_ms(2000);  // important, at least 2s
-    gpio::write(pwrPort, false);
   }
 };
 
@@ -2,13 +2,13 @@
 
 #include <stdint.h>
 
-#include "rawdisp/command_data_display.hpp"
 #include "rawdisp/command_data_spi.hpp"
 #include "rawdisp/gpio.hpp"
+#include "rawdisp/power_managed_epd.hpp"
 
 namespace rawdisp {
 
-class JD79667AA : public CommandDataDisplay {
+class JD79667AA : public PowerManagedEpd {
  public:
   enum class Command : uint8_t {
     PANEL_SETTING = 0x00,
@@ -50,16 +50,35 @@ class JD79667AA : public CommandDataDisplay {
     UNKNOWN_0xE9 = 0xE9,
   };
 
-  const int busyPort;
-  const int pwrPort;
-  const int rotation;
+  // settable, the driver outlives a single update
+  int rotation;
+
+  static constexpr InitCommand INIT_SEQ_POWER[] = {
+      InitCommand(Command::UNKNOWN_0x66, 0x49, 0x55, 0x13, 0x5D, 0x05, 0x10),
+      InitCommand(Command::UNKNOWN_0x4D, 0x78),
+      InitCommand(Command::PANEL_SETTING, 0x0F, 0x29),
+      InitCommand(Command::POWER_SETTING, 0x07, 0x00),
+      InitCommand(Command::UNKNOWN_0x03, 0x10, 0x54, 0x44),
+      InitCommand(Command::BOOSTER_SOFT_START, 0x0F, 0x0A, 0x2F, 0x25, 0x22,
+                  0x2E, 0x21),
+      InitCommand(Command::VCOM_AND_DATA_INTERVAL_SETTING, 0x37),
+      InitCommand(Command::TCON_SETTING, 0x02, 0x02),
+  };
+
+  // after RESOLUTION_SETTING
+  static constexpr InitCommand INIT_SEQ_POWER_ON[] = {
+      InitCommand(Command::UNKNOWN_0xE7, 0x1C),
+      InitCommand(Command::POWER_SAVING, 0x22),
+      InitCommand(Command::UNKNOWN_0xB6, 0x6F),
+      InitCommand(Command::UNKNOWN_0xB4, 0xD0),
+      InitCommand(Command::UNKNOWN_0xE9, 0x01),
+      InitCommand(Command::PLL_CONTROL, 0x08),
+      InitCommand(Command::POWER_ON).waitBusy(),
+  };
 
   JD79667AA(const DisplayConfig& cfg, CommandDataSpi& bus, int busyPort,
             int pwrPort, int rotation)
-      : CommandDataDisplay(bus, cfg),
-        busyPort(busyPort),
-        pwrPort(pwrPort),
-        rotation(rotation) {}
+      : PowerManagedEpd(bus, cfg, busyPort, pwrPort), rotation(rotation) {}
 
   inline void writeCommandArray(Command cmd, const uint8_t* data, size_t size) {
     bus.writeCommand(static_cast<uint8_t>(cmd), data, size);
@@ -87,25 +106,16 @@ class JD79667AA : public CommandDataDisplay {
     writeCommandArray(cmd, params, sizeof(params));
   }
 
-  bool waitBusy() {
-    sleep_ms(100);
-    while (!gpio::read(busyPort)) {
-      sleep_ms(10);
-    }
-    return true;
+  void setWindow(int x, int y, int w, int h) override {
+    // none
   }
 
-  void init() override {
-    CommandDataDisplay::init();
-
-    gpio::init(busyPort);
-    gpio::setDir(busyPort, false);
-
-    gpio::init(pwrPort);
-    gpio::setDir(pwrPort, true);
-    gpio::write(pwrPort, true);
-    sleep_ms(100);
+  void beginPixels(int plane = 0) override {
+    beginPixelsWithCommand(static_cast<uint8_t>(Command::DATA_START_TRANS));
+  }
 
+ protected:
+  void hardReset() override {
     if (resetPort >= 0) {
       sleep_ms(200);
       gpio::write(resetPort, false);
@@ -113,25 +123,10 @@ class JD79667AA : public CommandDataDisplay {
       gpio::write(resetPort, true);
       sleep_ms(200);
     }
+  }
 
-    {
-      const uint8_t params[] = {0x49, 0x55, 0x13, 0x5D, 0x05, 0x10};
-      writeCommandArray(Command::UNKNOWN_0x66, params, sizeof(params));
-    }
-
-    writeCommand(Command::UNKNOWN_0x4D, 0x78);
-
-    writeCommand(Command::PANEL_SETTING, 0x0F, 0x29);
-    writeCommand(Command::POWER_SETTING, 0x07, 0x00);
-    writeCommand(Command::UNKNOWN_0x03, 0x10, 0x54, 0x44);
-
-    {
-      const uint8_t params[] = {0x0F, 0x0A, 0x2F, 0x25, 0x22, 0x2E, 0x21};
-      writeCommandArray(Command::BOOSTER_SOFT_START, params, sizeof(params));
-    }
-
-    writeCommand(Command::VCOM_AND_DATA_INTERVAL_SETTING, 0x37);
-    writeCommand(Command::TCON_SETTING, 0x02, 0x02);
+  void configure() override {
+    writeInitSequence(INIT_SEQ_POWER);
 
     {
       const uint8_t wh = width >> 8;
@@ -141,38 +136,15 @@ class JD79667AA : public CommandDataDisplay {
       writeCommand(Command::RESOLUTION_SETTING, wh, wl, hh, hl);
     }
 
-    writeCommand(Command::UNKNOWN_0xE7, 0x1C);
-    writeCommand(Command::POWER_SAVING, 0x22);
-    writeCommand(Command::UNKNOWN_0xB6, 0x6F);
-    writeCommand(Command::UNKNOWN_0xB4, 0xD0);
-    writeCommand(Command::UNKNOWN_0xE9, 0x01);
-
-    writeCommand(Command::PLL_CONTROL, 0x08);
-    writeCommand(Command::POWER_ON);
-    waitBusy();
-  }
-
-  void setWindow(int x, int y, int w, int h) override {
-    // none
-  }
-
-  void writePixels(const void* data, size_t length, int plane = -1) override {
-    uint8_t cmd = static_cast<uint8_t>(Command::DATA_START_TRANS);
-    bus.writeStart(true);
-    bus.writeBytes(&cmd, 1);
-    bus.writeStart(false);
-    bus.writeBytes(static_cast<const uint8_t*>(data), length);
-    bus.writeEnd();
+    writeInitSequence(INIT_SEQ_POWER_ON);
   }
 
-  void startUpdateDisplay() { writeCommand(Command::DISPLAY_REFRESH, 0x00); }
+  void refresh() override { writeCommand(Command::DISPLAY_REFRESH, 0x00); }
 
-  void powerOff() {
+  void enterDeepSleep() override {
     writeCommand(Command::POWER_OFF, 0x00);
     waitBusy();
     writeCommand(Command::DEEP_SLEEP, 0xA5);
-    sleep_ms(2000);  // important, at least 2s
-    gpio::write(pwrPort, false);
   }
 };
 
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/compression.hpp"
+
+namespace rawdisp {
+
+// Streaming decoder for LZ77 assets. Each flag byte describes the next 8
+// tokens, LSB first:
+//   0: a literal byte
+//   1: a 16 bit little endian match, the lower `windowBits` bits hold
+//      distance - 1 and the upper bits hold length - MIN_MATCH
+// Decoded data is kept in a ring of WINDOW_SIZE bytes for back references,
+// so assets with a larger window than that are rejected.
+template <size_t WINDOW_SIZE = 1024>
+class Lz77Decoder {
+  static_assert((WINDOW_SIZE & (WINDOW_SIZE - 1)) == 0,
+                "WINDOW_SIZE must be a power of 2");
+
+ public:
+  static constexpr int MIN_MATCH = 3;
+  static constexpr int MIN_WINDOW_BITS = 8;
+  static constexpr int MAX_WINDOW_BITS = 12;
+
+  CompressedHeader header = {};
+
+  Lz77Decoder(const uint8_t *data, size_t size) {
+    isValid = CompressedHeader::parse(data, size, &header) &&
+              header.method == Compression::LZ77 &&
+              MIN_WINDOW_BITS <= header.param &&
+              header.param <= MAX_WINDOW_BITS &&
+              ((size_t)1 << header.param) <= WINDOW_SIZE;
+    windowBits = header.param;
+    begin = data + CompressedHeader::SIZE;
+    end = isValid ? data + size : begin;
+    rewind();
+  }
+
+  // Restarts decoding from the beginning of the data.
+  void rewind() {
+    src = begin;
+    pos = 0;
+    matchLeft = 0;
+    produced = 0;
+    flagBits = 0;
+  }
+
+  inline bool valid() const { return isValid; }
+  inline size_t originalSize() const { return header.originalSize; }
+  inline bool done() const { return !isValid || produced >= originalSize(); }
+
+  // Decodes up to `capacity` bytes. Returns 0 at the end of the data.
+  size_t read(uint8_t *dst, size_t capacity) {
+    size_t n = 0;
+    if (!isValid) return 0;
+    size_t remaining = header.originalSize - produced;
+    if (capacity > remaining) capacity = remaining;
+
+    while (n < capacity) {
+      if (matchLeft > 0) {
+        size_t k = capacity - n;
+        if (k > matchLeft) k = matchLeft;
+        uint32_t from = pos - matchDist;
+        for (size_t i = 0; i < k; i++) {
+          uint8_t b = window[(from + i) & MASK];
+          window[(pos + i) & MASK] = b;
+          dst[n + i] = b;
+        }
+        pos += k;
+        n += k;
+        matchLeft -= k;
+        continue;
+      }
+
+      if (flagBits == 0) {
+        if (src >= end) break;
+        flags = *(src++);
+        flagBits = 8;
+      }
+      bool isMatch = flags & 1;
+      flags >>= 1;
+      flagBits--;
+
+      if (!isMatch) {
+        if (src >= end) break;
+        uint8_t b = *(src++);
+        window[(pos++) & MASK] = b;
+        dst[n++] = b;
+      } else {
+        if (end - src < 2) break;
+        uint16_t token = src[0] | (src[1] << 8);
+        src += 2;
+        matchDist = (token & ((1 << windowBits) - 1)) + 1;
+        matchLeft = (token >> windowBits) + MIN_MATCH;
+      }
+    }
+    produced += n;
+    return n;
+  }
+
+ private:
+  static constexpr uint32_t MASK = WINDOW_SIZE - 1;
+
+  uint8_t window[WINDOW_SIZE];
+  const uint8_t *begin;
+  const uint8_t *end;
+  const uint8_t *src;
+  int windowBits = 0;
+  uint32_t pos = 0;
+  uint32_t matchDist = 0;
+  size_t matchLeft = 0;
+  size_t produced = 0;
+  uint8_t flags = 0;
+  int flagBits = 0;
+  bool isValid;
+};
+
+}  // namespace rawdisp
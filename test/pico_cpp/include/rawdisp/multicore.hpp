@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+
+#include "rawdisp/rawdisp_common.hpp"
+
+#if !RAWDISP_HOST
+#include <pico/multicore.h>
+#include <pico/stdlib.h>
+#else
+#include <thread>
+#endif
+
+namespace rawdisp::multicore {
+
+typedef void (*WorkerFunc)(void *ctx);
+
+#if !RAWDISP_HOST
+
+namespace detail {
+inline WorkerFunc workerFunc = nullptr;
+inline void *workerCtx = nullptr;
+inline std::atomic<bool> workerRunning{false};
+
+static inline void core1Entry() {
+  workerFunc(workerCtx);
+  workerRunning.store(false, std::memory_order_release);
+  while (true) {
+    tight_loop_contents();
+  }
+}
+}  // namespace detail
+
+// Runs func(ctx) on core 1.
+static inline void launch(WorkerFunc func, void *ctx) {
+  detail::workerFunc = func;
+  detail::workerCtx = ctx;
+  detail::workerRunning.store(true, std::memory_order_release);
+  multicore_reset_core1();
+  multicore_launch_core1(detail::core1Entry);
+}
+
+// Waits for the function started by launch() to return.
+static inline void join() {
+  while (detail::workerRunning.load(std::memory_order_acquire)) {
+    tight_loop_contents();
+  }
+}
+
+// Busy-wait hint while the other core makes progress.
+static inline void relax() { tight_loop_contents(); }
+
+#else
+
+namespace detail {
+inline std::thread worker;
+}  // namespace detail
+
+static inline void launch(WorkerFunc func, void *ctx) {
+  detail::worker = std::thread(func, ctx);
+}
+
+static inline void join() {
+  if (detail::worker.joinable()) detail::worker.join();
+}
+
+// threads may share one CPU
+static inline void relax() { std::this_thread::yield(); }
+
+#endif
+
+}  // namespace rawdisp::multicore
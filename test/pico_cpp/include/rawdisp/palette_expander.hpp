@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rawdisp/pixel_format.hpp"
+#include "rawdisp/rawdisp_common.hpp"
+
+namespace rawdisp {
+
+// Expands palette indexed pixels to the RGB format F. The source is laid
+// out as generated with alignment packing: 8 / INDEX_BITS pixels per byte
+// with the first pixel in the MSBs, or one pixel in the lower bits of a
+// byte for 6 bit indices. The palette is the RGB888 table generated
+// alongside the asset.
+template <PixelFormat F, int INDEX_BITS>
+class PaletteExpander {
+  using Traits = PixelFormatTraits<F>;
+  static_assert(Traits::IS_RGB, "not an RGB format");
+  static_assert(INDEX_BITS == 2 || INDEX_BITS == 4 || INDEX_BITS == 6 ||
+                    INDEX_BITS == 8,
+                "unsupported INDEX_BITS");
+
+  static constexpr int PPU = Traits::PIXELS_PER_UNIT;
+
+ public:
+  static constexpr int NUM_COLORS = 1 << INDEX_BITS;
+  static constexpr int PIXELS_PER_BYTE = INDEX_BITS > 4 ? 1 : 8 / INDEX_BITS;
+  // smallest run of source bytes that expands to whole units
+  static constexpr int PIXELS_PER_GROUP =
+      PIXELS_PER_BYTE > PPU ? PIXELS_PER_BYTE : PPU;
+  static constexpr int SRC_BYTES_PER_GROUP = PIXELS_PER_GROUP / PIXELS_PER_BYTE;
+  static constexpr int DST_BYTES_PER_GROUP =
+      PIXELS_PER_GROUP / PPU * Traits::BYTES_PER_UNIT;
+
+  // Whole source bytes are looked up at once when each of them expands
+  // to whole units, otherwise pixels are looked up one by one and packed.
+  static constexpr bool BYTE_LUT = SRC_BYTES_PER_GROUP == 1;
+
+  PaletteExpander(const uint8_t *paletteRgb888, int numColors) {
+    setPalette(paletteRgb888, numColors);
+  }
+
+  // Rebuilds the lookup table, entries beyond `numColors` become black.
+  void setPalette(const uint8_t *paletteRgb888, int numColors) {
+    if (numColors > NUM_COLORS) numColors = NUM_COLORS;
+    uint32_t pixels[PIXELS_PER_GROUP];
+    if constexpr (BYTE_LUT) {
+      for (int b = 0; b < 256; b++) {
+        for (int i = 0; i < PIXELS_PER_BYTE; i++) {
+          int index = (b >> ((PIXELS_PER_BYTE - 1 - i) * INDEX_BITS)) & MASK;
+          pixels[i] = colorOf(paletteRgb888, numColors, index);
+        }
+        for (int i = 0; i < PIXELS_PER_GROUP; i += PPU) {
+          packUnit<F>(pixels + i, PPU,
+                      byteLut[b] + i / PPU * Traits::BYTES_PER_UNIT);
+        }
+      }
+    } else {
+      for (int i = 0; i < NUM_COLORS; i++) {
+        pixelLut[i] = colorOf(paletteRgb888, numColors, i);
+      }
+    }
+  }
+
+  // Source bytes to expand at once into a buffer of `buffSize` bytes. Kept
+  // to whole words so that an aligned source stays aligned.
+  static constexpr size_t srcChunkFor(size_t buffSize) {
+    size_t n = buffSize / DST_BYTES_PER_GROUP * SRC_BYTES_PER_GROUP;
+    return n >= 4 ? n / 4 * 4 : n;
+  }
+
+  static constexpr size_t dstBytesFor(size_t srcBytes) {
+    return BYTE_LUT ? srcBytes * DST_BYTES_PER_GROUP
+                    : bytesForPixels<F>(srcBytes * PIXELS_PER_BYTE);
+  }
+
+  // Expands `srcBytes` bytes into `dst`, which needs dstBytesFor(srcBytes)
+  // bytes. Returns the number of bytes written.
+  size_t expand(const uint8_t *src, size_t srcBytes, uint8_t *dst) const {
+    uint8_t *p = dst;
+    if constexpr (BYTE_LUT) {
+      // one load per 4 source bytes, which saves XIP cache accesses when
+      // the asset is in flash
+      if (isWordAligned(src)) {
+        for (; srcBytes >= 4; srcBytes -= 4, src += 4) {
+          uint32_t w = readWordLe(src);
+          memcpy(p, byteLut[w & 0xff], DST_BYTES_PER_GROUP);
+          memcpy(p + DST_BYTES_PER_GROUP, byteLut[(w >> 8) & 0xff],
+                 DST_BYTES_PER_GROUP);
+          memcpy(p + DST_BYTES_PER_GROUP * 2, byteLut[(w >> 16) & 0xff],
+                 DST_BYTES_PER_GROUP);
+          memcpy(p + DST_BYTES_PER_GROUP * 3, byteLut[w >> 24],
+                 DST_BYTES_PER_GROUP);
+          p += DST_BYTES_PER_GROUP * 4;
+        }
+      }
+      for (size_t i = 0; i < srcBytes; i++) {
+        memcpy(p, byteLut[src[i]], DST_BYTES_PER_GROUP);
+        p += DST_BYTES_PER_GROUP;
+      }
+    } else {
+      uint32_t pixels[PIXELS_PER_GROUP];
+      while (srcBytes > 0) {
+        int n = srcBytes < (size_t)PIXELS_PER_GROUP ? srcBytes
+                                                    : PIXELS_PER_GROUP;
+        for (int i = 0; i < n; i++) {
+          pixels[i] = pixelLut[src[i] & MASK];
+        }
+        p += packUnit<F>(pixels, n, p);
+        src += n;
+        srcBytes -= n;
+      }
+    }
+    return p - dst;
+  }
+
+ private:
+  static constexpr int MASK = NUM_COLORS - 1;
+
+  static uint32_t colorOf(const uint8_t *palette, int numColors, int index) {
+    if (index >= numColors) return 0;
+    const uint8_t *c = palette + index * 3;
+    return packRgb<F>(c[0], c[1], c[2]);
+  }
+
+  uint8_t byteLut[BYTE_LUT ? 256 : 1][DST_BYTES_PER_GROUP];
+  uint32_t pixelLut[BYTE_LUT ? 1 : NUM_COLORS];
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/rawdisp_common.hpp"
+
+namespace rawdisp {
+
+// Nearest palette index of every RGB565 color, so that converting a
+// framebuffer to the palette of an e-paper panel takes one lookup per
+// pixel. The pixel value is the key: 32 x 64 x 32 cells, R in the MSBs.
+// With ENTRY_BITS of 4, for up to 16 colors, two entries share a byte
+// with the first one in the upper nibble (32 KiB), otherwise each takes
+// a byte (64 KiB). The generator emits the table to live in flash, or
+// build() fills one in RAM at boot time.
+template <int ENTRY_BITS = 4>
+class Rgb565PaletteLut {
+  static_assert(ENTRY_BITS == 4 || ENTRY_BITS == 8,
+                "ENTRY_BITS must be 4 or 8");
+
+ public:
+  static constexpr int MAX_COLORS = 1 << ENTRY_BITS;
+  static constexpr size_t NUM_KEYS = 65536;
+  static constexpr size_t SIZE = NUM_KEYS * ENTRY_BITS / 8;
+
+  const uint8_t *const table;
+
+  Rgb565PaletteLut(const uint8_t *table) : table(table) {}
+
+  // Fills `table` (SIZE bytes) with the nearest of `numColors` RGB888
+  // colors by squared distance, as IndexedPalette of the generator. The
+  // channels of a key are widened to 8 bits by repeating their MSBs.
+  static void build(const uint8_t *palette, int numColors, uint8_t *table) {
+    if (numColors > MAX_COLORS) numColors = MAX_COLORS;
+    int32_t distR[MAX_COLORS], distRG[MAX_COLORS];
+    for (int r = 0; r < 32; r++) {
+      int rv = (r << 3) | (r >> 2);
+      for (int i = 0; i < numColors; i++) {
+        int d = rv - palette[i * 3 + 0];
+        distR[i] = d * d;
+      }
+      for (int g = 0; g < 64; g++) {
+        int gv = (g << 2) | (g >> 4);
+        for (int i = 0; i < numColors; i++) {
+          int d = gv - palette[i * 3 + 1];
+          distRG[i] = distR[i] + d * d;
+        }
+        uint32_t key = (r << 11) | (g << 5);
+        for (int b = 0; b < 32; b++, key++) {
+          int bv = (b << 3) | (b >> 2);
+          int best = 0;
+          int32_t bestDist = INT32_MAX;
+          for (int i = 0; i < numColors; i++) {
+            int d = bv - palette[i * 3 + 2];
+            int32_t dist = distRG[i] + d * d;
+            if (dist < bestDist) {
+              bestDist = dist;
+              best = i;
+            }
+          }
+          if (ENTRY_BITS == 8) {
+            table[key] = best;
+          } else if (key & 1) {
+            table[key >> 1] |= best;
+          } else {
+            table[key >> 1] = best << 4;
+          }
+        }
+      }
+    }
+  }
+
+  RAWDISP_INLINE uint8_t lookup(uint32_t rgb565) const {
+    if (ENTRY_BITS == 8) return table[rgb565];
+    uint8_t b = table[rgb565 >> 1];
+    return (rgb565 & 1) ? (b & 0x0F) : (b >> 4);
+  }
+
+  RAWDISP_INLINE uint8_t lookup(uint8_t r, uint8_t g, uint8_t b) const {
+    return lookup(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+  }
+
+  // Converts `n` RGB565 pixels, big endian as PixelFormat::RGB565, to one
+  // palette index per pixel.
+  void quantize(const uint8_t *src, int n, uint8_t *indices) const {
+    for (int i = 0; i < n; i++, src += 2) {
+      indices[i] = lookup(((uint32_t)src[0] << 8) | src[1]);
+    }
+  }
+
+  // Same as above, packed BITS per pixel with the first one in the MSBs,
+  // as packIndices() and the Indexed2 layout of SSD1680::writeIndexed2().
+  template <int BITS>
+  void quantize(const uint8_t *src, int n, uint8_t *dst) const {
+    constexpr int PER_BYTE = 8 / BITS;
+    for (int i = 0; i < n; i += PER_BYTE) {
+      uint8_t v = 0;
+      for (int k = 0; k < PER_BYTE; k++, src += 2) {
+        v <<= BITS;
+        if (i + k < n) v |= lookup(((uint32_t)src[0] << 8) | src[1]);
+      }
+      *(dst++) = v;
+    }
+  }
+
+  // Same as above, split into the white and red planes of KR11.
+  void quantizeKr11(const uint8_t *src, int n, uint8_t *white, uint8_t *red,
+                    uint8_t whiteIndex = 1, uint8_t redIndex = 2) const {
+    for (int i = 0; i < n; i += 8) {
+      uint8_t w = 0, r = 0;
+      for (int k = 0; k < 8; k++, src += 2) {
+        w <<= 1;
+        r <<= 1;
+        if (i + k >= n) continue;
+        uint8_t idx = lookup(((uint32_t)src[0] << 8) | src[1]);
+        w |= idx == whiteIndex;
+        r |= idx == redIndex;
+      }
+      *(white++) = w;
+      *(red++) = r;
+    }
+  }
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/pixel_format.hpp"
+
+namespace rawdisp {
+
+// Converts pixels read back as RGB666 (three bytes, channels left aligned)
+// to the memory layout of F. Units with several pixels are packed together,
+// so call with a multiple of PIXELS_PER_UNIT except for the last chunk.
+// Returns the number of bytes written.
+template <PixelFormat F>
+static inline size_t convertFromRgb666(const uint8_t *src, int numPixels,
+                                       uint8_t *dst) {
+  using T = PixelFormatTraits<F>;
+  if constexpr (!T::IS_RGB) {
+    return 0;
+  } else {
+    uint8_t *p = dst;
+    uint32_t unit[T::PIXELS_PER_UNIT];
+    for (int i = 0; i < numPixels; i += T::PIXELS_PER_UNIT) {
+      int n = numPixels - i;
+      if (n > T::PIXELS_PER_UNIT) n = T::PIXELS_PER_UNIT;
+      for (int j = 0; j < n; j++, src += 3) {
+        unit[j] = packRgb<F>(src[0], src[1], src[2]);
+      }
+      p += packUnit<F>(unit, n, p);
+    }
+    return p - dst;
+  }
+}
+
+static inline size_t convertFromRgb666(PixelFormat fmt, const uint8_t *src,
+                                       int numPixels, uint8_t *dst) {
+  return dispatchPixelFormat(
+      fmt,
+      [&](auto t) {
+        return convertFromRgb666<decltype(t)::FORMAT>(src, numPixels, dst);
+      },
+      (size_t)0);
+}
+
+}  // namespace rawdisp
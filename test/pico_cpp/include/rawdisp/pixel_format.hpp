@@ -0,0 +1,216 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef RAWDISP_INLINE
+#define RAWDISP_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace rawdisp {
+
+enum class PixelFormat {
+  RGB111,
+  RGB444,
+  RGB565,
+  RGB666,
+  KR11,
+  BW,
+};
+
+// Memory layout of a PixelFormat. Pixels are stored in units of
+// BYTES_PER_UNIT bytes holding PIXELS_PER_UNIT pixels PIXEL_STRIDE bits
+// apart, the first pixel in the most significant bits if FAR_PIXEL_FIRST.
+// Units are big endian if UNIT_BIG_ENDIAN (BIG_ENDIAN is a libc macro).
+// Channel shifts are within the pixel.
+template <PixelFormat F>
+struct PixelFormatTraits;
+
+template <>
+struct PixelFormatTraits<PixelFormat::RGB111> {
+  static constexpr PixelFormat FORMAT = PixelFormat::RGB111;
+  static constexpr int BITS_PER_PIXEL = 4;
+  static constexpr int BYTES_PER_UNIT = 1;
+  static constexpr int PIXELS_PER_UNIT = 2;
+  static constexpr int PIXEL_STRIDE = 3;  // 00RGBRGB
+  static constexpr bool FAR_PIXEL_FIRST = true;
+  static constexpr bool UNIT_BIG_ENDIAN = true;
+  static constexpr int NUM_PLANES = 1;
+  static constexpr bool IS_RGB = true;
+  static constexpr int R_BITS = 1, G_BITS = 1, B_BITS = 1;
+  static constexpr int R_SHIFT = 2, G_SHIFT = 1, B_SHIFT = 0;
+};
+
+template <>
+struct PixelFormatTraits<PixelFormat::RGB444> {
+  static constexpr PixelFormat FORMAT = PixelFormat::RGB444;
+  static constexpr int BITS_PER_PIXEL = 12;
+  static constexpr int BYTES_PER_UNIT = 3;
+  static constexpr int PIXELS_PER_UNIT = 2;
+  static constexpr int PIXEL_STRIDE = 12;
+  static constexpr bool FAR_PIXEL_FIRST = true;
+  static constexpr bool UNIT_BIG_ENDIAN = true;
+  static constexpr int NUM_PLANES = 1;
+  static constexpr bool IS_RGB = true;
+  static constexpr int R_BITS = 4, G_BITS = 4, B_BITS = 4;
+  static constexpr int R_SHIFT = 8, G_SHIFT = 4, B_SHIFT = 0;
+};
+
+template <>
+struct PixelFormatTraits<PixelFormat::RGB565> {
+  static constexpr PixelFormat FORMAT = PixelFormat::RGB565;
+  static constexpr int BITS_PER_PIXEL = 16;
+  static constexpr int BYTES_PER_UNIT = 2;
+  static constexpr int PIXELS_PER_UNIT = 1;
+  static constexpr int PIXEL_STRIDE = 16;
+  static constexpr bool FAR_PIXEL_FIRST = true;
+  static constexpr bool UNIT_BIG_ENDIAN = true;
+  static constexpr int NUM_PLANES = 1;
+  static constexpr bool IS_RGB = true;
+  static constexpr int R_BITS = 5, G_BITS = 6, B_BITS = 5;
+  static constexpr int R_SHIFT = 11, G_SHIFT = 5, B_SHIFT = 0;
+};
+
+template <>
+struct PixelFormatTraits<PixelFormat::RGB666> {
+  static constexpr PixelFormat FORMAT = PixelFormat::RGB666;
+  static constexpr int BITS_PER_PIXEL = 24;
+  static constexpr int BYTES_PER_UNIT = 3;
+  static constexpr int PIXELS_PER_UNIT = 1;
+  static constexpr int PIXEL_STRIDE = 24;
+  static constexpr bool FAR_PIXEL_FIRST = true;
+  static constexpr bool UNIT_BIG_ENDIAN = true;
+  static constexpr int NUM_PLANES = 1;
+  static constexpr bool IS_RGB = true;
+  // one channel per byte, left aligned
+  static constexpr int R_BITS = 6, G_BITS = 6, B_BITS = 6;
+  static constexpr int R_SHIFT = 18, G_SHIFT = 10, B_SHIFT = 2;
+};
+
+template <>
+struct PixelFormatTraits<PixelFormat::KR11> {
+  static constexpr PixelFormat FORMAT = PixelFormat::KR11;
+  static constexpr int BITS_PER_PIXEL = 2;  // one bit in each plane
+  static constexpr int BYTES_PER_UNIT = 1;
+  static constexpr int PIXELS_PER_UNIT = 8;
+  static constexpr int PIXEL_STRIDE = 1;
+  static constexpr bool FAR_PIXEL_FIRST = true;
+  static constexpr bool UNIT_BIG_ENDIAN = true;
+  static constexpr int NUM_PLANES = 2;
+  static constexpr bool IS_RGB = false;
+};
+
+template <>
+struct PixelFormatTraits<PixelFormat::BW> {
+  static constexpr PixelFormat FORMAT = PixelFormat::BW;
+  static constexpr int BITS_PER_PIXEL = 1;
+  static constexpr int BYTES_PER_UNIT = 1;
+  static constexpr int PIXELS_PER_UNIT = 8;
+  static constexpr int PIXEL_STRIDE = 1;
+  static constexpr bool FAR_PIXEL_FIRST = true;
+  static constexpr bool UNIT_BIG_ENDIAN = true;
+  static constexpr int NUM_PLANES = 1;
+  static constexpr bool IS_RGB = false;
+};
+
+// Calls func(PixelFormatTraits<fmt>{}) so that a kernel written as a
+// generic lambda is instantiated for every format. Returns `fallback` for
+// an unknown format.
+template <typename TFunc, typename TResult>
+static constexpr RAWDISP_INLINE TResult dispatchPixelFormat(PixelFormat fmt,
+                                                            TFunc &&func,
+                                                            TResult fallback) {
+  switch (fmt) {
+    case PixelFormat::RGB111:
+      return func(PixelFormatTraits<PixelFormat::RGB111>{});
+    case PixelFormat::RGB444:
+      return func(PixelFormatTraits<PixelFormat::RGB444>{});
+    case PixelFormat::RGB565:
+      return func(PixelFormatTraits<PixelFormat::RGB565>{});
+    case PixelFormat::RGB666:
+      return func(PixelFormatTraits<PixelFormat::RGB666>{});
+    case PixelFormat::KR11:
+      return func(PixelFormatTraits<PixelFormat::KR11>{});
+    case PixelFormat::BW:
+      return func(PixelFormatTraits<PixelFormat::BW>{});
+    default:
+      return fallback;
+  }
+}
+
+template <PixelFormat F>
+static constexpr int memBitsPerPixel() {
+  return PixelFormatTraits<F>::BITS_PER_PIXEL;
+}
+
+static RAWDISP_INLINE int memBitsPerPixel(PixelFormat fmt) {
+  return dispatchPixelFormat(
+      fmt, [](auto t) { return decltype(t)::BITS_PER_PIXEL; }, -1);
+}
+
+template <PixelFormat F>
+static constexpr int pixelsPerTrans(size_t buffSize) {
+  return buffSize * 8 / PixelFormatTraits<F>::BITS_PER_PIXEL;
+}
+
+static RAWDISP_INLINE int pixelsPerTrans(PixelFormat fmt, size_t buffSize) {
+  return buffSize * 8 / memBitsPerPixel(fmt);
+}
+
+// bytes taken by `numPixels` pixels of one plane, the last unit may be
+// partial
+template <PixelFormat F>
+static constexpr size_t bytesForPixels(size_t numPixels) {
+  using T = PixelFormatTraits<F>;
+  return (numPixels * (T::BITS_PER_PIXEL / T::NUM_PLANES) + 7) / 8;
+}
+
+// Packs up to PIXELS_PER_UNIT pixel values into one unit. Only the bytes
+// covering `n` pixels are written. Returns the number of bytes written.
+template <PixelFormat F>
+static RAWDISP_INLINE size_t packUnit(const uint32_t *pixels, int n,
+                                      uint8_t *dst) {
+  using T = PixelFormatTraits<F>;
+  uint32_t unit = 0;
+  for (int i = 0; i < T::PIXELS_PER_UNIT; i++) {
+    if (i < n) {
+      int pos = T::FAR_PIXEL_FIRST ? T::PIXELS_PER_UNIT - 1 - i : i;
+      unit |= pixels[i] << (pos * T::PIXEL_STRIDE);
+    }
+  }
+  size_t numBytes = n >= T::PIXELS_PER_UNIT ? T::BYTES_PER_UNIT
+                                            : bytesForPixels<F>(n);
+  for (size_t i = 0; i < numBytes; i++) {
+    int pos = T::UNIT_BIG_ENDIAN ? T::BYTES_PER_UNIT - 1 - i : i;
+    dst[i] = unit >> (pos * 8);
+  }
+  return numBytes;
+}
+
+// Reverse of packUnit(), reads PIXELS_PER_UNIT pixel values from a unit.
+template <PixelFormat F>
+static RAWDISP_INLINE void unpackUnit(const uint8_t *src, uint32_t *pixels) {
+  using T = PixelFormatTraits<F>;
+  constexpr uint32_t MASK = (1ull << T::PIXEL_STRIDE) - 1;
+  uint32_t unit = 0;
+  for (int i = 0; i < T::BYTES_PER_UNIT; i++) {
+    int pos = T::UNIT_BIG_ENDIAN ? T::BYTES_PER_UNIT - 1 - i : i;
+    unit |= (uint32_t)src[i] << (pos * 8);
+  }
+  for (int i = 0; i < T::PIXELS_PER_UNIT; i++) {
+    int pos = T::FAR_PIXEL_FIRST ? T::PIXELS_PER_UNIT - 1 - i : i;
+    pixels[i] = (unit >> (pos * T::PIXEL_STRIDE)) & MASK;
+  }
+}
+
+// Builds a pixel value from 8-bit channels, RGB formats only.
+template <PixelFormat F>
+static RAWDISP_INLINE uint32_t packRgb(uint8_t r, uint8_t g, uint8_t b) {
+  using T = PixelFormatTraits<F>;
+  static_assert(T::IS_RGB, "not an RGB format");
+  return ((uint32_t)(r >> (8 - T::R_BITS)) << T::R_SHIFT) |
+         ((uint32_t)(g >> (8 - T::G_BITS)) << T::G_SHIFT) |
+         ((uint32_t)(b >> (8 - T::B_BITS)) << T::B_SHIFT);
+}
+
+}  // namespace rawdisp
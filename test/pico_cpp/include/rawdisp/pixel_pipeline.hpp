@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+
+#include "rawdisp/multicore.hpp"
+#include "rawdisp/spsc_ring.hpp"
+#include "rawdisp/timer.hpp"
+
+namespace rawdisp {
+
+struct PipelineStats {
+  uint32_t chunks = 0;
+  uint64_t bytes = 0;
+  uint64_t elapsedUs = 0;
+
+  // ring full: the producer waits for the bus
+  uint32_t producerStalls = 0;
+  uint64_t producerWaitUs = 0;
+  // ring empty: the bus waits for the producer
+  uint32_t consumerStarves = 0;
+  uint64_t consumerWaitUs = 0;
+
+  // ring occupancy seen by the consumer before each chunk
+  uint64_t occupancySum = 0;
+  uint32_t maxOccupancy = 0;
+
+  inline float meanOccupancy() const {
+    return chunks ? (float)occupancySum / chunks : 0;
+  }
+
+  inline bool busBound() const { return producerWaitUs > consumerWaitUs; }
+
+  void print(const char *name) const {
+    printf("%s: %u chunks, %llu bytes in %llu us\n", name, (unsigned)chunks,
+           (unsigned long long)bytes, (unsigned long long)elapsedUs);
+    printf("  producer stalls: %u (%llu us)\n", (unsigned)producerStalls,
+           (unsigned long long)producerWaitUs);
+    printf("  consumer starves: %u (%llu us)\n", (unsigned)consumerStarves,
+           (unsigned long long)consumerWaitUs);
+    printf("  occupancy: mean %.2f, max %u\n", meanOccupancy(),
+           (unsigned)maxOccupancy);
+    printf("  bottleneck: %s\n", busBound() ? "bus" : "compute");
+  }
+};
+
+// Decodes / renders pixel data on core 1 while core 0 sends it to the
+// display. Chunks are handed over through a lock-free ring. The sink is a
+// Display or anything else with beginPixels(plane), pushPixels(data,
+// length) and endPixels(), so that the pipeline also runs on a host.
+template <size_t CHUNK_SIZE = 2048, size_t NUM_CHUNKS = 4>
+class PixelPipeline {
+ public:
+  // Fills buf with up to capacity bytes of pixel data. Returns the number
+  // of bytes written, 0 at the end of the stream.
+  typedef size_t (*ProduceFunc)(void *ctx, uint8_t *buf, size_t capacity);
+
+  PipelineStats stats;
+
+  // Streams the produced data into the current window of the display.
+  template <typename TSink>
+  void run(TSink &display, ProduceFunc produce, void *ctx, int plane = 0) {
+    this->produce = produce;
+    this->produceCtx = ctx;
+    stats = PipelineStats();
+    ring.reset();
+    producerDone.store(false, std::memory_order_relaxed);
+
+    uint64_t t0 = timer::nowUs();
+    multicore::launch(producerEntry, this);
+
+    display.beginPixels(plane);
+    while (true) {
+      Chunk *c = ring.peek();
+      if (!c) {
+        if (producerDone.load(std::memory_order_acquire)) {
+          c = ring.peek();
+          if (!c) break;
+        } else {
+          uint64_t waitStart = timer::nowUs();
+          stats.consumerStarves++;
+          while (!(c = ring.peek())) {
+            if (producerDone.load(std::memory_order_acquire)) break;
+            multicore::relax();
+          }
+          stats.consumerWaitUs += timer::nowUs() - waitStart;
+          if (!c) continue;
+        }
+      }
+
+      uint32_t occupancy = ring.size();
+      stats.occupancySum += occupancy;
+      if (occupancy > stats.maxOccupancy) stats.maxOccupancy = occupancy;
+      stats.chunks++;
+      stats.bytes += c->length;
+
+      display.pushPixels(c->data, c->length);
+      ring.release();
+    }
+    display.endPixels();
+
+    multicore::join();
+    stats.elapsedUs = timer::nowUs() - t0;
+  }
+
+ private:
+  struct Chunk {
+    size_t length;
+    alignas(4) uint8_t data[CHUNK_SIZE];
+  };
+
+  SpscRing<Chunk, NUM_CHUNKS> ring;
+  std::atomic<bool> producerDone{false};
+  ProduceFunc produce = nullptr;
+  void *produceCtx = nullptr;
+
+  static void producerEntry(void *ctx) {
+    static_cast<PixelPipeline *>(ctx)->producerLoop();
+  }
+
+  // runs on core 1, only touches the producer side of the statistics
+  void producerLoop() {
+    while (true) {
+      Chunk *c = ring.acquire();
+      if (!c) {
+        uint64_t waitStart = timer::nowUs();
+        stats.producerStalls++;
+        while (!(c = ring.acquire())) {
+          multicore::relax();
+        }
+        stats.producerWaitUs += timer::nowUs() - waitStart;
+      }
+      c->length = produce(produceCtx, c->data, CHUNK_SIZE);
+      if (c->length == 0) break;
+      ring.commit();
+    }
+    producerDone.store(true, std::memory_order_release);
+  }
+};
+
+}  // namespace rawdisp
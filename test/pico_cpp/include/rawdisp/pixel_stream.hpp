@@ -0,0 +1,140 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rawdisp/pixel_format.hpp"
+
+namespace rawdisp {
+
+class Display;
+
+// Transfer session for one window. Pixels can be pushed in chunks of any
+// size, they are packed into a staging buffer of BUFF_SIZE bytes which is
+// flushed to the display whenever it fills up. A unit left incomplete at
+// the end of a chunk (e.g. 3 pixels of BW) is carried over to the next.
+// TDisplay needs setWindow(), beginPixels(), pushPixels() and endPixels().
+template <PixelFormat F, size_t BUFF_SIZE = 256, typename TDisplay = Display>
+class PixelStream {
+  using Traits = PixelFormatTraits<F>;
+  static constexpr int PPU = Traits::PIXELS_PER_UNIT;
+  static constexpr int BPU = Traits::BYTES_PER_UNIT;
+  static constexpr size_t CAPACITY = BUFF_SIZE / BPU * BPU;
+  static_assert(CAPACITY > 0, "BUFF_SIZE is smaller than a unit");
+
+ public:
+  TDisplay &display;
+
+  PixelStream(TDisplay &display, int x, int y, int w, int h, int plane = 0)
+      : display(display) {
+    display.setWindow(x, y, w, h);
+    display.beginPixels(plane);
+  }
+
+  ~PixelStream() { finish(); }
+
+  inline size_t pixelsPushed() const { return numPushed; }
+
+  // Pushes one pixel value.
+  inline void push(uint32_t pixel) {
+    unit[numUnit++] = pixel;
+    numPushed++;
+    if (numUnit == PPU) commitUnit();
+  }
+
+  // Pushes pixel values, one per element.
+  void push(const uint32_t *pixels, size_t n) {
+    if constexpr (PPU > 1) {
+      while (numUnit != 0 && n > 0) {
+        push(*(pixels++));
+        n--;
+      }
+    }
+    while (n >= (size_t)PPU) {
+      if (buffUsed + BPU > CAPACITY) flush();
+      buffUsed += packUnit<F>(pixels, PPU, buff + buffUsed);
+      pixels += PPU;
+      n -= PPU;
+      numPushed += PPU;
+    }
+    if constexpr (PPU > 1) {
+      while (n-- > 0) {
+        push(*(pixels++));
+      }
+    }
+  }
+
+  // Pushes pixels that are already packed in the layout of F, from a unit
+  // boundary. `data` holds bytesForPixels<F>(n) bytes.
+  void pushPacked(const uint8_t *data, size_t n) {
+    if (numUnit == 0) {
+      // aligned: whole units are copied as they are
+      size_t numUnits = n / PPU;
+      while (numUnits > 0) {
+        if (buffUsed == CAPACITY) flush();
+        size_t count = (CAPACITY - buffUsed) / BPU;
+        if (count > numUnits) count = numUnits;
+        memcpy(buff + buffUsed, data, count * BPU);
+        buffUsed += count * BPU;
+        data += count * BPU;
+        numUnits -= count;
+        n -= count * PPU;
+        numPushed += count * PPU;
+      }
+    }
+    uint32_t pixels[PPU];
+    while (n > 0) {
+      int count = n < (size_t)PPU ? n : PPU;
+      if (count < PPU) {
+        // the last unit is partial, don't read past the source
+        uint8_t last[BPU] = {};
+        memcpy(last, data, bytesForPixels<F>(count));
+        unpackUnit<F>(last, pixels);
+      } else {
+        unpackUnit<F>(data, pixels);
+      }
+      data += BPU;
+      for (int i = 0; i < count; i++) {
+        push(pixels[i]);
+      }
+      n -= count;
+    }
+  }
+
+  // Sends what is buffered.
+  void flush() {
+    if (buffUsed == 0) return;
+    display.pushPixels(buff, buffUsed);
+    buffUsed = 0;
+  }
+
+  // Sends the last, possibly partial, unit and ends the transfer.
+  void finish() {
+    if (finished) return;
+    if (numUnit > 0) {
+      if (buffUsed + BPU > CAPACITY) flush();
+      buffUsed += packUnit<F>(unit, numUnit, buff + buffUsed);
+      numUnit = 0;
+    }
+    flush();
+    display.endPixels();
+    finished = true;
+  }
+
+ private:
+  uint8_t buff[CAPACITY];
+  size_t buffUsed = 0;
+  uint32_t unit[PPU];
+  int numUnit = 0;
+  size_t numPushed = 0;
+  bool finished = false;
+
+  inline void commitUnit() {
+    if (buffUsed + BPU > CAPACITY) flush();
+    buffUsed += packUnit<F>(unit, PPU, buff + buffUsed);
+    numUnit = 0;
+  }
+};
+
+}  // namespace rawdisp
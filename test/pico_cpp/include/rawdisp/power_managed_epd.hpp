@@ -0,0 +1,157 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "rawdisp/asset_desc.hpp"
+#include "rawdisp/command_data_display.hpp"
+#include "rawdisp/command_data_spi.hpp"
+#include "rawdisp/gpio.hpp"
+#include "rawdisp/timer.hpp"
+
+namespace rawdisp {
+
+enum class PowerState {
+  OFF,           // power pin low, nothing configured
+  DEEP_SLEEP,    // powered, registers lost, needs reset to wake up
+  POWERED_IDLE,  // configured and booster on, ready to accept data
+  REFRESHING,    // refresh in progress, BUSY asserted
+};
+
+// Base class for UC81xx-like e-paper controllers (IST7163, JD79667AA).
+// Keeps track of how far the panel has been brought up so that consecutive
+// updates only take the steps that are actually needed.
+class PowerManagedEpd : public CommandDataDisplay {
+ public:
+  static constexpr uint32_t DEFAULT_IDLE_WINDOW_MS = 30000;
+  static constexpr uint32_t DEEP_SLEEP_HOLD_MS = 2000;
+
+  const int busyPort;
+  const int pwrPort;
+
+  // How long the panel is kept powered after the last refresh.
+  uint32_t idleWindowMs = DEFAULT_IDLE_WINDOW_MS;
+
+  PowerManagedEpd(CommandDataSpi& bus, const DisplayConfig& cfg, int busyPort,
+                  int pwrPort)
+      : CommandDataDisplay(bus, cfg), busyPort(busyPort), pwrPort(pwrPort) {}
+
+  // Both controllers take the whole screen as a single 2bpp plane, 4
+  // pixels per byte with the leftmost one in the MSBs. There's no partial
+  // window.
+  static constexpr bool isNativeAsset(const DisplayConfig& cfg,
+                                      const AssetDesc& asset) {
+    if (asset.format != AssetFormat::I2_RGB888 || asset.numPlanes != 1) {
+      return false;
+    }
+    const PlaneLayout& l = asset.planes[0].layout;
+    return l.type == PlaneType::DIRECT && l.pixelStride == 2 &&
+           l.pixelsPerFrag == 4 && l.bytesPerFrag == 1 &&
+           l.has(PlaneLayout::FLAG_FAR_PIXEL_FIRST) &&
+           !l.has(PlaneLayout::FLAG_VERT_PACK) &&
+           !l.has(PlaneLayout::FLAG_VERT_ADDR) && asset.width == cfg.width &&
+           asset.height == cfg.height;
+  }
+
+  inline PowerState powerState() const { return state; }
+
+  void init() override { wake(); }
+
+  // Brings the panel to POWERED_IDLE by the shortest path.
+  void wake() {
+    switch (state) {
+      case PowerState::OFF:
+        CommandDataDisplay::init();
+        gpio::init(busyPort);
+        gpio::setDir(busyPort, false);
+        gpio::init(pwrPort);
+        gpio::setDir(pwrPort, true);
+        gpio::write(pwrPort, true);
+        sleep_ms(100);
+        hardReset();
+        configure();
+        break;
+
+      case PowerState::DEEP_SLEEP:
+        // registers are lost in deep sleep, only reset can wake it up
+        hardReset();
+        configure();
+        break;
+
+      case PowerState::REFRESHING:
+        waitBusy();
+        break;
+
+      case PowerState::POWERED_IDLE:
+        break;
+    }
+    state = PowerState::POWERED_IDLE;
+    lastActiveUs = timer::nowUs();
+  }
+
+  void startUpdateDisplay() {
+    wake();
+    refresh();
+    state = PowerState::REFRESHING;
+  }
+
+  bool waitBusy() override {
+    sleep_ms(100);
+    while (isBusy()) {
+      sleep_ms(10);
+    }
+    if (state == PowerState::REFRESHING) {
+      state = PowerState::POWERED_IDLE;
+    }
+    lastActiveUs = timer::nowUs();
+    return true;
+  }
+
+  bool isBusy() override { return !gpio::read(busyPort); }
+
+  // Call periodically. Puts the panel to deep sleep once the idle window
+  // has elapsed.
+  void service() {
+    if (state == PowerState::REFRESHING && !isBusy()) {
+      state = PowerState::POWERED_IDLE;
+      lastActiveUs = timer::nowUs();
+    }
+    if (state == PowerState::POWERED_IDLE &&
+        timer::elapsedMs(lastActiveUs) >= idleWindowMs) {
+      sleep();
+    }
+  }
+
+  void sleep() {
+    if (state == PowerState::REFRESHING) {
+      waitBusy();
+    }
+    if (state != PowerState::POWERED_IDLE) return;
+    enterDeepSleep();
+    state = PowerState::DEEP_SLEEP;
+    sleepSinceUs = timer::nowUs();
+  }
+
+  void powerOff() {
+    if (state == PowerState::OFF) return;
+    sleep();
+    // the supply must be kept for a while after entering deep sleep
+    uint32_t elapsed = timer::elapsedMs(sleepSinceUs);
+    if (elapsed < DEEP_SLEEP_HOLD_MS) {
+      sleep_ms(DEEP_SLEEP_HOLD_MS - elapsed);
+    }
+    gpio::write(pwrPort, false);
+    state = PowerState::OFF;
+  }
+
+ protected:
+  PowerState state = PowerState::OFF;
+  uint64_t lastActiveUs = 0;
+  uint64_t sleepSinceUs = 0;
+
+  virtual void hardReset() = 0;
+  virtual void configure() = 0;  // register setup up to POWER_ON
+  virtual void refresh() = 0;
+  virtual void enterDeepSleep() = 0;
+};
+
+}  // namespace rawdisp
@@ -2,21 +2,40 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #ifndef RAWDISP_INLINE
 #define RAWDISP_INLINE inline __attribute__((always_inline))
 #endif
 
+// host build (Linux) when the Pico SDK is not available
+#ifndef RAWDISP_HOST
+#if __has_include(<pico/multicore.h>)
+#define RAWDISP_HOST 0
+#else
+#define RAWDISP_HOST 1
+#endif
+#endif
+
+#include "rawdisp/pixel_format.hpp"
+
 namespace rawdisp {
 
-enum class PixelFormat {
-  RGB111,
-  RGB444,
-  RGB565,
-  RGB666,
-  KR11,
-  BW,
-};
+// Arrays generated with 4 byte or wider alignment pass this and can be
+// read a word at a time.
+static RAWDISP_INLINE bool isWordAligned(const void *p) {
+  return ((uintptr_t)p & 3) == 0;
+}
+
+// Reads 4 bytes from a word aligned address, the first byte in the LSBs.
+static RAWDISP_INLINE uint32_t readWordLe(const uint8_t *p) {
+  uint32_t w;
+  memcpy(&w, __builtin_assume_aligned(p, 4), 4);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  w = __builtin_bswap32(w);
+#endif
+  return w;
+}
 
 static RAWDISP_INLINE void clipCoord(int *x, int *w, int max) {
   if (*x < 0) {
@@ -36,27 +55,4 @@ static RAWDISP_INLINE void clipCoord(int *x, int *w, int max) {
   }
 }
 
-static RAWDISP_INLINE int memBitsPerPixel(PixelFormat fmt) {
-  switch (fmt) {
-    case PixelFormat::RGB111:
-      return 4;
-    case PixelFormat::RGB565:
-      return 16;
-    case PixelFormat::RGB666:
-      return 24;
-    case PixelFormat::RGB444:
-      return 12;
-    case PixelFormat::KR11:
-      return 2;
-    case PixelFormat::BW:
-      return 1;
-    default:
-      return -1;
-  }
-}
-
-static RAWDISP_INLINE int pixelsPerTrans(PixelFormat fmt, size_t buffSize) {
-  return buffSize * 8 / memBitsPerPixel(fmt);
-}
-
 }  // namespace rawdisp
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rawdisp/compression.hpp"
+
+namespace rawdisp {
+
+// Streaming decoder for RLE assets. Control bytes:
+//   0xxxxxxx: copy the next x + 1 bytes
+//   1xxxxxxx: repeat the next byte x + 3 times
+class RleDecoder {
+ public:
+  static constexpr int MIN_RUN = 3;
+
+  CompressedHeader header;
+
+  RleDecoder(const uint8_t *data, size_t size) {
+    isValid = CompressedHeader::parse(data, size, &header) &&
+              header.method == Compression::RLE;
+    src = data + CompressedHeader::SIZE;
+    end = isValid ? data + size : src;
+  }
+
+  inline bool valid() const { return isValid; }
+  inline size_t originalSize() const { return header.originalSize; }
+  inline bool done() const {
+    return runLeft == 0 && litLeft == 0 && src >= end;
+  }
+
+  // Decodes up to `capacity` bytes. Returns 0 at the end of the data.
+  size_t read(uint8_t *dst, size_t capacity) {
+    size_t n = 0;
+    while (n < capacity) {
+      if (runLeft == 0 && litLeft == 0) {
+        if (src >= end) break;
+        uint8_t c = *(src++);
+        if (c & 0x80) {
+          if (src >= end) break;
+          runLeft = (c & 0x7F) + MIN_RUN;
+          runValue = *(src++);
+        } else {
+          litLeft = c + 1;
+        }
+      }
+
+      size_t k = capacity - n;
+      if (runLeft > 0) {
+        if (k > runLeft) k = runLeft;
+        memset(dst + n, runValue, k);
+        runLeft -= k;
+      } else {
+        if (k > litLeft) k = litLeft;
+        if (k > (size_t)(end - src)) k = end - src;
+        memcpy(dst + n, src, k);
+        src += k;
+        litLeft -= k;
+        // truncated data
+        if (src >= end) litLeft = 0;
+      }
+      n += k;
+    }
+    return n;
+  }
+
+ private:
+  const uint8_t *src;
+  const uint8_t *end;
+  size_t runLeft = 0;
+  size_t litLeft = 0;
+  uint8_t runValue = 0;
+  bool isValid;
+};
+
+}  // namespace rawdisp
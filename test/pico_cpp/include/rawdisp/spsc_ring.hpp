@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+namespace rawdisp {
+
+// Lock-free ring for exactly one producer and one consumer. Slots are
+// filled in place: acquire() / commit() on the producer side, peek() /
+// release() on the consumer side. Only loads and stores of the indices are
+// used, so this also works on cores without atomic read-modify-write.
+template <typename T, size_t N>
+class SpscRing {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+ public:
+  static constexpr size_t CAPACITY = N;
+
+  // Returns a free slot, or nullptr when the ring is full.
+  T *acquire() {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= N) return nullptr;
+    return &slots[h & (N - 1)];
+  }
+
+  void commit() {
+    head.store(head.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+  }
+
+  // Returns the oldest filled slot, or nullptr when the ring is empty.
+  T *peek() {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return nullptr;
+    return &slots[t & (N - 1)];
+  }
+
+  void release() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+  }
+
+  inline size_t size() const {
+    return head.load(std::memory_order_acquire) -
+           tail.load(std::memory_order_acquire);
+  }
+
+  void reset() {
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  T slots[N];
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+};
+
+}  // namespace rawdisp
@@ -40,6 +40,19 @@ class SSD1306 : public CommandDataDisplay {
   SSD1306(const DisplayConfig& cfg, CommandDataI2c& bus, int rotation)
       : CommandDataDisplay(bus, cfg), rotation(rotation) {}
 
+  // The GDDRAM takes 8 vertical pixels per byte, top pixel in the LSB.
+  static constexpr bool isNativeAsset(const DisplayConfig& cfg,
+                                      const AssetDesc& asset) {
+    if (asset.format != AssetFormat::BW || asset.numPlanes != 1) return false;
+    const PlaneLayout& l = asset.planes[0].layout;
+    return l.type == PlaneType::DIRECT && l.pixelStride == 1 &&
+           l.pixelsPerFrag == 8 && l.bytesPerFrag == 1 &&
+           l.has(PlaneLayout::FLAG_VERT_PACK) &&
+           !l.has(PlaneLayout::FLAG_VERT_ADDR) &&
+           !l.has(PlaneLayout::FLAG_FAR_PIXEL_FIRST) &&
+           asset.fitsIn(cfg.width, cfg.height);
+  }
+
   inline void writeCommandArray(Command cmd, const uint8_t* data, size_t size) {
     uint8_t cmdByte = static_cast<uint8_t>(cmd);
     bus.writeStart(true);
@@ -105,11 +118,7 @@ class SSD1306 : public CommandDataDisplay {
     writeCommand(Command::SET_PAGE_ADDR, y / 8, (y + h - 1) / 8);
   }
 
-  void writePixels(const void* data, size_t length, int plane = -1) override {
-    bus.writeStart(false);
-    bus.writeBytes(static_cast<const uint8_t*>(data), length);
-    bus.writeEnd();
-  }
+  void beginPixels(int plane = 0) override { bus.writeStart(false); }
 };
 
 }  // namespace rawdisp
\ No newline at end of file
@@ -64,6 +64,9 @@ class SSD1680 : public CommandDataDisplay {
     PLANE_RED = 1,
   };
 
+  // RAM X address is in bytes of 8 pixels
+  static constexpr bool BYTE_ADDRESSED_ROWS = true;
+
   const int busyPort;
   const int rotation;
 
@@ -71,6 +74,9 @@ class SSD1680 : public CommandDataDisplay {
           int rotation)
       : CommandDataDisplay(bus, cfg), busyPort(busyPort), rotation(rotation) {}
 
+  // rotations 1 and 3 scan Y first
+  bool scansColumns() const { return rotation & 1; }
+
   inline void writeCommandArray(Command cmd, const uint8_t* data, size_t size) {
     bus.writeCommand(static_cast<uint8_t>(cmd), data, size);
   }
@@ -97,7 +103,9 @@ class SSD1680 : public CommandDataDisplay {
     writeCommandArray(cmd, params, sizeof(params));
   }
 
-  bool waitBusy() {
+  bool isBusy() override { return busyPort >= 0 && gpio::read(busyPort); }
+
+  bool waitBusy() override {
     if (busyPort < 0) {
       sleep_ms(500);
       return true;
@@ -184,6 +192,10 @@ class SSD1680 : public CommandDataDisplay {
 
     xStart >>= 3;
     xEnd >>= 3;
+    ramXStart = xStart;
+    ramXEnd = xEnd;
+    ramYStart = yStart;
+    ramYEnd = yEnd;
 
     uint8_t xs = xStart & 0x1F;
     uint8_t xe = xEnd & 0x1F;
@@ -198,21 +210,89 @@ class SSD1680 : public CommandDataDisplay {
     writeCommand(Command::SET_RAM_Y_ADDR_COUNTER, ysl, ysh);
   }
 
-  void writePixels(const void* data, size_t length, int plane) override {
-    uint8_t cmd;
+  void beginPixels(int plane = 0) override {
     if (plane == PLANE_WHITE) {
-      cmd = static_cast<uint8_t>(Command::WRITE_RAM_BLACK);
+      beginPixelsWithCommand(static_cast<uint8_t>(Command::WRITE_RAM_BLACK));
     } else {
-      cmd = static_cast<uint8_t>(Command::WRITE_RAM_RED);
+      beginPixelsWithCommand(static_cast<uint8_t>(Command::WRITE_RAM_RED));
+    }
+  }
+
+  // Sends an Indexed2 image, 4 pixels per byte with the first one in the
+  // MSBs, in the order the current window is scanned, to both RAMs with a
+  // single pass over the source. Each band is split into black and red
+  // staging buffers, which are written with WRITE_RAM_BLACK and
+  // WRITE_RAM_RED after moving the address counter back to the start of
+  // the band. The source can live in flash or be drawn at run time.
+  template <int WHITE_INDEX = 1, int RED_INDEX = 2, size_t BAND_BYTES = 512>
+  void writeIndexed2(const uint8_t* data, size_t size) {
+    static constexpr SplitLut<WHITE_INDEX, RED_INDEX> LUT;
+    // static to keep the bands off the stack, the writes are blocking
+    static uint8_t white[BAND_BYTES], red[BAND_BYTES];
+    size_t numBytes = (size + 1) / 2;  // per plane
+    for (size_t pos = 0; pos < numBytes; pos += BAND_BYTES) {
+      size_t n = numBytes - pos < BAND_BYTES ? numBytes - pos : BAND_BYTES;
+      const uint8_t* src = data + pos * 2;
+      for (size_t i = 0; i < n; i++) {
+        uint8_t hi = LUT.table[src[i * 2]];
+        uint8_t lo = pos * 2 + i * 2 + 1 < size ? LUT.table[src[i * 2 + 1]]
+                                                 : LUT.table[0];
+        white[i] = (hi & 0xF0) | (lo >> 4);
+        red[i] = (hi << 4) | (lo & 0x0F);
+      }
+      setRamCounter(pos);
+      writePixels(white, n, PLANE_WHITE);
+      setRamCounter(pos);
+      writePixels(red, n, PLANE_RED);
     }
-    bus.writeStart(true);
-    bus.writeBytes(&cmd, 1);
-    bus.writeStart(false);
-    bus.writeBytes(static_cast<const uint8_t*>(data), length);
-    bus.writeEnd();
   }
 
   void startUpdateDisplay() { writeCommand(Command::MASTER_ACTIVATION); }
+
+ private:
+  // RAM address range of the current window, X in bytes
+  int ramXStart = 0;
+  int ramXEnd = 0;
+  int ramYStart = 0;
+  int ramYEnd = 0;
+
+  // One Indexed2 source byte to the 4 white bits (upper nibble) and the
+  // 4 red bits (lower nibble) it becomes.
+  template <int WHITE_INDEX, int RED_INDEX>
+  struct SplitLut {
+    uint8_t table[256];
+    constexpr SplitLut() : table() {
+      for (int b = 0; b < 256; b++) {
+        uint8_t v = 0;
+        for (int i = 0; i < 4; i++) {
+          int index = (b >> ((3 - i) * 2)) & 3;
+          if (index == WHITE_INDEX) v |= 0x80 >> i;
+          if (index == RED_INDEX) v |= 0x08 >> i;
+        }
+        table[b] = v;
+      }
+    }
+  };
+
+  // Moves the address counter to byte `pos` of the current window, in
+  // the scan order set by DATA_ENTRY_MODE_SETTING.
+  void setRamCounter(size_t pos) {
+    int dirX = ramXEnd >= ramXStart ? 1 : -1;
+    int dirY = ramYEnd >= ramYStart ? 1 : -1;
+    int x, y;
+    if (rotation & 1) {
+      // Y first
+      int lineLen = (ramYEnd - ramYStart) * dirY + 1;
+      x = ramXStart + dirX * (int)(pos / lineLen);
+      y = ramYStart + dirY * (int)(pos % lineLen);
+    } else {
+      int lineLen = (ramXEnd - ramXStart) * dirX + 1;
+      x = ramXStart + dirX * (int)(pos % lineLen);
+      y = ramYStart + dirY * (int)(pos / lineLen);
+    }
+    writeCommand(Command::SET_RAM_X_ADDR_COUNTER, x & 0x1F);
+    writeCommand(Command::SET_RAM_Y_ADDR_COUNTER, y & 0xFF, (y >> 8) & 0x01);
+  }
 };
 
 }  // namespace rawdisp
\ No newline at end of file
@@ -110,6 +110,27 @@ class ST7789 : public CommandDataDisplay {
     ADJUST_CONTROL_7 = 0xFF,
   };
 
+  static constexpr InitCommand INIT_SEQ_RESET[] = {
+      InitCommand::reset(true).wait(5),
+      InitCommand::reset(false).wait(100),
+  };
+
+  static constexpr InitCommand INIT_SEQ_WAKE[] = {
+      InitCommand(Command::SOFTWARE_RESET).wait(200),
+      InitCommand(Command::SLEEP_OUT).wait(200),
+  };
+
+  static constexpr InitCommand INIT_SEQ_DISPLAY_ON[] = {
+      // #if 0
+      //     InitCommand(Command::MEMORY_ACCESS_CONTROL, 0x48),
+      // #else
+      //     // InitCommand(Command::MEMORY_ACCESS_CONTROL, 0xE8),
+      //     InitCommand(Command::MEMORY_ACCESS_CONTROL, 0x28),
+      // #endif
+      InitCommand(Command::DISP_INVERSION_ON),
+      InitCommand(Command::DISPLAY_ON).wait(25),
+  };
+
   ST7789(const DisplayConfig& cfg, CommandDataSpi& bus)
       : CommandDataDisplay(bus, cfg) {}
 
@@ -140,44 +161,33 @@ class ST7789 : public CommandDataDisplay {
   }
 
   void init() override {
-    CommandDataDisplay::init();
-
-    if (resetPort >= 0) {
-      gpio::write(resetPort, false);
-      sleep_ms(5);
-      gpio::write(resetPort, true);
-      sleep_ms(100);
-    }
+    beginInit();
+    finishInit();
+  }
 
-    writeCommand(Command::SOFTWARE_RESET);
-    sleep_ms(200);
+  void beginInit() override {
+    CommandDataDisplay::init();
 
-    writeCommand(Command::SLEEP_OUT);
-    sleep_ms(200);
+    clearInitSequence();
+    appendInitSequence(INIT_SEQ_RESET);
+    appendInitSequence(INIT_SEQ_WAKE);
 
     switch (format) {
       case PixelFormat::RGB444:
-        writeCommand(Command::INTERFACE_PIXEL_FORMAT, 0x53);
+        formatSeq[0] = InitCommand(Command::INTERFACE_PIXEL_FORMAT, 0x53);
+        appendInitSequence(formatSeq, 1);
         break;
       case PixelFormat::RGB565:
-        writeCommand(Command::INTERFACE_PIXEL_FORMAT, 0x55);
+        formatSeq[0] = InitCommand(Command::INTERFACE_PIXEL_FORMAT, 0x55);
+        appendInitSequence(formatSeq, 1);
         break;
       case PixelFormat::RGB666:
-        writeCommand(Command::INTERFACE_PIXEL_FORMAT, 0x56);
+        formatSeq[0] = InitCommand(Command::INTERFACE_PIXEL_FORMAT, 0x56);
+        appendInitSequence(formatSeq, 1);
         break;
     }
 
-    // #if 0
-    //     writeCommand(Command::MEMORY_ACCESS_CONTROL, 0x48);
-    // #else
-    //     // writeCommand(Command::MEMORY_ACCESS_CONTROL, 0xE8);
-    //     writeCommand(Command::MEMORY_ACCESS_CONTROL, 0x28);
-    // #endif
-
-    writeCommand(Command::DISP_INVERSION_ON);
-
-    writeCommand(Command::DISPLAY_ON);
-    sleep_ms(25);
+    appendInitSequence(INIT_SEQ_DISPLAY_ON);
   }
 
   void setWindow(int x, int y, int w, int h) override {
@@ -196,14 +206,19 @@ class ST7789 : public CommandDataDisplay {
     writeCommand(Command::PAGE_ADDRESS_SET, tmp, 4);
   }
 
-  void writePixels(const void* data, size_t length, int plane = 0) override {
-    bus.writeStart(true);
-    uint8_t cmd = static_cast<uint8_t>(Command::MEMORY_WRITE);
-    bus.writeBytes(&cmd, 1);
-    bus.writeStart(false);
-    bus.writeBytes(static_cast<const uint8_t*>(data), length);
-    bus.writeEnd();
+  void beginPixels(int plane = 0) override {
+    beginPixelsWithCommand(static_cast<uint8_t>(Command::MEMORY_WRITE));
+  }
+
+  // returned as RGB666 regardless of the pixel format, after a dummy byte
+  bool readPixels(int x, int y, int w, int h, void* data,
+                  size_t length) override {
+    return readPixelsRgb666(static_cast<uint8_t>(Command::MEMORY_READ), 8, x,
+                            y, w, h, data, length);
   }
+
+ private:
+  InitCommand formatSeq[2];
 };
 
 }  // namespace rawdisp
\ No newline at end of file
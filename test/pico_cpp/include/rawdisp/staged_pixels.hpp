@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/command_data_display.hpp"
+#include "rawdisp/display.hpp"
+
+namespace rawdisp {
+
+// Sends pixels produced into a staging buffer to the current window.
+// TFill is `size_t fill(uint8_t *dst, size_t capacity)`, returning the
+// number of bytes written, 0 once there is nothing left.
+template <size_t BUFF_SIZE, typename TFill>
+static inline void writeStagedPixels(Display &display, TFill &&fill,
+                                     int plane = 0) {
+  uint8_t buff[BUFF_SIZE];
+  display.beginPixels(plane);
+  size_t n;
+  while ((n = fill(buff, BUFF_SIZE)) > 0) {
+    display.pushPixels(buff, n);
+  }
+  display.endPixels();
+}
+
+// Same as above, but fills one half of the buffer while the bus sends the
+// other half, so producing the pixels is hidden behind the transfer.
+template <size_t BUFF_SIZE, typename TFill>
+static inline void writeStagedPixels(CommandDataDisplay &display,
+                                     TFill &&fill, int plane = 0) {
+  uint8_t buff[2][BUFF_SIZE];
+  int side = 0;
+  display.beginPixels(plane);
+  size_t n;
+  while ((n = fill(buff[side], BUFF_SIZE)) > 0) {
+    // writeBytesAsync() waits for the previous transfer
+    display.bus.writeBytesAsync(buff[side], n);
+    side ^= 1;
+  }
+  display.endPixels();
+}
+
+}  // namespace rawdisp
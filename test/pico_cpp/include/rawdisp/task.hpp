@@ -0,0 +1,227 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <coroutine>
+
+#include "rawdisp/timer.hpp"
+
+namespace rawdisp {
+
+// Coroutine for cooperative multitasking. A task can co_await a delay, a
+// condition or another task, and is driven by a Scheduler.
+class Task {
+ public:
+  struct promise_type;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  struct promise_type {
+    // the outermost task, which holds the wait condition
+    promise_type *root = this;
+    // innermost coroutine to resume (valid in root)
+    std::coroutine_handle<> leaf;
+    // task awaiting this one
+    std::coroutine_handle<> continuation;
+
+    uint64_t wakeUs = 0;
+    bool (*ready)(void *ctx) = nullptr;
+    void *readyCtx = nullptr;
+
+    Task get_return_object() { return Task(Handle::from_promise(*this)); }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    struct FinalAwaiter {
+      bool await_ready() noexcept { return false; }
+      std::coroutine_handle<> await_suspend(Handle h) noexcept {
+        promise_type &p = h.promise();
+        if (p.continuation) {
+          p.root->leaf = p.continuation;
+          return p.continuation;
+        }
+        return std::noop_coroutine();
+      }
+      void await_resume() noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() {}
+
+    inline void waitFor(std::coroutine_handle<> h, uint64_t us) {
+      root->leaf = h;
+      root->wakeUs = us;
+      root->ready = nullptr;
+    }
+
+    inline void waitFor(std::coroutine_handle<> h, bool (*fn)(void *),
+                        void *ctx) {
+      root->leaf = h;
+      root->ready = fn;
+      root->readyCtx = ctx;
+    }
+
+    inline bool runnable(uint64_t nowUs) const {
+      if (ready) return ready(readyCtx);
+      return (int64_t)(nowUs - wakeUs) >= 0;
+    }
+  };
+
+  Task() {}
+  explicit Task(Handle h) : handle(h) {}
+  Task(const Task &) = delete;
+  Task(Task &&other) : handle(other.handle) { other.handle = nullptr; }
+
+  Task &operator=(const Task &) = delete;
+  Task &operator=(Task &&other) {
+    if (this != &other) {
+      if (handle) handle.destroy();
+      handle = other.handle;
+      other.handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~Task() {
+    if (handle) handle.destroy();
+  }
+
+  inline bool valid() const { return (bool)handle; }
+  inline bool done() const { return !handle || handle.done(); }
+
+  // Runs the task until its next suspension point, use from a Scheduler.
+  void resume() {
+    if (done()) return;
+    promise_type &p = handle.promise();
+    std::coroutine_handle<> h = p.leaf ? p.leaf : handle;
+    h.resume();
+  }
+
+  inline bool runnable(uint64_t nowUs) const {
+    return !done() && handle.promise().runnable(nowUs);
+  }
+
+  inline uint64_t wakeUs() const { return handle.promise().wakeUs; }
+  inline bool waitingCondition() const {
+    return handle.promise().ready != nullptr;
+  }
+
+  // co_await of a child task runs it to completion within the parent
+  bool await_ready() const { return done(); }
+
+  std::coroutine_handle<> await_suspend(Handle parent) {
+    promise_type &child = handle.promise();
+    child.root = parent.promise().root;
+    child.continuation = parent;
+    child.root->leaf = handle;
+    child.root->ready = nullptr;
+    child.root->wakeUs = 0;
+    return handle;
+  }
+
+  void await_resume() {}
+
+ private:
+  Handle handle;
+};
+
+struct SleepAwaiter {
+  uint64_t wakeUs;
+
+  bool await_ready() const { return (int64_t)(timer::nowUs() - wakeUs) >= 0; }
+  void await_suspend(Task::Handle h) { h.promise().waitFor(h, wakeUs); }
+  void await_resume() {}
+};
+
+template <typename TPred>
+struct ConditionAwaiter {
+  TPred pred;
+
+  bool await_ready() { return pred(); }
+  void await_suspend(Task::Handle h) {
+    h.promise().waitFor(
+        h, [](void *ctx) { return (*static_cast<TPred *>(ctx))(); }, &pred);
+  }
+  void await_resume() {}
+};
+
+static inline SleepAwaiter sleepUntilUs(uint64_t us) { return {us}; }
+
+static inline SleepAwaiter sleepUs(uint64_t us) {
+  return {timer::nowUs() + us};
+}
+
+static inline SleepAwaiter sleepMs(uint32_t ms) {
+  return {timer::nowUs() + (uint64_t)ms * 1000};
+}
+
+// resumes once pred() returns true, e.g. a BUSY pin or a DMA channel
+template <typename TPred>
+static inline ConditionAwaiter<TPred> waitUntil(TPred pred) {
+  return {pred};
+}
+
+// resumes once an IRQ handler has set the flag
+static inline auto waitFlag(volatile bool &flag) {
+  return waitUntil([&flag]() { return (bool)flag; });
+}
+
+// Round-robin scheduler for Tasks, runs on a single core.
+class Scheduler {
+ public:
+  static constexpr int MAX_TASKS = 8;
+  // polling interval while tasks are waiting for conditions
+  uint32_t conditionPollUs = 50;
+
+  bool spawn(Task &&task) {
+    for (int i = 0; i < MAX_TASKS; i++) {
+      if (tasks[i].valid()) continue;
+      tasks[i] = static_cast<Task &&>(task);
+      return true;
+    }
+    return false;
+  }
+
+  // Resumes every task that can proceed. Returns the number of live tasks.
+  int step() {
+    int numAlive = 0;
+    for (int i = 0; i < MAX_TASKS; i++) {
+      Task &t = tasks[i];
+      if (!t.valid()) continue;
+      if (t.runnable(timer::nowUs())) t.resume();
+      if (t.done()) {
+        t = Task();
+      } else {
+        numAlive++;
+      }
+    }
+    return numAlive;
+  }
+
+  // Runs until all tasks have finished, sleeping while nothing can proceed.
+  void run() {
+    while (step() > 0) {
+      uint64_t now = timer::nowUs();
+      uint64_t nextUs = now + conditionPollUs;
+      bool runnable = false;
+      for (int i = 0; i < MAX_TASKS; i++) {
+        const Task &t = tasks[i];
+        if (!t.valid()) continue;
+        if (t.runnable(now)) {
+          runnable = true;
+          break;
+        }
+        if (!t.waitingCondition() && t.wakeUs() < nextUs) {
+          nextUs = t.wakeUs();
+        }
+      }
+      if (!runnable && nextUs > now) {
+        timer::sleepUs(nextUs - now);
+      }
+    }
+  }
+
+ private:
+  Task tasks[MAX_TASKS];
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rawdisp/pixel_format.hpp"
+
+namespace rawdisp {
+
+// Tile map generated with the tile option. The bank holds the unique
+// tiles of one plane stacked vertically, each tile row packed in the
+// layout of F. Map entries are 16-bit little endian: the tile index in
+// the low 14 bits, FLIP_H and FLIP_V on top. The tile size has to be a
+// multiple of PIXELS_PER_UNIT so that tile rows are whole units.
+template <PixelFormat F>
+class TileMap {
+  using Traits = PixelFormatTraits<F>;
+  static constexpr int PPU = Traits::PIXELS_PER_UNIT;
+  static constexpr int BPU = Traits::BYTES_PER_UNIT;
+
+ public:
+  static constexpr uint16_t FLIP_H = 0x4000;
+  static constexpr uint16_t FLIP_V = 0x8000;
+  static constexpr uint16_t INDEX_MASK = 0x3fff;
+
+  const uint8_t *const bank;
+  const uint8_t *const map;
+  const int tileSize;
+  const int cols;
+  const int rows;
+  const int numTiles;
+
+  TileMap(const uint8_t *bank, size_t bankSize, const uint8_t *map,
+          size_t mapSize, int tileSize, int cols, int rows)
+      : bank(bank),
+        map(map),
+        tileSize(tileSize),
+        cols(cols),
+        rows(rows),
+        numTiles(tileSize > 0 && tileSize % PPU == 0
+                     ? bankSize / ((size_t)tileSize * tileRowBytes(tileSize))
+                     : 0) {
+    isValid = numTiles > 0 && mapSize >= (size_t)cols * rows * 2 &&
+              checkEntries();
+  }
+
+  inline bool valid() const { return isValid; }
+  inline int width() const { return cols * tileSize; }
+  inline int height() const { return rows * tileSize; }
+
+  // bytes of one pixel row spanning `numCols` tiles
+  inline size_t rowBytes(int numCols) const {
+    return (size_t)numCols * tileRowBytes(tileSize);
+  }
+
+  inline uint16_t entry(int col, int row) const {
+    const uint8_t *p = map + ((size_t)row * cols + col) * 2;
+    return p[0] | (p[1] << 8);
+  }
+
+  // Composes pixel rows [y, y + h) of tile columns [col, col + numCols)
+  // into `dst`, rowBytes(numCols) bytes per row.
+  void renderRows(int col, int numCols, int y, int h, uint8_t *dst) const {
+    const size_t tileRow = tileRowBytes(tileSize);
+    for (int iy = y; iy < y + h; iy++) {
+      int row = iy / tileSize;
+      int ty = iy % tileSize;
+      for (int c = col; c < col + numCols; c++) {
+        uint16_t e = entry(c, row);
+        int sy = (e & FLIP_V) ? tileSize - 1 - ty : ty;
+        const uint8_t *src =
+            bank + ((size_t)(e & INDEX_MASK) * tileSize + sy) * tileRow;
+        if (e & FLIP_H) {
+          mirrorRow(src, dst);
+        } else {
+          memcpy(dst, src, tileRow);
+        }
+        dst += tileRow;
+      }
+    }
+  }
+
+ private:
+  bool isValid;
+
+  static constexpr size_t tileRowBytes(int tileSize) {
+    return (size_t)tileSize / PPU * BPU;
+  }
+
+  bool checkEntries() const {
+    for (int i = 0; i < cols * rows; i++) {
+      if ((entry(i % cols, i / cols) & INDEX_MASK) >= numTiles) return false;
+    }
+    return true;
+  }
+
+  // Copies one tile row with the pixel order reversed.
+  void mirrorRow(const uint8_t *src, uint8_t *dst) const {
+    const int numUnits = tileSize / PPU;
+    for (int i = 0; i < numUnits; i++) {
+      const uint8_t *s = src + (numUnits - 1 - i) * BPU;
+      uint8_t *d = dst + i * BPU;
+      if constexpr (PPU == 1) {
+        memcpy(d, s, BPU);
+      } else {
+        uint32_t pixels[PPU], reversed[PPU];
+        unpackUnit<F>(s, pixels);
+        for (int j = 0; j < PPU; j++) reversed[j] = pixels[PPU - 1 - j];
+        packUnit<F>(reversed, PPU, d);
+      }
+    }
+  }
+};
+
+}  // namespace rawdisp
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawdisp/staged_pixels.hpp"
+#include "rawdisp/tile_map.hpp"
+
+namespace rawdisp {
+
+// Draws tiles [col, col + numCols) x [row, row + numRows) of the map, the
+// map itself placed at (x, y). The tiles are composed into bands of
+// whole rows in a staging buffer, which is on the stack and doubled on a
+// CommandDataDisplay. Returns false if the map is invalid or one row
+// doesn't fit in the buffer, e.g. 240 RGB444 pixels need a BUFF_SIZE of
+// 360.
+template <size_t BUFF_SIZE = 256, typename TDisplay, PixelFormat F>
+static inline bool writeTiles(TDisplay &display, const TileMap<F> &tiles,
+                              int x, int y, int col, int row, int numCols,
+                              int numRows, int plane = 0) {
+  size_t rowBytes = tiles.rowBytes(numCols);
+  int bandRows = BUFF_SIZE / rowBytes;
+  if (!tiles.valid() || bandRows == 0) return false;
+
+  int n = tiles.tileSize;
+  int iy = row * n, bottom = (row + numRows) * n;
+  display.setWindow(x + col * n, y + iy, numCols * n, numRows * n);
+  writeStagedPixels<BUFF_SIZE>(
+      display,
+      [&](uint8_t *dst, size_t) -> size_t {
+        if (iy >= bottom) return 0;
+        int h = bottom - iy < bandRows ? bottom - iy : bandRows;
+        tiles.renderRows(col, numCols, iy, h, dst);
+        iy += h;
+        return rowBytes * h;
+      },
+      plane);
+  return true;
+}
+
+// Draws the whole map at (x, y).
+template <size_t BUFF_SIZE = 256, typename TDisplay, PixelFormat F>
+static inline bool writeTileMap(TDisplay &display, const TileMap<F> &tiles,
+                                int x, int y, int plane = 0) {
+  return writeTiles<BUFF_SIZE>(display, tiles, x, y, 0, 0, tiles.cols,
+                               tiles.rows, plane);
+}
+
+}  // namespace rawdisp
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+
+#if __has_include(<pico/time.h>)
+#include <pico/time.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+namespace rawdisp::timer {
+
+#if __has_include(<pico/time.h>)
+
+static inline uint64_t nowUs() { return time_us_64(); }
+
+static inline void sleepUs(uint64_t us) { sleep_us(us); }
+
+#else
+
+static inline uint64_t nowUs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static inline void sleepUs(uint64_t us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+#endif
+
+static inline uint32_t elapsedMs(uint64_t sinceUs) {
+  return (nowUs() - sinceUs) / 1000;
+}
+
+}  // namespace rawdisp::timer
@@ -7,9 +7,25 @@
 #include "lgfx/lgfx_ssd1306.hpp"
 #include "lgfx/lgfx_st7789.hpp"
 
+#include "rawdisp/alpha_blend.hpp"
+#include "rawdisp/asset_pixels.hpp"
+#include "rawdisp/asset_set.hpp"
+#include "rawdisp/blit_pixels.hpp"
+#include "rawdisp/boot_orchestrator.hpp"
+#include "rawdisp/compressed_pixels.hpp"
+#include "rawdisp/display_manager.hpp"
+#include "rawdisp/display_tasks.hpp"
+#include "rawdisp/dither.hpp"
+#include "rawdisp/frame_scheduler.hpp"
 #include "rawdisp/ili9488.hpp"
+#include "rawdisp/indexed_pixels.hpp"
 #include "rawdisp/ist7163.hpp"
 #include "rawdisp/jd79667aa.hpp"
+#include "rawdisp/lz77_decoder.hpp"
+#include "rawdisp/palette_lut.hpp"
+#include "rawdisp/pixel_pipeline.hpp"
+#include "rawdisp/pixel_stream.hpp"
+#include "rawdisp/rle_decoder.hpp"
 #include "rawdisp/ssd1306.hpp"
 #include "rawdisp/ssd1680.hpp"
 #include "rawdisp/st7789.hpp"
@@ -17,12 +33,15 @@
 #include "bmp/argb8888_le_240x240.hpp"
 #include "bmp/bw_hs_128x64.hpp"
 #include "bmp/bw_vs_128x64.hpp"
+#include "bmp/i4_240x240.hpp"
 #include "bmp/kwr_hs_152x296.hpp"
+#include "bmp/kwr_i2_152x296.hpp"
 #include "bmp/kwr_vs_296x152.hpp"
-#include "bmp/kwry_hs_240x416.hpp"
-#include "bmp/kwry_hs_184x384.hpp"
+#include "bmp/kwry_hs_set.hpp"
 #include "bmp/rgb111_480x320.hpp"
+#include "bmp/rgb111_480x320_rle.hpp"
 #include "bmp/rgb444_be_240x240.hpp"
+#include "bmp/rgb444_be_240x240_lz77.hpp"
 
 namespace raw = rawdisp;
 namespace gpio = raw::gpio;
@@ -33,6 +52,7 @@ static constexpr uint32_t SPI_FREQ_SSD1680 = 10000000;
 static constexpr uint32_t SPI_FREQ_FAST = 10000000;
 static constexpr int SPI_SCK_PORT = 18;
 static constexpr int SPI_MOSI_PORT = 19;
+static constexpr int SPI_MISO_PORT = 16;
 
 static constexpr uint32_t I2C_FREQ = 400000;
 static constexpr int I2C_SDA_PORT = 20;
@@ -42,12 +62,28 @@ static constexpr int BUTTON_PORT = 3;
 static constexpr int HEX_PORTS[] = {7, 5, 6, 4};
 static constexpr int LED_PORT = 25;
 
+static constexpr uint32_t EPD_IDLE_WINDOW_MS = 60000;
+
+// the e-paper panels share one connector
+static raw::CommandDataSpi epdSpi(spi0, 2, 8);
+// e-paper panel kept powered between updates, if any
+static raw::PowerManagedEpd *activeEpd = nullptr;
+
+void boot_all_panels();
 void test_ili9488_raw_rgb111();
 void test_st7789_raw_rgb444();
-// void test_st7789_lgfx_argb8888();
 void test_ssd1306_raw();
 void test_ssd1306_lgfx();
 void test_ssd1680_raw(int rotation);
+void test_tasks();
+void test_pipeline_rgb444();
+void test_display_manager();
+void test_frame_scheduler();
+void test_readback_overlay();
+void test_pixel_stream();
+void test_rle_rgb111();
+void test_lz77_rgb444();
+void test_indexed_rgb444();
 void test_ist7163_raw(int rotation);
 void test_jd79667aa_raw(int rotation);
 bool i2cBusReset();
@@ -55,8 +91,10 @@ bool i2cBusReset();
 int main(void) {
   set_sys_clock_khz(250000, true);
   sleep_ms(100);
-  // stdio_init_all();
-  // sleep_ms(500);
+  // the boot, task and pipeline reports go to USB stdio, give it time to
+  // enumerate
+  stdio_init_all();
+  sleep_ms(500);
 
   gpio_init(BUTTON_PORT);
   gpio_set_dir(BUTTON_PORT, false);
@@ -80,9 +118,6 @@ int main(void) {
   gpio_set_function(I2C_SCL_PORT, GPIO_FUNC_I2C);
   i2c_init(i2c0, I2C_FREQ);
 
-  // int shift = 0;
-  //  sprite7789.setBuffer((void*)imageArray240x240argb8888, 240, 240, 32);
-
   // sprite7789.setColorDepth(1);
   // sprite7789.setBuffer((void*)imageArrayBw, 240, 240, 1);
   // sprite7789.setBuffer((void*)imageArrayGray2, 240, 240, 2);
@@ -93,9 +128,7 @@ int main(void) {
   //  sprite7789.setBuffer((void*)imageArrayRgb666, 240, 240, 18);
   //  sprite7789.setBuffer((void*)imageArrayRgb888, 240, 240, 24);
 
-  test_ssd1306_raw();
-  test_st7789_raw_rgb444();
-  test_ili9488_raw_rgb111();
+  boot_all_panels();
 
   while (true) {
     int hex = 0;
@@ -124,6 +157,42 @@ int main(void) {
         test_ili9488_raw_rgb111();
         break;
 
+      case 4:
+        test_tasks();
+        break;
+
+      case 5:
+        test_pipeline_rgb444();
+        break;
+
+      case 6:
+        test_display_manager();
+        break;
+
+      case 7:
+        test_frame_scheduler();
+        break;
+
+      case 8:
+        test_readback_overlay();
+        break;
+
+      case 9:
+        test_pixel_stream();
+        break;
+
+      case 10:
+        test_rle_rgb111();
+        break;
+
+      case 11:
+        test_lz77_rgb444();
+        break;
+
+      case 12:
+        test_indexed_rgb444();
+        break;
+
       case 13:
         //test_ist7163_raw(0);
         test_jd79667aa_raw(0);
@@ -145,86 +214,139 @@ int main(void) {
     gpio_put(LED_PORT, false);
 
     while (gpio_get(BUTTON_PORT) == true) {
+      if (activeEpd) activeEpd->service();
       sleep_ms(10);
     }
     while (gpio_get(BUTTON_PORT) == false) {
       sleep_ms(10);
     }
-
-    // for (int y = 0; y < 240 + 32; y += 16) {
-    //   for (int x = 0; x < 240 + 32; x += 16) {
-    //     int i = (y / 16) + (x / 16);
-    //     fbuf7789.fillRect(x - shift, y - shift, 16, 16,
-    //                       (i & 1) ? 0xFFFF : 0xC618);
-    //   }
-    // }
-    // fbuf7789.pushAlphaImage(0, 0, 240, 240, (argb8888_t *)argb8888Le240x240);
-    // fbuf7789.pushSprite(0, 0);
   }
 }
 
+static constexpr raw::DisplayConfig CFG_ILI9488 = {
+    .width = 480,
+    .height = 320,
+    .format = raw::PixelFormat::RGB111,
+    .resetPort = 13,
+};
+
+static constexpr raw::DisplayConfig CFG_ST7789 = {
+    .width = 480,
+    .height = 320,
+    .format = raw::PixelFormat::RGB444,
+    .resetPort = 14,
+};
+
+static constexpr raw::DisplayConfig CFG_SSD1306 = {
+    .width = 128,
+    .height = 64,
+    .format = raw::PixelFormat::BW,
+    .resetPort = -1,
+};
+
+void draw_ili9488_rgb111(raw::ILI9488 &raw9488) {
+  raw::writeAsset<CFG_ILI9488, rgb111_480x320_desc>(raw9488, 0, 0);
+
+  // prevent issue of 8-color mode
+  // https://blog.shapoco.net/2025/0901-ili9488-8color-wired-behavior/
+  raw9488.writeCommand(raw::ILI9488::Command::INTERFACE_PIXEL_FORMAT, 0x56);
+}
+
+void draw_st7789_rgb444(raw::ST7789 &raw7789) {
+  raw::writeAsset<CFG_ST7789, rgb444_be_240x240_desc>(raw7789, 0, 0);
+}
+
+void draw_ssd1306(raw::SSD1306 &display) {
+  raw::writeAsset<CFG_SSD1306, bw_vs_128x64_desc>(display, 0, 0);
+}
+
+// Brings up all panels concurrently, time to first image is that of the
+// slowest panel instead of the sum of all resets and sleeps.
+void boot_all_panels() {
+  raw::CommandDataSpi spi9488(spi0, 12, 15);
+  raw::ILI9488 raw9488(CFG_ILI9488, spi9488);
+  raw::CommandDataSpi spi7789(spi0, 17, 15);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+  raw::CommandDataI2c i2c(i2c0, 0x3C);
+  raw::SSD1306 raw1306(CFG_SSD1306, i2c, 2);
+
+  spi9488.init();
+  spi7789.init();
+  i2c.init();
+
+  raw::BootOrchestrator boot;
+  boot.add("ST7789", raw7789, [](raw::CommandDataDisplay &d) {
+    draw_st7789_rgb444(static_cast<raw::ST7789 &>(d));
+  });
+  boot.add("ILI9488", raw9488, [](raw::CommandDataDisplay &d) {
+    draw_ili9488_rgb111(static_cast<raw::ILI9488 &>(d));
+  });
+  // blocking init, runs while the SPI panels are in reset
+  boot.add("SSD1306", raw1306, [](raw::CommandDataDisplay &d) {
+    draw_ssd1306(static_cast<raw::SSD1306 &>(d));
+  });
+  boot.run();
+  boot.printReport();
+}
+
 void test_ili9488_raw_rgb111() {
-  raw::DisplayConfig cfg9488 = {
-      .width = 480,
-      .height = 320,
-      .format = raw::PixelFormat::RGB111,
-      .resetPort = 13,
-  };
   raw::CommandDataSpi spi9488(spi0, 12, 15);
-  raw::ILI9488 raw9488(cfg9488, spi9488);
+  raw::ILI9488 raw9488(CFG_ILI9488, spi9488);
 
   spi9488.init();
   raw9488.init();
+  draw_ili9488_rgb111(raw9488);
+}
 
-  raw9488.setWindow(0, 0, raw9488.width, raw9488.height);
-  raw9488.writePixels((uint8_t *)rgb111_480x320, sizeof(rgb111_480x320));
-
-  // prevent issue of 8-color mode
-  // https://blog.shapoco.net/2025/0901-ili9488-8color-wired-behavior/
-  raw9488.writeCommand(raw::ILI9488::Command::INTERFACE_PIXEL_FORMAT, 0x56);
+// ARGB8888 image over a checkerboard, composed a band of rows at a time
+void draw_st7789_alpha(raw::ST7789 &raw7789) {
+  constexpr raw::PixelFormat FMT = raw::PixelFormat::RGB444;
+  constexpr int W = 240, H = 240, BAND = 8;
+  constexpr size_t ROW_BYTES = raw::bytesForPixels<FMT>(W);
+  static uint8_t band[ROW_BYTES * BAND];
+  raw7789.setWindow(0, 0, W, H);
+  raw7789.beginPixels();
+  for (int y = 0; y < H; y += BAND) {
+    for (int iy = 0; iy < BAND; iy++) {
+      uint8_t *row = band + ROW_BYTES * iy;
+      for (int x = 0; x < W; x += 2) {
+        uint32_t c = ((x / 16 + (y + iy) / 16) & 1)
+                         ? raw::packRgb<FMT>(255, 255, 255)
+                         : raw::packRgb<FMT>(192, 192, 192);
+        uint32_t unit[2] = {c, c};
+        raw::packUnit<FMT>(unit, 2, row + x / 2 * 3);
+      }
+      raw::blendArgb8888<FMT>(argb8888Le240x240 + (y + iy) * W * 4, row, W);
+    }
+    raw7789.pushPixels(band, sizeof(band));
+  }
+  raw7789.endPixels();
 }
 
 void test_st7789_raw_rgb444() {
-  raw::DisplayConfig cfg7789 = {
-      .width = 480,
-      .height = 320,
-      .format = raw::PixelFormat::RGB444,
-      .resetPort = 14,
-  };
   raw::CommandDataSpi spi7789(spi0, 17, 15);
-  raw::ST7789 raw7789(cfg7789, spi7789);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
 
   spi7789.init();
   raw7789.init();
-  raw7789.setWindow(0, 0, raw7789.width, raw7789.height);
-  raw7789.writePixels((uint8_t *)rgb444_be_240x240, sizeof(rgb444_be_240x240));
-}
+  draw_st7789_rgb444(raw7789);
 
-// void test_st7789_lgfx_argb8888() {
-//   LGFX_ST7789 lgfx7789(240, 240, 0);
-//   LGFX_Sprite fbuf7789(&lgfx7789);
-//   LGFX_Sprite sprite7789(&fbuf7789);
-//   lgfx7789.begin();
-//   fbuf7789.setColorDepth(16);
-//   fbuf7789.createSprite(lgfx7789.width(), lgfx7789.height());
-//   sprite7789.setColorDepth(32);
-//     sprite7789.setBuffer((void*)imageArray240x240argb8888, 240, 240, 32);
-// }
+  // slide the image in from the left, only the visible columns are sent
+  for (int x = -raw7789.width; x <= 0; x += 5) {
+    raw::blitAsset(raw7789, rgb444_be_240x240_desc, x, 0);
+  }
+
+  sleep_ms(1000);
+  draw_st7789_alpha(raw7789);
+}
 
 void test_ssd1306_raw() {
-  raw::DisplayConfig cfg = {
-      .width = 128,
-      .height = 64,
-      .format = raw::PixelFormat::BW,
-      .resetPort = -1,
-  };
   raw::CommandDataI2c i2c(i2c0, 0x3C);
-  raw::SSD1306 display(cfg, i2c, 2);
+  raw::SSD1306 display(CFG_SSD1306, i2c, 2);
 
   i2c.init();
   display.init();
-  display.setWindow(0, 0, display.width, display.height);
-  display.writePixels((uint8_t *)bw_vs_128x64, sizeof(bw_vs_128x64));
+  draw_ssd1306(display);
 }
 
 void test_ssd1306_lgfx() {
@@ -242,6 +364,67 @@ void test_ssd1306_lgfx() {
   lgfx1306.print("LGFX");
 }
 
+// Graph drawn at run time over a white to red gradient, dithered to the
+// Indexed2 layout of writeIndexed2() row by row.
+void draw_ssd1680_graph(raw::SSD1680 &raw1680, int y0, int h) {
+  static constexpr uint8_t KWR[] = {0x00, 0x00, 0x00, 0xFF, 0xFF,
+                                    0xFF, 0xCC, 0x00, 0x00};
+  constexpr int W = 152;
+  constexpr int ROW_BYTES = W / 4;
+  static uint8_t band[ROW_BYTES * 64];
+  if (h > 64) h = 64;
+  // static to keep the error rows off the stack
+  static raw::Ditherer<W> dither(KWR, 3, W);
+  static uint8_t rgb[W * 3];
+  dither.reset();
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < W; x++) {
+      float curve = h / 2 + sinf(x * 0.08f) * (h / 2 - 4);
+      bool line = fabsf(y - curve) < 1.5f;
+      rgb[x * 3 + 0] = line ? 0 : 255 - x * 51 / W;
+      rgb[x * 3 + 1] = line ? 0 : 255 - x * 255 / W;
+      rgb[x * 3 + 2] = line ? 0 : 255 - x * 255 / W;
+    }
+    dither.ditherRow<2>(rgb, band + ROW_BYTES * y);
+  }
+  raw1680.setWindow(0, y0, W, h);
+  raw1680.writeIndexed2(band, ROW_BYTES * h);
+}
+
+// RGB565 bands drawn at run time, converted to Indexed2 with a LUT built
+// at boot time, one lookup per pixel.
+void draw_ssd1680_rgb565(raw::SSD1680 &raw1680, int y0, int h) {
+  static constexpr uint8_t KWR[] = {0x00, 0x00, 0x00, 0xFF, 0xFF,
+                                    0xFF, 0xCC, 0x00, 0x00};
+  using Lut = raw::Rgb565PaletteLut<4>;
+  constexpr int W = 152;
+  constexpr int ROW_BYTES = W / 4;
+  static uint8_t table[Lut::SIZE];
+  static uint8_t band[ROW_BYTES * 64];
+  if (h > 64) h = 64;
+  Lut::build(KWR, 3, table);
+  Lut lut(table);
+  static uint8_t fb[W * 2];
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < W; x++) {
+      // black to red, black to white and a darker gray ramp
+      int v = x * 255 / W;
+      int r = v, g = 0, b = 0;
+      if (y * 3 >= h * 2) {
+        r = g = b = v / 2;
+      } else if (y * 3 >= h) {
+        g = b = v;
+      }
+      uint16_t c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+      fb[x * 2] = c >> 8;
+      fb[x * 2 + 1] = c;
+    }
+    lut.quantize<2>(fb, W, band + ROW_BYTES * y);
+  }
+  raw1680.setWindow(0, y0, W, h);
+  raw1680.writeIndexed2(band, ROW_BYTES * h);
+}
+
 void test_ssd1680_raw(int rotation) {
   raw::DisplayConfig cfg1680 = {
       .width = 152,
@@ -255,12 +438,10 @@ void test_ssd1680_raw(int rotation) {
   raw1680.init();
   raw1680.setWindow(0, 0, raw1680.width, raw1680.height);
   if ((rotation & 1) == 0) {
-    raw1680.writePixels((uint8_t *)kwr_hs_152x296_white,
-                        sizeof(kwr_hs_152x296_white),
-                        raw::SSD1680::Plane::PLANE_WHITE);
-    raw1680.writePixels((uint8_t *)kwr_hs_152x296_red,
-                        sizeof(kwr_hs_152x296_red),
-                        raw::SSD1680::Plane::PLANE_RED);
+    // both RAMs from one Indexed2 array
+    raw1680.writeIndexed2(kwr_i2_152x296, sizeof(kwr_i2_152x296));
+    draw_ssd1680_graph(raw1680, raw1680.height - 48, 48);
+    draw_ssd1680_rgb565(raw1680, raw1680.height - 96, 48);
   } else {
     raw1680.writePixels((uint8_t *)kwr_vs_296x152_white,
                         sizeof(kwr_vs_296x152_white),
@@ -273,38 +454,331 @@ void test_ssd1680_raw(int rotation) {
   raw1680.waitBusy();
 }
 
+static raw::Task blink_led_task(const bool &stop) {
+  bool on = false;
+  while (!stop) {
+    on = !on;
+    gpio_put(LED_PORT, on);
+    co_await raw::sleepMs(100);
+  }
+  gpio_put(LED_PORT, true);
+}
+
+static raw::Task ssd1680_task(raw::SSD1680 &display, bool &done) {
+  co_await raw::initTask(display);
+  display.setWindow(0, 0, display.width, display.height);
+  display.writePixels((uint8_t *)kwr_hs_152x296_white,
+                      sizeof(kwr_hs_152x296_white),
+                      raw::SSD1680::Plane::PLANE_WHITE);
+  display.writePixels((uint8_t *)kwr_hs_152x296_red,
+                      sizeof(kwr_hs_152x296_red),
+                      raw::SSD1680::Plane::PLANE_RED);
+  co_await raw::refreshTask(display);
+  done = true;
+}
+
+static raw::Task st7789_task(raw::ST7789 &display) {
+  co_await raw::initTask(display);
+  draw_st7789_rgb444(display);
+}
+
+// Refreshes the e-paper while the TFT boots and the LED keeps blinking, all
+// on a single core.
+void test_tasks() {
+  raw::DisplayConfig cfg1680 = {
+      .width = 152,
+      .height = 296,
+      .format = raw::PixelFormat::KR11,
+      .resetPort = 10,
+  };
+  raw::CommandDataSpi spi1680(spi0, 9, 8);
+  raw::SSD1680 raw1680(cfg1680, spi1680, 11, 0);
+  raw::CommandDataSpi spi7789(spi0, 17, 15);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+  spi1680.init();
+  spi7789.init();
+
+  bool epdDone = false;
+  uint64_t t0 = raw::timer::nowUs();
+  raw::Scheduler sched;
+  sched.spawn(ssd1680_task(raw1680, epdDone));
+  sched.spawn(st7789_task(raw7789));
+  sched.spawn(blink_led_task(epdDone));
+  sched.run();
+  printf("tasks: %u ms\n", (unsigned)raw::timer::elapsedMs(t0));
+}
+
+struct InvertSource {
+  const uint8_t *data;
+  size_t size;
+  size_t offset;
+};
+
+// runs on core 1: inverts the image while core 0 sends the previous chunk
+static size_t produce_inverted(void *ctx, uint8_t *buf, size_t capacity) {
+  InvertSource *src = static_cast<InvertSource *>(ctx);
+  size_t n = src->size - src->offset;
+  if (n > capacity) n = capacity;
+  for (size_t i = 0; i < n; i++) {
+    buf[i] = ~src->data[src->offset + i];
+  }
+  src->offset += n;
+  return n;
+}
+
+void test_pipeline_rgb444() {
+  static raw::PixelPipeline<2048, 4> pipeline;
+  raw::CommandDataSpi spi7789(spi0, 17, 15);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+
+  spi7789.init();
+  raw7789.init();
+  raw7789.setWindow(0, 0, raw7789.width, raw7789.height);
+
+  InvertSource src = {(const uint8_t *)rgb444_be_240x240,
+                      sizeof(rgb444_be_240x240), 0};
+  pipeline.run(raw7789, produce_inverted, &src);
+  pipeline.stats.print("pipeline");
+}
+
+// Updates all panels at once, the SSD1306 is sent in small slices between
+// the DMA transfers of the TFTs.
+void test_display_manager() {
+  raw::CommandDataSpi spi9488(spi0, 12, 15);
+  raw::ILI9488 raw9488(CFG_ILI9488, spi9488);
+  raw::CommandDataSpi spi7789(spi0, 17, 15);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+  raw::CommandDataI2c i2c(i2c0, 0x3C);
+  raw::SSD1306 raw1306(CFG_SSD1306, i2c, 2);
+
+  spi9488.init();
+  spi7789.init();
+  i2c.init();
+  raw9488.init();
+  raw7789.init();
+  raw1306.init();
+
+  raw::DisplayManager mgr;
+  int id9488 = mgr.add("ILI9488", raw9488, 2);
+  int id7789 = mgr.add("ST7789", raw7789, 1);
+  int id1306 = mgr.add("SSD1306", raw1306, 0, 32);
+  mgr.submit(id9488, 0, 0, raw9488.width, raw9488.height, rgb111_480x320,
+             sizeof(rgb111_480x320));
+  mgr.submit(id7789, 0, 0, raw7789.width, raw7789.height, rgb444_be_240x240,
+             sizeof(rgb444_be_240x240));
+  mgr.submit(id1306, 0, 0, raw1306.width, raw1306.height, bw_vs_128x64,
+             sizeof(bw_vs_128x64));
+  mgr.run();
+  raw9488.writeCommand(raw::ILI9488::Command::INTERFACE_PIXEL_FORMAT, 0x56);
+  mgr.printReport();
+}
+
+struct BouncingBox {
+  static constexpr int MARGIN = 4;
+  static constexpr int SIZE = 64;
+  static constexpr int W = SIZE + MARGIN * 2;
+  raw::ST7789 *display;
+  int x;
+  int y;
+  uint8_t pixels[W * SIZE * 3 / 2];
+};
+
+// fills the box and its black margins
+static void render_box(void *ctx, uint32_t frame) {
+  constexpr raw::PixelFormat FMT = raw::PixelFormat::RGB444;
+  using Traits = raw::PixelFormatTraits<FMT>;
+  BouncingBox *box = static_cast<BouncingBox *>(ctx);
+  int range = box->display->width - BouncingBox::W;
+  int pos = (frame * BouncingBox::MARGIN) % (range * 2);
+  box->x = pos < range ? pos : range * 2 - pos;
+  box->y = (box->display->height - BouncingBox::SIZE) / 2;
+
+  uint32_t color = ((frame / 4) * 0x123) & 0xFFF;
+  uint8_t *p = box->pixels;
+  for (int y = 0; y < BouncingBox::SIZE; y++) {
+    for (int x = 0; x < BouncingBox::W; x += Traits::PIXELS_PER_UNIT) {
+      uint32_t unit[Traits::PIXELS_PER_UNIT];
+      for (int i = 0; i < Traits::PIXELS_PER_UNIT; i++) {
+        bool inside = BouncingBox::MARGIN <= x + i &&
+                      x + i < BouncingBox::MARGIN + BouncingBox::SIZE;
+        unit[i] = inside ? color : 0;
+      }
+      p += raw::packUnit<FMT>(unit, Traits::PIXELS_PER_UNIT, p);
+    }
+  }
+}
+
+static void transfer_box(void *ctx) {
+  BouncingBox *box = static_cast<BouncingBox *>(ctx);
+  box->display->setWindow(box->x, box->y, BouncingBox::W, BouncingBox::SIZE);
+  box->display->writePixels(box->pixels, sizeof(box->pixels));
+}
+
+void test_frame_scheduler() {
+  static BouncingBox box;
+  raw::CommandDataSpi spi7789(spi0, 17, 15);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+
+  spi7789.init();
+  raw7789.init();
+  draw_st7789_rgb444(raw7789);
+
+  box.display = &raw7789;
+  raw::FrameScheduler sched(60);
+  sched.run(600, render_box, transfer_box, &box);
+  sched.stats.print("ST7789 60fps");
+}
+
+// Darkens a box on top of what is on the screen by reading it back,
+// without a framebuffer.
+void test_readback_overlay() {
+  constexpr int BOX_W = 64;
+  constexpr int BOX_H = 32;
+  static uint8_t buff[BOX_W * BOX_H * 3 / 2];
+  raw::CommandDataSpi spi7789(spi0, 17, 15, SPI_MISO_PORT);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+
+  spi7789.init();
+  raw7789.init();
+  draw_st7789_rgb444(raw7789);
+
+  int x = 88, y = 104;
+  if (!raw7789.readPixels(x, y, BOX_W, BOX_H, buff, sizeof(buff))) {
+    printf("readback not supported\n");
+    return;
+  }
+  for (size_t i = 0; i < sizeof(buff); i++) {
+    // halves both RGB444 nibbles at once
+    buff[i] = (buff[i] >> 1) & 0x77;
+  }
+  raw7789.setWindow(x, y, BOX_W, BOX_H);
+  raw7789.writePixels(buff, sizeof(buff));
+}
+
+// Generates a full screen pattern through a 64 byte staging buffer.
+void test_pixel_stream() {
+  raw::CommandDataSpi spi9488(spi0, 12, 15);
+  raw::ILI9488 raw9488(CFG_ILI9488, spi9488);
+
+  spi9488.init();
+  raw9488.init();
+  {
+    raw::PixelStream<raw::PixelFormat::RGB111, 64> stream(
+        raw9488, 0, 0, raw9488.width, raw9488.height);
+    for (int y = 0; y < raw9488.height; y++) {
+      for (int x = 0; x < raw9488.width; x++) {
+        stream.push(((x / 40) + (y / 40) * 3) & 7);
+      }
+    }
+  }
+  raw9488.writeCommand(raw::ILI9488::Command::INTERFACE_PIXEL_FORMAT, 0x56);
+}
+
+void test_rle_rgb111() {
+  static_assert(
+      raw::ILI9488::isNativeAsset(CFG_ILI9488, rgb111_480x320_rle_desc));
+  raw::CommandDataSpi spi9488(spi0, 12, 15);
+  raw::ILI9488 raw9488(CFG_ILI9488, spi9488);
+
+  spi9488.init();
+  raw9488.init();
+
+  raw::RleDecoder decoder(rgb111_480x320_rle, sizeof(rgb111_480x320_rle));
+  if (!decoder.valid()) return;
+  uint64_t t0 = raw::timer::nowUs();
+  raw9488.setWindow(0, 0, raw9488.width, raw9488.height);
+  raw::writeDecodedPixels(raw9488, decoder);
+  printf("RLE: %u -> %u bytes in %llu us\n",
+         (unsigned)sizeof(rgb111_480x320_rle),
+         (unsigned)decoder.originalSize(),
+         (unsigned long long)(raw::timer::nowUs() - t0));
+  raw9488.writeCommand(raw::ILI9488::Command::INTERFACE_PIXEL_FORMAT, 0x56);
+}
+
+void test_lz77_rgb444() {
+  static_assert(
+      raw::ST7789::isNativeAsset(CFG_ST7789, rgb444_be_240x240_lz77_desc));
+  // static to keep the 4 KB window off the stack
+  static raw::Lz77Decoder<4096> decoder(rgb444_be_240x240_lz77,
+                                        sizeof(rgb444_be_240x240_lz77));
+  raw::CommandDataSpi spi7789(spi0, 17, 15);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+
+  spi7789.init();
+  raw7789.init();
+
+  decoder.rewind();
+  if (!decoder.valid()) return;
+  uint64_t t0 = raw::timer::nowUs();
+  raw7789.setWindow(0, 0, rgb444_be_240x240_lz77_desc.width,
+                    rgb444_be_240x240_lz77_desc.height);
+  raw::writeDecodedPixels(raw7789, decoder);
+  printf("LZ77: %u -> %u bytes in %llu us\n",
+         (unsigned)sizeof(rgb444_be_240x240_lz77),
+         (unsigned)decoder.originalSize(),
+         (unsigned long long)(raw::timer::nowUs() - t0));
+}
+
+void test_indexed_rgb444() {
+  static const raw::PaletteExpander<raw::PixelFormat::RGB444, 4> expander(
+      i4_240x240_desc.palette, i4_240x240_desc.paletteColors);
+  raw::CommandDataSpi spi7789(spi0, 17, 15);
+  raw::ST7789 raw7789(CFG_ST7789, spi7789);
+
+  spi7789.init();
+  raw7789.init();
+
+  uint64_t t0 = raw::timer::nowUs();
+  raw7789.setWindow(0, 0, i4_240x240_desc.width, i4_240x240_desc.height);
+  raw::writeIndexedPixels(raw7789, expander, i4_240x240, sizeof(i4_240x240));
+  printf("Indexed4: %u -> %u bytes in %llu us\n",
+         (unsigned)sizeof(i4_240x240),
+         (unsigned)expander.dstBytesFor(sizeof(i4_240x240)),
+         (unsigned long long)(raw::timer::nowUs() - t0));
+}
+
 void test_ist7163_raw(int rotation) {
-  raw::DisplayConfig cfg = {
+  static constexpr raw::DisplayConfig cfg = {
       .width = 240,
       .height = 416,
       .format = raw::PixelFormat::KR11,
       .resetPort = 22,
   };
-  raw::CommandDataSpi spi(spi0, 2, 8);
-  raw::IST7163 ist7163(cfg, spi, 1, 0, rotation);
-  spi.init();
+  static raw::IST7163 ist7163(cfg, epdSpi, 1, 0, rotation);
+  if (activeEpd && activeEpd != &ist7163) activeEpd->powerOff();
+  activeEpd = &ist7163;
+  ist7163.rotation = rotation;
+  ist7163.idleWindowMs = EPD_IDLE_WINDOW_MS;
+  epdSpi.init();
   ist7163.init();
-  ist7163.writePixels((uint8_t *)kwry_hs_240x416, sizeof(kwry_hs_240x416));
+  // the level is chosen from the set at compile time, *asset doesn't
+  // compile if none fits
+  static constexpr const raw::AssetDesc *asset =
+      raw::pickAsset<raw::IST7163>(kwry_hs_set, cfg);
+  raw::writeAsset<cfg, *asset>(ist7163, 0, 0);
   ist7163.startUpdateDisplay();
-  ist7163.waitBusy(); 
-  ist7163.powerOff();
+  ist7163.waitBusy();
 }
 
 void test_jd79667aa_raw(int rotation) {
-  raw::DisplayConfig cfg = {
+  static constexpr raw::DisplayConfig cfg = {
       .width = 184,
       .height = 384,
       .format = raw::PixelFormat::KR11,
       .resetPort = 22,
   };
-  raw::CommandDataSpi spi(spi0, 2, 8);
-  raw::JD79667AA jd79667aa(cfg, spi, 1, 0, rotation);
-  spi.init();
+  static raw::JD79667AA jd79667aa(cfg, epdSpi, 1, 0, rotation);
+  if (activeEpd && activeEpd != &jd79667aa) activeEpd->powerOff();
+  activeEpd = &jd79667aa;
+  jd79667aa.rotation = rotation;
+  jd79667aa.idleWindowMs = EPD_IDLE_WINDOW_MS;
+  epdSpi.init();
   jd79667aa.init();
-  jd79667aa.writePixels((uint8_t *)kwry_hs_184x384, sizeof(kwry_hs_184x384));
+  static constexpr const raw::AssetDesc *asset =
+      raw::pickAsset<raw::JD79667AA>(kwry_hs_set, cfg);
+  raw::writeAsset<cfg, *asset>(jd79667aa, 0, 0);
   jd79667aa.startUpdateDisplay();
-  jd79667aa.waitBusy(); 
-  jd79667aa.powerOff();
+  jd79667aa.waitBusy();
 }
 
 bool i2cBusReset() {